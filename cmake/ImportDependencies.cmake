@@ -17,6 +17,11 @@ SET(VCPKG_MANIFEST_DIR "${CMAKE_SOURCE_DIR}/vcpkg")
 option(USE_LOCAL_MLIR "Does not build llvm and mlir via vcpkg, rather uses a locally installed version" OFF)
 option(USE_LIBCXX_IF_AVAILABLE "Use Libc++ if supported by the system" ON)
 option(NES_USE_SYSTEM_DEPS "Rely on externally provided dependencies instead of bootstrapping vcpkg" OFF)
+option(NES_ENABLE_ARROW_SOURCES "Builds the Arrow IPC and Parquet sources and sinks, which requires building Apache Arrow via vcpkg" OFF)
+option(NES_ENABLE_KAFKA_PLUGINS "Builds the Kafka source and sink, which requires building librdkafka via vcpkg" OFF)
+option(NES_ENABLE_NETWORK_COMPRESSION "Builds the lz4 compression of the network source and sink, which requires building lz4 via vcpkg" OFF)
+option(NES_ENABLE_BUFFER_COMPRESSION "Builds the lz4 compression of the buffers queued between pipelines, which requires building lz4 via vcpkg" OFF)
+option(NES_ENABLE_BENCHMARKS "Builds the Google Benchmark microbenchmarks of the components" OFF)
 
 set(NES_SKIP_VCPKG OFF)
 if (NOT DEFINED CMAKE_TOOLCHAIN_FILE
@@ -117,6 +122,31 @@ else ()
     list(APPEND VCPKG_ENV_PASSTHROUGH "MLIR_DIR")
 endif ()
 
+if (NES_ENABLE_ARROW_SOURCES)
+    message(STATUS "Enabling Arrow feature for the VPCKG install")
+    list(APPEND VCPKG_MANIFEST_FEATURES "arrow")
+endif ()
+
+if (NES_ENABLE_KAFKA_PLUGINS)
+    message(STATUS "Enabling Kafka feature for the VPCKG install")
+    list(APPEND VCPKG_MANIFEST_FEATURES "kafka")
+endif ()
+
+if (NES_ENABLE_NETWORK_COMPRESSION)
+    message(STATUS "Enabling network compression feature for the VPCKG install")
+    list(APPEND VCPKG_MANIFEST_FEATURES "network-compression")
+endif ()
+
+if (NES_ENABLE_BUFFER_COMPRESSION)
+    message(STATUS "Enabling buffer compression feature for the VPCKG install")
+    list(APPEND VCPKG_MANIFEST_FEATURES "buffer-compression")
+endif ()
+
+if (NES_ENABLE_BENCHMARKS)
+    message(STATUS "Enabling benchmarks feature for the VPCKG install")
+    list(APPEND VCPKG_MANIFEST_FEATURES "benchmarks")
+endif ()
+
 if (NOT NES_SKIP_VCPKG)
     SET(VCPKG_STDLIB "libcxx")
     if (NOT USE_LIBCXX_IF_AVAILABLE)
@@ -94,3 +94,25 @@ macro(add_tests_if_enabled TEST_FOLDER_NAME)
         add_subdirectory(${TEST_FOLDER_NAME})
     endif ()
 endmacro()
+
+macro(add_benchmarks_if_enabled BENCHMARK_FOLDER_NAME)
+    if (NES_ENABLE_BENCHMARKS)
+        add_subdirectory(${BENCHMARK_FOLDER_NAME})
+    endif ()
+endmacro()
+
+# Adds a Google Benchmark executable and a run-<target> target, which writes the results as json to
+# NES_BENCHMARK_RESULTS_DIR/<target>.json. The results of two commits can be compared via tools/compare.py of Google Benchmark.
+# The run_benchmarks target runs all benchmarks one after another, as concurrent benchmarks would disturb each other.
+function(add_nes_benchmark TARGET_NAME)
+    add_executable(${TARGET_NAME} ${ARGN})
+    target_link_libraries(${TARGET_NAME} PRIVATE benchmark::benchmark)
+    add_dependencies(benchmarks ${TARGET_NAME})
+    add_custom_target(run-${TARGET_NAME}
+            COMMAND ${TARGET_NAME} --benchmark_out=${NES_BENCHMARK_RESULTS_DIR}/${TARGET_NAME}.json --benchmark_out_format=json
+            ${NES_BENCHMARK_ARGS}
+            DEPENDS ${TARGET_NAME}
+            USES_TERMINAL
+            COMMENT "Running ${TARGET_NAME}")
+    add_dependencies(run_benchmarks run-${TARGET_NAME})
+endfunction()
@@ -0,0 +1,89 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
+#include <Sequencing/NonBlockingMonotonicSeqQueue.hpp>
+#include <Sequencing/SequenceData.hpp>
+#include <benchmark/benchmark.h>
+
+/// This Benchmark measures the throughput of completing sequence numbers in the watermark processing of many origins, i.e., one
+/// NonBlockingMonotonicSeqQueue and its ChunkCollector per origin, as the MultiOriginWatermarkProcessor does.
+/// All threads complete the sequence numbers of all origins round-robin, thus multiple threads complete chunks of the same origin at the
+/// same time. The first argument is the number of origins, the second the number of chunks per sequence number.
+
+namespace
+{
+struct Origin
+{
+    NES::Sequencing::NonBlockingMonotonicSeqQueue<uint64_t> queue;
+    std::atomic<NES::SequenceNumber::Underlying> nextSequenceNumber{NES::SequenceNumber::INITIAL};
+};
+
+std::vector<std::unique_ptr<Origin>> origins;
+
+void setUp(const benchmark::State& state)
+{
+    if (state.thread_index() == 0)
+    {
+        origins.clear();
+        for (int64_t origin = 0; origin < state.range(0); ++origin)
+        {
+            origins.emplace_back(std::make_unique<Origin>());
+        }
+    }
+}
+
+void tearDown(const benchmark::State& state)
+{
+    if (state.thread_index() == 0)
+    {
+        origins.clear();
+    }
+}
+}
+
+/// Completes one sequence number, which consists of 'numberOfChunks' chunks, of the next origin per iteration
+static void BM_CompleteSequenceNumbersOfManyOrigins(benchmark::State& state)
+{
+    const auto numberOfChunks = static_cast<NES::ChunkNumber::Underlying>(state.range(1));
+    auto origin = static_cast<size_t>(state.thread_index()) % origins.size();
+    for (auto _ : state)
+    {
+        auto& current = *origins[origin];
+        const auto sequenceNumber = current.nextSequenceNumber.fetch_add(1);
+        for (NES::ChunkNumber::Underlying chunk = NES::ChunkNumber::INITIAL; chunk < NES::ChunkNumber::INITIAL + numberOfChunks; ++chunk)
+        {
+            current.queue.emplace(
+                NES::SequenceData{
+                    NES::SequenceNumber(sequenceNumber), NES::ChunkNumber(chunk), chunk == NES::ChunkNumber::INITIAL + numberOfChunks - 1},
+                sequenceNumber);
+        }
+        origin = (origin + 1) % origins.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_CompleteSequenceNumbersOfManyOrigins)
+    ->Setup(setUp)
+    ->Teardown(tearDown)
+    ->ArgsProduct({{1, 16, 256}, {1, 4}})
+    ->ThreadRange(1, 16)
+    ->UseRealTime();
+/// Run the benchmark
+BENCHMARK_MAIN();
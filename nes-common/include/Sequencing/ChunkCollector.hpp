@@ -115,7 +115,9 @@ private:
 /// We use a linked list with each node holding N chunk number counters. Once all sequence numbers in one such node have been completed,
 /// we can remove the node from the linked list without invalidating (moving) other counters.
 
-/// We have to lock the linked list to locate the relevant node; if no such node exists, we append a new one. Within the node, we locate
+/// We have to lock the linked list to locate the relevant node; if no such node exists, we append a new one. Threads locate existing
+/// nodes under a shared lock, thus threads completing chunks of the same origin concurrently do not serialize on the lookup. Solely
+/// appending and removing a node, which happens once per NodeSize sequence numbers, takes the exclusive lock. Within the node, we locate
 /// the chunk counter for the sequence number. We decrease the counter for every non-last chunk. Once we receive the last chunk, we
 /// increase the chunk counter by the current chunk number (which will be the maximum chunk number for this sequence). If the result of
 /// updating the chunk number is 0, we know that the SequenceNumber is complete.
@@ -130,17 +132,25 @@ std::optional<std::pair<SequenceNumber, Timestamp>> ChunkCollector<NodeSize, Ali
     PRECONDITION(data.chunkNumber != ChunkNumber::INVALID, "ChunkNumber is invalid");
     auto sequence = data.sequenceNumber - SequenceNumber::INITIAL;
 
+    const auto containsSequence = [&](const Node& node) { return node.start <= sequence && sequence < node.start + NodeSize; };
     auto& node = [&]() -> Node&
     {
-        auto locked = nodes.ulock();
-        auto it = std::ranges::find_if(*locked, [&](const auto& n) { return n.start <= sequence && sequence < n.start + NodeSize; });
-        if (it == locked->end())
         {
-            auto wlocked = locked.moveFromUpgradeToWrite();
-            wlocked->emplace_back((sequence / NodeSize) * NodeSize);
-            return wlocked->back();
+            auto rlocked = nodes.rlock();
+            if (auto it = std::ranges::find_if(*rlocked, containsSequence); it != rlocked->end())
+            {
+                /// The counters of a node are atomics, thus it is safe to modify them under the shared lock
+                return const_cast<Node&>(*it);
+            }
+        }
+        /// Another thread may have appended the node between releasing the shared and acquiring the exclusive lock
+        auto wlocked = nodes.wlock();
+        if (auto it = std::ranges::find_if(*wlocked, containsSequence); it != wlocked->end())
+        {
+            return *it;
         }
-        return const_cast<Node&>(*it);
+        wlocked->emplace_back((sequence / NodeSize) * NodeSize);
+        return wlocked->back();
     }();
 
     auto& chunk = node.data[sequence % NodeSize].v;
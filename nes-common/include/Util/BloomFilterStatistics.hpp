@@ -0,0 +1,69 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace NES
+{
+
+/// Counters of the Bloom filters that an operator checks before probing its hash maps, e.g., the hash join.
+/// Operators add their locally counted probes once per task, thus relaxed atomics do not contend on the per-record path.
+struct BloomFilterCounters
+{
+    std::atomic<uint64_t> filters{0};
+    std::atomic<uint64_t> filterSizeInBytes{0}; /// Summed up over all filters
+    std::atomic<uint64_t> probes{0};
+    std::atomic<uint64_t> hits{0}; /// Probes, for which the filter may contain the key
+
+    void recordFilter(const uint64_t sizeInBytes)
+    {
+        filters.fetch_add(1, std::memory_order::relaxed);
+        filterSizeInBytes.fetch_add(sizeInBytes, std::memory_order::relaxed);
+    }
+
+    void recordProbes(const uint64_t numberOfProbes, const uint64_t numberOfHits)
+    {
+        probes.fetch_add(numberOfProbes, std::memory_order::relaxed);
+        hits.fetch_add(numberOfHits, std::memory_order::relaxed);
+    }
+};
+
+struct BloomFilterCountersSnapshot
+{
+    std::string operatorName;
+    uint64_t filters;
+    uint64_t filterSizeInBytes;
+    uint64_t probes;
+    uint64_t hits;
+};
+
+/// Process-wide registry of the BloomFilterCounters of all operators, keyed by the name of the operator.
+/// The counters are never reset, i.e., they count since the start of the process, like the FunctionStatistics.
+class BloomFilterStatistics
+{
+public:
+    /// Creates the counters on first access. The reference stays valid for the lifetime of the process.
+    static BloomFilterCounters& getCounters(std::string_view operatorName);
+
+    /// Returns the current values of all registered counters, ordered by the operator name
+    static std::vector<BloomFilterCountersSnapshot> snapshot();
+};
+
+}
@@ -0,0 +1,38 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <chrono>
+#include <Time/Timestamp.hpp>
+
+namespace NES
+{
+
+/// Process-wide clock for the creation timestamps of buffers, which sources, operator handlers, and the query engine take for every buffer.
+/// By default, every read queries the system clock. With a resolution, a background thread publishes the system time at every tick of the
+/// resolution and a read is a single atomic load. Then, a timestamp lags behind the system clock by at most one resolution, plus the
+/// delay until the thread is scheduled. Ingestion-time operators read the creation timestamp of their buffers and thus use this clock.
+class CoarseClock
+{
+public:
+    /// Milliseconds since the UNIX epoch
+    [[nodiscard]] static Timestamp now();
+
+    /// Starts, respectively restarts, the background thread of the clock. Zero stops the thread and reads the system clock again.
+    static void setResolution(std::chrono::milliseconds resolution);
+    [[nodiscard]] static std::chrono::milliseconds getResolution();
+};
+
+}
@@ -23,6 +23,8 @@ enum class ExecutionMode : uint8_t
     /// Uses the interpretation based execution mode.
     INTERPRETER,
     /// Uses the compilation based execution mode.
-    COMPILER
+    COMPILER,
+    /// Interprets the pipelines, until a background thread compiled them.
+    TIERED
 };
 }
@@ -0,0 +1,67 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace NES
+{
+
+/// Counters of a physical function that calls into an external library for every record, e.g., MEOS.
+/// Worker threads update the counters with relaxed atomics, which keeps them cheap enough for the per-record path.
+struct FunctionCounters
+{
+    /// We log details of every n-th call only, to not serialize the worker threads on the logger
+    static constexpr uint64_t DEBUG_LOG_SAMPLING_INTERVAL = 1024;
+
+    std::atomic<uint64_t> calls{0};
+    std::atomic<uint64_t> invalidInputs{0};
+    std::atomic<uint64_t> errors{0};
+
+    /// Returns true if the caller should log (debug) details about this call
+    bool recordCall() { return calls.fetch_add(1, std::memory_order::relaxed) % DEBUG_LOG_SAMPLING_INTERVAL == 0; }
+
+    /// Null, empty, unparsable, or out-of-range inputs, for which the function returns its default result
+    void recordInvalidInput() { invalidInputs.fetch_add(1, std::memory_order::relaxed); }
+
+    /// Errors (exceptions) raised by the external library
+    void recordError() { errors.fetch_add(1, std::memory_order::relaxed); }
+};
+
+struct FunctionCountersSnapshot
+{
+    std::string functionName;
+    uint64_t calls;
+    uint64_t invalidInputs;
+    uint64_t errors;
+};
+
+/// Process-wide registry of the FunctionCounters of all physical functions, keyed by the name of the function.
+/// The counters are never reset, i.e., they count since the start of the process, like monotonic metrics counters.
+class FunctionStatistics
+{
+public:
+    /// Creates the counters on first access. The reference stays valid for the lifetime of the process.
+    static FunctionCounters& getCounters(std::string_view functionName);
+
+    /// Returns the current values of all registered counters, ordered by the function name
+    static std::vector<FunctionCountersSnapshot> snapshot();
+};
+
+}
@@ -0,0 +1,43 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace NES
+{
+
+/// A NUMA node and the CPUs which are local to it.
+struct NumaNode
+{
+    size_t id;
+    std::vector<size_t> cpus;
+};
+
+/// Reads the NUMA topology of the machine from sysfs. On machines (or containers) which do not expose any NUMA information, a single node
+/// containing all CPUs is returned. Nodes without CPUs (e.g., memory-only nodes) are skipped.
+[[nodiscard]] std::vector<NumaNode> getNumaTopology();
+
+/// Parses a Linux CPU list as found in sysfs, e.g., "0-3,8,10-11". Returns an empty optional if the list is malformed.
+[[nodiscard]] std::optional<std::vector<size_t>> parseCpuList(std::string_view cpuList);
+
+/// Restricts the calling thread to the given CPUs. Returns false if the affinity could not be set.
+bool pinCurrentThread(std::span<const size_t> cpus);
+
+}
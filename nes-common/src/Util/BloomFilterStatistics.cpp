@@ -0,0 +1,73 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Util/BloomFilterStatistics.hpp>
+
+#include <atomic>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace NES
+{
+
+namespace
+{
+struct Registry
+{
+    std::mutex mutex;
+    /// std::map is node-based, thus references to the counters stay valid when we register more operators
+    std::map<std::string, BloomFilterCounters, std::less<>> counters;
+};
+
+Registry& getRegistry()
+{
+    static Registry registry;
+    return registry;
+}
+}
+
+BloomFilterCounters& BloomFilterStatistics::getCounters(const std::string_view operatorName)
+{
+    auto& registry = getRegistry();
+    const std::scoped_lock lock(registry.mutex);
+    if (const auto it = registry.counters.find(operatorName); it != registry.counters.end())
+    {
+        return it->second;
+    }
+    return registry.counters.try_emplace(std::string(operatorName)).first->second;
+}
+
+std::vector<BloomFilterCountersSnapshot> BloomFilterStatistics::snapshot()
+{
+    auto& registry = getRegistry();
+    const std::scoped_lock lock(registry.mutex);
+    std::vector<BloomFilterCountersSnapshot> snapshots;
+    snapshots.reserve(registry.counters.size());
+    for (const auto& [operatorName, counters] : registry.counters)
+    {
+        snapshots.emplace_back(
+            operatorName,
+            counters.filters.load(std::memory_order::relaxed),
+            counters.filterSizeInBytes.load(std::memory_order::relaxed),
+            counters.probes.load(std::memory_order::relaxed),
+            counters.hits.load(std::memory_order::relaxed));
+    }
+    return snapshots;
+}
+
+}
@@ -0,0 +1,102 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Util/CoarseClock.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <utility>
+#include <Time/Timestamp.hpp>
+#include <Util/ThreadNaming.hpp>
+
+namespace NES
+{
+namespace
+{
+Timestamp::Underlying readSystemClock()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+struct CoarseClockState
+{
+    std::atomic<bool> isCoarse{false};
+    std::atomic<Timestamp::Underlying> currentTime{0};
+
+    std::mutex mutex;
+    std::condition_variable_any resolutionChanged;
+    std::chrono::milliseconds resolution{0};
+    /// Declared last, thus the thread is joined before the other members are destroyed
+    std::jthread updater;
+};
+
+CoarseClockState& getState()
+{
+    static CoarseClockState state;
+    return state;
+}
+}
+
+Timestamp CoarseClock::now()
+{
+    auto& state = getState();
+    if (state.isCoarse.load(std::memory_order_relaxed))
+    {
+        return Timestamp(state.currentTime.load(std::memory_order_relaxed));
+    }
+    return Timestamp(readSystemClock());
+}
+
+void CoarseClock::setResolution(const std::chrono::milliseconds resolution)
+{
+    auto& state = getState();
+    /// Destroying the previous thread stops and joins it after the lock is released, as the thread waits on the same mutex
+    std::jthread previousUpdater;
+    const std::scoped_lock lock(state.mutex);
+    previousUpdater = std::move(state.updater);
+    state.resolution = resolution;
+    if (resolution == std::chrono::milliseconds::zero())
+    {
+        state.isCoarse.store(false);
+        return;
+    }
+
+    state.currentTime.store(readSystemClock());
+    state.isCoarse.store(true);
+    state.updater = std::jthread(
+        [&state, resolution](const std::stop_token& stopToken)
+        {
+            setThreadName("CoarseClock");
+            std::unique_lock lock(state.mutex);
+            while (not stopToken.stop_requested())
+            {
+                /// The stop token wakes the thread, thus a stop does not wait for the end of the resolution
+                state.resolutionChanged.wait_for(lock, stopToken, resolution, [] { return false; });
+                state.currentTime.store(readSystemClock(), std::memory_order_relaxed);
+            }
+        });
+}
+
+std::chrono::milliseconds CoarseClock::getResolution()
+{
+    auto& state = getState();
+    const std::scoped_lock lock(state.mutex);
+    return state.resolution;
+}
+
+}
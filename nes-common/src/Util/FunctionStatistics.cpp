@@ -0,0 +1,73 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Util/FunctionStatistics.hpp>
+
+#include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace NES
+{
+
+namespace
+{
+struct Registry
+{
+    std::mutex mutex;
+    /// std::map is node-based, thus references to the counters stay valid when we register more functions
+    std::map<std::string, FunctionCounters, std::less<>> counters;
+};
+
+Registry& getRegistry()
+{
+    static Registry registry;
+    return registry;
+}
+}
+
+FunctionCounters& FunctionStatistics::getCounters(const std::string_view functionName)
+{
+    auto& registry = getRegistry();
+    const std::scoped_lock lock(registry.mutex);
+    if (const auto it = registry.counters.find(functionName); it != registry.counters.end())
+    {
+        return it->second;
+    }
+    return registry.counters.try_emplace(std::string(functionName)).first->second;
+}
+
+std::vector<FunctionCountersSnapshot> FunctionStatistics::snapshot()
+{
+    auto& registry = getRegistry();
+    const std::scoped_lock lock(registry.mutex);
+    std::vector<FunctionCountersSnapshot> snapshots;
+    snapshots.reserve(registry.counters.size());
+    for (const auto& [functionName, counters] : registry.counters)
+    {
+        snapshots.emplace_back(
+            functionName,
+            counters.calls.load(std::memory_order::relaxed),
+            counters.invalidInputs.load(std::memory_order::relaxed),
+            counters.errors.load(std::memory_order::relaxed));
+    }
+    return snapshots;
+}
+
+}
@@ -0,0 +1,141 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Util/NumaTopology.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <vector>
+#include <pthread.h>
+#include <sched.h>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Strings.hpp>
+
+namespace NES
+{
+
+namespace
+{
+constexpr std::string_view NUMA_NODE_SYSFS_DIRECTORY = "/sys/devices/system/node";
+constexpr std::string_view NUMA_NODE_PREFIX = "node";
+
+std::vector<size_t> allCpus()
+{
+    std::vector<size_t> cpus(std::max(1U, std::thread::hardware_concurrency()));
+    for (size_t cpu = 0; cpu < cpus.size(); ++cpu)
+    {
+        cpus[cpu] = cpu;
+    }
+    return cpus;
+}
+}
+
+std::optional<std::vector<size_t>> parseCpuList(std::string_view cpuList)
+{
+    std::vector<size_t> cpus;
+    for (const auto& range : Util::splitWithStringDelimiter<std::string_view>(Util::trimWhiteSpaces(cpuList), ","))
+    {
+        const auto dash = range.find('-');
+        if (dash == std::string_view::npos)
+        {
+            const auto cpu = Util::from_chars<size_t>(range);
+            if (!cpu)
+            {
+                return {};
+            }
+            cpus.push_back(*cpu);
+            continue;
+        }
+
+        const auto first = Util::from_chars<size_t>(range.substr(0, dash));
+        const auto last = Util::from_chars<size_t>(range.substr(dash + 1));
+        if (!first || !last || *first > *last)
+        {
+            return {};
+        }
+        for (size_t cpu = *first; cpu <= *last; ++cpu)
+        {
+            cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
+
+std::vector<NumaNode> getNumaTopology()
+{
+    std::vector<NumaNode> nodes;
+    std::error_code errorCode;
+    for (const auto& entry : std::filesystem::directory_iterator(NUMA_NODE_SYSFS_DIRECTORY, errorCode))
+    {
+        const auto name = entry.path().filename().string();
+        if (!name.starts_with(NUMA_NODE_PREFIX))
+        {
+            continue;
+        }
+        const auto nodeId = Util::from_chars<size_t>(std::string_view(name).substr(NUMA_NODE_PREFIX.size()));
+        if (!nodeId)
+        {
+            continue;
+        }
+
+        std::ifstream cpuListFile(entry.path() / "cpulist");
+        std::string cpuList;
+        if (!std::getline(cpuListFile, cpuList))
+        {
+            continue;
+        }
+        if (auto cpus = parseCpuList(cpuList); cpus && !cpus->empty())
+        {
+            nodes.emplace_back(*nodeId, std::move(*cpus));
+        }
+    }
+
+    if (nodes.empty())
+    {
+        NES_DEBUG("No NUMA topology found in {}. Assuming a single NUMA node.", NUMA_NODE_SYSFS_DIRECTORY);
+        nodes.emplace_back(0, allCpus());
+    }
+
+    std::ranges::sort(nodes, {}, &NumaNode::id);
+    return nodes;
+}
+
+bool pinCurrentThread(std::span<const size_t> cpus)
+{
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    for (const auto cpu : cpus)
+    {
+        if (cpu < CPU_SETSIZE)
+        {
+            CPU_SET(cpu, &cpuSet);
+        }
+    }
+    if (const auto result = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuSet); result != 0)
+    {
+        NES_WARNING("Could not pin thread to {} cpus: {}", cpus.size(), std::system_category().message(result));
+        return false;
+    }
+    return true;
+}
+
+}
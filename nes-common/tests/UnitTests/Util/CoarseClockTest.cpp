@@ -0,0 +1,79 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Util/CoarseClock.hpp>
+
+#include <chrono>
+#include <thread>
+#include <Time/Timestamp.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+
+namespace NES
+{
+class CoarseClockTest : public Testing::BaseUnitTest
+{
+public:
+    static void SetUpTestCase()
+    {
+        Logger::setupLogging("CoarseClockTest.log", LogLevel::LOG_DEBUG);
+        NES_INFO("CoarseClockTest test class SetUpTestCase.");
+    }
+
+    void TearDown() override
+    {
+        CoarseClock::setResolution(std::chrono::milliseconds::zero());
+        BaseUnitTest::TearDown();
+    }
+
+    static Timestamp systemTime()
+    {
+        const auto sinceEpoch = std::chrono::system_clock::now().time_since_epoch();
+        return Timestamp(std::chrono::duration_cast<std::chrono::milliseconds>(sinceEpoch).count());
+    }
+};
+
+TEST_F(CoarseClockTest, readsTheSystemClockWithoutResolution)
+{
+    const auto before = systemTime();
+    const auto now = CoarseClock::now();
+    EXPECT_LE(before, now);
+    EXPECT_LE(now, systemTime());
+}
+
+TEST_F(CoarseClockTest, advancesAtItsResolution)
+{
+    constexpr auto resolution = std::chrono::milliseconds(5);
+    CoarseClock::setResolution(resolution);
+    EXPECT_EQ(CoarseClock::getResolution(), resolution);
+
+    const auto start = CoarseClock::now();
+    EXPECT_LE(start, systemTime());
+    std::this_thread::sleep_for(resolution * 20);
+    const auto later = CoarseClock::now();
+    EXPECT_GT(later, start);
+    EXPECT_LE(later, systemTime());
+
+    /// Changing the resolution restarts the clock without going back in time
+    CoarseClock::setResolution(std::chrono::milliseconds(1));
+    EXPECT_GE(CoarseClock::now(), later);
+
+    CoarseClock::setResolution(std::chrono::milliseconds::zero());
+    EXPECT_EQ(CoarseClock::getResolution(), std::chrono::milliseconds::zero());
+    EXPECT_GE(CoarseClock::now(), later);
+}
+}
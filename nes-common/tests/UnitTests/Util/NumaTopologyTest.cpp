@@ -0,0 +1,60 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstddef>
+#include <vector>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <Util/NumaTopology.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+
+namespace NES
+{
+class NumaTopologyTest : public Testing::BaseUnitTest
+{
+public:
+    static void SetUpTestCase()
+    {
+        Logger::setupLogging("NumaTopologyTest.log", LogLevel::LOG_DEBUG);
+        NES_INFO("NumaTopologyTest test class SetUpTestCase.");
+    }
+};
+
+TEST_F(NumaTopologyTest, testParseCpuList)
+{
+    EXPECT_EQ(parseCpuList("0"), std::vector<size_t>({0}));
+    EXPECT_EQ(parseCpuList("0-3"), std::vector<size_t>({0, 1, 2, 3}));
+    EXPECT_EQ(parseCpuList("0-1,8,10-11\n"), std::vector<size_t>({0, 1, 8, 10, 11}));
+    EXPECT_EQ(parseCpuList(""), std::vector<size_t>{});
+}
+
+TEST_F(NumaTopologyTest, testParseMalformedCpuList)
+{
+    EXPECT_FALSE(parseCpuList("a").has_value());
+    EXPECT_FALSE(parseCpuList("3-1").has_value());
+    EXPECT_FALSE(parseCpuList("1-b").has_value());
+}
+
+TEST_F(NumaTopologyTest, testTopologyContainsAtLeastOneNode)
+{
+    const auto topology = getNumaTopology();
+    ASSERT_FALSE(topology.empty());
+    for (const auto& node : topology)
+    {
+        EXPECT_FALSE(node.cpus.empty());
+    }
+}
+}
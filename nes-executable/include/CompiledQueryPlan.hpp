@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <chrono>
+#include <cstddef>
 #include <memory>
 #include <variant>
 #include <vector>
@@ -21,6 +23,7 @@
 #include <Sinks/SinkDescriptor.hpp>
 #include <Sources/SourceDescriptor.hpp>
 #include <ExecutablePipelineStage.hpp>
+#include <QueryPriority.hpp>
 
 namespace NES
 {
@@ -47,6 +50,9 @@ struct CompiledQueryPlan
 
         /// Sources do not have any predecessors
         std::vector<std::weak_ptr<ExecutablePipeline>> successors;
+        /// If set, the source emits its raw buffers as formatted buffers of tuples of this size directly to the successors, thus the
+        /// successors are the pipelines that would read the buffers of its input formatter. Zero, if the successors format the raw buffers.
+        size_t formattedTupleSizeInBytes = 0;
     };
 
     struct Sink
@@ -67,5 +73,9 @@ struct CompiledQueryPlan
     std::vector<std::shared_ptr<ExecutablePipeline>> pipelines;
     std::vector<Sink> sinks;
     std::vector<Source> sources;
+    /// Chosen when the query is registered, thus it is not part of the compilation
+    QueryPriority priority = QueryPriority::NORMAL;
+    /// Wait of a task in the task queue, beyond which the buffers it emits are compressed, c.f., BufferCompression. Zero disables it.
+    std::chrono::milliseconds bufferCompressionDelay{0};
 };
 }
@@ -16,6 +16,9 @@
 #include <cstdint>
 #include <memory>
 #include <ostream>
+#include <string>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
 #include <Runtime/TupleBuffer.hpp>
 #include <PipelineExecutionContext.hpp>
 
@@ -26,6 +29,16 @@ namespace NES
 class ExecutablePipelineStage
 {
 public:
+    /// Cycles that the pipeline spent in one of its operators, c.f., OperatorProfile
+    struct OperatorCost
+    {
+        OperatorId operatorId = INVALID_OPERATOR_ID;
+        std::string name;
+        uint64_t numberOfInvocations = 0;
+        uint64_t inclusiveCycles = 0;
+        uint64_t exclusiveCycles = 0;
+    };
+
     virtual ~ExecutablePipelineStage() = default;
     /// Prepares the ExecutablePipelineStage for future execution.
     /// `start` may throw to indicate an error.
@@ -41,6 +54,18 @@ public:
     /// `stop` may throw to indicate an error.
     virtual void stop(PipelineExecutionContext& pipelineExecutionContext) = 0;
 
+    /// Returns the cycles of the operators from the root to the last child of the pipeline, if the pipeline profiles its operators.
+    /// Called concurrently to the execution of the pipeline, thus the costs of concurrently executing tasks may be counted partially.
+    [[nodiscard]] virtual std::vector<OperatorCost> getOperatorCosts() const { return {}; }
+
+    /// Returns the number of bytes that the state of the operators of the pipeline occupies in memory. Called concurrently to the execution
+    /// of the pipeline.
+    [[nodiscard]] virtual uint64_t getStateSizeInBytes() const { return 0; }
+
+    /// Returns the state of getStateSizeInBytes() by the WorkerThreadIds, modulo the number of worker threads, which own it. Empty, if
+    /// no state of the pipeline is owned by worker threads.
+    [[nodiscard]] virtual std::vector<uint64_t> getStateSizeInBytesPerWorkerThread() const { return {}; }
+
     friend std::ostream& operator<<(std::ostream& os, const ExecutablePipelineStage& eps) { return eps.toString(os); }
 
 protected:
@@ -22,6 +22,7 @@
 #include <Runtime/AbstractBufferProvider.hpp>
 #include <Runtime/Execution/OperatorHandler.hpp>
 #include <Runtime/TupleBuffer.hpp>
+#include <Time/Timestamp.hpp>
 
 namespace NES
 {
@@ -47,10 +48,19 @@ public:
 
     virtual bool emitBuffer(const TupleBuffer&, ContinuationPolicy) = 0;
 
+    /// Emits a buffer that is due at `deadline`, e.g., a window trigger that is due at the end of its window. The query engine executes
+    /// such buffers before the buffers without a deadline, earliest deadline first. Deadlines are only compared with each other, thus the
+    /// event time of the window end is sufficient. Returns success, if the buffer was emitted successfully.
+    virtual bool emitBufferWithDeadline(const TupleBuffer& buffer, Timestamp /*deadline*/) { return emitBuffer(buffer); }
+
     /// This method can only be called once per pipeline execution! The Pipeline should immediately finish its execution as the exact same task could be executed
     /// immediately.
     virtual void repeatTask(const TupleBuffer&, std::chrono::milliseconds) = 0;
 
+    /// Submits a new task that executes the current pipeline on the buffer. In contrast to 'repeatTask', the current pipeline execution
+    /// continues and may submit multiple tasks, e.g., to let other worker threads process parts of its input concurrently.
+    virtual void submitTask(const TupleBuffer&) = 0;
+
     virtual TupleBuffer allocateTupleBuffer() = 0;
     [[nodiscard]] virtual WorkerThreadId getId() const = 0;
     [[nodiscard]] virtual uint64_t getNumberOfWorkerThreads() const = 0;
@@ -0,0 +1,36 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace NES
+{
+
+/// The priority class of a query, which the query engine uses to order the tasks of concurrent queries.
+/// Each priority class receives a share of the WorkerThreads proportional to its weight, c.f., QueryEngineConfiguration.
+enum class QueryPriority : uint8_t
+{
+    /// Latency critical queries, e.g., alerting.
+    HIGH,
+    NORMAL,
+    /// Throughput oriented queries, e.g., large analytical joins, whose tasks may be delayed in favour of the other classes.
+    LOW
+};
+
+static constexpr size_t NumberOfQueryPriorities = 3;
+
+}
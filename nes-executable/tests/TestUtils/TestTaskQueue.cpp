@@ -63,6 +63,12 @@ void TestPipelineExecutionContext::repeatTask(const TupleBuffer&, std::chrono::m
     repeatTaskCallback();
 }
 
+void TestPipelineExecutionContext::submitTask(const TupleBuffer& tupleBuffer)
+{
+    PRECONDITION(submitTaskCallback != nullptr, "Cannot submit a task without a valid submitTaskCallback function");
+    submitTaskCallback(tupleBuffer);
+}
+
 void TestPipelineStage::execute(const TupleBuffer& tupleBuffer, PipelineExecutionContext& pec)
 {
     for (const auto& [_, taskFunction] : taskSteps)
@@ -105,23 +111,32 @@ void SingleThreadedTestTaskQueue::enqueueTasks(std::vector<TestPipelineTask> pip
 
     for (const auto& testTask : pipelineTasks)
     {
-        auto pipelineExecutionContext = std::make_shared<TestPipelineExecutionContext>(
-            this->bufferProvider, WorkerThreadId(testTask.workerThreadId.getRawValue()), PipelineId(0), this->resultBuffers);
-        /// There is a circular dependency, because the repeatTaskCallback needs to know about the pec and the pec needs to know about the
-        /// repeatTaskCallback. The Tasks own the pec. When a tasks goes out of scope, so should the pec and the repeatTaskCallback.
-        /// Thus, we give a weak_ptr of the pec to the repeatTaskCallback, which is guaranteed to be alive during the lifetime of the repeatTaskCallback.
-        const std::weak_ptr weakPipelineExecutionContext = pipelineExecutionContext;
-        auto repeatTaskCallback = [this, testTask, weakPipelineExecutionContext]()
-        {
-            const auto pecFromWeakCapturedPtr = weakPipelineExecutionContext.lock();
-            PRECONDITION(pecFromWeakCapturedPtr != nullptr, "The pipelineExecutionContext must be valid in the repeat callback function");
-            tasks.emplace(WorkTask{.task = testTask, .pipelineExecutionContext = pecFromWeakCapturedPtr});
-        };
-        pipelineExecutionContext->setRepeatTaskCallback(std::move(repeatTaskCallback));
-        tasks.emplace(WorkTask{.task = testTask, .pipelineExecutionContext = pipelineExecutionContext});
+        tasks.emplace(createWorkTask(testTask));
     }
 }
 
+WorkTask SingleThreadedTestTaskQueue::createWorkTask(const TestPipelineTask& testTask)
+{
+    auto pipelineExecutionContext = std::make_shared<TestPipelineExecutionContext>(
+        this->bufferProvider, WorkerThreadId(testTask.workerThreadId.getRawValue()), PipelineId(0), this->resultBuffers);
+    /// There is a circular dependency, because the repeatTaskCallback needs to know about the pec and the pec needs to know about the
+    /// repeatTaskCallback. The Tasks own the pec. When a tasks goes out of scope, so should the pec and the repeatTaskCallback.
+    /// Thus, we give a weak_ptr of the pec to the repeatTaskCallback, which is guaranteed to be alive during the lifetime of the repeatTaskCallback.
+    const std::weak_ptr weakPipelineExecutionContext = pipelineExecutionContext;
+    auto repeatTaskCallback = [this, testTask, weakPipelineExecutionContext]()
+    {
+        const auto pecFromWeakCapturedPtr = weakPipelineExecutionContext.lock();
+        PRECONDITION(pecFromWeakCapturedPtr != nullptr, "The pipelineExecutionContext must be valid in the repeat callback function");
+        tasks.emplace(WorkTask{.task = testTask, .pipelineExecutionContext = pecFromWeakCapturedPtr});
+    };
+    pipelineExecutionContext->setRepeatTaskCallback(std::move(repeatTaskCallback));
+    /// A submitted task runs on the same worker thread as the task that submitted it, but with its own pec
+    pipelineExecutionContext->setSubmitTaskCallback(
+        [this, testTask](const TupleBuffer& tupleBuffer)
+        { tasks.emplace(createWorkTask(TestPipelineTask{testTask.workerThreadId, tupleBuffer, testTask.eps})); });
+    return WorkTask{.task = testTask, .pipelineExecutionContext = std::move(pipelineExecutionContext)};
+}
+
 void SingleThreadedTestTaskQueue::runTasks()
 {
     while (not tasks.empty())
@@ -140,8 +155,9 @@ MultiThreadedTestTaskQueue::MultiThreadedTestTaskQueue(
     const size_t numberOfThreads,
     const std::vector<TestPipelineTask>& testTasks,
     std::shared_ptr<AbstractBufferProvider> bufferProvider,
-    std::shared_ptr<std::vector<std::vector<TupleBuffer>>> resultBuffers)
-    : threadTasks(testTasks.size())
+    std::shared_ptr<std::vector<std::vector<TupleBuffer>>> resultBuffers,
+    const size_t numberOfSubmittedTasks)
+    : threadTasks(testTasks.size() + numberOfSubmittedTasks)
     , numberOfWorkerThreads(numberOfThreads)
     , completionLatch(numberOfThreads)
     , bufferProvider(std::move(bufferProvider))
@@ -153,23 +169,31 @@ MultiThreadedTestTaskQueue::MultiThreadedTestTaskQueue(
 
     for (const auto& testTask : testTasks)
     {
-        auto pipelineExecutionContext = std::make_shared<TestPipelineExecutionContext>(
-            this->bufferProvider, WorkerThreadId(WorkerThreadId(0)), PipelineId(0), this->resultBuffers);
-        /// There is a circular dependency, because the repeatTaskCallback needs to know about the pec and the pec needs to know about the
-        /// repeatTaskCallback. The Tasks own the pec. When a tasks goes out of scope, so should the pec and the repeatTaskCallback.
-        /// Thus, we give a weak_ptr of the pec to the repeatTaskCallback, which is guaranteed to be alive during the lifetime of the repeatTaskCallback.
-        const std::weak_ptr weakPipelineExecutionContext = pipelineExecutionContext;
-        auto repeatTaskCallback = [this, testTask, weakPipelineExecutionContext]()
-        {
-            const auto pecFromWeakCapturedPtr = weakPipelineExecutionContext.lock();
-            PRECONDITION(pecFromWeakCapturedPtr != nullptr, "The pipelineExecutionContext must be valid in the repeat callback function");
-            threadTasks.blockingWrite(WorkTask{.task = testTask, .pipelineExecutionContext = pecFromWeakCapturedPtr});
-        };
-        pipelineExecutionContext->setRepeatTaskCallback(std::move(repeatTaskCallback));
-        threadTasks.blockingWrite(WorkTask{.task = testTask, .pipelineExecutionContext = pipelineExecutionContext});
+        threadTasks.blockingWrite(createWorkTask(testTask));
     }
 }
 
+WorkTask MultiThreadedTestTaskQueue::createWorkTask(const TestPipelineTask& testTask)
+{
+    auto pipelineExecutionContext = std::make_shared<TestPipelineExecutionContext>(
+        this->bufferProvider, WorkerThreadId(WorkerThreadId(0)), PipelineId(0), this->resultBuffers);
+    /// There is a circular dependency, because the repeatTaskCallback needs to know about the pec and the pec needs to know about the
+    /// repeatTaskCallback. The Tasks own the pec. When a tasks goes out of scope, so should the pec and the repeatTaskCallback.
+    /// Thus, we give a weak_ptr of the pec to the repeatTaskCallback, which is guaranteed to be alive during the lifetime of the repeatTaskCallback.
+    const std::weak_ptr weakPipelineExecutionContext = pipelineExecutionContext;
+    auto repeatTaskCallback = [this, testTask, weakPipelineExecutionContext]()
+    {
+        const auto pecFromWeakCapturedPtr = weakPipelineExecutionContext.lock();
+        PRECONDITION(pecFromWeakCapturedPtr != nullptr, "The pipelineExecutionContext must be valid in the repeat callback function");
+        threadTasks.blockingWrite(WorkTask{.task = testTask, .pipelineExecutionContext = pecFromWeakCapturedPtr});
+    };
+    pipelineExecutionContext->setRepeatTaskCallback(std::move(repeatTaskCallback));
+    pipelineExecutionContext->setSubmitTaskCallback(
+        [this, testTask](const TupleBuffer& tupleBuffer)
+        { threadTasks.blockingWrite(createWorkTask(TestPipelineTask{testTask.workerThreadId, tupleBuffer, testTask.eps})); });
+    return WorkTask{.task = testTask, .pipelineExecutionContext = std::move(pipelineExecutionContext)};
+}
+
 void MultiThreadedTestTaskQueue::startProcessing()
 {
     timer.start();
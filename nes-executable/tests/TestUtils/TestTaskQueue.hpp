@@ -92,6 +92,11 @@ public:
 
     void setRepeatTaskCallback(std::function<void()> repeatTaskCallback) { this->repeatTaskCallback = std::move(repeatTaskCallback); }
 
+    void setSubmitTaskCallback(std::function<void(const TupleBuffer&)> submitTaskCallback)
+    {
+        this->submitTaskCallback = std::move(submitTaskCallback);
+    }
+
     [[nodiscard]] WorkerThreadId getId() const override { return workerThreadId; };
 
     [[nodiscard]] uint64_t getNumberOfWorkerThreads() const override { return 0; }; /// dummy implementation for  pure virtual function
@@ -109,11 +114,15 @@ public:
 
     void repeatTask(const TupleBuffer&, std::chrono::milliseconds) override;
 
+    /// Calls the 'submitTaskCallback', which enqueues a new task for the buffer
+    void submitTask(const TupleBuffer& tupleBuffer) override;
+
     WorkerThreadId workerThreadId;
     PipelineId pipelineId;
 
 private:
     std::function<void()> repeatTaskCallback;
+    std::function<void(const TupleBuffer&)> submitTaskCallback;
     std::shared_ptr<AbstractBufferProvider> bufferManager;
     std::unordered_map<OperatorHandlerId, std::shared_ptr<OperatorHandler>> operatorHandlers;
     /// Different threads have different TestPipelineExecutionContexts. All threads share the same pointer to the result buffers.
@@ -199,6 +208,8 @@ private:
 
     /// Sets up all tasks for the threads.
     void enqueueTasks(std::vector<TestPipelineTask> pipelineTasks);
+    /// Creates a WorkTask whose pipelineExecutionContext enqueues repeated and submitted tasks
+    WorkTask createWorkTask(const TestPipelineTask& testTask);
     /// Executes tasks on respective threads.
     void runTasks();
 };
@@ -208,11 +219,13 @@ private:
 class MultiThreadedTestTaskQueue
 {
 public:
+    /// @param numberOfSubmittedTasks the number of tasks that the test tasks submit, which the MPMC queue holds on top of the test tasks
     MultiThreadedTestTaskQueue(
         size_t numberOfThreads,
         const std::vector<TestPipelineTask>& testTasks,
         std::shared_ptr<AbstractBufferProvider> bufferProvider,
-        std::shared_ptr<std::vector<std::vector<TupleBuffer>>> resultBuffers);
+        std::shared_ptr<std::vector<std::vector<TupleBuffer>>> resultBuffers,
+        size_t numberOfSubmittedTasks = 0);
 
     /// Activates threads which start to concurrently process the WorkTasks in the MPMC queue.
     void startProcessing();
@@ -231,6 +244,9 @@ private:
     Timer<std::chrono::microseconds> timer;
 
 
+    /// Creates a WorkTask whose pipelineExecutionContext writes repeated and submitted tasks into the MPMC queue
+    WorkTask createWorkTask(const TestPipelineTask& testTask);
+
     void threadFunction(size_t threadIdx);
 };
 
@@ -0,0 +1,122 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include <DataTypes/Schema.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Sources/SourceDescriptor.hpp>
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+#include <magic_enum/magic_enum.hpp>
+#include <CSVDelimiterScanner.hpp>
+#include <CSVInputFormatIndexer.hpp>
+#include <FieldOffsets.hpp>
+#include <RawTupleBuffer.hpp>
+
+/// This Benchmark measures the throughput (bytes/s) of indexing raw CSV buffers, i.e., of finding the offsets of all fields.
+/// We compare the byte-by-byte search (SCALAR) with the SIMD block scanning of all instruction sets the CPU supports.
+/// The first argument is the number of fields per tuple, the second the average number of characters per field.
+
+namespace
+{
+constexpr size_t BUFFER_SIZE = 64 * 1024;
+constexpr size_t NUMBER_OF_RAW_BUFFERS = 16;
+
+std::shared_ptr<NES::BufferManager> bufferManager;
+std::vector<NES::RawTupleBuffer> rawBuffers;
+
+/// Fills the raw buffers with tuples in which field 'i' of tuple 'j' has a length of 1 to 2 * averageFieldSize characters
+void setUp(const benchmark::State& state)
+{
+    const auto numberOfFields = static_cast<size_t>(state.range(0));
+    const auto averageFieldSize = static_cast<size_t>(state.range(1));
+    bufferManager = NES::BufferManager::create(BUFFER_SIZE, 4 * NUMBER_OF_RAW_BUFFERS);
+
+    std::string tuple;
+    size_t tupleIdx = 0;
+    for (size_t bufferIdx = 0; bufferIdx < NUMBER_OF_RAW_BUFFERS; ++bufferIdx)
+    {
+        auto buffer = bufferManager->getBufferBlocking();
+        std::string csv;
+        while (csv.size() < BUFFER_SIZE)
+        {
+            tuple.clear();
+            for (size_t fieldIdx = 0; fieldIdx < numberOfFields; ++fieldIdx)
+            {
+                const auto fieldSize = 1 + ((tupleIdx * 31 + fieldIdx * 17) % (2 * averageFieldSize));
+                tuple.append(fieldSize, static_cast<char>('0' + (fieldIdx % 10)));
+                tuple.push_back((fieldIdx + 1 == numberOfFields) ? '\n' : ',');
+            }
+            csv.append(tuple);
+            ++tupleIdx;
+        }
+        csv.resize(BUFFER_SIZE);
+        std::memcpy(buffer.getAvailableMemoryArea<char>().data(), csv.data(), BUFFER_SIZE);
+        /// Raw buffers store the number of bytes as their number of tuples
+        buffer.setNumberOfTuples(BUFFER_SIZE);
+        rawBuffers.emplace_back(std::move(buffer));
+    }
+}
+
+void tearDown(const benchmark::State&)
+{
+    rawBuffers.clear();
+    bufferManager.reset();
+}
+}
+
+static void BM_IndexCSVBuffer(benchmark::State& state, const NES::CSVDelimiterScanner::InstructionSet instructionSet)
+{
+    const auto numberOfFields = static_cast<size_t>(state.range(0));
+    const NES::ParserConfig config{.parserType = "CSV", .tupleDelimiter = "\n", .fieldDelimiter = ","};
+    const NES::CSVInputFormatIndexer indexer(config, numberOfFields, instructionSet);
+    const NES::CSVMetaData metaData(config, NES::Schema{});
+
+    size_t bufferIdx = 0;
+    for (auto _ : state)
+    {
+        NES::FieldOffsets<NES::CSV_NUM_OFFSETS_PER_FIELD> fieldOffsets(*bufferManager);
+        indexer.indexRawBuffer(fieldOffsets, rawBuffers[bufferIdx], metaData);
+        benchmark::DoNotOptimize(fieldOffsets.getTotalNumberOfTuples());
+        bufferIdx = (bufferIdx + 1) % rawBuffers.size();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * BUFFER_SIZE));
+}
+
+int main(int argc, char** argv)
+{
+    using enum NES::CSVDelimiterScanner::InstructionSet;
+    benchmark::Initialize(&argc, argv);
+    for (const auto instructionSet : {SCALAR, SSE2, AVX2, AVX512, NEON})
+    {
+        if (not NES::CSVDelimiterScanner::isSupported(instructionSet))
+        {
+            continue;
+        }
+        benchmark::RegisterBenchmark(fmt::format("BM_IndexCSVBuffer/{}", magic_enum::enum_name(instructionSet)), BM_IndexCSVBuffer, instructionSet)
+            ->Setup(setUp)
+            ->Teardown(tearDown)
+            ->ArgsProduct({{4, 16, 64}, {2, 8, 32}});
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,137 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Sources/SourceDescriptor.hpp>
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+#include <magic_enum/magic_enum.hpp>
+#include <CSVDelimiterScanner.hpp>
+#include <FieldOffsets.hpp>
+#include <JSONInputFormatIndexer.hpp>
+#include <RawTupleBuffer.hpp>
+
+/// This Benchmark measures the throughput (bytes/s) of indexing raw JSON buffers, i.e., of finding the offsets of all values.
+/// We compare the search per structural character (SCALAR) with the SIMD block scanning of all instruction sets the CPU supports.
+/// The first argument is the number of fields per tuple, the second one whether the keys of all tuples occur in the same order (1) or
+/// in an order that differs from tuple to tuple (0), which defeats the prediction of the field of a key.
+
+namespace
+{
+constexpr size_t BUFFER_SIZE = 64 * 1024;
+constexpr size_t NUMBER_OF_RAW_BUFFERS = 16;
+
+std::shared_ptr<NES::BufferManager> bufferManager;
+std::vector<NES::RawTupleBuffer> rawBuffers;
+
+std::string getKey(const size_t fieldIdx)
+{
+    return fmt::format("field_{}", fieldIdx);
+}
+
+/// Fills the raw buffers with flat JSON objects, whose values alternate between integers and strings
+void setUp(const benchmark::State& state)
+{
+    const auto numberOfFields = static_cast<size_t>(state.range(0));
+    const auto hasStableKeyOrder = state.range(1) != 0;
+    bufferManager = NES::BufferManager::create(BUFFER_SIZE, 4 * NUMBER_OF_RAW_BUFFERS);
+
+    std::string tuple;
+    size_t tupleIdx = 0;
+    for (size_t bufferIdx = 0; bufferIdx < NUMBER_OF_RAW_BUFFERS; ++bufferIdx)
+    {
+        auto buffer = bufferManager->getBufferBlocking();
+        std::string json;
+        while (json.size() < BUFFER_SIZE)
+        {
+            tuple = "{";
+            for (size_t i = 0; i < numberOfFields; ++i)
+            {
+                const auto fieldIdx = hasStableKeyOrder ? i : (i + tupleIdx) % numberOfFields;
+                const auto value = (fieldIdx % 2 == 0) ? std::to_string(tupleIdx * 31 + fieldIdx) : fmt::format("\"value_{}\"", tupleIdx);
+                tuple.append(fmt::format("\"{}\":{}", getKey(fieldIdx), value));
+                tuple.append((i + 1 == numberOfFields) ? "}\n" : ",");
+            }
+            json.append(tuple);
+            ++tupleIdx;
+        }
+        json.resize(BUFFER_SIZE);
+        std::memcpy(buffer.getAvailableMemoryArea<char>().data(), json.data(), BUFFER_SIZE);
+        /// Raw buffers store the number of bytes as their number of tuples
+        buffer.setNumberOfTuples(BUFFER_SIZE);
+        rawBuffers.emplace_back(std::move(buffer));
+    }
+}
+
+void tearDown(const benchmark::State&)
+{
+    rawBuffers.clear();
+    bufferManager.reset();
+}
+}
+
+static void BM_IndexJSONBuffer(benchmark::State& state, const NES::CSVDelimiterScanner::InstructionSet instructionSet)
+{
+    const auto numberOfFields = static_cast<size_t>(state.range(0));
+    const NES::ParserConfig config{.parserType = "JSON", .tupleDelimiter = "\n", .fieldDelimiter = ","};
+    const NES::JSONInputFormatIndexer indexer(config, numberOfFields, instructionSet);
+    NES::Schema schema;
+    for (size_t fieldIdx = 0; fieldIdx < numberOfFields; ++fieldIdx)
+    {
+        schema.addField(getKey(fieldIdx), (fieldIdx % 2 == 0) ? NES::DataType::Type::UINT64 : NES::DataType::Type::VARSIZED);
+    }
+    const NES::JSONMetaData metaData(config, schema);
+
+    size_t bufferIdx = 0;
+    for (auto _ : state)
+    {
+        NES::FieldOffsets<NES::JSON_NUM_OFFSETS_PER_FIELD> fieldOffsets(*bufferManager);
+        indexer.indexRawBuffer(fieldOffsets, rawBuffers[bufferIdx], metaData);
+        benchmark::DoNotOptimize(fieldOffsets.getTotalNumberOfTuples());
+        bufferIdx = (bufferIdx + 1) % rawBuffers.size();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * BUFFER_SIZE));
+}
+
+int main(int argc, char** argv)
+{
+    using enum NES::CSVDelimiterScanner::InstructionSet;
+    benchmark::Initialize(&argc, argv);
+    for (const auto instructionSet : {SCALAR, SSE2, AVX2, AVX512, NEON})
+    {
+        if (not NES::CSVDelimiterScanner::isSupported(instructionSet))
+        {
+            continue;
+        }
+        benchmark::RegisterBenchmark(
+            fmt::format("BM_IndexJSONBuffer/{}", magic_enum::enum_name(instructionSet)), BM_IndexJSONBuffer, instructionSet)
+            ->Setup(setUp)
+            ->Teardown(tearDown)
+            ->ArgsProduct({{4, 16, 64}, {0, 1}});
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
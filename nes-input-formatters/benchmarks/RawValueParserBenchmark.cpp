@@ -0,0 +1,115 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <Util/Strings.hpp>
+#include <benchmark/benchmark.h>
+#include <RawValueParser.hpp>
+
+/// This Benchmark measures the throughput (values/s) of parsing the fields of 'Input/input_sncb.csv'. The first column contains (integer)
+/// timestamps and all other columns contain floating points. We compare from_chars_with_exception with the fast parsers of parseRawValue.
+
+namespace
+{
+constexpr size_t NUMBER_OF_REPETITIONS = 1024;
+
+std::string sncbData;
+std::vector<std::string_view> timestampFields;
+std::vector<std::string_view> floatingPointFields;
+
+void setUp(const benchmark::State&)
+{
+    std::ifstream file(SNCB_INPUT_FILE);
+    const std::string content{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+    for (size_t repetition = 0; repetition < NUMBER_OF_REPETITIONS; ++repetition)
+    {
+        sncbData.append(content);
+    }
+
+    size_t fieldIdx = 0;
+    size_t startOfField = 0;
+    for (size_t position = 0; position < sncbData.size(); ++position)
+    {
+        if (sncbData[position] != ',' and sncbData[position] != '\n')
+        {
+            continue;
+        }
+        const auto field = std::string_view(sncbData).substr(startOfField, position - startOfField);
+        (fieldIdx == 0) ? timestampFields.push_back(field) : floatingPointFields.push_back(field);
+        fieldIdx = (sncbData[position] == '\n') ? 0 : fieldIdx + 1;
+        startOfField = position + 1;
+    }
+}
+
+void tearDown(const benchmark::State&)
+{
+    timestampFields.clear();
+    floatingPointFields.clear();
+    sncbData.clear();
+}
+
+template <typename T, bool UseFastParsers>
+void parseFields(benchmark::State& state, const std::vector<std::string_view>& fields)
+{
+    for (auto _ : state)
+    {
+        for (const auto field : fields)
+        {
+            if constexpr (UseFastParsers)
+            {
+                benchmark::DoNotOptimize(NES::parseRawValue<T>(field));
+            }
+            else
+            {
+                benchmark::DoNotOptimize(NES::Util::from_chars_with_exception<T>(field));
+            }
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * fields.size()));
+}
+}
+
+static void BM_ParseTimestamps(benchmark::State& state)
+{
+    parseFields<uint64_t, false>(state, timestampFields);
+}
+
+static void BM_ParseTimestampsFast(benchmark::State& state)
+{
+    parseFields<uint64_t, true>(state, timestampFields);
+}
+
+static void BM_ParseFloatingPoints(benchmark::State& state)
+{
+    parseFields<double, false>(state, floatingPointFields);
+}
+
+static void BM_ParseFloatingPointsFast(benchmark::State& state)
+{
+    parseFields<double, true>(state, floatingPointFields);
+}
+
+BENCHMARK(BM_ParseTimestamps)->Setup(setUp)->Teardown(tearDown);
+BENCHMARK(BM_ParseTimestampsFast)->Setup(setUp)->Teardown(tearDown);
+BENCHMARK(BM_ParseFloatingPoints)->Setup(setUp)->Teardown(tearDown);
+BENCHMARK(BM_ParseFloatingPointsFast)->Setup(setUp)->Teardown(tearDown);
+
+BENCHMARK_MAIN();
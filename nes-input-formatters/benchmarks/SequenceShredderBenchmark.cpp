@@ -0,0 +1,119 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <benchmark/benchmark.h>
+#include <RawTupleBuffer.hpp>
+#include <SequenceShredder.hpp>
+
+/// This stress benchmark measures the throughput (buffers/s) of the SequenceShredder, if N threads feed it out-of-order sequence numbers.
+/// Each thread claims blocks of sequence numbers and processes the sequence numbers of a block in descending order.
+/// Thus, the threads concurrently process sequence numbers that are up to 'number of threads * block size' apart, which exceeds the initial
+/// size of the STBuffer for larger blocks and forces the SequenceShredder to double the size of its STBuffer.
+/// The first argument is the number of threads, the second the number of sequence numbers per block.
+/// The counters report the number of out-of-range requests and the final size of the STBuffer.
+
+namespace
+{
+constexpr size_t NUMBER_OF_SEQUENCE_NUMBERS = 1 << 18;
+constexpr size_t NUMBER_OF_BUFFERS = 1 << 18;
+
+/// Derives whether the buffer of a sequence number contains a tuple delimiter from the sequence number, to make all runs comparable.
+/// The first and the last buffer always contain tuple delimiters.
+bool hasTupleDelimiter(const uint64_t sequenceNumber)
+{
+    return sequenceNumber == 1 or sequenceNumber == NUMBER_OF_SEQUENCE_NUMBERS or ((sequenceNumber * 0x9E3779B97F4A7C15) >> 63U) == 1;
+}
+
+void processSequenceNumber(NES::SequenceShredder& sequenceShredder, NES::BufferManager& bufferManager, const uint64_t sequenceNumber)
+{
+    auto buffer = bufferManager.getBufferBlocking();
+    buffer.setSequenceNumber(NES::SequenceNumber{sequenceNumber});
+    const auto stagedBuffer = NES::StagedBuffer{NES::RawTupleBuffer{std::move(buffer)}, 0, 0};
+    if (hasTupleDelimiter(sequenceNumber))
+    {
+        /// Repeating out-of-range requests, like the InputFormatterTask does by repeating its task
+        auto leadingSTResult = sequenceShredder.findLeadingSTWithDelimiter(stagedBuffer);
+        while (not leadingSTResult.isInRange)
+        {
+            leadingSTResult = sequenceShredder.findLeadingSTWithDelimiter(stagedBuffer);
+        }
+        benchmark::DoNotOptimize(leadingSTResult);
+        benchmark::DoNotOptimize(sequenceShredder.findTrailingSTWithDelimiter(NES::SequenceNumber{sequenceNumber}));
+        return;
+    }
+    auto result = sequenceShredder.findSTWithoutDelimiter(stagedBuffer);
+    while (not result.isInRange)
+    {
+        result = sequenceShredder.findSTWithoutDelimiter(stagedBuffer);
+    }
+    benchmark::DoNotOptimize(result);
+}
+}
+
+static void BM_SequenceShredderOutOfOrder(benchmark::State& state)
+{
+    const auto numberOfThreads = static_cast<size_t>(state.range(0));
+    const auto sequenceNumbersPerBlock = static_cast<size_t>(state.range(1));
+    const auto bufferManager = NES::BufferManager::create(64, NUMBER_OF_BUFFERS);
+
+    size_t numberOfOutOfRangeRequests = 0;
+    size_t sizeOfSpanningTupleBuffer = 0;
+    for (auto _ : state)
+    {
+        const auto sequenceShredder = std::make_unique<NES::SequenceShredder>(1);
+        std::atomic<uint64_t> nextSequenceNumber{1};
+        {
+            std::vector<std::jthread> threads;
+            for (size_t threadIdx = 0; threadIdx < numberOfThreads; ++threadIdx)
+            {
+                threads.emplace_back(
+                    [&]
+                    {
+                        for (auto firstSequenceNumber = nextSequenceNumber.fetch_add(sequenceNumbersPerBlock);
+                             firstSequenceNumber <= NUMBER_OF_SEQUENCE_NUMBERS;
+                             firstSequenceNumber = nextSequenceNumber.fetch_add(sequenceNumbersPerBlock))
+                        {
+                            const auto lastSequenceNumber
+                                = std::min<uint64_t>(firstSequenceNumber + sequenceNumbersPerBlock - 1, NUMBER_OF_SEQUENCE_NUMBERS);
+                            for (auto sequenceNumber = lastSequenceNumber; sequenceNumber >= firstSequenceNumber; --sequenceNumber)
+                            {
+                                processSequenceNumber(*sequenceShredder, *bufferManager, sequenceNumber);
+                            }
+                        }
+                    });
+            }
+        }
+        numberOfOutOfRangeRequests += sequenceShredder->getNumberOfOutOfRangeRequests();
+        sizeOfSpanningTupleBuffer = sequenceShredder->getSizeOfSpanningTupleBuffer();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * NUMBER_OF_SEQUENCE_NUMBERS));
+    state.counters["outOfRangeRequests"]
+        = benchmark::Counter(static_cast<double>(numberOfOutOfRangeRequests), benchmark::Counter::kAvgIterations);
+    state.counters["sizeOfSTBuffer"] = static_cast<double>(sizeOfSpanningTupleBuffer);
+}
+
+BENCHMARK(BM_SequenceShredderOutOfOrder)->ArgsProduct({{2, 8, 16}, {1, 64, 512}})->UseRealTime()->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,47 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <variant>
+
+namespace NES
+{
+
+/// Comparison of a numeric field of the schema of a source with a constant, e.g., 'deviceId = 42'. An input formatter, which parses its
+/// raw buffers, evaluates the predicates of a source on the raw values of their fields before it parses any other field of a tuple. Tuples
+/// that do not satisfy all predicates are never written into a formatted buffer.
+struct FieldPredicate
+{
+    enum class Comparison : uint8_t
+    {
+        EQUALS,
+        LESS,
+        LESS_EQUALS,
+        GREATER,
+        GREATER_EQUALS
+    };
+
+    /// The parsed value of the field is converted to the type of the constant before the comparison, thus the constant must represent all
+    /// values of the field, e.g., an int64_t for signed integer fields.
+    using Constant = std::variant<int64_t, uint64_t, double>;
+
+    std::string fieldName;
+    Comparison comparison;
+    Constant constant;
+};
+
+}
@@ -14,16 +14,35 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
+#include <optional>
+#include <vector>
 
 #include <DataTypes/Schema.hpp>
 #include <Identifiers/Identifiers.hpp>
+#include <InputFormatters/FieldPredicate.hpp>
 #include <InputFormatters/InputFormatterTaskPipeline.hpp>
+#include <MemoryLayout/MemoryLayout.hpp>
 #include <Sources/SourceDescriptor.hpp>
 
 namespace NES
 {
-std::unique_ptr<InputFormatterTaskPipeline> provideInputFormatterTask(const Schema& schema, const ParserConfig& config);
+/// @param formattedBufferLayout layout that the formatted buffers must have, i.e., the layout that the successors of the source expect.
+/// Defaults to the row layout.
+/// @param parsedFields indexes of the fields of the formatted buffers that the successors of the source read. The input formatter leaves
+/// all other fields of the formatted buffers undefined. Defaults to all fields.
+/// @param formattedSchema fields of the schema that the formatted buffers contain, e.g., the fields that the query reads. The input
+/// formatter does not convert any other field. Defaults to the schema.
+/// @param predicates comparisons on fields of the schema that all tuples, which the successors of the source read, satisfy. The input
+/// formatter does not parse the other tuples. Defaults to no predicates.
+std::unique_ptr<InputFormatterTaskPipeline> provideInputFormatterTask(
+    const Schema& schema,
+    const ParserConfig& config,
+    const std::shared_ptr<MemoryLayout>& formattedBufferLayout = nullptr,
+    std::optional<std::vector<size_t>> parsedFields = std::nullopt,
+    std::optional<Schema> formattedSchema = std::nullopt,
+    std::vector<FieldPredicate> predicates = {});
 
 bool contains(const std::string& parserType);
 }
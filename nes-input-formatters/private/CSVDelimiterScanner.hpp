@@ -0,0 +1,69 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace NES
+{
+
+/// Finds all single-byte tuple and field delimiters in blocks of 64 bytes of raw CSV data, using SIMD instructions.
+/// For each block, the scanner returns two bitmasks, in which bit i is set, if byte i of the block is a (tuple/field) delimiter.
+/// Iterating over the set bits of the masks visits the delimiters in order, without comparing each byte individually.
+class CSVDelimiterScanner
+{
+public:
+    static constexpr size_t BLOCK_SIZE = 64;
+
+    /// SCALAR denotes the byte-by-byte search, which does not use the scanner
+    enum class InstructionSet : uint8_t
+    {
+        SCALAR,
+        SSE2,
+        AVX2,
+        AVX512,
+        NEON
+    };
+
+    struct DelimiterMasks
+    {
+        uint64_t tupleDelimiters;
+        uint64_t fieldDelimiters;
+    };
+
+    /// Returns the widest instruction set that the CPU that we are running on supports.
+    static InstructionSet detectInstructionSet();
+    static bool isSupported(InstructionSet instructionSet);
+
+    /// @param instructionSet must be supported by the CPU and must not be SCALAR
+    CSVDelimiterScanner(char tupleDelimiter, char fieldDelimiter, InstructionSet instructionSet);
+
+    /// Scans up to BLOCK_SIZE bytes. If the block is shorter, the masks do not contain bits beyond the end of the block.
+    [[nodiscard]] DelimiterMasks scan(std::string_view block) const;
+
+    [[nodiscard]] InstructionSet getInstructionSet() const { return instructionSet; }
+
+private:
+    using ScanFunction = DelimiterMasks (*)(const char* block, char tupleDelimiter, char fieldDelimiter);
+
+    char tupleDelimiter;
+    char fieldDelimiter;
+    InstructionSet instructionSet;
+    ScanFunction scanFunction;
+};
+
+}
@@ -15,12 +15,14 @@
 #pragma once
 
 #include <cstddef>
+#include <optional>
 #include <ostream>
 #include <string_view>
 
 #include <DataTypes/Schema.hpp>
 #include <InputFormatters/InputFormatterTaskPipeline.hpp>
 #include <Sources/SourceDescriptor.hpp>
+#include <CSVDelimiterScanner.hpp>
 #include <FieldOffsets.hpp>
 #include <InputFormatIndexer.hpp>
 
@@ -47,7 +49,11 @@ public:
     using IndexerMetaData = CSVMetaData;
     using FieldIndexFunctionType = FieldOffsets<CSV_NUM_OFFSETS_PER_FIELD>;
 
-    explicit CSVInputFormatIndexer(ParserConfig config, size_t numberOfFieldsInSchema);
+    /// Scans for single-byte delimiters with the given instruction set. Multi-byte delimiters and SCALAR use a byte-by-byte search.
+    explicit CSVInputFormatIndexer(
+        ParserConfig config,
+        size_t numberOfFieldsInSchema,
+        CSVDelimiterScanner::InstructionSet instructionSet = CSVDelimiterScanner::detectInstructionSet());
     ~CSVInputFormatIndexer() = default;
 
     void indexRawBuffer(FieldOffsets<CSV_NUM_OFFSETS_PER_FIELD>& fieldOffsets, const RawTupleBuffer& rawBuffer, const CSVMetaData&) const;
@@ -57,6 +63,10 @@ public:
 private:
     ParserConfig config;
     size_t numberOfFieldsInSchema;
+    std::optional<CSVDelimiterScanner> delimiterScanner;
+
+    void indexRawBufferScalar(FieldOffsets<CSV_NUM_OFFSETS_PER_FIELD>& fieldOffsets, const RawTupleBuffer& rawBuffer) const;
+    void indexRawBufferInBlocks(FieldOffsets<CSV_NUM_OFFSETS_PER_FIELD>& fieldOffsets, const RawTupleBuffer& rawBuffer) const;
 };
 
 }
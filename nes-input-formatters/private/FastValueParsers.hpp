@@ -0,0 +1,278 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+
+/// Parsers for the common, well-formed representations of numbers that avoid the allocating, locale-aware standard library paths.
+/// All parsers return std::nullopt for any input that they do not handle, in which case the caller falls back to
+/// Util::from_chars_with_exception, which preserves the established semantics (and error messages) for all other inputs.
+namespace NES::FastValueParsers
+{
+
+/// Checks whether all eight bytes of the (little-endian) chunk are the characters '0' to '9', c.f., Lemire "Fast float parsing".
+constexpr bool isEightDigits(const uint64_t chunk)
+{
+    return (((chunk & 0xF0F0F0F0F0F0F0F0) | (((chunk + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4U)) == 0x3333333333333333);
+}
+
+/// Converts eight digit characters to their value with three multiplications (SWAR) instead of eight dependent multiply-adds
+constexpr uint32_t parseEightDigits(uint64_t chunk)
+{
+    constexpr uint64_t MASK = 0x000000FF000000FF;
+    constexpr uint64_t MULTIPLIER_LOWER = 0x000F424000000064; /// 100 + (1000000 << 32)
+    constexpr uint64_t MULTIPLIER_UPPER = 0x0000271000000001; /// 1 + (10000 << 32)
+    chunk -= 0x3030303030303030;
+    chunk = (chunk * 10) + (chunk >> 8U);
+    chunk = (((chunk & MASK) * MULTIPLIER_LOWER) + (((chunk >> 16U) & MASK) * MULTIPLIER_UPPER)) >> 32U;
+    return static_cast<uint32_t>(chunk);
+}
+
+/// Parses a string that solely consists of up to 19 digits, which always fit into an uint64_t, in chunks of eight digits
+inline std::optional<uint64_t> parseDigits(const std::string_view digits)
+{
+    constexpr size_t MAX_NUMBER_OF_DIGITS = std::numeric_limits<uint64_t>::digits10;
+    if (digits.empty() or digits.size() > MAX_NUMBER_OF_DIGITS)
+    {
+        return std::nullopt;
+    }
+    uint64_t value = 0;
+    size_t position = 0;
+    for (; position + sizeof(uint64_t) <= digits.size(); position += sizeof(uint64_t))
+    {
+        uint64_t chunk = 0;
+        std::memcpy(&chunk, digits.data() + position, sizeof(uint64_t));
+        if constexpr (std::endian::native == std::endian::big)
+        {
+            chunk = std::byteswap(chunk);
+        }
+        if (not isEightDigits(chunk))
+        {
+            return std::nullopt;
+        }
+        value = (value * 100000000) + parseEightDigits(chunk);
+    }
+    for (; position < digits.size(); ++position)
+    {
+        const auto digit = static_cast<uint8_t>(digits[position] - '0');
+        if (digit > 9)
+        {
+            return std::nullopt;
+        }
+        value = (value * 10) + digit;
+    }
+    return value;
+}
+
+/// Parses an optional '-' (for signed types) followed by digits. Returns std::nullopt, if the value does not fit into T.
+template <std::integral T>
+std::optional<T> parseInteger(std::string_view value)
+{
+    bool isNegative = false;
+    if constexpr (std::is_signed_v<T>)
+    {
+        if (not value.empty() and value.front() == '-')
+        {
+            isNegative = true;
+            value.remove_prefix(1);
+        }
+    }
+    const auto magnitude = parseDigits(value);
+    const auto maxMagnitude = static_cast<uint64_t>(std::numeric_limits<T>::max()) + static_cast<uint64_t>(isNegative);
+    if (not magnitude.has_value() or magnitude.value() > maxMagnitude)
+    {
+        return std::nullopt;
+    }
+    /// Negating in the unsigned domain and converting to T is well-defined (modular) since C++20, which covers the minimum of T
+    return static_cast<T>(isNegative ? (0 - magnitude.value()) : magnitude.value());
+}
+
+/// Clinger's fast path, which is also the first step of fast_float: If the decimal significand is exactly representable by T and the
+/// power of ten is exactly representable by T, a single IEEE multiplication or division yields the correctly rounded result.
+/// Accepts an optional '-', digits with an optional '.', and an optional exponent, e.g., '-12.5e3'.
+template <std::floating_point T>
+std::optional<T> parseFloatingPoint(std::string_view value)
+{
+    constexpr int64_t MAX_EXACT_POWER_OF_TEN = std::same_as<T, float> ? 10 : 22;
+    constexpr uint64_t MAX_EXACT_SIGNIFICAND = uint64_t{1} << static_cast<uint64_t>(std::numeric_limits<T>::digits);
+    constexpr auto POWERS_OF_TEN = []
+    {
+        std::array<T, MAX_EXACT_POWER_OF_TEN + 1> powers{};
+        powers[0] = 1;
+        for (size_t i = 1; i < powers.size(); ++i)
+        {
+            powers[i] = powers[i - 1] * 10;
+        }
+        return powers;
+    }();
+
+    const bool isNegative = not value.empty() and value.front() == '-';
+    if (isNegative)
+    {
+        value.remove_prefix(1);
+    }
+
+    uint64_t significand = 0;
+    int64_t exponent = 0;
+    size_t numberOfDigits = 0;
+    size_t position = 0;
+    const auto parseDigitsOfSignificand = [&](const bool isFraction)
+    {
+        for (; position < value.size() and static_cast<uint8_t>(value[position] - '0') <= 9; ++position)
+        {
+            /// More digits might not fit into the significand
+            if (++numberOfDigits > std::numeric_limits<uint64_t>::digits10)
+            {
+                return false;
+            }
+            significand = (significand * 10) + static_cast<uint8_t>(value[position] - '0');
+            exponent -= static_cast<int64_t>(isFraction);
+        }
+        return true;
+    };
+    if (not parseDigitsOfSignificand(false))
+    {
+        return std::nullopt;
+    }
+    if (position < value.size() and value[position] == '.')
+    {
+        ++position;
+        if (not parseDigitsOfSignificand(true))
+        {
+            return std::nullopt;
+        }
+    }
+    if (numberOfDigits == 0)
+    {
+        return std::nullopt;
+    }
+    if (position < value.size() and (value[position] == 'e' or value[position] == 'E'))
+    {
+        ++position;
+        const bool isNegativeExponent = position < value.size() and value[position] == '-';
+        if (position < value.size() and (value[position] == '-' or value[position] == '+'))
+        {
+            ++position;
+        }
+        /// Exponents with more digits exceed the fast path anyway
+        constexpr size_t MAX_DIGITS_OF_EXPONENT = 4;
+        const auto digitsOfExponent = value.substr(position);
+        const auto explicitExponent
+            = (digitsOfExponent.size() <= MAX_DIGITS_OF_EXPONENT) ? parseDigits(digitsOfExponent) : std::optional<uint64_t>{};
+        if (not explicitExponent.has_value())
+        {
+            return std::nullopt;
+        }
+        position = value.size();
+        exponent += isNegativeExponent ? -static_cast<int64_t>(explicitExponent.value()) : static_cast<int64_t>(explicitExponent.value());
+    }
+    if (position != value.size() or significand > MAX_EXACT_SIGNIFICAND or exponent < -MAX_EXACT_POWER_OF_TEN
+        or exponent > MAX_EXACT_POWER_OF_TEN)
+    {
+        return std::nullopt;
+    }
+
+    auto result = static_cast<T>(significand);
+    result = (exponent < 0) ? result / POWERS_OF_TEN[-exponent] : result * POWERS_OF_TEN[exponent];
+    return isNegative ? -result : result;
+}
+
+/// Parses an ISO-8601 timestamp 'YYYY-MM-DDTHH:MM:SS' (or ' ' instead of 'T') with an optional fraction of a second and an optional 'Z'
+/// or '+HH:MM'/'-HH:MM' offset to UTC to the milliseconds since the UNIX epoch. Digits of the fraction beyond milliseconds are truncated.
+inline std::optional<int64_t> parseISO8601ToEpochMilliseconds(const std::string_view value)
+{
+    constexpr size_t SIZE_OF_DATE_TIME = std::string_view{"YYYY-MM-DDTHH:MM:SS"}.size();
+    if (value.size() < SIZE_OF_DATE_TIME or value[4] != '-' or value[7] != '-' or (value[10] != 'T' and value[10] != ' ')
+        or value[13] != ':' or value[16] != ':')
+    {
+        return std::nullopt;
+    }
+    const auto year = parseDigits(value.substr(0, 4));
+    const auto month = parseDigits(value.substr(5, 2));
+    const auto day = parseDigits(value.substr(8, 2));
+    const auto hours = parseDigits(value.substr(11, 2));
+    const auto minutes = parseDigits(value.substr(14, 2));
+    const auto seconds = parseDigits(value.substr(17, 2));
+    if (not(year and month and day and hours and minutes and seconds) or hours.value() > 23 or minutes.value() > 59 or seconds.value() > 59)
+    {
+        return std::nullopt;
+    }
+    const std::chrono::year_month_day date{
+        std::chrono::year{static_cast<int>(year.value())},
+        std::chrono::month{static_cast<unsigned>(month.value())},
+        std::chrono::day{static_cast<unsigned>(day.value())}};
+    if (not date.ok())
+    {
+        return std::nullopt;
+    }
+
+    auto remainder = value.substr(SIZE_OF_DATE_TIME);
+    int64_t milliseconds = 0;
+    if (not remainder.empty() and remainder.front() == '.')
+    {
+        remainder.remove_prefix(1);
+        const auto numberOfFractionDigits = remainder.find_first_not_of("0123456789");
+        const auto fraction = remainder.substr(0, numberOfFractionDigits);
+        if (fraction.empty())
+        {
+            return std::nullopt;
+        }
+        for (size_t i = 0; i < 3; ++i)
+        {
+            milliseconds = (milliseconds * 10) + ((i < fraction.size()) ? fraction[i] - '0' : 0);
+        }
+        remainder.remove_prefix(fraction.size());
+    }
+
+    int64_t offsetInMinutes = 0;
+    if (remainder == "Z")
+    {
+        remainder = {};
+    }
+    else if (remainder.size() == 6 and (remainder.front() == '+' or remainder.front() == '-') and remainder[3] == ':')
+    {
+        const auto offsetHours = parseDigits(remainder.substr(1, 2));
+        const auto offsetMinutes = parseDigits(remainder.substr(4, 2));
+        if (not(offsetHours and offsetMinutes) or offsetHours.value() > 23 or offsetMinutes.value() > 59)
+        {
+            return std::nullopt;
+        }
+        const auto offset = static_cast<int64_t>((offsetHours.value() * 60) + offsetMinutes.value());
+        offsetInMinutes = (remainder.front() == '+') ? offset : -offset;
+        remainder = {};
+    }
+    if (not remainder.empty())
+    {
+        return std::nullopt;
+    }
+
+    const auto secondsSinceEpoch = std::chrono::sys_days{date}.time_since_epoch() + std::chrono::hours{static_cast<int64_t>(hours.value())}
+        + std::chrono::minutes{static_cast<int64_t>(minutes.value()) - offsetInMinutes}
+        + std::chrono::seconds{static_cast<int64_t>(seconds.value())};
+    return std::chrono::duration_cast<std::chrono::milliseconds>(secondsSinceEpoch).count() + milliseconds;
+}
+
+}
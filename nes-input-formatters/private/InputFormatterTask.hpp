@@ -18,18 +18,24 @@
 #include <cstdint>
 #include <cstdlib>
 #include <cstring>
+#include <functional>
 #include <memory>
+#include <optional>
 #include <ostream>
 #include <ranges>
 #include <span>
 #include <sstream>
 #include <string>
 #include <string_view>
+#include <utility>
+#include <variant>
 #include <vector>
 
 #include <DataTypes/DataType.hpp>
 #include <DataTypes/Schema.hpp>
 #include <Identifiers/Identifiers.hpp>
+#include <InputFormatters/FieldPredicate.hpp>
+#include <MemoryLayout/ColumnLayout.hpp>
 #include <Runtime/AbstractBufferProvider.hpp>
 #include <Runtime/TupleBuffer.hpp>
 #include <Sources/SourceDescriptor.hpp>
@@ -56,55 +62,202 @@ inline void setMetadataOfFormattedBuffer(
     formattedBuffer.setOriginId(rawBuffer.getOriginId());
 }
 
-/// Given that we know the number of tuples in a raw buffer, the number of (spanning) tuples that we already wrote into our current formatted
-/// buffer and the max number of tuples that fit into a formatted buffer (given a schema), we can precisely calculate how many formatted buffers
-/// we need to store all tuples from the raw buffer.
-inline size_t calculateNumberOfRequiredFormattedBuffers(
-    const size_t totalNumberOfTuplesInRawBuffer, const size_t numberOfTuplesInFirstFormattedBuffer, const size_t numberOfTuplesPerBuffer)
+/// Parses one field of the formatted schema, i.e., its index in the tuples of the raw buffer and its position in the formatted buffer
+struct FieldParser
 {
-    const auto capacityOfFirstBuffer
-        = std::min(numberOfTuplesPerBuffer - numberOfTuplesInFirstFormattedBuffer, totalNumberOfTuplesInRawBuffer);
-    const auto leftOverTuplesInFirstBuffer = totalNumberOfTuplesInRawBuffer - capacityOfFirstBuffer;
-    /// We need at least one (first) formatted buffer. We need additional buffers if we have leftover raw tuples.
-    /// Overflow-safe calculation of ceil taken from (https://stackoverflow.com/questions/2745074/fast-ceiling-of-an-integer-division-in-c-c)
-    /// 1 + ceil(leftOverTuplesInFirstBuffer / numberOfTuplesPerBuffer)
-    const auto numberOfBuffersToFill = 1
-        + ((leftOverTuplesInFirstBuffer % numberOfTuplesPerBuffer != 0U) ? (leftOverTuplesInFirstBuffer / numberOfTuplesPerBuffer) + 1
-                                                                         : leftOverTuplesInFirstBuffer / numberOfTuplesPerBuffer);
-    return numberOfBuffersToFill;
+    size_t rawFieldIndex;
+    size_t formattedFieldIndex;
+    size_t offsetInRawTupleInBytes; /// offset of the field in a raw tuple, if the raw format has fixed-size tuples
+    size_t offsetInTupleInBytes; /// offset of the field in a row of the formatted buffer
+    size_t sizeInBytes;
+    ParseFunctionSignature parseFunction;
+};
+
+/// Creates the parsers of the fields that the successors read in the order of the formatted schema.
+/// @param formattedSchema fields of the raw schema that the formatted buffers contain, e.g., the fields that a query reads
+/// @param dictionaryEncoding if set, the parsers store the values of var sized fields in the VarSizedDictionary
+/// @param parsedFields indexes of the fields of the formatted schema to parse. If not set, parses all fields.
+inline std::vector<FieldParser> createFieldParsers(
+    const Schema& rawSchema,
+    const Schema& formattedSchema,
+    const QuotationType quotationType,
+    const bool dictionaryEncoding,
+    const std::optional<std::vector<size_t>>& parsedFields)
+{
+    const auto& rawFields = rawSchema.getFields();
+    std::vector<FieldParser> fieldParsers;
+    size_t offsetInTupleInBytes = 0;
+    for (size_t formattedFieldIndex = 0; formattedFieldIndex < formattedSchema.getNumberOfFields(); ++formattedFieldIndex)
+    {
+        const auto field = formattedSchema.getFieldAt(formattedFieldIndex);
+        const auto sizeInBytes = static_cast<size_t>(field.dataType.getSizeInBytes());
+        if (not parsedFields or std::ranges::contains(*parsedFields, formattedFieldIndex))
+        {
+            const auto rawField = std::ranges::find(rawFields, field.name, &Schema::Field::name);
+            INVARIANT(rawField != rawFields.end(), "The formatted field {} is not part of the raw schema {}", field.name, rawSchema);
+            const auto rawFieldIndex = static_cast<size_t>(std::ranges::distance(rawFields.begin(), rawField));
+            size_t offsetInRawTupleInBytes = 0;
+            for (const auto& precedingRawField : rawFields | std::views::take(rawFieldIndex))
+            {
+                offsetInRawTupleInBytes += precedingRawField.dataType.getSizeInBytes();
+            }
+            fieldParsers.emplace_back(
+                rawFieldIndex,
+                formattedFieldIndex,
+                offsetInRawTupleInBytes,
+                offsetInTupleInBytes,
+                sizeInBytes,
+                getParseFunction(field.dataType.type, quotationType, dictionaryEncoding));
+        }
+        offsetInTupleInBytes += sizeInBytes;
+    }
+    return fieldParsers;
+}
+
+/// Evaluates a FieldPredicate on the raw value of its field, i.e., parses solely this field of a tuple
+struct FieldFilter
+{
+    size_t rawFieldIndex;
+    std::function<bool(std::string_view rawFieldValue)> matches;
+};
+
+template <typename FieldType, typename Comparator, typename ConstantType>
+std::function<bool(std::string_view)> createFieldFilterFunction(const ConstantType constant)
+{
+    return [constant](const std::string_view rawFieldValue)
+    { return Comparator{}(static_cast<ConstantType>(parseRawValue<FieldType>(rawFieldValue)), constant); };
+}
+
+template <typename FieldType>
+std::function<bool(std::string_view)> createFieldFilterFunction(const FieldPredicate& predicate)
+{
+    return std::visit(
+        [&]<typename ConstantType>(const ConstantType constant) -> std::function<bool(std::string_view)>
+        {
+            switch (predicate.comparison)
+            {
+                case FieldPredicate::Comparison::EQUALS:
+                    return createFieldFilterFunction<FieldType, std::equal_to<>>(constant);
+                case FieldPredicate::Comparison::LESS:
+                    return createFieldFilterFunction<FieldType, std::less<>>(constant);
+                case FieldPredicate::Comparison::LESS_EQUALS:
+                    return createFieldFilterFunction<FieldType, std::less_equal<>>(constant);
+                case FieldPredicate::Comparison::GREATER:
+                    return createFieldFilterFunction<FieldType, std::greater<>>(constant);
+                case FieldPredicate::Comparison::GREATER_EQUALS:
+                    return createFieldFilterFunction<FieldType, std::greater_equal<>>(constant);
+            }
+            std::unreachable();
+        },
+        predicate.constant);
+}
+
+/// Creates the filters that decide for every raw tuple, whether the InputFormatterTask parses it, from the predicates on the raw schema
+inline std::vector<FieldFilter> createFieldFilters(const Schema& rawSchema, const std::vector<FieldPredicate>& predicates)
+{
+    const auto& rawFields = rawSchema.getFields();
+    std::vector<FieldFilter> fieldFilters;
+    for (const auto& predicate : predicates)
+    {
+        const auto rawField = std::ranges::find(rawFields, predicate.fieldName, &Schema::Field::name);
+        PRECONDITION(
+            rawField != rawFields.end(), "The predicate on {} refers to no field of the raw schema {}", predicate.fieldName, rawSchema);
+        const auto rawFieldIndex = static_cast<size_t>(std::ranges::distance(rawFields.begin(), rawField));
+        switch (rawField->dataType.type)
+        {
+            case DataType::Type::INT8:
+                fieldFilters.emplace_back(rawFieldIndex, createFieldFilterFunction<int8_t>(predicate));
+                break;
+            case DataType::Type::INT16:
+                fieldFilters.emplace_back(rawFieldIndex, createFieldFilterFunction<int16_t>(predicate));
+                break;
+            case DataType::Type::INT32:
+                fieldFilters.emplace_back(rawFieldIndex, createFieldFilterFunction<int32_t>(predicate));
+                break;
+            case DataType::Type::INT64:
+                fieldFilters.emplace_back(rawFieldIndex, createFieldFilterFunction<int64_t>(predicate));
+                break;
+            case DataType::Type::UINT8:
+                fieldFilters.emplace_back(rawFieldIndex, createFieldFilterFunction<uint8_t>(predicate));
+                break;
+            case DataType::Type::UINT16:
+                fieldFilters.emplace_back(rawFieldIndex, createFieldFilterFunction<uint16_t>(predicate));
+                break;
+            case DataType::Type::UINT32:
+                fieldFilters.emplace_back(rawFieldIndex, createFieldFilterFunction<uint32_t>(predicate));
+                break;
+            case DataType::Type::UINT64:
+                fieldFilters.emplace_back(rawFieldIndex, createFieldFilterFunction<uint64_t>(predicate));
+                break;
+            case DataType::Type::FLOAT32:
+                fieldFilters.emplace_back(rawFieldIndex, createFieldFilterFunction<float>(predicate));
+                break;
+            case DataType::Type::FLOAT64:
+                fieldFilters.emplace_back(rawFieldIndex, createFieldFilterFunction<double>(predicate));
+                break;
+            default:
+                PRECONDITION(false, "The predicate on {} requires a numeric field, but got {}", predicate.fieldName, rawField->dataType);
+        }
+    }
+    return fieldFilters;
+}
+
+/// The number of tuples that fit into a formatted buffer. If the formatter writes columns, the column layout of the successor scan
+/// determines the capacity, since the layout fixes the offsets of the columns.
+inline size_t getNumberOfTuplesPerFormattedBuffer(
+    const size_t bufferSize, const SchemaInfo& schemaInfo, const std::shared_ptr<ColumnLayout>& columnLayout)
+{
+    if (columnLayout)
+    {
+        PRECONDITION(
+            bufferSize >= columnLayout->getBufferSize(),
+            "The formatted buffers of size {} are smaller than the buffers of the column layout of size {}.",
+            bufferSize,
+            columnLayout->getBufferSize());
+        return columnLayout->getCapacity();
+    }
+    return bufferSize / schemaInfo.getSizeOfTupleInBytes();
 }
 
 /// Takes a view over the raw bytes of a tuple, and a fieldIndexFunction that knows the field offsets in the raw bytes of the tuple.
-/// Iterates over all fields of the tuple and parses each field using the corresponding 'parse function'.
+/// Parses each field that has a field parser and leaves the bytes of all other fields in the formatted buffer undefined, as no successor
+/// reads them. Writes the tuple row-wise into the formatted buffer, unless a column layout is given.
+/// @return false, if the tuple does not satisfy a field filter. Then, the tuple is not parsed and its slot in the formatted buffer is free.
 template <typename FieldIndexFunctionType>
-void processTuple(
+bool processTuple(
     const std::string_view tupleView,
     const FieldIndexFunction<FieldIndexFunctionType>& fieldIndexFunction,
     const size_t numTuplesReadFromRawBuffer,
     TupleBuffer& formattedBuffer,
     const SchemaInfo& schemaInfo,
-    const std::vector<ParseFunctionSignature>& parseFunctions,
-    AbstractBufferProvider& bufferProvider /// for getting unpooled buffers for varsized data
-)
+    const std::vector<FieldParser>& fieldParsers,
+    const std::vector<FieldFilter>& fieldFilters,
+    AbstractBufferProvider& bufferProvider, /// for getting unpooled buffers for varsized data
+    const ColumnLayout* columnLayout)
 {
+    for (const auto& fieldFilter : fieldFilters)
+    {
+        if (not fieldFilter.matches(fieldIndexFunction.readFieldAt(tupleView, numTuplesReadFromRawBuffer, fieldFilter.rawFieldIndex)))
+        {
+            return false;
+        }
+    }
+
     const size_t currentTupleIdx = formattedBuffer.getNumberOfTuples();
     const size_t offsetOfCurrentTupleInBytes = currentTupleIdx * schemaInfo.getSizeOfTupleInBytes();
-    size_t offsetOfCurrentFieldInBytes = 0;
 
-    /// Currently, we still allow only row-wise writing to the formatted buffer
-    /// This will will change with #496, which implements the InputFormatterTask in Nautilus
+    /// This will change with #496, which implements the InputFormatterTask in Nautilus
     /// The InputFormatterTask then becomes part of a pipeline with a scan/emit phase and has access to the BufferRef
-    for (size_t fieldIndex = 0; fieldIndex < schemaInfo.getFieldSizesInBytes().size(); ++fieldIndex)
+    for (const auto& fieldParser : fieldParsers)
     {
         /// Get the current field, parse it, and write it to the correct position in the formatted buffer
-        const auto currentFieldSV = fieldIndexFunction.readFieldAt(tupleView, numTuplesReadFromRawBuffer, fieldIndex);
-        const auto writeOffsetInBytes = offsetOfCurrentTupleInBytes + offsetOfCurrentFieldInBytes;
-        parseFunctions[fieldIndex](currentFieldSV, writeOffsetInBytes, bufferProvider, formattedBuffer);
-
-        /// Add the size of the current field to the running offset to get the offset of the next field
-        const auto sizeOfCurrentFieldInBytes = schemaInfo.getFieldSizesInBytes().at(fieldIndex);
-        offsetOfCurrentFieldInBytes += sizeOfCurrentFieldInBytes;
+        const auto currentFieldSV = fieldIndexFunction.readFieldAt(tupleView, numTuplesReadFromRawBuffer, fieldParser.rawFieldIndex);
+        const auto writeOffsetInBytes = (columnLayout != nullptr)
+            ? columnLayout->getColumnOffset(fieldParser.formattedFieldIndex) + (currentTupleIdx * fieldParser.sizeInBytes)
+            : offsetOfCurrentTupleInBytes + fieldParser.offsetInTupleInBytes;
+        fieldParser.parseFunction(currentFieldSV, writeOffsetInBytes, bufferProvider, formattedBuffer);
     }
+    return true;
 }
 
 /// Constructs a spanning tuple (string) that spans over at least two buffers (buffersToFormat).
@@ -112,15 +265,18 @@ void processTuple(
 /// Second, appends all bytes of all raw buffers that are not the last buffer to the spanning tuple.
 /// Third, determines the end of the spanning tuple in the last buffer to format. Appends the required bytes to the spanning tuple.
 /// Lastly, formats the full spanning tuple.
+/// @return true, if the spanning tuple is not empty, even if it does not satisfy the field filters
 template <InputFormatIndexerType FormatterType>
-void processSpanningTuple(
+bool processSpanningTuple(
     const std::span<const StagedBuffer> stagedBuffersSpan,
     AbstractBufferProvider& bufferProvider,
     TupleBuffer& formattedBuffer,
     const SchemaInfo& schemaInfo,
     const typename FormatterType::IndexerMetaData& indexerMetaData,
     const FormatterType& inputFormatIndexer,
-    const std::vector<ParseFunctionSignature>& parseFunctions)
+    const std::vector<FieldParser>& fieldParsers,
+    const std::vector<FieldFilter>& fieldFilters,
+    const ColumnLayout* columnLayout)
 {
     INVARIANT(stagedBuffersSpan.size() >= 2, "A spanning tuple must span across at least two buffers");
     /// If the buffers are not empty, there are at least three buffers
@@ -144,15 +300,27 @@ void processSpanningTuple(
 
     const std::string completeSpanningTuple(spanningTupleStringStream.str());
     const auto sizeOfLeadingAndTrailingTupleDelimiter = 2 * indexerMetaData.getTupleDelimitingBytes().size();
-    if (completeSpanningTuple.size() > sizeOfLeadingAndTrailingTupleDelimiter)
+    if (completeSpanningTuple.size() <= sizeOfLeadingAndTrailingTupleDelimiter)
+    {
+        return false;
+    }
+    auto fieldIndexFunction = typename FormatterType::FieldIndexFunctionType(bufferProvider);
+    lastBuffer.setSpanningTuple(completeSpanningTuple);
+    inputFormatIndexer.indexRawBuffer(fieldIndexFunction, lastBuffer.getRawTupleBuffer(), indexerMetaData);
+    if (processTuple<typename FormatterType::FieldIndexFunctionType>(
+            completeSpanningTuple,
+            fieldIndexFunction,
+            0,
+            formattedBuffer,
+            schemaInfo,
+            fieldParsers,
+            fieldFilters,
+            bufferProvider,
+            columnLayout))
     {
-        auto fieldIndexFunction = typename FormatterType::FieldIndexFunctionType(bufferProvider);
-        lastBuffer.setSpanningTuple(completeSpanningTuple);
-        inputFormatIndexer.indexRawBuffer(fieldIndexFunction, lastBuffer.getRawTupleBuffer(), indexerMetaData);
-        processTuple<typename FormatterType::FieldIndexFunctionType>(
-            completeSpanningTuple, fieldIndexFunction, 0, formattedBuffer, schemaInfo, parseFunctions, bufferProvider);
         formattedBuffer.setNumberOfTuples(formattedBuffer.getNumberOfTuples() + 1);
     }
+    return true;
 }
 
 /// InputFormatterTasks concurrently take (potentially) raw input buffers and format all full tuples in these raw input buffers that the
@@ -169,22 +337,38 @@ class InputFormatterTask
 public:
     static constexpr bool hasSpanningTuple() { return FormatterType::HasSpanningTuple; }
 
+    /// @param columnLayout if set, the InputFormatterTask writes the formatted buffers according to the column layout, otherwise row-wise
+    /// @param parsedFields if set, the InputFormatterTask solely parses the fields of the formatted schema with these indexes, as the
+    /// successors read no others
+    /// @param formattedSchema if set, the formatted buffers solely contain these fields of the schema, otherwise all fields
+    /// @param predicates the InputFormatterTask skips all raw tuples that do not satisfy every predicate. Formats that require no
+    /// formatting forward their raw buffers and ignore the predicates, thus the successors must still evaluate them.
     explicit InputFormatterTask(
-        FormatterType inputFormatIndexer, const Schema& schema, const QuotationType quotationType, const ParserConfig& parserConfig)
+        FormatterType inputFormatIndexer,
+        const Schema& schema,
+        const QuotationType quotationType,
+        const ParserConfig& parserConfig,
+        std::shared_ptr<ColumnLayout> columnLayout = nullptr,
+        const std::optional<std::vector<size_t>>& parsedFields = std::nullopt,
+        const std::optional<Schema>& formattedSchema = std::nullopt,
+        const std::vector<FieldPredicate>& predicates = {})
 
         : inputFormatIndexer(std::move(inputFormatIndexer))
-        , schemaInfo(schema)
+        , rawSchemaInfo(schema)
+        , schemaInfo(formattedSchema.value_or(schema))
+        , isProjected(formattedSchema.has_value() and formattedSchema->getNumberOfFields() != schema.getNumberOfFields())
+        , columnLayout(std::move(columnLayout))
         , indexerMetaData(typename FormatterType::IndexerMetaData{parserConfig, schema})
+        , maxBytesPerFormattingTask(parserConfig.maxBytesPerFormattingTask)
         /// Only if we need to resolve spanning tuples, we need the SequenceShredder
         , sequenceShredder(hasSpanningTuple() ? std::make_unique<SequenceShredder>(parserConfig.tupleDelimiter.size()) : nullptr)
 
         /// Since we know the schema, we can create a vector that contains a function that converts the string representation of a field value
-        /// to our internal representation in the correct order. During parsing, we iterate over the fields in each tuple, and, using the current
-        /// field number, load the correct function for parsing from the vector.
-        , parseFunctions(
-              schema.getFields()
-              | std::views::transform([quotationType](const auto& field) { return getParseFunction(field.dataType.type, quotationType); })
-              | std::ranges::to<std::vector>())
+        /// to our internal representation in the correct order. During parsing, we iterate over the parsers of each tuple, which already
+        /// know where to read and write their field. Fields that no successor reads have no parser and are never touched.
+        , fieldParsers(createFieldParsers(
+              schema, formattedSchema.value_or(schema), quotationType, parserConfig.dictionaryEncoding, parsedFields))
+        , fieldFilters(createFieldFilters(schema, predicates))
     {
     }
 
@@ -221,14 +405,26 @@ public:
         /// the InputFormatterTask does not need to do anything.
         /// @Note: with a Nautilus implementation, we can skip the proxy function call that triggers formatting/indexing during tracing,
         /// leading to generated code that immediately operates on the data.
-        const auto [div, mod] = std::lldiv(static_cast<int64_t>(rawBuffer.getNumberOfTuples()), this->schemaInfo.getSizeOfTupleInBytes());
+        const auto [div, mod] = std::lldiv(static_cast<int64_t>(rawBuffer.getNumberOfTuples()), this->rawSchemaInfo.getSizeOfTupleInBytes());
         PRECONDITION(
             mod == 0,
             "Raw buffer contained {} bytes, which is not a multiple of the tuple size {} bytes.",
             rawBuffer.getNumberOfBytes(),
-            this->schemaInfo.getSizeOfTupleInBytes());
+            this->rawSchemaInfo.getSizeOfTupleInBytes());
         /// @Note: We assume that '.getNumberOfBytes()' ALWAYS returns the number of bytes at this point (set by source)
-        const auto numberOfTuplesInFormattedBuffer = rawBuffer.getNumberOfBytes() / this->schemaInfo.getSizeOfTupleInBytes();
+        const auto numberOfTuplesInFormattedBuffer = rawBuffer.getNumberOfBytes() / this->rawSchemaInfo.getSizeOfTupleInBytes();
+        /// An empty raw buffer solely completes its sequence number, which it does in any layout, thus it does not require a copy
+        if ((columnLayout or isProjected) and numberOfTuplesInFormattedBuffer != 0)
+        {
+            /// The native format contains full rows, thus we need to copy the fields into the layout expected by the successor
+            copyFieldsOfRawRows(rawBuffer, numberOfTuplesInFormattedBuffer, pec);
+            return;
+        }
+        if (maxBytesPerFormattingTask != 0 and rawBuffer.getNumberOfBytes() > maxBytesPerFormattingTask)
+        {
+            splitIntoMorsels(rawBuffer, numberOfTuplesInFormattedBuffer, pec);
+            return;
+        }
         rawBuffer.setNumberOfTuples(numberOfTuplesInFormattedBuffer);
         /// The 'rawBuffer' is already formatted, so we can use it without any formatting.
         rawBuffer.emit(pec, PipelineExecutionContext::ContinuationPolicy::POSSIBLE);
@@ -236,6 +432,87 @@ public:
 
     void executeTask(const RawTupleBuffer& rawBuffer, PipelineExecutionContext& pec)
     requires(FormatterType::IsFormattingRequired and hasSpanningTuple())
+    {
+        /// Sources emit each raw buffer as the single (last) chunk of its sequence number. The ranges of a split raw buffer are the chunks
+        /// of the raw buffer and therefore never split again.
+        const auto isRangeOfRawBuffer = rawBuffer.getChunkNumber() != ChunkNumber(ChunkNumber::INITIAL) or not rawBuffer.isLastChunk();
+        if (maxBytesPerFormattingTask != 0 and rawBuffer.getBufferSize() > maxBytesPerFormattingTask and not isRangeOfRawBuffer)
+        {
+            splitIntoFormattingRanges(rawBuffer, pec);
+            return;
+        }
+        formatRawBuffer(rawBuffer, pec);
+    }
+
+    std::ostream& taskToString(std::ostream& os) const
+    {
+        /// Not using fmt::format, because it fails during build, trying to pass sequenceShredder as a const value
+        os << "InputFormatterTask(" << ", inputFormatIndexer: " << inputFormatIndexer << ", sequenceShredder: " << *sequenceShredder
+           << ", maxBytesPerFormattingTask: " << maxBytesPerFormattingTask << ")\n";
+        return os;
+    }
+
+private:
+    FormatterType inputFormatIndexer;
+    SchemaInfo rawSchemaInfo;
+    SchemaInfo schemaInfo; /// of the formatted buffers
+    bool isProjected; /// if set, the formatted buffers contain a subset of the fields of the raw buffers
+    std::shared_ptr<ColumnLayout> columnLayout; /// nullptr, if the successors expect row-wise buffers
+    typename FormatterType::IndexerMetaData indexerMetaData;
+    size_t maxBytesPerFormattingTask; /// zero, if the InputFormatterTask formats, respectively forwards, each raw buffer as a whole
+    std::unique_ptr<SequenceShredder> sequenceShredder; /// unique_ptr, because mutex is not copiable
+    std::vector<FieldParser> fieldParsers;
+    std::vector<FieldFilter> fieldFilters; /// evaluated on every raw tuple before its fields are parsed
+
+    /// Splits a raw buffer into formatting ranges of at most 'maxBytesPerFormattingTask' bytes. Each range is an independent raw buffer
+    /// with a sequence number of its own. Submits a task for all but the first range, which the current task formats itself. Thus, multiple
+    /// worker threads format a large raw buffer concurrently and the SequenceShredder stitches the tuples that span the boundaries of
+    /// ranges, just like it stitches tuples that span raw buffers.
+    /// Copying the bytes into the ranges is cheap compared to formatting them and returns the raw buffer to its source early.
+    void splitIntoFormattingRanges(const RawTupleBuffer& rawBuffer, PipelineExecutionContext& pec)
+    requires(FormatterType::IsFormattingRequired and hasSpanningTuple())
+    {
+        /// All raw buffers of a source share the capacity of the buffers of its pool and therefore split into the same number of ranges.
+        /// The ranges of consecutive raw buffers thus get consecutive sequence numbers.
+        const auto numberOfRanges = (rawBuffer.getBufferSize() + maxBytesPerFormattingTask - 1) / maxBytesPerFormattingTask;
+        const auto sizeOfRangesInBytes = std::max<size_t>(1, (rawBuffer.getNumberOfBytes() + numberOfRanges - 1) / numberOfRanges);
+        const auto firstSequenceNumber
+            = ((rawBuffer.getSequenceNumber().getRawValue() - SequenceNumber::INITIAL) * numberOfRanges) + SequenceNumber::INITIAL;
+
+        const auto bufferProvider = pec.getBufferManager();
+        std::vector<TupleBuffer> ranges;
+        ranges.reserve(numberOfRanges);
+        for (size_t rangeIdx = 0; rangeIdx < numberOfRanges; ++rangeIdx)
+        {
+            auto range = bufferProvider->getUnpooledBuffer(sizeOfRangesInBytes);
+            if (not range.has_value())
+            {
+                throw CannotAllocateBuffer("{}B for a formatting range of a raw buffer were requested", sizeOfRangesInBytes);
+            }
+            /// The last ranges of a partially filled raw buffer may be empty. They still connect their neighbouring ranges.
+            const auto offsetOfRange = std::min(rangeIdx * sizeOfRangesInBytes, rawBuffer.getNumberOfBytes());
+            const auto numberOfBytesInRange = std::min(sizeOfRangesInBytes, rawBuffer.getNumberOfBytes() - offsetOfRange);
+            const auto bytesOfRange = rawBuffer.getBufferView().substr(offsetOfRange, numberOfBytesInRange);
+            std::memcpy(range->getAvailableMemoryArea<char>().data(), bytesOfRange.data(), bytesOfRange.size());
+            range->setNumberOfTuples(numberOfBytesInRange);
+            range->setSequenceNumber(SequenceNumber(firstSequenceNumber + rangeIdx));
+            range->setChunkNumber(ChunkNumber(ChunkNumber::INITIAL + rangeIdx));
+            range->setLastChunk(rangeIdx + 1 == numberOfRanges);
+            range->setOriginId(rawBuffer.getOriginId());
+            range->setWatermark(rawBuffer.getRawBuffer().getWatermark());
+            range->setCreationTimestampInMS(rawBuffer.getRawBuffer().getCreationTimestampInMS());
+            ranges.emplace_back(std::move(range.value()));
+        }
+
+        for (const auto& range : ranges | std::views::drop(1))
+        {
+            pec.submitTask(range);
+        }
+        formatRawBuffer(RawTupleBuffer{std::move(ranges.front())}, pec);
+    }
+
+    void formatRawBuffer(const RawTupleBuffer& rawBuffer, PipelineExecutionContext& pec)
+    requires(FormatterType::IsFormattingRequired and hasSpanningTuple())
     {
         /// Get field delimiter indices of the raw buffer by using the InputFormatIndexer implementation
         auto fieldIndexFunction = typename FormatterType::FieldIndexFunctionType(*pec.getBufferManager());
@@ -257,23 +534,83 @@ public:
         }
     }
 
-    std::ostream& taskToString(std::ostream& os) const
+    /// Splits an oversized raw buffer of rows into morsels of whole tuples of at most 'maxBytesPerFormattingTask' bytes, i.e., one morsel
+    /// fits into the cache of a core. The morsels are the chunks of the sequence number of the raw buffer, thus successors that depend on
+    /// the order of their input, e.g., windows, account for every morsel before they advance the watermark.
+    /// Worker threads pick up all but the last morsel, which the current worker thread continues with.
+    void splitIntoMorsels(const RawTupleBuffer& rawBuffer, const size_t numberOfTuplesInRawBuffer, PipelineExecutionContext& pec) const
     {
-        /// Not using fmt::format, because it fails during build, trying to pass sequenceShredder as a const value
-        os << "InputFormatterTask(" << ", inputFormatIndexer: " << inputFormatIndexer << ", sequenceShredder: " << *sequenceShredder
-           << ")\n";
-        return os;
+        const auto bufferProvider = pec.getBufferManager();
+        const auto rawTupleSize = static_cast<size_t>(this->rawSchemaInfo.getSizeOfTupleInBytes());
+        const auto numberOfTuplesPerMorsel = std::max<size_t>(1, maxBytesPerFormattingTask / rawTupleSize);
+        const auto rawBytes = rawBuffer.getBufferView();
+
+        ChunkNumber::Underlying runningChunkNumber = ChunkNumber::INITIAL;
+        for (size_t numTuplesReadFromRawBuffer = 0; numTuplesReadFromRawBuffer < numberOfTuplesInRawBuffer;)
+        {
+            const auto numberOfTuplesInMorsel = std::min(numberOfTuplesPerMorsel, numberOfTuplesInRawBuffer - numTuplesReadFromRawBuffer);
+            const auto sizeOfMorselInBytes = numberOfTuplesInMorsel * rawTupleSize;
+            auto morsel = sizeOfMorselInBytes <= bufferProvider->getBufferSize()
+                ? std::optional{bufferProvider->getBufferBlocking()}
+                : bufferProvider->getUnpooledBuffer(sizeOfMorselInBytes);
+            if (not morsel.has_value())
+            {
+                throw CannotAllocateBuffer("{}B for a morsel of a raw buffer were requested", sizeOfMorselInBytes);
+            }
+            const auto bytesOfMorsel = rawBytes.substr(numTuplesReadFromRawBuffer * rawTupleSize, sizeOfMorselInBytes);
+            std::memcpy(morsel->getAvailableMemoryArea<char>().data(), bytesOfMorsel.data(), bytesOfMorsel.size());
+            numTuplesReadFromRawBuffer += numberOfTuplesInMorsel;
+            morsel->setNumberOfTuples(numberOfTuplesInMorsel);
+            const auto isLastMorsel = numTuplesReadFromRawBuffer == numberOfTuplesInRawBuffer;
+            setMetadataOfFormattedBuffer(rawBuffer.getRawBuffer(), morsel.value(), runningChunkNumber, isLastMorsel);
+            using enum PipelineExecutionContext::ContinuationPolicy;
+            pec.emitBuffer(morsel.value(), isLastMorsel ? POSSIBLE : NEVER);
+        }
     }
 
-private:
-    FormatterType inputFormatIndexer;
-    SchemaInfo schemaInfo;
-    typename FormatterType::IndexerMetaData indexerMetaData;
-    std::unique_ptr<SequenceShredder> sequenceShredder; /// unique_ptr, because mutex is not copiable
-    std::vector<ParseFunctionSignature> parseFunctions;
+    /// Copies the fields of the fixed-size rows of a native raw buffer field by field into (potentially multiple) formatted buffers,
+    /// which either store the fields in columns or in narrower rows. The raw buffer must contain at least one tuple.
+    void copyFieldsOfRawRows(const RawTupleBuffer& rawBuffer, const size_t numberOfTuplesInRawBuffer, PipelineExecutionContext& pec) const
+    {
+        PRECONDITION(numberOfTuplesInRawBuffer != 0, "Copying the fields of an empty raw buffer would emit an empty formatted buffer");
+        const auto bufferProvider = pec.getBufferManager();
+        const auto numberOfTuplesPerBuffer
+            = getNumberOfTuplesPerFormattedBuffer(bufferProvider->getBufferSize(), this->schemaInfo, this->columnLayout);
+        PRECONDITION(numberOfTuplesPerBuffer != 0, "The capacity of a buffer must suffice to hold at least one tuple.");
+        const auto rawBytes = rawBuffer.getBufferView();
+        const auto rawTupleSize = this->rawSchemaInfo.getSizeOfTupleInBytes();
+
+        ChunkNumber::Underlying runningChunkNumber = ChunkNumber::INITIAL;
+        size_t numTuplesReadFromRawBuffer = 0;
+        do
+        {
+            const auto numberOfTuplesToWrite = std::min(numberOfTuplesPerBuffer, numberOfTuplesInRawBuffer - numTuplesReadFromRawBuffer);
+            auto formattedBuffer = bufferProvider->getBufferBlocking();
+            const auto formattedBytes = formattedBuffer.getAvailableMemoryArea<char>();
+            for (const auto& fieldParser : fieldParsers)
+            {
+                /// A column stores the fields of consecutive tuples next to each other, a row stores the fields of one tuple
+                const auto [firstFieldOffset, fieldStride] = columnLayout
+                    ? std::pair{columnLayout->getColumnOffset(fieldParser.formattedFieldIndex), fieldParser.sizeInBytes}
+                    : std::pair{fieldParser.offsetInTupleInBytes, this->schemaInfo.getSizeOfTupleInBytes()};
+                for (size_t tupleIdx = 0; tupleIdx < numberOfTuplesToWrite; ++tupleIdx)
+                {
+                    const auto* const field
+                        = rawBytes.data() + ((numTuplesReadFromRawBuffer + tupleIdx) * rawTupleSize) + fieldParser.offsetInRawTupleInBytes;
+                    std::memcpy(formattedBytes.data() + firstFieldOffset + (tupleIdx * fieldStride), field, fieldParser.sizeInBytes);
+                }
+            }
+            numTuplesReadFromRawBuffer += numberOfTuplesToWrite;
+            formattedBuffer.setNumberOfTuples(numberOfTuplesToWrite);
+            setMetadataOfFormattedBuffer(
+                rawBuffer.getRawBuffer(), formattedBuffer, runningChunkNumber, numTuplesReadFromRawBuffer == numberOfTuplesInRawBuffer);
+            pec.emitBuffer(formattedBuffer, PipelineExecutionContext::ContinuationPolicy::POSSIBLE);
+        } while (numTuplesReadFromRawBuffer < numberOfTuplesInRawBuffer);
+    }
 
     /// Called by processRawBufferWithTupleDelimiter if the raw buffer contains at least one full tuple.
-    /// Iterates over all full tuples, using the indexes in FieldOffsets and parses the tuples into formatted data.
+    /// Iterates over all full tuples, using the indexes in FieldOffsets, and parses the tuples that pass the field filters.
+    /// Emits a full formatted buffer once the raw buffer holds another tuple, the caller emits the last formatted buffer.
     void parseRawBuffer(
         const RawTupleBuffer& rawBuffer,
         ChunkNumber::Underlying& runningChunkNumber,
@@ -282,49 +619,35 @@ private:
         PipelineExecutionContext& pec) const
     {
         const auto bufferProvider = pec.getBufferManager();
-        const auto numberOfTuplesInFirstFormattedBuffer = formattedBuffer.getNumberOfTuples();
-        const size_t numberOfTuplesPerBuffer = bufferProvider->getBufferSize() / this->schemaInfo.getSizeOfTupleInBytes();
+        const size_t numberOfTuplesPerBuffer
+            = getNumberOfTuplesPerFormattedBuffer(bufferProvider->getBufferSize(), this->schemaInfo, this->columnLayout);
         PRECONDITION(numberOfTuplesPerBuffer != 0, "The capacity of a buffer must suffice to hold at least one tuple.");
-        const auto numberOfBuffersToFill = calculateNumberOfRequiredFormattedBuffers(
-            fieldIndexFunction.getTotalNumberOfTuples(), numberOfTuplesInFirstFormattedBuffer, numberOfTuplesPerBuffer);
-
-        /// Determine the total number of tuples to produce, including potential prior (spanning) tuples
-        /// If the first buffer is full already, the first iteration of the for loop below does 'nothing'
-        size_t numberOfFormattedTuplesToProduce = fieldIndexFunction.getTotalNumberOfTuples() + numberOfTuplesInFirstFormattedBuffer;
-        size_t numTuplesReadFromRawBuffer = 0;
 
-        /// Initialize indexes for offset buffer
-        for (size_t bufferIdx = 0; bufferIdx < numberOfBuffersToFill; ++bufferIdx)
+        for (size_t numTuplesReadFromRawBuffer = 0; numTuplesReadFromRawBuffer < fieldIndexFunction.getTotalNumberOfTuples();
+             ++numTuplesReadFromRawBuffer)
         {
-            /// Either fill the entire buffer, or process the leftover formatted tuples to produce
-            const size_t numberOfTuplesToRead = std::min(numberOfTuplesPerBuffer, numberOfFormattedTuplesToProduce);
-            /// If the current buffer is not the first buffer, set the meta data of the prior buffer, emit it, get a new buffer and reset the associated counters
-            if (bufferIdx != 0)
+            if (formattedBuffer.getNumberOfTuples() >= numberOfTuplesPerBuffer)
             {
                 /// The current raw buffer produces more than one formatted buffer.
                 /// Each formatted buffer has the sequence number of the raw buffer and a chunk number that uniquely identifies it.
                 /// Only the last formatted buffer sets the 'isLastChunk' member to true.
                 setMetadataOfFormattedBuffer(rawBuffer.getRawBuffer(), formattedBuffer, runningChunkNumber, false);
                 pec.emitBuffer(formattedBuffer, PipelineExecutionContext::ContinuationPolicy::POSSIBLE);
-                /// The 'isLastChunk' member of a new buffer is true pre default. If we don't require another buffer, the flag stays true.
                 formattedBuffer = bufferProvider->getBufferBlocking();
             }
-
-            /// Fill current buffer until either full, or we exhausted tuples in raw buffer
-            while (formattedBuffer.getNumberOfTuples() < numberOfTuplesToRead)
-            {
-                processTuple<typename FormatterType::FieldIndexFunctionType>(
+            if (processTuple<typename FormatterType::FieldIndexFunctionType>(
                     rawBuffer.getBufferView(),
                     fieldIndexFunction,
                     numTuplesReadFromRawBuffer,
                     formattedBuffer,
                     this->schemaInfo,
-                    this->parseFunctions,
-                    *bufferProvider);
+                    this->fieldParsers,
+                    this->fieldFilters,
+                    *bufferProvider,
+                    this->columnLayout.get()))
+            {
                 formattedBuffer.setNumberOfTuples(formattedBuffer.getNumberOfTuples() + 1);
-                ++numTuplesReadFromRawBuffer;
             }
-            numberOfFormattedTuplesToProduce -= formattedBuffer.getNumberOfTuples();
         }
     }
 
@@ -350,47 +673,56 @@ private:
 
         /// 1. process leading spanning tuple if required
         auto formattedBuffer = bufferProvider->getBufferBlocking();
+        bool hasProcessedTuples = false;
         if (/* hasLeadingSpanningTuple */ leadingSTBuffers.hasSpanningTuple())
         {
-            processSpanningTuple<FormatterType>(
+            hasProcessedTuples |= processSpanningTuple<FormatterType>(
                 leadingSTBuffers.getSpanningBuffers(),
                 *bufferProvider,
                 formattedBuffer,
                 this->schemaInfo,
                 this->indexerMetaData,
                 this->inputFormatIndexer,
-                this->parseFunctions);
+                this->fieldParsers,
+                this->fieldFilters,
+                this->columnLayout.get());
         }
 
         /// 2. process tuples in buffer
         if (fieldIndexFunction.getTotalNumberOfTuples() > 0)
         {
             parseRawBuffer(rawBuffer, runningChunkNumber, fieldIndexFunction, formattedBuffer, pec);
+            hasProcessedTuples = true;
         }
 
         /// 3. process trailing spanning tuple if required
         if (const auto trailingSTBuffers = sequenceShredder->findTrailingSTWithDelimiter(rawBuffer.getSequenceNumber());
             trailingSTBuffers.hasSpanningTuple())
         {
-            const auto numBytesInFormattedBuffer = formattedBuffer.getNumberOfTuples() * this->schemaInfo.getSizeOfTupleInBytes();
-            if (formattedBuffer.getBufferSize() - numBytesInFormattedBuffer < this->schemaInfo.getSizeOfTupleInBytes())
+            const auto numberOfTuplesPerBuffer
+                = getNumberOfTuplesPerFormattedBuffer(formattedBuffer.getBufferSize(), this->schemaInfo, this->columnLayout);
+            if (formattedBuffer.getNumberOfTuples() >= numberOfTuplesPerBuffer)
             {
                 setMetadataOfFormattedBuffer(rawBuffer.getRawBuffer(), formattedBuffer, runningChunkNumber, false);
                 pec.emitBuffer(formattedBuffer, PipelineExecutionContext::ContinuationPolicy::POSSIBLE);
                 formattedBuffer = bufferProvider->getBufferBlocking();
             }
 
-            processSpanningTuple<FormatterType>(
+            hasProcessedTuples |= processSpanningTuple<FormatterType>(
                 trailingSTBuffers.getSpanningBuffers(),
                 *bufferProvider,
                 formattedBuffer,
                 this->schemaInfo,
                 this->indexerMetaData,
                 this->inputFormatIndexer,
-                this->parseFunctions);
+                this->fieldParsers,
+                this->fieldFilters,
+                this->columnLayout.get());
         }
         /// If a raw buffer contains exactly one delimiter, but does not complete a spanning tuple, the formatted buffer does not contain a tuple
-        if (formattedBuffer.getNumberOfTuples() != 0)
+        /// If the field filters skipped all remaining tuples, the last formatted buffer is empty, but still completes the chunks of the raw
+        /// buffer and advances the watermark of its successors.
+        if (hasProcessedTuples)
         {
             setMetadataOfFormattedBuffer(rawBuffer.getRawBuffer(), formattedBuffer, runningChunkNumber, true);
             pec.emitBuffer(formattedBuffer, PipelineExecutionContext::ContinuationPolicy::POSSIBLE);
@@ -427,7 +759,9 @@ private:
             this->schemaInfo,
             this->indexerMetaData,
             this->inputFormatIndexer,
-            this->parseFunctions);
+            this->fieldParsers,
+            this->fieldFilters,
+            this->columnLayout.get());
 
         formattedBuffer.setSequenceNumber(rawBuffer.getSequenceNumber());
         formattedBuffer.setChunkNumber(ChunkNumber(runningChunkNumber++));
@@ -20,10 +20,12 @@
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <vector>
 
 #include <Configurations/Descriptor.hpp>
 #include <InputFormatters/InputFormatterTaskPipeline.hpp>
 #include <Util/Logger/Logger.hpp>
+#include <CSVDelimiterScanner.hpp>
 #include <FieldOffsets.hpp>
 #include <InputFormatIndexer.hpp>
 
@@ -39,12 +41,13 @@ struct JSONMetaData
         {
             if (const auto& qualifierPosition = field.name.find(Schema::ATTRIBUTE_NAME_SEPARATOR); qualifierPosition != std::string::npos)
             {
-                fieldNameToIndexOffset.emplace(field.name.substr(qualifierPosition + 1), fieldIdx);
+                fieldNames.emplace_back(field.name.substr(qualifierPosition + 1));
             }
             else
             {
-                fieldNameToIndexOffset.emplace(field.name, fieldIdx);
+                fieldNames.emplace_back(field.name);
             }
+            fieldNameToIndexOffset.emplace(fieldNames.back(), fieldIdx);
         }
     };
 
@@ -52,8 +55,12 @@ struct JSONMetaData
 
     const std::unordered_map<std::string, FieldIndex>& getFieldNameToIndexOffset() const { return this->fieldNameToIndexOffset; }
 
+    /// Returns the unqualified field names (JSON keys) in the order of the schema
+    const std::vector<std::string>& getFieldNames() const { return this->fieldNames; }
+
 private:
     std::string tupleDelimiter;
+    std::vector<std::string> fieldNames;
     std::unordered_map<std::string, FieldIndex> fieldNameToIndexOffset;
 };
 
@@ -70,7 +77,11 @@ public:
     static constexpr char FIELD_DELIMITER = ',';
     static constexpr char KEY_QUOTE = '"';
 
-    explicit JSONInputFormatIndexer(const ParserConfig& config, size_t numberOfFieldsInSchema);
+    /// Scans for the structural characters with the given instruction set. SCALAR uses a search per structural character.
+    explicit JSONInputFormatIndexer(
+        const ParserConfig& config,
+        size_t numberOfFieldsInSchema,
+        CSVDelimiterScanner::InstructionSet instructionSet = CSVDelimiterScanner::detectInstructionSet());
     ~JSONInputFormatIndexer() = default;
 
     void indexRawBuffer(FieldOffsets<JSON_NUM_OFFSETS_PER_FIELD>& fieldOffsets, const RawTupleBuffer& rawBuffer, const JSONMetaData&) const;
@@ -79,6 +90,14 @@ public:
 
 private:
     size_t numberOfFieldsInSchema;
+    /// Finds the tuple and field delimiters, respectively the key quotes and key-value delimiters, of a block
+    std::optional<CSVDelimiterScanner> delimiterScanner;
+    std::optional<CSVDelimiterScanner> keyScanner;
+
+    void indexRawBufferScalar(
+        FieldOffsets<JSON_NUM_OFFSETS_PER_FIELD>& fieldOffsets, const RawTupleBuffer& rawBuffer, const JSONMetaData& metaData) const;
+    void indexRawBufferInBlocks(
+        FieldOffsets<JSON_NUM_OFFSETS_PER_FIELD>& fieldOffsets, const RawTupleBuffer& rawBuffer, const JSONMetaData& metaData) const;
 };
 
 struct ConfigParametersJSON
@@ -59,6 +59,8 @@ public:
 
     [[nodiscard]] ChunkNumber getChunkNumber() const noexcept { return rawBuffer.getChunkNumber(); }
 
+    [[nodiscard]] bool isLastChunk() const noexcept { return rawBuffer.isLastChunk(); }
+
     [[nodiscard]] OriginId getOriginId() const noexcept { return rawBuffer.getOriginId(); }
 
     [[nodiscard]] std::string_view getBufferView() const noexcept { return bufferView; }
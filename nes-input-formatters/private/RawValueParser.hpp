@@ -15,14 +15,18 @@
 #pragma once
 
 #include <algorithm>
+#include <concepts>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <span>
 #include <string_view>
+#include <type_traits>
 #include <DataTypes/DataType.hpp>
 #include <Runtime/AbstractBufferProvider.hpp>
 #include <Runtime/TupleBuffer.hpp>
 #include <Util/Strings.hpp>
+#include <FastValueParsers.hpp>
 
 namespace NES
 {
@@ -36,6 +40,36 @@ enum class QuotationType : uint8_t
 using ParseFunctionSignature = std::function<void(
     std::string_view inputString, size_t writeOffsetInBytes, AbstractBufferProvider& bufferProvider, TupleBuffer& tupleBufferFormatted)>;
 
+/// Parses integers and floating points with the fast parsers and falls back to from_chars_with_exception for all other representations.
+/// 64-bit integer fields additionally accept ISO-8601 timestamps, which become the milliseconds since the UNIX epoch.
+template <typename T>
+T parseRawValue(const std::string_view fieldValueString)
+{
+    if constexpr (std::integral<T> and not std::same_as<T, bool> and not std::same_as<T, char>)
+    {
+        if (const auto parsedValue = FastValueParsers::parseInteger<T>(fieldValueString); parsedValue.has_value())
+        {
+            return parsedValue.value();
+        }
+        if constexpr (sizeof(T) == sizeof(int64_t))
+        {
+            if (const auto timestamp = FastValueParsers::parseISO8601ToEpochMilliseconds(fieldValueString);
+                timestamp.has_value() and (std::is_signed_v<T> or timestamp.value() >= 0))
+            {
+                return static_cast<T>(timestamp.value());
+            }
+        }
+    }
+    else if constexpr (std::floating_point<T>)
+    {
+        if (const auto parsedValue = FastValueParsers::parseFloatingPoint<T>(fieldValueString); parsedValue.has_value())
+        {
+            return parsedValue.value();
+        }
+    }
+    return Util::from_chars_with_exception<T>(fieldValueString);
+}
+
 /// Takes a target integer type and an integer value represented as a string. Attempts to parse the string to a C++ integer of the target type.
 /// @Note throws CannotFormatMalformedStringValue if the parsing fails.
 /// @Note given a string like '0751' and an integer value, from_chars creates an integer '751' from it. Also, '0.751' becomes '0'.
@@ -47,7 +81,7 @@ auto parseFieldString()
               AbstractBufferProvider&,
               TupleBuffer& tupleBufferFormatted)
     {
-        const T parsedValue = Util::from_chars_with_exception<T>(fieldValueString);
+        const T parsedValue = parseRawValue<T>(fieldValueString);
         const auto parsedValueBytes = std::as_bytes<const T>(std::span<const T>{&parsedValue, 1});
         std::ranges::copy(parsedValueBytes, tupleBufferFormatted.getAvailableMemoryArea().begin() + writeOffsetInBytes);
     };
@@ -63,12 +97,13 @@ auto parseQuotedFieldString()
     {
         INVARIANT(quotedFieldValueString.length() >= 2, "Input string must be at least 2 characters long.");
         const auto fieldValueString = quotedFieldValueString.substr(1, quotedFieldValueString.length() - 2);
-        const T parsedValue = Util::from_chars_with_exception<T>(fieldValueString);
+        const T parsedValue = parseRawValue<T>(fieldValueString);
         const auto parsedValueBytes = std::as_bytes<const T>(std::span<const T>{&parsedValue, 1});
         std::ranges::copy(parsedValueBytes, tupleBufferFormatted.getAvailableMemoryArea().begin() + writeOffsetInBytes);
     };
 }
 
 /// Takes a vector containing parse function for fields. Adds a parse function that parses strings to the vector.
-ParseFunctionSignature getParseFunction(DataType::Type physicalType, QuotationType quotationType);
+/// @param dictionaryEncoding if set, the parse function of var sized fields stores the values in the VarSizedDictionary
+ParseFunctionSignature getParseFunction(DataType::Type physicalType, QuotationType quotationType, bool dictionaryEncoding = false);
 }
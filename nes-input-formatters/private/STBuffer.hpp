@@ -76,6 +76,15 @@ public:
 
     explicit STBuffer(size_t initialSize, TupleBuffer dummyBuffer);
 
+    /// Constructs an STBuffer with twice the size of 'smallerBuffer' and moves all entries of 'smallerBuffer' into it.
+    /// The entry of a sequence number (SN) moves to the index 'SN % (2 * size)' and gets the abaItNo of the SN in the larger STBuffer.
+    /// An entry with an SN replaced the (used up) entry with the SN 'SN - size', which gets its own index in the larger STBuffer. Thus, we
+    /// mark that index as used up, which allows the buffer with the SN 'SN + size' to take the index.
+    /// Requires that no other thread accesses 'smallerBuffer' during the construction.
+    explicit STBuffer(STBuffer& smallerBuffer);
+
+    [[nodiscard]] size_t getSize() const { return buffer.size(); }
+
     /// First, checks if the prior entry at the index of 'sequenceNumber' contains the expected prior ABA iteration number and is used up
     /// If not, returns as 'NOT_IN_RANGE'
     /// Otherwise, searches for valid spanning tuples and on finding a spanning tuple, tries to claim the first buffer of the spanning tuple
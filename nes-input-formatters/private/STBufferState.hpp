@@ -17,6 +17,7 @@
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <new>
 #include <optional>
 #include <ostream>
@@ -69,6 +70,10 @@ class AtomicState
     /// The STBuffer initializes the very first entry with a dummy buffer and a matching dummy state to trigger the first leading ST
     /// Tag: 1, HasTupleDelimiter: True, ClaimedSpanningTuple: False, UsedLeading: True, UsedTrailing: False
     static constexpr uint64_t firstEntryDummy = (1ULL | hasTupleDelimiterBit | usedLeadingBufferBit);
+    /// The STBuffer sets entries to the 'usedUpState' that represent buffers whose spanning tuples are resolved when it doubles its size
+    /// Tag: -, HasTupleDelimiter: True, ClaimedSpanningTuple: True, UsedLeading: True, UsedTrailing: True
+    static constexpr uint64_t usedUpState = (hasTupleDelimiterBit | claimedSpanningTupleBit | usedLeadingAndTrailingBufferBits);
+    static constexpr uint64_t abaItNoBits = std::numeric_limits<uint32_t>::max();
 
     /// [1-32] : Iteration Tag:        protects against ABA and tells threads whether buffer is from the same iteration during ST search
     /// [33]   : HasTupleDelimiter:    when set, threads stop spanning tuple (ST) search, since the buffer represents a possible start/end
@@ -125,6 +130,14 @@ class AtomicState
 
     void setUsedLeadingAndTrailingBuffer() { this->state |= usedLeadingAndTrailingBufferBits; }
 
+    /// Keeps all bits of 'other', except for the abaItNo, which changes if the STBuffer changes its size
+    void setStateWithABAItNo(const BitmapState other, const ABAItNo abaItNumber)
+    {
+        this->state = (other.getBitmapState() & ~abaItNoBits) | abaItNumber.getRawValue();
+    }
+
+    void setUsedUpState(const ABAItNo abaItNumber) { this->state = (usedUpState | abaItNumber.getRawValue()); }
+
     friend std::ostream& operator<<(std::ostream& os, const AtomicState& atomicBitmapState);
 
     std::atomic<uint64_t> state;
@@ -174,6 +187,16 @@ public:
     /// Atomically loads the state of an entry, checks if its ABA iteration number matches the expected and if it has a tuple delimiter
     [[nodiscard]] EntryState getEntryState(ABAItNo expectedABAItNo) const;
 
+    [[nodiscard]] ABAItNo getABAItNo() const { return this->atomicState.getABAItNo(); }
+
+    /// Moves the buffer references, the offsets and the state of 'other' into this entry, replacing the ABA iteration number of 'other' by
+    /// 'abaItNumber'. Requires that no other thread accesses either entry, i.e., the STBuffer must be locked exclusively while resizing.
+    void moveFromEntryOfSmallerSTBuffer(STBufferEntry& other, ABAItNo abaItNumber);
+
+    /// Represents a buffer whose spanning tuples are resolved already, i.e., a buffer that a new buffer with 'abaItNumber + 1' may replace.
+    /// Since it has a delimiter and a claimed spanning tuple, searches stop at the entry without claiming a spanning tuple that uses it.
+    void setUsedUp(ABAItNo abaItNumber);
+
     /// Iterates over all STBufferEntries, checking that they don't hold any buffer references if they should not and that their atomic
     /// bitmap state is correct. Logs errors and returns 'false' if at least one entry is in an invalid state
     [[nodiscard]] bool validateFinalState(STBufferIdx bufferIdx, const STBufferEntry& nextEntry, STBufferIdx lastIdxOfBuffer) const;
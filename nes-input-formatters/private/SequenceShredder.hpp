@@ -14,10 +14,12 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <ostream>
+#include <shared_mutex>
 #include <utility>
 #include <vector>
 #include <Identifiers/Identifiers.hpp>
@@ -71,11 +73,18 @@ struct SequenceShredderResult
 
 /// The SequenceShredder concurrently takes StagedBuffers and uses a (thread-safe) spanning tuple buffer (STBuffer) to determine whether
 /// the provided buffer completes spanning tuples with buffers that (usually) other threads processed
-/// (Planned) The SequenceShredder keeps track of sequence numbers that were not in range of the STBuffer
-/// (Planned) Given enough out-of-range requests, the SequenceShredder doubles the size of the STBuffer
+/// The SequenceShredder keeps track of the requests with sequence numbers that were not in range of the STBuffer. A sequence number is out
+/// of range, if it is at least 'size of STBuffer' sequence numbers ahead of a sequence number whose spanning tuples are not resolved yet.
+/// The InputFormatterTask repeats the tasks of such buffers. Thus, many out-of-range requests signal that the STBuffer is too small for
+/// the number of buffers that the formatter threads process concurrently (out of order).
+/// Given OUT_OF_RANGE_REQUESTS_PER_RESIZE out-of-range requests, the SequenceShredder doubles the size of the STBuffer (up to
+/// MAX_SIZE_OF_ST_BUFFER). All threads access the STBuffer concurrently, synchronizing via the atomic states of its entries, and solely
+/// share a lock, which the thread that doubles the size of the STBuffer acquires exclusively.
 class SequenceShredder
 {
     static constexpr size_t INITIAL_SIZE_OF_ST_BUFFER = 1024;
+    static constexpr size_t MAX_SIZE_OF_ST_BUFFER = 64 * INITIAL_SIZE_OF_ST_BUFFER;
+    static constexpr size_t OUT_OF_RANGE_REQUESTS_PER_RESIZE = 64;
 
 public:
     explicit SequenceShredder(size_t sizeOfTupleDelimiterInBytes);
@@ -84,8 +93,8 @@ public:
 
     SequenceShredder(const SequenceShredder&) = delete;
     SequenceShredder& operator=(const SequenceShredder&) = delete;
-    SequenceShredder(SequenceShredder&&) = default;
-    SequenceShredder& operator=(SequenceShredder&&) = default;
+    SequenceShredder(SequenceShredder&&) = delete;
+    SequenceShredder& operator=(SequenceShredder&&) = delete;
 
     /// Uses the STBuffer to thread-safely determine whether the 'indexedRawBuffer' with the given 'sequenceNumber'
     /// completes spanning tuples and whether the calling thread is the first to claim the individual spanning tuples
@@ -95,8 +104,24 @@ public:
 
     friend std::ostream& operator<<(std::ostream& os, const SequenceShredder& sequenceShredder);
 
+    [[nodiscard]] size_t getSizeOfSpanningTupleBuffer() const;
+    [[nodiscard]] size_t getNumberOfOutOfRangeRequests() const { return numberOfOutOfRangeRequests.load(); }
+
 private:
     std::unique_ptr<STBuffer> spanningTupleBuffer;
+    mutable std::shared_mutex spanningTupleBufferMutex;
+    std::atomic<size_t> numberOfOutOfRangeRequests{0};
+    /// Counts the out-of-range requests since the last resize
+    std::atomic<size_t> numberOfOutOfRangeRequestsSinceResize{0};
+
+    /// Counts the out-of-range request and doubles the size of the STBuffer, if the request is the OUT_OF_RANGE_REQUESTS_PER_RESIZE-th
+    /// since the last resize. 'sizeOfSpanningTupleBuffer' is the size of the STBuffer that the request was not in range of.
+    /// Returns whether the size of the STBuffer changed since the request, in which case the request may be in range now.
+    bool trackOutOfRangeRequest(SequenceNumber sequenceNumber, size_t sizeOfSpanningTupleBuffer);
+
+    /// Calls 'stSearch' with the STBuffer and retries once, if the sequence number was out of range, but the STBuffer grew in the meantime
+    template <typename STSearch>
+    SequenceShredderResult searchInRangeOfSTBuffer(SequenceNumber sequenceNumber, const STSearch& stSearch);
 
     /// Enable 'ConcurrentSynchronizationTest' to used mocked buffer and provide 'sequenceNumber' as additional argument
     friend ConcurrentSynchronizationTest;
@@ -16,12 +16,16 @@
 
 #include <cstddef>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include <DataTypes/Schema.hpp>
 #include <Identifiers/Identifiers.hpp>
+#include <InputFormatters/FieldPredicate.hpp>
 #include <InputFormatters/InputFormatterTaskPipeline.hpp>
+#include <MemoryLayout/ColumnLayout.hpp>
 #include <Sources/SourceDescriptor.hpp>
 #include <Util/Registry.hpp>
 #include <Concepts.hpp>
@@ -37,8 +41,19 @@ using InputFormatIndexerRegistryReturnType = std::unique_ptr<InputFormatterTaskP
 /// Calls constructor of specific InputFormatter and exposes public members to it.
 struct InputFormatIndexerRegistryArguments
 {
-    InputFormatIndexerRegistryArguments(ParserConfig config, const Schema& schema)
-        : inputFormatIndexerConfig(std::move(config)), schema(schema)
+    InputFormatIndexerRegistryArguments(
+        ParserConfig config,
+        const Schema& schema,
+        std::shared_ptr<ColumnLayout> columnLayout = nullptr,
+        std::optional<std::vector<size_t>> parsedFields = std::nullopt,
+        std::optional<Schema> formattedSchema = std::nullopt,
+        std::vector<FieldPredicate> predicates = {})
+        : inputFormatIndexerConfig(std::move(config))
+        , schema(schema)
+        , columnLayout(std::move(columnLayout))
+        , parsedFields(std::move(parsedFields))
+        , formattedSchema(std::move(formattedSchema))
+        , predicates(std::move(predicates))
     {
     }
 
@@ -48,8 +63,15 @@ struct InputFormatIndexerRegistryArguments
     template <InputFormatIndexerType FormatterType>
     InputFormatIndexerRegistryReturnType createInputFormatterTaskPipeline(FormatterType inputFormatter, const QuotationType quotationType)
     {
-        auto inputFormatterTask
-            = InputFormatterTask<FormatterType>(std::move(inputFormatter), schema, quotationType, inputFormatIndexerConfig);
+        auto inputFormatterTask = InputFormatterTask<FormatterType>(
+            std::move(inputFormatter),
+            schema,
+            quotationType,
+            inputFormatIndexerConfig,
+            columnLayout,
+            parsedFields,
+            formattedSchema,
+            predicates);
         return std::make_unique<InputFormatterTaskPipeline>(std::move(inputFormatterTask));
     }
 
@@ -59,6 +81,10 @@ struct InputFormatIndexerRegistryArguments
 
 private:
     Schema schema;
+    std::shared_ptr<ColumnLayout> columnLayout;
+    std::optional<std::vector<size_t>> parsedFields;
+    std::optional<Schema> formattedSchema;
+    std::vector<FieldPredicate> predicates;
 };
 
 class InputFormatIndexerRegistry : public BaseRegistry<
@@ -0,0 +1,206 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <CSVDelimiterScanner.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <ErrorHandling.hpp>
+#include <magic_enum/magic_enum.hpp>
+
+#if defined(__x86_64__)
+    #include <immintrin.h>
+#elif defined(__aarch64__)
+    #include <arm_neon.h>
+#endif
+
+namespace NES
+{
+
+namespace
+{
+#if defined(__x86_64__)
+/// SSE2 is part of the x86-64 baseline, thus it does not require a target attribute
+CSVDelimiterScanner::DelimiterMasks scanSSE2(const char* block, const char tupleDelimiter, const char fieldDelimiter)
+{
+    const auto tupleDelimiterVector = _mm_set1_epi8(tupleDelimiter);
+    const auto fieldDelimiterVector = _mm_set1_epi8(fieldDelimiter);
+    CSVDelimiterScanner::DelimiterMasks masks{0, 0};
+    for (size_t i = 0; i < CSVDelimiterScanner::BLOCK_SIZE; i += sizeof(__m128i))
+    {
+        const auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + i)); /// NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        const auto tupleBits = static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, tupleDelimiterVector)));
+        const auto fieldBits = static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, fieldDelimiterVector)));
+        masks.tupleDelimiters |= static_cast<uint64_t>(tupleBits) << i;
+        masks.fieldDelimiters |= static_cast<uint64_t>(fieldBits) << i;
+    }
+    return masks;
+}
+
+__attribute__((target("avx2"))) CSVDelimiterScanner::DelimiterMasks
+scanAVX2(const char* block, const char tupleDelimiter, const char fieldDelimiter)
+{
+    const auto tupleDelimiterVector = _mm256_set1_epi8(tupleDelimiter);
+    const auto fieldDelimiterVector = _mm256_set1_epi8(fieldDelimiter);
+    /// NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+    const auto lowerBytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block));
+    const auto upperBytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + sizeof(__m256i)));
+    /// NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+    const auto toMask = [](const __m256i lower, const __m256i upper) __attribute__((target("avx2")))
+    {
+        const auto lowerBits = static_cast<uint32_t>(_mm256_movemask_epi8(lower));
+        const auto upperBits = static_cast<uint32_t>(_mm256_movemask_epi8(upper));
+        return (static_cast<uint64_t>(upperBits) << 32U) | lowerBits;
+    };
+    return {
+        .tupleDelimiters
+        = toMask(_mm256_cmpeq_epi8(lowerBytes, tupleDelimiterVector), _mm256_cmpeq_epi8(upperBytes, tupleDelimiterVector)),
+        .fieldDelimiters
+        = toMask(_mm256_cmpeq_epi8(lowerBytes, fieldDelimiterVector), _mm256_cmpeq_epi8(upperBytes, fieldDelimiterVector))};
+}
+
+__attribute__((target("avx512bw"))) CSVDelimiterScanner::DelimiterMasks
+scanAVX512(const char* block, const char tupleDelimiter, const char fieldDelimiter)
+{
+    const auto bytes = _mm512_loadu_si512(block);
+    return {
+        .tupleDelimiters = _mm512_cmpeq_epi8_mask(bytes, _mm512_set1_epi8(tupleDelimiter)),
+        .fieldDelimiters = _mm512_cmpeq_epi8_mask(bytes, _mm512_set1_epi8(fieldDelimiter))};
+}
+#endif
+
+#if defined(__aarch64__)
+/// NEON lacks a movemask instruction. We select one bit per byte, and reduce the four 16 byte vectors to one 64 bit mask
+/// with pairwise additions.
+uint64_t toMaskNEON(const uint8x16_t matches0, const uint8x16_t matches1, const uint8x16_t matches2, const uint8x16_t matches3)
+{
+    constexpr std::array<uint8_t, 16> BIT_PATTERN = {0x01, 0x02, 0x4, 0x8, 0x10, 0x20, 0x40, 0x80, 0x01, 0x02, 0x4, 0x8, 0x10, 0x20, 0x40, 0x80};
+    const auto bitPattern = vld1q_u8(BIT_PATTERN.data());
+    const auto sum0 = vpaddq_u8(vandq_u8(matches0, bitPattern), vandq_u8(matches1, bitPattern));
+    const auto sum1 = vpaddq_u8(vandq_u8(matches2, bitPattern), vandq_u8(matches3, bitPattern));
+    const auto sum2 = vpaddq_u8(sum0, sum1);
+    const auto sum3 = vpaddq_u8(sum2, sum2);
+    return vgetq_lane_u64(vreinterpretq_u64_u8(sum3), 0);
+}
+
+CSVDelimiterScanner::DelimiterMasks scanNEON(const char* block, const char tupleDelimiter, const char fieldDelimiter)
+{
+    /// NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+    const auto* bytes = reinterpret_cast<const uint8_t*>(block);
+    /// NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+    const std::array<uint8x16_t, 4> vectors{vld1q_u8(bytes), vld1q_u8(bytes + 16), vld1q_u8(bytes + 32), vld1q_u8(bytes + 48)};
+    const auto toMask = [&vectors](const uint8x16_t delimiter)
+    {
+        return toMaskNEON(
+            vceqq_u8(vectors[0], delimiter), vceqq_u8(vectors[1], delimiter), vceqq_u8(vectors[2], delimiter), vceqq_u8(vectors[3], delimiter));
+    };
+    return {
+        .tupleDelimiters = toMask(vdupq_n_u8(static_cast<uint8_t>(tupleDelimiter))),
+        .fieldDelimiters = toMask(vdupq_n_u8(static_cast<uint8_t>(fieldDelimiter)))};
+}
+#endif
+}
+
+CSVDelimiterScanner::InstructionSet CSVDelimiterScanner::detectInstructionSet()
+{
+    for (const auto instructionSet : {InstructionSet::AVX512, InstructionSet::AVX2, InstructionSet::SSE2, InstructionSet::NEON})
+    {
+        if (isSupported(instructionSet))
+        {
+            return instructionSet;
+        }
+    }
+    return InstructionSet::SCALAR;
+}
+
+bool CSVDelimiterScanner::isSupported(const InstructionSet instructionSet)
+{
+    switch (instructionSet)
+    {
+        case InstructionSet::SCALAR:
+            return true;
+#if defined(__x86_64__)
+        case InstructionSet::SSE2:
+            return true;
+        case InstructionSet::AVX2:
+            return __builtin_cpu_supports("avx2");
+        case InstructionSet::AVX512:
+            return __builtin_cpu_supports("avx512bw");
+        case InstructionSet::NEON:
+            return false;
+#elif defined(__aarch64__)
+        case InstructionSet::NEON:
+            return true;
+        case InstructionSet::SSE2:
+        case InstructionSet::AVX2:
+        case InstructionSet::AVX512:
+            return false;
+#else
+        default:
+            return false;
+#endif
+    }
+    return false;
+}
+
+CSVDelimiterScanner::CSVDelimiterScanner(const char tupleDelimiter, const char fieldDelimiter, const InstructionSet instructionSet)
+    : tupleDelimiter(tupleDelimiter), fieldDelimiter(fieldDelimiter), instructionSet(instructionSet), scanFunction(nullptr)
+{
+    PRECONDITION(
+        instructionSet != InstructionSet::SCALAR and isSupported(instructionSet),
+        "The CPU does not support the {} instruction set",
+        magic_enum::enum_name(instructionSet));
+    switch (instructionSet)
+    {
+#if defined(__x86_64__)
+        case InstructionSet::SSE2:
+            scanFunction = &scanSSE2;
+            break;
+        case InstructionSet::AVX2:
+            scanFunction = &scanAVX2;
+            break;
+        case InstructionSet::AVX512:
+            scanFunction = &scanAVX512;
+            break;
+#elif defined(__aarch64__)
+        case InstructionSet::NEON:
+            scanFunction = &scanNEON;
+            break;
+#endif
+        default:
+            break;
+    }
+    INVARIANT(scanFunction != nullptr, "No scan function for the {} instruction set", magic_enum::enum_name(instructionSet));
+}
+
+CSVDelimiterScanner::DelimiterMasks CSVDelimiterScanner::scan(const std::string_view block) const
+{
+    if (block.size() >= BLOCK_SIZE)
+    {
+        return scanFunction(block.data(), tupleDelimiter, fieldDelimiter);
+    }
+    /// Copy the trailing bytes of a buffer into a full block, to not read beyond the end of the buffer.
+    std::array<char, BLOCK_SIZE> paddedBlock{};
+    std::memcpy(paddedBlock.data(), block.data(), block.size());
+    auto masks = scanFunction(paddedBlock.data(), tupleDelimiter, fieldDelimiter);
+    const auto validBits = (block.empty()) ? 0 : (~uint64_t{0} >> (BLOCK_SIZE - block.size()));
+    masks.tupleDelimiters &= validBits;
+    masks.fieldDelimiters &= validBits;
+    return masks;
+}
+
+}
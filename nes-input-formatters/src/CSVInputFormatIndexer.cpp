@@ -14,7 +14,10 @@
 
 #include <CSVInputFormatIndexer.hpp>
 
+#include <bit>
 #include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <ostream>
 #include <string>
 #include <string_view>
@@ -23,6 +26,7 @@
 #include <InputFormatters/InputFormatterTaskPipeline.hpp>
 #include <Sources/SourceDescriptor.hpp>
 #include <fmt/format.h>
+#include <CSVDelimiterScanner.hpp>
 #include <ErrorHandling.hpp>
 #include <FieldOffsets.hpp>
 #include <InputFormatIndexerRegistry.hpp>
@@ -63,16 +67,32 @@ void initializeIndexFunctionForTuple(
 namespace NES
 {
 
-CSVInputFormatIndexer::CSVInputFormatIndexer(ParserConfig config, const size_t numberOfFieldsInSchema)
+CSVInputFormatIndexer::CSVInputFormatIndexer(
+    ParserConfig config, const size_t numberOfFieldsInSchema, const CSVDelimiterScanner::InstructionSet instructionSet)
     : config(std::move(config)), numberOfFieldsInSchema(numberOfFieldsInSchema)
 {
+    const auto hasSingleByteDelimiters = this->config.tupleDelimiter.size() == 1 and this->config.fieldDelimiter.size() == 1
+        and this->config.tupleDelimiter != this->config.fieldDelimiter;
+    if (hasSingleByteDelimiters and instructionSet != CSVDelimiterScanner::InstructionSet::SCALAR)
+    {
+        delimiterScanner.emplace(this->config.tupleDelimiter.front(), this->config.fieldDelimiter.front(), instructionSet);
+    }
 }
 
 void CSVInputFormatIndexer::indexRawBuffer(
     FieldOffsets<CSV_NUM_OFFSETS_PER_FIELD>& fieldOffsets, const RawTupleBuffer& rawBuffer, const CSVMetaData&) const
 {
     fieldOffsets.startSetup(numberOfFieldsInSchema, this->config.fieldDelimiter.size());
+    if (delimiterScanner.has_value())
+    {
+        indexRawBufferInBlocks(fieldOffsets, rawBuffer);
+        return;
+    }
+    indexRawBufferScalar(fieldOffsets, rawBuffer);
+}
 
+void CSVInputFormatIndexer::indexRawBufferScalar(FieldOffsets<CSV_NUM_OFFSETS_PER_FIELD>& fieldOffsets, const RawTupleBuffer& rawBuffer) const
+{
     const auto sizeOfTupleDelimiter = this->config.tupleDelimiter.size();
     const auto offsetOfFirstTupleDelimiter = static_cast<FieldIndex>(rawBuffer.getBufferView().find(this->config.tupleDelimiter));
 
@@ -108,6 +128,68 @@ void CSVInputFormatIndexer::indexRawBuffer(
     fieldOffsets.markWithTupleDelimiters(offsetOfFirstTupleDelimiter, offsetOfLastTupleDelimiter);
 }
 
+/// Visits the tuple and field delimiters of the buffer in a single pass, by iterating over the set bits of the delimiter masks of each block.
+/// Field delimiters before the first tuple delimiter belong to a spanning tuple, which the InputFormatterTask indexes separately.
+/// Field delimiters after the last tuple delimiter belong to a partial tuple, whose offsets we write, but never commit via 'writeOffsetsOfNextTuple'.
+void CSVInputFormatIndexer::indexRawBufferInBlocks(FieldOffsets<CSV_NUM_OFFSETS_PER_FIELD>& fieldOffsets, const RawTupleBuffer& rawBuffer) const
+{
+    constexpr auto NO_TUPLE_DELIMITER = std::numeric_limits<FieldIndex>::max();
+    const auto bufferView = rawBuffer.getBufferView();
+    const auto numberOfFields = static_cast<FieldIndex>(this->numberOfFieldsInSchema);
+
+    auto offsetOfFirstTupleDelimiter = NO_TUPLE_DELIMITER;
+    auto offsetOfLastTupleDelimiter = NO_TUPLE_DELIMITER;
+    FieldIndex fieldIdx = 0;
+    for (size_t blockStart = 0; blockStart < bufferView.size(); blockStart += CSVDelimiterScanner::BLOCK_SIZE)
+    {
+        const auto [tupleDelimiters, fieldDelimiters] = delimiterScanner->scan(bufferView.substr(blockStart, CSVDelimiterScanner::BLOCK_SIZE));
+        for (auto delimiters = tupleDelimiters | fieldDelimiters; delimiters != 0; delimiters &= delimiters - 1)
+        {
+            const auto positionInBlock = std::countr_zero(delimiters);
+            const auto position = static_cast<FieldIndex>(blockStart + positionInBlock);
+            if ((tupleDelimiters >> positionInBlock) & 1U)
+            {
+                if (offsetOfFirstTupleDelimiter == NO_TUPLE_DELIMITER)
+                {
+                    offsetOfFirstTupleDelimiter = position;
+                }
+                else
+                {
+                    /// The last delimiter is the end of the tuple, which allows the next phase to determine the last field without any extra calculations
+                    fieldOffsets.writeOffsetAt(position, numberOfFields);
+                    if (fieldIdx + 1 != numberOfFields)
+                    {
+                        throw CannotFormatSourceData(
+                            "Number of parsed fields does not match number of fields in schema (parsed {} vs {} schema",
+                            fieldIdx + 1,
+                            numberOfFields);
+                    }
+                    fieldOffsets.writeOffsetsOfNextTuple();
+                }
+                offsetOfLastTupleDelimiter = position;
+                fieldIdx = 0;
+                fieldOffsets.writeOffsetAt(position + 1, fieldIdx);
+            }
+            else if (offsetOfFirstTupleDelimiter != NO_TUPLE_DELIMITER)
+            {
+                /// The position of the field delimiter (+ size of field delimiter) is the beginning of the next field
+                ++fieldIdx;
+                if (fieldIdx < numberOfFields)
+                {
+                    fieldOffsets.writeOffsetAt(position + 1, fieldIdx);
+                }
+            }
+        }
+    }
+
+    if (offsetOfFirstTupleDelimiter == NO_TUPLE_DELIMITER)
+    {
+        fieldOffsets.markNoTupleDelimiters();
+        return;
+    }
+    fieldOffsets.markWithTupleDelimiters(offsetOfFirstTupleDelimiter, offsetOfLastTupleDelimiter);
+}
+
 InputFormatIndexerRegistryReturnType
 RegisterCSVInputFormatIndexer(InputFormatIndexerRegistryArguments arguments) ///NOLINT(performance-unnecessary-value-param)
 {
@@ -14,12 +14,18 @@
 
 #include <InputFormatters/InputFormatterProvider.hpp>
 
+#include <cstddef>
 #include <memory>
+#include <optional>
 #include <utility>
+#include <vector>
 
 #include <DataTypes/Schema.hpp>
 #include <Identifiers/Identifiers.hpp>
+#include <InputFormatters/FieldPredicate.hpp>
 #include <InputFormatters/InputFormatterTaskPipeline.hpp>
+#include <MemoryLayout/ColumnLayout.hpp>
+#include <MemoryLayout/MemoryLayout.hpp>
 #include <Sources/SourceDescriptor.hpp>
 #include <ErrorHandling.hpp>
 #include <InputFormatIndexerRegistry.hpp>
@@ -27,10 +33,20 @@
 namespace NES
 {
 
-std::unique_ptr<InputFormatterTaskPipeline> provideInputFormatterTask(const Schema& schema, const ParserConfig& config)
+std::unique_ptr<InputFormatterTaskPipeline> provideInputFormatterTask(
+    const Schema& schema,
+    const ParserConfig& config,
+    const std::shared_ptr<MemoryLayout>& formattedBufferLayout,
+    std::optional<std::vector<size_t>> parsedFields,
+    std::optional<Schema> formattedSchema,
+    std::vector<FieldPredicate> predicates)
 {
-    if (auto inputFormatter
-        = InputFormatIndexerRegistry::instance().create(config.parserType, InputFormatIndexerRegistryArguments(config, schema)))
+    /// Only the column layout changes how the InputFormatterTask writes formatted buffers
+    auto columnLayout = std::dynamic_pointer_cast<ColumnLayout>(formattedBufferLayout);
+    if (auto inputFormatter = InputFormatIndexerRegistry::instance().create(
+            config.parserType,
+            InputFormatIndexerRegistryArguments(
+                config, schema, std::move(columnLayout), std::move(parsedFields), std::move(formattedSchema), std::move(predicates))))
     {
         return std::move(inputFormatter.value());
     }
@@ -14,6 +14,7 @@
 
 #include <JSONInputFormatIndexer.hpp>
 
+#include <bit>
 #include <cstddef>
 #include <cstdint>
 #include <limits>
@@ -24,6 +25,7 @@
 #include <string_view>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include <Configurations/Descriptor.hpp>
 #include <InputFormatters/InputFormatterTaskPipeline.hpp>
@@ -31,6 +33,7 @@
 #include <Util/Logger/Logger.hpp>
 #include <fmt/format.h>
 #include <fmt/ranges.h>
+#include <CSVDelimiterScanner.hpp>
 #include <ErrorHandling.hpp>
 #include <FieldOffsets.hpp>
 #include <InputFormatIndexer.hpp>
@@ -88,21 +91,57 @@ void setupFieldAccessFunctionForTuple(
             "Number of parsed fields ({}) does not match number of fields in schema ({})", numFields, numberOfFieldsInSchema);
     }
 }
+
+/// A quote is escaped, if an odd number of backslashes precedes it
+bool isEscaped(const std::string_view bufferView, const size_t positionOfQuote)
+{
+    size_t numberOfBackslashes = 0;
+    while (numberOfBackslashes < positionOfQuote and bufferView[positionOfQuote - numberOfBackslashes - 1] == '\\')
+    {
+        ++numberOfBackslashes;
+    }
+    return numberOfBackslashes % 2 == 1;
+}
+
+/// The position of the structural character that we expect next, while visiting the structural characters of a tuple
+enum class KeyValueState : uint8_t
+{
+    BEFORE_KEY,
+    IN_KEY,
+    BEFORE_VALUE,
+    IN_VALUE
+};
 }
 
 namespace NES
 {
 
-JSONInputFormatIndexer::JSONInputFormatIndexer(const ParserConfig&, const size_t numberOfFieldsInSchema)
+JSONInputFormatIndexer::JSONInputFormatIndexer(
+    const ParserConfig&, const size_t numberOfFieldsInSchema, const CSVDelimiterScanner::InstructionSet instructionSet)
     : numberOfFieldsInSchema(numberOfFieldsInSchema)
 {
+    if (instructionSet != CSVDelimiterScanner::InstructionSet::SCALAR)
+    {
+        delimiterScanner.emplace(TUPLE_DELIMITER, FIELD_DELIMITER, instructionSet);
+        keyScanner.emplace(KEY_QUOTE, KEY_VALUE_DELIMITER, instructionSet);
+    }
 }
 
 void JSONInputFormatIndexer::indexRawBuffer(
     FieldOffsets<JSON_NUM_OFFSETS_PER_FIELD>& fieldOffsets, const RawTupleBuffer& rawBuffer, const JSONMetaData& metaData) const
 {
     fieldOffsets.startSetup(numberOfFieldsInSchema, FIELD_DELIMITER);
+    if (delimiterScanner.has_value())
+    {
+        indexRawBufferInBlocks(fieldOffsets, rawBuffer, metaData);
+        return;
+    }
+    indexRawBufferScalar(fieldOffsets, rawBuffer, metaData);
+}
 
+void JSONInputFormatIndexer::indexRawBufferScalar(
+    FieldOffsets<JSON_NUM_OFFSETS_PER_FIELD>& fieldOffsets, const RawTupleBuffer& rawBuffer, const JSONMetaData& metaData) const
+{
     const auto offsetOfFirstTupleDelimiter = static_cast<FieldIndex>(rawBuffer.getBufferView().find(TUPLE_DELIMITER));
 
     /// If the buffer does not contain a delimiter, set the 'offsetOfFirstTupleDelimiter' to a value larger than the buffer size to tell
@@ -137,6 +176,153 @@ void JSONInputFormatIndexer::indexRawBuffer(
     fieldOffsets.markWithTupleDelimiters(offsetOfFirstTupleDelimiter, offsetOfLastTupleDelimiter);
 }
 
+/// Builds a structural index of the buffer in a single pass, similar to the first stage of simdjson, i.e., visits the set bits of the masks
+/// of the tuple delimiters, field delimiters, key quotes and key-value delimiters of each block in order. A small state machine over these
+/// structural characters determines the keys and the offsets of the values of flat JSON objects. It skips field delimiters and key-value
+/// delimiters in keys and in string values, and escaped quotes in string values. Like the scalar indexing, it does not support escaped
+/// quotes in keys.
+/// Most sources emit their keys in a stable order. Thus, we predict the field of the i-th key of a tuple from the i-th key of the previous
+/// tuple (starting with the order of the schema) and solely fall back to the lookup of the key in the hash map, if the prediction fails.
+/// Structural characters before the first tuple delimiter belong to a spanning tuple, which the InputFormatterTask indexes separately.
+/// Values after the last tuple delimiter belong to a partial tuple, whose offsets we write, but never commit via 'writeOffsetsOfNextTuple'.
+void JSONInputFormatIndexer::indexRawBufferInBlocks(
+    FieldOffsets<JSON_NUM_OFFSETS_PER_FIELD>& fieldOffsets, const RawTupleBuffer& rawBuffer, const JSONMetaData& metaData) const
+{
+    constexpr auto NO_TUPLE_DELIMITER = std::numeric_limits<FieldIndex>::max();
+    constexpr auto SKIPPED_FIELD = std::numeric_limits<FieldIndex>::max();
+    const auto bufferView = rawBuffer.getBufferView();
+    const auto& fieldNames = metaData.getFieldNames();
+    auto predictedFieldIndexes
+        = std::views::iota(FieldIndex{0}, static_cast<FieldIndex>(numberOfFieldsInSchema)) | std::ranges::to<std::vector>();
+
+    auto offsetOfFirstTupleDelimiter = NO_TUPLE_DELIMITER;
+    auto offsetOfLastTupleDelimiter = NO_TUPLE_DELIMITER;
+    auto state = KeyValueState::BEFORE_KEY;
+    bool isInStringValue = false;
+    size_t numFields = 0;
+    FieldIndex fieldIdx = 0;
+    FieldIndex startOfKey = 0;
+    FieldIndex startOfValue = 0;
+    const auto writeValueOffsets = [&](const FieldIndex endOfValue)
+    {
+        if (fieldIdx != SKIPPED_FIELD)
+        {
+            fieldOffsets.writeOffsetAt({.startOfField = startOfValue, .endOfField = endOfValue}, fieldIdx);
+        }
+    };
+    const auto resolveKey = [&](const std::string_view key)
+    {
+        /// Like the scalar indexing, we ignore all fields after the expected number of fields
+        if (numFields == numberOfFieldsInSchema)
+        {
+            return SKIPPED_FIELD;
+        }
+        if (const auto predictedFieldIdx = predictedFieldIndexes[numFields]; fieldNames[predictedFieldIdx] == key)
+        {
+            ++numFields;
+            return predictedFieldIdx;
+        }
+        const auto fieldIdxOfKey = metaData.getFieldNameToIndexOffset().find(std::string(key));
+        if (fieldIdxOfKey == metaData.getFieldNameToIndexOffset().end())
+        {
+            throw FormattingError(
+                "Field '{}' is not part of expected schema('{}')",
+                key,
+                fmt::join((metaData.getFieldNameToIndexOffset() | std::views::keys), "','"));
+        }
+        predictedFieldIndexes[numFields++] = fieldIdxOfKey->second;
+        return fieldIdxOfKey->second;
+    };
+
+    for (size_t blockStart = 0; blockStart < bufferView.size(); blockStart += CSVDelimiterScanner::BLOCK_SIZE)
+    {
+        const auto block = bufferView.substr(blockStart, CSVDelimiterScanner::BLOCK_SIZE);
+        const auto [tupleDelimiters, fieldDelimiters] = delimiterScanner->scan(block);
+        const auto [keyQuotes, keyValueDelimiters] = keyScanner->scan(block);
+        auto structurals = tupleDelimiters | fieldDelimiters | keyQuotes | keyValueDelimiters;
+        if (offsetOfFirstTupleDelimiter == NO_TUPLE_DELIMITER)
+        {
+            /// Drop all structural characters in front of the first tuple delimiter
+            structurals = (tupleDelimiters == 0) ? 0 : structurals & (~uint64_t{0} << std::countr_zero(tupleDelimiters));
+        }
+        for (; structurals != 0; structurals &= structurals - 1)
+        {
+            const auto positionInBlock = std::countr_zero(structurals);
+            const auto position = static_cast<FieldIndex>(blockStart + positionInBlock);
+            if ((tupleDelimiters >> positionInBlock) & 1U)
+            {
+                if (offsetOfFirstTupleDelimiter == NO_TUPLE_DELIMITER)
+                {
+                    offsetOfFirstTupleDelimiter = position;
+                }
+                else
+                {
+                    /// The last value ends in front of the closing brace of the object
+                    if (state == KeyValueState::IN_VALUE)
+                    {
+                        writeValueOffsets(position - 1);
+                    }
+                    if (numFields != numberOfFieldsInSchema)
+                    {
+                        throw FormattingError(
+                            "Number of parsed fields ({}) does not match number of fields in schema ({})",
+                            numFields,
+                            numberOfFieldsInSchema);
+                    }
+                    fieldOffsets.writeOffsetsOfNextTuple();
+                }
+                offsetOfLastTupleDelimiter = position;
+                state = KeyValueState::BEFORE_KEY;
+                isInStringValue = false;
+                numFields = 0;
+            }
+            else if ((keyQuotes >> positionInBlock) & 1U)
+            {
+                switch (state)
+                {
+                    case KeyValueState::BEFORE_KEY:
+                        startOfKey = position + 1;
+                        state = KeyValueState::IN_KEY;
+                        break;
+                    case KeyValueState::IN_KEY:
+                        fieldIdx = resolveKey(bufferView.substr(startOfKey, position - startOfKey));
+                        state = KeyValueState::BEFORE_VALUE;
+                        break;
+                    case KeyValueState::IN_VALUE:
+                        if (not isEscaped(bufferView, position))
+                        {
+                            isInStringValue = not isInStringValue;
+                        }
+                        break;
+                    case KeyValueState::BEFORE_VALUE:
+                        break;
+                }
+            }
+            else if ((keyValueDelimiters >> positionInBlock) & 1U)
+            {
+                if (state == KeyValueState::BEFORE_VALUE)
+                {
+                    startOfValue = position + 1;
+                    state = KeyValueState::IN_VALUE;
+                }
+            }
+            else if (state == KeyValueState::IN_VALUE and not isInStringValue)
+            {
+                /// The field delimiter ends the value
+                writeValueOffsets(position);
+                state = KeyValueState::BEFORE_KEY;
+            }
+        }
+    }
+
+    if (offsetOfFirstTupleDelimiter == NO_TUPLE_DELIMITER)
+    {
+        fieldOffsets.markNoTupleDelimiters();
+        return;
+    }
+    fieldOffsets.markWithTupleDelimiters(offsetOfFirstTupleDelimiter, offsetOfLastTupleDelimiter);
+}
+
 std::ostream& operator<<(std::ostream& os, const JSONInputFormatIndexer&)
 {
     return os << fmt::format(
@@ -21,6 +21,8 @@
 #include <string_view>
 #include <DataTypes/DataType.hpp>
 #include <MemoryLayout/MemoryLayout.hpp>
+#include <MemoryLayout/VarSizedDictionary.hpp>
+#include <MemoryLayout/VariableSizedAccess.hpp>
 #include <Runtime/AbstractBufferProvider.hpp>
 #include <Runtime/TupleBuffer.hpp>
 #include <ErrorHandling.hpp>
@@ -28,47 +30,64 @@
 namespace NES
 {
 
-ParseFunctionSignature getQuotedStringParseFunction()
+namespace
 {
-    return [](const std::string_view inputString,
-              const size_t writeOffsetInBytes,
-              AbstractBufferProvider& bufferProvider,
-              TupleBuffer& tupleBufferFormatted)
+/// Short strings reside inline in the field anyway, thus, we only look up longer strings in the dictionary
+void writeStringField(
+    const std::string_view value,
+    const size_t writeOffsetInBytes,
+    AbstractBufferProvider& bufferProvider,
+    TupleBuffer& tupleBufferFormatted,
+    const bool dictionaryEncoding)
+{
+    const auto field = tupleBufferFormatted.getAvailableMemoryArea().subspan(writeOffsetInBytes).first<sizeof(VariableSizedAccess)>();
+    const auto valueBytes = std::as_bytes(std::span{value});
+    if (dictionaryEncoding and valueBytes.size() > VariableSizedAccess::INLINE_CAPACITY)
+    {
+        if (const auto variableSizedAccess = VarSizedDictionary::instance().encode(valueBytes); variableSizedAccess.has_value())
+        {
+            const auto combinedIdxOffset = variableSizedAccess->getCombinedIdxOffset();
+            std::ranges::copy(std::as_bytes(std::span{&combinedIdxOffset, 1}), field.begin());
+            return;
+        }
+    }
+    MemoryLayout::writeVarSizedField(tupleBufferFormatted, bufferProvider, field, valueBytes);
+}
+}
+
+ParseFunctionSignature getQuotedStringParseFunction(const bool dictionaryEncoding)
+{
+    return [dictionaryEncoding](
+               const std::string_view inputString,
+               const size_t writeOffsetInBytes,
+               AbstractBufferProvider& bufferProvider,
+               TupleBuffer& tupleBufferFormatted)
     {
         INVARIANT(inputString.length() >= 2, "Input string must be at least 2 characters long.");
         const auto inputStringWithoutQuotes = inputString.substr(1, inputString.length() - 2);
-        const auto variableSizedAccess = MemoryLayout::writeVarSized<MemoryLayout::PREPEND_LENGTH_AS_UINT32>(
-            tupleBufferFormatted, bufferProvider, std::as_bytes(std::span{inputStringWithoutQuotes}));
-        const auto combinedIdxOffset = variableSizedAccess.getCombinedIdxOffset();
-        const auto parsedValueBytes = std::as_bytes(std::span{&combinedIdxOffset, 1});
-        std::ranges::copy(parsedValueBytes, tupleBufferFormatted.getAvailableMemoryArea().begin() + writeOffsetInBytes);
+        writeStringField(inputStringWithoutQuotes, writeOffsetInBytes, bufferProvider, tupleBufferFormatted, dictionaryEncoding);
     };
 }
 
-ParseFunctionSignature getBasicStringParseFunction()
+ParseFunctionSignature getBasicStringParseFunction(const bool dictionaryEncoding)
 {
-    return [](const std::string_view inputString,
-              const size_t writeOffsetInBytes,
-              AbstractBufferProvider& bufferProvider,
-              TupleBuffer& tupleBufferFormatted)
-    {
-        const auto variableSizedAccess = MemoryLayout::writeVarSized<MemoryLayout::PREPEND_LENGTH_AS_UINT32>(
-            tupleBufferFormatted, bufferProvider, std::as_bytes(std::span{inputString}));
-        const auto combinedIdxOffset = variableSizedAccess.getCombinedIdxOffset();
-        const auto parsedValueBytes = std::as_bytes(std::span{&combinedIdxOffset, 1});
-        std::ranges::copy(parsedValueBytes, tupleBufferFormatted.getAvailableMemoryArea().begin() + writeOffsetInBytes);
-    };
+    return [dictionaryEncoding](
+               const std::string_view inputString,
+               const size_t writeOffsetInBytes,
+               AbstractBufferProvider& bufferProvider,
+               TupleBuffer& tupleBufferFormatted)
+    { writeStringField(inputString, writeOffsetInBytes, bufferProvider, tupleBufferFormatted, dictionaryEncoding); };
 }
 
-ParseFunctionSignature getStringParseFunction(const QuotationType quotationType)
+ParseFunctionSignature getStringParseFunction(const QuotationType quotationType, const bool dictionaryEncoding)
 {
     switch (quotationType)
     {
         case QuotationType::NONE: {
-            return getBasicStringParseFunction();
+            return getBasicStringParseFunction(dictionaryEncoding);
         }
         case QuotationType::DOUBLE_QUOTE: {
-            return getQuotedStringParseFunction();
+            return getQuotedStringParseFunction(dictionaryEncoding);
         }
     }
     std::unreachable();
@@ -115,7 +134,7 @@ ParseFunctionSignature getBasicTypeParseFunction(const DataType::Type physicalTy
             return parseFieldString<bool>();
         }
         case DataType::Type::VARSIZED: {
-            return getBasicStringParseFunction();
+            return getBasicStringParseFunction(false);
         }
         case DataType::Type::VARSIZED_POINTER_REP: {
             throw NotImplemented("Cannot parse VARSIZED_POINTER_REP type.");
@@ -127,11 +146,11 @@ ParseFunctionSignature getBasicTypeParseFunction(const DataType::Type physicalTy
     return nullptr;
 }
 
-ParseFunctionSignature getParseFunction(const DataType::Type physicalType, const QuotationType quotationType)
+ParseFunctionSignature getParseFunction(const DataType::Type physicalType, const QuotationType quotationType, const bool dictionaryEncoding)
 {
     if (physicalType == DataType::Type::VARSIZED)
     {
-        return getStringParseFunction(quotationType);
+        return getStringParseFunction(quotationType, dictionaryEncoding);
     }
     return getBasicTypeParseFunction(physicalType, quotationType);
 }
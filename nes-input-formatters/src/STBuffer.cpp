@@ -43,6 +43,30 @@ STBuffer::STBuffer(const size_t initialSize, TupleBuffer dummyBuffer) : buffer(s
     buffer.at(0).setStateOfFirstIndex(std::move(dummyBuffer));
 }
 
+STBuffer::STBuffer(STBuffer& smallerBuffer) : buffer(std::vector<STBufferEntry>(2 * smallerBuffer.buffer.size()))
+{
+    const auto sizeOfSmallerBuffer = smallerBuffer.buffer.size();
+    for (size_t smallerBufferIdx = 0; smallerBufferIdx < sizeOfSmallerBuffer; ++smallerBufferIdx)
+    {
+        auto& entry = smallerBuffer.buffer[smallerBufferIdx];
+        /// Entries with the abaItNo '0' never held a buffer, which matches the default state of the entries of the larger buffer
+        if (entry.getABAItNo() == ABAItNo{0})
+        {
+            continue;
+        }
+        const auto sequenceNumber = ((entry.getABAItNo().getRawValue() - 1) * sizeOfSmallerBuffer) + smallerBufferIdx;
+        const auto [bufferIdx, abaItNumber] = getBufferIdxAndABAItNo(SequenceNumber{sequenceNumber});
+        buffer[bufferIdx.getRawValue()].moveFromEntryOfSmallerSTBuffer(entry, abaItNumber);
+
+        if (sequenceNumber >= sizeOfSmallerBuffer)
+        {
+            const auto [replacedBufferIdx, replacedABAItNumber]
+                = getBufferIdxAndABAItNo(SequenceNumber{sequenceNumber - sizeOfSmallerBuffer});
+            buffer[replacedBufferIdx.getRawValue()].setUsedUp(replacedABAItNumber);
+        }
+    }
+}
+
 STBuffer::WithoutDelimiterSearchResult STBuffer::searchAndTryClaimWithoutDelimiter(const SequenceNumber sequenceNumber)
 {
     const auto [sequenceNumberBufferIdx, abaItNumber] = getBufferIdxAndABAItNo(sequenceNumber);
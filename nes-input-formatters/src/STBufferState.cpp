@@ -146,6 +146,22 @@ void STBufferEntry::claimLeadingBuffer(std::span<StagedBuffer> spanningTupleVect
     this->atomicState.setUsedLeadingBuffer();
 }
 
+void STBufferEntry::moveFromEntryOfSmallerSTBuffer(STBufferEntry& other, const ABAItNo abaItNumber)
+{
+    this->leadingBufferRef = std::move(other.leadingBufferRef);
+    this->trailingBufferRef = std::move(other.trailingBufferRef);
+    this->firstDelimiterOffset = other.firstDelimiterOffset;
+    this->lastDelimiterOffset = other.lastDelimiterOffset;
+    this->atomicState.setStateWithABAItNo(other.atomicState.getState(), abaItNumber);
+    other.leadingBufferRef = NES::TupleBuffer{};
+    other.trailingBufferRef = NES::TupleBuffer{};
+}
+
+void STBufferEntry::setUsedUp(const ABAItNo abaItNumber)
+{
+    this->atomicState.setUsedUpState(abaItNumber);
+}
+
 STBufferEntry::EntryState STBufferEntry::getEntryState(const ABAItNo expectedABAItNo) const
 {
     const auto currentState = this->atomicState.getState();
@@ -21,6 +21,7 @@
 #include <mutex>
 #include <ostream>
 #include <ranges>
+#include <shared_mutex>
 #include <sstream>
 #include <string>
 #include <utility>
@@ -65,6 +66,26 @@ SequenceShredder::~SequenceShredder()
     }
 }
 
+template <typename STSearch>
+SequenceShredderResult SequenceShredder::searchInRangeOfSTBuffer(const SequenceNumber sequenceNumber, const STSearch& stSearch)
+{
+    size_t sizeOfSpanningTupleBuffer = 0;
+    {
+        const std::shared_lock lock(spanningTupleBufferMutex);
+        if (auto stSearchResult = stSearch(*spanningTupleBuffer); stSearchResult.isInRange) [[likely]]
+        {
+            return stSearchResult;
+        }
+        sizeOfSpanningTupleBuffer = spanningTupleBuffer->getSize();
+    }
+    if (trackOutOfRangeRequest(sequenceNumber, sizeOfSpanningTupleBuffer))
+    {
+        const std::shared_lock lock(spanningTupleBufferMutex);
+        return stSearch(*spanningTupleBuffer);
+    }
+    return SequenceShredderResult{.isInRange = false, .spanningBuffers = {}};
+}
+
 SequenceShredderResult SequenceShredder::findLeadingSTWithDelimiter(const StagedBuffer& indexedRawBuffer)
 {
     return findLeadingSTWithDelimiter(indexedRawBuffer, indexedRawBuffer.getRawTupleBuffer().getSequenceNumber());
@@ -72,6 +93,7 @@ SequenceShredderResult SequenceShredder::findLeadingSTWithDelimiter(const Staged
 
 SpanningBuffers SequenceShredder::findTrailingSTWithDelimiter(const SequenceNumber sequenceNumber)
 {
+    const std::shared_lock lock(spanningTupleBufferMutex);
     return spanningTupleBuffer->tryFindTrailingSTForBufferWithDelimiter(sequenceNumber);
 }
 
@@ -83,29 +105,57 @@ SequenceShredderResult SequenceShredder::findSTWithoutDelimiter(const StagedBuff
 SequenceShredderResult
 SequenceShredder::findLeadingSTWithDelimiter(const StagedBuffer& indexedRawBuffer, const SequenceNumber sequenceNumber)
 {
-    /// (Planned) Atomically count the number of out of range attempts
-    /// (Planned) Thread that increases atomic counter to threshold blocks access to the current STBUffer, allocates new STBuffer
-    /// (Planned) with double the size, copies over the current state, swaps out the pointer to the STBuffer, and then enables other
-    /// (Planned) threads to access the new STBuffer
-    return spanningTupleBuffer->tryFindLeadingSTForBufferWithDelimiter(sequenceNumber, indexedRawBuffer);
+    return searchInRangeOfSTBuffer(
+        sequenceNumber,
+        [&indexedRawBuffer, sequenceNumber](STBuffer& stBuffer)
+        { return stBuffer.tryFindLeadingSTForBufferWithDelimiter(sequenceNumber, indexedRawBuffer); });
 }
 
 SequenceShredderResult SequenceShredder::findSTWithoutDelimiter(const StagedBuffer& indexedRawBuffer, const SequenceNumber sequenceNumber)
 {
-    if (const auto stSearchResult = spanningTupleBuffer->tryFindSTForBufferWithoutDelimiter(sequenceNumber, indexedRawBuffer);
-        stSearchResult.isInRange) [[likely]]
+    return searchInRangeOfSTBuffer(
+        sequenceNumber,
+        [&indexedRawBuffer, sequenceNumber](STBuffer& stBuffer)
+        { return stBuffer.tryFindSTForBufferWithoutDelimiter(sequenceNumber, indexedRawBuffer); });
+}
+
+bool SequenceShredder::trackOutOfRangeRequest(const SequenceNumber sequenceNumber, const size_t sizeOfSpanningTupleBuffer)
+{
+    ++numberOfOutOfRangeRequests;
+    const auto numberOfRequestsSinceResize = numberOfOutOfRangeRequestsSinceResize.fetch_add(1) + 1;
+    if (numberOfRequestsSinceResize < OUT_OF_RANGE_REQUESTS_PER_RESIZE or sizeOfSpanningTupleBuffer >= MAX_SIZE_OF_ST_BUFFER)
     {
-        return stSearchResult;
+        NES_WARNING("Sequence number: {} was out of range of STBuffer with size {}", sequenceNumber, sizeOfSpanningTupleBuffer);
+        return false;
     }
-    else
+
+    const std::unique_lock lock(spanningTupleBufferMutex);
+    /// Another thread may have doubled the size of the STBuffer already, while we waited for the lock
+    if (spanningTupleBuffer->getSize() == sizeOfSpanningTupleBuffer)
     {
-        NES_WARNING("Sequence number: {} was out of range of STBuffer", sequenceNumber);
-        return stSearchResult;
+        spanningTupleBuffer = std::make_unique<STBuffer>(*spanningTupleBuffer);
+        numberOfOutOfRangeRequestsSinceResize = 0;
+        NES_INFO(
+            "Doubled the size of the STBuffer from {} to {} after {} out-of-range requests",
+            sizeOfSpanningTupleBuffer,
+            spanningTupleBuffer->getSize(),
+            numberOfRequestsSinceResize);
     }
+    return true;
+}
+
+size_t SequenceShredder::getSizeOfSpanningTupleBuffer() const
+{
+    const std::shared_lock lock(spanningTupleBufferMutex);
+    return spanningTupleBuffer->getSize();
 }
 
 std::ostream& operator<<(std::ostream& os, const SequenceShredder& sequenceShredder)
 {
-    return os << fmt::format("SequenceShredder({})", *sequenceShredder.spanningTupleBuffer);
+    const std::shared_lock lock(sequenceShredder.spanningTupleBufferMutex);
+    return os << fmt::format(
+               "SequenceShredder({}, numberOfOutOfRangeRequests: {})",
+               *sequenceShredder.spanningTupleBuffer,
+               sequenceShredder.numberOfOutOfRangeRequests.load());
 }
 }
@@ -0,0 +1,197 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <DataTypes/Schema.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Sources/SourceDescriptor.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+#include <magic_enum/magic_enum.hpp>
+#include <BaseUnitTest.hpp>
+#include <CSVDelimiterScanner.hpp>
+#include <CSVInputFormatIndexer.hpp>
+#include <ErrorHandling.hpp>
+#include <FieldOffsets.hpp>
+#include <RawTupleBuffer.hpp>
+
+namespace NES
+{
+
+/// Compares the SIMD block scanning of the CSVInputFormatIndexer with its byte-by-byte search (SCALAR), which serves as the reference.
+/// Both must find the same first and last tuple delimiter and the same fields for every tuple in between.
+class CSVInputFormatIndexerTest : public Testing::BaseUnitTest
+{
+public:
+    static constexpr size_t BUFFER_SIZE = 4096;
+    static constexpr size_t NUMBER_OF_FIELDS = 3;
+
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("CSVInputFormatIndexerTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup CSVInputFormatIndexerTest test class.");
+    }
+
+    void SetUp() override
+    {
+        BaseUnitTest::SetUp();
+        using enum CSVDelimiterScanner::InstructionSet;
+        for (const auto instructionSet : {SSE2, AVX2, AVX512, NEON})
+        {
+            if (CSVDelimiterScanner::isSupported(instructionSet))
+            {
+                instructionSets.emplace_back(instructionSet);
+            }
+        }
+        if (instructionSets.empty())
+        {
+            GTEST_SKIP() << "The CPU supports none of the instruction sets of the CSVDelimiterScanner";
+        }
+    }
+
+    /// Renders the indexed buffer, i.e., the tuple delimiters that enclose the indexed tuples and their fields
+    std::vector<std::string> index(const CSVDelimiterScanner::InstructionSet instructionSet, const std::string& csv) const
+    {
+        auto buffer = bufferManager->getBufferBlocking();
+        std::memcpy(buffer.getAvailableMemoryArea<char>().data(), csv.data(), csv.size());
+        /// Raw buffers store the number of bytes as their number of tuples
+        buffer.setNumberOfTuples(csv.size());
+        const RawTupleBuffer rawBuffer(std::move(buffer));
+
+        const CSVInputFormatIndexer indexer(config, NUMBER_OF_FIELDS, instructionSet);
+        FieldOffsets<CSV_NUM_OFFSETS_PER_FIELD> fieldOffsets(*bufferManager);
+        indexer.indexRawBuffer(fieldOffsets, rawBuffer, CSVMetaData(config, Schema{}));
+
+        std::vector<std::string> indexedBuffer{fmt::format(
+            "first: {}, last: {}, tuples: {}",
+            fieldOffsets.getOffsetOfFirstTupleDelimiter(),
+            fieldOffsets.getOffsetOfLastTupleDelimiter(),
+            fieldOffsets.getTotalNumberOfTuples())};
+        for (size_t tupleIdx = 0; tupleIdx < fieldOffsets.getTotalNumberOfTuples(); ++tupleIdx)
+        {
+            for (size_t fieldIdx = 0; fieldIdx < NUMBER_OF_FIELDS; ++fieldIdx)
+            {
+                indexedBuffer.emplace_back(fieldOffsets.readFieldAt(rawBuffer.getBufferView(), tupleIdx, fieldIdx));
+            }
+        }
+        return indexedBuffer;
+    }
+
+    void expectSameIndexAsScalar(const std::string& csv) const
+    {
+        const auto expected = index(CSVDelimiterScanner::InstructionSet::SCALAR, csv);
+        for (const auto instructionSet : instructionSets)
+        {
+            EXPECT_EQ(index(instructionSet, csv), expected) << fmt::format("{} on: '{}'", magic_enum::enum_name(instructionSet), csv);
+        }
+    }
+
+    /// Field 'i' of tuple 'j' has 1 to 'maxFieldSize' characters, thus the delimiters fall on all positions of a block
+    static std::string createCSV(const size_t numberOfTuples, const size_t maxFieldSize)
+    {
+        std::string csv;
+        for (size_t tupleIdx = 0; tupleIdx < numberOfTuples; ++tupleIdx)
+        {
+            for (size_t fieldIdx = 0; fieldIdx < NUMBER_OF_FIELDS; ++fieldIdx)
+            {
+                csv.append(1 + ((tupleIdx * 7 + fieldIdx * 13) % maxFieldSize), static_cast<char>('a' + fieldIdx));
+                csv.push_back((fieldIdx + 1 == NUMBER_OF_FIELDS) ? '\n' : ',');
+            }
+        }
+        return csv;
+    }
+
+    ParserConfig config{.parserType = "CSV", .tupleDelimiter = "\n", .fieldDelimiter = ","};
+    std::shared_ptr<BufferManager> bufferManager = BufferManager::create(BUFFER_SIZE, 64);
+    std::vector<CSVDelimiterScanner::InstructionSet> instructionSets;
+};
+
+TEST_F(CSVInputFormatIndexerTest, MatchesScalarIndexerForAllBufferSizes)
+{
+    /// Every prefix ends with a partial tuple, unless it ends with a tuple delimiter, and most prefixes are no multiple of the block size
+    const auto csv = createCSV(40, 30);
+    ASSERT_GT(csv.size(), 4 * CSVDelimiterScanner::BLOCK_SIZE);
+    for (size_t size = 1; size <= 4 * CSVDelimiterScanner::BLOCK_SIZE + 1; ++size)
+    {
+        expectSameIndexAsScalar(csv.substr(0, size));
+    }
+}
+
+TEST_F(CSVInputFormatIndexerTest, MatchesScalarIndexerForDelimitersOnBlockBoundaries)
+{
+    constexpr auto blockSize = CSVDelimiterScanner::BLOCK_SIZE;
+    /// The first tuple delimiter ends the first block, a field delimiter starts the second one, and a tuple delimiter ends the second one
+    std::string csv = "x\n";
+    csv.insert(0, blockSize - csv.size(), 's');
+    csv += ",b,";
+    csv.append((2 * blockSize) - 1 - csv.size(), 'c');
+    csv += '\n';
+    ASSERT_EQ(csv[blockSize - 1], '\n');
+    ASSERT_EQ(csv[blockSize], ',');
+    ASSERT_EQ(csv[(2 * blockSize) - 1], '\n');
+
+    /// The first field of the first indexed tuple is empty
+    expectSameIndexAsScalar(csv);
+    expectSameIndexAsScalar(csv + "a,b,c\n");
+    /// A tuple of exactly one block between two tuple delimiters
+    std::string tupleOfOneBlock = "a,b,";
+    tupleOfOneBlock.append(blockSize - 1 - tupleOfOneBlock.size(), 'c');
+    expectSameIndexAsScalar("\n" + tupleOfOneBlock + "\n" + tupleOfOneBlock + "\n");
+}
+
+TEST_F(CSVInputFormatIndexerTest, MatchesScalarIndexerForTrailingPartialTuples)
+{
+    /// The partial tuple after the last tuple delimiter may contain more field delimiters than the schema has fields
+    expectSameIndexAsScalar("a,b\n1,2,3\n4,5,6\n7,8,9,10,11");
+    expectSameIndexAsScalar("a,b\n1,2,3\n4,5");
+    /// Without any tuple delimiter, the whole buffer belongs to a spanning tuple
+    expectSameIndexAsScalar("1,2,3,4,5,6,7");
+    expectSameIndexAsScalar(std::string(3 * CSVDelimiterScanner::BLOCK_SIZE, ','));
+}
+
+TEST_F(CSVInputFormatIndexerTest, MatchesScalarIndexerForOtherDelimiters)
+{
+    config.tupleDelimiter = ";";
+    config.fieldDelimiter = "|";
+    auto csv = createCSV(20, 25);
+    std::ranges::replace(csv, '\n', ';');
+    std::ranges::replace(csv, ',', '|');
+    for (size_t size = 1; size <= csv.size(); size += 5)
+    {
+        expectSameIndexAsScalar(csv.substr(0, size));
+    }
+}
+
+TEST_F(CSVInputFormatIndexerTest, RejectsTuplesWithWrongNumberOfFieldsLikeScalarIndexer)
+{
+    for (const auto* csv : {"a\n1,2\n", "a\n1,2,3,4\n", "a\n1,2,3\n4,5,6,7\n8,9,10\n"})
+    {
+        ASSERT_EXCEPTION_ERRORCODE(index(CSVDelimiterScanner::InstructionSet::SCALAR, csv), ErrorCode::CannotFormatSourceData);
+        for (const auto instructionSet : instructionSets)
+        {
+            ASSERT_EXCEPTION_ERRORCODE(index(instructionSet, csv), ErrorCode::CannotFormatSourceData);
+        }
+    }
+}
+
+}
@@ -0,0 +1,125 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <string>
+#include <tuple>
+
+#include <Identifiers/Identifiers.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+#include <InputFormatterTestUtil.hpp>
+
+/// NOLINTBEGIN(readability-magic-numbers)
+namespace NES
+{
+
+/// Tests whether the input formatter writes formatted buffers in the column layout, if the successors of the source read columns.
+class ColumnarFormattingTest : public Testing::BaseUnitTest
+{
+public:
+    static void SetUpTestCase()
+    {
+        Logger::setupLogging("ColumnarFormattingTest.log", LogLevel::LOG_DEBUG);
+        NES_INFO("Setup ColumnarFormattingTest test class.");
+    }
+
+    void SetUp() override { BaseUnitTest::SetUp(); }
+
+    void TearDown() override { BaseUnitTest::TearDown(); }
+
+    /// Returns the bytes of the given values in the native (row) format
+    static std::string toNativeBytes(const std::initializer_list<int32_t> values)
+    {
+        std::string nativeBytes(values.size() * sizeof(int32_t), '\0');
+        std::memcpy(nativeBytes.data(), std::data(values), nativeBytes.size());
+        return nativeBytes;
+    }
+};
+
+TEST_F(ColumnarFormattingTest, testCSVWritesColumnsIntoMultipleFormattedBuffers)
+{
+    using namespace InputFormatterTestUtil;
+    using enum TestDataTypes;
+    using TestTuple = std::tuple<int32_t, int32_t>;
+    runTest<TestTuple>(TestConfig<TestTuple>{
+        .numRequiredBuffers = 8, /// 1 buffer for raw data, 2 buffers for results, and the index buffers
+        .sizeOfRawBuffers = 16,
+        .sizeOfFormattedBuffers = 16, /// 2 columnar tuples of 8 bytes per formatted buffer
+        .parserConfig = {.parserType = "CSV", .tupleDelimiter = "\n", .fieldDelimiter = ","},
+        .testSchema = {INT32, INT32},
+        .expectedResults = {WorkerThreadResults<TestTuple>{{{TestTuple(1, 10), TestTuple(2, 20)}, {TestTuple(3, 30)}}}},
+        .rawBytesPerThread = {{.sequenceNumber = SequenceNumber(1), .rawBytes = "1,10\n2,20\n3,30\n"}},
+        .columnLayout = true});
+}
+
+TEST_F(ColumnarFormattingTest, testCSVWritesSpanningTupleIntoColumns)
+{
+    using namespace InputFormatterTestUtil;
+    using enum TestDataTypes;
+    using TestTuple = std::tuple<int32_t, int32_t>;
+    runTest<TestTuple>(TestConfig<TestTuple>{
+        .numRequiredBuffers = 8, /// 2 buffers for raw data, 2 buffers for results, and the index buffers
+        .sizeOfRawBuffers = 16,
+        .sizeOfFormattedBuffers = 16,
+        .parserConfig = {.parserType = "CSV", .tupleDelimiter = "\n", .fieldDelimiter = ","},
+        .testSchema = {INT32, INT32},
+        .expectedResults = {WorkerThreadResults<TestTuple>{{{TestTuple(123456789, 123456789)}}}},
+        .rawBytesPerThread
+        = {/* buffer 1 */ {.sequenceNumber = SequenceNumber(1), .rawBytes = "123456789,123456"},
+           /* buffer 2 */ {.sequenceNumber = SequenceNumber(2), .rawBytes = "789\n"}},
+        .columnLayout = true});
+}
+
+TEST_F(ColumnarFormattingTest, testNativeTransposesRowsIntoColumns)
+{
+    using namespace InputFormatterTestUtil;
+    using enum TestDataTypes;
+    using TestTuple = std::tuple<int32_t, int32_t>;
+    runTest<TestTuple>(TestConfig<TestTuple>{
+        .numRequiredBuffers = 3, /// 1 buffer for raw data, 2 buffers for results
+        .sizeOfRawBuffers = 24,
+        .sizeOfFormattedBuffers = 16, /// 2 columnar tuples of 8 bytes per formatted buffer
+        .parserConfig = {.parserType = "Native", .tupleDelimiter = "\n", .fieldDelimiter = "|"},
+        .testSchema = {INT32, INT32},
+        .expectedResults = {WorkerThreadResults<TestTuple>{{{TestTuple(1, 10), TestTuple(2, 20)}, {TestTuple(3, -30)}}}},
+        .rawBytesPerThread = {{.sequenceNumber = SequenceNumber(1), .rawBytes = toNativeBytes({1, 10, 2, 20, 3, -30})}},
+        .columnLayout = true});
+}
+
+/// An empty native raw buffer solely completes its sequence number. The input formatter forwards it as a single buffer without tuples
+/// instead of copying zero tuples into a columnar buffer.
+TEST_F(ColumnarFormattingTest, testNativeForwardsEmptyRawBuffer)
+{
+    using namespace InputFormatterTestUtil;
+    using enum TestDataTypes;
+    using TestTuple = std::tuple<int32_t, int32_t>;
+    runTest<TestTuple>(TestConfig<TestTuple>{
+        .numRequiredBuffers = 2, /// 1 buffer for raw data, 1 buffer for the expected result
+        .sizeOfRawBuffers = 24,
+        .sizeOfFormattedBuffers = 16,
+        .parserConfig = {.parserType = "Native", .tupleDelimiter = "\n", .fieldDelimiter = "|"},
+        .testSchema = {INT32, INT32},
+        .expectedResults = {WorkerThreadResults<TestTuple>{{{}}}},
+        .rawBytesPerThread = {{.sequenceNumber = SequenceNumber(1), .rawBytes = ""}},
+        .columnLayout = true});
+}
+
+}
+
+/// NOLINTEND(readability-magic-numbers)
@@ -12,6 +12,7 @@
     limitations under the License.
 */
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
@@ -56,7 +57,8 @@ public:
         TestThreadPool(
             const NES::SequenceNumberType upperBound,
             const std::optional<NES::SequenceNumberType> fixedSeed,
-            const NES::TupleBuffer& dummyBuffer)
+            const NES::TupleBuffer& dummyBuffer,
+            const size_t sequenceNumbersPerRequest)
             : sequenceShredder(SequenceShredder{1}), currentSequenceNumber(1), completionLatch(NUM_THREADS)
         {
             for (size_t i = 0; i < NUM_THREADS; ++i)
@@ -82,7 +84,12 @@ public:
                                     upperBound,
                                     sequenceNumberGen = std::move(sequenceNumberGen),
                                     boolDistribution = std::move(boolDistribution),
-                                    dummyBuffer] { threadFunction(i, upperBound, sequenceNumberGen, boolDistribution, dummyBuffer); });
+                                    dummyBuffer,
+                                    sequenceNumbersPerRequest]
+                                   {
+                                       threadFunction(
+                                           i, upperBound, sequenceNumberGen, boolDistribution, dummyBuffer, sequenceNumbersPerRequest);
+                                   });
             }
         }
 
@@ -99,6 +106,8 @@ public:
             return globalCheckSum;
         }
 
+        [[nodiscard]] size_t getSizeOfSpanningTupleBuffer() const { return sequenceShredder.getSizeOfSpanningTupleBuffer(); }
+
     private:
         SequenceShredder sequenceShredder;
         std::atomic<size_t> currentSequenceNumber;
@@ -114,84 +123,109 @@ public:
             const size_t upperBound,
             std::mt19937_64 sequenceNumberGen,
             std::bernoulli_distribution boolDistribution,
-            const NES::TupleBuffer& dummyBuffer)
+            const NES::TupleBuffer& dummyBuffer,
+            const size_t sequenceNumbersPerRequest)
         {
             threadLocalCheckSum.at(threadIdx) = 0;
 
-            /// Each thread gets and processes new sequence numbers, until they reach the upper bound.
-            for (auto threadLocalSequenceNumber = currentSequenceNumber.fetch_add(1); threadLocalSequenceNumber <= upperBound;
-                 threadLocalSequenceNumber = currentSequenceNumber.fetch_add(1))
+            /// Each thread gets and processes blocks of new sequence numbers in descending order, until they reach the upper bound.
+            for (auto firstSequenceNumberOfBlock = currentSequenceNumber.fetch_add(sequenceNumbersPerRequest);
+                 firstSequenceNumberOfBlock <= upperBound;
+                 firstSequenceNumberOfBlock = currentSequenceNumber.fetch_add(sequenceNumbersPerRequest))
             {
-                /// Force a tuple delimiter for the first and the last sequence number, to guarantee the check sum.
-                const bool tupleDelimiter
-                    = boolDistribution(sequenceNumberGen) or (threadLocalSequenceNumber == 1) or (threadLocalSequenceNumber == upperBound);
-                auto tupleDelimiterIndex = indexOfLastDetectedTupleDelimiter.load();
-
-                while (tupleDelimiterIndex > threadLocalSequenceNumber
-                       and not(indexOfLastDetectedTupleDelimiter.compare_exchange_weak(tupleDelimiterIndex, threadLocalSequenceNumber)))
+                const auto lastSequenceNumberOfBlock = std::min<NES::SequenceNumberType>(
+                    firstSequenceNumberOfBlock + sequenceNumbersPerRequest - 1, upperBound);
+                for (auto threadLocalSequenceNumber = lastSequenceNumberOfBlock; threadLocalSequenceNumber >= firstSequenceNumberOfBlock;
+                     --threadLocalSequenceNumber)
                 {
-                    /// CAS loop implementing std::atomic_max
+                    processSequenceNumber(
+                        threadIdx, threadLocalSequenceNumber, upperBound, sequenceNumberGen, boolDistribution, dummyBuffer);
                 }
+            }
+            completionLatch.count_down();
+        }
 
-                /// Since all threads copy the same reference, all copies of that reference point to the same buffer control block
-                /// Thus, we can't set the sequence number in that control block. Instead, we exploit the 'offset of last tuple delimiter',
-                /// of the StagedBuffer, which we create during each iteration and which is not manipulated by other threads
-                const auto dummyStagedBuffer
-                    = NES::StagedBuffer{NES::RawTupleBuffer{dummyBuffer}, 0, static_cast<uint32_t>(threadLocalSequenceNumber)};
-                if (tupleDelimiter)
+        void processSequenceNumber(
+            const size_t threadIdx,
+            const NES::SequenceNumberType threadLocalSequenceNumber,
+            const size_t upperBound,
+            std::mt19937_64& sequenceNumberGen,
+            std::bernoulli_distribution& boolDistribution,
+            const NES::TupleBuffer& dummyBuffer)
+        {
+            /// Force a tuple delimiter for the first and the last sequence number, to guarantee the check sum.
+            const bool tupleDelimiter
+                = boolDistribution(sequenceNumberGen) or (threadLocalSequenceNumber == 1) or (threadLocalSequenceNumber == upperBound);
+            auto tupleDelimiterIndex = indexOfLastDetectedTupleDelimiter.load();
+
+            while (tupleDelimiterIndex > threadLocalSequenceNumber
+                   and not(indexOfLastDetectedTupleDelimiter.compare_exchange_weak(tupleDelimiterIndex, threadLocalSequenceNumber)))
+            {
+                /// CAS loop implementing std::atomic_max
+            }
+
+            /// Since all threads copy the same reference, all copies of that reference point to the same buffer control block
+            /// Thus, we can't set the sequence number in that control block. Instead, we exploit the 'offset of last tuple delimiter',
+            /// of the StagedBuffer, which we create during each iteration and which is not manipulated by other threads
+            const auto dummyStagedBuffer
+                = NES::StagedBuffer{NES::RawTupleBuffer{dummyBuffer}, 0, static_cast<uint32_t>(threadLocalSequenceNumber)};
+            if (tupleDelimiter)
+            {
+                NES::SequenceShredderResult leadingSTResult
+                    = sequenceShredder.findLeadingSTWithDelimiter(dummyStagedBuffer, NES::SequenceNumber{threadLocalSequenceNumber});
+                while (not leadingSTResult.isInRange)
                 {
-                    NES::SequenceShredderResult leadingSTResult
-                        = sequenceShredder.findLeadingSTWithDelimiter(dummyStagedBuffer, NES::SequenceNumber{threadLocalSequenceNumber});
-                    while (not leadingSTResult.isInRange)
-                    {
-                        leadingSTResult = sequenceShredder.findLeadingSTWithDelimiter(
-                            dummyStagedBuffer, NES::SequenceNumber{threadLocalSequenceNumber});
-                    }
-                    const auto trailingSTResult
-                        = sequenceShredder.findTrailingSTWithDelimiter(NES::SequenceNumber{threadLocalSequenceNumber});
-                    const auto spanStart = (leadingSTResult.spanningBuffers.hasSpanningTuple())
-                        ? leadingSTResult.spanningBuffers.getSpanningBuffers().front().getOffsetOfLastTupleDelimiter()
-                        : threadLocalSequenceNumber;
-                    const auto spanEnd = (trailingSTResult.hasSpanningTuple())
-                        ? trailingSTResult.getSpanningBuffers().back().getOffsetOfLastTupleDelimiter()
-                        : threadLocalSequenceNumber;
-                    const auto localCheckSum = spanEnd - spanStart;
-                    threadLocalCheckSum.at(threadIdx) += localCheckSum;
+                    leadingSTResult = sequenceShredder.findLeadingSTWithDelimiter(
+                        dummyStagedBuffer, NES::SequenceNumber{threadLocalSequenceNumber});
                 }
-                else
+                const auto trailingSTResult
+                    = sequenceShredder.findTrailingSTWithDelimiter(NES::SequenceNumber{threadLocalSequenceNumber});
+                const auto spanStart = (leadingSTResult.spanningBuffers.hasSpanningTuple())
+                    ? leadingSTResult.spanningBuffers.getSpanningBuffers().front().getOffsetOfLastTupleDelimiter()
+                    : threadLocalSequenceNumber;
+                const auto spanEnd = (trailingSTResult.hasSpanningTuple())
+                    ? trailingSTResult.getSpanningBuffers().back().getOffsetOfLastTupleDelimiter()
+                    : threadLocalSequenceNumber;
+                const auto localCheckSum = spanEnd - spanStart;
+                threadLocalCheckSum.at(threadIdx) += localCheckSum;
+            }
+            else
+            {
+                NES::SequenceShredderResult result
+                    = sequenceShredder.findSTWithoutDelimiter(dummyStagedBuffer, NES::SequenceNumber{threadLocalSequenceNumber});
+                while (not result.isInRange)
                 {
-                    NES::SequenceShredderResult result
-                        = sequenceShredder.findSTWithoutDelimiter(dummyStagedBuffer, NES::SequenceNumber{threadLocalSequenceNumber});
-                    while (not result.isInRange)
-                    {
-                        result = sequenceShredder.findSTWithoutDelimiter(dummyStagedBuffer, NES::SequenceNumber{threadLocalSequenceNumber});
-                    }
-                    if (result.spanningBuffers.getSpanningBuffers().size() > 1)
-                    {
-                        /// The 'offset of last tuple delimiter' contains the sequence number (see comment above)
-                        const auto spanStart = result.spanningBuffers.getSpanningBuffers().front().getOffsetOfLastTupleDelimiter();
-                        const auto spanEnd = result.spanningBuffers.getSpanningBuffers().back().getOffsetOfLastTupleDelimiter();
-                        const auto localCheckSum = spanEnd - spanStart;
-                        threadLocalCheckSum.at(threadIdx) += localCheckSum;
-                    }
+                    result = sequenceShredder.findSTWithoutDelimiter(dummyStagedBuffer, NES::SequenceNumber{threadLocalSequenceNumber});
+                }
+                if (result.spanningBuffers.getSpanningBuffers().size() > 1)
+                {
+                    /// The 'offset of last tuple delimiter' contains the sequence number (see comment above)
+                    const auto spanStart = result.spanningBuffers.getSpanningBuffers().front().getOffsetOfLastTupleDelimiter();
+                    const auto spanEnd = result.spanningBuffers.getSpanningBuffers().back().getOffsetOfLastTupleDelimiter();
+                    const auto localCheckSum = spanEnd - spanStart;
+                    threadLocalCheckSum.at(threadIdx) += localCheckSum;
                 }
             }
-            completionLatch.count_down();
         }
     };
 
     template <size_t NUM_THREADS>
-    static void executeTest(const uint32_t upperBound, const std::optional<NES::SequenceNumberType> fixedSeed)
+    static void executeTest(
+        const uint32_t upperBound,
+        const std::optional<NES::SequenceNumberType> fixedSeed,
+        const size_t sequenceNumbersPerRequest = 1,
+        const size_t minSizeOfSpanningTupleBuffer = 0)
     {
         PRECONDITION(upperBound <= std::numeric_limits<uint32_t>::max(), "Not supporting values larger than 4294967295");
         /// To avoid (future) errors by creating a TupleBuffer without a valid control block, we create a single valid (dummy) tuple buffer
         /// All threads share the reference to that buffer throughout this test
         const auto testBufferManager = NES::BufferManager::create(1, 1);
         const auto dummyBuffer = testBufferManager->getBufferBlocking();
-        const TestThreadPool testThreadPool = TestThreadPool<NUM_THREADS>(upperBound, fixedSeed, dummyBuffer);
+        const TestThreadPool testThreadPool = TestThreadPool<NUM_THREADS>(upperBound, fixedSeed, dummyBuffer, sequenceNumbersPerRequest);
         testThreadPool.waitForCompletion();
         const auto checkSum = testThreadPool.getCheckSum();
         ASSERT_EQ(checkSum, upperBound);
+        ASSERT_GE(testThreadPool.getSizeOfSpanningTupleBuffer(), minSizeOfSpanningTupleBuffer);
     }
 };
 
@@ -206,3 +240,13 @@ TEST_F(ConcurrentSynchronizationTest, multiThreadedExhaustiveTest)
         executeTest<numThreads>(largestSequenceNumber, std::nullopt);
     }
 }
+
+TEST_F(ConcurrentSynchronizationTest, multiThreadedOutOfOrderTest)
+{
+    constexpr size_t numThreads = 16;
+    constexpr size_t largestSequenceNumber = 1000000;
+    /// Each thread processes 256 sequence numbers in descending order. Thus, the threads concurrently process buffers with sequence numbers
+    /// that are more than 4096 apart, which exceeds the initial size (1024) of the STBuffer and forces (at least) two resizes.
+    constexpr size_t sequenceNumbersPerRequest = 256;
+    executeTest<numThreads>(largestSequenceNumber, std::nullopt, sequenceNumbersPerRequest, 4096);
+}
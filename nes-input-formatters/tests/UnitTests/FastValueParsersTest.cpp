@@ -0,0 +1,123 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <optional>
+#include <string>
+#include <tuple>
+
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+#include <FastValueParsers.hpp>
+#include <RawValueParser.hpp>
+
+/// NOLINTBEGIN(readability-magic-numbers)
+namespace NES
+{
+
+class FastValueParsersTest : public Testing::BaseUnitTest
+{
+public:
+    static void SetUpTestCase()
+    {
+        Logger::setupLogging("FastValueParsersTest.log", LogLevel::LOG_DEBUG);
+        NES_INFO("Setup FastValueParsersTest test class.");
+    }
+
+    void SetUp() override { BaseUnitTest::SetUp(); }
+
+    void TearDown() override { BaseUnitTest::TearDown(); }
+};
+
+TEST_F(FastValueParsersTest, parseIntegers)
+{
+    using namespace FastValueParsers;
+    EXPECT_EQ(parseInteger<uint64_t>("1722520348"), 1722520348);
+    EXPECT_EQ(parseInteger<uint64_t>("1234567890123456789"), 1234567890123456789);
+    EXPECT_EQ(parseInteger<int8_t>("-128"), std::numeric_limits<int8_t>::min());
+    EXPECT_EQ(parseInteger<int64_t>("-9223372036854775808"), std::numeric_limits<int64_t>::min());
+    EXPECT_EQ(parseInteger<uint16_t>("0751"), 751);
+
+    /// Inputs that the fast path does not handle
+    EXPECT_EQ(parseInteger<int8_t>("128"), std::nullopt);
+    EXPECT_EQ(parseInteger<uint32_t>("-1"), std::nullopt);
+    EXPECT_EQ(parseInteger<uint32_t>("12a"), std::nullopt);
+    EXPECT_EQ(parseInteger<uint32_t>(""), std::nullopt);
+    EXPECT_EQ(parseInteger<uint64_t>("18446744073709551615"), std::nullopt);
+}
+
+TEST_F(FastValueParsersTest, parseFloatingPoints)
+{
+    using namespace FastValueParsers;
+    EXPECT_EQ(parseFloatingPoint<double>("29.4"), 29.4);
+    EXPECT_EQ(parseFloatingPoint<double>("-0.003"), -0.003);
+    EXPECT_EQ(parseFloatingPoint<double>("1296"), 1296.0);
+    EXPECT_EQ(parseFloatingPoint<double>("1.5e3"), 1500.0);
+    EXPECT_EQ(parseFloatingPoint<double>("-2E-2"), -0.02);
+    EXPECT_EQ(parseFloatingPoint<float>("4.376"), 4.376F);
+
+    /// Inputs that the fast path does not handle
+    EXPECT_EQ(parseFloatingPoint<double>("nan"), std::nullopt);
+    EXPECT_EQ(parseFloatingPoint<double>("."), std::nullopt);
+    EXPECT_EQ(parseFloatingPoint<double>("1e300"), std::nullopt);
+    EXPECT_EQ(parseFloatingPoint<double>("12345678901234567890.5"), std::nullopt);
+    EXPECT_EQ(parseFloatingPoint<double>(" 1.5"), std::nullopt);
+}
+
+TEST_F(FastValueParsersTest, fastPathIsCorrectlyRounded)
+{
+    for (uint64_t i = 0; i < 100000; ++i)
+    {
+        const auto value = fmt::format("{}.{:0{}}", (i * 7919) % 100000, (i * 104729) % 10000000, 1 + (i % 7));
+        EXPECT_EQ(FastValueParsers::parseFloatingPoint<double>(value), std::strtod(value.c_str(), nullptr)) << value;
+        /// Floats have fewer exact significand bits, thus the fast path does not handle all of the values
+        const auto expectedFloat = std::strtof(value.c_str(), nullptr);
+        EXPECT_EQ(FastValueParsers::parseFloatingPoint<float>(value).value_or(expectedFloat), expectedFloat) << value;
+    }
+}
+
+TEST_F(FastValueParsersTest, parseISO8601Timestamps)
+{
+    using namespace FastValueParsers;
+    EXPECT_EQ(parseISO8601ToEpochMilliseconds("1970-01-01T00:00:00Z"), 0);
+    EXPECT_EQ(parseISO8601ToEpochMilliseconds("2024-08-01T13:52:28"), 1722520348000);
+    EXPECT_EQ(parseISO8601ToEpochMilliseconds("2024-08-01 13:52:28.123Z"), 1722520348123);
+    EXPECT_EQ(parseISO8601ToEpochMilliseconds("2024-08-01T15:52:28.123456+02:00"), 1722520348123);
+    EXPECT_EQ(parseISO8601ToEpochMilliseconds("1969-12-31T23:59:59Z"), -1000);
+
+    EXPECT_EQ(parseISO8601ToEpochMilliseconds("2024-02-30T00:00:00"), std::nullopt);
+    EXPECT_EQ(parseISO8601ToEpochMilliseconds("2024-08-01T24:00:00"), std::nullopt);
+    EXPECT_EQ(parseISO8601ToEpochMilliseconds("2024-08-01T13:52:28.Z"), std::nullopt);
+    EXPECT_EQ(parseISO8601ToEpochMilliseconds("2024-08-01"), std::nullopt);
+}
+
+TEST_F(FastValueParsersTest, parseRawValueFallsBackToFromChars)
+{
+    EXPECT_EQ(parseRawValue<uint64_t>("0.751"), 0);
+    EXPECT_EQ(parseRawValue<uint64_t>("2024-08-01T13:52:28Z"), 1722520348000);
+    EXPECT_EQ(parseRawValue<int32_t>("2024-08-01T13:52:28Z"), 2024);
+    EXPECT_EQ(parseRawValue<double>(" 1.5"), 1.5);
+    EXPECT_EQ(parseRawValue<double>("1e300"), 1e300);
+    EXPECT_ANY_THROW(std::ignore = parseRawValue<uint8_t>("256"));
+    EXPECT_ANY_THROW(std::ignore = parseRawValue<double>("abc"));
+}
+
+}
+/// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,226 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Sources/SourceDescriptor.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+#include <magic_enum/magic_enum.hpp>
+#include <BaseUnitTest.hpp>
+#include <CSVDelimiterScanner.hpp>
+#include <ErrorHandling.hpp>
+#include <FieldOffsets.hpp>
+#include <JSONInputFormatIndexer.hpp>
+#include <RawTupleBuffer.hpp>
+
+namespace NES
+{
+
+/// Compares the structural index that the JSONInputFormatIndexer builds with SIMD block scanning with its search per structural character
+/// (SCALAR), which serves as the reference. Both must find the same first and last tuple delimiter and the same values for every tuple
+/// in between. The scalar indexing ends a value at the next field delimiter, even in a string value. Thus, the differential tests use
+/// string values without field delimiters, and a separate test checks that the block scanning skips them.
+class JSONInputFormatIndexerTest : public Testing::BaseUnitTest
+{
+public:
+    static constexpr size_t BUFFER_SIZE = 4096;
+    static constexpr size_t NUMBER_OF_FIELDS = 3;
+
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("JSONInputFormatIndexerTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup JSONInputFormatIndexerTest test class.");
+    }
+
+    void SetUp() override
+    {
+        BaseUnitTest::SetUp();
+        schema.addField("id", DataType::Type::UINT64);
+        schema.addField("name", DataType::Type::VARSIZED);
+        schema.addField("value", DataType::Type::UINT64);
+        using enum CSVDelimiterScanner::InstructionSet;
+        for (const auto instructionSet : {SSE2, AVX2, AVX512, NEON})
+        {
+            if (CSVDelimiterScanner::isSupported(instructionSet))
+            {
+                instructionSets.emplace_back(instructionSet);
+            }
+        }
+        if (instructionSets.empty())
+        {
+            GTEST_SKIP() << "The CPU supports none of the instruction sets of the CSVDelimiterScanner";
+        }
+    }
+
+    /// Renders the indexed buffer, i.e., the tuple delimiters that enclose the indexed tuples and their values in the order of the schema
+    std::vector<std::string> index(const CSVDelimiterScanner::InstructionSet instructionSet, const std::string& json) const
+    {
+        auto buffer = bufferManager->getBufferBlocking();
+        std::memcpy(buffer.getAvailableMemoryArea<char>().data(), json.data(), json.size());
+        /// Raw buffers store the number of bytes as their number of tuples
+        buffer.setNumberOfTuples(json.size());
+        const RawTupleBuffer rawBuffer(std::move(buffer));
+
+        const JSONInputFormatIndexer indexer(config, NUMBER_OF_FIELDS, instructionSet);
+        FieldOffsets<JSON_NUM_OFFSETS_PER_FIELD> fieldOffsets(*bufferManager);
+        indexer.indexRawBuffer(fieldOffsets, rawBuffer, JSONMetaData(config, schema));
+
+        std::vector<std::string> indexedBuffer{fmt::format(
+            "first: {}, last: {}, tuples: {}",
+            fieldOffsets.getOffsetOfFirstTupleDelimiter(),
+            fieldOffsets.getOffsetOfLastTupleDelimiter(),
+            fieldOffsets.getTotalNumberOfTuples())};
+        for (size_t tupleIdx = 0; tupleIdx < fieldOffsets.getTotalNumberOfTuples(); ++tupleIdx)
+        {
+            for (size_t fieldIdx = 0; fieldIdx < NUMBER_OF_FIELDS; ++fieldIdx)
+            {
+                indexedBuffer.emplace_back(fieldOffsets.readFieldAt(rawBuffer.getBufferView(), tupleIdx, fieldIdx));
+            }
+        }
+        return indexedBuffer;
+    }
+
+    void expectSameIndexAsScalar(const std::string& json) const
+    {
+        const auto expected = index(CSVDelimiterScanner::InstructionSet::SCALAR, json);
+        for (const auto instructionSet : instructionSets)
+        {
+            EXPECT_EQ(index(instructionSet, json), expected) << fmt::format("{} on: '{}'", magic_enum::enum_name(instructionSet), json);
+        }
+    }
+
+    void expectIndex(const std::string& json, const std::vector<std::string>& expected) const
+    {
+        for (const auto instructionSet : instructionSets)
+        {
+            EXPECT_EQ(index(instructionSet, json), expected) << fmt::format("{} on: '{}'", magic_enum::enum_name(instructionSet), json);
+        }
+    }
+
+    /// The string value of tuple 'i' has up to 'maxNameSize' characters and consists of key-value delimiters, escaped quotes, escaped
+    /// backslashes and braces. Every fourth tuple rotates the order of its keys, which invalidates the predicted order of the keys.
+    static std::string createJSON(const size_t numberOfTuples, const size_t maxNameSize)
+    {
+        static constexpr std::array<std::string_view, 6> NAME_PARTS{"a", "b:c", " ", R"(\")", R"(\\)", "{}"};
+        std::string json;
+        for (size_t tupleIdx = 0; tupleIdx < numberOfTuples; ++tupleIdx)
+        {
+            std::string name;
+            for (size_t partIdx = tupleIdx; name.size() < (tupleIdx * 11) % maxNameSize; ++partIdx)
+            {
+                name += NAME_PARTS[partIdx % NAME_PARTS.size()];
+            }
+            const std::array<std::string, NUMBER_OF_FIELDS> keyValues{
+                fmt::format(R"("id":{})", tupleIdx), fmt::format(R"("name":"{}")", name), fmt::format(R"("value":{})", tupleIdx * 7)};
+            const auto firstKey = (tupleIdx / 4) % NUMBER_OF_FIELDS;
+            json += fmt::format(
+                "{{{},{},{}}}\n",
+                keyValues[firstKey],
+                keyValues[(firstKey + 1) % NUMBER_OF_FIELDS],
+                keyValues[(firstKey + 2) % NUMBER_OF_FIELDS]);
+        }
+        return json;
+    }
+
+    Schema schema;
+    ParserConfig config{.parserType = "JSON", .tupleDelimiter = "\n", .fieldDelimiter = ","};
+    std::shared_ptr<BufferManager> bufferManager = BufferManager::create(BUFFER_SIZE, 64);
+    std::vector<CSVDelimiterScanner::InstructionSet> instructionSets;
+};
+
+TEST_F(JSONInputFormatIndexerTest, MatchesScalarIndexerForAllBufferSizes)
+{
+    /// Every prefix ends with a partial tuple, unless it ends with a tuple delimiter, and most prefixes are no multiple of the block size
+    const auto json = createJSON(30, 90);
+    ASSERT_GT(json.size(), 8 * CSVDelimiterScanner::BLOCK_SIZE);
+    ASSERT_LE(json.size(), BUFFER_SIZE);
+    for (size_t size = 1; size <= json.size(); ++size)
+    {
+        expectSameIndexAsScalar(json.substr(0, size));
+    }
+}
+
+TEST_F(JSONInputFormatIndexerTest, MatchesScalarIndexerForAllAlignmentsOfStringValues)
+{
+    /// Shifts the tuples by the spanning tuple in front of the first tuple delimiter, thus every quote, escaped quote and key spans the
+    /// boundary of two blocks for one of the shifts, e.g., a backslash ends a block and the quote that it escapes starts the next one
+    const auto json = "\n" + createJSON(6, 3 * CSVDelimiterScanner::BLOCK_SIZE);
+    for (size_t shift = 0; shift < CSVDelimiterScanner::BLOCK_SIZE; ++shift)
+    {
+        expectSameIndexAsScalar(std::string(shift, 's') + json);
+    }
+}
+
+TEST_F(JSONInputFormatIndexerTest, SkipsEscapedQuotesInStringValues)
+{
+    /// The field delimiter behind the escaped quote ends the value for the scalar indexing, but not for the block scanning
+    const std::vector<std::string> expected{"first: 0, last: 37, tuples: 1", "1", R"("a \" b,c")", "2"};
+    expectIndex("\n" R"({"id":1,"name":"a \" b,c","value":2})" "\n", expected);
+    /// An escaped backslash does not escape the closing quote
+    expectSameIndexAsScalar("\n" R"({"id":1,"name":"a \\","value":2})" "\n" R"({"id":3,"name":"\\\"","value":4})" "\n");
+}
+
+TEST_F(JSONInputFormatIndexerTest, SkipsDelimitersInStringValuesUnlikeScalarIndexer)
+{
+    const std::vector<std::string> expected{"first: 0, last: 36, tuples: 1", "1", R"("a,b:c,d")", "2"};
+    expectIndex("\n" R"({"id":1,"name":"a,b:c,d","value":2})" "\n", expected);
+}
+
+TEST_F(JSONInputFormatIndexerTest, TreatsNestedObjectsLikeScalarIndexer)
+{
+    /// Neither indexer supports nested objects. A nested object without field delimiters is the raw value of its key.
+    expectSameIndexAsScalar("\n" R"({"id":{"x":1},"name":"a","value":{}})" "\n");
+    /// The field delimiter of a nested object ends the value, thus the key after it is not part of the schema
+    const auto* json = "\n" R"({"id":{"x":1,"y":2},"name":"a","value":2})" "\n";
+    ASSERT_EXCEPTION_ERRORCODE(index(CSVDelimiterScanner::InstructionSet::SCALAR, json), ErrorCode::FormattingError);
+    for (const auto instructionSet : instructionSets)
+    {
+        ASSERT_EXCEPTION_ERRORCODE(index(instructionSet, json), ErrorCode::FormattingError);
+    }
+}
+
+TEST_F(JSONInputFormatIndexerTest, IgnoresFieldsAfterTheNumberOfFieldsInSchemaLikeScalarIndexer)
+{
+    expectSameIndexAsScalar("\n" R"({"id":1,"name":"a","value":2,"other":3})" "\n");
+}
+
+TEST_F(JSONInputFormatIndexerTest, RejectsUnknownKeysAndMissingFieldsLikeScalarIndexer)
+{
+    for (const auto* json :
+         {"\n" R"({"id":1,"name":"a","other":2})" "\n",
+          "\n" R"({"id":1,"name":"a"})" "\n",
+          "\n" R"({"id":1,"name":"a","value":2})" "\n" R"({"value":3,"id":4})" "\n"})
+    {
+        ASSERT_EXCEPTION_ERRORCODE(index(CSVDelimiterScanner::InstructionSet::SCALAR, json), ErrorCode::FormattingError);
+        for (const auto instructionSet : instructionSets)
+        {
+            ASSERT_EXCEPTION_ERRORCODE(index(instructionSet, json), ErrorCode::FormattingError);
+        }
+    }
+}
+
+}
@@ -31,6 +31,7 @@
 #include <Configuration/WorkerConfiguration.hpp>
 #include <DataTypes/Schema.hpp>
 #include <Identifiers/Identifiers.hpp>
+#include <MemoryLayout/VarSizedDictionary.hpp>
 #include <Runtime/BufferManager.hpp>
 #include <Runtime/TupleBuffer.hpp>
 #include <Sources/SourceCatalog.hpp>
@@ -158,6 +159,10 @@ public:
         size_t numberOfIterations;
         size_t numberOfThreads;
         size_t sizeOfRawBuffers;
+        /// If not zero, the InputFormatterTask splits the raw buffers into ranges that it formats in separate tasks
+        size_t maxBytesPerFormattingTask = 0;
+        /// If set, the InputFormatterTask stores the values of var sized fields in the VarSizedDictionary
+        bool dictionaryEncoding = false;
     };
 
     struct SetupResult
@@ -170,6 +175,16 @@ public:
         std::string currentTestFilePath;
     };
 
+    /// Each raw buffer splits into this many ranges that the InputFormatterTask formats in separate tasks
+    static size_t getNumberOfRangesPerRawBuffer(const TestConfig& testConfig)
+    {
+        if (testConfig.maxBytesPerFormattingTask == 0)
+        {
+            return 1;
+        }
+        return (testConfig.sizeOfRawBuffers + testConfig.maxBytesPerFormattingTask - 1) / testConfig.maxBytesPerFormattingTask;
+    }
+
     size_t getNumberOfExpectedBuffers(
         const TestConfig& testConfig, const std::filesystem::path& testFilePath, USED_IN_DEBUG const size_t sizeOfSchemaInBytes) const
     {
@@ -221,7 +236,8 @@ public:
             rawBuffers.size());
 
         /// We assume that we don't need more than two times the number of buffers to represent the formatted data than we need to represent the raw data
-        const auto numberOfRequiredFormattedBuffers = static_cast<uint32_t>((rawBuffers.size() + 1) * 2);
+        const auto numberOfRequiredFormattedBuffers
+            = static_cast<uint32_t>(((rawBuffers.size() * getNumberOfRangesPerRawBuffer(testConfig)) + 1) * 2);
 
         return SetupResult{
             .schema = schema,
@@ -282,7 +298,8 @@ public:
             /// Prepare TestTaskQueue for processing the input formatter tasks
             auto testBufferManager
                 = BufferManager::create(setupResult.sizeOfFormattedBuffers, setupResult.numberOfRequiredFormattedBuffers);
-            auto inputFormatterTask = InputFormatterTestUtil::createInputFormatterTask(setupResult.schema, testConfig.formatterType);
+            auto inputFormatterTask = InputFormatterTestUtil::createInputFormatterTask(
+                setupResult.schema, testConfig.formatterType, testConfig.maxBytesPerFormattingTask, testConfig.dictionaryEncoding);
             auto resultBuffers = std::make_shared<std::vector<std::vector<TupleBuffer>>>(testConfig.numberOfThreads);
 
             std::vector<TestPipelineTask> pipelineTasks;
@@ -301,9 +318,14 @@ public:
                     }
                 });
 
-            /// Create test task queue and process input formatter tasks
-            auto taskQueue
-                = std::make_unique<MultiThreadedTestTaskQueue>(testConfig.numberOfThreads, pipelineTasks, testBufferManager, resultBuffers);
+            /// Create test task queue and process input formatter tasks. The task of a split raw buffer submits a task per further range.
+            /// Raw buffers without spanning tuples split into morsels, which the task emits instead of submitting them.
+            auto taskQueue = std::make_unique<MultiThreadedTestTaskQueue>(
+                testConfig.numberOfThreads,
+                pipelineTasks,
+                testBufferManager,
+                resultBuffers,
+                testConfig.hasSpanningTuples ? pipelineTasks.size() * (getNumberOfRangesPerRawBuffer(testConfig) - 1) : 0);
             taskQueue->startProcessing();
             taskQueue->waitForCompletion();
 
@@ -407,6 +429,45 @@ TEST_F(SmallFilesTest, testSpaceCraftTelemetryData)
          .sizeOfRawBuffers = 16});
 }
 
+/// Splits each raw buffer into four ranges that different threads format, stitching the tuples that span ranges
+TEST_F(SmallFilesTest, testBimboDataSplitIntoFormattingRanges)
+{
+    runTest(TestConfig{
+        .testFileName = "Bimbo",
+        .formatterType = "CSV",
+        .hasSpanningTuples = true,
+        .numberOfIterations = 10,
+        .numberOfThreads = 8,
+        .sizeOfRawBuffers = 64,
+        .maxBytesPerFormattingTask = 16});
+}
+
+TEST_F(SmallFilesTest, testFoodDataJSONSplitIntoFormattingRanges)
+{
+    runTest(TestConfig{
+        .testFileName = "Food",
+        .formatterType = "JSON",
+        .hasSpanningTuples = true,
+        .numberOfIterations = 1,
+        .numberOfThreads = 8,
+        .sizeOfRawBuffers = 256,
+        .maxBytesPerFormattingTask = 48});
+}
+
+/// The formatted buffers reference the values of the var sized fields in the VarSizedDictionary instead of carrying copies of them
+TEST_F(SmallFilesTest, testFoodDataDictionaryEncoded)
+{
+    runTest(TestConfig{
+        .testFileName = "Food",
+        .formatterType = "CSV",
+        .hasSpanningTuples = true,
+        .numberOfIterations = 10,
+        .numberOfThreads = 8,
+        .sizeOfRawBuffers = 16,
+        .dictionaryEncoding = true});
+    EXPECT_GT(VarSizedDictionary::instance().getNumberOfEntries(), 0);
+}
+
 /// Simple test that confirms that we forward already formatted buffers without spanning tuples correctly
 TEST_F(SmallFilesTest, testTwoIntegerColumnsNoSpanningBinary)
 {
@@ -420,6 +481,19 @@ TEST_F(SmallFilesTest, testTwoIntegerColumnsNoSpanningBinary)
         .numberOfThreads = 8,
         .sizeOfRawBuffers = 4096});
 }
+
+/// Splits each raw buffer into four morsels, which the successors receive as the chunks of the raw buffer
+TEST_F(SmallFilesTest, testTwoIntegerColumnsNoSpanningBinarySplitIntoMorsels)
+{
+    runTest(TestConfig{
+        .testFileName = "TwoIntegerColumns",
+        .formatterType = "Native",
+        .hasSpanningTuples = false,
+        .numberOfIterations = 1,
+        .numberOfThreads = 8,
+        .sizeOfRawBuffers = 4096,
+        .maxBytesPerFormattingTask = 1024});
+}
 }
 
 /// NOLINTEND(readability-magic-numbers)
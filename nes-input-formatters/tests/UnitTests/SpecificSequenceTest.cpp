@@ -16,6 +16,7 @@
 #include <tuple>
 
 #include <Identifiers/Identifiers.hpp>
+#include <InputFormatters/FieldPredicate.hpp>
 #include <Util/Logger/Logger.hpp>
 #include <Util/Logger/impl/NesLogger.hpp>
 #include <gtest/gtest.h>
@@ -177,6 +178,46 @@ TEST_F(SpecificSequenceTest, testMultiplePartiallyFilledBuffers)
            {.sequenceNumber = SequenceNumber(3), .rawBytes = ",129"}}});
 }
 
+/// The input formatter skips the tuples that fail the predicate, including the spanning tuple that completes in the second buffer
+TEST_F(SpecificSequenceTest, testFilterTuplesDuringParsing)
+{
+    using namespace InputFormatterTestUtil;
+    using enum TestDataTypes;
+    using TestTuple = std::tuple<int32_t, int32_t>;
+    runTest<TestTuple>(TestConfig<TestTuple>{
+        .numRequiredBuffers = 8, /// 2 buffers for raw data, 2 buffers for results, and the index buffers
+        .sizeOfRawBuffers = 20,
+        .sizeOfFormattedBuffers = 32,
+        .parserConfig = {.parserType = "CSV", .tupleDelimiter = "\n", .fieldDelimiter = ","},
+        .testSchema = {INT32, INT32},
+        .expectedResults = {WorkerThreadResults<TestTuple>{{{TestTuple(2, 20)}, {TestTuple(2, 40)}}}},
+        .rawBytesPerThread
+        = {/* buffer 1 */ {.sequenceNumber = SequenceNumber(1), .rawBytes = "1,10\n2,20\n3,30\n2,"},
+           /* buffer 2 */ {.sequenceNumber = SequenceNumber(2), .rawBytes = "40\n4,50\n"}},
+        .predicates = {{.fieldName = "Field_0", .comparison = FieldPredicate::Comparison::EQUALS, .constant = int64_t{2}}}});
+}
+
+/// A raw buffer, whose tuples all fail the predicates, still emits an empty formatted buffer, which completes its sequence number
+TEST_F(SpecificSequenceTest, testFilterAllTuplesOfBuffer)
+{
+    using namespace InputFormatterTestUtil;
+    using enum TestDataTypes;
+    using TestTuple = std::tuple<int32_t, int32_t>;
+    runTest<TestTuple>(TestConfig<TestTuple>{
+        .numRequiredBuffers = 8, /// 2 buffers for raw data, 2 buffers for results, and the index buffers
+        .sizeOfRawBuffers = 16,
+        .sizeOfFormattedBuffers = 32,
+        .parserConfig = {.parserType = "CSV", .tupleDelimiter = "\n", .fieldDelimiter = ","},
+        .testSchema = {INT32, INT32},
+        .expectedResults = {WorkerThreadResults<TestTuple>{{{TestTuple(2, 20), TestTuple(3, 30)}, {}}}},
+        .rawBytesPerThread
+        = {/* buffer 1 */ {.sequenceNumber = SequenceNumber(1), .rawBytes = "1,10\n2,20\n3,30\n"},
+           /* buffer 2 */ {.sequenceNumber = SequenceNumber(2), .rawBytes = "2,40\n4,50\n"}},
+        .predicates
+        = {{.fieldName = "Field_0", .comparison = FieldPredicate::Comparison::GREATER_EQUALS, .constant = int64_t{2}},
+           {.fieldName = "Field_1", .comparison = FieldPredicate::Comparison::LESS, .constant = int64_t{35}}}});
+}
+
 }
 
 /// NOLINTEND(readability-magic-numbers)
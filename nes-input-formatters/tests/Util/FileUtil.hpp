@@ -159,9 +159,9 @@ inline void writePagedSizeTupleBufferChunkToFile(
                 {
                     const auto currentTupleOffset = tupleIdx * sizeOfSchemaInBytes;
                     const auto currentTupleVarSizedFieldOffset = currentTupleOffset + varSizedFieldOffset;
-                    const VariableSizedAccess varSizedAccess{
-                        *reinterpret_cast<uint64_t*>(buffer.getAvailableMemoryArea().data() + currentTupleVarSizedFieldOffset)};
-                    const auto variableSizedData = MemoryLayout::readVarSizedDataAsString(buffer, varSizedAccess);
+                    const auto field
+                        = buffer.getAvailableMemoryArea().subspan(currentTupleVarSizedFieldOffset).first<sizeof(VariableSizedAccess)>();
+                    const auto variableSizedData = MemoryLayout::readVarSizedFieldAsString(buffer, field);
                     appendFile.write(variableSizedData.data(), static_cast<std::streamsize>(variableSizedData.size()));
                 }
             }
@@ -181,11 +181,14 @@ std::unique_ptr<SourceHandle> createFileSource(
     return sourceProvider.lower(NES::OriginId(1), sourceDescriptor.value());
 }
 
-std::shared_ptr<InputFormatterTaskPipeline> createInputFormatterTask(const Schema& schema, std::string formatterType)
+std::shared_ptr<InputFormatterTaskPipeline> createInputFormatterTask(
+    const Schema& schema, std::string formatterType, const size_t maxBytesPerFormattingTask, const bool dictionaryEncoding)
 {
     const std::unordered_map<std::string, std::string> parserConfiguration{
         {"type", std::move(formatterType)}, {"tuple_delimiter", "\n"}, {"field_delimiter", "|"}};
-    const auto validatedParserConfiguration = validateAndFormatParserConfig(parserConfiguration);
+    auto validatedParserConfiguration = validateAndFormatParserConfig(parserConfiguration);
+    validatedParserConfiguration.maxBytesPerFormattingTask = maxBytesPerFormattingTask;
+    validatedParserConfiguration.dictionaryEncoding = dictionaryEncoding;
 
     return provideInputFormatterTask(schema, validatedParserConfiguration);
 }
@@ -26,8 +26,11 @@
 #include <vector>
 #include <DataTypes/Schema.hpp>
 #include <Identifiers/Identifiers.hpp>
+#include <InputFormatters/FieldPredicate.hpp>
 #include <InputFormatters/InputFormatterProvider.hpp>
 #include <InputFormatters/InputFormatterTaskPipeline.hpp>
+#include <MemoryLayout/ColumnLayout.hpp>
+#include <MemoryLayout/MemoryLayout.hpp>
 #include <MemoryLayout/RowLayout.hpp>
 #include <Runtime/BufferManager.hpp>
 #include <Sources/SourceDescriptor.hpp>
@@ -86,6 +89,10 @@ struct TestConfig
     /// Each workerThread(vector) can produce multiple buffers(vector) with multiple tuples(vector<TupleSchemaTemplate>)
     std::vector<WorkerThreadResults<TupleSchemaTemplate>> expectedResults;
     std::vector<ThreadInputBuffers> rawBytesPerThread;
+    /// The input formatter solely parses the tuples that satisfy all predicates
+    std::vector<FieldPredicate> predicates;
+    /// The input formatter writes the formatted buffers in the column layout instead of the row layout
+    bool columnLayout = false;
     using TupleSchema = TupleSchemaTemplate;
 };
 
@@ -154,7 +161,10 @@ std::unique_ptr<SourceHandle> createFileSource(
     std::shared_ptr<BufferManager> sourceBufferPool,
     size_t numberOfRequiredSourceBuffers);
 
-std::shared_ptr<InputFormatterTaskPipeline> createInputFormatterTask(const Schema& schema, std::string formatterType);
+/// @param maxBytesPerFormattingTask if not zero, the InputFormatterTask splits raw buffers into ranges of at most this many bytes
+/// @param dictionaryEncoding if set, the InputFormatterTask stores the values of var sized fields in the VarSizedDictionary
+std::shared_ptr<InputFormatterTaskPipeline> createInputFormatterTask(
+    const Schema& schema, std::string formatterType, size_t maxBytesPerFormattingTask = 0, bool dictionaryEncoding = false);
 
 /// Waits until source reached EoS
 void waitForSource(const std::vector<TupleBuffer>& resultBuffers, size_t numExpectedBuffers);
@@ -330,8 +340,35 @@ inline TupleBuffer copyStringDataToTupleBuffer(const std::string_view rawData, T
     return tupleBuffer;
 }
 
+/// Compares the tuples of two buffers of the same memory layout in order, e.g., of two columnar buffers.
+inline bool checkIfBuffersContainSameTuplesInOrder(
+    const TupleBuffer& leftBuffer, const TupleBuffer& rightBuffer, const std::shared_ptr<MemoryLayout>& memoryLayout)
+{
+    if (leftBuffer.getNumberOfTuples() != rightBuffer.getNumberOfTuples())
+    {
+        NES_ERROR("Buffers do not contain the same tuples, as they do not have the same number of tuples");
+        return false;
+    }
+    if (leftBuffer.getNumberOfTuples() == 0)
+    {
+        return true;
+    }
+
+    auto leftTestBuffer = TestTupleBuffer(memoryLayout, leftBuffer);
+    auto rightTestBuffer = TestTupleBuffer(memoryLayout, rightBuffer);
+    for (auto tupleIdx = 0UL; tupleIdx < leftBuffer.getNumberOfTuples(); ++tupleIdx)
+    {
+        if (leftTestBuffer[tupleIdx] != rightTestBuffer[tupleIdx])
+        {
+            NES_ERROR("Buffers do not contain the same tuples, as they differ in the tuple at idx: {}", tupleIdx);
+            return false;
+        }
+    }
+    return true;
+}
+
 /// Takes a schema, a buffer manager and tuples.
-/// Creates a TestTupleBuffer with row layout using the schema and the buffer manager.
+/// Creates a TestTupleBuffer with the given memory layout (row layout, if not set) using the schema and the buffer manager.
 /// Unfolds the tuples into the TestTupleBuffer.
 /// Example usage (assumes a bufferManager (shared_ptr to BufferManager object) is available):
 ///     using TestTuple = std::tuple<int, bool>;
@@ -339,11 +376,18 @@ inline TupleBuffer copyStringDataToTupleBuffer(const std::string_view rawData, T
 ///     auto testTupleBuffer = TestUtil::createTupleBufferFromTuples(schema, *bufferManager,
 ///         TestTuple(42, true), TestTuple(43, false), TestTuple(44, true), TestTuple(45, false));
 template <typename TupleSchema, bool ContainsVarSized = false, bool PrintDebug = false>
-TupleBuffer createTupleBufferFromTuples(const Schema& schema, BufferManager& bufferManager, const std::vector<TupleSchema>& tuples)
+TupleBuffer createTupleBufferFromTuples(
+    const Schema& schema,
+    BufferManager& bufferManager,
+    const std::vector<TupleSchema>& tuples,
+    std::shared_ptr<MemoryLayout> memoryLayout = nullptr)
 {
     PRECONDITION(bufferManager.getNumberOfAvailableBuffers() != 0, "Cannot create a test tuple buffer, if there are no buffers available");
-    auto rowLayout = std::make_shared<RowLayout>(bufferManager.getBufferSize(), schema);
-    auto testTupleBuffer = std::make_unique<TestTupleBuffer>(rowLayout, bufferManager.getBufferBlocking());
+    if (not memoryLayout)
+    {
+        memoryLayout = std::make_shared<RowLayout>(bufferManager.getBufferSize(), schema);
+    }
+    auto testTupleBuffer = std::make_unique<TestTupleBuffer>(memoryLayout, bufferManager.getBufferBlocking());
 
     for (const auto& testTuple : tuples)
     {
@@ -364,6 +408,17 @@ TupleBuffer createTupleBufferFromTuples(const Schema& schema, BufferManager& buf
     return testTupleBuffer->getBuffer();
 }
 
+/// Returns the memory layout of the formatted buffers of the test, or nullptr for the default row layout
+template <typename TupleSchemaTemplate>
+std::shared_ptr<MemoryLayout> getFormattedBufferLayout(const TestHandle<TupleSchemaTemplate>& testHandle)
+{
+    if (testHandle.testConfig.columnLayout)
+    {
+        return ColumnLayout::create(testHandle.testConfig.sizeOfFormattedBuffers, testHandle.schema);
+    }
+    return nullptr;
+}
+
 /// Gets the actual result buffers and the expected result buffers from the test handle and compares them.
 /// Logs both the actual and the expected buffers if 'PrintDebug' is set to true.
 template <typename TupleSchemaTemplate, bool PrintDebug>
@@ -395,8 +450,19 @@ bool validateResult(const TestHandle<TupleSchemaTemplate>& testHandle)
                     actualResultTestBuffer.toString(testHandle.schema, TestTupleBuffer::PrintMode::NO_HEADER_END_IN_NEWLINE),
                     expectedTestBuffer.toString(testHandle.schema, TestTupleBuffer::PrintMode::NO_HEADER_END_IN_NEWLINE));
             }
-            isValid &= checkIfBuffersAreEqual(
-                actualResultBuffer, testHandle.expectedResultVectors[taskIndex][bufferIndex], testHandle.schema.getSizeOfSchemaInBytes());
+            /// Columnar buffers spread the fields of a tuple over the buffer and the input formatter writes them in order
+            if (const auto columnLayout = getFormattedBufferLayout(testHandle))
+            {
+                isValid &= checkIfBuffersContainSameTuplesInOrder(
+                    actualResultBuffer, testHandle.expectedResultVectors[taskIndex][bufferIndex], columnLayout);
+            }
+            else
+            {
+                isValid &= checkIfBuffersAreEqual(
+                    actualResultBuffer,
+                    testHandle.expectedResultVectors[taskIndex][bufferIndex],
+                    testHandle.schema.getSizeOfSchemaInBytes());
+            }
             ++bufferIndex;
         }
         ++taskIndex;
@@ -414,7 +480,7 @@ std::vector<std::vector<TupleBuffer>> createExpectedResults(const TestHandle<Tup
         for (const auto& expectedBuffersVector : workerThreadResultVector.expectedResultsForThread)
         {
             expectedTupleBuffers.at(0).emplace_back(createTupleBufferFromTuples<TupleSchemaTemplate, false, PrintDebug>(
-                testHandle.schema, *testHandle.formattedBufferManager, expectedBuffersVector));
+                testHandle.schema, *testHandle.formattedBufferManager, expectedBuffersVector, getFormattedBufferLayout(testHandle)));
         }
     }
     return expectedTupleBuffers;
@@ -445,7 +511,13 @@ template <typename TupleSchemaTemplate>
 std::vector<TestPipelineTask> createTasks(const TestHandle<TupleSchemaTemplate>& testHandle)
 {
     const std::shared_ptr<InputFormatterTaskPipeline> inputFormatterTask
-        = provideInputFormatterTask(testHandle.schema, testHandle.testConfig.parserConfig);
+        = provideInputFormatterTask(
+            testHandle.schema,
+            testHandle.testConfig.parserConfig,
+            getFormattedBufferLayout(testHandle),
+            std::nullopt,
+            std::nullopt,
+            testHandle.testConfig.predicates);
     std::vector<TestPipelineTask> tasks;
     tasks.reserve(testHandle.inputBuffers.size());
     for (const auto& inputBuffer : testHandle.inputBuffers)
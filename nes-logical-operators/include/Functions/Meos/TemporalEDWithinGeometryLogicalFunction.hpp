@@ -17,6 +17,15 @@ public:
                                             LogicalFunction geometry,
                                             LogicalFunction distance);
 
+    /// Point-to-point variant: checks whether the temporal point (lon1, lat1, timestamp1) is within the distance of the point (lon2, lat2).
+    /// This variant is the predicate of spatial joins, e.g., whether two objects were within a distance of each other in the same window.
+    TemporalEDWithinGeometryLogicalFunction(LogicalFunction lon1,
+                                            LogicalFunction lat1,
+                                            LogicalFunction timestamp1,
+                                            LogicalFunction lon2,
+                                            LogicalFunction lat2,
+                                            LogicalFunction distance);
+
     DataType getDataType() const override;
     LogicalFunction withDataType(const DataType& dataType) const override;
     std::vector<LogicalFunction> getChildren() const override;
@@ -0,0 +1,63 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Functions/LogicalFunction.hpp>
+#include <Util/Logger/Formatter.hpp>
+#include <Util/PlanRenderer.hpp>
+#include <SerializableVariantDescriptor.pb.h>
+
+namespace NES
+{
+
+/// A named constant of a query, whose value may be updated while the query is running, e.g., the threshold of a selection.
+/// The query starts with the default value. All parameters of a query with the same name share their value.
+class QueryParameterLogicalFunction final : public LogicalFunctionConcept
+{
+public:
+    static constexpr std::string_view NAME = "QueryParameter";
+
+    QueryParameterLogicalFunction(std::string parameterName, DataType dataType, std::string defaultValue);
+
+    [[nodiscard]] const std::string& getParameterName() const;
+    [[nodiscard]] const std::string& getDefaultValue() const;
+
+    [[nodiscard]] bool operator==(const LogicalFunctionConcept& rhs) const override;
+
+    [[nodiscard]] SerializableFunction serialize() const override;
+
+    [[nodiscard]] DataType getDataType() const override;
+    [[nodiscard]] LogicalFunction withDataType(const DataType& dataType) const override;
+    [[nodiscard]] LogicalFunction withInferredDataType(const Schema& schema) const override;
+
+    [[nodiscard]] std::vector<LogicalFunction> getChildren() const override;
+    [[nodiscard]] LogicalFunction withChildren(const std::vector<LogicalFunction>& children) const override;
+
+    [[nodiscard]] std::string_view getType() const override;
+    [[nodiscard]] std::string explain(ExplainVerbosity verbosity) const override;
+
+private:
+    std::string parameterName;
+    DataType dataType;
+    std::string defaultValue;
+};
+}
+
+FMT_OSTREAM(NES::QueryParameterLogicalFunction);
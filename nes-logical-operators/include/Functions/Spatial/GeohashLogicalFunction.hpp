@@ -0,0 +1,68 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Functions/LogicalFunction.hpp>
+#include <Util/Logger/Formatter.hpp>
+#include <Util/PlanRenderer.hpp>
+#include <SerializableVariantDescriptor.pb.h>
+
+namespace NES
+{
+
+/// Geohash cell of a WGS84 position, given as (lon, lat, precision) in degrees, as an integer key.
+/// The key holds the 5 * precision bits of the geohash, i.e., the interleaved bits of the longitude and latitude cells starting with the
+/// longitude, thus, its base32 representation is the textual geohash of `precision` characters. Neighbouring positions share the prefix of
+/// their keys, which turns spatial grouping and partitioning into grouping by an UINT64 key.
+class GeohashLogicalFunction final : public LogicalFunctionConcept
+{
+public:
+    static constexpr std::string_view NAME = "Geohash";
+    /// 12 characters of 5 bits each fit into an UINT64 and resolve cells of a few centimeters
+    static constexpr uint64_t MAX_PRECISION = 12;
+
+    GeohashLogicalFunction(LogicalFunction lon, LogicalFunction lat, LogicalFunction precision);
+
+    [[nodiscard]] SerializableFunction serialize() const override;
+
+    [[nodiscard]] bool operator==(const LogicalFunctionConcept& rhs) const override;
+
+    [[nodiscard]] DataType getDataType() const override;
+    [[nodiscard]] LogicalFunction withDataType(const DataType& dataType) const override;
+    [[nodiscard]] LogicalFunction withInferredDataType(const Schema& schema) const override;
+
+    [[nodiscard]] std::vector<LogicalFunction> getChildren() const override;
+    [[nodiscard]] LogicalFunction withChildren(const std::vector<LogicalFunction>& children) const override;
+
+    [[nodiscard]] std::string_view getType() const override;
+    [[nodiscard]] std::string explain(ExplainVerbosity verbosity) const override;
+
+    /// The precision must be a constant number of characters in [1, MAX_PRECISION]. Returns it as an UINT64 constant.
+    [[nodiscard]] static LogicalFunction inferPrecision(const LogicalFunction& precision, std::string_view functionName);
+
+private:
+    DataType dataType;
+    std::vector<LogicalFunction> parameters;
+};
+
+}
+
+FMT_OSTREAM(NES::GeohashLogicalFunction);
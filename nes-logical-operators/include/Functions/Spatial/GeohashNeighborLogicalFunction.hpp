@@ -0,0 +1,61 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Functions/LogicalFunction.hpp>
+#include <Util/Logger/Formatter.hpp>
+#include <Util/PlanRenderer.hpp>
+#include <SerializableVariantDescriptor.pb.h>
+
+namespace NES
+{
+
+/// Neighbouring geohash cell of a GEOHASH key, given as (cell, precision, lonOffset, latOffset), which is `lonOffset` cells east and
+/// `latOffset` cells north of the cell. The longitude wraps around the antimeridian, whereas the latitude is clamped at the poles.
+/// Enumerating the offsets in [-1, 1] yields the eight neighbours of a cell, e.g., to match positions close to the border of a cell.
+class GeohashNeighborLogicalFunction final : public LogicalFunctionConcept
+{
+public:
+    static constexpr std::string_view NAME = "GeohashNeighbor";
+
+    GeohashNeighborLogicalFunction(LogicalFunction cell, LogicalFunction precision, LogicalFunction lonOffset, LogicalFunction latOffset);
+
+    [[nodiscard]] SerializableFunction serialize() const override;
+
+    [[nodiscard]] bool operator==(const LogicalFunctionConcept& rhs) const override;
+
+    [[nodiscard]] DataType getDataType() const override;
+    [[nodiscard]] LogicalFunction withDataType(const DataType& dataType) const override;
+    [[nodiscard]] LogicalFunction withInferredDataType(const Schema& schema) const override;
+
+    [[nodiscard]] std::vector<LogicalFunction> getChildren() const override;
+    [[nodiscard]] LogicalFunction withChildren(const std::vector<LogicalFunction>& children) const override;
+
+    [[nodiscard]] std::string_view getType() const override;
+    [[nodiscard]] std::string explain(ExplainVerbosity verbosity) const override;
+
+private:
+    DataType dataType;
+    std::vector<LogicalFunction> parameters;
+};
+
+}
+
+FMT_OSTREAM(NES::GeohashNeighborLogicalFunction);
@@ -0,0 +1,105 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include <Configurations/Descriptor.hpp>
+#include <DataTypes/Schema.hpp>
+#include <DataTypes/TimeUnit.hpp>
+#include <Functions/LogicalFunction.hpp>
+#include <Identifiers/Identifiers.hpp>
+#include <Operators/LogicalOperator.hpp>
+#include <Operators/OriginIdAssigner.hpp>
+#include <Traits/Trait.hpp>
+#include <Traits/TraitSet.hpp>
+#include <Util/PlanRenderer.hpp>
+#include <SerializableOperator.pb.h>
+#include <SerializableVariantDescriptor.pb.h>
+
+namespace NES
+{
+
+/// Emits the records of its child in the order of their event time. A bounded reorder buffer collects the records per interval of
+/// `reorderIntervalMs` and emits the records of an interval sorted by their timestamps, once the watermark has passed the end of the
+/// interval. The sequence numbers of the emitted buffers follow the intervals, thus the output is ordered by the sequence numbers of its
+/// buffers. Records that arrive after their interval has been emitted are dropped, c.f., the allowed lateness of window operators.
+/// Downstream operators, which require time-ordered records, e.g., building temporal sequences, do not need to sort by themselves.
+class EventTimeSortLogicalOperator final : public OriginIdAssigner
+{
+public:
+    EventTimeSortLogicalOperator(LogicalFunction onField, const Windowing::TimeUnit& unit, uint64_t reorderIntervalMs);
+
+    /// The field of the timestamp, which has to be an integer in the time unit
+    [[nodiscard]] LogicalFunction getOnField() const;
+    [[nodiscard]] Windowing::TimeUnit getUnit() const;
+    [[nodiscard]] uint64_t getReorderIntervalMs() const;
+
+    [[nodiscard]] bool operator==(const EventTimeSortLogicalOperator& rhs) const;
+    void serialize(SerializableOperator&) const;
+
+    [[nodiscard]] EventTimeSortLogicalOperator withTraitSet(TraitSet traitSet) const;
+    [[nodiscard]] TraitSet getTraitSet() const;
+
+    [[nodiscard]] EventTimeSortLogicalOperator withChildren(std::vector<LogicalOperator> children) const;
+    [[nodiscard]] std::vector<LogicalOperator> getChildren() const;
+
+    [[nodiscard]] std::vector<Schema> getInputSchemas() const;
+    [[nodiscard]] Schema getOutputSchema() const;
+
+    [[nodiscard]] std::string explain(ExplainVerbosity verbosity, OperatorId) const;
+    [[nodiscard]] std::string_view getName() const noexcept;
+
+    [[nodiscard]] EventTimeSortLogicalOperator withInferredSchema(std::vector<Schema> inputSchemas) const;
+
+    struct ConfigParameters
+    {
+        static inline const DescriptorConfig::ConfigParameter<uint64_t> TIME_MS{
+            "TimeMs",
+            std::nullopt,
+            [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(TIME_MS, config); }};
+        static inline const DescriptorConfig::ConfigParameter<FunctionList> FUNCTION{
+            "Function",
+            std::nullopt,
+            [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(FUNCTION, config); }};
+        static inline const DescriptorConfig::ConfigParameter<uint64_t> REORDER_INTERVAL_MS{
+            "ReorderIntervalMs",
+            std::nullopt,
+            [](const std::unordered_map<std::string, std::string>& config)
+            { return DescriptorConfig::tryGet(REORDER_INTERVAL_MS, config); }};
+
+        static inline std::unordered_map<std::string, DescriptorConfig::ConfigParameterContainer> parameterMap
+            = DescriptorConfig::createConfigParameterContainerMap(TIME_MS, FUNCTION, REORDER_INTERVAL_MS);
+    };
+
+private:
+    static constexpr std::string_view NAME = "EventTimeSort";
+
+    LogicalFunction onField;
+    Windowing::TimeUnit unit;
+    uint64_t reorderIntervalMs;
+
+    std::vector<LogicalOperator> children;
+    TraitSet traitSet;
+    Schema inputSchema, outputSchema;
+};
+
+static_assert(LogicalOperatorConcept<EventTimeSortLogicalOperator>);
+
+}
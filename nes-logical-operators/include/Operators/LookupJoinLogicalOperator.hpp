@@ -0,0 +1,147 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include <Configurations/Descriptor.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Functions/LogicalFunction.hpp>
+#include <Identifiers/Identifiers.hpp>
+#include <Operators/LogicalOperator.hpp>
+#include <Traits/Trait.hpp>
+#include <Traits/TraitSet.hpp>
+#include <Util/PlanRenderer.hpp>
+#include <SerializableOperator.pb.h>
+#include <SerializableVariantDescriptor.pb.h>
+
+namespace NES
+{
+
+/// Joins each record of its single child with the rows of a static table, e.g., reference data in a CSV file, whose key equals the key of
+/// the record. As the table is loaded into memory once and does not depend on time, the join needs neither a window nor watermarks.
+/// Alternatively, the rows of a key are fetched from an external service, c.f., ExternalTable, instead of a file.
+/// The output schema contains the fields of the child followed by the fields of the table.
+class LookupJoinLogicalOperator
+{
+public:
+    /// An external service, which responds to a GET request of the url with the rows of the key as CSV lines of the table schema
+    struct ExternalTable
+    {
+        /// The `{}` in the url is replaced by the key, e.g., `http://host:8080/customers?id={}`
+        std::string url;
+        /// Number of keys whose rows are cached
+        uint64_t cacheSize;
+        /// Number of requests that the join issues concurrently
+        uint64_t maxInFlight;
+
+        bool operator==(const ExternalTable&) const = default;
+    };
+
+    /// @param tableSchema contains the fields of the table in the order of its file, qualified by the name of the table
+    /// @param joinFunction compares a field of the child and a field of the table for equality
+    /// @param reloadIntervalMs specifies how often we check the file for modifications. Zero disables reloading the table.
+    LookupJoinLogicalOperator(std::string tableFilePath, Schema tableSchema, LogicalFunction joinFunction, uint64_t reloadIntervalMs);
+    LookupJoinLogicalOperator(ExternalTable externalTable, Schema tableSchema, LogicalFunction joinFunction);
+
+    [[nodiscard]] const std::string& getTableFilePath() const;
+    [[nodiscard]] const std::optional<ExternalTable>& getExternalTable() const;
+    [[nodiscard]] const Schema& getTableSchema() const;
+    [[nodiscard]] LogicalFunction getJoinFunction() const;
+    [[nodiscard]] uint64_t getReloadIntervalMs() const;
+
+    /// The key of the child and the name of the key field of the table, which are known after inferring the schema
+    [[nodiscard]] LogicalFunction getStreamKey() const;
+    [[nodiscard]] const Schema::Field& getTableKey() const;
+
+    [[nodiscard]] bool operator==(const LookupJoinLogicalOperator& rhs) const;
+    void serialize(SerializableOperator&) const;
+
+    [[nodiscard]] LookupJoinLogicalOperator withTraitSet(TraitSet traitSet) const;
+    [[nodiscard]] TraitSet getTraitSet() const;
+
+    [[nodiscard]] LookupJoinLogicalOperator withChildren(std::vector<LogicalOperator> children) const;
+    [[nodiscard]] std::vector<LogicalOperator> getChildren() const;
+
+    [[nodiscard]] std::vector<Schema> getInputSchemas() const;
+    [[nodiscard]] Schema getOutputSchema() const;
+
+    [[nodiscard]] std::string explain(ExplainVerbosity verbosity, OperatorId) const;
+    [[nodiscard]] std::string_view getName() const noexcept;
+
+    [[nodiscard]] LookupJoinLogicalOperator withInferredSchema(std::vector<Schema> inputSchemas) const;
+
+    static constexpr uint64_t DEFAULT_CACHE_SIZE = 10000;
+    static constexpr uint64_t DEFAULT_MAX_IN_FLIGHT = 64;
+
+    struct ConfigParameters
+    {
+        static inline const DescriptorConfig::ConfigParameter<std::string> TABLE_FILE_PATH{
+            "tableFilePath",
+            std::nullopt,
+            [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(TABLE_FILE_PATH, config); }};
+
+        static inline const DescriptorConfig::ConfigParameter<FunctionList> JOIN_FUNCTION{
+            "joinFunction",
+            std::nullopt,
+            [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(JOIN_FUNCTION, config); }};
+
+        static inline const DescriptorConfig::ConfigParameter<uint64_t> RELOAD_INTERVAL_MS{
+            "reloadIntervalMs",
+            0,
+            [](const std::unordered_map<std::string, std::string>& config)
+            { return DescriptorConfig::tryGet(RELOAD_INTERVAL_MS, config); }};
+
+        static inline const DescriptorConfig::ConfigParameter<std::string> TABLE_URL{
+            "tableUrl",
+            "",
+            [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(TABLE_URL, config); }};
+
+        static inline const DescriptorConfig::ConfigParameter<uint64_t> CACHE_SIZE{
+            "cacheSize",
+            DEFAULT_CACHE_SIZE,
+            [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(CACHE_SIZE, config); }};
+
+        static inline const DescriptorConfig::ConfigParameter<uint64_t> MAX_IN_FLIGHT{
+            "maxInFlight",
+            DEFAULT_MAX_IN_FLIGHT,
+            [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(MAX_IN_FLIGHT, config); }};
+
+        static inline std::unordered_map<std::string, DescriptorConfig::ConfigParameterContainer> parameterMap
+            = DescriptorConfig::createConfigParameterContainerMap(
+                TABLE_FILE_PATH, JOIN_FUNCTION, RELOAD_INTERVAL_MS, TABLE_URL, CACHE_SIZE, MAX_IN_FLIGHT);
+    };
+
+private:
+    static constexpr std::string_view NAME = "LookupJoin";
+    std::string tableFilePath;
+    Schema tableSchema;
+    LogicalFunction joinFunction;
+    uint64_t reloadIntervalMs;
+    std::optional<ExternalTable> externalTable;
+    std::optional<LogicalFunction> streamKey;
+    std::optional<Schema::Field> tableKey;
+
+    std::vector<LogicalOperator> children;
+    TraitSet traitSet;
+    Schema inputSchema, outputSchema;
+};
+
+static_assert(LogicalOperatorConcept<LookupJoinLogicalOperator>);
+}
@@ -0,0 +1,167 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include <Configurations/Descriptor.hpp>
+#include <DataTypes/Schema.hpp>
+#include <DataTypes/TimeUnit.hpp>
+#include <Functions/FieldAccessLogicalFunction.hpp>
+#include <Functions/LogicalFunction.hpp>
+#include <Identifiers/Identifiers.hpp>
+#include <Operators/LogicalOperator.hpp>
+#include <Traits/Trait.hpp>
+#include <Traits/TraitSet.hpp>
+#include <Util/PlanRenderer.hpp>
+#include <SerializableOperator.pb.h>
+#include <SerializableVariantDescriptor.pb.h>
+
+namespace NES
+{
+
+/// Detects a pattern of events per partition key in a single pass over its child, e.g., a drop of the brake pressure followed by a drop
+/// of the speed of the same train within 5 seconds. An event is a named predicate over a record. The pattern is a sequence of steps, each
+/// step matches a single event, all events of a conjunction in any order, any event of a disjunction, or repetitions of an event.
+/// The operator emits a record with the partition keys and the timestamps of the first and the last event of every match, whose events
+/// occurred within `withinMs`. In contrast to expressing the pattern as self joins of the stream, it stores solely the partial matches.
+class PatternLogicalOperator
+{
+public:
+    /// A step of the pattern, which refers to the events by their index
+    struct Step
+    {
+        enum class Type : uint8_t
+        {
+            EVENT,
+            AND,
+            OR,
+            ITERATION,
+        };
+
+        Type type = Type::EVENT;
+        std::vector<uint64_t> events;
+        /// Solely iterations repeat their event, i.e., between minimum and maximum times. Iterations without a maximum are unbounded.
+        uint64_t minimumRepetitions = 1;
+        std::optional<uint64_t> maximumRepetitions = 1;
+
+        bool operator==(const Step& other) const = default;
+    };
+
+    /// The physical operator evaluates all events of a record into a bitmask
+    static constexpr uint64_t MAX_NUMBER_OF_EVENTS = 64;
+
+    /// @param eventPredicates contains the predicate of each event, eventNames the name of each event for explaining the pattern
+    /// @param onField is the field of the event time in the time unit
+    PatternLogicalOperator(
+        std::vector<std::string> eventNames,
+        std::vector<LogicalFunction> eventPredicates,
+        std::vector<Step> steps,
+        std::vector<FieldAccessLogicalFunction> partitionKeys,
+        LogicalFunction onField,
+        const Windowing::TimeUnit& unit,
+        uint64_t withinMs);
+
+    [[nodiscard]] const std::vector<std::string>& getEventNames() const;
+    [[nodiscard]] const std::vector<LogicalFunction>& getEventPredicates() const;
+    [[nodiscard]] const std::vector<Step>& getSteps() const;
+    [[nodiscard]] const std::vector<FieldAccessLogicalFunction>& getPartitionKeys() const;
+    [[nodiscard]] LogicalFunction getOnField() const;
+    [[nodiscard]] Windowing::TimeUnit getUnit() const;
+    [[nodiscard]] uint64_t getWithinMs() const;
+
+    /// The fields of the timestamps of the first and the last event of a match, which are known after inferring the schema
+    [[nodiscard]] const std::string& getStartFieldName() const;
+    [[nodiscard]] const std::string& getEndFieldName() const;
+
+    [[nodiscard]] bool operator==(const PatternLogicalOperator& rhs) const;
+    void serialize(SerializableOperator&) const;
+
+    [[nodiscard]] PatternLogicalOperator withTraitSet(TraitSet traitSet) const;
+    [[nodiscard]] TraitSet getTraitSet() const;
+
+    [[nodiscard]] PatternLogicalOperator withChildren(std::vector<LogicalOperator> children) const;
+    [[nodiscard]] std::vector<LogicalOperator> getChildren() const;
+
+    [[nodiscard]] std::vector<Schema> getInputSchemas() const;
+    [[nodiscard]] Schema getOutputSchema() const;
+
+    [[nodiscard]] std::string explain(ExplainVerbosity verbosity, OperatorId) const;
+    [[nodiscard]] std::string_view getName() const noexcept;
+
+    [[nodiscard]] PatternLogicalOperator withInferredSchema(std::vector<Schema> inputSchemas) const;
+
+    struct ConfigParameters
+    {
+        static inline const DescriptorConfig::ConfigParameter<std::string> EVENT_NAMES{
+            "eventNames",
+            std::nullopt,
+            [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(EVENT_NAMES, config); }};
+        static inline const DescriptorConfig::ConfigParameter<FunctionList> EVENT_PREDICATES{
+            "eventPredicates",
+            std::nullopt,
+            [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(EVENT_PREDICATES, config); }};
+        /// Each step is serialized as its type, its minimum and maximum repetitions, its number of events, and its events.
+        /// A maximum of zero denotes an unbounded iteration.
+        static inline const DescriptorConfig::ConfigParameter<UInt64List> STEPS{
+            "steps",
+            std::nullopt,
+            [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(STEPS, config); }};
+        static inline const DescriptorConfig::ConfigParameter<FunctionList> PARTITION_KEYS{
+            "partitionKeys",
+            std::nullopt,
+            [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(PARTITION_KEYS, config); }};
+        static inline const DescriptorConfig::ConfigParameter<FunctionList> FUNCTION{
+            "Function",
+            std::nullopt,
+            [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(FUNCTION, config); }};
+        static inline const DescriptorConfig::ConfigParameter<uint64_t> TIME_MS{
+            "TimeMs",
+            std::nullopt,
+            [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(TIME_MS, config); }};
+        static inline const DescriptorConfig::ConfigParameter<uint64_t> WITHIN_MS{
+            "withinMs",
+            std::nullopt,
+            [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(WITHIN_MS, config); }};
+
+        static inline std::unordered_map<std::string, DescriptorConfig::ConfigParameterContainer> parameterMap
+            = DescriptorConfig::createConfigParameterContainerMap(
+                EVENT_NAMES, EVENT_PREDICATES, STEPS, PARTITION_KEYS, FUNCTION, TIME_MS, WITHIN_MS);
+    };
+
+private:
+    static constexpr std::string_view NAME = "Pattern";
+
+    std::vector<std::string> eventNames;
+    std::vector<LogicalFunction> eventPredicates;
+    std::vector<Step> steps;
+    std::vector<FieldAccessLogicalFunction> partitionKeys;
+    LogicalFunction onField;
+    Windowing::TimeUnit unit;
+    uint64_t withinMs;
+    std::string startFieldName, endFieldName;
+
+    std::vector<LogicalOperator> children;
+    TraitSet traitSet;
+    Schema inputSchema, outputSchema;
+};
+
+static_assert(LogicalOperatorConcept<PatternLogicalOperator>);
+
+}
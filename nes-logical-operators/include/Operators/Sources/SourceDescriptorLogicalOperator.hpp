@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <optional>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -43,6 +44,11 @@ public:
 
     [[nodiscard]] SourceDescriptor getSourceDescriptor() const;
 
+    /// Narrows the output schema to the given fields of the logical source in the order of the logical source, c.f.,
+    /// PushProjectionsIntoSources. Thus, the input formatter of the source does not convert any other field.
+    [[nodiscard]] SourceDescriptorLogicalOperator withProjectedFields(const std::vector<std::string>& fieldNames) const;
+    [[nodiscard]] bool isProjected() const;
+
     [[nodiscard]] bool operator==(const SourceDescriptorLogicalOperator& rhs) const;
     void serialize(SerializableOperator&) const;
 
@@ -64,6 +70,7 @@ public:
 private:
     static constexpr std::string_view NAME = "Source";
     SourceDescriptor sourceDescriptor;
+    std::optional<Schema> projectedSchema; /// nullopt, if the source outputs all fields of the logical source
 
     std::vector<LogicalOperator> children;
     TraitSet traitSet;
@@ -0,0 +1,57 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <memory>
+#include <string_view>
+
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Functions/FieldAccessLogicalFunction.hpp>
+#include <Operators/Windows/Aggregations/WindowAggregationLogicalFunction.hpp>
+#include <SerializableVariantDescriptor.pb.h>
+
+namespace NES
+{
+
+/// Approximates the quantile of a field with a constant-size sketch, e.g., APPROX_QUANTILE(value, 0.99)
+class ApproxQuantileAggregationLogicalFunction : public WindowAggregationLogicalFunction
+{
+public:
+    /// Creates a new ApproxQuantileAggregationLogicalFunction
+    /// @param onField field on which the aggregation should be performed
+    /// @param asField function describing how the aggregated field should be called
+    /// @param quantile quantile in [0, 1] that the aggregation approximates
+    ApproxQuantileAggregationLogicalFunction(
+        const FieldAccessLogicalFunction& onField, FieldAccessLogicalFunction asField, double quantile);
+    ApproxQuantileAggregationLogicalFunction(const FieldAccessLogicalFunction& onField, double quantile);
+
+    void inferStamp(const Schema& schema) override;
+
+    ~ApproxQuantileAggregationLogicalFunction() override = default;
+
+    [[nodiscard]] SerializableAggregationFunction serialize() const override;
+    [[nodiscard]] std::string_view getName() const noexcept override;
+    [[nodiscard]] double getQuantile() const;
+
+
+private:
+    static constexpr std::string_view NAME = "ApproxQuantile";
+    static constexpr DataType::Type partialAggregateStampType = DataType::Type::FLOAT64;
+    static constexpr DataType::Type finalAggregateStampType = DataType::Type::FLOAT64;
+
+    double quantile;
+};
+}
@@ -0,0 +1,60 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string_view>
+
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Functions/FieldAccessLogicalFunction.hpp>
+#include <Operators/Windows/Aggregations/WindowAggregationLogicalFunction.hpp>
+#include <SerializableVariantDescriptor.pb.h>
+
+namespace NES
+{
+
+/// Approximates the k most frequent values of a field with a constant-size sketch, e.g., APPROX_TOP_K(productId, 10).
+/// Similar to ARRAY_AGG, the result is a variable sized value that contains the top-k values in descending order of their frequency.
+class ApproxTopKAggregationLogicalFunction : public WindowAggregationLogicalFunction
+{
+public:
+    /// Creates a new ApproxTopKAggregationLogicalFunction
+    /// @param onField field on which the aggregation should be performed
+    /// @param asField function describing how the aggregated field should be called
+    /// @param k number of most frequent values in [1, MAX_K] that the aggregation approximates
+    ApproxTopKAggregationLogicalFunction(const FieldAccessLogicalFunction& onField, FieldAccessLogicalFunction asField, uint64_t k);
+    ApproxTopKAggregationLogicalFunction(const FieldAccessLogicalFunction& onField, uint64_t k);
+
+    void inferStamp(const Schema& schema) override;
+
+    ~ApproxTopKAggregationLogicalFunction() override = default;
+
+    [[nodiscard]] SerializableAggregationFunction serialize() const override;
+    [[nodiscard]] std::string_view getName() const noexcept override;
+    [[nodiscard]] uint64_t getK() const;
+
+    /// Matches the number of counters of the sketch that the physical aggregation uses
+    static constexpr uint64_t MAX_K = 64;
+
+private:
+    static constexpr std::string_view NAME = "ApproxTopK";
+    static constexpr DataType::Type partialAggregateStampType = DataType::Type::UNDEFINED;
+    static constexpr DataType::Type finalAggregateStampType = DataType::Type::VARSIZED;
+
+    uint64_t k;
+};
+}
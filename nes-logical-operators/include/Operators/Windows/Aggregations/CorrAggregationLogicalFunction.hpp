@@ -0,0 +1,56 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <memory>
+#include <string_view>
+
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Functions/FieldAccessLogicalFunction.hpp>
+#include <Operators/Windows/Aggregations/WindowAggregationLogicalFunction.hpp>
+#include <SerializableVariantDescriptor.pb.h>
+
+namespace NES
+{
+
+/// Calculates the Pearson correlation coefficient of two numeric fields, e.g., CORR(pressure, temperature)
+class CorrAggregationLogicalFunction : public WindowAggregationLogicalFunction
+{
+public:
+    /// Creates a new CorrAggregationLogicalFunction
+    /// @param onField first field on which the aggregation should be performed
+    /// @param secondOnField second field on which the aggregation should be performed
+    /// @param asField function describing how the aggregated field should be called
+    CorrAggregationLogicalFunction(
+        const FieldAccessLogicalFunction& onField, FieldAccessLogicalFunction secondOnField, FieldAccessLogicalFunction asField);
+    CorrAggregationLogicalFunction(const FieldAccessLogicalFunction& onField, FieldAccessLogicalFunction secondOnField);
+
+    void inferStamp(const Schema& schema) override;
+
+    ~CorrAggregationLogicalFunction() override = default;
+
+    [[nodiscard]] SerializableAggregationFunction serialize() const override;
+    [[nodiscard]] std::string_view getName() const noexcept override;
+    [[nodiscard]] const FieldAccessLogicalFunction& getSecondOnField() const;
+
+private:
+    static constexpr std::string_view NAME = "Corr";
+    static constexpr DataType::Type partialAggregateStampType = DataType::Type::UNDEFINED;
+    static constexpr DataType::Type finalAggregateStampType = DataType::Type::FLOAT64;
+
+    FieldAccessLogicalFunction secondOnField;
+};
+}
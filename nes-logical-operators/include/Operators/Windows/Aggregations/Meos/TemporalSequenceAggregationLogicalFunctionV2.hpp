@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <optional>
 #include <Operators/Windows/Aggregations/WindowAggregationLogicalFunction.hpp>
 
 namespace NES
@@ -22,14 +23,19 @@ namespace NES
 class TemporalSequenceAggregationLogicalFunctionV2 : public WindowAggregationLogicalFunction
 {
 public:
-    static std::shared_ptr<WindowAggregationLogicalFunction>
-    create(const FieldAccessLogicalFunction& lonField, const FieldAccessLogicalFunction& latField, const FieldAccessLogicalFunction& timestampField);
+    /// With a tolerance in meters, the trajectory drops the points that deviate at most by the tolerance from its predicted movement
+    static std::shared_ptr<WindowAggregationLogicalFunction> create(
+        const FieldAccessLogicalFunction& lonField,
+        const FieldAccessLogicalFunction& latField,
+        const FieldAccessLogicalFunction& timestampField,
+        std::optional<double> toleranceInMeters = std::nullopt);
 
     TemporalSequenceAggregationLogicalFunctionV2(
         const FieldAccessLogicalFunction& lonField,
         const FieldAccessLogicalFunction& latField,
         const FieldAccessLogicalFunction& timestampField,
-        const FieldAccessLogicalFunction& asField);
+        const FieldAccessLogicalFunction& asField,
+        std::optional<double> toleranceInMeters = std::nullopt);
 
     void inferStamp(const Schema& schema) override;
     ~TemporalSequenceAggregationLogicalFunctionV2() override = default;
@@ -41,6 +47,7 @@ public:
     [[nodiscard]] const FieldAccessLogicalFunction& getLonField() const noexcept { return lonField; }
     [[nodiscard]] const FieldAccessLogicalFunction& getLatField() const noexcept { return latField; }
     [[nodiscard]] const FieldAccessLogicalFunction& getTimestampField() const noexcept { return timestampField; }
+    [[nodiscard]] std::optional<double> getToleranceInMeters() const noexcept { return toleranceInMeters; }
 
 private:
     static constexpr std::string_view NAME = "TemporalSequence";
@@ -50,5 +57,6 @@ private:
     FieldAccessLogicalFunction lonField;
     FieldAccessLogicalFunction latField;
     FieldAccessLogicalFunction timestampField;
+    std::optional<double> toleranceInMeters;
 };
 }
@@ -0,0 +1,102 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include <Configurations/Descriptor.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Functions/LogicalFunction.hpp>
+#include <Identifiers/Identifiers.hpp>
+#include <Operators/LogicalOperator.hpp>
+#include <Operators/OriginIdAssigner.hpp>
+#include <Traits/Trait.hpp>
+#include <Traits/TraitSet.hpp>
+#include <Util/PlanRenderer.hpp>
+#include <WindowTypes/Types/WindowType.hpp>
+#include <Windowing/WindowMetaData.hpp>
+#include <SerializableVariantDescriptor.pb.h>
+
+namespace NES
+{
+class SerializableOperator;
+
+/// Joins all of its children in the same tumbling window on a shared key, i.e., it joins a record of each child, if the join fields of all
+/// records are equal. It replaces a left-deep chain of binary equi joins on the same key, c.f., CollapseMultiWayJoins, and produces the
+/// same output schema as the chain. Thus, the output contains the window start and end fields of every collapsed join.
+class MultiWayJoinLogicalOperator final : public OriginIdAssigner
+{
+public:
+    /// @param joinFields contains exactly one field access per child in the order of the children
+    explicit MultiWayJoinLogicalOperator(std::vector<LogicalFunction> joinFields, std::shared_ptr<Windowing::WindowType> windowType);
+
+    [[nodiscard]] const std::vector<LogicalFunction>& getJoinFields() const;
+    [[nodiscard]] std::vector<std::string> getJoinFieldNames() const;
+    [[nodiscard]] std::shared_ptr<Windowing::WindowType> getWindowType() const;
+
+    /// Returns the window start and end fields of the collapsed joins, starting with the outermost one
+    [[nodiscard]] const std::vector<WindowMetaData>& getWindowMetaData() const;
+
+    [[nodiscard]] bool operator==(const MultiWayJoinLogicalOperator& rhs) const;
+    void serialize(SerializableOperator&) const;
+
+    [[nodiscard]] MultiWayJoinLogicalOperator withTraitSet(TraitSet traitSet) const;
+    [[nodiscard]] TraitSet getTraitSet() const;
+
+    [[nodiscard]] MultiWayJoinLogicalOperator withChildren(std::vector<LogicalOperator> children) const;
+    [[nodiscard]] std::vector<LogicalOperator> getChildren() const;
+
+    [[nodiscard]] std::vector<Schema> getInputSchemas() const;
+    [[nodiscard]] Schema getOutputSchema() const;
+
+    [[nodiscard]] std::string explain(ExplainVerbosity verbosity, OperatorId) const;
+    [[nodiscard]] std::string_view getName() const noexcept;
+
+    [[nodiscard]] MultiWayJoinLogicalOperator withInferredSchema(std::vector<Schema> inputSchemas) const;
+
+    struct ConfigParameters
+    {
+        static inline const DescriptorConfig::ConfigParameter<FunctionList> JOIN_FIELDS{
+            "joinFields",
+            std::nullopt,
+            [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(JOIN_FIELDS, config); }};
+
+        static inline const DescriptorConfig::ConfigParameter<WindowInfos> WINDOW_INFOS{
+            "windowInfo",
+            std::nullopt,
+            [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(WINDOW_INFOS, config); }};
+
+        static inline std::unordered_map<std::string, DescriptorConfig::ConfigParameterContainer> parameterMap
+            = DescriptorConfig::createConfigParameterContainerMap(JOIN_FIELDS, WINDOW_INFOS);
+    };
+
+private:
+    static constexpr std::string_view NAME = "MultiWayJoin";
+    std::vector<LogicalFunction> joinFields;
+    std::shared_ptr<Windowing::WindowType> windowType;
+    std::vector<WindowMetaData> windowMetaData;
+
+    std::vector<LogicalOperator> children;
+    TraitSet traitSet;
+    std::vector<Schema> inputSchemas;
+    Schema outputSchema;
+};
+
+static_assert(LogicalOperatorConcept<MultiWayJoinLogicalOperator>);
+}
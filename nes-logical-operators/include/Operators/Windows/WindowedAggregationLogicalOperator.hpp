@@ -42,6 +42,16 @@ namespace NES
 class WindowedAggregationLogicalOperator final : public OriginIdAssigner
 {
 public:
+    /// Restricts the emitted records of each window to the `limit` records with the highest (descending) or lowest (ascending) value
+    /// of the order field, i.e., `ORDER BY orderFieldName DESC LIMIT limit`. The order field is a key or an aggregation of the window.
+    struct TopN
+    {
+        std::string orderFieldName;
+        bool descending = true;
+        uint64_t limit = 0;
+        bool operator==(const TopN& other) const = default;
+    };
+
     WindowedAggregationLogicalOperator(
         std::vector<FieldAccessLogicalFunction> groupingKey,
         std::vector<std::shared_ptr<WindowAggregationLogicalFunction>> aggregationFunctions,
@@ -63,6 +73,9 @@ public:
     [[nodiscard]] std::string getWindowEndFieldName() const;
     [[nodiscard]] const WindowMetaData& getWindowMetaData() const;
 
+    [[nodiscard]] const std::optional<TopN>& getTopN() const;
+    [[nodiscard]] WindowedAggregationLogicalOperator withTopN(std::optional<TopN> topN) const;
+
 
     [[nodiscard]] bool operator==(const WindowedAggregationLogicalOperator& rhs) const;
     void serialize(SerializableOperator&) const;
@@ -99,8 +112,24 @@ public:
             std::nullopt,
             [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(WINDOW_INFOS, config); }};
 
+        static inline const DescriptorConfig::ConfigParameter<std::string> TOP_N_FIELD{
+            "topNField",
+            std::nullopt,
+            [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(TOP_N_FIELD, config); }};
+
+        static inline const DescriptorConfig::ConfigParameter<bool> TOP_N_DESCENDING{
+            "topNDescending",
+            true,
+            [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(TOP_N_DESCENDING, config); }};
+
+        static inline const DescriptorConfig::ConfigParameter<uint64_t> TOP_N_LIMIT{
+            "topNLimit",
+            std::nullopt,
+            [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(TOP_N_LIMIT, config); }};
+
         static inline std::unordered_map<std::string, DescriptorConfig::ConfigParameterContainer> parameterMap
-            = DescriptorConfig::createConfigParameterContainerMap(WINDOW_AGGREGATIONS, WINDOW_INFOS, WINDOW_KEYS);
+            = DescriptorConfig::createConfigParameterContainerMap(
+                WINDOW_AGGREGATIONS, WINDOW_INFOS, WINDOW_KEYS, TOP_N_FIELD, TOP_N_DESCENDING, TOP_N_LIMIT);
     };
 
 private:
@@ -109,6 +138,7 @@ private:
     std::shared_ptr<Windowing::WindowType> windowType;
     std::vector<FieldAccessLogicalFunction> groupingKey;
     WindowMetaData windowMetaData;
+    std::optional<TopN> topN;
 
     std::vector<LogicalOperator> children;
     TraitSet traitSet;
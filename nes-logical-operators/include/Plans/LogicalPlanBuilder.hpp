@@ -14,7 +14,9 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -22,9 +24,12 @@
 #include <Functions/FieldAccessLogicalFunction.hpp>
 #include <Functions/LogicalFunction.hpp>
 #include <Operators/LogicalOperator.hpp>
+#include <Operators/LookupJoinLogicalOperator.hpp>
+#include <Operators/PatternLogicalOperator.hpp>
 #include <Operators/ProjectionLogicalOperator.hpp>
 #include <Operators/Windows/Aggregations/WindowAggregationLogicalFunction.hpp>
 #include <Operators/Windows/JoinLogicalOperator.hpp>
+#include <Operators/Windows/WindowedAggregationLogicalOperator.hpp>
 #include <Plans/LogicalPlan.hpp>
 #include <WindowTypes/Types/WindowType.hpp>
 
@@ -59,11 +64,35 @@ public:
     /// @return the updated queryPlan
     static LogicalPlan addSelection(LogicalFunction selectionFunction, const LogicalPlan& queryPlan);
 
+    /// @brief: this call adds an event time watermark assigner and the event time sort operator to the queryPlan
+    /// @param timestampField the field that contains the event time of the records in milliseconds
+    /// @param reorderIntervalMs the interval, whose records the sort emits in timestamp order once the watermark has passed it
+    /// @return the updated queryPlan
+    static LogicalPlan
+    addEventTimeSort(const LogicalPlan& queryPlan, FieldAccessLogicalFunction timestampField, uint64_t reorderIntervalMs);
+
+    /// @brief: this call adds an event time watermark assigner and the pattern operator to the queryPlan
+    /// @param eventNames and eventPredicates define the events, to which the steps of the pattern refer by their index
+    /// @param timestampField the field that contains the event time of the records in milliseconds
+    /// @param withinMs the maximum time between the first and the last event of a match
+    /// @return the updated queryPlan
+    static LogicalPlan addPattern(
+        const LogicalPlan& queryPlan,
+        std::vector<std::string> eventNames,
+        std::vector<LogicalFunction> eventPredicates,
+        std::vector<PatternLogicalOperator::Step> steps,
+        std::vector<FieldAccessLogicalFunction> partitionKeys,
+        FieldAccessLogicalFunction timestampField,
+        uint64_t withinMs);
+
+    /// @brief: this call adds the window aggregation operator to the queryPlan
+    /// @param topN restricts the emitted records of each window to its top n records, c.f., WindowedAggregationLogicalOperator::TopN
     static LogicalPlan addWindowAggregation(
         LogicalPlan queryPlan,
         const std::shared_ptr<Windowing::WindowType>& windowType,
         std::vector<std::shared_ptr<WindowAggregationLogicalFunction>> windowAggs,
-        std::vector<FieldAccessLogicalFunction> onKeys);
+        std::vector<FieldAccessLogicalFunction> onKeys,
+        std::optional<WindowedAggregationLogicalOperator::TopN> topN = std::nullopt);
 
     /// @brief UnionOperator to combine two query plans
     /// @param leftLogicalPlan the left query plan to combine by the union
@@ -84,6 +113,27 @@ public:
         std::shared_ptr<Windowing::WindowType> windowType,
         JoinLogicalOperator::JoinType joinType);
 
+    /// @brief This method adds a lookup join of the query plan with a static table
+    /// @param tableFilePath the CSV file that contains the rows of the table
+    /// @param tableSchema the fields of the table, qualified by the name of the table
+    /// @param joinFunction the equality of a field of the query plan and a field of the table
+    /// @param reloadIntervalMs how often the file is checked for modifications, zero disables reloading
+    /// @return the updated queryPlan
+    static LogicalPlan addLookupJoin(
+        const LogicalPlan& queryPlan,
+        std::string tableFilePath,
+        Schema tableSchema,
+        LogicalFunction joinFunction,
+        uint64_t reloadIntervalMs);
+
+    /// @brief This method adds a lookup join of the query plan with a table, whose rows are fetched from an external service per key
+    /// @return the updated queryPlan
+    static LogicalPlan addLookupJoin(
+        const LogicalPlan& queryPlan,
+        LookupJoinLogicalOperator::ExternalTable externalTable,
+        Schema tableSchema,
+        LogicalFunction joinFunction);
+
     static LogicalPlan addSink(std::string sinkName, const LogicalPlan& queryPlan);
     static LogicalPlan addInlineSink(
         std::string type, const Schema& schema, std::unordered_map<std::string, std::string> sinkConfig, const LogicalPlan& queryPlan);
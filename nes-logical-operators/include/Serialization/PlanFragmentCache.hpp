@@ -0,0 +1,71 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <unordered_set>
+#include <Operators/LogicalOperator.hpp>
+#include <folly/Synchronized.h>
+#include <folly/container/EvictingCacheMap.h>
+#include <SerializableOperator.pb.h>
+#include <SerializableQueryPlan.pb.h>
+
+namespace NES
+{
+
+/// Content-addressed cache of the deserialized operators of the plans that a worker receives. A fragment is an operator without its id
+/// and its children, e.g., a source with its parser configuration, which is identical in many queries. A client sends the fragments that
+/// it already sent to the worker solely by their hash, c.f., SentPlanFragments, thus they are neither transferred nor deserialized again.
+/// The cache evicts the least recently used fragments. A plan that references an evicted fragment fails with UnknownPlanFragment, upon
+/// which the client sends the plan again with all its fragments.
+class PlanFragmentCache
+{
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 4096;
+
+    explicit PlanFragmentCache(size_t capacity = DEFAULT_CAPACITY);
+
+    /// Hash of the operator without its id, its children, and its fragment hash. Equal fragments have equal hashes in every process.
+    [[nodiscard]] static uint64_t hashFragment(const SerializableOperator& serializedOperator);
+
+    /// Returns the operator with the id of the serialized operator. If the serialized operator solely references a fragment, the
+    /// operator is a copy of the cached fragment, otherwise the operator is deserialized and its fragment is cached.
+    /// @throws UnknownPlanFragment if the referenced fragment is not cached
+    [[nodiscard]] LogicalOperator deserializeOperator(const SerializableOperator& serializedOperator);
+
+private:
+    /// Accessing a fragment marks it as recently used, thus reads require the exclusive lock as well
+    folly::Synchronized<folly::EvictingCacheMap<uint64_t, LogicalOperator>, std::mutex> fragments;
+};
+
+/// Fragments that a client sent to one worker, thus it sends every fragment solely once
+class SentPlanFragments
+{
+public:
+    /// Annotates every operator of the plan with the hash of its fragment and replaces the operators, whose fragment was sent before, by
+    /// references to their fragment. Records the remaining fragments as sent.
+    void compactPlan(SerializableQueryPlan& serializedQueryPlan);
+
+    /// Forgets all sent fragments, e.g., as the worker restarted or evicted fragments, thus the next plan contains all its fragments
+    void clear();
+
+private:
+    std::mutex mutex;
+    std::unordered_set<uint64_t> sentFragments;
+};
+
+}
@@ -14,7 +14,11 @@
 
 #pragma once
 
+#include <functional>
+#include <Operators/LogicalOperator.hpp>
 #include <Plans/LogicalPlan.hpp>
+#include <Serialization/PlanFragmentCache.hpp>
+#include <SerializableOperator.pb.h>
 #include <SerializableQueryPlan.pb.h>
 
 namespace NES
@@ -24,5 +28,12 @@ class QueryPlanSerializationUtil
 public:
     static SerializableQueryPlan serializeQueryPlan(const LogicalPlan& queryPlan);
     static LogicalPlan deserializeQueryPlan(const SerializableQueryPlan& serializedQueryPlan);
+    /// Resolves the operators which solely reference a fragment via the cache and caches the fragments of all other operators
+    static LogicalPlan deserializeQueryPlan(const SerializableQueryPlan& serializedQueryPlan, PlanFragmentCache& fragmentCache);
+
+private:
+    static LogicalPlan deserializeQueryPlan(
+        const SerializableQueryPlan& serializedQueryPlan,
+        const std::function<LogicalOperator(const SerializableOperator&)>& deserializeOperator);
 };
 }
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <optional>
 #include <string_view>
 
 #include <Functions/FieldAccessLogicalFunction.hpp>
@@ -25,11 +26,13 @@ namespace NES::TemporalAggregationSerde
 inline constexpr std::string_view TEMPORAL_SEQUENCE_EXTRA_FIELDS_KEY = "TemporalSequence.extra_fields";
 
 /// Build a SerializableAggregationFunction for TemporalSequence storing lat/ts as a FunctionList inside on_field.config.
+/// The tolerance of the trajectory simplification is stored in the tolerance of the SerializableAggregationFunction.
 SerializableAggregationFunction serializeTemporalSequence(
     const FieldAccessLogicalFunction& lon,
     const FieldAccessLogicalFunction& lat,
     const FieldAccessLogicalFunction& ts,
-    const FieldAccessLogicalFunction& asField);
+    const FieldAccessLogicalFunction& asField,
+    std::optional<double> toleranceInMeters = std::nullopt);
 
 /// Parse lon, lat, ts, as FieldAccessLogicalFunctions from a SerializableAggregationFunction created by serializeTemporalSequence().
 /// Returns fields in the order: lon, lat, ts, as.
@@ -0,0 +1,46 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <string>
+#include <WindowTypes/Measures/TimeCharacteristic.hpp>
+#include <WindowTypes/Measures/TimeMeasure.hpp>
+#include <WindowTypes/Types/TimeBasedWindowType.hpp>
+#include <WindowTypes/Types/WindowType.hpp>
+
+namespace NES::Windowing
+{
+/// A SessionWindow assigns records to non-overlapping windows of activity that are separated by a gap without any record.
+/// A session starts with its first record and ends the gap after its last record. Thus, the windows have no fixed size.
+/// Solely windowed aggregations support session windows and the sessions are shared by all keys of the aggregation.
+class SessionWindow final : public TimeBasedWindowType
+{
+public:
+    SessionWindow(TimeCharacteristic timeCharacteristic, TimeMeasure gap);
+
+    [[nodiscard]] TimeMeasure getGap() const;
+
+    /// A session spans at least the gap. Thus, both the size and the slide of a session window are the gap.
+    TimeMeasure getSize() override;
+    TimeMeasure getSlide() override;
+
+    [[nodiscard]] std::string toString() const override;
+    bool operator==(const WindowType& otherWindowType) const override;
+
+private:
+    const TimeMeasure gap;
+};
+
+}
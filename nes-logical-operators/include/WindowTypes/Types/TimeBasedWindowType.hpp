@@ -15,6 +15,8 @@
 #pragma once
 
 #include <memory>
+#include <optional>
+#include <string>
 #include <vector>
 #include <DataTypes/Schema.hpp>
 #include <WindowTypes/Measures/TimeCharacteristic.hpp>
@@ -46,8 +48,17 @@ public:
     /// @return true if success else false
     bool inferStamp(const Schema& schema) override;
 
+    /// Windowed aggregations emit the results of open windows early, whenever the watermark passes a multiple of the early firing interval.
+    /// Each early result of a window supersedes its previous early result, until the final result follows on the window end.
+    [[nodiscard]] std::optional<TimeMeasure> getEarlyFiringInterval() const;
+    void setEarlyFiringInterval(TimeMeasure earlyFiringInterval);
+
 protected:
+    /// Returns the suffix of toString() that describes the early firing interval, if the window has one
+    [[nodiscard]] std::string earlyFiringIntervalToString() const;
+
     TimeCharacteristic timeCharacteristic;
+    std::optional<TimeMeasure> earlyFiringInterval;
 };
 
 }
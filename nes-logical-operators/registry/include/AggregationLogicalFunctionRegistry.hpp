@@ -14,7 +14,9 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 #include <Functions/FieldAccessLogicalFunction.hpp>
@@ -29,6 +31,12 @@ using AggregationLogicalFunctionRegistryReturnType = std::shared_ptr<WindowAggre
 struct AggregationLogicalFunctionRegistryArguments
 {
     std::vector<FieldAccessLogicalFunction> fields;
+    /// Solely set for quantile aggregations, e.g., ApproxQuantile
+    std::optional<double> quantile;
+    /// Solely set for top-k aggregations, e.g., ApproxTopK
+    std::optional<uint64_t> k;
+    /// Solely set for simplifying aggregations, e.g., TemporalSequence
+    std::optional<double> tolerance;
 };
 
 class AggregationLogicalFunctionRegistry : public BaseRegistry<
@@ -27,6 +27,23 @@ TemporalEDWithinGeometryLogicalFunction::TemporalEDWithinGeometryLogicalFunction
     parameters.push_back(std::move(distance));
 }
 
+TemporalEDWithinGeometryLogicalFunction::TemporalEDWithinGeometryLogicalFunction(LogicalFunction lon1,
+                                                                                 LogicalFunction lat1,
+                                                                                 LogicalFunction timestamp1,
+                                                                                 LogicalFunction lon2,
+                                                                                 LogicalFunction lat2,
+                                                                                 LogicalFunction distance)
+    : dataType(DataTypeProvider::provideDataType(DataType::Type::INT32))
+{
+    parameters.reserve(6);
+    parameters.push_back(std::move(lon1));
+    parameters.push_back(std::move(lat1));
+    parameters.push_back(std::move(timestamp1));
+    parameters.push_back(std::move(lon2));
+    parameters.push_back(std::move(lat2));
+    parameters.push_back(std::move(distance));
+}
+
 DataType TemporalEDWithinGeometryLogicalFunction::getDataType() const
 {
     return dataType;
@@ -46,7 +63,9 @@ std::vector<LogicalFunction> TemporalEDWithinGeometryLogicalFunction::getChildre
 
 LogicalFunction TemporalEDWithinGeometryLogicalFunction::withChildren(const std::vector<LogicalFunction>& children) const
 {
-    PRECONDITION(children.size() == 5, "TemporalEDWithinGeometryLogicalFunction requires 5 children, but got {}", children.size());
+    PRECONDITION(children.size() == 5 || children.size() == 6,
+                 "TemporalEDWithinGeometryLogicalFunction requires 5 or 6 children, but got {}",
+                 children.size());
     auto copy = *this;
     copy.parameters = children;
     return copy;
@@ -92,8 +111,17 @@ LogicalFunction TemporalEDWithinGeometryLogicalFunction::withInferredDataType(co
     INVARIANT(newChildren[0].getDataType().isNumeric(), "Longitude must be numeric, but was: {}", newChildren[0].getDataType());
     INVARIANT(newChildren[1].getDataType().isNumeric(), "Latitude must be numeric, but was: {}", newChildren[1].getDataType());
     INVARIANT(newChildren[2].getDataType().isType(DataType::Type::UINT64), "Timestamp must be UINT64, but was: {}", newChildren[2].getDataType());
-    INVARIANT(newChildren[3].getDataType().isType(DataType::Type::VARSIZED), "Geometry literal must be VARSIZED, but was: {}", newChildren[3].getDataType());
-    INVARIANT(newChildren[4].getDataType().isNumeric(), "Distance must be numeric, but was: {}", newChildren[4].getDataType());
+    if (newChildren.size() == 6)
+    {
+        INVARIANT(newChildren[3].getDataType().isNumeric(), "Second longitude must be numeric, but was: {}", newChildren[3].getDataType());
+        INVARIANT(newChildren[4].getDataType().isNumeric(), "Second latitude must be numeric, but was: {}", newChildren[4].getDataType());
+        INVARIANT(newChildren[5].getDataType().isNumeric(), "Distance must be numeric, but was: {}", newChildren[5].getDataType());
+    }
+    else
+    {
+        INVARIANT(newChildren[3].getDataType().isType(DataType::Type::VARSIZED), "Geometry literal must be VARSIZED, but was: {}", newChildren[3].getDataType());
+        INVARIANT(newChildren[4].getDataType().isNumeric(), "Distance must be numeric, but was: {}", newChildren[4].getDataType());
+    }
 
     return withChildren(newChildren);
 }
@@ -113,9 +141,18 @@ SerializableFunction TemporalEDWithinGeometryLogicalFunction::serialize() const
 LogicalFunctionRegistryReturnType
 LogicalFunctionGeneratedRegistrar::RegisterTemporalEDWithinGeometryLogicalFunction(LogicalFunctionRegistryArguments arguments)
 {
-    PRECONDITION(arguments.children.size() == 5,
-                 "TemporalEDWithinGeometryLogicalFunction requires 5 children, but got {}",
+    PRECONDITION(arguments.children.size() == 5 || arguments.children.size() == 6,
+                 "TemporalEDWithinGeometryLogicalFunction requires 5 or 6 children, but got {}",
                  arguments.children.size());
+    if (arguments.children.size() == 6)
+    {
+        return TemporalEDWithinGeometryLogicalFunction(arguments.children[0],
+                                                       arguments.children[1],
+                                                       arguments.children[2],
+                                                       arguments.children[3],
+                                                       arguments.children[4],
+                                                       arguments.children[5]);
+    }
     return TemporalEDWithinGeometryLogicalFunction(arguments.children[0],
                                                    arguments.children[1],
                                                    arguments.children[2],
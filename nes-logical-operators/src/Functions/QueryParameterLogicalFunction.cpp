@@ -0,0 +1,124 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Functions/QueryParameterLogicalFunction.hpp>
+
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <Configurations/Descriptor.hpp>
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Functions/LogicalFunction.hpp>
+#include <Serialization/DataTypeSerializationUtil.hpp>
+#include <Util/PlanRenderer.hpp>
+#include <fmt/format.h>
+#include <ErrorHandling.hpp>
+#include <LogicalFunctionRegistry.hpp>
+#include <SerializableVariantDescriptor.pb.h>
+
+namespace NES
+{
+
+QueryParameterLogicalFunction::QueryParameterLogicalFunction(std::string parameterName, DataType dataType, std::string defaultValue)
+    : parameterName(std::move(parameterName)), dataType(std::move(dataType)), defaultValue(std::move(defaultValue))
+{
+}
+
+const std::string& QueryParameterLogicalFunction::getParameterName() const
+{
+    return parameterName;
+}
+
+const std::string& QueryParameterLogicalFunction::getDefaultValue() const
+{
+    return defaultValue;
+}
+
+bool QueryParameterLogicalFunction::operator==(const LogicalFunctionConcept& rhs) const
+{
+    if (const auto* other = dynamic_cast<const QueryParameterLogicalFunction*>(&rhs))
+    {
+        return parameterName == other->parameterName and dataType == other->dataType and defaultValue == other->defaultValue;
+    }
+    return false;
+}
+
+std::string QueryParameterLogicalFunction::explain(ExplainVerbosity verbosity) const
+{
+    if (verbosity == ExplainVerbosity::Debug)
+    {
+        return fmt::format("QueryParameterLogicalFunction({} = {} : {})", parameterName, defaultValue, dataType);
+    }
+    return fmt::format("PARAMETER({}, {})", parameterName, defaultValue);
+}
+
+DataType QueryParameterLogicalFunction::getDataType() const
+{
+    return dataType;
+}
+
+LogicalFunction QueryParameterLogicalFunction::withDataType(const DataType& dataType) const
+{
+    auto copy = *this;
+    copy.dataType = dataType;
+    return copy;
+}
+
+LogicalFunction QueryParameterLogicalFunction::withInferredDataType(const Schema&) const
+{
+    /// Like for constant values, the data type of the parameter is defined by its default value
+    return *this;
+}
+
+std::vector<LogicalFunction> QueryParameterLogicalFunction::getChildren() const
+{
+    return {};
+}
+
+LogicalFunction QueryParameterLogicalFunction::withChildren(const std::vector<LogicalFunction>&) const
+{
+    return *this;
+}
+
+std::string_view QueryParameterLogicalFunction::getType() const
+{
+    return NAME;
+}
+
+SerializableFunction QueryParameterLogicalFunction::serialize() const
+{
+    SerializableFunction serializedFunction;
+    serializedFunction.set_function_type(NAME);
+    DataTypeSerializationUtil::serializeDataType(getDataType(), serializedFunction.mutable_data_type());
+    (*serializedFunction.mutable_config())["parameterName"] = descriptorConfigTypeToProto(DescriptorConfig::ConfigType(parameterName));
+    (*serializedFunction.mutable_config())["defaultValue"] = descriptorConfigTypeToProto(DescriptorConfig::ConfigType(defaultValue));
+    return serializedFunction;
+}
+
+LogicalFunctionRegistryReturnType
+LogicalFunctionGeneratedRegistrar::RegisterQueryParameterLogicalFunction(LogicalFunctionRegistryArguments arguments)
+{
+    if (not arguments.config.contains("parameterName") or not arguments.config.contains("defaultValue"))
+    {
+        throw CannotDeserialize("QueryParameterLogicalFunction requires a parameterName and a defaultValue in its config");
+    }
+    return QueryParameterLogicalFunction(
+        get<std::string>(arguments.config["parameterName"]),
+        std::move(arguments.dataType),
+        get<std::string>(arguments.config["defaultValue"]));
+}
+
+}
@@ -0,0 +1,161 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Functions/Spatial/GeohashLogicalFunction.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/DataTypeProvider.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Functions/CastToTypeLogicalFunction.hpp>
+#include <Functions/ConstantValueLogicalFunction.hpp>
+#include <Functions/LogicalFunction.hpp>
+#include <Serialization/DataTypeSerializationUtil.hpp>
+#include <Util/PlanRenderer.hpp>
+#include <Util/Strings.hpp>
+#include <fmt/format.h>
+#include <fmt/ranges.h>
+#include <ErrorHandling.hpp>
+#include <LogicalFunctionRegistry.hpp>
+#include <SerializableVariantDescriptor.pb.h>
+
+namespace NES
+{
+
+GeohashLogicalFunction::GeohashLogicalFunction(LogicalFunction lon, LogicalFunction lat, LogicalFunction precision)
+    : dataType(DataTypeProvider::provideDataType(DataType::Type::UINT64))
+    , parameters({std::move(lon), std::move(lat), std::move(precision)})
+{
+}
+
+bool GeohashLogicalFunction::operator==(const LogicalFunctionConcept& rhs) const
+{
+    if (const auto* other = dynamic_cast<const GeohashLogicalFunction*>(&rhs))
+    {
+        return parameters == other->parameters;
+    }
+    return false;
+}
+
+std::string GeohashLogicalFunction::explain(ExplainVerbosity verbosity) const
+{
+    std::vector<std::string> explainedParameters;
+    for (const auto& parameter : parameters)
+    {
+        explainedParameters.emplace_back(parameter.explain(verbosity));
+    }
+    if (verbosity == ExplainVerbosity::Debug)
+    {
+        return fmt::format("GeohashLogicalFunction({} : {})", fmt::join(explainedParameters, ", "), dataType);
+    }
+    return fmt::format("GEOHASH({})", fmt::join(explainedParameters, ", "));
+}
+
+DataType GeohashLogicalFunction::getDataType() const
+{
+    return dataType;
+};
+
+LogicalFunction GeohashLogicalFunction::withDataType(const DataType& dataType) const
+{
+    auto copy = *this;
+    copy.dataType = dataType;
+    return copy;
+};
+
+LogicalFunction GeohashLogicalFunction::inferPrecision(const LogicalFunction& precision, const std::string_view functionName)
+{
+    const auto constant = precision.tryGet<ConstantValueLogicalFunction>();
+    if (not constant.has_value())
+    {
+        throw CannotInferSchema(
+            "The precision of {} must be a constant, but got: {}", functionName, precision.explain(ExplainVerbosity::Short));
+    }
+    const auto value = Util::from_chars<double>(constant->getConstantValue());
+    if (not value.has_value() or std::trunc(*value) != *value or *value < 1 or *value > static_cast<double>(MAX_PRECISION))
+    {
+        throw CannotInferSchema(
+            "The precision of {} must be an integer in [1, {}], but got: {}", functionName, MAX_PRECISION, constant->getConstantValue());
+    }
+    return ConstantValueLogicalFunction(
+        DataTypeProvider::provideDataType(DataType::Type::UINT64), std::to_string(static_cast<uint64_t>(*value)));
+}
+
+LogicalFunction GeohashLogicalFunction::withInferredDataType(const Schema& schema) const
+{
+    /// The physical function computes on doubles, thus we cast all other numeric coordinates once in the logical plan
+    std::vector<LogicalFunction> newChildren;
+    for (const auto& child : {parameters[0], parameters[1]})
+    {
+        auto newChild = child.withInferredDataType(schema);
+        if (not newChild.getDataType().isNumeric())
+        {
+            throw CannotInferSchema("GEOHASH requires numeric coordinates, but got: {}", newChild.getDataType());
+        }
+        if (newChild.getDataType().type != DataType::Type::FLOAT64)
+        {
+            newChild = CastToTypeLogicalFunction(DataTypeProvider::provideDataType(DataType::Type::FLOAT64), newChild);
+        }
+        newChildren.push_back(newChild);
+    }
+    newChildren.push_back(inferPrecision(parameters[2], "GEOHASH"));
+    return withChildren(newChildren);
+};
+
+std::vector<LogicalFunction> GeohashLogicalFunction::getChildren() const
+{
+    return parameters;
+};
+
+LogicalFunction GeohashLogicalFunction::withChildren(const std::vector<LogicalFunction>& children) const
+{
+    PRECONDITION(children.size() == 3, "GeohashLogicalFunction requires exactly three children, but got {}", children.size());
+    auto copy = *this;
+    copy.parameters = children;
+    return copy;
+};
+
+std::string_view GeohashLogicalFunction::getType() const
+{
+    return NAME;
+}
+
+SerializableFunction GeohashLogicalFunction::serialize() const
+{
+    SerializableFunction serializedFunction;
+    serializedFunction.set_function_type(NAME);
+    for (const auto& parameter : parameters)
+    {
+        serializedFunction.add_children()->CopyFrom(parameter.serialize());
+    }
+    DataTypeSerializationUtil::serializeDataType(this->getDataType(), serializedFunction.mutable_data_type());
+    return serializedFunction;
+}
+
+LogicalFunctionRegistryReturnType
+LogicalFunctionGeneratedRegistrar::RegisterGeohashLogicalFunction(LogicalFunctionRegistryArguments arguments)
+{
+    if (arguments.children.size() != 3)
+    {
+        throw CannotDeserialize("GeohashLogicalFunction requires exactly three children, but got {}", arguments.children.size());
+    }
+    return GeohashLogicalFunction(arguments.children[0], arguments.children[1], arguments.children[2]);
+}
+
+}
@@ -0,0 +1,160 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Functions/Spatial/GeohashNeighborLogicalFunction.hpp>
+
+#include <cmath>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/DataTypeProvider.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Functions/CastToTypeLogicalFunction.hpp>
+#include <Functions/ConstantValueLogicalFunction.hpp>
+#include <Functions/LogicalFunction.hpp>
+#include <Functions/Spatial/GeohashLogicalFunction.hpp>
+#include <Serialization/DataTypeSerializationUtil.hpp>
+#include <Util/PlanRenderer.hpp>
+#include <Util/Strings.hpp>
+#include <fmt/format.h>
+#include <fmt/ranges.h>
+#include <ErrorHandling.hpp>
+#include <LogicalFunctionRegistry.hpp>
+#include <SerializableVariantDescriptor.pb.h>
+
+namespace NES
+{
+
+namespace
+{
+/// Casts an integer function to the given type. Numeric literals are FLOAT64 constants, thus they must be integral.
+LogicalFunction castToInteger(const LogicalFunction& function, const DataType::Type type, const std::string_view argumentName)
+{
+    if (const auto constant = function.tryGet<ConstantValueLogicalFunction>())
+    {
+        const auto value = Util::from_chars<double>(constant->getConstantValue());
+        if (not value.has_value() or std::trunc(*value) != *value)
+        {
+            throw CannotInferSchema(
+                "The {} of GEOHASH_NEIGHBOR must be an integer, but got: {}", argumentName, constant->getConstantValue());
+        }
+        return ConstantValueLogicalFunction(DataTypeProvider::provideDataType(type), fmt::format("{:.0f}", *value));
+    }
+    if (not function.getDataType().isInteger())
+    {
+        throw CannotInferSchema("The {} of GEOHASH_NEIGHBOR must be an integer, but got: {}", argumentName, function.getDataType());
+    }
+    if (function.getDataType().type != type)
+    {
+        return CastToTypeLogicalFunction(DataTypeProvider::provideDataType(type), function);
+    }
+    return function;
+}
+}
+
+GeohashNeighborLogicalFunction::GeohashNeighborLogicalFunction(
+    LogicalFunction cell, LogicalFunction precision, LogicalFunction lonOffset, LogicalFunction latOffset)
+    : dataType(DataTypeProvider::provideDataType(DataType::Type::UINT64))
+    , parameters({std::move(cell), std::move(precision), std::move(lonOffset), std::move(latOffset)})
+{
+}
+
+bool GeohashNeighborLogicalFunction::operator==(const LogicalFunctionConcept& rhs) const
+{
+    if (const auto* other = dynamic_cast<const GeohashNeighborLogicalFunction*>(&rhs))
+    {
+        return parameters == other->parameters;
+    }
+    return false;
+}
+
+std::string GeohashNeighborLogicalFunction::explain(ExplainVerbosity verbosity) const
+{
+    std::vector<std::string> explainedParameters;
+    for (const auto& parameter : parameters)
+    {
+        explainedParameters.emplace_back(parameter.explain(verbosity));
+    }
+    if (verbosity == ExplainVerbosity::Debug)
+    {
+        return fmt::format("GeohashNeighborLogicalFunction({} : {})", fmt::join(explainedParameters, ", "), dataType);
+    }
+    return fmt::format("GEOHASH_NEIGHBOR({})", fmt::join(explainedParameters, ", "));
+}
+
+DataType GeohashNeighborLogicalFunction::getDataType() const
+{
+    return dataType;
+};
+
+LogicalFunction GeohashNeighborLogicalFunction::withDataType(const DataType& dataType) const
+{
+    auto copy = *this;
+    copy.dataType = dataType;
+    return copy;
+};
+
+LogicalFunction GeohashNeighborLogicalFunction::withInferredDataType(const Schema& schema) const
+{
+    /// The physical function computes on the UINT64 key and signed INT64 offsets
+    return withChildren(
+        {castToInteger(parameters[0].withInferredDataType(schema), DataType::Type::UINT64, "cell"),
+         GeohashLogicalFunction::inferPrecision(parameters[1], "GEOHASH_NEIGHBOR"),
+         castToInteger(parameters[2].withInferredDataType(schema), DataType::Type::INT64, "longitude offset"),
+         castToInteger(parameters[3].withInferredDataType(schema), DataType::Type::INT64, "latitude offset")});
+};
+
+std::vector<LogicalFunction> GeohashNeighborLogicalFunction::getChildren() const
+{
+    return parameters;
+};
+
+LogicalFunction GeohashNeighborLogicalFunction::withChildren(const std::vector<LogicalFunction>& children) const
+{
+    PRECONDITION(children.size() == 4, "GeohashNeighborLogicalFunction requires exactly four children, but got {}", children.size());
+    auto copy = *this;
+    copy.parameters = children;
+    return copy;
+};
+
+std::string_view GeohashNeighborLogicalFunction::getType() const
+{
+    return NAME;
+}
+
+SerializableFunction GeohashNeighborLogicalFunction::serialize() const
+{
+    SerializableFunction serializedFunction;
+    serializedFunction.set_function_type(NAME);
+    for (const auto& parameter : parameters)
+    {
+        serializedFunction.add_children()->CopyFrom(parameter.serialize());
+    }
+    DataTypeSerializationUtil::serializeDataType(this->getDataType(), serializedFunction.mutable_data_type());
+    return serializedFunction;
+}
+
+LogicalFunctionRegistryReturnType
+LogicalFunctionGeneratedRegistrar::RegisterGeohashNeighborLogicalFunction(LogicalFunctionRegistryArguments arguments)
+{
+    if (arguments.children.size() != 4)
+    {
+        throw CannotDeserialize("GeohashNeighborLogicalFunction requires exactly four children, but got {}", arguments.children.size());
+    }
+    return GeohashNeighborLogicalFunction(arguments.children[0], arguments.children[1], arguments.children[2], arguments.children[3]);
+}
+
+}
@@ -0,0 +1,140 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+
+#include <Functions/Spatial/HaversineDistanceLogicalFunction.hpp>
+
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/DataTypeProvider.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Functions/CastToTypeLogicalFunction.hpp>
+#include <Functions/LogicalFunction.hpp>
+#include <Serialization/DataTypeSerializationUtil.hpp>
+#include <Util/PlanRenderer.hpp>
+#include <fmt/format.h>
+#include <fmt/ranges.h>
+#include <ErrorHandling.hpp>
+#include <LogicalFunctionRegistry.hpp>
+#include <SerializableVariantDescriptor.pb.h>
+
+namespace NES
+{
+
+HaversineDistanceLogicalFunction::HaversineDistanceLogicalFunction(
+    LogicalFunction lon1, LogicalFunction lat1, LogicalFunction lon2, LogicalFunction lat2)
+    : dataType(DataTypeProvider::provideDataType(DataType::Type::FLOAT64))
+    , parameters({std::move(lon1), std::move(lat1), std::move(lon2), std::move(lat2)})
+{
+}
+
+bool HaversineDistanceLogicalFunction::operator==(const LogicalFunctionConcept& rhs) const
+{
+    if (const auto* other = dynamic_cast<const HaversineDistanceLogicalFunction*>(&rhs))
+    {
+        return parameters == other->parameters;
+    }
+    return false;
+}
+
+std::string HaversineDistanceLogicalFunction::explain(ExplainVerbosity verbosity) const
+{
+    std::vector<std::string> explainedParameters;
+    for (const auto& parameter : parameters)
+    {
+        explainedParameters.emplace_back(parameter.explain(verbosity));
+    }
+    if (verbosity == ExplainVerbosity::Debug)
+    {
+        return fmt::format("HaversineDistanceLogicalFunction({} : {})", fmt::join(explainedParameters, ", "), dataType);
+    }
+    return fmt::format("HAVERSINE_DISTANCE({})", fmt::join(explainedParameters, ", "));
+}
+
+DataType HaversineDistanceLogicalFunction::getDataType() const
+{
+    return dataType;
+};
+
+LogicalFunction HaversineDistanceLogicalFunction::withDataType(const DataType& dataType) const
+{
+    auto copy = *this;
+    copy.dataType = dataType;
+    return copy;
+};
+
+LogicalFunction HaversineDistanceLogicalFunction::withInferredDataType(const Schema& schema) const
+{
+    /// The physical function computes on doubles, thus we cast all other numeric coordinates once in the logical plan
+    std::vector<LogicalFunction> newChildren;
+    for (const auto& child : getChildren())
+    {
+        auto newChild = child.withInferredDataType(schema);
+        if (not newChild.getDataType().isNumeric())
+        {
+            throw CannotInferSchema("HAVERSINE_DISTANCE requires numeric coordinates, but got: {}", newChild.getDataType());
+        }
+        if (newChild.getDataType().type != DataType::Type::FLOAT64)
+        {
+            newChild = CastToTypeLogicalFunction(DataTypeProvider::provideDataType(DataType::Type::FLOAT64), newChild);
+        }
+        newChildren.push_back(newChild);
+    }
+    return withChildren(newChildren);
+};
+
+std::vector<LogicalFunction> HaversineDistanceLogicalFunction::getChildren() const
+{
+    return parameters;
+};
+
+LogicalFunction HaversineDistanceLogicalFunction::withChildren(const std::vector<LogicalFunction>& children) const
+{
+    PRECONDITION(children.size() == 4, "HaversineDistanceLogicalFunction requires exactly four children, but got {}", children.size());
+    auto copy = *this;
+    copy.parameters = children;
+    return copy;
+};
+
+std::string_view HaversineDistanceLogicalFunction::getType() const
+{
+    return NAME;
+}
+
+SerializableFunction HaversineDistanceLogicalFunction::serialize() const
+{
+    SerializableFunction serializedFunction;
+    serializedFunction.set_function_type(NAME);
+    for (const auto& parameter : parameters)
+    {
+        serializedFunction.add_children()->CopyFrom(parameter.serialize());
+    }
+    DataTypeSerializationUtil::serializeDataType(this->getDataType(), serializedFunction.mutable_data_type());
+    return serializedFunction;
+}
+
+LogicalFunctionRegistryReturnType
+LogicalFunctionGeneratedRegistrar::RegisterHaversineDistanceLogicalFunction(LogicalFunctionRegistryArguments arguments)
+{
+    if (arguments.children.size() != 4)
+    {
+        throw CannotDeserialize("HaversineDistanceLogicalFunction requires exactly four children, but got {}", arguments.children.size());
+    }
+    return HaversineDistanceLogicalFunction(arguments.children[0], arguments.children[1], arguments.children[2], arguments.children[3]);
+}
+
+}
@@ -0,0 +1,141 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+
+#include <Functions/Spatial/PointInBBoxLogicalFunction.hpp>
+
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/DataTypeProvider.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Functions/CastToTypeLogicalFunction.hpp>
+#include <Functions/LogicalFunction.hpp>
+#include <Serialization/DataTypeSerializationUtil.hpp>
+#include <Util/PlanRenderer.hpp>
+#include <fmt/format.h>
+#include <fmt/ranges.h>
+#include <ErrorHandling.hpp>
+#include <LogicalFunctionRegistry.hpp>
+#include <SerializableVariantDescriptor.pb.h>
+
+namespace NES
+{
+
+PointInBBoxLogicalFunction::PointInBBoxLogicalFunction(
+    LogicalFunction lon, LogicalFunction lat, LogicalFunction xmin, LogicalFunction ymin, LogicalFunction xmax, LogicalFunction ymax)
+    : dataType(DataTypeProvider::provideDataType(DataType::Type::BOOLEAN))
+    , parameters({std::move(lon), std::move(lat), std::move(xmin), std::move(ymin), std::move(xmax), std::move(ymax)})
+{
+}
+
+bool PointInBBoxLogicalFunction::operator==(const LogicalFunctionConcept& rhs) const
+{
+    if (const auto* other = dynamic_cast<const PointInBBoxLogicalFunction*>(&rhs))
+    {
+        return parameters == other->parameters;
+    }
+    return false;
+}
+
+std::string PointInBBoxLogicalFunction::explain(ExplainVerbosity verbosity) const
+{
+    std::vector<std::string> explainedParameters;
+    for (const auto& parameter : parameters)
+    {
+        explainedParameters.emplace_back(parameter.explain(verbosity));
+    }
+    if (verbosity == ExplainVerbosity::Debug)
+    {
+        return fmt::format("PointInBBoxLogicalFunction({} : {})", fmt::join(explainedParameters, ", "), dataType);
+    }
+    return fmt::format("POINT_IN_BBOX({})", fmt::join(explainedParameters, ", "));
+}
+
+DataType PointInBBoxLogicalFunction::getDataType() const
+{
+    return dataType;
+};
+
+LogicalFunction PointInBBoxLogicalFunction::withDataType(const DataType& dataType) const
+{
+    auto copy = *this;
+    copy.dataType = dataType;
+    return copy;
+};
+
+LogicalFunction PointInBBoxLogicalFunction::withInferredDataType(const Schema& schema) const
+{
+    /// The physical function compares doubles, thus we cast all other numeric coordinates once in the logical plan
+    std::vector<LogicalFunction> newChildren;
+    for (const auto& child : getChildren())
+    {
+        auto newChild = child.withInferredDataType(schema);
+        if (not newChild.getDataType().isNumeric())
+        {
+            throw CannotInferSchema("POINT_IN_BBOX requires numeric coordinates, but got: {}", newChild.getDataType());
+        }
+        if (newChild.getDataType().type != DataType::Type::FLOAT64)
+        {
+            newChild = CastToTypeLogicalFunction(DataTypeProvider::provideDataType(DataType::Type::FLOAT64), newChild);
+        }
+        newChildren.push_back(newChild);
+    }
+    return withChildren(newChildren);
+};
+
+std::vector<LogicalFunction> PointInBBoxLogicalFunction::getChildren() const
+{
+    return parameters;
+};
+
+LogicalFunction PointInBBoxLogicalFunction::withChildren(const std::vector<LogicalFunction>& children) const
+{
+    PRECONDITION(children.size() == 6, "PointInBBoxLogicalFunction requires exactly six children, but got {}", children.size());
+    auto copy = *this;
+    copy.parameters = children;
+    return copy;
+};
+
+std::string_view PointInBBoxLogicalFunction::getType() const
+{
+    return NAME;
+}
+
+SerializableFunction PointInBBoxLogicalFunction::serialize() const
+{
+    SerializableFunction serializedFunction;
+    serializedFunction.set_function_type(NAME);
+    for (const auto& parameter : parameters)
+    {
+        serializedFunction.add_children()->CopyFrom(parameter.serialize());
+    }
+    DataTypeSerializationUtil::serializeDataType(this->getDataType(), serializedFunction.mutable_data_type());
+    return serializedFunction;
+}
+
+LogicalFunctionRegistryReturnType
+LogicalFunctionGeneratedRegistrar::RegisterPointInBBoxLogicalFunction(LogicalFunctionRegistryArguments arguments)
+{
+    if (arguments.children.size() != 6)
+    {
+        throw CannotDeserialize("PointInBBoxLogicalFunction requires exactly six children, but got {}", arguments.children.size());
+    }
+    return PointInBBoxLogicalFunction(
+        arguments.children[0], arguments.children[1], arguments.children[2], arguments.children[3], arguments.children[4], arguments.children[5]);
+}
+
+}
@@ -0,0 +1,206 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Operators/EventTimeSortLogicalOperator.hpp>
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+#include <Configurations/Descriptor.hpp>
+#include <DataTypes/Schema.hpp>
+#include <DataTypes/TimeUnit.hpp>
+#include <Functions/FieldAccessLogicalFunction.hpp>
+#include <Functions/LogicalFunction.hpp>
+#include <Identifiers/Identifiers.hpp>
+#include <Operators/LogicalOperator.hpp>
+#include <Serialization/FunctionSerializationUtil.hpp>
+#include <Serialization/SchemaSerializationUtil.hpp>
+#include <Traits/Trait.hpp>
+#include <Traits/TraitSet.hpp>
+#include <Util/PlanRenderer.hpp>
+#include <fmt/format.h>
+#include <ErrorHandling.hpp>
+#include <LogicalOperatorRegistry.hpp>
+#include <SerializableOperator.pb.h>
+#include <SerializableVariantDescriptor.pb.h>
+
+namespace NES
+{
+
+EventTimeSortLogicalOperator::EventTimeSortLogicalOperator(
+    LogicalFunction onField, const Windowing::TimeUnit& unit, const uint64_t reorderIntervalMs)
+    : onField(std::move(onField)), unit(unit), reorderIntervalMs(reorderIntervalMs)
+{
+    PRECONDITION(reorderIntervalMs > 0, "The reorder interval of an event time sort must be greater than 0");
+}
+
+std::string_view EventTimeSortLogicalOperator::getName() const noexcept
+{
+    return NAME;
+}
+
+LogicalFunction EventTimeSortLogicalOperator::getOnField() const
+{
+    return onField;
+}
+
+Windowing::TimeUnit EventTimeSortLogicalOperator::getUnit() const
+{
+    return unit;
+}
+
+uint64_t EventTimeSortLogicalOperator::getReorderIntervalMs() const
+{
+    return reorderIntervalMs;
+}
+
+std::string EventTimeSortLogicalOperator::explain(ExplainVerbosity verbosity, OperatorId id) const
+{
+    if (verbosity == ExplainVerbosity::Debug)
+    {
+        return fmt::format(
+            "EVENT_TIME_SORT(opId: {}, onField: {}, unit: {}, reorderIntervalMs: {}, inputSchema: {}, traitSet: {})",
+            id,
+            onField.explain(verbosity),
+            unit.getMillisecondsConversionMultiplier(),
+            reorderIntervalMs,
+            inputSchema,
+            traitSet.explain(verbosity));
+    }
+    return fmt::format("EVENT_TIME_SORT({}, {}ms)", onField.explain(verbosity), reorderIntervalMs);
+}
+
+bool EventTimeSortLogicalOperator::operator==(const EventTimeSortLogicalOperator& rhs) const
+{
+    return onField == rhs.onField and unit == rhs.unit and reorderIntervalMs == rhs.reorderIntervalMs
+        and getOutputSchema() == rhs.getOutputSchema() and getInputSchemas() == rhs.getInputSchemas()
+        and getTraitSet() == rhs.getTraitSet();
+}
+
+EventTimeSortLogicalOperator EventTimeSortLogicalOperator::withInferredSchema(std::vector<Schema> inputSchemas) const
+{
+    if (inputSchemas.size() != 1)
+    {
+        throw CannotInferSchema("An event time sort expects exactly one input, but got {}", inputSchemas.size());
+    }
+
+    auto copy = *this;
+    copy.onField = onField.withInferredDataType(inputSchemas[0]);
+    /// The probe reads solely the timestamp field of all records before it sorts them, thus the timestamp has to be a field
+    if (not copy.onField.tryGet<FieldAccessLogicalFunction>().has_value() or not copy.onField.getDataType().isInteger())
+    {
+        throw CannotInferSchema(
+            "An event time sort expects an integer field as its timestamp, but got {}", onField.explain(ExplainVerbosity::Short));
+    }
+    copy.inputSchema = inputSchemas[0];
+    copy.outputSchema = inputSchemas[0];
+    return copy;
+}
+
+TraitSet EventTimeSortLogicalOperator::getTraitSet() const
+{
+    return traitSet;
+}
+
+EventTimeSortLogicalOperator EventTimeSortLogicalOperator::withTraitSet(TraitSet traitSet) const
+{
+    auto copy = *this;
+    copy.traitSet = std::move(traitSet);
+    return copy;
+}
+
+EventTimeSortLogicalOperator EventTimeSortLogicalOperator::withChildren(std::vector<LogicalOperator> children) const
+{
+    auto copy = *this;
+    copy.children = std::move(children);
+    return copy;
+}
+
+std::vector<Schema> EventTimeSortLogicalOperator::getInputSchemas() const
+{
+    return {inputSchema};
+};
+
+Schema EventTimeSortLogicalOperator::getOutputSchema() const
+{
+    return outputSchema;
+}
+
+std::vector<LogicalOperator> EventTimeSortLogicalOperator::getChildren() const
+{
+    return children;
+}
+
+void EventTimeSortLogicalOperator::serialize(SerializableOperator& serializableOperator) const
+{
+    SerializableLogicalOperator proto;
+
+    proto.set_operator_type(NAME);
+
+    for (const auto& input : getInputSchemas())
+    {
+        auto* schProto = proto.add_input_schemas();
+        SchemaSerializationUtil::serializeSchema(input, schProto);
+    }
+
+    auto* outSch = proto.mutable_output_schema();
+    SchemaSerializationUtil::serializeSchema(outputSchema, outSch);
+
+    for (auto& child : getChildren())
+    {
+        serializableOperator.add_children_ids(child.getId().getRawValue());
+    }
+
+    FunctionList funcList;
+    *funcList.add_functions() = onField.serialize();
+    (*serializableOperator.mutable_config())[ConfigParameters::FUNCTION] = descriptorConfigTypeToProto(funcList);
+    (*serializableOperator.mutable_config())[ConfigParameters::TIME_MS]
+        = descriptorConfigTypeToProto(unit.getMillisecondsConversionMultiplier());
+    (*serializableOperator.mutable_config())[ConfigParameters::REORDER_INTERVAL_MS] = descriptorConfigTypeToProto(reorderIntervalMs);
+
+    serializableOperator.mutable_operator_()->CopyFrom(proto);
+}
+
+LogicalOperatorRegistryReturnType
+LogicalOperatorGeneratedRegistrar::RegisterEventTimeSortLogicalOperator(LogicalOperatorRegistryArguments arguments)
+{
+    const auto functionVariant = arguments.config.at(EventTimeSortLogicalOperator::ConfigParameters::FUNCTION);
+    const auto timeVariant = arguments.config.at(EventTimeSortLogicalOperator::ConfigParameters::TIME_MS);
+    const auto reorderIntervalVariant = arguments.config.at(EventTimeSortLogicalOperator::ConfigParameters::REORDER_INTERVAL_MS);
+    if (not std::holds_alternative<FunctionList>(functionVariant) or not std::holds_alternative<uint64_t>(timeVariant)
+        or not std::holds_alternative<uint64_t>(reorderIntervalVariant))
+    {
+        throw UnknownLogicalOperator();
+    }
+
+    const auto functions = std::get<FunctionList>(functionVariant).functions();
+    if (functions.size() != 1)
+    {
+        throw CannotDeserialize("Expected exactly one function but got {}", functions.size());
+    }
+    if (std::get<uint64_t>(reorderIntervalVariant) == 0)
+    {
+        throw CannotDeserialize("The reorder interval of an event time sort must be greater than 0");
+    }
+
+    auto logicalOperator = EventTimeSortLogicalOperator(
+        FunctionSerializationUtil::deserializeFunction(functions[0]),
+        Windowing::TimeUnit(std::get<uint64_t>(timeVariant)),
+        std::get<uint64_t>(reorderIntervalVariant));
+    return logicalOperator.withInferredSchema(arguments.inputSchemas);
+}
+}
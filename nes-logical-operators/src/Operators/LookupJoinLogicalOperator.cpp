@@ -0,0 +1,324 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Operators/LookupJoinLogicalOperator.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <Configurations/Descriptor.hpp>
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Functions/BooleanFunctions/EqualsLogicalFunction.hpp>
+#include <Functions/FieldAccessLogicalFunction.hpp>
+#include <Functions/LogicalFunction.hpp>
+#include <Identifiers/Identifiers.hpp>
+#include <Operators/LogicalOperator.hpp>
+#include <Serialization/FunctionSerializationUtil.hpp>
+#include <Serialization/SchemaSerializationUtil.hpp>
+#include <Traits/Trait.hpp>
+#include <Traits/TraitSet.hpp>
+#include <Util/PlanRenderer.hpp>
+#include <ErrorHandling.hpp>
+#include <LogicalOperatorRegistry.hpp>
+#include <SerializableOperator.pb.h>
+#include <SerializableVariantDescriptor.pb.h>
+
+namespace NES
+{
+
+LookupJoinLogicalOperator::LookupJoinLogicalOperator(
+    std::string tableFilePath, Schema tableSchema, LogicalFunction joinFunction, const uint64_t reloadIntervalMs)
+    : tableFilePath(std::move(tableFilePath))
+    , tableSchema(std::move(tableSchema))
+    , joinFunction(std::move(joinFunction))
+    , reloadIntervalMs(reloadIntervalMs)
+{
+}
+
+LookupJoinLogicalOperator::LookupJoinLogicalOperator(ExternalTable externalTable, Schema tableSchema, LogicalFunction joinFunction)
+    : tableSchema(std::move(tableSchema))
+    , joinFunction(std::move(joinFunction))
+    , reloadIntervalMs(0)
+    , externalTable(std::move(externalTable))
+{
+}
+
+std::string_view LookupJoinLogicalOperator::getName() const noexcept
+{
+    return NAME;
+}
+
+const std::string& LookupJoinLogicalOperator::getTableFilePath() const
+{
+    return tableFilePath;
+}
+
+const Schema& LookupJoinLogicalOperator::getTableSchema() const
+{
+    return tableSchema;
+}
+
+LogicalFunction LookupJoinLogicalOperator::getJoinFunction() const
+{
+    return joinFunction;
+}
+
+const std::optional<LookupJoinLogicalOperator::ExternalTable>& LookupJoinLogicalOperator::getExternalTable() const
+{
+    return externalTable;
+}
+
+uint64_t LookupJoinLogicalOperator::getReloadIntervalMs() const
+{
+    return reloadIntervalMs;
+}
+
+LogicalFunction LookupJoinLogicalOperator::getStreamKey() const
+{
+    INVARIANT(streamKey.has_value(), "The stream key of a lookup join is known after inferring its schema");
+    return streamKey.value();
+}
+
+const Schema::Field& LookupJoinLogicalOperator::getTableKey() const
+{
+    INVARIANT(tableKey.has_value(), "The table key of a lookup join is known after inferring its schema");
+    return tableKey.value();
+}
+
+bool LookupJoinLogicalOperator::operator==(const LookupJoinLogicalOperator& rhs) const
+{
+    return tableFilePath == rhs.tableFilePath and tableSchema == rhs.tableSchema and joinFunction == rhs.joinFunction
+        and reloadIntervalMs == rhs.reloadIntervalMs and externalTable == rhs.externalTable and getOutputSchema() == rhs.getOutputSchema()
+        and getInputSchemas() == rhs.getInputSchemas() and getTraitSet() == rhs.getTraitSet();
+}
+
+std::string LookupJoinLogicalOperator::explain(ExplainVerbosity verbosity, OperatorId opId) const
+{
+    if (externalTable.has_value())
+    {
+        if (verbosity == ExplainVerbosity::Debug)
+        {
+            return fmt::format(
+                "LookupJoin(opId: {}, url: {}, joinFunction: {}, cacheSize: {}, maxInFlight: {}, traitSet: {})",
+                opId,
+                externalTable->url,
+                joinFunction.explain(verbosity),
+                externalTable->cacheSize,
+                externalTable->maxInFlight,
+                traitSet.explain(verbosity));
+        }
+        return fmt::format("LookupJoin({}, {})", externalTable->url, joinFunction.explain(verbosity));
+    }
+    if (verbosity == ExplainVerbosity::Debug)
+    {
+        return fmt::format(
+            "LookupJoin(opId: {}, table: {}, joinFunction: {}, reloadIntervalMs: {}, traitSet: {})",
+            opId,
+            tableFilePath,
+            joinFunction.explain(verbosity),
+            reloadIntervalMs,
+            traitSet.explain(verbosity));
+    }
+    return fmt::format("LookupJoin({}, {})", tableFilePath, joinFunction.explain(verbosity));
+}
+
+LookupJoinLogicalOperator LookupJoinLogicalOperator::withInferredSchema(std::vector<Schema> inputSchemas) const
+{
+    if (inputSchemas.size() != 1)
+    {
+        throw CannotInferSchema("A lookup join expects exactly one input, but got {}", inputSchemas.size());
+    }
+
+    const auto joinFields = joinFunction.getChildren();
+    if (not joinFunction.tryGet<EqualsLogicalFunction>()
+        or not std::ranges::all_of(
+            joinFields, [](const LogicalFunction& joinField) { return joinField.tryGet<FieldAccessLogicalFunction>().has_value(); }))
+    {
+        throw CannotInferSchema("A lookup join expects the equality of two fields, but got {}", joinFunction.explain(ExplainVerbosity::Short));
+    }
+
+    /// The key of the table is the field that belongs to the table, the other one belongs to the input
+    auto copy = *this;
+    copy.streamKey.reset();
+    copy.tableKey.reset();
+    for (const auto& joinField : joinFields)
+    {
+        const auto fieldName = joinField.get<FieldAccessLogicalFunction>().getFieldName();
+        if (const auto tableField = tableSchema.getFieldByName(fieldName); tableField.has_value() and not copy.tableKey.has_value())
+        {
+            copy.tableKey = tableField;
+        }
+        else
+        {
+            copy.streamKey = joinField.withInferredDataType(inputSchemas[0]);
+        }
+    }
+    if (not copy.tableKey.has_value() or not copy.streamKey.has_value())
+    {
+        throw CannotInferSchema(
+            "A lookup join expects a field of its input and a field of the table {} in {}",
+            externalTable.has_value() ? externalTable->url : tableFilePath,
+            joinFunction.explain(ExplainVerbosity::Short));
+    }
+
+    /// Numeric keys of the input are cast to the type of the table key
+    const auto& streamKeyType = copy.streamKey->getDataType();
+    const auto& tableKeyType = copy.tableKey->dataType;
+    if (streamKeyType != tableKeyType and not(streamKeyType.isNumeric() and tableKeyType.isNumeric()))
+    {
+        throw CannotInferSchema("The keys of a lookup join must have compatible types, but got {} and {}", streamKeyType, tableKeyType);
+    }
+
+    copy.inputSchema = inputSchemas[0];
+    copy.outputSchema = inputSchemas[0];
+    copy.outputSchema.appendFieldsFromOtherSchema(tableSchema);
+    return copy;
+}
+
+TraitSet LookupJoinLogicalOperator::getTraitSet() const
+{
+    return traitSet;
+}
+
+LookupJoinLogicalOperator LookupJoinLogicalOperator::withTraitSet(TraitSet traitSet) const
+{
+    auto copy = *this;
+    copy.traitSet = std::move(traitSet);
+    return copy;
+}
+
+LookupJoinLogicalOperator LookupJoinLogicalOperator::withChildren(std::vector<LogicalOperator> children) const
+{
+    auto copy = *this;
+    copy.children = std::move(children);
+    return copy;
+}
+
+std::vector<Schema> LookupJoinLogicalOperator::getInputSchemas() const
+{
+    return {inputSchema};
+};
+
+Schema LookupJoinLogicalOperator::getOutputSchema() const
+{
+    return outputSchema;
+}
+
+std::vector<LogicalOperator> LookupJoinLogicalOperator::getChildren() const
+{
+    return children;
+}
+
+void LookupJoinLogicalOperator::serialize(SerializableOperator& serializableOperator) const
+{
+    SerializableLogicalOperator proto;
+
+    proto.set_operator_type(NAME);
+
+    for (const auto& input : getInputSchemas())
+    {
+        auto* schProto = proto.add_input_schemas();
+        SchemaSerializationUtil::serializeSchema(input, schProto);
+    }
+
+    /// The output schema ends with the fields of the table, which is how the deserialization restores the table schema
+    auto* outSch = proto.mutable_output_schema();
+    SchemaSerializationUtil::serializeSchema(outputSchema, outSch);
+
+    for (auto& child : getChildren())
+    {
+        serializableOperator.add_children_ids(child.getId().getRawValue());
+    }
+
+    FunctionList funcList;
+    auto* serializedFunction = funcList.add_functions();
+    serializedFunction->CopyFrom(joinFunction.serialize());
+    (*serializableOperator.mutable_config())[ConfigParameters::JOIN_FUNCTION] = descriptorConfigTypeToProto(funcList);
+    (*serializableOperator.mutable_config())[ConfigParameters::TABLE_FILE_PATH] = descriptorConfigTypeToProto(tableFilePath);
+    (*serializableOperator.mutable_config())[ConfigParameters::RELOAD_INTERVAL_MS] = descriptorConfigTypeToProto(reloadIntervalMs);
+    if (externalTable.has_value())
+    {
+        (*serializableOperator.mutable_config())[ConfigParameters::TABLE_URL] = descriptorConfigTypeToProto(externalTable->url);
+        (*serializableOperator.mutable_config())[ConfigParameters::CACHE_SIZE] = descriptorConfigTypeToProto(externalTable->cacheSize);
+        (*serializableOperator.mutable_config())[ConfigParameters::MAX_IN_FLIGHT] = descriptorConfigTypeToProto(externalTable->maxInFlight);
+    }
+
+    serializableOperator.mutable_operator_()->CopyFrom(proto);
+}
+
+LogicalOperatorRegistryReturnType
+LogicalOperatorGeneratedRegistrar::RegisterLookupJoinLogicalOperator(LogicalOperatorRegistryArguments arguments)
+{
+    if (arguments.inputSchemas.size() != 1)
+    {
+        throw CannotDeserialize("Expected exactly one input schema, but got {}", arguments.inputSchemas.size());
+    }
+
+    const auto functionVariant = arguments.config.at(LookupJoinLogicalOperator::ConfigParameters::JOIN_FUNCTION);
+    const auto filePathVariant = arguments.config.at(LookupJoinLogicalOperator::ConfigParameters::TABLE_FILE_PATH);
+    const auto reloadIntervalVariant = arguments.config.at(LookupJoinLogicalOperator::ConfigParameters::RELOAD_INTERVAL_MS);
+    if (not std::holds_alternative<FunctionList>(functionVariant) or not std::holds_alternative<std::string>(filePathVariant)
+        or not std::holds_alternative<uint64_t>(reloadIntervalVariant))
+    {
+        throw UnknownLogicalOperator();
+    }
+
+    const auto functions = std::get<FunctionList>(functionVariant).functions();
+    if (functions.size() != 1)
+    {
+        throw CannotDeserialize("Expected exactly one function but got {}", functions.size());
+    }
+
+    const auto numberOfInputFields = arguments.inputSchemas[0].getNumberOfFields();
+    Schema tableSchema{arguments.outputSchema.memoryLayoutType};
+    for (const auto& field : arguments.outputSchema.getFields() | std::views::drop(numberOfInputFields))
+    {
+        tableSchema.addField(field.name, field.dataType);
+    }
+
+    auto joinFunction = FunctionSerializationUtil::deserializeFunction(functions[0]);
+    if (const auto urlVariant = arguments.config.find(LookupJoinLogicalOperator::ConfigParameters::TABLE_URL);
+        urlVariant != arguments.config.end())
+    {
+        const auto cacheSizeVariant = arguments.config.at(LookupJoinLogicalOperator::ConfigParameters::CACHE_SIZE);
+        const auto maxInFlightVariant = arguments.config.at(LookupJoinLogicalOperator::ConfigParameters::MAX_IN_FLIGHT);
+        if (not std::holds_alternative<std::string>(urlVariant->second) or not std::holds_alternative<uint64_t>(cacheSizeVariant)
+            or not std::holds_alternative<uint64_t>(maxInFlightVariant))
+        {
+            throw UnknownLogicalOperator();
+        }
+        auto logicalOperator = LookupJoinLogicalOperator(
+            {.url = std::get<std::string>(urlVariant->second),
+             .cacheSize = std::get<uint64_t>(cacheSizeVariant),
+             .maxInFlight = std::get<uint64_t>(maxInFlightVariant)},
+            std::move(tableSchema),
+            std::move(joinFunction));
+        return logicalOperator.withInferredSchema(arguments.inputSchemas);
+    }
+
+    auto logicalOperator = LookupJoinLogicalOperator(
+        std::get<std::string>(filePathVariant), std::move(tableSchema), std::move(joinFunction), std::get<uint64_t>(reloadIntervalVariant));
+    return logicalOperator.withInferredSchema(arguments.inputSchemas);
+}
+}
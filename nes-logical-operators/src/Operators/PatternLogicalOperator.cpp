@@ -0,0 +1,421 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Operators/PatternLogicalOperator.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+#include <Configurations/Descriptor.hpp>
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/Schema.hpp>
+#include <DataTypes/TimeUnit.hpp>
+#include <Functions/FieldAccessLogicalFunction.hpp>
+#include <Functions/LogicalFunction.hpp>
+#include <Identifiers/Identifiers.hpp>
+#include <Operators/LogicalOperator.hpp>
+#include <Serialization/FunctionSerializationUtil.hpp>
+#include <Serialization/SchemaSerializationUtil.hpp>
+#include <Traits/Trait.hpp>
+#include <Traits/TraitSet.hpp>
+#include <Util/PlanRenderer.hpp>
+#include <fmt/format.h>
+#include <fmt/ranges.h>
+#include <ErrorHandling.hpp>
+#include <LogicalOperatorRegistry.hpp>
+#include <SerializableOperator.pb.h>
+#include <SerializableVariantDescriptor.pb.h>
+
+namespace NES
+{
+
+namespace
+{
+std::string explainStep(const PatternLogicalOperator::Step& step, const std::vector<std::string>& eventNames)
+{
+    const auto names = step.events | std::views::transform([&eventNames](const auto event) { return eventNames[event]; });
+    switch (step.type)
+    {
+        case PatternLogicalOperator::Step::Type::EVENT:
+            return eventNames[step.events.front()];
+        case PatternLogicalOperator::Step::Type::AND:
+            return fmt::format("AND({})", fmt::join(names, ", "));
+        case PatternLogicalOperator::Step::Type::OR:
+            return fmt::format("OR({})", fmt::join(names, ", "));
+        case PatternLogicalOperator::Step::Type::ITERATION:
+            if (step.maximumRepetitions.has_value())
+            {
+                return fmt::format("{}[{}, {}]", eventNames[step.events.front()], step.minimumRepetitions, *step.maximumRepetitions);
+            }
+            return fmt::format("{}[{},]", eventNames[step.events.front()], step.minimumRepetitions);
+    }
+    std::unreachable();
+}
+}
+
+PatternLogicalOperator::PatternLogicalOperator(
+    std::vector<std::string> eventNames,
+    std::vector<LogicalFunction> eventPredicates,
+    std::vector<Step> steps,
+    std::vector<FieldAccessLogicalFunction> partitionKeys,
+    LogicalFunction onField,
+    const Windowing::TimeUnit& unit,
+    const uint64_t withinMs)
+    : eventNames(std::move(eventNames))
+    , eventPredicates(std::move(eventPredicates))
+    , steps(std::move(steps))
+    , partitionKeys(std::move(partitionKeys))
+    , onField(std::move(onField))
+    , unit(unit)
+    , withinMs(withinMs)
+{
+    PRECONDITION(this->eventNames.size() == this->eventPredicates.size(), "Every event of a pattern requires a name and a predicate");
+    PRECONDITION(
+        not this->eventPredicates.empty() and this->eventPredicates.size() <= MAX_NUMBER_OF_EVENTS,
+        "A pattern requires between 1 and {} events, but got {}",
+        MAX_NUMBER_OF_EVENTS,
+        this->eventPredicates.size());
+    PRECONDITION(not this->steps.empty(), "A pattern requires at least one step");
+    PRECONDITION(withinMs > 0, "The time span of a pattern must be greater than 0");
+    for (const auto& step : this->steps)
+    {
+        PRECONDITION(
+            std::ranges::all_of(step.events, [this](const auto event) { return event < this->eventPredicates.size(); }),
+            "A step of a pattern refers to an undefined event");
+        const bool isSingleEvent = step.type == Step::Type::EVENT or step.type == Step::Type::ITERATION;
+        PRECONDITION(
+            isSingleEvent ? step.events.size() == 1 : not step.events.empty(), "A step of a pattern has an invalid number of events");
+        PRECONDITION(
+            step.minimumRepetitions > 0 and step.minimumRepetitions <= step.maximumRepetitions.value_or(step.minimumRepetitions),
+            "An iteration of a pattern requires a minimum between 1 and its maximum");
+    }
+}
+
+std::string_view PatternLogicalOperator::getName() const noexcept
+{
+    return NAME;
+}
+
+const std::vector<std::string>& PatternLogicalOperator::getEventNames() const
+{
+    return eventNames;
+}
+
+const std::vector<LogicalFunction>& PatternLogicalOperator::getEventPredicates() const
+{
+    return eventPredicates;
+}
+
+const std::vector<PatternLogicalOperator::Step>& PatternLogicalOperator::getSteps() const
+{
+    return steps;
+}
+
+const std::vector<FieldAccessLogicalFunction>& PatternLogicalOperator::getPartitionKeys() const
+{
+    return partitionKeys;
+}
+
+LogicalFunction PatternLogicalOperator::getOnField() const
+{
+    return onField;
+}
+
+Windowing::TimeUnit PatternLogicalOperator::getUnit() const
+{
+    return unit;
+}
+
+uint64_t PatternLogicalOperator::getWithinMs() const
+{
+    return withinMs;
+}
+
+const std::string& PatternLogicalOperator::getStartFieldName() const
+{
+    return startFieldName;
+}
+
+const std::string& PatternLogicalOperator::getEndFieldName() const
+{
+    return endFieldName;
+}
+
+std::string PatternLogicalOperator::explain(ExplainVerbosity verbosity, OperatorId id) const
+{
+    const auto explainedSteps = steps | std::views::transform([this](const auto& step) { return explainStep(step, eventNames); });
+    const auto explainedKeys = partitionKeys | std::views::transform([](const auto& key) { return key.getFieldName(); });
+    if (verbosity == ExplainVerbosity::Debug)
+    {
+        const auto explainEvent = [this, verbosity](const size_t event)
+        { return fmt::format("{}: {}", eventNames[event], eventPredicates[event].explain(verbosity)); };
+        const auto explainedEvents = std::views::iota(size_t{0}, eventNames.size()) | std::views::transform(explainEvent);
+        return fmt::format(
+            "PATTERN(opId: {}, steps: SEQ({}), events: [{}], partitionKeys: [{}], onField: {}, withinMs: {}, inputSchema: {}, "
+            "traitSet: {})",
+            id,
+            fmt::join(explainedSteps, ", "),
+            fmt::join(explainedEvents, ", "),
+            fmt::join(explainedKeys, ", "),
+            onField.explain(verbosity),
+            withinMs,
+            inputSchema,
+            traitSet.explain(verbosity));
+    }
+    return fmt::format(
+        "PATTERN(SEQ({}) WITHIN {}ms, partitionKeys: [{}])", fmt::join(explainedSteps, ", "), withinMs, fmt::join(explainedKeys, ", "));
+}
+
+bool PatternLogicalOperator::operator==(const PatternLogicalOperator& rhs) const
+{
+    return eventNames == rhs.eventNames and eventPredicates == rhs.eventPredicates and steps == rhs.steps
+        and partitionKeys == rhs.partitionKeys and onField == rhs.onField and unit == rhs.unit and withinMs == rhs.withinMs
+        and getOutputSchema() == rhs.getOutputSchema() and getInputSchemas() == rhs.getInputSchemas()
+        and getTraitSet() == rhs.getTraitSet();
+}
+
+PatternLogicalOperator PatternLogicalOperator::withInferredSchema(std::vector<Schema> inputSchemas) const
+{
+    if (inputSchemas.size() != 1)
+    {
+        throw CannotInferSchema("A pattern expects exactly one input, but got {}", inputSchemas.size());
+    }
+    const auto& inputSchema = inputSchemas[0];
+
+    auto copy = *this;
+    for (auto& predicate : copy.eventPredicates)
+    {
+        predicate = predicate.withInferredDataType(inputSchema);
+        if (not predicate.getDataType().isType(DataType::Type::BOOLEAN))
+        {
+            throw CannotInferSchema("An event of a pattern expects a predicate, but got {}", predicate.explain(ExplainVerbosity::Short));
+        }
+    }
+    copy.onField = onField.withInferredDataType(inputSchema);
+    if (not copy.onField.tryGet<FieldAccessLogicalFunction>().has_value() or not copy.onField.getDataType().isInteger())
+    {
+        throw CannotInferSchema(
+            "A pattern expects an integer field as its timestamp, but got {}", onField.explain(ExplainVerbosity::Short));
+    }
+
+    copy.inputSchema = inputSchema;
+    copy.outputSchema = Schema{inputSchema.memoryLayoutType};
+    const auto& qualifierForSystemFields = inputSchema.getQualifierNameForSystemGeneratedFieldsWithSeparator();
+    copy.startFieldName = qualifierForSystemFields + "START";
+    copy.endFieldName = qualifierForSystemFields + "END";
+    copy.outputSchema.addField(copy.startFieldName, DataType::Type::UINT64);
+    copy.outputSchema.addField(copy.endFieldName, DataType::Type::UINT64);
+    for (auto& key : copy.partitionKeys)
+    {
+        key = key.withInferredDataType(inputSchema).get<FieldAccessLogicalFunction>();
+        copy.outputSchema.addField(key.getFieldName(), key.getDataType());
+    }
+    return copy;
+}
+
+TraitSet PatternLogicalOperator::getTraitSet() const
+{
+    return traitSet;
+}
+
+PatternLogicalOperator PatternLogicalOperator::withTraitSet(TraitSet traitSet) const
+{
+    auto copy = *this;
+    copy.traitSet = std::move(traitSet);
+    return copy;
+}
+
+PatternLogicalOperator PatternLogicalOperator::withChildren(std::vector<LogicalOperator> children) const
+{
+    auto copy = *this;
+    copy.children = std::move(children);
+    return copy;
+}
+
+std::vector<Schema> PatternLogicalOperator::getInputSchemas() const
+{
+    return {inputSchema};
+};
+
+Schema PatternLogicalOperator::getOutputSchema() const
+{
+    return outputSchema;
+}
+
+std::vector<LogicalOperator> PatternLogicalOperator::getChildren() const
+{
+    return children;
+}
+
+void PatternLogicalOperator::serialize(SerializableOperator& serializableOperator) const
+{
+    SerializableLogicalOperator proto;
+
+    proto.set_operator_type(NAME);
+
+    for (const auto& input : getInputSchemas())
+    {
+        auto* schProto = proto.add_input_schemas();
+        SchemaSerializationUtil::serializeSchema(input, schProto);
+    }
+
+    auto* outSch = proto.mutable_output_schema();
+    SchemaSerializationUtil::serializeSchema(outputSchema, outSch);
+
+    for (auto& child : getChildren())
+    {
+        serializableOperator.add_children_ids(child.getId().getRawValue());
+    }
+
+    FunctionList predicateList;
+    for (const auto& predicate : eventPredicates)
+    {
+        *predicateList.add_functions() = predicate.serialize();
+    }
+    UInt64List stepList;
+    for (const auto& step : steps)
+    {
+        stepList.add_values(static_cast<uint64_t>(step.type));
+        stepList.add_values(step.minimumRepetitions);
+        stepList.add_values(step.maximumRepetitions.value_or(0));
+        stepList.add_values(step.events.size());
+        for (const auto event : step.events)
+        {
+            stepList.add_values(event);
+        }
+    }
+    FunctionList keyList;
+    for (const auto& key : partitionKeys)
+    {
+        *keyList.add_functions() = key.serialize();
+    }
+    FunctionList funcList;
+    *funcList.add_functions() = onField.serialize();
+
+    auto& config = *serializableOperator.mutable_config();
+    config[ConfigParameters::EVENT_NAMES] = descriptorConfigTypeToProto(fmt::format("{}", fmt::join(eventNames, ",")));
+    config[ConfigParameters::EVENT_PREDICATES] = descriptorConfigTypeToProto(predicateList);
+    config[ConfigParameters::STEPS] = descriptorConfigTypeToProto(stepList);
+    config[ConfigParameters::PARTITION_KEYS] = descriptorConfigTypeToProto(keyList);
+    config[ConfigParameters::FUNCTION] = descriptorConfigTypeToProto(funcList);
+    config[ConfigParameters::TIME_MS] = descriptorConfigTypeToProto(unit.getMillisecondsConversionMultiplier());
+    config[ConfigParameters::WITHIN_MS] = descriptorConfigTypeToProto(withinMs);
+
+    serializableOperator.mutable_operator_()->CopyFrom(proto);
+}
+
+LogicalOperatorRegistryReturnType
+LogicalOperatorGeneratedRegistrar::RegisterPatternLogicalOperator(LogicalOperatorRegistryArguments arguments)
+{
+    const auto eventNamesVariant = arguments.config.at(PatternLogicalOperator::ConfigParameters::EVENT_NAMES);
+    const auto predicatesVariant = arguments.config.at(PatternLogicalOperator::ConfigParameters::EVENT_PREDICATES);
+    const auto stepsVariant = arguments.config.at(PatternLogicalOperator::ConfigParameters::STEPS);
+    const auto keysVariant = arguments.config.at(PatternLogicalOperator::ConfigParameters::PARTITION_KEYS);
+    const auto functionVariant = arguments.config.at(PatternLogicalOperator::ConfigParameters::FUNCTION);
+    const auto timeVariant = arguments.config.at(PatternLogicalOperator::ConfigParameters::TIME_MS);
+    const auto withinVariant = arguments.config.at(PatternLogicalOperator::ConfigParameters::WITHIN_MS);
+    if (not std::holds_alternative<std::string>(eventNamesVariant) or not std::holds_alternative<FunctionList>(predicatesVariant)
+        or not std::holds_alternative<UInt64List>(stepsVariant) or not std::holds_alternative<FunctionList>(keysVariant)
+        or not std::holds_alternative<FunctionList>(functionVariant) or not std::holds_alternative<uint64_t>(timeVariant)
+        or not std::holds_alternative<uint64_t>(withinVariant))
+    {
+        throw UnknownLogicalOperator();
+    }
+
+    std::vector<LogicalFunction> eventPredicates;
+    for (const auto& predicate : std::get<FunctionList>(predicatesVariant).functions())
+    {
+        eventPredicates.push_back(FunctionSerializationUtil::deserializeFunction(predicate));
+    }
+    auto eventNames = std::get<std::string>(eventNamesVariant) | std::views::split(',')
+        | std::views::transform([](const auto& name) { return std::string(name.begin(), name.end()); });
+    std::vector<std::string> names(eventNames.begin(), eventNames.end());
+    if (names.size() != eventPredicates.size() or eventPredicates.empty()
+        or eventPredicates.size() > PatternLogicalOperator::MAX_NUMBER_OF_EVENTS)
+    {
+        throw CannotDeserialize("Expected between 1 and {} named events", PatternLogicalOperator::MAX_NUMBER_OF_EVENTS);
+    }
+
+    const auto& serializedSteps = std::get<UInt64List>(stepsVariant).values();
+    std::vector<PatternLogicalOperator::Step> steps;
+    for (int position = 0; position < serializedSteps.size();)
+    {
+        if (serializedSteps.size() - position < 4
+            or serializedSteps[position] > static_cast<uint64_t>(PatternLogicalOperator::Step::Type::ITERATION))
+        {
+            throw CannotDeserialize("Malformed step of a pattern at position {}", position);
+        }
+        PatternLogicalOperator::Step step;
+        step.type = static_cast<PatternLogicalOperator::Step::Type>(serializedSteps[position]);
+        step.minimumRepetitions = serializedSteps[position + 1];
+        step.maximumRepetitions = serializedSteps[position + 2] == 0 ? std::nullopt : std::optional(serializedSteps[position + 2]);
+        const auto numberOfEvents = serializedSteps[position + 3];
+        position += 4;
+        if (static_cast<uint64_t>(serializedSteps.size() - position) < numberOfEvents)
+        {
+            throw CannotDeserialize("Malformed step of a pattern at position {}", position);
+        }
+        for (uint64_t event = 0; event < numberOfEvents; ++event)
+        {
+            if (serializedSteps[position] >= eventPredicates.size())
+            {
+                throw CannotDeserialize("A step of a pattern refers to the undefined event {}", serializedSteps[position]);
+            }
+            step.events.push_back(serializedSteps[position++]);
+        }
+        steps.push_back(std::move(step));
+    }
+
+    std::vector<FieldAccessLogicalFunction> partitionKeys;
+    for (const auto& key : std::get<FunctionList>(keysVariant).functions())
+    {
+        auto function = FunctionSerializationUtil::deserializeFunction(key);
+        if (auto fieldAccess = function.tryGet<FieldAccessLogicalFunction>())
+        {
+            partitionKeys.push_back(fieldAccess.value());
+        }
+        else
+        {
+            throw UnknownLogicalOperator();
+        }
+    }
+
+    const auto functions = std::get<FunctionList>(functionVariant).functions();
+    if (functions.size() != 1)
+    {
+        throw CannotDeserialize("Expected exactly one function but got {}", functions.size());
+    }
+    if (std::get<uint64_t>(withinVariant) == 0)
+    {
+        throw CannotDeserialize("The time span of a pattern must be greater than 0");
+    }
+
+    auto logicalOperator = PatternLogicalOperator(
+        std::move(names),
+        std::move(eventPredicates),
+        std::move(steps),
+        std::move(partitionKeys),
+        FunctionSerializationUtil::deserializeFunction(functions[0]),
+        Windowing::TimeUnit(std::get<uint64_t>(timeVariant)),
+        std::get<uint64_t>(withinVariant));
+    return logicalOperator.withInferredSchema(arguments.inputSchemas);
+}
+}
@@ -14,6 +14,8 @@
 
 #include <Operators/Sources/SourceDescriptorLogicalOperator.hpp>
 
+#include <algorithm>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -39,6 +41,33 @@ SourceDescriptorLogicalOperator::SourceDescriptorLogicalOperator(SourceDescripto
 {
 }
 
+SourceDescriptorLogicalOperator SourceDescriptorLogicalOperator::withProjectedFields(const std::vector<std::string>& fieldNames) const
+{
+    const auto& logicalSourceSchema = *sourceDescriptor.getLogicalSource().getSchema();
+    Schema schema{logicalSourceSchema.memoryLayoutType};
+    for (const auto& field : logicalSourceSchema.getFields())
+    {
+        if (std::ranges::contains(fieldNames, field.name))
+        {
+            schema.addField(field.name, field.dataType);
+        }
+    }
+    PRECONDITION(
+        schema.getNumberOfFields() == fieldNames.size(),
+        "The projected fields {} must be distinct fields of the logical source {}",
+        fmt::join(fieldNames, ", "),
+        logicalSourceSchema);
+
+    auto copy = *this;
+    copy.projectedSchema = std::move(schema);
+    return copy;
+}
+
+bool SourceDescriptorLogicalOperator::isProjected() const
+{
+    return projectedSchema.has_value();
+}
+
 std::string_view SourceDescriptorLogicalOperator::getName() const noexcept
 {
     return NAME;
@@ -61,6 +90,15 @@ std::string SourceDescriptorLogicalOperator::explain(ExplainVerbosity verbosity,
 {
     if (verbosity == ExplainVerbosity::Debug)
     {
+        if (projectedSchema)
+        {
+            return fmt::format(
+                "SOURCE(opId: {}, {}, projectedFields: {}, traitSet: {})",
+                id,
+                sourceDescriptor.explain(verbosity),
+                fmt::join(projectedSchema->getFieldNames(), ", "),
+                traitSet.explain(verbosity));
+        }
         return fmt::format("SOURCE(opId: {}, {}, traitSet: {})", id, sourceDescriptor.explain(verbosity), traitSet.explain(verbosity));
     }
     return fmt::format("SOURCE({})", sourceDescriptor.explain(verbosity));
@@ -92,7 +130,7 @@ std::vector<Schema> SourceDescriptorLogicalOperator::getInputSchemas() const
 
 Schema SourceDescriptorLogicalOperator::getOutputSchema() const
 {
-    return {*sourceDescriptor.getLogicalSource().getSchema()};
+    return projectedSchema.value_or(*sourceDescriptor.getLogicalSource().getSchema());
 }
 
 std::vector<LogicalOperator> SourceDescriptorLogicalOperator::getChildren() const
@@ -109,6 +147,13 @@ void SourceDescriptorLogicalOperator::serialize(SerializableOperator& serializab
 {
     SerializableSourceDescriptorLogicalOperator proto;
     proto.mutable_sourcedescriptor()->CopyFrom(sourceDescriptor.serialize());
+    if (projectedSchema)
+    {
+        for (const auto& fieldName : projectedSchema->getFieldNames())
+        {
+            proto.add_projectedfields(fieldName);
+        }
+    }
 
     serializableOperator.mutable_source()->CopyFrom(proto);
 }
@@ -0,0 +1,124 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Operators/Windows/Aggregations/ApproxQuantileAggregationLogicalFunction.hpp>
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <DataTypes/DataTypeProvider.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Functions/FieldAccessLogicalFunction.hpp>
+#include <Functions/LogicalFunction.hpp>
+#include <Operators/Windows/Aggregations/WindowAggregationLogicalFunction.hpp>
+#include <AggregationLogicalFunctionRegistry.hpp>
+#include <ErrorHandling.hpp>
+#include <SerializableVariantDescriptor.pb.h>
+
+namespace NES
+{
+ApproxQuantileAggregationLogicalFunction::ApproxQuantileAggregationLogicalFunction(
+    const FieldAccessLogicalFunction& field, const double quantile)
+    : ApproxQuantileAggregationLogicalFunction(field, field, quantile)
+{
+}
+
+ApproxQuantileAggregationLogicalFunction::ApproxQuantileAggregationLogicalFunction(
+    const FieldAccessLogicalFunction& field, FieldAccessLogicalFunction asField, const double quantile)
+    : WindowAggregationLogicalFunction(
+          field.getDataType(),
+          DataTypeProvider::provideDataType(partialAggregateStampType),
+          DataTypeProvider::provideDataType(finalAggregateStampType),
+          field,
+          std::move(asField))
+    , quantile(quantile)
+{
+    if (not(0 <= quantile and quantile <= 1))
+    {
+        throw InvalidQuerySyntax("The quantile of APPROX_QUANTILE must be in [0, 1], but got {}", quantile);
+    }
+}
+
+std::string_view ApproxQuantileAggregationLogicalFunction::getName() const noexcept
+{
+    return NAME;
+}
+
+double ApproxQuantileAggregationLogicalFunction::getQuantile() const
+{
+    return quantile;
+}
+
+void ApproxQuantileAggregationLogicalFunction::inferStamp(const Schema& schema)
+{
+    /// We first infer the dataType of the input field and set the output dataType as the same.
+    onField = onField.withInferredDataType(schema).get<FieldAccessLogicalFunction>();
+    if (not onField.getDataType().isNumeric())
+    {
+        throw CannotDeserialize("aggregations on non numeric fields is not supported, but got {}", onField.getDataType());
+    }
+
+    ///Set fully qualified name for the as Field
+    const auto onFieldName = onField.getFieldName();
+    const auto asFieldName = asField.getFieldName();
+
+    const auto attributeNameResolver = onFieldName.substr(0, onFieldName.find(Schema::ATTRIBUTE_NAME_SEPARATOR) + 1);
+    ///If on and as field name are different then append the attribute name resolver from on field to the as field
+    if (asFieldName.find(Schema::ATTRIBUTE_NAME_SEPARATOR) == std::string::npos)
+    {
+        asField = asField.withFieldName(attributeNameResolver + asFieldName).get<FieldAccessLogicalFunction>();
+    }
+    else
+    {
+        const auto fieldName = asFieldName.substr(asFieldName.find_last_of(Schema::ATTRIBUTE_NAME_SEPARATOR) + 1);
+        asField = asField.withFieldName(attributeNameResolver + fieldName).get<FieldAccessLogicalFunction>();
+    }
+    inputStamp = onField.getDataType();
+    finalAggregateStamp = DataTypeProvider::provideDataType(DataType::Type::FLOAT64);
+    asField = asField.withDataType(getFinalAggregateStamp()).get<FieldAccessLogicalFunction>();
+}
+
+SerializableAggregationFunction ApproxQuantileAggregationLogicalFunction::serialize() const
+{
+    SerializableAggregationFunction serializedAggregationFunction;
+    serializedAggregationFunction.set_type(NAME);
+
+    auto onFieldFuc = SerializableFunction();
+    onFieldFuc.CopyFrom(onField.serialize());
+
+    auto asFieldFuc = SerializableFunction();
+    asFieldFuc.CopyFrom(asField.serialize());
+
+    serializedAggregationFunction.mutable_as_field()->CopyFrom(asFieldFuc);
+    serializedAggregationFunction.mutable_on_field()->CopyFrom(onFieldFuc);
+    serializedAggregationFunction.set_quantile(quantile);
+    return serializedAggregationFunction;
+}
+
+AggregationLogicalFunctionRegistryReturnType AggregationLogicalFunctionGeneratedRegistrar::RegisterApproxQuantileAggregationLogicalFunction(
+    AggregationLogicalFunctionRegistryArguments arguments)
+{
+    if (arguments.fields.size() != 2)
+    {
+        throw CannotDeserialize(
+            "ApproxQuantileAggregationLogicalFunction requires exactly two fields, but got {}", arguments.fields.size());
+    }
+    if (not arguments.quantile.has_value())
+    {
+        throw CannotDeserialize("ApproxQuantileAggregationLogicalFunction requires a quantile");
+    }
+    return std::make_shared<ApproxQuantileAggregationLogicalFunction>(arguments.fields[0], arguments.fields[1], arguments.quantile.value());
+}
+}
@@ -0,0 +1,123 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Operators/Windows/Aggregations/ApproxTopKAggregationLogicalFunction.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <DataTypes/DataTypeProvider.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Functions/FieldAccessLogicalFunction.hpp>
+#include <Functions/LogicalFunction.hpp>
+#include <Operators/Windows/Aggregations/WindowAggregationLogicalFunction.hpp>
+#include <AggregationLogicalFunctionRegistry.hpp>
+#include <ErrorHandling.hpp>
+#include <SerializableVariantDescriptor.pb.h>
+
+namespace NES
+{
+ApproxTopKAggregationLogicalFunction::ApproxTopKAggregationLogicalFunction(const FieldAccessLogicalFunction& field, const uint64_t k)
+    : ApproxTopKAggregationLogicalFunction(field, field, k)
+{
+}
+
+ApproxTopKAggregationLogicalFunction::ApproxTopKAggregationLogicalFunction(
+    const FieldAccessLogicalFunction& field, FieldAccessLogicalFunction asField, const uint64_t k)
+    : WindowAggregationLogicalFunction(
+          field.getDataType(),
+          DataTypeProvider::provideDataType(partialAggregateStampType),
+          DataTypeProvider::provideDataType(finalAggregateStampType),
+          field,
+          std::move(asField))
+    , k(k)
+{
+    if (not(0 < k and k <= MAX_K))
+    {
+        throw InvalidQuerySyntax("The k of APPROX_TOP_K must be in [1, {}], but got {}", MAX_K, k);
+    }
+}
+
+std::string_view ApproxTopKAggregationLogicalFunction::getName() const noexcept
+{
+    return NAME;
+}
+
+uint64_t ApproxTopKAggregationLogicalFunction::getK() const
+{
+    return k;
+}
+
+void ApproxTopKAggregationLogicalFunction::inferStamp(const Schema& schema)
+{
+    /// We first infer the dataType of the input field. The result contains the top-k values, i.e., is variable sized.
+    onField = onField.withInferredDataType(schema).get<FieldAccessLogicalFunction>();
+    if (not onField.getDataType().isNumeric())
+    {
+        throw CannotDeserialize("aggregations on non numeric fields is not supported, but got {}", onField.getDataType());
+    }
+
+    ///Set fully qualified name for the as Field
+    const auto onFieldName = onField.getFieldName();
+    const auto asFieldName = asField.getFieldName();
+
+    const auto attributeNameResolver = onFieldName.substr(0, onFieldName.find(Schema::ATTRIBUTE_NAME_SEPARATOR) + 1);
+    ///If on and as field name are different then append the attribute name resolver from on field to the as field
+    if (asFieldName.find(Schema::ATTRIBUTE_NAME_SEPARATOR) == std::string::npos)
+    {
+        asField = asField.withFieldName(attributeNameResolver + asFieldName).get<FieldAccessLogicalFunction>();
+    }
+    else
+    {
+        const auto fieldName = asFieldName.substr(asFieldName.find_last_of(Schema::ATTRIBUTE_NAME_SEPARATOR) + 1);
+        asField = asField.withFieldName(attributeNameResolver + fieldName).get<FieldAccessLogicalFunction>();
+    }
+    inputStamp = onField.getDataType();
+    finalAggregateStamp = DataTypeProvider::provideDataType(finalAggregateStampType);
+    asField = asField.withDataType(getFinalAggregateStamp()).get<FieldAccessLogicalFunction>();
+}
+
+SerializableAggregationFunction ApproxTopKAggregationLogicalFunction::serialize() const
+{
+    SerializableAggregationFunction serializedAggregationFunction;
+    serializedAggregationFunction.set_type(NAME);
+
+    auto onFieldFuc = SerializableFunction();
+    onFieldFuc.CopyFrom(onField.serialize());
+
+    auto asFieldFuc = SerializableFunction();
+    asFieldFuc.CopyFrom(asField.serialize());
+
+    serializedAggregationFunction.mutable_as_field()->CopyFrom(asFieldFuc);
+    serializedAggregationFunction.mutable_on_field()->CopyFrom(onFieldFuc);
+    serializedAggregationFunction.set_k(k);
+    return serializedAggregationFunction;
+}
+
+AggregationLogicalFunctionRegistryReturnType AggregationLogicalFunctionGeneratedRegistrar::RegisterApproxTopKAggregationLogicalFunction(
+    AggregationLogicalFunctionRegistryArguments arguments)
+{
+    if (arguments.fields.size() != 2)
+    {
+        throw CannotDeserialize("ApproxTopKAggregationLogicalFunction requires exactly two fields, but got {}", arguments.fields.size());
+    }
+    if (not arguments.k.has_value())
+    {
+        throw CannotDeserialize("ApproxTopKAggregationLogicalFunction requires a k");
+    }
+    return std::make_shared<ApproxTopKAggregationLogicalFunction>(arguments.fields[0], arguments.fields[1], arguments.k.value());
+}
+}
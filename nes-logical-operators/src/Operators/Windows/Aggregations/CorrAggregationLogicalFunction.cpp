@@ -0,0 +1,121 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Operators/Windows/Aggregations/CorrAggregationLogicalFunction.hpp>
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <DataTypes/DataTypeProvider.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Functions/FieldAccessLogicalFunction.hpp>
+#include <Functions/LogicalFunction.hpp>
+#include <Operators/Windows/Aggregations/WindowAggregationLogicalFunction.hpp>
+#include <AggregationLogicalFunctionRegistry.hpp>
+#include <ErrorHandling.hpp>
+#include <SerializableVariantDescriptor.pb.h>
+
+namespace NES
+{
+CorrAggregationLogicalFunction::CorrAggregationLogicalFunction(
+    const FieldAccessLogicalFunction& field, FieldAccessLogicalFunction secondField)
+    : CorrAggregationLogicalFunction(field, std::move(secondField), field)
+{
+}
+
+CorrAggregationLogicalFunction::CorrAggregationLogicalFunction(
+    const FieldAccessLogicalFunction& field, FieldAccessLogicalFunction secondField, FieldAccessLogicalFunction asField)
+    : WindowAggregationLogicalFunction(
+          field.getDataType(),
+          DataTypeProvider::provideDataType(partialAggregateStampType),
+          DataTypeProvider::provideDataType(finalAggregateStampType),
+          field,
+          std::move(asField))
+    , secondOnField(std::move(secondField))
+{
+}
+
+std::string_view CorrAggregationLogicalFunction::getName() const noexcept
+{
+    return NAME;
+}
+
+const FieldAccessLogicalFunction& CorrAggregationLogicalFunction::getSecondOnField() const
+{
+    return secondOnField;
+}
+
+void CorrAggregationLogicalFunction::inferStamp(const Schema& schema)
+{
+    /// We first infer the dataTypes of both input fields. The result is always a FLOAT64, as the physical function calculates with doubles.
+    onField = onField.withInferredDataType(schema).get<FieldAccessLogicalFunction>();
+    secondOnField = secondOnField.withInferredDataType(schema).get<FieldAccessLogicalFunction>();
+    if (not onField.getDataType().isNumeric() or not secondOnField.getDataType().isNumeric())
+    {
+        throw CannotInferSchema(
+            "{}: aggregations on non numeric fields is not supported, but got {} and {}",
+            NAME,
+            onField.getDataType(),
+            secondOnField.getDataType());
+    }
+
+    ///Set fully qualified name for the as Field
+    const auto onFieldName = onField.getFieldName();
+    const auto asFieldName = asField.getFieldName();
+
+    const auto attributeNameResolver = onFieldName.substr(0, onFieldName.find(Schema::ATTRIBUTE_NAME_SEPARATOR) + 1);
+    ///If on and as field name are different then append the attribute name resolver from on field to the as field
+    if (asFieldName.find(Schema::ATTRIBUTE_NAME_SEPARATOR) == std::string::npos)
+    {
+        asField = asField.withFieldName(attributeNameResolver + asFieldName).get<FieldAccessLogicalFunction>();
+    }
+    else
+    {
+        const auto fieldName = asFieldName.substr(asFieldName.find_last_of(Schema::ATTRIBUTE_NAME_SEPARATOR) + 1);
+        asField = asField.withFieldName(attributeNameResolver + fieldName).get<FieldAccessLogicalFunction>();
+    }
+    inputStamp = onField.getDataType();
+    finalAggregateStamp = DataTypeProvider::provideDataType(finalAggregateStampType);
+    asField = asField.withDataType(getFinalAggregateStamp()).get<FieldAccessLogicalFunction>();
+}
+
+SerializableAggregationFunction CorrAggregationLogicalFunction::serialize() const
+{
+    SerializableAggregationFunction serializedAggregationFunction;
+    serializedAggregationFunction.set_type(NAME);
+
+    auto onFieldFuc = SerializableFunction();
+    onFieldFuc.CopyFrom(onField.serialize());
+
+    auto asFieldFuc = SerializableFunction();
+    asFieldFuc.CopyFrom(asField.serialize());
+
+    serializedAggregationFunction.mutable_as_field()->CopyFrom(asFieldFuc);
+    serializedAggregationFunction.mutable_on_field()->CopyFrom(onFieldFuc);
+    serializedAggregationFunction.mutable_second_on_field()->CopyFrom(secondOnField.serialize());
+    return serializedAggregationFunction;
+}
+
+AggregationLogicalFunctionRegistryReturnType AggregationLogicalFunctionGeneratedRegistrar::RegisterCorrAggregationLogicalFunction(
+    AggregationLogicalFunctionRegistryArguments arguments)
+{
+    /// The fields are the two fields of the aggregation followed by the as field
+    if (arguments.fields.size() != 3)
+    {
+        throw CannotDeserialize("CorrAggregationLogicalFunction requires exactly three fields, but got {}", arguments.fields.size());
+    }
+    return std::make_shared<CorrAggregationLogicalFunction>(arguments.fields[0], arguments.fields[1], arguments.fields[2]);
+}
+}
@@ -15,6 +15,7 @@
 #include <Operators/Windows/Aggregations/Meos/TemporalSequenceAggregationLogicalFunctionV2.hpp>
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <Configurations/Descriptor.hpp>
@@ -36,7 +37,8 @@ TemporalSequenceAggregationLogicalFunctionV2::TemporalSequenceAggregationLogical
     const FieldAccessLogicalFunction& lonField,
     const FieldAccessLogicalFunction& latField,
     const FieldAccessLogicalFunction& timestampField,
-    const FieldAccessLogicalFunction& asField)
+    const FieldAccessLogicalFunction& asField,
+    const std::optional<double> toleranceInMeters)
     : WindowAggregationLogicalFunction(
           lonField.getDataType(),
           DataTypeProvider::provideDataType(partialAggregateStampType),
@@ -46,17 +48,23 @@ TemporalSequenceAggregationLogicalFunctionV2::TemporalSequenceAggregationLogical
     , lonField(lonField)
     , latField(latField)
     , timestampField(timestampField)
+    , toleranceInMeters(toleranceInMeters)
 {
+    if (toleranceInMeters.has_value() and not(*toleranceInMeters >= 0))
+    {
+        throw InvalidQuerySyntax("The tolerance of TEMPORAL_SEQUENCE must not be negative, but got {}", *toleranceInMeters);
+    }
 }
 
 std::shared_ptr<WindowAggregationLogicalFunction>
 TemporalSequenceAggregationLogicalFunctionV2::create(
     const FieldAccessLogicalFunction& lonField,
     const FieldAccessLogicalFunction& latField,
-    const FieldAccessLogicalFunction& timestampField)
+    const FieldAccessLogicalFunction& timestampField,
+    const std::optional<double> toleranceInMeters)
 {
     // Default alias to lon field; will be adjusted in inferStamp
-    return std::make_shared<TemporalSequenceAggregationLogicalFunctionV2>(lonField, latField, timestampField, lonField);
+    return std::make_shared<TemporalSequenceAggregationLogicalFunctionV2>(lonField, latField, timestampField, lonField, toleranceInMeters);
 }
 
 std::string_view TemporalSequenceAggregationLogicalFunctionV2::getName() const noexcept
@@ -97,7 +105,7 @@ void TemporalSequenceAggregationLogicalFunctionV2::inferStamp(const Schema& sche
 
 NES::SerializableAggregationFunction TemporalSequenceAggregationLogicalFunctionV2::serialize() const
 {
-    return TemporalAggregationSerde::serializeTemporalSequence(onField, latField, timestampField, asField);
+    return TemporalAggregationSerde::serializeTemporalSequence(onField, latField, timestampField, asField, toleranceInMeters);
 }
 
 AggregationLogicalFunctionRegistryReturnType AggregationLogicalFunctionGeneratedRegistrar::RegisterTemporalSequenceAggregationLogicalFunction(
@@ -108,7 +116,8 @@ AggregationLogicalFunctionRegistryReturnType AggregationLogicalFunctionGenerated
         auto function = TemporalSequenceAggregationLogicalFunctionV2::create(arguments.fields[0], arguments.fields[1], arguments.fields[2]);
         // last field is alias
         // NOTE: base class has no setter; emulate by constructing a new instance with alias
-        auto ptr = std::make_shared<TemporalSequenceAggregationLogicalFunctionV2>(arguments.fields[0], arguments.fields[1], arguments.fields[2], arguments.fields[3]);
+        auto ptr = std::make_shared<TemporalSequenceAggregationLogicalFunctionV2>(
+            arguments.fields[0], arguments.fields[1], arguments.fields[2], arguments.fields[3], arguments.tolerance);
         return ptr;
     }
     throw CannotDeserialize(
@@ -40,6 +40,7 @@
 #include <Traits/Trait.hpp>
 #include <Traits/TraitSet.hpp>
 #include <Util/PlanRenderer.hpp>
+#include <WindowTypes/Types/SessionWindow.hpp>
 #include <WindowTypes/Types/SlidingWindow.hpp>
 #include <WindowTypes/Types/TimeBasedWindowType.hpp>
 #include <WindowTypes/Types/TumblingWindow.hpp>
@@ -123,6 +124,15 @@ JoinLogicalOperator JoinLogicalOperator::withInferredSchema(std::vector<Schema>
     inputSchema.appendFieldsFromOtherSchema(rightInputSchema);
     copy.joinFunction = joinFunction.withInferredDataType(inputSchema);
     copy.windowType->inferStamp(inputSchema);
+    if (dynamic_cast<const Windowing::SessionWindow*>(copy.windowType.get()) != nullptr)
+    {
+        throw TypeInferenceException("Joins do not support session windows: {}", copy.windowType->toString());
+    }
+    if (const auto* timeBasedWindow = dynamic_cast<const Windowing::TimeBasedWindowType*>(copy.windowType.get());
+        timeBasedWindow != nullptr and timeBasedWindow->getEarlyFiringInterval().has_value())
+    {
+        throw TypeInferenceException("Joins do not emit early results: {}", copy.windowType->toString());
+    }
     return copy;
 }
 
@@ -0,0 +1,285 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Operators/Windows/MultiWayJoinLogicalOperator.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <fmt/format.h>
+#include <fmt/ranges.h>
+
+#include <Configurations/Descriptor.hpp>
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Functions/FieldAccessLogicalFunction.hpp>
+#include <Functions/LogicalFunction.hpp>
+#include <Identifiers/Identifiers.hpp>
+#include <Operators/LogicalOperator.hpp>
+#include <Serialization/FunctionSerializationUtil.hpp>
+#include <Serialization/SchemaSerializationUtil.hpp>
+#include <Traits/Trait.hpp>
+#include <Traits/TraitSet.hpp>
+#include <Util/PlanRenderer.hpp>
+#include <WindowTypes/Measures/TimeCharacteristic.hpp>
+#include <WindowTypes/Types/TimeBasedWindowType.hpp>
+#include <WindowTypes/Types/TumblingWindow.hpp>
+#include <WindowTypes/Types/WindowType.hpp>
+#include <ErrorHandling.hpp>
+#include <LogicalOperatorRegistry.hpp>
+#include <SerializableOperator.pb.h>
+#include <SerializableVariantDescriptor.pb.h>
+
+namespace NES
+{
+
+MultiWayJoinLogicalOperator::MultiWayJoinLogicalOperator(
+    std::vector<LogicalFunction> joinFields, std::shared_ptr<Windowing::WindowType> windowType)
+    : joinFields(std::move(joinFields)), windowType(std::move(windowType))
+{
+}
+
+std::string_view MultiWayJoinLogicalOperator::getName() const noexcept
+{
+    return NAME;
+}
+
+bool MultiWayJoinLogicalOperator::operator==(const MultiWayJoinLogicalOperator& rhs) const
+{
+    return *getWindowType() == *rhs.getWindowType() and getJoinFields() == rhs.getJoinFields()
+        and getInputSchemas() == rhs.getInputSchemas() and getOutputSchema() == rhs.getOutputSchema()
+        and getTraitSet() == rhs.getTraitSet();
+}
+
+std::string MultiWayJoinLogicalOperator::explain(ExplainVerbosity verbosity, OperatorId id) const
+{
+    if (verbosity == ExplainVerbosity::Debug)
+    {
+        return fmt::format(
+            "MultiWayJoin(opId: {}, windowType: {}, joinFields: {}, traitSet: {})",
+            id,
+            getWindowType()->toString(),
+            fmt::join(getJoinFieldNames(), ", "),
+            traitSet.explain(verbosity));
+    }
+    return fmt::format("MultiWayJoin({})", fmt::join(getJoinFieldNames(), " = "));
+}
+
+MultiWayJoinLogicalOperator MultiWayJoinLogicalOperator::withInferredSchema(std::vector<Schema> inputSchemas) const
+{
+    if (inputSchemas.size() < 2 or inputSchemas.size() != joinFields.size())
+    {
+        throw TypeInferenceException(
+            "A multi-way join requires one join field for each of at least two inputs, but got {} inputs and {} join fields",
+            inputSchemas.size(),
+            joinFields.size());
+    }
+
+    auto copy = *this;
+    for (size_t input = 0; input < inputSchemas.size(); ++input)
+    {
+        copy.joinFields[input] = joinFields[input].withInferredDataType(inputSchemas[input]);
+        if (copy.joinFields[input].getDataType() != copy.joinFields[0].getDataType())
+        {
+            throw TypeInferenceException(
+                "All join fields of a multi-way join must have the same data type, but got {} and {}",
+                copy.joinFields[0].getDataType(),
+                copy.joinFields[input].getDataType());
+        }
+    }
+
+    /// Reproducing the output schema of the left-deep chain of binary joins, c.f., JoinLogicalOperator::withInferredSchema()
+    copy.windowMetaData.clear();
+    auto joinedSchema = inputSchemas[0];
+    for (const auto& inputSchema : inputSchemas | std::views::drop(1))
+    {
+        const auto sourceNameLeft = joinedSchema.getSourceNameQualifier();
+        const auto sourceNameRight = inputSchema.getSourceNameQualifier();
+        if (not(sourceNameLeft and sourceNameRight))
+        {
+            throw TypeInferenceException("Schemas of MultiWayJoin operator must have source names.");
+        }
+        const auto qualifier = sourceNameLeft.value() + sourceNameRight.value() + Schema::ATTRIBUTE_NAME_SEPARATOR;
+        const WindowMetaData joinWindowMetaData{qualifier + "START", qualifier + "END"};
+
+        Schema nextJoinedSchema{outputSchema.memoryLayoutType};
+        nextJoinedSchema.addField(joinWindowMetaData.windowStartFieldName, DataType::Type::UINT64);
+        nextJoinedSchema.addField(joinWindowMetaData.windowEndFieldName, DataType::Type::UINT64);
+        nextJoinedSchema.appendFieldsFromOtherSchema(joinedSchema);
+        nextJoinedSchema.appendFieldsFromOtherSchema(inputSchema);
+        joinedSchema = std::move(nextJoinedSchema);
+        copy.windowMetaData.insert(copy.windowMetaData.begin(), joinWindowMetaData);
+    }
+    copy.outputSchema = std::move(joinedSchema);
+
+    auto inputSchema = inputSchemas[0];
+    for (const auto& otherInputSchema : inputSchemas | std::views::drop(1))
+    {
+        inputSchema.appendFieldsFromOtherSchema(otherInputSchema);
+    }
+    copy.windowType->inferStamp(inputSchema);
+    if (dynamic_cast<const Windowing::TumblingWindow*>(copy.windowType.get()) == nullptr)
+    {
+        throw TypeInferenceException("Multi-way joins solely support tumbling windows: {}", copy.windowType->toString());
+    }
+    copy.inputSchemas = std::move(inputSchemas);
+    return copy;
+}
+
+MultiWayJoinLogicalOperator MultiWayJoinLogicalOperator::withTraitSet(TraitSet traitSet) const
+{
+    auto copy = *this;
+    copy.traitSet = std::move(traitSet);
+    return copy;
+}
+
+TraitSet MultiWayJoinLogicalOperator::getTraitSet() const
+{
+    return traitSet;
+}
+
+MultiWayJoinLogicalOperator MultiWayJoinLogicalOperator::withChildren(std::vector<LogicalOperator> children) const
+{
+    auto copy = *this;
+    copy.children = std::move(children);
+    return copy;
+}
+
+std::vector<LogicalOperator> MultiWayJoinLogicalOperator::getChildren() const
+{
+    return children;
+}
+
+std::vector<Schema> MultiWayJoinLogicalOperator::getInputSchemas() const
+{
+    return inputSchemas;
+}
+
+Schema MultiWayJoinLogicalOperator::getOutputSchema() const
+{
+    return outputSchema;
+}
+
+const std::vector<LogicalFunction>& MultiWayJoinLogicalOperator::getJoinFields() const
+{
+    return joinFields;
+}
+
+std::vector<std::string> MultiWayJoinLogicalOperator::getJoinFieldNames() const
+{
+    return joinFields
+        | std::views::transform([](const LogicalFunction& joinField) { return joinField.get<FieldAccessLogicalFunction>().getFieldName(); })
+        | std::ranges::to<std::vector>();
+}
+
+std::shared_ptr<Windowing::WindowType> MultiWayJoinLogicalOperator::getWindowType() const
+{
+    return windowType;
+}
+
+const std::vector<WindowMetaData>& MultiWayJoinLogicalOperator::getWindowMetaData() const
+{
+    return windowMetaData;
+}
+
+void MultiWayJoinLogicalOperator::serialize(SerializableOperator& serializableOperator) const
+{
+    SerializableLogicalOperator proto;
+
+    proto.set_operator_type(NAME);
+    for (const auto& inputSchema : getInputSchemas())
+    {
+        auto* schProto = proto.add_input_schemas();
+        SchemaSerializationUtil::serializeSchema(inputSchema, schProto);
+    }
+
+    auto* outSch = proto.mutable_output_schema();
+    SchemaSerializationUtil::serializeSchema(getOutputSchema(), outSch);
+
+    for (const auto& child : getChildren())
+    {
+        serializableOperator.add_children_ids(child.getId().getRawValue());
+    }
+
+    WindowInfos windowInfo;
+    const auto tumblingWindow = std::dynamic_pointer_cast<Windowing::TumblingWindow>(windowType);
+    INVARIANT(tumblingWindow != nullptr, "Multi-way joins solely support tumbling windows");
+    const auto timeChar = tumblingWindow->getTimeCharacteristic();
+    auto timeCharProto = WindowInfos_TimeCharacteristic();
+    timeCharProto.set_type(WindowInfos_TimeCharacteristic_Type_Event_time);
+    timeCharProto.set_field(timeChar.field.name);
+    timeCharProto.set_multiplier(timeChar.getTimeUnit().getMillisecondsConversionMultiplier());
+    windowInfo.mutable_time_characteristic()->CopyFrom(timeCharProto);
+    windowInfo.mutable_tumbling_window()->set_size(tumblingWindow->getSize().getTime());
+
+    FunctionList joinFieldList;
+    for (const auto& joinField : joinFields)
+    {
+        *joinFieldList.add_functions() = joinField.serialize();
+    }
+
+    (*serializableOperator.mutable_config())[ConfigParameters::JOIN_FIELDS] = descriptorConfigTypeToProto(joinFieldList);
+    (*serializableOperator.mutable_config())[ConfigParameters::WINDOW_INFOS] = descriptorConfigTypeToProto(windowInfo);
+
+    serializableOperator.mutable_operator_()->CopyFrom(proto);
+}
+
+LogicalOperatorRegistryReturnType
+LogicalOperatorGeneratedRegistrar::RegisterMultiWayJoinLogicalOperator(LogicalOperatorRegistryArguments arguments)
+{
+    if (arguments.inputSchemas.size() < 2)
+    {
+        throw CannotDeserialize("Expected at least two input schemas, but got {}", arguments.inputSchemas.size());
+    }
+
+    const auto joinFieldsVariant = arguments.config.at(MultiWayJoinLogicalOperator::ConfigParameters::JOIN_FIELDS);
+    const auto windowInfoVariant = arguments.config.at(MultiWayJoinLogicalOperator::ConfigParameters::WINDOW_INFOS);
+    if (not std::holds_alternative<FunctionList>(joinFieldsVariant) or not std::holds_alternative<WindowInfos>(windowInfoVariant))
+    {
+        throw UnknownLogicalOperator();
+    }
+
+    std::vector<LogicalFunction> joinFields;
+    for (const auto& serializedJoinField : std::get<FunctionList>(joinFieldsVariant).functions())
+    {
+        auto joinField = FunctionSerializationUtil::deserializeFunction(serializedJoinField);
+        if (not joinField.tryGet<FieldAccessLogicalFunction>())
+        {
+            throw CannotDeserialize("Expected the join fields of a multi-way join to be field accesses, but got {}", joinField);
+        }
+        joinFields.emplace_back(std::move(joinField));
+    }
+
+    const auto& windowInfoProto = std::get<WindowInfos>(windowInfoVariant);
+    if (not windowInfoProto.has_tumbling_window())
+    {
+        throw CannotDeserialize("Multi-way joins solely support tumbling windows");
+    }
+    const auto& timeCharProto = windowInfoProto.time_characteristic();
+    auto timeChar = Windowing::TimeCharacteristic::createEventTime(
+        FieldAccessLogicalFunction(timeCharProto.field()), Windowing::TimeUnit(timeCharProto.multiplier()));
+    auto windowType
+        = std::make_shared<Windowing::TumblingWindow>(timeChar, Windowing::TimeMeasure(windowInfoProto.tumbling_window().size()));
+
+    auto logicalOperator = MultiWayJoinLogicalOperator(std::move(joinFields), std::move(windowType));
+    return logicalOperator.withInferredSchema(arguments.inputSchemas);
+}
+
+}
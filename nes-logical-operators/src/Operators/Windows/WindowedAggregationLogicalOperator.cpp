@@ -17,6 +17,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <ranges>
 #include <string>
 #include <string_view>
@@ -38,6 +39,7 @@
 #include <Serialization/SchemaSerializationUtil.hpp>
 #include <Traits/Trait.hpp>
 #include <Util/PlanRenderer.hpp>
+#include <WindowTypes/Types/SessionWindow.hpp>
 #include <WindowTypes/Types/SlidingWindow.hpp>
 #include <WindowTypes/Types/TimeBasedWindowType.hpp>
 #include <WindowTypes/Types/TumblingWindow.hpp>
@@ -69,11 +71,16 @@ std::string WindowedAggregationLogicalOperator::explain(ExplainVerbosity verbosi
     {
         auto windowType = getWindowType();
         auto windowAggregation = getWindowAggregation();
-        return fmt::format(
-            "WINDOW AGGREGATION(opId: {}, {}, window type: {})",
+        auto explanation = fmt::format(
+            "WINDOW AGGREGATION(opId: {}, {}, window type: {}",
             id,
             fmt::join(std::views::transform(windowAggregation, [](const auto& agg) { return agg->toString(); }), ", "),
             windowType->toString());
+        if (topN.has_value())
+        {
+            explanation += fmt::format(", top n: {} {} limit {}", topN->orderFieldName, topN->descending ? "DESC" : "ASC", topN->limit);
+        }
+        return explanation + ")";
     }
     auto windowAggregation = getWindowAggregation();
     return fmt::format(
@@ -115,8 +122,8 @@ bool WindowedAggregationLogicalOperator::operator==(const WindowedAggregationLog
         }
     }
 
-    return *windowType == *rhs.getWindowType() && getOutputSchema() == rhs.getOutputSchema() && getInputSchemas() == rhs.getInputSchemas()
-        && getTraitSet() == rhs.getTraitSet();
+    return *windowType == *rhs.getWindowType() && topN == rhs.getTopN() && getOutputSchema() == rhs.getOutputSchema()
+        && getInputSchemas() == rhs.getInputSchemas() && getTraitSet() == rhs.getTraitSet();
 }
 
 WindowedAggregationLogicalOperator WindowedAggregationLogicalOperator::withInferredSchema(std::vector<Schema> inputSchemas) const
@@ -147,6 +154,10 @@ WindowedAggregationLogicalOperator WindowedAggregationLogicalOperator::withInfer
 
     if (auto* timeWindow = dynamic_cast<Windowing::TimeBasedWindowType*>(getWindowType().get()))
     {
+        if (timeWindow->getEarlyFiringInterval().has_value() and dynamic_cast<Windowing::SessionWindow*>(timeWindow) != nullptr)
+        {
+            throw CannotInferSchema("Session windows do not emit early results: {}", timeWindow->toString());
+        }
         const auto& newQualifierForSystemField = firstSchema.getQualifierNameForSystemGeneratedFieldsWithSeparator();
 
         copy.windowMetaData.windowStartFieldName = newQualifierForSystemField + "START";
@@ -175,6 +186,24 @@ WindowedAggregationLogicalOperator WindowedAggregationLogicalOperator::withInfer
     {
         copy.outputSchema.addField(agg->asField.getFieldName(), agg->asField.getDataType());
     }
+
+    if (copy.topN.has_value())
+    {
+        const auto orderField = copy.outputSchema.getFieldByName(copy.topN->orderFieldName);
+        if (not orderField.has_value())
+        {
+            throw CannotInferSchema("The window aggregation does not produce the order field {} of its top n", copy.topN->orderFieldName);
+        }
+        if (not orderField->dataType.isNumeric())
+        {
+            throw CannotInferSchema("The order field {} of the top n must be numeric, but is {}", orderField->name, orderField->dataType);
+        }
+        if (copy.topN->limit == 0)
+        {
+            throw CannotInferSchema("The limit of the top n must be at least one");
+        }
+        copy.topN->orderFieldName = orderField->name;
+    }
     return copy;
 }
 
@@ -257,6 +286,18 @@ const WindowMetaData& WindowedAggregationLogicalOperator::getWindowMetaData() co
     return windowMetaData;
 }
 
+const std::optional<WindowedAggregationLogicalOperator::TopN>& WindowedAggregationLogicalOperator::getTopN() const
+{
+    return topN;
+}
+
+WindowedAggregationLogicalOperator WindowedAggregationLogicalOperator::withTopN(std::optional<TopN> topN) const
+{
+    auto copy = *this;
+    copy.topN = std::move(topN);
+    return copy;
+}
+
 void WindowedAggregationLogicalOperator::serialize(SerializableOperator& serializableOperator) const
 {
     SerializableLogicalOperator proto;
@@ -307,6 +348,10 @@ void WindowedAggregationLogicalOperator::serialize(SerializableOperator& seriali
         timeCharProto.set_field(timeChar.field.name);
         timeCharProto.set_multiplier(timeChar.getTimeUnit().getMillisecondsConversionMultiplier());
         windowInfo.mutable_time_characteristic()->CopyFrom(timeCharProto);
+        if (const auto earlyFiringInterval = timeBasedWindow->getEarlyFiringInterval())
+        {
+            windowInfo.set_early_firing_interval(earlyFiringInterval->getTime());
+        }
         if (auto tumblingWindow = std::dynamic_pointer_cast<Windowing::TumblingWindow>(windowType))
         {
             auto* tumbling = windowInfo.mutable_tumbling_window();
@@ -318,9 +363,21 @@ void WindowedAggregationLogicalOperator::serialize(SerializableOperator& seriali
             sliding->set_size(slidingWindow->getSize().getTime());
             sliding->set_slide(slidingWindow->getSlide().getTime());
         }
+        else if (auto sessionWindow = std::dynamic_pointer_cast<Windowing::SessionWindow>(windowType))
+        {
+            auto* session = windowInfo.mutable_session_window();
+            session->set_gap(sessionWindow->getGap().getTime());
+        }
     }
     (*serializableOperator.mutable_config())[ConfigParameters::WINDOW_INFOS] = descriptorConfigTypeToProto(windowInfo);
 
+    if (topN.has_value())
+    {
+        (*serializableOperator.mutable_config())[ConfigParameters::TOP_N_FIELD] = descriptorConfigTypeToProto(topN->orderFieldName);
+        (*serializableOperator.mutable_config())[ConfigParameters::TOP_N_DESCENDING] = descriptorConfigTypeToProto(topN->descending);
+        (*serializableOperator.mutable_config())[ConfigParameters::TOP_N_LIMIT] = descriptorConfigTypeToProto(topN->limit);
+    }
+
     serializableOperator.mutable_operator_()->CopyFrom(proto);
 }
 
@@ -403,13 +460,47 @@ LogicalOperatorGeneratedRegistrar::RegisterWindowedAggregationLogicalOperator(Lo
                     Windowing::TimeMeasure(windowInfoProto.sliding_window().slide()));
             }
         }
+        else if (windowInfoProto.has_session_window())
+        {
+            if (windowInfoProto.time_characteristic().type() == WindowInfos_TimeCharacteristic_Type_Ingestion_time)
+            {
+                auto timeChar = Windowing::TimeCharacteristic::createIngestionTime();
+                windowType = std::make_shared<Windowing::SessionWindow>(
+                    timeChar, Windowing::TimeMeasure(windowInfoProto.session_window().gap()));
+            }
+            else
+            {
+                auto field = FieldAccessLogicalFunction(windowInfoProto.time_characteristic().field());
+                auto multiplier = windowInfoProto.time_characteristic().multiplier();
+                auto timeChar = Windowing::TimeCharacteristic::createEventTime(field, Windowing::TimeUnit(multiplier));
+                windowType = std::make_shared<Windowing::SessionWindow>(
+                    timeChar, Windowing::TimeMeasure(windowInfoProto.session_window().gap()));
+            }
+        }
     }
     if (!windowType)
     {
         throw UnknownLogicalOperator();
     }
+    if (const auto& windowInfoProto = std::get<WindowInfos>(windowInfoVariant); windowInfoProto.has_early_firing_interval())
+    {
+        std::dynamic_pointer_cast<Windowing::TimeBasedWindowType>(windowType)
+            ->setEarlyFiringInterval(Windowing::TimeMeasure(windowInfoProto.early_firing_interval()));
+    }
 
     auto logicalOperator = WindowedAggregationLogicalOperator(keys, windowAggregations, windowType);
+    const auto topNFieldVariant = arguments.config[WindowedAggregationLogicalOperator::ConfigParameters::TOP_N_FIELD];
+    if (const auto* topNField = std::get_if<std::string>(&topNFieldVariant))
+    {
+        const auto descendingVariant = arguments.config[WindowedAggregationLogicalOperator::ConfigParameters::TOP_N_DESCENDING];
+        const auto limitVariant = arguments.config[WindowedAggregationLogicalOperator::ConfigParameters::TOP_N_LIMIT];
+        if (not std::holds_alternative<bool>(descendingVariant) or not std::holds_alternative<uint64_t>(limitVariant))
+        {
+            throw UnknownLogicalOperator();
+        }
+        logicalOperator = logicalOperator.withTopN(WindowedAggregationLogicalOperator::TopN{
+            .orderFieldName = *topNField, .descending = std::get<bool>(descendingVariant), .limit = std::get<uint64_t>(limitVariant)});
+    }
     if (arguments.inputSchemas.empty())
     {
         throw CannotDeserialize("Cannot construct WindowedAggregation");
@@ -15,7 +15,9 @@
 #include <Plans/LogicalPlanBuilder.hpp>
 
 #include <array>
+#include <cstdint>
 #include <memory>
+#include <optional>
 #include <ranges>
 #include <string>
 #include <unordered_map>
@@ -25,13 +27,17 @@
 
 #include <Configurations/Descriptor.hpp>
 #include <DataTypes/Schema.hpp>
+#include <DataTypes/TimeUnit.hpp>
 #include <Functions/ConstantValueLogicalFunction.hpp>
 #include <Functions/FieldAccessLogicalFunction.hpp>
 #include <Functions/LogicalFunction.hpp>
 #include <Functions/RenameLogicalFunction.hpp>
 #include <Iterators/BFSIterator.hpp>
+#include <Operators/EventTimeSortLogicalOperator.hpp>
 #include <Operators/EventTimeWatermarkAssignerLogicalOperator.hpp>
 #include <Operators/IngestionTimeWatermarkAssignerLogicalOperator.hpp>
+#include <Operators/LookupJoinLogicalOperator.hpp>
+#include <Operators/PatternLogicalOperator.hpp>
 #include <Operators/ProjectionLogicalOperator.hpp>
 #include <Operators/SelectionLogicalOperator.hpp>
 #include <Operators/Sinks/InlineSinkLogicalOperator.hpp>
@@ -86,11 +92,48 @@ LogicalPlan LogicalPlanBuilder::addSelection(LogicalFunction selectionFunction,
     return promoteOperatorToRoot(queryPlan, SelectionLogicalOperator(std::move(selectionFunction)));
 }
 
+LogicalPlan LogicalPlanBuilder::addEventTimeSort(
+    const LogicalPlan& queryPlan, FieldAccessLogicalFunction timestampField, const uint64_t reorderIntervalMs)
+{
+    PRECONDITION(not queryPlan.getRootOperators().empty(), "invalid query plan, as the root operator is empty");
+    /// The sort emits the records of an interval once the watermark of the timestamp field has passed the interval
+    const auto withWatermarks
+        = promoteOperatorToRoot(queryPlan, EventTimeWatermarkAssignerLogicalOperator(timestampField, Windowing::TimeUnit::Milliseconds()));
+    return promoteOperatorToRoot(
+        withWatermarks, EventTimeSortLogicalOperator(std::move(timestampField), Windowing::TimeUnit::Milliseconds(), reorderIntervalMs));
+}
+
+LogicalPlan LogicalPlanBuilder::addPattern(
+    const LogicalPlan& queryPlan,
+    std::vector<std::string> eventNames,
+    std::vector<LogicalFunction> eventPredicates,
+    std::vector<PatternLogicalOperator::Step> steps,
+    std::vector<FieldAccessLogicalFunction> partitionKeys,
+    FieldAccessLogicalFunction timestampField,
+    const uint64_t withinMs)
+{
+    PRECONDITION(not queryPlan.getRootOperators().empty(), "invalid query plan, as the root operator is empty");
+    /// The pattern removes partial matches, which time out before the watermark of the timestamp field
+    const auto withWatermarks
+        = promoteOperatorToRoot(queryPlan, EventTimeWatermarkAssignerLogicalOperator(timestampField, Windowing::TimeUnit::Milliseconds()));
+    return promoteOperatorToRoot(
+        withWatermarks,
+        PatternLogicalOperator(
+            std::move(eventNames),
+            std::move(eventPredicates),
+            std::move(steps),
+            std::move(partitionKeys),
+            std::move(timestampField),
+            Windowing::TimeUnit::Milliseconds(),
+            withinMs));
+}
+
 LogicalPlan LogicalPlanBuilder::addWindowAggregation(
     LogicalPlan queryPlan,
     const std::shared_ptr<Windowing::WindowType>& windowType,
     std::vector<std::shared_ptr<WindowAggregationLogicalFunction>> windowAggs,
-    std::vector<FieldAccessLogicalFunction> onKeys)
+    std::vector<FieldAccessLogicalFunction> onKeys,
+    std::optional<WindowedAggregationLogicalOperator::TopN> topN)
 {
     PRECONDITION(not queryPlan.getRootOperators().empty(), "invalid query plan, as the root operator is empty");
 
@@ -116,7 +159,8 @@ LogicalPlan LogicalPlanBuilder::addWindowAggregation(
     }
 
     auto inputSchema = queryPlan.getRootOperators().front().getOutputSchema();
-    return promoteOperatorToRoot(queryPlan, WindowedAggregationLogicalOperator(std::move(onKeys), std::move(windowAggs), windowType));
+    return promoteOperatorToRoot(
+        queryPlan, WindowedAggregationLogicalOperator(std::move(onKeys), std::move(windowAggs), windowType).withTopN(std::move(topN)));
 }
 
 LogicalPlan LogicalPlanBuilder::addUnion(LogicalPlan leftLogicalPlan, LogicalPlan rightLogicalPlan)
@@ -181,6 +225,26 @@ LogicalPlan LogicalPlanBuilder::addJoin(
     return leftLogicalPlan;
 }
 
+LogicalPlan LogicalPlanBuilder::addLookupJoin(
+    const LogicalPlan& queryPlan, std::string tableFilePath, Schema tableSchema, LogicalFunction joinFunction, const uint64_t reloadIntervalMs)
+{
+    NES_TRACE("LogicalPlanBuilder: add lookup join operator to query plan");
+    return promoteOperatorToRoot(
+        queryPlan,
+        LookupJoinLogicalOperator(std::move(tableFilePath), std::move(tableSchema), std::move(joinFunction), reloadIntervalMs));
+}
+
+LogicalPlan LogicalPlanBuilder::addLookupJoin(
+    const LogicalPlan& queryPlan,
+    LookupJoinLogicalOperator::ExternalTable externalTable,
+    Schema tableSchema,
+    LogicalFunction joinFunction)
+{
+    NES_TRACE("LogicalPlanBuilder: add lookup join operator with an external table to query plan");
+    return promoteOperatorToRoot(
+        queryPlan, LookupJoinLogicalOperator(std::move(externalTable), std::move(tableSchema), std::move(joinFunction)));
+}
+
 LogicalPlan LogicalPlanBuilder::addSink(std::string sinkName, const LogicalPlan& queryPlan)
 {
     return promoteOperatorToRoot(queryPlan, SinkLogicalOperator(std::move(sinkName)));
@@ -72,6 +72,10 @@ deserializeWindowAggregationFunction(const SerializableAggregationFunction& seri
         {
             args.fields.push_back(f);
         }
+        if (serializedFunction.has_tolerance())
+        {
+            args.tolerance = serializedFunction.tolerance();
+        }
         if (auto function = AggregationLogicalFunctionRegistry::instance().create(type, args))
         {
             return function.value();
@@ -88,6 +92,20 @@ deserializeWindowAggregationFunction(const SerializableAggregationFunction& seri
         {
             AggregationLogicalFunctionRegistryArguments args;
             args.fields = {fieldAccess.value(), asFieldAccess.value()};
+            if (serializedFunction.has_second_on_field())
+            {
+                /// Aggregations over two fields expect the second field before the as field
+                args.fields.insert(
+                    args.fields.begin() + 1, deserializeFunction(serializedFunction.second_on_field()).get<FieldAccessLogicalFunction>());
+            }
+            if (serializedFunction.has_quantile())
+            {
+                args.quantile = serializedFunction.quantile();
+            }
+            if (serializedFunction.has_k())
+            {
+                args.k = serializedFunction.k();
+            }
 
             if (auto function = AggregationLogicalFunctionRegistry::instance().create(type, args))
             {
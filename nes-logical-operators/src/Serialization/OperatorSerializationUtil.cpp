@@ -52,6 +52,11 @@ LogicalOperator OperatorSerializationUtil::deserializeOperator(const Serializabl
             const auto& serializedSource = serializedOperator.source();
             auto sourceDescriptor = deserializeSourceDescriptor(serializedSource.sourcedescriptor());
             auto sourceOperator = SourceDescriptorLogicalOperator(std::move(sourceDescriptor));
+            if (serializedSource.projectedfields_size() > 0)
+            {
+                return sourceOperator.withProjectedFields(
+                    std::vector<std::string>(serializedSource.projectedfields().begin(), serializedSource.projectedfields().end()));
+            }
             return sourceOperator;
         }
 
@@ -131,6 +136,8 @@ SourceDescriptor OperatorSerializationUtil::deserializeSourceDescriptor(const Se
     deserializedParserConfig.parserType = serializedParserConfig.type();
     deserializedParserConfig.tupleDelimiter = serializedParserConfig.tupledelimiter();
     deserializedParserConfig.fieldDelimiter = serializedParserConfig.fielddelimiter();
+    deserializedParserConfig.maxBytesPerFormattingTask = serializedParserConfig.maxbytesperformattingtask();
+    deserializedParserConfig.dictionaryEncoding = serializedParserConfig.dictionaryencoding();
 
     /// Deserialize SourceDescriptor config. Convert from protobuf variant to SourceDescriptor::ConfigType.
     DescriptorConfig::Config sourceDescriptorConfig{};
@@ -0,0 +1,124 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Serialization/PlanFragmentCache.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <Identifiers/Identifiers.hpp>
+#include <Operators/LogicalOperator.hpp>
+#include <Serialization/OperatorSerializationUtil.hpp>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+#include <ErrorHandling.hpp>
+#include <SerializableOperator.pb.h>
+#include <SerializableQueryPlan.pb.h>
+
+namespace NES
+{
+
+namespace
+{
+/// 64-bit FNV-1a, which is identical in the processes of the client and the worker, unlike std::hash
+uint64_t fnv1a(const std::string& bytes)
+{
+    constexpr uint64_t offsetBasis = 14695981039346656037ULL;
+    constexpr uint64_t prime = 1099511628211ULL;
+    uint64_t hash = offsetBasis;
+    for (const auto byte : bytes)
+    {
+        hash ^= static_cast<uint8_t>(byte);
+        hash *= prime;
+    }
+    return hash;
+}
+
+bool isFragmentReference(const SerializableOperator& serializedOperator)
+{
+    return serializedOperator.has_fragment_hash() and serializedOperator.value_case() == SerializableOperator::VALUE_NOT_SET;
+}
+}
+
+PlanFragmentCache::PlanFragmentCache(const size_t capacity) : fragments(folly::EvictingCacheMap<uint64_t, LogicalOperator>(capacity))
+{
+}
+
+uint64_t PlanFragmentCache::hashFragment(const SerializableOperator& serializedOperator)
+{
+    SerializableOperator fragment = serializedOperator;
+    fragment.clear_operator_id();
+    fragment.clear_children_ids();
+    fragment.clear_fragment_hash();
+
+    /// Protobuf serializes maps, e.g., the configs, in an arbitrary order, unless the serialization is deterministic
+    std::string bytes;
+    {
+        google::protobuf::io::StringOutputStream stringStream(&bytes);
+        google::protobuf::io::CodedOutputStream codedStream(&stringStream);
+        codedStream.SetSerializationDeterministic(true);
+        fragment.SerializeToCodedStream(&codedStream);
+    }
+    return fnv1a(bytes);
+}
+
+LogicalOperator PlanFragmentCache::deserializeOperator(const SerializableOperator& serializedOperator)
+{
+    const auto operatorId = OperatorId(serializedOperator.operator_id());
+    if (isFragmentReference(serializedOperator))
+    {
+        auto locked = fragments.lock();
+        const auto fragment = locked->find(serializedOperator.fragment_hash());
+        if (fragment == locked->end())
+        {
+            throw UnknownPlanFragment("Operator {} references the fragment {}", operatorId, serializedOperator.fragment_hash());
+        }
+        return fragment->second.withOperatorId(operatorId);
+    }
+
+    auto deserializedOperator = OperatorSerializationUtil::deserializeOperator(serializedOperator);
+    const auto hash = serializedOperator.has_fragment_hash() ? serializedOperator.fragment_hash() : hashFragment(serializedOperator);
+    fragments.lock()->set(hash, deserializedOperator);
+    return deserializedOperator;
+}
+
+void SentPlanFragments::compactPlan(SerializableQueryPlan& serializedQueryPlan)
+{
+    const std::scoped_lock lock(mutex);
+    for (auto& serializedOperator : *serializedQueryPlan.mutable_operators())
+    {
+        const auto hash = PlanFragmentCache::hashFragment(serializedOperator);
+        if (sentFragments.contains(hash))
+        {
+            /// Keeps solely the id and the children of the operator
+            serializedOperator.clear_config();
+            serializedOperator.clear_trait_set();
+            serializedOperator.clear_value();
+        }
+        else
+        {
+            sentFragments.insert(hash);
+        }
+        serializedOperator.set_fragment_hash(hash);
+    }
+}
+
+void SentPlanFragments::clear()
+{
+    const std::scoped_lock lock(mutex);
+    sentFragments.clear();
+}
+
+}
@@ -14,6 +14,7 @@
 
 #include <Serialization/QueryPlanSerializationUtil.hpp>
 
+#include <algorithm>
 #include <functional>
 #include <unordered_map>
 #include <utility>
@@ -23,7 +24,9 @@
 #include <Iterators/BFSIterator.hpp>
 #include <Operators/Sinks/SinkLogicalOperator.hpp>
 #include <Plans/LogicalPlan.hpp>
+#include <Operators/LogicalOperator.hpp>
 #include <Serialization/OperatorSerializationUtil.hpp>
+#include <Serialization/PlanFragmentCache.hpp>
 #include <Serialization/TraitSetSerializationUtil.hpp>
 #include <Util/Logger/Logger.hpp>
 #include <ErrorHandling.hpp>
@@ -63,6 +66,21 @@ SerializableQueryPlan QueryPlanSerializationUtil::serializeQueryPlan(const Logic
 }
 
 LogicalPlan QueryPlanSerializationUtil::deserializeQueryPlan(const SerializableQueryPlan& serializedQueryPlan)
+{
+    return deserializeQueryPlan(serializedQueryPlan, &OperatorSerializationUtil::deserializeOperator);
+}
+
+LogicalPlan
+QueryPlanSerializationUtil::deserializeQueryPlan(const SerializableQueryPlan& serializedQueryPlan, PlanFragmentCache& fragmentCache)
+{
+    return deserializeQueryPlan(
+        serializedQueryPlan,
+        [&fragmentCache](const SerializableOperator& serializedOp) { return fragmentCache.deserializeOperator(serializedOp); });
+}
+
+LogicalPlan QueryPlanSerializationUtil::deserializeQueryPlan(
+    const SerializableQueryPlan& serializedQueryPlan,
+    const std::function<LogicalOperator(const SerializableOperator&)>& deserializeOperator)
 {
     std::vector<Exception> deserializeExceptions;
 
@@ -74,7 +92,7 @@ LogicalPlan QueryPlanSerializationUtil::deserializeQueryPlan(const SerializableQ
         CPPTRACE_TRY
         {
             const auto operatorId = serializedOp.operator_id();
-            auto [_, inserted] = baseOps.emplace(operatorId, OperatorSerializationUtil::deserializeOperator(serializedOp));
+            auto [_, inserted] = baseOps.emplace(operatorId, deserializeOperator(serializedOp));
             if (!inserted)
             {
                 throw CannotDeserialize("Duplicate operator id in {}", serializedQueryPlan.DebugString());
@@ -94,6 +112,12 @@ LogicalPlan QueryPlanSerializationUtil::deserializeQueryPlan(const SerializableQ
 
     if (!deserializeExceptions.empty())
     {
+        /// The client resends the plan with all its fragments upon an unknown fragment, thus it must receive the error code
+        if (const auto unknownFragment = std::ranges::find(deserializeExceptions, ErrorCode::UnknownPlanFragment, &Exception::code);
+            unknownFragment != deserializeExceptions.end())
+        {
+            throw *unknownFragment;
+        }
         std::string msgs;
         for (auto& deserExc : deserializeExceptions)
         {
@@ -14,6 +14,7 @@
 
 #include <Serialization/TemporalAggregationSerde.hpp>
 
+#include <optional>
 #include <Configurations/Descriptor.hpp>
 #include <Functions/LogicalFunction.hpp>
 #include <Serialization/FunctionSerializationUtil.hpp>
@@ -25,7 +26,8 @@ SerializableAggregationFunction serializeTemporalSequence(
     const FieldAccessLogicalFunction& lon,
     const FieldAccessLogicalFunction& lat,
     const FieldAccessLogicalFunction& ts,
-    const FieldAccessLogicalFunction& asField)
+    const FieldAccessLogicalFunction& asField,
+    const std::optional<double> toleranceInMeters)
 {
     SerializableAggregationFunction saf;
     saf.set_type("TemporalSequence");
@@ -49,6 +51,11 @@ SerializableAggregationFunction serializeTemporalSequence(
     asProto.CopyFrom(LogicalFunction(asField).serialize());
     saf.mutable_as_field()->CopyFrom(asProto);
 
+    if (toleranceInMeters.has_value())
+    {
+        saf.set_tolerance(*toleranceInMeters);
+    }
+
     return saf;
 }
 
@@ -47,7 +47,12 @@ TimeMeasure SlidingWindow::getSlide()
 
 std::string SlidingWindow::toString() const
 {
-    return fmt::format("SlidingWindow: size={} slide={} timeCharacteristic={}", size.getTime(), slide.getTime(), timeCharacteristic);
+    return fmt::format(
+        "SlidingWindow: size={} slide={} timeCharacteristic={}{}",
+        size.getTime(),
+        slide.getTime(),
+        timeCharacteristic,
+        earlyFiringIntervalToString());
 }
 
 bool SlidingWindow::operator==(const WindowType& otherWindowType) const
@@ -55,7 +60,8 @@ bool SlidingWindow::operator==(const WindowType& otherWindowType) const
     if (const auto* otherSlidingWindow = dynamic_cast<const SlidingWindow*>(&otherWindowType))
     {
         return (this->size == otherSlidingWindow->size) && (this->slide == otherSlidingWindow->slide)
-            && (this->timeCharacteristic == (otherSlidingWindow->timeCharacteristic));
+            && (this->timeCharacteristic == (otherSlidingWindow->timeCharacteristic))
+            && (this->earlyFiringInterval == otherSlidingWindow->earlyFiringInterval);
     }
     return false;
 }
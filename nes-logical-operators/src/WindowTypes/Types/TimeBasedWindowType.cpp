@@ -14,9 +14,13 @@
 
 #include <WindowTypes/Types/TimeBasedWindowType.hpp>
 
+#include <optional>
+#include <string>
 #include <utility>
 #include <DataTypes/Schema.hpp>
 #include <WindowTypes/Measures/TimeCharacteristic.hpp>
+#include <WindowTypes/Measures/TimeMeasure.hpp>
+#include <fmt/format.h>
 #include <ErrorHandling.hpp>
 
 namespace NES::Windowing
@@ -55,4 +59,24 @@ TimeCharacteristic TimeBasedWindowType::getTimeCharacteristic() const
     return timeCharacteristic;
 }
 
+std::optional<TimeMeasure> TimeBasedWindowType::getEarlyFiringInterval() const
+{
+    return earlyFiringInterval;
+}
+
+void TimeBasedWindowType::setEarlyFiringInterval(TimeMeasure earlyFiringInterval)
+{
+    PRECONDITION(earlyFiringInterval.getTime() > 0, "The early firing interval must be greater than 0");
+    this->earlyFiringInterval.emplace(std::move(earlyFiringInterval));
+}
+
+std::string TimeBasedWindowType::earlyFiringIntervalToString() const
+{
+    if (earlyFiringInterval.has_value())
+    {
+        return fmt::format(" earlyFiringInterval={}", earlyFiringInterval->getTime());
+    }
+    return {};
+}
+
 }
@@ -41,14 +41,15 @@ TimeMeasure TumblingWindow::getSlide()
 
 std::string TumblingWindow::toString() const
 {
-    return fmt::format("TumblingWindow: size={} timeCharacteristic={}", size.getTime(), timeCharacteristic);
+    return fmt::format("TumblingWindow: size={} timeCharacteristic={}{}", size.getTime(), timeCharacteristic, earlyFiringIntervalToString());
 }
 
 bool TumblingWindow::operator==(const WindowType& otherWindowType) const
 {
     if (const auto* other = dynamic_cast<const TumblingWindow*>(&otherWindowType))
     {
-        return (this->size == other->size) && (this->timeCharacteristic == (other->timeCharacteristic));
+        return (this->size == other->size) && (this->timeCharacteristic == (other->timeCharacteristic))
+            && (this->earlyFiringInterval == other->earlyFiringInterval);
     }
     return false;
 }
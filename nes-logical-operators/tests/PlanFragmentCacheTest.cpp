@@ -0,0 +1,96 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Serialization/PlanFragmentCache.hpp>
+
+#include <cstdint>
+#include <string>
+#include <gtest/gtest.h>
+#include <Identifiers/Identifiers.hpp>
+#include <Operators/LogicalOperator.hpp>
+#include <Operators/Sinks/SinkLogicalOperator.hpp>
+#include <BaseUnitTest.hpp>
+#include <ErrorHandling.hpp>
+#include <SerializableOperator.pb.h>
+#include <SerializableQueryPlan.pb.h>
+
+using namespace NES;
+
+class PlanFragmentCacheTest : public ::testing::Test
+{
+protected:
+    static SerializableOperator serializeSink(const std::string& sinkName, const uint64_t operatorId, const uint64_t childId)
+    {
+        SerializableOperator serializedOperator;
+        LogicalOperator(SinkLogicalOperator(sinkName)).serialize(serializedOperator);
+        serializedOperator.set_operator_id(operatorId);
+        serializedOperator.add_children_ids(childId);
+        return serializedOperator;
+    }
+};
+
+TEST_F(PlanFragmentCacheTest, HashIgnoresIdAndChildren)
+{
+    EXPECT_EQ(PlanFragmentCache::hashFragment(serializeSink("sink", 1, 2)), PlanFragmentCache::hashFragment(serializeSink("sink", 5, 7)));
+    EXPECT_NE(PlanFragmentCache::hashFragment(serializeSink("sink", 1, 2)), PlanFragmentCache::hashFragment(serializeSink("other", 1, 2)));
+}
+
+TEST_F(PlanFragmentCacheTest, SendsEveryFragmentOnce)
+{
+    SentPlanFragments sentFragments;
+    SerializableQueryPlan firstPlan;
+    *firstPlan.add_operators() = serializeSink("sink", 1, 2);
+    sentFragments.compactPlan(firstPlan);
+    EXPECT_TRUE(firstPlan.operators(0).has_sink());
+    EXPECT_TRUE(firstPlan.operators(0).has_fragment_hash());
+
+    SerializableQueryPlan secondPlan;
+    *secondPlan.add_operators() = serializeSink("sink", 5, 7);
+    *secondPlan.add_operators() = serializeSink("other", 8, 9);
+    sentFragments.compactPlan(secondPlan);
+    EXPECT_EQ(secondPlan.operators(0).value_case(), SerializableOperator::VALUE_NOT_SET);
+    EXPECT_EQ(secondPlan.operators(0).operator_id(), 5);
+    EXPECT_EQ(secondPlan.operators(0).children_ids(0), 7);
+    EXPECT_EQ(secondPlan.operators(0).fragment_hash(), firstPlan.operators(0).fragment_hash());
+    EXPECT_TRUE(secondPlan.operators(1).has_sink());
+
+    sentFragments.clear();
+    SerializableQueryPlan thirdPlan;
+    *thirdPlan.add_operators() = serializeSink("sink", 10, 11);
+    sentFragments.compactPlan(thirdPlan);
+    EXPECT_TRUE(thirdPlan.operators(0).has_sink());
+}
+
+TEST_F(PlanFragmentCacheTest, ResolvesReferencedFragments)
+{
+    PlanFragmentCache fragmentCache;
+    SentPlanFragments sentFragments;
+
+    SerializableQueryPlan firstPlan;
+    *firstPlan.add_operators() = serializeSink("sink", 1, 2);
+    sentFragments.compactPlan(firstPlan);
+    EXPECT_EQ(fragmentCache.deserializeOperator(firstPlan.operators(0)).getId(), OperatorId(1));
+
+    SerializableQueryPlan secondPlan;
+    *secondPlan.add_operators() = serializeSink("sink", 5, 7);
+    sentFragments.compactPlan(secondPlan);
+    const auto resolved = fragmentCache.deserializeOperator(secondPlan.operators(0));
+    EXPECT_EQ(resolved.getId(), OperatorId(5));
+    ASSERT_TRUE(resolved.tryGetAs<SinkLogicalOperator>().has_value());
+    EXPECT_EQ(resolved.tryGetAs<SinkLogicalOperator>().value()->getSinkName(), "sink");
+
+    /// A worker, which evicted the fragment or never received it, rejects the reference
+    PlanFragmentCache emptyCache;
+    ASSERT_EXCEPTION_ERRORCODE(auto unused = emptyCache.deserializeOperator(secondPlan.operators(0)), ErrorCode::UnknownPlanFragment);
+}
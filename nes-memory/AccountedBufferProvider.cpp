@@ -0,0 +1,102 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Runtime/AccountedBufferProvider.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <Runtime/AbstractBufferProvider.hpp>
+#include <Runtime/MemoryAccount.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <ErrorHandling.hpp>
+
+namespace NES
+{
+
+AccountedBufferProvider::AccountedBufferProvider(
+    std::shared_ptr<AbstractBufferProvider> bufferProvider, std::shared_ptr<MemoryAccount> memoryAccount)
+    : bufferProvider(std::move(bufferProvider)), memoryAccount(std::move(memoryAccount))
+{
+    PRECONDITION(this->bufferProvider != nullptr, "The accounted buffer provider requires a buffer provider");
+    PRECONDITION(this->memoryAccount != nullptr, "The accounted buffer provider requires a memory account");
+}
+
+std::optional<TupleBuffer>
+AccountedBufferProvider::charge(std::optional<TupleBuffer> buffer, const MemoryAccount::Allocation allocation) const
+{
+    if (buffer.has_value() && not memoryAccount->tryCharge(*buffer, allocation))
+    {
+        throw QueryMemoryQuotaExceeded(
+            "Allocating {} bytes exceeds the quota of {} bytes, of which {} bytes are in use",
+            buffer->getBufferSize(),
+            memoryAccount->getQuotaInBytes(),
+            memoryAccount->getUsedBytes());
+    }
+    return buffer;
+}
+
+BufferManagerType AccountedBufferProvider::getBufferManagerType() const
+{
+    return bufferProvider->getBufferManagerType();
+}
+
+size_t AccountedBufferProvider::getBufferSize() const
+{
+    return bufferProvider->getBufferSize();
+}
+
+size_t AccountedBufferProvider::getNumOfPooledBuffers() const
+{
+    return bufferProvider->getNumOfPooledBuffers();
+}
+
+size_t AccountedBufferProvider::getNumOfUnpooledBuffers() const
+{
+    return bufferProvider->getNumOfUnpooledBuffers();
+}
+
+TupleBuffer AccountedBufferProvider::getBufferBlocking()
+{
+    return *charge(bufferProvider->getBufferBlocking(), MemoryAccount::Allocation::POOLED);
+}
+
+std::optional<TupleBuffer> AccountedBufferProvider::getBufferNoBlocking()
+{
+    return charge(bufferProvider->getBufferNoBlocking(), MemoryAccount::Allocation::POOLED);
+}
+
+std::optional<TupleBuffer> AccountedBufferProvider::getBufferWithTimeout(const std::chrono::milliseconds timeout_ms)
+{
+    return charge(bufferProvider->getBufferWithTimeout(timeout_ms), MemoryAccount::Allocation::POOLED);
+}
+
+std::optional<TupleBuffer> AccountedBufferProvider::getUnpooledBuffer(const size_t bufferSize)
+{
+    return charge(bufferProvider->getUnpooledBuffer(bufferSize), MemoryAccount::Allocation::UNPOOLED);
+}
+
+const std::shared_ptr<MemoryAccount>& AccountedBufferProvider::getMemoryAccount() const
+{
+    return memoryAccount;
+}
+
+const std::shared_ptr<AbstractBufferProvider>& AccountedBufferProvider::getBufferProvider() const
+{
+    return bufferProvider;
+}
+
+}
@@ -25,6 +25,7 @@
 #include <mutex>
 #include <optional>
 #include <utility>
+#include <vector>
 #include <unistd.h>
 #include <Runtime/AbstractBufferProvider.hpp>
 #include <Runtime/BufferRecycler.hpp>
@@ -42,8 +43,15 @@ BufferManager::BufferManager(
     const uint32_t bufferSize,
     const uint32_t numOfBuffers,
     std::shared_ptr<std::pmr::memory_resource> memoryResource,
-    const uint32_t withAlignment)
+    const uint32_t withAlignment,
+    const uint32_t bufferCacheSize,
+    std::vector<BufferSizeClass> sizeClasses)
     : availableBuffers(numOfBuffers)
+    , bufferCacheSize(std::min<size_t>(bufferCacheSize, MAX_BUFFER_CACHE_SIZE))
+    , bufferCacheBatchSize(std::max<size_t>(1, this->bufferCacheSize / 2))
+    /// Caches must never hold so many buffers that threads which are waiting for a buffer starve. We keep at least a quarter of the
+    /// pool in the shared queue before recycled buffers are cached again.
+    , bufferCacheLowWatermark(numOfBuffers / 4)
     , unpooledChunksManager(std::make_shared<UnpooledChunksManager>(memoryResource))
     , bufferSize(bufferSize)
     , numOfBuffers(numOfBuffers)
@@ -51,12 +59,39 @@ BufferManager::BufferManager(
 {
     ((void)withAlignment);
     initialize(DEFAULT_ALIGNMENT);
+    if (this->bufferCacheSize > 0)
+    {
+        bufferCaches = std::make_unique<std::array<BufferCache, NUMBER_OF_BUFFER_CACHES>>();
+    }
+
+    std::ranges::sort(sizeClasses, {}, &BufferSizeClass::bufferSize);
+    for (const auto& sizeClass : sizeClasses)
+    {
+        PRECONDITION(sizeClass.bufferSize > 0, "A buffer size class must not have a buffer size of zero");
+        PRECONDITION(
+            sizeClassPools.empty() || sizeClassPools.back()->getBufferSize() != sizeClass.bufferSize,
+            "Buffer size class {} is configured twice",
+            sizeClass.bufferSize);
+        if (sizeClass.numberOfBuffers == 0)
+        {
+            continue;
+        }
+        /// The size class pools share the memory resource but not the thread local caches of the BufferManager
+        sizeClassPools.emplace_back(
+            create(sizeClass.bufferSize, sizeClass.numberOfBuffers, this->memoryResource, DEFAULT_ALIGNMENT, 0, {}));
+    }
 }
 
 std::shared_ptr<BufferManager> BufferManager::create(
-    uint32_t bufferSize, uint32_t numOfBuffers, const std::shared_ptr<std::pmr::memory_resource>& memoryResource, uint32_t withAlignment)
+    uint32_t bufferSize,
+    uint32_t numOfBuffers,
+    const std::shared_ptr<std::pmr::memory_resource>& memoryResource,
+    uint32_t withAlignment,
+    uint32_t bufferCacheSize,
+    std::vector<BufferSizeClass> sizeClasses)
 {
-    return std::make_shared<BufferManager>(Private{}, bufferSize, numOfBuffers, memoryResource, withAlignment);
+    return std::make_shared<BufferManager>(
+        Private{}, bufferSize, numOfBuffers, memoryResource, withAlignment, bufferCacheSize, std::move(sizeClasses));
 }
 
 BufferManager::~BufferManager()
@@ -65,6 +100,13 @@ BufferManager::~BufferManager()
     NES_DEBUG("Calling BufferManager::destroy()");
     if (isDestroyed.compare_exchange_strong(expected, true))
     {
+        /// Cached buffers are available, but they have to be returned to the queue before the leak check can account for them.
+        reclaimCachedBuffers();
+        if (bufferCaches)
+        {
+            const auto [hits, misses] = getBufferCacheStatistics();
+            NES_DEBUG("BufferManager thread local buffer caches: {} hits, {} misses", hits, misses);
+        }
         bool success = true;
         if (allBuffers.size() != getNumberOfAvailableBuffers())
         {
@@ -90,12 +132,14 @@ BufferManager::~BufferManager()
         allBuffers.clear();
 
         availableBuffers = decltype(availableBuffers)();
+        bufferCaches.reset();
         NES_DEBUG("Shutting down Buffer Manager completed");
         memoryResource->deallocate(basePointer, allocatedAreaSize, DEFAULT_ALIGNMENT);
         allocatedAreaSize = 0;
 
-        /// Destroying the unpooled chunks
+        /// Destroying the unpooled chunks and the size class pools
         unpooledChunksManager.reset();
+        sizeClassPools.clear();
     }
 }
 
@@ -160,6 +204,112 @@ void BufferManager::initialize(uint32_t withAlignment)
     NES_DEBUG("BufferManager configuration bufferSize={} numOfBuffers={}", this->bufferSize, this->numOfBuffers);
 }
 
+BufferManager::BufferCache* BufferManager::getThreadLocalBufferCache()
+{
+    if (!bufferCaches)
+    {
+        return nullptr;
+    }
+    /// Every thread is assigned a cache index on its first access. The index is shared across all BufferManagers.
+    static std::atomic<size_t> nextBufferCacheIndex{0};
+    thread_local const size_t bufferCacheIndex = nextBufferCacheIndex.fetch_add(1, std::memory_order::relaxed) % NUMBER_OF_BUFFER_CACHES;
+    return &(*bufferCaches)[bufferCacheIndex];
+}
+
+TupleBuffer BufferManager::makeTupleBuffer(detail::MemorySegment* memSegment)
+{
+    if (memSegment->controlBlock->prepare(shared_from_this()))
+    {
+        return TupleBuffer(memSegment->controlBlock.get(), memSegment->ptr, memSegment->size);
+    }
+    throw InvalidRefCountForBuffer("[BufferManager] got buffer with invalid reference counter");
+}
+
+std::optional<TupleBuffer> BufferManager::getBufferFromCache()
+{
+    auto* cache = getThreadLocalBufferCache();
+    if (cache == nullptr)
+    {
+        return std::nullopt;
+    }
+
+    const std::scoped_lock lock(cache->mutex);
+    if (cache->size == 0)
+    {
+        /// Refill the magazine in a single batch. Reads from the shared queue are non-blocking, thus a partial refill is possible.
+        ++cache->misses;
+        detail::MemorySegment* memSegment = nullptr;
+        while (cache->size < bufferCacheBatchSize && availableBuffers.read(memSegment))
+        {
+            cache->segments[cache->size++] = memSegment;
+        }
+        if (cache->size == 0)
+        {
+            return std::nullopt;
+        }
+    }
+    else
+    {
+        ++cache->hits;
+    }
+    return makeTupleBuffer(cache->segments[--cache->size]);
+}
+
+bool BufferManager::recycleIntoCache(detail::MemorySegment* segment)
+{
+    auto* cache = getThreadLocalBufferCache();
+    if (cache == nullptr || availableBuffers.size() < static_cast<ssize_t>(bufferCacheLowWatermark))
+    {
+        return false;
+    }
+
+    const std::scoped_lock lock(cache->mutex);
+    if (cache->size == bufferCacheSize)
+    {
+        /// Drain half of the magazine into the shared queue to make room for the recycled buffer
+        while (cache->size > bufferCacheSize - bufferCacheBatchSize)
+        {
+            USED_IN_DEBUG const auto couldRecycleBuffer = availableBuffers.writeIfNotFull(cache->segments[--cache->size]);
+            INVARIANT(couldRecycleBuffer, "should always succeed");
+        }
+    }
+    cache->segments[cache->size++] = segment;
+    return true;
+}
+
+void BufferManager::reclaimCachedBuffers()
+{
+    if (!bufferCaches)
+    {
+        return;
+    }
+    for (auto& cache : *bufferCaches)
+    {
+        const std::scoped_lock lock(cache.mutex);
+        while (cache.size > 0)
+        {
+            USED_IN_DEBUG const auto couldRecycleBuffer = availableBuffers.writeIfNotFull(cache.segments[--cache.size]);
+            INVARIANT(couldRecycleBuffer, "should always succeed");
+        }
+    }
+}
+
+BufferCacheStatistics BufferManager::getBufferCacheStatistics() const
+{
+    BufferCacheStatistics statistics;
+    if (!bufferCaches)
+    {
+        return statistics;
+    }
+    for (const auto& cache : *bufferCaches)
+    {
+        const std::scoped_lock lock(cache.mutex);
+        statistics.hits += cache.hits;
+        statistics.misses += cache.misses;
+    }
+    return statistics;
+}
+
 TupleBuffer BufferManager::getBufferBlocking()
 {
     auto buffer = getBufferWithTimeout(GET_BUFFER_TIMEOUT);
@@ -173,35 +323,59 @@ TupleBuffer BufferManager::getBufferBlocking()
 
 std::optional<TupleBuffer> BufferManager::getBufferNoBlocking()
 {
-    detail::MemorySegment* memSegment = nullptr;
-    if (!availableBuffers.read(memSegment))
+    if (auto buffer = getBufferFromCache())
     {
-        return std::nullopt;
+        return buffer;
     }
-    if (memSegment->controlBlock->prepare(shared_from_this()))
+    detail::MemorySegment* memSegment = nullptr;
+    if (!availableBuffers.read(memSegment))
     {
-        return TupleBuffer(memSegment->controlBlock.get(), memSegment->ptr, memSegment->size);
+        if (!bufferCaches)
+        {
+            return std::nullopt;
+        }
+        /// The remaining free buffers might reside in the caches of other threads
+        reclaimCachedBuffers();
+        if (!availableBuffers.read(memSegment))
+        {
+            return std::nullopt;
+        }
     }
-    throw InvalidRefCountForBuffer("[BufferManager] got buffer with invalid reference counter");
+    return makeTupleBuffer(memSegment);
 }
 
 std::optional<TupleBuffer> BufferManager::getBufferWithTimeout(const std::chrono::milliseconds timeoutMs)
 {
+    if (auto buffer = getBufferFromCache())
+    {
+        return buffer;
+    }
     detail::MemorySegment* memSegment = nullptr;
     const auto deadline = std::chrono::steady_clock::now() + timeoutMs;
-    if (!availableBuffers.tryReadUntil(deadline, memSegment))
+    if (bufferCaches)
     {
-        return std::nullopt;
+        /// Buffers which are recycled while the pool is under pressure bypass the caches. However, buffers which have been cached before
+        /// the pool ran low have to be reclaimed, otherwise this thread could wait for buffers that are idle in other caches.
+        reclaimCachedBuffers();
     }
-    if (memSegment->controlBlock->prepare(shared_from_this()))
+    if (!availableBuffers.tryReadUntil(deadline, memSegment))
     {
-        return TupleBuffer(memSegment->controlBlock.get(), memSegment->ptr, memSegment->size);
+        return std::nullopt;
     }
-    throw InvalidRefCountForBuffer("[BufferManager] got buffer with invalid reference counter");
+    return makeTupleBuffer(memSegment);
 }
 
 std::optional<TupleBuffer> BufferManager::getUnpooledBuffer(const size_t bufferSize)
 {
+    /// Only the smallest fitting size class is asked. Falling through to larger size classes would let small requests drain them.
+    const auto sizeClass = std::ranges::find_if(sizeClassPools, [bufferSize](const auto& pool) { return pool->getBufferSize() >= bufferSize; });
+    if (sizeClass != sizeClassPools.end())
+    {
+        if (auto buffer = (*sizeClass)->getBufferNoBlocking())
+        {
+            return buffer;
+        }
+    }
     return unpooledChunksManager->getUnpooledBuffer(bufferSize, DEFAULT_ALIGNMENT, shared_from_this());
 }
 
@@ -210,6 +384,10 @@ void BufferManager::recyclePooledBuffer(detail::MemorySegment* segment)
     INVARIANT(segment->isAvailable(), "Recycling buffer callback invoked on used memory segment");
     INVARIANT(
         segment->controlBlock->owningBufferRecycler == nullptr, "Buffer should not retain a reference to its parent while not in use");
+    if (recycleIntoCache(segment))
+    {
+        return;
+    }
     USED_IN_DEBUG const auto couldRecycleBuffer = availableBuffers.writeIfNotFull(segment);
     INVARIANT(couldRecycleBuffer, "should always succeed");
 }
@@ -237,7 +415,27 @@ size_t BufferManager::getNumOfUnpooledBuffers() const
 size_t BufferManager::getNumberOfAvailableBuffers() const
 {
     /// If there are pending reads the queue may report negative values. This effectivly means its empty.
-    return static_cast<size_t>(std::max(availableBuffers.size(), static_cast<ssize_t>(0)));
+    auto numberOfAvailableBuffers = static_cast<size_t>(std::max(availableBuffers.size(), static_cast<ssize_t>(0)));
+    if (bufferCaches)
+    {
+        for (const auto& cache : *bufferCaches)
+        {
+            const std::scoped_lock lock(cache.mutex);
+            numberOfAvailableBuffers += cache.size;
+        }
+    }
+    return numberOfAvailableBuffers;
+}
+
+std::vector<BufferSizeClassOccupancy> BufferManager::getSizeClassOccupancy() const
+{
+    std::vector<BufferSizeClassOccupancy> occupancy;
+    occupancy.reserve(sizeClassPools.size());
+    for (const auto& pool : sizeClassPools)
+    {
+        occupancy.emplace_back(pool->getBufferSize(), pool->getNumOfPooledBuffers(), pool->getNumberOfAvailableBuffers());
+    }
+    return occupancy;
 }
 
 BufferManagerType BufferManager::getBufferManagerType() const
@@ -0,0 +1,126 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Runtime/MemoryAccount.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <Runtime/TupleBuffer.hpp>
+#include <ErrorHandling.hpp>
+#include <TupleBufferImpl.hpp>
+
+namespace NES
+{
+
+namespace
+{
+void raisePeak(std::atomic<uint64_t>& peak, const uint64_t value)
+{
+    auto current = peak.load(std::memory_order_relaxed);
+    while (current < value && not peak.compare_exchange_weak(current, value, std::memory_order_relaxed))
+    {
+    }
+}
+}
+
+MemoryAccount::MemoryAccount(const uint64_t quotaInBytes, std::shared_ptr<MemoryAccount> parent)
+    : parent(std::move(parent)), quotaInBytes(quotaInBytes)
+{
+}
+
+bool MemoryAccount::tryCharge(const TupleBuffer& buffer, const Allocation allocation)
+{
+    auto* controlBlock = buffer.getControlBlock();
+    PRECONDITION(controlBlock != nullptr, "Cannot charge an invalid buffer");
+    PRECONDITION(controlBlock->memoryAccount == nullptr, "The buffer is already charged to an account");
+
+    const uint64_t numberOfBytes = buffer.getBufferSize();
+    if (not tryReserve(numberOfBytes, allocation))
+    {
+        return false;
+    }
+    /// The buffer manager hands out buffers with a single reference, thus no other thread releases the buffer concurrently
+    controlBlock->memoryAccount = shared_from_this();
+    controlBlock->numberOfChargedBytes = numberOfBytes;
+    controlBlock->isChargedAsUnpooled = allocation == Allocation::UNPOOLED;
+    return true;
+}
+
+bool MemoryAccount::tryReserve(const uint64_t numberOfBytes, const Allocation allocation)
+{
+    const auto used = usedBytes.fetch_add(numberOfBytes, std::memory_order_relaxed) + numberOfBytes;
+    if ((quotaInBytes != 0 && used > quotaInBytes) || (parent && not parent->tryReserve(numberOfBytes, allocation)))
+    {
+        usedBytes.fetch_sub(numberOfBytes, std::memory_order_relaxed);
+        return false;
+    }
+
+    raisePeak(peakBytes, used);
+    if (allocation == Allocation::UNPOOLED)
+    {
+        raisePeak(peakNumberOfUnpooledBuffers, numberOfUnpooledBuffers.fetch_add(1, std::memory_order_relaxed) + 1);
+    }
+    else
+    {
+        raisePeak(peakNumberOfPooledBuffers, numberOfPooledBuffers.fetch_add(1, std::memory_order_relaxed) + 1);
+    }
+    return true;
+}
+
+void MemoryAccount::release(const uint64_t numberOfBytes, const Allocation allocation)
+{
+    [[maybe_unused]] const auto previous = usedBytes.fetch_sub(numberOfBytes, std::memory_order_relaxed);
+    INVARIANT(previous >= numberOfBytes, "Released {} bytes, but solely {} bytes are charged", numberOfBytes, previous);
+    auto& numberOfBuffers = allocation == Allocation::UNPOOLED ? numberOfUnpooledBuffers : numberOfPooledBuffers;
+    numberOfBuffers.fetch_sub(1, std::memory_order_relaxed);
+    if (parent)
+    {
+        parent->release(numberOfBytes, allocation);
+    }
+}
+
+uint64_t MemoryAccount::getUsedBytes() const
+{
+    return usedBytes.load(std::memory_order_relaxed);
+}
+
+uint64_t MemoryAccount::getPeakBytes() const
+{
+    return peakBytes.load(std::memory_order_relaxed);
+}
+
+uint64_t MemoryAccount::getQuotaInBytes() const
+{
+    return quotaInBytes;
+}
+
+MemoryAccount::Usage MemoryAccount::getUsage() const
+{
+    return {
+        .bytes = usedBytes.load(std::memory_order_relaxed),
+        .numberOfPooledBuffers = numberOfPooledBuffers.load(std::memory_order_relaxed),
+        .numberOfUnpooledBuffers = numberOfUnpooledBuffers.load(std::memory_order_relaxed)};
+}
+
+MemoryAccount::Usage MemoryAccount::getPeakUsage() const
+{
+    return {
+        .bytes = peakBytes.load(std::memory_order_relaxed),
+        .numberOfPooledBuffers = peakNumberOfPooledBuffers.load(std::memory_order_relaxed),
+        .numberOfUnpooledBuffers = peakNumberOfUnpooledBuffers.load(std::memory_order_relaxed)};
+}
+
+}
@@ -27,6 +27,7 @@
 #include <vector>
 #include <DataTypes/DataType.hpp>
 #include <DataTypes/Schema.hpp>
+#include <MemoryLayout/VarSizedDictionary.hpp>
 #include <MemoryLayout/VariableSizedAccess.hpp>
 #include <Runtime/AbstractBufferProvider.hpp>
 #include <Runtime/TupleBuffer.hpp>
@@ -131,6 +132,11 @@ template VariableSizedAccess MemoryLayout::writeVarSized<MemoryLayout::PrependMo
 std::span<std::byte>
 MemoryLayout::loadAssociatedVarSizedValue(const TupleBuffer& tupleBuffer, const VariableSizedAccess variableSizedAccess)
 {
+    if (variableSizedAccess.isDictionaryEncoded())
+    {
+        return VarSizedDictionary::instance().decode(variableSizedAccess);
+    }
+
     /// Loading the childbuffer containing the variable sized data.
     auto childBuffer = tupleBuffer.loadChildBuffer(variableSizedAccess.getIndex());
 
@@ -156,6 +162,50 @@ std::string MemoryLayout::readVarSizedDataAsString(const TupleBuffer& tupleBuffe
     return std::string{strPtrContent, stringSize};
 }
 
+void MemoryLayout::writeVarSizedField(
+    TupleBuffer& tupleBuffer,
+    AbstractBufferProvider& bufferProvider,
+    const VarSizedField field,
+    const std::span<const std::byte> varSizedValue)
+{
+    if (varSizedValue.size() <= VariableSizedAccess::INLINE_CAPACITY)
+    {
+        /// Short var sized data is stored inline, i.e., the length in the lower 32 bits and the content in the upper 32 bits of the field
+        const auto varSizedLength = static_cast<uint32_t>(varSizedValue.size());
+        std::ranges::fill(field, std::byte{0});
+        std::ranges::copy(std::as_bytes(std::span{&varSizedLength, 1}), field.begin());
+        std::ranges::copy(varSizedValue, field.begin() + sizeof(uint32_t));
+        return;
+    }
+    const auto variableSizedAccess = writeVarSized<PREPEND_LENGTH_AS_UINT32>(tupleBuffer, bufferProvider, varSizedValue);
+    const auto combinedIdxOffset = variableSizedAccess.getCombinedIdxOffset();
+    std::ranges::copy(std::as_bytes(std::span{&combinedIdxOffset, 1}), field.begin());
+}
+
+std::span<const std::byte> MemoryLayout::loadVarSizedField(const TupleBuffer& tupleBuffer, const ConstVarSizedField field)
+{
+    alignas(VariableSizedAccess::CombinedIndex) std::array<std::byte, sizeof(VariableSizedAccess::CombinedIndex)> fieldBuffer{};
+    std::ranges::copy(field, fieldBuffer.begin());
+    const auto combinedIdxOffset = std::bit_cast<VariableSizedAccess::CombinedIndex>(fieldBuffer);
+    if (VariableSizedAccess::isInlined(combinedIdxOffset))
+    {
+        const auto varSizedLength = static_cast<uint32_t>(combinedIdxOffset);
+        INVARIANT(
+            varSizedLength <= VariableSizedAccess::INLINE_CAPACITY,
+            "Inlined var sized data of length {} exceeds the inline capacity {}",
+            varSizedLength,
+            VariableSizedAccess::INLINE_CAPACITY);
+        return field.subspan(0, varSizedLength + sizeof(uint32_t));
+    }
+    return loadAssociatedVarSizedValue(tupleBuffer, VariableSizedAccess{combinedIdxOffset});
+}
+
+std::string MemoryLayout::readVarSizedFieldAsString(const TupleBuffer& tupleBuffer, const ConstVarSizedField field)
+{
+    const auto strWithSize = loadVarSizedField(tupleBuffer, field).subspan(sizeof(uint32_t));
+    return std::string{reinterpret_cast<const char*>(strWithSize.data()), strWithSize.size()};
+}
+
 uint64_t MemoryLayout::getTupleSize() const
 {
     return recordSize;
@@ -228,4 +278,9 @@ void MemoryLayout::setKeyFieldNames(const std::vector<std::string>& keyFields)
         keyFieldNames.emplace_back(field);
     }
 }
+
+void MemoryLayout::optimizeFieldPlacement(const std::vector<std::string>&)
+{
+    /// The fields of a tuple are adjacent solely in interleaved layouts, e.g., the row layout
+}
 }
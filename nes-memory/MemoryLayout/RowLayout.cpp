@@ -13,10 +13,14 @@
 */
 #include <MemoryLayout/RowLayout.hpp>
 
+#include <algorithm>
+#include <bit>
 #include <cstdint>
 #include <memory>
+#include <numeric>
 #include <string>
 #include <utility>
+#include <vector>
 #include <DataTypes/Schema.hpp>
 #include <MemoryLayout/MemoryLayout.hpp>
 #include <Util/Logger/Logger.hpp>
@@ -24,6 +28,23 @@
 
 namespace NES
 {
+namespace
+{
+/// Fields are aligned to their size, if it is a power of two, up to the alignment of 64-bit values
+uint64_t fieldAlignment(const uint64_t fieldSize)
+{
+    if (not std::has_single_bit(fieldSize))
+    {
+        return 1;
+    }
+    return std::min<uint64_t>(fieldSize, alignof(uint64_t));
+}
+
+uint64_t alignUp(const uint64_t offset, const uint64_t alignment)
+{
+    return (offset + alignment - 1) / alignment * alignment;
+}
+}
 
 RowLayout::RowLayout(const uint64_t bufferSize, Schema schema) : MemoryLayout(bufferSize, std::move(schema))
 {
@@ -36,7 +57,7 @@ RowLayout::RowLayout(const uint64_t bufferSize, Schema schema) : MemoryLayout(bu
 }
 
 RowLayout::RowLayout(const RowLayout& other)
-    : MemoryLayout(other.bufferSize, other.schema), fieldOffSets(other.fieldOffSets) /// NOLINT(*-copy-constructor-init)
+    : MemoryLayout(other), fieldOffSets(other.fieldOffSets)
 {
 }
 
@@ -76,4 +97,44 @@ uint64_t RowLayout::getFieldOffset(const uint64_t tupleIndex, const uint64_t fie
     return offSet;
 }
 
+void RowLayout::optimizeFieldPlacement(const std::vector<std::string>& hotFieldNames)
+{
+    std::vector<bool> isHot(physicalFieldSizes.size(), false);
+    for (const auto& hotFieldName : hotFieldNames)
+    {
+        if (const auto fieldIndex = getFieldIndexFromName(hotFieldName); fieldIndex.has_value())
+        {
+            isHot[*fieldIndex] = true;
+        }
+    }
+
+    std::vector<uint64_t> placementOrder(physicalFieldSizes.size());
+    std::iota(placementOrder.begin(), placementOrder.end(), 0);
+    std::ranges::stable_sort(
+        placementOrder,
+        [&](const uint64_t lhs, const uint64_t rhs)
+        {
+            if (isHot[lhs] != isHot[rhs])
+            {
+                return static_cast<bool>(isHot[lhs]);
+            }
+            return fieldAlignment(physicalFieldSizes[lhs]) > fieldAlignment(physicalFieldSizes[rhs]);
+        });
+
+    uint64_t offsetCounter = 0;
+    uint64_t tupleAlignment = 1;
+    for (const auto fieldIndex : placementOrder)
+    {
+        const auto alignment = fieldAlignment(physicalFieldSizes[fieldIndex]);
+        offsetCounter = alignUp(offsetCounter, alignment);
+        fieldOffSets[fieldIndex] = offsetCounter;
+        offsetCounter += physicalFieldSizes[fieldIndex];
+        tupleAlignment = std::max(tupleAlignment, alignment);
+    }
+
+    /// Padding the tuple to its largest alignment keeps the fields of all subsequent tuples aligned
+    recordSize = alignUp(offsetCounter, tupleAlignment);
+    capacity = recordSize > 0 ? bufferSize / recordSize : 0;
+}
+
 }
@@ -0,0 +1,101 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <MemoryLayout/VarSizedDictionary.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <span>
+#include <string_view>
+#include <MemoryLayout/VariableSizedAccess.hpp>
+#include <ErrorHandling.hpp>
+
+namespace NES
+{
+
+VarSizedDictionary::VarSizedDictionary() : entries(std::make_unique<std::unique_ptr<std::byte[]>[]>(MAX_NUMBER_OF_ENTRIES))
+{
+}
+
+VarSizedDictionary& VarSizedDictionary::instance()
+{
+    static VarSizedDictionary dictionary;
+    return dictionary;
+}
+
+std::optional<VariableSizedAccess> VarSizedDictionary::encode(const std::span<const std::byte> varSizedValue)
+{
+    if (varSizedValue.size() > MAX_ENTRY_SIZE)
+    {
+        return std::nullopt;
+    }
+    const std::string_view value{reinterpret_cast<const char*>(varSizedValue.data()), varSizedValue.size()};
+    const auto toAccess = [](const uint32_t code)
+    { return VariableSizedAccess{VariableSizedAccess::Index{VariableSizedAccess::DICTIONARY_INDEX}, VariableSizedAccess::Offset{code}}; };
+
+    /// Low-cardinality fields mostly contain known values, thus, we first look the value up without blocking the other formatters
+    {
+        const std::shared_lock lock(codesMutex);
+        if (const auto code = codes.find(value); code != codes.end())
+        {
+            return toAccess(code->second);
+        }
+    }
+
+    const std::unique_lock lock(codesMutex);
+    if (const auto code = codes.find(value); code != codes.end())
+    {
+        return toAccess(code->second);
+    }
+    const auto code = numberOfEntries.load(std::memory_order::relaxed);
+    if (code >= MAX_NUMBER_OF_ENTRIES)
+    {
+        return std::nullopt;
+    }
+
+    /// An entry stores the length in the first 32 bits, followed by the content, as any other var sized data
+    const auto varSizedLength = static_cast<uint32_t>(varSizedValue.size());
+    auto entry = std::make_unique<std::byte[]>(sizeof(uint32_t) + varSizedValue.size());
+    std::ranges::copy(std::as_bytes(std::span{&varSizedLength, 1}), entry.get());
+    std::ranges::copy(varSizedValue, entry.get() + sizeof(uint32_t));
+    const std::string_view entryContent{reinterpret_cast<const char*>(entry.get() + sizeof(uint32_t)), varSizedValue.size()};
+
+    entries[code] = std::move(entry);
+    codes.emplace(entryContent, static_cast<uint32_t>(code));
+    numberOfEntries.store(code + 1, std::memory_order::release);
+    return toAccess(static_cast<uint32_t>(code));
+}
+
+std::span<std::byte> VarSizedDictionary::decode(const VariableSizedAccess variableSizedAccess) const
+{
+    PRECONDITION(variableSizedAccess.isDictionaryEncoded(), "{} does not reference the dictionary", variableSizedAccess);
+    const auto code = variableSizedAccess.getOffset().getRawOffset();
+    PRECONDITION(code < numberOfEntries.load(std::memory_order::acquire), "The dictionary does not contain the code {}", code);
+    std::byte* const entry = entries[code].get();
+    uint32_t varSizedLength = 0;
+    std::ranges::copy(std::span{entry, sizeof(uint32_t)}, std::as_writable_bytes(std::span{&varSizedLength, 1}).begin());
+    return {entry, sizeof(uint32_t) + varSizedLength};
+}
+
+size_t VarSizedDictionary::getNumberOfEntries() const
+{
+    return numberOfEntries.load(std::memory_order::acquire);
+}
+
+}
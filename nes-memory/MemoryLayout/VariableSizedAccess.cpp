@@ -46,24 +46,24 @@ operator%(const VariableSizedAccess::Index& index, const VariableSizedAccess::In
     return index.index % other;
 }
 
-VariableSizedAccess::Offset::Offset(const uint64_t offset) : offset(offset)
+VariableSizedAccess::Offset::Offset(const uint64_t offset) : offset(static_cast<Underlying>(offset | REFERENCE_BIT))
 {
     PRECONDITION(offset < (1UL << UnderlyingBits), "Currently we only support {} ({}bit) offsets", (1UL << UnderlyingBits), UnderlyingBits);
 }
 
 VariableSizedAccess::Offset VariableSizedAccess::Offset::convertToOffset(const CombinedIndex combinedIdxOffset)
 {
-    return Offset{static_cast<uint32_t>(combinedIdxOffset & 0xffffffffUL)};
+    return Offset{static_cast<uint32_t>(combinedIdxOffset & 0xffffffffUL & ~REFERENCE_BIT)};
 }
 
 VariableSizedAccess::Offset::Underlying VariableSizedAccess::Offset::getRawOffset() const
 {
-    return offset;
+    return static_cast<Underlying>(offset & ~REFERENCE_BIT);
 }
 
 std::ostream& operator<<(std::ostream& os, const VariableSizedAccess::Offset& offset)
 {
-    return os << offset.offset;
+    return os << offset.getRawOffset();
 }
 
 }
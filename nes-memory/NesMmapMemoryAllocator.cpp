@@ -0,0 +1,167 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Runtime/Allocator/NesMmapMemoryAllocator.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+#include <sched.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <Util/Logger/Logger.hpp>
+#include <ErrorHandling.hpp>
+
+namespace NES
+{
+
+namespace
+{
+/// Rounding all mappings to the huge page size keeps the length passed to munmap independent of whether the allocation was
+/// actually backed by huge pages.
+size_t mappingSize(const size_t bytes)
+{
+    return (bytes + NesMmapMemoryAllocator::HUGE_PAGE_SIZE - 1) / NesMmapMemoryAllocator::HUGE_PAGE_SIZE
+        * NesMmapMemoryAllocator::HUGE_PAGE_SIZE;
+}
+
+bool isMapped(const size_t bytes)
+{
+    return bytes >= NesMmapMemoryAllocator::HUGE_PAGE_SIZE;
+}
+
+/// Spawning a thread only pays off if it faults in at least this many bytes
+constexpr size_t MIN_PREFAULT_BYTES_PER_THREAD = 256 * 1024 * 1024;
+
+size_t numberOfAllowedCpus()
+{
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    if (sched_getaffinity(0, sizeof(cpu_set_t), &cpuSet) == 0)
+    {
+        return std::max(1, CPU_COUNT(&cpuSet));
+    }
+    return std::max(1U, std::thread::hardware_concurrency());
+}
+
+/// Faults in every page of the mapping by writing to it. Faulting in a large buffer pool on a single thread, e.g., via MAP_POPULATE,
+/// dominates the startup of the worker, thus the mapping is split across threads. The threads inherit the CPU affinity of the calling
+/// thread, which keeps the first touch on the NUMA node of a NUMA local buffer manager.
+void prefault(void* memory, const size_t size, const size_t pageSize)
+{
+    const auto numberOfPages = size / pageSize;
+    const auto numberOfThreads = std::clamp<size_t>(size / MIN_PREFAULT_BYTES_PER_THREAD, 1, numberOfAllowedCpus());
+    auto faultIn = [memory, pageSize](const size_t firstPage, const size_t endPage)
+    {
+        auto* bytes = static_cast<volatile char*>(memory);
+        for (size_t page = firstPage; page < endPage; ++page)
+        {
+            bytes[page * pageSize] = 0;
+        }
+    };
+    if (numberOfThreads == 1)
+    {
+        faultIn(0, numberOfPages);
+        return;
+    }
+
+    const auto pagesPerThread = (numberOfPages + numberOfThreads - 1) / numberOfThreads;
+    std::vector<std::jthread> threads;
+    threads.reserve(numberOfThreads);
+    for (size_t firstPage = 0; firstPage < numberOfPages; firstPage += pagesPerThread)
+    {
+        threads.emplace_back(faultIn, firstPage, std::min(firstPage + pagesPerThread, numberOfPages));
+    }
+}
+}
+
+NesMmapMemoryAllocator::NesMmapMemoryAllocator(const HugePagePolicy hugePagePolicy, const bool lockMemory)
+    : hugePagePolicy(hugePagePolicy), lockMemory(lockMemory)
+{
+}
+
+void* NesMmapMemoryAllocator::do_allocate(const size_t bytes, const size_t alignment)
+{
+    if (!isMapped(bytes))
+    {
+        void* tmp = nullptr;
+        auto ret = posix_memalign(&tmp, alignment, bytes);
+        INVARIANT(ret == 0, "memory allocation failed with alignment");
+        return tmp;
+    }
+
+    PRECONDITION(
+        alignment <= static_cast<size_t>(sysconf(_SC_PAGE_SIZE)),
+        "The mmap allocator only supports alignments up to the page size, but got {}",
+        alignment);
+
+    const auto size = mappingSize(bytes);
+    constexpr auto protection = PROT_READ | PROT_WRITE;
+    constexpr auto flags = MAP_PRIVATE | MAP_ANONYMOUS;
+
+    void* memory = MAP_FAILED;
+    if (hugePagePolicy == HugePagePolicy::EXPLICIT)
+    {
+        memory = mmap(nullptr, size, protection, flags | MAP_HUGETLB, -1, 0);
+        if (memory == MAP_FAILED)
+        {
+            NES_WARNING(
+                "Could not map {} bytes backed by huge pages: {}. Falling back to transparent huge pages.", size, std::strerror(errno));
+        }
+        else
+        {
+            prefault(memory, size, NesMmapMemoryAllocator::HUGE_PAGE_SIZE);
+        }
+    }
+
+    if (memory == MAP_FAILED)
+    {
+        memory = mmap(nullptr, size, protection, flags, -1, 0);
+        INVARIANT(memory != MAP_FAILED, "Could not map {} bytes: {}", size, std::strerror(errno));
+        /// Transparent huge pages have to be requested before the memory is faulted in
+        if (hugePagePolicy != HugePagePolicy::NONE && madvise(memory, size, MADV_HUGEPAGE) != 0)
+        {
+            NES_WARNING("Transparent huge pages are not available: {}", std::strerror(errno));
+        }
+        prefault(memory, size, static_cast<size_t>(sysconf(_SC_PAGE_SIZE)));
+    }
+
+    if (lockMemory && mlock(memory, size) != 0)
+    {
+        NES_WARNING("Could not lock {} bytes of memory: {}", size, std::strerror(errno));
+    }
+    return memory;
+}
+
+void NesMmapMemoryAllocator::do_deallocate(void* p, const size_t bytes, size_t)
+{
+    if (!isMapped(bytes))
+    {
+        std::free(p); /// NOLINT(cppcoreguidelines-no-malloc)
+        return;
+    }
+
+    const auto size = mappingSize(bytes);
+    if (lockMemory)
+    {
+        munlock(p, size);
+    }
+    munmap(p, size);
+}
+
+}
@@ -76,17 +76,16 @@ DynamicTuple::DynamicTuple(const uint64_t tupleIndex, std::shared_ptr<MemoryLayo
 void DynamicTuple::writeVarSized(
     std::variant<const uint64_t, const std::string> field, std::string_view value, AbstractBufferProvider& bufferProvider)
 {
-    auto combinedIdxOffset
-        = MemoryLayout::writeVarSized<MemoryLayout::PREPEND_LENGTH_AS_UINT32>(buffer, bufferProvider, std::as_bytes(std::span{value}));
     std::visit(
-        [this, combinedIdxOffset](const auto& key)
+        [this, &value, &bufferProvider](const auto& key)
         {
             if constexpr (
                 std::is_convertible_v<std::decay_t<decltype(key)>, std::size_t>
                 || std::is_convertible_v<std::decay_t<decltype(key)>, std::string>)
             {
-                *reinterpret_cast<uint64_t*>(const_cast<uint8_t*>((*this)[key].getMemory().data()))
-                    = combinedIdxOffset.getCombinedIdxOffset();
+                auto* const fieldMemory = reinterpret_cast<std::byte*>(const_cast<uint8_t*>((*this)[key].getMemory().data()));
+                const MemoryLayout::VarSizedField field{fieldMemory, sizeof(VariableSizedAccess)};
+                MemoryLayout::writeVarSizedField(buffer, bufferProvider, field, std::as_bytes(std::span{value}));
             }
             else
             {
@@ -106,8 +105,8 @@ std::string DynamicTuple::readVarSized(std::variant<const uint64_t, const std::s
                 std::is_convertible_v<std::decay_t<decltype(key)>, std::size_t>
                 || std::is_convertible_v<std::decay_t<decltype(key)>, std::string>)
             {
-                const VariableSizedAccess index{(*this)[key].template read<uint64_t>()};
-                return MemoryLayout::readVarSizedDataAsString(this->buffer, index);
+                const auto field = std::as_bytes((*this)[key].getMemory()).template first<sizeof(VariableSizedAccess)>();
+                return MemoryLayout::readVarSizedFieldAsString(this->buffer, field);
             }
             else
             {
@@ -173,10 +172,10 @@ bool DynamicTuple::operator==(const DynamicTuple& other) const
 
             if (field.dataType.isType(DataType::Type::VARSIZED))
             {
-                const VariableSizedAccess thisVarSizedAccess{thisDynamicField.template read<VariableSizedAccess::CombinedIndex>()};
-                const VariableSizedAccess otherVarSizedAccess{otherDynamicField.template read<VariableSizedAccess::CombinedIndex>()};
-                const auto thisString = MemoryLayout::readVarSizedDataAsString(buffer, thisVarSizedAccess);
-                const auto otherString = MemoryLayout::readVarSizedDataAsString(other.buffer, otherVarSizedAccess);
+                const auto thisField = std::as_bytes(thisDynamicField.getMemory()).template first<sizeof(VariableSizedAccess)>();
+                const auto otherField = std::as_bytes(otherDynamicField.getMemory()).template first<sizeof(VariableSizedAccess)>();
+                const auto thisString = MemoryLayout::readVarSizedFieldAsString(buffer, thisField);
+                const auto otherString = MemoryLayout::readVarSizedFieldAsString(other.buffer, otherField);
                 return thisString == otherString;
             }
             return thisDynamicField == otherDynamicField;
@@ -14,7 +14,9 @@
 
 #include <Runtime/TupleBuffer.hpp>
 
+#include <algorithm>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <ostream>
 #include <string>
@@ -30,6 +32,26 @@
 namespace NES
 {
 
+TupleBuffer TupleBuffer::wrapMemory(uint8_t* ptr, const uint32_t size, std::function<void()> onRelease)
+{
+    /// The control block of a wrapped segment owns the recycle callback, thus the callback must not access its captures after deleting it
+    auto* memorySegment = new detail::MemorySegment(
+        ptr,
+        size,
+        [onRelease = std::move(onRelease)](detail::MemorySegment* segment, BufferRecycler*) mutable
+        {
+            const auto release = std::move(onRelease);
+            delete segment;
+            release();
+        });
+    if (memorySegment->controlBlock->prepare(nullptr))
+    {
+        return TupleBuffer(memorySegment->controlBlock.get(), memorySegment->ptr, size);
+    }
+    delete memorySegment;
+    throw InvalidRefCountForBuffer("[TupleBuffer] wrapped memory with invalid reference counter");
+}
+
 TupleBuffer::TupleBuffer(const TupleBuffer& other) noexcept : controlBlock(other.controlBlock), ptr(other.ptr), size(other.size)
 {
     if (controlBlock != nullptr)
@@ -134,6 +156,11 @@ Timestamp TupleBuffer::getCreationTimestampInMS() const noexcept
     return controlBlock->getCreationTimestamp();
 }
 
+Timestamp TupleBuffer::getLatestCreationTimestampInMS() const noexcept
+{
+    return std::max(controlBlock->getLatestCreationTimestamp(), controlBlock->getCreationTimestamp());
+}
+
 void TupleBuffer::setSequenceNumber(const SequenceNumber sequenceNumber) noexcept
 {
     controlBlock->setSequenceNumber(sequenceNumber);
@@ -169,6 +196,11 @@ void TupleBuffer::setCreationTimestampInMS(const Timestamp value) noexcept
     controlBlock->setCreationTimestamp(value);
 }
 
+void TupleBuffer::setLatestCreationTimestampInMS(const Timestamp value) noexcept
+{
+    controlBlock->setLatestCreationTimestamp(value);
+}
+
 void TupleBuffer::setOriginId(const OriginId id) noexcept
 {
     controlBlock->setOriginId(id);
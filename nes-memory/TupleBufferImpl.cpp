@@ -20,6 +20,7 @@
 #include <utility>
 #include <Identifiers/Identifiers.hpp>
 #include <MemoryLayout/VariableSizedAccess.hpp>
+#include <Runtime/MemoryAccount.hpp>
 #include <Runtime/TupleBuffer.hpp>
 #include <Time/Timestamp.hpp>
 #include <Util/Logger/Logger.hpp>
@@ -194,7 +195,16 @@ bool BufferControlBlock::release()
         }
 #endif
         const auto recycler = std::move(owningBufferRecycler);
+        if (const auto account = std::move(memoryAccount))
+        {
+            account->release(
+                numberOfChargedBytes, isChargedAsUnpooled ? MemoryAccount::Allocation::UNPOOLED : MemoryAccount::Allocation::POOLED);
+            numberOfChargedBytes = 0;
+            isChargedAsUnpooled = false;
+        }
         numberOfTuples = 0;
+        /// Sources solely set the creation timestamp, thus a recycled buffer must not report the latest creation timestamp of its last use
+        latestCreationTimestamp = Timestamp(Timestamp::INITIAL_VALUE);
         recycleCallback(owner, recycler.get());
         return true;
     }
@@ -292,6 +302,16 @@ Timestamp BufferControlBlock::getCreationTimestamp() const noexcept
     return creationTimestamp;
 }
 
+void BufferControlBlock::setLatestCreationTimestamp(const Timestamp timestamp)
+{
+    this->latestCreationTimestamp = timestamp;
+}
+
+Timestamp BufferControlBlock::getLatestCreationTimestamp() const noexcept
+{
+    return latestCreationTimestamp;
+}
+
 OriginId BufferControlBlock::getOriginId() const noexcept
 {
     return originId;
@@ -45,6 +45,7 @@ class LocalBufferPool;
 class TupleBuffer;
 class FixedSizeBufferPool;
 class BufferRecycler;
+class MemoryAccount;
 
 static constexpr auto GET_BUFFER_TIMEOUT = std::chrono::milliseconds(1000);
 
@@ -111,6 +112,8 @@ public:
     void setOriginId(OriginId originId);
     void setCreationTimestamp(Timestamp timestamp);
     [[nodiscard]] Timestamp getCreationTimestamp() const noexcept;
+    void setLatestCreationTimestamp(Timestamp timestamp);
+    [[nodiscard]] Timestamp getLatestCreationTimestamp() const noexcept;
     [[nodiscard]] VariableSizedAccess::Index storeChildBuffer(BufferControlBlock* control);
     [[nodiscard]] bool loadChildBuffer(VariableSizedAccess::Index index, BufferControlBlock*& control, uint8_t*& ptr, uint32_t& size) const;
 
@@ -127,6 +130,7 @@ private:
     ChunkNumber chunkNumber = INVALID_CHUNK_NUMBER;
     bool lastChunk = true;
     Timestamp creationTimestamp = Timestamp(Timestamp::INITIAL_VALUE);
+    Timestamp latestCreationTimestamp = Timestamp(Timestamp::INITIAL_VALUE);
     OriginId originId = INVALID_ORIGIN_ID;
     std::vector<MemorySegment*> children;
 
@@ -134,6 +138,10 @@ public:
     MemorySegment* owner;
     std::shared_ptr<BufferRecycler> owningBufferRecycler = nullptr;
     std::function<void(MemorySegment*, BufferRecycler*)> recycleCallback;
+    /// Set if the buffer is charged to the memory account of a query, which is credited once the buffer is recycled
+    std::shared_ptr<MemoryAccount> memoryAccount = nullptr;
+    uint64_t numberOfChargedBytes = 0;
+    bool isChargedAsUnpooled = false;
 
 #ifdef NES_DEBUG_TUPLE_BUFFER_LEAKS
 private:
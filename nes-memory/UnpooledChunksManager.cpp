@@ -16,11 +16,11 @@
 #include <Runtime/UnpooledChunksManager.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <memory_resource>
-#include <numeric>
 #include <ranges>
 #include <thread>
 #include <utility>
@@ -33,84 +33,114 @@
 
 namespace NES
 {
-UnpooledChunksManager::UnpooledChunksManager(std::shared_ptr<std::pmr::memory_resource> memoryResource)
+namespace
+{
+std::atomic<uint64_t> nextManagerId{1};
+}
+
+UnpooledChunksManager::UnpooledChunk::UnpooledChunk(
+    std::shared_ptr<std::pmr::memory_resource> memoryResource,
+    uint8_t* startOfChunk,
+    const size_t totalSize,
+    const size_t alignment,
+    std::shared_ptr<std::atomic<uint64_t>> activeMemorySegments)
     : memoryResource(std::move(memoryResource))
+    , startOfChunk(startOfChunk)
+    , totalSize(totalSize)
+    , alignment(alignment)
+    , activeMemorySegments(std::move(activeMemorySegments))
 {
 }
 
-UnpooledChunksManager::UnpooledChunk::UnpooledChunk(const uint64_t windowSize) : lastAllocateChunkKey(nullptr), rollingAverage(windowSize)
+void UnpooledChunksManager::UnpooledChunk::release()
 {
+    const auto previousReferences = references.fetch_sub(1, std::memory_order::acq_rel);
+    INVARIANT(previousReferences > 0, "Releasing an unpooled chunk without references");
+    if (previousReferences == 1)
+    {
+        /// The owning thread has retired the chunk and no memory segment is active anymore, thus nobody can access the chunk
+        NES_TRACE("Deallocating {}", *this);
+        memoryResource->deallocate(startOfChunk, totalSize, alignment);
+        delete this; /// NOLINT(cppcoreguidelines-owning-memory)
+    }
 }
 
-void UnpooledChunksManager::UnpooledChunk::emplaceChunkControlBlock(
-    uint8_t* chunkKey, std::unique_ptr<detail::MemorySegment> newMemorySegment)
+UnpooledChunksManager::UnpooledChunksManager(std::shared_ptr<std::pmr::memory_resource> memoryResource)
+    : memoryResource(std::move(memoryResource))
+    , managerId(nextManagerId.fetch_add(1, std::memory_order::relaxed))
+    , activeMemorySegments(std::make_shared<std::atomic<uint64_t>>(0))
 {
-    auto& curUnpooledChunk = chunks.at(chunkKey);
-    curUnpooledChunk.unpooledMemorySegments.emplace_back(std::move(newMemorySegment));
 }
 
-std::shared_ptr<folly::Synchronized<UnpooledChunksManager::UnpooledChunk>> UnpooledChunksManager::getChunk(const std::thread::id threadId)
+UnpooledChunksManager::~UnpooledChunksManager()
 {
-    auto upgradeLockedUnpooledBuffers = allLocalUnpooledBuffers.ulock();
-    if (const auto existingChunk = upgradeLockedUnpooledBuffers->find(threadId); existingChunk != upgradeLockedUnpooledBuffers->cend())
+    /// Chunks that still contain active memory segments are deallocated once their last segment is recycled
+    for (const auto& localChunks : *allLocalUnpooledBuffers.wlock() | std::views::values)
     {
-        return existingChunk->second;
+        if (localChunks->currentChunk != nullptr)
+        {
+            std::exchange(localChunks->currentChunk, nullptr)->release();
+        }
     }
-
-    /// We have seen a new thread id and need to create a new UnpooledBufferChunkData for it
-    auto newUnpooledBuffer = std::make_shared<folly::Synchronized<UnpooledChunk>>(UnpooledChunk(ROLLING_AVERAGE_UNPOOLED_BUFFER_SIZE));
-    upgradeLockedUnpooledBuffers.moveFromUpgradeToWrite()->emplace(threadId, newUnpooledBuffer);
-    return newUnpooledBuffer;
 }
 
-size_t UnpooledChunksManager::getNumberOfUnpooledBuffers() const
+UnpooledChunksManager::ThreadLocalChunks& UnpooledChunksManager::getThreadLocalChunks()
 {
-    const auto lockedAllBufferChunkData = allLocalUnpooledBuffers.rlock();
-    size_t numOfUnpooledBuffers = 0;
-    for (const auto& chunkData : *lockedAllBufferChunkData | std::views::values)
+    /// Caches the lookup of the most recently used UnpooledChunksManager of this thread, which avoids the lock on the hot path
+    struct LookupCache
+    {
+        uint64_t managerId = 0;
+        ThreadLocalChunks* localChunks = nullptr;
+    };
+    thread_local LookupCache lookupCache;
+    if (lookupCache.managerId == managerId)
     {
-        const auto rLockedChunkData = chunkData->rlock();
-        numOfUnpooledBuffers += std::accumulate(
-            rLockedChunkData->chunks.begin(),
-            rLockedChunkData->chunks.end(),
-            0,
-            [](const auto& sum, const auto& item) { return sum + item.second.activeMemorySegments; });
+        return *lookupCache.localChunks;
     }
-    return numOfUnpooledBuffers;
+
+    const auto threadId = std::this_thread::get_id();
+    auto upgradeLockedUnpooledBuffers = allLocalUnpooledBuffers.ulock();
+    auto existingChunks = upgradeLockedUnpooledBuffers->find(threadId);
+    ThreadLocalChunks* localChunks = nullptr;
+    if (existingChunks != upgradeLockedUnpooledBuffers->end())
+    {
+        localChunks = existingChunks->second.get();
+    }
+    else
+    {
+        /// We have seen a new thread id and need to create a new allocation state for it
+        localChunks = upgradeLockedUnpooledBuffers.moveFromUpgradeToWrite()
+                          ->emplace(threadId, std::make_unique<ThreadLocalChunks>())
+                          .first->second.get();
+    }
+    lookupCache = {.managerId = managerId, .localChunks = localChunks};
+    return *localChunks;
 }
 
-std::pair<uint8_t*, uint8_t*>
-UnpooledChunksManager::allocateSpace(const std::thread::id threadId, const size_t neededSize, const size_t alignment)
+size_t UnpooledChunksManager::getNumberOfUnpooledBuffers() const
+{
+    return activeMemorySegments->load(std::memory_order::relaxed);
+}
+
+std::pair<UnpooledChunksManager::UnpooledChunk*, uint8_t*>
+UnpooledChunksManager::allocateSpace(ThreadLocalChunks& localChunks, const size_t neededSize, const size_t alignment)
 {
     /// There exist two possibilities that can happen
     /// 1. We have enough space in an already allocated chunk or 2. we need to allocate a new chunk of memory
-
-    const auto lockedLocalUnpooledBufferData = getChunk(threadId)->wlock();
-    const auto newRollingAverage = static_cast<size_t>(lockedLocalUnpooledBufferData->rollingAverage.add(neededSize));
-    auto& localLastAllocatedChunkKey = lockedLocalUnpooledBufferData->lastAllocateChunkKey;
-    auto& localUnpooledBufferChunkStorage = lockedLocalUnpooledBufferData->chunks;
-    if (localUnpooledBufferChunkStorage.contains(localLastAllocatedChunkKey))
+    const auto newRollingAverage = static_cast<size_t>(localChunks.rollingAverage.add(neededSize));
+    if (auto* currentChunk = localChunks.currentChunk; currentChunk != nullptr && currentChunk->usedSize + neededSize < currentChunk->totalSize)
     {
-        if (auto& currentAllocatedChunk = localUnpooledBufferChunkStorage.at(localLastAllocatedChunkKey);
-            currentAllocatedChunk.usedSize + neededSize < currentAllocatedChunk.totalSize)
-        {
-            /// There is enough space in the last allocated chunk. Thus, we can create a tuple buffer from the available space
-            const auto localMemoryForNewTupleBuffer = currentAllocatedChunk.startOfChunk + currentAllocatedChunk.usedSize;
-            const auto localKeyForUnpooledBufferChunk = localLastAllocatedChunkKey;
-            currentAllocatedChunk.activeMemorySegments += 1;
-            currentAllocatedChunk.usedSize += neededSize;
-            NES_TRACE(
-                "Added tuple buffer {} of {}B to: {}",
-                fmt::ptr(localMemoryForNewTupleBuffer),
-                neededSize,
-                fmt::format("{}", currentAllocatedChunk));
-            return {localKeyForUnpooledBufferChunk, localMemoryForNewTupleBuffer};
-        }
+        /// There is enough space in the current chunk. Thus, we can create a tuple buffer from the available space
+        auto* const localMemoryForNewTupleBuffer = currentChunk->startOfChunk + currentChunk->usedSize;
+        currentChunk->usedSize += neededSize;
+        currentChunk->references.fetch_add(1, std::memory_order::relaxed);
+        NES_TRACE("Added tuple buffer {} of {}B to: {}", fmt::ptr(localMemoryForNewTupleBuffer), neededSize, *currentChunk);
+        return {currentChunk, localMemoryForNewTupleBuffer};
     }
 
-    /// The last allocated chunk is not enough. Thus, we need to allocate a new chunk and insert it into the unpooled buffer storage
+    /// The current chunk is not enough. Thus, we need to allocate a new chunk.
     /// The memory to allocate must be larger than bufferSize, while also taking the rolling average into account.
-    /// For now, we allocate multiple localLastAllocateChunkKeyrolling averages. If this is too small for the current bufferSize, we allocate at least the bufferSize
+    /// For now, we allocate multiple rolling averages. If this is too small for the current bufferSize, we allocate at least the bufferSize
     const auto newAllocationSizeExact = std::max(neededSize, newRollingAverage * NUM_PRE_ALLOCATED_CHUNKS);
     const auto newAllocationSize = (newAllocationSizeExact + 4095U) & ~4095U; /// Round to the nearest multiple of 4KB (page size)
     auto* const newlyAllocatedMemory = static_cast<uint8_t*>(memoryResource->allocate(newAllocationSize, alignment));
@@ -120,69 +150,53 @@ UnpooledChunksManager::allocateSpace(const std::thread::id threadId, const size_
         return {};
     }
 
-    /// Updating the local last allocate chunk key and adding the new chunk to the local chunk storage
-    localLastAllocatedChunkKey = newlyAllocatedMemory;
-    const auto localKeyForUnpooledBufferChunk = newlyAllocatedMemory;
-    const auto localMemoryForNewTupleBuffer = newlyAllocatedMemory;
-    auto& currentAllocatedChunk = localUnpooledBufferChunkStorage[localKeyForUnpooledBufferChunk];
-    currentAllocatedChunk.startOfChunk = newlyAllocatedMemory;
-    currentAllocatedChunk.totalSize = newAllocationSize;
-    currentAllocatedChunk.usedSize += neededSize;
-    currentAllocatedChunk.activeMemorySegments += 1;
-    NES_TRACE("Created new chunk {} for tuple buffer {} of {}B", currentAllocatedChunk, fmt::ptr(localMemoryForNewTupleBuffer), neededSize);
-    return {localKeyForUnpooledBufferChunk, localMemoryForNewTupleBuffer};
+    /// Retiring the previous chunk. It is deallocated as soon as all of its memory segments have been recycled.
+    if (localChunks.currentChunk != nullptr)
+    {
+        std::exchange(localChunks.currentChunk, nullptr)->release();
+    }
+
+    auto* newChunk = new UnpooledChunk( /// NOLINT(cppcoreguidelines-owning-memory)
+        memoryResource,
+        newlyAllocatedMemory,
+        newAllocationSize,
+        alignment,
+        activeMemorySegments);
+    newChunk->usedSize = neededSize;
+    newChunk->references.fetch_add(1, std::memory_order::relaxed);
+    localChunks.currentChunk = newChunk;
+    NES_TRACE("Created new chunk {} for tuple buffer {} of {}B", *newChunk, fmt::ptr(newlyAllocatedMemory), neededSize);
+    return {newChunk, newlyAllocatedMemory};
 }
 
 TupleBuffer
 UnpooledChunksManager::getUnpooledBuffer(const size_t neededSize, size_t alignment, const std::shared_ptr<BufferRecycler>& bufferRecycler)
 {
-    const auto threadId = std::this_thread::get_id();
-
     /// we have to align the buffer size as ARM throws an SIGBUS if we have unaligned accesses on atomics.
     const auto alignedBufferSizePlusControlBlock = alignBufferSize(neededSize + sizeof(detail::BufferControlBlock), alignment);
 
-    /// Getting space from the unpooled chunks manager
-    const auto& [localKeyForUnpooledBufferChunk, localMemoryForNewTupleBuffer]
-        = this->allocateSpace(threadId, alignedBufferSizePlusControlBlock, alignment);
+    /// Getting space from the chunk of this thread
+    auto& localChunks = getThreadLocalChunks();
+    const auto [chunk, localMemoryForNewTupleBuffer] = this->allocateSpace(localChunks, alignedBufferSizePlusControlBlock, alignment);
+    INVARIANT(chunk != nullptr, "Could not allocate an unpooled buffer of {}B", neededSize);
 
-    /// Creating a new memory segment, and adding it to the unpooledMemorySegments
+    /// Creating a new memory segment, and adding it to the unpooledMemorySegments of its chunk
     const auto alignedBufferSize = alignBufferSize(neededSize, alignment);
     const auto controlBlockSize = alignBufferSize(sizeof(detail::BufferControlBlock), alignment);
-    const auto chunk = this->getChunk(threadId);
     auto memSegment = std::make_unique<detail::MemorySegment>(
         localMemoryForNewTupleBuffer + controlBlockSize,
         alignedBufferSize,
-        [copyOfMemoryResource = this->memoryResource,
-         copyOLastChunkPtr = localKeyForUnpooledBufferChunk,
-         copyOfChunk = chunk,
-         copyOfAlignment = alignment](detail::MemorySegment* memorySegment, BufferRecycler*)
+        [chunk](detail::MemorySegment* memorySegment, BufferRecycler*)
         {
-            auto lockedLocalUnpooledBufferData = copyOfChunk->wlock();
-            auto& curUnpooledChunk = lockedLocalUnpooledBufferData->chunks[copyOLastChunkPtr];
-            INVARIANT(
-                curUnpooledChunk.activeMemorySegments > 0,
-                "curUnpooledChunk.activeMemorySegments must be larger than 0 but is {}",
-                curUnpooledChunk.activeMemorySegments);
-            curUnpooledChunk.activeMemorySegments -= 1;
             memorySegment->size = 0;
-            if (curUnpooledChunk.activeMemorySegments == 0)
-            {
-                /// All memory segments have been removed, therefore, we can deallocate the unpooled chunk
-                const auto extractedChunk = lockedLocalUnpooledBufferData->chunks.extract(copyOLastChunkPtr);
-                const auto& extractedChunkControlBlock = extractedChunk.mapped();
-                lockedLocalUnpooledBufferData->lastAllocateChunkKey = nullptr;
-                lockedLocalUnpooledBufferData.unlock();
-                copyOfMemoryResource->deallocate(
-                    extractedChunkControlBlock.startOfChunk, extractedChunkControlBlock.totalSize, copyOfAlignment);
-            }
+            chunk->activeMemorySegments->fetch_sub(1, std::memory_order::relaxed);
+            chunk->release();
         });
 
     auto* leakedMemSegment = memSegment.get();
-    {
-        /// Inserting the memory segment into the unpooled buffer storage
-        const auto lockedLocalUnpooledBufferData = chunk->wlock();
-        lockedLocalUnpooledBufferData->emplaceChunkControlBlock(localKeyForUnpooledBufferChunk, std::move(memSegment));
-    }
+    /// The owning thread holds a reference to the chunk, thus no other thread can deallocate the chunk concurrently
+    chunk->unpooledMemorySegments.emplace_back(std::move(memSegment));
+    activeMemorySegments->fetch_add(1, std::memory_order::relaxed);
 
     if (leakedMemSegment->controlBlock->prepare(bufferRecycler))
     {
@@ -0,0 +1,85 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <Runtime/Allocator/NesDefaultMemoryAllocator.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <benchmark/benchmark.h>
+
+/// This Benchmark measures the contention of threads that acquire and release pooled buffers, as the sources and WorkerThreads do.
+/// The first argument is the size of the thread local buffer caches, zero disables the caches, thus every acquire and release passes
+/// the shared queue of the BufferManager.
+
+namespace
+{
+constexpr uint32_t NUMBER_OF_BUFFERS = 16 * 1024;
+std::shared_ptr<NES::BufferManager> bufferManager;
+
+void setUp(const benchmark::State& state)
+{
+    if (state.thread_index() == 0)
+    {
+        bufferManager = NES::BufferManager::create(
+            NES::BufferManager::DEFAULT_BUFFER_SIZE,
+            NUMBER_OF_BUFFERS,
+            std::make_shared<NES::NesDefaultMemoryAllocator>(),
+            NES::BufferManager::DEFAULT_ALIGNMENT,
+            static_cast<uint32_t>(state.range(0)));
+    }
+}
+
+void tearDown(const benchmark::State& state)
+{
+    if (state.thread_index() == 0)
+    {
+        bufferManager.reset();
+    }
+}
+}
+
+/// Acquires a pooled buffer and releases it right away
+static void BM_AcquireAndRelease(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        auto buffer = bufferManager->getBufferBlocking();
+        benchmark::DoNotOptimize(buffer);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+/// Acquires a batch of buffers before releasing them, as a pipeline which emits multiple buffers per input buffer does
+static void BM_AcquireAndReleaseBatch(benchmark::State& state)
+{
+    constexpr size_t BATCH_SIZE = 32;
+    std::vector<NES::TupleBuffer> buffers;
+    buffers.reserve(BATCH_SIZE);
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < BATCH_SIZE; ++i)
+        {
+            buffers.emplace_back(bufferManager->getBufferBlocking());
+        }
+        buffers.clear();
+    }
+    state.SetItemsProcessed(state.iterations() * BATCH_SIZE);
+}
+
+BENCHMARK(BM_AcquireAndRelease)->Setup(setUp)->Teardown(tearDown)->Arg(0)->Arg(64)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK(BM_AcquireAndReleaseBatch)->Setup(setUp)->Teardown(tearDown)->Arg(0)->Arg(64)->ThreadRange(1, 16)->UseRealTime();
+/// Run the benchmark
+BENCHMARK_MAIN();
@@ -0,0 +1,80 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <benchmark/benchmark.h>
+
+/// This Benchmark measures the throughput of allocating and recycling unpooled buffers across multiple threads.
+/// Every thread allocates from its own chunk, thus the throughput should scale with the number of threads.
+/// The retained buffers are released by another thread than the allocating one to include cross-thread recycling.
+
+namespace
+{
+std::shared_ptr<NES::BufferManager> bufferManager;
+
+void setUp(const benchmark::State& state)
+{
+    if (state.thread_index() == 0)
+    {
+        bufferManager = NES::BufferManager::create();
+    }
+}
+
+void tearDown(const benchmark::State& state)
+{
+    if (state.thread_index() == 0)
+    {
+        bufferManager.reset();
+    }
+}
+}
+
+/// Allocates an unpooled buffer and releases it right away
+static void BM_AllocateAndRecycleUnpooledBuffer(benchmark::State& state)
+{
+    const auto bufferSize = static_cast<size_t>(state.range(0));
+    for (auto _ : state)
+    {
+        auto buffer = bufferManager->getUnpooledBuffer(bufferSize);
+        benchmark::DoNotOptimize(buffer);
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+/// Attaches multiple unpooled child buffers to a pooled buffer, as variable sized data does
+static void BM_StoreUnpooledChildBuffers(benchmark::State& state)
+{
+    constexpr size_t NUMBER_OF_CHILDREN = 16;
+    const auto bufferSize = static_cast<size_t>(state.range(0));
+    for (auto _ : state)
+    {
+        auto parent = bufferManager->getBufferBlocking();
+        for (size_t child = 0; child < NUMBER_OF_CHILDREN; ++child)
+        {
+            auto childBuffer = bufferManager->getUnpooledBuffer(bufferSize);
+            benchmark::DoNotOptimize(parent.storeChildBuffer(childBuffer.value()));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * NUMBER_OF_CHILDREN);
+}
+
+BENCHMARK(BM_AllocateAndRecycleUnpooledBuffer)->Setup(setUp)->Teardown(tearDown)->Arg(64)->Arg(1024)->Arg(16 * 1024)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK(BM_StoreUnpooledChildBuffers)->Setup(setUp)->Teardown(tearDown)->Arg(64)->Arg(1024)->ThreadRange(1, 16)->UseRealTime();
+/// Run the benchmark
+BENCHMARK_MAIN();
@@ -58,7 +58,7 @@ public:
     static VariableSizedAccess
     writeVarSized(TupleBuffer& tupleBuffer, AbstractBufferProvider& bufferProvider, std::span<const std::byte> varSizedValue);
 
-    /// @brief Reads the variable sized data and returns the pointer to the var sized data
+    /// @brief Reads the variable sized data from the child buffer or the VarSizedDictionary and returns the pointer to the var sized data
     /// @return Pointer to variable sized data
     static std::span<std::byte> loadAssociatedVarSizedValue(const TupleBuffer& tupleBuffer, VariableSizedAccess variableSizedAccess);
 
@@ -66,6 +66,21 @@ public:
     /// @return Variable sized data as a string
     static std::string readVarSizedDataAsString(const TupleBuffer& tupleBuffer, VariableSizedAccess variableSizedAccess);
 
+    /// The 64-bit field of a tuple storing a var sized value, c.f., @class VariableSizedAccess
+    using VarSizedField = std::span<std::byte, sizeof(VariableSizedAccess::CombinedIndex)>;
+    using ConstVarSizedField = std::span<const std::byte, sizeof(VariableSizedAccess::CombinedIndex)>;
+
+    /// @brief Writes the variable sized data to the field. If it fits into the field, we store it inline, otherwise in a child buffer.
+    static void writeVarSizedField(
+        TupleBuffer& tupleBuffer, AbstractBufferProvider& bufferProvider, VarSizedField field, std::span<const std::byte> varSizedValue);
+
+    /// @brief Reads the variable sized data of the field, which either resides in the field itself or in a child buffer
+    /// @return Variable sized data with the prepended length
+    static std::span<const std::byte> loadVarSizedField(const TupleBuffer& tupleBuffer, ConstVarSizedField field);
+
+    /// @brief Reads the variable sized data of the field. Similar as loadVarSizedField, but returns a string
+    static std::string readVarSizedFieldAsString(const TupleBuffer& tupleBuffer, ConstVarSizedField field);
+
     /// Gets the field index for a specific field name. If the field name not exists, we return an empty optional.
     /// @return either field index for fieldName or empty optional
     [[nodiscard]] std::optional<uint64_t> getFieldIndexFromName(const std::string& fieldName) const;
@@ -86,6 +101,11 @@ public:
     [[nodiscard]] uint64_t getFieldSize(uint64_t fieldIndex) const;
     [[nodiscard]] std::vector<std::string> getKeyFieldNames() const;
     void setKeyFieldNames(const std::vector<std::string>& keyFields);
+
+    /// Places the physical fields of a tuple such that the hot fields, i.e., the fields an operator accesses for every tuple, come first
+    /// and every field is naturally aligned. The field indices, and thus the logical order of the schema, stay unchanged.
+    /// Layouts that do not interleave the fields of a tuple keep their placement.
+    virtual void optimizeFieldPlacement(const std::vector<std::string>& hotFieldNames);
     bool operator==(const MemoryLayout& rhs) const = default;
     bool operator!=(const MemoryLayout& rhs) const = default;
 
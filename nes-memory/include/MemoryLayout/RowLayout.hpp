@@ -16,6 +16,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <string>
 #include <vector>
 #include <DataTypes/Schema.hpp>
 #include <MemoryLayout/MemoryLayout.hpp>
@@ -31,6 +32,8 @@ namespace NES
  * | F1, F2, F3 |
  *
  * This may be beneficial for processing performance if all fields of the tuple are accessed.
+ * Operators that own their layout, e.g., the build sides of a join, may place the fields they access for every tuple first, c.f.,
+ * optimizeFieldPlacement. The field indices keep the order of the schema, thus solely the offsets of the fields change.
  */
 class RowLayout : public MemoryLayout
 {
@@ -52,6 +55,10 @@ public:
     /// @throws CannotAccessBuffer if the tuple index or the field index is out of bounds.
     [[nodiscard]] uint64_t getFieldOffset(uint64_t tupleIndex, uint64_t fieldIndex) const override;
 
+    /// Places the hot fields at the start of the tuple, followed by all other fields. Both groups are ordered by descending alignment and
+    /// every field starts at a multiple of its alignment. The tuple is padded to its largest alignment, thus the tuple size may grow.
+    void optimizeFieldPlacement(const std::vector<std::string>& hotFieldNames) override;
+
 private:
     std::vector<uint64_t> fieldOffSets;
 };
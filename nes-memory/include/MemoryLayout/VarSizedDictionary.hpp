@@ -0,0 +1,64 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <span>
+#include <string_view>
+#include <unordered_map>
+#include <MemoryLayout/VariableSizedAccess.hpp>
+
+namespace NES
+{
+
+/// @brief Append-only dictionary of var sized values, which the input formatters share to encode low-cardinality var sized fields.
+/// Instead of copying a value to a child buffer of every tuple buffer, the field stores the code of the value in the dictionary,
+/// c.f., @class VariableSizedAccess.
+/// As the dictionary never removes a value, a code and the memory of its value stay valid as long as the process runs.
+/// Thus, the dictionary holds at most MAX_NUMBER_OF_ENTRIES values of at most MAX_ENTRY_SIZE bytes. Afterward, encode() returns nullopt
+/// and the formatters store the values in child buffers again.
+class VarSizedDictionary
+{
+public:
+    static constexpr size_t MAX_NUMBER_OF_ENTRIES = 1UL << 16UL;
+    static constexpr size_t MAX_ENTRY_SIZE = 256;
+
+    static VarSizedDictionary& instance();
+
+    /// Returns the access to the dictionary entry of the var sized value and adds the entry, if the value is new to the dictionary
+    std::optional<VariableSizedAccess> encode(std::span<const std::byte> varSizedValue);
+
+    /// Returns the var sized value with the prepended length. The memory must not be written to.
+    [[nodiscard]] std::span<std::byte> decode(VariableSizedAccess variableSizedAccess) const;
+
+    [[nodiscard]] size_t getNumberOfEntries() const;
+
+private:
+    VarSizedDictionary();
+
+    /// Entries are only written before their code is published, thus, decode() reads them without synchronization
+    std::unique_ptr<std::unique_ptr<std::byte[]>[]> entries;
+    std::atomic<size_t> numberOfEntries{0};
+
+    /// The keys are views of the contents of the entries
+    mutable std::shared_mutex codesMutex;
+    std::unordered_map<std::string_view, uint32_t> codes;
+};
+
+}
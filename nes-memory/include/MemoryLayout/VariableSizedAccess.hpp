@@ -14,7 +14,9 @@
 
 #pragma once
 
+#include <bit>
 #include <compare>
+#include <cstddef>
 #include <cstdint>
 #include <ostream>
 #include <Util/Logger/Formatter.hpp>
@@ -33,13 +35,26 @@ class BufferControlBlock;
 ///
 /// We use 64 bits to store the child index and offset for accessing the correct variable sized data.
 /// We use the upper 32 bits for the childIndex and the lower 32 bits for the childBufferOffset
-/// This allows us to have 4 million child buffer and having a maximum child buffer size of 4 GB
-/// (unless we have only one var sized object per child)
+/// This allows us to have 4 million child buffer and having a maximum child buffer size of 2 GB
+/// (unless we have only one var sized object per child), as the highest bit of the offset marks the field as a reference.
+///
+/// Var sized data of up to INLINE_CAPACITY bytes does not require a child buffer, instead we store it inline in the 64 bits of the field.
+/// The lower 32 bits contain the length and the upper 32 bits the content, thus, the field itself is a valid var sized data object
+/// with a length prefix, c.f., @class VariableSizedData. As the length is at most INLINE_CAPACITY, the reference bit is never set.
+///
+/// Dictionary encoded var sized data resides in the VarSizedDictionary. Its fields store the DICTIONARY_INDEX and the code as offset.
 class VariableSizedAccess
 {
 public:
     using CombinedIndex = uint64_t;
 
+    static constexpr size_t INLINE_CAPACITY = sizeof(CombinedIndex) - sizeof(uint32_t);
+    static constexpr CombinedIndex REFERENCE_BIT = 1UL << 31UL;
+    static constexpr uint32_t DICTIONARY_INDEX = UINT32_MAX;
+
+    /// Returns true, if the var sized data is stored inline in the field and not in a child buffer
+    static constexpr bool isInlined(const CombinedIndex combinedIdxOffset) { return (combinedIdxOffset & REFERENCE_BIT) == 0; }
+
     class Index
     {
     public:
@@ -70,7 +85,8 @@ public:
         /// Required for allowing VariableSizedAccess to access offset in VariableSizedAccess::getCombinedIdxOffset()
         friend class VariableSizedAccess;
         using Underlying = uint32_t;
-        static constexpr auto UnderlyingBits = sizeof(Underlying) * 8;
+        /// The highest bit is reserved for the REFERENCE_BIT
+        static constexpr auto UnderlyingBits = (sizeof(Underlying) * 8) - 1;
 
         explicit Offset(uint64_t offset);
 
@@ -82,6 +98,7 @@ public:
         friend std::strong_ordering operator<=>(const Offset& lhs, const Offset& rhs) = default;
 
     private:
+        /// Always contains the REFERENCE_BIT, so that a bit_cast of the CombinedIndex and the constructor result in the same offset
         Underlying offset;
     };
 
@@ -97,6 +114,7 @@ public:
     explicit VariableSizedAccess(const CombinedIndex combinedIdxOffset)
         : offset(Offset::convertToOffset(combinedIdxOffset)), index(Index::convertToIndex(combinedIdxOffset))
     {
+        PRECONDITION(not isInlined(combinedIdxOffset), "Inlined var sized data {} is not stored in a child buffer", combinedIdxOffset);
     }
 
     explicit VariableSizedAccess(const Index index) : offset(0), index(index) { }
@@ -111,6 +129,9 @@ public:
 
     [[nodiscard]] Offset getOffset() const { return offset; };
 
+    /// Returns true, if the var sized data resides in the VarSizedDictionary and not in a child buffer
+    [[nodiscard]] bool isDictionaryEncoded() const { return index.index == DICTIONARY_INDEX; }
+
     [[nodiscard]] CombinedIndex getCombinedIdxOffset() const
     {
         const uint64_t indexBitsCombined = static_cast<uint64_t>(index.index) << 32UL;
@@ -126,6 +147,7 @@ public:
 
 static_assert(sizeof(VariableSizedAccess) == 8, "Underlying type must be 8 bytes (64 bits)");
 static_assert(sizeof(VariableSizedAccess::CombinedIndex) == 8, "Underlying type must be 8 bytes (64 bits)");
+static_assert(std::endian::native == std::endian::little, "Inlined var sized data expects the length in the lower 32 bits of the field");
 
 }
 
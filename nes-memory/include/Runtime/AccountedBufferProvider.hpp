@@ -0,0 +1,56 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <Runtime/AbstractBufferProvider.hpp>
+#include <Runtime/MemoryAccount.hpp>
+#include <Runtime/TupleBuffer.hpp>
+
+namespace NES
+{
+
+/// Charges every buffer that it obtains from the wrapped buffer provider to the memory account of a query. A buffer which exceeds the quota
+/// of the account is returned to the wrapped provider and the allocation throws QueryMemoryQuotaExceeded, which fails the query instead of
+/// letting it exhaust the buffer pool that it shares with all other queries.
+class AccountedBufferProvider final : public AbstractBufferProvider
+{
+public:
+    AccountedBufferProvider(std::shared_ptr<AbstractBufferProvider> bufferProvider, std::shared_ptr<MemoryAccount> memoryAccount);
+
+    [[nodiscard]] BufferManagerType getBufferManagerType() const override;
+    [[nodiscard]] size_t getBufferSize() const override;
+    [[nodiscard]] size_t getNumOfPooledBuffers() const override;
+    [[nodiscard]] size_t getNumOfUnpooledBuffers() const override;
+
+    TupleBuffer getBufferBlocking() override;
+    std::optional<TupleBuffer> getBufferNoBlocking() override;
+    std::optional<TupleBuffer> getBufferWithTimeout(std::chrono::milliseconds timeout_ms) override;
+    std::optional<TupleBuffer> getUnpooledBuffer(size_t bufferSize) override;
+
+    [[nodiscard]] const std::shared_ptr<MemoryAccount>& getMemoryAccount() const;
+    [[nodiscard]] const std::shared_ptr<AbstractBufferProvider>& getBufferProvider() const;
+
+private:
+    std::optional<TupleBuffer> charge(std::optional<TupleBuffer> buffer, MemoryAccount::Allocation allocation) const;
+
+    std::shared_ptr<AbstractBufferProvider> bufferProvider;
+    std::shared_ptr<MemoryAccount> memoryAccount;
+};
+
+}
@@ -0,0 +1,62 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+
+namespace NES
+{
+
+/// Backing pages of memory allocated by the NesMmapMemoryAllocator
+enum class HugePagePolicy : uint8_t
+{
+    /// Regular pages of the operating system (usually 4 KiB)
+    NONE,
+    /// Regular mapping, which is advised to be backed by transparent huge pages (madvise(MADV_HUGEPAGE))
+    TRANSPARENT,
+    /// Explicit huge pages from the hugetlbfs pool (MAP_HUGETLB). Falls back to transparent huge pages if the pool is exhausted.
+    EXPLICIT
+};
+
+/**
+ * @brief Memory resource which maps anonymous memory via mmap. Large allocations, e.g., the global buffer pool, can be backed by huge
+ * pages to reduce TLB misses. Allocations are pre-faulted, thus no page faults occur while the memory is used for the first time.
+ * Large allocations are pre-faulted by multiple threads, which inherit the CPU affinity of the allocating thread.
+ * Optionally, the memory is locked via mlock to prevent it from being swapped out.
+ * Allocation sizes are rounded up to the huge page size. Allocations smaller than a huge page, e.g., unpooled chunks, are not worth a
+ * mapping of their own and are served via posix_memalign, like in the NesDefaultMemoryAllocator.
+ */
+class NesMmapMemoryAllocator : public std::pmr::memory_resource
+{
+public:
+    static constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+    explicit NesMmapMemoryAllocator(HugePagePolicy hugePagePolicy, bool lockMemory = false);
+    ~NesMmapMemoryAllocator() override = default;
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+
+    bool do_is_equal(const memory_resource& other) const noexcept override { return this == &other; }
+
+    HugePagePolicy hugePagePolicy;
+    bool lockMemory;
+};
+}
@@ -14,8 +14,11 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <condition_variable>
+#include <cstddef>
+#include <cstdint>
 #include <deque>
 #include <memory>
 #include <memory_resource>
@@ -31,6 +34,28 @@
 namespace NES
 {
 
+/// Hit and miss counters of the thread local buffer caches of a BufferManager
+struct BufferCacheStatistics
+{
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+};
+
+/// A pool of pooled buffers of a fixed size that serves unpooled buffer requests up to that size
+struct BufferSizeClass
+{
+    uint32_t bufferSize = 0;
+    uint32_t numberOfBuffers = 0;
+};
+
+/// Snapshot of the occupancy of one buffer size class
+struct BufferSizeClassOccupancy
+{
+    size_t bufferSize = 0;
+    size_t numberOfBuffers = 0;
+    size_t numberOfAvailableBuffers = 0;
+};
+
 /**
  * @brief The BufferManager is responsible for:
  * 1. Pooled Buffers: preallocated fixed-size buffers of memory that must be reference counted
@@ -50,6 +75,14 @@ namespace NES
  * Unpooled buffers are either allocated on the spot or served via a previously allocated, unpooled buffer that has
  * been returned to the BufferManager by some component.
  *
+ * Optionally, the BufferManager keeps a small cache (magazine) of free pooled buffers per thread in front of the shared queue of
+ * available buffers. Magazines are refilled from and drained to the shared queue in batches. If the shared queue runs low, buffers
+ * bypass the magazines and waiting threads reclaim buffers from the magazines of other threads, which keeps backpressure intact.
+ *
+ * Optionally, unpooled buffer requests are served from size classes. Every size class is a pool of buffers of a fixed size with its
+ * own free list. A request is served by the smallest size class that fits it and only falls back to the UnpooledChunksManager if that
+ * size class is exhausted or no size class is large enough.
+ *
  */
 class BufferManager final : public std::enable_shared_from_this<BufferManager>, public BufferRecycler, public AbstractBufferProvider
 {
@@ -63,28 +96,39 @@ class BufferManager final : public std::enable_shared_from_this<BufferManager>,
         explicit Private() = default;
     };
 
+public:
     static constexpr auto DEFAULT_BUFFER_SIZE = 8 * 1024;
     static constexpr auto DEFAULT_NUMBER_OF_BUFFERS = 1024;
     static constexpr auto DEFAULT_ALIGNMENT = 64;
 
-public:
+    /// Maximum number of free buffers a single thread local cache can hold
+    static constexpr size_t MAX_BUFFER_CACHE_SIZE = 256;
+    /// Number of thread local caches. Threads beyond this number share caches.
+    static constexpr size_t NUMBER_OF_BUFFER_CACHES = 64;
+
     explicit BufferManager(
         Private,
         uint32_t bufferSize,
         uint32_t numOfBuffers,
         std::shared_ptr<std::pmr::memory_resource> memoryResource,
-        uint32_t withAlignment);
+        uint32_t withAlignment,
+        uint32_t bufferCacheSize,
+        std::vector<BufferSizeClass> sizeClasses);
 
     /// Creates a new global buffer manager
     /// @param bufferSize the size of each buffer in bytes
     /// @param numOfBuffers the total number of buffers in the pool
     /// @param withAlignment the alignment of each buffer, default is 64 so ony cache line aligned buffers, This value must be a pow of two and smaller than page size
     /// @param memoryResource resource for allocating and deallocating memory
+    /// @param bufferCacheSize number of free buffers each thread may cache locally, zero disables the thread local caches
+    /// @param sizeClasses pools which serve unpooled buffer requests before the UnpooledChunksManager is used
     static std::shared_ptr<BufferManager> create(
         uint32_t bufferSize = DEFAULT_BUFFER_SIZE,
         uint32_t numOfBuffers = DEFAULT_NUMBER_OF_BUFFERS,
         const std::shared_ptr<std::pmr::memory_resource>& memoryResource = std::make_shared<NesDefaultMemoryAllocator>(),
-        uint32_t withAlignment = DEFAULT_ALIGNMENT);
+        uint32_t withAlignment = DEFAULT_ALIGNMENT,
+        uint32_t bufferCacheSize = 0,
+        std::vector<BufferSizeClass> sizeClasses = {});
 
     BufferManager(const BufferManager&) = delete;
     BufferManager& operator=(const BufferManager&) = delete;
@@ -121,8 +165,14 @@ public:
     size_t getBufferSize() const override;
     size_t getNumOfPooledBuffers() const override;
     size_t getNumOfUnpooledBuffers() const override;
+    /// Includes the buffers which are currently held by thread local caches
     size_t getNumberOfAvailableBuffers() const;
 
+    [[nodiscard]] BufferCacheStatistics getBufferCacheStatistics() const;
+
+    /// Returns the occupancy of all size classes ordered by ascending buffer size
+    [[nodiscard]] std::vector<BufferSizeClassOccupancy> getSizeClassOccupancy() const;
+
     /**
      * @brief Recycle a pooled buffer by making it available to others
      * @param buffer
@@ -136,11 +186,37 @@ public:
     void recycleUnpooledBuffer(detail::MemorySegment* segment, const AllocationThreadInfo&) override;
 
 private:
+    /// A magazine of free memory segments, which is mostly accessed by a single thread. The lock is thus uncontended most of the time.
+    struct alignas(64) BufferCache
+    {
+        mutable std::mutex mutex;
+        std::array<detail::MemorySegment*, MAX_BUFFER_CACHE_SIZE> segments{};
+        size_t size = 0;
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+    };
+
+    [[nodiscard]] BufferCache* getThreadLocalBufferCache();
+    std::optional<TupleBuffer> getBufferFromCache();
+    bool recycleIntoCache(detail::MemorySegment* segment);
+    /// Moves the cached segments of all threads back into the queue of available buffers.
+    void reclaimCachedBuffers();
+    TupleBuffer makeTupleBuffer(detail::MemorySegment* memSegment);
+
     std::vector<detail::MemorySegment> allBuffers;
 
     folly::MPMCQueue<detail::MemorySegment*> availableBuffers;
 
+    size_t bufferCacheSize;
+    /// Magazines are refilled from and drained into availableBuffers in batches of this size
+    size_t bufferCacheBatchSize;
+    /// If fewer buffers are available in the shared queue, recycled buffers bypass the thread local caches
+    size_t bufferCacheLowWatermark;
+    std::unique_ptr<std::array<BufferCache, NUMBER_OF_BUFFER_CACHES>> bufferCaches;
+
     std::shared_ptr<NES::UnpooledChunksManager> unpooledChunksManager;
+    /// Pools of the size classes ordered by ascending buffer size
+    std::vector<std::shared_ptr<BufferManager>> sizeClassPools;
 
     size_t bufferSize;
     size_t numOfBuffers;
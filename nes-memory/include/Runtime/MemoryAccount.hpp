@@ -0,0 +1,82 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <Runtime/TupleBuffer.hpp>
+
+namespace NES
+{
+namespace detail
+{
+class BufferControlBlock;
+}
+
+/// Accounts the memory of the buffers that a query owns, c.f., AccountedBufferProvider. A charged buffer stays on the account until its
+/// reference count drops to zero, thus the account covers the pooled, the unpooled, and the state buffers of the query, e.g., the pages of
+/// a PagedVector, independent of the thread which releases them.
+/// Charging solely counts the bytes, i.e., it neither allocates nor reserves memory in the buffer manager.
+/// An account with a parent, e.g., the account of a single pipeline of the query, charges the parent as well, thus the parent accounts the
+/// buffers of all of its children.
+class MemoryAccount : public std::enable_shared_from_this<MemoryAccount>
+{
+public:
+    /// Whether the buffer stems from the buffer pool or was requested as an unpooled buffer
+    enum class Allocation : uint8_t
+    {
+        POOLED,
+        UNPOOLED
+    };
+
+    struct Usage
+    {
+        uint64_t bytes = 0;
+        uint64_t numberOfPooledBuffers = 0;
+        uint64_t numberOfUnpooledBuffers = 0;
+    };
+
+    /// A quota of zero solely tracks the memory of the query. The account has to be owned by a shared_ptr.
+    explicit MemoryAccount(uint64_t quotaInBytes, std::shared_ptr<MemoryAccount> parent = nullptr);
+
+    /// Charges the buffer to the account until it is recycled. Returns false, without charging the buffer, if the buffer exceeds the quota
+    /// of the account or of one of its parents.
+    [[nodiscard]] bool tryCharge(const TupleBuffer& buffer, Allocation allocation = Allocation::POOLED);
+
+    [[nodiscard]] uint64_t getUsedBytes() const;
+    /// Maximum of the used bytes since the account was created
+    [[nodiscard]] uint64_t getPeakBytes() const;
+    [[nodiscard]] uint64_t getQuotaInBytes() const;
+    [[nodiscard]] Usage getUsage() const;
+    /// Maxima of the individual counters since the account was created, which the account did not necessarily reach at the same time
+    [[nodiscard]] Usage getPeakUsage() const;
+
+private:
+    friend class detail::BufferControlBlock;
+    bool tryReserve(uint64_t numberOfBytes, Allocation allocation);
+    void release(uint64_t numberOfBytes, Allocation allocation);
+
+    std::shared_ptr<MemoryAccount> parent;
+    uint64_t quotaInBytes;
+    std::atomic<uint64_t> usedBytes{0};
+    std::atomic<uint64_t> peakBytes{0};
+    std::atomic<uint64_t> numberOfPooledBuffers{0};
+    std::atomic<uint64_t> peakNumberOfPooledBuffers{0};
+    std::atomic<uint64_t> numberOfUnpooledBuffers{0};
+    std::atomic<uint64_t> peakNumberOfUnpooledBuffers{0};
+};
+
+}
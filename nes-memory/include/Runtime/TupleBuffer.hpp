@@ -73,6 +73,8 @@ class TupleBuffer
     friend class FixedSizeBufferPool;
     friend class LocalBufferPool;
     friend class detail::MemorySegment;
+    /// Charges the control block of the buffer
+    friend class MemoryAccount;
 
     [[nodiscard]] explicit TupleBuffer(detail::BufferControlBlock* controlBlock, uint8_t* ptr, uint32_t size) noexcept
         : controlBlock(controlBlock), ptr(ptr), size(size)
@@ -84,6 +86,10 @@ public:
     /// @brief Default constructor creates an empty wrapper around nullptr without controlBlock (nullptr) and size 0.
     [[nodiscard]] TupleBuffer() noexcept = default;
 
+    /// @brief Wraps externally managed memory, e.g., a memory-mapped region of a file, without copying it.
+    /// The memory must remain valid until the last TupleBuffer that references it is released, which calls 'onRelease'.
+    [[nodiscard]] static TupleBuffer wrapMemory(uint8_t* ptr, uint32_t size, std::function<void()> onRelease);
+
 
     /// @brief Copy constructor: Increase the reference count associated to the control buffer.
     [[nodiscard]] TupleBuffer(const TupleBuffer& other) noexcept;
@@ -152,7 +158,11 @@ public:
     [[nodiscard]] Timestamp getWatermark() const noexcept;
     void setWatermark(Timestamp value) noexcept;
 
+    /// The creation timestamp is the ingestion timestamp of the oldest data in the buffer. Sources set it when they fill the buffer, all
+    /// operators propagate it to the buffers they emit.
     [[nodiscard]] Timestamp getCreationTimestampInMS() const noexcept;
+    /// Ingestion timestamp of the latest data in the buffer, which is at least the creation timestamp
+    [[nodiscard]] Timestamp getLatestCreationTimestampInMS() const noexcept;
     void setSequenceNumber(SequenceNumber sequenceNumber) noexcept;
 
     [[nodiscard]] std::string getSequenceDataAsString() const noexcept;
@@ -169,6 +179,7 @@ public:
     [[nodiscard]] bool isLastChunk() const noexcept;
 
     void setCreationTimestampInMS(Timestamp value) noexcept;
+    void setLatestCreationTimestampInMS(Timestamp value) noexcept;
 
     [[nodiscard]] OriginId getOriginId() const noexcept;
     void setOriginId(OriginId id) noexcept;
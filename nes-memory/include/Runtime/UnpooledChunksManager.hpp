@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <iosfwd>
@@ -35,6 +36,10 @@ namespace NES
 
 
 /// Stores and tracks all memory chunks for unpooled / variable sized buffers
+///
+/// Every thread allocates from its own chunk, thus allocating an unpooled buffer does not require any synchronization with other
+/// threads. Recycling an unpooled buffer, which may happen on any thread, only decrements the reference counter of its chunk.
+/// The only lock is taken the first time a thread requests an unpooled buffer from this manager.
 class UnpooledChunksManager
 {
     static constexpr auto NUM_PRE_ALLOCATED_CHUNKS = 10;
@@ -43,53 +48,70 @@ class UnpooledChunksManager
     /// Needed for allocating and deallocating memory
     std::shared_ptr<std::pmr::memory_resource> memoryResource;
 
-    /// Helper struct that stores necessary information for accessing unpooled chunks
     /// Instead of allocating the exact needed space, we allocate a chunk of a space calculated by a rolling average of the last n sizes.
     /// Thus, we (pre-)allocate potentially multiple buffers. At least, there is a high chance that one chunk contains multiple tuple buffers
+    ///
+    /// A chunk is reference counted. Every active memory segment holds one reference and the owning thread holds one reference as long
+    /// as it allocates from the chunk. Once the owning thread moves on to a new chunk, the chunk is retired and whoever releases the
+    /// last reference deallocates it. Memory segments are only added by the owning thread while it still holds its reference.
     struct UnpooledChunk
     {
-        struct ChunkControlBlock
+        UnpooledChunk(
+            std::shared_ptr<std::pmr::memory_resource> memoryResource,
+            uint8_t* startOfChunk,
+            size_t totalSize,
+            size_t alignment,
+            std::shared_ptr<std::atomic<uint64_t>> activeMemorySegments);
+
+        /// Drops one reference and deallocates the chunk if it was the last one
+        void release();
+
+        std::shared_ptr<std::pmr::memory_resource> memoryResource;
+        uint8_t* startOfChunk = nullptr;
+        size_t totalSize = 0;
+        size_t alignment = 0;
+        /// Only accessed by the owning thread
+        size_t usedSize = 0;
+        std::vector<std::unique_ptr<detail::MemorySegment>> unpooledMemorySegments;
+        /// Starts with the reference of the owning thread
+        std::atomic<uint64_t> references{1};
+        /// Counter of all active memory segments of the UnpooledChunksManager
+        std::shared_ptr<std::atomic<uint64_t>> activeMemorySegments;
+
+        friend std::ostream& operator<<(std::ostream& os, const UnpooledChunk& chunk)
         {
-            size_t totalSize = 0;
-            size_t usedSize = 0;
-            uint8_t* startOfChunk = nullptr;
-            std::vector<std::unique_ptr<detail::MemorySegment>> unpooledMemorySegments;
-            uint64_t activeMemorySegments = 0;
-
-            friend std::ostream& operator<<(std::ostream& os, const ChunkControlBlock& chunkControlBlock)
-            {
-                return os << fmt::format(
-                           "CCB {} ({}/{}B) with {} activeMemorySegments",
-                           fmt::ptr(chunkControlBlock.startOfChunk),
-                           chunkControlBlock.usedSize,
-                           chunkControlBlock.totalSize,
-                           chunkControlBlock.activeMemorySegments);
-            }
-        };
-
-        explicit UnpooledChunk(uint64_t windowSize);
-        void emplaceChunkControlBlock(uint8_t* chunkKey, std::unique_ptr<detail::MemorySegment> newMemorySegment);
-        std::unordered_map<uint8_t*, ChunkControlBlock> chunks;
-        uint8_t* lastAllocateChunkKey;
-        RollingAverage<size_t> rollingAverage;
+            return os << fmt::format(
+                       "Chunk {} ({}/{}B) with {} references", fmt::ptr(chunk.startOfChunk), chunk.usedSize, chunk.totalSize, chunk.references.load());
+        }
     };
 
-    /// UnpooledBufferData is a shared_ptr, as we pass a shared_ptr to anyone that requires access to an unpooled buffer chunk
-    folly::Synchronized<std::unordered_map<std::thread::id, std::shared_ptr<folly::Synchronized<UnpooledChunk>>>> allLocalUnpooledBuffers;
+    /// Allocation state of a single thread. It is only accessed by its thread.
+    struct ThreadLocalChunks
+    {
+        UnpooledChunk* currentChunk = nullptr;
+        RollingAverage<size_t> rollingAverage{ROLLING_AVERAGE_UNPOOLED_BUFFER_SIZE};
+    };
 
-    /// Returns two pointers wrapped in a pair
-    /// std::get<0>: the key that is being used in the unordered_map of a ChunkControlBlock
-    /// std::get<1>: pointer to the memory address that is large enough for neededSize
-    std::pair<uint8_t*, uint8_t*> allocateSpace(std::thread::id threadId, size_t neededSize, size_t alignment);
+    /// Distinguishes UnpooledChunksManagers in the thread local lookup cache, as addresses may be reused
+    const uint64_t managerId;
+    std::shared_ptr<std::atomic<uint64_t>> activeMemorySegments;
+    folly::Synchronized<std::unordered_map<std::thread::id, std::unique_ptr<ThreadLocalChunks>>> allLocalUnpooledBuffers;
 
-    std::shared_ptr<folly::Synchronized<UnpooledChunk>> getChunk(std::thread::id threadId);
+    /// Returns the chunk with enough space for neededSize and the memory address within the chunk
+    std::pair<UnpooledChunk*, uint8_t*> allocateSpace(ThreadLocalChunks& localChunks, size_t neededSize, size_t alignment);
+
+    ThreadLocalChunks& getThreadLocalChunks();
 
 public:
     explicit UnpooledChunksManager(std::shared_ptr<std::pmr::memory_resource> memoryResource);
+    ~UnpooledChunksManager();
+    UnpooledChunksManager(const UnpooledChunksManager&) = delete;
+    UnpooledChunksManager& operator=(const UnpooledChunksManager&) = delete;
+
     size_t getNumberOfUnpooledBuffers() const;
     TupleBuffer getUnpooledBuffer(size_t neededSize, size_t alignment, const std::shared_ptr<BufferRecycler>& bufferRecycler);
 };
 
 }
 
-FMT_OSTREAM(NES::UnpooledChunksManager::UnpooledChunk::ChunkControlBlock);
+FMT_OSTREAM(NES::UnpooledChunksManager::UnpooledChunk);
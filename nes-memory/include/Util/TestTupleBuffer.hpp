@@ -424,9 +424,8 @@ private:
         {
             if constexpr (IsString<typename std::tuple_element<I, std::tuple<Types...>>::type>)
             {
-                const VariableSizedAccess childBufferIdx{
-                    *reinterpret_cast<uint64_t*>(const_cast<uint8_t*>((*this)[recordIndex][I].getMemory().data()))};
-                std::get<I>(record) = MemoryLayout::readVarSizedDataAsString(this->buffer, childBufferIdx);
+                const auto field = std::as_bytes((*this)[recordIndex][I].getMemory()).template first<sizeof(VariableSizedAccess)>();
+                std::get<I>(record) = MemoryLayout::readVarSizedFieldAsString(this->buffer, field);
             }
             else
             {
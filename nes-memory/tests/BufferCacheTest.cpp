@@ -0,0 +1,104 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <Runtime/Allocator/NesDefaultMemoryAllocator.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <gtest/gtest.h>
+
+namespace NES
+{
+
+namespace
+{
+constexpr size_t BUFFER_SIZE = 1024;
+constexpr size_t NUMBER_OF_BUFFERS = 128;
+constexpr size_t BUFFER_CACHE_SIZE = 16;
+
+std::shared_ptr<BufferManager> createCachingBufferManager()
+{
+    return BufferManager::create(
+        BUFFER_SIZE,
+        NUMBER_OF_BUFFERS,
+        std::make_shared<NesDefaultMemoryAllocator>(),
+        BufferManager::DEFAULT_ALIGNMENT,
+        BUFFER_CACHE_SIZE);
+}
+}
+
+TEST(BufferCacheTest, CachedBuffersAreAvailable)
+{
+    auto bufferManager = createCachingBufferManager();
+    {
+        std::vector<TupleBuffer> buffers;
+        for (size_t i = 0; i < BUFFER_CACHE_SIZE; ++i)
+        {
+            buffers.push_back(bufferManager->getBufferBlocking());
+        }
+        EXPECT_EQ(bufferManager->getNumberOfAvailableBuffers(), NUMBER_OF_BUFFERS - BUFFER_CACHE_SIZE);
+    }
+    /// Released buffers end up in the cache of this thread, but still count as available
+    EXPECT_EQ(bufferManager->getNumberOfAvailableBuffers(), NUMBER_OF_BUFFERS);
+
+    /// Reallocating the buffers is served from the cache
+    const auto statisticsBefore = bufferManager->getBufferCacheStatistics();
+    {
+        std::vector<TupleBuffer> buffers;
+        for (size_t i = 0; i < BUFFER_CACHE_SIZE / 2; ++i)
+        {
+            buffers.push_back(bufferManager->getBufferBlocking());
+        }
+    }
+    EXPECT_GT(bufferManager->getBufferCacheStatistics().hits, statisticsBefore.hits);
+}
+
+TEST(BufferCacheTest, AllBuffersCanBeAllocatedAcrossThreads)
+{
+    auto bufferManager = createCachingBufferManager();
+
+    /// Every thread fills its cache by allocating and releasing buffers
+    {
+        std::vector<std::jthread> threads;
+        for (size_t thread = 0; thread < 4; ++thread)
+        {
+            threads.emplace_back(
+                [&bufferManager]
+                {
+                    std::vector<TupleBuffer> buffers;
+                    for (size_t i = 0; i < BUFFER_CACHE_SIZE; ++i)
+                    {
+                        buffers.push_back(bufferManager->getBufferBlocking());
+                    }
+                });
+        }
+    }
+
+    /// A single thread has to be able to allocate the entire pool, including the buffers cached by other threads
+    std::vector<TupleBuffer> buffers;
+    for (size_t i = 0; i < NUMBER_OF_BUFFERS; ++i)
+    {
+        auto buffer = bufferManager->getBufferNoBlocking();
+        ASSERT_TRUE(buffer.has_value()) << "Could only allocate " << i << " buffers";
+        buffers.push_back(std::move(*buffer));
+    }
+    EXPECT_FALSE(bufferManager->getBufferNoBlocking().has_value());
+}
+
+}
@@ -0,0 +1,94 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <vector>
+#include <Runtime/Allocator/NesDefaultMemoryAllocator.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <gtest/gtest.h>
+
+namespace NES
+{
+
+namespace
+{
+constexpr size_t SMALL_SIZE_CLASS = 8 * 1024;
+constexpr size_t LARGE_SIZE_CLASS = 64 * 1024;
+constexpr size_t BUFFERS_PER_SIZE_CLASS = 4;
+
+std::shared_ptr<BufferManager> createBufferManagerWithSizeClasses()
+{
+    /// The size classes are intentionally not ordered
+    return BufferManager::create(
+        BufferManager::DEFAULT_BUFFER_SIZE,
+        16,
+        std::make_shared<NesDefaultMemoryAllocator>(),
+        BufferManager::DEFAULT_ALIGNMENT,
+        0,
+        {{LARGE_SIZE_CLASS, BUFFERS_PER_SIZE_CLASS}, {SMALL_SIZE_CLASS, BUFFERS_PER_SIZE_CLASS}});
+}
+}
+
+TEST(BufferSizeClassTest, UnpooledBuffersAreServedFromTheSmallestFittingSizeClass)
+{
+    auto bufferManager = createBufferManagerWithSizeClasses();
+    {
+        auto small = bufferManager->getUnpooledBuffer(100);
+        auto large = bufferManager->getUnpooledBuffer(SMALL_SIZE_CLASS + 1);
+        ASSERT_TRUE(small.has_value());
+        ASSERT_TRUE(large.has_value());
+        EXPECT_EQ(small->getBufferSize(), SMALL_SIZE_CLASS);
+        EXPECT_EQ(large->getBufferSize(), LARGE_SIZE_CLASS);
+
+        const auto occupancy = bufferManager->getSizeClassOccupancy();
+        ASSERT_EQ(occupancy.size(), 2);
+        EXPECT_EQ(occupancy[0].bufferSize, SMALL_SIZE_CLASS);
+        EXPECT_EQ(occupancy[0].numberOfBuffers, BUFFERS_PER_SIZE_CLASS);
+        EXPECT_EQ(occupancy[0].numberOfAvailableBuffers, BUFFERS_PER_SIZE_CLASS - 1);
+        EXPECT_EQ(occupancy[1].bufferSize, LARGE_SIZE_CLASS);
+        EXPECT_EQ(occupancy[1].numberOfAvailableBuffers, BUFFERS_PER_SIZE_CLASS - 1);
+        EXPECT_EQ(bufferManager->getNumOfUnpooledBuffers(), 0);
+    }
+    for (const auto& sizeClass : bufferManager->getSizeClassOccupancy())
+    {
+        EXPECT_EQ(sizeClass.numberOfAvailableBuffers, sizeClass.numberOfBuffers);
+    }
+}
+
+TEST(BufferSizeClassTest, ExhaustedSizeClassFallsBackToUnpooledChunks)
+{
+    auto bufferManager = createBufferManagerWithSizeClasses();
+    std::vector<TupleBuffer> buffers;
+    for (size_t i = 0; i < BUFFERS_PER_SIZE_CLASS; ++i)
+    {
+        buffers.push_back(bufferManager->getUnpooledBuffer(SMALL_SIZE_CLASS).value());
+    }
+    EXPECT_EQ(bufferManager->getSizeClassOccupancy()[0].numberOfAvailableBuffers, 0);
+
+    /// Small requests must not drain the larger size class
+    auto fallback = bufferManager->getUnpooledBuffer(SMALL_SIZE_CLASS);
+    ASSERT_TRUE(fallback.has_value());
+    EXPECT_GE(fallback->getBufferSize(), SMALL_SIZE_CLASS);
+    EXPECT_EQ(bufferManager->getSizeClassOccupancy()[1].numberOfAvailableBuffers, BUFFERS_PER_SIZE_CLASS);
+
+    /// Requests which exceed all size classes are always served by the unpooled chunks
+    auto huge = bufferManager->getUnpooledBuffer(LARGE_SIZE_CLASS + 1);
+    ASSERT_TRUE(huge.has_value());
+    EXPECT_GE(huge->getBufferSize(), LARGE_SIZE_CLASS + 1);
+}
+
+}
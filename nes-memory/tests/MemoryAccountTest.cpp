@@ -0,0 +1,124 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Runtime/MemoryAccount.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <vector>
+#include <Runtime/AccountedBufferProvider.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <gtest/gtest.h>
+#include <ErrorHandling.hpp>
+
+namespace NES
+{
+
+namespace
+{
+constexpr size_t BUFFER_SIZE = 1024;
+constexpr size_t NUMBER_OF_BUFFERS = 16;
+}
+
+TEST(MemoryAccountTest, BuffersAreChargedUntilTheyAreRecycled)
+{
+    auto bufferManager = BufferManager::create(BUFFER_SIZE, NUMBER_OF_BUFFERS);
+    const auto account = std::make_shared<MemoryAccount>(0);
+    AccountedBufferProvider provider(bufferManager, account);
+    {
+        auto buffer = provider.getBufferBlocking();
+        auto copy = buffer;
+        {
+            const auto other = provider.getBufferNoBlocking();
+            ASSERT_TRUE(other.has_value());
+            EXPECT_EQ(account->getUsedBytes(), 2 * BUFFER_SIZE);
+        }
+        /// The account is credited once the last reference of a buffer is released
+        buffer = {};
+        EXPECT_EQ(account->getUsedBytes(), BUFFER_SIZE);
+    }
+    EXPECT_EQ(account->getUsedBytes(), 0);
+    EXPECT_EQ(account->getPeakBytes(), 2 * BUFFER_SIZE);
+    EXPECT_EQ(bufferManager->getNumberOfAvailableBuffers(), NUMBER_OF_BUFFERS);
+}
+
+TEST(MemoryAccountTest, ChildBuffersAreCreditedWithTheirParent)
+{
+    auto bufferManager = BufferManager::create(BUFFER_SIZE, NUMBER_OF_BUFFERS);
+    const auto account = std::make_shared<MemoryAccount>(0);
+    AccountedBufferProvider provider(bufferManager, account);
+    {
+        auto parent = provider.getBufferBlocking();
+        auto child = provider.getUnpooledBuffer(4 * BUFFER_SIZE);
+        ASSERT_TRUE(child.has_value());
+        const auto childSize = child->getBufferSize();
+        [[maybe_unused]] const auto index = parent.storeChildBuffer(*child);
+        child.reset();
+        EXPECT_EQ(account->getUsedBytes(), BUFFER_SIZE + childSize);
+    }
+    EXPECT_EQ(account->getUsedBytes(), 0);
+}
+
+TEST(MemoryAccountTest, AllocationsBeyondTheQuotaFail)
+{
+    auto bufferManager = BufferManager::create(BUFFER_SIZE, NUMBER_OF_BUFFERS);
+    const auto account = std::make_shared<MemoryAccount>(2 * BUFFER_SIZE);
+    AccountedBufferProvider provider(bufferManager, account);
+
+    std::vector<TupleBuffer> buffers;
+    buffers.push_back(provider.getBufferBlocking());
+    buffers.push_back(provider.getBufferBlocking());
+    EXPECT_THROW(static_cast<void>(provider.getBufferBlocking()), Exception);
+    EXPECT_THROW(static_cast<void>(provider.getUnpooledBuffer(BUFFER_SIZE)), Exception);
+
+    /// The rejected buffers are returned to the buffer manager, which other queries keep allocating from
+    EXPECT_EQ(account->getUsedBytes(), 2 * BUFFER_SIZE);
+    EXPECT_EQ(bufferManager->getNumberOfAvailableBuffers(), NUMBER_OF_BUFFERS - 2);
+
+    buffers.pop_back();
+    EXPECT_NO_THROW(buffers.push_back(provider.getBufferBlocking()));
+}
+
+TEST(MemoryAccountTest, ChildAccountsChargeTheirParent)
+{
+    auto bufferManager = BufferManager::create(BUFFER_SIZE, NUMBER_OF_BUFFERS);
+    const auto queryAccount = std::make_shared<MemoryAccount>(3 * BUFFER_SIZE);
+    const auto pipelineAccount = std::make_shared<MemoryAccount>(0, queryAccount);
+    AccountedBufferProvider queryProvider(bufferManager, queryAccount);
+    AccountedBufferProvider pipelineProvider(bufferManager, pipelineAccount);
+    {
+        const auto pooled = pipelineProvider.getBufferBlocking();
+        const auto unpooled = pipelineProvider.getUnpooledBuffer(BUFFER_SIZE);
+        ASSERT_TRUE(unpooled.has_value());
+        const auto other = queryProvider.getBufferBlocking();
+
+        EXPECT_EQ(pipelineAccount->getUsage().numberOfPooledBuffers, 1);
+        EXPECT_EQ(pipelineAccount->getUsage().numberOfUnpooledBuffers, 1);
+        EXPECT_EQ(queryAccount->getUsage().numberOfPooledBuffers, 2);
+        EXPECT_EQ(queryAccount->getUsedBytes(), pipelineAccount->getUsedBytes() + BUFFER_SIZE);
+
+        /// The child is bound by the quota of its parent
+        EXPECT_THROW(static_cast<void>(pipelineProvider.getBufferBlocking()), Exception);
+        EXPECT_EQ(pipelineAccount->getUsage().numberOfPooledBuffers, 1);
+    }
+    EXPECT_EQ(queryAccount->getUsedBytes(), 0);
+    EXPECT_EQ(pipelineAccount->getUsage().bytes, 0);
+    EXPECT_EQ(pipelineAccount->getUsage().numberOfUnpooledBuffers, 0);
+    EXPECT_EQ(pipelineAccount->getPeakUsage().numberOfPooledBuffers, 1);
+    EXPECT_EQ(queryAccount->getPeakUsage().numberOfPooledBuffers, 2);
+}
+
+}
@@ -0,0 +1,68 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <Runtime/Allocator/NesMmapMemoryAllocator.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <gtest/gtest.h>
+
+namespace NES
+{
+
+class MmapMemoryAllocatorTest : public ::testing::TestWithParam<HugePagePolicy>
+{
+};
+
+TEST_P(MmapMemoryAllocatorTest, BufferPoolIsUsable)
+{
+    constexpr size_t bufferSize = 4096;
+    constexpr size_t numberOfBuffers = 1024;
+    auto bufferManager = BufferManager::create(bufferSize, numberOfBuffers, std::make_shared<NesMmapMemoryAllocator>(GetParam()));
+
+    std::vector<TupleBuffer> buffers;
+    for (size_t i = 0; i < numberOfBuffers; ++i)
+    {
+        auto buffer = bufferManager->getBufferBlocking();
+        const auto memory = buffer.getAvailableMemoryArea<uint8_t>();
+        std::memset(memory.data(), static_cast<int>(i % 256), memory.size());
+        buffers.push_back(std::move(buffer));
+    }
+    for (size_t i = 0; i < numberOfBuffers; ++i)
+    {
+        EXPECT_EQ(buffers[i].getAvailableMemoryArea<uint8_t>()[bufferSize - 1], static_cast<uint8_t>(i % 256));
+    }
+}
+
+TEST_P(MmapMemoryAllocatorTest, SmallAllocationsAreNotMapped)
+{
+    NesMmapMemoryAllocator allocator(GetParam());
+    auto* memory = static_cast<uint8_t*>(allocator.allocate(128, 64));
+    ASSERT_NE(memory, nullptr);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(memory) % 64, 0);
+    std::memset(memory, 1, 128);
+    allocator.deallocate(memory, 128, 64);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    HugePagePolicies,
+    MmapMemoryAllocatorTest,
+    ::testing::Values(HugePagePolicy::NONE, HugePagePolicy::TRANSPARENT, HugePagePolicy::EXPLICIT));
+
+}
@@ -0,0 +1,73 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <Nautilus/DataTypes/VarVal.hpp>
+#include <Nautilus/Interface/Hash/HashFunction.hpp>
+#include <benchmark/benchmark.h>
+#include <magic_enum/magic_enum.hpp>
+#include <nautilus/Engine.hpp>
+
+/// This Benchmark measures the throughput of the compiled hash functions, which hash the keys of every hash map and hash join.
+/// A compiled loop hashes consecutive keys and combines the hashes, thus the benchmark solely measures the hash function and not the call
+/// into the compiled code.
+
+namespace
+{
+using NES::Nautilus::Interface::HashFunction;
+using NES::Nautilus::Interface::HashFunctionType;
+
+constexpr uint64_t NUMBER_OF_KEYS = 1'000'000;
+}
+
+static void BM_HashKeys(benchmark::State& state)
+{
+    const auto hashFunctionType = static_cast<HashFunctionType>(state.range(0));
+    state.SetLabel(std::string(magic_enum::enum_name(hashFunctionType)));
+    const auto hashFunction = HashFunction::create(hashFunctionType);
+
+    nautilus::engine::Options options;
+    options.setOption("engine.Compilation", true);
+    options.setOption("mlir.enableMultithreading", false);
+    const nautilus::engine::NautilusEngine engine(options);
+    /// NOLINTBEGIN(performance-unnecessary-value-param)
+    auto hashKeys = engine.registerFunction(std::function(
+        [&hashFunction](nautilus::val<uint64_t> numberOfKeys) -> nautilus::val<uint64_t>
+        {
+            nautilus::val<uint64_t> combinedHashes = 0;
+            for (nautilus::val<uint64_t> key = 0; key < numberOfKeys; key = key + 1)
+            {
+                combinedHashes = combinedHashes ^ hashFunction->calculate(NES::Nautilus::VarVal(key));
+            }
+            return combinedHashes;
+        }));
+    /// NOLINTEND(performance-unnecessary-value-param)
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(hashKeys(NUMBER_OF_KEYS));
+    }
+    state.SetItemsProcessed(state.iterations() * NUMBER_OF_KEYS);
+    state.SetBytesProcessed(state.iterations() * NUMBER_OF_KEYS * sizeof(uint64_t));
+}
+
+BENCHMARK(BM_HashKeys)
+    ->Arg(static_cast<int64_t>(HashFunctionType::MURMUR3))
+    ->Arg(static_cast<int64_t>(HashFunctionType::CRC32))
+    ->Arg(static_cast<int64_t>(HashFunctionType::XXH3))
+    ->Unit(benchmark::kMillisecond);
+/// Run the benchmark
+BENCHMARK_MAIN();
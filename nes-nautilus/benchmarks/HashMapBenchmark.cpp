@@ -0,0 +1,201 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+#include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMap.hpp>
+#include <Nautilus/Interface/HashMap/OpenAddressingHashMap/OpenAddressingHashMap.hpp>
+#include <Runtime/AbstractBufferProvider.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <benchmark/benchmark.h>
+
+/// This Benchmark compares the ChainedHashMap with the OpenAddressingHashMap for a GROUP BY key COUNT(*) aggregation and for the probe
+/// phase of a hash join, i.e., solely lookups of existing keys. The lookups mirror the findKey() of the corresponding nautilus wrappers.
+/// With an increasing number of keys, the hash maps exceed the caches and the number of cache misses per lookup dominates the throughput.
+/// Prefetching the buckets of a group of keys before their lookups overlaps these cache misses.
+
+namespace
+{
+using NES::Nautilus::Interface::ChainedHashMap;
+using NES::Nautilus::Interface::ChainedHashMapEntry;
+using NES::Nautilus::Interface::OpenAddressingHashMap;
+
+constexpr uint64_t PAGE_SIZE = 4096;
+constexpr uint64_t MIN_NUMBER_OF_RECORDS = 1'000'000;
+
+struct KeyValue
+{
+    uint64_t key;
+    uint64_t count;
+};
+
+/// Finalizer of MurMur3, which the MurMur3HashFunction applies to the keys as well
+uint64_t hashKey(uint64_t key)
+{
+    key ^= key >> 33U;
+    key *= 0xff51afd7ed558ccdULL;
+    key ^= key >> 33U;
+    key *= 0xc4ceb9fe1a85ec53ULL;
+    key ^= key >> 33U;
+    return key;
+}
+
+KeyValue* getKeyValue(ChainedHashMapEntry* entry)
+{
+    /// NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    return reinterpret_cast<KeyValue*>(reinterpret_cast<int8_t*>(entry) + sizeof(ChainedHashMapEntry));
+}
+
+KeyValue* findKey(const ChainedHashMap& hashMap, const uint64_t key, const uint64_t hash)
+{
+    for (auto* entry = hashMap.findChain(hash); entry != nullptr; entry = entry->next)
+    {
+        if (getKeyValue(entry)->key == key)
+        {
+            return getKeyValue(entry);
+        }
+    }
+    return nullptr;
+}
+
+KeyValue* findKey(const OpenAddressingHashMap& hashMap, const uint64_t key, const uint64_t hash)
+{
+    for (auto probePosition = hashMap.findCandidate(hash, 0); probePosition != OpenAddressingHashMap::NO_CANDIDATE;
+         probePosition = hashMap.findCandidate(hash, probePosition + 1))
+    {
+        if (auto* keyValue = getKeyValue(hashMap.getCandidate(hash, probePosition)); keyValue->key == key)
+        {
+            return keyValue;
+        }
+    }
+    return nullptr;
+}
+
+template <typename HashMap>
+void findOrInsert(HashMap& hashMap, const uint64_t key, NES::AbstractBufferProvider& bufferProvider)
+{
+    const auto hash = hashKey(key);
+    auto* keyValue = (hashMap.getNumberOfTuples() == 0) ? nullptr : findKey(hashMap, key, hash);
+    if (keyValue == nullptr)
+    {
+        keyValue = getKeyValue(static_cast<ChainedHashMapEntry*>(hashMap.insertEntry(hash, &bufferProvider)));
+        keyValue->key = key;
+        keyValue->count = 0;
+    }
+    ++keyValue->count;
+}
+
+/// Draws the keys of the records uniformly from [0, numberOfKeys)
+std::vector<uint64_t> createRecords(const uint64_t numberOfKeys)
+{
+    std::mt19937_64 generator(42);
+    std::uniform_int_distribution<uint64_t> distribution(0, numberOfKeys - 1);
+    std::vector<uint64_t> records(std::max(numberOfKeys, MIN_NUMBER_OF_RECORDS));
+    std::ranges::generate(records, [&] { return distribution(generator); });
+    return records;
+}
+}
+
+/// Aggregates all records into a new hash map, whose number of buckets matches the number of keys
+template <typename HashMap>
+static void BM_FindOrInsert(benchmark::State& state)
+{
+    const auto numberOfKeys = static_cast<uint64_t>(state.range(0));
+    const auto records = createRecords(numberOfKeys);
+    const auto bufferManager = NES::BufferManager::create();
+    for (auto _ : state)
+    {
+        HashMap hashMap(sizeof(KeyValue::key), sizeof(KeyValue::count), numberOfKeys, PAGE_SIZE);
+        for (const auto key : records)
+        {
+            findOrInsert(hashMap, key, *bufferManager);
+        }
+        benchmark::DoNotOptimize(hashMap.getNumberOfTuples());
+    }
+    state.SetItemsProcessed(state.iterations() * records.size());
+}
+
+/// Looks up the keys of all records in a hash map that contains all keys
+template <typename HashMap>
+static void BM_Lookup(benchmark::State& state)
+{
+    const auto numberOfKeys = static_cast<uint64_t>(state.range(0));
+    const auto records = createRecords(numberOfKeys);
+    const auto bufferManager = NES::BufferManager::create();
+    HashMap hashMap(sizeof(KeyValue::key), sizeof(KeyValue::count), numberOfKeys, PAGE_SIZE);
+    for (uint64_t key = 0; key < numberOfKeys; ++key)
+    {
+        findOrInsert(hashMap, key, *bufferManager);
+    }
+
+    for (auto _ : state)
+    {
+        for (const auto key : records)
+        {
+            benchmark::DoNotOptimize(findKey(hashMap, key, hashKey(key)));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * records.size());
+}
+
+/// Looks up the keys of all records in groups of PREFETCH_GROUP_SIZE, prefetching the buckets of a group before its lookups
+template <typename HashMap>
+static void BM_GroupPrefetchedLookup(benchmark::State& state)
+{
+    constexpr uint64_t PREFETCH_GROUP_SIZE = 16;
+    const auto numberOfKeys = static_cast<uint64_t>(state.range(0));
+    const auto records = createRecords(numberOfKeys);
+    const auto bufferManager = NES::BufferManager::create();
+    HashMap hashMap(sizeof(KeyValue::key), sizeof(KeyValue::count), numberOfKeys, PAGE_SIZE);
+    for (uint64_t key = 0; key < numberOfKeys; ++key)
+    {
+        findOrInsert(hashMap, key, *bufferManager);
+    }
+
+    std::array<uint64_t, PREFETCH_GROUP_SIZE> hashes{};
+    for (auto _ : state)
+    {
+        for (uint64_t groupStart = 0; groupStart < records.size(); groupStart += PREFETCH_GROUP_SIZE)
+        {
+            const auto groupSize = std::min(PREFETCH_GROUP_SIZE, records.size() - groupStart);
+            for (uint64_t i = 0; i < groupSize; ++i)
+            {
+                hashes[i] = hashKey(records[groupStart + i]);
+                hashMap.prefetchBucket(hashes[i]);
+            }
+            for (uint64_t i = 0; i < groupSize; ++i)
+            {
+                benchmark::DoNotOptimize(findKey(hashMap, records[groupStart + i], hashes[i]));
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * records.size());
+}
+
+BENCHMARK_TEMPLATE(BM_FindOrInsert, ChainedHashMap)->Arg(1'000)->Arg(100'000)->Arg(10'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_FindOrInsert, OpenAddressingHashMap)->Arg(1'000)->Arg(100'000)->Arg(10'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Lookup, ChainedHashMap)->Arg(1'000)->Arg(100'000)->Arg(10'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Lookup, OpenAddressingHashMap)->Arg(1'000)->Arg(100'000)->Arg(10'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_GroupPrefetchedLookup, ChainedHashMap)->Arg(1'000)->Arg(100'000)->Arg(10'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_GroupPrefetchedLookup, OpenAddressingHashMap)
+    ->Arg(1'000)
+    ->Arg(100'000)
+    ->Arg(10'000'000)
+    ->Unit(benchmark::kMillisecond);
+/// Run the benchmark
+BENCHMARK_MAIN();
@@ -0,0 +1,167 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedEntryMemoryProvider.hpp>
+#include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMap.hpp>
+#include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMapRef.hpp>
+#include <Nautilus/Interface/HashMap/HashMap.hpp>
+#include <Runtime/AbstractBufferProvider.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <benchmark/benchmark.h>
+#include <nautilus/Engine.hpp>
+
+/// This Benchmark measures the probe phase of the hash join via the compiled ChainedHashMapRef, i.e., iterating over all entries of the
+/// right hash map and looking up their keys in the left hash maps. It compares the probe with and without prefetching the buckets of the
+/// next right key, as the HJProbePhysicalOperator does. The argument is the number of keys in each hash map.
+
+namespace
+{
+using NES::Nautilus::Interface::ChainedHashMap;
+using NES::Nautilus::Interface::ChainedHashMapEntry;
+using NES::Nautilus::Interface::ChainedHashMapRef;
+using NES::Nautilus::Interface::HashMap;
+using NES::Nautilus::Interface::BufferRef::ChainedEntryMemoryProvider;
+
+constexpr uint64_t PAGE_SIZE = 4096;
+constexpr uint64_t NUMBER_OF_LEFT_HASH_MAPS = 4;
+
+struct KeyValue
+{
+    uint64_t key;
+    uint64_t value;
+};
+
+/// Finalizer of MurMur3, which the MurMur3HashFunction applies to the keys as well
+uint64_t hashKey(uint64_t key)
+{
+    key ^= key >> 33U;
+    key *= 0xff51afd7ed558ccdULL;
+    key ^= key >> 33U;
+    key *= 0xc4ceb9fe1a85ec53ULL;
+    key ^= key >> 33U;
+    return key;
+}
+
+const NES::Schema& schema()
+{
+    static const auto schema = NES::Schema{NES::Schema::MemoryLayoutType::ROW_LAYOUT}
+                                   .addField("key", NES::DataType::Type::UINT64)
+                                   .addField("value", NES::DataType::Type::UINT64);
+    return schema;
+}
+
+std::unique_ptr<nautilus::engine::NautilusEngine> createEngine()
+{
+    nautilus::engine::Options options;
+    options.setOption("engine.Compilation", true);
+    options.setOption("mlir.enableMultithreading", false);
+    return std::make_unique<nautilus::engine::NautilusEngine>(options);
+}
+
+/// Inserts the keys in their given order, thus the order of the entries on the pages of the hash map is the order of the keys
+std::unique_ptr<ChainedHashMap> createHashMap(const std::vector<uint64_t>& keys, NES::AbstractBufferProvider& bufferProvider)
+{
+    auto hashMap = std::make_unique<ChainedHashMap>(sizeof(KeyValue::key), sizeof(KeyValue::value), keys.size(), PAGE_SIZE);
+    for (const auto key : keys)
+    {
+        auto* entry = static_cast<ChainedHashMapEntry*>(hashMap->insertEntry(hashKey(key), &bufferProvider));
+        /// NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        *reinterpret_cast<KeyValue*>(reinterpret_cast<int8_t*>(entry) + sizeof(ChainedHashMapEntry)) = KeyValue{.key = key, .value = key};
+    }
+    return hashMap;
+}
+
+/// NOLINTBEGIN(performance-unnecessary-value-param)
+/// Mirrors the loop of HJProbePhysicalOperator::open() and counts the keys that the left hash maps contain
+auto compileProbe(const nautilus::engine::NautilusEngine& engine, const bool prefetch)
+{
+    const auto fieldOffsets = ChainedEntryMemoryProvider::createFieldOffsets(schema(), {"key"}, {"value"});
+    const auto fieldKeys = fieldOffsets.first;
+    const auto fieldValues = fieldOffsets.second;
+    const uint64_t entrySize = sizeof(ChainedHashMapEntry) + sizeof(KeyValue);
+    const uint64_t entriesPerPage = PAGE_SIZE / entrySize;
+    return engine.registerFunction(std::function(
+        [=](nautilus::val<HashMap**> leftHashMaps, nautilus::val<uint64_t> numberOfLeftHashMaps, nautilus::val<HashMap*> rightHashMapPtr)
+            -> nautilus::val<uint64_t>
+        {
+            nautilus::val<uint64_t> matches = 0;
+            const ChainedHashMapRef rightHashMap{rightHashMapPtr, fieldKeys, fieldValues, entriesPerPage, entrySize};
+            const auto rightEnd = rightHashMap.end();
+            for (auto rightIt = rightHashMap.begin(); rightIt != rightEnd; ++rightIt)
+            {
+                const ChainedHashMapRef::ChainedEntryRef rightEntryRef{*rightIt, rightHashMapPtr, fieldKeys, fieldValues};
+                if (prefetch)
+                {
+                    auto nextRightIt = rightIt;
+                    ++nextRightIt;
+                    if (nextRightIt != rightEnd)
+                    {
+                        const ChainedHashMapRef::ChainedEntryRef nextRightEntryRef{*nextRightIt, rightHashMapPtr, fieldKeys, fieldValues};
+                        ChainedHashMapRef::prefetchBuckets(leftHashMaps, numberOfLeftHashMaps, nextRightEntryRef.getHash());
+                    }
+                }
+                for (nautilus::val<uint64_t> leftHashMapIndex = 0; leftHashMapIndex < numberOfLeftHashMaps; ++leftHashMapIndex)
+                {
+                    const nautilus::val<HashMap*> leftHashMapPtr = leftHashMaps[leftHashMapIndex];
+                    ChainedHashMapRef leftHashMap{leftHashMapPtr, fieldKeys, fieldValues, entriesPerPage, entrySize};
+                    if (leftHashMap.findEntry(rightEntryRef.entryRef))
+                    {
+                        matches = matches + 1;
+                    }
+                }
+            }
+            return matches;
+        }));
+}
+/// NOLINTEND(performance-unnecessary-value-param)
+}
+
+/// Probes the left hash maps, which all contain the keys, with a right hash map that contains the same keys in a random order
+static void BM_Probe(benchmark::State& state, const bool prefetch)
+{
+    const auto numberOfKeys = static_cast<uint64_t>(state.range(0));
+    const auto bufferManager = NES::BufferManager::create();
+    std::vector<uint64_t> keys(numberOfKeys);
+    std::iota(keys.begin(), keys.end(), 0);
+    std::vector<std::unique_ptr<ChainedHashMap>> leftHashMaps;
+    std::vector<HashMap*> leftHashMapPtrs;
+    for (uint64_t index = 0; index < NUMBER_OF_LEFT_HASH_MAPS; ++index)
+    {
+        leftHashMaps.emplace_back(createHashMap(keys, *bufferManager));
+        leftHashMapPtrs.emplace_back(leftHashMaps.back().get());
+    }
+    std::ranges::shuffle(keys, std::mt19937_64(42));
+    const auto rightHashMap = createHashMap(keys, *bufferManager);
+
+    const auto engine = createEngine();
+    auto probe = compileProbe(*engine, prefetch);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(probe(leftHashMapPtrs.data(), leftHashMapPtrs.size(), rightHashMap.get()));
+    }
+    state.SetItemsProcessed(state.iterations() * numberOfKeys * NUMBER_OF_LEFT_HASH_MAPS);
+}
+
+BENCHMARK_CAPTURE(BM_Probe, WithoutPrefetching, false)->Arg(1'000)->Arg(100'000)->Arg(10'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_Probe, WithPrefetching, true)->Arg(1'000)->Arg(100'000)->Arg(10'000'000)->Unit(benchmark::kMillisecond);
+/// Run the benchmark
+BENCHMARK_MAIN();
@@ -0,0 +1,135 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Nautilus/DataTypes/VarVal.hpp>
+#include <Nautilus/Interface/BufferRef/TupleBufferRef.hpp>
+#include <Nautilus/Interface/PagedVector/PagedVector.hpp>
+#include <Nautilus/Interface/PagedVector/PagedVectorRef.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <Runtime/AbstractBufferProvider.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <benchmark/benchmark.h>
+#include <nautilus/Engine.hpp>
+
+/// This Benchmark measures appending records to and iterating over the PagedVector via the compiled PagedVectorRef, as the nested loop
+/// join and the window operators do. The argument is the number of records, whose two 8 byte fields fill 256 records per page.
+
+namespace
+{
+using NES::Nautilus::Record;
+using NES::Nautilus::VarVal;
+using NES::Nautilus::Interface::PagedVector;
+using NES::Nautilus::Interface::PagedVectorRef;
+using NES::Nautilus::Interface::BufferRef::TupleBufferRef;
+
+constexpr uint64_t PAGE_SIZE = 4096;
+
+const NES::Schema& schema()
+{
+    static const auto schema = NES::Schema{NES::Schema::MemoryLayoutType::ROW_LAYOUT}
+                                   .addField("key", NES::DataType::Type::UINT64)
+                                   .addField("value", NES::DataType::Type::UINT64);
+    return schema;
+}
+
+std::unique_ptr<nautilus::engine::NautilusEngine> createEngine()
+{
+    nautilus::engine::Options options;
+    options.setOption("engine.Compilation", true);
+    options.setOption("mlir.enableMultithreading", false);
+    return std::make_unique<nautilus::engine::NautilusEngine>(options);
+}
+
+/// NOLINTBEGIN(performance-unnecessary-value-param)
+auto compileAppend(const nautilus::engine::NautilusEngine& engine, const std::shared_ptr<TupleBufferRef>& bufferRef)
+{
+    return engine.registerFunction(std::function(
+        [bufferRef](
+            nautilus::val<PagedVector*> pagedVector, nautilus::val<NES::AbstractBufferProvider*> bufferProvider, nautilus::val<uint64_t> n)
+        {
+            const PagedVectorRef pagedVectorRef(pagedVector, bufferRef);
+            for (nautilus::val<uint64_t> i = 0; i < n; i = i + 1)
+            {
+                Record record;
+                record.write("key", VarVal(i));
+                record.write("value", VarVal(i));
+                pagedVectorRef.writeRecord(record, bufferProvider);
+            }
+        }));
+}
+
+auto compileSum(const nautilus::engine::NautilusEngine& engine, const std::shared_ptr<TupleBufferRef>& bufferRef)
+{
+    return engine.registerFunction(std::function(
+        [bufferRef](nautilus::val<PagedVector*> pagedVector) -> nautilus::val<uint64_t>
+        {
+            const PagedVectorRef pagedVectorRef(pagedVector, bufferRef);
+            const std::vector<Record::RecordFieldIdentifier> projections{"value"};
+            nautilus::val<uint64_t> sum = 0;
+            for (auto it = pagedVectorRef.begin(projections); it != pagedVectorRef.end(projections); ++it)
+            {
+                const auto record = *it;
+                sum = sum + record.read("value").cast<nautilus::val<uint64_t>>();
+            }
+            return sum;
+        }));
+}
+/// NOLINTEND(performance-unnecessary-value-param)
+}
+
+/// Appends all records to a new PagedVector, which allocates its pages while growing
+static void BM_Append(benchmark::State& state)
+{
+    const auto numberOfRecords = static_cast<uint64_t>(state.range(0));
+    const auto bufferManager = NES::BufferManager::create();
+    const auto engine = createEngine();
+    auto append = compileAppend(*engine, TupleBufferRef::create(PAGE_SIZE, schema()));
+    for (auto _ : state)
+    {
+        PagedVector pagedVector;
+        append(&pagedVector, bufferManager.get(), numberOfRecords);
+        benchmark::DoNotOptimize(pagedVector.getTotalNumberOfEntries());
+    }
+    state.SetItemsProcessed(state.iterations() * numberOfRecords);
+    state.SetBytesProcessed(state.iterations() * numberOfRecords * schema().getSizeOfSchemaInBytes());
+}
+
+/// Iterates over all records of a PagedVector and sums up one of their fields
+static void BM_Iterate(benchmark::State& state)
+{
+    const auto numberOfRecords = static_cast<uint64_t>(state.range(0));
+    const auto bufferManager = NES::BufferManager::create();
+    const auto engine = createEngine();
+    const auto bufferRef = TupleBufferRef::create(PAGE_SIZE, schema());
+    auto append = compileAppend(*engine, bufferRef);
+    auto sum = compileSum(*engine, bufferRef);
+    PagedVector pagedVector;
+    append(&pagedVector, bufferManager.get(), numberOfRecords);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(sum(&pagedVector));
+    }
+    state.SetItemsProcessed(state.iterations() * numberOfRecords);
+    state.SetBytesProcessed(state.iterations() * numberOfRecords * schema().getSizeOfSchemaInBytes());
+}
+
+BENCHMARK(BM_Append)->Arg(1'000)->Arg(100'000)->Arg(10'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Iterate)->Arg(1'000)->Arg(100'000)->Arg(10'000'000)->Unit(benchmark::kMillisecond);
+/// Run the benchmark
+BENCHMARK_MAIN();
@@ -32,6 +32,26 @@ namespace NES::Nautilus
 #define DEFINE_OPERATOR_VAR_VAL_BINARY(operatorName, op) \
     VarVal operatorName(const VarVal& rhs) const \
     { \
+        /* Operands of the same type, e.g., the operands of comparisons after lowering, solely dispatch over the type of one operand */ \
+        if (this->value.index() == rhs.value.index()) \
+        { \
+            return std::visit( \
+                [&]<typename T>(const T& lhsVal) \
+                { \
+                    if constexpr (requires(T l, T r) { l op r; }) \
+                    { \
+                        return detail::var_val_t(lhsVal op *std::get_if<T>(&rhs.value)); \
+                    } \
+                    else \
+                    { \
+                        throw UnknownOperation( \
+                            std::string("VarVal operation not implemented: ") + " " + #operatorName + " " + typeid(T).name() + " " \
+                            + typeid(T).name()); \
+                        return detail::var_val_t(lhsVal); \
+                    } \
+                }, \
+                this->value); \
+        } \
         return std::visit( \
             [&]<typename LHS, typename RHS>(const LHS& lhsVal, const RHS& rhsVal) \
             { \
@@ -0,0 +1,66 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <Nautilus/Interface/Hash/HashFunction.hpp>
+#include <Runtime/AbstractBufferProvider.hpp>
+#include <Runtime/TupleBuffer.hpp>
+
+namespace NES::Nautilus::Interface
+{
+
+/// Blocked Bloom filter over the hash values of keys, following Putze et al. https://doi.org/10.1145/1498698.1594230.
+/// The filter consists of blocks of one cache line, i.e., WORDS_PER_BLOCK 64-bit words. A key sets one bit in each word of a single block.
+/// Thus, adding or checking a key touches exactly one cache line, for well below 1% false positives with BITS_PER_KEY bits per key.
+///
+/// The lower bits of the hash select the block, and the upper 32 bits select the bit of each word via multiplicative hashing with a
+/// per-word salt. As adding a key only sets bits, the filter never has false negatives.
+///
+/// IMPORTANT: This filter is *NOT* thread safe for concurrent adds. Concurrent mayContain() calls are safe after all keys have been added.
+class BlockedBloomFilter
+{
+public:
+    static constexpr uint64_t WORDS_PER_BLOCK = 8;
+    static constexpr uint64_t BITS_PER_BLOCK = WORDS_PER_BLOCK * 64;
+    static constexpr uint64_t BITS_PER_KEY = 16;
+
+    /// Allocates a power of 2 number of blocks, so that each of the expected keys has at least BITS_PER_KEY bits
+    BlockedBloomFilter(uint64_t expectedNumberOfKeys, AbstractBufferProvider* bufferProvider);
+
+    void add(HashFunction::HashValue::raw_type hash);
+    /// Returns false, if the filter has definitely not seen the hash
+    [[nodiscard]] bool mayContain(HashFunction::HashValue::raw_type hash) const;
+
+    [[nodiscard]] uint64_t getNumberOfBlocks() const;
+    [[nodiscard]] uint64_t getSizeInBytes() const;
+
+private:
+    /// Salts from the Bloom filter of Apache Impala https://github.com/apache/impala/blob/master/be/src/util/bloom-filter.h
+    static constexpr std::array<uint32_t, WORDS_PER_BLOCK> SALTS
+        = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU, 0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+    [[nodiscard]] uint64_t* getBlock(HashFunction::HashValue::raw_type hash) const;
+    /// Returns for each word of the block the single bit that the hash sets
+    [[nodiscard]] static std::array<uint64_t, WORDS_PER_BLOCK> getMasks(HashFunction::HashValue::raw_type hash);
+
+    TupleBuffer filterSpace;
+    uint64_t* words; /// Stores the bits of all blocks
+    uint64_t numberOfBlocks; /// Always a power of 2
+    HashFunction::HashValue::raw_type blockMask; /// Mask to calculate the block from the hash value. Always numberOfBlocks - 1
+};
+
+}
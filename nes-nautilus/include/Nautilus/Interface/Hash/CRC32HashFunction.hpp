@@ -0,0 +1,44 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <Nautilus/DataTypes/VarVal.hpp>
+#include <Nautilus/Interface/Hash/HashFunction.hpp>
+
+namespace NES::Nautilus::Interface
+{
+
+/// Hash function that uses the CRC32C instructions of the CPU (SSE4.2 on x86-64, the CRC extension on ARMv8), which hash a 64-bit key
+/// with a latency of three cycles. As a CRC has only 32 bits, we compute two CRCs with different seeds over the key, one of them over
+/// the key with swapped halves, and multiply their concatenation with an odd constant. Thus, the lower and the upper 32 bits of the hash
+/// do not correlate. This matters, as the hash maps pick the bucket from the lower and the tag or partition from the upper bits.
+/// On CPUs without CRC32 instructions, we fall back to a table-based CRC32C that returns the same hashes but is considerably slower.
+class CRC32HashFunction : public HashFunction
+{
+public:
+    /// Seeds of the lower and upper CRC as an initialisation
+    static constexpr uint64_t SEED = 0x9E3779B97F4A7C15;
+    [[nodiscard]] HashValue init() const override;
+
+    [[nodiscard]] std::unique_ptr<HashFunction> clone() const override;
+
+    /// Returns true, if the CPU that we are running on provides CRC32C instructions
+    static bool hasHardwareSupport();
+
+protected:
+    /// Calculates the hash of value with the lower and upper 32 bits of hash as the seeds of the two CRCs
+    [[nodiscard]] HashValue calculate(HashValue& hash, const VarVal& value) const override;
+};
+}
@@ -13,6 +13,7 @@
 */
 
 #pragma once
+#include <cstdint>
 #include <memory>
 #include <vector>
 #include <Nautilus/DataTypes/VarVal.hpp>
@@ -20,6 +21,16 @@
 namespace NES::Nautilus::Interface
 {
 
+enum class HashFunctionType : uint8_t
+{
+    /// Finalizer of MurMur3, c.f., MurMur3HashFunction
+    MURMUR3,
+    /// Hardware CRC32 instructions, c.f., CRC32HashFunction
+    CRC32,
+    /// Avalanche of XXH3 for 8 byte inputs, c.f., XXH3HashFunction
+    XXH3
+};
+
 /// Interface for hash function on Nautilus values.
 /// Subclasses can provide specific hash algorithms.
 class HashFunction
@@ -32,6 +43,8 @@ public:
 
     [[nodiscard]] virtual std::unique_ptr<HashFunction> clone() const = 0;
 
+    static std::unique_ptr<HashFunction> create(HashFunctionType hashFunctionType);
+
 protected:
     [[nodiscard]] virtual HashValue init() const = 0;
     virtual HashValue calculate(HashValue& hash, const VarVal& value) const = 0;
@@ -0,0 +1,41 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <Nautilus/DataTypes/VarVal.hpp>
+#include <Nautilus/Interface/Hash/HashFunction.hpp>
+
+namespace NES::Nautilus::Interface
+{
+
+/// Hash function that applies the rrmxmx avalanche, which XXH3 uses for inputs of 4 to 8 bytes, to each key.
+/// See https://github.com/Cyan4973/xxHash/blob/dev/xxhash.h (XXH3_len_4to8_64b).
+/// In contrast to the MurMur3HashFunction, the previous hash is mixed into the key before the avalanche and not xor-ed afterwards.
+/// Thus, the hash of multiple keys depends on their order and equal keys do not cancel each other out.
+/// Fixed size keys are hashed in traced code, which the compiler inlines. Variable sized keys are hashed in steps of 8 bytes.
+class XXH3HashFunction : public HashFunction
+{
+public:
+    /// Seed as an initialisation.
+    static constexpr uint64_t SEED = 0;
+    [[nodiscard]] HashValue init() const override;
+
+    [[nodiscard]] std::unique_ptr<HashFunction> clone() const override;
+
+protected:
+    /// Calculates the hash of value with the keyed hash as the seed
+    [[nodiscard]] HashValue calculate(HashValue& hash, const VarVal& value) const override;
+};
+}
@@ -37,9 +37,21 @@ struct FieldOffsets
 };
 
 /// ChainedHashMapEntry uses for reading and writing either the keys or values
+///
+/// Variable sized fields are stored like the strings of Umbra https://www.cidrdb.org/cidr2020/papers/p29-neumann-cidr20.pdf in a slot
+/// of VAR_SIZED_SLOT_SIZE bytes, whose first 4 bytes store the size of the content.
+/// | --- size --- | ------------ content (size <= INLINED_VAR_SIZED_SIZE) ----------- |
+/// | --- size --- | --- prefix of the content --- | --- pointer to size + content --- |
+/// Inlined contents do not require any space outside the entry, as the slot itself is the size followed by the content.
+/// Longer contents are copied to the var sized space of the hash map.
+/// Comparing them checks the size and the prefix before the remaining content.
 class ChainedEntryMemoryProvider
 {
 public:
+    static constexpr uint64_t VAR_SIZED_SLOT_SIZE = 16;
+    static constexpr uint32_t INLINED_VAR_SIZED_SIZE = 12;
+    static constexpr uint32_t VAR_SIZED_PREFIX_SIZE = 4;
+
     explicit ChainedEntryMemoryProvider(std::vector<FieldOffsets> fields) : fields(std::move(fields)) { }
 
     /// We need to create the fields for the keys and values here, as we know here how the fields and the values are stored in the ChainedHashMapEntry.
@@ -48,10 +60,15 @@ public:
         const Schema& schema,
         const std::vector<Record::RecordFieldIdentifier>& fieldNameKeys,
         const std::vector<Record::RecordFieldIdentifier>& fieldNameValues);
+    /// Returns the number of bytes that a field of this type occupies in the ChainedHashMapEntry
+    static uint64_t getFieldSizeInBytes(const DataType& type);
 
 
     [[nodiscard]] VarVal
     readVarVal(const nautilus::val<ChainedHashMapEntry*>& entryRef, const Record::RecordFieldIdentifier& fieldName) const;
+    /// Compares the field of the entry with the value. Var sized data differing in their size or prefix is not read from the var sized space.
+    [[nodiscard]] nautilus::val<bool> isFieldEqual(
+        const nautilus::val<ChainedHashMapEntry*>& entryRef, const Record::RecordFieldIdentifier& fieldName, const VarVal& value) const;
     [[nodiscard]] Record readRecord(const nautilus::val<ChainedHashMapEntry*>& entryRef) const;
     void writeRecord(
         const nautilus::val<ChainedHashMapEntry*>& entryRef,
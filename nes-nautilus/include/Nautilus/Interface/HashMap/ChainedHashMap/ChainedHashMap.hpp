@@ -43,6 +43,23 @@ public:
     explicit ChainedHashMapEntry(const HashFunction::HashValue::raw_type hash) : hash(hash) { };
 };
 
+/// Statistics about how evenly a hash map spreads its entries over its buckets, e.g., to choose the initial number of buckets
+struct BucketStatistics
+{
+    uint64_t numberOfBuckets;
+    uint64_t numberOfUsedBuckets; /// Number of buckets that contain at least one entry
+    uint64_t numberOfEntries;
+    uint64_t numberOfResizes; /// Number of times that the hash map has grown since its creation
+
+    [[nodiscard]] double getLoadFactor() const { return static_cast<double>(numberOfEntries) / static_cast<double>(numberOfBuckets); }
+
+    /// Average number of entries per used bucket, i.e., the average length of a non-empty chain
+    [[nodiscard]] double getAverageChainLength() const
+    {
+        return (numberOfUsedBuckets == 0) ? 0 : static_cast<double>(numberOfEntries) / static_cast<double>(numberOfUsedBuckets);
+    }
+};
+
 /// Implementation of a single thread chained HashMap.
 /// To operate on the hash-map, {@refitem ChainedHashMapRef.hpp} provides a Nautilus wrapper.
 /// The implementation origins from Kersten et al. https://github.com/TimoKersten/db-engine-paradigms and Leis et.al
@@ -51,17 +68,21 @@ public:
 /// The HashMap is distinguishing two memory areas:
 ///
 /// Entry Space:
-/// The entry space is fixed size and contains pointers into the storage space. The entry space operates as a starting point for each chain.
+/// The entry space contains pointers into the storage space. The entry space operates as a starting point for each chain.
 /// This means that the entry space can be thought of buckets in a hash table.
+/// Once the average chain length exceeds the MAX_LOAD_FACTOR, the entry space doubles. To not stall a single insert for relinking all
+/// entries, we keep the previous entry space and move CHAINS_MIGRATED_PER_INSERT of its chains with each following insert.
+/// Until all chains have moved, a chain is located in the previous entry space, if its position has not been migrated yet.
 ///
 /// Storage Space:
-/// The storage space contains individual key-value pairs. It does not support variable length keys or values for now.
-/// For keys, one could project them beforehand to a fixed length representation, e.g., uin64_t, and then use the newly mapped key.
+/// The storage space contains individual key-value pairs. Variable length keys and values with up to 12 bytes are inlined into the entry.
+/// Longer ones are copied into the var sized space, c.f., ChainedEntryMemoryProvider.
 ///
 /// IMPORTANT:
 /// 1. This hash map is *NOT* thread save and allows for no concurrent accesses, as it does not use any locking, atomics or synchronization primitives.
 /// 2. This hash map does not clear the content of the entry. So it is up to the user to initialize values correctly.
-class ChainedHashMap final : public HashMap
+/// 3. Entries never move in the storage space, as the values, e.g., aggregation states or paged vectors, might be referenced by pointers.
+class ChainedHashMap : public HashMap
 {
 public:
     struct Page
@@ -74,10 +95,18 @@ public:
         uint64_t numberOfEntries{0};
     };
 
+    /// The entry space doubles, once the number of entries exceeds MAX_LOAD_FACTOR * numberOfChains
+    static constexpr double MAX_LOAD_FACTOR = 1.0;
+    /// As the entry space doubles, moving at least one chain per insert finishes the migration before the next resize is due
+    static constexpr uint64_t CHAINS_MIGRATED_PER_INSERT = 2;
+
     ChainedHashMap(uint64_t entrySize, uint64_t numberOfBuckets, uint64_t pageSize);
     ChainedHashMap(uint64_t keySize, uint64_t valueSize, uint64_t numberOfBuckets, uint64_t pageSize);
     ~ChainedHashMap() override;
     [[nodiscard]] ChainedHashMapEntry* findChain(HashFunction::HashValue::raw_type hash) const;
+    /// Issues a software prefetch for the bucket of the hash without waiting for it. Prefetching the buckets of a group of keys before
+    /// looking them up overlaps their cache misses, instead of stalling on the bucket of one key after the other.
+    virtual void prefetchBucket(HashFunction::HashValue::raw_type hash) const;
     std::span<std::byte> allocateSpaceForVarSized(AbstractBufferProvider* bufferProvider, size_t neededSize);
     AbstractHashMapEntry* insertEntry(HashFunction::HashValue::raw_type hash, AbstractBufferProvider* bufferProvider) override;
     [[nodiscard]] uint64_t getNumberOfTuples() const override;
@@ -85,20 +114,40 @@ public:
     [[nodiscard]] uint64_t getNumberOfPages() const;
     [[nodiscard]] ChainedHashMapEntry* getStartOfChain(uint64_t entryIdx) const;
     [[nodiscard]] uint64_t getNumberOfChains() const;
+    [[nodiscard]] virtual BucketStatistics getBucketStatistics() const;
+
+    /// Calls the function for every entry in the order of the storage space, regardless of how the entries are linked
+    void forEachEntry(const std::function<void(ChainedHashMapEntry*)>& function);
 
     /// Clears and deletes all entries in the hash map. It also releases the memory of any allocated buffers or other memory.
-    void clear() noexcept;
+    virtual void clear() noexcept;
+
+    /// Deletes all entries like clear(), but keeps the zeroed entry space and up to maxRetainedPages zeroed pages of the storage space,
+    /// which the following inserts fill before allocating new pages. Thus, a recycled hash map does not allocate its memory again.
+    virtual void clearForReuse(uint64_t maxRetainedPages) noexcept;
 
     /// The passed method is being executed, once the destructor is called. This is necessary as the value type of this hash map
     /// might allocate its own memory. Thus, the destructor of the value type should be called to release the memory.
     void setDestructorCallback(const std::function<void(ChainedHashMapEntry*)>& callback);
 
     /// Creates a new chained hash map with the same configuration, i.e., pageSize, entrySize, entriesPerPage and numberOfChains
+    /// The new hash map is of the same type as the other, e.g., an OpenAddressingHashMap
     static std::unique_ptr<ChainedHashMap> createNewMapWithSameConfiguration(const ChainedHashMap& other);
 
-private:
+protected:
     friend class ChainedHashMapRef;
 
+    [[nodiscard]] virtual std::unique_ptr<ChainedHashMap> createEmptyMapWithSameConfiguration() const;
+
+    /// Allocates a new entry in the storage space without linking it into any chain
+    ChainedHashMapEntry* allocateEntry(HashFunction::HashValue::raw_type hash, AbstractBufferProvider* bufferProvider);
+
+    /// Returns the position that stores the start of the chain for the hash, either in the current or in the previous entry space
+    [[nodiscard]] ChainedHashMapEntry** getChainPosition(HashFunction::HashValue::raw_type hash) const;
+    [[nodiscard]] TupleBuffer allocateEntrySpace(uint64_t newNumberOfChains, AbstractBufferProvider* bufferProvider) const;
+    void grow(AbstractBufferProvider* bufferProvider);
+    void migrateChains(uint64_t numberOfChainsToMigrate);
+
     /// Specifies the number of pre-allocated var sized
     static constexpr auto NUMBER_OF_PRE_ALLOCATED_VAR_SIZED_ITEMS = 100;
     TupleBuffer entrySpace;
@@ -111,6 +160,12 @@ private:
     uint64_t numberOfChains; /// Number of buckets in the hash map
     ChainedHashMapEntry** entries; /// Stores the pointers to the first entry in each chain
     HashFunction::HashValue::raw_type mask; /// Mask to calculate the bucket position from the hash value. Always a (power of 2)-1
+    TupleBuffer oldEntrySpace;
+    ChainedHashMapEntry** oldEntries; /// Stores the chains of the entry space before the last resize, until all of them have been migrated
+    uint64_t oldNumberOfChains; /// Number of buckets before the last resize. Zero, if no migration is in progress
+    uint64_t numberOfMigratedChains; /// Chains of the previous entry space with a lower position have been migrated
+    uint64_t numberOfUsedChains; /// Number of chains that contain at least one entry
+    uint64_t numberOfResizes;
     std::function<void(ChainedHashMapEntry*)> destructorCallBack; /// Callback function to be executed, once the destructor is called
 };
 }
@@ -34,7 +34,7 @@ namespace NES::Nautilus::Interface
 /// Forward declaration of EntryIterator so that we can use it in ChainedHashMapRef for making EntryIterator friend.
 class EntryIterator;
 
-class ChainedHashMapRef final : public HashMapRef
+class ChainedHashMapRef : public HashMapRef
 {
 public:
     /// A nautilus wrapper to operate on the chained hash map.
@@ -129,22 +129,31 @@ public:
         const std::function<void(nautilus::val<AbstractHashMapEntry*>&)>& onInsert,
         const nautilus::val<AbstractBufferProvider*>& bufferProvider) override;
     nautilus::val<AbstractHashMapEntry*> findEntry(const nautilus::val<AbstractHashMapEntry*>& otherEntry) override;
+
+    /// Prefetches the bucket of the hash in all hash maps, see ChainedHashMap::prefetchBucket().
+    /// A single call into the C++ runtime covers all hash maps, as the call dominates the cost of issuing a prefetch.
+    static void prefetchBuckets(
+        const nautilus::val<HashMap**>& hashMaps, const nautilus::val<uint64_t>& numberOfHashMaps, const HashFunction::HashValue& hash);
     [[nodiscard]] EntryIterator begin() const;
     [[nodiscard]] EntryIterator end() const;
 
 
-private:
-    /// Finds the chain for the given hash value. If no chain exists, it returns nullptr.
-    [[nodiscard]] nautilus::val<ChainedHashMapEntry*> findChain(const HashFunction::HashValue& hash) const;
-    nautilus::val<ChainedHashMapEntry*>
-    insert(const HashFunction::HashValue& hash, const nautilus::val<AbstractBufferProvider*>& bufferProvider);
+protected:
+    /// Returns the entry with the same keys as recordKey or nullptr, if no such entry exists.
+    /// Hash maps that resolve collisions differently, e.g., via open addressing, override this method.
+    [[nodiscard]] virtual nautilus::val<ChainedHashMapEntry*> findKey(const Record& recordKey, const HashFunction::HashValue& hash) const;
     [[nodiscard]] nautilus::val<bool> compareKeys(const ChainedEntryRef& entryRef, const Record& keys) const;
-    [[nodiscard]] nautilus::val<ChainedHashMapEntry*> findKey(const Record& recordKey, const HashFunction::HashValue& hash) const;
-    [[nodiscard]] nautilus::val<ChainedHashMapEntry*> findEntry(const ChainedEntryRef& otherEntryRef) const;
 
     std::vector<BufferRef::FieldOffsets> fieldKeys;
     std::vector<BufferRef::FieldOffsets> fieldValues;
     nautilus::val<uint64_t> entriesPerPage;
     nautilus::val<uint64_t> entrySize;
+
+private:
+    /// Finds the chain for the given hash value. If no chain exists, it returns nullptr.
+    [[nodiscard]] nautilus::val<ChainedHashMapEntry*> findChain(const HashFunction::HashValue& hash) const;
+    nautilus::val<ChainedHashMapEntry*>
+    insert(const HashFunction::HashValue& hash, const nautilus::val<AbstractBufferProvider*>& bufferProvider);
+    [[nodiscard]] nautilus::val<ChainedHashMapEntry*> findEntry(const ChainedEntryRef& otherEntryRef) const;
 };
 }
@@ -20,6 +20,15 @@
 namespace NES::Nautilus::Interface
 {
 
+/// Collision resolution of the hash maps that back our aggregations and hash joins
+enum class HashMapType : uint8_t
+{
+    /// Links all entries of a bucket via pointers, c.f., ChainedHashMap
+    CHAINED,
+    /// Probes groups of slots with SIMD instructions, c.f., OpenAddressingHashMap
+    OPEN_ADDRESSING
+};
+
 class AbstractHashMapEntry
 {
 public:
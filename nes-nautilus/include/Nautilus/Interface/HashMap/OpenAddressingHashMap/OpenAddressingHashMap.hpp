@@ -0,0 +1,97 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <Nautilus/Interface/Hash/HashFunction.hpp>
+#include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMap.hpp>
+#include <Nautilus/Interface/HashMap/HashMap.hpp>
+#include <Runtime/AbstractBufferProvider.hpp>
+#include <Runtime/TupleBuffer.hpp>
+
+namespace NES::Nautilus::Interface
+{
+/// Forward declaration of the OpenAddressingHashMapRef, to avoid cyclic dependencies between OpenAddressingHashMap and its ref
+class OpenAddressingHashMapRef;
+
+/// Implementation of a single thread hash map that resolves collisions via open addressing instead of chains.
+/// To operate on the hash-map, {@refitem OpenAddressingHashMapRef.hpp} provides a Nautilus wrapper.
+/// The probing follows the Swiss tables of Abseil https://abseil.io/about/design/swisstables.
+///
+/// Slot Space:
+/// The slot space consists of one pointer to an entry and one control byte per slot.
+/// | --- Entry* --- | ... | --- Entry* --- | --- control byte --- | ... | --- control byte --- |
+/// | ---------------- capacity * 64bit -- | -------------------- capacity * 8bit ------------- |
+/// A control byte is either EMPTY or stores the upper 7 bits of the hash of its entry (the tag).
+/// A lookup compares the tag with the control bytes of a group of GROUP_SIZE slots at once via SIMD instructions.
+/// Thus, we only compare the keys of slots with a matching tag, which are for a non-matching key on average one in 128 slots.
+/// As we never delete single entries, a group that contains an empty slot ends the probe sequence.
+///
+/// Storage Space:
+/// The entries are stored, as in the ChainedHashMap, in the pages of the storage space. Keys and values are not inlined into the slots,
+/// as the entries must not move, once the slot space grows. Thus, the EntryIterator of the ChainedHashMapRef works for this hash map.
+///
+/// The slot space doubles, once more than MAX_LOAD_FACTOR of all slots are occupied. Growing reinserts the pointers via the stored hashes.
+class OpenAddressingHashMap final : public ChainedHashMap
+{
+public:
+    static constexpr uint64_t GROUP_SIZE = 16;
+    static constexpr uint8_t EMPTY = 0x80;
+    static constexpr double MAX_LOAD_FACTOR = 7.0 / 8.0;
+    /// Returned by findCandidate(), if the probe sequence does not contain a further slot with a matching tag
+    static constexpr uint64_t NO_CANDIDATE = std::numeric_limits<uint64_t>::max();
+
+    OpenAddressingHashMap(uint64_t entrySize, uint64_t numberOfBuckets, uint64_t pageSize);
+    OpenAddressingHashMap(uint64_t keySize, uint64_t valueSize, uint64_t numberOfBuckets, uint64_t pageSize);
+    ~OpenAddressingHashMap() override = default;
+
+    AbstractHashMapEntry* insertEntry(HashFunction::HashValue::raw_type hash, AbstractBufferProvider* bufferProvider) override;
+
+    /// Returns the first position at or after probePosition in the probe sequence of the hash, whose slot has the tag of the hash.
+    /// If no such slot exists, it returns NO_CANDIDATE.
+    [[nodiscard]] uint64_t findCandidate(HashFunction::HashValue::raw_type hash, uint64_t probePosition) const;
+
+    /// Returns the entry at the position in the probe sequence of the hash. The position must stem from findCandidate().
+    [[nodiscard]] ChainedHashMapEntry* getCandidate(HashFunction::HashValue::raw_type hash, uint64_t probePosition) const;
+    [[nodiscard]] uint64_t getCapacity() const;
+    /// Prefetches the control bytes and the slots of the first group of the probe sequence
+    void prefetchBucket(HashFunction::HashValue::raw_type hash) const override;
+    /// Each slot is a bucket that contains at most one entry
+    [[nodiscard]] BucketStatistics getBucketStatistics() const override;
+
+    void clear() noexcept override;
+    void clearForReuse(uint64_t maxRetainedPages) noexcept override;
+
+protected:
+    [[nodiscard]] std::unique_ptr<ChainedHashMap> createEmptyMapWithSameConfiguration() const override;
+
+private:
+    friend class OpenAddressingHashMapRef;
+
+    /// The probe sequence starts at the group that contains the slot hash & slotMask
+    [[nodiscard]] uint64_t getStartOfProbeSequence(HashFunction::HashValue::raw_type hash) const;
+    void allocateSlotSpace(uint64_t newCapacity, AbstractBufferProvider* bufferProvider);
+    void grow(AbstractBufferProvider* bufferProvider);
+    void insertIntoSlotSpace(ChainedHashMapEntry* entry);
+
+    TupleBuffer slotSpace;
+    ChainedHashMapEntry** slots; /// Stores the pointers to the entries
+    uint8_t* controlBytes; /// Stores the tag of each slot or EMPTY
+    uint64_t capacity; /// Number of slots in the slot space. Always a power of 2 and a multiple of the GROUP_SIZE
+    HashFunction::HashValue::raw_type slotMask; /// Mask to calculate the slot from the hash value. Always capacity - 1
+};
+}
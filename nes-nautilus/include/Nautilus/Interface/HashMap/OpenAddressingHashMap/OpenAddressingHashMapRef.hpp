@@ -0,0 +1,49 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <Nautilus/Interface/Hash/HashFunction.hpp>
+#include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedEntryMemoryProvider.hpp>
+#include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMap.hpp>
+#include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMapRef.hpp>
+#include <Nautilus/Interface/HashMap/HashMap.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <val.hpp>
+#include <val_ptr.hpp>
+
+namespace NES::Nautilus::Interface
+{
+
+/// A nautilus wrapper to operate on the open addressing hash map.
+/// As the OpenAddressingHashMap stores its entries in the same way as the ChainedHashMap, we solely replace the lookup of a key.
+/// Insertions, the ChainedEntryRef and the EntryIterator are the same as for the ChainedHashMapRef.
+class OpenAddressingHashMapRef final : public ChainedHashMapRef
+{
+public:
+    OpenAddressingHashMapRef(
+        const nautilus::val<HashMap*>& hashMapRef,
+        std::vector<BufferRef::FieldOffsets> fieldsKey,
+        std::vector<BufferRef::FieldOffsets> fieldsValue,
+        const nautilus::val<uint64_t>& entriesPerPage,
+        const nautilus::val<uint64_t>& entrySize);
+    ~OpenAddressingHashMapRef() override = default;
+
+protected:
+    /// Probes the slot space in the C++ runtime for slots with a matching tag and compares the keys of these candidates in the traced code.
+    [[nodiscard]] nautilus::val<ChainedHashMapEntry*> findKey(const Record& recordKey, const HashFunction::HashValue& hash) const override;
+};
+}
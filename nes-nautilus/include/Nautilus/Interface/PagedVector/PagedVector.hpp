@@ -15,6 +15,7 @@
 #pragma once
 
 #include <cstdint>
+#include <cstdio>
 #include <memory>
 #include <vector>
 #include <MemoryLayout/MemoryLayout.hpp>
@@ -40,14 +41,24 @@ public:
     };
 
     PagedVector() = default;
+    ~PagedVector() = default;
+
+    /// The PagedVectorRef accesses the last page via its address, which a copy or move would not update
+    PagedVector(const PagedVector&) = delete;
+    PagedVector& operator=(const PagedVector&) = delete;
+    PagedVector(PagedVector&&) = delete;
+    PagedVector& operator=(PagedVector&&) = delete;
 
     /// Appends a new page to the pages vector if the last page is full.
     void appendPageIfFull(AbstractBufferProvider* bufferProvider, const MemoryLayout* memoryLayout);
 
     /// Appends the pages of the given PagedVector with the pages of this PagedVector.
+    /// Moves the pages without touching their reference counts and leaves other without pages.
     void moveAllPages(PagedVector& other);
 
-    /// Copies all pages from other to this
+    /// Appends the pages of other to this by sharing them, i.e., copying the references to the pages and not the entries.
+    /// Thus, other is unchanged and the pages stay valid, even if other is released. As both vectors refer to the same pages now, this
+    /// never appends entries to the shared last page but to a new page instead.
     void copyFrom(const PagedVector& other);
 
     /// Returns a pointer to the tuple buffer that contains the entry at the given position.
@@ -63,7 +74,35 @@ public:
 
     [[nodiscard]] uint64_t getNumberOfPages() const { return pages.getNumberOfPages(); }
 
+    /// Returns the number of bytes of all pages in memory, excluding child buffers of variable sized data
+    [[nodiscard]] uint64_t getSizeOfPagesInBytes() const;
+
+    /// Appends all pages to the file and releases their memory. Until reloadPages() is called, the PagedVector must not be accessed.
+    /// Returns false and keeps the pages in memory, if a page stores variable sized data in child buffers, as we solely write the pages.
+    bool spillPages(std::FILE* file);
+    /// Reads all spilled pages back from the file into new pages
+    void reloadPages(std::FILE* file, AbstractBufferProvider* bufferProvider);
+    [[nodiscard]] bool hasSpilledPages() const { return not spilledPages.empty(); }
+
+    /// Writes the number of pages and all pages to the file without releasing them, e.g., to checkpoint the PagedVector.
+    /// Returns false, if a page stores variable sized data in child buffers, c.f., spillPages().
+    bool writePages(std::FILE* file) const;
+    /// Appends the pages, which writePages() has written at the current position of the file, as new pages
+    void readPages(std::FILE* file, AbstractBufferProvider* bufferProvider);
+
 private:
+    /// Allows the PagedVectorRef to append records to the last page without invoking the PagedVector for each record
+    friend class PagedVectorRef;
+
+    /// Position of a spilled page in the spill file
+    struct SpilledPage
+    {
+        long offset;
+        uint64_t bufferSize;
+        uint64_t numberOfTuples;
+    };
+
+
     /// Wrapper around a vector of TupleBufferWithCumulativeSum to take care of updating the cumulative sums
     struct PagesWrapper
     {
@@ -78,17 +117,41 @@ private:
         [[nodiscard]] std::optional<size_t> findIdx(uint64_t entryPos) const;
         void addPage(const TupleBuffer& newPage);
         void addPages(const PagesWrapper& other);
+        void addPages(PagesWrapper&& other);
         void clearPages();
 
     private:
         /// We use a cumulative sum to increase the speed of findIdx for an entry pos
         void updateCumulativeSumLastItem();
-        void updateCumulativeSumAllPages();
+        /// Only updates the cumulative sums of the pages starting at firstPageIndex, as the sums of the pages before remain the same
+        void updateCumulativeSumPagesFrom(size_t firstPageIndex);
+        /// Checks if the page that is no longer the last page has as many entries as all other pages before it
+        void trackEntriesPerPage(uint64_t numberOfEntriesOnPage);
+        /// Updates the entries per page of the pages before the pages of other are appended, c.f., addPages()
+        void trackEntriesPerPageBeforeAdding(const PagesWrapper& other);
 
         std::vector<TupleBufferWithCumulativeSum> pages;
+
+        /// As long as all pages but the last one contain the same number of entries, findIdx() divides by this number instead of
+        /// searching the cumulative sums. This is the case for all paged vectors that are solely filled via appendPageIfFull().
+        /// Combining paged vectors via addPages() might append pages that are not full.
+        uint64_t entriesPerPage{0};
+        bool hasSameEntriesPerPage{true};
     };
 
+    /// Forces the next PagedVectorRef::writeRecord() to call appendPageIfFull(), as the pages have changed otherwise
+    void invalidateLastPageForAppend();
+
     PagesWrapper pages;
+    std::vector<SpilledPage> spilledPages;
+    /// Set, if the last page stems from copyFrom(), thus another PagedVector might refer to it and solely reads it
+    bool isLastPageShared{false};
+
+    /// Last page at the time of the last appendPageIfFull(), which PagedVectorRef::writeRecord() fills until it holds capacityLastPage
+    /// tuples. Thus, writing a record solely invokes the PagedVector once per page and not once per record.
+    const TupleBuffer* lastPageForAppend{nullptr};
+    uint64_t numberOfTuplesLastPage{0};
+    uint64_t capacityLastPage{0};
 };
 
 }
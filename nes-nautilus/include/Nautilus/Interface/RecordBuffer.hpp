@@ -67,6 +67,9 @@ public:
     /// Get the creation timestamp of the underlying tuple buffer. The creation timestamp is the point in time when the tuple buffer was created.
     nautilus::val<Timestamp> getCreatingTs();
     void setCreationTs(const nautilus::val<Timestamp>& creationTs);
+    /// Get the ingestion timestamp of the latest data in the underlying tuple buffer, c.f., TupleBuffer::getLatestCreationTimestampInMS
+    nautilus::val<Timestamp> getLatestCreationTs();
+    void setLatestCreationTs(const nautilus::val<Timestamp>& latestCreationTs);
 
     ~RecordBuffer() = default;
 
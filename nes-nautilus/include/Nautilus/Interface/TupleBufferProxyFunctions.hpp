@@ -66,6 +66,11 @@ inline Timestamp NES_Memory_TupleBuffer_getCreationTimestampInMS(const TupleBuff
     return tupleBuffer->getCreationTimestampInMS();
 };
 
+inline Timestamp NES_Memory_TupleBuffer_getLatestCreationTimestampInMS(const TupleBuffer* tupleBuffer)
+{
+    return tupleBuffer->getLatestCreationTimestampInMS();
+};
+
 inline void NES_Memory_TupleBuffer_setSequenceNumber(TupleBuffer* tupleBuffer, const SequenceNumber sequenceNumber)
 {
     tupleBuffer->setSequenceNumber(sequenceNumber);
@@ -81,6 +86,11 @@ inline void NES_Memory_TupleBuffer_setCreationTimestampInMS(TupleBuffer* tupleBu
     tupleBuffer->setCreationTimestampInMS(Timestamp(value));
 }
 
+inline void NES_Memory_TupleBuffer_setLatestCreationTimestampInMS(TupleBuffer* tupleBuffer, const Timestamp value)
+{
+    tupleBuffer->setLatestCreationTimestampInMS(Timestamp(value));
+}
+
 inline void NES_Memory_TupleBuffer_setChunkNumber(TupleBuffer* tupleBuffer, const ChunkNumber chunkNumber)
 {
     tupleBuffer->setChunkNumber(ChunkNumber(chunkNumber));
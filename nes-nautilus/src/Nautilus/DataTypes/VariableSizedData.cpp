@@ -93,6 +93,11 @@ nautilus::val<bool> VariableSizedData::operator==(const VariableSizedData& rhs)
     {
         return {false};
     }
+    /// Dictionary encoded var sized data of equal values resides in the same entry, thus, we can skip comparing it byte-wise
+    if (ptrToVarSized == rhs.ptrToVarSized)
+    {
+        return {true};
+    }
     const auto varSizedData = getContent();
     const auto rhsVarSizedData = rhs.getContent();
     const auto compareResult = (nautilus::memcmp(varSizedData, rhsVarSizedData, size) == 0);
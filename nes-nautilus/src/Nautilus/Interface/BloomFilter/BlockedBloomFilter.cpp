@@ -0,0 +1,96 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+#include <Nautilus/Interface/BloomFilter/BlockedBloomFilter.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <Nautilus/Interface/Hash/HashFunction.hpp>
+#include <Runtime/AbstractBufferProvider.hpp>
+#include <ErrorHandling.hpp>
+
+namespace NES::Nautilus::Interface
+{
+
+BlockedBloomFilter::BlockedBloomFilter(const uint64_t expectedNumberOfKeys, AbstractBufferProvider* bufferProvider)
+    : words(nullptr)
+    , numberOfBlocks(std::bit_ceil(std::max(uint64_t{1}, ((expectedNumberOfKeys * BITS_PER_KEY) + BITS_PER_BLOCK - 1) / BITS_PER_BLOCK)))
+    , blockMask(numberOfBlocks - 1)
+{
+    const auto totalSpace = getSizeInBytes();
+    const auto filterBuffer = bufferProvider->getUnpooledBuffer(totalSpace);
+    if (not filterBuffer)
+    {
+        throw CannotAllocateBuffer("Could not allocate memory for BlockedBloomFilter of size {}", std::to_string(totalSpace));
+    }
+
+    filterSpace = filterBuffer.value();
+    words = reinterpret_cast<uint64_t*>(filterSpace.getAvailableMemoryArea().data()); /// NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    std::memset(words, 0, totalSpace);
+}
+
+uint64_t* BlockedBloomFilter::getBlock(const HashFunction::HashValue::raw_type hash) const
+{
+    return words + ((hash & blockMask) * WORDS_PER_BLOCK);
+}
+
+std::array<uint64_t, BlockedBloomFilter::WORDS_PER_BLOCK> BlockedBloomFilter::getMasks(const HashFunction::HashValue::raw_type hash)
+{
+    /// The upper 6 bits of the salted upper half of the hash select one of the 64 bits of a word
+    const auto upperHash = static_cast<uint32_t>(hash >> 32U);
+    std::array<uint64_t, WORDS_PER_BLOCK> masks{};
+    for (uint64_t word = 0; word < WORDS_PER_BLOCK; ++word)
+    {
+        masks[word] = uint64_t{1} << ((upperHash * SALTS[word]) >> 26U);
+    }
+    return masks;
+}
+
+void BlockedBloomFilter::add(const HashFunction::HashValue::raw_type hash)
+{
+    auto* const block = getBlock(hash);
+    const auto masks = getMasks(hash);
+    for (uint64_t word = 0; word < WORDS_PER_BLOCK; ++word)
+    {
+        block[word] |= masks[word];
+    }
+}
+
+bool BlockedBloomFilter::mayContain(const HashFunction::HashValue::raw_type hash) const
+{
+    /// Checking all words without an early exit, so that the compiler can vectorize the comparison
+    const auto* const block = getBlock(hash);
+    const auto masks = getMasks(hash);
+    uint64_t missingBits = 0;
+    for (uint64_t word = 0; word < WORDS_PER_BLOCK; ++word)
+    {
+        missingBits |= masks[word] & ~block[word];
+    }
+    return missingBits == 0;
+}
+
+uint64_t BlockedBloomFilter::getNumberOfBlocks() const
+{
+    return numberOfBlocks;
+}
+
+uint64_t BlockedBloomFilter::getSizeInBytes() const
+{
+    return numberOfBlocks * WORDS_PER_BLOCK * sizeof(uint64_t);
+}
+
+}
@@ -15,6 +15,7 @@
 #include <Nautilus/Interface/BufferRef/TupleBufferRef.hpp>
 
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <memory>
@@ -53,16 +54,23 @@ TupleBufferRef::loadValue(const DataType& physicalType, const RecordBuffer& reco
     {
         return VarVal::readVarValFromMemory(fieldReference, physicalType.type);
     }
-    nautilus::val<VariableSizedAccess> combinedIdxOffset{
-        Nautilus::Util::readValueFromMemRef<VariableSizedAccess::CombinedIndex>(fieldReference)};
-    const auto varSizedPtr = invoke(
-        +[](const TupleBuffer* tupleBuffer, const VariableSizedAccess variableSizedAccess)
-        {
-            INVARIANT(tupleBuffer != nullptr, "Tuplebuffer MUST NOT be null at this point");
-            return MemoryLayout::loadAssociatedVarSizedValue(*tupleBuffer, variableSizedAccess).data();
-        },
-        recordBuffer.getReference(),
-        combinedIdxOffset);
+    const auto combinedIdxOffset = Nautilus::Util::readValueFromMemRef<VariableSizedAccess::CombinedIndex>(fieldReference);
+
+    /// Short var sized data is stored inline, i.e., the field itself contains the length and the content, c.f., @class VariableSizedAccess.
+    /// Thus, we only have to load the child buffer, if the field references var sized data in a child buffer.
+    nautilus::val<int8_t*> varSizedPtr = fieldReference;
+    if ((combinedIdxOffset & nautilus::val<VariableSizedAccess::CombinedIndex>(VariableSizedAccess::REFERENCE_BIT))
+        != nautilus::val<VariableSizedAccess::CombinedIndex>(0))
+    {
+        varSizedPtr = invoke(
+            +[](const TupleBuffer* tupleBuffer, const VariableSizedAccess variableSizedAccess)
+            {
+                INVARIANT(tupleBuffer != nullptr, "Tuplebuffer MUST NOT be null at this point");
+                return MemoryLayout::loadAssociatedVarSizedValue(*tupleBuffer, variableSizedAccess).data();
+            },
+            recordBuffer.getReference(),
+            nautilus::val<VariableSizedAccess>{combinedIdxOffset});
+    }
     return VariableSizedData(varSizedPtr);
 }
 
@@ -86,20 +94,24 @@ VarVal TupleBufferRef::storeValue(
     }
 
     const auto varSizedValue = value.cast<VariableSizedData>();
-    const auto variableSizedAccess = invoke(
-        +[](TupleBuffer* tupleBuffer, AbstractBufferProvider* bufferProvider, const int8_t* varSizedPtr, const uint32_t varSizedValueLength)
+    invoke(
+        +[](TupleBuffer* tupleBuffer,
+            AbstractBufferProvider* bufferProvider,
+            int8_t* field,
+            const int8_t* varSizedContent,
+            const uint32_t varSizedContentLength)
         {
             INVARIANT(tupleBuffer != nullptr, "Tuplebuffer MUST NOT be null at this point");
             INVARIANT(bufferProvider != nullptr, "BufferProvider MUST NOT be null at this point");
-            const std::span<const int8_t> varSizedValueSpan{varSizedPtr, varSizedPtr + varSizedValueLength};
-            return MemoryLayout::writeVarSized<MemoryLayout::PREPEND_NONE>(*tupleBuffer, *bufferProvider, std::as_bytes(varSizedValueSpan));
+            const MemoryLayout::VarSizedField fieldSpan{reinterpret_cast<std::byte*>(field), sizeof(VariableSizedAccess)};
+            const std::span<const int8_t> varSizedValueSpan{varSizedContent, varSizedContent + varSizedContentLength};
+            MemoryLayout::writeVarSizedField(*tupleBuffer, *bufferProvider, fieldSpan, std::as_bytes(varSizedValueSpan));
         },
         recordBuffer.getReference(),
         bufferProvider,
-        varSizedValue.getReference(),
-        varSizedValue.getTotalSize());
-    auto fieldReferenceCastedU64 = static_cast<nautilus::val<uint64_t*>>(fieldReference);
-    *fieldReferenceCastedU64 = variableSizedAccess.convertToValue();
+        fieldReference,
+        varSizedValue.getContent(),
+        varSizedValue.getContentSize());
     return value;
 }
 
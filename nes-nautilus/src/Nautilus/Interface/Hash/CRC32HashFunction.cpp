@@ -0,0 +1,168 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+#include <Nautilus/Interface/Hash/CRC32HashFunction.hpp>
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <Nautilus/DataTypes/VarVal.hpp>
+#include <Nautilus/DataTypes/VariableSizedData.hpp>
+#include <Nautilus/Interface/Hash/HashFunction.hpp>
+#include <nautilus/function.hpp>
+#include <nautilus/val.hpp>
+
+#if defined(__x86_64__)
+    #include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+    #include <arm_acle.h>
+#endif
+
+namespace NES::Nautilus::Interface
+{
+
+namespace
+{
+/// Reflected polynomial of CRC32C (Castagnoli), which the CRC32 instructions of x86-64 and ARMv8 implement
+constexpr uint32_t CRC32C_POLYNOMIAL = 0x82F63B78U;
+
+constexpr std::array<uint32_t, 256> createCRC32CTable()
+{
+    std::array<uint32_t, 256> table{};
+    for (uint32_t byte = 0; byte < table.size(); ++byte)
+    {
+        auto crc = byte;
+        for (int bit = 0; bit < 8; ++bit)
+        {
+            crc = (crc >> 1U) ^ ((crc & 1U) * CRC32C_POLYNOMIAL);
+        }
+        table[byte] = crc;
+    }
+    return table;
+}
+
+constexpr auto CRC32C_TABLE = createCRC32CTable();
+
+uint32_t crc32cSoftware(uint32_t crc, uint64_t value)
+{
+    for (int byte = 0; byte < 8; ++byte)
+    {
+        crc = (crc >> 8U) ^ CRC32C_TABLE[(crc ^ value) & 0xFFU];
+        value >>= 8U;
+    }
+    return crc;
+}
+
+#if defined(__x86_64__)
+__attribute__((target("sse4.2"))) uint32_t crc32cHardware(const uint32_t crc, const uint64_t value)
+{
+    return static_cast<uint32_t>(_mm_crc32_u64(crc, value));
+}
+
+bool detectHardwareSupport()
+{
+    return __builtin_cpu_supports("sse4.2");
+}
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+uint32_t crc32cHardware(const uint32_t crc, const uint64_t value)
+{
+    return __crc32cd(crc, value);
+}
+
+bool detectHardwareSupport()
+{
+    return true;
+}
+#else
+uint32_t crc32cHardware(const uint32_t crc, const uint64_t value)
+{
+    return crc32cSoftware(crc, value);
+}
+
+bool detectHardwareSupport()
+{
+    return false;
+}
+#endif
+
+const bool HAS_HARDWARE_SUPPORT = detectHardwareSupport();
+
+/// A CRC is linear in its input. Thus, for keys that differ in few bits, e.g., consecutive integers, the bits of the two CRCs correlate.
+/// Multiplying with an odd constant breaks up this correlation without introducing collisions.
+constexpr uint64_t MULTIPLIER = 0x2545F4914F6CDD1DULL;
+
+uint64_t crc32Step(const uint64_t hash, const uint64_t value)
+{
+    const auto crc = HAS_HARDWARE_SUPPORT ? crc32cHardware : crc32cSoftware;
+    const uint64_t lower = crc(static_cast<uint32_t>(hash), value);
+    const uint64_t upper = crc(static_cast<uint32_t>(hash >> 32U), std::rotl(value, 32));
+    return ((upper << 32U) | lower) * MULTIPLIER;
+}
+
+/// Hashes the bytes in steps of 8 bytes. The length is part of the last step, so that trailing zero bytes change the hash.
+uint64_t crc32Bytes(const uint64_t hash, void* data, const uint64_t length)
+{
+    const auto* const bytes = static_cast<const uint8_t*>(data);
+    auto result = hash;
+    uint64_t offset = 0;
+    for (; offset + sizeof(uint64_t) <= length; offset += sizeof(uint64_t))
+    {
+        uint64_t word = 0;
+        std::memcpy(&word, bytes + offset, sizeof(uint64_t));
+        result = crc32Step(result, word);
+    }
+    uint64_t tail = 0;
+    if (offset < length)
+    {
+        std::memcpy(&tail, bytes + offset, length - offset);
+    }
+    return crc32Step(result ^ length, tail);
+}
+}
+
+HashFunction::HashValue CRC32HashFunction::init() const
+{
+    return SEED;
+}
+
+std::unique_ptr<HashFunction> CRC32HashFunction::clone() const
+{
+    return std::make_unique<CRC32HashFunction>(*this);
+}
+
+bool CRC32HashFunction::hasHardwareSupport()
+{
+    return HAS_HARDWARE_SUPPORT;
+}
+
+HashFunction::HashValue CRC32HashFunction::calculate(HashValue& hash, const VarVal& value) const
+{
+    return value
+        .customVisit(
+            [&]<typename T>(const T& val) -> VarVal
+            {
+                if constexpr (std::is_same_v<T, VariableSizedData>)
+                {
+                    return nautilus::invoke(crc32Bytes, hash, val.getContent(), val.getContentSize());
+                }
+                else
+                {
+                    return nautilus::invoke(crc32Step, hash, static_cast<nautilus::val<uint64_t>>(val));
+                }
+            })
+        .cast<HashValue>();
+}
+}
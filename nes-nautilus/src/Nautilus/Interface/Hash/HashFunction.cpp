@@ -11,9 +11,14 @@
     See the License for the specific language governing permissions and
     limitations under the License.
 */
+#include <memory>
+#include <utility>
 #include <vector>
 #include <Nautilus/DataTypes/VarVal.hpp>
+#include <Nautilus/Interface/Hash/CRC32HashFunction.hpp>
 #include <Nautilus/Interface/Hash/HashFunction.hpp>
+#include <Nautilus/Interface/Hash/MurMur3HashFunction.hpp>
+#include <Nautilus/Interface/Hash/XXH3HashFunction.hpp>
 #include <static.hpp>
 
 namespace NES::Nautilus::Interface
@@ -33,4 +38,18 @@ HashFunction::HashValue HashFunction::calculate(const std::vector<VarVal>& value
     }
     return hash;
 }
+
+std::unique_ptr<HashFunction> HashFunction::create(const HashFunctionType hashFunctionType)
+{
+    switch (hashFunctionType)
+    {
+        case HashFunctionType::MURMUR3:
+            return std::make_unique<MurMur3HashFunction>();
+        case HashFunctionType::CRC32:
+            return std::make_unique<CRC32HashFunction>();
+        case HashFunctionType::XXH3:
+            return std::make_unique<XXH3HashFunction>();
+    }
+    std::unreachable();
+}
 }
@@ -0,0 +1,107 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+#include <Nautilus/Interface/Hash/XXH3HashFunction.hpp>
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <Nautilus/DataTypes/VarVal.hpp>
+#include <Nautilus/DataTypes/VariableSizedData.hpp>
+#include <Nautilus/Interface/Hash/HashFunction.hpp>
+#include <nautilus/function.hpp>
+#include <nautilus/val.hpp>
+
+namespace NES::Nautilus::Interface
+{
+
+namespace
+{
+/// Constants of XXH3_rrmxmx. The bitflip replaces the two secret words that XXH3 xor-s before subtracting the seed.
+constexpr uint64_t MULTIPLIER = UINT64_C(0x9FB21C651E98DF25);
+constexpr uint64_t BITFLIP = UINT64_C(0xC73AB174C5ECD5A2);
+constexpr uint64_t INPUT_LENGTH = 8;
+
+uint64_t rrmxmx(uint64_t hash, const uint64_t length)
+{
+    hash ^= std::rotl(hash, 49) ^ std::rotl(hash, 24);
+    hash *= MULTIPLIER;
+    hash ^= (hash >> 35U) + length;
+    hash *= MULTIPLIER;
+    return hash ^ (hash >> 28U);
+}
+
+/// Hashes the bytes in steps of 8 bytes. The length is part of the last step, so that trailing zero bytes change the hash.
+uint64_t xxh3Bytes(const uint64_t hash, void* data, const uint64_t length)
+{
+    const auto* const bytes = static_cast<const uint8_t*>(data);
+    auto result = hash;
+    uint64_t offset = 0;
+    for (; offset + sizeof(uint64_t) <= length; offset += sizeof(uint64_t))
+    {
+        uint64_t word = 0;
+        std::memcpy(&word, bytes + offset, sizeof(uint64_t));
+        result = rrmxmx(word ^ (BITFLIP - result), INPUT_LENGTH);
+    }
+    uint64_t tail = 0;
+    if (offset < length)
+    {
+        std::memcpy(&tail, bytes + offset, length - offset);
+    }
+    return rrmxmx(tail ^ (BITFLIP - result), length);
+}
+
+/// Same as rrmxmx() for an input length of 8 bytes, but on traced values
+HashFunction::HashValue rrmxmx(HashFunction::HashValue hash)
+{
+    const auto rotateLeft = [](const HashFunction::HashValue& value, const uint64_t bits)
+    { return (value << HashFunction::HashValue(bits)) | (value >> HashFunction::HashValue(64 - bits)); };
+
+    hash = hash ^ rotateLeft(hash, 49) ^ rotateLeft(hash, 24);
+    hash = hash * HashFunction::HashValue(MULTIPLIER);
+    hash = hash ^ ((hash >> HashFunction::HashValue(35)) + HashFunction::HashValue(INPUT_LENGTH));
+    hash = hash * HashFunction::HashValue(MULTIPLIER);
+    return hash ^ (hash >> HashFunction::HashValue(28));
+}
+}
+
+HashFunction::HashValue XXH3HashFunction::init() const
+{
+    return SEED;
+}
+
+std::unique_ptr<HashFunction> XXH3HashFunction::clone() const
+{
+    return std::make_unique<XXH3HashFunction>(*this);
+}
+
+HashFunction::HashValue XXH3HashFunction::calculate(HashValue& hash, const VarVal& value) const
+{
+    return value
+        .customVisit(
+            [&]<typename T>(const T& val) -> VarVal
+            {
+                if constexpr (std::is_same_v<T, VariableSizedData>)
+                {
+                    return nautilus::invoke(xxh3Bytes, hash, val.getContent(), val.getContentSize());
+                }
+                else
+                {
+                    return rrmxmx(static_cast<nautilus::val<uint64_t>>(val) ^ (HashValue(BITFLIP) - hash));
+                }
+            })
+        .cast<HashValue>();
+}
+}
@@ -52,7 +52,7 @@ std::pair<std::vector<BufferRef::FieldOffsets>, std::vector<BufferRef::FieldOffs
         const auto& fieldValue = field.value();
         fieldsKey.emplace_back(
             BufferRef::FieldOffsets{.fieldIdentifier = fieldValue.name, .type = fieldValue.dataType, .fieldOffset = offset});
-        offset += fieldValue.dataType.getSizeInBytes();
+        offset += getFieldSizeInBytes(fieldValue.dataType);
     }
 
     for (const auto& fieldName : fieldNameValues)
@@ -62,11 +62,66 @@ std::pair<std::vector<BufferRef::FieldOffsets>, std::vector<BufferRef::FieldOffs
         const auto& fieldValue = field.value();
         fieldsValue.emplace_back(
             BufferRef::FieldOffsets{.fieldIdentifier = fieldValue.name, .type = fieldValue.dataType, .fieldOffset = offset});
-        offset += fieldValue.dataType.getSizeInBytes();
+        offset += getFieldSizeInBytes(fieldValue.dataType);
     }
     return {fieldsKey, fieldsValue};
 }
 
+uint64_t ChainedEntryMemoryProvider::getFieldSizeInBytes(const DataType& type)
+{
+    if (type.isType(DataType::Type::VARSIZED_POINTER_REP))
+    {
+        return VAR_SIZED_SLOT_SIZE;
+    }
+    return type.getSizeInBytes();
+}
+
+namespace
+{
+uint32_t readVarSizedSize(const int8_t* varSizedSlot)
+{
+    uint32_t size = 0;
+    std::memcpy(&size, varSizedSlot, sizeof(uint32_t));
+    return size;
+}
+
+/// Returns the pointer to the size followed by the content, which is the slot itself for inlined contents
+const int8_t* getVarSizedData(const int8_t* varSizedSlot)
+{
+    if (readVarSizedSize(varSizedSlot) <= ChainedEntryMemoryProvider::INLINED_VAR_SIZED_SIZE)
+    {
+        return varSizedSlot;
+    }
+    const int8_t* varSizedData = nullptr;
+    std::memcpy(&varSizedData, varSizedSlot + sizeof(uint32_t) + ChainedEntryMemoryProvider::VAR_SIZED_PREFIX_SIZE, sizeof(int8_t*));
+    return varSizedData;
+}
+
+bool isVarSizedEqual(const int8_t* varSizedSlot, const int8_t* otherVarSizedData)
+{
+    const auto size = readVarSizedSize(varSizedSlot);
+    if (size != readVarSizedSize(otherVarSizedData))
+    {
+        return false;
+    }
+
+    /// Both the inlined content and the prefix start directly after the size
+    const auto* const otherContent = otherVarSizedData + sizeof(uint32_t);
+    const auto* const inlinedContent = varSizedSlot + sizeof(uint32_t);
+    if (size <= ChainedEntryMemoryProvider::INLINED_VAR_SIZED_SIZE)
+    {
+        return std::memcmp(inlinedContent, otherContent, size) == 0;
+    }
+    if (std::memcmp(inlinedContent, otherContent, ChainedEntryMemoryProvider::VAR_SIZED_PREFIX_SIZE) != 0)
+    {
+        return false;
+    }
+    const auto* const content = getVarSizedData(varSizedSlot) + sizeof(uint32_t);
+    constexpr auto prefixSize = ChainedEntryMemoryProvider::VAR_SIZED_PREFIX_SIZE;
+    return std::memcmp(content + prefixSize, otherContent + prefixSize, size - prefixSize) == 0;
+}
+}
+
 VarVal ChainedEntryMemoryProvider::readVarVal(
     const nautilus::val<ChainedHashMapEntry*>& entryRef, const Record::RecordFieldIdentifier& fieldName) const
 {
@@ -79,8 +134,7 @@ VarVal ChainedEntryMemoryProvider::readVarVal(
             const auto memoryAddress = castedEntryAddress + fieldOffset;
             if (type.isType(DataType::Type::VARSIZED_POINTER_REP))
             {
-                const auto varSizedDataPtr
-                    = nautilus::invoke(+[](const int8_t** memoryAddressInEntry) { return *memoryAddressInEntry; }, memoryAddress);
+                const auto varSizedDataPtr = nautilus::invoke(getVarSizedData, memoryAddress);
                 VariableSizedData varSizedData(varSizedDataPtr);
                 return varSizedData;
             }
@@ -92,6 +146,24 @@ VarVal ChainedEntryMemoryProvider::readVarVal(
     throw FieldNotFound("Field {} not found in ChainedEntryMemoryProvider", fieldName);
 }
 
+nautilus::val<bool> ChainedEntryMemoryProvider::isFieldEqual(
+    const nautilus::val<ChainedHashMapEntry*>& entryRef, const Record::RecordFieldIdentifier& fieldName, const VarVal& value) const
+{
+    for (const auto& [fieldIdentifier, type, fieldOffset] : nautilus::static_iterable(fields))
+    {
+        if (fieldIdentifier == fieldName)
+        {
+            if (type.isType(DataType::Type::VARSIZED_POINTER_REP))
+            {
+                const auto memoryAddress = static_cast<nautilus::val<int8_t*>>(entryRef) + fieldOffset;
+                return nautilus::invoke(isVarSizedEqual, memoryAddress, value.cast<VariableSizedData>().getReference());
+            }
+            return (readVarVal(entryRef, fieldName) == value).cast<nautilus::val<bool>>();
+        }
+    }
+    throw FieldNotFound("Field {} not found in ChainedEntryMemoryProvider", fieldName);
+}
+
 Record ChainedEntryMemoryProvider::readRecord(const nautilus::val<ChainedHashMapEntry*>& entryRef) const
 {
     Record record;
@@ -115,14 +187,26 @@ void storeVarSized(
     nautilus::invoke(
         +[](ChainedHashMap* hashMap,
             AbstractBufferProvider* bufferProvider,
-            const int8_t** memoryAddressInEntry,
+            int8_t* varSizedSlot,
             const int8_t* varSizedData,
             const uint64_t varSizedDataSize)
         {
+            /// Zeroing the slot, so that the unused bytes of inlined contents do not depend on previous entries
+            std::memset(varSizedSlot, 0, ChainedEntryMemoryProvider::VAR_SIZED_SLOT_SIZE);
+            const auto contentSize = varSizedDataSize - sizeof(uint32_t);
+            if (contentSize <= ChainedEntryMemoryProvider::INLINED_VAR_SIZED_SIZE)
+            {
+                std::memcpy(varSizedSlot, varSizedData, varSizedDataSize);
+                return;
+            }
+
             auto spaceForVarSizedData = hashMap->allocateSpaceForVarSized(bufferProvider, varSizedDataSize);
             const std::span<const int8_t> varSizedSpan{varSizedData, varSizedData + varSizedDataSize};
             std::ranges::copy(std::as_bytes(varSizedSpan), spaceForVarSizedData.begin());
-            *memoryAddressInEntry = reinterpret_cast<const signed char*>(spaceForVarSizedData.data());
+            const auto* const outOfLineVarSizedData = reinterpret_cast<const int8_t*>(spaceForVarSizedData.data());
+            constexpr auto sizeAndPrefixSize = sizeof(uint32_t) + ChainedEntryMemoryProvider::VAR_SIZED_PREFIX_SIZE;
+            std::memcpy(varSizedSlot, varSizedData, sizeAndPrefixSize);
+            std::memcpy(varSizedSlot + sizeAndPrefixSize, &outOfLineVarSizedData, sizeof(int8_t*));
         },
         hashMapRef,
         bufferProviderRef,
@@ -22,9 +22,11 @@
 #include <memory>
 #include <span>
 #include <string>
+#include <utility>
 #include <Nautilus/Interface/Hash/HashFunction.hpp>
 #include <Nautilus/Interface/HashMap/HashMap.hpp>
 #include <Runtime/AbstractBufferProvider.hpp>
+#include <Runtime/TupleBuffer.hpp>
 #include <ErrorHandling.hpp>
 
 namespace NES::Nautilus::Interface
@@ -64,6 +66,11 @@ ChainedHashMap::ChainedHashMap(uint64_t entrySize, const uint64_t numberOfBucket
     , numberOfChains(calcCapacity(numberOfBuckets, assumedLoadFactor))
     , entries(nullptr)
     , mask(numberOfChains - 1)
+    , oldEntries(nullptr)
+    , oldNumberOfChains(0)
+    , numberOfMigratedChains(0)
+    , numberOfUsedChains(0)
+    , numberOfResizes(0)
     , destructorCallBack(nullptr)
 {
     PRECONDITION(entrySize > 0, "Entry size has to be greater than 0. Entry size is set to small for entry size {}", entrySize);
@@ -90,6 +97,11 @@ ChainedHashMap::ChainedHashMap(const uint64_t keySize, const uint64_t valueSize,
     , numberOfChains(calcCapacity(numberOfBuckets, assumedLoadFactor))
     , entries(nullptr)
     , mask(numberOfChains - 1)
+    , oldEntries(nullptr)
+    , oldNumberOfChains(0)
+    , numberOfMigratedChains(0)
+    , numberOfUsedChains(0)
+    , numberOfResizes(0)
     , destructorCallBack({})
 {
     PRECONDITION(entrySize > 0, "Entry size has to be greater than 0. Entry size is set to small for entry size {}", entrySize);
@@ -120,13 +132,40 @@ void ChainedHashMap::setDestructorCallback(const std::function<void(ChainedHashM
 
 std::unique_ptr<ChainedHashMap> ChainedHashMap::createNewMapWithSameConfiguration(const ChainedHashMap& other)
 {
-    return std::make_unique<ChainedHashMap>(other.entrySize, other.numberOfChains, other.pageSize);
+    return other.createEmptyMapWithSameConfiguration();
+}
+
+std::unique_ptr<ChainedHashMap> ChainedHashMap::createEmptyMapWithSameConfiguration() const
+{
+    return std::make_unique<ChainedHashMap>(entrySize, numberOfChains, pageSize);
 }
 
 ChainedHashMapEntry* ChainedHashMap::findChain(const HashFunction::HashValue::raw_type hash) const
 {
-    const auto entryStartPos = hash & mask;
-    return entries[entryStartPos];
+    return *getChainPosition(hash);
+}
+
+void ChainedHashMap::prefetchBucket(const HashFunction::HashValue::raw_type hash) const
+{
+    if (entries != nullptr)
+    {
+        __builtin_prefetch(getChainPosition(hash));
+    }
+}
+
+ChainedHashMapEntry** ChainedHashMap::getChainPosition(const HashFunction::HashValue::raw_type hash) const
+{
+    if (oldNumberOfChains > 0)
+    {
+        /// While migrating, the chain is still located in the previous entry space, if its position has not been migrated yet
+        if (const auto oldEntryPos = hash & (oldNumberOfChains - 1); oldEntryPos >= numberOfMigratedChains)
+        {
+            return &oldEntries[oldEntryPos];
+        }
+    }
+    const auto entryPos = hash & mask;
+    INVARIANT(entryPos < numberOfChains, "Invalid entry position as pos {} is greater than capacity {}", entryPos, numberOfChains);
+    return &entries[entryPos];
 }
 
 std::span<std::byte> ChainedHashMap::allocateSpaceForVarSized(AbstractBufferProvider* bufferProvider, const size_t neededSize)
@@ -158,24 +197,110 @@ AbstractHashMapEntry* ChainedHashMap::insertEntry(const HashFunction::HashValue:
     /// 0. Checking, if we have to set fill the entry space. This should be only done once, i.e., when the entries are still null
     if (entries == nullptr) [[unlikely]]
     {
-        /// We add one more entry to the capacity, as we need to have a valid entry for the last entry in the entries array
-        /// We will be using this entry for checking, if we are at the end of our hash map in our EntryIterator
-        const auto totalSpace = (numberOfChains + 1) * sizeof(ChainedHashMapEntry*);
-        const auto entryBuffer = bufferProvider->getUnpooledBuffer(totalSpace);
-        if (not entryBuffer)
+        entrySpace = allocateEntrySpace(numberOfChains, bufferProvider);
+        entries = reinterpret_cast<ChainedHashMapEntry**>(entrySpace.getAvailableMemoryArea().data());
+    }
+    else if (const auto exceedsLoadFactor = static_cast<double>(numberOfTuples + 1) > MAX_LOAD_FACTOR * static_cast<double>(numberOfChains);
+             exceedsLoadFactor and oldNumberOfChains == 0) [[unlikely]]
+    {
+        grow(bufferProvider);
+    }
+
+    /// 1. Moving a few chains of the previous entry space, so that no single insert pays for relinking all entries
+    if (oldNumberOfChains > 0)
+    {
+        migrateChains(CHAINS_MIGRATED_PER_INSERT);
+    }
+
+    /// 2. Allocating the new entry in the storage space
+    auto* const newEntry = allocateEntry(hash, bufferProvider);
+
+    /// 3. Updating the chain
+    auto* const chainPosition = getChainPosition(hash);
+    if (*chainPosition == nullptr)
+    {
+        ++numberOfUsedChains;
+    }
+    newEntry->next = *chainPosition;
+    *chainPosition = newEntry;
+    return newEntry;
+}
+
+TupleBuffer ChainedHashMap::allocateEntrySpace(const uint64_t newNumberOfChains, AbstractBufferProvider* bufferProvider) const
+{
+    /// We add one more entry to the capacity, as we need to have a valid entry for the last entry in the entries array
+    /// We will be using this entry for checking, if we are at the end of our hash map in our EntryIterator
+    const auto totalSpace = (newNumberOfChains + 1) * sizeof(ChainedHashMapEntry*);
+    const auto entryBuffer = bufferProvider->getUnpooledBuffer(totalSpace);
+    if (not entryBuffer)
+    {
+        throw CannotAllocateBuffer("Could not allocate memory for ChainedHashMap of size {}", std::to_string(totalSpace));
+    }
+    auto* const newEntries = reinterpret_cast<ChainedHashMapEntry**>(entryBuffer->getAvailableMemoryArea().data());
+    std::memset(static_cast<void*>(newEntries), 0, entryBuffer->getBufferSize());
+
+    /// Pointing the end of the entries to itself
+    newEntries[newNumberOfChains] = reinterpret_cast<ChainedHashMapEntry*>(&newEntries[newNumberOfChains]);
+    return entryBuffer.value();
+}
+
+void ChainedHashMap::grow(AbstractBufferProvider* bufferProvider)
+{
+    PRECONDITION(oldNumberOfChains == 0, "Can not grow the ChainedHashMap while migrating {} chains", oldNumberOfChains);
+    auto newEntrySpace = allocateEntrySpace(numberOfChains * 2, bufferProvider);
+
+    /// Keeping the previous entry space, until all of its chains have been migrated
+    oldEntrySpace = std::move(entrySpace);
+    oldEntries = entries;
+    oldNumberOfChains = numberOfChains;
+    numberOfMigratedChains = 0;
+
+    entrySpace = std::move(newEntrySpace);
+    entries = reinterpret_cast<ChainedHashMapEntry**>(entrySpace.getAvailableMemoryArea().data());
+    numberOfChains *= 2;
+    mask = numberOfChains - 1;
+    ++numberOfResizes;
+}
+
+void ChainedHashMap::migrateChains(const uint64_t numberOfChainsToMigrate)
+{
+    /// As the number of chains doubles, the entries of an old chain are split between two new chains.
+    /// The entries stay at their position in the storage space, we solely relink them.
+    const auto lastChainToMigrate = std::min(numberOfMigratedChains + numberOfChainsToMigrate, oldNumberOfChains);
+    for (; numberOfMigratedChains < lastChainToMigrate; ++numberOfMigratedChains)
+    {
+        auto* entry = oldEntries[numberOfMigratedChains];
+        if (entry != nullptr)
         {
-            throw CannotAllocateBuffer("Could not allocate memory for ChainedHashMap of size {}", std::to_string(totalSpace));
+            --numberOfUsedChains;
         }
-        entrySpace = entryBuffer.value();
-        entries = reinterpret_cast<ChainedHashMapEntry**>(entrySpace.getAvailableMemoryArea().data());
-        std::memset(static_cast<void*>(entries), 0, entryBuffer->getBufferSize());
+        while (entry != nullptr)
+        {
+            auto* const next = entry->next;
+            auto*& chainStart = entries[entry->hash & mask];
+            if (chainStart == nullptr)
+            {
+                ++numberOfUsedChains;
+            }
+            entry->next = chainStart;
+            chainStart = entry;
+            entry = next;
+        }
+    }
 
-        /// Pointing the end of the entries to itself
-        entries[numberOfChains] = reinterpret_cast<ChainedHashMapEntry*>(&entries[numberOfChains]);
+    if (numberOfMigratedChains == oldNumberOfChains)
+    {
+        oldEntrySpace = TupleBuffer();
+        oldEntries = nullptr;
+        oldNumberOfChains = 0;
+        numberOfMigratedChains = 0;
     }
+}
 
-    /// 1. Check if we need to allocate a new page
-    if (numberOfTuples % entriesPerPage == 0)
+ChainedHashMapEntry* ChainedHashMap::allocateEntry(const HashFunction::HashValue::raw_type hash, AbstractBufferProvider* bufferProvider)
+{
+    /// 1. Check if we need to allocate a new page. A recycled hash map fills its retained pages first, c.f., clearForReuse()
+    if (numberOfTuples % entriesPerPage == 0 and numberOfTuples / entriesPerPage >= storageSpace.size())
     {
         auto newPage = bufferProvider->getUnpooledBuffer(pageSize);
         if (not newPage)
@@ -197,16 +322,8 @@ AbstractHashMapEntry* ChainedHashMap::insertEntry(const HashFunction::HashValue:
     bufferStorage.setNumberOfTuples(bufferStorage.getNumberOfTuples() + 1);
     const auto entryOffsetInBuffer = (numberOfTuples - (pageIndex * entriesPerPage)) * entrySize;
 
-    /// 3. Inserting the new entry
-    const auto entryPos = hash & mask;
-    INVARIANT(entryPos <= mask, "Invalid entry position, as pos {} is greater than mask {}", entryPos, mask);
-    INVARIANT(entryPos < numberOfChains, "Invalid entry position as pos {} is greater than capacity {}", entryPos, numberOfChains);
+    /// 3. Creating the new entry and updating the current size
     auto* const newEntry = new (bufferStorage.getAvailableMemoryArea().subspan(entryOffsetInBuffer).data()) ChainedHashMapEntry(hash);
-
-    /// 4. Updating the chain and the current size
-    auto* const oldValue = entries[entryPos];
-    newEntry->next = oldValue;
-    entries[entryPos] = newEntry;
     this->numberOfTuples++;
     return newEntry;
 }
@@ -233,29 +350,78 @@ uint64_t ChainedHashMap::getNumberOfChains() const
     return numberOfChains;
 }
 
+BucketStatistics ChainedHashMap::getBucketStatistics() const
+{
+    return {
+        .numberOfBuckets = numberOfChains,
+        .numberOfUsedBuckets = numberOfUsedChains,
+        .numberOfEntries = numberOfTuples,
+        .numberOfResizes = numberOfResizes};
+}
+
+void ChainedHashMap::forEachEntry(const std::function<void(ChainedHashMapEntry*)>& function)
+{
+    /// We iterate over the storage space, as every entry is stored in exactly one page, regardless of how the entries are linked.
+    for (auto& page : storageSpace)
+    {
+        const auto memArea = page.getAvailableMemoryArea();
+        for (uint64_t entryIdx = 0; entryIdx < page.getNumberOfTuples(); ++entryIdx)
+        {
+            function(reinterpret_cast<ChainedHashMapEntry*>(memArea.subspan(entryIdx * entrySize).data()));
+        }
+    }
+}
+
 void ChainedHashMap::clear() noexcept
 {
     /// Deleting all entries in the hash map
-    if (entries != nullptr and destructorCallBack != nullptr)
+    if (destructorCallBack != nullptr)
     {
         /// Calling for every value in the hash map the destructor callback
-        /// We start here by iterating over all entries while starting in the entry space
-        for (uint64_t entryIdx = 0; entryIdx < numberOfChains; ++entryIdx)
-        {
-            auto* entry = entries[entryIdx];
-            while (entry != nullptr)
-            {
-                auto* next = entry->next;
-                destructorCallBack(entry);
-                entry = next;
-            }
-        }
+        forEachEntry(destructorCallBack);
     }
     entries = nullptr;
+    oldEntrySpace = TupleBuffer();
+    oldEntries = nullptr;
+    oldNumberOfChains = 0;
+    numberOfMigratedChains = 0;
+    numberOfUsedChains = 0;
     numberOfTuples = 0;
 
     /// Releasing all memory
     storageSpace.clear();
 }
 
+void ChainedHashMap::clearForReuse(const uint64_t maxRetainedPages) noexcept
+{
+    if (destructorCallBack != nullptr)
+    {
+        forEachEntry(destructorCallBack);
+    }
+    oldEntrySpace = TupleBuffer();
+    oldEntries = nullptr;
+    oldNumberOfChains = 0;
+    numberOfMigratedChains = 0;
+    numberOfUsedChains = 0;
+    numberOfTuples = 0;
+
+    /// Keeping the entry space, whose last entry points to itself to mark the end of the entries, c.f., allocateEntrySpace()
+    if (entries != nullptr)
+    {
+        std::memset(static_cast<void*>(entries), 0, numberOfChains * sizeof(ChainedHashMapEntry*));
+    }
+
+    /// Retained pages are zeroed, as allocateEntry() zeroes new pages
+    if (storageSpace.size() > maxRetainedPages)
+    {
+        storageSpace.resize(maxRetainedPages);
+    }
+    for (auto& page : storageSpace)
+    {
+        std::ranges::fill(page.getAvailableMemoryArea(), std::byte{0});
+        page.setNumberOfTuples(0);
+    }
+    varSizedSpace.clear();
+}
+
 }
@@ -18,6 +18,7 @@
 #include <exception>
 #include <functional>
 #include <limits>
+#include <span>
 #include <utility>
 #include <vector>
 #include <DataTypes/DataType.hpp>
@@ -174,10 +175,14 @@ nautilus::val<ChainedHashMapEntry*> ChainedHashMapRef::findKey(const Nautilus::R
     auto entry = findChain(hash);
     while (entry)
     {
+        /// Comparing the stored hash first, as it is cheaper than comparing the keys, e.g., var sized keys
         const ChainedEntryRef entryRef(entry, hashMapRef, fieldKeys, fieldValues);
-        if (compareKeys(entryRef, recordKey))
+        if (entryRef.getHash() == hash)
         {
-            return entry;
+            if (compareKeys(entryRef, recordKey))
+            {
+                return entry;
+            }
         }
         entry = entryRef.getNext();
     }
@@ -266,6 +271,23 @@ void ChainedHashMapRef::insertOrUpdateEntry(
     }
 }
 
+void ChainedHashMapRef::prefetchBuckets(
+    const nautilus::val<HashMap**>& hashMaps, const nautilus::val<uint64_t>& numberOfHashMaps, const HashFunction::HashValue& hash)
+{
+    /// All hash maps of an operator derive from the ChainedHashMap, thus a static_cast suffices and we avoid a dynamic_cast per key
+    nautilus::invoke(
+        +[](HashMap** hashMapsValue, const uint64_t numberOfHashMapsValue, const HashFunction::HashValue::raw_type hashValue)
+        {
+            for (const auto* hashMap : std::span{hashMapsValue, numberOfHashMapsValue})
+            {
+                static_cast<const ChainedHashMap*>(hashMap)->prefetchBucket(hashValue);
+            }
+        },
+        hashMaps,
+        numberOfHashMaps,
+        hash);
+}
+
 ChainedHashMapRef::EntryIterator ChainedHashMapRef::begin() const
 {
     const nautilus::val<uint64_t> tupleIndex = 0;
@@ -308,6 +330,18 @@ nautilus::val<ChainedHashMapEntry*> ChainedHashMapRef::findChain(const HashFunct
         return nullptr;
     }
 
+    /// While the hash map migrates its chains after a resize, the chain might still be located in the previous entry space.
+    /// Instead of tracing the lookup in both entry spaces, we let the hash map find the chain until the migration has finished.
+    const auto oldNumberOfChainsRef = Util::getMemberRef(hashMapRef, &ChainedHashMap::oldNumberOfChains);
+    if (const auto oldNumberOfChains = Util::readValueFromMemRef<uint64_t>(oldNumberOfChainsRef); oldNumberOfChains > 0)
+    {
+        return nautilus::invoke(
+            +[](const HashMap* hashMap, const HashFunction::HashValue::raw_type hashValue)
+            { return dynamic_cast<const ChainedHashMap*>(hashMap)->findChain(hashValue); },
+            hashMapRef,
+            hash);
+    }
+
     const auto maskRef = Util::getMemberRef(hashMapRef, &ChainedHashMap::mask);
     auto mask = Util::readValueFromMemRef<uint64_t>(maskRef);
     const auto entryStartPos = hash & mask;
@@ -333,7 +367,7 @@ nautilus::val<bool> ChainedHashMapRef::compareKeys(const ChainedEntryRef& entryR
 {
     for (const auto& [fieldIdentifier, type, fieldOffset] : nautilus::static_iterable(fieldKeys))
     {
-        if (keys.read(fieldIdentifier) != entryRef.getKey(fieldIdentifier))
+        if (not entryRef.memoryProviderKeys.isFieldEqual(entryRef.entryRef, fieldIdentifier, keys.read(fieldIdentifier)))
         {
             return false;
         }
@@ -0,0 +1,257 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+#include <Nautilus/Interface/HashMap/OpenAddressingHashMap/OpenAddressingHashMap.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <Nautilus/Interface/Hash/HashFunction.hpp>
+#include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMap.hpp>
+#include <Nautilus/Interface/HashMap/HashMap.hpp>
+#include <Runtime/AbstractBufferProvider.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <ErrorHandling.hpp>
+
+#if defined(__x86_64__)
+    #include <immintrin.h>
+#endif
+
+namespace NES::Nautilus::Interface
+{
+
+namespace
+{
+/// The control byte of an occupied slot stores the upper 7 bits of the hash, as the lower bits determine the start of the probe sequence
+uint8_t toTag(const HashFunction::HashValue::raw_type hash)
+{
+    return static_cast<uint8_t>(hash >> 57U);
+}
+
+/// Returns a bitmask, in which bit i is set, if control byte i of the group is equal to the value
+#if defined(__x86_64__)
+/// SSE2 is part of the x86-64 baseline, thus it does not require a target attribute
+uint32_t matchGroup(const uint8_t* group, const uint8_t value)
+{
+    const auto controlBytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group)); /// NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(controlBytes, _mm_set1_epi8(static_cast<char>(value)))));
+}
+#else
+uint32_t matchGroup(const uint8_t* group, const uint8_t value)
+{
+    uint32_t matches = 0;
+    for (uint64_t i = 0; i < OpenAddressingHashMap::GROUP_SIZE; ++i)
+    {
+        matches |= static_cast<uint32_t>(group[i] == value) << i;
+    }
+    return matches;
+}
+#endif
+}
+
+OpenAddressingHashMap::OpenAddressingHashMap(const uint64_t entrySize, const uint64_t numberOfBuckets, const uint64_t pageSize)
+    : ChainedHashMap(entrySize, numberOfBuckets, pageSize)
+    , slots(nullptr)
+    , controlBytes(nullptr)
+    , capacity(std::max(numberOfChains, GROUP_SIZE))
+    , slotMask(capacity - 1)
+{
+}
+
+OpenAddressingHashMap::OpenAddressingHashMap(
+    const uint64_t keySize, const uint64_t valueSize, const uint64_t numberOfBuckets, const uint64_t pageSize)
+    : ChainedHashMap(keySize, valueSize, numberOfBuckets, pageSize)
+    , slots(nullptr)
+    , controlBytes(nullptr)
+    , capacity(std::max(numberOfChains, GROUP_SIZE))
+    , slotMask(capacity - 1)
+{
+}
+
+std::unique_ptr<ChainedHashMap> OpenAddressingHashMap::createEmptyMapWithSameConfiguration() const
+{
+    return std::make_unique<OpenAddressingHashMap>(entrySize, numberOfChains, pageSize);
+}
+
+uint64_t OpenAddressingHashMap::getStartOfProbeSequence(const HashFunction::HashValue::raw_type hash) const
+{
+    return hash & slotMask & ~(GROUP_SIZE - 1);
+}
+
+AbstractHashMapEntry*
+OpenAddressingHashMap::insertEntry(const HashFunction::HashValue::raw_type hash, AbstractBufferProvider* bufferProvider)
+{
+    /// 0. Allocating the slot space on the first insert or growing it, if the new entry would exceed the load factor
+    if (slots == nullptr) [[unlikely]]
+    {
+        allocateSlotSpace(capacity, bufferProvider);
+    }
+    else if (static_cast<double>(numberOfTuples + 1) > MAX_LOAD_FACTOR * static_cast<double>(capacity)) [[unlikely]]
+    {
+        grow(bufferProvider);
+    }
+
+    /// 1. Allocating the new entry in the storage space and inserting a pointer to it into the slot space
+    auto* const newEntry = allocateEntry(hash, bufferProvider);
+    insertIntoSlotSpace(newEntry);
+    return newEntry;
+}
+
+void OpenAddressingHashMap::allocateSlotSpace(const uint64_t newCapacity, AbstractBufferProvider* bufferProvider)
+{
+    PRECONDITION(
+        (newCapacity % GROUP_SIZE) == 0 and std::has_single_bit(newCapacity),
+        "Capacity {} has to be a power of 2 and a multiple of the group size {}",
+        newCapacity,
+        GROUP_SIZE);
+    const auto totalSpace = newCapacity * (sizeof(ChainedHashMapEntry*) + sizeof(uint8_t));
+    const auto slotBuffer = bufferProvider->getUnpooledBuffer(totalSpace);
+    if (not slotBuffer)
+    {
+        throw CannotAllocateBuffer("Could not allocate memory for OpenAddressingHashMap of size {}", std::to_string(totalSpace));
+    }
+
+    /// We store the pointers in front of the control bytes to keep them aligned
+    slotSpace = slotBuffer.value();
+    const auto memArea = slotSpace.getAvailableMemoryArea();
+    /// NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+    slots = reinterpret_cast<ChainedHashMapEntry**>(memArea.data());
+    controlBytes = reinterpret_cast<uint8_t*>(memArea.subspan(newCapacity * sizeof(ChainedHashMapEntry*)).data());
+    /// NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+    std::memset(controlBytes, EMPTY, newCapacity);
+    capacity = newCapacity;
+    slotMask = newCapacity - 1;
+}
+
+void OpenAddressingHashMap::grow(AbstractBufferProvider* bufferProvider)
+{
+    /// Keeping the old slot space alive until we have reinserted all entries
+    const auto oldSlotSpace = slotSpace;
+    auto* const* const oldSlots = slots;
+    const auto* const oldControlBytes = controlBytes;
+    const auto oldCapacity = capacity;
+
+    allocateSlotSpace(oldCapacity * 2, bufferProvider);
+    ++numberOfResizes;
+    for (uint64_t slot = 0; slot < oldCapacity; ++slot)
+    {
+        if (oldControlBytes[slot] != EMPTY)
+        {
+            insertIntoSlotSpace(oldSlots[slot]);
+        }
+    }
+}
+
+void OpenAddressingHashMap::insertIntoSlotSpace(ChainedHashMapEntry* entry)
+{
+    /// As we never delete single entries, the occupied slots of each group are a prefix of the group.
+    /// Thus, the first empty slot in the probe sequence is the lowest empty slot of the first group with an empty slot.
+    const auto startOfProbeSequence = getStartOfProbeSequence(entry->hash);
+    for (uint64_t groupPosition = 0; groupPosition < capacity; groupPosition += GROUP_SIZE)
+    {
+        const auto groupStart = (startOfProbeSequence + groupPosition) & slotMask;
+        if (const auto emptySlots = matchGroup(controlBytes + groupStart, EMPTY); emptySlots != 0)
+        {
+            const auto slot = groupStart + std::countr_zero(emptySlots);
+            controlBytes[slot] = toTag(entry->hash);
+            slots[slot] = entry;
+            return;
+        }
+    }
+    INVARIANT(false, "The slot space of the OpenAddressingHashMap is full for capacity {}", capacity);
+}
+
+uint64_t OpenAddressingHashMap::findCandidate(const HashFunction::HashValue::raw_type hash, const uint64_t probePosition) const
+{
+    if (slots == nullptr)
+    {
+        return NO_CANDIDATE;
+    }
+
+    const auto startOfProbeSequence = getStartOfProbeSequence(hash);
+    const auto tag = toTag(hash);
+    for (auto groupPosition = probePosition & ~(GROUP_SIZE - 1); groupPosition < capacity; groupPosition += GROUP_SIZE)
+    {
+        const auto* const group = controlBytes + ((startOfProbeSequence + groupPosition) & slotMask);
+        auto candidates = matchGroup(group, tag);
+        if (groupPosition < probePosition)
+        {
+            /// Ignoring all slots in front of the probe position, as their keys have been compared already
+            candidates &= ~uint32_t{0} << (probePosition - groupPosition);
+        }
+        if (candidates != 0)
+        {
+            return groupPosition + std::countr_zero(candidates);
+        }
+        if (matchGroup(group, EMPTY) != 0)
+        {
+            return NO_CANDIDATE;
+        }
+    }
+    return NO_CANDIDATE;
+}
+
+ChainedHashMapEntry* OpenAddressingHashMap::getCandidate(const HashFunction::HashValue::raw_type hash, const uint64_t probePosition) const
+{
+    PRECONDITION(probePosition < capacity, "Probe position {} is greater than the capacity {}", probePosition, capacity);
+    return slots[(getStartOfProbeSequence(hash) + probePosition) & slotMask];
+}
+
+void OpenAddressingHashMap::prefetchBucket(const HashFunction::HashValue::raw_type hash) const
+{
+    if (slots != nullptr)
+    {
+        const auto startOfProbeSequence = getStartOfProbeSequence(hash);
+        __builtin_prefetch(controlBytes + startOfProbeSequence);
+        /// The pointers of a group span two cache lines
+        __builtin_prefetch(slots + startOfProbeSequence);
+        __builtin_prefetch(slots + startOfProbeSequence + (GROUP_SIZE / 2));
+    }
+}
+
+uint64_t OpenAddressingHashMap::getCapacity() const
+{
+    return capacity;
+}
+
+BucketStatistics OpenAddressingHashMap::getBucketStatistics() const
+{
+    return {
+        .numberOfBuckets = capacity,
+        .numberOfUsedBuckets = numberOfTuples,
+        .numberOfEntries = numberOfTuples,
+        .numberOfResizes = numberOfResizes};
+}
+
+void OpenAddressingHashMap::clear() noexcept
+{
+    ChainedHashMap::clear();
+    slotSpace = TupleBuffer();
+    slots = nullptr;
+    controlBytes = nullptr;
+}
+
+void OpenAddressingHashMap::clearForReuse(const uint64_t maxRetainedPages) noexcept
+{
+    ChainedHashMap::clearForReuse(maxRetainedPages);
+    /// Emptying the control bytes suffices, as the slots of empty control bytes are never read
+    if (controlBytes != nullptr)
+    {
+        std::memset(controlBytes, EMPTY, capacity);
+    }
+}
+
+}
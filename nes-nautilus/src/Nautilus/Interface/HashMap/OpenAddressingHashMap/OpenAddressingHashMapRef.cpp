@@ -0,0 +1,74 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+#include <Nautilus/Interface/HashMap/OpenAddressingHashMap/OpenAddressingHashMapRef.hpp>
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include <Nautilus/DataTypes/DataTypesUtil.hpp>
+#include <Nautilus/Interface/Hash/HashFunction.hpp>
+#include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMap.hpp>
+#include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMapRef.hpp>
+#include <Nautilus/Interface/HashMap/HashMap.hpp>
+#include <Nautilus/Interface/HashMap/OpenAddressingHashMap/OpenAddressingHashMap.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <nautilus/function.hpp>
+#include <nautilus/val.hpp>
+#include <nautilus/val_ptr.hpp>
+
+namespace NES::Nautilus::Interface
+{
+
+OpenAddressingHashMapRef::OpenAddressingHashMapRef(
+    const nautilus::val<HashMap*>& hashMapRef,
+    std::vector<BufferRef::FieldOffsets> fieldsKey,
+    std::vector<BufferRef::FieldOffsets> fieldsValue,
+    const nautilus::val<uint64_t>& entriesPerPage,
+    const nautilus::val<uint64_t>& entrySize)
+    : ChainedHashMapRef(hashMapRef, std::move(fieldsKey), std::move(fieldsValue), entriesPerPage, entrySize)
+{
+}
+
+nautilus::val<ChainedHashMapEntry*>
+OpenAddressingHashMapRef::findKey(const Nautilus::Record& recordKey, const HashFunction::HashValue& hash) const
+{
+    const auto findCandidate = +[](const HashMap* hashMap, const HashFunction::HashValue::raw_type hashValue, const uint64_t probePosition)
+    { return dynamic_cast<const OpenAddressingHashMap*>(hashMap)->findCandidate(hashValue, probePosition); };
+
+    auto probePosition = nautilus::invoke(findCandidate, hashMapRef, hash, nautilus::val<uint64_t>(0));
+    while (probePosition != OpenAddressingHashMap::NO_CANDIDATE)
+    {
+        /// Reading the candidate from the slot space, as findCandidate() only returns its position in the probe sequence
+        const auto slotMask
+            = Util::readValueFromMemRef<uint64_t>(Util::getMemberRef(hashMapRef, &OpenAddressingHashMap::slotMask));
+        const auto slots
+            = Util::readValueFromMemRef<ChainedHashMapEntry**>(Util::getMemberRef(hashMapRef, &OpenAddressingHashMap::slots));
+        const auto startOfProbeSequence = hash & slotMask & ~(OpenAddressingHashMap::GROUP_SIZE - 1);
+        const nautilus::val<ChainedHashMapEntry*> candidate = slots[(startOfProbeSequence + probePosition) & slotMask];
+
+        /// The tag solely matches 7 bits of the hash. Thus, comparing the stored hash first avoids most key comparisons of other keys.
+        const ChainedEntryRef entryRef(candidate, hashMapRef, fieldKeys, fieldValues);
+        if (entryRef.getHash() == hash)
+        {
+            if (compareKeys(entryRef, recordKey))
+            {
+                return candidate;
+            }
+        }
+        probePosition = nautilus::invoke(findCandidate, hashMapRef, hash, probePosition + 1);
+    }
+    return nullptr;
+}
+
+}
@@ -14,13 +14,16 @@
 #include <Nautilus/Interface/PagedVector/PagedVector.hpp>
 
 #include <algorithm>
+#include <array>
 #include <cstddef>
 #include <cstdint>
+#include <cstdio>
 #include <functional>
 #include <iterator>
 #include <memory>
 #include <optional>
 #include <ranges>
+#include <utility>
 #include <vector>
 #include <MemoryLayout/MemoryLayout.hpp>
 #include <Runtime/AbstractBufferProvider.hpp>
@@ -37,17 +40,28 @@ void PagedVector::appendPageIfFull(AbstractBufferProvider* bufferProvider, const
     PRECONDITION(memoryLayout->getTupleSize() > 0, "EntrySize for a pagedVector has to be larger than 0!");
     PRECONDITION(memoryLayout->getCapacity() > 0, "At least one tuple has to fit on a page!");
 
-    if (pages.getNumberOfPages() == 0 || pages.getNumberOfTuplesLastPage() >= memoryLayout->getCapacity())
+    if (pages.getNumberOfPages() == 0 || isLastPageShared || pages.getNumberOfTuplesLastPage() >= memoryLayout->getCapacity())
     {
         if (const auto page = bufferProvider->getUnpooledBuffer(memoryLayout->getBufferSize()); page.has_value())
         {
             pages.addPage(page.value());
+            isLastPageShared = false;
         }
         else
         {
             throw BufferAllocationFailure("No unpooled TupleBuffer available!");
         }
     }
+    lastPageForAppend = std::addressof(pages.getLastPage());
+    numberOfTuplesLastPage = lastPageForAppend->getNumberOfTuples();
+    capacityLastPage = memoryLayout->getCapacity();
+}
+
+void PagedVector::invalidateLastPageForAppend()
+{
+    lastPageForAppend = nullptr;
+    numberOfTuplesLastPage = 0;
+    capacityLastPage = 0;
 }
 
 void PagedVector::PagesWrapper::updateCumulativeSumLastItem()
@@ -61,25 +75,185 @@ void PagedVector::PagesWrapper::updateCumulativeSumLastItem()
     lastItem.cumulativeSum = lastItem.buffer.getNumberOfTuples() + penultimateCumulativeSum;
 }
 
-void PagedVector::PagesWrapper::updateCumulativeSumAllPages()
+void PagedVector::PagesWrapper::updateCumulativeSumPagesFrom(const size_t firstPageIndex)
 {
-    size_t curCumulativeSum = 0;
-    for (auto& page : pages)
+    size_t curCumulativeSum = (firstPageIndex == 0) ? 0 : pages[firstPageIndex - 1].cumulativeSum;
+    for (auto& page : pages | std::views::drop(firstPageIndex))
     {
         page.cumulativeSum = page.buffer.getNumberOfTuples() + curCumulativeSum;
         curCumulativeSum = page.cumulativeSum;
     }
 }
 
+void PagedVector::PagesWrapper::trackEntriesPerPage(const uint64_t numberOfEntriesOnPage)
+{
+    if (entriesPerPage == 0)
+    {
+        entriesPerPage = numberOfEntriesOnPage;
+        hasSameEntriesPerPage = hasSameEntriesPerPage and numberOfEntriesOnPage > 0;
+    }
+    else if (numberOfEntriesOnPage != entriesPerPage)
+    {
+        hasSameEntriesPerPage = false;
+    }
+}
+
 void PagedVector::moveAllPages(PagedVector& other)
 {
-    copyFrom(other);
-    other.pages.clearPages();
+    if (other.pages.getNumberOfPages() > 0)
+    {
+        /// The moved pages are referenced by the same vectors as before, thus the last page of other might still be shared
+        isLastPageShared = other.isLastPageShared;
+    }
+    pages.addPages(std::move(other.pages));
+    invalidateLastPageForAppend();
+    other.isLastPageShared = false;
+    other.invalidateLastPageForAppend();
 }
 
 void PagedVector::copyFrom(const PagedVector& other)
 {
+    if (other.pages.getNumberOfPages() > 0)
+    {
+        isLastPageShared = true;
+    }
     pages.addPages(other.pages);
+    invalidateLastPageForAppend();
+}
+
+uint64_t PagedVector::getSizeOfPagesInBytes() const
+{
+    uint64_t sizeInBytes = 0;
+    for (size_t pageIndex = 0; pageIndex < pages.getNumberOfPages(); ++pageIndex)
+    {
+        sizeInBytes += pages[pageIndex].buffer.getBufferSize();
+    }
+    return sizeInBytes;
+}
+
+bool PagedVector::spillPages(std::FILE* file)
+{
+    PRECONDITION(file != nullptr, "The spill file must not be null");
+    PRECONDITION(spilledPages.empty(), "The pages of this PagedVector have been spilled already");
+    for (size_t pageIndex = 0; pageIndex < pages.getNumberOfPages(); ++pageIndex)
+    {
+        if (pages[pageIndex].buffer.getNumberOfChildBuffers() > 0)
+        {
+            return false;
+        }
+    }
+
+    if (std::fseek(file, 0, SEEK_END) != 0)
+    {
+        throw CannotSpillState("Could not seek to the end of the spill file");
+    }
+    for (size_t pageIndex = 0; pageIndex < pages.getNumberOfPages(); ++pageIndex)
+    {
+        const auto& page = pages[pageIndex].buffer;
+        const auto offset = std::ftell(file);
+        const auto memArea = page.getAvailableMemoryArea();
+        if (offset < 0 or std::fwrite(memArea.data(), 1, memArea.size(), file) != memArea.size())
+        {
+            throw CannotSpillState("Could not write page {} of size {} to the spill file", pageIndex, memArea.size());
+        }
+        spilledPages.emplace_back(offset, memArea.size(), page.getNumberOfTuples());
+    }
+    pages.clearPages();
+    isLastPageShared = false;
+    invalidateLastPageForAppend();
+    return true;
+}
+
+void PagedVector::reloadPages(std::FILE* file, AbstractBufferProvider* bufferProvider)
+{
+    PRECONDITION(file != nullptr, "The spill file must not be null");
+    PRECONDITION(bufferProvider != nullptr, "The buffer provider must not be null");
+    PRECONDITION(pages.getNumberOfPages() == 0, "Pages must not be added to a PagedVector, whose pages have been spilled");
+    for (const auto& [offset, bufferSize, numberOfTuples] : spilledPages)
+    {
+        auto page = bufferProvider->getUnpooledBuffer(bufferSize);
+        if (not page.has_value())
+        {
+            throw BufferAllocationFailure("No unpooled TupleBuffer available!");
+        }
+
+        if (std::fseek(file, offset, SEEK_SET) != 0 or std::fread(page->getAvailableMemoryArea().data(), 1, bufferSize, file) != bufferSize)
+        {
+            throw CannotSpillState("Could not read page of size {} at offset {} from the spill file", bufferSize, offset);
+        }
+        page->setNumberOfTuples(numberOfTuples);
+        pages.addPage(page.value());
+    }
+    spilledPages.clear();
+    invalidateLastPageForAppend();
+}
+
+bool PagedVector::writePages(std::FILE* file) const
+{
+    PRECONDITION(file != nullptr, "The checkpoint file must not be null");
+    PRECONDITION(spilledPages.empty(), "The pages of this PagedVector have been spilled");
+    for (size_t pageIndex = 0; pageIndex < pages.getNumberOfPages(); ++pageIndex)
+    {
+        if (pages[pageIndex].buffer.getNumberOfChildBuffers() > 0)
+        {
+            return false;
+        }
+    }
+
+    const uint64_t numberOfPages = pages.getNumberOfPages();
+    if (std::fwrite(&numberOfPages, sizeof(numberOfPages), 1, file) != 1)
+    {
+        throw CannotSpillState("Could not write the number of pages to the checkpoint file");
+    }
+    for (size_t pageIndex = 0; pageIndex < numberOfPages; ++pageIndex)
+    {
+        const auto& page = pages[pageIndex].buffer;
+        const auto memArea = page.getAvailableMemoryArea();
+        const std::array<uint64_t, 2> pageHeader{memArea.size(), page.getNumberOfTuples()};
+        if (std::fwrite(pageHeader.data(), sizeof(uint64_t), pageHeader.size(), file) != pageHeader.size()
+            or std::fwrite(memArea.data(), 1, memArea.size(), file) != memArea.size())
+        {
+            throw CannotSpillState("Could not write page {} of size {} to the checkpoint file", pageIndex, memArea.size());
+        }
+    }
+    return true;
+}
+
+void PagedVector::readPages(std::FILE* file, AbstractBufferProvider* bufferProvider)
+{
+    PRECONDITION(file != nullptr, "The checkpoint file must not be null");
+    PRECONDITION(bufferProvider != nullptr, "The buffer provider must not be null");
+    PRECONDITION(spilledPages.empty(), "Pages must not be added to a PagedVector, whose pages have been spilled");
+    uint64_t numberOfPages = 0;
+    if (std::fread(&numberOfPages, sizeof(numberOfPages), 1, file) != 1)
+    {
+        throw CannotSpillState("Could not read the number of pages from the checkpoint file");
+    }
+    for (uint64_t pageIndex = 0; pageIndex < numberOfPages; ++pageIndex)
+    {
+        std::array<uint64_t, 2> pageHeader{};
+        if (std::fread(pageHeader.data(), sizeof(uint64_t), pageHeader.size(), file) != pageHeader.size())
+        {
+            throw CannotSpillState("Could not read the header of page {} from the checkpoint file", pageIndex);
+        }
+        const auto [bufferSize, numberOfTuples] = pageHeader;
+        auto page = bufferProvider->getUnpooledBuffer(bufferSize);
+        if (not page.has_value())
+        {
+            throw BufferAllocationFailure("No unpooled TupleBuffer available!");
+        }
+        if (std::fread(page->getAvailableMemoryArea().data(), 1, bufferSize, file) != bufferSize)
+        {
+            throw CannotSpillState("Could not read page {} of size {} from the checkpoint file", pageIndex, bufferSize);
+        }
+        page->setNumberOfTuples(numberOfTuples);
+        pages.addPage(page.value());
+    }
+    if (numberOfPages > 0)
+    {
+        isLastPageShared = false;
+    }
+    invalidateLastPageForAppend();
 }
 
 const TupleBuffer* PagedVector::getTupleBufferForEntry(const uint64_t entryPos) const
@@ -118,19 +292,68 @@ const PagedVector::TupleBufferWithCumulativeSum& PagedVector::PagesWrapper::oper
 
 void PagedVector::PagesWrapper::addPage(const TupleBuffer& newPage)
 {
+    if (not pages.empty())
+    {
+        trackEntriesPerPage(getNumberOfTuplesLastPage());
+    }
     updateCumulativeSumLastItem();
     pages.emplace_back(newPage);
 }
 
+void PagedVector::PagesWrapper::trackEntriesPerPageBeforeAdding(const PagesWrapper& other)
+{
+    /// All pages of other but its last one have other.entriesPerPage entries
+    if (not pages.empty())
+    {
+        trackEntriesPerPage(getNumberOfTuplesLastPage());
+    }
+    if (other.pages.size() > 1)
+    {
+        hasSameEntriesPerPage = hasSameEntriesPerPage and other.hasSameEntriesPerPage;
+        trackEntriesPerPage(other.entriesPerPage);
+    }
+}
+
 void PagedVector::PagesWrapper::addPages(const PagesWrapper& other)
 {
+    if (other.pages.empty())
+    {
+        return;
+    }
+
+    trackEntriesPerPageBeforeAdding(other);
+    const auto firstNewPageIndex = pages.size();
     pages.insert(pages.end(), other.pages.begin(), other.pages.end());
-    updateCumulativeSumAllPages();
+    updateCumulativeSumPagesFrom((firstNewPageIndex == 0) ? 0 : firstNewPageIndex - 1);
+}
+
+void PagedVector::PagesWrapper::addPages(PagesWrapper&& other)
+{
+    if (other.pages.empty())
+    {
+        return;
+    }
+
+    trackEntriesPerPageBeforeAdding(other);
+    const auto firstNewPageIndex = pages.size();
+    if (pages.empty())
+    {
+        /// Taking over the vector of other avoids touching the pages at all
+        pages = std::move(other.pages);
+    }
+    else
+    {
+        pages.insert(pages.end(), std::make_move_iterator(other.pages.begin()), std::make_move_iterator(other.pages.end()));
+    }
+    updateCumulativeSumPagesFrom((firstNewPageIndex == 0) ? 0 : firstNewPageIndex - 1);
+    other.clearPages();
 }
 
 void PagedVector::PagesWrapper::clearPages()
 {
     pages.clear();
+    entriesPerPage = 0;
+    hasSameEntriesPerPage = true;
 }
 
 std::optional<size_t> PagedVector::PagesWrapper::findIdx(const uint64_t entryPos) const
@@ -141,6 +364,13 @@ std::optional<size_t> PagedVector::PagesWrapper::findIdx(const uint64_t entryPos
         return {};
     }
 
+    if (hasSameEntriesPerPage)
+    {
+        /// All pages but the last one contain entriesPerPage entries. The last page might contain more, if it stems from addPages().
+        /// If no page is full yet, there is only a single page.
+        return (entriesPerPage == 0) ? 0 : std::min<size_t>(entryPos / entriesPerPage, pages.size() - 1);
+    }
+
     /// Use std::lower_bound to find the first cumulative sum greater than entryPos
     auto projection = [&](const TupleBufferWithCumulativeSum& bufferWithSum) -> size_t
     {
@@ -17,6 +17,7 @@
 #include <utility>
 #include <vector>
 #include <MemoryLayout/MemoryLayout.hpp>
+#include <Nautilus/DataTypes/DataTypesUtil.hpp>
 #include <Nautilus/Interface/BufferRef/TupleBufferRef.hpp>
 #include <Nautilus/Interface/PagedVector/PagedVector.hpp>
 #include <Nautilus/Interface/RecordBuffer.hpp>
@@ -34,10 +35,9 @@ uint64_t getTotalNumberOfEntriesProxy(const PagedVector* pagedVector)
     return pagedVector->getTotalNumberOfEntries();
 }
 
-const TupleBuffer* createNewEntryProxy(PagedVector* pagedVector, AbstractBufferProvider* bufferProvider, const MemoryLayout* memoryLayout)
+void appendPageProxy(PagedVector* pagedVector, AbstractBufferProvider* bufferProvider, const MemoryLayout* memoryLayout)
 {
     pagedVector->appendPageIfFull(bufferProvider, memoryLayout);
-    return std::addressof(pagedVector->getLastPage());
 }
 
 const TupleBuffer* getFirstPageProxy(const PagedVector* pagedVector)
@@ -68,10 +68,20 @@ PagedVectorRef::PagedVectorRef(
 
 void PagedVectorRef::writeRecord(const Record& record, const nautilus::val<AbstractBufferProvider*>& bufferProvider) const
 {
-    auto recordBuffer = RecordBuffer(invoke(createNewEntryProxy, pagedVectorRef, bufferProvider, memoryLayout));
-    auto numTuplesOnPage = recordBuffer.getNumRecords();
+    /// We solely invoke the PagedVector, if the last page is full, and otherwise read the last page and its number of tuples directly
+    const auto numberOfTuplesRef = Util::getMemberRef(pagedVectorRef, &PagedVector::numberOfTuplesLastPage);
+    const auto capacity = Util::readValueFromMemRef<uint64_t>(Util::getMemberRef(pagedVectorRef, &PagedVector::capacityLastPage));
+    if (Util::readValueFromMemRef<uint64_t>(numberOfTuplesRef) >= capacity)
+    {
+        invoke(appendPageProxy, pagedVectorRef, bufferProvider, memoryLayout);
+    }
+
+    auto numTuplesOnPage = Util::readValueFromMemRef<uint64_t>(numberOfTuplesRef);
+    auto recordBuffer
+        = RecordBuffer(Util::readValueFromMemRef<const TupleBuffer*>(Util::getMemberRef(pagedVectorRef, &PagedVector::lastPageForAppend)));
     bufferRef->writeRecord(numTuplesOnPage, recordBuffer, record, bufferProvider);
     recordBuffer.setNumRecords(numTuplesOnPage + 1);
+    *static_cast<nautilus::val<uint64_t*>>(numberOfTuplesRef) = numTuplesOnPage + 1;
 }
 
 Record PagedVectorRef::readRecord(const nautilus::val<uint64_t>& pos, const std::vector<Record::RecordFieldIdentifier>& projections) const
@@ -111,4 +111,14 @@ void RecordBuffer::setCreationTs(const nautilus::val<Timestamp>& creationTs)
     invoke(ProxyFunctions::NES_Memory_TupleBuffer_setCreationTimestampInMS, tupleBufferRef, creationTs);
 }
 
+nautilus::val<Timestamp> RecordBuffer::getLatestCreationTs()
+{
+    return {invoke(ProxyFunctions::NES_Memory_TupleBuffer_getLatestCreationTimestampInMS, tupleBufferRef)};
+}
+
+void RecordBuffer::setLatestCreationTs(const nautilus::val<Timestamp>& latestCreationTs)
+{
+    invoke(ProxyFunctions::NES_Memory_TupleBuffer_setLatestCreationTimestampInMS, tupleBufferRef, latestCreationTs);
+}
+
 }
@@ -24,6 +24,7 @@
 #include <Nautilus/Interface/BufferRef/TupleBufferRef.hpp>
 #include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedEntryMemoryProvider.hpp>
 #include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMap.hpp>
+#include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMapRef.hpp>
 #include <Nautilus/Interface/HashMap/HashMap.hpp>
 #include <Nautilus/Interface/Record.hpp>
 #include <Runtime/AbstractBufferProvider.hpp>
@@ -70,6 +71,8 @@ public:
     std::shared_ptr<Interface::BufferRef::TupleBufferRef> inputBufferRef;
     uint64_t keySize, valueSize, entriesPerPage, entrySize;
     TestParams params;
+    /// Determines the nautilus wrapper that the compiled functions use to operate on the hash map
+    Interface::HashMapType hashMapType{Interface::HashMapType::CHAINED};
 
     enum ExactMapInsert : uint8_t
     {
@@ -88,6 +91,9 @@ public:
         const Interface::BufferRef::TupleBufferRef& memoryProviderInputBuffer,
         const std::map<RecordWithFields, Record>& exactMap);
 
+    /// Creates the nautilus wrapper for the hash map type
+    [[nodiscard]] std::unique_ptr<Interface::ChainedHashMapRef> createHashMapRef(const nautilus::val<Interface::HashMap*>& hashMap) const;
+
     /// Compiles the query that writes the values for all keys in keyBufferRef to outputBufferForKeys.
     /// This enables us to perform a comparison in the c++ code by comparing every value in the record buffer with the exact value.
     /// We are using findOrCreateEntry() of the hash map interface.
@@ -25,6 +25,7 @@
 #include <random>
 #include <sstream>
 #include <tuple>
+#include <utility>
 #include <vector>
 #include <DataTypes/DataType.hpp>
 #include <DataTypes/Schema.hpp>
@@ -33,6 +34,7 @@
 #include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMap.hpp>
 #include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMapRef.hpp>
 #include <Nautilus/Interface/HashMap/HashMap.hpp>
+#include <Nautilus/Interface/HashMap/OpenAddressingHashMap/OpenAddressingHashMapRef.hpp>
 #include <Nautilus/Interface/Record.hpp>
 #include <Nautilus/Interface/RecordBuffer.hpp>
 #include <Runtime/AbstractBufferProvider.hpp>
@@ -175,6 +177,19 @@ std::string ChainedHashMapTestUtils::compareExpectedWithActual(
     return ss.str();
 }
 
+std::unique_ptr<Interface::ChainedHashMapRef>
+ChainedHashMapTestUtils::createHashMapRef(const nautilus::val<Interface::HashMap*>& hashMap) const
+{
+    switch (hashMapType)
+    {
+        case Interface::HashMapType::CHAINED:
+            return std::make_unique<Interface::ChainedHashMapRef>(hashMap, fieldKeys, fieldValues, entriesPerPage, entrySize);
+        case Interface::HashMapType::OPEN_ADDRESSING:
+            return std::make_unique<Interface::OpenAddressingHashMapRef>(hashMap, fieldKeys, fieldValues, entriesPerPage, entrySize);
+    }
+    std::unreachable();
+}
+
 nautilus::engine::CallableFunction<void, TupleBuffer*, TupleBuffer*, AbstractBufferProvider*, Interface::HashMap*>
 ChainedHashMapTestUtils::compileFindAndWriteToOutputBuffer() const
 {
@@ -188,12 +203,12 @@ ChainedHashMapTestUtils::compileFindAndWriteToOutputBuffer() const
             nautilus::val<AbstractBufferProvider*> bufferManagerVal,
             nautilus::val<Interface::HashMap*> hashMapVal)
         {
-            Interface::ChainedHashMapRef hashMapRef(hashMapVal, fieldKeys, fieldValues, entriesPerPage, entrySize);
+            const auto hashMapRef = createHashMapRef(hashMapVal);
             const RecordBuffer recordBufferKey(keyBufferRef);
             for (nautilus::val<uint64_t> i = 0; i < recordBufferKey.getNumRecords(); i = i + 1)
             {
                 auto recordKey = inputBufferRef->readRecord(projectionKeys, recordBufferKey, i);
-                auto foundEntry = hashMapRef.findOrCreateEntry(
+                auto foundEntry = hashMapRef->findOrCreateEntry(
                     recordKey, *NautilusTestUtils::getMurMurHashFunction(), ASSERT_VIOLATION_FOR_ON_INSERT, bufferManagerVal);
 
                 const auto castedEntry = static_cast<nautilus::val<Interface::ChainedHashMapEntry*>>(foundEntry);
@@ -258,13 +273,13 @@ ChainedHashMapTestUtils::compileFindAndInsert() const
             nautilus::val<AbstractBufferProvider*> bufferManagerVal,
             nautilus::val<Interface::HashMap*> hashMapVal)
         {
-            Interface::ChainedHashMapRef hashMapRef(hashMapVal, fieldKeys, fieldValues, entriesPerPage, entrySize);
+            const auto hashMapRef = createHashMapRef(hashMapVal);
             const RecordBuffer recordBuffer(inputBufferPtr);
             for (nautilus::val<uint64_t> i = 0; i < recordBuffer.getNumRecords(); i = i + 1)
             {
                 auto recordKey = inputBufferRef->readRecord(projectionKeys, recordBuffer, i);
                 auto recordValue = inputBufferRef->readRecord(projectionValues, recordBuffer, i);
-                auto foundEntry = hashMapRef.findOrCreateEntry(
+                auto foundEntry = hashMapRef->findOrCreateEntry(
                     recordKey,
                     *NautilusTestUtils::getMurMurHashFunction(),
                     [&](const nautilus::val<Interface::AbstractHashMapEntry*>& entry)
@@ -293,7 +308,7 @@ ChainedHashMapTestUtils::compileFindAndUpdate() const
             nautilus::val<AbstractBufferProvider*> bufferManagerVal,
             nautilus::val<Interface::HashMap*> hashMapVal)
         {
-            Interface::ChainedHashMapRef hashMapRef(hashMapVal, fieldKeys, fieldValues, entriesPerPage, entrySize);
+            const auto hashMapRef = createHashMapRef(hashMapVal);
             const RecordBuffer recordBufferKey(keyBufferRef);
             const RecordBuffer recordBufferValue(valueBufferUpdatedRef);
 
@@ -301,7 +316,7 @@ ChainedHashMapTestUtils::compileFindAndUpdate() const
             {
                 auto recordKey = inputBufferRef->readRecord(projectionKeys, recordBufferKey, i);
                 auto recordValue = inputBufferRef->readRecord(projectionValues, recordBufferValue, i);
-                auto foundEntry = hashMapRef.findOrCreateEntry(
+                auto foundEntry = hashMapRef->findOrCreateEntry(
                     recordKey,
                     *NautilusTestUtils::getMurMurHashFunction(),
                     [&](const nautilus::val<Interface::AbstractHashMapEntry*>& entry)
@@ -310,7 +325,7 @@ ChainedHashMapTestUtils::compileFindAndUpdate() const
                         ref.copyValuesToEntry(recordValue, bufferManagerVal);
                     },
                     bufferManagerVal);
-                hashMapRef.insertOrUpdateEntry(
+                hashMapRef->insertOrUpdateEntry(
                     foundEntry,
                     [&](const nautilus::val<Interface::AbstractHashMapEntry*>& entry)
                     {
@@ -0,0 +1,89 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <bit>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+#include <Nautilus/Interface/BloomFilter/BlockedBloomFilter.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+
+namespace NES::Nautilus::Interface
+{
+class BlockedBloomFilterTest : public Testing::BaseUnitTest
+{
+public:
+    static constexpr uint64_t NUMBER_OF_KEYS = 100'000;
+
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("BlockedBloomFilterTest.log", LogLevel::LOG_DEBUG);
+        NES_INFO("Setup BlockedBloomFilterTest class.");
+    }
+
+    void SetUp() override
+    {
+        BaseUnitTest::SetUp();
+        bufferManager = BufferManager::create();
+    }
+
+    static void TearDownTestSuite() { NES_INFO("Tear down BlockedBloomFilterTest class."); }
+
+    std::shared_ptr<BufferManager> bufferManager;
+};
+
+TEST_F(BlockedBloomFilterTest, sizesTheFilterForTheExpectedNumberOfKeys)
+{
+    const BlockedBloomFilter emptyFilter(0, bufferManager.get());
+    EXPECT_EQ(emptyFilter.getNumberOfBlocks(), 1);
+    EXPECT_EQ(emptyFilter.getSizeInBytes(), BlockedBloomFilter::BITS_PER_BLOCK / 8);
+
+    const BlockedBloomFilter filter(NUMBER_OF_KEYS, bufferManager.get());
+    EXPECT_TRUE(std::has_single_bit(filter.getNumberOfBlocks()));
+    EXPECT_GE(filter.getSizeInBytes() * 8, NUMBER_OF_KEYS * BlockedBloomFilter::BITS_PER_KEY);
+    EXPECT_LT(filter.getSizeInBytes() * 8, 2 * NUMBER_OF_KEYS * BlockedBloomFilter::BITS_PER_KEY);
+}
+
+TEST_F(BlockedBloomFilterTest, hasNoFalseNegativesAndFewFalsePositives)
+{
+    BlockedBloomFilter filter(NUMBER_OF_KEYS, bufferManager.get());
+    std::mt19937_64 generator(42);
+    std::vector<uint64_t> addedHashes(NUMBER_OF_KEYS);
+    for (auto& hash : addedHashes)
+    {
+        hash = generator();
+        filter.add(hash);
+    }
+
+    for (const auto hash : addedHashes)
+    {
+        EXPECT_TRUE(filter.mayContain(hash));
+    }
+
+    /// With BITS_PER_KEY bits per key, less than one in hundred hashes, which we have not added, should pass the filter
+    uint64_t falsePositives = 0;
+    for (uint64_t i = 0; i < NUMBER_OF_KEYS; ++i)
+    {
+        falsePositives += static_cast<uint64_t>(filter.mayContain(generator()));
+    }
+    EXPECT_LT(falsePositives, NUMBER_OF_KEYS / 100);
+}
+
+}
@@ -12,13 +12,25 @@
     limitations under the License.
 */
 
+#include <algorithm>
+#include <cstdint>
 #include <cstring>
+#include <functional>
 #include <memory>
 #include <sstream>
+#include <string>
 #include <tuple>
 #include <vector>
 #include <DataTypes/DataType.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Nautilus/DataTypes/VarVal.hpp>
+#include <Nautilus/DataTypes/VariableSizedData.hpp>
+#include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedEntryMemoryProvider.hpp>
 #include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMap.hpp>
+#include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMapRef.hpp>
+#include <Nautilus/Interface/HashMap/HashMap.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <Runtime/AbstractBufferProvider.hpp>
 
 #include <Util/ExecutionMode.hpp>
 #include <Util/Logger/LogLevel.hpp>
@@ -91,6 +103,30 @@ TEST_P(ChainedHashMapTest, fixedDataTypesSingleInsert)
     checkEntryIterator(hashMap, exactMap);
 }
 
+TEST_P(ChainedHashMapTest, growsIncrementally)
+{
+    /// Starting with the minimal number of buckets forces the hash map to grow multiple times while we are inserting
+    auto hashMap = ChainedHashMap(keySize, valueSize, 1, params.pageSize);
+    const auto exactMap = createExactMap(ExactMapInsert::INSERT);
+    auto findAndInsert = compileFindAndInsert();
+    for (auto& buffer : inputBuffers)
+    {
+        findAndInsert(std::addressof(buffer), bufferManager.get(), std::addressof(hashMap));
+    }
+
+    /// The hash map must have grown with the number of keys, so that the average chain length stays below the load factor
+    const auto statistics = hashMap.getBucketStatistics();
+    EXPECT_EQ(statistics.numberOfEntries, hashMap.getNumberOfTuples());
+    EXPECT_EQ(statistics.numberOfBuckets, hashMap.getNumberOfChains());
+    EXPECT_GT(statistics.numberOfResizes, 0);
+    EXPECT_LE(statistics.getLoadFactor(), ChainedHashMap::MAX_LOAD_FACTOR);
+    EXPECT_LE(statistics.numberOfUsedBuckets, std::min(statistics.numberOfEntries, statistics.numberOfBuckets));
+
+    /// Lookups have to find all entries, regardless if their chain has been migrated
+    checkIfValuesAreCorrectViaFindEntry(hashMap, exactMap);
+    checkEntryIterator(hashMap, exactMap);
+}
+
 TEST_P(ChainedHashMapTest, fixedDataTypesUpdate)
 {
     /// Creating the hash map
@@ -120,6 +156,60 @@ TEST_P(ChainedHashMapTest, fixedDataTypesUpdate)
     checkEntryIterator(hashMap, exactMap);
 }
 
+TEST_P(ChainedHashMapTest, variableSizedKeys)
+{
+    /// Keys up to 12 bytes are inlined into the entry. The longer keys share the prefix with another key and differ afterward.
+    const std::vector<std::string> keys{
+        "RE1", "ICE 123", "S-Bahn S1 ab", "S-Bahn S1 abc", "Frankfurt(Main)Hbf", "Frankfurt(Main)Sued", "Frankfurt Flughafen"};
+    std::vector<std::vector<int8_t>> varSizedKeys;
+    for (const auto& key : keys)
+    {
+        const auto size = static_cast<uint32_t>(key.size());
+        std::vector<int8_t> varSizedKey(sizeof(uint32_t) + key.size());
+        std::memcpy(varSizedKey.data(), &size, sizeof(uint32_t));
+        std::memcpy(varSizedKey.data() + sizeof(uint32_t), key.data(), key.size());
+        varSizedKeys.emplace_back(std::move(varSizedKey));
+    }
+
+    const auto keySchema = Schema{Schema::MemoryLayoutType::ROW_LAYOUT}.addField("key", DataType::Type::VARSIZED_POINTER_REP);
+    const auto fieldOffsets = BufferRef::ChainedEntryMemoryProvider::createFieldOffsets(keySchema, {"key"}, {});
+    constexpr auto varSizedKeySize = BufferRef::ChainedEntryMemoryProvider::VAR_SIZED_SLOT_SIZE;
+    const auto varSizedEntrySize = sizeof(ChainedHashMapEntry) + varSizedKeySize;
+    const auto varSizedEntriesPerPage = params.pageSize / varSizedEntrySize;
+    auto hashMap = ChainedHashMap(varSizedKeySize, 0, params.numberOfBuckets, params.pageSize);
+
+    /// Inserts the key, if it does not exist yet, and returns if the entry stores the same key
+    /// NOLINTBEGIN(performance-unnecessary-value-param)
+    auto findOrCreateAndCompare = nautilusEngine->registerFunction(std::function(
+        [&](nautilus::val<int8_t*> varSizedKey,
+            nautilus::val<AbstractBufferProvider*> bufferManagerVal,
+            nautilus::val<HashMap*> hashMapVal) -> nautilus::val<bool>
+        {
+            ChainedHashMapRef hashMapRef(hashMapVal, fieldOffsets.first, fieldOffsets.second, varSizedEntriesPerPage, varSizedEntrySize);
+            const VariableSizedData key(varSizedKey);
+            const Record recordKey({{"key", VarVal(key)}});
+            const auto entry = hashMapRef.findOrCreateEntry(
+                recordKey,
+                *TestUtils::NautilusTestUtils::getMurMurHashFunction(),
+                [](const nautilus::val<AbstractHashMapEntry*>&) { },
+                bufferManagerVal);
+            const ChainedHashMapRef::ChainedEntryRef entryRef(
+                static_cast<nautilus::val<ChainedHashMapEntry*>>(entry), hashMapVal, fieldOffsets.first, fieldOffsets.second);
+            return entryRef.getKey("key").cast<VariableSizedData>() == key;
+        }));
+    /// NOLINTEND(performance-unnecessary-value-param)
+
+    /// The second round must find the entries of the first round
+    for (uint64_t round = 0; round < 2; ++round)
+    {
+        for (auto& varSizedKey : varSizedKeys)
+        {
+            EXPECT_TRUE(findOrCreateAndCompare(varSizedKey.data(), bufferManager.get(), std::addressof(hashMap)));
+        }
+    }
+    EXPECT_EQ(hashMap.getNumberOfTuples(), keys.size());
+}
+
 INSTANTIATE_TEST_CASE_P(
     ChainedHashMapTest,
     ChainedHashMapTest,
@@ -0,0 +1,97 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <unordered_set>
+#include <Nautilus/DataTypes/VarVal.hpp>
+#include <Nautilus/Interface/Hash/HashFunction.hpp>
+#include <Util/ExecutionMode.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <magic_enum/magic_enum.hpp>
+#include <nautilus/Engine.hpp>
+#include <BaseUnitTest.hpp>
+
+namespace NES::Nautilus::Interface
+{
+class HashFunctionTest : public Testing::BaseUnitTest, public testing::WithParamInterface<std::tuple<HashFunctionType, ExecutionMode>>
+{
+public:
+    static constexpr uint64_t NUMBER_OF_KEYS = 100'000;
+    /// The open addressing hash map stores the upper 7 bits of the hash as the tag
+    static constexpr uint64_t NUMBER_OF_TAGS = 128;
+
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("HashFunctionTest.log", LogLevel::LOG_DEBUG);
+        NES_INFO("Setup HashFunctionTest class.");
+    }
+
+    void SetUp() override
+    {
+        BaseUnitTest::SetUp();
+        const auto& [hashFunctionType, backend] = GetParam();
+        hashFunction = HashFunction::create(hashFunctionType);
+
+        nautilus::engine::Options options;
+        options.setOption("engine.Compilation", backend == ExecutionMode::COMPILER);
+        options.setOption("mlir.enableMultithreading", false);
+        nautilusEngine = std::make_unique<nautilus::engine::NautilusEngine>(options);
+    }
+
+    static void TearDownTestSuite() { NES_INFO("Tear down HashFunctionTest class."); }
+
+    std::unique_ptr<HashFunction> hashFunction;
+    std::unique_ptr<nautilus::engine::NautilusEngine> nautilusEngine;
+};
+
+TEST_P(HashFunctionTest, hashesAreDeterministicAndSpreadOverAllBits)
+{
+    /// We are not allowed to use const or const references for the lambda function params, as nautilus does not support this in the registerFunction method.
+    auto calculateHash = nautilusEngine->registerFunction(std::function(
+        [this](nautilus::val<uint64_t> key) -> nautilus::val<uint64_t> { return hashFunction->calculate(VarVal(key)); }));
+
+    std::unordered_set<uint64_t> hashes;
+    std::unordered_set<uint64_t> tags;
+    for (uint64_t key = 0; key < NUMBER_OF_KEYS; ++key)
+    {
+        const auto hash = calculateHash(key);
+        EXPECT_EQ(hash, calculateHash(key));
+        hashes.insert(hash);
+        tags.insert(hash >> 57U);
+    }
+
+    /// Consecutive keys must neither collide nor leave the upper bits, e.g., the tags or the radix partitions, unused
+    EXPECT_EQ(hashes.size(), NUMBER_OF_KEYS);
+    EXPECT_EQ(tags.size(), NUMBER_OF_TAGS);
+}
+
+INSTANTIATE_TEST_CASE_P(
+    HashFunctionTest,
+    HashFunctionTest,
+    ::testing::Combine(
+        ::testing::Values(HashFunctionType::MURMUR3, HashFunctionType::CRC32, HashFunctionType::XXH3),
+        ::testing::Values(ExecutionMode::COMPILER, ExecutionMode::INTERPRETER)),
+    [](const testing::TestParamInfo<HashFunctionTest::ParamType>& info)
+    {
+        return std::string(magic_enum::enum_name(std::get<0>(info.param))) + "_"
+            + std::string(magic_enum::enum_name(std::get<1>(info.param)));
+    });
+}
@@ -13,6 +13,7 @@
 */
 
 #include <cstdint>
+#include <cstdio>
 #include <cstdlib>
 #include <cstring>
 #include <memory>
@@ -286,6 +287,195 @@ TEST_P(PagedVectorTest, appendAllPagesMultipleVectorsWithDifferentPageSizes)
         projections, testSchema, entrySize, pageSize, allRecords, allRecordsAfterAppendAll, 1, *nautilusEngine, *bufferManager);
 }
 
+TEST_P(PagedVectorTest, storeIntoVectorWhosePagesHaveBeenMoved)
+{
+    bufferManager = BufferManager::create();
+    const auto testSchema = Schema{Schema::MemoryLayoutType::ROW_LAYOUT}
+                                .addField("value1", DataType::Type::UINT64)
+                                .addField("value2", DataType::Type::UINT64);
+    constexpr auto pageSize = PAGE_SIZE;
+    const auto projections = testSchema.getFieldNames();
+    const auto firstRecords = createMonotonicallyIncreasingValues(testSchema, numberOfItems, *bufferManager);
+    const auto secondRecords = createMonotonicallyIncreasingValues(testSchema, numberOfItems, *bufferManager);
+
+    /// Writing to the other vector after moving its pages must neither append to the moved pages nor to the combined vector
+    PagedVector pagedVector;
+    PagedVector otherPagedVector;
+    TestUtils::runStoreTest(pagedVector, testSchema, pageSize, projections, firstRecords, *nautilusEngine, *bufferManager);
+    TestUtils::runStoreTest(otherPagedVector, testSchema, pageSize, projections, firstRecords, *nautilusEngine, *bufferManager);
+    pagedVector.moveAllPages(otherPagedVector);
+    TestUtils::runStoreTest(otherPagedVector, testSchema, pageSize, projections, secondRecords, *nautilusEngine, *bufferManager);
+
+    std::vector<TupleBuffer> combinedRecords = firstRecords;
+    combinedRecords.insert(combinedRecords.end(), firstRecords.begin(), firstRecords.end());
+    TestUtils::runRetrieveTest(pagedVector, testSchema, pageSize, projections, combinedRecords, *nautilusEngine, *bufferManager);
+    TestUtils::runRetrieveTest(otherPagedVector, testSchema, pageSize, projections, secondRecords, *nautilusEngine, *bufferManager);
+}
+
+TEST_P(PagedVectorTest, positionalAccessAfterCombiningPartiallyFilledVectors)
+{
+    bufferManager = BufferManager::create();
+    const auto testSchema = Schema{Schema::MemoryLayoutType::ROW_LAYOUT}.addField("value1", DataType::Type::UINT64);
+    const auto bufferRef = BufferRef::TupleBufferRef::create(PAGE_SIZE, testSchema);
+    const auto* const memoryLayout = bufferRef->getMemoryLayout().get();
+    const auto capacity = memoryLayout->getCapacity();
+
+    /// Fills the paged vector with the number of entries without writing any values, as we solely check the positions of the entries
+    const auto fill = [&](PagedVector& pagedVector, const uint64_t numberOfEntries)
+    {
+        for (uint64_t entry = 0; entry < numberOfEntries; ++entry)
+        {
+            pagedVector.appendPageIfFull(bufferManager.get(), memoryLayout);
+            auto lastPage = pagedVector.getLastPage();
+            lastPage.setNumberOfTuples(lastPage.getNumberOfTuples() + 1);
+        }
+    };
+
+    /// The first vector ends with a partially filled page. Thus, the combined vector has pages with a different number of entries.
+    PagedVector pagedVector;
+    PagedVector otherPagedVector;
+    fill(pagedVector, (2 * capacity) + 3);
+    fill(otherPagedVector, capacity + 5);
+    EXPECT_EQ(*pagedVector.getBufferPosForEntry(capacity + 1), 1);
+    pagedVector.copyFrom(otherPagedVector);
+    ASSERT_EQ(pagedVector.getNumberOfPages(), 5);
+    ASSERT_EQ(pagedVector.getTotalNumberOfEntries(), (3 * capacity) + 8);
+
+    /// Number of entries of each page of the combined vector. All entries of a page must be located in the same tuple buffer.
+    uint64_t entryPos = 0;
+    for (const auto numberOfEntries : {capacity, capacity, uint64_t{3}, capacity, uint64_t{5}})
+    {
+        const auto* const page = pagedVector.getTupleBufferForEntry(entryPos);
+        for (uint64_t posOnPage = 0; posOnPage < numberOfEntries; ++posOnPage, ++entryPos)
+        {
+            EXPECT_EQ(pagedVector.getTupleBufferForEntry(entryPos), page);
+            EXPECT_EQ(*pagedVector.getBufferPosForEntry(entryPos), posOnPage);
+        }
+    }
+    EXPECT_EQ(pagedVector.getTupleBufferForEntry(entryPos - 1), &pagedVector.getLastPage());
+    EXPECT_FALSE(pagedVector.getBufferPosForEntry(entryPos).has_value());
+}
+
+TEST_P(PagedVectorTest, appendToVectorThatSharesThePagesOfAnotherVector)
+{
+    bufferManager = BufferManager::create();
+    const auto testSchema = Schema{Schema::MemoryLayoutType::ROW_LAYOUT}.addField("value1", DataType::Type::UINT64);
+    const auto bufferRef = BufferRef::TupleBufferRef::create(PAGE_SIZE, testSchema);
+    const auto* const memoryLayout = bufferRef->getMemoryLayout().get();
+    const auto capacity = memoryLayout->getCapacity();
+
+    const auto fill = [&](PagedVector& pagedVector, const uint64_t numberOfEntries)
+    {
+        for (uint64_t entry = 0; entry < numberOfEntries; ++entry)
+        {
+            pagedVector.appendPageIfFull(bufferManager.get(), memoryLayout);
+            auto lastPage = pagedVector.getLastPage();
+            lastPage.setNumberOfTuples(lastPage.getNumberOfTuples() + 1);
+        }
+    };
+
+    /// The shared last page is partially filled. Appending to the combined vector must not write to it, as it belongs to the other vector.
+    PagedVector pagedVector;
+    PagedVector otherPagedVector;
+    fill(otherPagedVector, capacity + 5);
+    pagedVector.copyFrom(otherPagedVector);
+    fill(pagedVector, 3);
+    EXPECT_EQ(otherPagedVector.getTotalNumberOfEntries(), capacity + 5);
+    EXPECT_EQ(otherPagedVector.getLastPage().getNumberOfTuples(), 5);
+    EXPECT_EQ(pagedVector.getNumberOfPages(), 3);
+    EXPECT_EQ(pagedVector.getTotalNumberOfEntries(), capacity + 8);
+
+    /// Moving the pages keeps the pages shared with the other vector, while the last page of the moved vector is its own
+    PagedVector movedPagedVector;
+    movedPagedVector.moveAllPages(pagedVector);
+    EXPECT_EQ(pagedVector.getNumberOfPages(), 0);
+    fill(movedPagedVector, 2);
+    EXPECT_EQ(movedPagedVector.getNumberOfPages(), 3);
+    EXPECT_EQ(movedPagedVector.getLastPage().getNumberOfTuples(), 5);
+    EXPECT_EQ(otherPagedVector.getTotalNumberOfEntries(), capacity + 5);
+}
+
+TEST_P(PagedVectorTest, spillAndReloadPages)
+{
+    bufferManager = BufferManager::create();
+    const auto testSchema = Schema{Schema::MemoryLayoutType::ROW_LAYOUT}.addField("value1", DataType::Type::UINT64);
+    const auto bufferRef = BufferRef::TupleBufferRef::create(PAGE_SIZE, testSchema);
+    const auto* const memoryLayout = bufferRef->getMemoryLayout().get();
+    const auto numberOfEntries = (3 * memoryLayout->getCapacity()) + 7;
+
+    /// Writes the position of each entry as its value, as the row layout of a single field stores the entries consecutively
+    PagedVector pagedVector;
+    for (uint64_t entry = 0; entry < numberOfEntries; ++entry)
+    {
+        pagedVector.appendPageIfFull(bufferManager.get(), memoryLayout);
+        auto lastPage = pagedVector.getLastPage();
+        reinterpret_cast<uint64_t*>(lastPage.getAvailableMemoryArea().data())[lastPage.getNumberOfTuples()] = entry; /// NOLINT
+        lastPage.setNumberOfTuples(lastPage.getNumberOfTuples() + 1);
+    }
+    const auto numberOfPages = pagedVector.getNumberOfPages();
+    EXPECT_GT(pagedVector.getSizeOfPagesInBytes(), numberOfEntries * sizeof(uint64_t));
+
+    const std::unique_ptr<std::FILE, int (*)(std::FILE*)> spillFile{std::tmpfile(), &std::fclose};
+    ASSERT_NE(spillFile, nullptr);
+    ASSERT_TRUE(pagedVector.spillPages(spillFile.get()));
+    EXPECT_TRUE(pagedVector.hasSpilledPages());
+    EXPECT_EQ(pagedVector.getNumberOfPages(), 0);
+    EXPECT_EQ(pagedVector.getSizeOfPagesInBytes(), 0);
+
+    pagedVector.reloadPages(spillFile.get(), bufferManager.get());
+    EXPECT_FALSE(pagedVector.hasSpilledPages());
+    ASSERT_EQ(pagedVector.getNumberOfPages(), numberOfPages);
+    ASSERT_EQ(pagedVector.getTotalNumberOfEntries(), numberOfEntries);
+    for (uint64_t entry = 0; entry < numberOfEntries; ++entry)
+    {
+        const auto* const page = pagedVector.getTupleBufferForEntry(entry);
+        const auto posOnPage = pagedVector.getBufferPosForEntry(entry);
+        ASSERT_NE(page, nullptr);
+        ASSERT_TRUE(posOnPage.has_value());
+        EXPECT_EQ(reinterpret_cast<const uint64_t*>(page->getAvailableMemoryArea().data())[*posOnPage], entry); /// NOLINT
+    }
+}
+
+TEST_P(PagedVectorTest, writeAndReadPages)
+{
+    bufferManager = BufferManager::create();
+    const auto testSchema = Schema{Schema::MemoryLayoutType::ROW_LAYOUT}.addField("value1", DataType::Type::UINT64);
+    const auto bufferRef = BufferRef::TupleBufferRef::create(PAGE_SIZE, testSchema);
+    const auto* const memoryLayout = bufferRef->getMemoryLayout().get();
+    const auto numberOfEntries = (2 * memoryLayout->getCapacity()) + 5;
+
+    PagedVector pagedVector;
+    for (uint64_t entry = 0; entry < numberOfEntries; ++entry)
+    {
+        pagedVector.appendPageIfFull(bufferManager.get(), memoryLayout);
+        auto lastPage = pagedVector.getLastPage();
+        reinterpret_cast<uint64_t*>(lastPage.getAvailableMemoryArea().data())[lastPage.getNumberOfTuples()] = entry; /// NOLINT
+        lastPage.setNumberOfTuples(lastPage.getNumberOfTuples() + 1);
+    }
+
+    /// Writing the pages keeps them in memory, thus we can write them twice and read both copies into one PagedVector
+    const std::unique_ptr<std::FILE, int (*)(std::FILE*)> checkpointFile{std::tmpfile(), &std::fclose};
+    ASSERT_NE(checkpointFile, nullptr);
+    ASSERT_TRUE(pagedVector.writePages(checkpointFile.get()));
+    ASSERT_TRUE(pagedVector.writePages(checkpointFile.get()));
+    EXPECT_EQ(pagedVector.getTotalNumberOfEntries(), numberOfEntries);
+
+    std::rewind(checkpointFile.get());
+    PagedVector restoredPagedVector;
+    restoredPagedVector.readPages(checkpointFile.get(), bufferManager.get());
+    restoredPagedVector.readPages(checkpointFile.get(), bufferManager.get());
+    ASSERT_EQ(restoredPagedVector.getNumberOfPages(), 2 * pagedVector.getNumberOfPages());
+    ASSERT_EQ(restoredPagedVector.getTotalNumberOfEntries(), 2 * numberOfEntries);
+    for (uint64_t entry = 0; entry < 2 * numberOfEntries; ++entry)
+    {
+        const auto* const page = restoredPagedVector.getTupleBufferForEntry(entry);
+        const auto posOnPage = restoredPagedVector.getBufferPosForEntry(entry);
+        ASSERT_NE(page, nullptr);
+        ASSERT_TRUE(posOnPage.has_value());
+        EXPECT_EQ(reinterpret_cast<const uint64_t*>(page->getAvailableMemoryArea().data())[*posOnPage], entry % numberOfEntries); /// NOLINT
+    }
+}
+
 INSTANTIATE_TEST_CASE_P(
     PagedVectorTest,
     PagedVectorTest,
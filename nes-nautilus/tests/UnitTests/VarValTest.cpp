@@ -223,6 +223,19 @@ TEST_F(VarValTest, binaryOperatorOverloads)
     TEST_BINARY_OPERATION_BOOLEAN(||);
 }
 
+/// The lowering converts the operands of comparisons of different types to their common type, which must not change their result
+TEST_F(VarValTest, comparisonOfMixedTypesEqualsComparisonInCommonType)
+{
+    using namespace NES::Nautilus;
+    const VarVal negative = nautilus::val<int32_t>(-5);
+    const VarVal positive = nautilus::val<uint64_t>(3);
+    const VarVal floating = nautilus::val<float>(2.5F);
+    const auto isTrue = [](const VarVal& value) { return value.cast<nautilus::val<bool>>(); };
+    EXPECT_EQ(isTrue(negative < positive), isTrue(negative.castToType(DataType::Type::UINT64) < positive));
+    EXPECT_EQ(isTrue(negative == positive), isTrue(negative.castToType(DataType::Type::UINT64) == positive));
+    EXPECT_EQ(isTrue(positive > floating), isTrue(positive.castToType(DataType::Type::FLOAT32) > floating));
+}
+
 TEST_F(VarValTest, unaryOperatorOverloads)
 {
     auto testVarValOperation = []<typename T>(const T value)
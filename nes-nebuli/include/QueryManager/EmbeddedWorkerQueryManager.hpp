@@ -13,6 +13,10 @@
 */
 
 #pragma once
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
 #include <Identifiers/Identifiers.hpp>
 #include <Listeners/QueryLog.hpp>
 #include <ErrorHandling.hpp>
@@ -31,7 +35,15 @@ public:
     std::expected<void, Exception> start(QueryId queryId) noexcept override;
     std::expected<void, Exception> stop(QueryId queryId) noexcept override;
     std::expected<void, Exception> unregister(QueryId queryId) noexcept override;
+    std::expected<void, Exception>
+    updateParameters(QueryId queryId, const std::unordered_map<std::string, std::string>& parameters) noexcept override;
     [[nodiscard]] std::expected<LocalQueryStatus, Exception> status(QueryId queryId) const noexcept override;
+    /// Counters of the running pipelines of the query, c.f., SingleNodeWorker::getPipelineMetrics
+    [[nodiscard]] std::optional<std::vector<PipelineMetrics>> pipelineMetrics(QueryId queryId) const;
+    /// Memory of the buffers that the pipelines of the query hold, c.f., SingleNodeWorker::getQueryMemory
+    [[nodiscard]] std::optional<QueryMemoryMetrics> queryMemory(QueryId queryId) const;
+    /// c.f., SingleNodeWorker::getEngineMetrics
+    [[nodiscard]] EngineMetrics engineMetrics() const;
 
 private:
     SingleNodeWorker worker;
@@ -18,9 +18,12 @@
 
 #include <cstddef>
 #include <memory>
+#include <string>
+#include <unordered_map>
 #include <Identifiers/Identifiers.hpp>
 #include <Listeners/QueryLog.hpp>
 #include <Plans/LogicalPlan.hpp>
+#include <Serialization/PlanFragmentCache.hpp>
 #include <grpcpp/client_context.h>
 #include <ErrorHandling.hpp>
 #include <SingleNodeWorkerRPCService.grpc.pb.h>
@@ -30,6 +33,8 @@ namespace NES
 class GRPCQueryManager final : public QueryManager
 {
     std::unique_ptr<WorkerRPCService::Stub> stub;
+    /// Fragments of the registered plans, which subsequent plans solely reference by their hash
+    SentPlanFragments sentFragments;
 
 public:
     explicit GRPCQueryManager(const std::shared_ptr<grpc::Channel>& channel);
@@ -37,6 +42,8 @@ public:
     std::expected<void, Exception> stop(QueryId queryId) noexcept override;
     std::expected<void, Exception> start(QueryId queryId) noexcept override;
     std::expected<void, Exception> unregister(QueryId queryId) noexcept override;
+    std::expected<void, Exception>
+    updateParameters(QueryId queryId, const std::unordered_map<std::string, std::string>& parameters) noexcept override;
     [[nodiscard]] std::expected<LocalQueryStatus, Exception> status(QueryId queryId) const noexcept override;
 };
 }
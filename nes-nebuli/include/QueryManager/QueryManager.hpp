@@ -40,6 +40,9 @@ public:
     virtual std::expected<void, Exception> start(QueryId queryId) noexcept = 0;
     virtual std::expected<void, Exception> stop(QueryId queryId) noexcept = 0;
     virtual std::expected<void, Exception> unregister(QueryId queryId) noexcept = 0;
+    /// Sets the values of the PARAMETER functions of the query by their name, either all or none of them
+    virtual std::expected<void, Exception>
+    updateParameters(QueryId queryId, const std::unordered_map<std::string, std::string>& parameters) noexcept = 0;
     [[nodiscard]] virtual std::expected<LocalQueryStatus, Exception> status(QueryId queryId) const noexcept = 0;
 };
 }
@@ -18,6 +18,7 @@
 #include <expected>
 #include <memory>
 #include <mutex>
+#include <string>
 #include <unordered_map>
 #include <variant>
 #include <vector>
@@ -96,6 +97,11 @@ struct DropQueryStatementResult
     QueryId id;
 };
 
+struct PrepareQueryStatementResult
+{
+    std::string name;
+};
+
 using StatementResult = std::variant<
     CreateLogicalSourceStatementResult,
     CreatePhysicalSourceStatementResult,
@@ -108,7 +114,8 @@ using StatementResult = std::variant<
     DropSinkStatementResult,
     QueryStatementResult,
     ShowQueriesStatementResult,
-    DropQueryStatementResult>;
+    DropQueryStatementResult,
+    PrepareQueryStatementResult>;
 
 /// A bit of CRTP magic for nicer syntax when the object is in a shared ptr
 template <typename HandlerImpl>
@@ -165,12 +172,19 @@ class QueryStatementHandler final : public StatementHandler<QueryStatementHandle
     SharedPtr<QueryManager> queryManager;
     std::vector<QueryId> runningQueries;
     std::shared_ptr<const LegacyOptimizer> optimizer;
+    /// The optimized plans of the prepared queries by their name. Executing a prepared query neither parses nor optimizes it again.
+    std::unordered_map<std::string, LogicalPlan> preparedQueries;
+
+    std::expected<QueryStatementResult, Exception> registerAndStart(const LogicalPlan& optimizedPlan);
 
 public:
     explicit QueryStatementHandler(const std::shared_ptr<QueryManager>& queryManager, const std::shared_ptr<LegacyOptimizer>& optimizer);
     std::expected<QueryStatementResult, Exception> operator()(const QueryStatement& statement);
     std::expected<ShowQueriesStatementResult, Exception> operator()(const ShowQueriesStatement& statement);
     std::expected<DropQueryStatementResult, Exception> operator()(const DropQueryStatement& statement);
+    std::expected<PrepareQueryStatementResult, Exception> operator()(const PrepareQueryStatement& statement);
+    /// Registers the instance with the prepared plan and sets its parameters before the instance starts
+    std::expected<QueryStatementResult, Exception> operator()(const ExecuteQueryStatement& statement);
 
     [[nodiscard]] std::vector<QueryId> getRunningQueries() const;
 };
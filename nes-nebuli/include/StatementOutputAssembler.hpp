@@ -74,6 +74,9 @@ constexpr std::array<std::string_view, 1> queryIdOutputColumns{"query_id"};
 using QueryStatusOutputRowType = std::tuple<QueryId, std::string>;
 constexpr std::array<std::string_view, 2> queryStatusOutputColumns{"query_id", "query_status"};
 
+using PreparedQueryOutputRowType = std::tuple<std::string>;
+constexpr std::array<std::string_view, 1> preparedQueryOutputColumns{"prepared_query"};
+
 /// NOLINTBEGIN(readability-convert-member-functions-to-static)
 template <>
 struct StatementOutputAssembler<CreateLogicalSourceStatementResult>
@@ -262,6 +265,17 @@ struct StatementOutputAssembler<DropQueryStatementResult>
     }
 };
 
+template <>
+struct StatementOutputAssembler<PrepareQueryStatementResult>
+{
+    using OutputRowType = PreparedQueryOutputRowType;
+
+    auto convert(const PrepareQueryStatementResult& result)
+    {
+        return std::make_pair(preparedQueryOutputColumns, std::vector{std::make_tuple(result.name)});
+    }
+};
+
 /// NOLINTEND(readability-convert-member-functions-to-static)
 
 
@@ -277,5 +291,6 @@ static_assert(AssemblembleStatementResult<DropSinkStatementResult>);
 static_assert(AssemblembleStatementResult<QueryStatementResult>);
 static_assert(AssemblembleStatementResult<ShowQueriesStatementResult>);
 static_assert(AssemblembleStatementResult<DropQueryStatementResult>);
+static_assert(AssemblembleStatementResult<PrepareQueryStatementResult>);
 
 }
@@ -35,6 +35,8 @@ namespace NES
  * Note: if expandSourceOnly is set to true then only source operators will be expanded and @see LogicalSourceExpansionRule:isBlockingOperator
  * will be ignored.
  *
+ * Note: a partitioned physical source, c.f., SourceDescriptor::NUMBER_OF_PARTITIONS, expands into a source per partition.
+ *
  * Example: a query :                       Sink
  *                                           |
  *                                           Map
@@ -0,0 +1,33 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <Plans/LogicalPlan.hpp>
+
+namespace NES
+{
+
+/// Pushes selections towards the sources, thus they filter the records before the stateful operators build their state:
+/// 1. Below a union into each of its inputs, if the inputs have the field names of the union.
+/// 2. Below a join into the input, whose fields a conjunct of the predicate solely accesses.
+/// 3. Below a windowed aggregation, if a conjunct solely accesses the grouping keys.
+/// Conjuncts that access the fields of both join inputs or the window start and end stay above the operator.
+/// Session windows close after a gap in all records of their inputs, thus the rule does not push selections below session windows.
+class SelectionPushDownRule
+{
+public:
+    void apply(LogicalPlan& queryPlan) const; ///NOLINT(readability-convert-member-functions-to-static)
+};
+}
@@ -21,6 +21,7 @@
 #include <LegacyOptimizer/OriginIdInferencePhase.hpp>
 #include <LegacyOptimizer/RedundantProjectionRemovalRule.hpp>
 #include <LegacyOptimizer/RedundantUnionRemovalRule.hpp>
+#include <LegacyOptimizer/SelectionPushDownRule.hpp>
 #include <LegacyOptimizer/SinkBindingRule.hpp>
 #include <LegacyOptimizer/SourceInferencePhase.hpp>
 #include <LegacyOptimizer/TypeInferencePhase.hpp>
@@ -39,6 +40,7 @@ LogicalPlan LegacyOptimizer::optimize(const LogicalPlan& plan) const
     constexpr auto originIdInferencePhase = OriginIdInferencePhase{};
     constexpr auto redundantUnionRemovalRule = RedundantUnionRemovalRule{};
     constexpr auto redundantProjectionRemovalRule = RedundantProjectionRemovalRule{};
+    constexpr auto selectionPushDownRule = SelectionPushDownRule{};
 
     inlineSinkBindingPhase.apply(newPlan);
     sinkBindingRule.apply(newPlan);
@@ -52,6 +54,8 @@ LogicalPlan LegacyOptimizer::optimize(const LogicalPlan& plan) const
 
     redundantProjectionRemovalRule.apply(newPlan);
     NES_INFO("After Redundant Projection Removal:\n{}", newPlan);
+    selectionPushDownRule.apply(newPlan);
+    NES_INFO("After Selection Push Down:\n{}", newPlan);
 
     originIdInferencePhase.apply(newPlan);
     typeInference.apply(newPlan);
@@ -50,8 +50,10 @@ void LogicalSourceExpansionRule::apply(LogicalPlan& queryPlan) const
             throw UnknownSourceName("No physical sources present for logical source \"{}\"", sourceOp->getLogicalSourceName());
         }
 
+        /// Every partition of a physical source becomes a source of its own, thus the union merges the watermarks of all partitions
         auto expandedSourceOperators = entries
-            | std::views::transform([](const auto& entry) { return LogicalOperator{SourceDescriptorLogicalOperator{entry}}; })
+            | std::views::transform([](const auto& entry) { return entry.partition(); }) | std::views::join
+            | std::views::transform([](const auto& partition) { return LogicalOperator{SourceDescriptorLogicalOperator{partition}}; })
             | std::ranges::to<std::vector>();
 
         INVARIANT(getParents(queryPlan, sourceOp).size() == 1, "Source name operator must have exactly one parent");
@@ -0,0 +1,234 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <LegacyOptimizer/SelectionPushDownRule.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <optional>
+#include <ranges>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+#include <DataTypes/Schema.hpp>
+#include <Functions/BooleanFunctions/AndLogicalFunction.hpp>
+#include <Functions/FieldAccessLogicalFunction.hpp>
+#include <Functions/LogicalFunction.hpp>
+#include <Iterators/BFSIterator.hpp>
+#include <LegacyOptimizer/TypeInferencePhase.hpp>
+#include <Operators/LogicalOperator.hpp>
+#include <Operators/SelectionLogicalOperator.hpp>
+#include <Operators/UnionLogicalOperator.hpp>
+#include <Operators/Windows/JoinLogicalOperator.hpp>
+#include <Operators/Windows/WindowedAggregationLogicalOperator.hpp>
+#include <Plans/LogicalPlan.hpp>
+#include <WindowTypes/Types/SessionWindow.hpp>
+#include <ErrorHandling.hpp>
+
+namespace NES
+{
+
+namespace
+{
+std::vector<LogicalFunction> splitConjuncts(const LogicalFunction& predicate)
+{
+    if (not predicate.tryGet<AndLogicalFunction>())
+    {
+        return {predicate};
+    }
+    std::vector<LogicalFunction> conjuncts;
+    for (const auto& child : predicate.getChildren())
+    {
+        std::ranges::copy(splitConjuncts(child), std::back_inserter(conjuncts));
+    }
+    return conjuncts;
+}
+
+LogicalOperator createSelection(const std::vector<LogicalFunction>& conjuncts, const LogicalOperator& child)
+{
+    PRECONDITION(not conjuncts.empty(), "A selection requires at least one conjunct");
+    auto predicate = conjuncts.front();
+    for (const auto& conjunct : conjuncts | std::views::drop(1))
+    {
+        predicate = AndLogicalFunction(predicate, conjunct);
+    }
+    return LogicalOperator{SelectionLogicalOperator(std::move(predicate))}.withChildren({child});
+}
+
+std::vector<std::string> getAccessedFields(const LogicalFunction& function)
+{
+    return BFSRange(function)
+        | std::views::filter([](const LogicalFunction& child) { return child.tryGet<FieldAccessLogicalFunction>().has_value(); })
+        | std::views::transform([](const LogicalFunction& child) { return child.get<FieldAccessLogicalFunction>().getFieldName(); })
+        | std::ranges::to<std::vector>();
+}
+
+bool accessesSolely(const LogicalFunction& function, const Schema& schema)
+{
+    return std::ranges::all_of(getAccessedFields(function), [&schema](const auto& fieldName) { return schema.contains(fieldName); });
+}
+
+std::optional<LogicalOperator> pushBelowUnion(const LogicalFunction& predicate, const LogicalOperator& unionOperator)
+{
+    const auto fieldNames = unionOperator.getOutputSchema().getFieldNames();
+    const auto inputs = unionOperator.getChildren();
+    if (not std::ranges::all_of(inputs, [&fieldNames](const auto& input) { return input.getOutputSchema().getFieldNames() == fieldNames; }))
+    {
+        return std::nullopt;
+    }
+    return unionOperator.withChildren(
+        inputs | std::views::transform([&predicate](const auto& input) { return createSelection({predicate}, input); })
+        | std::ranges::to<std::vector>());
+}
+
+std::optional<LogicalOperator>
+pushBelowJoin(const std::vector<LogicalFunction>& conjuncts, const TypedLogicalOperator<JoinLogicalOperator>& join)
+{
+    if (dynamic_cast<const Windowing::SessionWindow*>(join->getWindowType().get()) != nullptr)
+    {
+        return std::nullopt;
+    }
+    std::vector<LogicalFunction> leftConjuncts;
+    std::vector<LogicalFunction> rightConjuncts;
+    std::vector<LogicalFunction> remainingConjuncts;
+    for (const auto& conjunct : conjuncts)
+    {
+        if (accessesSolely(conjunct, join->getLeftSchema()))
+        {
+            leftConjuncts.push_back(conjunct);
+        }
+        else if (accessesSolely(conjunct, join->getRightSchema()))
+        {
+            rightConjuncts.push_back(conjunct);
+        }
+        else
+        {
+            remainingConjuncts.push_back(conjunct);
+        }
+    }
+    if (leftConjuncts.empty() and rightConjuncts.empty())
+    {
+        return std::nullopt;
+    }
+
+    auto inputs = join.getChildren();
+    INVARIANT(inputs.size() == 2, "A join must have two inputs, but has {}", inputs.size());
+    if (not leftConjuncts.empty())
+    {
+        inputs[0] = createSelection(leftConjuncts, inputs[0]);
+    }
+    if (not rightConjuncts.empty())
+    {
+        inputs[1] = createSelection(rightConjuncts, inputs[1]);
+    }
+    LogicalOperator newJoin = join.withChildren(std::move(inputs));
+    if (remainingConjuncts.empty())
+    {
+        return newJoin;
+    }
+    return createSelection(remainingConjuncts, newJoin);
+}
+
+std::optional<LogicalOperator> pushBelowWindowedAggregation(
+    const std::vector<LogicalFunction>& conjuncts, const TypedLogicalOperator<WindowedAggregationLogicalOperator>& aggregation)
+{
+    if (dynamic_cast<const Windowing::SessionWindow*>(aggregation->getWindowType().get()) != nullptr)
+    {
+        return std::nullopt;
+    }
+    const auto groupingKeys = aggregation->getGroupingKeys()
+        | std::views::transform([](const FieldAccessLogicalFunction& key) { return key.getFieldName(); })
+        | std::ranges::to<std::unordered_set>();
+    const auto [pushedConjuncts, remainingConjuncts] = [&]
+    {
+        std::pair<std::vector<LogicalFunction>, std::vector<LogicalFunction>> partition;
+        for (const auto& conjunct : conjuncts)
+        {
+            const auto accessedFields = getAccessedFields(conjunct);
+            const auto accessesSolelyKeys = not accessedFields.empty()
+                and std::ranges::all_of(
+                    accessedFields, [&groupingKeys](const auto& fieldName) { return groupingKeys.contains(fieldName); });
+            (accessesSolelyKeys ? partition.first : partition.second).push_back(conjunct);
+        }
+        return partition;
+    }();
+    if (pushedConjuncts.empty())
+    {
+        return std::nullopt;
+    }
+
+    const auto inputs = aggregation.getChildren();
+    INVARIANT(inputs.size() == 1, "A windowed aggregation must have one input, but has {}", inputs.size());
+    LogicalOperator newAggregation = aggregation.withChildren({createSelection(pushedConjuncts, inputs.front())});
+    if (remainingConjuncts.empty())
+    {
+        return newAggregation;
+    }
+    return createSelection(remainingConjuncts, newAggregation);
+}
+
+/// Returns the subtree that replaces the selection, if a conjunct of the selection moves below its input
+std::optional<LogicalOperator> pushDown(const LogicalPlan& queryPlan, const TypedLogicalOperator<SelectionLogicalOperator>& selection)
+{
+    const auto inputs = selection.getChildren();
+    INVARIANT(inputs.size() == 1, "Selection operator must have exactly one child");
+    const auto& input = inputs.front();
+    /// Changing an input that other operators share would change their results as well
+    if (getParents(queryPlan, input).size() != 1)
+    {
+        return std::nullopt;
+    }
+
+    const auto predicate = selection->getPredicate();
+    if (input.tryGetAs<UnionLogicalOperator>())
+    {
+        return pushBelowUnion(predicate, input);
+    }
+    if (const auto join = input.tryGetAs<JoinLogicalOperator>())
+    {
+        return pushBelowJoin(splitConjuncts(predicate), *join);
+    }
+    if (const auto aggregation = input.tryGetAs<WindowedAggregationLogicalOperator>())
+    {
+        return pushBelowWindowedAggregation(splitConjuncts(predicate), *aggregation);
+    }
+    return std::nullopt;
+}
+}
+
+void SelectionPushDownRule::apply(LogicalPlan& queryPlan) const ///NOLINT(readability-convert-member-functions-to-static)
+{
+    constexpr auto typeInference = TypeInferencePhase{};
+    /// Every push moves conjuncts closer to the sources, thus the rule terminates once no selection moves anymore
+    for (auto pushed = true; pushed;)
+    {
+        pushed = false;
+        for (const auto& selection : getOperatorByType<SelectionLogicalOperator>(queryPlan))
+        {
+            if (auto replacement = pushDown(queryPlan, selection))
+            {
+                auto replaceResult = replaceSubtree(queryPlan, selection.getId(), *replacement);
+                INVARIANT(replaceResult.has_value(), "Failed to push down selection");
+                queryPlan = std::move(replaceResult.value());
+                /// The next push reads the schemas of the new selections
+                typeInference.apply(queryPlan);
+                pushed = true;
+                break;
+            }
+        }
+    }
+}
+
+}
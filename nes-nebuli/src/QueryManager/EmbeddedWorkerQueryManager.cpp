@@ -14,6 +14,11 @@
 
 #include <QueryManager/EmbeddedWorkerQueryManager.hpp>
 
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 #include <Identifiers/Identifiers.hpp>
 #include <Listeners/QueryLog.hpp>
 #include <Plans/LogicalPlan.hpp>
@@ -47,8 +52,29 @@ std::expected<void, Exception> EmbeddedWorkerQueryManager::unregister(const Quer
     return worker.unregisterQuery(queryId);
 }
 
+std::expected<void, Exception> EmbeddedWorkerQueryManager::updateParameters(
+    const QueryId queryId, const std::unordered_map<std::string, std::string>& parameters) noexcept
+{
+    return worker.updateQueryParameters(queryId, parameters);
+}
+
 std::expected<LocalQueryStatus, Exception> EmbeddedWorkerQueryManager::status(QueryId queryId) const noexcept
 {
     return worker.getQueryStatus(queryId);
 }
+
+std::optional<std::vector<PipelineMetrics>> EmbeddedWorkerQueryManager::pipelineMetrics(const QueryId queryId) const
+{
+    return worker.getPipelineMetrics(queryId);
+}
+
+std::optional<QueryMemoryMetrics> EmbeddedWorkerQueryManager::queryMemory(const QueryId queryId) const
+{
+    return worker.getQueryMemory(queryId);
+}
+
+EngineMetrics EmbeddedWorkerQueryManager::engineMetrics() const
+{
+    return worker.getEngineMetrics();
+}
 }
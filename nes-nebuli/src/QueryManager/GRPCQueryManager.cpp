@@ -19,6 +19,9 @@
 #include <exception>
 #include <memory>
 #include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #include <google/protobuf/empty.pb.h>
@@ -29,6 +32,7 @@
 
 #include <Listeners/QueryLog.hpp>
 #include <Plans/LogicalPlan.hpp>
+#include <Serialization/PlanFragmentCache.hpp>
 #include <Serialization/QueryPlanSerializationUtil.hpp>
 #include <Util/Logger/Logger.hpp>
 #include <ErrorHandling.hpp>
@@ -44,15 +48,37 @@ GRPCQueryManager::GRPCQueryManager(const std::shared_ptr<grpc::Channel>& channel
 {
 }
 
+namespace
+{
+bool failedWithErrorCode(const grpc::ClientContext& context, const ErrorCode errorCode)
+{
+    const auto& trailingMetadata = context.GetServerTrailingMetadata();
+    const auto code = trailingMetadata.find("code");
+    return code != trailingMetadata.end() and std::string_view(code->second.data(), code->second.size()) == std::to_string(errorCode);
+}
+}
+
 std::expected<QueryId, Exception> GRPCQueryManager::registerQuery(const NES::LogicalPlan& plan) noexcept
 {
     try
     {
-        grpc::ClientContext context;
+        const auto serializedPlan = NES::QueryPlanSerializationUtil::serializeQueryPlan(plan);
         RegisterQueryReply reply;
         RegisterQueryRequest request;
-        request.mutable_queryplan()->CopyFrom(NES::QueryPlanSerializationUtil::serializeQueryPlan(plan));
-        auto status = stub->RegisterQuery(&context, request, &reply);
+        request.mutable_queryplan()->CopyFrom(serializedPlan);
+        sentFragments.compactPlan(*request.mutable_queryplan());
+        auto context = std::make_unique<grpc::ClientContext>();
+        auto status = stub->RegisterQuery(context.get(), request, &reply);
+        if (not status.ok() and failedWithErrorCode(*context, ErrorCode::UnknownPlanFragment))
+        {
+            /// The worker evicted fragments or restarted, thus we send all fragments of the plan again
+            NES_DEBUG("Worker does not know all fragments of the plan, sending the full plan.");
+            sentFragments.clear();
+            request.mutable_queryplan()->CopyFrom(serializedPlan);
+            sentFragments.compactPlan(*request.mutable_queryplan());
+            context = std::make_unique<grpc::ClientContext>();
+            status = stub->RegisterQuery(context.get(), request, &reply);
+        }
         if (status.ok())
         {
             NES_DEBUG("Registration was successful.");
@@ -217,4 +243,33 @@ std::expected<void, Exception> GRPCQueryManager::stop(const QueryId queryId) noe
         return std::unexpected{QueryStopFailed("Message from external exception: {} ", e.what())};
     }
 }
+
+std::expected<void, Exception>
+GRPCQueryManager::updateParameters(const QueryId queryId, const std::unordered_map<std::string, std::string>& parameters) noexcept
+{
+    try
+    {
+        grpc::ClientContext context;
+        UpdateQueryParametersRequest request;
+        request.set_queryid(queryId.getRawValue());
+        request.mutable_parameters()->insert(parameters.begin(), parameters.end());
+        google::protobuf::Empty response;
+        const auto status = stub->UpdateQueryParameters(&context, request, &response);
+        if (status.ok())
+        {
+            NES_DEBUG("Updating the parameters was successful.");
+            return {};
+        }
+
+        return std::unexpected{NES::InvalidQueryParameter(
+            "Status: {}\nMessage: {}\nDetail: {}",
+            magic_enum::enum_name(status.error_code()),
+            status.error_message(),
+            status.error_details())};
+    }
+    catch (std::exception& e)
+    {
+        return std::unexpected{InvalidQueryParameter("Message from external exception: {} ", e.what())};
+    }
+}
 }
@@ -19,6 +19,7 @@
 #include <memory>
 #include <mutex>
 #include <ranges>
+#include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -182,14 +183,80 @@ std::expected<DropQueryStatementResult, Exception> QueryStatementHandler::operat
         .transform([&statement] { return DropQueryStatementResult{statement.id}; });
 }
 
+std::expected<QueryStatementResult, Exception> QueryStatementHandler::registerAndStart(const LogicalPlan& optimizedPlan)
+{
+    const auto id = queryManager->registerQuery(optimizedPlan);
+    return id.and_then([this](const auto& queryId) { return queryManager->start(queryId); })
+        .transform(
+            [&id, this]
+            {
+                runningQueries.push_back(id.value());
+                return QueryStatementResult{id.value()};
+            });
+}
+
 std::expected<QueryStatementResult, Exception> QueryStatementHandler::operator()(const QueryStatement& statement)
 {
     const std::unique_lock lock(mutex);
     CPPTRACE_TRY
     {
-        const auto optimizedPlan = optimizer->optimize(statement);
-        const auto id = queryManager->registerQuery(optimizedPlan);
-        return id.and_then([this](const auto& queryId) { return queryManager->start(queryId); })
+        return registerAndStart(optimizer->optimize(statement));
+    }
+    CPPTRACE_CATCH(...)
+    {
+        return std::unexpected{wrapExternalException()};
+    }
+    std::unreachable();
+}
+
+std::expected<PrepareQueryStatementResult, Exception> QueryStatementHandler::operator()(const PrepareQueryStatement& statement)
+{
+    const std::unique_lock lock(mutex);
+    CPPTRACE_TRY
+    {
+        if (preparedQueries.contains(statement.name))
+        {
+            return std::unexpected{InvalidStatement("A query named {} is already prepared", statement.name)};
+        }
+        preparedQueries.emplace(statement.name, optimizer->optimize(statement.plan));
+        return PrepareQueryStatementResult{statement.name};
+    }
+    CPPTRACE_CATCH(...)
+    {
+        return std::unexpected{wrapExternalException()};
+    }
+    std::unreachable();
+}
+
+std::expected<QueryStatementResult, Exception> QueryStatementHandler::operator()(const ExecuteQueryStatement& statement)
+{
+    const std::unique_lock lock(mutex);
+    CPPTRACE_TRY
+    {
+        const auto preparedQuery = preparedQueries.find(statement.name);
+        if (preparedQuery == preparedQueries.end())
+        {
+            return std::unexpected{InvalidStatement("There is no prepared query named {}", statement.name)};
+        }
+        if (statement.parameters.empty())
+        {
+            return registerAndStart(preparedQuery->second);
+        }
+
+        /// The instance shares the plan of the template, solely the values of its parameters differ
+        const auto id = queryManager->registerQuery(preparedQuery->second);
+        return id.and_then([&](const auto& queryId) { return queryManager->updateParameters(queryId, statement.parameters); })
+            .or_else(
+                [&](const Exception& exception) -> std::expected<void, Exception>
+                {
+                    if (id.has_value())
+                    {
+                        /// The instance never started, thus it is unregistered again if one of its parameters cannot be set
+                        [[maybe_unused]] const auto unregistered = queryManager->unregister(id.value());
+                    }
+                    return std::unexpected{exception};
+                })
+            .and_then([&] { return queryManager->start(id.value()); })
             .transform(
                 [&id, this]
                 {
@@ -0,0 +1,57 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <Util/RollingAverage.hpp>
+#include <folly/Synchronized.h>
+
+namespace NES
+{
+
+/// Decides per new slice, whether the builds of an aggregation pre-aggregate its records in their small per thread tables, c.f.,
+/// AggregationBuildPhysicalOperator. The builds report for every flush of a table, how many records it has combined into how many keys.
+/// At a high key cardinality, nearly every record creates a key of its own, thus the table solely adds the cost of merging it into the
+/// slice. Then, the builds insert the records of the following slices directly into the slice hash maps. As the cardinality changes
+/// over time, every SAMPLING_INTERVAL-th slice pre-aggregates anyway to measure the reduction again.
+class AdaptivePreAggregation
+{
+public:
+    /// Pre-aggregation pays off, if the table combines at least this share of the records into keys that it already contains
+    static constexpr double MIN_REDUCTION = 0.25;
+    static constexpr uint64_t SAMPLING_INTERVAL = 16;
+    /// Number of flushes, over which we average the reduction
+    static constexpr uint64_t NUMBER_OF_SAMPLES = 64;
+
+    /// Called by a build after merging a table, which has combined `numberOfRecords` records into `numberOfKeys` keys, into its slice
+    void recordFlush(uint64_t numberOfRecords, uint64_t numberOfKeys);
+
+    /// Called once per new slice, decides whether the builds pre-aggregate the records of the following slices
+    void onNewSlice();
+
+    [[nodiscard]] bool isEnabled() const;
+
+    /// Average share of the records, which the tables have combined into existing keys, or 1 if no build has flushed a table yet
+    [[nodiscard]] double getReduction() const;
+
+private:
+    folly::Synchronized<RollingAverage<double>> reduction{RollingAverage<double>{NUMBER_OF_SAMPLES}};
+    std::atomic<bool> hasSamples{false};
+    std::atomic<bool> enabled{true};
+    std::atomic<uint64_t> numberOfSlices{0};
+};
+
+}
@@ -15,18 +15,24 @@
 #pragma once
 
 
+#include <cstdint>
 #include <memory>
 #include <vector>
 #include <Aggregation/AggregationOperatorHandler.hpp>
 #include <Aggregation/Function/AggregationPhysicalFunction.hpp>
 #include <Identifiers/Identifiers.hpp>
 #include <Nautilus/Interface/HashMap/HashMap.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <Nautilus/Interface/RecordBuffer.hpp>
 #include <Runtime/Execution/OperatorHandler.hpp>
 #include <Time/Timestamp.hpp>
 #include <Watermark/TimeFunction.hpp>
 #include <CompilationContext.hpp>
+#include <ExecutionContext.hpp>
 #include <HashMapOptions.hpp>
 #include <WindowBuildPhysicalOperator.hpp>
+#include <val.hpp>
+#include <val_ptr.hpp>
 
 namespace NES
 {
@@ -35,8 +41,16 @@ Interface::HashMap* getAggHashMapProxy(
     const AggregationOperatorHandler* operatorHandler,
     Timestamp timestamp,
     WorkerThreadId workerThreadId,
+    uint64_t partition,
     const AggregationBuildPhysicalOperator* buildOperator);
+Interface::HashMap* getPreAggregationTableProxy(
+    AggregationOperatorHandler* operatorHandler, WorkerThreadId workerThreadId, const AggregationBuildPhysicalOperator* buildOperator);
 
+/// Updates the aggregation states of each record in the hash map of its slice and worker thread.
+/// Optionally, the build first aggregates the records of a buffer in a small table per worker thread that fits into the L1 cache.
+/// It merges the table into the hash map of the slice, once the buffer is processed, a record belongs to another slice, or the table is
+/// full. For streams with few hot keys, most records solely update the small table instead of the large hash map of the slice.
+/// At a high key cardinality, the handler disables the table for new slices, c.f., AdaptivePreAggregation.
 class AggregationBuildPhysicalOperator final : public WindowBuildPhysicalOperator
 {
 public:
@@ -44,20 +58,55 @@ public:
         const AggregationOperatorHandler* operatorHandler,
         Timestamp timestamp,
         WorkerThreadId workerThreadId,
+        uint64_t partition,
         const AggregationBuildPhysicalOperator* buildOperator);
+    friend Interface::HashMap* getPreAggregationTableProxy(
+        AggregationOperatorHandler* operatorHandler, WorkerThreadId workerThreadId, const AggregationBuildPhysicalOperator* buildOperator);
 
+    /// @param numberOfPartitions must be a power of 2 and not larger than HashMapOptions::MAX_NUMBER_OF_PARTITIONS
+    /// @param preAggregationTableSize number of keys of the pre-aggregation table. 0 disables it. Requires a single partition and
+    /// aggregation states without cleanup, as the table gets cleared without calling the cleanup function of the states.
     AggregationBuildPhysicalOperator(
         OperatorHandlerId operatorHandlerId,
         std::unique_ptr<TimeFunction> timeFunction,
         std::vector<std::shared_ptr<AggregationPhysicalFunction>> aggregationFunctions,
-        HashMapOptions hashMapOptions);
+        HashMapOptions hashMapOptions,
+        uint64_t numberOfPartitions = 1,
+        uint64_t preAggregationTableSize = 0);
     void setup(ExecutionContext& executionCtx, CompilationContext& compilationContext) const override;
     void execute(ExecutionContext& ctx, Record& record) const override;
 
+    /// Merges the pre-aggregation table into the slice, before the windows get triggered
+    void close(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const override;
+
+protected:
+    [[nodiscard]] std::unique_ptr<WindowOperatorBuildLocalState> createLocalState(
+        ExecutionContext& executionCtx,
+        const nautilus::val<OperatorHandler*>& operatorHandler,
+        const nautilus::val<Timestamp>& oldestAcceptedTimestamp) const override;
+
 private:
+    /// Updates the aggregation states of the keys of the record in the slice of the timestamp
+    void aggregateRecord(ExecutionContext& ctx, Record& record, const nautilus::val<Timestamp>& timestamp) const;
+
+    /// Returns the hash map of the slice of the timestamp for the partition
+    nautilus::val<Interface::HashMap*>
+    getHashMap(ExecutionContext& ctx, const nautilus::val<Timestamp>& timestamp, const nautilus::val<uint64_t>& partition) const;
+
+    /// Returns the pre-aggregation table for the records of the slice hash map. If the table holds the states of another slice or is full,
+    /// it merges the table into its slice hash map first. Returns the slice hash map, if the handler disabled the pre-aggregation for the
+    /// slice, c.f., AdaptivePreAggregation.
+    nautilus::val<Interface::HashMap*>
+    getPreAggregationTable(ExecutionContext& ctx, const nautilus::val<Interface::HashMap*>& sliceHashMapPtr) const;
+
+    /// Combines the pre-aggregated states into the slice hash map and clears the table
+    void flushPreAggregationTable(ExecutionContext& ctx) const;
+
     /// The aggregation function is a shared_ptr, because it is used in the aggregation build and in the getSliceCleanupFunction()
     std::vector<std::shared_ptr<AggregationPhysicalFunction>> aggregationPhysicalFunctions;
     HashMapOptions hashMapOptions;
+    uint64_t numberOfPartitions;
+    uint64_t preAggregationTableSize;
 };
 
 }
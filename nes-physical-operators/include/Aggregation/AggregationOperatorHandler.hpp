@@ -19,14 +19,22 @@
 #include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <utility>
 #include <vector>
+#include <Aggregation/AdaptivePreAggregation.hpp>
+#include <Aggregation/AggregationSlice.hpp>
 #include <Identifiers/Identifiers.hpp>
+#include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMap.hpp>
 #include <Nautilus/Interface/HashMap/HashMap.hpp>
 #include <Runtime/Execution/OperatorHandler.hpp>
 #include <SliceStore/Slice.hpp>
 #include <SliceStore/WindowSlicesStoreInterface.hpp>
+#include <Time/Timestamp.hpp>
 #include <Util/RollingAverage.hpp>
+#include <folly/Synchronized.h>
+#include <HashMapRecycler.hpp>
 #include <HashMapSlice.hpp>
 #include <WindowBasedOperatorHandler.hpp>
 
@@ -41,8 +49,12 @@ struct EmittedAggregationWindow
     EmittedAggregationWindow(
         const WindowInfo windowInfo,
         std::unique_ptr<Nautilus::Interface::HashMap> finalHashMap,
-        const std::vector<Nautilus::Interface::HashMap*>& allHashMaps)
-        : windowInfo(windowInfo), finalHashMap(std::move(finalHashMap)), numberOfHashMaps(allHashMaps.size())
+        const std::vector<Nautilus::Interface::HashMap*>& allHashMaps,
+        std::vector<std::shared_ptr<AggregationSlice>> slices)
+        : windowInfo(windowInfo)
+        , finalHashMap(std::move(finalHashMap))
+        , numberOfHashMaps(allHashMaps.size())
+        , slices(std::move(slices))
     {
         finalHashMapPtr = this->finalHashMap.get();
         /// Copying the hashmap pointers after this object, hence this + 1
@@ -56,8 +68,26 @@ struct EmittedAggregationWindow
         finalHashMap; /// Pointer to the final hash map that the probe should use to combine all hash maps
     uint64_t numberOfHashMaps;
     Nautilus::Interface::HashMap** hashMaps; /// Pointer to the stored pointers of all hash maps that the probe should combine
+
+    /// Solely set for the incremental aggregation of sliding windows, c.f., AggregationOperatorHandler::prepareIncrementalAggregation()
+    std::vector<std::shared_ptr<AggregationSlice>> slices;
+    /// Pairs of the target and the source hash map, whose aggregation states the probe combines into the target
+    std::vector<std::pair<Nautilus::Interface::HashMap*, Nautilus::Interface::HashMap*>> combineSteps;
+    /// Solely used by the top n of the probe. Bounded heap of the order values and entries of the final hash map, whose top is the entry
+    /// that is evicted next, i.e., the minimum for a descending and the maximum for an ascending order.
+    std::vector<std::pair<double, Nautilus::Interface::ChainedHashMapEntry*>> topNEntries;
 };
 
+/// For sliding windows, the probe combines the hash maps of at least size / slide slices per window.
+/// To make the work per window independent of this ratio, the incremental aggregation divides the time into chunks, whose length is the
+/// largest multiple of the slide that is not larger than the window size. Thus, a window [start, end) contains at most one chunk start
+/// and consists of a suffix of one chunk [start, chunkStart) and a prefix of the next chunk [chunkStart, end).
+/// Each slice stores the combined states of its chunk up to (prefix) and from (suffix) it. The probe creates these hash maps once by
+/// combining the slice with the prefix of its predecessor or the suffix of its successor and then combines per window solely the suffix
+/// of its first slice and the prefix of its last slice into the final hash map.
+/// In contrast to subtracting expired slices from a running state, this works for all aggregation functions, e.g., min, max, and median,
+/// and for windows that are probed concurrently and out of order.
+
 class AggregationOperatorHandler final : public WindowBasedOperatorHandler
 {
 public:
@@ -65,11 +95,31 @@ public:
         const std::vector<OriginId>& inputOrigins,
         OriginId outputOriginId,
         std::unique_ptr<WindowSlicesStoreInterface> sliceAndWindowStore,
-        uint64_t maxNumberOfBuckets);
+        uint64_t maxNumberOfBuckets,
+        bool incrementalAggregation);
 
     [[nodiscard]] std::function<std::vector<std::shared_ptr<Slice>>(SliceStart, SliceEnd)>
     getCreateNewSlicesFunction(const CreateNewSlicesArguments& newSlicesArguments) const override;
 
+    /// Triggers all windows behind the global watermark and afterward emits the early results of all windows that are still filling,
+    /// c.f., WindowSlicesStoreInterface::getEarlyWindowSlices()
+    void checkAndTriggerWindows(const BufferMetaData& bufferMetaData, PipelineExecutionContext* pipelineCtx) override;
+
+    /// Creates all missing prefix and suffix hash maps of the slices of the window and stores the combine steps that fill them, followed
+    /// by the combine steps of the final hash map, in the window. To create each prefix and suffix hash map once, it locks until
+    /// finishIncrementalAggregation() is called. Returns the number of combine steps that have to be executed while holding the lock.
+    uint64_t prepareIncrementalAggregation(EmittedAggregationWindow& window);
+
+    /// Releases the lock of prepareIncrementalAggregation() and returns the number of all combine steps of the window
+    uint64_t finishIncrementalAggregation(const EmittedAggregationWindow& window);
+
+    /// Returns the pre-aggregation table of the worker thread, c.f., AggregationBuildPhysicalOperator. Creates the table on first access.
+    Nautilus::Interface::HashMap* getPreAggregationTableOrCreate(
+        WorkerThreadId workerThreadId, const std::function<std::unique_ptr<Nautilus::Interface::HashMap>()>& createTable);
+
+    /// Decides per new slice, whether the builds pre-aggregate its records, if they have a pre-aggregation table
+    [[nodiscard]] AdaptivePreAggregation& getAdaptivePreAggregation() const;
+
     /// Is required to not perform the setup again and resolving a race condition to the cleanup state function
     std::atomic<bool> setupAlreadyCalled;
     /// shared_ptr as multiple slices need access to it
@@ -79,8 +129,32 @@ protected:
     void triggerSlices(
         const std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>>& slicesAndWindowInfo,
         PipelineExecutionContext* pipelineCtx) override;
+
+    /// Emits the slices of the window with the watermark to the probe operator, as one buffer per partition
+    void emitWindow(
+        const WindowInfoAndSequenceNumber& windowInfo,
+        const std::vector<std::shared_ptr<Slice>>& allSlices,
+        Timestamp watermark,
+        PipelineExecutionContext* pipelineCtx);
+    void emitPartitionToProbe(
+        const WindowInfoAndSequenceNumber& windowInfo,
+        const std::vector<std::shared_ptr<Slice>>& allSlices,
+        uint64_t partition,
+        uint64_t numberOfPartitions,
+        Timestamp watermark,
+        PipelineExecutionContext* pipelineCtx);
+
     folly::Synchronized<RollingAverage<uint64_t>> rollingAverageNumberOfKeys;
     uint64_t maxNumberOfBuckets;
+    /// Shared with all slices of the handler, which reuse the hash maps of the destroyed slices instead of allocating them again
+    std::shared_ptr<HashMapRecycler> hashMapRecycler = std::make_shared<HashMapRecycler>();
+    bool incrementalAggregation;
+    uint64_t chunkSize; /// Largest multiple of the window slide that is not larger than the window size
+    std::mutex incrementalAggregationMutex; /// Guards the prefix and suffix hash maps of all slices
+    /// Shared with the function that creates the slices, which lets it decide per new slice
+    std::shared_ptr<AdaptivePreAggregation> adaptivePreAggregation = std::make_shared<AdaptivePreAggregation>();
+    /// Each worker thread pre-aggregates the records of a buffer in its own small table, before merging them into the slice
+    folly::Synchronized<std::unordered_map<WorkerThreadId, std::unique_ptr<Nautilus::Interface::HashMap>>> preAggregationTables;
 };
 
 }
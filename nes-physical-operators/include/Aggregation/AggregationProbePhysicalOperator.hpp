@@ -14,14 +14,19 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <optional>
+#include <string>
 #include <vector>
 #include <Aggregation/Function/AggregationPhysicalFunction.hpp>
+#include <Nautilus/Interface/HashMap/HashMap.hpp>
 #include <Nautilus/Interface/RecordBuffer.hpp>
 #include <Runtime/Execution/OperatorHandler.hpp>
 #include <Windowing/WindowMetaData.hpp>
 #include <HashMapOptions.hpp>
 #include <WindowProbePhysicalOperator.hpp>
+#include <val_ptr.hpp>
 
 namespace NES
 {
@@ -29,16 +34,30 @@ namespace NES
 class AggregationProbePhysicalOperator final : public WindowProbePhysicalOperator
 {
 public:
+    /// Emits solely the `limit` records of a window with the highest (descending) or lowest (ascending) value of the numeric order field
+    struct TopN
+    {
+        std::string orderFieldName;
+        bool descending = true;
+        uint64_t limit = 0;
+    };
+
     AggregationProbePhysicalOperator(
         HashMapOptions hashMapOptions,
         std::vector<std::shared_ptr<AggregationPhysicalFunction>> aggregationPhysicalFunctions,
         OperatorHandlerId operatorHandlerId,
-        WindowMetaData windowMetaData);
+        WindowMetaData windowMetaData,
+        bool incrementalAggregation,
+        std::optional<TopN> topN = std::nullopt);
     void open(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const override;
 
 private:
     std::vector<std::shared_ptr<AggregationPhysicalFunction>> aggregationPhysicalFunctions;
     HashMapOptions hashMapOptions;
+    /// Combines the prefix and suffix hash maps of the slices instead of all slices, c.f., AggregationOperatorHandler
+    bool incrementalAggregation;
+    /// Keeps the top n entries in a bounded heap while iterating over the final hash map, c.f., EmittedAggregationWindow::topNEntries
+    std::optional<TopN> topN;
 };
 
 }
@@ -15,6 +15,7 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
 #include <Identifiers/Identifiers.hpp>
 #include <Nautilus/Interface/HashMap/HashMap.hpp>
 #include <SliceStore/Slice.hpp>
@@ -25,17 +26,39 @@ namespace NES
 
 /// This class represents a single slice for the (keyed) aggregation. It stores the aggregation state in a hashmap.
 /// If it is a global/non-keyed aggregation, each hashmap contains a single entry for the keyValue = 0.
-/// In our current implementation, we have one hashmap per worker thread.
+/// In our current implementation, we have one hashmap per worker thread and radix partition, ordered by worker thread and then by
+/// partition, c.f., HJSlice. As equal keys always end up in the same partition, the probe combines each partition separately.
+///
+/// For the incremental aggregation of sliding windows, the slice additionally stores the combined aggregation states of the other slices
+/// of its chunk, c.f., AggregationOperatorHandler. The prefix hash map combines all slices from the chunk start up to and including this
+/// slice and the suffix hash map combines all slices from this slice up to the chunk end.
 class AggregationSlice final : public HashMapSlice
 {
 public:
     AggregationSlice(
         SliceStart sliceStart, SliceEnd sliceEnd, const CreateNewHashMapSliceArgs& createNewHashMapSliceArgs, uint64_t numberOfHashMaps);
+    ~AggregationSlice() override;
 
     /// Returns the pointer to the underlying hashmap.
     /// IMPORTANT: This method should only be used for passing the hashmap to the nautilus executable.
-    [[nodiscard]] Nautilus::Interface::HashMap* getHashMapPtr(WorkerThreadId workerThreadId) const;
-    [[nodiscard]] Nautilus::Interface::HashMap* getHashMapPtrOrCreate(WorkerThreadId workerThreadId);
+    [[nodiscard]] Nautilus::Interface::HashMap* getHashMapPtr(WorkerThreadId workerThreadId, uint64_t partition = 0) const;
+    [[nodiscard]] Nautilus::Interface::HashMap* getHashMapPtrOrCreate(WorkerThreadId workerThreadId, uint64_t partition = 0);
+
+    /// Returns the number of hash maps per partition, i.e., one per worker thread
+    [[nodiscard]] uint64_t getNumberOfHashMapsPerPartition() const;
+    [[nodiscard]] uint64_t getNumberOfPartitions() const;
+
+    /// Returns nullptr, if the prefix or suffix hash map has not been created yet
+    [[nodiscard]] Nautilus::Interface::HashMap* getPrefixHashMapPtr() const;
+    [[nodiscard]] Nautilus::Interface::HashMap* getSuffixHashMapPtr() const;
+    [[nodiscard]] Nautilus::Interface::HashMap* createPrefixHashMap();
+    [[nodiscard]] Nautilus::Interface::HashMap* createSuffixHashMap();
+
+private:
+    [[nodiscard]] uint64_t getHashMapPosition(WorkerThreadId workerThreadId, uint64_t partition) const;
+
+    std::unique_ptr<Nautilus::Interface::HashMap> prefixHashMap;
+    std::unique_ptr<Nautilus::Interface::HashMap> suffixHashMap;
 };
 
 }
@@ -16,12 +16,16 @@
 
 #include <cstddef>
 #include <memory>
+#include <vector>
 #include <DataTypes/DataType.hpp>
 #include <Functions/PhysicalFunction.hpp>
+#include <Nautilus/Interface/HashMap/HashMap.hpp>
 #include <Nautilus/Interface/Record.hpp>
 #include <Runtime/AbstractBufferProvider.hpp>
 #include <ExecutionContext.hpp>
+#include <HashMapOptions.hpp>
 #include <val_concepts.hpp>
+#include <val_ptr.hpp>
 
 namespace NES
 {
@@ -80,4 +84,13 @@ protected:
     const Nautilus::Record::RecordFieldIdentifier resultFieldIdentifier;
 };
 
+/// Combines the aggregation states of all entries of the hash map into the entries of the same keys in the target hash map.
+/// Missing entries in the target hash map are created and reset before combining them.
+void combineAggregationHashMaps(
+    ExecutionContext& executionCtx,
+    const HashMapOptions& hashMapOptions,
+    const std::vector<std::shared_ptr<AggregationPhysicalFunction>>& aggregationPhysicalFunctions,
+    const nautilus::val<Interface::HashMap*>& targetHashMapPtr,
+    const nautilus::val<Interface::HashMap*>& hashMapPtr);
+
 }
@@ -0,0 +1,59 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <Aggregation/Function/AggregationPhysicalFunction.hpp>
+#include <DataTypes/DataType.hpp>
+#include <Functions/PhysicalFunction.hpp>
+#include <Nautilus/Interface/Hash/HashFunction.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <val_concepts.hpp>
+
+namespace NES
+{
+
+/// Approximates the number of distinct values via an ApproxCountDistinctSketch. The state has a constant size regardless of the number of
+/// distinct values, whereas an exact count would have to keep all distinct values. Combining the states of two slices merges their registers.
+/// The aggregation state stores a pointer to the sketch, as the sketch is larger than the pages of the hash maps.
+class ApproxCountDistinctAggregationPhysicalFunction : public AggregationPhysicalFunction
+{
+public:
+    ApproxCountDistinctAggregationPhysicalFunction(
+        DataType inputType,
+        DataType resultType,
+        PhysicalFunction inputFunction,
+        Nautilus::Record::RecordFieldIdentifier resultFieldIdentifier);
+    void lift(
+        const nautilus::val<AggregationState*>& aggregationState,
+        PipelineMemoryProvider& pipelineMemoryProvider,
+        const Nautilus::Record& record) override;
+    void combine(
+        nautilus::val<AggregationState*> aggregationState1,
+        nautilus::val<AggregationState*> aggregationState2,
+        PipelineMemoryProvider& pipelineMemoryProvider) override;
+    Nautilus::Record lower(nautilus::val<AggregationState*> aggregationState, PipelineMemoryProvider& pipelineMemoryProvider) override;
+    void reset(nautilus::val<AggregationState*> aggregationState, PipelineMemoryProvider& pipelineMemoryProvider) override;
+    void cleanup(nautilus::val<AggregationState*> aggregationState) override;
+    [[nodiscard]] size_t getSizeOfStateInBytes() const override;
+    ~ApproxCountDistinctAggregationPhysicalFunction() override = default;
+
+private:
+    /// Hashes the values like the keys of the hash maps, i.e., also variable sized values
+    std::unique_ptr<Nautilus::Interface::HashFunction> hashFunction;
+};
+
+}
@@ -0,0 +1,43 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace NES
+{
+
+/// HyperLogLog sketch with a fixed precision, c.f., Heule et al. "HyperLogLog in Practice" (HyperLogLog++).
+/// Each of the 2^PRECISION registers stores the maximum position of the first one bit of the hashes that fall into it. The size of the
+/// sketch is independent of the number of distinct values and two sketches merge by taking the maximum of each register.
+/// As we use 64-bit hashes, there is no need for the large range correction of the original HyperLogLog. In contrast to HyperLogLog++,
+/// we solely fall back to linear counting for small cardinalities without the empirical bias correction, which keeps the sketch small.
+class ApproxCountDistinctSketch
+{
+public:
+    /// The relative standard error is about 1.04 / sqrt(2^PRECISION), i.e., 1.6% for a precision of 12
+    static constexpr uint64_t PRECISION = 12;
+    static constexpr uint64_t NUMBER_OF_REGISTERS = 1UL << PRECISION;
+
+    void insertHash(uint64_t hash);
+    void merge(const ApproxCountDistinctSketch& other);
+    [[nodiscard]] uint64_t getNumberOfDistinctValues() const;
+
+private:
+    std::array<uint8_t, NUMBER_OF_REGISTERS> registers{};
+};
+
+}
@@ -0,0 +1,67 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <limits>
+
+namespace NES
+{
+
+/// Merging t-digest with a fixed capacity, c.f., Dunning and Ertl "Computing Extremely Accurate Quantiles Using t-Digests".
+/// It summarizes the values by centroids, i.e., a mean and the number of values it represents. Centroids close to the minimum or maximum
+/// represent fewer values than central ones, which keeps the error of extreme quantiles small. Inserting and merging append centroids and
+/// compress all centroids by merging neighbours, once the capacity is exhausted. Thus, the size of the sketch is independent of the number
+/// of values and merging two sketches costs O(CAPACITY log CAPACITY).
+class ApproxQuantileSketch
+{
+public:
+    /// Bounds the number of centroids after a compression. A larger compression reduces the error, but enlarges the sketch.
+    static constexpr uint64_t COMPRESSION = 64;
+    static constexpr uint64_t CAPACITY = 2 * COMPRESSION;
+
+    void insert(double value);
+    void merge(const ApproxQuantileSketch& other);
+
+    /// Returns the approximate value of the quantile in [0, 1] by interpolating between the means of the neighbouring centroids.
+    /// Returns 0, if the sketch is empty.
+    [[nodiscard]] double getQuantile(double quantile);
+
+    [[nodiscard]] uint64_t getNumberOfValues() const;
+    [[nodiscard]] uint64_t getNumberOfCentroids() const;
+
+private:
+    struct Centroid
+    {
+        double mean;
+        double weight;
+    };
+
+    void addCentroid(Centroid centroid);
+
+    /// Sorts the centroids by their mean and merges neighbours, as long as the merged centroid does not exceed the size limit of its
+    /// quantile, c.f., the k1 scale function of the paper
+    void compress();
+
+    std::array<Centroid, CAPACITY> centroids{};
+    uint64_t numberOfCentroids{0};
+    uint64_t numberOfCompressedCentroids{0}; /// The first ones are sorted and compressed already
+    double totalWeight{0};
+    double min{std::numeric_limits<double>::infinity()};
+    double max{-std::numeric_limits<double>::infinity()};
+};
+
+}
@@ -0,0 +1,56 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <span>
+
+namespace NES
+{
+
+/// SpaceSaving sketch with a fixed number of counters, c.f., Metwally et al. "Efficient Computation of Frequent and Top-k Elements in
+/// Data Streams". A value without a counter replaces the value of the smallest counter and inherits its count as error. Thus, the count of
+/// a counter overestimates the frequency of its value by at most its error, and every value, whose frequency exceeds the total number of
+/// values divided by CAPACITY, has a counter. Two sketches merge by adding their counters, c.f., Agarwal et al. "Mergeable Summaries".
+/// The sketch stores the values by their 64-bit representation, i.e., the caller has to map the values to keys.
+class ApproxTopKSketch
+{
+public:
+    /// The maximum k of the top-k values. More counters reduce the error, but enlarge the sketch and slow down the insertion.
+    static constexpr uint64_t CAPACITY = 64;
+
+    struct Counter
+    {
+        uint64_t key;
+        uint64_t count;
+        uint64_t error;
+    };
+
+    void insert(uint64_t key);
+    void merge(const ApproxTopKSketch& other);
+
+    /// Returns up to k counters in descending order of their count
+    [[nodiscard]] std::span<const Counter> getTopK(uint64_t k);
+
+private:
+    /// Returns the smallest count, if all counters are in use, as any value without a counter might have occurred this often
+    [[nodiscard]] uint64_t getMaximumCountOfMissingValues() const;
+
+    std::array<Counter, CAPACITY> counters{};
+    uint64_t numberOfCounters{0};
+};
+
+}
@@ -0,0 +1,34 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <Aggregation/Function/CovarPopAggregationPhysicalFunction.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <val_concepts.hpp>
+
+namespace NES
+{
+
+/// Calculates the Pearson correlation coefficient of two fields from the co-moment state of the covariance.
+/// If one of the fields is constant, the correlation is undefined and the result is 0.
+class CorrAggregationPhysicalFunction final : public CovarPopAggregationPhysicalFunction
+{
+public:
+    using CovarPopAggregationPhysicalFunction::CovarPopAggregationPhysicalFunction;
+    Nautilus::Record lower(nautilus::val<AggregationState*> aggregationState, PipelineMemoryProvider& pipelineMemoryProvider) override;
+    ~CorrAggregationPhysicalFunction() override = default;
+};
+
+}
@@ -0,0 +1,72 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <Aggregation/Function/AggregationPhysicalFunction.hpp>
+#include <DataTypes/DataType.hpp>
+#include <Functions/PhysicalFunction.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <val_concepts.hpp>
+
+namespace NES
+{
+
+/// Calculates the population covariance of two fields in a single pass via the bivariate algorithm of Welford.
+/// Next to the co-moment, the state keeps the sums of the squared distances of both fields to their means, which their correlation needs.
+/// The state has a constant size, i.e., [count] [meanX] [meanY] [m2X] [m2Y] [coMoment], and two states combine in O(1).
+class CovarPopAggregationPhysicalFunction : public AggregationPhysicalFunction
+{
+public:
+    CovarPopAggregationPhysicalFunction(
+        DataType inputType,
+        DataType resultType,
+        PhysicalFunction inputFunction,
+        PhysicalFunction secondInputFunction,
+        Nautilus::Record::RecordFieldIdentifier resultFieldIdentifier);
+    void lift(
+        const nautilus::val<AggregationState*>& aggregationState,
+        PipelineMemoryProvider& pipelineMemoryProvider,
+        const Nautilus::Record& record) override;
+    void combine(
+        nautilus::val<AggregationState*> aggregationState1,
+        nautilus::val<AggregationState*> aggregationState2,
+        PipelineMemoryProvider& pipelineMemoryProvider) override;
+    Nautilus::Record lower(nautilus::val<AggregationState*> aggregationState, PipelineMemoryProvider& pipelineMemoryProvider) override;
+    void reset(nautilus::val<AggregationState*> aggregationState, PipelineMemoryProvider& pipelineMemoryProvider) override;
+    void cleanup(nautilus::val<AggregationState*> aggregationState) override;
+    [[nodiscard]] size_t getSizeOfStateInBytes() const override;
+    ~CovarPopAggregationPhysicalFunction() override = default;
+
+protected:
+    struct CoMomentState
+    {
+        nautilus::val<double> count;
+        nautilus::val<double> meanX;
+        nautilus::val<double> meanY;
+        nautilus::val<double> m2X; /// Sum of the squared distances of the first field to its mean
+        nautilus::val<double> m2Y; /// Sum of the squared distances of the second field to its mean
+        nautilus::val<double> coMoment; /// Sum of the products of the distances of both fields to their means
+    };
+
+    static CoMomentState readState(const nautilus::val<AggregationState*>& aggregationState);
+
+private:
+    static void writeState(const nautilus::val<AggregationState*>& aggregationState, const CoMomentState& state);
+
+    PhysicalFunction secondInputFunction;
+};
+
+}
@@ -0,0 +1,51 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <Aggregation/Function/AggregationPhysicalFunction.hpp>
+#include <Aggregation/Function/SharedStateAggregationPhysicalFunction.hpp>
+#include <DataTypes/DataType.hpp>
+#include <Functions/PhysicalFunction.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <val_concepts.hpp>
+
+namespace NES
+{
+
+/// Calculates the same aggregation over the same input as another aggregation of the operator, e.g., SUM(a) AS s1 and SUM(a) AS s2.
+/// Thus, it lowers the state of the other aggregation and solely renames its result.
+class DuplicateAggregationPhysicalFunction final : public SharedStateAggregationPhysicalFunction
+{
+public:
+    DuplicateAggregationPhysicalFunction(
+        DataType inputType,
+        DataType resultType,
+        PhysicalFunction inputFunction,
+        Nautilus::Record::RecordFieldIdentifier resultFieldIdentifier,
+        std::shared_ptr<AggregationPhysicalFunction> original,
+        Nautilus::Record::RecordFieldIdentifier originalResultFieldIdentifier,
+        size_t originalStateOffset);
+    Nautilus::Record lower(nautilus::val<AggregationState*> aggregationState, PipelineMemoryProvider& pipelineMemoryProvider) override;
+    ~DuplicateAggregationPhysicalFunction() override = default;
+
+private:
+    std::shared_ptr<AggregationPhysicalFunction> original;
+    Nautilus::Record::RecordFieldIdentifier originalResultFieldIdentifier;
+    size_t originalStateOffset;
+};
+
+}
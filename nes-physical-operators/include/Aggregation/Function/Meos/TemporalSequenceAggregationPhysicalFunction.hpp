@@ -16,14 +16,21 @@
 
 #include <cstddef>
 #include <memory>
+#include <optional>
 #include <Aggregation/Function/AggregationPhysicalFunction.hpp>
-#include <Nautilus/Interface/BufferRef/TupleBufferRef.hpp>
 #include <Nautilus/Interface/Record.hpp>
 #include <val_concepts.hpp>
+#include <MEOSWrapper.hpp>
 
 namespace NES
 {
 
+/// Aggregates lon/lat/timestamp triples into a MEOS trajectory (temporal point with discrete interpolation).
+/// The aggregation state holds the trajectory in its binary MEOS representation, which grows with every lifted record.
+/// Thus, lowering only serializes the trajectory instead of formatting and parsing the text representation of all points.
+/// The result is the trajectory in MEOS extended WKB, which lowering writes directly into the arena.
+/// With a tolerance, lifting simplifies the trajectory online by dead reckoning, c.f., TrajectorySimplifier, thus the state and the result
+/// solely contain the points that deviate by more than the tolerance in meters from the movement predicted by the previous points.
 class TemporalSequenceAggregationPhysicalFunction : public AggregationPhysicalFunction
 {
 public:
@@ -35,7 +42,7 @@ public:
         PhysicalFunction latFunctionParam,
         PhysicalFunction timestampFunctionParam,
         Nautilus::Record::RecordFieldIdentifier resultFieldIdentifier,
-        std::shared_ptr<Nautilus::Interface::BufferRef::TupleBufferRef> bufferRef);
+        std::optional<double> toleranceInMeters = std::nullopt);
     void lift(
         const nautilus::val<AggregationState*>& aggregationState,
         PipelineMemoryProvider& pipelineMemoryProvider,
@@ -52,10 +59,12 @@ public:
     void cleanup(nautilus::val<AggregationState*> aggregationState) override;
 
 private:
-    std::shared_ptr<Nautilus::Interface::BufferRef::TupleBufferRef> bufferRef;
     PhysicalFunction lonFunction;
     PhysicalFunction latFunction;
     PhysicalFunction timestampFunction;
+    std::optional<double> toleranceInMeters;
+    /// Shared by all states and copies of the aggregation, thus the unit of the timestamps is detected once per query
+    std::shared_ptr<MEOS::Meos::EpochConverter> epochConverter = std::make_shared<MEOS::Meos::EpochConverter>();
 };
 
 }
@@ -0,0 +1,48 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <Aggregation/Function/SharedStateAggregationPhysicalFunction.hpp>
+#include <DataTypes/DataType.hpp>
+#include <Functions/PhysicalFunction.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <val_concepts.hpp>
+
+namespace NES
+{
+
+/// Calculates the average from the states of a SUM over the same field and a COUNT of the operator, e.g., AVG(a) next to SUM(a) and
+/// COUNT(b). Thus, the records solely update the sum and the count once instead of a second time for the state of the average.
+class SharedStateAvgAggregationPhysicalFunction final : public SharedStateAggregationPhysicalFunction
+{
+public:
+    SharedStateAvgAggregationPhysicalFunction(
+        DataType inputType,
+        DataType resultType,
+        PhysicalFunction inputFunction,
+        Nautilus::Record::RecordFieldIdentifier resultFieldIdentifier,
+        size_t sumStateOffset,
+        size_t countStateOffset);
+    Nautilus::Record lower(nautilus::val<AggregationState*> aggregationState, PipelineMemoryProvider& pipelineMemoryProvider) override;
+    ~SharedStateAvgAggregationPhysicalFunction() override = default;
+
+private:
+    static constexpr DataType countType = DataType{DataType::Type::UINT64};
+    size_t sumStateOffset;
+    size_t countStateOffset;
+};
+
+}
@@ -0,0 +1,72 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace NES
+{
+
+/// Online trajectory simplification by dead reckoning. The simplifier predicts the position of the next point from the last kept point and
+/// the velocity of the last kept segment, and drops the point, if its distance to the prediction is within the tolerance. Once a point
+/// deviates, the last dropped point ends the segment and the deviating point starts the next one. Thus, a train moving at constant speed
+/// keeps a few points per straight segment, while turns and stops keep their points, and the trajectory deviates approximately by at most
+/// the tolerance from the original one. The simplifier has a fixed size and does not allocate, thus it lives in the aggregation state.
+class TrajectorySimplifier
+{
+public:
+    /// Longitude and latitude in degrees and the timestamp in milliseconds
+    struct Point
+    {
+        double lon;
+        double lat;
+        uint64_t timestamp;
+    };
+
+    /// A new point keeps at most the last dropped point, which ends the current segment, and the new point itself
+    static constexpr size_t MAX_KEPT_POINTS = 2;
+    using KeptPoints = std::array<Point, MAX_KEPT_POINTS>;
+
+    explicit TrajectorySimplifier(double toleranceInMeters);
+
+    /// Writes the points that the trajectory keeps for the new point into `keptPoints` and returns their number.
+    /// The points must arrive in the order of their timestamps.
+    size_t insert(const Point& point, KeptPoints& keptPoints);
+
+    /// The last dropped point ends the trajectory, thus it must be appended before the trajectory is emitted or merged.
+    /// Returns the point, if there is one, and forgets it.
+    [[nodiscard]] std::optional<Point> flush();
+
+    [[nodiscard]] uint64_t getNumberOfDroppedPoints() const;
+
+    /// Equirectangular approximation of the distance in meters, which is precise for the short distances between neighbouring points
+    [[nodiscard]] static double distanceInMeters(const Point& first, const Point& second);
+
+private:
+    double toleranceInMeters;
+    Point anchor{};
+    /// Degrees per millisecond of the last kept segment, a single kept point predicts a stationary object
+    double lonVelocity{0};
+    double latVelocity{0};
+    bool hasAnchor{false};
+    bool hasDroppedPoint{false};
+    Point lastDroppedPoint{};
+    uint64_t numberOfDroppedPoints{0};
+};
+
+}
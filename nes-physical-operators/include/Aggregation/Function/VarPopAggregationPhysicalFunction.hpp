@@ -0,0 +1,68 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <Aggregation/Function/AggregationPhysicalFunction.hpp>
+#include <DataTypes/DataType.hpp>
+#include <Functions/PhysicalFunction.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <val_concepts.hpp>
+
+namespace NES
+{
+
+/// Calculates the population variance of the values in a single pass via the algorithm of Welford. In contrast to summing the squares of
+/// the values, updating the mean and the sum of the squared distances to the mean does not lose precision for large values with a small
+/// variance. The state has a constant size, i.e., [count] [mean] [m2], and two states combine in O(1) via the formula of Chan et al.
+class VarPopAggregationPhysicalFunction : public AggregationPhysicalFunction
+{
+public:
+    VarPopAggregationPhysicalFunction(
+        DataType inputType,
+        DataType resultType,
+        PhysicalFunction inputFunction,
+        Nautilus::Record::RecordFieldIdentifier resultFieldIdentifier);
+    void lift(
+        const nautilus::val<AggregationState*>& aggregationState,
+        PipelineMemoryProvider& pipelineMemoryProvider,
+        const Nautilus::Record& record) override;
+    void combine(
+        nautilus::val<AggregationState*> aggregationState1,
+        nautilus::val<AggregationState*> aggregationState2,
+        PipelineMemoryProvider& pipelineMemoryProvider) override;
+    Nautilus::Record lower(nautilus::val<AggregationState*> aggregationState, PipelineMemoryProvider& pipelineMemoryProvider) override;
+    void reset(nautilus::val<AggregationState*> aggregationState, PipelineMemoryProvider& pipelineMemoryProvider) override;
+    void cleanup(nautilus::val<AggregationState*> aggregationState) override;
+    [[nodiscard]] size_t getSizeOfStateInBytes() const override;
+    ~VarPopAggregationPhysicalFunction() override = default;
+
+protected:
+    /// Returns the population variance of the values in the aggregation state
+    [[nodiscard]] static nautilus::val<double> getVariance(const nautilus::val<AggregationState*>& aggregationState);
+
+private:
+    struct WelfordState
+    {
+        nautilus::val<double> count;
+        nautilus::val<double> mean;
+        nautilus::val<double> m2; /// Sum of the squared distances of the values to their mean
+    };
+
+    static WelfordState readState(const nautilus::val<AggregationState*>& aggregationState);
+    static void writeState(const nautilus::val<AggregationState*>& aggregationState, const WelfordState& state);
+};
+
+}
@@ -13,12 +13,20 @@
 */
 
 #pragma once
+#include <atomic>
+#include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <map>
+#include <memory>
+#include <optional>
 #include <ostream>
+#include <vector>
 #include <Identifiers/Identifiers.hpp>
 #include <Runtime/Execution/OperatorHandler.hpp>
 #include <Runtime/QueryTerminationType.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Time/Timestamp.hpp>
 #include <Util/Logger/Formatter.hpp>
 #include <fmt/base.h>
 #include <fmt/ostream.h>
@@ -49,10 +57,16 @@ struct SequenceState
     uint64_t seenChunks = INVALID_CHUNK_NUMBER.getRawValue();
 };
 
+/// Besides the chunk state of the sequence numbers, the handler stores the buffers of an emit that coalesces invocations, c.f.,
+/// EmitPhysicalOperator. Such an emit writes the records of multiple pipeline invocations of a WorkerThread into the same buffer, until
+/// it is full or its first record waited for the max delay. The handler numbers the coalesced buffers per origin, thus each of them is a
+/// single, last chunk. The delay is checked whenever the pipeline runs. Thus, the records of a pipeline that receives no more buffers wait
+/// until it stops.
 class EmitOperatorHandler final : public OperatorHandler
 {
 public:
     EmitOperatorHandler() = default;
+    explicit EmitOperatorHandler(std::chrono::milliseconds coalescingMaxDelay);
 
     /// Returns the next chunk number belonging to a sequence number for emitting a buffer
     uint64_t getNextChunkNumber(SequenceNumberForOriginId seqNumberOriginId);
@@ -65,11 +79,58 @@ public:
     /// Removes the sequence state in seqNumberOriginIdToChunkStateInput and seqNumberOriginIdToOutputChunkNumber for the seqNumberOriginId
     void removeSequenceState(SequenceNumberForOriginId seqNumberOriginId);
 
+    /// Creates a coalesced buffer per WorkerThread
+    void setupCoalescing(size_t numberOfWorkerThreads);
+
+    /// Returns the buffer, into which the emit writes the records of the current invocation. It contains the records of previous
+    /// invocations of the WorkerThread, if they had the same origin. Otherwise, the handler emits them first.
+    TupleBuffer* acquireCoalescedBuffer(PipelineExecutionContext& pipelineExecutionContext, OriginId originId);
+
+    /// Emits the acquired buffer, if it is full or its first record waited for the max delay, and emits the buffers of other WorkerThreads
+    /// that waited for the max delay. Otherwise, it keeps the buffer for the next invocation.
+    void releaseCoalescedBuffer(
+        PipelineExecutionContext& pipelineExecutionContext,
+        TupleBuffer* buffer,
+        uint64_t numberOfRecords,
+        OriginId originId,
+        Timestamp watermarkTs,
+        Timestamp creationTs,
+        Timestamp latestCreationTs,
+        bool isFull);
+
+    /// Emits the records that the coalesced buffers still hold, once the pipeline stops
+    void flushCoalescedBuffers(PipelineExecutionContext& pipelineExecutionContext);
+
     void start(PipelineExecutionContext& pipelineExecutionContext, uint32_t localStateVariableId) override;
     void stop(QueryTerminationType terminationType, PipelineExecutionContext& pipelineExecutionContext) override;
 
     folly::Synchronized<std::map<SequenceNumberForOriginId, SequenceState>> seqNumberOriginIdToChunkStateInput;
     folly::Synchronized<std::map<SequenceNumberForOriginId, ChunkNumber::Underlying>> seqNumberOriginIdToOutputChunkNumber;
+
+private:
+    /// The buffer of a WorkerThread. A thread of the background compilation may share it with a WorkerThread, thus the flag guards it.
+    struct CoalescedBuffer
+    {
+        std::atomic_flag isUsed;
+        TupleBuffer buffer;
+        bool isAllocated{false};
+        OriginId originId = INVALID_ORIGIN_ID;
+        Timestamp watermarkTs = Timestamp(Timestamp::INITIAL_VALUE);
+        /// The records of several invocations span the creation timestamps of their input buffers
+        Timestamp creationTs = Timestamp(Timestamp::INITIAL_VALUE);
+        Timestamp latestCreationTs = Timestamp(Timestamp::INITIAL_VALUE);
+        std::optional<std::chrono::steady_clock::time_point> firstRecordArrival;
+    };
+
+    void emitCoalescedBuffer(PipelineExecutionContext& pipelineExecutionContext, CoalescedBuffer& coalescedBuffer);
+    void emitExpiredBuffers(PipelineExecutionContext& pipelineExecutionContext, std::chrono::steady_clock::time_point now);
+
+    std::chrono::milliseconds coalescingMaxDelay{0};
+    std::vector<std::unique_ptr<CoalescedBuffer>> coalescedBuffers;
+    /// Sequence numbers of the coalesced buffers per origin
+    folly::Synchronized<std::map<OriginId, SequenceNumber::Underlying>> originIdToOutputSequenceNumber;
+    std::atomic<uint64_t> numberOfCoalescedInvocations{0};
+    std::atomic<uint64_t> numberOfCoalescedBuffers{0};
 };
 }
 
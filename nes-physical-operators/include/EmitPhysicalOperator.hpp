@@ -17,6 +17,7 @@
 #include <cstdint>
 #include <memory>
 #include <optional>
+#include <MemoryLayout/MemoryLayout.hpp>
 #include <Nautilus/Interface/BufferRef/TupleBufferRef.hpp>
 #include <Nautilus/Interface/Record.hpp>
 #include <Nautilus/Interface/RecordBuffer.hpp>
@@ -31,14 +32,25 @@ namespace NES
 
 /// @brief Basic emit operator that receives records from an upstream operator and
 /// writes them to a tuple buffer according to a memory layout.
+/// If it coalesces invocations, it writes the records of multiple pipeline invocations of a WorkerThread into the same buffer, which the
+/// EmitOperatorHandler emits once it is full or its first record waited for the max delay. This avoids many sparse buffers, if a pipeline,
+/// e.g., a selective filter, emits few records per input buffer. As the coalesced buffers do not keep the sequence numbers of the input,
+/// solely emits that feed a sink coalesce invocations.
+/// If it reuses input buffers, it writes the records into the input buffer of the invocation instead of a new buffer, while the pipeline
+/// holds the only reference to the input buffer. The pipeline has to read each input record before the emit writes any record at or
+/// behind its position, e.g., a chain of maps and selections over row-wise buffers, whose output records do not exceed the input records.
 class EmitPhysicalOperator final : public PhysicalOperatorConcept
 {
 public:
-    explicit EmitPhysicalOperator(OperatorHandlerId operatorHandlerId, std::shared_ptr<Interface::BufferRef::TupleBufferRef> bufferRef);
+    explicit EmitPhysicalOperator(
+        OperatorHandlerId operatorHandlerId,
+        std::shared_ptr<Interface::BufferRef::TupleBufferRef> bufferRef,
+        bool coalescesInvocations = false,
+        bool reusesInputBuffers = false);
 
-    void setup(ExecutionContext&, CompilationContext&) const override { /*noop*/ }
+    void setup(ExecutionContext& ctx, CompilationContext& compilationContext) const override;
 
-    void terminate(ExecutionContext&) const override { /*noop*/ }
+    void terminate(ExecutionContext& ctx) const override;
 
     void open(ExecutionContext& ctx, RecordBuffer& recordBuffer) const override;
     void execute(ExecutionContext& ctx, Record& record) const override;
@@ -52,12 +64,24 @@ public:
     [[nodiscard]] std::optional<PhysicalOperator> getChild() const override;
     void setChild(PhysicalOperator child) override;
 
+    /// Memory layout of the buffers the emit writes, i.e., the layout that the consumer of the output buffers reads
+    [[nodiscard]] std::shared_ptr<MemoryLayout> getMemoryLayout() const;
+    [[nodiscard]] bool coalescesInvocationsOfWorkerThreads() const;
+    [[nodiscard]] bool reusesExclusiveInputBuffers() const;
+
 private:
     [[nodiscard]] uint64_t getMaxRecordsPerBuffer() const;
+    void releaseCoalescedBuffer(
+        ExecutionContext& ctx,
+        RecordBuffer& recordBuffer,
+        const nautilus::val<uint64_t>& numRecords,
+        const nautilus::val<bool>& isFull) const;
 
     std::optional<PhysicalOperator> child;
     std::shared_ptr<Interface::BufferRef::TupleBufferRef> bufferRef;
     OperatorHandlerId operatorHandlerId;
+    bool coalescesInvocations;
+    bool reusesInputBuffers;
 };
 
 }
@@ -0,0 +1,43 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <memory>
+#include <Nautilus/Interface/BufferRef/TupleBufferRef.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <Runtime/Execution/OperatorHandler.hpp>
+#include <Watermark/TimeFunction.hpp>
+#include <ExecutionContext.hpp>
+#include <WindowBuildPhysicalOperator.hpp>
+
+namespace NES
+{
+
+/// This class is the first phase of the event time sort. Each worker thread appends the records to the PagedVector of the slice that
+/// contains their timestamp. Afterward, the second phase (EventTimeSortProbe) sorts and emits the records of a slice.
+class EventTimeSortBuildPhysicalOperator final : public WindowBuildPhysicalOperator
+{
+public:
+    EventTimeSortBuildPhysicalOperator(
+        OperatorHandlerId operatorHandlerId,
+        std::unique_ptr<TimeFunction> timeFunction,
+        std::shared_ptr<Interface::BufferRef::TupleBufferRef> bufferRef);
+
+    void execute(ExecutionContext& executionCtx, Record& record) const override;
+
+private:
+    std::shared_ptr<Interface::BufferRef::TupleBufferRef> bufferRef;
+};
+}
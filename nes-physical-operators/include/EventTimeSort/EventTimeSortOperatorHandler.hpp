@@ -0,0 +1,57 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
+#include <Runtime/Execution/OperatorHandler.hpp>
+#include <SliceStore/Slice.hpp>
+#include <SliceStore/WindowSlicesStoreInterface.hpp>
+#include <PipelineExecutionContext.hpp>
+#include <WindowBasedOperatorHandler.hpp>
+
+namespace NES
+{
+/// This task models the information for triggering the sort of a reorder interval
+struct EmittedEventTimeSortTrigger
+{
+    EmittedEventTimeSortTrigger(const WindowInfo& windowInfo, const SliceEnd sliceEnd) : sliceEnd(sliceEnd), windowInfo(windowInfo) { }
+
+    SliceEnd sliceEnd;
+    WindowInfo windowInfo;
+};
+
+/// The event time sort treats each reorder interval as a tumbling window of a single slice. Once the global watermark has passed a slice,
+/// the handler emits the slice to the probe, which sorts and emits its records. The sequence numbers of the windows order the intervals.
+class EventTimeSortOperatorHandler final : public WindowBasedOperatorHandler
+{
+public:
+    EventTimeSortOperatorHandler(
+        const std::vector<OriginId>& inputOrigins,
+        OriginId outputOriginId,
+        std::unique_ptr<WindowSlicesStoreInterface> sliceAndWindowStore);
+
+    [[nodiscard]] std::function<std::vector<std::shared_ptr<Slice>>(SliceStart, SliceEnd)>
+    getCreateNewSlicesFunction(const CreateNewSlicesArguments&) const override;
+
+private:
+    void triggerSlices(
+        const std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>>& slicesAndWindowInfo,
+        PipelineExecutionContext* pipelineCtx) override;
+};
+}
@@ -0,0 +1,48 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <Nautilus/Interface/BufferRef/TupleBufferRef.hpp>
+#include <Nautilus/Interface/RecordBuffer.hpp>
+#include <Runtime/Execution/OperatorHandler.hpp>
+#include <Watermark/TimeFunction.hpp>
+#include <ExecutionContext.hpp>
+#include <WindowProbePhysicalOperator.hpp>
+
+namespace NES
+{
+
+/// This class is the second phase of the event time sort. It reads the timestamps of all records of a slice, sorts the positions of the
+/// records by their timestamps, and then reads and emits the records in this order.
+class EventTimeSortProbePhysicalOperator final : public WindowProbePhysicalOperator
+{
+public:
+    /// @param timestampFieldName is the field, which the time function reads, so that the first pass over the records reads solely it
+    EventTimeSortProbePhysicalOperator(
+        OperatorHandlerId operatorHandlerId,
+        EventTimeFunction timeFunction,
+        std::string timestampFieldName,
+        std::shared_ptr<Interface::BufferRef::TupleBufferRef> bufferRef);
+
+    void open(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const override;
+
+private:
+    EventTimeFunction timeFunction;
+    std::string timestampFieldName;
+    std::shared_ptr<Interface::BufferRef::TupleBufferRef> bufferRef;
+};
+}
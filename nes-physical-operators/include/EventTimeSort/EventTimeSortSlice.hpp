@@ -0,0 +1,72 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
+#include <Nautilus/Interface/PagedVector/PagedVector.hpp>
+#include <Runtime/AbstractBufferProvider.hpp>
+#include <SliceStore/Slice.hpp>
+#include <Time/Timestamp.hpp>
+
+namespace NES
+{
+
+/// Buffers the records of one reorder interval for the event time sort. Each worker thread appends the records in their arrival order to
+/// a PagedVector of its own. Once the watermark has passed the slice, the probe combines the PagedVectors and sorts the positions of all
+/// records by their timestamps, c.f., sortByTimestamp().
+class EventTimeSortSlice final : public Slice
+{
+public:
+    /// A slice with fewer records than milliseconds divided by this factor uses a comparison sort instead of the counting sort
+    static constexpr uint64_t COUNTING_SORT_MAX_MS_PER_RECORD = 4;
+
+    EventTimeSortSlice(SliceStart sliceStart, SliceEnd sliceEnd, uint64_t numberOfWorkerThreads);
+
+    [[nodiscard]] uint64_t getNumberOfTuples() const;
+    [[nodiscard]] Nautilus::Interface::PagedVector* getPagedVectorRef(WorkerThreadId workerThreadId) const;
+
+    /// Moves all tuples in this slice to the PagedVector at 0th index
+    void combinePagedVectors();
+
+    /// The probe adds the timestamp of each record of the combined PagedVector, sorts them, and reads the records by their sorted
+    /// positions.
+    /// As each slice is the only slice of its window, a single probe accesses the sort keys.
+    void addSortKey(Timestamp timestamp, uint64_t position);
+    /// Sorts stably, thus records with the same timestamp keep their order within the PagedVector of a worker thread. As all timestamps lie
+    /// within the slice, a counting sort over the milliseconds of the slice sorts in linear time, unless the slice spans many more
+    /// milliseconds than it holds records, c.f., COUNTING_SORT_MAX_MS_PER_RECORD.
+    void sortByTimestamp();
+    [[nodiscard]] uint64_t getSortedPosition(uint64_t index) const;
+
+    [[nodiscard]] uint64_t getStateSizeInBytes() const override;
+    /// Spills the pages of all PagedVectors into one file. PagedVectors with variable sized data stay in memory.
+    uint64_t spillState(const std::filesystem::path& spillDirectory) override;
+    void reloadState(AbstractBufferProvider* bufferProvider) override;
+
+private:
+    std::vector<std::unique_ptr<Nautilus::Interface::PagedVector>> pagedVectors;
+    std::vector<std::pair<Timestamp::Underlying, uint64_t>> sortKeys;
+    std::mutex combinePagedVectorsMutex;
+    std::mutex spillMutex;
+    SpillFile spillFile{nullptr, &std::fclose};
+};
+}
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <vector>
 #include <Functions/PhysicalFunction.hpp>
 #include <Nautilus/DataTypes/VarVal.hpp>
 #include <Nautilus/Interface/Record.hpp>
@@ -22,15 +23,20 @@
 namespace NES
 {
 
+/// Concatenates variable sized data. Nested concatenations, e.g., CONCAT(a, CONCAT(b, c)), are flattened into a single concatenation of
+/// all their operands, which allocates the result once and copies every operand directly to its position in the result, instead of
+/// allocating and copying an intermediate result per nested concatenation.
 class ConcatPhysicalFunction final : public PhysicalFunctionConcept
 {
 public:
-    ConcatPhysicalFunction(PhysicalFunction leftPhysicalFunction, PhysicalFunction rightPhysicalFunction);
+    ConcatPhysicalFunction(const PhysicalFunction& leftPhysicalFunction, const PhysicalFunction& rightPhysicalFunction);
     [[nodiscard]] VarVal execute(const Record& record, ArenaRef& arena) const override;
 
 private:
-    PhysicalFunction leftPhysicalFunction;
-    PhysicalFunction rightPhysicalFunction;
+    void addOperand(const PhysicalFunction& operand);
+
+    /// Operands in the order of the concatenation, none of them is a concatenation itself
+    std::vector<PhysicalFunction> operands;
 };
 
 }
@@ -17,6 +17,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <string_view>
 #include <vector>
 #include <Functions/PhysicalFunction.hpp>
 #include <Nautilus/DataTypes/VarVal.hpp>
@@ -33,6 +34,9 @@ public:
     explicit ConstantValueVariableSizePhysicalFunction(const int8_t* value, size_t size);
     [[nodiscard]] VarVal execute(const Record& record, ArenaRef& arena) const override;
 
+    /// Returns the constant value without its size prefix, which allows to pre-process the constant when lowering the query
+    [[nodiscard]] std::string_view getValue() const;
+
 private:
     std::vector<int8_t> data;
 };
@@ -27,6 +27,8 @@ public:
     explicit FieldAccessPhysicalFunction(Record::RecordFieldIdentifier field);
     [[nodiscard]] VarVal execute(const Record& record, ArenaRef& arena) const override;
 
+    [[nodiscard]] const Record::RecordFieldIdentifier& getField() const;
+
 private:
     const Record::RecordFieldIdentifier field;
 };
@@ -14,9 +14,14 @@
 
 #pragma once
 
+#include <string>
+#include <utility>
+#include <vector>
+#include <DataTypes/DataType.hpp>
 #include <Functions/ConstantValueLogicalFunction.hpp>
 #include <Functions/LogicalFunction.hpp>
 #include <Functions/PhysicalFunction.hpp>
+#include <Functions/QueryParameterLogicalFunction.hpp>
 
 namespace NES::QueryCompilation
 {
@@ -27,8 +32,20 @@ public:
     /// NodeFunction a NodeFunctionConstantValue, FieldAccessLogicalFunction or FieldAssignment
     static PhysicalFunction lowerFunction(LogicalFunction logicalFunction);
 
+    /// A function and the field of the record, which an earlier operator of the pipeline wrote its result to
+    using ComputedField = std::pair<LogicalFunction, std::string>;
+    /// Lowers the function, but reads the computed fields instead of recomputing sub-functions that are equal to their functions.
+    /// Thus, e.g., a projection computes a repeated sub-expression, such as an expensive MEOS function, once per record.
+    /// Comparisons of different numeric types compare operands that the lowering already converted to their common type.
+    static PhysicalFunction lowerFunction(LogicalFunction logicalFunction, const std::vector<ComputedField>& computedFields);
+
 private:
     static PhysicalFunction lowerConstantFunction(const ConstantValueLogicalFunction& nodeFunction);
+    /// Reads the parameter of the query that is lowered on the calling thread, c.f., QueryParameters::Scope
+    static PhysicalFunction lowerQueryParameterFunction(const QueryParameterLogicalFunction& parameterFunction);
+    /// Lowers the operand of a comparison, such that it returns values of the given type
+    static PhysicalFunction
+    lowerComparisonOperand(const LogicalFunction& operand, DataType::Type type, const std::vector<ComputedField>& computedFields);
 };
 
 }
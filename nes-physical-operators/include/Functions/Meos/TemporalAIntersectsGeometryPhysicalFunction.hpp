@@ -1,8 +1,10 @@
 #pragma once
 
+#include <memory>
 #include <Functions/PhysicalFunction.hpp>
 #include <Nautilus/DataTypes/VarVal.hpp>
 #include <Nautilus/Interface/Record.hpp>
+#include <MEOSWrapper.hpp>
 
 namespace NES {
 
@@ -20,7 +22,11 @@ public:
 private:
     std::vector<PhysicalFunction> parameterFunctions;  // Stores 4 or 6 parameter functions
     bool isTemporal6Param;  // true for 6-param temporal-temporal, false for 4-param temporal-static
-    
+    // Set if the static geometry is a constant, e.g., a set of geofences in the query text. Built once when creating the function.
+    std::shared_ptr<const MEOS::Meos::GeofenceIndex> constantGeofences;
+    // Shared by the copies of the function, thus the unit of the timestamps is detected once per query
+    std::shared_ptr<MEOS::Meos::EpochConverter> epochConverter = std::make_shared<MEOS::Meos::EpochConverter>();
+
     // Helper methods for different parameter cases
     VarVal executeTemporal6Param(const std::vector<VarVal>& params) const;
     VarVal executeTemporal4Param(const std::vector<VarVal>& params) const;
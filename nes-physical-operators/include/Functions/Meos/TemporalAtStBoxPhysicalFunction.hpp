@@ -1,8 +1,10 @@
 #pragma once
 
+#include <memory>
 #include <Functions/PhysicalFunction.hpp>
 #include <Nautilus/DataTypes/VarVal.hpp>
 #include <Nautilus/Interface/Record.hpp>
+#include <MEOSWrapper.hpp>
 
 namespace NES {
 
@@ -24,6 +26,8 @@ public:
 private:
     std::vector<PhysicalFunction> parameterFunctions;
     bool hasBorderParam;
+    /// Shared by the copies of the function, thus the unit of the timestamps is detected once per query
+    std::shared_ptr<MEOS::Meos::EpochConverter> epochConverter = std::make_shared<MEOS::Meos::EpochConverter>();
 };
 
 }
@@ -1,6 +1,8 @@
 #pragma once
 #include <Functions/PhysicalFunction.hpp>
+#include <memory>
 #include <vector>
+#include <MEOSWrapper.hpp>
 
 namespace NES {
 
@@ -25,10 +27,15 @@ public:
 
 private:
     std::vector<PhysicalFunction> paramFns;
+    /* set if the static geometry is a constant, e.g., a set of geofences in the query text */
+    std::shared_ptr<const MEOS::Meos::GeofenceIndex> constantGeofences;
+    /* shared by the copies of the function, thus the unit of the timestamps is detected once per query */
+    std::shared_ptr<MEOS::Meos::EpochConverter> epochConverter = std::make_shared<MEOS::Meos::EpochConverter>();
 
     VarVal execTemporalStatic (const std::vector<VarVal>&) const;
     VarVal execStaticTemporal (const std::vector<VarVal>&) const;
     VarVal execTemporalTemporal(const std::vector<VarVal>&) const;
+    VarVal execConstantGeofences(const VarVal& lon, const VarVal& lat, const VarVal& ts, bool geofenceFirst) const;
 };
 
 } // namespace NES
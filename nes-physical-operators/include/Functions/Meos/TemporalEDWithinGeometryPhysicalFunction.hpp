@@ -1,8 +1,12 @@
 #pragma once
 
+#include <memory>
+#include <optional>
+#include <vector>
 #include <Functions/PhysicalFunction.hpp>
 #include <Nautilus/DataTypes/VarVal.hpp>
 #include <Nautilus/Interface/Record.hpp>
+#include <MEOSWrapper.hpp>
 
 namespace NES {
 
@@ -14,10 +18,26 @@ public:
                                              PhysicalFunction geometryFunction,
                                              PhysicalFunction distanceFunction);
 
+    /// Point-to-point variant, which checks the temporal point (lon1, lat1, timestamp1) against the point (lon2, lat2)
+    TemporalEDWithinGeometryPhysicalFunction(PhysicalFunction lon1Function,
+                                             PhysicalFunction lat1Function,
+                                             PhysicalFunction timestamp1Function,
+                                             PhysicalFunction lon2Function,
+                                             PhysicalFunction lat2Function,
+                                             PhysicalFunction distanceFunction);
+
     VarVal execute(const Record& record, ArenaRef& arena) const override;
 
 private:
+    VarVal executePointToPoint(const std::vector<VarVal>& parameterValues) const;
+
     std::vector<PhysicalFunction> parameterFunctions;
+    /// Set if the static geometry is a constant of the query. We parse it once when creating the function.
+    std::shared_ptr<const MEOS::Meos::StaticGeometry> constantStaticGeometry;
+    /// Bounding box of the constant static geometry. Points further away from it than the distance can not be within the distance.
+    std::optional<MEOS::Meos::BoundingBox> constantBoundingBox;
+    /// Shared by the copies of the function, thus the unit of the timestamps is detected once per query
+    std::shared_ptr<MEOS::Meos::EpochConverter> epochConverter = std::make_shared<MEOS::Meos::EpochConverter>();
 };
 
 }
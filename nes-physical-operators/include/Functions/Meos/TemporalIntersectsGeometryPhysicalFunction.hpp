@@ -1,9 +1,12 @@
 
 #pragma once
 
+#include <memory>
+#include <optional>
 #include <Functions/PhysicalFunction.hpp>
 #include <Nautilus/DataTypes/VarVal.hpp>
 #include <Nautilus/Interface/Record.hpp>
+#include <MEOSWrapper.hpp>
 
 namespace NES {
 
@@ -21,7 +24,13 @@ public:
 private:
     std::vector<PhysicalFunction> parameterFunctions;  // Stores 4 or 6 parameter functions
     bool isTemporal6Param;  // true for 6-param temporal-temporal, false for 4-param temporal-static
-    
+    /// If the static geometry is a constant of the query, we parse it once when creating the function and share it for all records
+    std::shared_ptr<const MEOS::Meos::StaticGeometry> constantStaticGeometry;
+    /// Bounding box of the constant static geometry. Points outside of it can not intersect the geometry.
+    std::optional<MEOS::Meos::BoundingBox> constantBoundingBox;
+    /// Shared by the copies of the function, thus the unit of the timestamps is detected once per query
+    std::shared_ptr<MEOS::Meos::EpochConverter> epochConverter = std::make_shared<MEOS::Meos::EpochConverter>();
+
     // Helper methods for different parameter cases
     VarVal executeTemporal6Param(const std::vector<VarVal>& params) const;
     VarVal executeTemporal4Param(const std::vector<VarVal>& params) const;
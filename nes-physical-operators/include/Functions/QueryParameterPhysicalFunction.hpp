@@ -0,0 +1,49 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <Functions/PhysicalFunction.hpp>
+#include <Functions/QueryParameters.hpp>
+#include <Nautilus/DataTypes/VarVal.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <ExecutionContext.hpp>
+#include <function.hpp>
+
+namespace NES
+{
+
+/// Reads the current value of a query parameter, instead of returning a constant that is baked into the compiled code
+template <typename T>
+requires std::is_integral_v<T> || std::is_floating_point_v<T>
+class QueryParameterPhysicalFunction final : public PhysicalFunctionConcept
+{
+public:
+    explicit QueryParameterPhysicalFunction(std::shared_ptr<const QueryParameter> parameter) : parameter(std::move(parameter)) { }
+
+    VarVal execute(const Record&, ArenaRef&) const override
+    {
+        return VarVal(nautilus::invoke(
+            +[](const QueryParameter* parameter) { return parameter->get<T>(); },
+            nautilus::val<const QueryParameter*>(parameter.get())));
+    }
+
+private:
+    std::shared_ptr<const QueryParameter> parameter;
+};
+
+}
@@ -0,0 +1,103 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <DataTypes/DataType.hpp>
+
+namespace NES
+{
+
+/// The current value of a query parameter, c.f., QueryParameterLogicalFunction. The compiled code reads the value for every record,
+/// instead of baking it into the code, thus an update applies to the running query without recompiling it.
+class QueryParameter
+{
+public:
+    /// @throw InvalidQueryParameter if the value cannot be parsed as the type, or the type is not a fixed-size type
+    QueryParameter(std::string name, DataType::Type type, std::string_view value);
+
+    [[nodiscard]] const std::string& getName() const;
+    [[nodiscard]] DataType::Type getType() const;
+
+    /// Returns the bytes of the value parsed as the type of the parameter
+    /// @throw InvalidQueryParameter if the value cannot be parsed
+    [[nodiscard]] uint64_t parse(std::string_view value) const;
+    /// Publishes the bytes of a parsed value. Records, which the WorkerThreads process concurrently, observe either value.
+    void store(uint64_t bytes);
+
+    template <typename T>
+    requires(std::is_arithmetic_v<T> and sizeof(T) <= sizeof(uint64_t))
+    [[nodiscard]] T get() const
+    {
+        const auto bytes = value.load(std::memory_order_relaxed);
+        T result;
+        std::memcpy(&result, &bytes, sizeof(T));
+        return result;
+    }
+
+private:
+    std::string name;
+    DataType::Type type;
+    /// The value of the parameter's type in the leading bytes, as every fixed-size type fits into 64 bits
+    std::atomic<uint64_t> value{0};
+};
+
+/// The parameters of a query by their name
+class QueryParameters
+{
+public:
+    /// Collects the parameters that the lowering of a query on the calling thread creates, c.f., FunctionProvider.
+    /// The optimizer lowers a query as a pure function, thus the parameters are not threaded through every lowering rule.
+    class Scope
+    {
+    public:
+        explicit Scope(QueryParameters& parameters);
+        ~Scope();
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+        Scope(Scope&&) = delete;
+        Scope& operator=(Scope&&) = delete;
+
+    private:
+        QueryParameters* previous;
+    };
+
+    /// Returns the parameters of the query that is lowered on the calling thread, or nullptr outside a Scope
+    [[nodiscard]] static QueryParameters* current();
+
+    /// Returns the parameter with the name, respectively creates it with the default value
+    /// @throw InvalidQueryParameter if the parameter exists with a different type
+    std::shared_ptr<QueryParameter> getOrCreate(const std::string& name, DataType::Type type, std::string_view defaultValue);
+
+    /// Applies either all or none of the values, e.g., if the query has no parameter with one of the names or a value cannot be parsed.
+    /// @throw InvalidQueryParameter
+    void update(const std::unordered_map<std::string, std::string>& values);
+
+    [[nodiscard]] bool empty() const;
+
+private:
+    mutable std::mutex mutex;
+    std::unordered_map<std::string, std::shared_ptr<QueryParameter>> parameters;
+};
+
+}
@@ -0,0 +1,56 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include <Functions/PhysicalFunction.hpp>
+#include <Nautilus/DataTypes/VarVal.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <ExecutionContext.hpp>
+#include <val.hpp>
+
+namespace NES
+{
+
+/// Computes the integer geohash of (lon, lat) with `precision` characters, i.e., 5 * precision bits.
+/// The coordinates are FLOAT64 degrees, the logical function casts other numeric types and validates the UINT64 precision.
+/// In contrast to the bisection of the textual geohash, the cells are quantized by a multiplication and the bits are interleaved by
+/// shifts and masks. Thus, the function is traced arithmetic without any call, which the compiler inlines into the pipeline.
+class GeohashPhysicalFunction final : public PhysicalFunctionConcept
+{
+public:
+    GeohashPhysicalFunction(PhysicalFunction lonFunction, PhysicalFunction latFunction, PhysicalFunction precisionFunction);
+    [[nodiscard]] VarVal execute(const Record& record, ArenaRef& arena) const override;
+
+    /// Number of bits of the longitude and of the latitude cell of a geohash with a precision. The longitude has the extra bit of odd
+    /// numbers of bits.
+    [[nodiscard]] static std::pair<nautilus::val<uint64_t>, nautilus::val<uint64_t>>
+    getNumberOfBits(const nautilus::val<uint64_t>& precision);
+
+    /// Interleaves the cells starting with the most significant bit of the longitude cell
+    [[nodiscard]] static nautilus::val<uint64_t>
+    interleave(const nautilus::val<uint64_t>& lonCell, const nautilus::val<uint64_t>& latCell, const nautilus::val<uint64_t>& precision);
+
+    /// Splits a geohash into its longitude and its latitude cell
+    [[nodiscard]] static std::pair<nautilus::val<uint64_t>, nautilus::val<uint64_t>>
+    deinterleave(const nautilus::val<uint64_t>& geohash, const nautilus::val<uint64_t>& precision);
+
+private:
+    std::vector<PhysicalFunction> parameterFunctions;
+};
+
+}
@@ -0,0 +1,43 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+
+#pragma once
+
+#include <vector>
+#include <Functions/PhysicalFunction.hpp>
+#include <Nautilus/DataTypes/VarVal.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <ExecutionContext.hpp>
+
+namespace NES
+{
+
+/// Computes the great-circle distance in meters between (lon1, lat1) and (lon2, lat2) via the haversine formula.
+/// All coordinates are FLOAT64 degrees, the logical function casts other numeric types.
+class HaversineDistancePhysicalFunction final : public PhysicalFunctionConcept
+{
+public:
+    /// Mean earth radius in meters, as defined by the IUGG
+    static constexpr double EARTH_RADIUS = 6371008.8;
+
+    HaversineDistancePhysicalFunction(
+        PhysicalFunction lon1Function, PhysicalFunction lat1Function, PhysicalFunction lon2Function, PhysicalFunction lat2Function);
+    [[nodiscard]] VarVal execute(const Record& record, ArenaRef& arena) const override;
+
+private:
+    std::vector<PhysicalFunction> parameterFunctions;
+};
+
+}
@@ -0,0 +1,45 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+
+#pragma once
+
+#include <vector>
+#include <Functions/PhysicalFunction.hpp>
+#include <Nautilus/DataTypes/VarVal.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <ExecutionContext.hpp>
+
+namespace NES
+{
+
+/// Performs xmin <= lon <= xmax and ymin <= lat <= ymax. As the function consists only of comparisons, it is fully traced and
+/// the compiler can inline it into the pipeline.
+class PointInBBoxPhysicalFunction final : public PhysicalFunctionConcept
+{
+public:
+    PointInBBoxPhysicalFunction(
+        PhysicalFunction lonFunction,
+        PhysicalFunction latFunction,
+        PhysicalFunction xminFunction,
+        PhysicalFunction yminFunction,
+        PhysicalFunction xmaxFunction,
+        PhysicalFunction ymaxFunction);
+    [[nodiscard]] VarVal execute(const Record& record, ArenaRef& arena) const override;
+
+private:
+    std::vector<PhysicalFunction> parameterFunctions;
+};
+
+}
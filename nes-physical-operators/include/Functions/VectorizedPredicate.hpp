@@ -0,0 +1,124 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+#include <DataTypes/DataType.hpp>
+#include <Functions/LogicalFunction.hpp>
+#include <MemoryLayout/MemoryLayout.hpp>
+
+namespace NES
+{
+
+/// Predicate that is evaluated over all tuples of a buffer at once, instead of record-at-a-time in traced code.
+/// The predicate consists of comparisons between a fixed-size numeric field and a constant, combined via AND, OR, and NOT.
+/// Evaluating a whole column chunk in a tight loop allows the compiler to vectorize the comparisons for the SIMD instructions of the target.
+class VectorizedPredicate
+{
+public:
+    /// Number of tuples that we evaluate at once. Small chunks keep the intermediate selection masks in the L1 cache.
+    static constexpr size_t CHUNK_SIZE = 1024;
+
+    enum class ComparisonType : uint8_t
+    {
+        EQUALS,
+        LESS,
+        LESS_EQUALS,
+        GREATER,
+        GREATER_EQUALS
+    };
+
+    /// Both operands of a comparison are widened to a type that represents the values of both, e.g., int32 and int8 to int64.
+    using Constant = std::variant<int64_t, uint64_t, double>;
+
+    struct Comparison
+    {
+        std::string fieldName;
+        ComparisonType comparison;
+        Constant constant;
+    };
+
+    /// Returns nullopt if the predicate contains functions that we can not vectorize. The predicate must then be evaluated per record.
+    static std::optional<VectorizedPredicate> create(const LogicalFunction& predicate);
+
+    /// Resolves the accessed fields to their positions in buffers of the given memory layout.
+    /// Returns nullopt if a field is not part of the layout or if the types of a field and its constant do not allow vectorization.
+    [[nodiscard]] std::optional<VectorizedPredicate> bind(const MemoryLayout& memoryLayout) const;
+
+    /// Evaluates the bound predicate for the first 'numberOfTuples' tuples in the buffer. Writes the indexes of all qualifying tuples
+    /// to the selection vector, which must have space for 'numberOfTuples' indexes.
+    /// @return number of qualifying tuples
+    uint64_t evaluate(const int8_t* buffer, uint64_t numberOfTuples, uint64_t* selectionVector) const;
+
+    /// Evaluates the bound predicate solely for the tuples in the selection vector, e.g., the qualifying tuples of a preceding predicate.
+    /// Removes the indexes of all tuples that do not qualify from the selection vector, keeping the order of the remaining indexes.
+    /// @return number of remaining tuples
+    uint64_t refine(const int8_t* buffer, uint64_t* selectionVector, uint64_t numberOfSelectedTuples) const;
+
+    /// Comparisons that every qualifying tuple satisfies, i.e., the comparisons that solely ANDs connect to the root of the predicate.
+    /// The constants of a bound predicate are widened to the types of their fields.
+    [[nodiscard]] std::vector<Comparison> getConjunctiveComparisons() const;
+
+private:
+    struct Node
+    {
+        enum class Type : uint8_t
+        {
+            COMPARISON,
+            AND,
+            OR,
+            NEGATE
+        };
+
+        Type type;
+        /// Indexes of the child nodes in 'nodes'
+        std::vector<size_t> children;
+
+        /// Only set for comparisons
+        ComparisonType comparison = ComparisonType::EQUALS;
+        std::string fieldName;
+        Constant constant;
+
+        /// Set by bind(). Offset of the field of the first tuple and the distance between the fields of consecutive tuples.
+        DataType::Type fieldType = DataType::Type::UNDEFINED;
+        uint64_t offset = 0;
+        uint64_t stride = 0;
+    };
+
+    explicit VectorizedPredicate(std::vector<Node> nodes) : nodes(std::move(nodes)) { }
+
+    static std::optional<size_t> addNode(const LogicalFunction& function, std::vector<Node>& nodes);
+    /// Evaluates the tuples [firstTuple, firstTuple + numberOfTuples), or the tuples at these positions of 'tupleIndexes', if it is set
+    void evaluateNode(
+        size_t nodeIndex,
+        const int8_t* buffer,
+        uint64_t firstTuple,
+        size_t numberOfTuples,
+        const uint64_t* tupleIndexes,
+        uint8_t* mask) const;
+
+    /// Children precede their parents, thus the last node is the root of the predicate
+    std::vector<Node> nodes;
+    bool bound = false;
+};
+
+}
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <bit>
 #include <cstdint>
 #include <functional>
 #include <memory>
@@ -21,10 +22,17 @@
 #include <utility>
 #include <vector>
 #include <Functions/PhysicalFunction.hpp>
+#include <Nautilus/DataTypes/VarVal.hpp>
 #include <Nautilus/Interface/Hash/HashFunction.hpp>
 #include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedEntryMemoryProvider.hpp>
+#include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMapRef.hpp>
 #include <Nautilus/Interface/HashMap/HashMap.hpp>
+#include <Nautilus/Interface/HashMap/OpenAddressingHashMap/OpenAddressingHashMapRef.hpp>
+#include <Nautilus/Interface/Record.hpp>
 #include <ErrorHandling.hpp>
+#include <static.hpp>
+#include <val.hpp>
+#include <val_ptr.hpp>
 
 namespace NES
 {
@@ -32,6 +40,9 @@ namespace NES
 /// Stores members that are needed for both phases of the aggregation, build and probe
 struct HashMapOptions
 {
+    /// Upper bound for the number of radix partitions of the hash maps of a slice, c.f., getPartition()
+    static constexpr uint64_t MAX_NUMBER_OF_PARTITIONS = 1024;
+
     HashMapOptions(
         std::unique_ptr<Nautilus::Interface::HashFunction> hashFunction,
         std::vector<PhysicalFunction> keyFunctions,
@@ -42,7 +53,8 @@ struct HashMapOptions
         const uint64_t keySize,
         const uint64_t valueSize,
         const uint64_t pageSize,
-        const uint64_t numberOfBuckets)
+        const uint64_t numberOfBuckets,
+        const Nautilus::Interface::HashMapType hashMapType = Nautilus::Interface::HashMapType::CHAINED)
         : hashFunction(std::move(hashFunction))
         , keyFunctions(std::move(keyFunctions))
         , fieldKeys(std::move(fieldKeys))
@@ -53,6 +65,7 @@ struct HashMapOptions
         , valueSize(valueSize)
         , pageSize(pageSize)
         , numberOfBuckets(numberOfBuckets)
+        , hashMapType(hashMapType)
     {
         INVARIANT(entriesPerPage > 0, "The number of entries per page must be greater than 0");
         INVARIANT(entrySize > 0, "The entry size must be greater than 0");
@@ -78,6 +91,7 @@ struct HashMapOptions
         , valueSize(std::move(other.valueSize))
         , pageSize(std::move(other.pageSize))
         , numberOfBuckets(std::move(other.numberOfBuckets))
+        , hashMapType(other.hashMapType)
     {
     }
 
@@ -92,6 +106,7 @@ struct HashMapOptions
         , valueSize(other.valueSize)
         , pageSize(other.pageSize)
         , numberOfBuckets(other.numberOfBuckets)
+        , hashMapType(other.hashMapType)
     {
     }
 
@@ -107,6 +122,7 @@ struct HashMapOptions
         valueSize = std::move(other.valueSize);
         pageSize = std::move(other.pageSize);
         numberOfBuckets = std::move(other.numberOfBuckets);
+        hashMapType = other.hashMapType;
         return *this;
     };
 
@@ -122,6 +138,7 @@ struct HashMapOptions
         valueSize = other.valueSize;
         pageSize = other.pageSize;
         numberOfBuckets = other.numberOfBuckets;
+        hashMapType = other.hashMapType;
         return *this;
     }
 
@@ -144,6 +161,46 @@ struct HashMapOptions
         };
     }
 
+    /// Creates the nautilus wrapper that matches the hash map type. We only need this wrapper for lookups, as iterating over all entries
+    /// works the same for all hash map types via ChainedHashMapRef::EntryIterator.
+    [[nodiscard]] std::unique_ptr<Nautilus::Interface::ChainedHashMapRef>
+    createHashMapRef(const nautilus::val<Nautilus::Interface::HashMap*>& hashMap) const
+    {
+        switch (hashMapType)
+        {
+            case Nautilus::Interface::HashMapType::CHAINED:
+                return std::make_unique<Nautilus::Interface::ChainedHashMapRef>(
+                    hashMap, fieldKeys, fieldValues, entriesPerPage, entrySize);
+            case Nautilus::Interface::HashMapType::OPEN_ADDRESSING:
+                return std::make_unique<Nautilus::Interface::OpenAddressingHashMapRef>(
+                    hashMap, fieldKeys, fieldValues, entriesPerPage, entrySize);
+        }
+        std::unreachable();
+    }
+
+    /// Returns the radix partition of the keys of the record. Expects that the record already contains the key fields.
+    /// The number of partitions must be a power of 2.
+    [[nodiscard]] nautilus::val<uint64_t> getPartition(const Record& record, const uint64_t numberOfPartitions) const
+    {
+        if (numberOfPartitions == 1)
+        {
+            return 0;
+        }
+
+        std::vector<VarVal> keyValues;
+        for (const auto& [fieldIdentifier, type, fieldOffset] : nautilus::static_iterable(fieldKeys))
+        {
+            keyValues.emplace_back(record.read(fieldIdentifier));
+        }
+
+        /// The hash maps choose the bucket via the lower bits of the hash and the OpenAddressingHashMap uses the upper 7 bits as tags.
+        /// Thus, we take the radix bits directly below the tag, to not cluster the keys of a partition in a few buckets.
+        constexpr uint64_t firstTagBit = 57;
+        const auto hash = hashFunction->calculate(keyValues);
+        const nautilus::val<uint64_t> shift{firstTagBit - static_cast<uint64_t>(std::countr_zero(numberOfPartitions))};
+        return (hash >> shift) & nautilus::val<uint64_t>(numberOfPartitions - 1);
+    }
+
     /// It is fine that these are not nautilus types, because they are only used in the tracing and not in the actual execution
     std::unique_ptr<Nautilus::Interface::HashFunction> hashFunction;
     std::vector<PhysicalFunction> keyFunctions;
@@ -155,6 +212,7 @@ struct HashMapOptions
     uint64_t valueSize;
     uint64_t pageSize;
     uint64_t numberOfBuckets;
+    Nautilus::Interface::HashMapType hashMapType;
 };
 
 }
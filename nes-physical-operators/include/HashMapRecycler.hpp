@@ -0,0 +1,75 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <vector>
+#include <Nautilus/Interface/HashMap/HashMap.hpp>
+#include <folly/Synchronized.h>
+
+namespace NES
+{
+
+/// Keeps the cleared hash maps of destroyed slices, such that the next slices reuse their entry space and pages instead of allocating
+/// them again. The slices of an operator handler share its recycler, c.f., CreateNewHashMapSliceArgs. As the handlers adapt the number
+/// of buckets of new slices, a slice solely reuses a hash map with the same configuration as its own.
+class HashMapRecycler
+{
+public:
+    struct Configuration
+    {
+        Nautilus::Interface::HashMapType hashMapType;
+        uint64_t keySize;
+        uint64_t valueSize;
+        uint64_t numberOfBuckets;
+        uint64_t pageSize;
+
+        auto operator<=>(const Configuration&) const = default;
+    };
+
+    static constexpr size_t DEFAULT_MAX_NUMBER_OF_HASH_MAPS = 256;
+    /// Bounds the memory that a recycled hash map keeps, as a slice with many keys must not pin its pages for all following slices
+    static constexpr uint64_t DEFAULT_MAX_RETAINED_PAGES_PER_HASH_MAP = 64;
+
+    explicit HashMapRecycler(
+        size_t maxNumberOfHashMaps = DEFAULT_MAX_NUMBER_OF_HASH_MAPS,
+        uint64_t maxRetainedPagesPerHashMap = DEFAULT_MAX_RETAINED_PAGES_PER_HASH_MAP);
+
+    /// Returns a cleared hash map of the configuration or nullptr, if the recycler keeps none
+    [[nodiscard]] std::unique_ptr<Nautilus::Interface::HashMap> acquire(const Configuration& configuration);
+
+    /// Clears the hash map, whose values have been cleaned up already, and keeps it for the next slice of the configuration.
+    /// Releases the hash map, if the recycler keeps maxNumberOfHashMaps already.
+    void recycle(const Configuration& configuration, std::unique_ptr<Nautilus::Interface::HashMap> hashMap);
+
+    [[nodiscard]] size_t getNumberOfHashMaps() const;
+
+private:
+    struct RecycledHashMaps
+    {
+        std::map<Configuration, std::vector<std::unique_ptr<Nautilus::Interface::HashMap>>> hashMapsByConfiguration;
+        size_t numberOfHashMaps = 0;
+    };
+
+    size_t maxNumberOfHashMaps;
+    uint64_t maxRetainedPagesPerHashMap;
+    folly::Synchronized<RecycledHashMaps> recycledHashMaps;
+};
+
+}
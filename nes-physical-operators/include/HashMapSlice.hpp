@@ -24,6 +24,7 @@
 #include <Nautilus/Interface/HashMap/HashMap.hpp>
 #include <SliceStore/Slice.hpp>
 #include <Engine.hpp>
+#include <HashMapRecycler.hpp>
 
 namespace NES
 {
@@ -37,12 +38,16 @@ struct CreateNewHashMapSliceArgs final : CreateNewSlicesArguments
         const uint64_t keySize,
         const uint64_t valueSize,
         const uint64_t pageSize,
-        const uint64_t numberOfBuckets)
+        const uint64_t numberOfBuckets,
+        const Nautilus::Interface::HashMapType hashMapType = Nautilus::Interface::HashMapType::CHAINED,
+        const uint64_t numberOfPartitions = 1)
         : nautilusCleanup(std::move(nautilusCleanup))
         , keySize(keySize)
         , valueSize(valueSize)
         , pageSize(pageSize)
         , numberOfBuckets(numberOfBuckets)
+        , hashMapType(hashMapType)
+        , numberOfPartitions(numberOfPartitions)
     {
     }
 
@@ -52,6 +57,11 @@ struct CreateNewHashMapSliceArgs final : CreateNewSlicesArguments
     uint64_t valueSize;
     uint64_t pageSize;
     uint64_t numberOfBuckets;
+    Nautilus::Interface::HashMapType hashMapType;
+    uint64_t numberOfPartitions; /// Number of radix partitions per input stream and worker thread, c.f., HJSlice
+    /// Set by the operator handler, whose slices reuse the hash maps of the destroyed slices. Without a recycler, each slice allocates its
+    /// own hash maps and releases them on destruction.
+    std::shared_ptr<HashMapRecycler> hashMapRecycler;
 };
 
 /// A HashMapSlice stores a number of hashmaps per input stream. We assume that each input stream has the same number of hashmaps
@@ -79,7 +89,19 @@ public:
 
     [[nodiscard]] uint64_t getNumberOfTuples() const;
 
+    /// Approximates the state by the keys and values of the stored tuples, without the buckets and the partially filled pages of the
+    /// hash maps. Reads the hash maps without synchronizing the builds, thus concurrently inserted tuples may be missing.
+    [[nodiscard]] uint64_t getStateSizeInBytes() const override;
+    /// Approximates the state of each worker thread, c.f., getStateSizeInBytes()
+    void addStateSizeInBytesPerWorkerThread(std::vector<uint64_t>& stateSizeInBytesPerWorkerThread) const override;
+
 protected:
+    /// Creates a new and empty hash map of the type and configuration in the createNewHashMapSliceArgs or reuses a recycled one
+    [[nodiscard]] std::unique_ptr<Nautilus::Interface::HashMap> createHashMap() const;
+    /// Hands the hash map, whose values have been cleaned up, to the recycler, if the slice has one. Otherwise, it releases the hash map.
+    void recycleHashMap(std::unique_ptr<Nautilus::Interface::HashMap> hashMap) const;
+    [[nodiscard]] HashMapRecycler::Configuration getRecyclerConfiguration() const;
+
     std::vector<std::unique_ptr<Nautilus::Interface::HashMap>> hashMaps;
     CreateNewHashMapSliceArgs createNewHashMapSliceArgs;
     uint64_t numberOfHashMapsPerInputStream;
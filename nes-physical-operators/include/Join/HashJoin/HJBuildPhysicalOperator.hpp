@@ -13,20 +13,28 @@
 */
 
 #pragma once
+#include <cstdint>
 #include <memory>
+#include <optional>
 #include <Identifiers/Identifiers.hpp>
 #include <Join/HashJoin/HJOperatorHandler.hpp>
+#include <Join/HashJoin/HJSlice.hpp>
 #include <Join/StreamJoinBuildPhysicalOperator.hpp>
 #include <Join/StreamJoinUtil.hpp>
 #include <Nautilus/Interface/BufferRef/TupleBufferRef.hpp>
 #include <Nautilus/Interface/HashMap/HashMap.hpp>
 #include <Nautilus/Interface/Record.hpp>
+#include <Nautilus/Interface/RecordBuffer.hpp>
 #include <Runtime/Execution/OperatorHandler.hpp>
 #include <Time/Timestamp.hpp>
 #include <Watermark/TimeFunction.hpp>
+#include <Windowing/WindowMetaData.hpp>
 #include <CompilationContext.hpp>
 #include <ExecutionContext.hpp>
 #include <HashMapOptions.hpp>
+#include <HashMapSlice.hpp>
+#include <WindowBuildPhysicalOperator.hpp>
+#include <val_ptr.hpp>
 
 namespace NES
 {
@@ -36,11 +44,32 @@ Interface::HashMap* getHashJoinHashMapProxy(
     Timestamp timestamp,
     WorkerThreadId workerThreadId,
     JoinBuildSideType buildSide,
+    uint64_t partition,
     const HJBuildPhysicalOperator* buildOperator);
+HJSlice* getHashJoinSliceProxy(const HJOperatorHandler* operatorHandler, Timestamp timestamp, const HJBuildPhysicalOperator* buildOperator);
+
+/// Configures the symmetric hash join, c.f., HJBuildPhysicalOperator
+struct SymmetricHashJoinOptions
+{
+    /// Layout of the hash maps and of the records of the other side
+    HashMapOptions otherSideHashMapOptions;
+    std::shared_ptr<Interface::BufferRef::TupleBufferRef> otherSideBufferRef;
+    /// Writes the joined records in the output schema of the join
+    std::shared_ptr<Interface::BufferRef::TupleBufferRef> joinedBufferRef;
+    WindowMetaData windowMetaData;
+};
 
 /// This class is the first phase of the join. For both streams (left and right), the tuples are stored in a hash map of a
 /// corresponding slice one after the other. Afterward, the second phase (HJProbe) will start joining the tuples by comparing the join keys
 /// via a hash function.
+/// With more than one partition, the build radix-partitions the tuples by the hash of their keys. Each worker thread inserts the tuples of
+/// a partition into a separate and thus smaller hash map, so that the probe can join each partition separately, c.f., HJSlice.
+///
+/// In a symmetric hash join, each record probes the hash maps of the other side of its slice right after its insertion and the build emits
+/// the joined records at the end of each buffer. Thus, results arrive with the latency of a buffer instead of a window and the window
+/// solely determines, when we drop the slices. As the records of both sides in a slice then belong to the same window, we solely support
+/// it for tumbling windows. The builds of both sides insert and probe under the lock of the operator handler, as they read the hash maps
+/// of other worker threads.
 class HJBuildPhysicalOperator : public StreamJoinBuildPhysicalOperator
 {
 public:
@@ -49,18 +78,72 @@ public:
         Timestamp timestamp,
         WorkerThreadId workerThreadId,
         JoinBuildSideType buildSide,
+        uint64_t partition,
         const HJBuildPhysicalOperator* buildOperator);
+    friend HJSlice*
+    getHashJoinSliceProxy(const HJOperatorHandler* operatorHandler, Timestamp timestamp, const HJBuildPhysicalOperator* buildOperator);
+
+    static constexpr uint64_t MAX_NUMBER_OF_PARTITIONS = HashMapOptions::MAX_NUMBER_OF_PARTITIONS;
+
+    /// @param numberOfPartitions must be a power of 2 and not larger than MAX_NUMBER_OF_PARTITIONS. Both sides of a join must use the same.
     HJBuildPhysicalOperator(
         OperatorHandlerId operatorHandlerId,
         JoinBuildSideType joinBuildSide,
         std::unique_ptr<TimeFunction> timeFunction,
         const std::shared_ptr<Interface::BufferRef::TupleBufferRef>& bufferRef,
-        HashMapOptions hashMapOptions);
+        HashMapOptions hashMapOptions,
+        uint64_t numberOfPartitions = 1,
+        std::optional<SymmetricHashJoinOptions> symmetricHashJoinOptions = std::nullopt);
     void setup(ExecutionContext& executionCtx, CompilationContext& compilationContext) const override;
     void execute(ExecutionContext& ctx, Record& record) const override;
+    void close(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const override;
+
+    /// Creates the function that destroys the paged vectors of all entries of a hash map, once its slice gets destroyed
+    [[nodiscard]] static std::shared_ptr<CreateNewHashMapSliceArgs::NautilusCleanupExec>
+    createCleanupFunction(CompilationContext& compilationContext, const HashMapOptions& hashMapOptions);
+
+    /// Inserts the record into the paged vector of the entry of its keys and returns the entry. Expects that the record already contains
+    /// the key fields.
+    static nautilus::val<Interface::AbstractHashMapEntry*> insertIntoHashMap(
+        ExecutionContext& ctx,
+        const Record& record,
+        const nautilus::val<Interface::HashMap*>& hashMapPtr,
+        const HashMapOptions& hashMapOptions,
+        const std::shared_ptr<Interface::BufferRef::TupleBufferRef>& bufferRef);
+
+protected:
+    /// Returns the hash map of the slice of the timestamp for the partition
+    nautilus::val<Interface::HashMap*>
+    getHashMap(ExecutionContext& ctx, const nautilus::val<Timestamp>& timestamp, const nautilus::val<uint64_t>& partition) const;
+
+    /// Returns the partition of the record. Expects that the record already contains the key fields.
+    [[nodiscard]] nautilus::val<uint64_t> getPartition(const Record& record) const;
+
+    /// Inserts the record into the entry of its keys and returns the entry. Expects that the record already contains the key fields.
+    nautilus::val<Interface::AbstractHashMapEntry*>
+    insertRecord(ExecutionContext& ctx, const Record& record, const nautilus::val<Interface::HashMap*>& hashMapPtr) const;
+
+    [[nodiscard]] std::unique_ptr<WindowOperatorBuildLocalState> createLocalState(
+        ExecutionContext& executionCtx,
+        const nautilus::val<OperatorHandler*>& operatorHandler,
+        const nautilus::val<Timestamp>& oldestAcceptedTimestamp) const override;
 
-private:
     HashMapOptions hashMapOptions;
+    uint64_t numberOfPartitions;
+
+private:
+    /// Joins the record with all records of the same keys in the hash maps of the other side of its slice and writes the joined records
+    /// to the result buffer of the local state. Expects to hold the lock of the operator handler.
+    void probeOtherSide(
+        ExecutionContext& ctx,
+        const Record& record,
+        const nautilus::val<Interface::AbstractHashMapEntry*>& entry,
+        const nautilus::val<Timestamp>& timestamp,
+        const nautilus::val<uint64_t>& partition) const;
+
+    void emitJoinedRecords(ExecutionContext& ctx) const;
+
+    std::optional<SymmetricHashJoinOptions> symmetricHashJoinOptions;
 };
 
 }
@@ -14,21 +14,29 @@
 
 #pragma once
 #include <algorithm>
+#include <atomic>
 #include <bit>
 #include <cstdint>
 #include <functional>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <utility>
 #include <vector>
 #include <Identifiers/Identifiers.hpp>
 #include <Join/StreamJoinOperatorHandler.hpp>
 #include <Join/StreamJoinUtil.hpp>
+#include <Nautilus/Interface/BloomFilter/BlockedBloomFilter.hpp>
 #include <Nautilus/Interface/HashMap/HashMap.hpp>
+#include <Runtime/TupleBuffer.hpp>
 #include <Runtime/Execution/OperatorHandler.hpp>
 #include <Sequencing/SequenceData.hpp>
 #include <SliceStore/Slice.hpp>
 #include <SliceStore/WindowSlicesStoreInterface.hpp>
+#include <Time/Timestamp.hpp>
 #include <Util/RollingAverage.hpp>
+#include <folly/Synchronized.h>
+#include <HashMapRecycler.hpp>
 #include <HashMapSlice.hpp>
 
 namespace NES
@@ -39,9 +47,17 @@ struct EmittedHJWindowTrigger
 {
     EmittedHJWindowTrigger(
         const WindowInfo windowInfo,
+        const uint64_t numberOfWindows,
+        const uint64_t windowSlide,
         const std::vector<Nautilus::Interface::HashMap*>& leftHashMaps,
-        const std::vector<Nautilus::Interface::HashMap*>& rightHashMaps)
-        : windowInfo(windowInfo), leftNumberOfHashMaps(leftHashMaps.size()), rightNumberOfHashMaps(rightHashMaps.size())
+        const std::vector<Nautilus::Interface::HashMap*>& rightHashMaps,
+        const Nautilus::Interface::BlockedBloomFilter* leftBloomFilter)
+        : windowInfo(windowInfo)
+        , numberOfWindows(numberOfWindows)
+        , windowSlide(windowSlide)
+        , leftNumberOfHashMaps(leftHashMaps.size())
+        , rightNumberOfHashMaps(rightHashMaps.size())
+        , leftBloomFilter(leftBloomFilter)
     {
         /// Copying the left and right hashmap pointer pointers after this object, hence this + 1
         const auto leftHashMapPtrSizeInByte = leftHashMaps.size() * sizeof(Nautilus::Interface::HashMap*);
@@ -54,14 +70,23 @@ struct EmittedHJWindowTrigger
     }
 
     WindowInfo windowInfo;
+    /// The probe emits each joined record for this many windows, starting with the window info and moving by the window slide
+    uint64_t numberOfWindows;
+    uint64_t windowSlide;
     uint64_t leftNumberOfHashMaps;
     uint64_t rightNumberOfHashMaps;
     Nautilus::Interface::HashMap**
         leftHashMaps; /// Pointer to the stored pointers of all hash maps of the left input stream that the probe should iterate over
     Nautilus::Interface::HashMap**
         rightHashMaps; /// Pointer to the stored pointers of all hash maps of the right input stream that the probe should iterate over
+    const Nautilus::Interface::BlockedBloomFilter* leftBloomFilter; /// Filter over the keys of all left hash maps or nullptr, if disabled
 };
 
+/// For sliding windows, each pair of slices belongs to all windows that contain both slices. Instead of probing the pair for each of
+/// these windows, the handler can share the pairs across the windows: the first triggered window that contains a pair emits it once,
+/// and the probe writes every joined record of the pair with the start and end of all windows of the pair. Thus, the probe work per
+/// window does not grow with the ratio of the window size to the slide, solely the number of emitted records does.
+/// The handler remembers the emitted pairs, until the left slice of the pair is destroyed, as no window contains the pair afterward.
 class HJOperatorHandler final : public StreamJoinOperatorHandler
 {
 public:
@@ -69,7 +94,11 @@ public:
         const std::vector<OriginId>& inputOrigins,
         OriginId outputOriginId,
         std::unique_ptr<WindowSlicesStoreInterface> sliceAndWindowStore,
-        uint64_t maxNumberOfBuckets);
+        uint64_t maxNumberOfBuckets,
+        bool useBloomFilter = true,
+        bool symmetric = false,
+        uint64_t maxNumberOfProbeTasksPerPartition = 1,
+        bool shareSlicePairs = false);
 
     [[nodiscard]] std::function<std::vector<std::shared_ptr<Slice>>(SliceStart, SliceEnd)>
     getCreateNewSlicesFunction(const CreateNewSlicesArguments& newSlicesArguments) const override;
@@ -79,6 +108,24 @@ public:
         std::shared_ptr<CreateNewHashMapSliceArgs::NautilusCleanupExec> nautilusCleanupExec, const JoinBuildSideType& buildSide);
     [[nodiscard]] std::vector<std::shared_ptr<CreateNewHashMapSliceArgs::NautilusCleanupExec>> getNautilusCleanupExec() const;
 
+    /// Guards the hash maps of all slices in a symmetric hash join, as each build reads the hash maps of the other side of all threads
+    [[nodiscard]] std::mutex& getSymmetricJoinMutex();
+
+    /// Emits the records, which the builds of a symmetric hash join have joined, to the probe. As the builds emit them before the windows
+    /// trigger, the joined records and the window triggers share the sequence numbers of the output origin.
+    /// The joined records carry the creation timestamps of the input buffer, whose records the build has joined.
+    void emitJoinedRecords(
+        TupleBuffer& tupleBuffer,
+        uint64_t numberOfRecords,
+        const SliceCreationTimestamps& creationTimestamps,
+        PipelineExecutionContext* pipelineCtx);
+
+protected:
+    /// Emits the pairs of slices of each window, c.f., shareSlicePairs
+    void triggerSlices(
+        const std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>>& slicesAndWindowInfo,
+        PipelineExecutionContext* pipelineCtx) override;
+
 private:
     /// Is required to not perform the setup again and resolving a race condition to the cleanup state function
     std::atomic<bool> setupAlreadyCalledLeft;
@@ -88,6 +135,9 @@ private:
     std::shared_ptr<CreateNewHashMapSliceArgs::NautilusCleanupExec> rightCleanupStateNautilusFunction;
 
 
+    /// Emits one probe task per partition of the slices, so that multiple worker threads can probe the partitions of a window.
+    /// Thus, each pair of slices occupies as many chunks of the sequence number as there are partitions. If a pair of slices is the sole
+    /// chunk of its sequence number, it splits the probe of partitions with heavy hitters, c.f., maxNumberOfProbeTasksPerPartition.
     void emitSlicesToProbe(
         Slice& sliceLeft,
         Slice& sliceRight,
@@ -95,8 +145,48 @@ private:
         const SequenceData& sequenceData,
         PipelineExecutionContext* pipelineCtx) override;
 
+    /// Emits the pair of slices for `numberOfWindows` windows, starting with `windowInfo`, c.f., EmittedHJWindowTrigger
+    void emitSlicePairToProbe(
+        Slice& sliceLeft,
+        Slice& sliceRight,
+        const WindowInfo& windowInfo,
+        uint64_t numberOfWindows,
+        const SequenceData& sequenceData,
+        PipelineExecutionContext* pipelineCtx);
+
+    void emitPartitionToProbe(
+        const std::vector<Nautilus::Interface::HashMap*>& leftHashMaps,
+        const std::vector<Nautilus::Interface::HashMap*>& rightHashMaps,
+        const Nautilus::Interface::BlockedBloomFilter* leftBloomFilter,
+        const SliceCreationTimestamps& creationTimestamps,
+        const WindowInfo& windowInfo,
+        uint64_t numberOfWindows,
+        const SequenceData& sequenceData,
+        PipelineExecutionContext* pipelineCtx) const;
+
     folly::Synchronized<RollingAverage<uint64_t>> rollingAverageNumberOfKeys;
     uint64_t maxNumberOfBuckets;
+    /// Shared with all slices of the handler, which reuse the hash maps of the destroyed slices instead of allocating them again
+    std::shared_ptr<HashMapRecycler> hashMapRecycler = std::make_shared<HashMapRecycler>();
+    /// If set, the probe skips all keys of the right side that the Bloom filter over the keys of the left side does not contain
+    bool useBloomFilter;
+
+    /// Splits the probe of a partition, if a heavy hitter, i.e., a key that joins more pairs than a probe task should, stalls the window on
+    /// the worker thread probing the partition. Each of the up to this many probe tasks probes a share of the right hash maps, which we
+    /// balance by their number of joined pairs, against all left hash maps. 1 disables the splitting.
+    uint64_t maxNumberOfProbeTasksPerPartition;
+
+    /// In a symmetric hash join, the window triggers solely advance the watermark, as the builds have joined all records already
+    bool symmetric;
+    std::mutex symmetricJoinMutex;
+    std::atomic<SequenceNumber::Underlying> nextSymmetricSequenceNumber{SequenceNumber::INITIAL};
+    /// Start of the last triggered window. All records, which the builds join afterwards, belong to later windows.
+    std::atomic<Timestamp::Underlying> symmetricWatermark{Timestamp::INITIAL_VALUE};
+
+    /// If set, each pair of slices is probed once for all sliding windows that contain it, c.f., the class comment
+    bool shareSlicePairs;
+    /// Ends of the left and right slice of all emitted pairs and the left slice, whose destruction expires the pair
+    folly::Synchronized<std::map<std::pair<SliceEnd, SliceEnd>, std::weak_ptr<Slice>>> emittedSlicePairs;
 };
 
 }
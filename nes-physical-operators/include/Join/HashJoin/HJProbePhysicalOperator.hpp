@@ -14,16 +14,21 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <Functions/PhysicalFunction.hpp>
 #include <Join/StreamJoinProbePhysicalOperator.hpp>
 #include <Join/StreamJoinUtil.hpp>
 #include <Nautilus/Interface/BufferRef/TupleBufferRef.hpp>
+#include <Nautilus/Interface/PagedVector/PagedVectorRef.hpp>
+#include <Nautilus/Interface/Record.hpp>
 #include <Nautilus/Interface/RecordBuffer.hpp>
 #include <Runtime/Execution/OperatorHandler.hpp>
+#include <Time/Timestamp.hpp>
 #include <Windowing/WindowMetaData.hpp>
 #include <ExecutionContext.hpp>
 #include <HashMapOptions.hpp>
+#include <val.hpp>
 
 namespace NES
 {
@@ -40,7 +45,9 @@ public:
         std::shared_ptr<Interface::BufferRef::TupleBufferRef> leftBufferRef,
         std::shared_ptr<Interface::BufferRef::TupleBufferRef> rightBufferRef,
         HashMapOptions leftHashMapBasedOptions,
-        HashMapOptions rightHashMapBasedOptions);
+        HashMapOptions rightHashMapBasedOptions,
+        bool verifyCandidates = false,
+        std::shared_ptr<Interface::BufferRef::TupleBufferRef> symmetricJoinedBufferRef = nullptr);
 
     /// As the second phase gets triggered by the first phase, we receive a tuple buffer containing all information for performing the probe.
     /// Thus, we start a new pipeline and therefore, we create new Records from the built-up state.
@@ -49,6 +56,46 @@ public:
 private:
     std::shared_ptr<Interface::BufferRef::TupleBufferRef> leftBufferRef, rightBufferRef;
     HashMapOptions leftHashMapOptions, rightHashMapOptions;
+    /// If set, equal keys only denote join candidates, e.g., the grid cells of a spatial join.
+    /// Then, we evaluate the join function for each pair of records with equal keys.
+    bool verifyCandidates;
+    /// If set, the builds join the records symmetrically and emit buffers of joined records, which we solely pass to our child
+    std::shared_ptr<Interface::BufferRef::TupleBufferRef> symmetricJoinedBufferRef;
+
+    /// Windows of a pair of slices that is shared across sliding windows, c.f., HJOperatorHandler
+    struct SharedWindows
+    {
+        nautilus::val<uint64_t> numberOfWindows;
+        nautilus::val<uint64_t> windowSlide;
+    };
+
+    void passJoinedRecords(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const;
+
+    /// Passes the joined record to the child once per window of the pair of slices, by moving the window start and end by the slide
+    void executeChildForAllWindows(
+        ExecutionContext& executionCtx,
+        const Record& joinedRecord,
+        const nautilus::val<Timestamp>& windowStart,
+        const nautilus::val<Timestamp>& windowEnd,
+        const SharedWindows& sharedWindows) const;
+
+    /// Joins all pairs of records of the paged vectors of the same key
+    void joinMatches(
+        const Interface::PagedVectorRef& leftPagedVector,
+        const Interface::PagedVectorRef& rightPagedVector,
+        ExecutionContext& executionCtx,
+        const nautilus::val<Timestamp>& windowStart,
+        const nautilus::val<Timestamp>& windowEnd,
+        const SharedWindows& sharedWindows) const;
+
+    /// Evaluates the join function on the join function fields of all pairs of records and materializes the remaining fields for matches
+    void joinCandidates(
+        const Interface::PagedVectorRef& leftPagedVector,
+        const Interface::PagedVectorRef& rightPagedVector,
+        ExecutionContext& executionCtx,
+        const nautilus::val<Timestamp>& windowStart,
+        const nautilus::val<Timestamp>& windowEnd,
+        const SharedWindows& sharedWindows) const;
 };
 
 }
@@ -15,25 +15,74 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <vector>
 #include <Identifiers/Identifiers.hpp>
 #include <Join/StreamJoinUtil.hpp>
+#include <Nautilus/Interface/BloomFilter/BlockedBloomFilter.hpp>
 #include <Nautilus/Interface/HashMap/HashMap.hpp>
+#include <Runtime/AbstractBufferProvider.hpp>
 #include <SliceStore/Slice.hpp>
 #include <HashMapSlice.hpp>
 
 namespace NES
 {
 
+/// How the record pairs, which the probe of a partition joins, spread over the keys and the right hash maps of the partition
+struct HJPartitionSkew
+{
+    uint64_t numberOfJoinedKeys{0};
+    uint64_t numberOfPairs{0};
+    uint64_t numberOfPairsOfHeaviestKey{0};
+    /// Number of pairs that the probe joins for the records of the right hash map of each worker thread
+    std::vector<uint64_t> numberOfPairsPerRightHashMap;
+};
+
 /// As a hash join has left and right side, we need to handle the left and right side of the join with one slice
 /// Thus, we use a HashMapSlice and set the number of input streams to 2 in its constructor
+///
+/// For a radix-partitioned hash join, each worker thread inserts the tuples of a partition into a separate hash map.
+/// The hash maps of one side are ordered by worker thread and then by partition, c.f.,
+/// | Left: [Worker1: Partition1][Worker1: Partition2]...[Worker2: Partition1]... | Right: [Worker1: Partition1]... |
+/// Thus, the probe can join each partition separately, as tuples with equal keys always end up in the same partition.
+///
+/// Additionally, the slice stores one Bloom filter per partition over the keys of the left side, which the probe checks before looking
+/// up a key of the right side in all left hash maps of the partition.
 class HJSlice final : public HashMapSlice
 {
 public:
+    /// Name of the BloomFilterStatistics of the hash join
+    static constexpr std::string_view BLOOM_FILTER_STATISTICS_NAME = "HashJoin";
+
     HJSlice(
         SliceStart sliceStart, SliceEnd sliceEnd, const CreateNewHashMapSliceArgs& createNewHashMapSliceArgs, uint64_t numberOfHashMaps);
-    [[nodiscard]] Nautilus::Interface::HashMap* getHashMapPtr(WorkerThreadId workerThreadId, const JoinBuildSideType& buildSide) const;
-    [[nodiscard]] Nautilus::Interface::HashMap* getHashMapPtrOrCreate(WorkerThreadId workerThreadId, const JoinBuildSideType& buildSide);
+    [[nodiscard]] Nautilus::Interface::HashMap*
+    getHashMapPtr(WorkerThreadId workerThreadId, const JoinBuildSideType& buildSide, uint64_t partition) const;
+    [[nodiscard]] Nautilus::Interface::HashMap*
+    getHashMapPtrOrCreate(WorkerThreadId workerThreadId, const JoinBuildSideType& buildSide, uint64_t partition);
+
+    /// Returns the number of hash maps per side and partition, i.e., one per worker thread
     [[nodiscard]] uint64_t getNumberOfHashMapsForSide() const;
+    [[nodiscard]] uint64_t getNumberOfPartitions() const;
+
+    /// Returns the Bloom filter over the keys of all left hash maps of the partition. A slice gets triggered only once no more tuples
+    /// arrive for it. Thus, we build the filter on first access, which sizes it for the final number of keys. This method is thread-safe.
+    [[nodiscard]] const Nautilus::Interface::BlockedBloomFilter*
+    getOrCreateBloomFilter(uint64_t partition, AbstractBufferProvider* bufferProvider);
+
+    /// Counts the records of each key in the left hash maps of this slice and the right hash maps of the right slice of the partition.
+    /// As the hash maps store the records of a key in the paged vector of its entry, counting requires one pass over the entries and no
+    /// pass over the records. Keys are identified by their hash, thus, colliding keys may overestimate the pairs of a key.
+    [[nodiscard]] HJPartitionSkew getPartitionSkew(const HJSlice& rightSlice, uint64_t partition) const;
+
+private:
+    [[nodiscard]] uint64_t getHashMapPosition(WorkerThreadId workerThreadId, const JoinBuildSideType& buildSide, uint64_t partition) const;
+
+    /// Multiple windows might trigger a slice concurrently, e.g., for sliding windows
+    std::mutex bloomFilterMutex;
+    std::vector<std::unique_ptr<Nautilus::Interface::BlockedBloomFilter>> bloomFilters; /// One per partition, nullptr until first access
 };
 
 }
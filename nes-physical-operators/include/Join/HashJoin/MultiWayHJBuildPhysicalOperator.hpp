@@ -0,0 +1,70 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <Identifiers/Identifiers.hpp>
+#include <Join/HashJoin/MultiWayHJOperatorHandler.hpp>
+#include <Nautilus/Interface/BufferRef/TupleBufferRef.hpp>
+#include <Nautilus/Interface/HashMap/HashMap.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <Runtime/Execution/OperatorHandler.hpp>
+#include <Time/Timestamp.hpp>
+#include <Watermark/TimeFunction.hpp>
+#include <CompilationContext.hpp>
+#include <ExecutionContext.hpp>
+#include <HashMapOptions.hpp>
+#include <WindowBuildPhysicalOperator.hpp>
+
+namespace NES
+{
+class MultiWayHJBuildPhysicalOperator;
+Interface::HashMap* getMultiWayHashJoinHashMapProxy(
+    const MultiWayHJOperatorHandler* operatorHandler,
+    Timestamp timestamp,
+    WorkerThreadId workerThreadId,
+    uint64_t input,
+    const MultiWayHJBuildPhysicalOperator* buildOperator);
+
+/// This class is the first phase of the multi-way hash join. There is one build per input of the join, which stores the records of its
+/// input in the hash map of its input in the corresponding slice, like the HJBuildPhysicalOperator does for each side of a binary join.
+/// All inputs must compute keys of the same layout, so that the probe can look up the keys of one input in the hash maps of the others.
+class MultiWayHJBuildPhysicalOperator final : public WindowBuildPhysicalOperator
+{
+public:
+    friend Interface::HashMap* getMultiWayHashJoinHashMapProxy(
+        const MultiWayHJOperatorHandler* operatorHandler,
+        Timestamp timestamp,
+        WorkerThreadId workerThreadId,
+        uint64_t input,
+        const MultiWayHJBuildPhysicalOperator* buildOperator);
+
+    MultiWayHJBuildPhysicalOperator(
+        OperatorHandlerId operatorHandlerId,
+        uint64_t input,
+        std::unique_ptr<TimeFunction> timeFunction,
+        std::shared_ptr<Interface::BufferRef::TupleBufferRef> bufferRef,
+        HashMapOptions hashMapOptions);
+    void setup(ExecutionContext& executionCtx, CompilationContext& compilationContext) const override;
+    void execute(ExecutionContext& ctx, Record& record) const override;
+
+private:
+    uint64_t input;
+    std::shared_ptr<Interface::BufferRef::TupleBufferRef> bufferRef;
+    HashMapOptions hashMapOptions;
+};
+
+}
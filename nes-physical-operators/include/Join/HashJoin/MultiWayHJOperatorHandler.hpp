@@ -0,0 +1,114 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <span>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
+#include <Nautilus/Interface/HashMap/HashMap.hpp>
+#include <Runtime/Execution/OperatorHandler.hpp>
+#include <SliceStore/Slice.hpp>
+#include <SliceStore/WindowSlicesStoreInterface.hpp>
+#include <Util/RollingAverage.hpp>
+#include <HashMapRecycler.hpp>
+#include <HashMapSlice.hpp>
+#include <WindowBasedOperatorHandler.hpp>
+
+namespace NES
+{
+
+/// This task models the information for a multi-way hash join based window trigger. It stores the number of hash maps of each input and
+/// the pointers to the hash maps of all inputs one after the other after this object.
+struct EmittedMultiWayHJWindowTrigger
+{
+    EmittedMultiWayHJWindowTrigger(const WindowInfo windowInfo, const std::vector<std::vector<Nautilus::Interface::HashMap*>>& inputHashMaps)
+        : windowInfo(windowInfo), numberOfInputs(inputHashMaps.size())
+    {
+        numberOfHashMaps = std::bit_cast<uint64_t*>(this + 1);
+        hashMaps = std::bit_cast<Nautilus::Interface::HashMap**>(numberOfHashMaps + numberOfInputs);
+        auto* nextHashMap = hashMaps;
+        for (uint64_t input = 0; input < numberOfInputs; ++input)
+        {
+            numberOfHashMaps[input] = inputHashMaps[input].size();
+            nextHashMap = std::ranges::copy(inputHashMaps[input], nextHashMap).out;
+        }
+    }
+
+    /// Returns the pointer to the stored pointers of all hash maps of the input that the probe should iterate over
+    [[nodiscard]] Nautilus::Interface::HashMap** getHashMaps(const uint64_t input) const
+    {
+        const std::span numberOfHashMapsPerInput{numberOfHashMaps, numberOfInputs};
+        return hashMaps + std::accumulate(numberOfHashMapsPerInput.begin(), numberOfHashMapsPerInput.begin() + input, uint64_t{0});
+    }
+
+    WindowInfo windowInfo;
+    uint64_t numberOfInputs;
+    uint64_t* numberOfHashMaps; /// Number of hash maps of each input
+    Nautilus::Interface::HashMap** hashMaps;
+};
+
+/// Operator handler of the multi-way hash join, c.f., MultiWayHJBuildPhysicalOperator.
+/// As all records of a window are in the hash maps of its slices, we emit a single probe task per window with the hash maps of all inputs.
+class MultiWayHJOperatorHandler final : public WindowBasedOperatorHandler
+{
+public:
+    MultiWayHJOperatorHandler(
+        const std::vector<OriginId>& inputOrigins,
+        OriginId outputOriginId,
+        std::unique_ptr<WindowSlicesStoreInterface> sliceAndWindowStore,
+        uint64_t numberOfInputs,
+        uint64_t maxNumberOfBuckets);
+
+    [[nodiscard]] std::function<std::vector<std::shared_ptr<Slice>>(SliceStart, SliceEnd)>
+    getCreateNewSlicesFunction(const CreateNewSlicesArguments& newSlicesArguments) const override;
+
+    bool wasSetupCalled(uint64_t input);
+    void setNautilusCleanupExec(std::shared_ptr<CreateNewHashMapSliceArgs::NautilusCleanupExec> nautilusCleanupExec, uint64_t input);
+    [[nodiscard]] std::vector<std::shared_ptr<CreateNewHashMapSliceArgs::NautilusCleanupExec>> getNautilusCleanupExec() const;
+
+protected:
+    void triggerSlices(
+        const std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>>& slicesAndWindowInfo,
+        PipelineExecutionContext* pipelineCtx) override;
+
+private:
+    void emitWindowToProbe(
+        const std::vector<std::vector<Nautilus::Interface::HashMap*>>& inputHashMaps,
+        const SliceCreationTimestamps& creationTimestamps,
+        const WindowInfo& windowInfo,
+        SequenceNumber sequenceNumber,
+        PipelineExecutionContext* pipelineCtx) const;
+
+    uint64_t numberOfInputs;
+    /// Is required to not perform the setup again and resolving a race condition to the cleanup state function
+    std::vector<std::atomic<bool>> setupAlreadyCalled;
+    /// shared_ptr as multiple slices need access to it
+    std::vector<std::shared_ptr<CreateNewHashMapSliceArgs::NautilusCleanupExec>> cleanupStateNautilusFunctions;
+
+    folly::Synchronized<RollingAverage<uint64_t>> rollingAverageNumberOfKeys;
+    uint64_t maxNumberOfBuckets;
+    /// Shared with all slices of the handler, which reuse the hash maps of the destroyed slices instead of allocating them again
+    std::shared_ptr<HashMapRecycler> hashMapRecycler = std::make_shared<HashMapRecycler>();
+};
+
+}
@@ -0,0 +1,83 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <Nautilus/Interface/BufferRef/TupleBufferRef.hpp>
+#include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMapRef.hpp>
+#include <Nautilus/Interface/HashMap/HashMap.hpp>
+#include <Nautilus/Interface/PagedVector/PagedVectorRef.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <Nautilus/Interface/RecordBuffer.hpp>
+#include <Runtime/Execution/OperatorHandler.hpp>
+#include <Time/Timestamp.hpp>
+#include <Windowing/WindowMetaData.hpp>
+#include <ExecutionContext.hpp>
+#include <HashMapOptions.hpp>
+#include <WindowProbePhysicalOperator.hpp>
+
+namespace NES
+{
+
+/// Performs the second phase of the multi-way hash join. We iterate once over the keys of the first input, i.e., the fact side of a star join,
+/// and look up each key in the hash maps of all other inputs. Thus, we join a record of every input, without materializing the intermediate
+/// results of a chain of binary joins. The output contains the window start and end fields of every join that the operator replaces.
+class MultiWayHJProbePhysicalOperator final : public WindowProbePhysicalOperator
+{
+public:
+    /// @param windowMetaData contains the window start and end fields of the replaced joins, starting with the outermost one
+    MultiWayHJProbePhysicalOperator(
+        OperatorHandlerId operatorHandlerId,
+        std::vector<WindowMetaData> windowMetaData,
+        std::vector<std::shared_ptr<Interface::BufferRef::TupleBufferRef>> bufferRefs,
+        std::vector<HashMapOptions> hashMapOptions);
+
+    /// As the second phase gets triggered by the first phase, we receive a tuple buffer containing all information for performing the probe.
+    void open(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const override;
+
+private:
+    struct InputHashMaps
+    {
+        nautilus::val<uint64_t> numberOfHashMaps;
+        nautilus::val<Interface::HashMap**> hashMaps;
+    };
+
+    /// Joins the partially joined record with all records of the key of the fact entry of the given input and continues with the next input.
+    /// As the input is known while tracing, we unroll the inputs into nested loops.
+    void joinInput(
+        uint64_t input,
+        const Record& joinedRecord,
+        const Interface::ChainedHashMapRef::ChainedEntryRef& factEntryRef,
+        const std::vector<InputHashMaps>& inputHashMaps,
+        ExecutionContext& executionCtx,
+        const nautilus::val<Timestamp>& windowStart,
+        const nautilus::val<Timestamp>& windowEnd) const;
+
+    /// Joins the records of all other inputs with all records of the fact entry and passes them to the child
+    void joinFactRecords(
+        const Record& joinedRecord,
+        const Interface::ChainedHashMapRef::ChainedEntryRef& factEntryRef,
+        ExecutionContext& executionCtx,
+        const nautilus::val<Timestamp>& windowStart,
+        const nautilus::val<Timestamp>& windowEnd) const;
+
+    std::vector<WindowMetaData> allWindowMetaData;
+    std::vector<std::shared_ptr<Interface::BufferRef::TupleBufferRef>> bufferRefs;
+    std::vector<HashMapOptions> hashMapOptions;
+};
+
+}
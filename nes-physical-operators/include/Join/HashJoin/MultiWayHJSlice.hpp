@@ -0,0 +1,50 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <Identifiers/Identifiers.hpp>
+#include <Nautilus/Interface/HashMap/HashMap.hpp>
+#include <SliceStore/Slice.hpp>
+#include <HashMapSlice.hpp>
+
+namespace NES
+{
+
+/// A multi-way hash join stores the records of each of its inputs in separate hash maps. Thus, we use a HashMapSlice with one input stream
+/// per input of the join and one hash map per worker thread and input, c.f.,
+/// | Input 0: [Worker1][Worker2]... | Input 1: [Worker1][Worker2]... | ... | Input N - 1: [Worker1][Worker2]... |
+class MultiWayHJSlice final : public HashMapSlice
+{
+public:
+    MultiWayHJSlice(
+        SliceStart sliceStart,
+        SliceEnd sliceEnd,
+        const CreateNewHashMapSliceArgs& createNewHashMapSliceArgs,
+        uint64_t numberOfHashMaps,
+        uint64_t numberOfInputs);
+
+    [[nodiscard]] Nautilus::Interface::HashMap* getHashMapPtr(WorkerThreadId workerThreadId, uint64_t input) const;
+    [[nodiscard]] Nautilus::Interface::HashMap* getHashMapPtrOrCreate(WorkerThreadId workerThreadId, uint64_t input);
+
+    /// Returns the number of hash maps per input, i.e., one per worker thread
+    [[nodiscard]] uint64_t getNumberOfHashMapsForInput() const;
+    [[nodiscard]] uint64_t getNumberOfInputs() const;
+
+private:
+    [[nodiscard]] uint64_t getHashMapPosition(WorkerThreadId workerThreadId, uint64_t input) const;
+};
+
+}
@@ -0,0 +1,62 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <Functions/PhysicalFunction.hpp>
+#include <Identifiers/Identifiers.hpp>
+#include <Join/HashJoin/HJBuildPhysicalOperator.hpp>
+#include <Join/StreamJoinUtil.hpp>
+#include <Nautilus/Interface/BufferRef/TupleBufferRef.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <Watermark/TimeFunction.hpp>
+#include <ExecutionContext.hpp>
+#include <HashMapOptions.hpp>
+
+namespace NES
+{
+/// Returns the key of the grid cell that contains the point (lon, lat), shifted by the given number of cells in each dimension
+uint64_t getSpatialJoinCellProxy(double lon, double lat, double cellSize, int64_t offsetLon, int64_t offsetLat);
+
+/// Build phase of a spatial join, whose join function checks whether the positions of both sides are within a distance of each other.
+/// Instead of the join fields, the key of the hash map is the cell of a grid, whose cells are as large as the distance. The left side
+/// inserts each record into the cell of its position. The right side inserts each record into the cell of its position and into all
+/// eight neighbouring cells, as positions within the distance can only lie in these cells. Thus, the probe (HJProbe) only has to evaluate
+/// the exact join function for records that share a cell, instead of for all pairs of records in the window.
+/// Each pair of records shares exactly one cell, i.e., the cell of the left record. Therefore, the probe does not produce duplicates.
+class SpatialHJBuildPhysicalOperator final : public HJBuildPhysicalOperator
+{
+public:
+    /// @param hashMapOptions must have exactly one UINT64 key field, which stores the cell of the record
+    SpatialHJBuildPhysicalOperator(
+        OperatorHandlerId operatorHandlerId,
+        JoinBuildSideType joinBuildSide,
+        std::unique_ptr<TimeFunction> timeFunction,
+        const std::shared_ptr<Interface::BufferRef::TupleBufferRef>& bufferRef,
+        HashMapOptions hashMapOptions,
+        PhysicalFunction lonFunction,
+        PhysicalFunction latFunction,
+        double cellSize);
+    void execute(ExecutionContext& ctx, Record& record) const override;
+
+private:
+    PhysicalFunction lonFunction;
+    PhysicalFunction latFunction;
+    double cellSize;
+};
+
+}
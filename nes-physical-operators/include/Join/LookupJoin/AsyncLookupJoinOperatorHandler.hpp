@@ -0,0 +1,101 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include <DataTypes/Schema.hpp>
+#include <Identifiers/Identifiers.hpp>
+#include <Join/LookupJoin/HttpLookupClient.hpp>
+#include <Join/LookupJoin/LookupTable.hpp>
+#include <Runtime/Execution/OperatorHandler.hpp>
+#include <Runtime/QueryTerminationType.hpp>
+#include <folly/Synchronized.h>
+#include <folly/container/EvictingCacheMap.h>
+
+namespace NES
+{
+
+/// Owns the rows of the keys of a lookup join with an external table, c.f., AsyncLookupJoinPhysicalOperator. The HttpLookupClient
+/// fetches the rows of a key on its own I/O thread and an LRU cache keeps the rows of the `cacheSize` most recently used keys. Each key
+/// is requested once, even if the records of multiple buffers wait for it. A worker thread pins the rows of all keys of its current
+/// buffer, thus evicting a key never frees rows that a worker thread still reads.
+class AsyncLookupJoinOperatorHandler final : public OperatorHandler
+{
+public:
+    /// @param url contains `{}`, which is replaced by the textual representation of the key of a request
+    AsyncLookupJoinOperatorHandler(
+        std::string url, uint64_t cacheSize, uint64_t maxInFlight, Schema tableSchema, std::string keyFieldName);
+
+    void start(PipelineExecutionContext& pipelineExecutionContext, uint32_t localStateVariableId) override;
+    void stop(QueryTerminationType terminationType, PipelineExecutionContext& pipelineExecutionContext) override;
+
+    /// Releases the keys that the worker thread pinned for its previous buffer
+    void unpinKeys(WorkerThreadId workerThreadId);
+    /// Pins the rows of the key and returns true, if they are cached. Otherwise, requests them and returns false.
+    /// Throws ExternalLookupFailure, if a previous request failed, as its records cannot be joined.
+    [[nodiscard]] bool pinKey(WorkerThreadId workerThreadId, std::string_view key);
+    /// The table of the rows of a key that the worker thread pinned for its current buffer
+    [[nodiscard]] const LookupTable* getPinnedKey(WorkerThreadId workerThreadId, std::string_view key) const;
+
+private:
+    /// Allows looking up a std::string_view without constructing a std::string
+    struct KeyHash
+    {
+        using is_transparent = void;
+        size_t operator()(const std::string_view key) const { return std::hash<std::string_view>{}(key); }
+    };
+    using PinnedKeys = std::unordered_map<std::string, std::shared_ptr<const LookupTable>, KeyHash, std::equal_to<>>;
+
+    struct Cache
+    {
+        explicit Cache(const uint64_t cacheSize) : tables(cacheSize) { }
+
+        folly::EvictingCacheMap<std::string, std::shared_ptr<const LookupTable>> tables;
+        /// Keys whose requests are in flight or queued at the client
+        std::unordered_set<std::string> requestedKeys;
+        std::optional<std::string> failure;
+    };
+
+    /// Called on the I/O thread of the client
+    void onResponse(const std::string& key, std::expected<HttpLookupClient::Response, std::string> response);
+    /// The key as the url expects it, e.g., the digits of a number instead of its bytes
+    [[nodiscard]] std::string formatKey(std::string_view key) const;
+
+    std::string url;
+    uint64_t maxInFlight;
+    Schema tableSchema;
+    std::string keyFieldName;
+    Schema::Field keyField;
+
+    folly::Synchronized<Cache, std::mutex> cache;
+    /// Each worker thread solely accesses its own entry
+    std::vector<PinnedKeys> pinnedKeys;
+
+    std::once_flag startedClient;
+    std::unique_ptr<HttpLookupClient> client;
+};
+
+}
@@ -0,0 +1,76 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <vector>
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Functions/PhysicalFunction.hpp>
+#include <Identifiers/Identifiers.hpp>
+#include <Join/LookupJoin/LookupTableProbe.hpp>
+#include <Nautilus/Interface/BufferRef/TupleBufferRef.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <Nautilus/Interface/RecordBuffer.hpp>
+#include <CompilationContext.hpp>
+#include <ExecutionContext.hpp>
+#include <PhysicalOperator.hpp>
+
+namespace NES
+{
+
+/// Joins each record with the rows of an external table, c.f., AsyncLookupJoinOperatorHandler, whose key equals the key of the record.
+/// The operator scans the buffers of the preceding pipeline twice. The first pass pins the rows of the keys of all records and requests the
+/// keys that are not cached. If any key is missing, the buffer waits as a repeated task, which neither blocks the worker thread on the
+/// request nor holds the records in memory besides their input buffer, and a later execution retries the buffer. Once all keys are pinned,
+/// the second pass joins the records and passes them to the child. Records without a matching row are dropped.
+/// As a retried buffer must not emit any record before, the operator opens and closes its child solely in the second pass.
+class AsyncLookupJoinPhysicalOperator final : public PhysicalOperatorConcept
+{
+public:
+    /// Delay until a worker thread retries a buffer that waits for keys
+    static constexpr std::chrono::milliseconds RETRY_INTERVAL{1};
+
+    /// @param bufferRef reads the buffers of the preceding pipeline
+    /// @param streamKeyField names the field of the records that the stream key reads
+    AsyncLookupJoinPhysicalOperator(
+        OperatorHandlerId operatorHandlerId,
+        std::shared_ptr<Interface::BufferRef::TupleBufferRef> bufferRef,
+        PhysicalFunction streamKey,
+        Record::RecordFieldIdentifier streamKeyField,
+        DataType tableKeyType,
+        Schema tableSchema);
+
+    void setup(ExecutionContext& executionCtx, CompilationContext& compilationContext) const override;
+    void open(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const override;
+    void close(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const override;
+    void terminate(ExecutionContext& executionCtx) const override;
+
+    [[nodiscard]] std::optional<PhysicalOperator> getChild() const override;
+    void setChild(PhysicalOperator child) override;
+
+private:
+    void joinRecords(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const;
+
+    OperatorHandlerId operatorHandlerId;
+    std::shared_ptr<Interface::BufferRef::TupleBufferRef> bufferRef;
+    std::vector<Record::RecordFieldIdentifier> keyProjection;
+    LookupTableProbe tableProbe;
+    std::optional<PhysicalOperator> child;
+};
+
+}
@@ -0,0 +1,122 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <expected>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stop_token>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+struct addrinfo;
+
+namespace NES
+{
+
+/// Issues HTTP GET requests on a dedicated I/O thread, c.f., AsyncLookupJoinOperatorHandler. The thread drives up to `maxInFlight`
+/// non-blocking connections via epoll and an eventfd, which wakes it up on new requests and stop requests. Other requests wait in a queue.
+/// It sends HTTP/1.0 requests, thus the server closes the connection after its response and the client never parses a chunked body.
+class HttpLookupClient
+{
+public:
+    struct Response
+    {
+        unsigned statusCode;
+        std::string body;
+    };
+
+    /// Called on the I/O thread with the key of the request and its response or the reason why the request failed
+    using OnResponse = std::function<void(const std::string& key, std::expected<Response, std::string> response)>;
+
+    /// A request without a response within the timeout fails
+    static constexpr std::chrono::seconds REQUEST_TIMEOUT{10};
+
+    /// @param url of the form `http://host[:port]/path`, in which the `{}` is replaced by the key of a request.
+    /// Throws InvalidConfigParameter, if the url is malformed.
+    HttpLookupClient(std::string_view url, size_t maxInFlight, OnResponse onResponse);
+    ~HttpLookupClient();
+
+    HttpLookupClient(const HttpLookupClient&) = delete;
+    HttpLookupClient(HttpLookupClient&&) = delete;
+    HttpLookupClient& operator=(const HttpLookupClient&) = delete;
+    HttpLookupClient& operator=(HttpLookupClient&&) = delete;
+
+    /// Thread-safe. The `urlKey` replaces the `{}` of the url, the response callback receives the `key`.
+    void request(std::string key, std::string_view urlKey);
+
+    /// Replaces the characters of the key that are not allowed in a url by their percent encoding
+    [[nodiscard]] static std::string encodeUrlKey(std::string_view key);
+
+private:
+    struct PendingRequest
+    {
+        std::string key;
+        std::string message;
+    };
+
+    struct AddressDeleter
+    {
+        void operator()(addrinfo* address) const;
+    };
+
+    struct Connection
+    {
+        std::string key;
+        std::string message;
+        int socket{-1};
+        size_t numberOfSentBytes{0};
+        std::string response;
+        std::chrono::steady_clock::time_point deadline;
+    };
+
+    void run(const std::stop_token& stopToken);
+    void wakeUp() const;
+    /// Resolves the host on the I/O thread, such that starting the query does not block on the DNS lookup
+    void resolveHost();
+    void connectPendingRequests();
+    void handleEvent(Connection& connection, uint32_t events);
+    void complete(Connection& connection, std::expected<Response, std::string> response);
+
+    std::string host;
+    std::string port;
+    /// The path, query, and host header of the url before and after the `{}`
+    std::string requestPrefix;
+    std::string requestSuffix;
+    size_t maxInFlight;
+    OnResponse onResponse;
+
+    int epollFd;
+    int wakeUpFd;
+
+    std::mutex pendingRequestsMutex;
+    std::deque<PendingRequest> pendingRequests;
+
+    /// Only accessed by the I/O thread
+    std::vector<std::unique_ptr<Connection>> connections;
+    std::unique_ptr<addrinfo, AddressDeleter> address;
+    std::string resolveError;
+
+    std::jthread thread;
+};
+
+}
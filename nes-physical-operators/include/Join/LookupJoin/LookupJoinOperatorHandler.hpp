@@ -0,0 +1,73 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <stop_token>
+#include <string>
+#include <thread>
+#include <vector>
+#include <DataTypes/Schema.hpp>
+#include <Identifiers/Identifiers.hpp>
+#include <Join/LookupJoin/LookupTable.hpp>
+#include <Runtime/Execution/OperatorHandler.hpp>
+#include <Runtime/QueryTerminationType.hpp>
+
+namespace NES
+{
+
+/// Owns the lookup table of a lookup join, c.f., LookupJoinPhysicalOperator. It loads the table once at the start of the query and reloads
+/// it, whenever the modification time of its file changes. A reload publishes a new immutable table. Thus, a worker thread pins the
+/// current table for a complete buffer, i.e., it never observes a partially reloaded table, and the old table is freed once the last
+/// worker thread pinned a newer one.
+class LookupJoinOperatorHandler final : public OperatorHandler
+{
+public:
+    /// @param reloadInterval specifies how often we check the file for modifications. Zero disables reloading.
+    LookupJoinOperatorHandler(
+        std::filesystem::path filePath, Schema tableSchema, std::string keyFieldName, std::chrono::milliseconds reloadInterval);
+
+    void start(PipelineExecutionContext& pipelineExecutionContext, uint32_t localStateVariableId) override;
+    void stop(QueryTerminationType terminationType, PipelineExecutionContext& pipelineExecutionContext) override;
+
+    /// Keeps the current table alive until the worker thread pins the next one and returns it
+    [[nodiscard]] const LookupTable* pinTable(WorkerThreadId workerThreadId);
+
+private:
+    void reloadLoop(const std::stop_token& stopToken);
+
+    std::filesystem::path filePath;
+    Schema tableSchema;
+    std::string keyFieldName;
+    std::chrono::milliseconds reloadInterval;
+
+    std::once_flag loadedTable;
+    std::atomic<std::shared_ptr<const LookupTable>> table;
+    std::filesystem::file_time_type lastWriteTimeOfTable;
+    /// Each worker thread solely accesses its own entry
+    std::vector<std::shared_ptr<const LookupTable>> pinnedTables;
+
+    std::mutex reloadMutex;
+    std::condition_variable_any reloadCondition;
+    std::jthread reloadThread;
+};
+
+}
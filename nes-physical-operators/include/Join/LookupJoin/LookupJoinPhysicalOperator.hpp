@@ -0,0 +1,55 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <optional>
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Functions/PhysicalFunction.hpp>
+#include <Join/LookupJoin/LookupTableProbe.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <Nautilus/Interface/RecordBuffer.hpp>
+#include <Runtime/Execution/OperatorHandler.hpp>
+#include <CompilationContext.hpp>
+#include <ExecutionContext.hpp>
+#include <PhysicalOperator.hpp>
+
+namespace NES
+{
+
+/// Joins each record with the rows of a static lookup table, c.f., LookupJoinOperatorHandler, whose key equals the key of the record.
+/// In contrast to stream joins, it neither buffers records nor depends on windows or watermarks. Thus, it pipelines with its parent and
+/// child and passes each joined record directly to its child. Records without a matching row are dropped.
+class LookupJoinPhysicalOperator final : public PhysicalOperatorConcept
+{
+public:
+    /// @param tableSchema contains the fields of the table in the order of its file with the names of the joined record
+    LookupJoinPhysicalOperator(OperatorHandlerId operatorHandlerId, PhysicalFunction streamKey, DataType tableKeyType, Schema tableSchema);
+
+    void setup(ExecutionContext& executionCtx, CompilationContext& compilationContext) const override;
+    void open(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const override;
+    void execute(ExecutionContext& executionCtx, Record& record) const override;
+    void terminate(ExecutionContext& executionCtx) const override;
+
+    [[nodiscard]] std::optional<PhysicalOperator> getChild() const override;
+    void setChild(PhysicalOperator child) override;
+
+private:
+    OperatorHandlerId operatorHandlerId;
+    LookupTableProbe tableProbe;
+    std::optional<PhysicalOperator> child;
+};
+
+}
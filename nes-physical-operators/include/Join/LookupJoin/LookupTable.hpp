@@ -0,0 +1,83 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <istream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include <DataTypes/Schema.hpp>
+
+namespace NES
+{
+
+/// Offsets of the fields in a row of a lookup table. Fixed size fields store their value. Variable sized fields store the offset of their
+/// size and content in the variable sized data of the table, as VariableSizedData expects it.
+struct LookupTableLayout
+{
+    explicit LookupTableLayout(const Schema& schema);
+
+    std::vector<uint64_t> fieldOffsets;
+    uint64_t rowSize{0};
+};
+
+/// Immutable table of the records of a static CSV file, which is indexed by its key field, e.g., reference data to enrich a stream with.
+/// It stores the rows of the same key contiguously. Thus, probing a key requires a single hash table lookup and reading its rows does not
+/// chase any pointers. As the table never changes after loading, all worker threads read it without any synchronization.
+class LookupTable
+{
+public:
+    /// The rows of a key, which are stored one after the other
+    struct Rows
+    {
+        const int8_t* firstRow;
+        uint64_t numberOfRows;
+    };
+
+    /// Parses each non-empty line of the file as a comma separated record of the schema.
+    /// Throws CannotOpenSource, if the file cannot be read, and CannotFormatMalformedStringValue, if a line does not match the schema.
+    LookupTable(const std::filesystem::path& filePath, const Schema& schema, const std::string& keyFieldName);
+    /// Parses the lines of the stream in the same way, e.g., a response of an external service. `tableName` solely names it in errors.
+    LookupTable(std::istream& lines, std::string_view tableName, const Schema& schema, const std::string& keyFieldName);
+
+    /// Returns the rows of the key or nullptr, if the table contains no row with the key.
+    /// The key consists of the bytes of a fixed size value or of the content of a variable sized value.
+    [[nodiscard]] const Rows* find(std::string_view key) const;
+
+    [[nodiscard]] const int8_t* getVariableSizedData() const;
+    [[nodiscard]] uint64_t getNumberOfRows() const;
+
+private:
+    /// Allows looking up a std::string_view without constructing a std::string
+    struct KeyHash
+    {
+        using is_transparent = void;
+        size_t operator()(const std::string_view key) const { return std::hash<std::string_view>{}(key); }
+    };
+
+    void load(std::istream& lines, std::string_view tableName, const Schema& schema, const std::string& keyFieldName);
+
+    LookupTableLayout layout;
+    std::vector<int8_t> rows;
+    std::vector<int8_t> variableSizedData;
+    std::unordered_map<std::string, Rows, KeyHash, std::equal_to<>> rowsOfKey;
+};
+
+}
@@ -0,0 +1,64 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Functions/PhysicalFunction.hpp>
+#include <Join/LookupJoin/LookupTable.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <ExecutionContext.hpp>
+#include <val_ptr.hpp>
+
+namespace NES
+{
+
+/// Joins records with the rows of their keys in a lookup table. Shared by the lookup joins with a static table, c.f.,
+/// LookupJoinPhysicalOperator, and with an external table, c.f., AsyncLookupJoinPhysicalOperator.
+class LookupTableProbe
+{
+public:
+    /// The key of a record as the lookup table indexes it, i.e., the bytes of a fixed size value or the content of a variable sized value
+    struct Key
+    {
+        nautilus::val<int8_t*> content;
+        nautilus::val<uint64_t> size;
+    };
+
+    /// @param tableSchema contains the fields of the table in the order of its file with the names of the joined record
+    LookupTableProbe(PhysicalFunction streamKey, DataType tableKeyType, Schema tableSchema);
+
+    [[nodiscard]] Key readKey(ExecutionContext& executionCtx, Record& record) const;
+
+    /// Calls `emit` with a copy of the record for each row of the key in the table, to which it appended the fields of the row
+    void probe(
+        const nautilus::val<const LookupTable*>& table,
+        const nautilus::val<int8_t*>& variableSizedData,
+        const Key& key,
+        const Record& record,
+        const std::function<void(Record&)>& emit) const;
+
+    [[nodiscard]] static nautilus::val<int8_t*> getVariableSizedData(const nautilus::val<const LookupTable*>& table);
+
+private:
+    PhysicalFunction streamKey;
+    DataType tableKeyType;
+    Schema tableSchema;
+    LookupTableLayout tableLayout;
+};
+
+}
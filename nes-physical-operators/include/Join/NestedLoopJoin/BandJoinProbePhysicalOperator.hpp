@@ -0,0 +1,90 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <Functions/PhysicalFunction.hpp>
+#include <Join/NestedLoopJoin/NLJProbePhysicalOperator.hpp>
+#include <Join/StreamJoinUtil.hpp>
+#include <Nautilus/Interface/BufferRef/TupleBufferRef.hpp>
+#include <Nautilus/Interface/PagedVector/PagedVectorRef.hpp>
+#include <Runtime/Execution/OperatorHandler.hpp>
+#include <Time/Timestamp.hpp>
+#include <Windowing/WindowMetaData.hpp>
+#include <ExecutionContext.hpp>
+#include <val.hpp>
+
+namespace NES
+{
+
+/// Band value and position of a record in its paged vector, which the band join sorts by the band value
+struct BandJoinSortEntry
+{
+    double bandValue;
+    uint64_t position;
+};
+
+/// Sorts the entries by their band value and moves entries, whose band value is NaN, to the end, as they never satisfy the band.
+/// Returns the number of entries with a band value other than NaN.
+uint64_t sortBandJoinEntriesProxy(BandJoinSortEntry* entries, uint64_t numberOfEntries);
+
+/// Probe of a sort-merge band join, whose join function bounds the difference of an attribute of both sides, e.g.,
+/// left.ts BETWEEN right.ts - 5 AND right.ts + 5. It reuses the slices of the NLJ build.
+/// Instead of comparing all pairs of records, the probe sorts the records of both sides by their band attribute and sweeps over both
+/// sorted sides. For each left record, the right records within the band form a range, whose start only moves forward for increasing left
+/// band values. Thus, the probe costs O(n log n + m log m) plus the number of candidates in the band instead of O(n * m).
+/// The band values are compared as FLOAT64 and the probe evaluates the complete join function for each candidate.
+class BandJoinProbePhysicalOperator final : public NLJProbePhysicalOperator
+{
+public:
+    /// Expects that lowerBound <= leftBand - rightBand <= upperBound holds for all pairs of records that satisfy the join function
+    BandJoinProbePhysicalOperator(
+        OperatorHandlerId operatorHandlerId,
+        PhysicalFunction joinFunction,
+        WindowMetaData windowMetaData,
+        const JoinSchema& joinSchema,
+        std::shared_ptr<TupleBufferRef> leftMemoryProvider,
+        std::shared_ptr<TupleBufferRef> rightMemoryProvider,
+        PhysicalFunction leftBandFunction,
+        PhysicalFunction rightBandFunction,
+        double lowerBound,
+        double upperBound);
+
+protected:
+    void joinPagedVectors(
+        const Interface::PagedVectorRef& leftPagedVector,
+        const Interface::PagedVectorRef& rightPagedVector,
+        ExecutionContext& executionCtx,
+        const nautilus::val<Timestamp>& windowStart,
+        const nautilus::val<Timestamp>& windowEnd) const override;
+
+private:
+    /// Writes the sort entries of all records of the paged vector to the arena and sorts them by their band value.
+    /// Returns the sort entries and the number of entries with a band value other than NaN.
+    std::pair<nautilus::val<int8_t*>, nautilus::val<uint64_t>> sortByBandValue(
+        const Interface::PagedVectorRef& pagedVector,
+        const TupleBufferRef& memoryProvider,
+        const PhysicalFunction& bandFunction,
+        ExecutionContext& executionCtx) const;
+
+    PhysicalFunction leftBandFunction;
+    PhysicalFunction rightBandFunction;
+    double lowerBound;
+    double upperBound;
+};
+
+}
@@ -30,9 +30,13 @@ namespace NES
 using namespace Interface::BufferRef;
 
 /// Performs the second phase of the join. The tuples are joined via two nested loops.
-class NLJProbePhysicalOperator final : public StreamJoinProbePhysicalOperator
+class NLJProbePhysicalOperator : public StreamJoinProbePhysicalOperator
 {
 public:
+    /// Size of the block of outer records that we join with every scan over the inner records. Half of a typical L1 data cache keeps the
+    /// block cached, while the scan streams the inner records through the remaining cache.
+    static constexpr uint64_t OUTER_BLOCK_SIZE_IN_BYTES = 16 * 1024;
+
     NLJProbePhysicalOperator(
         OperatorHandlerId operatorHandlerId,
         PhysicalFunction joinFunction,
@@ -44,6 +48,15 @@ public:
     void open(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const override;
 
 protected:
+    /// Joins all records of the left and the right paged vector of a window
+    virtual void joinPagedVectors(
+        const Interface::PagedVectorRef& leftPagedVector,
+        const Interface::PagedVectorRef& rightPagedVector,
+        ExecutionContext& executionCtx,
+        const nautilus::val<Timestamp>& windowStart,
+        const nautilus::val<Timestamp>& windowEnd) const;
+
+    /// Joins the records block-wise, c.f., OUTER_BLOCK_SIZE_IN_BYTES
     void performNLJ(
         const Interface::PagedVectorRef& outerPagedVector,
         const Interface::PagedVectorRef& innerPagedVector,
@@ -15,7 +15,10 @@
 #pragma once
 
 #include <cstdint>
+#include <cstdio>
+#include <filesystem>
 #include <memory>
+#include <mutex>
 #include <vector>
 #include <Identifiers/Identifiers.hpp>
 #include <Join/StreamJoinUtil.hpp>
@@ -45,9 +48,23 @@ public:
     /// Moves all tuples in this slice to the PagedVector at 0th index on both sides.
     void combinePagedVectors();
 
+    [[nodiscard]] uint64_t getStateSizeInBytes() const override;
+    /// Once the PagedVectors are combined, the first worker thread owns the state of the slice
+    void addStateSizeInBytesPerWorkerThread(std::vector<uint64_t>& stateSizeInBytesPerWorkerThread) const override;
+    /// Spills the pages of all PagedVectors into one file. PagedVectors with variable sized data stay in memory.
+    uint64_t spillState(const std::filesystem::path& spillDirectory) override;
+    void reloadState(AbstractBufferProvider* bufferProvider) override;
+    /// Writes the pages of all PagedVectors. Fails for spilled slices and for PagedVectors with variable sized data.
+    bool writeCheckpoint(std::FILE* file) override;
+    /// Distributes the checkpointed PagedVectors over the PagedVectors of this slice, as the number of worker threads might have changed
+    void readCheckpoint(std::FILE* file, AbstractBufferProvider* bufferProvider) override;
+
 private:
     std::vector<std::unique_ptr<Nautilus::Interface::PagedVector>> leftPagedVectors;
     std::vector<std::unique_ptr<Nautilus::Interface::PagedVector>> rightPagedVectors;
     std::mutex combinePagedVectorsMutex;
+    /// Guards the spill file, as multiple worker threads might reload the slice for different windows at the same time
+    std::mutex spillMutex;
+    SpillFile spillFile{nullptr, &std::fclose};
 };
 }
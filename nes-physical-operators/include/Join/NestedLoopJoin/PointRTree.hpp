@@ -0,0 +1,76 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <span>
+
+namespace NES
+{
+
+/// Static R-tree over points with a timestamp, which the STBox join builds over the records of a slice when a window triggers.
+/// The tree is packed by Sort-Tile-Recursive (STR): the points are sorted by x into vertical slabs, each slab is sorted by y and cut into
+/// leaves of NODE_CAPACITY points. The levels above pack the nodes below in the same way by their centers. Thus, all nodes are full apart
+/// from the last one of each level, the leaves barely overlap, and a range query visits only the leaves that intersect the range.
+/// The tree does not allocate, as the entries and the nodes live in caller-provided memory, e.g., the arena of the probe.
+class PointRTree
+{
+public:
+    static constexpr uint64_t NODE_CAPACITY = 16;
+
+    /// Coordinates of a point and the position of its record, e.g., in the paged vector of a slice
+    struct Entry
+    {
+        double x;
+        double y;
+        int64_t t;
+        uint64_t position;
+    };
+
+    /// Inclusive bounds in all three dimensions
+    struct Range
+    {
+        double xmin;
+        double ymin;
+        double xmax;
+        double ymax;
+        int64_t tmin;
+        int64_t tmax;
+    };
+
+    /// Minimum bounding range of the children of the node. The children of a leaf are the entries [begin, end), the children of an inner
+    /// node are the nodes [begin, end).
+    struct Node
+    {
+        Range bounds;
+        uint64_t begin;
+        uint64_t end;
+        bool isLeaf;
+    };
+
+    /// Number of nodes of the tree over the given number of entries, the memory for the nodes must hold as many
+    [[nodiscard]] static uint64_t getNumberOfNodes(uint64_t numberOfEntries);
+
+    /// Reorders the entries and writes the nodes, which must hold getNumberOfNodes(entries.size()) nodes. Returns the number of written
+    /// nodes, the last one is the root. Entries with a NaN coordinate never lie within a range, thus the tree leaves them out.
+    static uint64_t build(std::span<Entry> entries, std::span<Node> nodes);
+
+    /// Writes the positions of all entries within the range to `positions` and returns their number.
+    /// `nodes` are the nodes that build wrote and `positions` must hold as many positions as there are entries.
+    [[nodiscard]] static uint64_t
+    query(std::span<const Entry> entries, std::span<const Node> nodes, const Range& range, std::span<uint64_t> positions);
+};
+
+}
@@ -0,0 +1,91 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <Functions/PhysicalFunction.hpp>
+#include <Join/NestedLoopJoin/NLJProbePhysicalOperator.hpp>
+#include <Join/NestedLoopJoin/PointRTree.hpp>
+#include <Join/StreamJoinUtil.hpp>
+#include <Nautilus/Interface/BufferRef/TupleBufferRef.hpp>
+#include <Nautilus/Interface/PagedVector/PagedVectorRef.hpp>
+#include <Runtime/Execution/OperatorHandler.hpp>
+#include <Time/Timestamp.hpp>
+#include <Windowing/WindowMetaData.hpp>
+#include <ExecutionContext.hpp>
+#include <MEOSWrapper.hpp>
+#include <val.hpp>
+
+namespace NES
+{
+
+/// Converts the epoch timestamps of the entries to MEOS timestamps and builds the R-tree over the entries.
+/// Returns the number of nodes of the tree.
+uint64_t buildStBoxJoinIndexProxy(
+    PointRTree::Entry* entries, uint64_t numberOfEntries, PointRTree::Node* nodes, MEOS::Meos::EpochConverter* epochConverter);
+
+/// Writes the positions of the points within the bounds of the STBox to `positions` and returns their number.
+/// An STBox that MEOS cannot parse contains no points.
+uint64_t queryStBoxJoinIndexProxy(
+    const PointRTree::Entry* entries,
+    uint64_t numberOfEntries,
+    const PointRTree::Node* nodes,
+    uint64_t numberOfNodes,
+    const char* stbox,
+    uint32_t stboxSize,
+    uint64_t* positions);
+
+/// Probe of a join, whose join function clips the points of one side to the STBoxes of the other side, i.e.,
+/// TGEO_AT_STBOX(lon, lat, timestamp, stbox) = INT32(1), e.g., for assigning positions to tiles or time slots. It reuses the slices of the
+/// NLJ build. Instead of evaluating the join function with one MEOS call for all pairs of points and boxes, the probe builds a PointRTree
+/// over the points of the window once it triggers, and queries the tree with the bounds of each box. Thus, the probe evaluates the complete
+/// join function solely for the points within the bounds of a box and costs O(n log n + m log n) plus the number of candidates.
+class StBoxJoinProbePhysicalOperator final : public NLJProbePhysicalOperator
+{
+public:
+    StBoxJoinProbePhysicalOperator(
+        OperatorHandlerId operatorHandlerId,
+        PhysicalFunction joinFunction,
+        WindowMetaData windowMetaData,
+        const JoinSchema& joinSchema,
+        std::shared_ptr<TupleBufferRef> leftMemoryProvider,
+        std::shared_ptr<TupleBufferRef> rightMemoryProvider,
+        JoinBuildSideType pointSide,
+        PhysicalFunction lonFunction,
+        PhysicalFunction latFunction,
+        PhysicalFunction timestampFunction,
+        PhysicalFunction stboxFunction);
+
+protected:
+    void joinPagedVectors(
+        const Interface::PagedVectorRef& leftPagedVector,
+        const Interface::PagedVectorRef& rightPagedVector,
+        ExecutionContext& executionCtx,
+        const nautilus::val<Timestamp>& windowStart,
+        const nautilus::val<Timestamp>& windowEnd) const override;
+
+private:
+    /// The side whose records provide the points, the records of the other side provide the STBoxes
+    JoinBuildSideType pointSide;
+    PhysicalFunction lonFunction;
+    PhysicalFunction latFunction;
+    PhysicalFunction timestampFunction;
+    PhysicalFunction stboxFunction;
+    /// Shared by the copies of the probe, thus the unit of the timestamps is detected once per query
+    std::shared_ptr<MEOS::Meos::EpochConverter> epochConverter = std::make_shared<MEOS::Meos::EpochConverter>();
+};
+
+}
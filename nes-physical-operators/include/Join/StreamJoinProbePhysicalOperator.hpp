@@ -19,6 +19,8 @@
 #include <vector>
 #include <Functions/PhysicalFunction.hpp>
 #include <Join/StreamJoinUtil.hpp>
+#include <Nautilus/Interface/BufferRef/TupleBufferRef.hpp>
+#include <Nautilus/Interface/PagedVector/PagedVectorRef.hpp>
 #include <Nautilus/Interface/Record.hpp>
 #include <Nautilus/Interface/RecordBuffer.hpp>
 #include <Runtime/Execution/OperatorHandler.hpp>
@@ -48,6 +50,18 @@ protected:
         const std::vector<Record::RecordFieldIdentifier>& projectionsOuter,
         const std::vector<Record::RecordFieldIdentifier>& projectionsInner) const;
 
+    /// Returns the fields, which the join function reads, i.e., the key fields of the memory provider or all fields, if it has none.
+    /// Probes solely read these fields for evaluating the join function and materialize the remaining fields for matches only.
+    static std::vector<Record::RecordFieldIdentifier> getJoinFunctionFields(const Interface::BufferRef::TupleBufferRef& memoryProvider);
+    static std::vector<Record::RecordFieldIdentifier> getRemainingFields(const Interface::BufferRef::TupleBufferRef& memoryProvider);
+
+    /// Writes the fields of the record at the position in the paged vector to the joined record
+    static void materializeFields(
+        Record& joinedRecord,
+        const Interface::PagedVectorRef& pagedVector,
+        const nautilus::val<uint64_t>& pos,
+        const std::vector<Record::RecordFieldIdentifier>& fields);
+
     PhysicalFunction joinFunction;
     JoinSchema joinSchema;
 };
@@ -33,6 +33,9 @@ public:
     [[nodiscard]] std::optional<PhysicalOperator> getChild() const override;
     void setChild(PhysicalOperator child) override;
 
+    [[nodiscard]] const Record::RecordFieldIdentifier& getFieldToWriteTo() const;
+    [[nodiscard]] const PhysicalFunction& getMapFunction() const;
+
 private:
     Record::RecordFieldIdentifier fieldToWriteTo;
     PhysicalFunction mapFunction;
@@ -0,0 +1,75 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
+
+namespace NES
+{
+
+/// Counts the cycles that a compiled pipeline spends in each of its physical operators, c.f., `profile_operators`.
+/// The compilation wraps the open, execute, and close calls of every operator with reads of the cycle counter. As these calls of an
+/// operator invoke the ones of its child, the cycles of an operator include the cycles of its descendants. The exclusive cycles subtract
+/// the cycles of the child, thus they attribute every cycle to a single operator.
+/// The worker threads record concurrently. As a profile solely requires approximate shares, the counters are relaxed atomics.
+/// @note Each read of the cycle counter is a call of a proxy function, thus profiling inflates the cycles of operators that are invoked
+/// per record, but preserves which operators dominate the pipeline.
+class OperatorProfile
+{
+public:
+    struct OperatorCycles
+    {
+        OperatorId operatorId = INVALID_OPERATOR_ID;
+        std::string name;
+        uint64_t numberOfInvocations = 0;
+        uint64_t inclusiveCycles = 0;
+        uint64_t exclusiveCycles = 0;
+    };
+
+    /// The operators of the pipeline from its root to its last child, with the names under which the profile reports them
+    OperatorProfile(PipelineId pipelineId, const std::vector<std::pair<OperatorId, std::string>>& operators);
+
+    /// Returns the counter of an operator of the pipeline, or nullopt for operators of other pipelines
+    [[nodiscard]] std::optional<size_t> counterOf(OperatorId operatorId) const;
+    void record(size_t counter, uint64_t cycles);
+
+    /// Reads the time stamp counter on x86-64 and the virtual counter on ARM64, otherwise the steady clock in nanoseconds
+    [[nodiscard]] static uint64_t readCycleCounter();
+
+    [[nodiscard]] std::vector<OperatorCycles> getOperatorCycles() const;
+    /// Names the operators like `Pipeline3::Selection`, sorted by descending exclusive cycles
+    [[nodiscard]] std::string toString() const;
+
+private:
+    struct Counter
+    {
+        OperatorId operatorId = INVALID_OPERATOR_ID;
+        std::string name;
+        std::atomic<uint64_t> numberOfInvocations{0};
+        std::atomic<uint64_t> cycles{0};
+    };
+
+    PipelineId pipelineId;
+    std::vector<Counter> counters;
+};
+
+}
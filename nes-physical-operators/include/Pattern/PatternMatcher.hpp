@@ -0,0 +1,115 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include <Time/Timestamp.hpp>
+
+namespace NES
+{
+
+/// Matches a pattern, i.e., a sequence of steps over events, per key with a linear nondeterministic finite automaton. A partial match,
+/// i.e., a run of the automaton, stores solely the step it waits for and the progress within the step. Thus, a record advances all runs of
+/// its key in a single pass, instead of storing and joining all records of the key.
+/// Each record, which matches the first step, starts a new run. Runs skip records that do not advance them, i.e., skip-till-next-match.
+/// An iteration, whose minimum is reached, prefers to advance to the next step. A run, whose first event is more than `within` before the
+/// current record, has timed out. The matcher is not thread-safe.
+class PatternMatcher
+{
+public:
+    struct Step
+    {
+        enum class Type : uint8_t
+        {
+            /// Matches a single event, or any event of the mask
+            ANY,
+            /// Matches every event of the mask once in any order
+            ALL,
+            /// Matches the single event of the mask between minimum and maximum times
+            ITERATION,
+        };
+
+        Type type = Type::ANY;
+        /// Bit i of the mask is set, if the step matches event i
+        uint64_t events = 0;
+        uint64_t minimumRepetitions = 1;
+        std::optional<uint64_t> maximumRepetitions = 1;
+    };
+
+    /// The timestamps of the first and the last event of a complete match
+    struct Match
+    {
+        Timestamp start;
+        Timestamp end;
+        uint64_t numberOfEvents;
+    };
+
+    /// A record matches the events of a bitmask
+    static constexpr size_t MAX_NUMBER_OF_EVENTS = 64;
+    /// Starting further runs of a key drops its oldest runs
+    static constexpr size_t DEFAULT_MAX_RUNS_PER_KEY = 1024;
+
+    PatternMatcher(std::vector<Step> steps, uint64_t within, size_t maxRunsPerKey = DEFAULT_MAX_RUNS_PER_KEY);
+
+    /// Advances the runs of the key by a record, which matched the events of the `matchedEvents` mask.
+    /// Appends the matches that the record completed to `matches`.
+    void advance(std::string_view key, uint64_t matchedEvents, Timestamp timestamp, std::vector<Match>& matches);
+
+    /// Removes all runs, which time out before the watermark. As no future record precedes the watermark, they can never complete.
+    void collectGarbage(Timestamp watermark);
+
+    [[nodiscard]] size_t getNumberOfKeys() const;
+    [[nodiscard]] size_t getNumberOfRuns() const;
+    [[nodiscard]] uint64_t getNumberOfDroppedRuns() const;
+    [[nodiscard]] uint64_t getStateSizeInBytes() const;
+
+private:
+    struct Run
+    {
+        size_t step = 0;
+        /// The number of repetitions of an iteration or the mask of the already matched events of a conjunction
+        uint64_t progress = 0;
+        Timestamp start = Timestamp(Timestamp::INITIAL_VALUE);
+        Timestamp last = Timestamp(Timestamp::INITIAL_VALUE);
+        uint64_t numberOfEvents = 0;
+    };
+
+    /// Returns true, if the record advanced the run
+    [[nodiscard]] bool tryAdvance(Run& run, uint64_t matchedEvents, Timestamp timestamp) const;
+    [[nodiscard]] bool hasTimedOut(const Run& run, Timestamp timestamp) const;
+
+    /// Allows looking up a std::string_view without constructing a std::string
+    struct KeyHash
+    {
+        using is_transparent = void;
+        size_t operator()(const std::string_view key) const { return std::hash<std::string_view>{}(key); }
+    };
+
+    std::vector<Step> steps;
+    uint64_t within;
+    size_t maxRunsPerKey;
+    std::unordered_map<std::string, std::vector<Run>, KeyHash, std::equal_to<>> runsOfKey;
+    size_t numberOfRuns = 0;
+    uint64_t numberOfDroppedRuns = 0;
+};
+
+}
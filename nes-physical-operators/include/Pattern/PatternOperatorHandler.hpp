@@ -0,0 +1,74 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
+#include <Pattern/PatternMatcher.hpp>
+#include <Runtime/Execution/OperatorHandler.hpp>
+#include <Runtime/QueryTerminationType.hpp>
+#include <Time/Timestamp.hpp>
+
+namespace NES
+{
+
+/// Owns the partial matches of a pattern, c.f., PatternPhysicalOperator. The keys are distributed over stripes, each of which is a
+/// PatternMatcher behind its own lock, such that worker threads solely contend for the lock, if they process keys of the same stripe.
+/// The matches that a record completes are buffered per worker thread until the worker thread advances the pattern by its next record.
+class PatternOperatorHandler final : public OperatorHandler
+{
+public:
+    static constexpr size_t NUMBER_OF_STRIPES = 64;
+
+    PatternOperatorHandler(std::vector<PatternMatcher::Step> steps, uint64_t withinMs);
+
+    void start(PipelineExecutionContext& pipelineExecutionContext, uint32_t localStateVariableId) override;
+    void stop(QueryTerminationType terminationType, PipelineExecutionContext& pipelineExecutionContext) override;
+    [[nodiscard]] uint64_t getStateSizeInBytes() const override;
+
+    /// Advances the partial matches of the key by a record and returns the number of matches that the record completed
+    [[nodiscard]] uint64_t advance(WorkerThreadId workerThreadId, std::string_view key, uint64_t matchedEvents, Timestamp timestamp);
+    [[nodiscard]] const PatternMatcher::Match& getMatch(WorkerThreadId workerThreadId, uint64_t matchIndex) const;
+
+    /// Removes the partial matches that time out before the watermark. As this visits all keys, it runs at most once per `withinMs`.
+    void collectGarbage(Timestamp watermark);
+
+private:
+    struct Stripe
+    {
+        explicit Stripe(PatternMatcher matcher) : matcher(std::move(matcher)) { }
+
+        mutable std::mutex mutex;
+        PatternMatcher matcher;
+    };
+
+    uint64_t withinMs;
+    std::vector<std::unique_ptr<Stripe>> stripes;
+
+    std::once_flag allocatedMatches;
+    /// Each worker thread solely accesses its own entry
+    std::vector<std::vector<PatternMatcher::Match>> matchesOfWorker;
+
+    std::atomic<Timestamp::Underlying> lastGarbageCollection{Timestamp::INITIAL_VALUE};
+};
+
+}
@@ -0,0 +1,80 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+#include <DataTypes/DataType.hpp>
+#include <Functions/PhysicalFunction.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <Nautilus/Interface/RecordBuffer.hpp>
+#include <Runtime/Execution/OperatorHandler.hpp>
+#include <Watermark/TimeFunction.hpp>
+#include <nautilus/val.hpp>
+#include <CompilationContext.hpp>
+#include <ExecutionContext.hpp>
+#include <PhysicalOperator.hpp>
+
+namespace NES
+{
+
+/// Detects a pattern of events per partition key, c.f., PatternOperatorHandler. The operator evaluates the predicates of all events of a
+/// record into a bitmask. Solely records that match at least one event advance the partial matches of their key. For every match that a
+/// record completes, the operator passes a record with the timestamps of the first and the last event and the partition keys to its child.
+/// The operator pipelines with its parent and child. It advances the partial matches in the order in which it processes the records, thus
+/// an out-of-order stream should be sorted by its event time before, e.g., by an EventTimeSortLogicalOperator.
+class PatternPhysicalOperator final : public PhysicalOperatorConcept
+{
+public:
+    struct PartitionKey
+    {
+        std::string fieldName;
+        DataType dataType;
+    };
+
+    PatternPhysicalOperator(
+        OperatorHandlerId operatorHandlerId,
+        std::vector<PhysicalFunction> eventPredicates,
+        std::vector<PartitionKey> partitionKeys,
+        EventTimeFunction timeFunction,
+        std::string startFieldName,
+        std::string endFieldName);
+
+    void setup(ExecutionContext& executionCtx, CompilationContext& compilationContext) const override;
+    void open(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const override;
+    void execute(ExecutionContext& executionCtx, Record& record) const override;
+    void close(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const override;
+    void terminate(ExecutionContext& executionCtx) const override;
+
+    [[nodiscard]] std::optional<PhysicalOperator> getChild() const override;
+    void setChild(PhysicalOperator child) override;
+
+private:
+    /// Writes the bytes of the partition keys of the record into the arena, each variable sized key is prefixed by its size
+    [[nodiscard]] std::pair<nautilus::val<int8_t*>, nautilus::val<uint64_t>> writeKey(ExecutionContext& executionCtx, Record& record) const;
+
+    OperatorHandlerId operatorHandlerId;
+    std::vector<PhysicalFunction> eventPredicates;
+    std::vector<PartitionKey> partitionKeys;
+    EventTimeFunction timeFunction;
+    std::string startFieldName;
+    std::string endFieldName;
+    std::optional<PhysicalOperator> child;
+};
+
+}
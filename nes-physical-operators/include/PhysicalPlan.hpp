@@ -13,11 +13,13 @@
 */
 #pragma once
 
+#include <chrono>
 #include <cstdint>
 #include <memory>
 #include <ostream>
 #include <string>
 #include <vector>
+#include <DataTypes/Schema.hpp>
 #include <Identifiers/Identifiers.hpp>
 #include <Util/ExecutionMode.hpp>
 #include <Util/Logger/Formatter.hpp>
@@ -40,17 +42,33 @@ public:
     [[nodiscard]] const Roots& getRootOperators() const;
     [[nodiscard]] ExecutionMode getExecutionMode() const;
     [[nodiscard]] uint64_t getOperatorBufferSize() const;
+    /// Milliseconds, for which emits that feed a sink coalesce records. Zero disables the coalescing.
+    [[nodiscard]] std::chrono::milliseconds getEmitCoalescingMaxDelay() const;
+    /// Milliseconds, which a task waits in the task queue before the buffers it emits are compressed. Zero disables the compression.
+    [[nodiscard]] std::chrono::milliseconds getBufferCompressionDelay() const;
+    /// Memory layout of the buffers that are passed between pipelines
+    [[nodiscard]] Schema::MemoryLayoutType getOperatorMemoryLayout() const;
 
 private:
     QueryId queryId;
     Roots rootOperators;
     ExecutionMode executionMode;
     uint64_t operatorBufferSize;
+    std::chrono::milliseconds emitCoalescingMaxDelay;
+    std::chrono::milliseconds bufferCompressionDelay;
+    Schema::MemoryLayoutType operatorMemoryLayout;
 
     [[nodiscard]] std::string toString() const;
 
     friend class PhysicalPlanBuilder;
-    PhysicalPlan(QueryId id, Roots rootOperators, ExecutionMode executionMode, uint64_t operatorBufferSize);
+    PhysicalPlan(
+        QueryId id,
+        Roots rootOperators,
+        ExecutionMode executionMode,
+        uint64_t operatorBufferSize,
+        std::chrono::milliseconds emitCoalescingMaxDelay,
+        std::chrono::milliseconds bufferCompressionDelay,
+        Schema::MemoryLayoutType operatorMemoryLayout);
 };
 }
 
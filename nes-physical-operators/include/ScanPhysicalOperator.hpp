@@ -14,12 +14,16 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <optional>
 #include <vector>
+#include <Functions/VectorizedPredicate.hpp>
+#include <MemoryLayout/MemoryLayout.hpp>
 #include <Nautilus/Interface/BufferRef/TupleBufferRef.hpp>
 #include <Nautilus/Interface/Record.hpp>
 #include <Nautilus/Interface/RecordBuffer.hpp>
+#include <Watermark/VectorizedMaxTimestamp.hpp>
 #include <PhysicalOperator.hpp>
 
 namespace NES
@@ -27,6 +31,11 @@ namespace NES
 
 /// @brief This basic scan operator extracts records from a base tuple buffer according to a memory layout.
 /// Furthermore, it supports projection push down to eliminate unneeded reads
+/// If the child is a selection with a vectorized predicate, the scan evaluates the predicate over the whole buffer into a selection vector
+/// and only reads the qualifying records. Each directly following selection with a vectorized predicate refines the selection vector,
+/// thus it solely evaluates the records that passed the previous selections.
+/// If an event-time watermark assigner follows the scan or its vectorized selections, the scan computes the maximum timestamp of the
+/// (qualifying) records at once and skips the assigner for every record.
 class ScanPhysicalOperator final : public PhysicalOperatorConcept
 {
 public:
@@ -40,10 +49,26 @@ public:
     [[nodiscard]] std::optional<PhysicalOperator> getChild() const override;
     void setChild(PhysicalOperator child) override;
 
+    /// Memory layout of the buffers the scan reads, i.e., the layout that the producer of the input buffers has to write
+    [[nodiscard]] std::shared_ptr<MemoryLayout> getMemoryLayout() const;
+
+    /// Fields of the buffers that the scan reads. Its successors never access any other field.
+    [[nodiscard]] const std::vector<Record::RecordFieldIdentifier>& getProjections() const;
+
 private:
+    void openWithVectorizedSelection(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const;
+
     std::shared_ptr<Interface::BufferRef::TupleBufferRef> bufferRef;
     std::vector<Record::RecordFieldIdentifier> projections;
     std::optional<PhysicalOperator> child;
+    /// Predicates of the chain of vectorizable selections after the scan, bound to its memory layout. Empty, if the child is not a
+    /// vectorizable selection.
+    std::shared_ptr<const std::vector<VectorizedPredicate>> vectorizedSelections;
+    /// Number of selections that the scan evaluates
+    size_t numberOfVectorizedSelections = 0;
+    /// Timestamp field of the event-time watermark assigner after the selections, bound to the memory layout of the scan.
+    /// nullptr, if there is no such assigner or its timestamp is not an integer field.
+    std::shared_ptr<const VectorizedMaxTimestamp> vectorizedWatermark;
 };
 
 }
@@ -13,27 +13,48 @@
 */
 #pragma once
 
+#include <cstddef>
+#include <memory>
 #include <optional>
+#include <span>
 #include <utility>
+#include <vector>
 #include <Functions/PhysicalFunction.hpp>
+#include <Functions/VectorizedPredicate.hpp>
 #include <Nautilus/Interface/Record.hpp>
 #include <PhysicalOperator.hpp>
+#include <SelectivityProfile.hpp>
 
 namespace NES
 {
 
-/// @brief Selection operator that evaluates a boolean function on each record.
+/// @brief Selection operator that evaluates the conjunction of boolean functions on each record.
+/// If the predicate can be vectorized, a preceding scan evaluates it over whole buffers instead and only passes qualifying records to
+/// the child of the selection.
+/// While the tiered execution interprets the pipeline, the selection evaluates every conjunct and records its pass rate in the profile.
+/// The compiled pipeline evaluates the conjuncts in ascending order of their pass rates and stops at the first conjunct that fails.
 class SelectionPhysicalOperator final : public PhysicalOperatorConcept
 {
 public:
-    explicit SelectionPhysicalOperator(PhysicalFunction function) : function(std::move(std::move(function))) { };
+    explicit SelectionPhysicalOperator(
+        std::vector<PhysicalFunction> conjuncts, std::shared_ptr<const VectorizedPredicate> vectorizedPredicate = nullptr);
     void execute(ExecutionContext& ctx, Record& record) const override;
 
     [[nodiscard]] std::optional<PhysicalOperator> getChild() const override;
     void setChild(PhysicalOperator child) override;
 
+    /// nullptr, if the predicate must be evaluated per record
+    [[nodiscard]] const std::shared_ptr<const VectorizedPredicate>& getVectorizedPredicate() const;
+
 private:
-    const PhysicalFunction function;
+    void executeAndProfile(ExecutionContext& ctx, Record& record) const;
+    /// Evaluates the conjuncts in the order and calls the child, if all of them pass
+    void executeConjuncts(ExecutionContext& ctx, Record& record, std::span<const size_t> order) const;
+
+    std::vector<PhysicalFunction> conjuncts;
+    /// Shared by the copies of the operator, thus the interpreted and the compiled pipeline use the same profile
+    std::shared_ptr<SelectivityProfile> profile;
+    std::shared_ptr<const VectorizedPredicate> vectorizedPredicate;
     std::optional<PhysicalOperator> child;
 };
 }
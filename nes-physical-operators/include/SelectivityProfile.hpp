@@ -0,0 +1,52 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace NES
+{
+
+/// Counts how many records pass each conjunct of a selection, while the tiered execution interprets the pipeline.
+/// The compilation then evaluates the conjuncts in ascending order of their pass rate, thus the most selective conjunct rejects the records
+/// before the others are evaluated.
+/// The worker threads record concurrently. As the order solely requires approximate pass rates, the counters are relaxed atomics.
+class SelectivityProfile
+{
+public:
+    explicit SelectivityProfile(size_t numberOfConjuncts);
+
+    void record(size_t conjunct, bool passed);
+
+    [[nodiscard]] uint64_t getNumberOfEvaluations(size_t conjunct) const;
+    /// Returns 1, if the conjunct was not evaluated yet
+    [[nodiscard]] double getPassRate(size_t conjunct) const;
+
+    /// Returns the conjuncts in ascending order of their pass rate. Conjuncts with equal pass rates keep the order of the query.
+    [[nodiscard]] std::vector<size_t> getEvaluationOrder() const;
+
+private:
+    struct Counter
+    {
+        std::atomic<uint64_t> evaluated{0};
+        std::atomic<uint64_t> passed{0};
+    };
+
+    std::vector<Counter> counters;
+};
+
+}
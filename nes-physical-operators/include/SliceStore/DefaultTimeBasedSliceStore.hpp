@@ -15,6 +15,7 @@
 #pragma once
 #include <atomic>
 #include <cstdint>
+#include <filesystem>
 #include <functional>
 #include <map>
 #include <memory>
@@ -24,6 +25,7 @@
 #include <folly/Synchronized.h>
 
 #include <Identifiers/Identifiers.hpp>
+#include <Runtime/AbstractBufferProvider.hpp>
 #include <SliceStore/Slice.hpp>
 #include <SliceStore/SliceAssigner.hpp>
 #include <Time/Timestamp.hpp>
@@ -47,7 +49,16 @@ struct SlicesAndState
 class DefaultTimeBasedSliceStore final : public WindowSlicesStoreInterface
 {
 public:
-    DefaultTimeBasedSliceStore(uint64_t windowSize, uint64_t windowSlide);
+    /// If memoryBudgetInBytes is larger than 0, we spill idle slices into the spillDirectory, once the state of all slices behind the
+    /// global watermark exceeds the budget. If earlyFiringInterval is larger than 0, we emit early results, c.f., getEarlyWindowSlices().
+    /// If the checkpointDirectory is not empty, we checkpoint the slices into it, c.f., checkpointSealedSlices().
+    DefaultTimeBasedSliceStore(
+        uint64_t windowSize,
+        uint64_t windowSlide,
+        uint64_t memoryBudgetInBytes = 0,
+        std::filesystem::path spillDirectory = {},
+        uint64_t earlyFiringInterval = 0,
+        std::filesystem::path checkpointDirectory = {});
 
     ~DefaultTimeBasedSliceStore() override;
     std::vector<std::shared_ptr<Slice>> getSlicesOrCreate(
@@ -55,13 +66,34 @@ public:
     std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>>
     getTriggerableWindowSlices(Timestamp globalWatermark) override;
     std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>> getAllNonTriggeredSlices() override;
+    std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>> getEarlyWindowSlices(Timestamp globalWatermark) override;
     std::optional<std::shared_ptr<Slice>> getSliceBySliceEnd(SliceEnd sliceEnd) override;
-    void garbageCollectSlicesAndWindows(Timestamp newGlobalWaterMark) override;
+    std::vector<std::shared_ptr<Slice>> garbageCollectSlicesAndWindows(Timestamp newGlobalWaterMark) override;
     void deleteState() override;
+    Timestamp restoreCheckpoint(
+        const std::function<std::vector<std::shared_ptr<Slice>>(SliceStart, SliceEnd)>& createNewSlice,
+        AbstractBufferProvider* bufferProvider) override;
     void incrementNumberOfInputPipelines() override;
     uint64_t getWindowSize() const override;
+    uint64_t getWindowSlide() const override;
+    SliceStart getSliceStartTs(Timestamp timestamp) const override;
+    SliceEnd getSliceEndTs(Timestamp timestamp) const override;
+    uint64_t getStateSizeInBytes() const override;
+    std::vector<uint64_t> getStateSizeInBytesPerWorkerThread() const override;
 
 private:
+    /// Spills slices behind the global watermark that no emitted window references, until their state fits into the memory budget.
+    /// As the build never writes into slices behind the global watermark and we hold the lock of the windows, no other thread accesses
+    /// the spilled slices. Emitting a window reloads its slices, c.f., Slice::reloadState().
+    void spillIdleSlices(const std::map<WindowInfo, SlicesAndState>& lockedWindows, Timestamp globalWatermark);
+
+    /// Writes every slice behind the global watermark, which has not been checkpointed yet, into its own file in the checkpoint directory.
+    /// Afterward, it writes the global watermark into the watermark file, which marks the checkpoint as complete. As the build never writes
+    /// into slices behind the global watermark, their pages are a consistent snapshot without copying them, and each slice is written
+    /// once. The checkpoint deletes the files of slices that solely belong to windows before the watermark. If writing a file fails, the
+    /// previous checkpoint stays valid and the next triggering retries. Must be called while holding the lock of the windows.
+    void checkpointSealedSlices(Timestamp globalWatermark);
+
     /// We need to store the windows and slices in two separate maps. This is necessary as we need to access the slices during the join build phase,
     /// while we need to access windows during the triggering of windows.
     folly::Synchronized<std::map<WindowInfo, SlicesAndState>> windows;
@@ -72,9 +104,21 @@ private:
     /// and increases for each window info.
     std::atomic<SequenceNumber::Underlying> sequenceNumber;
 
+    /// The last multiple of the early firing interval, for which we have emitted early results. Guarded by the lock of the windows.
+    Timestamp lastEarlyFiringTs;
+
     /// If a window build operator appears in multiple pipelines, it may get terminated multiple times
     /// We need to track how many input pipelines have not terminated yet, to only release pending slices after the last termination
     std::atomic<uint64_t> numberOfActiveInputPipelines;
+
+    uint64_t memoryBudgetInBytes;
+    std::filesystem::path spillDirectory;
+
+    /// The checkpointed slices and the watermark of the last complete checkpoint. Guarded by the lock of the windows.
+    std::filesystem::path checkpointDirectory;
+    std::map<SliceEnd, SliceStart> checkpointedSlices;
+    Timestamp checkpointedWatermark;
+    bool checkpointRestored;
 };
 
 }
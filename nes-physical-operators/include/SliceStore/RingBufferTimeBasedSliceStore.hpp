@@ -0,0 +1,109 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
+#include <Runtime/AbstractBufferProvider.hpp>
+#include <SliceStore/Slice.hpp>
+#include <SliceStore/SliceAssigner.hpp>
+#include <SliceStore/WindowSlicesStoreInterface.hpp>
+#include <Time/Timestamp.hpp>
+#include <folly/Synchronized.h>
+
+namespace NES
+{
+
+/// Slice store for time-based windows that stores the slices in a ring buffer of slots instead of a map.
+/// All slice ends are a multiple of the greatest common divisor of the window size and slide. Thus, the slice end determines the slot.
+/// Looking up or creating a slice solely loads or compares-and-swaps the atomic shared pointer of its slot without taking any lock.
+/// If the slot stores a different slice, i.e., more slices are alive than the ring has slots, the slice is stored in a locked overflow map.
+///
+/// In contrast to the DefaultTimeBasedSliceStore, creating a slice does not update any windows. As the windows are arithmetic as well,
+/// triggering derives the windows from the alive slices and emits all windows, whose end lies between the last emitted window end and the
+/// global watermark. Thus, a window is never emitted twice. Triggering and garbage collection skip, if another thread is already doing it.
+class RingBufferTimeBasedSliceStore final : public WindowSlicesStoreInterface
+{
+public:
+    static constexpr uint64_t MIN_NUMBER_OF_SLOTS = 1024;
+    static constexpr uint64_t MAX_NUMBER_OF_SLOTS = 65536;
+
+    /// Allocates a power of 2 number of slots, so that the slices of four windows fit into the ring
+    RingBufferTimeBasedSliceStore(uint64_t windowSize, uint64_t windowSlide);
+
+    ~RingBufferTimeBasedSliceStore() override;
+    std::vector<std::shared_ptr<Slice>> getSlicesOrCreate(
+        Timestamp timestamp, const std::function<std::vector<std::shared_ptr<Slice>>(SliceStart, SliceEnd)>& createNewSlice) override;
+    std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>>
+    getTriggerableWindowSlices(Timestamp globalWatermark) override;
+    std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>> getAllNonTriggeredSlices() override;
+    std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>> getEarlyWindowSlices(Timestamp globalWatermark) override;
+    std::optional<std::shared_ptr<Slice>> getSliceBySliceEnd(SliceEnd sliceEnd) override;
+    std::vector<std::shared_ptr<Slice>> garbageCollectSlicesAndWindows(Timestamp newGlobalWaterMark) override;
+    void deleteState() override;
+    Timestamp restoreCheckpoint(
+        const std::function<std::vector<std::shared_ptr<Slice>>(SliceStart, SliceEnd)>& createNewSlice,
+        AbstractBufferProvider* bufferProvider) override;
+    void incrementNumberOfInputPipelines() override;
+    uint64_t getWindowSize() const override;
+    uint64_t getWindowSlide() const override;
+    SliceStart getSliceStartTs(Timestamp timestamp) const override;
+    SliceEnd getSliceEndTs(Timestamp timestamp) const override;
+    uint64_t getStateSizeInBytes() const override;
+    std::vector<uint64_t> getStateSizeInBytesPerWorkerThread() const override;
+
+    [[nodiscard]] uint64_t getNumberOfSlots() const;
+
+private:
+    using Slot = std::atomic<std::shared_ptr<Slice>>;
+
+    [[nodiscard]] Slot& getSlot(SliceEnd sliceEnd);
+
+    /// Calls the function for all slots that might store a slice with a slice end in [firstSliceEnd, lastSliceEnd].
+    /// As several slice ends share a slot, the function has to check the slice end of the slice in the slot.
+    void forEachSlot(SliceEnd firstSliceEnd, SliceEnd lastSliceEnd, const std::function<void(Slot&)>& function);
+
+    /// Emits all windows with a window end in (lastEmittedWindowEnd, maxWindowEnd) that contain at least one alive slice.
+    /// Must be called while holding the triggerMutex.
+    std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>> emitWindows(Timestamp maxWindowEnd);
+
+    SliceAssigner sliceAssigner;
+    uint64_t sliceEndGranularity; /// All slice ends are a multiple of it
+    std::vector<Slot> slots;
+    uint64_t slotMask; /// Mask to calculate the slot from the slice end. Always slots.size() - 1
+    folly::Synchronized<std::map<SliceEnd, std::shared_ptr<Slice>>> overflowSlices;
+
+    /// Guards the last emitted window end. We emit windows in the order of their window end, so that the sequence numbers increase.
+    std::mutex triggerMutex;
+    Timestamp lastEmittedWindowEnd;
+    std::atomic<SequenceNumber::Underlying> sequenceNumber;
+
+    /// Guards the last collected slice end, as all slices up to it have been removed already
+    std::mutex garbageCollectionMutex;
+    Timestamp lastCollectedSliceEnd;
+
+    /// If a window build operator appears in multiple pipelines, it may get terminated multiple times
+    /// We need to track how many input pipelines have not terminated yet, to only release pending slices after the last termination
+    std::atomic<uint64_t> numberOfActiveInputPipelines;
+};
+
+}
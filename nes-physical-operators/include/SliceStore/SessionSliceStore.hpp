@@ -0,0 +1,106 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <optional>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
+#include <Runtime/AbstractBufferProvider.hpp>
+#include <SliceStore/Slice.hpp>
+#include <SliceStore/SliceAssigner.hpp>
+#include <SliceStore/WindowSlicesStoreInterface.hpp>
+#include <Time/Timestamp.hpp>
+#include <folly/Synchronized.h>
+
+namespace NES
+{
+
+/// Slice store for session windows. A session consists of all records, whose timestamps are less than the gap apart from each other.
+/// We cut the time into slices of the gap length, as for a tumbling window of the gap, and track the first and last timestamp per slice.
+/// As all records of a slice are less than the gap apart, a session is a run of slices, in which each slice starts less than the gap after
+/// the last timestamp of its predecessor. Thus, sessions merge in place: a record that closes the gap between two sessions solely updates
+/// the timestamps of its slice and the triggering emits both runs of slices as one session, without copying or combining any state.
+///
+/// A session [first timestamp, last timestamp + gap) is triggerable, once its end lies behind the global watermark, as no future record can
+/// extend it anymore. All slices of the session end before the session end and are thus complete.
+class SessionSliceStore final : public WindowSlicesStoreInterface
+{
+public:
+    explicit SessionSliceStore(uint64_t gap);
+
+    ~SessionSliceStore() override;
+    std::vector<std::shared_ptr<Slice>> getSlicesOrCreate(
+        Timestamp timestamp, const std::function<std::vector<std::shared_ptr<Slice>>(SliceStart, SliceEnd)>& createNewSlice) override;
+    std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>>
+    getTriggerableWindowSlices(Timestamp globalWatermark) override;
+    std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>> getAllNonTriggeredSlices() override;
+    std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>> getEarlyWindowSlices(Timestamp globalWatermark) override;
+    std::optional<std::shared_ptr<Slice>> getSliceBySliceEnd(SliceEnd sliceEnd) override;
+    std::vector<std::shared_ptr<Slice>> garbageCollectSlicesAndWindows(Timestamp newGlobalWaterMark) override;
+    void deleteState() override;
+    Timestamp restoreCheckpoint(
+        const std::function<std::vector<std::shared_ptr<Slice>>(SliceStart, SliceEnd)>& createNewSlice,
+        AbstractBufferProvider* bufferProvider) override;
+    void incrementNumberOfInputPipelines() override;
+
+    /// A session spans at least the gap. Thus, we return the gap for the window size and slide.
+    uint64_t getWindowSize() const override;
+    uint64_t getWindowSlide() const override;
+
+    /// Returns the range between the first and last timestamp of the slice including the timestamp, as solely records outside of this range
+    /// change the timestamps of the slice.
+    SliceStart getSliceStartTs(Timestamp timestamp) const override;
+    SliceEnd getSliceEndTs(Timestamp timestamp) const override;
+    uint64_t getStateSizeInBytes() const override;
+    std::vector<uint64_t> getStateSizeInBytesPerWorkerThread() const override;
+
+private:
+    struct SessionSlice
+    {
+        SessionSlice(std::shared_ptr<Slice> slice, Timestamp timestamp);
+
+        /// Updates the first and last timestamp. The build calls it while holding the read lock of the slices.
+        void addTimestamp(Timestamp timestamp) const;
+
+        std::shared_ptr<Slice> slice;
+        mutable std::atomic<Timestamp::Underlying> firstTimestamp;
+        mutable std::atomic<Timestamp::Underlying> lastTimestamp;
+        /// The end of the session that contains the slice, once we have emitted the session. Guarded by the write lock of the slices.
+        std::optional<Timestamp> emittedSessionEnd;
+    };
+
+    /// Emits all sessions of not emitted slices, whose session end is smaller than the max session end, in the order of their session ends.
+    /// Must be called while holding the write lock of the slices.
+    std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>>
+    emitSessions(std::map<SliceEnd, SessionSlice>& lockedSlices, Timestamp maxSessionEnd);
+
+    folly::Synchronized<std::map<SliceEnd, SessionSlice>> slices;
+    SliceAssigner sliceAssigner;
+    uint64_t gap;
+
+    /// We emit the sessions in the order of their session end, so that the sequence numbers increase
+    std::atomic<SequenceNumber::Underlying> sequenceNumber;
+
+    /// If a window build operator appears in multiple pipelines, it may get terminated multiple times
+    /// We need to track how many input pipelines have not terminated yet, to only release pending slices after the last termination
+    std::atomic<uint64_t> numberOfActiveInputPipelines;
+};
+
+}
@@ -14,7 +14,13 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <vector>
+#include <Runtime/AbstractBufferProvider.hpp>
 #include <Time/Timestamp.hpp>
 
 namespace NES
@@ -27,6 +33,18 @@ struct CreateNewSlicesArguments
     virtual ~CreateNewSlicesArguments() = default;
 };
 
+/// Ingestion timestamps of the oldest and the latest data, which the builds have added to one or more slices,
+/// c.f., TupleBuffer::getCreationTimestampInMS() and TupleBuffer::getLatestCreationTimestampInMS()
+struct SliceCreationTimestamps
+{
+    Timestamp oldest = Timestamp(Timestamp::INVALID_VALUE);
+    Timestamp latest = Timestamp(Timestamp::INITIAL_VALUE);
+
+    void merge(const SliceCreationTimestamps& other);
+    /// True, if no build has added any data
+    [[nodiscard]] bool isEmpty() const;
+};
+
 /// This enum helps to keep track of the status of a window by classifying the stages of the join
 /// The state transitions are as follows:
 ///                Current State |     Action                        | Next State
@@ -57,11 +75,43 @@ public:
     [[nodiscard]] SliceStart getSliceStart() const;
     [[nodiscard]] SliceEnd getSliceEnd() const;
 
+    /// Called by the builds, whenever they start adding the records of an input buffer to this slice. Thread-safe.
+    void addCreationTimestamps(Timestamp creationTs, Timestamp latestCreationTs);
+    [[nodiscard]] SliceCreationTimestamps getCreationTimestamps() const;
+
     bool operator==(const Slice& rhs) const;
     bool operator!=(const Slice& rhs) const;
 
+    /// Returns the number of bytes that the state of this slice occupies in memory
+    [[nodiscard]] virtual uint64_t getStateSizeInBytes() const;
+
+    /// Adds the state of the slice, which the worker thread with the index modulo the number of worker threads owns, to the entry of the
+    /// index and grows the vector if necessary. Slices whose state is not owned by worker threads add nothing.
+    virtual void addStateSizeInBytesPerWorkerThread(std::vector<uint64_t>& stateSizeInBytesPerWorkerThread) const;
+
+    /// Writes the state of this slice to a file in the spill directory and releases its memory. Returns the number of released bytes.
+    /// The state must not be accessed until reloadState() is called. Slices that do not support spilling keep their state in memory.
+    virtual uint64_t spillState(const std::filesystem::path& spillDirectory);
+
+    /// Reads the spilled state back into memory. Does nothing, if the state has not been spilled.
+    virtual void reloadState(AbstractBufferProvider* bufferProvider);
+
+    /// Writes a copy of the state of this slice to the checkpoint file, without releasing it. Returns false, if the slice does not support
+    /// checkpointing its state. The caller must ensure that no thread writes into the slice meanwhile.
+    virtual bool writeCheckpoint(std::FILE* file);
+
+    /// Adds the state, which writeCheckpoint() has written to the file, to this slice
+    virtual void readCheckpoint(std::FILE* file, AbstractBufferProvider* bufferProvider);
+
 protected:
+    using SpillFile = std::unique_ptr<std::FILE, int (*)(std::FILE*)>;
+
+    /// Creates an anonymous file in the spill directory, which is deleted once it is closed
+    static SpillFile createSpillFile(const std::filesystem::path& spillDirectory);
+
     SliceStart sliceStart;
     SliceEnd sliceEnd;
+    std::atomic<Timestamp::Underlying> oldestCreationTimestamp{Timestamp::INVALID_VALUE};
+    std::atomic<Timestamp::Underlying> latestCreationTimestamp{Timestamp::INITIAL_VALUE};
 };
 }
@@ -27,10 +27,15 @@ namespace NES
 /// @brief The SliceAssigner assigner determines the start and end timestamp of a slice for
 /// a specific window definition, that consists of a window size and a window slide.
 /// @note Tumbling windows are in general modeled at this point as sliding windows with the size is equals to the slide.
+/// If the early firing interval is larger than 0, we additionally cut the slices at each multiple of it. Thus, the early results of a
+/// window solely read slices that lie completely behind the watermark, c.f., WindowSlicesStoreInterface::getEarlyWindowSlices().
 class SliceAssigner
 {
 public:
-    explicit SliceAssigner(const uint64_t windowSize, const uint64_t windowSlide) : windowSize(windowSize), windowSlide(windowSlide) { }
+    explicit SliceAssigner(const uint64_t windowSize, const uint64_t windowSlide, const uint64_t earlyFiringInterval = 0)
+        : windowSize(windowSize), windowSlide(windowSlide), earlyFiringInterval(earlyFiringInterval)
+    {
+    }
 
     SliceAssigner(const SliceAssigner& other) = default;
     SliceAssigner(SliceAssigner&& other) noexcept = default;
@@ -48,7 +53,8 @@ public:
         const auto prevSlideStart = timestampRaw - ((timestampRaw) % windowSlide);
         const auto prevWindowStart
             = timestampRaw < windowSize ? prevSlideStart : timestampRaw - ((timestampRaw - windowSize) % windowSlide);
-        return SliceStart(std::max(prevSlideStart, prevWindowStart));
+        const auto prevEarlyFiringStart = earlyFiringInterval > 0 ? timestampRaw - (timestampRaw % earlyFiringInterval) : 0;
+        return SliceStart(std::max({prevSlideStart, prevWindowStart, prevEarlyFiringStart}));
     }
 
     /// @brief Calculates the end of a slice for a specific timestamp ts.
@@ -60,7 +66,9 @@ public:
         const auto nextSlideEnd = timestampRaw + windowSlide - ((timestampRaw) % windowSlide);
         const auto nextWindowEnd
             = timestampRaw < windowSize ? windowSize : timestampRaw + windowSlide - ((timestampRaw - windowSize) % windowSlide);
-        return SliceEnd(std::min(nextSlideEnd, nextWindowEnd));
+        const auto nextEarlyFiringEnd
+            = earlyFiringInterval > 0 ? timestampRaw + earlyFiringInterval - (timestampRaw % earlyFiringInterval) : nextSlideEnd;
+        return SliceEnd(std::min({nextSlideEnd, nextWindowEnd, nextEarlyFiringEnd}));
     }
 
     /// Retrieves all window identifiers that correspond to this slice
@@ -71,23 +79,15 @@ public:
         const auto sliceStart = slice.getSliceStart().getRawValue();
         const auto sliceEnd = slice.getSliceEnd().getRawValue();
 
-        /// Taking the max out of sliceEnd and windowSize, allows us to not create windows, such as 0-5 for slide 5 and size 100.
-        /// In our window model, a window is always the size of the window size.
-        auto firstWindowEnd = std::max((sliceEnd), windowSize);
-        auto lastWindowEnd = sliceStart + windowSize;
-
-        if ((firstWindowEnd - windowSize) % windowSlide != 0)
-        {
-            /// firstWindowEnd is no valid windowEnd for the window parameters size and slide.
-            /// essentially means, it is the firstWindowStart in which the slice is not contained, and we can use that to derive the required parameters
-            lastWindowEnd = firstWindowEnd + windowSize - windowSlide;
-            firstWindowEnd = sliceStart + windowSlide;
-        }
+        /// A window contains the slice, if its window start, which is a multiple of the slide, is not larger than the slice start and
+        /// its window end is not smaller than the slice end. In our window model, a window is always the size of the window size.
+        const auto firstWindowStart = sliceEnd <= windowSize ? 0 : ((sliceEnd - windowSize + windowSlide - 1) / windowSlide) * windowSlide;
+        const auto lastWindowStart = (sliceStart / windowSlide) * windowSlide;
 
         std::vector<WindowInfo> allWindows;
-        for (auto curWindowEnd = firstWindowEnd; curWindowEnd <= lastWindowEnd; curWindowEnd += windowSlide)
+        for (auto curWindowStart = firstWindowStart; curWindowStart <= lastWindowStart; curWindowStart += windowSlide)
         {
-            allWindows.emplace_back(curWindowEnd - windowSize, curWindowEnd);
+            allWindows.emplace_back(curWindowStart, curWindowStart + windowSize);
         }
 
         return allWindows;
@@ -97,9 +97,12 @@ public:
 
     [[nodiscard]] uint64_t getWindowSlide() const { return windowSlide; }
 
+    [[nodiscard]] uint64_t getEarlyFiringInterval() const { return earlyFiringInterval; }
+
 private:
     uint64_t windowSize;
     uint64_t windowSlide;
+    uint64_t earlyFiringInterval;
 };
 
 }
@@ -0,0 +1,70 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <vector>
+#include <SliceStore/Slice.hpp>
+
+namespace NES
+{
+
+/// Destroys the slices, which the garbage collection has removed from a slice store, on a background thread. Destroying a slice cleans up
+/// its state, e.g., the destructor callbacks of its hash maps and its paged vectors, which takes long for large slices and would otherwise
+/// delay the next task of the worker thread that ran the garbage collection.
+/// The thread starts with the first reclaimed slices and destroys one slice at a time, thus reclaiming a slice never blocks the
+/// garbage collection for longer than moving the slice into the queue.
+class SliceReclaimer
+{
+public:
+    SliceReclaimer() = default;
+    /// Destroys all pending slices before returning, as their cleanup may call into the compiled pipelines of the query
+    ~SliceReclaimer();
+
+    SliceReclaimer(const SliceReclaimer&) = delete;
+    SliceReclaimer(SliceReclaimer&&) = delete;
+    SliceReclaimer& operator=(const SliceReclaimer&) = delete;
+    SliceReclaimer& operator=(SliceReclaimer&&) = delete;
+
+    /// Enqueues the slices for their destruction. A slice, which is still referenced elsewhere, e.g., by a running probe task, is destroyed
+    /// by its last owner.
+    void reclaim(std::vector<std::shared_ptr<Slice>> slices);
+
+    /// Destroys all pending slices on the calling thread, e.g., once the query stops. Returns after all slices, which have been reclaimed
+    /// before the call, are destroyed.
+    void drain();
+
+    [[nodiscard]] size_t getNumberOfPendingSlices() const;
+
+private:
+    void runReclaimer(const std::stop_token& stopToken);
+    /// Returns false, if no slice is pending
+    bool destroyOldestPendingSlice();
+
+    mutable std::mutex mutex;
+    /// Held while destroying a slice, thus drain() returns not before the reclaimer thread has destroyed the slice that it took
+    std::mutex destructionMutex;
+    std::condition_variable_any slicesPending;
+    std::deque<std::shared_ptr<Slice>> pendingSlices;
+    std::jthread reclaimerThread;
+};
+
+}
@@ -15,6 +15,7 @@
 #pragma once
 
 #include <cstdint>
+#include <filesystem>
 #include <functional>
 #include <map>
 #include <memory>
@@ -23,6 +24,7 @@
 #include <Identifiers/Identifiers.hpp>
 #include <Join/StreamJoinUtil.hpp>
 #include <Nautilus/Util.hpp>
+#include <Runtime/AbstractBufferProvider.hpp>
 #include <SliceStore/Slice.hpp>
 #include <Time/Timestamp.hpp>
 
@@ -58,11 +60,30 @@ struct WindowInfoAndSequenceNumber
     bool operator<(const WindowInfoAndSequenceNumber& other) const { return windowInfo < other.windowInfo; }
 };
 
+/// Implementations of the WindowSlicesStoreInterface for time-based windows, c.f., WindowSlicesStoreInterface::create()
+enum class SliceStoreType : uint8_t
+{
+    /// Stores the slices and windows in maps that are guarded by locks, c.f., DefaultTimeBasedSliceStore
+    DEFAULT,
+    /// Stores the slices in a ring buffer of atomic slots, c.f., RingBufferTimeBasedSliceStore
+    RING_BUFFER
+};
+
 /// This is the interface for storing windows and slices in a window-based operator
 /// It provides an interface to operate on slices and windows for a time-based window operator, e.g., join or aggregation
 class WindowSlicesStoreInterface
 {
 public:
+    /// Creates a slice store for time-based windows. Solely the DEFAULT slice store spills slices above the memory budget to disk and
+    /// checkpoints its slices into a non-empty checkpoint directory.
+    static std::unique_ptr<WindowSlicesStoreInterface> create(
+        SliceStoreType sliceStoreType,
+        uint64_t windowSize,
+        uint64_t windowSlide,
+        uint64_t memoryBudgetInBytes = 0,
+        const std::filesystem::path& spillDirectory = {},
+        const std::filesystem::path& checkpointDirectory = {});
+
     virtual ~WindowSlicesStoreInterface() = default;
     /// Retrieves the slices that corresponds to the timestamp. If no slices exist for the timestamp, they are created by calling the method createNewSlice
     virtual std::vector<std::shared_ptr<Slice>>
@@ -75,6 +96,13 @@ public:
     virtual std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>> getTriggerableWindowSlices(Timestamp globalWatermark)
         = 0;
 
+    /// Retrieves the slices of all windows that are still filling, to emit early results of them, c.f., SliceAssigner.
+    /// Each time the global watermark passes a multiple of the early firing interval, it returns for all windows that contain this multiple
+    /// the slices that end before it. As the window is not triggered, its slices are returned again with the next multiple.
+    /// Solely the DEFAULT slice store emits early results. All other slice stores return no windows.
+    virtual std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>> getEarlyWindowSlices(Timestamp globalWatermark)
+        = 0;
+
     /// Retrieves the slice by its end timestamp. If no slice exists for the given slice end, the optional return value is nullopt
     virtual std::optional<std::shared_ptr<Slice>> getSliceBySliceEnd(SliceEnd sliceEnd) = 0;
 
@@ -84,13 +112,21 @@ public:
     virtual std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>> getAllNonTriggeredSlices() = 0;
 
     /// Garbage collect all slices and windows that are not valid anymore
-    /// It is open for the implementation to delete the slices in this call or to mark them for deletion
-    /// There is no guarantee that the slices are deleted after this call
-    virtual void garbageCollectSlicesAndWindows(Timestamp newGlobalWaterMark) = 0;
+    /// Returns the slices that have been removed from the store. The caller decides when to destroy them, c.f., SliceReclaimer, as
+    /// the destruction of large slices takes long. There is no guarantee that all invalid slices are removed in this call.
+    virtual std::vector<std::shared_ptr<Slice>> garbageCollectSlicesAndWindows(Timestamp newGlobalWaterMark) = 0;
 
     /// Deletes all slices, directly in this call
     virtual void deleteState() = 0;
 
+    /// Restores the slices, which a previous run of the query has checkpointed, by creating them via createNewSlice and reading their
+    /// state. Returns the watermark, up to which the previous run has triggered the windows, or the initial timestamp without checkpoint.
+    /// Solely the DEFAULT slice store checkpoints slices. Only the first call restores the slices.
+    virtual Timestamp restoreCheckpoint(
+        const std::function<std::vector<std::shared_ptr<Slice>>(SliceStart, SliceEnd)>& createNewSlice,
+        AbstractBufferProvider* bufferProvider)
+        = 0;
+
     /// Increments the number of pipelines that contain a build(!) operator using this slice store, in order to track the expected number of terminations.
     /// This should be called each time an operator whose handler uses this store is set up.
     /// Note: This should not be inferred when the store is created during the lowering stage, as the same build operator may appear in multiple pipelines.
@@ -98,5 +134,18 @@ public:
 
     /// Returns the window size
     [[nodiscard]] virtual uint64_t getWindowSize() const = 0;
+
+    /// Returns the window slide
+    [[nodiscard]] virtual uint64_t getWindowSlide() const = 0;
+
+    /// Returns the start and end of the slice that contains the timestamp, without creating the slice.
+    /// All timestamps in [start, end) map to the same slices and do not change the slice store, when passed to getSlicesOrCreate().
+    [[nodiscard]] virtual SliceStart getSliceStartTs(Timestamp timestamp) const = 0;
+    [[nodiscard]] virtual SliceEnd getSliceEndTs(Timestamp timestamp) const = 0;
+
+    /// Returns the number of bytes that the state of the stored slices occupies in memory, c.f., Slice::getStateSizeInBytes()
+    [[nodiscard]] virtual uint64_t getStateSizeInBytes() const = 0;
+    /// Returns the state of the stored slices by the worker threads which own it, c.f., Slice::addStateSizeInBytesPerWorkerThread()
+    [[nodiscard]] virtual std::vector<uint64_t> getStateSizeInBytesPerWorkerThread() const = 0;
 };
 }
@@ -15,6 +15,7 @@
 
 #include <memory>
 #include <optional>
+#include <DataTypes/Schema.hpp>
 #include <Identifiers/Identifiers.hpp>
 #include <Sources/SourceDescriptor.hpp>
 #include <PhysicalOperator.hpp>
@@ -24,12 +25,14 @@ namespace NES
 class SourcePhysicalOperator final : public PhysicalOperatorConcept
 {
 public:
-    explicit SourcePhysicalOperator(SourceDescriptor descriptor, OriginId id);
+    /// @param formattedSchema fields of the logical source that the input formatter writes into the formatted buffers. Defaults to all.
+    explicit SourcePhysicalOperator(SourceDescriptor descriptor, OriginId id, std::optional<Schema> formattedSchema = std::nullopt);
     [[nodiscard]] std::optional<PhysicalOperator> getChild() const override;
     void setChild(PhysicalOperator child) override;
 
     [[nodiscard]] SourceDescriptor getDescriptor() const;
     [[nodiscard]] OriginId getOriginId() const;
+    [[nodiscard]] Schema getFormattedSchema() const;
 
     bool operator==(const SourcePhysicalOperator& other) const;
 
@@ -37,5 +40,6 @@ private:
     std::optional<PhysicalOperator> child;
     OriginId originId;
     SourceDescriptor descriptor;
+    std::optional<Schema> formattedSchema;
 };
 }
@@ -31,6 +31,10 @@ public:
 
     void execute(ExecutionContext& ctx, Record& record) const override;
 
+    /// The i-th input field is renamed to the i-th output field
+    [[nodiscard]] const std::vector<std::string>& getInputFields() const;
+    [[nodiscard]] const std::vector<std::string>& getOutputFields() const;
+
 private:
     std::vector<std::string> inputFields;
     std::vector<std::string> outputFields;
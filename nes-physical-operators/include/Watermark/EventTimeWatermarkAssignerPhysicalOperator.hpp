@@ -14,6 +14,8 @@
 #pragma once
 #include <memory>
 #include <optional>
+#include <Nautilus/Interface/TimestampRef.hpp>
+#include <Time/Timestamp.hpp>
 #include <Watermark/TimeFunction.hpp>
 #include <PhysicalOperator.hpp>
 
@@ -23,6 +25,8 @@ class TimeFunction;
 
 /// @brief Watermark assignment operator.
 /// Determines the watermark ts according to a WatermarkStrategyDescriptor an places it in the current buffer.
+/// If the timestamp is an integer field of the buffers of a preceding scan, the scan computes the maximum timestamp of its buffer at once,
+/// c.f., VectorizedMaxTimestamp, and passes its records directly to the child of the assigner.
 class EventTimeWatermarkAssignerPhysicalOperator : public PhysicalOperatorConcept
 {
 public:
@@ -33,6 +37,10 @@ public:
     [[nodiscard]] std::optional<PhysicalOperator> getChild() const override;
     void setChild(PhysicalOperator child) override;
 
+    [[nodiscard]] const EventTimeFunction& getTimeFunction() const;
+    /// Raises the watermark of the current buffer to the timestamp, instead of executing the assigner for every record
+    void updateWatermark(ExecutionContext& executionCtx, const nautilus::val<Timestamp>& timestamp) const;
+
 private:
     EventTimeFunction timeFunction;
     std::optional<PhysicalOperator> child;
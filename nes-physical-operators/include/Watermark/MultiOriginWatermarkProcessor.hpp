@@ -13,8 +13,13 @@
 */
 
 #pragma once
+#include <atomic>
+#include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <string>
+#include <unordered_map>
 #include <vector>
 #include <Identifiers/Identifiers.hpp>
 #include <Sequencing/NonBlockingMonotonicSeqQueue.hpp>
@@ -26,11 +31,21 @@ namespace NES
 {
 
 /// @brief A multi origin version of the lock free watermark processor.
+/// The watermarks of all origins are the leaves of a tournament tree, whose inner nodes store the minimal watermark of their subtree.
+/// Thus, an update solely recomputes the nodes on the path from its leaf to the root and the root stores the global watermark.
+/// An update stops as soon as it does not change the minimum of a subtree, e.g., if the updated origin is not the slowest origin of its
+/// subtree. As the nodes solely increase, concurrent updates never lower a node and the last update of a child always reads its sibling.
+///
+/// If an idle timeout is set, updates of other origins advance the watermark of each origin, which had no update for the idle timeout, to
+/// the watermark of the most advanced origin. Thus, an idle origin does not hold back the global watermark. Once the origin sends buffers
+/// again, its watermark stays at the advanced watermark, until its own watermark passes it. Records with a smaller timestamp are late.
 class MultiOriginWatermarkProcessor
 {
 public:
-    explicit MultiOriginWatermarkProcessor(const std::vector<OriginId>& origins);
-    static std::shared_ptr<MultiOriginWatermarkProcessor> create(const std::vector<OriginId>& origins);
+    explicit MultiOriginWatermarkProcessor(
+        const std::vector<OriginId>& origins, std::chrono::milliseconds idleTimeout = std::chrono::milliseconds::zero());
+    static std::shared_ptr<MultiOriginWatermarkProcessor>
+    create(const std::vector<OriginId>& origins, std::chrono::milliseconds idleTimeout = std::chrono::milliseconds::zero());
 
     /// @brief Updates the watermark timestamp and origin and emits the current watermark.
     [[nodiscard]] Timestamp updateWatermark(Timestamp ts, SequenceData sequenceData, OriginId origin) const;
@@ -38,11 +53,37 @@ public:
     /// @brief Returns the current watermark across all origins
     [[nodiscard]] Timestamp getCurrentWatermark() const;
 
+    /// @brief Returns the current watermark of the origin
+    [[nodiscard]] Timestamp getCurrentWatermark(OriginId origin) const;
+
+    /// @brief Returns how far the watermark of the origin lags behind the watermark of the most advanced origin.
+    /// The origins with the largest lag hold back the global watermark.
+    [[nodiscard]] uint64_t getWatermarkLag(OriginId origin) const;
+
     std::string getCurrentStatus();
 
 private:
+    [[nodiscard]] size_t getOriginIndex(OriginId origin) const;
+
+    /// Increases the leaf of the origin to the watermark and propagates the new minimum towards the root
+    void propagateWatermark(size_t originIndex, uint64_t watermark) const;
+
+    /// Advances the watermark of all idle origins to the watermark of the most advanced origin.
+    /// Solely one thread checks the origins per half of the idle timeout.
+    void advanceIdleOrigins(std::chrono::steady_clock::time_point now) const;
+
     const std::vector<OriginId> origins;
+    const std::unordered_map<OriginId, size_t> originIndexes;
     std::vector<std::shared_ptr<Sequencing::NonBlockingMonotonicSeqQueue<uint64_t>>> watermarkProcessors;
+
+    /// Tournament tree of the watermarks in heap order, i.e., the root is at index 1 and the children of node i are at 2i and 2i + 1.
+    /// The leaves start at numberOfLeaves. Leaves without an origin store the maximal watermark, so that they never determine a minimum.
+    size_t numberOfLeaves;
+    mutable std::vector<std::atomic<uint64_t>> tournamentTree;
+
+    std::chrono::milliseconds idleTimeout; /// Zero disables the detection of idle origins
+    mutable std::vector<std::atomic<std::chrono::steady_clock::time_point>> lastUpdates;
+    mutable std::atomic<std::chrono::steady_clock::time_point> lastIdleCheck;
 };
 
 }
@@ -14,6 +14,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <DataTypes/TimeUnit.hpp>
 #include <Functions/PhysicalFunction.hpp>
 #include <Nautilus/DataTypes/VarVal.hpp>
@@ -56,6 +57,10 @@ public:
         return std::make_unique<EventTimeFunction>(timestampFunction, unit);
     }
 
+    /// Field that holds the timestamp, if the timestamp function solely accesses a field
+    [[nodiscard]] std::optional<Record::RecordFieldIdentifier> getTimestampField() const;
+    [[nodiscard]] const Windowing::TimeUnit& getUnit() const;
+
 private:
     Windowing::TimeUnit unit;
     PhysicalFunction timestampFunction;
@@ -18,6 +18,7 @@
 #include <ostream>
 #include <tuple>
 #include <utility>
+#include <vector>
 #include <DataTypes/Schema.hpp>
 #include <DataTypes/TimeUnit.hpp>
 #include <Functions/FieldAccessPhysicalFunction.hpp>
@@ -68,27 +69,36 @@ public:
 
     static std::tuple<TimestampField, TimestampField>
     getTimestampLeftAndRight(const JoinLogicalOperator& joinOperator, const std::shared_ptr<Windowing::TimeBasedWindowType>& windowType)
+    {
+        const auto timestampFields = getTimestampsOfInputs(joinOperator.getInputSchemas(), windowType);
+        return {timestampFields.at(0), timestampFields.at(1)};
+    }
+
+    /// Returns the timestamp field of the window for each input schema, e.g., for the inputs of a join
+    static std::vector<TimestampField>
+    getTimestampsOfInputs(const std::vector<Schema>& inputSchemas, const std::shared_ptr<Windowing::TimeBasedWindowType>& windowType)
     {
         if (windowType->getTimeCharacteristic().getType() == Windowing::TimeCharacteristic::Type::IngestionTime)
         {
             NES_DEBUG("Skip eventime identification as we use ingestion time");
-            return {TimestampField::ingestionTime(), TimestampField::ingestionTime()};
+            return std::vector(inputSchemas.size(), TimestampField::ingestionTime());
         }
 
         const auto timeStampFieldNameWithoutSourceName = windowType->getTimeCharacteristic().field.getUnqualifiedName();
 
-        /// Extracting the left and right timestamp
-        const auto timeStampFieldNameLeft = joinOperator.getInputSchemas().at(0).getFieldByName(timeStampFieldNameWithoutSourceName);
-        const auto timeStampFieldNameRight = joinOperator.getInputSchemas().at(1).getFieldByName(timeStampFieldNameWithoutSourceName);
-
-        INVARIANT(
-            timeStampFieldNameLeft.has_value() and timeStampFieldNameRight.has_value(),
-            "Could not find timestampfieldname {} in both streams!",
-            timeStampFieldNameWithoutSourceName);
-
-        return {
-            TimestampField::eventTime(timeStampFieldNameLeft.value().name, windowType->getTimeCharacteristic().getTimeUnit()),
-            TimestampField::eventTime(timeStampFieldNameRight.value().name, windowType->getTimeCharacteristic().getTimeUnit())};
+        /// Extracting the timestamp of each input
+        std::vector<TimestampField> timestampFields;
+        for (const auto& inputSchema : inputSchemas)
+        {
+            const auto timeStampField = inputSchema.getFieldByName(timeStampFieldNameWithoutSourceName);
+            INVARIANT(
+                timeStampField.has_value(),
+                "Could not find timestampfieldname {} in all streams!",
+                timeStampFieldNameWithoutSourceName);
+            timestampFields.emplace_back(
+                TimestampField::eventTime(timeStampField.value().name, windowType->getTimeCharacteristic().getTimeUnit()));
+        }
+        return timestampFields;
     }
 
 private:
@@ -0,0 +1,56 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <DataTypes/DataType.hpp>
+#include <MemoryLayout/MemoryLayout.hpp>
+#include <Time/Timestamp.hpp>
+
+namespace NES
+{
+
+/// Computes the maximum timestamp of all tuples of a buffer at once, instead of a traced comparison per record, if the timestamp is a
+/// fixed-size integer field. Reducing a column in a tight loop allows the compiler to vectorize the maximum for the SIMD instructions of
+/// the target. As the record-at-a-time EventTimeFunction, the reduction casts the field to uint64 and converts it to milliseconds.
+class VectorizedMaxTimestamp
+{
+public:
+    /// Returns nullopt if the field is not part of the memory layout or is not an integer
+    static std::optional<VectorizedMaxTimestamp>
+    create(const std::string& fieldName, uint64_t millisecondsConversionMultiplier, const MemoryLayout& memoryLayout);
+
+    /// Maximum timestamp in milliseconds of the first 'numberOfTuples' tuples in the buffer, Timestamp::INITIAL_VALUE if there is none
+    [[nodiscard]] Timestamp::Underlying evaluate(const int8_t* buffer, uint64_t numberOfTuples) const;
+    /// Maximum timestamp in milliseconds of the tuples in the selection vector, e.g., the qualifying tuples of a vectorized selection
+    [[nodiscard]] Timestamp::Underlying
+    evaluate(const int8_t* buffer, const uint64_t* selectionVector, uint64_t numberOfSelectedTuples) const;
+
+private:
+    VectorizedMaxTimestamp(DataType::Type fieldType, uint64_t offset, uint64_t stride, uint64_t millisecondsConversionMultiplier)
+        : fieldType(fieldType), offset(offset), stride(stride), millisecondsConversionMultiplier(millisecondsConversionMultiplier)
+    {
+    }
+
+    DataType::Type fieldType;
+    /// Offset of the field of the first tuple and the distance between the fields of consecutive tuples
+    uint64_t offset;
+    uint64_t stride;
+    uint64_t millisecondsConversionMultiplier;
+};
+
+}
@@ -14,16 +14,21 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <functional>
 #include <map>
 #include <memory>
 #include <vector>
 #include <Identifiers/Identifiers.hpp>
+#include <Runtime/AbstractBufferProvider.hpp>
 #include <Runtime/Execution/OperatorHandler.hpp>
 #include <Runtime/QueryTerminationType.hpp>
+#include <Runtime/TupleBuffer.hpp>
 #include <Sequencing/SequenceData.hpp>
 #include <SliceStore/Slice.hpp>
+#include <SliceStore/SliceReclaimer.hpp>
 #include <SliceStore/WindowSlicesStoreInterface.hpp>
 #include <Time/Timestamp.hpp>
 #include <Watermark/MultiOriginWatermarkProcessor.hpp>
@@ -66,12 +71,27 @@ public:
 
     /// We can not call opHandler->start() from Nautilus, as we only get a pointer in the proxy function in Nautilus, e.g., setupProxy() in StreamJoinBuild
     void setWorkerThreads(uint64_t numberOfWorkerThreads);
+    /// Excludes input origins without buffers for the timeout from the watermark, c.f., MultiOriginWatermarkProcessor. Zero disables it.
+    void setIdleOriginTimeout(std::chrono::milliseconds idleOriginTimeout);
+    /// Keeps windows open for the allowed lateness after the global watermark has passed their end, so that records arriving out of order
+    /// within it still contribute to their windows. As the probe watermark follows the emitted windows, the slices stay alive as well.
+    void setAllowedLateness(uint64_t allowedLateness);
     void start(PipelineExecutionContext& pipelineExecutionContext, uint32_t localStateVariableId) override;
     void stop(QueryTerminationType queryTerminationType, PipelineExecutionContext& pipelineExecutionContext) override;
 
     WindowSlicesStoreInterface& getSliceAndWindowStore() const;
-
-    /// Updates the corresponding watermark processor, and then garbage collects all slices and windows that are not valid anymore
+    /// Returns the state of the slices in the slice store, c.f., WindowSlicesStoreInterface::getStateSizeInBytes()
+    [[nodiscard]] uint64_t getStateSizeInBytes() const override;
+    [[nodiscard]] std::vector<uint64_t> getStateSizeInBytesPerWorkerThread() const override;
+
+    /// Records with an older timestamp arrive later than the allowed lateness, i.e., all windows containing them have been emitted already.
+    /// The build drops them and counts them via countLateRecord().
+    [[nodiscard]] Timestamp getOldestAcceptedTimestamp() const;
+    void countLateRecord();
+    [[nodiscard]] uint64_t getNumberOfLateRecords() const;
+
+    /// Updates the corresponding watermark processor, and then garbage collects all slices and windows that are not valid anymore.
+    /// The removed slices are destroyed by the slice reclaimer, so that the calling worker thread does not destroy their state.
     void garbageCollectSlicesAndWindows(const BufferMetaData& bufferMetaData) const;
 
     /// Checks and triggers windows that are ready to be triggered, e.g., the watermark has passed the window end for time-based windows.
@@ -94,10 +114,27 @@ protected:
         PipelineExecutionContext* pipelineCtx)
         = 0;
 
+    /// Sets the creation timestamps of a buffer that triggers the probe of a window to the oldest and the latest ingested data of the
+    /// window's slices, instead of the time of the trigger. Windows without any creation timestamps fall back to the current time.
+    static void setCreationTimestamps(TupleBuffer& tupleBuffer, const SliceCreationTimestamps& creationTimestamps);
+
+    /// Restores the checkpointed slices via the slice store and advances the trigger watermark to the watermark of the checkpoint,
+    /// c.f., WindowSlicesStoreInterface::restoreCheckpoint()
+    void restoreCheckpoint(
+        const std::function<std::vector<std::shared_ptr<Slice>>(SliceStart, SliceEnd)>& createNewSlice,
+        AbstractBufferProvider* bufferProvider);
+
     std::unique_ptr<WindowSlicesStoreInterface> sliceAndWindowStore;
+    /// Declared after the slice store, so that the pending slices are destroyed before the store
+    std::unique_ptr<SliceReclaimer> sliceReclaimer;
     std::unique_ptr<MultiOriginWatermarkProcessor> watermarkProcessorBuild;
     std::unique_ptr<MultiOriginWatermarkProcessor> watermarkProcessorProbe;
     uint64_t numberOfWorkerThreads;
+    std::chrono::milliseconds idleOriginTimeout;
+    uint64_t allowedLateness;
+    /// The largest watermark, up to which we have triggered the windows. It lags the global watermark by the allowed lateness.
+    std::atomic<Timestamp::Underlying> triggerWatermark;
+    std::atomic<uint64_t> numberOfLateRecords;
     const OriginId outputOriginId;
     const std::vector<OriginId> inputOrigins;
 };
@@ -15,14 +15,19 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <optional>
+#include <Nautilus/Interface/TimestampRef.hpp>
 #include <Runtime/Execution/OperatorHandler.hpp>
+#include <Time/Timestamp.hpp>
 #include <Watermark/TimeFunction.hpp>
 #include <CompilationContext.hpp>
+#include <ExecutionContext.hpp>
 #include <OperatorState.hpp>
 #include <PhysicalOperator.hpp>
 #include <val.hpp>
+#include <val_ptr.hpp>
 
 namespace NES
 {
@@ -31,12 +36,40 @@ namespace NES
 class WindowOperatorBuildLocalState : public OperatorState
 {
 public:
-    explicit WindowOperatorBuildLocalState(const nautilus::val<OperatorHandler*>& operatorHandler) : operatorHandler(operatorHandler) { }
+    WindowOperatorBuildLocalState(
+        const nautilus::val<OperatorHandler*>& operatorHandler, const nautilus::val<Timestamp>& oldestAcceptedTimestamp)
+        : operatorHandler(operatorHandler), oldestAcceptedTimestamp(oldestAcceptedTimestamp)
+    {
+    }
 
     nautilus::val<OperatorHandler*> getOperatorHandler() { return operatorHandler; }
 
+    /// We fetch the oldest accepted timestamp once per pipeline invocation. As it solely increases, we might accept a few late records.
+    [[nodiscard]] nautilus::val<Timestamp> getOldestAcceptedTimestamp() const { return oldestAcceptedTimestamp; }
+
+    /// Consecutive records mostly belong to the same slice. Thus, we cache the operator specific state of the last slice,
+    /// e.g., its hash map, for the current pipeline invocation. Initially, the cached slice [sliceStart, sliceEnd) is empty.
+    [[nodiscard]] bool isInCachedSlice(const nautilus::val<Timestamp>& timestamp) const
+    {
+        return cachedSliceStart <= timestamp and timestamp < cachedSliceEnd;
+    }
+
+    void cacheSlice(
+        const nautilus::val<Timestamp>& sliceStart, const nautilus::val<Timestamp>& sliceEnd, const nautilus::val<int8_t*>& sliceState)
+    {
+        cachedSliceStart = sliceStart;
+        cachedSliceEnd = sliceEnd;
+        cachedSliceState = sliceState;
+    }
+
+    [[nodiscard]] nautilus::val<int8_t*> getCachedSliceState() const { return cachedSliceState; }
+
 private:
     nautilus::val<OperatorHandler*> operatorHandler;
+    nautilus::val<Timestamp> oldestAcceptedTimestamp;
+    nautilus::val<Timestamp> cachedSliceStart{Timestamp(Timestamp::INITIAL_VALUE)};
+    nautilus::val<Timestamp> cachedSliceEnd{Timestamp(Timestamp::INITIAL_VALUE)};
+    nautilus::val<int8_t*> cachedSliceState{nullptr};
 };
 
 /// Is the general probe operator for window operators. It is responsible for emitting slices and windows to the second phase (probe).
@@ -65,6 +98,23 @@ public:
     void setChild(PhysicalOperator child) override;
 
 protected:
+    /// Creates the local state in open(). Builds that keep further intermediates per pipeline invocation return a derived local state.
+    [[nodiscard]] virtual std::unique_ptr<WindowOperatorBuildLocalState> createLocalState(
+        ExecutionContext& executionCtx,
+        const nautilus::val<OperatorHandler*>& operatorHandler,
+        const nautilus::val<Timestamp>& oldestAcceptedTimestamp) const;
+
+    /// Returns the operator specific state of the slice that contains the timestamp, e.g., the hash map of the aggregation.
+    /// Only if the timestamp lies outside of the slice of the previous call, we call getSliceState to look up the slice in the slice store.
+    nautilus::val<int8_t*> getSliceStateCached(
+        ExecutionContext& executionCtx,
+        const nautilus::val<Timestamp>& timestamp,
+        const std::function<nautilus::val<int8_t*>(const nautilus::val<OperatorHandler*>&)>& getSliceState) const;
+
+    /// Returns true, if the record arrived later than the allowed lateness, c.f., WindowBasedOperatorHandler::getOldestAcceptedTimestamp().
+    /// The build must drop such records, as all windows containing them have been emitted already. We count them in the operator handler.
+    nautilus::val<bool> isLateRecord(ExecutionContext& executionCtx, const nautilus::val<Timestamp>& timestamp) const;
+
     std::optional<PhysicalOperator> child;
     const OperatorHandlerId operatorHandlerId;
     const std::unique_ptr<TimeFunction> timeFunction;
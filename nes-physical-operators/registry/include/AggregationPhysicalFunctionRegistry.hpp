@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <optional>
 #include <string>
@@ -36,6 +37,12 @@ struct AggregationPhysicalFunctionRegistryArguments
     PhysicalFunction inputFunction;
     Record::RecordFieldIdentifier resultFieldIdentifier;
     std::optional<std::shared_ptr<Interface::BufferRef::TupleBufferRef>> bufferRefPagedVector;
+    /// Solely set for quantile aggregations, e.g., ApproxQuantile
+    std::optional<double> quantile;
+    /// Solely set for top-k aggregations, e.g., ApproxTopK
+    std::optional<uint64_t> k;
+    /// Solely set for aggregations over two fields, e.g., CovarPop
+    std::optional<PhysicalFunction> secondInputFunction;
 };
 
 class AggregationPhysicalFunctionRegistry : public BaseRegistry<
@@ -0,0 +1,62 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Aggregation/AdaptivePreAggregation.hpp>
+
+#include <cstdint>
+#include <Util/Logger/Logger.hpp>
+
+namespace NES
+{
+
+void AdaptivePreAggregation::recordFlush(const uint64_t numberOfRecords, const uint64_t numberOfKeys)
+{
+    if (numberOfRecords == 0)
+    {
+        return;
+    }
+    reduction.wlock()->add(1.0 - (static_cast<double>(numberOfKeys) / static_cast<double>(numberOfRecords)));
+    hasSamples.store(true, std::memory_order::relaxed);
+}
+
+void AdaptivePreAggregation::onNewSlice()
+{
+    const auto slice = numberOfSlices.fetch_add(1, std::memory_order::relaxed) + 1;
+    const auto currentReduction = getReduction();
+    const auto enable = currentReduction >= MIN_REDUCTION or slice % SAMPLING_INTERVAL == 0;
+    if (enabled.exchange(enable, std::memory_order::relaxed) != enable)
+    {
+        NES_DEBUG(
+            "{} the pre-aggregation at slice {}, as the tables combine {:.2f} of the records into existing keys",
+            enable ? "Enabling" : "Disabling",
+            slice,
+            currentReduction);
+    }
+}
+
+bool AdaptivePreAggregation::isEnabled() const
+{
+    return enabled.load(std::memory_order::relaxed);
+}
+
+double AdaptivePreAggregation::getReduction() const
+{
+    if (not hasSamples.load(std::memory_order::relaxed))
+    {
+        return 1;
+    }
+    return reduction.rlock()->getAverage();
+}
+
+}
@@ -13,19 +13,25 @@
 */
 #include <Aggregation/AggregationBuildPhysicalOperator.hpp>
 
+#include <bit>
 #include <cstdint>
 #include <functional>
 #include <memory>
 #include <ranges>
 #include <utility>
 #include <vector>
+#include <Aggregation/AdaptivePreAggregation.hpp>
 #include <Aggregation/AggregationOperatorHandler.hpp>
 #include <Aggregation/AggregationSlice.hpp>
 #include <Aggregation/Function/AggregationPhysicalFunction.hpp>
 #include <Identifiers/Identifiers.hpp>
+#include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMap.hpp>
 #include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMapRef.hpp>
 #include <Nautilus/Interface/HashMap/HashMap.hpp>
+#include <Nautilus/Interface/HashMap/OpenAddressingHashMap/OpenAddressingHashMap.hpp>
 #include <Nautilus/Interface/Record.hpp>
+#include <Nautilus/Interface/RecordBuffer.hpp>
+#include <Runtime/Execution/OperatorHandler.hpp>
 #include <SliceStore/Slice.hpp>
 #include <Time/Timestamp.hpp>
 #include <CompilationContext.hpp>
@@ -44,6 +50,7 @@ Interface::HashMap* getAggHashMapProxy(
     const AggregationOperatorHandler* operatorHandler,
     const Timestamp timestamp,
     const WorkerThreadId workerThreadId,
+    const uint64_t partition,
     const AggregationBuildPhysicalOperator* buildOperator)
 {
     PRECONDITION(operatorHandler != nullptr, "The operator handler should not be null");
@@ -55,7 +62,9 @@ Interface::HashMap* getAggHashMapProxy(
         buildOperator->hashMapOptions.keySize,
         buildOperator->hashMapOptions.valueSize,
         buildOperator->hashMapOptions.pageSize,
-        buildOperator->hashMapOptions.numberOfBuckets};
+        buildOperator->hashMapOptions.numberOfBuckets,
+        buildOperator->hashMapOptions.hashMapType,
+        buildOperator->numberOfPartitions};
     auto wrappedCreateFunction(
         [createFunction = operatorHandler->getCreateNewSlicesFunction(hashMapSliceArgs),
          cleanupStateNautilusFunction = operatorHandler->cleanupStateNautilusFunction](const SliceStart sliceStart, const SliceEnd sliceEnd)
@@ -74,9 +83,76 @@ Interface::HashMap* getAggHashMapProxy(
     /// Converting the slice to an AggregationSlice and returning the pointer to the hashmap
     const auto aggregationSlice = std::dynamic_pointer_cast<AggregationSlice>(hashMap[0]);
     INVARIANT(aggregationSlice != nullptr, "The slice should be an AggregationSlice in an AggregationBuild");
-    return aggregationSlice->getHashMapPtrOrCreate(workerThreadId);
+    return aggregationSlice->getHashMapPtrOrCreate(workerThreadId, partition);
 }
 
+Interface::HashMap* getPreAggregationTableProxy(
+    AggregationOperatorHandler* operatorHandler, const WorkerThreadId workerThreadId, const AggregationBuildPhysicalOperator* buildOperator)
+{
+    PRECONDITION(operatorHandler != nullptr, "The operator handler should not be null");
+    PRECONDITION(buildOperator != nullptr, "The build operator should not be null");
+
+    /// The table has the same entry layout and page size as the slice hash maps, so that we can combine it like a slice hash map
+    const auto& hashMapOptions = buildOperator->hashMapOptions;
+    return operatorHandler->getPreAggregationTableOrCreate(
+        workerThreadId,
+        [&hashMapOptions, numberOfBuckets = buildOperator->preAggregationTableSize]() -> std::unique_ptr<Interface::HashMap>
+        {
+            switch (hashMapOptions.hashMapType)
+            {
+                case Interface::HashMapType::CHAINED:
+                    return std::make_unique<Interface::ChainedHashMap>(
+                        hashMapOptions.keySize, hashMapOptions.valueSize, numberOfBuckets, hashMapOptions.pageSize);
+                case Interface::HashMapType::OPEN_ADDRESSING:
+                    return std::make_unique<Interface::OpenAddressingHashMap>(
+                        hashMapOptions.keySize, hashMapOptions.valueSize, numberOfBuckets, hashMapOptions.pageSize);
+            }
+            std::unreachable();
+        });
+}
+
+void clearPreAggregationTableProxy(Interface::HashMap* preAggregationTable)
+{
+    PRECONDITION(preAggregationTable != nullptr, "The pre-aggregation table should not be null");
+    auto* const chainedHashMap = dynamic_cast<Interface::ChainedHashMap*>(preAggregationTable);
+    INVARIANT(chainedHashMap != nullptr, "The pre-aggregation table should be a ChainedHashMap or an OpenAddressingHashMap");
+    chainedHashMap->clear();
+}
+
+bool usePreAggregationProxy(const AggregationOperatorHandler* operatorHandler)
+{
+    PRECONDITION(operatorHandler != nullptr, "The operator handler should not be null");
+    return operatorHandler->getAdaptivePreAggregation().isEnabled();
+}
+
+void recordPreAggregationFlushProxy(
+    const AggregationOperatorHandler* operatorHandler, const uint64_t numberOfRecords, const uint64_t numberOfKeys)
+{
+    PRECONDITION(operatorHandler != nullptr, "The operator handler should not be null");
+    operatorHandler->getAdaptivePreAggregation().recordFlush(numberOfRecords, numberOfKeys);
+}
+
+/// Extends the local state of the window build by the pre-aggregation table of the worker thread and the slice hash map, into which we
+/// merge the table. Initially, the table is empty and belongs to no slice.
+class AggregationBuildLocalState final : public WindowOperatorBuildLocalState
+{
+public:
+    AggregationBuildLocalState(
+        const nautilus::val<OperatorHandler*>& operatorHandler,
+        const nautilus::val<Timestamp>& oldestAcceptedTimestamp,
+        const nautilus::val<Interface::HashMap*>& preAggregationTable)
+        : WindowOperatorBuildLocalState(operatorHandler, oldestAcceptedTimestamp), preAggregationTable(preAggregationTable)
+    {
+    }
+
+    nautilus::val<Interface::HashMap*> preAggregationTable;
+    nautilus::val<Interface::HashMap*> sliceHashMap{nullptr};
+    /// Whether the records of the slice hash map get pre-aggregated, c.f., AdaptivePreAggregation
+    nautilus::val<bool> preAggregate = false;
+    nautilus::val<uint64_t> numberOfPreAggregatedRecords = 0;
+    nautilus::val<uint64_t> numberOfPreAggregatedKeys = 0;
+};
+
 void AggregationBuildPhysicalOperator::setup(ExecutionContext& executionCtx, CompilationContext& compilationContext) const
 {
     WindowBuildPhysicalOperator::setup(executionCtx, compilationContext);
@@ -120,17 +196,16 @@ void AggregationBuildPhysicalOperator::setup(ExecutionContext& executionCtx, Com
 
 void AggregationBuildPhysicalOperator::execute(ExecutionContext& ctx, Record& record) const
 {
-    /// Getting the operator handler from the local state
-    auto* const localState = dynamic_cast<WindowOperatorBuildLocalState*>(ctx.getLocalState(id));
-    auto operatorHandler = localState->getOperatorHandler();
-
-    /// Getting the correspinding slice so that we can update the aggregation states
     const auto timestamp = timeFunction->getTs(ctx, record);
-    const auto hashMapPtr = invoke(
-        getAggHashMapProxy, operatorHandler, timestamp, ctx.workerThreadId, nautilus::val<const AggregationBuildPhysicalOperator*>(this));
-    Interface::ChainedHashMapRef hashMap(
-        hashMapPtr, hashMapOptions.fieldKeys, hashMapOptions.fieldValues, hashMapOptions.entriesPerPage, hashMapOptions.entrySize);
+    if (not isLateRecord(ctx, timestamp))
+    {
+        aggregateRecord(ctx, record, timestamp);
+    }
+}
 
+void AggregationBuildPhysicalOperator::aggregateRecord(
+    ExecutionContext& ctx, Record& record, const nautilus::val<Timestamp>& timestamp) const
+{
     /// Calling the key functions to add/update the keys to the record
     for (nautilus::static_val<uint64_t> i = 0; i < hashMapOptions.fieldKeys.size(); ++i)
     {
@@ -140,8 +215,16 @@ void AggregationBuildPhysicalOperator::execute(ExecutionContext& ctx, Record& re
         record.write(fieldIdentifier, value);
     }
 
+    /// Getting the correspinding slice and hash map of the partition of the keys so that we can update the aggregation states
+    auto hashMapPtr = getHashMap(ctx, timestamp, hashMapOptions.getPartition(record, numberOfPartitions));
+    if (preAggregationTableSize > 0)
+    {
+        hashMapPtr = getPreAggregationTable(ctx, hashMapPtr);
+    }
+    const auto hashMap = hashMapOptions.createHashMapRef(hashMapPtr);
+
     /// Finding or creating the entry for the provided record
-    const auto hashMapEntry = hashMap.findOrCreateEntry(
+    const auto hashMapEntry = hashMap->findOrCreateEntry(
         record,
         *hashMapOptions.hashFunction,
         [&](const nautilus::val<Interface::AbstractHashMapEntry*>& entry)
@@ -155,6 +238,16 @@ void AggregationBuildPhysicalOperator::execute(ExecutionContext& ctx, Record& re
                 aggFunction->reset(state, ctx.pipelineMemoryProvider);
                 state = state + aggFunction->getSizeOfStateInBytes();
             }
+
+            /// Counting the keys of the pre-aggregation table to merge it into the slice, once it is full
+            if (preAggregationTableSize > 0)
+            {
+                auto* const localState = dynamic_cast<AggregationBuildLocalState*>(ctx.getLocalState(id));
+                if (localState->preAggregate)
+                {
+                    localState->numberOfPreAggregatedKeys = localState->numberOfPreAggregatedKeys + 1;
+                }
+            }
         },
         ctx.pipelineMemoryProvider.bufferProvider);
 
@@ -170,15 +263,132 @@ void AggregationBuildPhysicalOperator::execute(ExecutionContext& ctx, Record& re
     }
 }
 
+nautilus::val<Interface::HashMap*>
+AggregationBuildPhysicalOperator::getHashMap(
+    ExecutionContext& ctx, const nautilus::val<Timestamp>& timestamp, const nautilus::val<uint64_t>& partition) const
+{
+    const auto getHashMapOfPartition = [&](const nautilus::val<OperatorHandler*>& operatorHandler)
+    {
+        return invoke(
+            getAggHashMapProxy,
+            operatorHandler,
+            timestamp,
+            ctx.workerThreadId,
+            partition,
+            nautilus::val<const AggregationBuildPhysicalOperator*>(this));
+    };
+
+    /// The cached slice stores a single hash map. Thus, we solely cache it, if all records of the slice belong to the same partition.
+    if (numberOfPartitions == 1)
+    {
+        return static_cast<nautilus::val<Interface::HashMap*>>(getSliceStateCached(
+            ctx,
+            timestamp,
+            [&](const nautilus::val<OperatorHandler*>& operatorHandler)
+            { return static_cast<nautilus::val<int8_t*>>(getHashMapOfPartition(operatorHandler)); }));
+    }
+
+    /// Getting the operator handler from the local state
+    auto* localState = dynamic_cast<WindowOperatorBuildLocalState*>(ctx.getLocalState(id));
+    return getHashMapOfPartition(localState->getOperatorHandler());
+}
+
+nautilus::val<Interface::HashMap*> AggregationBuildPhysicalOperator::getPreAggregationTable(
+    ExecutionContext& ctx, const nautilus::val<Interface::HashMap*>& sliceHashMapPtr) const
+{
+    /// The table stores the states of a single slice. Thus, we merge it, before we pre-aggregate the first record of another slice.
+    /// With another slice, we also ask the handler again, whether pre-aggregating pays off.
+    auto* const localState = dynamic_cast<AggregationBuildLocalState*>(ctx.getLocalState(id));
+    if (localState->sliceHashMap != sliceHashMapPtr)
+    {
+        flushPreAggregationTable(ctx);
+        localState->sliceHashMap = sliceHashMapPtr;
+        localState->preAggregate = invoke(usePreAggregationProxy, localState->getOperatorHandler());
+    }
+    else if (localState->numberOfPreAggregatedKeys >= preAggregationTableSize)
+    {
+        flushPreAggregationTable(ctx);
+    }
+
+    nautilus::val<Interface::HashMap*> hashMapPtr = sliceHashMapPtr;
+    if (localState->preAggregate)
+    {
+        localState->numberOfPreAggregatedRecords = localState->numberOfPreAggregatedRecords + 1;
+        hashMapPtr = localState->preAggregationTable;
+    }
+    return hashMapPtr;
+}
+
+void AggregationBuildPhysicalOperator::flushPreAggregationTable(ExecutionContext& ctx) const
+{
+    auto* const localState = dynamic_cast<AggregationBuildLocalState*>(ctx.getLocalState(id));
+    if (localState->numberOfPreAggregatedKeys > 0)
+    {
+        combineAggregationHashMaps(
+            ctx, hashMapOptions, aggregationPhysicalFunctions, localState->sliceHashMap, localState->preAggregationTable);
+
+        /// Clearing the table releases its pages. As all states of the table lie in the table itself, they do not need any cleanup.
+        invoke(clearPreAggregationTableProxy, localState->preAggregationTable);
+        invoke(
+            recordPreAggregationFlushProxy,
+            localState->getOperatorHandler(),
+            localState->numberOfPreAggregatedRecords,
+            localState->numberOfPreAggregatedKeys);
+        localState->numberOfPreAggregatedKeys = 0;
+    }
+    localState->numberOfPreAggregatedRecords = 0;
+}
+
+void AggregationBuildPhysicalOperator::close(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const
+{
+    if (preAggregationTableSize > 0)
+    {
+        flushPreAggregationTable(executionCtx);
+    }
+    WindowBuildPhysicalOperator::close(executionCtx, recordBuffer);
+}
+
+std::unique_ptr<WindowOperatorBuildLocalState> AggregationBuildPhysicalOperator::createLocalState(
+    ExecutionContext& executionCtx,
+    const nautilus::val<OperatorHandler*>& operatorHandler,
+    const nautilus::val<Timestamp>& oldestAcceptedTimestamp) const
+{
+    if (preAggregationTableSize == 0)
+    {
+        return WindowBuildPhysicalOperator::createLocalState(executionCtx, operatorHandler, oldestAcceptedTimestamp);
+    }
+
+    /// Each worker thread reuses its table across all buffers
+    const auto preAggregationTable = invoke(
+        getPreAggregationTableProxy,
+        operatorHandler,
+        executionCtx.workerThreadId,
+        nautilus::val<const AggregationBuildPhysicalOperator*>(this));
+    return std::make_unique<AggregationBuildLocalState>(operatorHandler, oldestAcceptedTimestamp, preAggregationTable);
+}
+
 AggregationBuildPhysicalOperator::AggregationBuildPhysicalOperator(
     const OperatorHandlerId operatorHandlerId,
     std::unique_ptr<TimeFunction> timeFunction,
     std::vector<std::shared_ptr<AggregationPhysicalFunction>> aggregationFunctions,
-    HashMapOptions hashMapOptions)
+    HashMapOptions hashMapOptions,
+    const uint64_t numberOfPartitions,
+    const uint64_t preAggregationTableSize)
     : WindowBuildPhysicalOperator(operatorHandlerId, std::move(timeFunction))
     , aggregationPhysicalFunctions(std::move(aggregationFunctions))
     , hashMapOptions(std::move(hashMapOptions))
+    , numberOfPartitions(numberOfPartitions)
+    , preAggregationTableSize(preAggregationTableSize)
 {
+    PRECONDITION(
+        std::has_single_bit(numberOfPartitions) and numberOfPartitions <= HashMapOptions::MAX_NUMBER_OF_PARTITIONS,
+        "The number of partitions {} must be a power of 2 and not larger than {}",
+        numberOfPartitions,
+        HashMapOptions::MAX_NUMBER_OF_PARTITIONS);
+    PRECONDITION(
+        preAggregationTableSize == 0 or numberOfPartitions == 1,
+        "The pre-aggregation table requires a single partition, but got {} partitions",
+        numberOfPartitions);
 }
 
 }
@@ -15,15 +15,18 @@
 
 #include <algorithm>
 #include <bit>
-#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <functional>
+#include <initializer_list>
 #include <map>
 #include <memory>
+#include <ranges>
+#include <unordered_map>
 #include <utility>
 #include <vector>
+#include <Aggregation/AdaptivePreAggregation.hpp>
 #include <Aggregation/AggregationSlice.hpp>
 #include <Identifiers/Identifiers.hpp>
 #include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMap.hpp>
@@ -31,6 +34,7 @@
 #include <Runtime/TupleBuffer.hpp>
 #include <SliceStore/Slice.hpp>
 #include <SliceStore/WindowSlicesStoreInterface.hpp>
+#include <Time/Timestamp.hpp>
 #include <Util/Logger/Logger.hpp>
 #include <ErrorHandling.hpp>
 #include <PipelineExecutionContext.hpp>
@@ -43,12 +47,22 @@ AggregationOperatorHandler::AggregationOperatorHandler(
     const std::vector<OriginId>& inputOrigins,
     const OriginId outputOriginId,
     std::unique_ptr<WindowSlicesStoreInterface> sliceAndWindowStore,
-    const uint64_t maxNumberOfBuckets)
+    const uint64_t maxNumberOfBuckets,
+    const bool incrementalAggregation)
     : WindowBasedOperatorHandler(inputOrigins, outputOriginId, std::move(sliceAndWindowStore))
     , setupAlreadyCalled(false)
     , rollingAverageNumberOfKeys(RollingAverage<uint64_t>{100})
     , maxNumberOfBuckets(maxNumberOfBuckets)
+    , incrementalAggregation(incrementalAggregation)
+    , chunkSize(
+          (this->sliceAndWindowStore->getWindowSize() / this->sliceAndWindowStore->getWindowSlide())
+          * this->sliceAndWindowStore->getWindowSlide())
 {
+    PRECONDITION(
+        not incrementalAggregation or chunkSize > 0,
+        "The incremental aggregation requires a window size {} that is at least the window slide {}",
+        this->sliceAndWindowStore->getWindowSize(),
+        this->sliceAndWindowStore->getWindowSlide());
 }
 
 std::function<std::vector<std::shared_ptr<Slice>>(SliceStart, SliceEnd)>
@@ -58,90 +72,270 @@ AggregationOperatorHandler::getCreateNewSlicesFunction(const CreateNewSlicesArgu
         numberOfWorkerThreads > 0, "Number of worker threads not set for window based operator. Was setWorkerThreads() being called?");
     auto newHashMapArgs = dynamic_cast<const CreateNewHashMapSliceArgs&>(newSlicesArguments);
     newHashMapArgs.numberOfBuckets = std::clamp(rollingAverageNumberOfKeys.rlock()->getAverage(), 1UL, maxNumberOfBuckets);
+    newHashMapArgs.hashMapRecycler = hashMapRecycler;
     return std::function(
-        [outputOriginId = outputOriginId, numberOfWorkerThreads = numberOfWorkerThreads, copyOfNewHashMapArgs = newHashMapArgs](
-            SliceStart sliceStart, SliceEnd sliceEnd) -> std::vector<std::shared_ptr<Slice>>
+        [outputOriginId = outputOriginId,
+         numberOfWorkerThreads = numberOfWorkerThreads,
+         copyOfNewHashMapArgs = newHashMapArgs,
+         adaptivePreAggregation = adaptivePreAggregation](SliceStart sliceStart, SliceEnd sliceEnd) -> std::vector<std::shared_ptr<Slice>>
         {
             NES_TRACE("Creating new aggregation slice with for slice {}-{} for output origin {}", sliceStart, sliceEnd, outputOriginId);
+            adaptivePreAggregation->onNewSlice();
             return {std::make_shared<AggregationSlice>(sliceStart, sliceEnd, copyOfNewHashMapArgs, numberOfWorkerThreads)};
         });
 }
 
+void AggregationOperatorHandler::checkAndTriggerWindows(const BufferMetaData& bufferMetaData, PipelineExecutionContext* pipelineCtx)
+{
+    WindowBasedOperatorHandler::checkAndTriggerWindows(bufferMetaData, pipelineCtx);
+
+    /// Emitting the early results of all windows that are still filling. As these windows start before all windows that get triggered
+    /// afterward, we set the watermark of all early results to the earliest window start. Otherwise, the watermark might decrease.
+    const auto earlyWindows = sliceAndWindowStore->getEarlyWindowSlices(watermarkProcessorBuild->getCurrentWatermark());
+    if (earlyWindows.empty())
+    {
+        return;
+    }
+    const auto earliestWindowStart = std::ranges::min(
+        earlyWindows | std::views::keys | std::views::transform([](const auto& window) { return window.windowInfo.windowStart; }));
+    for (const auto& [windowInfo, allSlices] : earlyWindows)
+    {
+        NES_TRACE("Emitting early result of window {}-{}", windowInfo.windowInfo.windowStart, windowInfo.windowInfo.windowEnd);
+        emitWindow(windowInfo, allSlices, earliestWindowStart, pipelineCtx);
+    }
+}
+
 void AggregationOperatorHandler::triggerSlices(
     const std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>>& slicesAndWindowInfo,
     PipelineExecutionContext* pipelineCtx)
 {
     for (const auto& [windowInfo, allSlices] : slicesAndWindowInfo)
     {
-        /// Getting all hashmaps for each slice that has at least one tuple
-        std::unique_ptr<Nautilus::Interface::ChainedHashMap> finalHashMap;
-        std::vector<Nautilus::Interface::HashMap*> allHashMaps;
-        uint64_t totalNumberOfTuples = 0;
-        for (const auto& slice : allSlices)
+        emitWindow(windowInfo, allSlices, windowInfo.windowInfo.windowStart, pipelineCtx);
+    }
+}
+
+void AggregationOperatorHandler::emitWindow(
+    const WindowInfoAndSequenceNumber& windowInfo,
+    const std::vector<std::shared_ptr<Slice>>& allSlices,
+    const Timestamp watermark,
+    PipelineExecutionContext* pipelineCtx)
+{
+    /// All slices of an aggregation have the same number of partitions. The probe combines and lowers each partition in a separate task.
+    const auto numberOfPartitions
+        = allSlices.empty() ? 1 : std::dynamic_pointer_cast<AggregationSlice>(allSlices.front())->getNumberOfPartitions();
+    INVARIANT(
+        not incrementalAggregation or numberOfPartitions == 1,
+        "The incremental aggregation does not support {} partitions, as the prefix and suffix hash maps span all partitions",
+        numberOfPartitions);
+    for (uint64_t partition = 0; partition < numberOfPartitions; ++partition)
+    {
+        emitPartitionToProbe(windowInfo, allSlices, partition, numberOfPartitions, watermark, pipelineCtx);
+    }
+}
+
+void AggregationOperatorHandler::emitPartitionToProbe(
+    const WindowInfoAndSequenceNumber& windowInfo,
+    const std::vector<std::shared_ptr<Slice>>& allSlices,
+    const uint64_t partition,
+    const uint64_t numberOfPartitions,
+    const Timestamp watermark,
+    PipelineExecutionContext* pipelineCtx)
+{
+    /// Getting all hashmaps of the partition for each slice that has at least one tuple
+    std::unique_ptr<Nautilus::Interface::ChainedHashMap> finalHashMap;
+    std::vector<Nautilus::Interface::HashMap*> allHashMaps;
+    std::vector<std::shared_ptr<AggregationSlice>> aggregationSlices;
+    uint64_t totalNumberOfTuples = 0;
+    SliceCreationTimestamps creationTimestamps;
+    for (const auto& slice : allSlices)
+    {
+        creationTimestamps.merge(slice->getCreationTimestamps());
+        const auto aggregationSlice = std::dynamic_pointer_cast<AggregationSlice>(slice);
+        if (incrementalAggregation)
+        {
+            aggregationSlices.emplace_back(aggregationSlice);
+        }
+        for (uint64_t hashMapIdx = 0; hashMapIdx < aggregationSlice->getNumberOfHashMapsPerPartition(); ++hashMapIdx)
         {
-            const auto aggregationSlice = std::dynamic_pointer_cast<AggregationSlice>(slice);
-            for (uint64_t hashMapIdx = 0; hashMapIdx < aggregationSlice->getNumberOfHashMaps(); ++hashMapIdx)
+            if (auto* hashMap = aggregationSlice->getHashMapPtr(WorkerThreadId(hashMapIdx), partition);
+                (hashMap != nullptr) and hashMap->getNumberOfTuples() > 0)
             {
-                if (auto* hashMap = aggregationSlice->getHashMapPtr(WorkerThreadId(hashMapIdx));
-                    (hashMap != nullptr) and hashMap->getNumberOfTuples() > 0)
+                /// As the hashmap has one value per key, we can use the number of tuples for the number of keys
+                rollingAverageNumberOfKeys.wlock()->add(hashMap->getNumberOfTuples());
+                const auto statistics = dynamic_cast<const Nautilus::Interface::ChainedHashMap*>(hashMap)->getBucketStatistics();
+                NES_DEBUG(
+                    "Aggregation hash map of slice {}-{} stores {} keys in {} of {} buckets (average chain length {:.2f}) after {} resizes",
+                    slice->getSliceStart(),
+                    slice->getSliceEnd(),
+                    statistics.numberOfEntries,
+                    statistics.numberOfUsedBuckets,
+                    statistics.numberOfBuckets,
+                    statistics.getAverageChainLength(),
+                    statistics.numberOfResizes);
+
+                allHashMaps.emplace_back(hashMap);
+                totalNumberOfTuples += hashMap->getNumberOfTuples();
+                if (not finalHashMap)
                 {
-                    /// As the hashmap has one value per key, we can use the number of tuples for the number of keys
-                    rollingAverageNumberOfKeys.wlock()->add(hashMap->getNumberOfTuples());
-
-                    allHashMaps.emplace_back(hashMap);
-                    totalNumberOfTuples += hashMap->getNumberOfTuples();
-                    if (not finalHashMap)
-                    {
-                        finalHashMap = Nautilus::Interface::ChainedHashMap::createNewMapWithSameConfiguration(
-                            *dynamic_cast<Nautilus::Interface::ChainedHashMap*>(hashMap));
-                    }
+                    finalHashMap = Nautilus::Interface::ChainedHashMap::createNewMapWithSameConfiguration(
+                        *dynamic_cast<Nautilus::Interface::ChainedHashMap*>(hashMap));
                 }
             }
         }
+    }
+
+
+    /// We need a buffer that is large enough to store:
+    /// - all pointers to all hashmaps of the window to be triggered
+    /// - a new hashmap for the probe operator, so that we are not overwriting the thread local hashmaps
+    /// - size of EmittedAggregationWindow
+    const auto neededBufferSize = sizeof(EmittedAggregationWindow) + (allHashMaps.size() * sizeof(Nautilus::Interface::HashMap*));
+    const auto tupleBufferVal = pipelineCtx->getBufferManager()->getUnpooledBuffer(neededBufferSize);
+    if (not tupleBufferVal.has_value())
+    {
+        throw CannotAllocateBuffer("{}B for the hash join window trigger were requested", neededBufferSize);
+    }
+    auto tupleBuffer = tupleBufferVal.value();
+
+    /// It might be that the buffer is not zeroed out.
+    std::ranges::fill(tupleBuffer.getAvailableMemoryArea(), std::byte{0});
+
+    /// As we are here "emitting" a buffer, we have to set the originId, the seq number, the watermark and the "number of tuples".
+    /// The watermark cannot be the slice end as some buffers might be still waiting to get processed.
+    /// The partitions of a window are the chunks of its sequence number.
+    tupleBuffer.setOriginId(outputOriginId);
+    tupleBuffer.setSequenceNumber(windowInfo.sequenceNumber);
+    tupleBuffer.setChunkNumber(ChunkNumber(ChunkNumber::INITIAL + partition));
+    tupleBuffer.setLastChunk(partition + 1 == numberOfPartitions);
+    tupleBuffer.setWatermark(watermark);
+    tupleBuffer.setNumberOfTuples(totalNumberOfTuples);
+    setCreationTimestamps(tupleBuffer, creationTimestamps);
+
+
+    /// Writing all necessary information for the aggregation probe to the buffer via the placement new constructor
+    auto tmp = tupleBuffer.getAvailableMemoryArea();
+    new (tmp.data())
+        EmittedAggregationWindow{windowInfo.windowInfo, std::move(finalHashMap), allHashMaps, std::move(aggregationSlices)};
+
+
+    /// Dispatching the buffer to the probe operator via the task queue, which runs the triggers before other tasks by their window end.
+    pipelineCtx->emitBufferWithDeadline(tupleBuffer, windowInfo.windowInfo.windowEnd);
+    NES_TRACE(
+        "Emitted partition {} of window {}-{} with watermarkTs {} sequenceNumber {} originId {}",
+        partition,
+        windowInfo.windowInfo.windowStart,
+        windowInfo.windowInfo.windowEnd,
+        tupleBuffer.getWatermark(),
+        tupleBuffer.getSequenceNumber(),
+        tupleBuffer.getOriginId());
+}
+
+uint64_t AggregationOperatorHandler::prepareIncrementalAggregation(EmittedAggregationWindow& window)
+{
+    PRECONDITION(incrementalAggregation, "The incremental aggregation is disabled");
+    incrementalAggregationMutex.lock();
+    if (window.finalHashMapPtr == nullptr)
+    {
+        /// No slice of the window contains a tuple. Thus, we do not have to combine anything.
+        return 0;
+    }
+
+    /// The window contains at most one chunk start, c.f., EmittedAggregationWindow. All slices before it belong to the previous chunk.
+    const auto windowStart = window.windowInfo.windowStart.getRawValue();
+    const auto chunkStart = ((window.windowInfo.windowEnd.getRawValue() - 1) / chunkSize) * chunkSize;
+    INVARIANT(
+        chunkStart >= windowStart,
+        "Window {}-{} must contain the chunk start {}",
+        window.windowInfo.windowStart,
+        window.windowInfo.windowEnd,
+        chunkStart);
+    std::ranges::sort(window.slices, {}, [](const auto& slice) { return slice->getSliceStart(); });
+    const auto firstSliceOfChunk = std::ranges::find_if(window.slices, [chunkStart](const auto& slice)
+                                                        { return slice->getSliceStart().getRawValue() >= chunkStart; });
+
+    const auto addCombineStepsOfSlice = [&window](Nautilus::Interface::HashMap* target, const AggregationSlice& slice)
+    {
+        for (uint64_t hashMapIdx = 0; hashMapIdx < slice.getNumberOfHashMapsPerPartition(); ++hashMapIdx)
+        {
+            if (auto* hashMap = slice.getHashMapPtr(WorkerThreadId(hashMapIdx)); hashMap != nullptr and hashMap->getNumberOfTuples() > 0)
+            {
+                window.combineSteps.emplace_back(target, hashMap);
+            }
+        }
+    };
+
+    /// Creating the missing suffix hash maps of the previous chunk from its end, as each suffix contains the suffix of its successor
+    Nautilus::Interface::HashMap* suffixHashMap = nullptr;
+    for (const auto& slice : std::ranges::subrange(window.slices.begin(), firstSliceOfChunk) | std::views::reverse)
+    {
+        if (auto* existingSuffixHashMap = slice->getSuffixHashMapPtr(); existingSuffixHashMap != nullptr)
+        {
+            suffixHashMap = existingSuffixHashMap;
+            continue;
+        }
+        auto* const newSuffixHashMap = slice->createSuffixHashMap();
+        if (suffixHashMap != nullptr)
+        {
+            window.combineSteps.emplace_back(newSuffixHashMap, suffixHashMap);
+        }
+        addCombineStepsOfSlice(newSuffixHashMap, *slice);
+        suffixHashMap = newSuffixHashMap;
+    }
 
+    /// Creating the missing prefix hash maps of the chunk from its start, as each prefix contains the prefix of its predecessor
+    Nautilus::Interface::HashMap* prefixHashMap = nullptr;
+    for (const auto& slice : std::ranges::subrange(firstSliceOfChunk, window.slices.end()))
+    {
+        if (auto* existingPrefixHashMap = slice->getPrefixHashMapPtr(); existingPrefixHashMap != nullptr)
+        {
+            prefixHashMap = existingPrefixHashMap;
+            continue;
+        }
+        auto* const newPrefixHashMap = slice->createPrefixHashMap();
+        if (prefixHashMap != nullptr)
+        {
+            window.combineSteps.emplace_back(newPrefixHashMap, prefixHashMap);
+        }
+        addCombineStepsOfSlice(newPrefixHashMap, *slice);
+        prefixHashMap = newPrefixHashMap;
+    }
 
-        /// We need a buffer that is large enough to store:
-        /// - all pointers to all hashmaps of the window to be triggered
-        /// - a new hashmap for the probe operator, so that we are not overwriting the thread local hashmaps
-        /// - size of EmittedAggregationWindow
-        const auto neededBufferSize = sizeof(EmittedAggregationWindow) + (allHashMaps.size() * sizeof(Nautilus::Interface::HashMap*));
-        const auto tupleBufferVal = pipelineCtx->getBufferManager()->getUnpooledBuffer(neededBufferSize);
-        if (not tupleBufferVal.has_value())
+    /// Combining the suffix of the first slice and the prefix of the last slice of the window into the final hash map
+    const auto numberOfLockedCombineSteps = window.combineSteps.size();
+    for (auto* const hashMap : {suffixHashMap, prefixHashMap})
+    {
+        if (hashMap != nullptr)
         {
-            throw CannotAllocateBuffer("{}B for the hash join window trigger were requested", neededBufferSize);
+            window.combineSteps.emplace_back(window.finalHashMapPtr, hashMap);
         }
-        auto tupleBuffer = tupleBufferVal.value();
-
-        /// It might be that the buffer is not zeroed out.
-        std::ranges::fill(tupleBuffer.getAvailableMemoryArea(), std::byte{0});
-
-        /// As we are here "emitting" a buffer, we have to set the originId, the seq number, the watermark and the "number of tuples".
-        /// The watermark cannot be the slice end as some buffers might be still waiting to get processed.
-        tupleBuffer.setOriginId(outputOriginId);
-        tupleBuffer.setSequenceNumber(windowInfo.sequenceNumber);
-        tupleBuffer.setChunkNumber(ChunkNumber(ChunkNumber::INITIAL));
-        tupleBuffer.setLastChunk(true);
-        tupleBuffer.setWatermark(windowInfo.windowInfo.windowStart);
-        tupleBuffer.setNumberOfTuples(totalNumberOfTuples);
-        tupleBuffer.setCreationTimestampInMS(Timestamp(
-            std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now().time_since_epoch()).count()));
-
-
-        /// Writing all necessary information for the aggregation probe to the buffer via the placement new constructor
-        auto tmp = tupleBuffer.getAvailableMemoryArea();
-        new (tmp.data()) EmittedAggregationWindow{windowInfo.windowInfo, std::move(finalHashMap), allHashMaps};
-
-
-        /// Dispatching the buffer to the probe operator via the task queue.
-        pipelineCtx->emitBuffer(tupleBuffer);
-        NES_TRACE(
-            "Emitted window {}-{} with watermarkTs {} sequenceNumber {} originId {}",
-            windowInfo.windowInfo.windowStart,
-            windowInfo.windowInfo.windowEnd,
-            tupleBuffer.getWatermark(),
-            tupleBuffer.getSequenceNumber(),
-            tupleBuffer.getOriginId());
     }
+    return numberOfLockedCombineSteps;
+}
+
+uint64_t AggregationOperatorHandler::finishIncrementalAggregation(const EmittedAggregationWindow& window)
+{
+    /// The combine steps into the final hash map solely read the prefix and suffix hash maps. Thus, they do not require the lock.
+    incrementalAggregationMutex.unlock();
+    return window.combineSteps.size();
+}
+
+AdaptivePreAggregation& AggregationOperatorHandler::getAdaptivePreAggregation() const
+{
+    return *adaptivePreAggregation;
+}
+
+Nautilus::Interface::HashMap* AggregationOperatorHandler::getPreAggregationTableOrCreate(
+    const WorkerThreadId workerThreadId, const std::function<std::unique_ptr<Nautilus::Interface::HashMap>()>& createTable)
+{
+    /// We look up the table once per buffer. Thus, the lock is not contended by the records.
+    auto lockedPreAggregationTables = preAggregationTables.wlock();
+    auto& preAggregationTable = (*lockedPreAggregationTables)[workerThreadId];
+    if (preAggregationTable == nullptr)
+    {
+        preAggregationTable = createTable();
+    }
+    return preAggregationTable.get();
 }
 
 }
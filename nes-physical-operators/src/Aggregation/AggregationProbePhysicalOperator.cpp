@@ -13,13 +13,18 @@
 */
 #include <Aggregation/AggregationProbePhysicalOperator.hpp>
 
+#include <algorithm>
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <utility>
 #include <vector>
 #include <Aggregation/AggregationOperatorHandler.hpp>
+#include <Aggregation/AggregationSlice.hpp>
 #include <Aggregation/Function/AggregationPhysicalFunction.hpp>
+#include <DataTypes/DataType.hpp>
 #include <Nautilus/DataTypes/DataTypesUtil.hpp>
+#include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMap.hpp>
 #include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMapRef.hpp>
 #include <Nautilus/Interface/HashMap/HashMap.hpp>
 #include <Nautilus/Interface/Record.hpp>
@@ -48,11 +53,98 @@ Interface::HashMap* getHashMapPtrProxy(const EmittedAggregationWindow* emittedAg
     return emittedAggregationWindow->hashMaps[currentHashMapVal];
 }
 
+uint64_t prepareIncrementalAggregationProxy(OperatorHandler* ptrOpHandler, EmittedAggregationWindow* emittedAggregationWindow)
+{
+    PRECONDITION(ptrOpHandler != nullptr, "opHandler context should not be null!");
+    PRECONDITION(emittedAggregationWindow != nullptr, "EmittedAggregationWindow must not be nullptr");
+    auto* const opHandler = dynamic_cast<AggregationOperatorHandler*>(ptrOpHandler);
+    return opHandler->prepareIncrementalAggregation(*emittedAggregationWindow);
+}
+
+uint64_t finishIncrementalAggregationProxy(OperatorHandler* ptrOpHandler, const EmittedAggregationWindow* emittedAggregationWindow)
+{
+    PRECONDITION(ptrOpHandler != nullptr, "opHandler context should not be null!");
+    PRECONDITION(emittedAggregationWindow != nullptr, "EmittedAggregationWindow must not be nullptr");
+    auto* const opHandler = dynamic_cast<AggregationOperatorHandler*>(ptrOpHandler);
+    return opHandler->finishIncrementalAggregation(*emittedAggregationWindow);
+}
+
+Interface::HashMap* getCombineStepTargetProxy(const EmittedAggregationWindow* emittedAggregationWindow, const uint64_t combineStep)
+{
+    PRECONDITION(emittedAggregationWindow != nullptr, "EmittedAggregationWindow must not be nullptr");
+    PRECONDITION(combineStep < emittedAggregationWindow->combineSteps.size(), "combineStep must be smaller than the number of steps");
+    return emittedAggregationWindow->combineSteps[combineStep].first;
+}
+
+Interface::HashMap* getCombineStepSourceProxy(const EmittedAggregationWindow* emittedAggregationWindow, const uint64_t combineStep)
+{
+    PRECONDITION(emittedAggregationWindow != nullptr, "EmittedAggregationWindow must not be nullptr");
+    PRECONDITION(combineStep < emittedAggregationWindow->combineSteps.size(), "combineStep must be smaller than the number of steps");
+    return emittedAggregationWindow->combineSteps[combineStep].second;
+}
+
+namespace
+{
+/// Orders the top n heap such that its top is the entry that leaves the top n first
+struct TopNHeapOrder
+{
+    bool descending;
+
+    bool operator()(
+        const std::pair<double, Interface::ChainedHashMapEntry*>& lhs, const std::pair<double, Interface::ChainedHashMapEntry*>& rhs) const
+    {
+        return descending ? lhs.first > rhs.first : lhs.first < rhs.first;
+    }
+};
+}
+
+void offerTopNEntryProxy(
+    EmittedAggregationWindow* emittedAggregationWindow,
+    const double orderValue,
+    Interface::ChainedHashMapEntry* entry,
+    const uint64_t limit,
+    const bool descending)
+{
+    PRECONDITION(emittedAggregationWindow != nullptr, "EmittedAggregationWindow must not be nullptr");
+    auto& heap = emittedAggregationWindow->topNEntries;
+    const TopNHeapOrder heapOrder{descending};
+    if (heap.size() < limit)
+    {
+        heap.emplace_back(orderValue, entry);
+        std::ranges::push_heap(heap, heapOrder);
+        return;
+    }
+    /// The entry replaces the top of the heap solely if it ranks higher, i.e., ties keep the entries that were offered first
+    if (const std::pair candidate{orderValue, entry}; heapOrder(candidate, heap.front()))
+    {
+        std::ranges::pop_heap(heap, heapOrder);
+        heap.back() = candidate;
+        std::ranges::push_heap(heap, heapOrder);
+    }
+}
+
+uint64_t sortTopNEntriesProxy(EmittedAggregationWindow* emittedAggregationWindow, const bool descending)
+{
+    PRECONDITION(emittedAggregationWindow != nullptr, "EmittedAggregationWindow must not be nullptr");
+    /// Sorting the heap by its own order places the entry with the highest rank first
+    std::ranges::sort_heap(emittedAggregationWindow->topNEntries, TopNHeapOrder{descending});
+    return emittedAggregationWindow->topNEntries.size();
+}
+
+Interface::ChainedHashMapEntry* getTopNEntryProxy(const EmittedAggregationWindow* emittedAggregationWindow, const uint64_t rank)
+{
+    PRECONDITION(emittedAggregationWindow != nullptr, "EmittedAggregationWindow must not be nullptr");
+    PRECONDITION(rank < emittedAggregationWindow->topNEntries.size(), "rank must be smaller than the number of top n entries");
+    return emittedAggregationWindow->topNEntries[rank].second;
+}
+
 void AggregationProbePhysicalOperator::open(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const
 {
     /// As this operator functions as a scan, we have to set the execution context for this pipeline
     executionCtx.watermarkTs = recordBuffer.getWatermarkTs();
     executionCtx.currentTs = recordBuffer.getCreatingTs();
+    executionCtx.creationTs = recordBuffer.getCreatingTs();
+    executionCtx.latestCreationTs = recordBuffer.getLatestCreationTs();
     executionCtx.sequenceNumber = recordBuffer.getSequenceNumber();
     executionCtx.chunkNumber = recordBuffer.getChunkNumber();
     executionCtx.lastChunk = recordBuffer.isLastChunk();
@@ -74,72 +166,46 @@ void AggregationProbePhysicalOperator::open(ExecutionContext& executionCtx, Reco
         Nautilus::Util::getMemberRef(aggregationWindowRef, &EmittedAggregationWindow::finalHashMapPtr));
 
     /// Combining all keys from all hash maps in the final hash map, and then iterating over the final hash map once to lower the aggregation states
-    Interface::ChainedHashMapRef finalHashMap(
-        finalHashMapPtr, hashMapOptions.fieldKeys, hashMapOptions.fieldValues, hashMapOptions.entriesPerPage, hashMapOptions.entrySize);
-    for (nautilus::val<uint64_t> curHashMap = 0; curHashMap < numberOfHashMaps; ++curHashMap)
+    if (incrementalAggregation)
     {
-        const nautilus::val<Interface::HashMap*> hashMapPtr = hashMapRefs[curHashMap];
-        const Interface::ChainedHashMapRef currentMap(
-            hashMapPtr, hashMapOptions.fieldKeys, hashMapOptions.fieldValues, hashMapOptions.entriesPerPage, hashMapOptions.entrySize);
-        for (const auto entry : currentMap)
+        /// Creating the missing prefix and suffix hash maps while holding the lock, before combining them into the final hash map
+        const auto operatorHandler = executionCtx.getGlobalOperatorHandler(operatorHandlerId);
+        const auto numberOfLockedCombineSteps = invoke(prepareIncrementalAggregationProxy, operatorHandler, aggregationWindowRef);
+        for (nautilus::val<uint64_t> combineStep = 0; combineStep < numberOfLockedCombineSteps; ++combineStep)
         {
-            const Interface::ChainedHashMapRef::ChainedEntryRef entryRef(
-                entry, hashMapPtr, hashMapOptions.fieldKeys, hashMapOptions.fieldValues);
-            const auto tmpRecordKey = entryRef.getKey();
-
-            /// Inserting the record key into the final/global hash map. If an entry for the key already exists, we have to combine the aggregation states
-            /// We do this by iterating over the aggregation functions and combining all aggregation states into a global state.
-            finalHashMap.insertOrUpdateEntry(
-                entryRef.entryRef,
-                [fieldKeys = hashMapOptions.fieldKeys,
-                 fieldValues = hashMapOptions.fieldValues,
-                 &executionCtx,
-                 &entryRef,
-                 &aggregationPhysicalFunctions = aggregationPhysicalFunctions,
-                 hashMapPtr = hashMapPtr](const nautilus::val<Interface::AbstractHashMapEntry*>& entryOnUpdate)
-                {
-                    /// Combining the aggregation states of the current entry with the aggregation states of the final hash map
-                    const Interface::ChainedHashMapRef::ChainedEntryRef entryRefOnInsert(entryOnUpdate, hashMapPtr, fieldKeys, fieldValues);
-                    auto globalState = static_cast<nautilus::val<AggregationState*>>(entryRefOnInsert.getValueMemArea());
-                    auto entryRefState = static_cast<nautilus::val<AggregationState*>>(entryRef.getValueMemArea());
-                    for (const auto& aggFunction : nautilus::static_iterable(aggregationPhysicalFunctions))
-                    {
-                        aggFunction->combine(globalState, entryRefState, executionCtx.pipelineMemoryProvider);
-                        globalState = globalState + aggFunction->getSizeOfStateInBytes();
-                        entryRefState = entryRefState + aggFunction->getSizeOfStateInBytes();
-                    }
-                },
-                [fieldKeys = hashMapOptions.fieldKeys,
-                 fieldValues = hashMapOptions.fieldValues,
-                 &executionCtx,
-                 &entryRef,
-                 &aggregationPhysicalFunctions = aggregationPhysicalFunctions,
-                 hashMapPtr = hashMapPtr](const nautilus::val<Interface::AbstractHashMapEntry*>& entryOnInsert)
-                {
-                    /// If the entry for the provided key has not been seen by this hash map / worker thread, we need
-                    /// to create a new one and initialize the aggregation states. After that, we can combine the aggregation states.
-                    const Interface::ChainedHashMapRef::ChainedEntryRef entryRefOnInsert(entryOnInsert, hashMapPtr, fieldKeys, fieldValues);
-                    auto globalState = static_cast<nautilus::val<AggregationState*>>(entryRefOnInsert.getValueMemArea());
-                    auto entryRefStatePtr = static_cast<nautilus::val<AggregationState*>>(entryRef.getValueMemArea());
-                    for (const auto& aggFunction : nautilus::static_iterable(aggregationPhysicalFunctions))
-                    {
-                        /// In contrast to the lambda method above, we have to reset the aggregation state before combining it with the other state
-                        aggFunction->reset(globalState, executionCtx.pipelineMemoryProvider);
-                        aggFunction->combine(globalState, entryRefStatePtr, executionCtx.pipelineMemoryProvider);
-                        globalState = globalState + aggFunction->getSizeOfStateInBytes();
-                        entryRefStatePtr = entryRefStatePtr + aggFunction->getSizeOfStateInBytes();
-                    }
-                },
-                executionCtx.pipelineMemoryProvider.bufferProvider);
+            combineAggregationHashMaps(
+                executionCtx,
+                hashMapOptions,
+                aggregationPhysicalFunctions,
+                invoke(getCombineStepTargetProxy, aggregationWindowRef, combineStep),
+                invoke(getCombineStepSourceProxy, aggregationWindowRef, combineStep));
+        }
+        const auto numberOfCombineSteps = invoke(finishIncrementalAggregationProxy, operatorHandler, aggregationWindowRef);
+        for (auto combineStep = numberOfLockedCombineSteps; combineStep < numberOfCombineSteps; ++combineStep)
+        {
+            combineAggregationHashMaps(
+                executionCtx,
+                hashMapOptions,
+                aggregationPhysicalFunctions,
+                invoke(getCombineStepTargetProxy, aggregationWindowRef, combineStep),
+                invoke(getCombineStepSourceProxy, aggregationWindowRef, combineStep));
+        }
+    }
+    else
+    {
+        for (nautilus::val<uint64_t> curHashMap = 0; curHashMap < numberOfHashMaps; ++curHashMap)
+        {
+            const nautilus::val<Interface::HashMap*> hashMapPtr = hashMapRefs[curHashMap];
+            combineAggregationHashMaps(executionCtx, hashMapOptions, aggregationPhysicalFunctions, finalHashMapPtr, hashMapPtr);
         }
     }
+    const auto finalHashMap = hashMapOptions.createHashMapRef(finalHashMapPtr);
 
-    /// Lowering, each aggregation state in the final hash map and passing the record to the child
-    for (const auto entry : finalHashMap)
+    /// Lowering an entry of the final hash map into a record of its aggregation states, keys, and the window start and end
+    const auto lowerEntry = [&](const nautilus::val<Interface::ChainedHashMapEntry*>& entry)
     {
         const Interface::ChainedHashMapRef::ChainedEntryRef entryRef(
             entry, finalHashMapPtr, hashMapOptions.fieldKeys, hashMapOptions.fieldValues);
-        const auto recordKey = entryRef.getKey();
         Record outputRecord;
         for (auto finalStatePtr = static_cast<nautilus::val<AggregationState*>>(entryRef.getValueMemArea());
              const auto& aggFunction : nautilus::static_iterable(aggregationPhysicalFunctions))
@@ -147,19 +213,53 @@ void AggregationProbePhysicalOperator::open(ExecutionContext& executionCtx, Reco
             outputRecord.reassignFields(aggFunction->lower(finalStatePtr, executionCtx.pipelineMemoryProvider));
             finalStatePtr = finalStatePtr + aggFunction->getSizeOfStateInBytes();
         }
-
-        /// Adding the window start and end to the output record and then passing the record to the child
-        outputRecord.reassignFields(recordKey);
+        outputRecord.reassignFields(entryRef.getKey());
         outputRecord.write(windowMetaData.windowStartFieldName, windowStart.convertToValue());
         outputRecord.write(windowMetaData.windowEndFieldName, windowEnd.convertToValue());
-        executeChild(executionCtx, outputRecord);
-
+        return outputRecord;
+    };
+    const auto cleanupEntry = [&](const nautilus::val<Interface::ChainedHashMapEntry*>& entry)
+    {
+        const Interface::ChainedHashMapRef::ChainedEntryRef entryRef(
+            entry, finalHashMapPtr, hashMapOptions.fieldKeys, hashMapOptions.fieldValues);
         for (auto finalStatePtr = static_cast<nautilus::val<AggregationState*>>(entryRef.getValueMemArea());
              const auto& aggFunction : nautilus::static_iterable(aggregationPhysicalFunctions))
         {
             aggFunction->cleanup(finalStatePtr);
             finalStatePtr = finalStatePtr + aggFunction->getSizeOfStateInBytes();
         }
+    };
+
+    if (topN.has_value())
+    {
+        /// The values of the groups are final solely after combining all slices, thus we select the top n of the final hash map.
+        /// Solely the entries of the top n are lowered a second time and passed to the child.
+        const nautilus::val<uint64_t> limit{topN->limit};
+        const nautilus::val<bool> descending{topN->descending};
+        for (const auto entry : *finalHashMap)
+        {
+            const auto orderValue
+                = lowerEntry(entry).read(topN->orderFieldName).castToType(DataType::Type::FLOAT64).cast<nautilus::val<double>>();
+            invoke(offerTopNEntryProxy, aggregationWindowRef, orderValue, entry, limit, descending);
+        }
+        const auto numberOfTopNEntries = invoke(sortTopNEntriesProxy, aggregationWindowRef, descending);
+        for (nautilus::val<uint64_t> rank = 0; rank < numberOfTopNEntries; ++rank)
+        {
+            executeChild(executionCtx, lowerEntry(invoke(getTopNEntryProxy, aggregationWindowRef, rank)));
+        }
+        for (const auto entry : *finalHashMap)
+        {
+            cleanupEntry(entry);
+        }
+    }
+    else
+    {
+        /// Lowering, each aggregation state in the final hash map and passing the record to the child
+        for (const auto entry : *finalHashMap)
+        {
+            executeChild(executionCtx, lowerEntry(entry));
+            cleanupEntry(entry);
+        }
     }
 
     /// As we are creating a new hash map for the probe operator, we have to reset/destroy the final hash map of the emitted aggregation window
@@ -171,6 +271,10 @@ void AggregationProbePhysicalOperator::open(ExecutionContext& executionCtx, Reco
                 emittedAggregationWindow->windowInfo.windowStart,
                 emittedAggregationWindow->windowInfo.windowEnd);
             emittedAggregationWindow->finalHashMap.reset();
+            /// Releasing the slices of the incremental aggregation, as the emitted window itself is never destructed
+            std::vector<std::shared_ptr<AggregationSlice>>().swap(emittedAggregationWindow->slices);
+            std::vector<std::pair<Interface::HashMap*, Interface::HashMap*>>().swap(emittedAggregationWindow->combineSteps);
+            std::vector<std::pair<double, Interface::ChainedHashMapEntry*>>().swap(emittedAggregationWindow->topNEntries);
         },
         aggregationWindowRef);
 }
@@ -179,10 +283,14 @@ AggregationProbePhysicalOperator::AggregationProbePhysicalOperator(
     HashMapOptions hashMapOptions,
     std::vector<std::shared_ptr<AggregationPhysicalFunction>> aggregationPhysicalFunctions,
     const OperatorHandlerId operatorHandlerId,
-    WindowMetaData windowMetaData)
+    WindowMetaData windowMetaData,
+    const bool incrementalAggregation,
+    std::optional<TopN> topN)
     : WindowProbePhysicalOperator(operatorHandlerId, std::move(windowMetaData))
     , aggregationPhysicalFunctions(std::move(aggregationPhysicalFunctions))
     , hashMapOptions(std::move(hashMapOptions))
+    , incrementalAggregation(incrementalAggregation)
+    , topN(std::move(topN))
 {
 }
 }
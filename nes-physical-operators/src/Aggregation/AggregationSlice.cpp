@@ -14,6 +14,7 @@
 #include <Aggregation/AggregationSlice.hpp>
 
 #include <cstdint>
+#include <initializer_list>
 #include <memory>
 #include <utility>
 #include <Identifiers/Identifiers.hpp>
@@ -30,31 +31,86 @@ AggregationSlice::AggregationSlice(
     const SliceEnd sliceEnd,
     const CreateNewHashMapSliceArgs& createNewHashMapSliceArgs,
     const uint64_t numberOfHashMaps)
-    : HashMapSlice(sliceStart, sliceEnd, createNewHashMapSliceArgs, numberOfHashMaps, 1)
+    : HashMapSlice(sliceStart, sliceEnd, createNewHashMapSliceArgs, numberOfHashMaps * createNewHashMapSliceArgs.numberOfPartitions, 1)
 {
+    PRECONDITION(createNewHashMapSliceArgs.numberOfPartitions > 0, "An aggregation slice requires at least one partition");
 }
 
-Nautilus::Interface::HashMap* AggregationSlice::getHashMapPtr(const WorkerThreadId workerThreadId) const
+AggregationSlice::~AggregationSlice()
 {
-    const auto pos = workerThreadId % hashMaps.size();
-    INVARIANT(pos < hashMaps.size(), "The worker thread id should be smaller than the number of hashmaps");
-    return hashMaps[pos].get();
+    /// The prefix and suffix hash maps store aggregation states of their own. Thus, we have to clean them up as the other hash maps.
+    for (auto* const hashMap : {&prefixHashMap, &suffixHashMap})
+    {
+        if (*hashMap != nullptr and (*hashMap)->getNumberOfTuples() > 0)
+        {
+            createNewHashMapSliceArgs.nautilusCleanup[0]->operator()(hashMap->get());
+        }
+        if (*hashMap != nullptr)
+        {
+            recycleHashMap(std::move(*hashMap));
+        }
+    }
 }
 
-Nautilus::Interface::HashMap* AggregationSlice::getHashMapPtrOrCreate(const WorkerThreadId workerThreadId)
+uint64_t AggregationSlice::getHashMapPosition(const WorkerThreadId workerThreadId, const uint64_t partition) const
 {
-    const auto pos = workerThreadId % hashMaps.size();
+    PRECONDITION(
+        partition < createNewHashMapSliceArgs.numberOfPartitions,
+        "Partition {} is not smaller than the number of partitions {}",
+        partition,
+        createNewHashMapSliceArgs.numberOfPartitions);
+    const auto pos = ((workerThreadId % getNumberOfHashMapsPerPartition()) * createNewHashMapSliceArgs.numberOfPartitions) + partition;
     INVARIANT(pos < hashMaps.size(), "The worker thread id should be smaller than the number of hashmaps");
+    return pos;
+}
+
+Nautilus::Interface::HashMap* AggregationSlice::getHashMapPtr(const WorkerThreadId workerThreadId, const uint64_t partition) const
+{
+    return hashMaps[getHashMapPosition(workerThreadId, partition)].get();
+}
 
+Nautilus::Interface::HashMap* AggregationSlice::getHashMapPtrOrCreate(const WorkerThreadId workerThreadId, const uint64_t partition)
+{
+    const auto pos = getHashMapPosition(workerThreadId, partition);
     if (hashMaps.at(pos) == nullptr)
     {
-        hashMaps.at(pos) = std::make_unique<Nautilus::Interface::ChainedHashMap>(
-            createNewHashMapSliceArgs.keySize,
-            createNewHashMapSliceArgs.valueSize,
-            createNewHashMapSliceArgs.numberOfBuckets,
-            createNewHashMapSliceArgs.pageSize);
+        hashMaps.at(pos) = createHashMap();
     }
     return hashMaps[pos].get();
 }
 
+uint64_t AggregationSlice::getNumberOfHashMapsPerPartition() const
+{
+    return hashMaps.size() / createNewHashMapSliceArgs.numberOfPartitions;
+}
+
+uint64_t AggregationSlice::getNumberOfPartitions() const
+{
+    return createNewHashMapSliceArgs.numberOfPartitions;
+}
+
+Nautilus::Interface::HashMap* AggregationSlice::getPrefixHashMapPtr() const
+{
+    return prefixHashMap.get();
+}
+
+Nautilus::Interface::HashMap* AggregationSlice::getSuffixHashMapPtr() const
+{
+    return suffixHashMap.get();
+}
+
+Nautilus::Interface::HashMap* AggregationSlice::createPrefixHashMap()
+{
+    PRECONDITION(prefixHashMap == nullptr, "The prefix hash map of slice {}-{} has been created already", sliceStart, sliceEnd);
+    prefixHashMap = createHashMap();
+    return prefixHashMap.get();
+}
+
+Nautilus::Interface::HashMap* AggregationSlice::createSuffixHashMap()
+{
+    PRECONDITION(suffixHashMap == nullptr, "The suffix hash map of slice {}-{} has been created already", sliceStart, sliceEnd);
+    suffixHashMap = createHashMap();
+    return suffixHashMap.get();
+}
+
 }
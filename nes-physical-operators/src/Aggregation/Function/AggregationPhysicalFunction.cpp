@@ -14,10 +14,18 @@
 
 #include <Aggregation/Function/AggregationPhysicalFunction.hpp>
 
+#include <memory>
 #include <utility>
+#include <vector>
 #include <DataTypes/DataType.hpp>
 #include <Functions/PhysicalFunction.hpp>
+#include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMapRef.hpp>
+#include <Nautilus/Interface/HashMap/HashMap.hpp>
 #include <Nautilus/Interface/Record.hpp>
+#include <ExecutionContext.hpp>
+#include <HashMapOptions.hpp>
+#include <static.hpp>
+#include <val_ptr.hpp>
 
 namespace NES
 {
@@ -32,4 +40,68 @@ AggregationPhysicalFunction::AggregationPhysicalFunction(
 }
 
 AggregationPhysicalFunction::~AggregationPhysicalFunction() = default;
+
+void combineAggregationHashMaps(
+    ExecutionContext& executionCtx,
+    const HashMapOptions& hashMapOptions,
+    const std::vector<std::shared_ptr<AggregationPhysicalFunction>>& aggregationPhysicalFunctions,
+    const nautilus::val<Interface::HashMap*>& targetHashMapPtr,
+    const nautilus::val<Interface::HashMap*>& hashMapPtr)
+{
+    const auto targetHashMap = hashMapOptions.createHashMapRef(targetHashMapPtr);
+    const Interface::ChainedHashMapRef currentMap(
+        hashMapPtr, hashMapOptions.fieldKeys, hashMapOptions.fieldValues, hashMapOptions.entriesPerPage, hashMapOptions.entrySize);
+    for (const auto entry : currentMap)
+    {
+        const Interface::ChainedHashMapRef::ChainedEntryRef entryRef(
+            entry, hashMapPtr, hashMapOptions.fieldKeys, hashMapOptions.fieldValues);
+        const auto tmpRecordKey = entryRef.getKey();
+
+        /// Inserting the record key into the target hash map. If an entry for the key already exists, we have to combine the aggregation states
+        /// We do this by iterating over the aggregation functions and combining all aggregation states into a global state.
+        targetHashMap->insertOrUpdateEntry(
+            entryRef.entryRef,
+            [fieldKeys = hashMapOptions.fieldKeys,
+             fieldValues = hashMapOptions.fieldValues,
+             &executionCtx,
+             &entryRef,
+             &aggregationPhysicalFunctions = aggregationPhysicalFunctions,
+             hashMapPtr = hashMapPtr](const nautilus::val<Interface::AbstractHashMapEntry*>& entryOnUpdate)
+            {
+                /// Combining the aggregation states of the current entry with the aggregation states of the final hash map
+                const Interface::ChainedHashMapRef::ChainedEntryRef entryRefOnInsert(entryOnUpdate, hashMapPtr, fieldKeys, fieldValues);
+                auto globalState = static_cast<nautilus::val<AggregationState*>>(entryRefOnInsert.getValueMemArea());
+                auto entryRefState = static_cast<nautilus::val<AggregationState*>>(entryRef.getValueMemArea());
+                for (const auto& aggFunction : nautilus::static_iterable(aggregationPhysicalFunctions))
+                {
+                    aggFunction->combine(globalState, entryRefState, executionCtx.pipelineMemoryProvider);
+                    globalState = globalState + aggFunction->getSizeOfStateInBytes();
+                    entryRefState = entryRefState + aggFunction->getSizeOfStateInBytes();
+                }
+            },
+            [fieldKeys = hashMapOptions.fieldKeys,
+             fieldValues = hashMapOptions.fieldValues,
+             &executionCtx,
+             &entryRef,
+             &aggregationPhysicalFunctions = aggregationPhysicalFunctions,
+             hashMapPtr = hashMapPtr](const nautilus::val<Interface::AbstractHashMapEntry*>& entryOnInsert)
+            {
+                /// If the entry for the provided key has not been seen by this hash map / worker thread, we need
+                /// to create a new one and initialize the aggregation states. After that, we can combine the aggregation states.
+                const Interface::ChainedHashMapRef::ChainedEntryRef entryRefOnInsert(entryOnInsert, hashMapPtr, fieldKeys, fieldValues);
+                auto globalState = static_cast<nautilus::val<AggregationState*>>(entryRefOnInsert.getValueMemArea());
+                auto entryRefStatePtr = static_cast<nautilus::val<AggregationState*>>(entryRef.getValueMemArea());
+                for (const auto& aggFunction : nautilus::static_iterable(aggregationPhysicalFunctions))
+                {
+                    /// In contrast to the lambda method above, we have to reset the aggregation state before combining it with the other state
+                    aggFunction->reset(globalState, executionCtx.pipelineMemoryProvider);
+                    aggFunction->combine(globalState, entryRefStatePtr, executionCtx.pipelineMemoryProvider);
+                    globalState = globalState + aggFunction->getSizeOfStateInBytes();
+                    entryRefStatePtr = entryRefStatePtr + aggFunction->getSizeOfStateInBytes();
+                }
+            },
+            executionCtx.pipelineMemoryProvider.bufferProvider);
+    }
+}
+
 }
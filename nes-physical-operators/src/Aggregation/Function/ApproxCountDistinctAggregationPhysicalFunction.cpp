@@ -0,0 +1,122 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Aggregation/Function/ApproxCountDistinctAggregationPhysicalFunction.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <Aggregation/Function/AggregationPhysicalFunction.hpp>
+#include <Aggregation/Function/ApproxCountDistinctSketch.hpp>
+#include <DataTypes/DataType.hpp>
+#include <Functions/PhysicalFunction.hpp>
+#include <Nautilus/DataTypes/VarVal.hpp>
+#include <Nautilus/Interface/Hash/HashFunction.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <nautilus/function.hpp>
+#include <AggregationPhysicalFunctionRegistry.hpp>
+#include <ExecutionContext.hpp>
+#include <val.hpp>
+#include <val_ptr.hpp>
+
+namespace NES
+{
+
+namespace
+{
+ApproxCountDistinctSketch* getSketch(AggregationState* aggregationState)
+{
+    return *reinterpret_cast<ApproxCountDistinctSketch**>(aggregationState); /// NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+}
+}
+
+ApproxCountDistinctAggregationPhysicalFunction::ApproxCountDistinctAggregationPhysicalFunction(
+    DataType inputType, DataType resultType, PhysicalFunction inputFunction, Nautilus::Record::RecordFieldIdentifier resultFieldIdentifier)
+    : AggregationPhysicalFunction(std::move(inputType), std::move(resultType), std::move(inputFunction), std::move(resultFieldIdentifier))
+    , hashFunction(Nautilus::Interface::HashFunction::create(Nautilus::Interface::HashFunctionType::MURMUR3))
+{
+}
+
+void ApproxCountDistinctAggregationPhysicalFunction::lift(
+    const nautilus::val<AggregationState*>& aggregationState,
+    PipelineMemoryProvider& pipelineMemoryProvider,
+    const Nautilus::Record& record)
+{
+    const auto value = inputFunction.execute(record, pipelineMemoryProvider.arena);
+    nautilus::invoke(
+        +[](AggregationState* aggregationStatePtr, const uint64_t hash) -> void { getSketch(aggregationStatePtr)->insertHash(hash); },
+        aggregationState,
+        hashFunction->calculate(value));
+}
+
+void ApproxCountDistinctAggregationPhysicalFunction::combine(
+    const nautilus::val<AggregationState*> aggregationState1,
+    const nautilus::val<AggregationState*> aggregationState2,
+    PipelineMemoryProvider&)
+{
+    /// Merging the registers of the second sketch into the first one, which is independent of the number of values
+    nautilus::invoke(
+        +[](AggregationState* aggregationStatePtr1, AggregationState* aggregationStatePtr2) -> void
+        { getSketch(aggregationStatePtr1)->merge(*getSketch(aggregationStatePtr2)); },
+        aggregationState1,
+        aggregationState2);
+}
+
+Nautilus::Record
+ApproxCountDistinctAggregationPhysicalFunction::lower(const nautilus::val<AggregationState*> aggregationState, PipelineMemoryProvider&)
+{
+    const auto numberOfDistinctValues = nautilus::invoke(
+        +[](AggregationState* aggregationStatePtr) -> uint64_t { return getSketch(aggregationStatePtr)->getNumberOfDistinctValues(); },
+        aggregationState);
+    return Nautilus::Record({{resultFieldIdentifier, VarVal(numberOfDistinctValues).castToType(resultType.type)}});
+}
+
+void ApproxCountDistinctAggregationPhysicalFunction::reset(const nautilus::val<AggregationState*> aggregationState, PipelineMemoryProvider&)
+{
+    nautilus::invoke(
+        +[](AggregationState* aggregationStatePtr) -> void
+        {
+            /// Allocates a new, empty sketch and stores the pointer to it in the aggregation state
+            /// NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast, cppcoreguidelines-owning-memory)
+            *reinterpret_cast<ApproxCountDistinctSketch**>(aggregationStatePtr) = new ApproxCountDistinctSketch();
+        },
+        aggregationState);
+}
+
+void ApproxCountDistinctAggregationPhysicalFunction::cleanup(const nautilus::val<AggregationState*> aggregationState)
+{
+    nautilus::invoke(
+        +[](AggregationState* aggregationStatePtr) -> void
+        {
+            /// Deletes the sketch that reset() allocated
+            delete getSketch(aggregationStatePtr); /// NOLINT(cppcoreguidelines-owning-memory)
+        },
+        aggregationState);
+}
+
+size_t ApproxCountDistinctAggregationPhysicalFunction::getSizeOfStateInBytes() const
+{
+    return sizeof(ApproxCountDistinctSketch*);
+}
+
+AggregationPhysicalFunctionRegistryReturnType
+AggregationPhysicalFunctionGeneratedRegistrar::RegisterApproxCountDistinctAggregationPhysicalFunction(
+    AggregationPhysicalFunctionRegistryArguments arguments)
+{
+    return std::make_shared<ApproxCountDistinctAggregationPhysicalFunction>(
+        std::move(arguments.inputType), std::move(arguments.resultType), arguments.inputFunction, arguments.resultFieldIdentifier);
+}
+
+}
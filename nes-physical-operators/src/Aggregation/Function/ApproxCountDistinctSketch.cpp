@@ -0,0 +1,63 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Aggregation/Function/ApproxCountDistinctSketch.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+
+namespace NES
+{
+
+void ApproxCountDistinctSketch::insertHash(const uint64_t hash)
+{
+    /// The first bits select the register and the position of the first one bit in the remaining bits determines the rank.
+    /// Setting the last bit bounds the rank, if all remaining bits are zero.
+    const auto registerIndex = hash >> (64 - PRECISION);
+    const auto remainingBits = (hash << PRECISION) | (1UL << (PRECISION - 1));
+    const auto rank = static_cast<uint8_t>(std::countl_zero(remainingBits) + 1);
+    registers[registerIndex] = std::max(registers[registerIndex], rank);
+}
+
+void ApproxCountDistinctSketch::merge(const ApproxCountDistinctSketch& other)
+{
+    std::ranges::transform(
+        registers, other.registers, registers.begin(), [](const uint8_t reg, const uint8_t otherReg) { return std::max(reg, otherReg); });
+}
+
+uint64_t ApproxCountDistinctSketch::getNumberOfDistinctValues() const
+{
+    constexpr auto numberOfRegisters = static_cast<double>(NUMBER_OF_REGISTERS);
+    constexpr auto alpha = 0.7213 / (1 + (1.079 / numberOfRegisters));
+
+    double harmonicSum = 0;
+    uint64_t numberOfEmptyRegisters = 0;
+    for (const auto reg : registers)
+    {
+        harmonicSum += std::ldexp(1.0, -reg);
+        numberOfEmptyRegisters += reg == 0 ? 1 : 0;
+    }
+    const auto estimate = alpha * numberOfRegisters * numberOfRegisters / harmonicSum;
+
+    /// For small cardinalities, many registers are still empty and linear counting over the empty registers is more accurate
+    if (estimate <= 2.5 * numberOfRegisters and numberOfEmptyRegisters > 0)
+    {
+        return std::llround(numberOfRegisters * std::log(numberOfRegisters / static_cast<double>(numberOfEmptyRegisters)));
+    }
+    return std::llround(estimate);
+}
+
+}
@@ -0,0 +1,133 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Aggregation/Function/ApproxQuantileAggregationPhysicalFunction.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <Aggregation/Function/AggregationPhysicalFunction.hpp>
+#include <Aggregation/Function/ApproxQuantileSketch.hpp>
+#include <DataTypes/DataType.hpp>
+#include <Functions/PhysicalFunction.hpp>
+#include <Nautilus/DataTypes/VarVal.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <nautilus/function.hpp>
+#include <AggregationPhysicalFunctionRegistry.hpp>
+#include <ErrorHandling.hpp>
+#include <ExecutionContext.hpp>
+#include <val.hpp>
+#include <val_ptr.hpp>
+
+namespace NES
+{
+
+namespace
+{
+ApproxQuantileSketch* getSketch(AggregationState* aggregationState)
+{
+    return *reinterpret_cast<ApproxQuantileSketch**>(aggregationState); /// NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+}
+}
+
+ApproxQuantileAggregationPhysicalFunction::ApproxQuantileAggregationPhysicalFunction(
+    DataType inputType,
+    DataType resultType,
+    PhysicalFunction inputFunction,
+    Nautilus::Record::RecordFieldIdentifier resultFieldIdentifier,
+    const double quantile)
+    : AggregationPhysicalFunction(std::move(inputType), std::move(resultType), std::move(inputFunction), std::move(resultFieldIdentifier))
+    , quantile(quantile)
+{
+    PRECONDITION(0 <= quantile and quantile <= 1, "The quantile must be in [0, 1], but got {}", quantile);
+}
+
+void ApproxQuantileAggregationPhysicalFunction::lift(
+    const nautilus::val<AggregationState*>& aggregationState,
+    PipelineMemoryProvider& pipelineMemoryProvider,
+    const Nautilus::Record& record)
+{
+    const auto value = inputFunction.execute(record, pipelineMemoryProvider.arena).castToType(DataType::Type::FLOAT64);
+    nautilus::invoke(
+        +[](AggregationState* aggregationStatePtr, const double valueToInsert) -> void
+        { getSketch(aggregationStatePtr)->insert(valueToInsert); },
+        aggregationState,
+        value.cast<nautilus::val<double>>());
+}
+
+void ApproxQuantileAggregationPhysicalFunction::combine(
+    const nautilus::val<AggregationState*> aggregationState1,
+    const nautilus::val<AggregationState*> aggregationState2,
+    PipelineMemoryProvider&)
+{
+    /// Merging the centroids of the second sketch into the first one, which is independent of the number of values
+    nautilus::invoke(
+        +[](AggregationState* aggregationStatePtr1, AggregationState* aggregationStatePtr2) -> void
+        { getSketch(aggregationStatePtr1)->merge(*getSketch(aggregationStatePtr2)); },
+        aggregationState1,
+        aggregationState2);
+}
+
+Nautilus::Record
+ApproxQuantileAggregationPhysicalFunction::lower(const nautilus::val<AggregationState*> aggregationState, PipelineMemoryProvider&)
+{
+    const auto quantileValue = nautilus::invoke(
+        +[](AggregationState* aggregationStatePtr, const double quantileToLower) -> double
+        { return getSketch(aggregationStatePtr)->getQuantile(quantileToLower); },
+        aggregationState,
+        nautilus::val<double>(quantile));
+    return Nautilus::Record({{resultFieldIdentifier, VarVal(quantileValue).castToType(resultType.type)}});
+}
+
+void ApproxQuantileAggregationPhysicalFunction::reset(const nautilus::val<AggregationState*> aggregationState, PipelineMemoryProvider&)
+{
+    nautilus::invoke(
+        +[](AggregationState* aggregationStatePtr) -> void
+        {
+            /// Allocates a new, empty sketch and stores the pointer to it in the aggregation state
+            /// NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast, cppcoreguidelines-owning-memory)
+            *reinterpret_cast<ApproxQuantileSketch**>(aggregationStatePtr) = new ApproxQuantileSketch();
+        },
+        aggregationState);
+}
+
+void ApproxQuantileAggregationPhysicalFunction::cleanup(const nautilus::val<AggregationState*> aggregationState)
+{
+    nautilus::invoke(
+        +[](AggregationState* aggregationStatePtr) -> void
+        {
+            /// Deletes the sketch that reset() allocated
+            delete getSketch(aggregationStatePtr); /// NOLINT(cppcoreguidelines-owning-memory)
+        },
+        aggregationState);
+}
+
+size_t ApproxQuantileAggregationPhysicalFunction::getSizeOfStateInBytes() const
+{
+    return sizeof(ApproxQuantileSketch*);
+}
+
+AggregationPhysicalFunctionRegistryReturnType AggregationPhysicalFunctionGeneratedRegistrar::RegisterApproxQuantileAggregationPhysicalFunction(
+    AggregationPhysicalFunctionRegistryArguments arguments)
+{
+    INVARIANT(arguments.quantile.has_value(), "Quantile of the approximate quantile aggregation not set");
+    return std::make_shared<ApproxQuantileAggregationPhysicalFunction>(
+        std::move(arguments.inputType),
+        std::move(arguments.resultType),
+        arguments.inputFunction,
+        arguments.resultFieldIdentifier,
+        arguments.quantile.value());
+}
+
+}
@@ -0,0 +1,150 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Aggregation/Function/ApproxQuantileSketch.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <numbers>
+#include <span>
+#include <ErrorHandling.hpp>
+
+namespace NES
+{
+
+namespace
+{
+/// The k1 scale function maps a quantile to k in [-COMPRESSION / 4, COMPRESSION / 4]. A centroid may span at most 1 in k.
+double quantileToK(const double quantile)
+{
+    return static_cast<double>(ApproxQuantileSketch::COMPRESSION) / (2 * std::numbers::pi) * std::asin((2 * quantile) - 1);
+}
+
+double kToQuantile(const double k)
+{
+    const auto angle = std::min(k * 2 * std::numbers::pi / static_cast<double>(ApproxQuantileSketch::COMPRESSION), std::numbers::pi / 2);
+    return (std::sin(angle) + 1) / 2;
+}
+}
+
+void ApproxQuantileSketch::insert(const double value)
+{
+    addCentroid({.mean = value, .weight = 1});
+    min = std::min(min, value);
+    max = std::max(max, value);
+}
+
+void ApproxQuantileSketch::merge(const ApproxQuantileSketch& other)
+{
+    for (const auto& centroid : std::span(other.centroids).first(other.numberOfCentroids))
+    {
+        addCentroid(centroid);
+    }
+    min = std::min(min, other.min);
+    max = std::max(max, other.max);
+}
+
+double ApproxQuantileSketch::getQuantile(const double quantile)
+{
+    PRECONDITION(0 <= quantile and quantile <= 1, "The quantile must be in [0, 1], but got {}", quantile);
+    if (numberOfCentroids == 0)
+    {
+        return 0;
+    }
+    compress();
+
+    /// Each centroid represents its values around its mean. Thus, the values up to the center of the first centroid lie between the
+    /// minimum and its mean and the values after the center of the last centroid between its mean and the maximum.
+    const auto targetWeight = quantile * totalWeight;
+    const auto& first = centroids[0];
+    if (targetWeight <= first.weight / 2)
+    {
+        return min + ((first.mean - min) * targetWeight / (first.weight / 2));
+    }
+
+    auto weightUpToCenter = first.weight / 2;
+    for (uint64_t i = 1; i < numberOfCentroids; ++i)
+    {
+        const auto& previous = centroids[i - 1];
+        const auto& current = centroids[i];
+        const auto weightUpToNextCenter = weightUpToCenter + ((previous.weight + current.weight) / 2);
+        if (targetWeight <= weightUpToNextCenter)
+        {
+            return previous.mean
+                + ((current.mean - previous.mean) * (targetWeight - weightUpToCenter) / (weightUpToNextCenter - weightUpToCenter));
+        }
+        weightUpToCenter = weightUpToNextCenter;
+    }
+
+    const auto& last = centroids[numberOfCentroids - 1];
+    return std::min(max, last.mean + ((max - last.mean) * (targetWeight - weightUpToCenter) / (last.weight / 2)));
+}
+
+uint64_t ApproxQuantileSketch::getNumberOfValues() const
+{
+    return static_cast<uint64_t>(totalWeight);
+}
+
+uint64_t ApproxQuantileSketch::getNumberOfCentroids() const
+{
+    return numberOfCentroids;
+}
+
+void ApproxQuantileSketch::addCentroid(const Centroid centroid)
+{
+    if (numberOfCentroids == CAPACITY)
+    {
+        compress();
+        INVARIANT(numberOfCentroids < CAPACITY, "Compressing {} centroids must free at least one centroid", CAPACITY);
+    }
+    centroids[numberOfCentroids++] = centroid;
+    totalWeight += centroid.weight;
+}
+
+void ApproxQuantileSketch::compress()
+{
+    if (numberOfCompressedCentroids == numberOfCentroids)
+    {
+        return;
+    }
+
+    const auto uncompressedCentroids = std::span(centroids).first(numberOfCentroids);
+    std::ranges::sort(uncompressedCentroids, {}, &Centroid::mean);
+
+    /// Greedily merging each centroid into its predecessor, if the merged centroid does not exceed the weight limit of its quantiles
+    uint64_t lastCentroid = 0;
+    double weightBeforeLastCentroid = 0;
+    auto maxQuantileOfLastCentroid = kToQuantile(quantileToK(0) + 1);
+    for (uint64_t i = 1; i < numberOfCentroids; ++i)
+    {
+        auto& last = centroids[lastCentroid];
+        const auto& current = centroids[i];
+        if ((weightBeforeLastCentroid + last.weight + current.weight) / totalWeight <= maxQuantileOfLastCentroid)
+        {
+            last.weight += current.weight;
+            last.mean += (current.mean - last.mean) * current.weight / last.weight;
+        }
+        else
+        {
+            weightBeforeLastCentroid += last.weight;
+            maxQuantileOfLastCentroid = kToQuantile(quantileToK(weightBeforeLastCentroid / totalWeight) + 1);
+            centroids[++lastCentroid] = current;
+        }
+    }
+    numberOfCentroids = lastCentroid + 1;
+    numberOfCompressedCentroids = numberOfCentroids;
+}
+
+}
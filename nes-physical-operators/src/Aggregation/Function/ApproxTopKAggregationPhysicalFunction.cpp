@@ -0,0 +1,183 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Aggregation/Function/ApproxTopKAggregationPhysicalFunction.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <utility>
+#include <Aggregation/Function/AggregationPhysicalFunction.hpp>
+#include <Aggregation/Function/ApproxTopKSketch.hpp>
+#include <DataTypes/DataType.hpp>
+#include <Functions/PhysicalFunction.hpp>
+#include <Nautilus/DataTypes/VarVal.hpp>
+#include <Nautilus/DataTypes/VariableSizedData.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <nautilus/function.hpp>
+#include <AggregationPhysicalFunctionRegistry.hpp>
+#include <ErrorHandling.hpp>
+#include <ExecutionContext.hpp>
+#include <val.hpp>
+#include <val_ptr.hpp>
+
+namespace NES
+{
+
+namespace
+{
+ApproxTopKSketch* getSketch(AggregationState* aggregationState)
+{
+    return *reinterpret_cast<ApproxTopKSketch**>(aggregationState); /// NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+}
+
+/// The sketch identifies a value by its 64-bit representation. Thus, we widen integers to UINT64, which keeps negative values distinct
+/// due to the two's complement, and floating point values to FLOAT64. Casting the key back to the input type restores the value.
+DataType::Type getKeyType(const DataType& inputType)
+{
+    return inputType.isFloat() ? DataType::Type::FLOAT64 : DataType::Type::UINT64;
+}
+}
+
+ApproxTopKAggregationPhysicalFunction::ApproxTopKAggregationPhysicalFunction(
+    DataType inputType,
+    DataType resultType,
+    PhysicalFunction inputFunction,
+    Nautilus::Record::RecordFieldIdentifier resultFieldIdentifier,
+    const uint64_t k)
+    : AggregationPhysicalFunction(std::move(inputType), std::move(resultType), std::move(inputFunction), std::move(resultFieldIdentifier))
+    , k(k)
+{
+    PRECONDITION(
+        0 < k and k <= ApproxTopKSketch::CAPACITY,
+        "The k of the approximate top-k must be in [1, {}], but got {}",
+        ApproxTopKSketch::CAPACITY,
+        k);
+}
+
+void ApproxTopKAggregationPhysicalFunction::lift(
+    const nautilus::val<AggregationState*>& aggregationState,
+    PipelineMemoryProvider& pipelineMemoryProvider,
+    const Nautilus::Record& record)
+{
+    const auto value = inputFunction.execute(record, pipelineMemoryProvider.arena).castToType(getKeyType(inputType));
+    if (inputType.isFloat())
+    {
+        nautilus::invoke(
+            +[](AggregationState* aggregationStatePtr, const double valueToInsert) -> void
+            { getSketch(aggregationStatePtr)->insert(std::bit_cast<uint64_t>(valueToInsert)); },
+            aggregationState,
+            value.cast<nautilus::val<double>>());
+    }
+    else
+    {
+        nautilus::invoke(
+            +[](AggregationState* aggregationStatePtr, const uint64_t valueToInsert) -> void
+            { getSketch(aggregationStatePtr)->insert(valueToInsert); },
+            aggregationState,
+            value.cast<nautilus::val<uint64_t>>());
+    }
+}
+
+void ApproxTopKAggregationPhysicalFunction::combine(
+    const nautilus::val<AggregationState*> aggregationState1,
+    const nautilus::val<AggregationState*> aggregationState2,
+    PipelineMemoryProvider&)
+{
+    /// Merging the counters of the second sketch into the first one, which is independent of the number of values
+    nautilus::invoke(
+        +[](AggregationState* aggregationStatePtr1, AggregationState* aggregationStatePtr2) -> void
+        { getSketch(aggregationStatePtr1)->merge(*getSketch(aggregationStatePtr2)); },
+        aggregationState1,
+        aggregationState2);
+}
+
+Nautilus::Record ApproxTopKAggregationPhysicalFunction::lower(
+    const nautilus::val<AggregationState*> aggregationState, PipelineMemoryProvider& pipelineMemoryProvider)
+{
+    /// Copying the keys of the top-k counters into a scratch array of the pipeline invocation
+    const auto keys = pipelineMemoryProvider.arena.allocateMemory(nautilus::val<size_t>(k * sizeof(uint64_t)));
+    const auto numberOfTopValues = nautilus::invoke(
+        +[](AggregationState* aggregationStatePtr, uint64_t* keysPtr, const uint64_t kToLower) -> uint64_t
+        {
+            const auto topK = getSketch(aggregationStatePtr)->getTopK(kToLower);
+            std::ranges::transform(topK, keysPtr, &ApproxTopKSketch::Counter::key);
+            return topK.size();
+        },
+        aggregationState,
+        static_cast<nautilus::val<uint64_t*>>(keys),
+        nautilus::val<uint64_t>(k));
+
+    /// Writing the top-k values with their input type into the result, c.f., ArrayAggregationPhysicalFunction
+    const auto valueSize = inputType.getSizeInBytes();
+    auto variableSized = pipelineMemoryProvider.arena.allocateVariableSizedData(
+        static_cast<nautilus::val<uint32_t>>(numberOfTopValues * nautilus::val<uint64_t>(valueSize)));
+    auto currentKey = keys;
+    auto currentValue = variableSized.getContent();
+    for (nautilus::val<uint64_t> i = 0; i < numberOfTopValues; i = i + 1)
+    {
+        VarVal::readVarValFromMemory(currentKey, getKeyType(inputType)).castToType(inputType.type).writeToMemory(currentValue);
+        currentKey += sizeof(uint64_t);
+        currentValue += valueSize;
+    }
+
+    Nautilus::Record resultRecord;
+    resultRecord.write(resultFieldIdentifier, variableSized);
+    return resultRecord;
+}
+
+void ApproxTopKAggregationPhysicalFunction::reset(const nautilus::val<AggregationState*> aggregationState, PipelineMemoryProvider&)
+{
+    nautilus::invoke(
+        +[](AggregationState* aggregationStatePtr) -> void
+        {
+            /// Allocates a new, empty sketch and stores the pointer to it in the aggregation state
+            /// NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast, cppcoreguidelines-owning-memory)
+            *reinterpret_cast<ApproxTopKSketch**>(aggregationStatePtr) = new ApproxTopKSketch();
+        },
+        aggregationState);
+}
+
+void ApproxTopKAggregationPhysicalFunction::cleanup(const nautilus::val<AggregationState*> aggregationState)
+{
+    nautilus::invoke(
+        +[](AggregationState* aggregationStatePtr) -> void
+        {
+            /// Deletes the sketch that reset() allocated
+            delete getSketch(aggregationStatePtr); /// NOLINT(cppcoreguidelines-owning-memory)
+        },
+        aggregationState);
+}
+
+size_t ApproxTopKAggregationPhysicalFunction::getSizeOfStateInBytes() const
+{
+    return sizeof(ApproxTopKSketch*);
+}
+
+AggregationPhysicalFunctionRegistryReturnType AggregationPhysicalFunctionGeneratedRegistrar::RegisterApproxTopKAggregationPhysicalFunction(
+    AggregationPhysicalFunctionRegistryArguments arguments)
+{
+    INVARIANT(arguments.k.has_value(), "K of the approximate top-k aggregation not set");
+    return std::make_shared<ApproxTopKAggregationPhysicalFunction>(
+        std::move(arguments.inputType),
+        std::move(arguments.resultType),
+        arguments.inputFunction,
+        arguments.resultFieldIdentifier,
+        arguments.k.value());
+}
+
+}
@@ -0,0 +1,104 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Aggregation/Function/ApproxTopKSketch.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <span>
+
+namespace NES
+{
+
+void ApproxTopKSketch::insert(const uint64_t key)
+{
+    const auto usedCounters = std::span(counters).first(numberOfCounters);
+    if (const auto counter = std::ranges::find(usedCounters, key, &Counter::key); counter != usedCounters.end())
+    {
+        ++counter->count;
+    }
+    else if (numberOfCounters < CAPACITY)
+    {
+        counters[numberOfCounters++] = {.key = key, .count = 1, .error = 0};
+    }
+    else
+    {
+        auto& smallestCounter = *std::ranges::min_element(usedCounters, {}, &Counter::count);
+        smallestCounter = {.key = key, .count = smallestCounter.count + 1, .error = smallestCounter.count};
+    }
+}
+
+void ApproxTopKSketch::merge(const ApproxTopKSketch& other)
+{
+    /// A value without a counter in one sketch might have occurred as often as the smallest counter of this sketch. Thus, we add this
+    /// count to the count and the error of the value, which keeps the guarantees of the sketch for the merged values.
+    const auto maximumCountOfMissingValues = getMaximumCountOfMissingValues();
+    const auto otherMaximumCountOfMissingValues = other.getMaximumCountOfMissingValues();
+    const auto otherCounters = std::span(other.counters).first(other.numberOfCounters);
+
+    std::array<Counter, 2 * CAPACITY> mergedCounters{};
+    uint64_t numberOfMergedCounters = 0;
+    for (const auto& counter : std::span(counters).first(numberOfCounters))
+    {
+        if (const auto otherCounter = std::ranges::find(otherCounters, counter.key, &Counter::key); otherCounter != otherCounters.end())
+        {
+            mergedCounters[numberOfMergedCounters++]
+                = {.key = counter.key, .count = counter.count + otherCounter->count, .error = counter.error + otherCounter->error};
+        }
+        else
+        {
+            mergedCounters[numberOfMergedCounters++] = {
+                .key = counter.key,
+                .count = counter.count + otherMaximumCountOfMissingValues,
+                .error = counter.error + otherMaximumCountOfMissingValues};
+        }
+    }
+    const auto usedCounters = std::span(counters).first(numberOfCounters);
+    for (const auto& otherCounter : otherCounters)
+    {
+        if (std::ranges::find(usedCounters, otherCounter.key, &Counter::key) == usedCounters.end())
+        {
+            mergedCounters[numberOfMergedCounters++] = {
+                .key = otherCounter.key,
+                .count = otherCounter.count + maximumCountOfMissingValues,
+                .error = otherCounter.error + maximumCountOfMissingValues};
+        }
+    }
+
+    /// Keeping the largest counters, which are the candidates for the top-k values
+    numberOfCounters = std::min(numberOfMergedCounters, CAPACITY);
+    const auto candidates = std::span(mergedCounters).first(numberOfMergedCounters);
+    std::ranges::partial_sort(candidates, candidates.begin() + numberOfCounters, std::ranges::greater{}, &Counter::count);
+    std::ranges::copy(candidates.first(numberOfCounters), counters.begin());
+}
+
+std::span<const ApproxTopKSketch::Counter> ApproxTopKSketch::getTopK(const uint64_t k)
+{
+    const auto usedCounters = std::span(counters).first(numberOfCounters);
+    std::ranges::sort(usedCounters, std::ranges::greater{}, &Counter::count);
+    return usedCounters.first(std::min(k, numberOfCounters));
+}
+
+uint64_t ApproxTopKSketch::getMaximumCountOfMissingValues() const
+{
+    if (numberOfCounters < CAPACITY)
+    {
+        return 0;
+    }
+    return std::ranges::min_element(counters, {}, &Counter::count)->count;
+}
+
+}
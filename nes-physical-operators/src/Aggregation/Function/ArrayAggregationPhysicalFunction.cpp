@@ -68,7 +68,8 @@ void ArrayAggregationPhysicalFunction::combine(
     const auto memArea1 = static_cast<nautilus::val<Nautilus::Interface::PagedVector*>>(aggregationState1);
     const auto memArea2 = static_cast<nautilus::val<Nautilus::Interface::PagedVector*>>(aggregationState2);
 
-    /// Calling the copyFrom function of the paged vector to combine the two paged vectors by copying the content of the second paged vector to the first paged vector
+    /// Combining the two paged vectors by sharing the pages of the second paged vector with the first one, which copies no entries.
+    /// The second state belongs to a slice, which the probes of other windows might still combine, thus we must not move its pages.
     nautilus::invoke(
         +[](Nautilus::Interface::PagedVector* vector1, const Nautilus::Interface::PagedVector* vector2) -> void
         { vector1->copyFrom(*vector2); },
@@ -0,0 +1,64 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Aggregation/Function/CorrAggregationPhysicalFunction.hpp>
+
+#include <cmath>
+#include <memory>
+#include <utility>
+#include <Aggregation/Function/AggregationPhysicalFunction.hpp>
+#include <Nautilus/DataTypes/VarVal.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <nautilus/function.hpp>
+#include <AggregationPhysicalFunctionRegistry.hpp>
+#include <ErrorHandling.hpp>
+#include <ExecutionContext.hpp>
+#include <val.hpp>
+
+namespace NES
+{
+
+Nautilus::Record CorrAggregationPhysicalFunction::lower(const nautilus::val<AggregationState*> aggregationState, PipelineMemoryProvider&)
+{
+    /// The count cancels out, as the covariance and both variances divide by it
+    const auto state = readState(aggregationState);
+    const auto correlation = nautilus::invoke(
+        +[](const double coMoment, const double m2X, const double m2Y) -> double
+        {
+            /// A constant field has no variance, thus its correlation is undefined. As results cannot be null, we return 0 instead of NaN.
+            if (m2X <= 0 or m2Y <= 0)
+            {
+                return 0;
+            }
+            return coMoment / std::sqrt(m2X * m2Y);
+        },
+        state.coMoment,
+        state.m2X,
+        state.m2Y);
+    return Nautilus::Record({{resultFieldIdentifier, Nautilus::VarVal(correlation).castToType(resultType.type)}});
+}
+
+AggregationPhysicalFunctionRegistryReturnType AggregationPhysicalFunctionGeneratedRegistrar::RegisterCorrAggregationPhysicalFunction(
+    AggregationPhysicalFunctionRegistryArguments arguments)
+{
+    INVARIANT(arguments.secondInputFunction.has_value(), "Second input function of the correlation aggregation not set");
+    return std::make_shared<CorrAggregationPhysicalFunction>(
+        std::move(arguments.inputType),
+        std::move(arguments.resultType),
+        arguments.inputFunction,
+        arguments.secondInputFunction.value(),
+        arguments.resultFieldIdentifier);
+}
+
+}
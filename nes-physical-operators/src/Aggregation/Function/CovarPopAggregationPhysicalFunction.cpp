@@ -0,0 +1,170 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Aggregation/Function/CovarPopAggregationPhysicalFunction.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <Aggregation/Function/AggregationPhysicalFunction.hpp>
+#include <DataTypes/DataType.hpp>
+#include <Functions/PhysicalFunction.hpp>
+#include <Nautilus/DataTypes/VarVal.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <nautilus/std/cstring.h>
+#include <AggregationPhysicalFunctionRegistry.hpp>
+#include <ErrorHandling.hpp>
+#include <ExecutionContext.hpp>
+#include <val.hpp>
+#include <val_concepts.hpp>
+#include <val_ptr.hpp>
+
+namespace NES
+{
+
+namespace
+{
+constexpr uint64_t NUMBER_OF_STATE_VALUES = 6;
+
+nautilus::val<int8_t*> getStateValue(const nautilus::val<AggregationState*>& aggregationState, const uint64_t position)
+{
+    return static_cast<nautilus::val<int8_t*>>(aggregationState) + nautilus::val<uint64_t>(position * sizeof(double));
+}
+
+nautilus::val<double> readStateValue(const nautilus::val<AggregationState*>& aggregationState, const uint64_t position)
+{
+    return Nautilus::VarVal::readVarValFromMemory(getStateValue(aggregationState, position), DataType::Type::FLOAT64)
+        .cast<nautilus::val<double>>();
+}
+}
+
+CovarPopAggregationPhysicalFunction::CovarPopAggregationPhysicalFunction(
+    DataType inputType,
+    DataType resultType,
+    PhysicalFunction inputFunction,
+    PhysicalFunction secondInputFunction,
+    Nautilus::Record::RecordFieldIdentifier resultFieldIdentifier)
+    : AggregationPhysicalFunction(std::move(inputType), std::move(resultType), std::move(inputFunction), std::move(resultFieldIdentifier))
+    , secondInputFunction(std::move(secondInputFunction))
+{
+}
+
+CovarPopAggregationPhysicalFunction::CoMomentState
+CovarPopAggregationPhysicalFunction::readState(const nautilus::val<AggregationState*>& aggregationState)
+{
+    return {
+        .count = readStateValue(aggregationState, 0),
+        .meanX = readStateValue(aggregationState, 1),
+        .meanY = readStateValue(aggregationState, 2),
+        .m2X = readStateValue(aggregationState, 3),
+        .m2Y = readStateValue(aggregationState, 4),
+        .coMoment = readStateValue(aggregationState, 5)};
+}
+
+void CovarPopAggregationPhysicalFunction::writeState(const nautilus::val<AggregationState*>& aggregationState, const CoMomentState& state)
+{
+    Nautilus::VarVal(state.count).writeToMemory(getStateValue(aggregationState, 0));
+    Nautilus::VarVal(state.meanX).writeToMemory(getStateValue(aggregationState, 1));
+    Nautilus::VarVal(state.meanY).writeToMemory(getStateValue(aggregationState, 2));
+    Nautilus::VarVal(state.m2X).writeToMemory(getStateValue(aggregationState, 3));
+    Nautilus::VarVal(state.m2Y).writeToMemory(getStateValue(aggregationState, 4));
+    Nautilus::VarVal(state.coMoment).writeToMemory(getStateValue(aggregationState, 5));
+}
+
+void CovarPopAggregationPhysicalFunction::lift(
+    const nautilus::val<AggregationState*>& aggregationState,
+    PipelineMemoryProvider& pipelineMemoryProvider,
+    const Nautilus::Record& record)
+{
+    const auto valueX
+        = inputFunction.execute(record, pipelineMemoryProvider.arena).castToType(DataType::Type::FLOAT64).cast<nautilus::val<double>>();
+    const auto valueY = secondInputFunction.execute(record, pipelineMemoryProvider.arena)
+                            .castToType(DataType::Type::FLOAT64)
+                            .cast<nautilus::val<double>>();
+
+    /// Moving both means towards the values and adding the products of the distances to the old and the new means
+    auto state = readState(aggregationState);
+    state.count = state.count + nautilus::val<double>(1);
+    const auto deltaX = valueX - state.meanX;
+    const auto deltaY = valueY - state.meanY;
+    state.meanX = state.meanX + (deltaX / state.count);
+    state.meanY = state.meanY + (deltaY / state.count);
+    state.m2X = state.m2X + (deltaX * (valueX - state.meanX));
+    state.m2Y = state.m2Y + (deltaY * (valueY - state.meanY));
+    state.coMoment = state.coMoment + (deltaX * (valueY - state.meanY));
+    writeState(aggregationState, state);
+}
+
+void CovarPopAggregationPhysicalFunction::combine(
+    const nautilus::val<AggregationState*> aggregationState1,
+    const nautilus::val<AggregationState*> aggregationState2,
+    PipelineMemoryProvider&)
+{
+    /// Combining both states via the pairwise formula of Chan et al., c.f., VarPopAggregationPhysicalFunction
+    auto state1 = readState(aggregationState1);
+    const auto state2 = readState(aggregationState2);
+    if (state2.count > nautilus::val<double>(0))
+    {
+        const auto count = state1.count + state2.count;
+        const auto deltaX = state2.meanX - state1.meanX;
+        const auto deltaY = state2.meanY - state1.meanY;
+        const auto weight = state1.count * state2.count / count;
+        state1.meanX = state1.meanX + (deltaX * state2.count / count);
+        state1.meanY = state1.meanY + (deltaY * state2.count / count);
+        state1.m2X = state1.m2X + state2.m2X + (deltaX * deltaX * weight);
+        state1.m2Y = state1.m2Y + state2.m2Y + (deltaY * deltaY * weight);
+        state1.coMoment = state1.coMoment + state2.coMoment + (deltaX * deltaY * weight);
+        state1.count = count;
+        writeState(aggregationState1, state1);
+    }
+}
+
+Nautilus::Record
+CovarPopAggregationPhysicalFunction::lower(const nautilus::val<AggregationState*> aggregationState, PipelineMemoryProvider&)
+{
+    const auto state = readState(aggregationState);
+    const auto covariance = state.coMoment / state.count;
+    return Nautilus::Record({{resultFieldIdentifier, Nautilus::VarVal(covariance).castToType(resultType.type)}});
+}
+
+void CovarPopAggregationPhysicalFunction::reset(const nautilus::val<AggregationState*> aggregationState, PipelineMemoryProvider&)
+{
+    /// Resetting the count, the means, and all sums to 0
+    const auto memArea = static_cast<nautilus::val<int8_t*>>(aggregationState);
+    nautilus::memset(memArea, 0, getSizeOfStateInBytes());
+}
+
+void CovarPopAggregationPhysicalFunction::cleanup(nautilus::val<AggregationState*>)
+{
+}
+
+size_t CovarPopAggregationPhysicalFunction::getSizeOfStateInBytes() const
+{
+    return NUMBER_OF_STATE_VALUES * sizeof(double);
+}
+
+AggregationPhysicalFunctionRegistryReturnType AggregationPhysicalFunctionGeneratedRegistrar::RegisterCovarPopAggregationPhysicalFunction(
+    AggregationPhysicalFunctionRegistryArguments arguments)
+{
+    INVARIANT(arguments.secondInputFunction.has_value(), "Second input function of the covariance aggregation not set");
+    return std::make_shared<CovarPopAggregationPhysicalFunction>(
+        std::move(arguments.inputType),
+        std::move(arguments.resultType),
+        arguments.inputFunction,
+        arguments.secondInputFunction.value(),
+        arguments.resultFieldIdentifier);
+}
+
+}
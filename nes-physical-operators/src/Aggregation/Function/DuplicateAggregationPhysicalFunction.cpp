@@ -0,0 +1,54 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Aggregation/Function/DuplicateAggregationPhysicalFunction.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <Aggregation/Function/AggregationPhysicalFunction.hpp>
+#include <Aggregation/Function/SharedStateAggregationPhysicalFunction.hpp>
+#include <DataTypes/DataType.hpp>
+#include <Functions/PhysicalFunction.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <ExecutionContext.hpp>
+#include <val_concepts.hpp>
+
+namespace NES
+{
+
+DuplicateAggregationPhysicalFunction::DuplicateAggregationPhysicalFunction(
+    DataType inputType,
+    DataType resultType,
+    PhysicalFunction inputFunction,
+    Nautilus::Record::RecordFieldIdentifier resultFieldIdentifier,
+    std::shared_ptr<AggregationPhysicalFunction> original,
+    Nautilus::Record::RecordFieldIdentifier originalResultFieldIdentifier,
+    const size_t originalStateOffset)
+    : SharedStateAggregationPhysicalFunction(
+          std::move(inputType), std::move(resultType), std::move(inputFunction), std::move(resultFieldIdentifier))
+    , original(std::move(original))
+    , originalResultFieldIdentifier(std::move(originalResultFieldIdentifier))
+    , originalStateOffset(originalStateOffset)
+{
+}
+
+Nautilus::Record DuplicateAggregationPhysicalFunction::lower(
+    const nautilus::val<AggregationState*> aggregationState, PipelineMemoryProvider& pipelineMemoryProvider)
+{
+    const auto originalRecord = original->lower(getSharedState(aggregationState, originalStateOffset), pipelineMemoryProvider);
+    return Nautilus::Record({{resultFieldIdentifier, originalRecord.read(originalResultFieldIdentifier)}});
+}
+
+}
@@ -14,13 +14,16 @@
 
 #include <Aggregation/Function/MedianAggregationPhysicalFunction.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <span>
 #include <utility>
 #include <Aggregation/Function/AggregationPhysicalFunction.hpp>
 #include <DataTypes/DataType.hpp>
 #include <Functions/PhysicalFunction.hpp>
+#include <Nautilus/DataTypes/VarVal.hpp>
 #include <Nautilus/Interface/BufferRef/TupleBufferRef.hpp>
 #include <Nautilus/Interface/PagedVector/PagedVector.hpp>
 #include <Nautilus/Interface/PagedVector/PagedVectorRef.hpp>
@@ -49,7 +52,7 @@ MedianAggregationPhysicalFunction::MedianAggregationPhysicalFunction(
 void MedianAggregationPhysicalFunction::lift(
     const nautilus::val<AggregationState*>& aggregationState, PipelineMemoryProvider& pipelineMemoryProvider, const Record& record)
 {
-    /// Adding the record to the paged vector. We are storing the full record in the paged vector for now.
+    /// Adding the record to the paged vector, which solely stores the fields of its memory layout, i.e., the field of the median
     const auto memArea = static_cast<nautilus::val<int8_t*>>(aggregationState);
     const Interface::PagedVectorRef pagedVectorRef(memArea, bufferRefPagedVector);
     pagedVectorRef.writeRecord(record, pipelineMemoryProvider.bufferProvider);
@@ -64,7 +67,8 @@ void MedianAggregationPhysicalFunction::combine(
     const auto memArea1 = static_cast<nautilus::val<Interface::PagedVector*>>(aggregationState1);
     const auto memArea2 = static_cast<nautilus::val<Interface::PagedVector*>>(aggregationState2);
 
-    /// Calling the copyFrom function of the paged vector to combine the two paged vectors by copying the content of the second paged vector to the first paged vector
+    /// Combining the two paged vectors by sharing the pages of the second paged vector with the first one, which copies no entries.
+    /// The second state belongs to a slice, which the probes of other windows might still combine, thus we must not move its pages.
     nautilus::invoke(
         +[](Interface::PagedVector* vector1, const Interface::PagedVector* vector2) -> void { vector1->copyFrom(*vector2); },
         memArea1,
@@ -87,71 +91,34 @@ Nautilus::Record MedianAggregationPhysicalFunction::lower(
         },
         pagedVectorPtr);
 
-    /// Iterating in two nested loops over all the records in the paged vector to get the median.
-    /// We pick a candidate and then count for each item, if the candidate is smaller and also if the candidate is less than the item.
-    const nautilus::val<int64_t> medianPos1 = (numberOfEntries - 1) / 2;
-    const nautilus::val<int64_t> medianPos2 = numberOfEntries / 2;
-    nautilus::val<uint64_t> medianItemPos1 = 0;
-    nautilus::val<uint64_t> medianItemPos2 = 0;
-    nautilus::val<bool> medianFound1(false);
-    nautilus::val<bool> medianFound2(false);
-
-
-    /// Picking a candidate and counting how many items are smaller or equal to the candidate
+    /// Copying the values of all records into a contiguous scratch array of the pipeline invocation, in which we select the median.
+    /// Casting the values to the result type before selecting them does not change their order.
+    const auto values = pipelineMemoryProvider.arena.allocateMemory(numberOfEntries * nautilus::val<uint64_t>(sizeof(double)));
+    auto currentValue = values;
     const auto endIt = pagedVectorRef.end(allFieldNames);
-    for (auto candidateIt = pagedVectorRef.begin(allFieldNames); candidateIt != endIt; ++candidateIt)
+    for (auto itemIt = pagedVectorRef.begin(allFieldNames); itemIt != endIt; ++itemIt)
     {
-        nautilus::val<int64_t> countLessThan = 0;
-        nautilus::val<int64_t> countEqual = 0;
-        const auto candidateRecord = *candidateIt;
-        const auto candidateValue = inputFunction.execute(candidateRecord, pipelineMemoryProvider.arena);
-
-        /// Counting how many items are smaller or equal for the current candidate
-        for (auto itemIt = pagedVectorRef.begin(allFieldNames); itemIt != endIt; ++itemIt)
-        {
-            const auto itemRecord = *itemIt;
-            const auto itemValue = inputFunction.execute(itemRecord, pipelineMemoryProvider.arena);
-            if (itemValue < candidateValue)
-            {
-                countLessThan = countLessThan + 1;
-            }
-            if (itemValue == candidateValue)
-            {
-                countEqual = countEqual + 1;
-            }
-        }
-
-        /// Checking if the current candidate is the median, and if so, storing the position of the median
-        /// The current candidate is the median if the number of items that are smaller or equal to the candidate is larger than the median position
-        if (not medianFound1 && countLessThan <= medianPos1 && medianPos1 < countLessThan + countEqual)
-        {
-            medianItemPos1 = candidateIt - pagedVectorRef.begin(allFieldNames);
-            medianFound1 = true;
-        }
-        if (not medianFound2 && countLessThan <= medianPos2 && medianPos2 < countLessThan + countEqual)
-        {
-            medianItemPos2 = candidateIt - pagedVectorRef.begin(allFieldNames);
-            medianFound2 = true;
-        }
+        const auto itemRecord = *itemIt;
+        inputFunction.execute(itemRecord, pipelineMemoryProvider.arena).castToType(DataType::Type::FLOAT64).writeToMemory(currentValue);
+        currentValue += sizeof(double);
     }
 
-    /// Setting the default median value. If a median was found, the value will be overwritten
-    const VarVal zero(nautilus::val<uint64_t>(0));
-    VarVal medianValue = zero.castToType(resultType.type);
-    if (medianFound1 and medianFound2)
-    {
-        /// Calculating the median value. Regardless if the number of entries is odd or even, we calculate the median as the average of the two middle values.
-        /// For even numbers of entries, this is its natural definition.
-        /// For odd numbers of entries, both positions are pointing to the same item and thus, we are calculating the average of the same item, which is the item itself.
-        const auto medianRecord1 = pagedVectorRef.readRecord(medianItemPos1, allFieldNames);
-        const auto medianRecord2 = pagedVectorRef.readRecord(medianItemPos2, allFieldNames);
-
-        const auto medianValue1 = inputFunction.execute(medianRecord1, pipelineMemoryProvider.arena);
-        const auto medianValue2 = inputFunction.execute(medianRecord2, pipelineMemoryProvider.arena);
-        const VarVal two = nautilus::val<uint64_t>(2);
-        medianValue
-            = (medianValue1.castToType(resultType.type) + medianValue2.castToType(resultType.type)) / two.castToType(resultType.type);
-    }
+    /// Selecting the two middle values in linear time via introselect instead of counting for each value the smaller and equal values
+    const auto median = invoke(
+        +[](double* valuesPtr, const uint64_t numberOfValues)
+        {
+            /// Regardless if the number of values is odd or even, we calculate the median as the average of the two middle values.
+            /// For odd numbers of values, both positions are pointing to the same value, whose average is the value itself.
+            const std::span valueSpan(valuesPtr, numberOfValues);
+            const auto upperMedian = valueSpan.begin() + static_cast<std::ptrdiff_t>(numberOfValues / 2);
+            std::ranges::nth_element(valueSpan, upperMedian);
+            /// After the selection, no value before the upper median is larger than it. Thus, the lower median is the largest of them.
+            const auto lowerMedian = numberOfValues % 2 == 0 ? *std::ranges::max_element(valueSpan.begin(), upperMedian) : *upperMedian;
+            return (lowerMedian + *upperMedian) / 2;
+        },
+        static_cast<nautilus::val<double*>>(values),
+        numberOfEntries);
+    const auto medianValue = VarVal(median).castToType(resultType.type);
 
     /// Adding the median to the result record
     Record resultRecord;
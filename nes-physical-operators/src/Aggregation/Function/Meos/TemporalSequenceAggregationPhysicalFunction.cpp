@@ -16,22 +16,17 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <memory>
-#include <stdexcept>
-#include <utility>
-#include <string_view>
 #include <cstdlib>
-#include <ctime>
-#include <mutex>
 #include <cstring>
-#include <cstdio>
-#include <string>
+#include <new>
+#include <optional>
+#include <stdexcept>
+#include <utility>
 
-#include <MemoryLayout/ColumnLayout.hpp>
-#include <Nautilus/Interface/BufferRef/TupleBufferRef.hpp>
-#include <Nautilus/Interface/PagedVector/PagedVector.hpp>
-#include <Nautilus/Interface/PagedVector/PagedVectorRef.hpp>
+#include <Aggregation/Function/TrajectorySimplifier.hpp>
 #include <Nautilus/Interface/Record.hpp>
+#include <Util/FunctionStatistics.hpp>
+#include <Util/Logger/Logger.hpp>
 #include <nautilus/function.hpp>
 
 #include <AggregationPhysicalFunctionRegistry.hpp>
@@ -42,20 +37,34 @@
 
 // MEOS wrapper header
 #include <MEOSWrapper.hpp>
-extern "C" {
-#include <meos.h>
-}
 
 namespace NES
 {
 
-constexpr static std::string_view LonFieldName = "lon";
-constexpr static std::string_view LatFieldName = "lat";
-constexpr static std::string_view TimestampFieldName = "timestamp";
-
-// Mutex for thread-safe MEOS operations
-static std::mutex meos_mutex;
-
+namespace
+{
+// The aggregation state owns the trajectory. nullptr denotes an empty trajectory, i.e., no record has been lifted yet.
+struct TemporalSequenceAggregationState
+{
+    Temporal* trajectory;
+    // MEOS WKB of the trajectory while lower() copies it into the result, nullptr otherwise
+    uint8_t* wkb;
+    // Drops the points within the tolerance, if the aggregation has one, otherwise it is unused
+    TrajectorySimplifier simplifier;
+    // Converts the timestamps in the unit detected once for all states of the aggregation, owned by the aggregation function
+    MEOS::Meos::EpochConverter* epochConverter;
+};
+
+// The last point that the simplifier dropped ends the trajectory, thus we append it before emitting or merging the trajectory
+void appendLastDroppedPoint(TemporalSequenceAggregationState* sequenceState)
+{
+    if (const auto point = sequenceState->simplifier.flush())
+    {
+        sequenceState->trajectory = MEOS::Meos::appendToTrajectory(
+            sequenceState->trajectory, point->lon, point->lat, point->timestamp, *sequenceState->epochConverter);
+    }
+}
+}
 
 TemporalSequenceAggregationPhysicalFunction::TemporalSequenceAggregationPhysicalFunction(
     DataType inputType,
@@ -64,284 +73,129 @@ TemporalSequenceAggregationPhysicalFunction::TemporalSequenceAggregationPhysical
     PhysicalFunction latFunctionParam,
     PhysicalFunction timestampFunctionParam,
     Nautilus::Record::RecordFieldIdentifier resultFieldIdentifier,
-    std::shared_ptr<Nautilus::Interface::BufferRef::TupleBufferRef> bufferRef)
+    std::optional<double> toleranceInMeters)
     : AggregationPhysicalFunction(std::move(inputType), std::move(resultType), lonFunctionParam, std::move(resultFieldIdentifier))
-    , bufferRef(std::move(bufferRef))
     , lonFunction(std::move(lonFunctionParam))
     , latFunction(std::move(latFunctionParam))
     , timestampFunction(std::move(timestampFunctionParam))
+    , toleranceInMeters(toleranceInMeters)
 {
+    PRECONDITION(
+        not toleranceInMeters.has_value() or *toleranceInMeters >= 0,
+        "The tolerance of TEMPORAL_SEQUENCE must not be negative, but is {}",
+        toleranceInMeters.value_or(0));
 }
 
 void TemporalSequenceAggregationPhysicalFunction::lift(
     const nautilus::val<AggregationState*>& aggregationState, PipelineMemoryProvider& pipelineMemoryProvider, const Nautilus::Record& record)
 {
-    const auto pagedVectorPtr = static_cast<nautilus::val<Nautilus::Interface::PagedVector*>>(aggregationState);
-
-    // For TEMPORAL_SEQUENCE, we need to store lon, lat, and timestamp values
-    auto lonValue = lonFunction.execute(record, pipelineMemoryProvider.arena);
-    auto latValue = latFunction.execute(record, pipelineMemoryProvider.arena);
-    auto timestampValue = timestampFunction.execute(record, pipelineMemoryProvider.arena);
-
-    // Create a record with all three fields for temporal sequence
-    Record aggregateStateRecord({
-        {std::string(LonFieldName), lonValue},
-        {std::string(LatFieldName), latValue},
-        {std::string(TimestampFieldName), timestampValue}
-    });
-
-    const Nautilus::Interface::PagedVectorRef pagedVectorRef(pagedVectorPtr, bufferRef);
-    pagedVectorRef.writeRecord(aggregateStateRecord, pipelineMemoryProvider.bufferProvider);
-}
-
-void TemporalSequenceAggregationPhysicalFunction::combine(
-    const nautilus::val<AggregationState*> aggregationState1,
-    const nautilus::val<AggregationState*> aggregationState2,
-    PipelineMemoryProvider&)
-{
-    // Getting the paged vectors from the aggregation states
-    const auto memArea1 = static_cast<nautilus::val<Nautilus::Interface::PagedVector*>>(aggregationState1);
-    const auto memArea2 = static_cast<nautilus::val<Nautilus::Interface::PagedVector*>>(aggregationState2);
-
-    // Calling the copyFrom function of the paged vector to combine the two paged vectors by copying the content of the second paged vector to the first paged vector
-    nautilus::invoke(
-        +[](Nautilus::Interface::PagedVector* vector1, const Nautilus::Interface::PagedVector* vector2) -> void
-        { vector1->copyFrom(*vector2); },
-        memArea1,
-        memArea2);
-}
-
-Nautilus::Record TemporalSequenceAggregationPhysicalFunction::lower(
-    const nautilus::val<AggregationState*> aggregationState, PipelineMemoryProvider& pipelineMemoryProvider)
-{
-    // Ensure MEOS is initialized
-    MEOS::Meos::ensureMeosInitialized();
-
-    // Getting the paged vector from the aggregation state
-    const auto pagedVectorPtr = static_cast<nautilus::val<Nautilus::Interface::PagedVector*>>(aggregationState);
-    const Nautilus::Interface::PagedVectorRef pagedVectorRef(pagedVectorPtr, bufferRef);
-    const auto allFieldNames = bufferRef->getMemoryLayout()->getSchema().getFieldNames();
-    const auto numberOfEntries = invoke(
-        +[](const Nautilus::Interface::PagedVector* pagedVector)
-        {
-            return pagedVector->getTotalNumberOfEntries();
-        },
-        pagedVectorPtr);
-
-    // Handle empty PagedVector case
-    if (numberOfEntries == nautilus::val<size_t>(0)) {
-        // Create BINARY(0) string for empty trajectory
-        const char* emptyBinaryStr = "BINARY(0)";
-        auto strLen = nautilus::val<size_t>(strlen(emptyBinaryStr));
-        auto variableSized = pipelineMemoryProvider.arena.allocateVariableSizedData(strLen);
-
-        nautilus::invoke(
-            +[](int8_t* dest, size_t len) -> void
-            {
-                const char* str = "BINARY(0)";
-                memcpy(dest, str, len);
-            },
-            variableSized.getContent(),
-            strLen);
-
-        Nautilus::Record resultRecord;
-        resultRecord.write(resultFieldIdentifier, variableSized);
-        return resultRecord;
-    }
-
-    // Build the trajectory string in MEOS format for temporal instant set
-    // For single point: Point(-73.9857 40.7484)@2000-01-01 08:00:00
-    // For multiple points: {Point(-73.9857 40.7484)@2000-01-01 08:00:00, Point(-73.9787 40.7505)@2000-01-01 08:05:00}
-    auto trajectoryStr = nautilus::invoke(
-        +[](const Nautilus::Interface::PagedVector* pagedVector) -> char*
-        {
-            // Allocate a buffer for the trajectory string
-            // Each point is approximately 100 chars: Point(-123.456789 12.345678)@2000-01-01 08:00:00
-            // Add extra space to prevent buffer issues
-            size_t bufferSize = pagedVector->getTotalNumberOfEntries() * 150 + 50;
-            char* buffer = (char*)malloc(bufferSize);
-
-            // Initialize buffer to zeros to ensure proper null termination
-            memset(buffer, 0, bufferSize);
-
-            // Start with opening brace for temporal instant set
-            strcpy(buffer, "{");
-            return buffer;
-        },
-        pagedVectorPtr);
-
-    // Track if this is the first point using a counter
-    auto pointCounter = nautilus::val<int64_t>(0);
+    const auto lon = lonFunction.execute(record, pipelineMemoryProvider.arena).cast<nautilus::val<double>>();
+    const auto lat = latFunction.execute(record, pipelineMemoryProvider.arena).cast<nautilus::val<double>>();
+    const auto timestamp = timestampFunction.execute(record, pipelineMemoryProvider.arena).cast<nautilus::val<uint64_t>>();
 
-    // Read from paged vector in original order
-    const auto endIt = pagedVectorRef.end(allFieldNames);
-    for (auto candidateIt = pagedVectorRef.begin(allFieldNames); candidateIt != endIt; ++candidateIt)
+    if (toleranceInMeters.has_value())
     {
-        const auto itemRecord = *candidateIt;
-
-        // Read all three fields for temporal sequence
-        const auto lonValue = itemRecord.read(std::string(LonFieldName));
-        const auto latValue = itemRecord.read(std::string(LatFieldName));
-        const auto timestampValue = itemRecord.read(std::string(TimestampFieldName));
-
-        auto lon = lonValue.cast<nautilus::val<double>>();
-        auto lat = latValue.cast<nautilus::val<double>>();
-        auto timestamp = timestampValue.cast<nautilus::val<int64_t>>();
-
-        // Append point to trajectory string in MEOS format
-        trajectoryStr = nautilus::invoke(
-            +[](char* buffer, double lonVal, double latVal, int64_t tsVal, int64_t counter) -> char*
+        // Append solely the points that the simplifier keeps to the trajectory in the aggregation state
+        nautilus::invoke(
+            +[](AggregationState* state, double lonValue, double latValue, uint64_t timestampValue) -> void
             {
-                if (counter > 0) {
-                    strcat(buffer, ", ");
-                }
-
-                // Convert timestamp to MEOS format
-                // Determine if timestamp is in seconds or milliseconds
-                long long adjustedTime;
-                if (tsVal > 1000000000000LL) {
-                    // Milliseconds (13+ digits)
-                    adjustedTime = tsVal / 1000;
-                } else {
-                    // Seconds (10 digits or less) - Unix timestamp
-                    adjustedTime = tsVal;
+                auto* sequenceState = reinterpret_cast<TemporalSequenceAggregationState*>(state); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+                TrajectorySimplifier::KeptPoints keptPoints{};
+                const auto numberOfKeptPoints
+                    = sequenceState->simplifier.insert({.lon = lonValue, .lat = latValue, .timestamp = timestampValue}, keptPoints);
+                for (size_t index = 0; index < numberOfKeptPoints; ++index)
+                {
+                    const auto& point = keptPoints[index];
+                    sequenceState->trajectory = MEOS::Meos::appendToTrajectory(
+                        sequenceState->trajectory, point.lon, point.lat, point.timestamp, *sequenceState->epochConverter);
                 }
-
-                // Use MEOS wrapper to convert timestamp
-                std::string timestampString = MEOS::Meos::convertSecondsToTimestamp(adjustedTime);
-                const char* timestampStr = timestampString.c_str();
-
-                char pointStr[120];
-                // Use Point format that MEOS expects: Point(lon lat)@timestamp
-                sprintf(pointStr, "Point(%.6f %.6f)@%s", lonVal, latVal, timestampStr);
-                strcat(buffer, pointStr);
-                return buffer;
             },
-            trajectoryStr,
+            aggregationState,
             lon,
             lat,
-            timestamp,
-            pointCounter);
-
-        pointCounter = pointCounter + nautilus::val<int64_t>(1);
+            timestamp);
+        return;
     }
 
-    // Close the trajectory string - always use braces for temporal instant sets
-    trajectoryStr = nautilus::invoke(
-        +[](char* buffer, int64_t totalPoints) -> char*
+    // Append the point to the trajectory in the aggregation state
+    nautilus::invoke(
+        +[](AggregationState* state, double lonValue, double latValue, uint64_t timestampValue) -> void
         {
-            // Always close with brace - temporal instant sets require {} even for single points
-            strcat(buffer, "}");
-            if (totalPoints == 1) {
-                printf("DEBUG: Single point trajectory string: %s\n", buffer);
-            } else {
-                printf("DEBUG: Multiple points trajectory string: %s\n", buffer);
-            }
-            return buffer;
+            auto* sequenceState = reinterpret_cast<TemporalSequenceAggregationState*>(state); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            sequenceState->trajectory = MEOS::Meos::appendToTrajectory(
+                sequenceState->trajectory, lonValue, latValue, timestampValue, *sequenceState->epochConverter);
         },
-        trajectoryStr,
-        pointCounter);
+        aggregationState,
+        lon,
+        lat,
+        timestamp);
+}
 
+void TemporalSequenceAggregationPhysicalFunction::combine(
+    const nautilus::val<AggregationState*> aggregationState1,
+    const nautilus::val<AggregationState*> aggregationState2,
+    PipelineMemoryProvider&)
+{
+    // Merging the trajectory of the second state into the trajectory of the first state. The second state keeps its trajectory.
     nautilus::invoke(
-        +[](const char* buffer) -> void
+        +[](AggregationState* state1, AggregationState* state2) -> void
         {
-            printf("DEBUG: trajectory string before MEOS: %s\n", buffer);
+            auto* sequenceState1 = reinterpret_cast<TemporalSequenceAggregationState*>(state1); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            auto* sequenceState2 = reinterpret_cast<TemporalSequenceAggregationState*>(state2); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            appendLastDroppedPoint(sequenceState1);
+            appendLastDroppedPoint(sequenceState2);
+            sequenceState1->trajectory = MEOS::Meos::mergeTrajectories(sequenceState1->trajectory, sequenceState2->trajectory);
         },
-        trajectoryStr);
+        aggregationState1,
+        aggregationState2);
+}
 
-    // Convert string to MEOS binary format and get size
-    auto binarySize = nautilus::invoke(
-        +[](const char* trajStr) -> size_t
+Nautilus::Record TemporalSequenceAggregationPhysicalFunction::lower(
+    const nautilus::val<AggregationState*> aggregationState, PipelineMemoryProvider& pipelineMemoryProvider)
+{
+    // Serialize the trajectory to MEOS WKB. We need its size to allocate the result in the arena, thus the state keeps the
+    // serialized trajectory until we copied it. An empty trajectory has a size of 0.
+    const auto wkbSize = nautilus::invoke(
+        +[](AggregationState* state) -> size_t
         {
-            // Validate string is not empty
-            if (!trajStr || strlen(trajStr) == 0) {
-                return 0;
-            }
-
-            // Parse the temporal instant string into a MEOS temporal object
-            // Lock mutex for thread-safe MEOS operations
-            std::lock_guard<std::mutex> lock(meos_mutex);
-
-            // Parse using the wrapper function
-            std::string trajString(trajStr);
-            void* temp = MEOS::Meos::parseTemporalPoint(trajString);
-            if (!temp) {
+            static auto& counters = FunctionStatistics::getCounters("TemporalSequence");
+            const bool sampled = counters.recordCall();
+            auto* sequenceState = reinterpret_cast<TemporalSequenceAggregationState*>(state); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            appendLastDroppedPoint(sequenceState);
+            if (sequenceState->trajectory == nullptr) {
                 return 0;
             }
 
-            // Get the size needed for binary WKB format
             size_t size = 0;
-            uint8_t* data = MEOS::Meos::temporalToWKB(temp, size);
-
-            if (!data) {
-                MEOS::Meos::freeTemporalObject(temp);
+            sequenceState->wkb = MEOS::Meos::temporalToWKB(sequenceState->trajectory, size);
+            if (!sequenceState->wkb) {
+                counters.recordError();
                 return 0;
             }
 
-            free(data);
-            MEOS::Meos::freeTemporalObject(temp);
-
+            if (sampled) {
+                NES_DEBUG("TemporalSequence: MEOS WKB size {}", size);
+            }
             return size;
         },
-        trajectoryStr);
-
-    if (binarySize == nautilus::val<size_t>(0)) {
-        // Return empty record or handle error appropriately
-        auto emptyVariableSized = pipelineMemoryProvider.arena.allocateVariableSizedData(0);
-        Nautilus::Record resultRecord;
-        resultRecord.write(resultFieldIdentifier, emptyVariableSized);
-        return resultRecord;
-    }
-
-    // Create BINARY(N) string format for test compatibility
-    auto binaryFormatStr = nautilus::invoke(
-        +[](size_t size, const char* trajStr) -> char*
-        {
-            // Allocate buffer for "BINARY(N)" string
-            char* buffer = (char*)malloc(32);  // More than enough for "BINARY(" + number + ")"
-            sprintf(buffer, "BINARY(%zu)", size);
-
-            // Free the trajectory string as we don't need it anymore
-            free((void*)trajStr);
-            return buffer;
-        },
-        binarySize,
-        trajectoryStr);
-
-    // Get the length of the BINARY(N) string
-    auto formatStrLen = nautilus::invoke(
-        +[](const char* str) -> size_t
-        {
-            return strlen(str);
-        },
-        binaryFormatStr);
-
-    // Allocate variable sized data for the BINARY(N) string
-    auto variableSized = pipelineMemoryProvider.arena.allocateVariableSizedData(formatStrLen);
-
-    // Copy the BINARY(N) string to the allocated memory
-    nautilus::invoke(
-        +[](int8_t* dest, const char* formatStr, size_t len) -> void
-        {
-            memcpy(dest, formatStr, len);
-            free((void*)formatStr);
-        },
-        variableSized.getContent(),
-        binaryFormatStr,
-        formatStrLen);
+        aggregationState);
 
+    // Write the WKB directly into the arena-backed result
+    auto variableSized = pipelineMemoryProvider.arena.allocateVariableSizedData(wkbSize);
     nautilus::invoke(
-        +[](const int8_t* data, size_t len, size_t size) -> void
+        +[](AggregationState* state, int8_t* dest, size_t size) -> void
         {
-            printf(
-                "DEBUG: MEOS WKB size=%zu label=%.*s\n",
-                size,
-                static_cast<int>(len),
-                reinterpret_cast<const char*>(data));
+            auto* sequenceState = reinterpret_cast<TemporalSequenceAggregationState*>(state); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            if (sequenceState->wkb == nullptr) {
+                return;
+            }
+            std::memcpy(dest, sequenceState->wkb, size);
+            free(sequenceState->wkb);
+            sequenceState->wkb = nullptr;
         },
+        aggregationState,
         variableSized.getContent(),
-        nautilus::val<size_t>(formatStrLen),
-        binarySize);
+        wkbSize);
 
     Nautilus::Record resultRecord;
     resultRecord.write(resultFieldIdentifier, variableSized);
@@ -352,28 +206,34 @@ Nautilus::Record TemporalSequenceAggregationPhysicalFunction::lower(
 void TemporalSequenceAggregationPhysicalFunction::reset(const nautilus::val<AggregationState*> aggregationState, PipelineMemoryProvider&)
 {
     nautilus::invoke(
-        +[](AggregationState* pagedVectorMemArea) -> void
+        +[](AggregationState* state, double tolerance, MEOS::Meos::EpochConverter* epochConverter) -> void
         {
-            // Allocates a new PagedVector in the memory area provided by the pointer to the pagedvector
-            auto* pagedVector = reinterpret_cast<Nautilus::Interface::PagedVector*>(pagedVectorMemArea);
-            new (pagedVector) Nautilus::Interface::PagedVector();
+            // The memory area of the state is uninitialized, thus we must not free a previous trajectory
+            auto* sequenceState = reinterpret_cast<TemporalSequenceAggregationState*>(state); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            sequenceState->trajectory = nullptr;
+            sequenceState->wkb = nullptr;
+            new (&sequenceState->simplifier) TrajectorySimplifier(tolerance);
+            sequenceState->epochConverter = epochConverter;
         },
-        aggregationState);
+        aggregationState,
+        nautilus::val<double>(toleranceInMeters.value_or(0)),
+        nautilus::val<MEOS::Meos::EpochConverter*>(epochConverter.get()));
 }
 
 size_t TemporalSequenceAggregationPhysicalFunction::getSizeOfStateInBytes() const
 {
-    return sizeof(Nautilus::Interface::PagedVector);
+    return sizeof(TemporalSequenceAggregationState);
 }
 void TemporalSequenceAggregationPhysicalFunction::cleanup(nautilus::val<AggregationState*> aggregationState)
 {
     nautilus::invoke(
-        +[](AggregationState* pagedVectorMemArea) -> void
+        +[](AggregationState* state) -> void
         {
-            // Calls the destructor of the PagedVector
-            auto* pagedVector = reinterpret_cast<Nautilus::Interface::PagedVector*>(
-                pagedVectorMemArea); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
-            pagedVector->~PagedVector();
+            auto* sequenceState = reinterpret_cast<TemporalSequenceAggregationState*>(state); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            MEOS::Meos::freeTrajectory(sequenceState->trajectory);
+            sequenceState->trajectory = nullptr;
+            free(sequenceState->wkb);
+            sequenceState->wkb = nullptr;
         },
         aggregationState);
 }
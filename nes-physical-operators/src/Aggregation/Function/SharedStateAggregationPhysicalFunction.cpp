@@ -0,0 +1,66 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Aggregation/Function/SharedStateAggregationPhysicalFunction.hpp>
+
+#include <cstddef>
+#include <utility>
+#include <Aggregation/Function/AggregationPhysicalFunction.hpp>
+#include <DataTypes/DataType.hpp>
+#include <Functions/PhysicalFunction.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <ExecutionContext.hpp>
+#include <val.hpp>
+#include <val_concepts.hpp>
+#include <val_ptr.hpp>
+
+namespace NES
+{
+
+SharedStateAggregationPhysicalFunction::SharedStateAggregationPhysicalFunction(
+    DataType inputType, DataType resultType, PhysicalFunction inputFunction, Nautilus::Record::RecordFieldIdentifier resultFieldIdentifier)
+    : AggregationPhysicalFunction(std::move(inputType), std::move(resultType), std::move(inputFunction), std::move(resultFieldIdentifier))
+{
+}
+
+void SharedStateAggregationPhysicalFunction::lift(
+    const nautilus::val<AggregationState*>&, PipelineMemoryProvider&, const Nautilus::Record&)
+{
+}
+
+void SharedStateAggregationPhysicalFunction::combine(
+    nautilus::val<AggregationState*>, nautilus::val<AggregationState*>, PipelineMemoryProvider&)
+{
+}
+
+void SharedStateAggregationPhysicalFunction::reset(nautilus::val<AggregationState*>, PipelineMemoryProvider&)
+{
+}
+
+void SharedStateAggregationPhysicalFunction::cleanup(nautilus::val<AggregationState*>)
+{
+}
+
+size_t SharedStateAggregationPhysicalFunction::getSizeOfStateInBytes() const
+{
+    return 0;
+}
+
+nautilus::val<AggregationState*>
+SharedStateAggregationPhysicalFunction::getSharedState(const nautilus::val<AggregationState*>& aggregationState, const size_t offset)
+{
+    return aggregationState + offset;
+}
+
+}
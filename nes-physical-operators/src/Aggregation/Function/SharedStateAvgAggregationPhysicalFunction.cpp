@@ -0,0 +1,60 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Aggregation/Function/SharedStateAvgAggregationPhysicalFunction.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <Aggregation/Function/SharedStateAggregationPhysicalFunction.hpp>
+#include <DataTypes/DataType.hpp>
+#include <Functions/PhysicalFunction.hpp>
+#include <Nautilus/DataTypes/VarVal.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <ExecutionContext.hpp>
+#include <val.hpp>
+#include <val_concepts.hpp>
+#include <val_ptr.hpp>
+
+namespace NES
+{
+
+SharedStateAvgAggregationPhysicalFunction::SharedStateAvgAggregationPhysicalFunction(
+    DataType inputType,
+    DataType resultType,
+    PhysicalFunction inputFunction,
+    Nautilus::Record::RecordFieldIdentifier resultFieldIdentifier,
+    const size_t sumStateOffset,
+    const size_t countStateOffset)
+    : SharedStateAggregationPhysicalFunction(
+          std::move(inputType), std::move(resultType), std::move(inputFunction), std::move(resultFieldIdentifier))
+    , sumStateOffset(sumStateOffset)
+    , countStateOffset(countStateOffset)
+{
+}
+
+Nautilus::Record
+SharedStateAvgAggregationPhysicalFunction::lower(const nautilus::val<AggregationState*> aggregationState, PipelineMemoryProvider&)
+{
+    /// The state of the sum solely consists of the sum and the state of the count solely of the count, c.f., their aggregation functions
+    const auto memAreaSum = static_cast<nautilus::val<int8_t*>>(getSharedState(aggregationState, sumStateOffset));
+    const auto memAreaCount = static_cast<nautilus::val<int8_t*>>(getSharedState(aggregationState, countStateOffset));
+    const auto sum = Nautilus::VarVal::readVarValFromMemory(memAreaSum, inputType.type);
+    const auto count = Nautilus::VarVal::readVarValFromMemory(memAreaCount, countType.type);
+
+    const auto avg = sum.castToType(resultType.type) / count.castToType(resultType.type);
+    return Nautilus::Record({{resultFieldIdentifier, avg}});
+}
+
+}
@@ -0,0 +1,106 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Aggregation/Function/TrajectorySimplifier.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numbers>
+#include <optional>
+#include <ErrorHandling.hpp>
+
+namespace NES
+{
+
+namespace
+{
+constexpr double EARTH_RADIUS_IN_METERS = 6371008.8;
+
+double toRadians(const double degrees)
+{
+    return degrees * std::numbers::pi / 180;
+}
+}
+
+TrajectorySimplifier::TrajectorySimplifier(const double toleranceInMeters) : toleranceInMeters(toleranceInMeters)
+{
+    PRECONDITION(toleranceInMeters >= 0, "The tolerance of the trajectory simplification must not be negative, but is {}", toleranceInMeters);
+}
+
+size_t TrajectorySimplifier::insert(const Point& point, KeptPoints& keptPoints)
+{
+    if (not hasAnchor)
+    {
+        hasAnchor = true;
+        anchor = point;
+        keptPoints[0] = point;
+        return 1;
+    }
+
+    const auto elapsed = static_cast<double>(point.timestamp) - static_cast<double>(anchor.timestamp);
+    const Point prediction{
+        .lon = anchor.lon + (lonVelocity * elapsed), .lat = anchor.lat + (latVelocity * elapsed), .timestamp = point.timestamp};
+    if (distanceInMeters(prediction, point) <= toleranceInMeters)
+    {
+        if (hasDroppedPoint)
+        {
+            ++numberOfDroppedPoints;
+        }
+        hasDroppedPoint = true;
+        lastDroppedPoint = point;
+        return 0;
+    }
+
+    size_t numberOfKeptPoints = 0;
+    if (hasDroppedPoint)
+    {
+        /// The segment ends at the last point that still followed the prediction
+        anchor = lastDroppedPoint;
+        keptPoints[numberOfKeptPoints++] = lastDroppedPoint;
+        hasDroppedPoint = false;
+    }
+    const auto segmentDuration = static_cast<double>(point.timestamp) - static_cast<double>(anchor.timestamp);
+    lonVelocity = segmentDuration > 0 ? (point.lon - anchor.lon) / segmentDuration : 0;
+    latVelocity = segmentDuration > 0 ? (point.lat - anchor.lat) / segmentDuration : 0;
+    anchor = point;
+    keptPoints[numberOfKeptPoints++] = point;
+    return numberOfKeptPoints;
+}
+
+std::optional<TrajectorySimplifier::Point> TrajectorySimplifier::flush()
+{
+    if (not hasDroppedPoint)
+    {
+        return std::nullopt;
+    }
+    hasDroppedPoint = false;
+    anchor = lastDroppedPoint;
+    return lastDroppedPoint;
+}
+
+uint64_t TrajectorySimplifier::getNumberOfDroppedPoints() const
+{
+    return numberOfDroppedPoints;
+}
+
+double TrajectorySimplifier::distanceInMeters(const Point& first, const Point& second)
+{
+    const auto meanLatitude = toRadians((first.lat + second.lat) / 2);
+    const auto x = toRadians(second.lon - first.lon) * std::cos(meanLatitude);
+    const auto y = toRadians(second.lat - first.lat);
+    return std::hypot(x, y) * EARTH_RADIUS_IN_METERS;
+}
+
+}
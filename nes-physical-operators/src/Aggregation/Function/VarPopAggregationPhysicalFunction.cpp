@@ -0,0 +1,133 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Aggregation/Function/VarPopAggregationPhysicalFunction.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <Aggregation/Function/AggregationPhysicalFunction.hpp>
+#include <DataTypes/DataType.hpp>
+#include <Functions/PhysicalFunction.hpp>
+#include <Nautilus/DataTypes/VarVal.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <nautilus/std/cstring.h>
+#include <AggregationPhysicalFunctionRegistry.hpp>
+#include <ExecutionContext.hpp>
+#include <val.hpp>
+#include <val_concepts.hpp>
+#include <val_ptr.hpp>
+
+namespace NES
+{
+
+VarPopAggregationPhysicalFunction::VarPopAggregationPhysicalFunction(
+    DataType inputType, DataType resultType, PhysicalFunction inputFunction, Nautilus::Record::RecordFieldIdentifier resultFieldIdentifier)
+    : AggregationPhysicalFunction(std::move(inputType), std::move(resultType), std::move(inputFunction), std::move(resultFieldIdentifier))
+{
+}
+
+VarPopAggregationPhysicalFunction::WelfordState
+VarPopAggregationPhysicalFunction::readState(const nautilus::val<AggregationState*>& aggregationState)
+{
+    const auto memArea = static_cast<nautilus::val<int8_t*>>(aggregationState);
+    return {
+        .count = Nautilus::VarVal::readVarValFromMemory(memArea, DataType::Type::FLOAT64).cast<nautilus::val<double>>(),
+        .mean = Nautilus::VarVal::readVarValFromMemory(memArea + nautilus::val<uint64_t>(sizeof(double)), DataType::Type::FLOAT64)
+                    .cast<nautilus::val<double>>(),
+        .m2 = Nautilus::VarVal::readVarValFromMemory(memArea + nautilus::val<uint64_t>(2 * sizeof(double)), DataType::Type::FLOAT64)
+                  .cast<nautilus::val<double>>()};
+}
+
+void VarPopAggregationPhysicalFunction::writeState(const nautilus::val<AggregationState*>& aggregationState, const WelfordState& state)
+{
+    const auto memArea = static_cast<nautilus::val<int8_t*>>(aggregationState);
+    Nautilus::VarVal(state.count).writeToMemory(memArea);
+    Nautilus::VarVal(state.mean).writeToMemory(memArea + nautilus::val<uint64_t>(sizeof(double)));
+    Nautilus::VarVal(state.m2).writeToMemory(memArea + nautilus::val<uint64_t>(2 * sizeof(double)));
+}
+
+nautilus::val<double> VarPopAggregationPhysicalFunction::getVariance(const nautilus::val<AggregationState*>& aggregationState)
+{
+    const auto state = readState(aggregationState);
+    return state.m2 / state.count;
+}
+
+void VarPopAggregationPhysicalFunction::lift(
+    const nautilus::val<AggregationState*>& aggregationState,
+    PipelineMemoryProvider& pipelineMemoryProvider,
+    const Nautilus::Record& record)
+{
+    const auto value
+        = inputFunction.execute(record, pipelineMemoryProvider.arena).castToType(DataType::Type::FLOAT64).cast<nautilus::val<double>>();
+
+    /// Moving the mean towards the value and adding the product of the distances to the old and the new mean
+    auto state = readState(aggregationState);
+    state.count = state.count + nautilus::val<double>(1);
+    const auto delta = value - state.mean;
+    state.mean = state.mean + (delta / state.count);
+    state.m2 = state.m2 + (delta * (value - state.mean));
+    writeState(aggregationState, state);
+}
+
+void VarPopAggregationPhysicalFunction::combine(
+    const nautilus::val<AggregationState*> aggregationState1,
+    const nautilus::val<AggregationState*> aggregationState2,
+    PipelineMemoryProvider&)
+{
+    /// Combining both states via the formula of Chan et al., which corrects the sum of the squared distances by the distance of the means.
+    /// We skip empty second states, as their count would otherwise divide by zero for two empty states.
+    auto state1 = readState(aggregationState1);
+    const auto state2 = readState(aggregationState2);
+    if (state2.count > nautilus::val<double>(0))
+    {
+        const auto count = state1.count + state2.count;
+        const auto delta = state2.mean - state1.mean;
+        state1.mean = state1.mean + (delta * state2.count / count);
+        state1.m2 = state1.m2 + state2.m2 + (delta * delta * state1.count * state2.count / count);
+        state1.count = count;
+        writeState(aggregationState1, state1);
+    }
+}
+
+Nautilus::Record VarPopAggregationPhysicalFunction::lower(const nautilus::val<AggregationState*> aggregationState, PipelineMemoryProvider&)
+{
+    return Nautilus::Record({{resultFieldIdentifier, Nautilus::VarVal(getVariance(aggregationState)).castToType(resultType.type)}});
+}
+
+void VarPopAggregationPhysicalFunction::reset(const nautilus::val<AggregationState*> aggregationState, PipelineMemoryProvider&)
+{
+    /// Resetting the count, the mean, and the sum of the squared distances to 0
+    const auto memArea = static_cast<nautilus::val<int8_t*>>(aggregationState);
+    nautilus::memset(memArea, 0, getSizeOfStateInBytes());
+}
+
+void VarPopAggregationPhysicalFunction::cleanup(nautilus::val<AggregationState*>)
+{
+}
+
+size_t VarPopAggregationPhysicalFunction::getSizeOfStateInBytes() const
+{
+    return 3 * sizeof(double);
+}
+
+AggregationPhysicalFunctionRegistryReturnType AggregationPhysicalFunctionGeneratedRegistrar::RegisterVarPopAggregationPhysicalFunction(
+    AggregationPhysicalFunctionRegistryArguments arguments)
+{
+    return std::make_shared<VarPopAggregationPhysicalFunction>(
+        std::move(arguments.inputType), std::move(arguments.resultType), arguments.inputFunction, arguments.resultFieldIdentifier);
+}
+
+}
@@ -14,15 +14,26 @@
 
 #include <EmitOperatorHandler.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <Identifiers/Identifiers.hpp>
 #include <Runtime/QueryTerminationType.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Time/Timestamp.hpp>
 #include <Util/Logger/Logger.hpp>
+#include <ErrorHandling.hpp>
 #include <PipelineExecutionContext.hpp>
 
 namespace NES
 {
 
+EmitOperatorHandler::EmitOperatorHandler(const std::chrono::milliseconds coalescingMaxDelay) : coalescingMaxDelay(coalescingMaxDelay)
+{
+}
+
 uint64_t EmitOperatorHandler::getNextChunkNumber(const SequenceNumberForOriginId seqNumberOriginId)
 {
     auto lockedMap = seqNumberOriginIdToOutputChunkNumber.wlock();
@@ -66,4 +77,140 @@ bool EmitOperatorHandler::processChunkNumber(
     return seenChunks == lastChunkNumber;
 }
 
+void EmitOperatorHandler::setupCoalescing(const size_t numberOfWorkerThreads)
+{
+    coalescedBuffers.clear();
+    for (size_t workerThread = 0; workerThread < numberOfWorkerThreads; ++workerThread)
+    {
+        coalescedBuffers.emplace_back(std::make_unique<CoalescedBuffer>());
+    }
+}
+
+TupleBuffer* EmitOperatorHandler::acquireCoalescedBuffer(PipelineExecutionContext& pipelineExecutionContext, const OriginId originId)
+{
+    INVARIANT(not coalescedBuffers.empty(), "The emit must set up the coalescing before it acquires a buffer");
+    numberOfCoalescedInvocations.fetch_add(1, std::memory_order_relaxed);
+    auto& coalescedBuffer = *coalescedBuffers[pipelineExecutionContext.getId() % coalescedBuffers.size()];
+    if (coalescedBuffer.isUsed.test_and_set(std::memory_order_acquire))
+    {
+        /// Another thread executes the pipeline with the same buffer, thus this invocation emits a buffer of its own
+        return new TupleBuffer(pipelineExecutionContext.allocateTupleBuffer());
+    }
+    if (coalescedBuffer.isAllocated and coalescedBuffer.originId != originId)
+    {
+        emitCoalescedBuffer(pipelineExecutionContext, coalescedBuffer);
+    }
+    if (not coalescedBuffer.isAllocated)
+    {
+        coalescedBuffer.buffer = pipelineExecutionContext.allocateTupleBuffer();
+        coalescedBuffer.buffer.setNumberOfTuples(0);
+        coalescedBuffer.isAllocated = true;
+        coalescedBuffer.originId = originId;
+    }
+    return std::addressof(coalescedBuffer.buffer);
+}
+
+void EmitOperatorHandler::releaseCoalescedBuffer(
+    PipelineExecutionContext& pipelineExecutionContext,
+    TupleBuffer* buffer,
+    const uint64_t numberOfRecords,
+    const OriginId originId,
+    const Timestamp watermarkTs,
+    const Timestamp creationTs,
+    const Timestamp latestCreationTs,
+    const bool isFull)
+{
+    const auto now = std::chrono::steady_clock::now();
+    auto& coalescedBuffer = *coalescedBuffers[pipelineExecutionContext.getId() % coalescedBuffers.size()];
+    if (buffer != std::addressof(coalescedBuffer.buffer))
+    {
+        const std::unique_ptr<TupleBuffer> ownBuffer(buffer);
+        CoalescedBuffer uncoalescedBuffer{
+            .buffer = *ownBuffer,
+            .isAllocated = true,
+            .originId = originId,
+            .watermarkTs = watermarkTs,
+            .creationTs = creationTs,
+            .latestCreationTs = latestCreationTs};
+        uncoalescedBuffer.buffer.setNumberOfTuples(numberOfRecords);
+        emitCoalescedBuffer(pipelineExecutionContext, uncoalescedBuffer);
+        emitExpiredBuffers(pipelineExecutionContext, now);
+        return;
+    }
+
+    if (const auto previousNumberOfRecords = coalescedBuffer.buffer.getNumberOfTuples(); numberOfRecords > previousNumberOfRecords)
+    {
+        const bool isFirst = previousNumberOfRecords == 0;
+        coalescedBuffer.creationTs = isFirst ? creationTs : std::min(coalescedBuffer.creationTs, creationTs);
+        coalescedBuffer.latestCreationTs = isFirst ? latestCreationTs : std::max(coalescedBuffer.latestCreationTs, latestCreationTs);
+    }
+    coalescedBuffer.buffer.setNumberOfTuples(numberOfRecords);
+    coalescedBuffer.watermarkTs = watermarkTs;
+    if (numberOfRecords > 0 and not coalescedBuffer.firstRecordArrival.has_value())
+    {
+        coalescedBuffer.firstRecordArrival = now;
+    }
+    if (isFull or (coalescedBuffer.firstRecordArrival.has_value() and now - *coalescedBuffer.firstRecordArrival >= coalescingMaxDelay))
+    {
+        emitCoalescedBuffer(pipelineExecutionContext, coalescedBuffer);
+    }
+    coalescedBuffer.isUsed.clear(std::memory_order_release);
+    emitExpiredBuffers(pipelineExecutionContext, now);
+}
+
+void EmitOperatorHandler::emitExpiredBuffers(
+    PipelineExecutionContext& pipelineExecutionContext, const std::chrono::steady_clock::time_point now)
+{
+    for (const auto& coalescedBuffer : coalescedBuffers)
+    {
+        /// Skips the buffers that other threads currently write to
+        if (coalescedBuffer->isUsed.test_and_set(std::memory_order_acquire))
+        {
+            continue;
+        }
+        if (coalescedBuffer->firstRecordArrival.has_value() and now - *coalescedBuffer->firstRecordArrival >= coalescingMaxDelay)
+        {
+            emitCoalescedBuffer(pipelineExecutionContext, *coalescedBuffer);
+        }
+        coalescedBuffer->isUsed.clear(std::memory_order_release);
+    }
+}
+
+void EmitOperatorHandler::flushCoalescedBuffers(PipelineExecutionContext& pipelineExecutionContext)
+{
+    for (const auto& coalescedBuffer : coalescedBuffers)
+    {
+        if (coalescedBuffer->firstRecordArrival.has_value())
+        {
+            emitCoalescedBuffer(pipelineExecutionContext, *coalescedBuffer);
+        }
+    }
+    coalescedBuffers.clear();
+    NES_DEBUG(
+        "Emit coalesced the records of {} pipeline invocations into {} buffers",
+        numberOfCoalescedInvocations.load(std::memory_order_relaxed),
+        numberOfCoalescedBuffers.load(std::memory_order_relaxed));
+}
+
+void EmitOperatorHandler::emitCoalescedBuffer(PipelineExecutionContext& pipelineExecutionContext, CoalescedBuffer& coalescedBuffer)
+{
+    /// Empty buffers carry no records and the coalesced buffers do not forward sequence numbers of the input, thus the emit skips them
+    if (coalescedBuffer.buffer.getNumberOfTuples() > 0)
+    {
+        const auto sequenceNumber = (*originIdToOutputSequenceNumber.wlock())[coalescedBuffer.originId]++ + SequenceNumber::INITIAL;
+        coalescedBuffer.buffer.setOriginId(coalescedBuffer.originId);
+        coalescedBuffer.buffer.setSequenceNumber(SequenceNumber(sequenceNumber));
+        coalescedBuffer.buffer.setChunkNumber(INITIAL_CHUNK_NUMBER);
+        coalescedBuffer.buffer.setLastChunk(true);
+        coalescedBuffer.buffer.setWatermark(coalescedBuffer.watermarkTs);
+        coalescedBuffer.buffer.setCreationTimestampInMS(coalescedBuffer.creationTs);
+        coalescedBuffer.buffer.setLatestCreationTimestampInMS(coalescedBuffer.latestCreationTs);
+        pipelineExecutionContext.emitBuffer(coalescedBuffer.buffer);
+        numberOfCoalescedBuffers.fetch_add(1, std::memory_order_relaxed);
+    }
+    coalescedBuffer.buffer = TupleBuffer();
+    coalescedBuffer.isAllocated = false;
+    coalescedBuffer.firstRecordArrival.reset();
+}
+
 }
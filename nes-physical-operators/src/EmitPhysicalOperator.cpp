@@ -20,11 +20,14 @@
 #include <optional>
 #include <utility>
 #include <Identifiers/Identifiers.hpp>
+#include <MemoryLayout/MemoryLayout.hpp>
 #include <Nautilus/Interface/BufferRef/TupleBufferRef.hpp>
 #include <Nautilus/Interface/NESStrongTypeRef.hpp>
 #include <Nautilus/Interface/Record.hpp>
 #include <Nautilus/Interface/RecordBuffer.hpp>
 #include <Runtime/Execution/OperatorHandler.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Time/Timestamp.hpp>
 #include <Util/Logger/Logger.hpp>
 #include <Util/StdInt.hpp>
 #include <nautilus/val.hpp>
@@ -32,6 +35,7 @@
 #include <ExecutionContext.hpp>
 #include <OperatorState.hpp>
 #include <PhysicalOperator.hpp>
+#include <PipelineExecutionContext.hpp>
 #include <function.hpp>
 #include <val_ptr.hpp>
 
@@ -62,6 +66,56 @@ void removeSequenceStateProxy(void* operatorHandlerPtr, OriginId originId, Seque
     pipelineCtx->removeSequenceState({.sequenceNumber = SequenceNumber(sequenceNumber), .originId = OriginId(originId)});
 }
 
+void setupCoalescingProxy(void* operatorHandlerPtr, PipelineExecutionContext* pipelineCtx)
+{
+    PRECONDITION(operatorHandlerPtr != nullptr, "operator handler should not be null");
+    PRECONDITION(pipelineCtx != nullptr, "pipeline context should not be null");
+    static_cast<EmitOperatorHandler*>(operatorHandlerPtr)->setupCoalescing(pipelineCtx->getNumberOfWorkerThreads());
+}
+
+TupleBuffer* acquireCoalescedBufferProxy(void* operatorHandlerPtr, PipelineExecutionContext* pipelineCtx, OriginId originId)
+{
+    PRECONDITION(operatorHandlerPtr != nullptr, "operator handler should not be null");
+    PRECONDITION(pipelineCtx != nullptr, "pipeline context should not be null");
+    return static_cast<EmitOperatorHandler*>(operatorHandlerPtr)->acquireCoalescedBuffer(*pipelineCtx, originId);
+}
+
+void releaseCoalescedBufferProxy(
+    void* operatorHandlerPtr,
+    PipelineExecutionContext* pipelineCtx,
+    TupleBuffer* buffer,
+    uint64_t numberOfRecords,
+    OriginId originId,
+    Timestamp watermarkTs,
+    Timestamp creationTs,
+    Timestamp latestCreationTs,
+    bool isFull)
+{
+    PRECONDITION(operatorHandlerPtr != nullptr, "operator handler should not be null");
+    PRECONDITION(pipelineCtx != nullptr, "pipeline context should not be null");
+    static_cast<EmitOperatorHandler*>(operatorHandlerPtr)
+        ->releaseCoalescedBuffer(*pipelineCtx, buffer, numberOfRecords, originId, watermarkTs, creationTs, latestCreationTs, isFull);
+}
+
+void flushCoalescedBuffersProxy(void* operatorHandlerPtr, PipelineExecutionContext* pipelineCtx)
+{
+    PRECONDITION(operatorHandlerPtr != nullptr, "operator handler should not be null");
+    PRECONDITION(pipelineCtx != nullptr, "pipeline context should not be null");
+    static_cast<EmitOperatorHandler*>(operatorHandlerPtr)->flushCoalescedBuffers(*pipelineCtx);
+}
+
+TupleBuffer* reuseOrAllocateBufferProxy(PipelineExecutionContext* pipelineCtx, TupleBuffer* inputBuffer, const uint64_t bufferSize)
+{
+    PRECONDITION(pipelineCtx != nullptr, "pipeline context should not be null");
+    PRECONDITION(inputBuffer != nullptr, "input buffer should not be null");
+    /// No other task or operator can obtain a reference to the input buffer, as solely the holders of a reference can copy it
+    if (inputBuffer->getReferenceCounter() == 1 and inputBuffer->getBufferSize() >= bufferSize)
+    {
+        return new TupleBuffer(*inputBuffer);
+    }
+    return new TupleBuffer(pipelineCtx->allocateTupleBuffer());
+}
+
 namespace
 {
 nautilus::val<bool> isLastChunk(ExecutionContext& context, OperatorHandlerId operatorHandlerId)
@@ -98,10 +152,43 @@ public:
     nautilus::val<int8_t*> bufferMemoryArea;
 };
 
-void EmitPhysicalOperator::open(ExecutionContext& ctx, RecordBuffer&) const
+void EmitPhysicalOperator::setup(ExecutionContext& ctx, CompilationContext&) const
+{
+    if (coalescesInvocations)
+    {
+        nautilus::invoke(setupCoalescingProxy, ctx.getGlobalOperatorHandler(operatorHandlerId), ctx.pipelineContext);
+    }
+}
+
+void EmitPhysicalOperator::terminate(ExecutionContext& ctx) const
 {
+    if (coalescesInvocations)
+    {
+        nautilus::invoke(flushCoalescedBuffersProxy, ctx.getGlobalOperatorHandler(operatorHandlerId), ctx.pipelineContext);
+    }
+}
+
+void EmitPhysicalOperator::open(ExecutionContext& ctx, RecordBuffer& recordBuffer) const
+{
+    if (coalescesInvocations)
+    {
+        /// continue writing after the records of the previous invocations
+        const auto resultBufferRef = nautilus::invoke(
+            acquireCoalescedBufferProxy, ctx.getGlobalOperatorHandler(operatorHandlerId), ctx.pipelineContext, ctx.originId);
+        auto emitState = std::make_unique<EmitState>(RecordBuffer(resultBufferRef));
+        emitState->outputIndex = emitState->resultBuffer.getNumRecords();
+        ctx.setLocalOperatorState(id, std::move(emitState));
+        return;
+    }
+
     /// initialize state variable and create new buffer
-    const auto resultBufferRef = ctx.allocateBuffer();
+    const auto resultBufferRef = reusesInputBuffers
+        ? nautilus::invoke(
+              reuseOrAllocateBufferProxy,
+              ctx.pipelineContext,
+              recordBuffer.getReference(),
+              nautilus::val<uint64_t>(bufferRef->getMemoryLayout()->getBufferSize()))
+        : ctx.allocateBuffer();
     const auto resultBuffer = RecordBuffer(resultBufferRef);
     auto emitState = std::make_unique<EmitState>(resultBuffer);
     ctx.setLocalOperatorState(id, std::move(emitState));
@@ -113,11 +200,20 @@ void EmitPhysicalOperator::execute(ExecutionContext& ctx, Record& record) const
     /// emit buffer if it reached the maximal capacity
     if (emitState->outputIndex >= getMaxRecordsPerBuffer())
     {
-        emitRecordBuffer(ctx, emitState->resultBuffer, emitState->outputIndex, false);
-        const auto resultBufferRef = ctx.allocateBuffer();
-        emitState->resultBuffer = RecordBuffer(resultBufferRef);
+        if (coalescesInvocations)
+        {
+            releaseCoalescedBuffer(ctx, emitState->resultBuffer, emitState->outputIndex, true);
+            emitState->resultBuffer = RecordBuffer(nautilus::invoke(
+                acquireCoalescedBufferProxy, ctx.getGlobalOperatorHandler(operatorHandlerId), ctx.pipelineContext, ctx.originId));
+            emitState->outputIndex = emitState->resultBuffer.getNumRecords();
+        }
+        else
+        {
+            emitRecordBuffer(ctx, emitState->resultBuffer, emitState->outputIndex, false);
+            emitState->resultBuffer = RecordBuffer(ctx.allocateBuffer());
+            emitState->outputIndex = 0_u64;
+        }
         emitState->bufferMemoryArea = emitState->resultBuffer.getMemArea();
-        emitState->outputIndex = 0_u64;
     }
 
     /// We need to first check if the buffer has to be emitted and then write to it. Otherwise, it can happen that we will
@@ -131,9 +227,33 @@ void EmitPhysicalOperator::close(ExecutionContext& ctx, RecordBuffer&) const
 {
     /// emit current buffer and set the metadata
     auto* const emitState = dynamic_cast<EmitState*>(ctx.getLocalState(id));
+    if (coalescesInvocations)
+    {
+        releaseCoalescedBuffer(ctx, emitState->resultBuffer, emitState->outputIndex, false);
+        return;
+    }
     emitRecordBuffer(ctx, emitState->resultBuffer, emitState->outputIndex, true);
 }
 
+void EmitPhysicalOperator::releaseCoalescedBuffer(
+    ExecutionContext& ctx,
+    RecordBuffer& recordBuffer,
+    const nautilus::val<uint64_t>& numRecords,
+    const nautilus::val<bool>& isFull) const
+{
+    nautilus::invoke(
+        releaseCoalescedBufferProxy,
+        ctx.getGlobalOperatorHandler(operatorHandlerId),
+        ctx.pipelineContext,
+        recordBuffer.getReference(),
+        numRecords,
+        ctx.originId,
+        ctx.watermarkTs,
+        ctx.creationTs,
+        ctx.latestCreationTs,
+        isFull);
+}
+
 void EmitPhysicalOperator::emitRecordBuffer(
     ExecutionContext& ctx,
     RecordBuffer& recordBuffer,
@@ -144,7 +264,8 @@ void EmitPhysicalOperator::emitRecordBuffer(
     recordBuffer.setWatermarkTs(ctx.watermarkTs);
     recordBuffer.setOriginId(ctx.originId);
     recordBuffer.setSequenceNumber(ctx.sequenceNumber);
-    recordBuffer.setCreationTs(ctx.currentTs);
+    recordBuffer.setCreationTs(ctx.creationTs);
+    recordBuffer.setLatestCreationTs(ctx.latestCreationTs);
 
     /// Chunk Logic. Order matters.
     /// A worker thread will clean up the sequence state for the current sequence number if its told it is the last
@@ -165,9 +286,16 @@ void EmitPhysicalOperator::emitRecordBuffer(
 }
 
 EmitPhysicalOperator::EmitPhysicalOperator(
-    OperatorHandlerId operatorHandlerId, std::shared_ptr<Interface::BufferRef::TupleBufferRef> memoryProvider)
-    : bufferRef(std::move(memoryProvider)), operatorHandlerId(operatorHandlerId)
+    OperatorHandlerId operatorHandlerId,
+    std::shared_ptr<Interface::BufferRef::TupleBufferRef> memoryProvider,
+    const bool coalescesInvocations,
+    const bool reusesInputBuffers)
+    : bufferRef(std::move(memoryProvider))
+    , operatorHandlerId(operatorHandlerId)
+    , coalescesInvocations(coalescesInvocations)
+    , reusesInputBuffers(reusesInputBuffers)
 {
+    PRECONDITION(not(coalescesInvocations and reusesInputBuffers), "An emit that coalesces invocations cannot reuse its input buffers");
 }
 
 [[nodiscard]] uint64_t EmitPhysicalOperator::getMaxRecordsPerBuffer() const
@@ -175,6 +303,21 @@ EmitPhysicalOperator::EmitPhysicalOperator(
     return bufferRef->getMemoryLayout()->getCapacity();
 }
 
+std::shared_ptr<MemoryLayout> EmitPhysicalOperator::getMemoryLayout() const
+{
+    return bufferRef->getMemoryLayout();
+}
+
+bool EmitPhysicalOperator::coalescesInvocationsOfWorkerThreads() const
+{
+    return coalescesInvocations;
+}
+
+bool EmitPhysicalOperator::reusesExclusiveInputBuffers() const
+{
+    return reusesInputBuffers;
+}
+
 std::optional<PhysicalOperator> EmitPhysicalOperator::getChild() const
 {
     return child;
@@ -0,0 +1,82 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <EventTimeSort/EventTimeSortBuildPhysicalOperator.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <EventTimeSort/EventTimeSortOperatorHandler.hpp>
+#include <EventTimeSort/EventTimeSortSlice.hpp>
+#include <Identifiers/Identifiers.hpp>
+#include <Nautilus/Interface/BufferRef/TupleBufferRef.hpp>
+#include <Nautilus/Interface/PagedVector/PagedVector.hpp>
+#include <Nautilus/Interface/PagedVector/PagedVectorRef.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <Runtime/Execution/OperatorHandler.hpp>
+#include <Time/Timestamp.hpp>
+#include <Watermark/TimeFunction.hpp>
+#include <ErrorHandling.hpp>
+#include <ExecutionContext.hpp>
+#include <WindowBuildPhysicalOperator.hpp>
+#include <function.hpp>
+#include <val_ptr.hpp>
+
+namespace NES
+{
+
+namespace
+{
+Nautilus::Interface::PagedVector*
+getEventTimeSortPagedVectorProxy(OperatorHandler* ptrOpHandler, const Timestamp timestamp, const WorkerThreadId workerThreadId)
+{
+    PRECONDITION(ptrOpHandler != nullptr, "opHandler context should not be null!");
+    const auto* opHandler = dynamic_cast<EventTimeSortOperatorHandler*>(ptrOpHandler);
+    const auto createFunction = opHandler->getCreateNewSlicesFunction({});
+    const auto* slice
+        = dynamic_cast<EventTimeSortSlice*>(opHandler->getSliceAndWindowStore().getSlicesOrCreate(timestamp, createFunction)[0].get());
+    INVARIANT(slice != nullptr, "The slice of an event time sort must be an EventTimeSortSlice");
+    return slice->getPagedVectorRef(workerThreadId);
+}
+}
+
+EventTimeSortBuildPhysicalOperator::EventTimeSortBuildPhysicalOperator(
+    const OperatorHandlerId operatorHandlerId,
+    std::unique_ptr<TimeFunction> timeFunction,
+    std::shared_ptr<Interface::BufferRef::TupleBufferRef> bufferRef)
+    : WindowBuildPhysicalOperator(operatorHandlerId, std::move(timeFunction)), bufferRef(std::move(bufferRef))
+{
+}
+
+void EventTimeSortBuildPhysicalOperator::execute(ExecutionContext& executionCtx, Record& record) const
+{
+    const auto timestamp = timeFunction->getTs(executionCtx, record);
+    if (not isLateRecord(executionCtx, timestamp))
+    {
+        /// Get the PagedVector of this worker thread in the slice of the timestamp
+        const auto pagedVectorMemRef = static_cast<nautilus::val<Interface::PagedVector*>>(getSliceStateCached(
+            executionCtx,
+            timestamp,
+            [&](const nautilus::val<OperatorHandler*>& operatorHandler)
+            {
+                return static_cast<nautilus::val<int8_t*>>(
+                    invoke(getEventTimeSortPagedVectorProxy, operatorHandler, timestamp, executionCtx.workerThreadId));
+            }));
+
+        /// Records are appended in their arrival order, the probe sorts them once the watermark has passed the slice
+        const Interface::PagedVectorRef pagedVectorRef(pagedVectorMemRef, bufferRef);
+        pagedVectorRef.writeRecord(record, executionCtx.pipelineMemoryProvider.bufferProvider);
+    }
+}
+}
@@ -0,0 +1,89 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <EventTimeSort/EventTimeSortOperatorHandler.hpp>
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <EventTimeSort/EventTimeSortSlice.hpp>
+#include <Identifiers/Identifiers.hpp>
+#include <SliceStore/Slice.hpp>
+#include <SliceStore/WindowSlicesStoreInterface.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <ErrorHandling.hpp>
+#include <PipelineExecutionContext.hpp>
+#include <WindowBasedOperatorHandler.hpp>
+
+namespace NES
+{
+EventTimeSortOperatorHandler::EventTimeSortOperatorHandler(
+    const std::vector<OriginId>& inputOrigins,
+    const OriginId outputOriginId,
+    std::unique_ptr<WindowSlicesStoreInterface> sliceAndWindowStore)
+    : WindowBasedOperatorHandler(inputOrigins, outputOriginId, std::move(sliceAndWindowStore))
+{
+}
+
+std::function<std::vector<std::shared_ptr<Slice>>(SliceStart, SliceEnd)>
+EventTimeSortOperatorHandler::getCreateNewSlicesFunction(const CreateNewSlicesArguments&) const
+{
+    PRECONDITION(
+        numberOfWorkerThreads > 0, "Number of worker threads not set for window based operator. Was setWorkerThreads() being called?");
+    return std::function(
+        [numberOfWorkerThreads = numberOfWorkerThreads](SliceStart sliceStart, SliceEnd sliceEnd) -> std::vector<std::shared_ptr<Slice>>
+        {
+            NES_TRACE("Creating new event time sort slice for sliceStart {} and sliceEnd {}", sliceStart, sliceEnd);
+            return {std::make_shared<EventTimeSortSlice>(sliceStart, sliceEnd, numberOfWorkerThreads)};
+        });
+}
+
+void EventTimeSortOperatorHandler::triggerSlices(
+    const std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>>& slicesAndWindowInfo,
+    PipelineExecutionContext* pipelineCtx)
+{
+    for (const auto& [windowInfo, allSlices] : slicesAndWindowInfo)
+    {
+        INVARIANT(allSlices.size() == 1, "A reorder interval of the event time sort consists of one slice, but has {}", allSlices.size());
+        auto& slice = dynamic_cast<EventTimeSortSlice&>(*allSlices.front());
+
+        /// The slice store might have spilled the slice to disk, if it exceeded its memory budget
+        slice.reloadState(pipelineCtx->getBufferManager().get());
+        slice.combinePagedVectors();
+
+        auto tupleBuffer = pipelineCtx->getBufferManager()->getBufferBlocking();
+        tupleBuffer.setOriginId(outputOriginId);
+        tupleBuffer.setSequenceNumber(windowInfo.sequenceNumber);
+        tupleBuffer.setChunkNumber(ChunkNumber(ChunkNumber::INITIAL));
+        tupleBuffer.setLastChunk(true);
+        tupleBuffer.setWatermark(windowInfo.windowInfo.windowStart);
+        tupleBuffer.setNumberOfTuples(slice.getNumberOfTuples());
+        setCreationTimestamps(tupleBuffer, slice.getCreationTimestamps());
+        new (tupleBuffer.getAvailableMemoryArea().data()) EmittedEventTimeSortTrigger{windowInfo.windowInfo, slice.getSliceEnd()};
+
+        /// The task queue runs the triggers before other tasks by their window end, thus the intervals are sorted in their order
+        pipelineCtx->emitBufferWithDeadline(tupleBuffer, windowInfo.windowInfo.windowEnd);
+
+        NES_DEBUG(
+            "Emitted event time sort slice {}-{} with {} tuples and sequenceNumber {}",
+            slice.getSliceStart(),
+            slice.getSliceEnd(),
+            slice.getNumberOfTuples(),
+            tupleBuffer.getSequenceDataAsString());
+    }
+}
+
+}
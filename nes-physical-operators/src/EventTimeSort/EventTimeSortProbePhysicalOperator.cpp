@@ -0,0 +1,135 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <EventTimeSort/EventTimeSortProbePhysicalOperator.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include <EventTimeSort/EventTimeSortOperatorHandler.hpp>
+#include <EventTimeSort/EventTimeSortSlice.hpp>
+#include <Identifiers/Identifiers.hpp>
+#include <Nautilus/Interface/BufferRef/TupleBufferRef.hpp>
+#include <Nautilus/Interface/PagedVector/PagedVector.hpp>
+#include <Nautilus/Interface/PagedVector/PagedVectorRef.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <Nautilus/Interface/RecordBuffer.hpp>
+#include <Runtime/Execution/OperatorHandler.hpp>
+#include <SliceStore/Slice.hpp>
+#include <Time/Timestamp.hpp>
+#include <Watermark/TimeFunction.hpp>
+#include <Windowing/WindowMetaData.hpp>
+#include <ErrorHandling.hpp>
+#include <ExecutionContext.hpp>
+#include <WindowProbePhysicalOperator.hpp>
+#include <function.hpp>
+#include <val.hpp>
+#include <val_ptr.hpp>
+
+namespace NES
+{
+
+namespace
+{
+EventTimeSortSlice* getEventTimeSortSliceProxy(OperatorHandler* ptrOpHandler, const EmittedEventTimeSortTrigger* trigger)
+{
+    PRECONDITION(ptrOpHandler != nullptr, "op handler context should not be null");
+    PRECONDITION(trigger != nullptr, "event time sort trigger should not be null");
+    const auto* opHandler = dynamic_cast<EventTimeSortOperatorHandler*>(ptrOpHandler);
+
+    const auto slice = opHandler->getSliceAndWindowStore().getSliceBySliceEnd(trigger->sliceEnd);
+    INVARIANT(slice.has_value(), "Could not find a slice for slice end {}", trigger->sliceEnd);
+    return dynamic_cast<EventTimeSortSlice*>(slice.value().get());
+}
+
+Nautilus::Interface::PagedVector* getCombinedPagedVectorProxy(const EventTimeSortSlice* slice)
+{
+    PRECONDITION(slice != nullptr, "event time sort slice should not be null");
+    /// During triggering the slice, we append all pages of all local copies to a single PagedVector located at position 0
+    return slice->getPagedVectorRef(WorkerThreadId(0));
+}
+
+void addSortKeyProxy(EventTimeSortSlice* slice, const Timestamp timestamp, const uint64_t position)
+{
+    PRECONDITION(slice != nullptr, "event time sort slice should not be null");
+    slice->addSortKey(timestamp, position);
+}
+
+void sortByTimestampProxy(EventTimeSortSlice* slice)
+{
+    PRECONDITION(slice != nullptr, "event time sort slice should not be null");
+    slice->sortByTimestamp();
+}
+
+uint64_t getSortedPositionProxy(const EventTimeSortSlice* slice, const uint64_t index)
+{
+    PRECONDITION(slice != nullptr, "event time sort slice should not be null");
+    return slice->getSortedPosition(index);
+}
+}
+
+EventTimeSortProbePhysicalOperator::EventTimeSortProbePhysicalOperator(
+    const OperatorHandlerId operatorHandlerId,
+    EventTimeFunction timeFunction,
+    std::string timestampFieldName,
+    std::shared_ptr<Interface::BufferRef::TupleBufferRef> bufferRef)
+    : WindowProbePhysicalOperator(operatorHandlerId, WindowMetaData{})
+    , timeFunction(std::move(timeFunction))
+    , timestampFieldName(std::move(timestampFieldName))
+    , bufferRef(std::move(bufferRef))
+{
+}
+
+void EventTimeSortProbePhysicalOperator::open(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const
+{
+    /// As this operator functions as a scan, we have to set the execution context for this pipeline
+    executionCtx.watermarkTs = recordBuffer.getWatermarkTs();
+    executionCtx.currentTs = recordBuffer.getCreatingTs();
+    executionCtx.creationTs = recordBuffer.getCreatingTs();
+    executionCtx.latestCreationTs = recordBuffer.getLatestCreationTs();
+    executionCtx.sequenceNumber = recordBuffer.getSequenceNumber();
+    executionCtx.chunkNumber = recordBuffer.getChunkNumber();
+    executionCtx.lastChunk = recordBuffer.isLastChunk();
+    executionCtx.originId = recordBuffer.getOriginId();
+    openChild(executionCtx, recordBuffer);
+
+    const auto triggerRef = static_cast<nautilus::val<EmittedEventTimeSortTrigger*>>(recordBuffer.getMemArea());
+    const auto operatorHandlerMemRef = executionCtx.getGlobalOperatorHandler(operatorHandlerId);
+    const auto sliceRef = invoke(getEventTimeSortSliceProxy, operatorHandlerMemRef, triggerRef);
+    const Interface::PagedVectorRef pagedVector(invoke(getCombinedPagedVectorProxy, sliceRef), bufferRef);
+
+    /// First pass: reading solely the timestamps, which the slice sorts together with the positions of their records
+    const std::vector<Record::RecordFieldIdentifier> timestampProjection{timestampFieldName};
+    nautilus::val<uint64_t> position(0);
+    for (auto it = pagedVector.begin(timestampProjection); it != pagedVector.end(timestampProjection); ++it)
+    {
+        auto timestampRecord = *it;
+        invoke(addSortKeyProxy, sliceRef, timeFunction.getTs(executionCtx, timestampRecord), position);
+        ++position;
+    }
+    invoke(sortByTimestampProxy, sliceRef);
+
+    /// Second pass: reading and emitting the records by their sorted positions
+    const auto allFieldNames = bufferRef->getMemoryLayout()->getSchema().getFieldNames();
+    const auto numberOfTuples = pagedVector.getNumberOfTuples();
+    for (nautilus::val<uint64_t> index(0); index < numberOfTuples; ++index)
+    {
+        const auto sortedPosition = invoke(getSortedPositionProxy, sliceRef, index);
+        auto record = pagedVector.readRecord(sortedPosition, allFieldNames);
+        executeChild(executionCtx, record);
+    }
+}
+}
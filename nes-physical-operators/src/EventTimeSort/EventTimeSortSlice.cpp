@@ -0,0 +1,162 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <EventTimeSort/EventTimeSortSlice.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <utility>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
+#include <Nautilus/Interface/PagedVector/PagedVector.hpp>
+#include <Runtime/AbstractBufferProvider.hpp>
+#include <SliceStore/Slice.hpp>
+#include <Time/Timestamp.hpp>
+#include <ErrorHandling.hpp>
+
+namespace NES
+{
+
+EventTimeSortSlice::EventTimeSortSlice(const SliceStart sliceStart, const SliceEnd sliceEnd, const uint64_t numberOfWorkerThreads)
+    : Slice(sliceStart, sliceEnd)
+{
+    for (uint64_t i = 0; i < numberOfWorkerThreads; ++i)
+    {
+        pagedVectors.emplace_back(std::make_unique<Nautilus::Interface::PagedVector>());
+    }
+}
+
+uint64_t EventTimeSortSlice::getNumberOfTuples() const
+{
+    return std::accumulate(
+        pagedVectors.begin(),
+        pagedVectors.end(),
+        uint64_t{0},
+        [](const uint64_t sum, const auto& pagedVector) { return sum + pagedVector->getTotalNumberOfEntries(); });
+}
+
+Nautilus::Interface::PagedVector* EventTimeSortSlice::getPagedVectorRef(const WorkerThreadId workerThreadId) const
+{
+    const auto pos = workerThreadId % pagedVectors.size();
+    return pagedVectors[pos].get();
+}
+
+void EventTimeSortSlice::combinePagedVectors()
+{
+    const std::scoped_lock lock(combinePagedVectorsMutex);
+    if (pagedVectors.size() > 1)
+    {
+        for (uint64_t i = 1; i < pagedVectors.size(); ++i)
+        {
+            pagedVectors[0]->moveAllPages(*pagedVectors[i]);
+        }
+        pagedVectors.erase(pagedVectors.begin() + 1, pagedVectors.end());
+    }
+}
+
+void EventTimeSortSlice::addSortKey(const Timestamp timestamp, const uint64_t position)
+{
+    INVARIANT(
+        sliceStart <= timestamp and timestamp < sliceEnd,
+        "The timestamp {} of a record lies outside of its slice {}-{}",
+        timestamp,
+        sliceStart,
+        sliceEnd);
+    sortKeys.emplace_back(timestamp.getRawValue(), position);
+}
+
+void EventTimeSortSlice::sortByTimestamp()
+{
+    const auto sliceLength = sliceEnd.getRawValue() - sliceStart.getRawValue();
+    if (sliceLength > COUNTING_SORT_MAX_MS_PER_RECORD * sortKeys.size())
+    {
+        std::ranges::stable_sort(sortKeys, {}, &std::pair<Timestamp::Underlying, uint64_t>::first);
+        return;
+    }
+
+    /// Counts the records per millisecond of the slice, whose prefix sum yields the first sorted index of each millisecond
+    std::vector<uint64_t> firstIndexOfMs(sliceLength + 1, 0);
+    for (const auto& [timestamp, position] : sortKeys)
+    {
+        ++firstIndexOfMs[timestamp - sliceStart.getRawValue() + 1];
+    }
+    std::partial_sum(firstIndexOfMs.begin(), firstIndexOfMs.end(), firstIndexOfMs.begin());
+
+    std::vector<std::pair<Timestamp::Underlying, uint64_t>> sortedKeys(sortKeys.size());
+    for (const auto& sortKey : sortKeys)
+    {
+        sortedKeys[firstIndexOfMs[sortKey.first - sliceStart.getRawValue()]++] = sortKey;
+    }
+    sortKeys = std::move(sortedKeys);
+}
+
+uint64_t EventTimeSortSlice::getSortedPosition(const uint64_t index) const
+{
+    PRECONDITION(index < sortKeys.size(), "The sorted index {} exceeds the {} sorted records", index, sortKeys.size());
+    return sortKeys[index].second;
+}
+
+uint64_t EventTimeSortSlice::getStateSizeInBytes() const
+{
+    uint64_t sizeInBytes = 0;
+    for (const auto& pagedVector : pagedVectors)
+    {
+        sizeInBytes += pagedVector->getSizeOfPagesInBytes();
+    }
+    return sizeInBytes;
+}
+
+uint64_t EventTimeSortSlice::spillState(const std::filesystem::path& spillDirectory)
+{
+    const std::scoped_lock lock(spillMutex);
+    if (spillFile != nullptr)
+    {
+        return 0;
+    }
+
+    spillFile = createSpillFile(spillDirectory);
+    uint64_t spilledBytes = 0;
+    for (const auto& pagedVector : pagedVectors)
+    {
+        const auto sizeInBytes = pagedVector->getSizeOfPagesInBytes();
+        if (pagedVector->spillPages(spillFile.get()))
+        {
+            spilledBytes += sizeInBytes;
+        }
+    }
+    return spilledBytes;
+}
+
+void EventTimeSortSlice::reloadState(AbstractBufferProvider* bufferProvider)
+{
+    const std::scoped_lock lock(spillMutex);
+    if (spillFile == nullptr)
+    {
+        return;
+    }
+
+    for (const auto& pagedVector : pagedVectors)
+    {
+        if (pagedVector->hasSpilledPages())
+        {
+            pagedVector->reloadPages(spillFile.get(), bufferProvider);
+        }
+    }
+    spillFile.reset();
+}
+}
@@ -15,7 +15,7 @@
 #include <Functions/ConcatPhysicalFunction.hpp>
 
 #include <cstdint>
-#include <utility>
+#include <vector>
 #include <Functions/PhysicalFunction.hpp>
 #include <Nautilus/DataTypes/VarVal.hpp>
 #include <Nautilus/DataTypes/VariableSizedData.hpp>
@@ -29,23 +29,43 @@
 namespace NES
 {
 
-ConcatPhysicalFunction::ConcatPhysicalFunction(PhysicalFunction leftPhysicalFunction, PhysicalFunction rightPhysicalFunction)
-    : leftPhysicalFunction(std::move(leftPhysicalFunction)), rightPhysicalFunction(std::move(rightPhysicalFunction))
+ConcatPhysicalFunction::ConcatPhysicalFunction(const PhysicalFunction& leftPhysicalFunction, const PhysicalFunction& rightPhysicalFunction)
 {
+    addOperand(leftPhysicalFunction);
+    addOperand(rightPhysicalFunction);
 }
 
-VarVal ConcatPhysicalFunction::execute(const Record& record, ArenaRef& arena) const
+void ConcatPhysicalFunction::addOperand(const PhysicalFunction& operand)
 {
-    const auto leftValue = leftPhysicalFunction.execute(record, arena).cast<VariableSizedData>();
-    const auto rightValue = rightPhysicalFunction.execute(record, arena).cast<VariableSizedData>();
+    if (const auto nestedConcat = operand.tryGet<ConcatPhysicalFunction>())
+    {
+        operands.insert(operands.end(), nestedConcat->operands.begin(), nestedConcat->operands.end());
+        return;
+    }
+    operands.emplace_back(operand);
+}
 
-    const auto newSize = leftValue.getContentSize() + rightValue.getContentSize();
+VarVal ConcatPhysicalFunction::execute(const Record& record, ArenaRef& arena) const
+{
+    /// Evaluating all operands first, thus we know the size of the result before allocating it
+    std::vector<VariableSizedData> values;
+    values.reserve(operands.size());
+    nautilus::val<uint32_t> newSize = 0;
+    for (const auto& operand : operands)
+    {
+        values.emplace_back(operand.execute(record, arena).cast<VariableSizedData>());
+        newSize = newSize + values.back().getContentSize();
+    }
     auto newVarSizeData = arena.allocateVariableSizedData(newSize);
 
-    /// Writing the left value and then the right value to the new variable sized data
-    nautilus::memcpy(newVarSizeData.getContent(), leftValue.getContent(), leftValue.getContentSize());
-    nautilus::memcpy(newVarSizeData.getContent() + leftValue.getContentSize(), rightValue.getContent(), rightValue.getContentSize());
-    VarVal(nautilus::val<uint32_t>(newSize)).writeToMemory(newVarSizeData.getReference());
+    /// Writing the values one after another to the new variable sized data
+    nautilus::val<int8_t*> writePosition = newVarSizeData.getContent();
+    for (const auto& value : values)
+    {
+        nautilus::memcpy(writePosition, value.getContent(), value.getContentSize());
+        writePosition = writePosition + value.getContentSize();
+    }
+    VarVal(newSize).writeToMemory(newVarSizeData.getReference());
     return newVarSizeData;
 }
 
@@ -18,6 +18,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <string_view>
 #include <Nautilus/DataTypes/VarVal.hpp>
 #include <Nautilus/DataTypes/VariableSizedData.hpp>
 #include <Nautilus/Interface/Record.hpp>
@@ -44,4 +45,9 @@ VarVal ConstantValueVariableSizePhysicalFunction::execute(const Record&, ArenaRe
     return result;
 }
 
+std::string_view ConstantValueVariableSizePhysicalFunction::getValue() const
+{
+    return {std::bit_cast<const char*>(data.data() + sizeof(uint32_t)), data.size() - sizeof(uint32_t)};
+}
+
 }
@@ -30,4 +30,9 @@ VarVal FieldAccessPhysicalFunction::execute(const Record& record, ArenaRef&) con
     return record.read(field);
 }
 
+const Record::RecordFieldIdentifier& FieldAccessPhysicalFunction::getField() const
+{
+    return field;
+}
+
 }
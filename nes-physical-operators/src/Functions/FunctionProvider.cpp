@@ -13,13 +13,24 @@
 */
 #include <Functions/FunctionProvider.hpp>
 
+#include <algorithm>
 #include <cstdint>
+#include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <utility>
 #include <vector>
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/DataTypeProvider.hpp>
+#include <Functions/BooleanFunctions/EqualsLogicalFunction.hpp>
 #include <Functions/CastFieldPhysicalFunction.hpp>
 #include <Functions/CastToTypeLogicalFunction.hpp>
+#include <Functions/ComparisonFunctions/GreaterEqualsLogicalFunction.hpp>
+#include <Functions/ComparisonFunctions/GreaterLogicalFunction.hpp>
+#include <Functions/ComparisonFunctions/LessEqualsLogicalFunction.hpp>
+#include <Functions/ComparisonFunctions/LessLogicalFunction.hpp>
 #include <Functions/ConstantValueLogicalFunction.hpp>
 #include <Functions/ConstantValuePhysicalFunction.hpp>
 #include <Functions/ConstantValueVariableSizePhysicalFunction.hpp>
@@ -27,19 +38,165 @@
 #include <Functions/FieldAccessPhysicalFunction.hpp>
 #include <Functions/LogicalFunction.hpp>
 #include <Functions/PhysicalFunction.hpp>
+#include <Functions/QueryParameterLogicalFunction.hpp>
+#include <Functions/QueryParameterPhysicalFunction.hpp>
+#include <Functions/QueryParameters.hpp>
 #include <Util/Strings.hpp>
 #include <ErrorHandling.hpp>
 #include <PhysicalFunctionRegistry.hpp>
 
 namespace NES::QueryCompilation
 {
+namespace
+{
+template <typename T>
+struct TypeTag
+{
+    using Type = T;
+};
+
+/// Calls the function with the C++ type of a fixed-size numeric type. Returns nullopt for all other types.
+template <typename Function>
+auto visitNumericType(const DataType::Type type, Function&& function) -> std::optional<decltype(function(TypeTag<int8_t>{}))>
+{
+    switch (type)
+    {
+        case DataType::Type::UINT8:
+            return function(TypeTag<uint8_t>{});
+        case DataType::Type::UINT16:
+            return function(TypeTag<uint16_t>{});
+        case DataType::Type::UINT32:
+            return function(TypeTag<uint32_t>{});
+        case DataType::Type::UINT64:
+            return function(TypeTag<uint64_t>{});
+        case DataType::Type::INT8:
+            return function(TypeTag<int8_t>{});
+        case DataType::Type::INT16:
+            return function(TypeTag<int16_t>{});
+        case DataType::Type::INT32:
+            return function(TypeTag<int32_t>{});
+        case DataType::Type::INT64:
+            return function(TypeTag<int64_t>{});
+        case DataType::Type::FLOAT32:
+            return function(TypeTag<float>{});
+        case DataType::Type::FLOAT64:
+            return function(TypeTag<double>{});
+        default:
+            return std::nullopt;
+    }
+}
+
+template <typename T>
+constexpr DataType::Type toDataTypeType()
+{
+    if constexpr (std::is_same_v<T, uint8_t>)
+    {
+        return DataType::Type::UINT8;
+    }
+    else if constexpr (std::is_same_v<T, uint16_t>)
+    {
+        return DataType::Type::UINT16;
+    }
+    else if constexpr (std::is_same_v<T, uint32_t>)
+    {
+        return DataType::Type::UINT32;
+    }
+    else if constexpr (std::is_same_v<T, uint64_t>)
+    {
+        return DataType::Type::UINT64;
+    }
+    else if constexpr (std::is_same_v<T, int8_t>)
+    {
+        return DataType::Type::INT8;
+    }
+    else if constexpr (std::is_same_v<T, int16_t>)
+    {
+        return DataType::Type::INT16;
+    }
+    else if constexpr (std::is_same_v<T, int32_t>)
+    {
+        return DataType::Type::INT32;
+    }
+    else if constexpr (std::is_same_v<T, int64_t>)
+    {
+        return DataType::Type::INT64;
+    }
+    else if constexpr (std::is_same_v<T, float>)
+    {
+        return DataType::Type::FLOAT32;
+    }
+    else
+    {
+        static_assert(std::is_same_v<T, double>, "Unexpected common type of two numeric types");
+        return DataType::Type::FLOAT64;
+    }
+}
+
+bool isComparison(const LogicalFunction& function)
+{
+    return function.tryGet<EqualsLogicalFunction>() or function.tryGet<LessLogicalFunction>()
+        or function.tryGet<LessEqualsLogicalFunction>() or function.tryGet<GreaterLogicalFunction>()
+        or function.tryGet<GreaterEqualsLogicalFunction>();
+}
+
+/// Returns the type, to which the usual arithmetic conversions convert both operands of a comparison of different numeric types.
+/// Returns nullopt, if the operands have the same type or are not both fixed-size numeric types.
+std::optional<DataType::Type> getCommonComparisonType(const DataType::Type left, const DataType::Type right)
+{
+    if (left == right)
+    {
+        return std::nullopt;
+    }
+    return visitNumericType(
+               left,
+               [right]<typename Left>(TypeTag<Left>)
+               {
+                   return visitNumericType(
+                       right, []<typename Right>(TypeTag<Right>) { return toDataTypeType<std::common_type_t<Left, Right>>(); });
+               })
+        .value_or(std::nullopt);
+}
+
+bool isRepresentableAs(const std::string_view value, const DataType::Type type)
+{
+    return visitNumericType(type, [value]<typename T>(TypeTag<T>) { return NES::Util::from_chars<T>(value).has_value(); }).value_or(false);
+}
+}
+
 PhysicalFunction FunctionProvider::lowerFunction(LogicalFunction logicalFunction)
 {
+    return lowerFunction(std::move(logicalFunction), {});
+}
+
+PhysicalFunction FunctionProvider::lowerFunction(LogicalFunction logicalFunction, const std::vector<ComputedField>& computedFields)
+{
+    /// 0. Reading a computed field is solely cheaper than recomputing functions with children
+    if (not logicalFunction.getChildren().empty())
+    {
+        const auto computedField = std::ranges::find_if(
+            computedFields, [&logicalFunction](const ComputedField& field) { return field.first == logicalFunction; });
+        if (computedField != computedFields.end())
+        {
+            return FieldAccessPhysicalFunction(computedField->second);
+        }
+    }
+
     /// 1. Recursively lower the children of the function node.
+    /// The operands of comparisons of different numeric types are converted to their common type here, instead of per comparison.
+    std::optional<DataType::Type> commonComparisonType;
+    if (const auto children = logicalFunction.getChildren(); children.size() == 2 and isComparison(logicalFunction))
+    {
+        commonComparisonType = getCommonComparisonType(children[0].getDataType().type, children[1].getDataType().type);
+    }
     std::vector<PhysicalFunction> childFunction;
     for (const auto& child : logicalFunction.getChildren())
     {
-        childFunction.emplace_back(lowerFunction(child));
+        if (commonComparisonType)
+        {
+            childFunction.emplace_back(lowerComparisonOperand(child, *commonComparisonType, computedFields));
+            continue;
+        }
+        childFunction.emplace_back(lowerFunction(child, computedFields));
     }
 
     /// 2. The field access and constant value nodes are special as they require a different treatment,
@@ -52,6 +209,10 @@ PhysicalFunction FunctionProvider::lowerFunction(LogicalFunction logicalFunction
     {
         return lowerConstantFunction(*constantValueFunction);
     }
+    if (const auto queryParameterFunction = logicalFunction.tryGet<QueryParameterLogicalFunction>())
+    {
+        return lowerQueryParameterFunction(*queryParameterFunction);
+    }
     if (const auto castToTypeNode = logicalFunction.tryGet<CastToTypeLogicalFunction>())
     {
         INVARIANT(childFunction.size() == 1, "CastFieldPhysicalFunction expects exact one child!");
@@ -68,6 +229,22 @@ PhysicalFunction FunctionProvider::lowerFunction(LogicalFunction logicalFunction
     throw UnknownFunctionType("Can not lower function: {}", logicalFunction);
 }
 
+PhysicalFunction FunctionProvider::lowerComparisonOperand(
+    const LogicalFunction& operand, const DataType::Type type, const std::vector<ComputedField>& computedFields)
+{
+    if (operand.getDataType().type == type)
+    {
+        return lowerFunction(operand, computedFields);
+    }
+    /// Constants, whose value the common type represents, are lowered in the common type, thus the traced code contains no cast of them
+    if (const auto constant = operand.tryGet<ConstantValueLogicalFunction>();
+        constant and isRepresentableAs(constant->getConstantValue(), type))
+    {
+        return lowerConstantFunction(ConstantValueLogicalFunction(DataTypeProvider::provideDataType(type), constant->getConstantValue()));
+    }
+    return CastFieldPhysicalFunction(lowerFunction(operand, computedFields), DataTypeProvider::provideDataType(type));
+}
+
 namespace
 {
 template <typename T>
@@ -82,6 +259,36 @@ T parseConstantValue(std::string_view input)
 }
 }
 
+PhysicalFunction FunctionProvider::lowerQueryParameterFunction(const QueryParameterLogicalFunction& parameterFunction)
+{
+    const auto type = parameterFunction.getDataType().type;
+    /// Outside a QueryParameters::Scope, e.g., in tests, nobody can update the parameter, thus it keeps its default value
+    std::shared_ptr<QueryParameter> parameter;
+    if (auto* parameters = QueryParameters::current())
+    {
+        parameter = parameters->getOrCreate(parameterFunction.getParameterName(), type, parameterFunction.getDefaultValue());
+    }
+    else
+    {
+        parameter = std::make_shared<QueryParameter>(parameterFunction.getParameterName(), type, parameterFunction.getDefaultValue());
+    }
+    auto function = visitNumericType(
+        type, [&parameter]<typename T>(TypeTag<T>) -> PhysicalFunction { return QueryParameterPhysicalFunction<T>(parameter); });
+    if (function)
+    {
+        return *function;
+    }
+    switch (type)
+    {
+        case DataType::Type::BOOLEAN:
+            return QueryParameterPhysicalFunction<bool>(parameter);
+        case DataType::Type::CHAR:
+            return QueryParameterPhysicalFunction<char>(parameter);
+        default:
+            throw UnsupportedQuery("The query parameter {} must have a fixed-size type", parameterFunction.getParameterName());
+    }
+}
+
 PhysicalFunction FunctionProvider::lowerConstantFunction(const ConstantValueLogicalFunction& constantFunction)
 {
     const auto stringValue = constantFunction.getConstantValue();
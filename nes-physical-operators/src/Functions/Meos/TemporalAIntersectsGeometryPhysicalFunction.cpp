@@ -1,18 +1,21 @@
 #include <utility>
 #include <vector>
 #include <string>
+#include <string_view>
 #include <cstring>
+#include <memory>
+#include <Functions/ConstantValueVariableSizePhysicalFunction.hpp>
 #include <Functions/Meos/TemporalAIntersectsGeometryPhysicalFunction.hpp>
 #include <Functions/PhysicalFunction.hpp>
 #include <Nautilus/DataTypes/VarVal.hpp>
 #include <Nautilus/DataTypes/VariableSizedData.hpp>
 #include <Nautilus/Interface/Record.hpp>
+#include <Util/FunctionStatistics.hpp>
+#include <Util/Logger/Logger.hpp>
 #include <ErrorHandling.hpp>
 #include <ExecutionContext.hpp>
 #include <PhysicalFunctionRegistry.hpp>
 #include <MEOSWrapper.hpp>
-#include <fmt/format.h>
-#include <iostream>
 #include <val.hpp>
 #include <function.hpp>
 
@@ -27,6 +30,17 @@ TemporalAIntersectsGeometryPhysicalFunction::TemporalAIntersectsGeometryPhysical
     parameterFunctions.push_back(std::move(lat1Function));
     parameterFunctions.push_back(std::move(timestamp1Function));
     parameterFunctions.push_back(std::move(staticGeometryFunction));
+
+    // Index a constant static geometry once, instead of parsing it for every record
+    if (const auto constantGeometry = parameterFunctions[3].tryGet<ConstantValueVariableSizePhysicalFunction>()) {
+        const auto wkt = MEOS::Meos::stripQuotes(constantGeometry->getValue());
+        if (!wkt.empty()) {
+            auto geofences = std::make_shared<const MEOS::Meos::GeofenceIndex>(wkt);
+            if (geofences->size() > 0) {
+                constantGeofences = std::move(geofences);
+            }
+        }
+    }
 }
 
 // Constructor with 6 parameters for temporal-temporal intersection
@@ -44,8 +58,6 @@ TemporalAIntersectsGeometryPhysicalFunction::TemporalAIntersectsGeometryPhysical
 
 VarVal TemporalAIntersectsGeometryPhysicalFunction::execute(const Record& record, ArenaRef& arena) const
 {
-    std::cout << "TemporalAIntersectsGeometryPhysicalFunction::execute called with " << parameterFunctions.size() << " arguments" << std::endl;
-    
     // Execute all parameter functions to get their values
     std::vector<VarVal> parameterValues;
     parameterValues.reserve(parameterFunctions.size());
@@ -72,57 +84,48 @@ VarVal TemporalAIntersectsGeometryPhysicalFunction::executeTemporal6Param(const
     auto lat2 = params[4].cast<nautilus::val<double>>();
     auto timestamp2 = params[5].cast<nautilus::val<uint64_t>>();
     
-    std::cout << "6-param temporal-temporal aintersection with coordinate values" << std::endl;
-    
     // Use nautilus::invoke to call external MEOS function with coordinate parameters
     const auto result = nautilus::invoke(
-        +[](double lon1_val, double lat1_val, uint64_t ts1_val, double lon2_val, double lat2_val, uint64_t ts2_val) -> int {
+        +[](double lon1_val, double lat1_val, uint64_t ts1_val, double lon2_val, double lat2_val, uint64_t ts2_val,
+            MEOS::Meos::EpochConverter* converter) -> int {
+            static auto& counters = FunctionStatistics::getCounters("TemporalAIntersects");
+            const bool sampled = counters.recordCall();
             try {
                 // Use the existing global MEOS initialization mechanism
                 MEOS::Meos::ensureMeosInitialized();
                 auto inRange = [](double lo, double la){ return lo >= -180.0 && lo <= 180.0 && la >= -90.0 && la <= 90.0; };
                 if (!inRange(lon1_val, lat1_val) || !inRange(lon2_val, lat2_val)) {
-                    std::cout << "TemporalAIntersects: coordinates out of range" << std::endl;
+                    counters.recordInvalidInput();
                     return 0;
                 }
                 
-                // Convert UINT64 timestamps to MEOS timestamp strings
-                std::string timestamp1_str = MEOS::Meos::convertEpochToTimestamp(ts1_val);
-                std::string timestamp2_str = MEOS::Meos::convertEpochToTimestamp(ts2_val);
-                
-                // Build temporal geometry WKT strings from coordinates and timestamps
-                std::string left_geometry_wkt = fmt::format("SRID=4326;Point({} {})@{}", lon1_val, lat1_val, timestamp1_str);
-                std::string right_geometry_wkt = fmt::format("SRID=4326;Point({} {})@{}", lon2_val, lat2_val, timestamp2_str);
-                
-                std::cout << "Built temporal geometries:" << std::endl;
-                std::cout << "Left: " << left_geometry_wkt << std::endl;
-                std::cout << "Right: " << right_geometry_wkt << std::endl;
-                
-                // Both geometries are temporal points, use temporal-temporal aintersection
-                std::cout << "Using temporal-temporal aintersection (aintersects_tgeo_tgeo)" << std::endl;
-                MEOS::Meos::TemporalGeometry left_temporal(left_geometry_wkt);
+                // Build temporal points directly from coordinates and timestamps
+                MEOS::Meos::TemporalGeometry left_temporal(lon1_val, lat1_val, ts1_val, *converter);
                 if (!left_temporal.getGeometry()) {
-                    std::cout << "TemporalAIntersects: left temporal geometry is null" << std::endl;
+                    counters.recordInvalidInput();
                     return 0;
                 }
-                MEOS::Meos::TemporalGeometry right_temporal(right_geometry_wkt);
+                MEOS::Meos::TemporalGeometry right_temporal(lon2_val, lat2_val, ts2_val, *converter);
                 if (!right_temporal.getGeometry()) {
-                    std::cout << "TemporalAIntersects: right temporal geometry is null" << std::endl;
+                    counters.recordInvalidInput();
                     return 0;
                 }
                 int intersection_result = left_temporal.aintersects(right_temporal);
-                std::cout << "aintersects_tgeo_tgeo result: " << intersection_result << std::endl;
+                if (sampled) {
+                    NES_DEBUG("TemporalAIntersects: aintersects_tgeo_tgeo returned {}", intersection_result);
+                }
                 
                 return intersection_result;
             } catch (const std::exception& e) {
-                std::cout << "MEOS exception in temporal geometry aintersection: " << e.what() << std::endl;
+                counters.recordError();
+                NES_DEBUG("TemporalAIntersects: MEOS exception: {}", e.what());
                 return -1;  // Error case
             } catch (...) {
-                std::cout << "Unknown error in temporal geometry aintersection" << std::endl;
+                counters.recordError();
                 return -1;  // Error case
             }
         },
-        lon1, lat1, timestamp1, lon2, lat2, timestamp2
+        lon1, lat1, timestamp1, lon2, lat2, timestamp2, nautilus::val<MEOS::Meos::EpochConverter*>(epochConverter.get())
     );
     
     return VarVal(result);
@@ -135,72 +138,89 @@ VarVal TemporalAIntersectsGeometryPhysicalFunction::executeTemporal4Param(const
     auto lat1 = params[1].cast<nautilus::val<double>>();
     auto timestamp1 = params[2].cast<nautilus::val<uint64_t>>();
     auto static_geometry_varsized = params[3].cast<VariableSizedData>();
-    
-    std::cout << "4-param temporal-static aintersection with coordinate values" << std::endl;
-    
+
+    if (constantGeofences) {
+        // Only evaluates aintersects_tgeo_geo for the geofences whose bounding box contains the point
+        const auto result = nautilus::invoke(
+            +[](double lon1_val, double lat1_val, uint64_t ts1_val, const MEOS::Meos::GeofenceIndex* geofences,
+                MEOS::Meos::EpochConverter* converter) -> int {
+                static auto& counters = FunctionStatistics::getCounters("TemporalAIntersects");
+                counters.recordCall();
+                try {
+                    MEOS::Meos::ensureMeosInitialized();
+                    if (!(lon1_val >= -180.0 && lon1_val <= 180.0 && lat1_val >= -90.0 && lat1_val <= 90.0)) {
+                        counters.recordInvalidInput();
+                        return 0;
+                    }
+                    MEOS::Meos::TemporalGeometry left_temporal(lon1_val, lat1_val, ts1_val, *converter);
+                    if (!left_temporal.getGeometry()) {
+                        counters.recordInvalidInput();
+                        return 0;
+                    }
+                    return geofences->aintersects(left_temporal, lon1_val, lat1_val);
+                } catch (...) {
+                    counters.recordError();
+                    return -1;
+                }
+            },
+            lon1, lat1, timestamp1, nautilus::val<const MEOS::Meos::GeofenceIndex*>(constantGeofences.get()),
+            nautilus::val<MEOS::Meos::EpochConverter*>(epochConverter.get()));
+        return VarVal(result);
+    }
+
     // Use nautilus::invoke to call external MEOS function with coordinate and geometry parameters
     const auto result = nautilus::invoke(
-        +[](double lon1_val, double lat1_val, uint64_t ts1_val, const char* static_geom_ptr, uint32_t static_geom_size) -> int {
+        +[](double lon1_val, double lat1_val, uint64_t ts1_val, const char* static_geom_ptr, uint32_t static_geom_size,
+            MEOS::Meos::EpochConverter* converter) -> int {
+            static auto& counters = FunctionStatistics::getCounters("TemporalAIntersects");
+            const bool sampled = counters.recordCall();
             try {
                 // Use the existing global MEOS initialization mechanism
                 MEOS::Meos::ensureMeosInitialized();
                 if (!(lon1_val >= -180.0 && lon1_val <= 180.0 && lat1_val >= -90.0 && lat1_val <= 90.0)) {
-                    std::cout << "TemporalAIntersects: coordinates out of range" << std::endl;
+                    counters.recordInvalidInput();
                     return 0;
                 }
                 
-                // Convert UINT64 timestamp to MEOS timestamp string
-                std::string timestamp1_str = MEOS::Meos::convertEpochToTimestamp(ts1_val);
-                
-                // Build temporal geometry WKT string from coordinates and timestamp
-                std::string left_geometry_wkt = fmt::format("SRID=4326;Point({} {})@{}", lon1_val, lat1_val, timestamp1_str);
+                // View the static geometry WKT in the VariableSizedData and strip quotes if present
+                // (CSV parsing includes quotes in the string values)
+                const auto right_geometry_wkt = MEOS::Meos::stripQuotes(std::string_view(static_geom_ptr, static_geom_size));
                 
-                // Extract static geometry WKT from VariableSizedData
-                std::string right_geometry_wkt(static_geom_ptr, static_geom_size);
                 
-                // Strip quotes if present (CSV parsing includes quotes in the string values)
-                while (!right_geometry_wkt.empty() && (right_geometry_wkt.front() == '\'' || right_geometry_wkt.front() == '"')) {
-                    right_geometry_wkt = right_geometry_wkt.substr(1);
-                }
-                while (!right_geometry_wkt.empty() && (right_geometry_wkt.back() == '\'' || right_geometry_wkt.back() == '"')) {
-                    right_geometry_wkt = right_geometry_wkt.substr(0, right_geometry_wkt.size() - 1);
-                }
-                
-                std::cout << "Built geometries:" << std::endl;
-                std::cout << "Left (temporal): " << left_geometry_wkt << std::endl;
-                std::cout << "Right (static): " << right_geometry_wkt << std::endl;
-                
-                // Validate input strings are not empty
-                if (left_geometry_wkt.empty() || right_geometry_wkt.empty()) {
-                    std::cout << "Empty geometry WKT string(s)" << std::endl;
+                // Validate input string is not empty
+                if (right_geometry_wkt.empty()) {
+                    counters.recordInvalidInput();
                     return -1;
                 }
                 
                 // Use temporal-static aintersection
-                std::cout << "Using temporal-static aintersection (aintersects_tgeo_geo)" << std::endl;
-                MEOS::Meos::TemporalGeometry left_temporal(left_geometry_wkt);
+                MEOS::Meos::TemporalGeometry left_temporal(lon1_val, lat1_val, ts1_val, *converter);
                 if (!left_temporal.getGeometry()) {
-                    std::cout << "TemporalAIntersects: MEOS temporal geometry is null" << std::endl;
+                    counters.recordInvalidInput();
                     return 0;
                 }
                 MEOS::Meos::StaticGeometry right_static(right_geometry_wkt);
                 if (!right_static.getGeometry()) {
-                    std::cout << "TemporalAIntersects: MEOS static geometry is null" << std::endl;
+                    counters.recordInvalidInput();
                     return 0;
                 }
                 int intersection_result = left_temporal.aintersectsStatic(right_static);
-                std::cout << "aintersects_tgeo_geo result: " << intersection_result << std::endl;
+                if (sampled) {
+                    NES_DEBUG("TemporalAIntersects: aintersects_tgeo_geo returned {}", intersection_result);
+                }
                 
                 return intersection_result;
             } catch (const std::exception& e) {
-                std::cout << "MEOS exception in temporal geometry aintersection: " << e.what() << std::endl;
+                counters.recordError();
+                NES_DEBUG("TemporalAIntersects: MEOS exception: {}", e.what());
                 return -1;  // Error case
             } catch (...) {
-                std::cout << "Unknown error in temporal geometry aintersection" << std::endl;
+                counters.recordError();
                 return -1;  // Error case
             }
         },
-        lon1, lat1, timestamp1, static_geometry_varsized.getContent(), static_geometry_varsized.getContentSize()
+        lon1, lat1, timestamp1, static_geometry_varsized.getContent(), static_geometry_varsized.getContentSize(),
+        nautilus::val<MEOS::Meos::EpochConverter*>(epochConverter.get())
     );
     
     return VarVal(result);
@@ -8,11 +8,11 @@
 #include <PhysicalFunctionRegistry.hpp>
 #include <ErrorHandling.hpp>
 #include <ExecutionContext.hpp>
-#include <fmt/format.h>
 #include <function.hpp>
 #include <cctype>
 #include <iostream>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <val.hpp>
 
@@ -72,18 +72,15 @@ VarVal TemporalAtStBoxPhysicalFunction::execute(const Record& record, ArenaRef&
             uint64_t timestampValue,
             const char* stboxPtr,
             uint32_t stboxSize,
-            bool borderInclusiveFlag) -> int {
+            bool borderInclusiveFlag,
+            MEOS::Meos::EpochConverter* converter) -> int {
             try
             {
                 MEOS::Meos::ensureMeosInitialized();
-                const std::string timestampString = MEOS::Meos::convertEpochToTimestamp(timestampValue);
-                std::string temporalGeometryWkt = fmt::format("SRID=4326;Point({} {})@{}", lonValue, latValue, timestampString);
-                std::string stboxWkt(stboxPtr, stboxSize);
-                while (!stboxWkt.empty() && (stboxWkt.front()=='\'' || stboxWkt.front()=='"')) stboxWkt.erase(stboxWkt.begin());
-                while (!stboxWkt.empty() && (stboxWkt.back()=='\'' || stboxWkt.back()=='"')) stboxWkt.pop_back();
-                if (temporalGeometryWkt.empty() || stboxWkt.empty()) return 0;
+                const auto stboxWkt = MEOS::Meos::stripQuotes(std::string_view(stboxPtr, stboxSize));
+                if (stboxWkt.empty()) return 0;
 
-                MEOS::Meos::TemporalGeometry temporalGeometry(temporalGeometryWkt);
+                MEOS::Meos::TemporalGeometry temporalGeometry(lonValue, latValue, timestampValue, *converter);
                 if (!temporalGeometry.getGeometry()) return 0;
                 MEOS::Meos::SpatioTemporalBox stbox(stboxWkt);
                 if (!stbox.getBox()) return 0;
@@ -97,7 +94,8 @@ VarVal TemporalAtStBoxPhysicalFunction::execute(const Record& record, ArenaRef&
         timestamp,
         stboxLiteral.getContent(),
         stboxLiteral.getContentSize(),
-        borderVal);
+        borderVal,
+        nautilus::val<MEOS::Meos::EpochConverter*>(epochConverter.get()));
 
     return VarVal(result);
 }
@@ -1,16 +1,34 @@
 #include <Functions/Meos/TemporalEContainsGeometryPhysicalFunction.hpp>
+#include <Functions/ConstantValueVariableSizePhysicalFunction.hpp>
 #include <PhysicalFunctionRegistry.hpp>
 #include <MEOSWrapper.hpp>
-#include <fmt/format.h>
 #include <Nautilus/DataTypes/VariableSizedData.hpp>
 #include <Nautilus/DataTypes/VarVal.hpp>
 #include <Nautilus/Interface/Record.hpp>
+#include <Util/FunctionStatistics.hpp>
+#include <Util/Logger/Logger.hpp>
 #include <ExecutionContext.hpp>
 #include <ErrorHandling.hpp>
-#include <iostream>
+#include <string_view>
 
 namespace NES {
 
+namespace {
+/* indexes a constant static geometry once, instead of parsing it for every record */
+std::shared_ptr<const MEOS::Meos::GeofenceIndex> indexConstantGeometry(const PhysicalFunction& function) {
+    const auto constantGeometry = function.tryGet<ConstantValueVariableSizePhysicalFunction>();
+    if (!constantGeometry) {
+        return nullptr;
+    }
+    const auto wkt = MEOS::Meos::stripQuotes(constantGeometry->getValue());
+    if (wkt.empty()) {
+        return nullptr;
+    }
+    auto geofences = std::make_shared<const MEOS::Meos::GeofenceIndex>(wkt);
+    return geofences->size() > 0 ? geofences : nullptr;
+}
+}
+
 /* ─────────── constructors ─────────── */
 
 TemporalEContainsGeometryPhysicalFunction::
@@ -19,6 +37,11 @@ TemporalEContainsGeometryPhysicalFunction(PhysicalFunction param1,
                                          PhysicalFunction param3,
                                          PhysicalFunction param4)
     : paramFns{std::move(param1),std::move(param2),std::move(param3),std::move(param4)} {
+    /* only the static geometry can be a variable-sized constant */
+    constantGeofences = indexConstantGeometry(paramFns[0]);
+    if (!constantGeofences) {
+        constantGeofences = indexConstantGeometry(paramFns[3]);
+    }
 }
 
 TemporalEContainsGeometryPhysicalFunction::
@@ -36,7 +59,6 @@ TemporalEContainsGeometryPhysicalFunction(PhysicalFunction lon1,
 
 VarVal TemporalEContainsGeometryPhysicalFunction::execute(const Record& rec,
                                                           ArenaRef& arena) const {
-    std::cout << "TemporalEContainsGeometryPhysicalFunction::execute called with " << paramFns.size() << " arguments" << std::endl;
     std::vector<VarVal> vals; vals.reserve(paramFns.size());
     for(auto& f:paramFns){ 
         vals.push_back(f.execute(rec, arena));
@@ -61,6 +83,39 @@ VarVal TemporalEContainsGeometryPhysicalFunction::execute(const Record& rec,
 
 /* ─────────── helpers ─────────── */
 
+/* only evaluates the exact predicate for the geofences whose bounding box contains the point */
+VarVal
+TemporalEContainsGeometryPhysicalFunction::execConstantGeofences(const VarVal& lonVal, const VarVal& latVal, const VarVal& tsVal, bool geofenceFirst) const {
+    auto lon = lonVal.cast<nautilus::val<double>>();
+    auto lat = latVal.cast<nautilus::val<double>>();
+    auto ts  = tsVal.cast<nautilus::val<uint64_t>>();
+
+    const auto res = nautilus::invoke(
+        +[](double lo, double la, uint64_t t, const MEOS::Meos::GeofenceIndex* geofences, bool geoFirst,
+            MEOS::Meos::EpochConverter* converter) -> int {
+            static auto& counters = FunctionStatistics::getCounters("TemporalEContains");
+            counters.recordCall();
+            try {
+                MEOS::Meos::ensureMeosInitialized();
+                if (!(lo >= -180.0 && lo <= 180.0 && la >= -90.0 && la <= 90.0)) {
+                    counters.recordInvalidInput();
+                    return 0;
+                }
+                MEOS::Meos::TemporalGeometry point(lo, la, t, *converter);
+                if (!point.getGeometry()) {
+                    counters.recordInvalidInput();
+                    return 0;
+                }
+                return geoFirst ? geofences->containsTemporal(point, lo, la) : geofences->containedByTemporal(point, lo, la);
+            } catch (...) {
+                counters.recordError();
+                return -1;
+            }
+    }, lon, lat, ts, nautilus::val<const MEOS::Meos::GeofenceIndex*>(constantGeofences.get()), nautilus::val<bool>(geofenceFirst),
+        nautilus::val<MEOS::Meos::EpochConverter*>(epochConverter.get()));
+    return VarVal(res);
+}
+
 VarVal
 TemporalEContainsGeometryPhysicalFunction::execTemporalTemporal(const std::vector<VarVal>& p) const {
     auto lon1 = p[0].cast<nautilus::val<double>>();
@@ -70,31 +125,29 @@ TemporalEContainsGeometryPhysicalFunction::execTemporalTemporal(const std::vecto
     auto lat2 = p[4].cast<nautilus::val<double>>();
     auto ts2  = p[5].cast<nautilus::val<uint64_t>>();
 
-    std::cout << "6-param temporal-temporal contains function with coordinate values" << std::endl;
-
 
     const auto res = nautilus::invoke(
-        +[](double lo1,double la1,uint64_t t1, double lo2, double la2, uint64_t t2) -> int {
+        +[](double lo1,double la1,uint64_t t1, double lo2, double la2, uint64_t t2, MEOS::Meos::EpochConverter* converter) -> int {
+            static auto& counters = FunctionStatistics::getCounters("TemporalEContains");
+            counters.recordCall();
             try {
                 MEOS::Meos::ensureMeosInitialized();
                 auto inRange = [](double lo, double la){ return lo >= -180.0 && lo <= 180.0 && la >= -90.0 && la <= 90.0; };
                 if (!inRange(lo1, la1) || !inRange(lo2, la2)) {
-                    std::cout << "TemporalEContains: coordinates out of range" << std::endl;
+                    counters.recordInvalidInput();
                     return 0;
                 }
-                auto tsToStr = MEOS::Meos::convertEpochToTimestamp;
-                std::string left  = fmt::format("SRID=4326;Point({} {})@{}", lo1, la1, tsToStr(t1));
-                std::string right = fmt::format("SRID=4326;Point({} {})@{}", lo2, la2, tsToStr(t2));
-                MEOS::Meos::TemporalGeometry l(left), r(right);
+                MEOS::Meos::TemporalGeometry l(lo1, la1, t1, *converter), r(lo2, la2, t2, *converter);
                 return l.contains(r);
             } catch (const std::exception& e) {
-                std::cout << "MEOS exception in temporal geometry contains: " << e.what() << std::endl;
+                counters.recordError();
+                NES_DEBUG("TemporalEContains: MEOS exception: {}", e.what());
                 return -1;  // Error case
             } catch (...) {
-                std::cout << "Unknown error in temporal geometry contains" << std::endl;
+                counters.recordError();
                 return -1;  // Error case
             }
-        }, lon1,lat1,ts1,lon2,lat2,ts2
+        }, lon1,lat1,ts1,lon2,lat2,ts2, nautilus::val<MEOS::Meos::EpochConverter*>(epochConverter.get())
     );
 
     return VarVal(res);
@@ -107,58 +160,52 @@ TemporalEContainsGeometryPhysicalFunction::execTemporalStatic(const std::vector<
     auto lat  = p[1].cast<nautilus::val<double>>();
     auto ts   = p[2].cast<nautilus::val<uint64_t>>();
     auto stat = p[3].cast<VariableSizedData>();
-    std::cout << "4-param temporal-static contains function with coordinate values" << std::endl;
-
+    if (constantGeofences) {
+        return execConstantGeofences(p[0], p[1], p[2], false);
+    }
 
     const auto res = nautilus::invoke(
-        +[](double lo,double la,uint64_t t, const char* g, uint32_t sz) -> int {
+        +[](double lo,double la,uint64_t t, const char* g, uint32_t sz, MEOS::Meos::EpochConverter* converter) -> int {
+            static auto& counters = FunctionStatistics::getCounters("TemporalEContains");
+            const bool sampled = counters.recordCall();
             try {
                 MEOS::Meos::ensureMeosInitialized();
                 if (!(lo >= -180.0 && lo <= 180.0 && la >= -90.0 && la <= 90.0)) {
-                    std::cout << "TemporalEContains: coordinates out of range" << std::endl;
+                    counters.recordInvalidInput();
                     return 0;
                 }
-                std::string tsStr = MEOS::Meos::convertEpochToTimestamp(t);
-                std::string left  = fmt::format("SRID=4326;Point({} {})@{}", lo, la, tsStr);
-                std::string right(g, sz);
-                while (!right.empty() && (right.front() == '\'' || right.front() == '"')) {
-                    right = right.substr(1);
-                }
-                while (!right.empty() && (right.back() == '\'' || right.back() == '"')) {
-                    right = right.substr(0, right.size() - 1);
-                }
-                std::cout << "Built geometries:" << std::endl;
-                std::cout << "Left (temporal): " << left << std::endl;
-                std::cout << "Right (static): " << right << std::endl;
+                const auto right = MEOS::Meos::stripQuotes(std::string_view(g, sz));
 
-                // Validate input strings are not empty
-                if (left.empty() || right.empty()) {
-                    std::cout << "Empty geometry WKT string(s)" << std::endl;
+                // Validate input string is not empty
+                if (right.empty()) {
+                    counters.recordInvalidInput();
                     return -1;
                 }
-                std::cout << "Using temporal-static contains function (econtains_tgeo_geo)" << std::endl;
 
-                MEOS::Meos::TemporalGeometry  l(left);
+                MEOS::Meos::TemporalGeometry  l(lo, la, t, *converter);
                 if (!l.getGeometry()) {
-                    std::cout << "TemporalEContains: MEOS temporal geometry is null" << std::endl;
+                    counters.recordInvalidInput();
                     return 0;
                 }
                 MEOS::Meos::StaticGeometry    r(right);
                 if (!r.getGeometry()) {
-                    std::cout << "TemporalEContains: MEOS static geometry is null" << std::endl;
+                    counters.recordInvalidInput();
                     return 0;
                 }
                 int contains_result = l.containsStatic(r);
-                std::cout << "econtains_tgeo_geo result: " << contains_result << std::endl;
+                if (sampled) {
+                    NES_DEBUG("TemporalEContains: econtains_tgeo_geo returned {}", contains_result);
+                }
                 return contains_result;
             } catch (const std::exception& e) {
-                std::cout << "MEOS exception in temporal geometry contains: " << e.what() << std::endl;
+                counters.recordError();
+                NES_DEBUG("TemporalEContains: MEOS exception: {}", e.what());
                 return -1;  // Error case
             } catch (...) {
-                std::cout << "Unknown error in temporal geometry contains" << std::endl;
+                counters.recordError();
                 return -1;  // Error case
             }
-    }, lon,lat,ts, stat.getContent(), stat.getContentSize());
+    }, lon,lat,ts, stat.getContent(), stat.getContentSize(), nautilus::val<MEOS::Meos::EpochConverter*>(epochConverter.get()));
 
     return VarVal(res);
 }
@@ -170,58 +217,52 @@ TemporalEContainsGeometryPhysicalFunction::execStaticTemporal(const std::vector<
     auto lon  = p[1].cast<nautilus::val<double>>();
     auto lat  = p[2].cast<nautilus::val<double>>();
     auto ts   = p[3].cast<nautilus::val<uint64_t>>();
-    std::cout << "4-param static-temporal contains function with coordinate values" << std::endl;
-
+    if (constantGeofences) {
+        return execConstantGeofences(p[1], p[2], p[3], true);
+    }
 
     const auto res = nautilus::invoke(
-        +[](const char* g,uint32_t sz, double lo,double la,uint64_t t) -> int {
+        +[](const char* g,uint32_t sz, double lo,double la,uint64_t t, MEOS::Meos::EpochConverter* converter) -> int {
+            static auto& counters = FunctionStatistics::getCounters("TemporalEContains");
+            const bool sampled = counters.recordCall();
             try {
                 MEOS::Meos::ensureMeosInitialized();
                 if (!(lo >= -180.0 && lo <= 180.0 && la >= -90.0 && la <= 90.0)) {
-                    std::cout << "TemporalEContains: coordinates out of range" << std::endl;
+                    counters.recordInvalidInput();
                     return 0;
                 }
-                std::string tsStr = MEOS::Meos::convertEpochToTimestamp(t);
-                std::string right  = fmt::format("SRID=4326;Point({} {})@{}", lo, la, tsStr);
-                std::string left(g, sz);
-                while (!left.empty() && (left.front() == '\'' || left.front() == '"')) {
-                    left = left.substr(1);
-                }
-                while (!left.empty() && (left.back() == '\'' || left.back() == '"')) {
-                    left = left.substr(0, left.size() - 1);
-                }
-                std::cout << "Built geometries:" << std::endl;
-                std::cout << "Left (static): " << left << std::endl;
-                std::cout << "Right (temporal): " << right << std::endl;
+                const auto left = MEOS::Meos::stripQuotes(std::string_view(g, sz));
 
-                // Validate input strings are not empty
-                if (left.empty() || right.empty()) {
-                    std::cout << "Empty geometry WKT string(s)" << std::endl;
+                // Validate input string is not empty
+                if (left.empty()) {
+                    counters.recordInvalidInput();
                     return -1;
                 }
-                std::cout << "Using static-temporal contains function (econtains_geo_tgeo)" << std::endl;
 
                 MEOS::Meos::StaticGeometry l(left);
                 if (!l.getGeometry()) {
-                    std::cout << "TemporalEContains: MEOS static geometry is null" << std::endl;
+                    counters.recordInvalidInput();
                     return 0;
                 }
-                MEOS::Meos::TemporalGeometry r(right);
+                MEOS::Meos::TemporalGeometry r(lo, la, t, *converter);
                 if (!r.getGeometry()) {
-                    std::cout << "TemporalEContains: MEOS temporal geometry is null" << std::endl;
+                    counters.recordInvalidInput();
                     return 0;
                 }
                 int contains_result = l.containsTemporal(r);
-                std::cout << "econtains_geo_tgeo result: " << contains_result << std::endl;
+                if (sampled) {
+                    NES_DEBUG("TemporalEContains: econtains_geo_tgeo returned {}", contains_result);
+                }
                 return contains_result;
             } catch (const std::exception& e) {
-                std::cout << "MEOS exception in temporal geometry contains: " << e.what() << std::endl;
+                counters.recordError();
+                NES_DEBUG("TemporalEContains: MEOS exception: {}", e.what());
                 return -1;  // Error case
             } catch (...) {
-                std::cout << "Unknown error in temporal geometry contains" << std::endl;
+                counters.recordError();
                 return -1;  // Error case
             }
-    }, stat.getContent(), stat.getContentSize(), lon,lat,ts);
+    }, stat.getContent(), stat.getContentSize(), lon,lat,ts, nautilus::val<MEOS::Meos::EpochConverter*>(epochConverter.get()));
 
     return VarVal(res);
 }
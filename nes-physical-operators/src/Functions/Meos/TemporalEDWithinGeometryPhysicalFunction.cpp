@@ -1,18 +1,22 @@
 #include <Functions/Meos/TemporalEDWithinGeometryPhysicalFunction.hpp>
 
+#include <Functions/ConstantValueVariableSizePhysicalFunction.hpp>
 #include <Functions/PhysicalFunction.hpp>
 #include <MEOSWrapper.hpp>
 #include <Nautilus/DataTypes/VarVal.hpp>
 #include <Nautilus/DataTypes/VariableSizedData.hpp>
 #include <Nautilus/Interface/Record.hpp>
+#include <Util/FunctionStatistics.hpp>
+#include <Util/Logger/Logger.hpp>
 #include <PhysicalFunctionRegistry.hpp>
 #include <ErrorHandling.hpp>
 #include <ExecutionContext.hpp>
-#include <fmt/format.h>
 #include <function.hpp>
-#include <iostream>
+#include <memory>
 #include <string>
+#include <string_view>
 #include <utility>
+#include <vector>
 #include <val.hpp>
 
 namespace NES {
@@ -29,6 +33,37 @@ TemporalEDWithinGeometryPhysicalFunction::TemporalEDWithinGeometryPhysicalFuncti
     parameterFunctions.push_back(std::move(timestampFunction));
     parameterFunctions.push_back(std::move(geometryFunction));
     parameterFunctions.push_back(std::move(distanceFunction));
+
+    // Parse a constant static geometry once, instead of for every record
+    if (const auto constantGeometry = parameterFunctions[3].tryGet<ConstantValueVariableSizePhysicalFunction>())
+    {
+        const auto wkt = MEOS::Meos::stripQuotes(constantGeometry->getValue());
+        if (!wkt.empty())
+        {
+            auto staticGeometry = std::make_shared<const MEOS::Meos::StaticGeometry>(wkt);
+            if (staticGeometry->getGeometry())
+            {
+                constantBoundingBox = staticGeometry->getBoundingBox();
+                constantStaticGeometry = std::move(staticGeometry);
+            }
+        }
+    }
+}
+
+TemporalEDWithinGeometryPhysicalFunction::TemporalEDWithinGeometryPhysicalFunction(PhysicalFunction lon1Function,
+                                                                                   PhysicalFunction lat1Function,
+                                                                                   PhysicalFunction timestamp1Function,
+                                                                                   PhysicalFunction lon2Function,
+                                                                                   PhysicalFunction lat2Function,
+                                                                                   PhysicalFunction distanceFunction)
+{
+    parameterFunctions.reserve(6);
+    parameterFunctions.push_back(std::move(lon1Function));
+    parameterFunctions.push_back(std::move(lat1Function));
+    parameterFunctions.push_back(std::move(timestamp1Function));
+    parameterFunctions.push_back(std::move(lon2Function));
+    parameterFunctions.push_back(std::move(lat2Function));
+    parameterFunctions.push_back(std::move(distanceFunction));
 }
 
 VarVal TemporalEDWithinGeometryPhysicalFunction::execute(const Record& record, ArenaRef& arena) const
@@ -40,61 +75,187 @@ VarVal TemporalEDWithinGeometryPhysicalFunction::execute(const Record& record, A
         parameterValues.emplace_back(function.execute(record, arena));
     }
 
+    if (parameterValues.size() == 6)
+    {
+        return executePointToPoint(parameterValues);
+    }
+
     auto lon = parameterValues[0].cast<nautilus::val<double>>();
     auto lat = parameterValues[1].cast<nautilus::val<double>>();
     auto timestamp = parameterValues[2].cast<nautilus::val<uint64_t>>();
     auto geometry = parameterValues[3].cast<VariableSizedData>();
     auto distance = parameterValues[4].cast<nautilus::val<double>>();
 
+    if (constantStaticGeometry)
+    {
+        // Rejects points outside the bounding box of the static geometry expanded by the distance in compiled code,
+        // without calling into MEOS. The distance of the planar edwithin is in the units of the coordinates.
+        nautilus::val<bool> mayBeWithin = true;
+        if (constantBoundingBox)
+        {
+            mayBeWithin = lon >= constantBoundingBox->xmin - distance && lon <= constantBoundingBox->xmax + distance
+                && lat >= constantBoundingBox->ymin - distance && lat <= constantBoundingBox->ymax + distance;
+        }
+        nautilus::val<int> result = 0;
+        if (mayBeWithin)
+        {
+            result = nautilus::invoke(
+                +[](double lonValue, double latValue, uint64_t timestampValue, const MEOS::Meos::StaticGeometry* staticGeometry,
+                    double distanceValue, MEOS::Meos::EpochConverter* converter)
+                    -> int
+                {
+                    static auto& counters = FunctionStatistics::getCounters("TemporalEDWithin");
+                    counters.recordCall();
+                    try
+                    {
+                        MEOS::Meos::ensureMeosInitialized();
+                        if (!(lonValue >= -180.0 && lonValue <= 180.0 && latValue >= -90.0 && latValue <= 90.0))
+                        {
+                            counters.recordInvalidInput();
+                            return 0;
+                        }
+                        MEOS::Meos::TemporalGeometry temporalGeometry(lonValue, latValue, timestampValue, *converter);
+                        if (!temporalGeometry.getGeometry())
+                        {
+                            counters.recordInvalidInput();
+                            return 0;
+                        }
+                        return MEOS::Meos::safe_edwithin_tgeo_geo(
+                            static_cast<const Temporal*>(temporalGeometry.getGeometry()), staticGeometry->getGeometry(), distanceValue);
+                    }
+                    catch (...)
+                    {
+                        counters.recordError();
+                        return -1;
+                    }
+                },
+                lon,
+                lat,
+                timestamp,
+                nautilus::val<const MEOS::Meos::StaticGeometry*>(constantStaticGeometry.get()),
+                distance, nautilus::val<MEOS::Meos::EpochConverter*>(epochConverter.get()));
+        }
+        return VarVal(result);
+    }
+
     const auto result = nautilus::invoke(
         +[](double lonValue,
             double latValue,
             uint64_t timestampValue,
             const char* geometryPtr,
             uint32_t geometrySize,
-            double distanceValue) -> int {
+            double distanceValue, MEOS::Meos::EpochConverter* converter) -> int {
+            static auto& counters = FunctionStatistics::getCounters("TemporalEDWithin");
+            counters.recordCall();
             try
             {
                 MEOS::Meos::ensureMeosInitialized();
                 if (!(lonValue >= -180.0 && lonValue <= 180.0 && latValue >= -90.0 && latValue <= 90.0)) {
-                    std::cout << "TemporalEDWithin: coordinates out of range" << std::endl;
+                    counters.recordInvalidInput();
                     return 0;
                 }
 
-                const std::string timestampString = MEOS::Meos::convertEpochToTimestamp(timestampValue);
-                std::string temporalGeometryWkt = fmt::format("SRID=4326;Point({} {})@{}", lonValue, latValue, timestampString);
-                std::string staticGeometryWkt(geometryPtr, geometrySize);
-
-                while (!staticGeometryWkt.empty() && (staticGeometryWkt.front() == '\'' || staticGeometryWkt.front() == '"'))
-                    staticGeometryWkt.erase(staticGeometryWkt.begin());
-                while (!staticGeometryWkt.empty() && (staticGeometryWkt.back() == '\'' || staticGeometryWkt.back() == '"'))
-                    staticGeometryWkt.pop_back();
+                const auto staticGeometryWkt = MEOS::Meos::stripQuotes(std::string_view(geometryPtr, geometrySize));
 
-                if (temporalGeometryWkt.empty() || staticGeometryWkt.empty())
+                if (staticGeometryWkt.empty()) {
+                    counters.recordInvalidInput();
                     return 0;
+                }
 
-                MEOS::Meos::TemporalGeometry temporalGeometry(temporalGeometryWkt);
-                if (!temporalGeometry.getGeometry()) return 0;
+                MEOS::Meos::TemporalGeometry temporalGeometry(lonValue, latValue, timestampValue, *converter);
                 MEOS::Meos::StaticGeometry staticGeometry(staticGeometryWkt);
-                if (!staticGeometry.getGeometry()) return 0;
+                if (!temporalGeometry.getGeometry() || !staticGeometry.getGeometry()) {
+                    counters.recordInvalidInput();
+                    return 0;
+                }
 
                 return MEOS::Meos::safe_edwithin_tgeo_geo(static_cast<const Temporal*>(temporalGeometry.getGeometry()),
                                                          static_cast<const GSERIALIZED*>(staticGeometry.getGeometry()),
                                                          distanceValue);
             }
-            catch (...) { return -1; }
+            catch (...)
+            {
+                counters.recordError();
+                return -1;
+            }
         },
-        lon, lat, timestamp, geometry.getContent(), geometry.getContentSize(), distance);
+        lon, lat, timestamp, geometry.getContent(), geometry.getContentSize(), distance,
+        nautilus::val<MEOS::Meos::EpochConverter*>(epochConverter.get()));
 
     return VarVal(result);
 }
 
+VarVal TemporalEDWithinGeometryPhysicalFunction::executePointToPoint(const std::vector<VarVal>& parameterValues) const
+{
+    auto lon1 = parameterValues[0].cast<nautilus::val<double>>();
+    auto lat1 = parameterValues[1].cast<nautilus::val<double>>();
+    auto timestamp1 = parameterValues[2].cast<nautilus::val<uint64_t>>();
+    auto lon2 = parameterValues[3].cast<nautilus::val<double>>();
+    auto lat2 = parameterValues[4].cast<nautilus::val<double>>();
+    auto distance = parameterValues[5].cast<nautilus::val<double>>();
+
+    // Points whose coordinates differ by more than the distance in either dimension can not be within the distance.
+    // We reject them in compiled code, without calling into MEOS.
+    const nautilus::val<bool> mayBeWithin
+        = lon1 - lon2 <= distance && lon2 - lon1 <= distance && lat1 - lat2 <= distance && lat2 - lat1 <= distance;
+    nautilus::val<int> result = 0;
+    if (mayBeWithin)
+    {
+        result = nautilus::invoke(
+            +[](double lon1Value, double lat1Value, uint64_t timestamp1Value, double lon2Value, double lat2Value, double distanceValue,
+                MEOS::Meos::EpochConverter* converter) -> int
+            {
+                static auto& counters = FunctionStatistics::getCounters("TemporalEDWithin");
+                counters.recordCall();
+                try
+                {
+                    MEOS::Meos::ensureMeosInitialized();
+                    auto inRange = [](double lon, double lat) { return lon >= -180.0 && lon <= 180.0 && lat >= -90.0 && lat <= 90.0; };
+                    if (!inRange(lon1Value, lat1Value) || !inRange(lon2Value, lat2Value))
+                    {
+                        counters.recordInvalidInput();
+                        return 0;
+                    }
+                    MEOS::Meos::TemporalGeometry temporalGeometry(lon1Value, lat1Value, timestamp1Value, *converter);
+                    if (!temporalGeometry.getGeometry())
+                    {
+                        counters.recordInvalidInput();
+                        return 0;
+                    }
+                    return MEOS::Meos::safe_edwithin_tgeo_point(
+                        static_cast<const Temporal*>(temporalGeometry.getGeometry()), lon2Value, lat2Value, distanceValue);
+                }
+                catch (...)
+                {
+                    counters.recordError();
+                    return -1;
+                }
+            },
+            lon1,
+            lat1,
+            timestamp1,
+            lon2,
+            lat2,
+            distance, nautilus::val<MEOS::Meos::EpochConverter*>(epochConverter.get()));
+    }
+    return VarVal(result);
+}
+
 PhysicalFunctionRegistryReturnType
 PhysicalFunctionGeneratedRegistrar::RegisterTemporalEDWithinGeometryPhysicalFunction(PhysicalFunctionRegistryArguments arguments)
 {
-    PRECONDITION(arguments.childFunctions.size() == 5,
-                 "TemporalEDWithinGeometryPhysicalFunction requires 5 child functions, but got {}",
+    PRECONDITION(arguments.childFunctions.size() == 5 || arguments.childFunctions.size() == 6,
+                 "TemporalEDWithinGeometryPhysicalFunction requires 5 or 6 child functions, but got {}",
                  arguments.childFunctions.size());
+    if (arguments.childFunctions.size() == 6)
+    {
+        return TemporalEDWithinGeometryPhysicalFunction(arguments.childFunctions[0],
+                                                        arguments.childFunctions[1],
+                                                        arguments.childFunctions[2],
+                                                        arguments.childFunctions[3],
+                                                        arguments.childFunctions[4],
+                                                        arguments.childFunctions[5]);
+    }
     return TemporalEDWithinGeometryPhysicalFunction(arguments.childFunctions[0],
                                                     arguments.childFunctions[1],
                                                     arguments.childFunctions[2],
@@ -1,18 +1,21 @@
 #include <utility>
 #include <vector>
 #include <string>
+#include <string_view>
 #include <cstring>
+#include <memory>
+#include <Functions/ConstantValueVariableSizePhysicalFunction.hpp>
 #include <Functions/Meos/TemporalIntersectsGeometryPhysicalFunction.hpp>
 #include <Functions/PhysicalFunction.hpp>
 #include <Nautilus/DataTypes/VarVal.hpp>
 #include <Nautilus/DataTypes/VariableSizedData.hpp>
 #include <Nautilus/Interface/Record.hpp>
+#include <Util/FunctionStatistics.hpp>
+#include <Util/Logger/Logger.hpp>
 #include <ErrorHandling.hpp>
 #include <ExecutionContext.hpp>
 #include <PhysicalFunctionRegistry.hpp>
 #include <MEOSWrapper.hpp>
-#include <fmt/format.h>
-#include <iostream>
 #include <val.hpp>
 #include <function.hpp>
 
@@ -27,6 +30,18 @@ TemporalIntersectsGeometryPhysicalFunction::TemporalIntersectsGeometryPhysicalFu
     parameterFunctions.push_back(std::move(lat1Function));
     parameterFunctions.push_back(std::move(timestamp1Function));
     parameterFunctions.push_back(std::move(staticGeometryFunction));
+
+    // Parse a constant static geometry (e.g., a polygon in the query text) once, instead of for every record
+    if (const auto constantGeometry = parameterFunctions[3].tryGet<ConstantValueVariableSizePhysicalFunction>()) {
+        const auto wkt = MEOS::Meos::stripQuotes(constantGeometry->getValue());
+        if (!wkt.empty()) {
+            auto staticGeometry = std::make_shared<const MEOS::Meos::StaticGeometry>(wkt);
+            if (staticGeometry->getGeometry()) {
+                constantBoundingBox = staticGeometry->getBoundingBox();
+                constantStaticGeometry = std::move(staticGeometry);
+            }
+        }
+    }
 }
 
 // Constructor with 6 parameters for temporal-temporal intersection
@@ -44,8 +59,6 @@ TemporalIntersectsGeometryPhysicalFunction::TemporalIntersectsGeometryPhysicalFu
 
 VarVal TemporalIntersectsGeometryPhysicalFunction::execute(const Record& record, ArenaRef& arena) const
 {
-    std::cout << "TemporalIntersectsGeometryPhysicalFunction::execute called with " << parameterFunctions.size() << " arguments" << std::endl;
-    
     // Execute all parameter functions to get their values
     std::vector<VarVal> parameterValues;
     parameterValues.reserve(parameterFunctions.size());
@@ -72,58 +85,45 @@ VarVal TemporalIntersectsGeometryPhysicalFunction::executeTemporal6Param(const s
     auto lat2 = params[4].cast<nautilus::val<double>>();
     auto timestamp2 = params[5].cast<nautilus::val<uint64_t>>();
     
-    std::cout << "6-param temporal-temporal intersection with coordinate values" << std::endl;
-    
     // Use nautilus::invoke to call external MEOS function with coordinate parameters
     const auto result = nautilus::invoke(
-        +[](double lon1_val, double lat1_val, uint64_t ts1_val, double lon2_val, double lat2_val, uint64_t ts2_val) -> int {
+        +[](double lon1_val, double lat1_val, uint64_t ts1_val, double lon2_val, double lat2_val, uint64_t ts2_val,
+            MEOS::Meos::EpochConverter* converter) -> int {
+            static auto& counters = FunctionStatistics::getCounters("TemporalIntersectsGeometry");
+            const bool sampled = counters.recordCall();
             try {
                 // Use the existing global MEOS initialization mechanism
                 MEOS::Meos::ensureMeosInitialized();
                 // Basic lon/lat sanity check to prevent bogus inputs
                 auto inRange = [](double lo, double la){ return lo >= -180.0 && lo <= 180.0 && la >= -90.0 && la <= 90.0; };
                 if (!inRange(lon1_val, lat1_val) || !inRange(lon2_val, lat2_val)) {
-                    std::cout << "TemporalIntersects: coordinates out of range" << std::endl;
+                    counters.recordInvalidInput();
                     return 0;
                 }
                 
-                // Convert timestamps in seconds/ms/us/ns to MEOS timestamp strings
-                std::string timestamp1_str = MEOS::Meos::convertEpochToTimestamp(ts1_val);
-                std::string timestamp2_str = MEOS::Meos::convertEpochToTimestamp(ts2_val);
-                
-                // Build temporal geometry WKT strings from coordinates and timestamps
-                std::string left_geometry_wkt = fmt::format("SRID=4326;Point({} {})@{}", lon1_val, lat1_val, timestamp1_str);
-                std::string right_geometry_wkt = fmt::format("SRID=4326;Point({} {})@{}", lon2_val, lat2_val, timestamp2_str);
-                
-                std::cout << "Built temporal geometries:" << std::endl;
-                std::cout << "Left: " << left_geometry_wkt << std::endl;
-                std::cout << "Right: " << right_geometry_wkt << std::endl;
-                
-                // Both geometries are temporal points, use temporal-temporal intersection
-                std::cout << "Using temporal-temporal intersection (eintersects_tgeo_tgeo)" << std::endl;
-                MEOS::Meos::TemporalGeometry left_temporal(left_geometry_wkt);
-                if (!left_temporal.getGeometry()) {
-                    std::cout << "TemporalIntersects: left temporal geometry is null" << std::endl;
-                    return 0;
-                }
-                MEOS::Meos::TemporalGeometry right_temporal(right_geometry_wkt);
-                if (!right_temporal.getGeometry()) {
-                    std::cout << "TemporalIntersects: right temporal geometry is null" << std::endl;
+                // Build temporal points directly from coordinates and timestamps
+                MEOS::Meos::TemporalGeometry left_temporal(lon1_val, lat1_val, ts1_val, *converter);
+                MEOS::Meos::TemporalGeometry right_temporal(lon2_val, lat2_val, ts2_val, *converter);
+                if (!left_temporal.getGeometry() || !right_temporal.getGeometry()) {
+                    counters.recordInvalidInput();
                     return 0;
                 }
                 int intersection_result = left_temporal.intersects(right_temporal);
-                std::cout << "eintersects_tgeo_tgeo result: " << intersection_result << std::endl;
-                
+                if (sampled) {
+                    NES_DEBUG("TemporalIntersectsGeometry: eintersects_tgeo_tgeo returned {} for ({}, {}, {}) and ({}, {}, {})",
+                              intersection_result, lon1_val, lat1_val, ts1_val, lon2_val, lat2_val, ts2_val);
+                }
                 return intersection_result;
             } catch (const std::exception& e) {
-                std::cout << "MEOS exception in temporal geometry intersection: " << e.what() << std::endl;
+                counters.recordError();
+                NES_DEBUG("TemporalIntersectsGeometry: MEOS exception in temporal geometry intersection: {}", e.what());
                 return -1;  // Error case
             } catch (...) {
-                std::cout << "Unknown error in temporal geometry intersection" << std::endl;
+                counters.recordError();
                 return -1;  // Error case
             }
         },
-        lon1, lat1, timestamp1, lon2, lat2, timestamp2
+        lon1, lat1, timestamp1, lon2, lat2, timestamp2, nautilus::val<MEOS::Meos::EpochConverter*>(epochConverter.get())
     );
     
     return VarVal(result);
@@ -136,37 +136,79 @@ VarVal TemporalIntersectsGeometryPhysicalFunction::executeTemporal4Param(const s
     auto lat1 = params[1].cast<nautilus::val<double>>();
     auto timestamp1 = params[2].cast<nautilus::val<uint64_t>>();
     auto static_geometry_varsized = params[3].cast<VariableSizedData>();
-    
-    std::cout << "4-param temporal-static intersection with coordinate values" << std::endl;
-    
+
+    if (constantStaticGeometry) {
+        // Rejects points outside the bounding box of the static geometry in compiled code, without calling into MEOS
+        nautilus::val<bool> mayIntersect = true;
+        if (constantBoundingBox) {
+            mayIntersect = lon1 >= constantBoundingBox->xmin && lon1 <= constantBoundingBox->xmax && lat1 >= constantBoundingBox->ymin
+                && lat1 <= constantBoundingBox->ymax;
+        }
+        nautilus::val<int> result = 0;
+        if (mayIntersect) {
+            // The static geometry was parsed when creating the function, thus we only build the temporal point per record
+            result = nautilus::invoke(
+                +[](double lon1_val, double lat1_val, uint64_t ts1_val, const MEOS::Meos::StaticGeometry* static_geom,
+                    MEOS::Meos::EpochConverter* converter) -> int {
+                    static auto& counters = FunctionStatistics::getCounters("TemporalIntersectsGeometry");
+                    counters.recordCall();
+                    try {
+                        MEOS::Meos::ensureMeosInitialized();
+                        if (!(lon1_val >= -180.0 && lon1_val <= 180.0 && lat1_val >= -90.0 && lat1_val <= 90.0)) {
+                            counters.recordInvalidInput();
+                            return 0;
+                        }
+                        MEOS::Meos::TemporalGeometry left(lon1_val, lat1_val, ts1_val, *converter);
+                        if (!left.getGeometry()) {
+                            counters.recordInvalidInput();
+                            return 0;
+                        }
+                        return MEOS::Meos::safe_eintersects_tgeo_geo(static_cast<const Temporal*>(left.getGeometry()), static_geom->getGeometry());
+                    } catch (...) {
+                        counters.recordError();
+                        return -1;
+                    }
+                },
+                lon1, lat1, timestamp1, nautilus::val<const MEOS::Meos::StaticGeometry*>(constantStaticGeometry.get()),
+                nautilus::val<MEOS::Meos::EpochConverter*>(epochConverter.get()));
+        }
+        return VarVal(result);
+    }
+
     // Call MEOS: eintersects_tgeo_geo(temporal, static)
     const auto result = nautilus::invoke(
-        +[](double lon1_val, double lat1_val, uint64_t ts1_val, const char* static_geom_ptr, uint32_t static_geom_size) -> int {
+        +[](double lon1_val, double lat1_val, uint64_t ts1_val, const char* static_geom_ptr, uint32_t static_geom_size,
+            MEOS::Meos::EpochConverter* converter) -> int {
+            static auto& counters = FunctionStatistics::getCounters("TemporalIntersectsGeometry");
+            counters.recordCall();
             try {
                 MEOS::Meos::ensureMeosInitialized();
                 if (!(lon1_val >= -180.0 && lon1_val <= 180.0 && lat1_val >= -90.0 && lat1_val <= 90.0)) {
-                    std::cout << "TemporalIntersects: coordinates out of range" << std::endl;
+                    counters.recordInvalidInput();
                     return 0;
                 }
 
-                // Build temporal point
-                std::string ts_str = MEOS::Meos::convertEpochToTimestamp(ts1_val);
-                std::string left_wkt = fmt::format("SRID=4326;Point({} {})@{}", lon1_val, lat1_val, ts_str);
-
                 // Parse static WKT
-                std::string right_wkt(static_geom_ptr, static_geom_size);
-                while (!right_wkt.empty() && (right_wkt.front()=='\'' || right_wkt.front()=='"')) right_wkt.erase(right_wkt.begin());
-                while (!right_wkt.empty() && (right_wkt.back()=='\'' || right_wkt.back()=='"')) right_wkt.pop_back();
-                if (left_wkt.empty() || right_wkt.empty()) return 0;
+                const auto right_wkt = MEOS::Meos::stripQuotes(std::string_view(static_geom_ptr, static_geom_size));
+                if (right_wkt.empty()) {
+                    counters.recordInvalidInput();
+                    return 0;
+                }
 
-                MEOS::Meos::TemporalGeometry left(left_wkt);
-                if (!left.getGeometry()) return 0;
+                MEOS::Meos::TemporalGeometry left(lon1_val, lat1_val, ts1_val, *converter);
                 MEOS::Meos::StaticGeometry right(right_wkt);
-                if (!right.getGeometry()) return 0;
+                if (!left.getGeometry() || !right.getGeometry()) {
+                    counters.recordInvalidInput();
+                    return 0;
+                }
                 return MEOS::Meos::safe_eintersects_tgeo_geo(static_cast<const Temporal*>(left.getGeometry()), static_cast<const GSERIALIZED*>(right.getGeometry()));
-            } catch (...) { return -1; }
+            } catch (...) {
+                counters.recordError();
+                return -1;
+            }
         },
-        lon1, lat1, timestamp1, static_geometry_varsized.getContent(), static_geometry_varsized.getContentSize());
+        lon1, lat1, timestamp1, static_geometry_varsized.getContent(), static_geometry_varsized.getContentSize(),
+        nautilus::val<MEOS::Meos::EpochConverter*>(epochConverter.get()));
     
     return VarVal(result);
 }
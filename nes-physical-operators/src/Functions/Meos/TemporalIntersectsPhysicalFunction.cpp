@@ -18,12 +18,13 @@
 #include <Functions/PhysicalFunction.hpp>
 #include <Nautilus/DataTypes/VarVal.hpp>
 #include <Nautilus/Interface/Record.hpp>
+#include <Util/FunctionStatistics.hpp>
+#include <Util/Logger/Logger.hpp>
 #include <ErrorHandling.hpp>
 #include <ExecutionContext.hpp>
 #include <PhysicalFunctionRegistry.hpp>
 #include <MEOSWrapper.hpp>
 #include <fmt/format.h>
-#include <iostream>
 #include <val.hpp>
 #include <function.hpp>
 
@@ -36,34 +37,31 @@ VarVal TemporalIntersectsPhysicalFunction::execute(const Record& record, ArenaRe
     const auto latValue = rightPhysicalFunction.execute(record, arena);
     const auto tsValue = tsPhysicalFunction.execute(record, arena);
     
-    std::cout << "TemporalIntersectsPhysicalFunction::execute called" << std::endl;
-    
     // Extract nautilus::val<double> values from VarVal 
     auto lon_val = lonValue.cast<nautilus::val<double>>();
     auto lat_val = latValue.cast<nautilus::val<double>>();
     auto ts_val = tsValue.cast<nautilus::val<double>>();
     
-    std::cout << "TemporalIntersectsPhysicalFunction processing values" << std::endl;
-    
     // Use nautilus::invoke to call external MEOS function with raw values
     const auto result = nautilus::invoke(
         +[](double lon, double lat, double ts) -> bool {
+            static auto& counters = FunctionStatistics::getCounters("TemporalIntersects");
+            const bool sampled = counters.recordCall();
             try {
-                // Ensure MEOS is initialized but don't create a Meos object that will finalize it
-                static MEOS::Meos* meos_instance = nullptr;
-                if (!meos_instance) {
-                    meos_instance = new MEOS::Meos();
-                }
+                // Initializes MEOS for the calling worker thread
+                MEOS::Meos::ensureMeosInitialized();
                 
                 MEOS::Meos::TemporalInstant temporal1(lon, lat,static_cast<long long>(ts));    
                 MEOS::Meos::TemporalInstant temporal2(-73.9857, 40.7484,static_cast<long long>(ts));    
 
                 bool intersection_result = temporal1.intersects(temporal2);
-                std::cout << "MEOS intersection result: " << intersection_result << std::endl;
+                if (sampled) {
+                    NES_DEBUG("TemporalIntersects: MEOS intersection returned {}", intersection_result);
+                }
 
                 return intersection_result;
             } catch (...) {
-                std::cout << "MEOS error in spatial intersection" << std::endl;
+                counters.recordError();
                 return false;
             }
         },
@@ -0,0 +1,181 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Functions/QueryParameters.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <DataTypes/DataType.hpp>
+#include <Util/Strings.hpp>
+#include <magic_enum/magic_enum.hpp>
+#include <ErrorHandling.hpp>
+
+namespace NES
+{
+
+namespace
+{
+template <typename T>
+std::optional<uint64_t> parseBytes(const std::string_view value)
+{
+    const auto parsed = NES::Util::from_chars<T>(value);
+    if (not parsed)
+    {
+        return std::nullopt;
+    }
+    uint64_t bytes = 0;
+    std::memcpy(&bytes, &*parsed, sizeof(T));
+    return bytes;
+}
+
+std::optional<uint64_t> parseBytes(const DataType::Type type, const std::string_view value)
+{
+    switch (type)
+    {
+        case DataType::Type::UINT8:
+            return parseBytes<uint8_t>(value);
+        case DataType::Type::UINT16:
+            return parseBytes<uint16_t>(value);
+        case DataType::Type::UINT32:
+            return parseBytes<uint32_t>(value);
+        case DataType::Type::UINT64:
+            return parseBytes<uint64_t>(value);
+        case DataType::Type::INT8:
+            return parseBytes<int8_t>(value);
+        case DataType::Type::INT16:
+            return parseBytes<int16_t>(value);
+        case DataType::Type::INT32:
+            return parseBytes<int32_t>(value);
+        case DataType::Type::INT64:
+            return parseBytes<int64_t>(value);
+        case DataType::Type::FLOAT32:
+            return parseBytes<float>(value);
+        case DataType::Type::FLOAT64:
+            return parseBytes<double>(value);
+        case DataType::Type::BOOLEAN:
+            return parseBytes<bool>(value);
+        case DataType::Type::CHAR:
+            return parseBytes<char>(value);
+        case DataType::Type::VARSIZED:
+        case DataType::Type::VARSIZED_POINTER_REP:
+        case DataType::Type::UNDEFINED:
+            return std::nullopt;
+    }
+    std::unreachable();
+}
+
+thread_local QueryParameters* currentParameters = nullptr;
+}
+
+QueryParameter::QueryParameter(std::string name, const DataType::Type type, const std::string_view value)
+    : name(std::move(name)), type(type), value(parse(value))
+{
+}
+
+const std::string& QueryParameter::getName() const
+{
+    return name;
+}
+
+DataType::Type QueryParameter::getType() const
+{
+    return type;
+}
+
+uint64_t QueryParameter::parse(const std::string_view value) const
+{
+    if (auto bytes = parseBytes(type, value))
+    {
+        return *bytes;
+    }
+    throw InvalidQueryParameter(
+        "Cannot parse \"{}\" as the {} value of the query parameter {}", value, magic_enum::enum_name(type), name);
+}
+
+void QueryParameter::store(const uint64_t bytes)
+{
+    value.store(bytes, std::memory_order_relaxed);
+}
+
+QueryParameters::Scope::Scope(QueryParameters& parameters) : previous(std::exchange(currentParameters, &parameters))
+{
+}
+
+QueryParameters::Scope::~Scope()
+{
+    currentParameters = previous;
+}
+
+QueryParameters* QueryParameters::current()
+{
+    return currentParameters;
+}
+
+std::shared_ptr<QueryParameter>
+QueryParameters::getOrCreate(const std::string& name, const DataType::Type type, const std::string_view defaultValue)
+{
+    const std::scoped_lock lock(mutex);
+    if (const auto parameter = parameters.find(name); parameter != parameters.end())
+    {
+        if (parameter->second->getType() != type)
+        {
+            throw InvalidQueryParameter(
+                "The query parameter {} is used as {} and as {}",
+                name,
+                magic_enum::enum_name(parameter->second->getType()),
+                magic_enum::enum_name(type));
+        }
+        return parameter->second;
+    }
+    auto parameter = std::make_shared<QueryParameter>(name, type, defaultValue);
+    parameters.emplace(name, parameter);
+    return parameter;
+}
+
+void QueryParameters::update(const std::unordered_map<std::string, std::string>& values)
+{
+    const std::scoped_lock lock(mutex);
+    /// Parsing all values before storing any of them rejects the update as a whole
+    std::vector<std::pair<QueryParameter*, uint64_t>> parsedValues;
+    parsedValues.reserve(values.size());
+    for (const auto& [name, value] : values)
+    {
+        const auto parameter = parameters.find(name);
+        if (parameter == parameters.end())
+        {
+            throw InvalidQueryParameter("The query has no parameter {}", name);
+        }
+        parsedValues.emplace_back(parameter->second.get(), parameter->second->parse(value));
+    }
+    for (const auto& [parameter, bytes] : parsedValues)
+    {
+        parameter->store(bytes);
+    }
+}
+
+bool QueryParameters::empty() const
+{
+    const std::scoped_lock lock(mutex);
+    return parameters.empty();
+}
+
+}
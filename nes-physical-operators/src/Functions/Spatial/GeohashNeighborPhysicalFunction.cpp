@@ -0,0 +1,77 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Functions/Spatial/GeohashNeighborPhysicalFunction.hpp>
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include <Functions/PhysicalFunction.hpp>
+#include <Functions/Spatial/GeohashPhysicalFunction.hpp>
+#include <Nautilus/DataTypes/VarVal.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <ErrorHandling.hpp>
+#include <ExecutionContext.hpp>
+#include <PhysicalFunctionRegistry.hpp>
+#include <val.hpp>
+
+namespace NES
+{
+
+GeohashNeighborPhysicalFunction::GeohashNeighborPhysicalFunction(
+    PhysicalFunction cellFunction,
+    PhysicalFunction precisionFunction,
+    PhysicalFunction lonOffsetFunction,
+    PhysicalFunction latOffsetFunction)
+    : parameterFunctions(
+          {std::move(cellFunction), std::move(precisionFunction), std::move(lonOffsetFunction), std::move(latOffsetFunction)})
+{
+}
+
+VarVal GeohashNeighborPhysicalFunction::execute(const Record& record, ArenaRef& arena) const
+{
+    const auto cell = parameterFunctions[0].execute(record, arena).cast<nautilus::val<uint64_t>>();
+    const auto precision = parameterFunctions[1].execute(record, arena).cast<nautilus::val<uint64_t>>();
+    const auto lonOffset = parameterFunctions[2].execute(record, arena).cast<nautilus::val<int64_t>>();
+    const auto latOffset = parameterFunctions[3].execute(record, arena).cast<nautilus::val<int64_t>>();
+
+    const auto [lonBits, latBits] = GeohashPhysicalFunction::getNumberOfBits(precision);
+    const auto [lonCell, latCell] = GeohashPhysicalFunction::deinterleave(cell, precision);
+
+    /// Adding the offset in two's complement and masking the bits wraps the longitude around the antimeridian
+    const auto lonMask = (nautilus::val<uint64_t>(1) << lonBits) - nautilus::val<uint64_t>(1);
+    const auto neighborLonCell = (lonCell + static_cast<nautilus::val<uint64_t>>(lonOffset)) & lonMask;
+
+    const auto maxLatCell = static_cast<nautilus::val<int64_t>>((nautilus::val<uint64_t>(1) << latBits) - nautilus::val<uint64_t>(1));
+    auto neighborLatCell = static_cast<nautilus::val<int64_t>>(latCell) + latOffset;
+    if (neighborLatCell < nautilus::val<int64_t>(0))
+    {
+        neighborLatCell = nautilus::val<int64_t>(0);
+    }
+    if (neighborLatCell > maxLatCell)
+    {
+        neighborLatCell = maxLatCell;
+    }
+    return VarVal(GeohashPhysicalFunction::interleave(neighborLonCell, static_cast<nautilus::val<uint64_t>>(neighborLatCell), precision));
+}
+
+PhysicalFunctionRegistryReturnType PhysicalFunctionGeneratedRegistrar::RegisterGeohashNeighborPhysicalFunction(
+    PhysicalFunctionRegistryArguments physicalFunctionRegistryArguments)
+{
+    const auto& children = physicalFunctionRegistryArguments.childFunctions;
+    PRECONDITION(children.size() == 4, "GeohashNeighbor function must have exactly four sub-functions");
+    return GeohashNeighborPhysicalFunction(children[0], children[1], children[2], children[3]);
+}
+
+}
@@ -0,0 +1,131 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Functions/Spatial/GeohashPhysicalFunction.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include <Functions/PhysicalFunction.hpp>
+#include <Nautilus/DataTypes/VarVal.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <ErrorHandling.hpp>
+#include <ExecutionContext.hpp>
+#include <PhysicalFunctionRegistry.hpp>
+#include <val.hpp>
+
+namespace NES
+{
+
+namespace
+{
+constexpr uint64_t BITS_PER_CHARACTER = 5;
+
+/// Masks of the steps that spread the lower 32 bits of a value to the even bits, c.f., "Bit Twiddling Hacks" on interleaving bits
+constexpr std::array<std::pair<uint64_t, uint64_t>, 5> SPREAD_STEPS{
+    {{16, 0x0000FFFF0000FFFF}, {8, 0x00FF00FF00FF00FF}, {4, 0x0F0F0F0F0F0F0F0F}, {2, 0x3333333333333333}, {1, 0x5555555555555555}}};
+constexpr uint64_t LOWER_HALF = 0x00000000FFFFFFFF;
+
+nautilus::val<uint64_t> spread(nautilus::val<uint64_t> value)
+{
+    value = value & nautilus::val<uint64_t>(LOWER_HALF);
+    for (const auto& [shift, mask] : SPREAD_STEPS)
+    {
+        value = (value | (value << nautilus::val<uint64_t>(shift))) & nautilus::val<uint64_t>(mask);
+    }
+    return value;
+}
+
+nautilus::val<uint64_t> compact(nautilus::val<uint64_t> value)
+{
+    value = value & nautilus::val<uint64_t>(SPREAD_STEPS.back().second);
+    for (size_t step = SPREAD_STEPS.size() - 1; step > 0; --step)
+    {
+        const auto shift = nautilus::val<uint64_t>(SPREAD_STEPS[step].first);
+        value = (value | (value >> shift)) & nautilus::val<uint64_t>(SPREAD_STEPS[step - 1].second);
+    }
+    return (value | (value >> nautilus::val<uint64_t>(SPREAD_STEPS.front().first))) & nautilus::val<uint64_t>(LOWER_HALF);
+}
+
+/// Maps the coordinate in [minimum, minimum + range] to its cell in [0, 2^bits - 1]
+nautilus::val<uint64_t>
+quantize(const nautilus::val<double>& coordinate, const double minimum, const double range, const nautilus::val<uint64_t>& bits)
+{
+    const auto numberOfCells = nautilus::val<uint64_t>(1) << bits;
+    auto scaled = (coordinate - minimum) * (static_cast<nautilus::val<double>>(numberOfCells) / range);
+    if (scaled < 0.0)
+    {
+        scaled = nautilus::val<double>(0.0);
+    }
+    auto cell = static_cast<nautilus::val<uint64_t>>(scaled);
+    if (cell >= numberOfCells)
+    {
+        cell = numberOfCells - nautilus::val<uint64_t>(1);
+    }
+    return cell;
+}
+}
+
+GeohashPhysicalFunction::GeohashPhysicalFunction(
+    PhysicalFunction lonFunction, PhysicalFunction latFunction, PhysicalFunction precisionFunction)
+    : parameterFunctions({std::move(lonFunction), std::move(latFunction), std::move(precisionFunction)})
+{
+}
+
+std::pair<nautilus::val<uint64_t>, nautilus::val<uint64_t>>
+GeohashPhysicalFunction::getNumberOfBits(const nautilus::val<uint64_t>& precision)
+{
+    const auto numberOfBits = precision * nautilus::val<uint64_t>(BITS_PER_CHARACTER);
+    return {(numberOfBits + nautilus::val<uint64_t>(1)) >> nautilus::val<uint64_t>(1), numberOfBits >> nautilus::val<uint64_t>(1)};
+}
+
+nautilus::val<uint64_t> GeohashPhysicalFunction::interleave(
+    const nautilus::val<uint64_t>& lonCell, const nautilus::val<uint64_t>& latCell, const nautilus::val<uint64_t>& precision)
+{
+    /// The most significant bit belongs to the longitude, thus the longitude occupies the odd bits of an even number of bits
+    const auto [lonBits, latBits] = getNumberOfBits(precision);
+    const auto lonShift = lonBits - latBits;
+    const auto latShift = nautilus::val<uint64_t>(1) - lonShift;
+    return (spread(lonCell) << latShift) | (spread(latCell) << lonShift);
+}
+
+std::pair<nautilus::val<uint64_t>, nautilus::val<uint64_t>>
+GeohashPhysicalFunction::deinterleave(const nautilus::val<uint64_t>& geohash, const nautilus::val<uint64_t>& precision)
+{
+    const auto [lonBits, latBits] = getNumberOfBits(precision);
+    const auto lonShift = lonBits - latBits;
+    const auto latShift = nautilus::val<uint64_t>(1) - lonShift;
+    return {compact(geohash >> latShift), compact(geohash >> lonShift)};
+}
+
+VarVal GeohashPhysicalFunction::execute(const Record& record, ArenaRef& arena) const
+{
+    const auto lon = parameterFunctions[0].execute(record, arena).cast<nautilus::val<double>>();
+    const auto lat = parameterFunctions[1].execute(record, arena).cast<nautilus::val<double>>();
+    const auto precision = parameterFunctions[2].execute(record, arena).cast<nautilus::val<uint64_t>>();
+    const auto [lonBits, latBits] = getNumberOfBits(precision);
+    return VarVal(interleave(quantize(lon, -180.0, 360.0, lonBits), quantize(lat, -90.0, 180.0, latBits), precision));
+}
+
+PhysicalFunctionRegistryReturnType
+PhysicalFunctionGeneratedRegistrar::RegisterGeohashPhysicalFunction(PhysicalFunctionRegistryArguments physicalFunctionRegistryArguments)
+{
+    const auto& children = physicalFunctionRegistryArguments.childFunctions;
+    PRECONDITION(children.size() == 3, "Geohash function must have exactly three sub-functions");
+    return GeohashPhysicalFunction(children[0], children[1], children[2]);
+}
+
+}
@@ -0,0 +1,76 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+
+#include <Functions/Spatial/HaversineDistancePhysicalFunction.hpp>
+
+#include <cmath>
+#include <numbers>
+#include <utility>
+#include <vector>
+#include <Functions/PhysicalFunction.hpp>
+#include <Nautilus/DataTypes/VarVal.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <ErrorHandling.hpp>
+#include <ExecutionContext.hpp>
+#include <PhysicalFunctionRegistry.hpp>
+#include <function.hpp>
+#include <val.hpp>
+
+namespace NES
+{
+
+HaversineDistancePhysicalFunction::HaversineDistancePhysicalFunction(
+    PhysicalFunction lon1Function, PhysicalFunction lat1Function, PhysicalFunction lon2Function, PhysicalFunction lat2Function)
+    : parameterFunctions({std::move(lon1Function), std::move(lat1Function), std::move(lon2Function), std::move(lat2Function)})
+{
+}
+
+VarVal HaversineDistancePhysicalFunction::execute(const Record& record, ArenaRef& arena) const
+{
+    /// The conversion to radians and the differences are traced. Nautilus has no trigonometric functions, thus only the
+    /// central angle is computed by a plain function, which neither allocates nor crosses into MEOS.
+    constexpr double degreesToRadians = std::numbers::pi / 180.0;
+    const auto lon1 = parameterFunctions[0].execute(record, arena).cast<nautilus::val<double>>() * degreesToRadians;
+    const auto lat1 = parameterFunctions[1].execute(record, arena).cast<nautilus::val<double>>() * degreesToRadians;
+    const auto lon2 = parameterFunctions[2].execute(record, arena).cast<nautilus::val<double>>() * degreesToRadians;
+    const auto lat2 = parameterFunctions[3].execute(record, arena).cast<nautilus::val<double>>() * degreesToRadians;
+    const nautilus::val<double> halfDeltaLon = (lon2 - lon1) * 0.5;
+    const nautilus::val<double> halfDeltaLat = (lat2 - lat1) * 0.5;
+
+    const auto centralAngle = nautilus::invoke(
+        +[](const double lat1, const double lat2, const double halfDeltaLon, const double halfDeltaLat)
+        {
+            const auto sinLat = std::sin(halfDeltaLat);
+            const auto sinLon = std::sin(halfDeltaLon);
+            const auto haversine = (sinLat * sinLat) + (std::cos(lat1) * std::cos(lat2) * sinLon * sinLon);
+            /// Rounding errors can result in values slightly above 1 for antipodal points
+            return 2.0 * std::asin(std::sqrt(std::fmin(1.0, haversine)));
+        },
+        lat1,
+        lat2,
+        halfDeltaLon,
+        halfDeltaLat);
+    return VarVal(centralAngle * EARTH_RADIUS);
+}
+
+PhysicalFunctionRegistryReturnType PhysicalFunctionGeneratedRegistrar::RegisterHaversineDistancePhysicalFunction(
+    PhysicalFunctionRegistryArguments physicalFunctionRegistryArguments)
+{
+    const auto& children = physicalFunctionRegistryArguments.childFunctions;
+    PRECONDITION(children.size() == 4, "HaversineDistance function must have exactly four sub-functions");
+    return HaversineDistancePhysicalFunction(children[0], children[1], children[2], children[3]);
+}
+
+}
@@ -0,0 +1,66 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+
+#include <Functions/Spatial/PointInBBoxPhysicalFunction.hpp>
+
+#include <utility>
+#include <vector>
+#include <Functions/PhysicalFunction.hpp>
+#include <Nautilus/DataTypes/VarVal.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <ErrorHandling.hpp>
+#include <ExecutionContext.hpp>
+#include <PhysicalFunctionRegistry.hpp>
+
+namespace NES
+{
+
+PointInBBoxPhysicalFunction::PointInBBoxPhysicalFunction(
+    PhysicalFunction lonFunction,
+    PhysicalFunction latFunction,
+    PhysicalFunction xminFunction,
+    PhysicalFunction yminFunction,
+    PhysicalFunction xmaxFunction,
+    PhysicalFunction ymaxFunction)
+    : parameterFunctions(
+          {std::move(lonFunction),
+           std::move(latFunction),
+           std::move(xminFunction),
+           std::move(yminFunction),
+           std::move(xmaxFunction),
+           std::move(ymaxFunction)})
+{
+}
+
+VarVal PointInBBoxPhysicalFunction::execute(const Record& record, ArenaRef& arena) const
+{
+    const auto lon = parameterFunctions[0].execute(record, arena);
+    const auto lat = parameterFunctions[1].execute(record, arena);
+    const auto xmin = parameterFunctions[2].execute(record, arena);
+    const auto ymin = parameterFunctions[3].execute(record, arena);
+    const auto xmax = parameterFunctions[4].execute(record, arena);
+    const auto ymax = parameterFunctions[5].execute(record, arena);
+    return (xmin <= lon) && (lon <= xmax) && (ymin <= lat) && (lat <= ymax);
+}
+
+PhysicalFunctionRegistryReturnType
+PhysicalFunctionGeneratedRegistrar::RegisterPointInBBoxPhysicalFunction(PhysicalFunctionRegistryArguments physicalFunctionRegistryArguments)
+{
+    const auto& children = physicalFunctionRegistryArguments.childFunctions;
+    PRECONDITION(children.size() == 6, "PointInBBox function must have exactly six sub-functions");
+    return PointInBBoxPhysicalFunction(children[0], children[1], children[2], children[3], children[4], children[5]);
+}
+
+}
@@ -0,0 +1,509 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Functions/VectorizedPredicate.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <optional>
+#include <ranges>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+#include <DataTypes/DataType.hpp>
+#include <Functions/BooleanFunctions/AndLogicalFunction.hpp>
+#include <Functions/BooleanFunctions/EqualsLogicalFunction.hpp>
+#include <Functions/BooleanFunctions/NegateLogicalFunction.hpp>
+#include <Functions/BooleanFunctions/OrLogicalFunction.hpp>
+#include <Functions/ComparisonFunctions/GreaterEqualsLogicalFunction.hpp>
+#include <Functions/ComparisonFunctions/GreaterLogicalFunction.hpp>
+#include <Functions/ComparisonFunctions/LessEqualsLogicalFunction.hpp>
+#include <Functions/ComparisonFunctions/LessLogicalFunction.hpp>
+#include <Functions/ConstantValueLogicalFunction.hpp>
+#include <Functions/FieldAccessLogicalFunction.hpp>
+#include <Functions/LogicalFunction.hpp>
+#include <MemoryLayout/ColumnLayout.hpp>
+#include <MemoryLayout/MemoryLayout.hpp>
+#include <Util/Strings.hpp>
+#include <ErrorHandling.hpp>
+#include <magic_enum/magic_enum.hpp>
+
+namespace NES
+{
+
+namespace
+{
+enum class NumericCategory : uint8_t
+{
+    SIGNED,
+    UNSIGNED,
+    FLOATING_POINT
+};
+
+std::optional<NumericCategory> getNumericCategory(const DataType::Type type)
+{
+    switch (type)
+    {
+        case DataType::Type::INT8:
+        case DataType::Type::INT16:
+        case DataType::Type::INT32:
+        case DataType::Type::INT64:
+            return NumericCategory::SIGNED;
+        case DataType::Type::UINT8:
+        case DataType::Type::UINT16:
+        case DataType::Type::UINT32:
+        case DataType::Type::UINT64:
+            return NumericCategory::UNSIGNED;
+        case DataType::Type::FLOAT32:
+        case DataType::Type::FLOAT64:
+            return NumericCategory::FLOATING_POINT;
+        default:
+            return std::nullopt;
+    }
+}
+
+std::optional<VectorizedPredicate::Constant> parseConstant(const ConstantValueLogicalFunction& constantFunction)
+{
+    const auto category = getNumericCategory(constantFunction.getDataType().type);
+    if (not category)
+    {
+        return std::nullopt;
+    }
+    const auto value = constantFunction.getConstantValue();
+    switch (*category)
+    {
+        case NumericCategory::SIGNED:
+            return Util::from_chars<int64_t>(value).transform([](auto parsed) { return VectorizedPredicate::Constant{parsed}; });
+        case NumericCategory::UNSIGNED:
+            return Util::from_chars<uint64_t>(value).transform([](auto parsed) { return VectorizedPredicate::Constant{parsed}; });
+        case NumericCategory::FLOATING_POINT:
+            return Util::from_chars<double>(value).transform([](auto parsed) { return VectorizedPredicate::Constant{parsed}; });
+    }
+    std::unreachable();
+}
+
+/// 'constant < field' is equivalent to 'field > constant'
+VectorizedPredicate::ComparisonType mirror(const VectorizedPredicate::ComparisonType comparison)
+{
+    switch (comparison)
+    {
+        case VectorizedPredicate::ComparisonType::EQUALS:
+            return VectorizedPredicate::ComparisonType::EQUALS;
+        case VectorizedPredicate::ComparisonType::LESS:
+            return VectorizedPredicate::ComparisonType::GREATER;
+        case VectorizedPredicate::ComparisonType::LESS_EQUALS:
+            return VectorizedPredicate::ComparisonType::GREATER_EQUALS;
+        case VectorizedPredicate::ComparisonType::GREATER:
+            return VectorizedPredicate::ComparisonType::LESS;
+        case VectorizedPredicate::ComparisonType::GREATER_EQUALS:
+            return VectorizedPredicate::ComparisonType::LESS_EQUALS;
+    }
+    std::unreachable();
+}
+
+std::optional<VectorizedPredicate::ComparisonType> getComparisonType(const LogicalFunction& function)
+{
+    if (function.tryGet<EqualsLogicalFunction>())
+    {
+        return VectorizedPredicate::ComparisonType::EQUALS;
+    }
+    if (function.tryGet<LessLogicalFunction>())
+    {
+        return VectorizedPredicate::ComparisonType::LESS;
+    }
+    if (function.tryGet<LessEqualsLogicalFunction>())
+    {
+        return VectorizedPredicate::ComparisonType::LESS_EQUALS;
+    }
+    if (function.tryGet<GreaterLogicalFunction>())
+    {
+        return VectorizedPredicate::ComparisonType::GREATER;
+    }
+    if (function.tryGet<GreaterEqualsLogicalFunction>())
+    {
+        return VectorizedPredicate::ComparisonType::GREATER_EQUALS;
+    }
+    return std::nullopt;
+}
+
+/// The per-record path compares the operands after the usual arithmetic conversions. We only vectorize comparisons, where widening both
+/// operands to 64 bit yields the same result: operands of the same signedness, unsigned fields with non-negative signed constants, and
+/// comparisons involving a floating point operand.
+std::optional<VectorizedPredicate::Constant> widenConstant(const DataType::Type fieldType, const VectorizedPredicate::Constant& constant)
+{
+    const auto fieldCategory = getNumericCategory(fieldType);
+    if (not fieldCategory)
+    {
+        return std::nullopt;
+    }
+    return std::visit(
+        [&]<typename T>(const T value) -> std::optional<VectorizedPredicate::Constant>
+        {
+            if (*fieldCategory == NumericCategory::FLOATING_POINT)
+            {
+                return VectorizedPredicate::Constant{static_cast<double>(value)};
+            }
+            if constexpr (std::is_same_v<T, double>)
+            {
+                return VectorizedPredicate::Constant{value};
+            }
+            else if constexpr (std::is_same_v<T, int64_t>)
+            {
+                if (*fieldCategory == NumericCategory::SIGNED)
+                {
+                    return VectorizedPredicate::Constant{value};
+                }
+                if (value >= 0)
+                {
+                    return VectorizedPredicate::Constant{static_cast<uint64_t>(value)};
+                }
+                return std::nullopt;
+            }
+            else
+            {
+                if (*fieldCategory == NumericCategory::UNSIGNED)
+                {
+                    return VectorizedPredicate::Constant{value};
+                }
+                return std::nullopt;
+            }
+        },
+        constant);
+}
+
+template <typename FieldType, typename ComputeType, typename Comparator>
+void compareField(
+    const int8_t* field,
+    const uint64_t stride,
+    const size_t numberOfTuples,
+    const uint64_t* tupleIndexes,
+    const ComputeType constant,
+    uint8_t* mask)
+{
+    constexpr Comparator comparator{};
+    /// Gathers the selected tuples, which are not contiguous
+    if (tupleIndexes != nullptr)
+    {
+        for (size_t i = 0; i < numberOfTuples; ++i)
+        {
+            FieldType value;
+            std::memcpy(&value, field + (tupleIndexes[i] * stride), sizeof(FieldType));
+            mask[i] = static_cast<uint8_t>(comparator(static_cast<ComputeType>(value), constant));
+        }
+        return;
+    }
+    /// Separate loop for contiguous columns, as a known stride allows the compiler to vectorize the loads.
+    if (stride == sizeof(FieldType))
+    {
+        for (size_t i = 0; i < numberOfTuples; ++i)
+        {
+            FieldType value;
+            std::memcpy(&value, field + (i * sizeof(FieldType)), sizeof(FieldType));
+            mask[i] = static_cast<uint8_t>(comparator(static_cast<ComputeType>(value), constant));
+        }
+        return;
+    }
+    for (size_t i = 0; i < numberOfTuples; ++i)
+    {
+        FieldType value;
+        std::memcpy(&value, field + (i * stride), sizeof(FieldType));
+        mask[i] = static_cast<uint8_t>(comparator(static_cast<ComputeType>(value), constant));
+    }
+}
+
+template <typename FieldType, typename ComputeType>
+void compareField(
+    const VectorizedPredicate::ComparisonType comparison,
+    const int8_t* field,
+    const uint64_t stride,
+    const size_t numberOfTuples,
+    const uint64_t* tupleIndexes,
+    const ComputeType constant,
+    uint8_t* mask)
+{
+    switch (comparison)
+    {
+        case VectorizedPredicate::ComparisonType::EQUALS:
+            return compareField<FieldType, ComputeType, std::equal_to<>>(field, stride, numberOfTuples, tupleIndexes, constant, mask);
+        case VectorizedPredicate::ComparisonType::LESS:
+            return compareField<FieldType, ComputeType, std::less<>>(field, stride, numberOfTuples, tupleIndexes, constant, mask);
+        case VectorizedPredicate::ComparisonType::LESS_EQUALS:
+            return compareField<FieldType, ComputeType, std::less_equal<>>(field, stride, numberOfTuples, tupleIndexes, constant, mask);
+        case VectorizedPredicate::ComparisonType::GREATER:
+            return compareField<FieldType, ComputeType, std::greater<>>(field, stride, numberOfTuples, tupleIndexes, constant, mask);
+        case VectorizedPredicate::ComparisonType::GREATER_EQUALS:
+            return compareField<FieldType, ComputeType, std::greater_equal<>>(field, stride, numberOfTuples, tupleIndexes, constant, mask);
+    }
+}
+
+template <typename ComputeType>
+void compareField(
+    const DataType::Type fieldType,
+    const VectorizedPredicate::ComparisonType comparison,
+    const int8_t* field,
+    const uint64_t stride,
+    const size_t numberOfTuples,
+    const uint64_t* tupleIndexes,
+    const ComputeType constant,
+    uint8_t* mask)
+{
+    switch (fieldType)
+    {
+        case DataType::Type::INT8:
+            return compareField<int8_t>(comparison, field, stride, numberOfTuples, tupleIndexes, constant, mask);
+        case DataType::Type::INT16:
+            return compareField<int16_t>(comparison, field, stride, numberOfTuples, tupleIndexes, constant, mask);
+        case DataType::Type::INT32:
+            return compareField<int32_t>(comparison, field, stride, numberOfTuples, tupleIndexes, constant, mask);
+        case DataType::Type::INT64:
+            return compareField<int64_t>(comparison, field, stride, numberOfTuples, tupleIndexes, constant, mask);
+        case DataType::Type::UINT8:
+            return compareField<uint8_t>(comparison, field, stride, numberOfTuples, tupleIndexes, constant, mask);
+        case DataType::Type::UINT16:
+            return compareField<uint16_t>(comparison, field, stride, numberOfTuples, tupleIndexes, constant, mask);
+        case DataType::Type::UINT32:
+            return compareField<uint32_t>(comparison, field, stride, numberOfTuples, tupleIndexes, constant, mask);
+        case DataType::Type::UINT64:
+            return compareField<uint64_t>(comparison, field, stride, numberOfTuples, tupleIndexes, constant, mask);
+        case DataType::Type::FLOAT32:
+            return compareField<float>(comparison, field, stride, numberOfTuples, tupleIndexes, constant, mask);
+        case DataType::Type::FLOAT64:
+            return compareField<double>(comparison, field, stride, numberOfTuples, tupleIndexes, constant, mask);
+        default:
+            INVARIANT(false, "bind() only accepts numeric fields, but got {}", magic_enum::enum_name(fieldType));
+    }
+}
+}
+
+std::optional<VectorizedPredicate> VectorizedPredicate::create(const LogicalFunction& predicate)
+{
+    std::vector<Node> nodes;
+    if (addNode(predicate, nodes))
+    {
+        return VectorizedPredicate(std::move(nodes));
+    }
+    return std::nullopt;
+}
+
+std::optional<size_t> VectorizedPredicate::addNode(const LogicalFunction& function, std::vector<Node>& nodes)
+{
+    const auto children = function.getChildren();
+    std::optional<Node::Type> booleanType;
+    if (function.tryGet<AndLogicalFunction>())
+    {
+        booleanType = Node::Type::AND;
+    }
+    else if (function.tryGet<OrLogicalFunction>())
+    {
+        booleanType = Node::Type::OR;
+    }
+    else if (function.tryGet<NegateLogicalFunction>())
+    {
+        booleanType = Node::Type::NEGATE;
+    }
+
+    if (booleanType)
+    {
+        Node node{.type = *booleanType};
+        for (const auto& child : children)
+        {
+            const auto childIndex = addNode(child, nodes);
+            if (not childIndex)
+            {
+                return std::nullopt;
+            }
+            node.children.emplace_back(*childIndex);
+        }
+        nodes.emplace_back(std::move(node));
+        return nodes.size() - 1;
+    }
+
+    /// Comparison between a field and a constant, in any order
+    const auto comparison = getComparisonType(function);
+    if (not comparison or children.size() != 2)
+    {
+        return std::nullopt;
+    }
+    auto field = children[0].tryGet<FieldAccessLogicalFunction>();
+    auto constant = children[1].tryGet<ConstantValueLogicalFunction>();
+    auto comparisonType = *comparison;
+    if (not field or not constant)
+    {
+        field = children[1].tryGet<FieldAccessLogicalFunction>();
+        constant = children[0].tryGet<ConstantValueLogicalFunction>();
+        comparisonType = mirror(comparisonType);
+    }
+    if (not field or not constant)
+    {
+        return std::nullopt;
+    }
+    const auto constantValue = parseConstant(*constant);
+    if (not constantValue)
+    {
+        return std::nullopt;
+    }
+    nodes.emplace_back(
+        Node{.type = Node::Type::COMPARISON, .comparison = comparisonType, .fieldName = field->getFieldName(), .constant = *constantValue});
+    return nodes.size() - 1;
+}
+
+std::optional<VectorizedPredicate> VectorizedPredicate::bind(const MemoryLayout& memoryLayout) const
+{
+    auto boundNodes = nodes;
+    const auto* columnLayout = dynamic_cast<const ColumnLayout*>(&memoryLayout);
+    for (auto& node : boundNodes)
+    {
+        if (node.type != Node::Type::COMPARISON)
+        {
+            continue;
+        }
+        const auto fieldIndex = memoryLayout.getFieldIndexFromName(node.fieldName);
+        if (not fieldIndex)
+        {
+            return std::nullopt;
+        }
+        const auto fieldType = memoryLayout.getSchema().getFieldByName(node.fieldName).value().dataType.type;
+        const auto widenedConstant = widenConstant(fieldType, node.constant);
+        if (not widenedConstant)
+        {
+            return std::nullopt;
+        }
+        node.constant = *widenedConstant;
+        node.fieldType = fieldType;
+        node.offset = memoryLayout.getFieldOffset(0, *fieldIndex);
+        node.stride = (columnLayout != nullptr) ? memoryLayout.getFieldSize(*fieldIndex) : memoryLayout.getTupleSize();
+    }
+    VectorizedPredicate boundPredicate(std::move(boundNodes));
+    boundPredicate.bound = true;
+    return boundPredicate;
+}
+
+std::vector<VectorizedPredicate::Comparison> VectorizedPredicate::getConjunctiveComparisons() const
+{
+    std::vector<Comparison> comparisons;
+    std::vector<size_t> conjuncts{nodes.size() - 1};
+    while (not conjuncts.empty())
+    {
+        const auto& node = nodes[conjuncts.back()];
+        conjuncts.pop_back();
+        if (node.type == Node::Type::AND)
+        {
+            conjuncts.insert(conjuncts.end(), node.children.begin(), node.children.end());
+        }
+        else if (node.type == Node::Type::COMPARISON)
+        {
+            comparisons.emplace_back(node.fieldName, node.comparison, node.constant);
+        }
+    }
+    return comparisons;
+}
+
+uint64_t VectorizedPredicate::evaluate(const int8_t* buffer, const uint64_t numberOfTuples, uint64_t* selectionVector) const
+{
+    PRECONDITION(bound, "The predicate must be bound to a memory layout before it can be evaluated");
+    std::array<uint8_t, CHUNK_SIZE> mask{};
+    uint64_t numberOfSelectedTuples = 0;
+    for (uint64_t firstTuple = 0; firstTuple < numberOfTuples; firstTuple += CHUNK_SIZE)
+    {
+        const auto numberOfTuplesInChunk = std::min<uint64_t>(CHUNK_SIZE, numberOfTuples - firstTuple);
+        evaluateNode(nodes.size() - 1, buffer, firstTuple, numberOfTuplesInChunk, nullptr, mask.data());
+        /// Branch-free compaction of the mask into the selection vector
+        for (size_t i = 0; i < numberOfTuplesInChunk; ++i)
+        {
+            selectionVector[numberOfSelectedTuples] = firstTuple + i;
+            numberOfSelectedTuples += mask[i];
+        }
+    }
+    return numberOfSelectedTuples;
+}
+
+uint64_t VectorizedPredicate::refine(const int8_t* buffer, uint64_t* selectionVector, const uint64_t numberOfSelectedTuples) const
+{
+    PRECONDITION(bound, "The predicate must be bound to a memory layout before it can be evaluated");
+    std::array<uint8_t, CHUNK_SIZE> mask{};
+    uint64_t numberOfRemainingTuples = 0;
+    for (uint64_t firstIndex = 0; firstIndex < numberOfSelectedTuples; firstIndex += CHUNK_SIZE)
+    {
+        const auto numberOfTuplesInChunk = std::min<uint64_t>(CHUNK_SIZE, numberOfSelectedTuples - firstIndex);
+        evaluateNode(nodes.size() - 1, buffer, firstIndex, numberOfTuplesInChunk, selectionVector, mask.data());
+        /// Compacts in place, as the remaining indexes never overtake the indexes that are still to be evaluated
+        for (size_t i = 0; i < numberOfTuplesInChunk; ++i)
+        {
+            selectionVector[numberOfRemainingTuples] = selectionVector[firstIndex + i];
+            numberOfRemainingTuples += mask[i];
+        }
+    }
+    return numberOfRemainingTuples;
+}
+
+void VectorizedPredicate::evaluateNode(
+    const size_t nodeIndex,
+    const int8_t* buffer,
+    const uint64_t firstTuple,
+    const size_t numberOfTuples,
+    const uint64_t* tupleIndexes,
+    uint8_t* mask) const
+{
+    const auto& node = nodes[nodeIndex];
+    switch (node.type)
+    {
+        case Node::Type::COMPARISON: {
+            const auto* field = buffer + node.offset;
+            const auto* chunkIndexes = tupleIndexes;
+            if (tupleIndexes == nullptr)
+            {
+                field += firstTuple * node.stride;
+            }
+            else
+            {
+                chunkIndexes += firstTuple;
+            }
+            std::visit(
+                [&](const auto constant)
+                { compareField(node.fieldType, node.comparison, field, node.stride, numberOfTuples, chunkIndexes, constant, mask); },
+                node.constant);
+            return;
+        }
+        case Node::Type::NEGATE: {
+            evaluateNode(node.children.front(), buffer, firstTuple, numberOfTuples, tupleIndexes, mask);
+            for (size_t i = 0; i < numberOfTuples; ++i)
+            {
+                mask[i] ^= 1U;
+            }
+            return;
+        }
+        case Node::Type::AND:
+        case Node::Type::OR: {
+            evaluateNode(node.children.front(), buffer, firstTuple, numberOfTuples, tupleIndexes, mask);
+            std::array<uint8_t, CHUNK_SIZE> childMask{};
+            for (const auto childIndex : node.children | std::views::drop(1))
+            {
+                evaluateNode(childIndex, buffer, firstTuple, numberOfTuples, tupleIndexes, childMask.data());
+                for (size_t i = 0; i < numberOfTuples; ++i)
+                {
+                    mask[i] = (node.type == Node::Type::AND) ? (mask[i] & childMask[i]) : (mask[i] | childMask[i]);
+                }
+            }
+            return;
+        }
+    }
+}
+
+}
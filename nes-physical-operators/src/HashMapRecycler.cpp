@@ -0,0 +1,72 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <HashMapRecycler.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMap.hpp>
+#include <Nautilus/Interface/HashMap/HashMap.hpp>
+#include <ErrorHandling.hpp>
+
+namespace NES
+{
+
+HashMapRecycler::HashMapRecycler(const size_t maxNumberOfHashMaps, const uint64_t maxRetainedPagesPerHashMap)
+    : maxNumberOfHashMaps(maxNumberOfHashMaps), maxRetainedPagesPerHashMap(maxRetainedPagesPerHashMap)
+{
+}
+
+std::unique_ptr<Nautilus::Interface::HashMap> HashMapRecycler::acquire(const Configuration& configuration)
+{
+    const auto locked = recycledHashMaps.wlock();
+    const auto hashMaps = locked->hashMapsByConfiguration.find(configuration);
+    if (hashMaps == locked->hashMapsByConfiguration.end() or hashMaps->second.empty())
+    {
+        return nullptr;
+    }
+    auto hashMap = std::move(hashMaps->second.back());
+    hashMaps->second.pop_back();
+    --locked->numberOfHashMaps;
+    return hashMap;
+}
+
+void HashMapRecycler::recycle(const Configuration& configuration, std::unique_ptr<Nautilus::Interface::HashMap> hashMap)
+{
+    PRECONDITION(hashMap != nullptr, "The recycled hash map must not be null");
+    auto* const chainedHashMap = dynamic_cast<Nautilus::Interface::ChainedHashMap*>(hashMap.get());
+    INVARIANT(chainedHashMap != nullptr, "The recycled hash map should be a ChainedHashMap or an OpenAddressingHashMap");
+    if (recycledHashMaps.rlock()->numberOfHashMaps >= maxNumberOfHashMaps)
+    {
+        return;
+    }
+
+    /// Clearing the hash map before taking the lock, as zeroing its memory takes longer than any other access to the recycler
+    chainedHashMap->clearForReuse(maxRetainedPagesPerHashMap);
+    const auto locked = recycledHashMaps.wlock();
+    if (locked->numberOfHashMaps < maxNumberOfHashMaps)
+    {
+        locked->hashMapsByConfiguration[configuration].emplace_back(std::move(hashMap));
+        ++locked->numberOfHashMaps;
+    }
+}
+
+size_t HashMapRecycler::getNumberOfHashMaps() const
+{
+    return recycledHashMaps.rlock()->numberOfHashMaps;
+}
+
+}
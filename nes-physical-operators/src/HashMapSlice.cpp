@@ -14,6 +14,7 @@
 #include <HashMapSlice.hpp>
 
 #include <algorithm>
+#include <bit>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
@@ -24,8 +25,10 @@
 #include <Identifiers/Identifiers.hpp>
 #include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMap.hpp>
 #include <Nautilus/Interface/HashMap/HashMap.hpp>
+#include <Nautilus/Interface/HashMap/OpenAddressingHashMap/OpenAddressingHashMap.hpp>
 #include <SliceStore/Slice.hpp>
 #include <ErrorHandling.hpp>
+#include <HashMapRecycler.hpp>
 
 namespace NES
 {
@@ -60,11 +63,62 @@ HashMapSlice::~HashMapSlice()
             /// Calling the compiled nautilus function
             createNewHashMapSliceArgs.nautilusCleanup[i / numberOfHashMapsPerInputStream]->operator()(hashMaps[i].get());
         }
+        if (hashMaps[i])
+        {
+            recycleHashMap(std::move(hashMaps[i]));
+        }
     }
 
     hashMaps.clear();
 }
 
+HashMapRecycler::Configuration HashMapSlice::getRecyclerConfiguration() const
+{
+    return {
+        .hashMapType = createNewHashMapSliceArgs.hashMapType,
+        .keySize = createNewHashMapSliceArgs.keySize,
+        .valueSize = createNewHashMapSliceArgs.valueSize,
+        /// The handlers derive the number of buckets from a rolling average of the keys, which differs slightly between slices. As the hash
+        /// maps round their number of buckets up to a power of two, a hash map fits all slices whose number of buckets rounds to its own.
+        .numberOfBuckets = std::bit_ceil(createNewHashMapSliceArgs.numberOfBuckets),
+        .pageSize = createNewHashMapSliceArgs.pageSize};
+}
+
+void HashMapSlice::recycleHashMap(std::unique_ptr<Nautilus::Interface::HashMap> hashMap) const
+{
+    if (createNewHashMapSliceArgs.hashMapRecycler)
+    {
+        createNewHashMapSliceArgs.hashMapRecycler->recycle(getRecyclerConfiguration(), std::move(hashMap));
+    }
+}
+
+std::unique_ptr<Nautilus::Interface::HashMap> HashMapSlice::createHashMap() const
+{
+    if (createNewHashMapSliceArgs.hashMapRecycler)
+    {
+        if (auto recycledHashMap = createNewHashMapSliceArgs.hashMapRecycler->acquire(getRecyclerConfiguration()))
+        {
+            return recycledHashMap;
+        }
+    }
+    switch (createNewHashMapSliceArgs.hashMapType)
+    {
+        case Nautilus::Interface::HashMapType::CHAINED:
+            return std::make_unique<Nautilus::Interface::ChainedHashMap>(
+                createNewHashMapSliceArgs.keySize,
+                createNewHashMapSliceArgs.valueSize,
+                createNewHashMapSliceArgs.numberOfBuckets,
+                createNewHashMapSliceArgs.pageSize);
+        case Nautilus::Interface::HashMapType::OPEN_ADDRESSING:
+            return std::make_unique<Nautilus::Interface::OpenAddressingHashMap>(
+                createNewHashMapSliceArgs.keySize,
+                createNewHashMapSliceArgs.valueSize,
+                createNewHashMapSliceArgs.numberOfBuckets,
+                createNewHashMapSliceArgs.pageSize);
+    }
+    std::unreachable();
+}
+
 uint64_t HashMapSlice::getNumberOfHashMaps() const
 {
     return hashMaps.size();
@@ -78,4 +132,34 @@ uint64_t HashMapSlice::getNumberOfTuples() const
         0,
         [](uint64_t runningSum, const auto& hashMap) { return runningSum + hashMap->getNumberOfTuples(); });
 }
+
+uint64_t HashMapSlice::getStateSizeInBytes() const
+{
+    uint64_t numberOfTuples = 0;
+    for (const auto& hashMap : hashMaps)
+    {
+        /// The builds create the hash maps of their worker threads lazily
+        if (hashMap)
+        {
+            numberOfTuples += hashMap->getNumberOfTuples();
+        }
+    }
+    return numberOfTuples * (createNewHashMapSliceArgs.keySize + createNewHashMapSliceArgs.valueSize);
+}
+
+void HashMapSlice::addStateSizeInBytesPerWorkerThread(std::vector<uint64_t>& stateSizeInBytesPerWorkerThread) const
+{
+    /// The hash maps of an input stream are ordered by worker thread and then by partition, c.f., AggregationSlice and HJSlice
+    const auto numberOfPartitions = createNewHashMapSliceArgs.numberOfPartitions;
+    const auto numberOfWorkerThreads = numberOfHashMapsPerInputStream / numberOfPartitions;
+    stateSizeInBytesPerWorkerThread.resize(std::max<size_t>(stateSizeInBytesPerWorkerThread.size(), numberOfWorkerThreads), 0);
+    for (uint64_t position = 0; position < hashMaps.size(); ++position)
+    {
+        if (hashMaps[position])
+        {
+            stateSizeInBytesPerWorkerThread[(position % numberOfHashMapsPerInputStream) / numberOfPartitions]
+                += hashMaps[position]->getNumberOfTuples() * (createNewHashMapSliceArgs.keySize + createNewHashMapSliceArgs.valueSize);
+        }
+    }
+}
 }
@@ -14,10 +14,13 @@
 
 #include <Join/HashJoin/HJBuildPhysicalOperator.hpp>
 
+#include <bit>
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <utility>
+#include <vector>
 #include <Identifiers/Identifiers.hpp>
 #include <Join/HashJoin/HJOperatorHandler.hpp>
 #include <Join/HashJoin/HJSlice.hpp>
@@ -29,11 +32,15 @@
 #include <Nautilus/Interface/PagedVector/PagedVector.hpp>
 #include <Nautilus/Interface/PagedVector/PagedVectorRef.hpp>
 #include <Nautilus/Interface/Record.hpp>
+#include <Nautilus/Interface/RecordBuffer.hpp>
+#include <Runtime/Execution/OperatorHandler.hpp>
+#include <Runtime/TupleBuffer.hpp>
 #include <Time/Timestamp.hpp>
 #include <CompilationContext.hpp>
 #include <ErrorHandling.hpp>
 #include <ExecutionContext.hpp>
 #include <HashMapSlice.hpp>
+#include <PipelineExecutionContext.hpp>
 #include <WindowBuildPhysicalOperator.hpp>
 #include <function.hpp>
 #include <options.hpp>
@@ -43,12 +50,8 @@
 
 namespace NES
 {
-Interface::HashMap* getHashJoinHashMapProxy(
-    const HJOperatorHandler* operatorHandler,
-    const Timestamp timestamp,
-    const WorkerThreadId workerThreadId,
-    const JoinBuildSideType buildSide,
-    const HJBuildPhysicalOperator* buildOperator)
+HJSlice*
+getHashJoinSliceProxy(const HJOperatorHandler* operatorHandler, const Timestamp timestamp, const HJBuildPhysicalOperator* buildOperator)
 {
     PRECONDITION(operatorHandler != nullptr, "The operator handler should not be null");
     PRECONDITION(buildOperator != nullptr, "The build operator should not be null");
@@ -58,7 +61,9 @@ Interface::HashMap* getHashJoinHashMapProxy(
         buildOperator->hashMapOptions.keySize,
         buildOperator->hashMapOptions.valueSize,
         buildOperator->hashMapOptions.pageSize,
-        buildOperator->hashMapOptions.numberOfBuckets};
+        buildOperator->hashMapOptions.numberOfBuckets,
+        buildOperator->hashMapOptions.hashMapType,
+        buildOperator->numberOfPartitions};
     const auto hashMap = operatorHandler->getSliceAndWindowStore().getSlicesOrCreate(
         timestamp, operatorHandler->getCreateNewSlicesFunction(hashMapSliceArgs));
     INVARIANT(
@@ -67,10 +72,67 @@ Interface::HashMap* getHashJoinHashMapProxy(
         "slicing, but got {}",
         hashMap.size());
 
-    /// Converting the slice to an HJSlice and returning the pointer to the hashmap
-    const auto hjSlice = std::dynamic_pointer_cast<HJSlice>(hashMap[0]);
+    /// The slice store keeps the slice alive, until the probe has processed its window
+    auto* const hjSlice = dynamic_cast<HJSlice*>(hashMap[0].get());
     INVARIANT(hjSlice != nullptr, "The slice should be an HJSlice in an HJBuildPhysicalOperator");
-    return hjSlice->getHashMapPtrOrCreate(workerThreadId, buildSide);
+    return hjSlice;
+}
+
+Interface::HashMap* getHashJoinHashMapProxy(
+    const HJOperatorHandler* operatorHandler,
+    const Timestamp timestamp,
+    const WorkerThreadId workerThreadId,
+    const JoinBuildSideType buildSide,
+    const uint64_t partition,
+    const HJBuildPhysicalOperator* buildOperator)
+{
+    return getHashJoinSliceProxy(operatorHandler, timestamp, buildOperator)->getHashMapPtrOrCreate(workerThreadId, buildSide, partition);
+}
+
+namespace
+{
+/// Stores the buffer, to which a symmetric hash join writes the joined records of the current pipeline invocation
+class SymmetricHJBuildLocalState final : public WindowOperatorBuildLocalState
+{
+public:
+    SymmetricHJBuildLocalState(
+        const nautilus::val<OperatorHandler*>& operatorHandler,
+        const nautilus::val<Timestamp>& oldestAcceptedTimestamp,
+        const RecordBuffer& resultBuffer)
+        : WindowOperatorBuildLocalState(operatorHandler, oldestAcceptedTimestamp), resultBuffer(resultBuffer)
+    {
+    }
+
+    RecordBuffer resultBuffer;
+    nautilus::val<uint64_t> outputIndex{0};
+};
+
+void lockSymmetricHashJoinProxy(OperatorHandler* ptrOpHandler)
+{
+    PRECONDITION(ptrOpHandler != nullptr, "opHandler context should not be null!");
+    dynamic_cast<HJOperatorHandler*>(ptrOpHandler)->getSymmetricJoinMutex().lock();
+}
+
+void unlockSymmetricHashJoinProxy(OperatorHandler* ptrOpHandler)
+{
+    PRECONDITION(ptrOpHandler != nullptr, "opHandler context should not be null!");
+    dynamic_cast<HJOperatorHandler*>(ptrOpHandler)->getSymmetricJoinMutex().unlock();
+}
+
+void emitJoinedRecordsProxy(
+    OperatorHandler* ptrOpHandler,
+    PipelineExecutionContext* pipelineCtx,
+    TupleBuffer* tupleBuffer,
+    const uint64_t numberOfRecords,
+    const Timestamp creationTs,
+    const Timestamp latestCreationTs)
+{
+    PRECONDITION(ptrOpHandler != nullptr, "opHandler context should not be null!");
+    PRECONDITION(pipelineCtx != nullptr, "pipeline context should not be null");
+    PRECONDITION(tupleBuffer != nullptr, "tuple buffer should not be null");
+    dynamic_cast<HJOperatorHandler*>(ptrOpHandler)
+        ->emitJoinedRecords(*tupleBuffer, numberOfRecords, {.oldest = creationTs, .latest = latestCreationTs}, pipelineCtx);
+}
 }
 
 void HJBuildPhysicalOperator::setup(ExecutionContext& executionCtx, CompilationContext& compilationContext) const
@@ -78,75 +140,247 @@ void HJBuildPhysicalOperator::setup(ExecutionContext& executionCtx, CompilationC
     StreamJoinBuildPhysicalOperator::setup(executionCtx, compilationContext);
 
     /// Creating the cleanup function for the slice of current stream
+    auto* operatorHandler = dynamic_cast<HJOperatorHandler*>(executionCtx.getGlobalOperatorHandler(operatorHandlerId).value);
+    if (operatorHandler->wasSetupCalled(joinBuildSide))
+    {
+        return;
+    }
+
+    operatorHandler->setNautilusCleanupExec(createCleanupFunction(compilationContext, hashMapOptions), joinBuildSide);
+}
+
+std::shared_ptr<CreateNewHashMapSliceArgs::NautilusCleanupExec>
+HJBuildPhysicalOperator::createCleanupFunction(CompilationContext& compilationContext, const HashMapOptions& hashMapOptions)
+{
     /// As the setup function does not get traced, we do not need to have any nautilus::invoke calls to jump to the C++ runtime
     /// We are not allowed to use const or const references for the lambda function params, as nautilus does not support this in the registerFunction method.
     /// ReSharper disable once CppPassValueParameterByConstReference
     /// NOLINTBEGIN(performance-unnecessary-value-param)
-    auto* operatorHandler = dynamic_cast<HJOperatorHandler*>(executionCtx.getGlobalOperatorHandler(operatorHandlerId).value);
-    if (operatorHandler->wasSetupCalled(joinBuildSide))
+    return std::make_shared<CreateNewHashMapSliceArgs::NautilusCleanupExec>(compilationContext.registerFunction(std::function(
+        [copyOfHashMapOptions = hashMapOptions](nautilus::val<Nautilus::Interface::HashMap*> hashMap)
+        {
+            const Interface::ChainedHashMapRef hashMapRef{
+                hashMap,
+                copyOfHashMapOptions.fieldKeys,
+                copyOfHashMapOptions.fieldValues,
+                copyOfHashMapOptions.entriesPerPage,
+                copyOfHashMapOptions.entrySize};
+            for (const auto entry : hashMapRef)
+            {
+                const Interface::ChainedHashMapRef::ChainedEntryRef entryRefReset{
+                    entry, hashMap, copyOfHashMapOptions.fieldKeys, copyOfHashMapOptions.fieldValues};
+                const auto state = entryRefReset.getValueMemArea();
+                nautilus::invoke(
+                    +[](int8_t* pagedVectorMemArea) -> void
+                    {
+                        /// Calls the destructor of the PagedVector
+                        /// NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+                        auto* pagedVector = reinterpret_cast<Nautilus::Interface::PagedVector*>(pagedVectorMemArea);
+                        pagedVector->~PagedVector();
+                    },
+                    state);
+            }
+        })));
+    /// NOLINTEND(performance-unnecessary-value-param)
+}
+
+void HJBuildPhysicalOperator::execute(ExecutionContext& ctx, Record& record) const
+{
+    const auto timestamp = timeFunction->getTs(ctx, record);
+    if (not isLateRecord(ctx, timestamp))
     {
-        return;
+        /// Calling the key functions to add/update the keys to the record
+        for (nautilus::static_val<uint64_t> i = 0; i < hashMapOptions.fieldKeys.size(); ++i)
+        {
+            const auto& [fieldIdentifier, type, fieldOffset] = hashMapOptions.fieldKeys[i];
+            const auto& function = hashMapOptions.keyFunctions[i];
+            const auto value = function.execute(record, ctx.pipelineMemoryProvider.arena);
+            record.write(fieldIdentifier, value);
+        }
+
+        /// Get the current slice / hash map of the partition that we have to insert the tuple into
+        const auto partition = getPartition(record);
+        const auto hashMapPtr = getHashMap(ctx, timestamp, partition);
+        if (not symmetricHashJoinOptions.has_value())
+        {
+            insertRecord(ctx, record, hashMapPtr);
+            return;
+        }
+
+        /// The builds of the other side might insert into the hash maps, which we probe, concurrently
+        const auto operatorHandler = dynamic_cast<WindowOperatorBuildLocalState*>(ctx.getLocalState(id))->getOperatorHandler();
+        invoke(lockSymmetricHashJoinProxy, operatorHandler);
+        const auto entry = insertRecord(ctx, record, hashMapPtr);
+        probeOtherSide(ctx, record, entry, timestamp, partition);
+        invoke(unlockSymmetricHashJoinProxy, operatorHandler);
     }
+}
+
+void HJBuildPhysicalOperator::close(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const
+{
+    /// Emitting the joined records before triggering the windows, as the triggers might drop the slices of the joined records
+    if (symmetricHashJoinOptions.has_value())
+    {
+        const auto* const localState = dynamic_cast<SymmetricHJBuildLocalState*>(executionCtx.getLocalState(id));
+        if (localState->outputIndex > 0)
+        {
+            emitJoinedRecords(executionCtx);
+        }
+    }
+    StreamJoinBuildPhysicalOperator::close(executionCtx, recordBuffer);
+}
+
+void HJBuildPhysicalOperator::probeOtherSide(
+    ExecutionContext& ctx,
+    const Record& record,
+    const nautilus::val<Interface::AbstractHashMapEntry*>& entry,
+    const nautilus::val<Timestamp>& timestamp,
+    const nautilus::val<uint64_t>& partition) const
+{
+    const auto& [otherSideHashMapOptions, otherSideBufferRef, joinedBufferRef, windowMetaData] = symmetricHashJoinOptions.value();
+    auto* const localState = dynamic_cast<SymmetricHJBuildLocalState*>(ctx.getLocalState(id));
+    const auto slice = invoke(
+        getHashJoinSliceProxy, localState->getOperatorHandler(), timestamp, nautilus::val<const HJBuildPhysicalOperator*>(this));
 
-    const auto cleanupStateNautilusFunction
-        = std::make_shared<CreateNewHashMapSliceArgs::NautilusCleanupExec>(compilationContext.registerFunction(std::function(
-            [copyOfHashMapOptions = hashMapOptions](nautilus::val<Nautilus::Interface::HashMap*> hashMap)
+    /// As we solely support tumbling windows, the slice is the window of the joined records
+    const auto windowStart = invoke(+[](const HJSlice* hjSlice) { return hjSlice->getSliceStart(); }, slice);
+    const auto windowEnd = invoke(+[](const HJSlice* hjSlice) { return hjSlice->getSliceEnd(); }, slice);
+    const auto otherSide = joinBuildSide == JoinBuildSideType::Left ? JoinBuildSideType::Right : JoinBuildSideType::Left;
+    const auto fields = bufferRef->getMemoryLayout()->getSchema().getFieldNames();
+    const auto otherSideFields = otherSideBufferRef->getMemoryLayout()->getSchema().getFieldNames();
+
+    const auto numberOfHashMaps = invoke(+[](const HJSlice* hjSlice) { return hjSlice->getNumberOfHashMapsForSide(); }, slice);
+    for (nautilus::val<uint64_t> workerThread = 0; workerThread < numberOfHashMaps; ++workerThread)
+    {
+        const auto otherSideHashMapPtr = invoke(
+            +[](const HJSlice* hjSlice, const uint64_t workerThreadId, const JoinBuildSideType buildSide, const uint64_t partitionOfRecord)
+            { return hjSlice->getHashMapPtr(WorkerThreadId(workerThreadId), buildSide, partitionOfRecord); },
+            slice,
+            workerThread,
+            nautilus::val<JoinBuildSideType>(otherSide),
+            partition);
+        const auto otherSideHashMapExists
+            = invoke(+[](const Interface::HashMap* hashMap) { return hashMap != nullptr; }, otherSideHashMapPtr);
+        if (not otherSideHashMapExists)
+        {
+            continue;
+        }
+
+        /// Both sides store the keys in the same layout. Thus, we can look up the entry of the record in the hash maps of the other side.
+        if (const auto otherSideEntry = otherSideHashMapOptions.createHashMapRef(otherSideHashMapPtr)->findEntry(entry))
+        {
+            const Interface::ChainedHashMapRef::ChainedEntryRef otherSideEntryRef{
+                otherSideEntry, otherSideHashMapPtr, otherSideHashMapOptions.fieldKeys, otherSideHashMapOptions.fieldValues};
+            auto otherSidePagedVectorMem = otherSideEntryRef.getValueMemArea();
+            const Interface::PagedVectorRef otherSidePagedVector{otherSidePagedVectorMem, otherSideBufferRef};
+            for (auto it = otherSidePagedVector.begin(otherSideFields); it != otherSidePagedVector.end(otherSideFields); ++it)
             {
-                const Interface::ChainedHashMapRef hashMapRef{
-                    hashMap,
-                    copyOfHashMapOptions.fieldKeys,
-                    copyOfHashMapOptions.fieldValues,
-                    copyOfHashMapOptions.entriesPerPage,
-                    copyOfHashMapOptions.entrySize};
-                for (const auto entry : hashMapRef)
+                const auto otherSideRecord = *it;
+                Record joinedRecord;
+                joinedRecord.write(windowMetaData.windowStartFieldName, windowStart.convertToValue());
+                joinedRecord.write(windowMetaData.windowEndFieldName, windowEnd.convertToValue());
+                for (const auto& fieldName : nautilus::static_iterable(fields))
                 {
-                    const Interface::ChainedHashMapRef::ChainedEntryRef entryRefReset{
-                        entry, hashMap, copyOfHashMapOptions.fieldKeys, copyOfHashMapOptions.fieldValues};
-                    const auto state = entryRefReset.getValueMemArea();
-                    nautilus::invoke(
-                        +[](int8_t* pagedVectorMemArea) -> void
-                        {
-                            /// Calls the destructor of the PagedVector
-                            /// NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
-                            auto* pagedVector = reinterpret_cast<Nautilus::Interface::PagedVector*>(pagedVectorMemArea);
-                            pagedVector->~PagedVector();
-                        },
-                        state);
+                    joinedRecord.write(fieldName, record.read(fieldName));
                 }
-            })));
-    /// NOLINTEND(performance-unnecessary-value-param)
-    operatorHandler->setNautilusCleanupExec(cleanupStateNautilusFunction, joinBuildSide);
+                for (const auto& fieldName : nautilus::static_iterable(otherSideFields))
+                {
+                    joinedRecord.write(fieldName, otherSideRecord.read(fieldName));
+                }
+
+                if (localState->outputIndex >= joinedBufferRef->getMemoryLayout()->getCapacity())
+                {
+                    emitJoinedRecords(ctx);
+                    localState->resultBuffer = RecordBuffer(ctx.allocateBuffer());
+                    localState->outputIndex = 0;
+                }
+                joinedBufferRef->writeRecord(
+                    localState->outputIndex, localState->resultBuffer, joinedRecord, ctx.pipelineMemoryProvider.bufferProvider);
+                localState->outputIndex = localState->outputIndex + 1;
+            }
+        }
+    }
 }
 
-void HJBuildPhysicalOperator::execute(ExecutionContext& ctx, Record& record) const
+void HJBuildPhysicalOperator::emitJoinedRecords(ExecutionContext& ctx) const
 {
-    /// Getting the operator handler from the local state
-    auto* localState = dynamic_cast<WindowOperatorBuildLocalState*>(ctx.getLocalState(id));
-    auto operatorHandler = localState->getOperatorHandler();
+    auto* const localState = dynamic_cast<SymmetricHJBuildLocalState*>(ctx.getLocalState(id));
+    invoke(
+        emitJoinedRecordsProxy,
+        localState->getOperatorHandler(),
+        ctx.pipelineContext,
+        localState->resultBuffer.getReference(),
+        localState->outputIndex,
+        ctx.creationTs,
+        ctx.latestCreationTs);
+}
 
-    /// Get the current slice / hash map that we have to insert the tuple into
-    const auto timestamp = timeFunction->getTs(ctx, record);
-    const auto hashMapPtr = invoke(
-        getHashJoinHashMapProxy,
-        operatorHandler,
-        timestamp,
-        ctx.workerThreadId,
-        nautilus::val<JoinBuildSideType>(joinBuildSide),
-        nautilus::val<const HJBuildPhysicalOperator*>(this));
-    Interface::ChainedHashMapRef hashMap{
-        hashMapPtr, hashMapOptions.fieldKeys, hashMapOptions.fieldValues, hashMapOptions.entriesPerPage, hashMapOptions.entrySize};
-
-    /// Calling the key functions to add/update the keys to the record
-    for (nautilus::static_val<uint64_t> i = 0; i < hashMapOptions.fieldKeys.size(); ++i)
+std::unique_ptr<WindowOperatorBuildLocalState> HJBuildPhysicalOperator::createLocalState(
+    ExecutionContext& executionCtx,
+    const nautilus::val<OperatorHandler*>& operatorHandler,
+    const nautilus::val<Timestamp>& oldestAcceptedTimestamp) const
+{
+    if (not symmetricHashJoinOptions.has_value())
     {
-        const auto& [fieldIdentifier, type, fieldOffset] = hashMapOptions.fieldKeys[i];
-        const auto& function = hashMapOptions.keyFunctions[i];
-        const auto value = function.execute(record, ctx.pipelineMemoryProvider.arena);
-        record.write(fieldIdentifier, value);
+        return StreamJoinBuildPhysicalOperator::createLocalState(executionCtx, operatorHandler, oldestAcceptedTimestamp);
     }
+    return std::make_unique<SymmetricHJBuildLocalState>(
+        operatorHandler, oldestAcceptedTimestamp, RecordBuffer(executionCtx.allocateBuffer()));
+}
+
+nautilus::val<uint64_t> HJBuildPhysicalOperator::getPartition(const Record& record) const
+{
+    return hashMapOptions.getPartition(record, numberOfPartitions);
+}
+
+nautilus::val<Interface::HashMap*>
+HJBuildPhysicalOperator::getHashMap(
+    ExecutionContext& ctx, const nautilus::val<Timestamp>& timestamp, const nautilus::val<uint64_t>& partition) const
+{
+    const auto getHashMapOfPartition = [&](const nautilus::val<OperatorHandler*>& operatorHandler)
+    {
+        return invoke(
+            getHashJoinHashMapProxy,
+            operatorHandler,
+            timestamp,
+            ctx.workerThreadId,
+            nautilus::val<JoinBuildSideType>(joinBuildSide),
+            partition,
+            nautilus::val<const HJBuildPhysicalOperator*>(this));
+    };
+
+    /// The cached slice stores a single hash map. Thus, we solely cache it, if all records of the slice belong to the same partition.
+    if (numberOfPartitions == 1)
+    {
+        return static_cast<nautilus::val<Interface::HashMap*>>(getSliceStateCached(
+            ctx,
+            timestamp,
+            [&](const nautilus::val<OperatorHandler*>& operatorHandler)
+            { return static_cast<nautilus::val<int8_t*>>(getHashMapOfPartition(operatorHandler)); }));
+    }
+
+    /// Getting the operator handler from the local state
+    auto* localState = dynamic_cast<WindowOperatorBuildLocalState*>(ctx.getLocalState(id));
+    return getHashMapOfPartition(localState->getOperatorHandler());
+}
+
+nautilus::val<Interface::AbstractHashMapEntry*> HJBuildPhysicalOperator::insertRecord(
+    ExecutionContext& ctx, const Record& record, const nautilus::val<Interface::HashMap*>& hashMapPtr) const
+{
+    return insertIntoHashMap(ctx, record, hashMapPtr, hashMapOptions, bufferRef);
+}
+
+nautilus::val<Interface::AbstractHashMapEntry*> HJBuildPhysicalOperator::insertIntoHashMap(
+    ExecutionContext& ctx,
+    const Record& record,
+    const nautilus::val<Interface::HashMap*>& hashMapPtr,
+    const HashMapOptions& hashMapOptions,
+    const std::shared_ptr<Interface::BufferRef::TupleBufferRef>& bufferRef)
+{
+    const auto hashMap = hashMapOptions.createHashMapRef(hashMapPtr);
 
     /// Finding or creating the entry for the provided record
-    const auto hashMapEntry = hashMap.findOrCreateEntry(
+    const auto hashMapEntry = hashMap->findOrCreateEntry(
         record,
         *hashMapOptions.hashFunction,
         [&](const nautilus::val<Interface::AbstractHashMapEntry*>& entry)
@@ -173,6 +407,7 @@ void HJBuildPhysicalOperator::execute(ExecutionContext& ctx, Record& record) con
     auto entryMemArea = entryRef.getValueMemArea();
     const Nautilus::Interface::PagedVectorRef pagedVectorRef(entryMemArea, bufferRef);
     pagedVectorRef.writeRecord(record, ctx.pipelineMemoryProvider.bufferProvider);
+    return hashMapEntry;
 }
 
 HJBuildPhysicalOperator::HJBuildPhysicalOperator(
@@ -180,10 +415,19 @@ HJBuildPhysicalOperator::HJBuildPhysicalOperator(
     const JoinBuildSideType joinBuildSide,
     std::unique_ptr<TimeFunction> timeFunction,
     const std::shared_ptr<Interface::BufferRef::TupleBufferRef>& bufferRef,
-    HashMapOptions hashMapOptions)
+    HashMapOptions hashMapOptions,
+    const uint64_t numberOfPartitions,
+    std::optional<SymmetricHashJoinOptions> symmetricHashJoinOptions)
     : StreamJoinBuildPhysicalOperator(operatorHandlerId, joinBuildSide, std::move(timeFunction), bufferRef)
     , hashMapOptions(std::move(hashMapOptions))
+    , numberOfPartitions(numberOfPartitions)
+    , symmetricHashJoinOptions(std::move(symmetricHashJoinOptions))
 {
+    PRECONDITION(
+        std::has_single_bit(numberOfPartitions) and numberOfPartitions <= MAX_NUMBER_OF_PARTITIONS,
+        "The number of partitions {} must be a power of 2 and not larger than {}",
+        numberOfPartitions,
+        MAX_NUMBER_OF_PARTITIONS);
 }
 
 }
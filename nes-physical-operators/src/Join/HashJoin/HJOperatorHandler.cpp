@@ -16,38 +16,74 @@
 #include <Join/HashJoin/HJOperatorHandler.hpp>
 
 #include <algorithm>
-#include <chrono>
 #include <cstdint>
 #include <cstring>
 #include <functional>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <numeric>
 #include <utility>
 #include <vector>
 #include <Identifiers/Identifiers.hpp>
 #include <Join/HashJoin/HJSlice.hpp>
 #include <Join/StreamJoinOperatorHandler.hpp>
 #include <Join/StreamJoinUtil.hpp>
+#include <Nautilus/Interface/BloomFilter/BlockedBloomFilter.hpp>
+#include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMap.hpp>
 #include <Nautilus/Interface/HashMap/HashMap.hpp>
+#include <Runtime/TupleBuffer.hpp>
 #include <Sequencing/SequenceData.hpp>
 #include <SliceStore/Slice.hpp>
 #include <SliceStore/WindowSlicesStoreInterface.hpp>
+#include <Time/Timestamp.hpp>
 #include <Util/Logger/Logger.hpp>
 #include <ErrorHandling.hpp>
 #include <PipelineExecutionContext.hpp>
 
 namespace NES
 {
+
+namespace
+{
+/// Assigns each right hash map that joins any pairs to the probe task with the fewest pairs so far, starting with the largest hash map
+std::vector<std::vector<Nautilus::Interface::HashMap*>> balanceRightHashMaps(
+    std::vector<std::pair<Nautilus::Interface::HashMap*, uint64_t>> rightHashMapsWithPairs, const uint64_t numberOfProbeTasks)
+{
+    std::ranges::sort(rightHashMapsWithPairs, std::ranges::greater{}, &std::pair<Nautilus::Interface::HashMap*, uint64_t>::second);
+    std::vector<std::vector<Nautilus::Interface::HashMap*>> rightHashMapsPerTask(numberOfProbeTasks);
+    std::vector<uint64_t> pairsPerTask(numberOfProbeTasks, 0);
+    for (const auto& [hashMap, pairs] : rightHashMapsWithPairs)
+    {
+        const auto task = std::ranges::distance(pairsPerTask.begin(), std::ranges::min_element(pairsPerTask));
+        rightHashMapsPerTask[task].emplace_back(hashMap);
+        pairsPerTask[task] += pairs;
+    }
+    return rightHashMapsPerTask;
+}
+}
+
 HJOperatorHandler::HJOperatorHandler(
     const std::vector<OriginId>& inputOrigins,
     const OriginId outputOriginId,
     std::unique_ptr<WindowSlicesStoreInterface> sliceAndWindowStore,
-    const uint64_t maxNumberOfBuckets)
+    const uint64_t maxNumberOfBuckets,
+    const bool useBloomFilter,
+    const bool symmetric,
+    const uint64_t maxNumberOfProbeTasksPerPartition,
+    const bool shareSlicePairs)
     : StreamJoinOperatorHandler(inputOrigins, outputOriginId, std::move(sliceAndWindowStore))
     , setupAlreadyCalledLeft(false)
     , setupAlreadyCalledRight(false)
     , rollingAverageNumberOfKeys(RollingAverage<uint64_t>{100})
     , maxNumberOfBuckets(maxNumberOfBuckets)
+    , useBloomFilter(useBloomFilter)
+    , maxNumberOfProbeTasksPerPartition(maxNumberOfProbeTasksPerPartition)
+    , symmetric(symmetric)
+    , shareSlicePairs(shareSlicePairs)
 {
+    PRECONDITION(maxNumberOfProbeTasksPerPartition > 0, "A partition requires at least one probe task");
+    PRECONDITION(not(symmetric and shareSlicePairs), "A symmetric hash join joins the records in the builds and has no pairs of slices");
 }
 
 std::function<std::vector<std::shared_ptr<Slice>>(SliceStart, SliceEnd)>
@@ -58,6 +94,7 @@ HJOperatorHandler::getCreateNewSlicesFunction(const CreateNewSlicesArguments& ne
 
     auto newHashMapArgs = dynamic_cast<const CreateNewHashMapSliceArgs&>(newSlicesArguments);
     newHashMapArgs.numberOfBuckets = std::clamp(rollingAverageNumberOfKeys.rlock()->getAverage(), 1UL, maxNumberOfBuckets);
+    newHashMapArgs.hashMapRecycler = hashMapRecycler;
     return std::function(
         [outputOriginId = outputOriginId, numberOfWorkerThreads = numberOfWorkerThreads, copyOfNewHashMapArgs = newHashMapArgs](
             SliceStart sliceStart, SliceEnd sliceEnd) -> std::vector<std::shared_ptr<Slice>>
@@ -104,6 +141,103 @@ std::vector<std::shared_ptr<CreateNewHashMapSliceArgs::NautilusCleanupExec>> HJO
     return {leftCleanupStateNautilusFunction, rightCleanupStateNautilusFunction};
 }
 
+std::mutex& HJOperatorHandler::getSymmetricJoinMutex()
+{
+    return symmetricJoinMutex;
+}
+
+void HJOperatorHandler::emitJoinedRecords(
+    TupleBuffer& tupleBuffer,
+    const uint64_t numberOfRecords,
+    const SliceCreationTimestamps& creationTimestamps,
+    PipelineExecutionContext* pipelineCtx)
+{
+    PRECONDITION(symmetric, "Solely the builds of a symmetric hash join emit joined records");
+
+    /// Each buffer is a single chunk of its sequence number. We read the watermark after taking the sequence number, so that the watermarks
+    /// do not decrease with the sequence numbers, c.f., emitSlicesToProbe().
+    tupleBuffer.setOriginId(outputOriginId);
+    tupleBuffer.setSequenceNumber(SequenceNumber(nextSymmetricSequenceNumber++));
+    tupleBuffer.setChunkNumber(ChunkNumber(ChunkNumber::INITIAL));
+    tupleBuffer.setLastChunk(true);
+    tupleBuffer.setWatermark(Timestamp(symmetricWatermark.load()));
+    tupleBuffer.setNumberOfTuples(numberOfRecords);
+    setCreationTimestamps(tupleBuffer, creationTimestamps);
+    pipelineCtx->emitBuffer(tupleBuffer);
+}
+
+void HJOperatorHandler::triggerSlices(
+    const std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>>& slicesAndWindowInfo,
+    PipelineExecutionContext* pipelineCtx)
+{
+    if (not shareSlicePairs)
+    {
+        StreamJoinOperatorHandler::triggerSlices(slicesAndWindowInfo, pipelineCtx);
+        return;
+    }
+
+    const auto windowSize = sliceAndWindowStore->getWindowSize();
+    const auto windowSlide = sliceAndWindowStore->getWindowSlide();
+    for (const auto& [windowInfo, allSlices] : slicesAndWindowInfo)
+    {
+        /// Claiming all pairs of slices of the window that no other window has emitted yet. As several threads trigger windows
+        /// concurrently, a later window may claim a pair first. Thus, a pair is emitted for all windows containing it, not solely for the
+        /// windows from the claiming one on.
+        std::vector<std::pair<std::shared_ptr<Slice>, std::shared_ptr<Slice>>> claimedPairs;
+        {
+            auto lockedSlicePairs = emittedSlicePairs.wlock();
+            std::erase_if(*lockedSlicePairs, [](const auto& slicePair) { return slicePair.second.expired(); });
+            for (const auto& sliceLeft : allSlices)
+            {
+                for (const auto& sliceRight : allSlices)
+                {
+                    if (lockedSlicePairs->try_emplace({sliceLeft->getSliceEnd(), sliceRight->getSliceEnd()}, sliceLeft).second)
+                    {
+                        claimedPairs.emplace_back(sliceLeft, sliceRight);
+                    }
+                }
+            }
+        }
+
+        /// Every sequence number requires at least one chunk, even if all pairs of the window have been emitted by other windows
+        if (claimedPairs.empty())
+        {
+            const SequenceData sequenceData{windowInfo.sequenceNumber, ChunkNumber(ChunkNumber::INITIAL), true};
+            emitPartitionToProbe({}, {}, nullptr, {}, windowInfo.windowInfo, 1, sequenceData, pipelineCtx);
+            continue;
+        }
+
+        /// A window contains the pair, if it starts not after the first slice start and ends not before the last slice end, c.f.,
+        /// SliceAssigner::getAllWindowsForSlice()
+        ChunkNumber::Underlying chunkNumber = ChunkNumber::INITIAL;
+        for (const auto& [sliceLeft, sliceRight] : claimedPairs)
+        {
+            const auto pairStart = std::min(sliceLeft->getSliceStart(), sliceRight->getSliceStart()).getRawValue();
+            const auto pairEnd = std::max(sliceLeft->getSliceEnd(), sliceRight->getSliceEnd()).getRawValue();
+            const auto firstWindowStart
+                = pairEnd <= windowSize ? 0 : ((pairEnd - windowSize + windowSlide - 1) / windowSlide) * windowSlide;
+            const auto lastWindowStart = (pairStart / windowSlide) * windowSlide;
+            INVARIANT(
+                firstWindowStart <= lastWindowStart,
+                "The pair of slices {}-{} must belong to at least one window, as window {} contains it",
+                pairStart,
+                pairEnd,
+                windowInfo.windowInfo.windowStart);
+
+            const bool isLastChunk = chunkNumber == claimedPairs.size();
+            const SequenceData sequenceData{windowInfo.sequenceNumber, ChunkNumber(chunkNumber), isLastChunk};
+            emitSlicePairToProbe(
+                *sliceLeft,
+                *sliceRight,
+                WindowInfo{firstWindowStart, firstWindowStart + windowSize},
+                ((lastWindowStart - firstWindowStart) / windowSlide) + 1,
+                sequenceData,
+                pipelineCtx);
+            ++chunkNumber;
+        }
+    }
+}
+
 void HJOperatorHandler::emitSlicesToProbe(
     Slice& sliceLeft,
     Slice& sliceRight,
@@ -111,31 +245,193 @@ void HJOperatorHandler::emitSlicesToProbe(
     const SequenceData& sequenceData,
     PipelineExecutionContext* pipelineCtx)
 {
-    /// Counting how many tuples the probe has to check for this probe task
-    uint64_t totalNumberOfTuples = 0;
+    emitSlicePairToProbe(sliceLeft, sliceRight, windowInfo, 1, sequenceData, pipelineCtx);
+}
 
-    /// Getting all hash maps for the left and right slice
-    auto getHashMapsForSlice = [&](const Slice& slice, const JoinBuildSideType& buildSide)
+void HJOperatorHandler::emitSlicePairToProbe(
+    Slice& sliceLeft,
+    Slice& sliceRight,
+    const WindowInfo& windowInfo,
+    const uint64_t numberOfWindows,
+    const SequenceData& sequenceData,
+    PipelineExecutionContext* pipelineCtx)
+{
+    if (symmetric)
+    {
+        /// The builds have joined the records of the window already. Thus, we solely emit an empty buffer that advances the watermark.
+        /// As the window triggers and the joined records share the sequence numbers, we do not use the ones of the slice store.
+        symmetricWatermark = windowInfo.windowStart.getRawValue();
+        auto tupleBuffer = pipelineCtx->allocateTupleBuffer();
+        tupleBuffer.setOriginId(outputOriginId);
+        tupleBuffer.setSequenceNumber(SequenceNumber(nextSymmetricSequenceNumber++));
+        tupleBuffer.setChunkNumber(ChunkNumber(ChunkNumber::INITIAL));
+        tupleBuffer.setLastChunk(true);
+        tupleBuffer.setWatermark(windowInfo.windowStart);
+        tupleBuffer.setNumberOfTuples(0);
+        pipelineCtx->emitBuffer(tupleBuffer);
+        return;
+    }
+
+    auto* const hashJoinSliceLeft = dynamic_cast<HJSlice*>(&sliceLeft);
+    const auto* const hashJoinSliceRight = dynamic_cast<const HJSlice*>(&sliceRight);
+    INVARIANT(hashJoinSliceLeft != nullptr and hashJoinSliceRight != nullptr, "Slice must be of type HashMapSlice!");
+    INVARIANT(
+        hashJoinSliceLeft->getNumberOfPartitions() == hashJoinSliceRight->getNumberOfPartitions(),
+        "Both slices must have the same number of partitions, but got {} and {}",
+        hashJoinSliceLeft->getNumberOfPartitions(),
+        hashJoinSliceRight->getNumberOfPartitions());
+
+    /// Getting all hash maps of a partition for the left or right slice
+    auto getHashMapsForPartition = [&](const HJSlice& slice, const JoinBuildSideType& buildSide, const uint64_t partition)
     {
         std::vector<Nautilus::Interface::HashMap*> allHashMaps;
-        const auto* const hashJoinSlice = dynamic_cast<const HJSlice*>(&slice);
-        INVARIANT(hashJoinSlice != nullptr, "Slice must be of type HashMapSlice!");
-        for (uint64_t hashMapIdx = 0; hashMapIdx < hashJoinSlice->getNumberOfHashMapsForSide(); ++hashMapIdx)
+        for (uint64_t hashMapIdx = 0; hashMapIdx < slice.getNumberOfHashMapsForSide(); ++hashMapIdx)
         {
-            if (auto* hashMap = hashJoinSlice->getHashMapPtr(WorkerThreadId(hashMapIdx), buildSide);
+            if (auto* hashMap = slice.getHashMapPtr(WorkerThreadId(hashMapIdx), buildSide, partition);
                 hashMap and hashMap->getNumberOfTuples() > 0)
             {
                 /// As the hashmap has one value per key, we can use the number of tuples for the number of keys
                 rollingAverageNumberOfKeys.wlock()->add(hashMap->getNumberOfTuples());
+                const auto statistics = dynamic_cast<const Nautilus::Interface::ChainedHashMap*>(hashMap)->getBucketStatistics();
+                NES_DEBUG(
+                    "Hash join hash map of slice {}-{} stores {} keys in {} of {} buckets (average chain length {:.2f}) after {} resizes",
+                    slice.getSliceStart(),
+                    slice.getSliceEnd(),
+                    statistics.numberOfEntries,
+                    statistics.numberOfUsedBuckets,
+                    statistics.numberOfBuckets,
+                    statistics.getAverageChainLength(),
+                    statistics.numberOfResizes);
 
                 allHashMaps.emplace_back(hashMap);
-                totalNumberOfTuples += hashMap->getNumberOfTuples();
             }
         }
         return allHashMaps;
     };
-    const auto leftHashMaps = getHashMapsForSlice(sliceLeft, JoinBuildSideType::Left);
-    const auto rightHashMaps = getHashMapsForSlice(sliceRight, JoinBuildSideType::Right);
+
+    /// Reassigning the chunks of a pair of slices is solely possible, if it is the sole chunk of its sequence number, as otherwise each
+    /// pair must occupy as many chunks as there are partitions
+    const auto numberOfPartitions = hashJoinSliceLeft->getNumberOfPartitions();
+    const auto splitSkewedPartitions
+        = maxNumberOfProbeTasksPerPartition > 1 and sequenceData.chunkNumber == ChunkNumber::INITIAL and sequenceData.lastChunk;
+    std::vector<HJPartitionSkew> skewPerPartition;
+    uint64_t numberOfPairs = 0;
+    if (splitSkewedPartitions)
+    {
+        for (uint64_t partition = 0; partition < numberOfPartitions; ++partition)
+        {
+            const auto& skew = skewPerPartition.emplace_back(hashJoinSliceLeft->getPartitionSkew(*hashJoinSliceRight, partition));
+            numberOfPairs += skew.numberOfPairs;
+        }
+    }
+    /// Spreading the pairs evenly, each worker thread or partition, whatever is more, would join this many pairs
+    const auto targetPairsPerProbeTask
+        = std::max<uint64_t>(1, numberOfPairs / std::max<uint64_t>(numberOfPartitions, numberOfWorkerThreads));
+
+    struct ProbeTask
+    {
+        std::vector<Nautilus::Interface::HashMap*> leftHashMaps;
+        std::vector<Nautilus::Interface::HashMap*> rightHashMaps;
+        const Nautilus::Interface::BlockedBloomFilter* leftBloomFilter;
+    };
+    std::vector<ProbeTask> probeTasks;
+    uint64_t numberOfSplitPartitions = 0;
+    for (uint64_t partition = 0; partition < numberOfPartitions; ++partition)
+    {
+        auto leftHashMaps = getHashMapsForPartition(*hashJoinSliceLeft, JoinBuildSideType::Left, partition);
+        auto rightHashMaps = getHashMapsForPartition(*hashJoinSliceRight, JoinBuildSideType::Right, partition);
+        const auto* const leftBloomFilter = (useBloomFilter and not leftHashMaps.empty() and not rightHashMaps.empty())
+            ? hashJoinSliceLeft->getOrCreateBloomFilter(partition, pipelineCtx->getBufferManager().get())
+            : nullptr;
+        if (not splitSkewedPartitions or skewPerPartition[partition].numberOfPairsOfHeaviestKey <= targetPairsPerProbeTask)
+        {
+            probeTasks.emplace_back(std::move(leftHashMaps), std::move(rightHashMaps), leftBloomFilter);
+            continue;
+        }
+
+        /// The probe tasks of a split partition share the left hash maps, as the probe solely reads them. Right hash maps without any
+        /// joined pairs produce no output and, thus, do not need a probe task.
+        const auto& skew = skewPerPartition[partition];
+        std::vector<std::pair<Nautilus::Interface::HashMap*, uint64_t>> rightHashMapsWithPairs;
+        for (uint64_t hashMapIdx = 0; hashMapIdx < skew.numberOfPairsPerRightHashMap.size(); ++hashMapIdx)
+        {
+            if (skew.numberOfPairsPerRightHashMap[hashMapIdx] > 0)
+            {
+                rightHashMapsWithPairs.emplace_back(
+                    hashJoinSliceRight->getHashMapPtr(WorkerThreadId(hashMapIdx), JoinBuildSideType::Right, partition),
+                    skew.numberOfPairsPerRightHashMap[hashMapIdx]);
+            }
+        }
+        const auto numberOfProbeTasks = std::min(
+            {maxNumberOfProbeTasksPerPartition,
+             (skew.numberOfPairs + targetPairsPerProbeTask - 1) / targetPairsPerProbeTask,
+             static_cast<uint64_t>(rightHashMapsWithPairs.size())});
+        if (numberOfProbeTasks <= 1)
+        {
+            probeTasks.emplace_back(std::move(leftHashMaps), std::move(rightHashMaps), leftBloomFilter);
+            continue;
+        }
+        ++numberOfSplitPartitions;
+        for (auto& rightHashMapsOfTask : balanceRightHashMaps(std::move(rightHashMapsWithPairs), numberOfProbeTasks))
+        {
+            probeTasks.emplace_back(leftHashMaps, std::move(rightHashMapsOfTask), leftBloomFilter);
+        }
+    }
+
+    if (splitSkewedPartitions)
+    {
+        uint64_t numberOfJoinedKeys = 0;
+        uint64_t numberOfPairsOfHeaviestKey = 0;
+        for (const auto& skew : skewPerPartition)
+        {
+            numberOfJoinedKeys += skew.numberOfJoinedKeys;
+            numberOfPairsOfHeaviestKey = std::max(numberOfPairsOfHeaviestKey, skew.numberOfPairsOfHeaviestKey);
+        }
+        NES_DEBUG(
+            "Hash join window {}-{} joins {} pairs of {} keys, of which the heaviest key joins {} pairs. {} of {} partitions are skewed "
+            "and probed by {} tasks in total.",
+            windowInfo.windowStart,
+            windowInfo.windowEnd,
+            numberOfPairs,
+            numberOfJoinedKeys,
+            numberOfPairsOfHeaviestKey,
+            numberOfSplitPartitions,
+            numberOfPartitions,
+            probeTasks.size());
+    }
+
+    auto creationTimestamps = sliceLeft.getCreationTimestamps();
+    creationTimestamps.merge(sliceRight.getCreationTimestamps());
+
+    /// The chunks of the probe tasks follow each other. Solely the last probe task of the last pair of slices is the last chunk.
+    const auto firstChunkNumber = ((sequenceData.chunkNumber - ChunkNumber::INITIAL) * probeTasks.size()) + ChunkNumber::INITIAL;
+    for (uint64_t task = 0; task < probeTasks.size(); ++task)
+    {
+        const SequenceData taskSequenceData{
+            SequenceNumber(sequenceData.sequenceNumber),
+            ChunkNumber(firstChunkNumber + task),
+            sequenceData.lastChunk and task + 1 == probeTasks.size()};
+        const auto& [leftHashMaps, rightHashMaps, leftBloomFilter] = probeTasks[task];
+        emitPartitionToProbe(
+            leftHashMaps, rightHashMaps, leftBloomFilter, creationTimestamps, windowInfo, numberOfWindows, taskSequenceData, pipelineCtx);
+    }
+}
+
+void HJOperatorHandler::emitPartitionToProbe(
+    const std::vector<Nautilus::Interface::HashMap*>& leftHashMaps,
+    const std::vector<Nautilus::Interface::HashMap*>& rightHashMaps,
+    const Nautilus::Interface::BlockedBloomFilter* leftBloomFilter,
+    const SliceCreationTimestamps& creationTimestamps,
+    const WindowInfo& windowInfo,
+    const uint64_t numberOfWindows,
+    const SequenceData& sequenceData,
+    PipelineExecutionContext* pipelineCtx) const
+{
+    /// Counting how many tuples the probe has to check for this probe task
+    const auto countTuples = [](uint64_t runningSum, const Nautilus::Interface::HashMap* hashMap)
+    { return runningSum + hashMap->getNumberOfTuples(); };
+    const auto totalNumberOfTuples = std::accumulate(leftHashMaps.begin(), leftHashMaps.end(), uint64_t{0}, countTuples)
+        + std::accumulate(rightHashMaps.begin(), rightHashMaps.end(), uint64_t{0}, countTuples);
 
     /// We need a buffer that is large enough to store:
     /// - all pointers to (left + right) hashmaps of the window to be triggered
@@ -157,14 +453,14 @@ void HJOperatorHandler::emitSlicesToProbe(
     tupleBuffer.setLastChunk(sequenceData.lastChunk);
     tupleBuffer.setWatermark(windowInfo.windowStart);
     tupleBuffer.setNumberOfTuples(totalNumberOfTuples);
-    tupleBuffer.setCreationTimestampInMS(Timestamp(
-        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now().time_since_epoch()).count()));
+    setCreationTimestamps(tupleBuffer, creationTimestamps);
 
     /// Writing all necessary information for the probe to the buffer via the placement constructor
-    new (tupleBuffer.getAvailableMemoryArea().data()) EmittedHJWindowTrigger{windowInfo, leftHashMaps, rightHashMaps};
+    new (tupleBuffer.getAvailableMemoryArea().data()) EmittedHJWindowTrigger{
+        windowInfo, numberOfWindows, sliceAndWindowStore->getWindowSlide(), leftHashMaps, rightHashMaps, leftBloomFilter};
 
-    /// Dispatching the buffer to the probe operator via the task queue.
-    pipelineCtx->emitBuffer(tupleBuffer);
+    /// Dispatching the buffer to the probe operator via the task queue, which runs the triggers before other tasks by their window end.
+    pipelineCtx->emitBufferWithDeadline(tupleBuffer, windowInfo.windowEnd);
     NES_TRACE(
         "Triggered window {}-{} with watermarkTs {} sequenceNumber {} originId {} and {}-{} hashmaps",
         windowInfo.windowStart,
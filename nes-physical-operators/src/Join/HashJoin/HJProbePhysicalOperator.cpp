@@ -18,18 +18,22 @@
 #include <utility>
 #include <Functions/PhysicalFunction.hpp>
 #include <Join/HashJoin/HJOperatorHandler.hpp>
+#include <Join/HashJoin/HJSlice.hpp>
 #include <Join/StreamJoinProbePhysicalOperator.hpp>
 #include <Join/StreamJoinUtil.hpp>
 #include <Nautilus/DataTypes/DataTypesUtil.hpp>
+#include <Nautilus/Interface/BloomFilter/BlockedBloomFilter.hpp>
 #include <Nautilus/Interface/BufferRef/TupleBufferRef.hpp>
 #include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMapRef.hpp>
 #include <Nautilus/Interface/HashMap/HashMap.hpp>
 #include <Nautilus/Interface/PagedVector/PagedVectorRef.hpp>
+#include <Nautilus/Interface/Record.hpp>
 #include <Nautilus/Interface/RecordBuffer.hpp>
 #include <Nautilus/Interface/TimestampRef.hpp>
 #include <Runtime/Execution/OperatorHandler.hpp>
 #include <SliceStore/WindowSlicesStoreInterface.hpp>
 #include <Time/Timestamp.hpp>
+#include <Util/BloomFilterStatistics.hpp>
 #include <Windowing/WindowMetaData.hpp>
 #include <ErrorHandling.hpp>
 #include <ExecutionContext.hpp>
@@ -49,25 +53,130 @@ HJProbePhysicalOperator::HJProbePhysicalOperator(
     std::shared_ptr<Interface::BufferRef::TupleBufferRef> leftBufferRef,
     std::shared_ptr<Interface::BufferRef::TupleBufferRef> rightBufferRef,
     HashMapOptions leftHashMapBasedOptions,
-    HashMapOptions rightHashMapBasedOptions)
+    HashMapOptions rightHashMapBasedOptions,
+    const bool verifyCandidates,
+    std::shared_ptr<Interface::BufferRef::TupleBufferRef> symmetricJoinedBufferRef)
     : StreamJoinProbePhysicalOperator(operatorHandlerId, std::move(joinFunction), std::move(windowMetaData), std::move(joinSchema))
     , leftBufferRef(std::move(leftBufferRef))
     , rightBufferRef(std::move(rightBufferRef))
     , leftHashMapOptions(std::move(leftHashMapBasedOptions))
     , rightHashMapOptions(std::move(rightHashMapBasedOptions))
+    , verifyCandidates(verifyCandidates)
+    , symmetricJoinedBufferRef(std::move(symmetricJoinedBufferRef))
 {
 }
 
+void HJProbePhysicalOperator::passJoinedRecords(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const
+{
+    /// Window triggers solely carry the watermark and thus, contain no records
+    const auto fields = symmetricJoinedBufferRef->getMemoryLayout()->getSchema().getFieldNames();
+    for (nautilus::val<uint64_t> i = 0; i < recordBuffer.getNumRecords(); ++i)
+    {
+        auto joinedRecord = symmetricJoinedBufferRef->readRecord(fields, recordBuffer, i);
+        if (not verifyCandidates)
+        {
+            executeChild(executionCtx, joinedRecord);
+        }
+        else if (joinFunction.execute(joinedRecord, executionCtx.pipelineMemoryProvider.arena))
+        {
+            executeChild(executionCtx, joinedRecord);
+        }
+    }
+}
+
+void HJProbePhysicalOperator::executeChildForAllWindows(
+    ExecutionContext& executionCtx,
+    const Record& joinedRecord,
+    const nautilus::val<Timestamp>& windowStart,
+    const nautilus::val<Timestamp>& windowEnd,
+    const SharedWindows& sharedWindows) const
+{
+    /// Each window passes a copy of the joined record, as the children may overwrite its fields
+    nautilus::val<uint64_t> start = windowStart.convertToValue();
+    nautilus::val<uint64_t> end = windowEnd.convertToValue();
+    for (nautilus::val<uint64_t> window = 0; window < sharedWindows.numberOfWindows; ++window)
+    {
+        auto windowRecord = joinedRecord;
+        windowRecord.write(windowMetaData.windowStartFieldName, start);
+        windowRecord.write(windowMetaData.windowEndFieldName, end);
+        executeChild(executionCtx, windowRecord);
+        start = start + sharedWindows.windowSlide;
+        end = end + sharedWindows.windowSlide;
+    }
+}
+
+void HJProbePhysicalOperator::joinMatches(
+    const Interface::PagedVectorRef& leftPagedVector,
+    const Interface::PagedVectorRef& rightPagedVector,
+    ExecutionContext& executionCtx,
+    const nautilus::val<Timestamp>& windowStart,
+    const nautilus::val<Timestamp>& windowEnd,
+    const SharedWindows& sharedWindows) const
+{
+    const auto leftFields = leftBufferRef->getMemoryLayout()->getSchema().getFieldNames();
+    const auto rightFields = rightBufferRef->getMemoryLayout()->getSchema().getFieldNames();
+    for (auto leftIt = leftPagedVector.begin(leftFields); leftIt != leftPagedVector.end(leftFields); ++leftIt)
+    {
+        const auto leftRecord = *leftIt;
+        for (auto rightIt = rightPagedVector.begin(rightFields); rightIt != rightPagedVector.end(rightFields); ++rightIt)
+        {
+            auto joinedRecord = createJoinedRecord(leftRecord, *rightIt, windowStart, windowEnd, leftFields, rightFields);
+            executeChildForAllWindows(executionCtx, joinedRecord, windowStart, windowEnd, sharedWindows);
+        }
+    }
+}
+
+void HJProbePhysicalOperator::joinCandidates(
+    const Interface::PagedVectorRef& leftPagedVector,
+    const Interface::PagedVectorRef& rightPagedVector,
+    ExecutionContext& executionCtx,
+    const nautilus::val<Timestamp>& windowStart,
+    const nautilus::val<Timestamp>& windowEnd,
+    const SharedWindows& sharedWindows) const
+{
+    const auto leftKeyFields = getJoinFunctionFields(*leftBufferRef);
+    const auto rightKeyFields = getJoinFunctionFields(*rightBufferRef);
+    const auto leftRemainingFields = getRemainingFields(*leftBufferRef);
+    const auto rightRemainingFields = getRemainingFields(*rightBufferRef);
+
+    nautilus::val<uint64_t> leftPos(0);
+    for (auto leftIt = leftPagedVector.begin(leftKeyFields); leftIt != leftPagedVector.end(leftKeyFields); ++leftIt)
+    {
+        const auto leftKeyRecord = *leftIt;
+        nautilus::val<uint64_t> rightPos(0);
+        for (auto rightIt = rightPagedVector.begin(rightKeyFields); rightIt != rightPagedVector.end(rightKeyFields); ++rightIt)
+        {
+            auto joinedRecord = createJoinedRecord(leftKeyRecord, *rightIt, windowStart, windowEnd, leftKeyFields, rightKeyFields);
+            if (joinFunction.execute(joinedRecord, executionCtx.pipelineMemoryProvider.arena))
+            {
+                /// Solely reading the remaining fields of both records, if they satisfy the join function
+                materializeFields(joinedRecord, leftPagedVector, leftPos, leftRemainingFields);
+                materializeFields(joinedRecord, rightPagedVector, rightPos, rightRemainingFields);
+                executeChildForAllWindows(executionCtx, joinedRecord, windowStart, windowEnd, sharedWindows);
+            }
+            ++rightPos;
+        }
+        ++leftPos;
+    }
+}
+
 void HJProbePhysicalOperator::open(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const
 {
     /// As this operator functions as a scan, we have to set the execution context for this pipeline
     executionCtx.watermarkTs = recordBuffer.getWatermarkTs();
     executionCtx.currentTs = recordBuffer.getCreatingTs();
+    executionCtx.creationTs = recordBuffer.getCreatingTs();
+    executionCtx.latestCreationTs = recordBuffer.getLatestCreationTs();
     executionCtx.sequenceNumber = recordBuffer.getSequenceNumber();
     executionCtx.chunkNumber = recordBuffer.getChunkNumber();
     executionCtx.lastChunk = recordBuffer.isLastChunk();
     executionCtx.originId = recordBuffer.getOriginId();
     StreamJoinProbePhysicalOperator::open(executionCtx, recordBuffer);
+    if (symmetricJoinedBufferRef != nullptr)
+    {
+        passJoinedRecords(executionCtx, recordBuffer);
+        return;
+    }
 
     /// Getting number of hash maps and return if there are no hashmaps
     const auto hashJoinWindowRef = static_cast<nautilus::val<EmittedHJWindowTrigger*>>(recordBuffer.getMemArea());
@@ -86,65 +195,98 @@ void HJProbePhysicalOperator::open(ExecutionContext& executionCtx, RecordBuffer&
         Nautilus::Util::readValueFromMemRef<uint64_t>(Nautilus::Util::getMemberRef(windowInfoRef, &WindowInfo::windowStart))};
     const nautilus::val<Timestamp> windowEnd{
         Nautilus::Util::readValueFromMemRef<uint64_t>(Nautilus::Util::getMemberRef(windowInfoRef, &WindowInfo::windowEnd))};
+    const SharedWindows sharedWindows{
+        .numberOfWindows = Nautilus::Util::readValueFromMemRef<uint64_t>(
+            Nautilus::Util::getMemberRef(hashJoinWindowRef, &EmittedHJWindowTrigger::numberOfWindows)),
+        .windowSlide = Nautilus::Util::readValueFromMemRef<uint64_t>(
+            Nautilus::Util::getMemberRef(hashJoinWindowRef, &EmittedHJWindowTrigger::windowSlide))};
     auto leftHashMapRefs = Nautilus::Util::readValueFromMemRef<Interface::HashMap**>(
         Nautilus::Util::getMemberRef(hashJoinWindowRef, &EmittedHJWindowTrigger::leftHashMaps));
     auto rightHashMapRefs = Nautilus::Util::readValueFromMemRef<Interface::HashMap**>(
         Nautilus::Util::getMemberRef(hashJoinWindowRef, &EmittedHJWindowTrigger::rightHashMaps));
 
+    const auto leftBloomFilter = Nautilus::Util::readValueFromMemRef<Interface::BlockedBloomFilter*>(
+        Nautilus::Util::getMemberRef(hashJoinWindowRef, &EmittedHJWindowTrigger::leftBloomFilter));
+    nautilus::val<uint64_t> bloomFilterProbes = 0;
+    nautilus::val<uint64_t> bloomFilterHits = 0;
 
-    /// We iterate over all "left" hash maps and check if we find a tuple with the same key in the "right" hash maps
-    for (nautilus::val<uint64_t> leftHashMapIndex = 0; leftHashMapIndex < leftNumberOfHashMaps; ++leftHashMapIndex)
+    /// We iterate over all keys of the "right" hash maps and check if we find a tuple with the same key in the "left" hash maps.
+    /// As the Bloom filter covers the keys of all left hash maps, we check it once per right key before looking the key up.
+    /// Before looking up a right key, we prefetch the buckets of the next right key in all left hash maps. Thus, the cache misses of the
+    /// next lookups overlap with the lookups and the join of the current key, instead of stalling on one bucket after the other.
+    for (nautilus::val<uint64_t> rightHashMapIndex = 0; rightHashMapIndex < rightNumberOfHashMaps; ++rightHashMapIndex)
     {
-        const nautilus::val<Interface::HashMap*> leftHashMapPtr = leftHashMapRefs[leftHashMapIndex];
-        Interface::ChainedHashMapRef leftHashMap{
-            leftHashMapPtr,
-            leftHashMapOptions.fieldKeys,
-            leftHashMapOptions.fieldValues,
-            leftHashMapOptions.entriesPerPage,
-            leftHashMapOptions.entrySize};
-        for (nautilus::val<uint64_t> rightHashMapIndex = 0; rightHashMapIndex < rightNumberOfHashMaps; ++rightHashMapIndex)
+        const nautilus::val<Interface::HashMap*> rightHashMapPtr = rightHashMapRefs[rightHashMapIndex];
+        const Interface::ChainedHashMapRef rightHashMap{
+            rightHashMapPtr,
+            rightHashMapOptions.fieldKeys,
+            rightHashMapOptions.fieldValues,
+            rightHashMapOptions.entriesPerPage,
+            rightHashMapOptions.entrySize};
+        const auto rightEnd = rightHashMap.end();
+        for (auto rightIt = rightHashMap.begin(); rightIt != rightEnd; ++rightIt)
         {
-            const nautilus::val<Interface::HashMap*> rightHashMapPtr = rightHashMapRefs[rightHashMapIndex];
-            const Interface::ChainedHashMapRef rightHashMap{
-                rightHashMapPtr,
-                rightHashMapOptions.fieldKeys,
-                rightHashMapOptions.fieldValues,
-                rightHashMapOptions.entriesPerPage,
-                rightHashMapOptions.entrySize};
-            for (const auto rightEntry : rightHashMap)
+            auto nextRightIt = rightIt;
+            ++nextRightIt;
+            if (nextRightIt != rightEnd)
             {
-                const Interface::ChainedHashMapRef::ChainedEntryRef rightEntryRef{
-                    rightEntry, rightHashMapPtr, rightHashMapOptions.fieldKeys, rightHashMapOptions.fieldValues};
+                const Interface::ChainedHashMapRef::ChainedEntryRef nextRightEntryRef{
+                    *nextRightIt, rightHashMapPtr, rightHashMapOptions.fieldKeys, rightHashMapOptions.fieldValues};
+                Interface::ChainedHashMapRef::prefetchBuckets(leftHashMapRefs, leftNumberOfHashMaps, nextRightEntryRef.getHash());
+            }
+
+            const Interface::ChainedHashMapRef::ChainedEntryRef rightEntryRef{
+                *rightIt, rightHashMapPtr, rightHashMapOptions.fieldKeys, rightHashMapOptions.fieldValues};
+            ++bloomFilterProbes;
+            const auto mayContainKey = nautilus::invoke(
+                +[](const Interface::BlockedBloomFilter* bloomFilter, const uint64_t hash)
+                { return bloomFilter == nullptr or bloomFilter->mayContain(hash); },
+                leftBloomFilter,
+                rightEntryRef.getHash());
+            if (mayContainKey)
+            {
+                ++bloomFilterHits;
                 auto rightPagedVectorMem = rightEntryRef.getValueMemArea();
                 const Interface::PagedVectorRef rightPagedVector{rightPagedVectorMem, rightBufferRef};
-                const auto rightFields = rightBufferRef->getMemoryLayout()->getSchema().getFieldNames();
-                auto rightItStart = rightPagedVector.begin(rightFields);
-                auto rightItEnd = rightPagedVector.end(rightFields);
-
-                /// We use here findEntry as the other methods would insert a new entry, which is unnecessary
-                if (auto leftEntry = leftHashMap.findEntry(rightEntryRef.entryRef))
+                for (nautilus::val<uint64_t> leftHashMapIndex = 0; leftHashMapIndex < leftNumberOfHashMaps; ++leftHashMapIndex)
                 {
-                    /// At this moment, we can be sure that both paged vector contain only records that satisfy the join condition
-                    const Interface::ChainedHashMapRef::ChainedEntryRef leftEntryRef{
-                        leftEntry, leftHashMapPtr, leftHashMapOptions.fieldKeys, leftHashMapOptions.fieldValues};
-                    auto leftPagedVectorMem = leftEntryRef.getValueMemArea();
-                    const Interface::PagedVectorRef leftPagedVector{leftPagedVectorMem, leftBufferRef};
-                    const auto leftFields = leftBufferRef->getMemoryLayout()->getSchema().getFieldNames();
-
-                    for (auto leftIt = leftPagedVector.begin(leftFields); leftIt != leftPagedVector.end(leftFields); ++leftIt)
+                    const nautilus::val<Interface::HashMap*> leftHashMapPtr = leftHashMapRefs[leftHashMapIndex];
+                    const auto leftHashMap = leftHashMapOptions.createHashMapRef(leftHashMapPtr);
+
+                    /// We use here findEntry as the other methods would insert a new entry, which is unnecessary
+                    if (auto leftEntry = leftHashMap->findEntry(rightEntryRef.entryRef))
                     {
-                        for (auto rightIt = rightItStart; rightIt != rightItEnd; ++rightIt)
+                        /// At this moment, we can be sure that both paged vector contain only records that satisfy the join condition,
+                        /// unless the keys only denote candidates
+                        const Interface::ChainedHashMapRef::ChainedEntryRef leftEntryRef{
+                            leftEntry, leftHashMapPtr, leftHashMapOptions.fieldKeys, leftHashMapOptions.fieldValues};
+                        auto leftPagedVectorMem = leftEntryRef.getValueMemArea();
+                        const Interface::PagedVectorRef leftPagedVector{leftPagedVectorMem, leftBufferRef};
+                        if (verifyCandidates)
                         {
-                            const auto leftRecord = *leftIt;
-                            const auto rightRecord = *rightIt;
-                            auto joinedRecord
-                                = createJoinedRecord(leftRecord, rightRecord, windowStart, windowEnd, leftFields, rightFields);
-                            executeChild(executionCtx, joinedRecord);
+                            joinCandidates(leftPagedVector, rightPagedVector, executionCtx, windowStart, windowEnd, sharedWindows);
+                        }
+                        else
+                        {
+                            joinMatches(leftPagedVector, rightPagedVector, executionCtx, windowStart, windowEnd, sharedWindows);
                         }
                     }
                 }
             }
         }
     }
+
+    /// Adding the probes of this task at once, to not contend with other worker threads on the counters for every key
+    nautilus::invoke(
+        +[](const Interface::BlockedBloomFilter* bloomFilter, const uint64_t probes, const uint64_t hits)
+        {
+            if (bloomFilter != nullptr)
+            {
+                BloomFilterStatistics::getCounters(HJSlice::BLOOM_FILTER_STATISTICS_NAME).recordProbes(probes, hits);
+            }
+        },
+        leftBloomFilter,
+        bloomFilterProbes,
+        bloomFilterHits);
 }
 }
@@ -13,15 +13,24 @@
 */
 #include <Join/HashJoin/HJSlice.hpp>
 
+#include <algorithm>
+#include <bit>
 #include <cstdint>
 #include <memory>
+#include <mutex>
+#include <ranges>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 #include <Identifiers/Identifiers.hpp>
 #include <Join/StreamJoinUtil.hpp>
+#include <Nautilus/Interface/BloomFilter/BlockedBloomFilter.hpp>
 #include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMap.hpp>
 #include <Nautilus/Interface/HashMap/HashMap.hpp>
+#include <Nautilus/Interface/PagedVector/PagedVector.hpp>
+#include <Runtime/AbstractBufferProvider.hpp>
 #include <SliceStore/Slice.hpp>
+#include <Util/BloomFilterStatistics.hpp>
 #include <ErrorHandling.hpp>
 #include <HashMapSlice.hpp>
 
@@ -29,53 +38,154 @@ namespace NES
 {
 HJSlice::HJSlice(
     SliceStart sliceStart, SliceEnd sliceEnd, const CreateNewHashMapSliceArgs& createNewHashMapSliceArgs, const uint64_t numberOfHashMaps)
-    : HashMapSlice(std::move(sliceStart), std::move(sliceEnd), createNewHashMapSliceArgs, numberOfHashMaps, 2)
+    : HashMapSlice(
+          std::move(sliceStart),
+          std::move(sliceEnd),
+          createNewHashMapSliceArgs,
+          numberOfHashMaps * createNewHashMapSliceArgs.numberOfPartitions,
+          2)
+    , bloomFilters(createNewHashMapSliceArgs.numberOfPartitions)
 {
+    PRECONDITION(createNewHashMapSliceArgs.numberOfPartitions > 0, "A hash join slice requires at least one partition");
 }
 
-Nautilus::Interface::HashMap* HJSlice::getHashMapPtr(const WorkerThreadId workerThreadId, const JoinBuildSideType& buildSide) const
+uint64_t
+HJSlice::getHashMapPosition(const WorkerThreadId workerThreadId, const JoinBuildSideType& buildSide, const uint64_t partition) const
 {
+    PRECONDITION(
+        partition < createNewHashMapSliceArgs.numberOfPartitions,
+        "Partition {} is not smaller than the number of partitions {}",
+        partition,
+        createNewHashMapSliceArgs.numberOfPartitions);
+
     /// Hashmaps of the left build side come before right
-    auto pos = (workerThreadId % numberOfHashMapsPerInputStream)
+    const auto pos = ((workerThreadId % getNumberOfHashMapsForSide()) * createNewHashMapSliceArgs.numberOfPartitions) + partition
         + ((static_cast<uint64_t>(buildSide == JoinBuildSideType::Right) * numberOfHashMapsPerInputStream));
 
     INVARIANT(
         not hashMaps.empty() and pos < hashMaps.size(),
-        "No hashmap found for workerThreadId {} at pos {} for {} hashmaps",
+        "No hashmap found for workerThreadId {} and partition {} at pos {} for {} hashmaps",
         workerThreadId,
+        partition,
         pos,
         hashMaps.size());
-    return hashMaps[pos].get();
+    return pos;
 }
 
-Nautilus::Interface::HashMap* HJSlice::getHashMapPtrOrCreate(const WorkerThreadId workerThreadId, const JoinBuildSideType& buildSide)
+Nautilus::Interface::HashMap*
+HJSlice::getHashMapPtr(const WorkerThreadId workerThreadId, const JoinBuildSideType& buildSide, const uint64_t partition) const
 {
-    /// Hashmaps of the left build side come before right
-    auto pos = (workerThreadId % numberOfHashMapsPerInputStream)
-        + ((static_cast<uint64_t>(buildSide == JoinBuildSideType::Right) * numberOfHashMapsPerInputStream));
-
-    INVARIANT(
-        not hashMaps.empty() and pos < hashMaps.size(),
-        "No hashmap found for workerThreadId {} at pos {} for {} hashmaps",
-        workerThreadId,
-        pos,
-        hashMaps.size());
+    return hashMaps[getHashMapPosition(workerThreadId, buildSide, partition)].get();
+}
 
+Nautilus::Interface::HashMap*
+HJSlice::getHashMapPtrOrCreate(const WorkerThreadId workerThreadId, const JoinBuildSideType& buildSide, const uint64_t partition)
+{
+    const auto pos = getHashMapPosition(workerThreadId, buildSide, partition);
     if (hashMaps.at(pos) == nullptr)
     {
         /// Hashmap at pos has not been initialized
-        hashMaps.at(pos) = std::make_unique<Nautilus::Interface::ChainedHashMap>(
-            createNewHashMapSliceArgs.keySize,
-            createNewHashMapSliceArgs.valueSize,
-            createNewHashMapSliceArgs.numberOfBuckets,
-            createNewHashMapSliceArgs.pageSize);
+        hashMaps.at(pos) = createHashMap();
     }
     return hashMaps.at(pos).get();
 }
 
 uint64_t HJSlice::getNumberOfHashMapsForSide() const
 {
-    return numberOfHashMapsPerInputStream;
+    return numberOfHashMapsPerInputStream / createNewHashMapSliceArgs.numberOfPartitions;
+}
+
+uint64_t HJSlice::getNumberOfPartitions() const
+{
+    return createNewHashMapSliceArgs.numberOfPartitions;
+}
+
+const Nautilus::Interface::BlockedBloomFilter*
+HJSlice::getOrCreateBloomFilter(const uint64_t partition, AbstractBufferProvider* bufferProvider)
+{
+    const std::scoped_lock lock(bloomFilterMutex);
+    auto& bloomFilter = bloomFilters.at(partition);
+    if (bloomFilter != nullptr)
+    {
+        return bloomFilter.get();
+    }
+
+    std::vector<Nautilus::Interface::ChainedHashMap*> leftHashMaps;
+    uint64_t numberOfKeys = 0;
+    for (uint64_t workerThread = 0; workerThread < getNumberOfHashMapsForSide(); ++workerThread)
+    {
+        if (auto* hashMap = getHashMapPtr(WorkerThreadId(workerThread), JoinBuildSideType::Left, partition); hashMap != nullptr)
+        {
+            leftHashMaps.emplace_back(dynamic_cast<Nautilus::Interface::ChainedHashMap*>(hashMap));
+            numberOfKeys += hashMap->getNumberOfTuples();
+        }
+    }
+
+    /// As each entry stores the hash of its key, we do not have to hash the keys again
+    bloomFilter = std::make_unique<Nautilus::Interface::BlockedBloomFilter>(numberOfKeys, bufferProvider);
+    for (auto* hashMap : leftHashMaps)
+    {
+        hashMap->forEachEntry([&bloomFilter](const Nautilus::Interface::ChainedHashMapEntry* entry) { bloomFilter->add(entry->hash); });
+    }
+    BloomFilterStatistics::getCounters(BLOOM_FILTER_STATISTICS_NAME).recordFilter(bloomFilter->getSizeInBytes());
+    return bloomFilter.get();
+}
+
+HJPartitionSkew HJSlice::getPartitionSkew(const HJSlice& rightSlice, const uint64_t partition) const
+{
+    /// The paged vector of the records of a key follows the key in its entry
+    const auto valueOffset = sizeof(Nautilus::Interface::ChainedHashMapEntry) + createNewHashMapSliceArgs.keySize;
+    const auto getNumberOfRecords = [valueOffset](const Nautilus::Interface::ChainedHashMapEntry* entry)
+    {
+        return std::bit_cast<const Nautilus::Interface::PagedVector*>(std::bit_cast<const int8_t*>(entry) + valueOffset)
+            ->getTotalNumberOfEntries();
+    };
+    const auto forEachEntry
+        = [partition](const HJSlice& slice, const JoinBuildSideType buildSide, const uint64_t workerThread, const auto& function)
+    {
+        if (auto* hashMap
+            = dynamic_cast<Nautilus::Interface::ChainedHashMap*>(slice.getHashMapPtr(WorkerThreadId(workerThread), buildSide, partition)))
+        {
+            hashMap->forEachEntry(function);
+        }
+    };
+
+    std::unordered_map<uint64_t, uint64_t> leftRecordsPerKey;
+    for (uint64_t workerThread = 0; workerThread < getNumberOfHashMapsForSide(); ++workerThread)
+    {
+        forEachEntry(
+            *this,
+            JoinBuildSideType::Left,
+            workerThread,
+            [&](const Nautilus::Interface::ChainedHashMapEntry* entry) { leftRecordsPerKey[entry->hash] += getNumberOfRecords(entry); });
+    }
+
+    HJPartitionSkew skew{.numberOfPairsPerRightHashMap = std::vector<uint64_t>(rightSlice.getNumberOfHashMapsForSide(), 0)};
+    std::unordered_map<uint64_t, uint64_t> pairsPerKey;
+    for (uint64_t workerThread = 0; workerThread < rightSlice.getNumberOfHashMapsForSide(); ++workerThread)
+    {
+        forEachEntry(
+            rightSlice,
+            JoinBuildSideType::Right,
+            workerThread,
+            [&](const Nautilus::Interface::ChainedHashMapEntry* entry)
+            {
+                if (const auto leftRecords = leftRecordsPerKey.find(entry->hash); leftRecords != leftRecordsPerKey.end())
+                {
+                    const auto pairs = leftRecords->second * getNumberOfRecords(entry);
+                    skew.numberOfPairsPerRightHashMap[workerThread] += pairs;
+                    pairsPerKey[entry->hash] += pairs;
+                }
+            });
+    }
+
+    skew.numberOfJoinedKeys = pairsPerKey.size();
+    for (const auto& pairs : pairsPerKey | std::views::values)
+    {
+        skew.numberOfPairs += pairs;
+        skew.numberOfPairsOfHeaviestKey = std::max(skew.numberOfPairsOfHeaviestKey, pairs);
+    }
+    return skew;
 }
 
 }
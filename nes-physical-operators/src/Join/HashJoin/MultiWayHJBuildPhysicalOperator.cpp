@@ -0,0 +1,131 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Join/HashJoin/MultiWayHJBuildPhysicalOperator.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <Identifiers/Identifiers.hpp>
+#include <Join/HashJoin/HJBuildPhysicalOperator.hpp>
+#include <Join/HashJoin/MultiWayHJOperatorHandler.hpp>
+#include <Join/HashJoin/MultiWayHJSlice.hpp>
+#include <Nautilus/Interface/BufferRef/TupleBufferRef.hpp>
+#include <Nautilus/Interface/HashMap/HashMap.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <Runtime/Execution/OperatorHandler.hpp>
+#include <Time/Timestamp.hpp>
+#include <Watermark/TimeFunction.hpp>
+#include <CompilationContext.hpp>
+#include <ErrorHandling.hpp>
+#include <ExecutionContext.hpp>
+#include <HashMapOptions.hpp>
+#include <HashMapSlice.hpp>
+#include <WindowBuildPhysicalOperator.hpp>
+#include <function.hpp>
+#include <static.hpp>
+#include <val_ptr.hpp>
+
+namespace NES
+{
+Interface::HashMap* getMultiWayHashJoinHashMapProxy(
+    const MultiWayHJOperatorHandler* operatorHandler,
+    const Timestamp timestamp,
+    const WorkerThreadId workerThreadId,
+    const uint64_t input,
+    const MultiWayHJBuildPhysicalOperator* buildOperator)
+{
+    PRECONDITION(operatorHandler != nullptr, "The operator handler should not be null");
+    PRECONDITION(buildOperator != nullptr, "The build operator should not be null");
+
+    const CreateNewHashMapSliceArgs hashMapSliceArgs{
+        operatorHandler->getNautilusCleanupExec(),
+        buildOperator->hashMapOptions.keySize,
+        buildOperator->hashMapOptions.valueSize,
+        buildOperator->hashMapOptions.pageSize,
+        buildOperator->hashMapOptions.numberOfBuckets,
+        buildOperator->hashMapOptions.hashMapType};
+    const auto hashMap = operatorHandler->getSliceAndWindowStore().getSlicesOrCreate(
+        timestamp, operatorHandler->getCreateNewSlicesFunction(hashMapSliceArgs));
+    INVARIANT(
+        hashMap.size() == 1,
+        "We expect exactly one slice for the given timestamp during the MultiWayHashJoinBuild, as we currently solely support "
+        "slicing, but got {}",
+        hashMap.size());
+
+    /// The slice store keeps the slice alive, until the probe has processed its window
+    auto* const multiWayHJSlice = dynamic_cast<MultiWayHJSlice*>(hashMap[0].get());
+    INVARIANT(multiWayHJSlice != nullptr, "The slice should be a MultiWayHJSlice in a MultiWayHJBuildPhysicalOperator");
+    return multiWayHJSlice->getHashMapPtrOrCreate(workerThreadId, input);
+}
+
+void MultiWayHJBuildPhysicalOperator::setup(ExecutionContext& executionCtx, CompilationContext& compilationContext) const
+{
+    WindowBuildPhysicalOperator::setup(executionCtx, compilationContext);
+
+    /// Creating the cleanup function for the slice of current input
+    auto* operatorHandler = dynamic_cast<MultiWayHJOperatorHandler*>(executionCtx.getGlobalOperatorHandler(operatorHandlerId).value);
+    if (operatorHandler->wasSetupCalled(input))
+    {
+        return;
+    }
+    operatorHandler->setNautilusCleanupExec(HJBuildPhysicalOperator::createCleanupFunction(compilationContext, hashMapOptions), input);
+}
+
+void MultiWayHJBuildPhysicalOperator::execute(ExecutionContext& ctx, Record& record) const
+{
+    const auto timestamp = timeFunction->getTs(ctx, record);
+    if (not isLateRecord(ctx, timestamp))
+    {
+        /// Calling the key functions to add/update the keys to the record
+        for (nautilus::static_val<uint64_t> i = 0; i < hashMapOptions.fieldKeys.size(); ++i)
+        {
+            const auto& [fieldIdentifier, type, fieldOffset] = hashMapOptions.fieldKeys[i];
+            const auto& function = hashMapOptions.keyFunctions[i];
+            const auto value = function.execute(record, ctx.pipelineMemoryProvider.arena);
+            record.write(fieldIdentifier, value);
+        }
+
+        /// Get the current slice / hash map of our input that we have to insert the tuple into
+        const auto hashMapPtr = static_cast<nautilus::val<Interface::HashMap*>>(getSliceStateCached(
+            ctx,
+            timestamp,
+            [&](const nautilus::val<OperatorHandler*>& operatorHandler)
+            {
+                return static_cast<nautilus::val<int8_t*>>(invoke(
+                    getMultiWayHashJoinHashMapProxy,
+                    operatorHandler,
+                    timestamp,
+                    ctx.workerThreadId,
+                    nautilus::val<uint64_t>(input),
+                    nautilus::val<const MultiWayHJBuildPhysicalOperator*>(this)));
+            }));
+        HJBuildPhysicalOperator::insertIntoHashMap(ctx, record, hashMapPtr, hashMapOptions, bufferRef);
+    }
+}
+
+MultiWayHJBuildPhysicalOperator::MultiWayHJBuildPhysicalOperator(
+    const OperatorHandlerId operatorHandlerId,
+    const uint64_t input,
+    std::unique_ptr<TimeFunction> timeFunction,
+    std::shared_ptr<Interface::BufferRef::TupleBufferRef> bufferRef,
+    HashMapOptions hashMapOptions)
+    : WindowBuildPhysicalOperator(operatorHandlerId, std::move(timeFunction))
+    , input(input)
+    , bufferRef(std::move(bufferRef))
+    , hashMapOptions(std::move(hashMapOptions))
+{
+}
+
+}
@@ -0,0 +1,184 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Join/HashJoin/MultiWayHJOperatorHandler.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
+#include <Join/HashJoin/MultiWayHJSlice.hpp>
+#include <Nautilus/Interface/HashMap/HashMap.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <SliceStore/Slice.hpp>
+#include <SliceStore/WindowSlicesStoreInterface.hpp>
+#include <Time/Timestamp.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <ErrorHandling.hpp>
+#include <HashMapSlice.hpp>
+#include <PipelineExecutionContext.hpp>
+#include <WindowBasedOperatorHandler.hpp>
+
+namespace NES
+{
+MultiWayHJOperatorHandler::MultiWayHJOperatorHandler(
+    const std::vector<OriginId>& inputOrigins,
+    const OriginId outputOriginId,
+    std::unique_ptr<WindowSlicesStoreInterface> sliceAndWindowStore,
+    const uint64_t numberOfInputs,
+    const uint64_t maxNumberOfBuckets)
+    : WindowBasedOperatorHandler(inputOrigins, outputOriginId, std::move(sliceAndWindowStore))
+    , numberOfInputs(numberOfInputs)
+    , setupAlreadyCalled(numberOfInputs)
+    , cleanupStateNautilusFunctions(numberOfInputs)
+    , rollingAverageNumberOfKeys(RollingAverage<uint64_t>{100})
+    , maxNumberOfBuckets(maxNumberOfBuckets)
+{
+    PRECONDITION(numberOfInputs >= 2, "A multi-way hash join requires at least two inputs, but got {}", numberOfInputs);
+}
+
+std::function<std::vector<std::shared_ptr<Slice>>(SliceStart, SliceEnd)>
+MultiWayHJOperatorHandler::getCreateNewSlicesFunction(const CreateNewSlicesArguments& newSlicesArguments) const
+{
+    PRECONDITION(
+        numberOfWorkerThreads > 0, "Number of worker threads not set for window based operator. Has setWorkerThreads() being called?");
+
+    auto newHashMapArgs = dynamic_cast<const CreateNewHashMapSliceArgs&>(newSlicesArguments);
+    newHashMapArgs.numberOfBuckets = std::clamp(rollingAverageNumberOfKeys.rlock()->getAverage(), 1UL, maxNumberOfBuckets);
+    newHashMapArgs.hashMapRecycler = hashMapRecycler;
+    return std::function(
+        [outputOriginId = outputOriginId,
+         numberOfWorkerThreads = numberOfWorkerThreads,
+         numberOfInputs = numberOfInputs,
+         copyOfNewHashMapArgs = newHashMapArgs](SliceStart sliceStart, SliceEnd sliceEnd) -> std::vector<std::shared_ptr<Slice>>
+        {
+            NES_TRACE("Creating new multi-way hash-join slice for slice {}-{} for output origin {}", sliceStart, sliceEnd, outputOriginId);
+            return {std::make_shared<MultiWayHJSlice>(sliceStart, sliceEnd, copyOfNewHashMapArgs, numberOfWorkerThreads, numberOfInputs)};
+        });
+}
+
+bool MultiWayHJOperatorHandler::wasSetupCalled(const uint64_t input)
+{
+    bool expectedValue = false;
+    return not setupAlreadyCalled.at(input).compare_exchange_strong(expectedValue, true);
+}
+
+void MultiWayHJOperatorHandler::setNautilusCleanupExec(
+    std::shared_ptr<CreateNewHashMapSliceArgs::NautilusCleanupExec> nautilusCleanupExec, const uint64_t input)
+{
+    cleanupStateNautilusFunctions.at(input) = std::move(nautilusCleanupExec);
+}
+
+std::vector<std::shared_ptr<CreateNewHashMapSliceArgs::NautilusCleanupExec>> MultiWayHJOperatorHandler::getNautilusCleanupExec() const
+{
+    return cleanupStateNautilusFunctions;
+}
+
+void MultiWayHJOperatorHandler::triggerSlices(
+    const std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>>& slicesAndWindowInfo,
+    PipelineExecutionContext* pipelineCtx)
+{
+    /// In contrast to the binary joins, we do not have to emit all combinations of slices. Each record of a window is in exactly one hash map
+    /// of the slices of the window. Thus, probing the hash maps of all slices of all inputs at once joins each combination of records once.
+    for (const auto& [windowInfo, allSlices] : slicesAndWindowInfo)
+    {
+        std::vector<std::vector<Nautilus::Interface::HashMap*>> inputHashMaps(numberOfInputs);
+        SliceCreationTimestamps creationTimestamps;
+        for (const auto& slice : allSlices)
+        {
+            creationTimestamps.merge(slice->getCreationTimestamps());
+            const auto* const multiWayHJSlice = dynamic_cast<const MultiWayHJSlice*>(slice.get());
+            INVARIANT(multiWayHJSlice != nullptr, "Slice must be of type MultiWayHJSlice!");
+            for (uint64_t input = 0; input < numberOfInputs; ++input)
+            {
+                for (uint64_t hashMapIdx = 0; hashMapIdx < multiWayHJSlice->getNumberOfHashMapsForInput(); ++hashMapIdx)
+                {
+                    if (auto* hashMap = multiWayHJSlice->getHashMapPtr(WorkerThreadId(hashMapIdx), input);
+                        hashMap and hashMap->getNumberOfTuples() > 0)
+                    {
+                        /// As the hashmap has one value per key, we can use the number of tuples for the number of keys
+                        rollingAverageNumberOfKeys.wlock()->add(hashMap->getNumberOfTuples());
+                        inputHashMaps[input].emplace_back(hashMap);
+                    }
+                }
+            }
+        }
+        emitWindowToProbe(inputHashMaps, creationTimestamps, windowInfo.windowInfo, windowInfo.sequenceNumber, pipelineCtx);
+    }
+}
+
+void MultiWayHJOperatorHandler::emitWindowToProbe(
+    const std::vector<std::vector<Nautilus::Interface::HashMap*>>& inputHashMaps,
+    const SliceCreationTimestamps& creationTimestamps,
+    const WindowInfo& windowInfo,
+    const SequenceNumber sequenceNumber,
+    PipelineExecutionContext* pipelineCtx) const
+{
+    /// Counting how many tuples the probe has to check for this probe task
+    uint64_t totalNumberOfHashMaps = 0;
+    uint64_t totalNumberOfTuples = 0;
+    for (const auto& hashMaps : inputHashMaps)
+    {
+        totalNumberOfHashMaps += hashMaps.size();
+        for (const auto* hashMap : hashMaps)
+        {
+            totalNumberOfTuples += hashMap->getNumberOfTuples();
+        }
+    }
+
+    /// We need a buffer that is large enough to store:
+    /// - size of EmittedMultiWayHJWindowTrigger
+    /// - the number of hash maps of each input
+    /// - all pointers to the hashmaps of all inputs of the window to be triggered
+    const auto neededBufferSize = sizeof(EmittedMultiWayHJWindowTrigger) + (inputHashMaps.size() * sizeof(uint64_t))
+        + (totalNumberOfHashMaps * sizeof(Nautilus::Interface::HashMap*));
+    const auto tupleBufferVal = pipelineCtx->getBufferManager()->getUnpooledBuffer(neededBufferSize);
+    if (not tupleBufferVal.has_value())
+    {
+        throw CannotAllocateBuffer("{}B for the multi-way hash join window trigger were requested", neededBufferSize);
+    }
+
+    /// As we are here "emitting" a buffer, we have to set the originId, the seq number, the watermark and the "number of tuples".
+    /// The watermark cannot be the slice end as some buffers might be still waiting to get processed.
+    /// Each window is a single chunk of its sequence number.
+    auto tupleBuffer = tupleBufferVal.value();
+    tupleBuffer.setOriginId(outputOriginId);
+    tupleBuffer.setSequenceNumber(sequenceNumber);
+    tupleBuffer.setChunkNumber(ChunkNumber(ChunkNumber::INITIAL));
+    tupleBuffer.setLastChunk(true);
+    tupleBuffer.setWatermark(windowInfo.windowStart);
+    tupleBuffer.setNumberOfTuples(totalNumberOfTuples);
+    setCreationTimestamps(tupleBuffer, creationTimestamps);
+
+    /// Writing all necessary information for the probe to the buffer via the placement constructor
+    new (tupleBuffer.getAvailableMemoryArea().data()) EmittedMultiWayHJWindowTrigger{windowInfo, inputHashMaps};
+
+    /// Dispatching the buffer to the probe operator via the task queue, which runs the triggers before other tasks by their window end.
+    pipelineCtx->emitBufferWithDeadline(tupleBuffer, windowInfo.windowEnd);
+    NES_TRACE(
+        "Triggered window {}-{} with watermarkTs {} sequenceNumber {} originId {} and {} hashmaps of {} inputs",
+        windowInfo.windowStart,
+        windowInfo.windowEnd,
+        tupleBuffer.getWatermark(),
+        tupleBuffer.getSequenceNumber(),
+        tupleBuffer.getOriginId(),
+        totalNumberOfHashMaps,
+        inputHashMaps.size());
+}
+
+}
@@ -0,0 +1,186 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+#include <Join/HashJoin/MultiWayHJProbePhysicalOperator.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <Join/HashJoin/MultiWayHJOperatorHandler.hpp>
+#include <Nautilus/DataTypes/DataTypesUtil.hpp>
+#include <Nautilus/Interface/BufferRef/TupleBufferRef.hpp>
+#include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMapRef.hpp>
+#include <Nautilus/Interface/HashMap/HashMap.hpp>
+#include <Nautilus/Interface/PagedVector/PagedVectorRef.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <Nautilus/Interface/RecordBuffer.hpp>
+#include <Runtime/Execution/OperatorHandler.hpp>
+#include <SliceStore/WindowSlicesStoreInterface.hpp>
+#include <Time/Timestamp.hpp>
+#include <Windowing/WindowMetaData.hpp>
+#include <ErrorHandling.hpp>
+#include <ExecutionContext.hpp>
+#include <HashMapOptions.hpp>
+#include <WindowProbePhysicalOperator.hpp>
+#include <function.hpp>
+#include <static.hpp>
+#include <val.hpp>
+#include <val_ptr.hpp>
+
+namespace NES
+{
+
+MultiWayHJProbePhysicalOperator::MultiWayHJProbePhysicalOperator(
+    const OperatorHandlerId operatorHandlerId,
+    std::vector<WindowMetaData> windowMetaData,
+    std::vector<std::shared_ptr<Interface::BufferRef::TupleBufferRef>> bufferRefs,
+    std::vector<HashMapOptions> hashMapOptions)
+    : WindowProbePhysicalOperator(operatorHandlerId, windowMetaData.at(0))
+    , allWindowMetaData(std::move(windowMetaData))
+    , bufferRefs(std::move(bufferRefs))
+    , hashMapOptions(std::move(hashMapOptions))
+{
+    PRECONDITION(
+        this->bufferRefs.size() >= 2 and this->bufferRefs.size() == this->hashMapOptions.size()
+            and this->allWindowMetaData.size() == this->bufferRefs.size() - 1,
+        "A multi-way join requires a buffer ref and hash map options for each of at least two inputs and window fields for each join");
+}
+
+void MultiWayHJProbePhysicalOperator::joinFactRecords(
+    const Record& joinedRecord,
+    const Interface::ChainedHashMapRef::ChainedEntryRef& factEntryRef,
+    ExecutionContext& executionCtx,
+    const nautilus::val<Timestamp>& windowStart,
+    const nautilus::val<Timestamp>& windowEnd) const
+{
+    const auto factFields = bufferRefs[0]->getMemoryLayout()->getSchema().getFieldNames();
+    auto factPagedVectorMem = factEntryRef.getValueMemArea();
+    const Interface::PagedVectorRef factPagedVector{factPagedVectorMem, bufferRefs[0]};
+    for (auto factIt = factPagedVector.begin(factFields); factIt != factPagedVector.end(factFields); ++factIt)
+    {
+        const auto factRecord = *factIt;
+        auto outputRecord = joinedRecord;
+        for (const auto& [windowStartFieldName, windowEndFieldName] : nautilus::static_iterable(allWindowMetaData))
+        {
+            outputRecord.write(windowStartFieldName, windowStart.convertToValue());
+            outputRecord.write(windowEndFieldName, windowEnd.convertToValue());
+        }
+        for (const auto& fieldName : nautilus::static_iterable(factFields))
+        {
+            outputRecord.write(fieldName, factRecord.read(fieldName));
+        }
+        executeChild(executionCtx, outputRecord);
+    }
+}
+
+void MultiWayHJProbePhysicalOperator::joinInput(
+    const uint64_t input,
+    const Record& joinedRecord,
+    const Interface::ChainedHashMapRef::ChainedEntryRef& factEntryRef,
+    const std::vector<InputHashMaps>& inputHashMaps,
+    ExecutionContext& executionCtx,
+    const nautilus::val<Timestamp>& windowStart,
+    const nautilus::val<Timestamp>& windowEnd) const
+{
+    if (input == inputHashMaps.size())
+    {
+        joinFactRecords(joinedRecord, factEntryRef, executionCtx, windowStart, windowEnd);
+        return;
+    }
+
+    const auto& options = hashMapOptions[input];
+    const auto fields = bufferRefs[input]->getMemoryLayout()->getSchema().getFieldNames();
+    const auto& [numberOfHashMaps, hashMaps] = inputHashMaps[input];
+    for (nautilus::val<uint64_t> hashMapIndex = 0; hashMapIndex < numberOfHashMaps; ++hashMapIndex)
+    {
+        const nautilus::val<Interface::HashMap*> hashMapPtr = hashMaps[hashMapIndex];
+        const auto hashMap = options.createHashMapRef(hashMapPtr);
+
+        /// We use here findEntry as the other methods would insert a new entry, which is unnecessary
+        if (auto entry = hashMap->findEntry(factEntryRef.entryRef))
+        {
+            const Interface::ChainedHashMapRef::ChainedEntryRef entryRef{entry, hashMapPtr, options.fieldKeys, options.fieldValues};
+            auto pagedVectorMem = entryRef.getValueMemArea();
+            const Interface::PagedVectorRef pagedVector{pagedVectorMem, bufferRefs[input]};
+            for (auto it = pagedVector.begin(fields); it != pagedVector.end(fields); ++it)
+            {
+                const auto record = *it;
+                auto nextJoinedRecord = joinedRecord;
+                for (const auto& fieldName : nautilus::static_iterable(fields))
+                {
+                    nextJoinedRecord.write(fieldName, record.read(fieldName));
+                }
+                joinInput(input + 1, nextJoinedRecord, factEntryRef, inputHashMaps, executionCtx, windowStart, windowEnd);
+            }
+        }
+    }
+}
+
+void MultiWayHJProbePhysicalOperator::open(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const
+{
+    /// As this operator functions as a scan, we have to set the execution context for this pipeline
+    executionCtx.watermarkTs = recordBuffer.getWatermarkTs();
+    executionCtx.currentTs = recordBuffer.getCreatingTs();
+    executionCtx.creationTs = recordBuffer.getCreatingTs();
+    executionCtx.latestCreationTs = recordBuffer.getLatestCreationTs();
+    executionCtx.sequenceNumber = recordBuffer.getSequenceNumber();
+    executionCtx.chunkNumber = recordBuffer.getChunkNumber();
+    executionCtx.lastChunk = recordBuffer.isLastChunk();
+    executionCtx.originId = recordBuffer.getOriginId();
+    WindowProbePhysicalOperator::open(executionCtx, recordBuffer);
+
+    /// Getting the hash maps of all inputs and return if any input has no hash maps, as then, no record can join
+    const auto windowTriggerRef = static_cast<nautilus::val<EmittedMultiWayHJWindowTrigger*>>(recordBuffer.getMemArea());
+    std::vector<InputHashMaps> inputHashMaps;
+    for (nautilus::static_val<uint64_t> input = 0; input < bufferRefs.size(); ++input)
+    {
+        const auto numberOfHashMaps = nautilus::invoke(
+            +[](const EmittedMultiWayHJWindowTrigger* windowTrigger, const uint64_t input) { return windowTrigger->numberOfHashMaps[input]; },
+            windowTriggerRef,
+            nautilus::val<uint64_t>(input));
+        if (numberOfHashMaps == 0)
+        {
+            return;
+        }
+        const auto hashMaps = nautilus::invoke(
+            +[](const EmittedMultiWayHJWindowTrigger* windowTrigger, const uint64_t input) { return windowTrigger->getHashMaps(input); },
+            windowTriggerRef,
+            nautilus::val<uint64_t>(input));
+        inputHashMaps.emplace_back(numberOfHashMaps, hashMaps);
+    }
+
+    const auto windowInfoRef = Nautilus::Util::getMemberRef(windowTriggerRef, &EmittedMultiWayHJWindowTrigger::windowInfo);
+    const nautilus::val<Timestamp> windowStart{
+        Nautilus::Util::readValueFromMemRef<uint64_t>(Nautilus::Util::getMemberRef(windowInfoRef, &WindowInfo::windowStart))};
+    const nautilus::val<Timestamp> windowEnd{
+        Nautilus::Util::readValueFromMemRef<uint64_t>(Nautilus::Util::getMemberRef(windowInfoRef, &WindowInfo::windowEnd))};
+
+    /// We iterate a single time over all keys of the fact side and join the records of all other inputs with the same key
+    const auto& factOptions = hashMapOptions[0];
+    const auto& [factNumberOfHashMaps, factHashMaps] = inputHashMaps[0];
+    for (nautilus::val<uint64_t> factHashMapIndex = 0; factHashMapIndex < factNumberOfHashMaps; ++factHashMapIndex)
+    {
+        const nautilus::val<Interface::HashMap*> factHashMapPtr = factHashMaps[factHashMapIndex];
+        const Interface::ChainedHashMapRef factHashMap{
+            factHashMapPtr, factOptions.fieldKeys, factOptions.fieldValues, factOptions.entriesPerPage, factOptions.entrySize};
+        for (auto factIt = factHashMap.begin(); factIt != factHashMap.end(); ++factIt)
+        {
+            const Interface::ChainedHashMapRef::ChainedEntryRef factEntryRef{
+                *factIt, factHashMapPtr, factOptions.fieldKeys, factOptions.fieldValues};
+            joinInput(1, Record{}, factEntryRef, inputHashMaps, executionCtx, windowStart, windowEnd);
+        }
+    }
+}
+
+}
@@ -0,0 +1,80 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Join/HashJoin/MultiWayHJSlice.hpp>
+
+#include <cstdint>
+#include <utility>
+#include <Identifiers/Identifiers.hpp>
+#include <Nautilus/Interface/HashMap/HashMap.hpp>
+#include <SliceStore/Slice.hpp>
+#include <ErrorHandling.hpp>
+#include <HashMapSlice.hpp>
+
+namespace NES
+{
+MultiWayHJSlice::MultiWayHJSlice(
+    SliceStart sliceStart,
+    SliceEnd sliceEnd,
+    const CreateNewHashMapSliceArgs& createNewHashMapSliceArgs,
+    const uint64_t numberOfHashMaps,
+    const uint64_t numberOfInputs)
+    : HashMapSlice(std::move(sliceStart), std::move(sliceEnd), createNewHashMapSliceArgs, numberOfHashMaps, numberOfInputs)
+{
+    PRECONDITION(numberOfInputs >= 2, "A multi-way hash join requires at least two inputs, but got {}", numberOfInputs);
+}
+
+uint64_t MultiWayHJSlice::getHashMapPosition(const WorkerThreadId workerThreadId, const uint64_t input) const
+{
+    PRECONDITION(input < numberOfInputStreams, "Input {} is not smaller than the number of inputs {}", input, numberOfInputStreams);
+
+    /// Hashmaps of an input come before the ones of the next input
+    const auto pos = (workerThreadId % numberOfHashMapsPerInputStream) + (input * numberOfHashMapsPerInputStream);
+    INVARIANT(
+        pos < hashMaps.size(),
+        "No hashmap found for workerThreadId {} and input {} at pos {} for {} hashmaps",
+        workerThreadId,
+        input,
+        pos,
+        hashMaps.size());
+    return pos;
+}
+
+Nautilus::Interface::HashMap* MultiWayHJSlice::getHashMapPtr(const WorkerThreadId workerThreadId, const uint64_t input) const
+{
+    return hashMaps[getHashMapPosition(workerThreadId, input)].get();
+}
+
+Nautilus::Interface::HashMap* MultiWayHJSlice::getHashMapPtrOrCreate(const WorkerThreadId workerThreadId, const uint64_t input)
+{
+    const auto pos = getHashMapPosition(workerThreadId, input);
+    if (hashMaps.at(pos) == nullptr)
+    {
+        /// Hashmap at pos has not been initialized
+        hashMaps.at(pos) = createHashMap();
+    }
+    return hashMaps.at(pos).get();
+}
+
+uint64_t MultiWayHJSlice::getNumberOfHashMapsForInput() const
+{
+    return numberOfHashMapsPerInputStream;
+}
+
+uint64_t MultiWayHJSlice::getNumberOfInputs() const
+{
+    return numberOfInputStreams;
+}
+
+}
@@ -0,0 +1,109 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+
+#include <Join/HashJoin/SpatialHJBuildPhysicalOperator.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <Functions/PhysicalFunction.hpp>
+#include <Identifiers/Identifiers.hpp>
+#include <Join/HashJoin/HJBuildPhysicalOperator.hpp>
+#include <Join/StreamJoinUtil.hpp>
+#include <Nautilus/DataTypes/VarVal.hpp>
+#include <Nautilus/Interface/BufferRef/TupleBufferRef.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <Watermark/TimeFunction.hpp>
+#include <ErrorHandling.hpp>
+#include <ExecutionContext.hpp>
+#include <HashMapOptions.hpp>
+#include <function.hpp>
+#include <val.hpp>
+
+namespace NES
+{
+uint64_t getSpatialJoinCellProxy(const double lon, const double lat, const double cellSize, const int64_t offsetLon, const int64_t offsetLat)
+{
+    /// Invalid positions fall into one arbitrary cell. The join function rejects them afterward.
+    if (not std::isfinite(lon) or not std::isfinite(lat))
+    {
+        return 0;
+    }
+
+    /// We clamp the cell indexes to 32 bits to pack both into one key. As clamping is monotone, positions within the distance of each other
+    /// still lie in neighbouring cells, i.e., we might get more candidates for extreme coordinates but never lose a join partner.
+    constexpr auto maxCellIndex = static_cast<double>(std::numeric_limits<int32_t>::max() - 1);
+    const auto cellIndex = [cellSize](const double coordinate, const int64_t offset)
+    { return static_cast<int64_t>(std::clamp(std::floor(coordinate / cellSize), -maxCellIndex, maxCellIndex)) + offset; };
+    const auto cellLon = static_cast<uint32_t>(cellIndex(lon, offsetLon));
+    const auto cellLat = static_cast<uint32_t>(cellIndex(lat, offsetLat));
+    return (static_cast<uint64_t>(cellLon) << 32U) | cellLat;
+}
+
+void SpatialHJBuildPhysicalOperator::execute(ExecutionContext& ctx, Record& record) const
+{
+    const auto timestamp = timeFunction->getTs(ctx, record);
+    if (not isLateRecord(ctx, timestamp))
+    {
+        /// Get the current slice / hash map that we have to insert the tuple into.
+        /// We do not partition the spatial join, as the right side inserts each record into nine cells, i.e., nine partitions.
+        const auto hashMapPtr = getHashMap(ctx, timestamp, nautilus::val<uint64_t>(0));
+
+        const auto lon = lonFunction.execute(record, ctx.pipelineMemoryProvider.arena).cast<nautilus::val<double>>();
+        const auto lat = latFunction.execute(record, ctx.pipelineMemoryProvider.arena).cast<nautilus::val<double>>();
+        const auto& cellFieldIdentifier = hashMapOptions.fieldKeys[0].fieldIdentifier;
+
+        /// The left side inserts each record solely into its own cell, the right side additionally into the eight neighbouring cells
+        const int64_t neighbourhood = joinBuildSide == JoinBuildSideType::Right ? 1 : 0;
+        for (int64_t offsetLon = -neighbourhood; offsetLon <= neighbourhood; ++offsetLon)
+        {
+            for (int64_t offsetLat = -neighbourhood; offsetLat <= neighbourhood; ++offsetLat)
+            {
+                const auto cell = nautilus::invoke(
+                    getSpatialJoinCellProxy,
+                    lon,
+                    lat,
+                    nautilus::val<double>(cellSize),
+                    nautilus::val<int64_t>(offsetLon),
+                    nautilus::val<int64_t>(offsetLat));
+                record.write(cellFieldIdentifier, VarVal(cell));
+                insertRecord(ctx, record, hashMapPtr);
+            }
+        }
+    }
+}
+
+SpatialHJBuildPhysicalOperator::SpatialHJBuildPhysicalOperator(
+    const OperatorHandlerId operatorHandlerId,
+    const JoinBuildSideType joinBuildSide,
+    std::unique_ptr<TimeFunction> timeFunction,
+    const std::shared_ptr<Interface::BufferRef::TupleBufferRef>& bufferRef,
+    HashMapOptions hashMapOptions,
+    PhysicalFunction lonFunction,
+    PhysicalFunction latFunction,
+    const double cellSize)
+    : HJBuildPhysicalOperator(operatorHandlerId, joinBuildSide, std::move(timeFunction), bufferRef, std::move(hashMapOptions))
+    , lonFunction(std::move(lonFunction))
+    , latFunction(std::move(latFunction))
+    , cellSize(cellSize)
+{
+    PRECONDITION(this->hashMapOptions.fieldKeys.size() == 1, "The spatial join expects exactly one key field for the grid cell");
+    PRECONDITION(cellSize > 0, "The cell size of the spatial join must be positive, but was {}", cellSize);
+}
+
+}
@@ -0,0 +1,214 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Join/LookupJoin/AsyncLookupJoinOperatorHandler.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <expected>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Identifiers/Identifiers.hpp>
+#include <Join/LookupJoin/HttpLookupClient.hpp>
+#include <Join/LookupJoin/LookupTable.hpp>
+#include <Runtime/QueryTerminationType.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <fmt/format.h>
+#include <ErrorHandling.hpp>
+#include <PipelineExecutionContext.hpp>
+
+namespace NES
+{
+
+namespace
+{
+constexpr unsigned STATUS_OK = 200;
+constexpr unsigned STATUS_NOT_FOUND = 404;
+
+template <typename T>
+std::string formatValue(const std::string_view key)
+{
+    INVARIANT(key.size() == sizeof(T), "Expected a key of {} bytes, but got {}", sizeof(T), key.size());
+    T value;
+    std::memcpy(&value, key.data(), sizeof(T));
+    return fmt::format("{}", value);
+}
+}
+
+AsyncLookupJoinOperatorHandler::AsyncLookupJoinOperatorHandler(
+    std::string url, const uint64_t cacheSize, const uint64_t maxInFlight, Schema tableSchema, std::string keyFieldName)
+    : url(std::move(url))
+    , maxInFlight(maxInFlight)
+    , tableSchema(std::move(tableSchema))
+    , keyFieldName(std::move(keyFieldName))
+    , keyField(this->tableSchema.getFieldByName(this->keyFieldName).value())
+    , cache(Cache(cacheSize))
+{
+    PRECONDITION(cacheSize > 0, "The cache of a lookup join must hold at least one key");
+}
+
+void AsyncLookupJoinOperatorHandler::start(PipelineExecutionContext& pipelineExecutionContext, uint32_t)
+{
+    std::call_once(
+        startedClient,
+        [this, &pipelineExecutionContext]
+        {
+            pinnedKeys.resize(pipelineExecutionContext.getNumberOfWorkerThreads());
+            client = std::make_unique<HttpLookupClient>(
+                url,
+                maxInFlight,
+                [this](const std::string& key, std::expected<HttpLookupClient::Response, std::string> response)
+                { onResponse(key, std::move(response)); });
+        });
+}
+
+void AsyncLookupJoinOperatorHandler::stop(QueryTerminationType, PipelineExecutionContext&)
+{
+    /// Joins the I/O thread, thus no response arrives after the query stopped
+    client.reset();
+}
+
+void AsyncLookupJoinOperatorHandler::unpinKeys(const WorkerThreadId workerThreadId)
+{
+    INVARIANT(
+        workerThreadId.getRawValue() < pinnedKeys.size(),
+        "Worker thread {} exceeds the number of worker threads {} of the lookup join",
+        workerThreadId,
+        pinnedKeys.size());
+    pinnedKeys[workerThreadId.getRawValue()].clear();
+}
+
+bool AsyncLookupJoinOperatorHandler::pinKey(const WorkerThreadId workerThreadId, const std::string_view key)
+{
+    INVARIANT(client != nullptr, "The lookup join must be started before pinning keys");
+    auto& pinnedKeysOfWorker = pinnedKeys.at(workerThreadId.getRawValue());
+    if (pinnedKeysOfWorker.contains(key))
+    {
+        return true;
+    }
+
+    {
+        auto lockedCache = cache.lock();
+        if (lockedCache->failure.has_value())
+        {
+            throw ExternalLookupFailure("Could not look up the rows of a key at {}: {}", url, lockedCache->failure.value());
+        }
+        if (const auto table = lockedCache->tables.find(std::string(key)); table != lockedCache->tables.end())
+        {
+            pinnedKeysOfWorker.emplace(key, table->second);
+            return true;
+        }
+        if (not lockedCache->requestedKeys.emplace(key).second)
+        {
+            return false;
+        }
+    }
+    client->request(std::string(key), formatKey(key));
+    return false;
+}
+
+const LookupTable* AsyncLookupJoinOperatorHandler::getPinnedKey(const WorkerThreadId workerThreadId, const std::string_view key) const
+{
+    const auto& pinnedKeysOfWorker = pinnedKeys.at(workerThreadId.getRawValue());
+    const auto table = pinnedKeysOfWorker.find(key);
+    INVARIANT(table != pinnedKeysOfWorker.end(), "The worker thread {} must pin a key before probing it", workerThreadId);
+    return table->second.get();
+}
+
+void AsyncLookupJoinOperatorHandler::onResponse(const std::string& key, std::expected<HttpLookupClient::Response, std::string> response)
+{
+    std::shared_ptr<const LookupTable> table;
+    std::string failure;
+    if (not response.has_value())
+    {
+        failure = std::move(response.error());
+    }
+    else if (response->statusCode != STATUS_OK and response->statusCode != STATUS_NOT_FOUND)
+    {
+        failure = fmt::format("Unexpected status code {}", response->statusCode);
+    }
+    else
+    {
+        /// A key without rows is cached as well, thus its records are dropped without requesting it again
+        try
+        {
+            std::istringstream rows(response->statusCode == STATUS_OK ? std::move(response->body) : std::string());
+            table = std::make_shared<const LookupTable>(rows, url, tableSchema, keyFieldName);
+        }
+        catch (const Exception& exception)
+        {
+            failure = exception.what();
+        }
+    }
+
+    auto lockedCache = cache.lock();
+    lockedCache->requestedKeys.erase(key);
+    if (table)
+    {
+        lockedCache->tables.set(key, std::move(table));
+        return;
+    }
+    NES_ERROR("Could not look up the rows of a key at {}: {}", url, failure);
+    if (not lockedCache->failure.has_value())
+    {
+        lockedCache->failure = std::move(failure);
+    }
+}
+
+std::string AsyncLookupJoinOperatorHandler::formatKey(const std::string_view key) const
+{
+    switch (keyField.dataType.type)
+    {
+        case DataType::Type::UINT8:
+            return formatValue<uint8_t>(key);
+        case DataType::Type::UINT16:
+            return formatValue<uint16_t>(key);
+        case DataType::Type::UINT32:
+            return formatValue<uint32_t>(key);
+        case DataType::Type::UINT64:
+            return formatValue<uint64_t>(key);
+        case DataType::Type::INT8:
+            return formatValue<int8_t>(key);
+        case DataType::Type::INT16:
+            return formatValue<int16_t>(key);
+        case DataType::Type::INT32:
+            return formatValue<int32_t>(key);
+        case DataType::Type::INT64:
+            return formatValue<int64_t>(key);
+        case DataType::Type::FLOAT32:
+            return formatValue<float>(key);
+        case DataType::Type::FLOAT64:
+            return formatValue<double>(key);
+        case DataType::Type::BOOLEAN:
+            return formatValue<bool>(key);
+        case DataType::Type::CHAR:
+            return formatValue<char>(key);
+        case DataType::Type::VARSIZED:
+            return std::string(key);
+        case DataType::Type::VARSIZED_POINTER_REP:
+        case DataType::Type::UNDEFINED:
+            throw UnknownDataType("Lookup tables do not support keys of type {}", keyField.dataType);
+    }
+    std::unreachable();
+}
+
+}
@@ -0,0 +1,192 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Join/LookupJoin/AsyncLookupJoinPhysicalOperator.hpp>
+
+#include <bit>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <utility>
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Functions/PhysicalFunction.hpp>
+#include <Identifiers/Identifiers.hpp>
+#include <Join/LookupJoin/AsyncLookupJoinOperatorHandler.hpp>
+#include <Join/LookupJoin/LookupTable.hpp>
+#include <Join/LookupJoin/LookupTableProbe.hpp>
+#include <Nautilus/Interface/BufferRef/TupleBufferRef.hpp>
+#include <Nautilus/Interface/NESStrongTypeRef.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <Nautilus/Interface/RecordBuffer.hpp>
+#include <Runtime/Execution/OperatorHandler.hpp>
+#include <Runtime/QueryTerminationType.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Util/StdInt.hpp>
+#include <nautilus/val.hpp>
+#include <CompilationContext.hpp>
+#include <ErrorHandling.hpp>
+#include <ExecutionContext.hpp>
+#include <PhysicalOperator.hpp>
+#include <PipelineExecutionContext.hpp>
+#include <function.hpp>
+#include <val_ptr.hpp>
+
+namespace NES
+{
+
+namespace
+{
+void setupAsyncLookupJoinProxy(OperatorHandler* ptrOpHandler, PipelineExecutionContext* pipelineCtx)
+{
+    PRECONDITION(ptrOpHandler != nullptr, "opHandler context should not be null!");
+    PRECONDITION(pipelineCtx != nullptr, "pipeline context should not be null!");
+    dynamic_cast<AsyncLookupJoinOperatorHandler*>(ptrOpHandler)->start(*pipelineCtx, 0);
+}
+
+void terminateAsyncLookupJoinProxy(OperatorHandler* ptrOpHandler, PipelineExecutionContext* pipelineCtx)
+{
+    PRECONDITION(ptrOpHandler != nullptr, "opHandler context should not be null!");
+    PRECONDITION(pipelineCtx != nullptr, "pipeline context should not be null!");
+    dynamic_cast<AsyncLookupJoinOperatorHandler*>(ptrOpHandler)->stop(QueryTerminationType::Graceful, *pipelineCtx);
+}
+
+void unpinKeysProxy(OperatorHandler* ptrOpHandler, const WorkerThreadId workerThreadId)
+{
+    PRECONDITION(ptrOpHandler != nullptr, "opHandler context should not be null!");
+    dynamic_cast<AsyncLookupJoinOperatorHandler*>(ptrOpHandler)->unpinKeys(workerThreadId);
+}
+
+bool pinKeyProxy(OperatorHandler* ptrOpHandler, const WorkerThreadId workerThreadId, const int8_t* key, const uint64_t keySize)
+{
+    PRECONDITION(ptrOpHandler != nullptr, "opHandler context should not be null!");
+    return dynamic_cast<AsyncLookupJoinOperatorHandler*>(ptrOpHandler)
+        ->pinKey(workerThreadId, std::string_view(std::bit_cast<const char*>(key), keySize));
+}
+
+const LookupTable*
+getPinnedKeyProxy(OperatorHandler* ptrOpHandler, const WorkerThreadId workerThreadId, const int8_t* key, const uint64_t keySize)
+{
+    PRECONDITION(ptrOpHandler != nullptr, "opHandler context should not be null!");
+    return dynamic_cast<AsyncLookupJoinOperatorHandler*>(ptrOpHandler)
+        ->getPinnedKey(workerThreadId, std::string_view(std::bit_cast<const char*>(key), keySize));
+}
+
+void retryBufferProxy(PipelineExecutionContext* pipelineCtx, const TupleBuffer* buffer)
+{
+    PRECONDITION(pipelineCtx != nullptr, "pipeline context should not be null!");
+    PRECONDITION(buffer != nullptr, "buffer should not be null!");
+    pipelineCtx->repeatTask(*buffer, AsyncLookupJoinPhysicalOperator::RETRY_INTERVAL);
+}
+}
+
+AsyncLookupJoinPhysicalOperator::AsyncLookupJoinPhysicalOperator(
+    const OperatorHandlerId operatorHandlerId,
+    std::shared_ptr<Interface::BufferRef::TupleBufferRef> bufferRef,
+    PhysicalFunction streamKey,
+    Record::RecordFieldIdentifier streamKeyField,
+    DataType tableKeyType,
+    Schema tableSchema)
+    : operatorHandlerId(operatorHandlerId)
+    , bufferRef(std::move(bufferRef))
+    , keyProjection({std::move(streamKeyField)})
+    , tableProbe(std::move(streamKey), std::move(tableKeyType), std::move(tableSchema))
+{
+}
+
+void AsyncLookupJoinPhysicalOperator::setup(ExecutionContext& executionCtx, CompilationContext& compilationContext) const
+{
+    nautilus::invoke(setupAsyncLookupJoinProxy, executionCtx.getGlobalOperatorHandler(operatorHandlerId), executionCtx.pipelineContext);
+    setupChild(executionCtx, compilationContext);
+}
+
+void AsyncLookupJoinPhysicalOperator::open(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const
+{
+    executionCtx.watermarkTs = recordBuffer.getWatermarkTs();
+    executionCtx.originId = recordBuffer.getOriginId();
+    executionCtx.currentTs = recordBuffer.getCreatingTs();
+    executionCtx.creationTs = recordBuffer.getCreatingTs();
+    executionCtx.latestCreationTs = recordBuffer.getLatestCreationTs();
+    executionCtx.sequenceNumber = recordBuffer.getSequenceNumber();
+    executionCtx.chunkNumber = recordBuffer.getChunkNumber();
+    executionCtx.lastChunk = recordBuffer.isLastChunk();
+
+    /// The first pass solely reads the keys, thus a buffer that waits for keys reads few fields
+    const auto handler = executionCtx.getGlobalOperatorHandler(operatorHandlerId);
+    nautilus::invoke(unpinKeysProxy, handler, executionCtx.workerThreadId);
+    const auto numberOfRecords = recordBuffer.getNumRecords();
+    nautilus::val<uint64_t> numberOfMissingKeys = 0_u64;
+    for (nautilus::val<uint64_t> i = 0_u64; i < numberOfRecords; i = i + 1_u64)
+    {
+        auto record = bufferRef->readRecord(keyProjection, recordBuffer, i);
+        const auto key = tableProbe.readKey(executionCtx, record);
+        if (not nautilus::invoke(pinKeyProxy, handler, executionCtx.workerThreadId, key.content, key.size))
+        {
+            numberOfMissingKeys = numberOfMissingKeys + 1_u64;
+        }
+    }
+
+    if (numberOfMissingKeys == 0_u64)
+    {
+        openChild(executionCtx, recordBuffer);
+        joinRecords(executionCtx, recordBuffer);
+        closeChild(executionCtx, recordBuffer);
+    }
+    else
+    {
+        nautilus::invoke(retryBufferProxy, executionCtx.pipelineContext, recordBuffer.getReference());
+    }
+}
+
+void AsyncLookupJoinPhysicalOperator::joinRecords(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const
+{
+    const auto handler = executionCtx.getGlobalOperatorHandler(operatorHandlerId);
+    const auto numberOfRecords = recordBuffer.getNumRecords();
+    for (nautilus::val<uint64_t> i = 0_u64; i < numberOfRecords; i = i + 1_u64)
+    {
+        auto record = bufferRef->readRecord({}, recordBuffer, i);
+        const auto key = tableProbe.readKey(executionCtx, record);
+        const auto table = nautilus::invoke(getPinnedKeyProxy, handler, executionCtx.workerThreadId, key.content, key.size);
+        tableProbe.probe(
+            table,
+            LookupTableProbe::getVariableSizedData(table),
+            key,
+            record,
+            [&](Record& joinedRecord) { executeChild(executionCtx, joinedRecord); });
+    }
+}
+
+void AsyncLookupJoinPhysicalOperator::close(ExecutionContext&, RecordBuffer&) const
+{
+    /// The child is closed in the second pass of open, if the buffer did not wait for keys
+}
+
+void AsyncLookupJoinPhysicalOperator::terminate(ExecutionContext& executionCtx) const
+{
+    nautilus::invoke(terminateAsyncLookupJoinProxy, executionCtx.getGlobalOperatorHandler(operatorHandlerId), executionCtx.pipelineContext);
+    terminateChild(executionCtx);
+}
+
+std::optional<PhysicalOperator> AsyncLookupJoinPhysicalOperator::getChild() const
+{
+    return child;
+}
+
+void AsyncLookupJoinPhysicalOperator::setChild(PhysicalOperator child)
+{
+    this->child = std::move(child);
+}
+
+}
@@ -0,0 +1,358 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Join/LookupJoin/HttpLookupClient.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <expected>
+#include <memory>
+#include <mutex>
+#include <ranges>
+#include <stop_token>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <netdb.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Strings.hpp>
+#include <Util/ThreadNaming.hpp>
+#include <fmt/chrono.h>
+#include <fmt/format.h>
+#include <ErrorHandling.hpp>
+
+namespace NES
+{
+
+namespace
+{
+constexpr std::string_view SCHEME = "http://";
+constexpr std::string_view KEY_PLACEHOLDER = "{}";
+constexpr std::string_view DEFAULT_PORT = "80";
+constexpr int MAX_NUMBER_OF_EVENTS = 64;
+/// Bounds the time until the I/O thread notices a request that exceeded its timeout
+constexpr int TIMEOUT_CHECK_INTERVAL_MS = 100;
+constexpr int WAIT_INDEFINITELY = -1;
+constexpr size_t RECEIVE_BUFFER_SIZE = 16 * 1024;
+
+std::expected<HttpLookupClient::Response, std::string> parseResponse(const std::string_view response)
+{
+    constexpr std::string_view STATUS_LINE_PREFIX = "HTTP/1.";
+    constexpr std::string_view HEADER_END = "\r\n\r\n";
+    /// The status line starts with `HTTP/1.x NNN`
+    constexpr size_t STATUS_CODE_OFFSET = STATUS_LINE_PREFIX.size() + 2;
+    constexpr size_t STATUS_CODE_LENGTH = 3;
+
+    const auto headerEnd = response.find(HEADER_END);
+    if (not response.starts_with(STATUS_LINE_PREFIX) or headerEnd == std::string_view::npos
+        or headerEnd < STATUS_CODE_OFFSET + STATUS_CODE_LENGTH)
+    {
+        return std::unexpected(fmt::format("Malformed response of {} bytes", response.size()));
+    }
+    const auto statusCode = Util::from_chars<unsigned>(response.substr(STATUS_CODE_OFFSET, STATUS_CODE_LENGTH));
+    if (not statusCode.has_value())
+    {
+        return std::unexpected(fmt::format("Malformed status line: {}", response.substr(0, response.find("\r\n"))));
+    }
+    return HttpLookupClient::Response{
+        .statusCode = statusCode.value(), .body = std::string(response.substr(headerEnd + HEADER_END.size()))};
+}
+}
+
+void HttpLookupClient::AddressDeleter::operator()(addrinfo* address) const
+{
+    freeaddrinfo(address);
+}
+
+HttpLookupClient::HttpLookupClient(const std::string_view url, const size_t maxInFlight, OnResponse onResponse)
+    : maxInFlight(maxInFlight), onResponse(std::move(onResponse))
+{
+    PRECONDITION(maxInFlight > 0, "The lookup client requires at least one request in flight");
+    if (not url.starts_with(SCHEME))
+    {
+        throw InvalidConfigParameter("The url {} of the lookup table must start with {}", url, SCHEME);
+    }
+    const auto authorityAndPath = url.substr(SCHEME.size());
+    const auto pathStart = authorityAndPath.find('/');
+    const auto authority = authorityAndPath.substr(0, pathStart);
+    const auto path = pathStart == std::string_view::npos ? std::string_view("/") : authorityAndPath.substr(pathStart);
+    const auto portStart = authority.rfind(':');
+    host = authority.substr(0, portStart);
+    port = portStart == std::string_view::npos ? DEFAULT_PORT : authority.substr(portStart + 1);
+    const auto keyStart = path.find(KEY_PLACEHOLDER);
+    if (host.empty() or not Util::from_chars<uint16_t>(port).has_value() or keyStart == std::string_view::npos)
+    {
+        throw InvalidConfigParameter(
+            "The url {} of the lookup table must be of the form http://host[:port]/path with {{}} for the key", url);
+    }
+    requestPrefix = fmt::format("GET {}", path.substr(0, keyStart));
+    requestSuffix = fmt::format(
+        "{} HTTP/1.0\r\nHost: {}\r\nAccept: text/csv\r\nConnection: close\r\n\r\n",
+        path.substr(keyStart + KEY_PLACEHOLDER.size()),
+        authority);
+
+    epollFd = epoll_create1(EPOLL_CLOEXEC);
+    wakeUpFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    /// The eventfd is the only descriptor without a Connection, which is why it carries a nullptr
+    epoll_event wakeUpEvent{.events = EPOLLIN, .data = {.ptr = nullptr}};
+    if (epollFd < 0 or wakeUpFd < 0 or epoll_ctl(epollFd, EPOLL_CTL_ADD, wakeUpFd, &wakeUpEvent) != 0)
+    {
+        const auto error = errno;
+        ::close(epollFd);
+        ::close(wakeUpFd);
+        throw ExternalLookupFailure("Could not create the epoll instance of the lookup client: {}", std::strerror(error));
+    }
+    thread = std::jthread(
+        [this](const std::stop_token& stopToken)
+        {
+            setThreadName("HttpLookup");
+            run(stopToken);
+        });
+}
+
+HttpLookupClient::~HttpLookupClient()
+{
+    thread.request_stop();
+    wakeUp();
+    thread.join();
+    for (const auto& connection : connections)
+    {
+        if (connection->socket >= 0)
+        {
+            ::close(connection->socket);
+        }
+    }
+    ::close(epollFd);
+    ::close(wakeUpFd);
+}
+
+void HttpLookupClient::request(std::string key, const std::string_view urlKey)
+{
+    {
+        const std::scoped_lock lock(pendingRequestsMutex);
+        pendingRequests.emplace_back(
+            PendingRequest{.key = std::move(key), .message = requestPrefix + encodeUrlKey(urlKey) + requestSuffix});
+    }
+    wakeUp();
+}
+
+std::string HttpLookupClient::encodeUrlKey(const std::string_view key)
+{
+    std::string encodedKey;
+    encodedKey.reserve(key.size());
+    for (const auto character : key)
+    {
+        if (std::isalnum(static_cast<unsigned char>(character)) != 0 or character == '-' or character == '.' or character == '_'
+            or character == '~')
+        {
+            encodedKey.push_back(character);
+        }
+        else
+        {
+            encodedKey += fmt::format("%{:02X}", static_cast<unsigned char>(character));
+        }
+    }
+    return encodedKey;
+}
+
+void HttpLookupClient::wakeUp() const
+{
+    constexpr uint64_t increment = 1;
+    [[maybe_unused]] const auto numberOfWrittenBytes = write(wakeUpFd, &increment, sizeof(increment));
+}
+
+void HttpLookupClient::resolveHost()
+{
+    addrinfo hints{};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    addrinfo* result = nullptr;
+    if (const auto errorCode = getaddrinfo(host.c_str(), port.c_str(), &hints, &result); errorCode != 0)
+    {
+        resolveError = fmt::format("Could not resolve {}:{}: {}", host, port, gai_strerror(errorCode));
+        NES_ERROR("HttpLookupClient: {}", resolveError);
+        return;
+    }
+    address.reset(result);
+}
+
+void HttpLookupClient::run(const std::stop_token& stopToken)
+{
+    resolveHost();
+    std::array<epoll_event, MAX_NUMBER_OF_EVENTS> events{};
+    while (not stopToken.stop_requested())
+    {
+        connectPendingRequests();
+
+        const auto timeout = connections.empty() ? WAIT_INDEFINITELY : TIMEOUT_CHECK_INTERVAL_MS;
+        const auto numberOfEvents = epoll_wait(epollFd, events.data(), MAX_NUMBER_OF_EVENTS, timeout);
+        if (numberOfEvents < 0 and errno != EINTR)
+        {
+            NES_ERROR("HttpLookupClient failed to wait for events: {}", std::strerror(errno));
+        }
+        for (const auto& event : events | std::views::take(std::max(numberOfEvents, 0)))
+        {
+            if (event.data.ptr == nullptr)
+            {
+                uint64_t numberOfWakeUps = 0;
+                [[maybe_unused]] const auto numberOfReadBytes = read(wakeUpFd, &numberOfWakeUps, sizeof(numberOfWakeUps));
+                continue;
+            }
+            handleEvent(*static_cast<Connection*>(event.data.ptr), event.events);
+        }
+
+        const auto now = std::chrono::steady_clock::now();
+        for (auto& connection : connections)
+        {
+            if (connection->socket >= 0 and connection->deadline < now)
+            {
+                complete(*connection, std::unexpected(fmt::format("No response from {}:{} within {}", host, port, REQUEST_TIMEOUT)));
+            }
+        }
+        /// Completed connections are removed after handling all events, as later events of the same wakeup may point to them
+        std::erase_if(connections, [](const auto& connection) { return connection->socket < 0; });
+    }
+}
+
+void HttpLookupClient::connectPendingRequests()
+{
+    while (connections.size() < maxInFlight)
+    {
+        PendingRequest pendingRequest;
+        {
+            const std::scoped_lock lock(pendingRequestsMutex);
+            if (pendingRequests.empty())
+            {
+                return;
+            }
+            pendingRequest = std::move(pendingRequests.front());
+            pendingRequests.pop_front();
+        }
+
+        auto connection = std::make_unique<Connection>();
+        connection->key = std::move(pendingRequest.key);
+        connection->message = std::move(pendingRequest.message);
+        connection->deadline = std::chrono::steady_clock::now() + REQUEST_TIMEOUT;
+        if (not address)
+        {
+            complete(*connection, std::unexpected(resolveError));
+            continue;
+        }
+        connection->socket = ::socket(address->ai_family, address->ai_socktype | SOCK_NONBLOCK | SOCK_CLOEXEC, address->ai_protocol);
+        if (connection->socket < 0)
+        {
+            complete(*connection, std::unexpected(fmt::format("Could not create a socket: {}", std::strerror(errno))));
+            continue;
+        }
+        /// The connection is established once the socket becomes writable
+        epoll_event event{.events = EPOLLOUT, .data = {.ptr = connection.get()}};
+        if ((::connect(connection->socket, address->ai_addr, address->ai_addrlen) != 0 and errno != EINPROGRESS)
+            or epoll_ctl(epollFd, EPOLL_CTL_ADD, connection->socket, &event) != 0)
+        {
+            complete(*connection, std::unexpected(fmt::format("Could not connect to {}:{}: {}", host, port, std::strerror(errno))));
+            continue;
+        }
+        connections.emplace_back(std::move(connection));
+    }
+}
+
+void HttpLookupClient::handleEvent(Connection& connection, const uint32_t events)
+{
+    if (connection.socket < 0)
+    {
+        return;
+    }
+
+    if (connection.numberOfSentBytes < connection.message.size())
+    {
+        int error = 0;
+        socklen_t errorLength = sizeof(error);
+        if ((events & (EPOLLERR | EPOLLHUP)) != 0 and getsockopt(connection.socket, SOL_SOCKET, SO_ERROR, &error, &errorLength) == 0
+            and error != 0)
+        {
+            complete(connection, std::unexpected(fmt::format("Could not connect to {}:{}: {}", host, port, std::strerror(error))));
+            return;
+        }
+        const auto numberOfSentBytes = ::send(
+            connection.socket,
+            connection.message.data() + connection.numberOfSentBytes,
+            connection.message.size() - connection.numberOfSentBytes,
+            MSG_NOSIGNAL);
+        if (numberOfSentBytes < 0)
+        {
+            if (errno != EAGAIN and errno != EWOULDBLOCK and errno != EINTR)
+            {
+                complete(connection, std::unexpected(fmt::format("Could not send to {}:{}: {}", host, port, std::strerror(errno))));
+            }
+            return;
+        }
+        connection.numberOfSentBytes += static_cast<size_t>(numberOfSentBytes);
+        if (connection.numberOfSentBytes == connection.message.size())
+        {
+            epoll_event event{.events = EPOLLIN, .data = {.ptr = &connection}};
+            if (epoll_ctl(epollFd, EPOLL_CTL_MOD, connection.socket, &event) != 0)
+            {
+                complete(connection, std::unexpected(fmt::format("Could not watch the connection: {}", std::strerror(errno))));
+            }
+        }
+        return;
+    }
+
+    /// Level-triggered epoll reports the socket again, thus reading until it would block suffices
+    std::array<char, RECEIVE_BUFFER_SIZE> buffer{};
+    while (true)
+    {
+        const auto numberOfReceivedBytes = ::recv(connection.socket, buffer.data(), buffer.size(), 0);
+        if (numberOfReceivedBytes > 0)
+        {
+            connection.response.append(buffer.data(), static_cast<size_t>(numberOfReceivedBytes));
+            continue;
+        }
+        if (numberOfReceivedBytes == 0)
+        {
+            /// The server closes the connection after an HTTP/1.0 response
+            auto response = parseResponse(connection.response);
+            complete(connection, std::move(response));
+            return;
+        }
+        if (errno != EAGAIN and errno != EWOULDBLOCK and errno != EINTR)
+        {
+            complete(connection, std::unexpected(fmt::format("Could not receive from {}:{}: {}", host, port, std::strerror(errno))));
+        }
+        return;
+    }
+}
+
+void HttpLookupClient::complete(Connection& connection, std::expected<Response, std::string> response)
+{
+    if (connection.socket >= 0)
+    {
+        /// Closing the socket removes it from the epoll instance
+        ::close(connection.socket);
+        connection.socket = -1;
+    }
+    onResponse(connection.key, std::move(response));
+}
+
+}
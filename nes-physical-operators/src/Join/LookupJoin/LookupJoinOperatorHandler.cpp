@@ -0,0 +1,110 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Join/LookupJoin/LookupJoinOperatorHandler.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <stop_token>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <DataTypes/Schema.hpp>
+#include <Identifiers/Identifiers.hpp>
+#include <Join/LookupJoin/LookupTable.hpp>
+#include <Runtime/QueryTerminationType.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <ErrorHandling.hpp>
+#include <PipelineExecutionContext.hpp>
+
+namespace NES
+{
+
+LookupJoinOperatorHandler::LookupJoinOperatorHandler(
+    std::filesystem::path filePath, Schema tableSchema, std::string keyFieldName, const std::chrono::milliseconds reloadInterval)
+    : filePath(std::move(filePath))
+    , tableSchema(std::move(tableSchema))
+    , keyFieldName(std::move(keyFieldName))
+    , reloadInterval(reloadInterval)
+{
+}
+
+void LookupJoinOperatorHandler::start(PipelineExecutionContext& pipelineExecutionContext, uint32_t)
+{
+    std::call_once(
+        loadedTable,
+        [this, &pipelineExecutionContext]
+        {
+            std::error_code errorCode;
+            lastWriteTimeOfTable = std::filesystem::last_write_time(filePath, errorCode);
+            table.store(std::make_shared<const LookupTable>(filePath, tableSchema, keyFieldName));
+            pinnedTables.resize(pipelineExecutionContext.getNumberOfWorkerThreads());
+            NES_DEBUG("Loaded {} rows of the lookup table {}", table.load()->getNumberOfRows(), filePath.string());
+
+            if (reloadInterval > std::chrono::milliseconds::zero())
+            {
+                reloadThread = std::jthread([this](const std::stop_token& stopToken) { reloadLoop(stopToken); });
+            }
+        });
+}
+
+void LookupJoinOperatorHandler::stop(QueryTerminationType, PipelineExecutionContext&)
+{
+    reloadThread.request_stop();
+}
+
+const LookupTable* LookupJoinOperatorHandler::pinTable(const WorkerThreadId workerThreadId)
+{
+    const auto workerThread = workerThreadId.getRawValue();
+    INVARIANT(
+        workerThread < pinnedTables.size(),
+        "Worker thread {} exceeds the number of worker threads {} of the lookup join",
+        workerThreadId,
+        pinnedTables.size());
+    pinnedTables[workerThread] = table.load();
+    return pinnedTables[workerThread].get();
+}
+
+void LookupJoinOperatorHandler::reloadLoop(const std::stop_token& stopToken)
+{
+    std::unique_lock lock(reloadMutex);
+    while (not reloadCondition.wait_for(lock, stopToken, reloadInterval, [] { return false; }) and not stopToken.stop_requested())
+    {
+        std::error_code errorCode;
+        const auto lastWriteTime = std::filesystem::last_write_time(filePath, errorCode);
+        if (errorCode or lastWriteTime == lastWriteTimeOfTable)
+        {
+            continue;
+        }
+
+        /// Keeping the old table, if the file is malformed, e.g., while it is being written
+        try
+        {
+            auto reloadedTable = std::make_shared<const LookupTable>(filePath, tableSchema, keyFieldName);
+            NES_DEBUG("Reloaded {} rows of the lookup table {}", reloadedTable->getNumberOfRows(), filePath.string());
+            table.store(std::move(reloadedTable));
+            lastWriteTimeOfTable = lastWriteTime;
+        }
+        catch (const Exception& exception)
+        {
+            NES_ERROR("Could not reload the lookup table {}: {}", filePath.string(), exception.what());
+        }
+    }
+}
+
+}
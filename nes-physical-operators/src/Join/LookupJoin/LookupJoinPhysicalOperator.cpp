@@ -0,0 +1,129 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Join/LookupJoin/LookupJoinPhysicalOperator.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Functions/PhysicalFunction.hpp>
+#include <Identifiers/Identifiers.hpp>
+#include <Join/LookupJoin/LookupJoinOperatorHandler.hpp>
+#include <Join/LookupJoin/LookupTable.hpp>
+#include <Join/LookupJoin/LookupTableProbe.hpp>
+#include <Nautilus/Interface/NESStrongTypeRef.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <Nautilus/Interface/RecordBuffer.hpp>
+#include <Runtime/Execution/OperatorHandler.hpp>
+#include <Runtime/QueryTerminationType.hpp>
+#include <nautilus/val.hpp>
+#include <CompilationContext.hpp>
+#include <ErrorHandling.hpp>
+#include <ExecutionContext.hpp>
+#include <OperatorState.hpp>
+#include <PhysicalOperator.hpp>
+#include <PipelineExecutionContext.hpp>
+#include <function.hpp>
+#include <val_ptr.hpp>
+
+namespace NES
+{
+
+namespace
+{
+void setupLookupJoinProxy(OperatorHandler* ptrOpHandler, PipelineExecutionContext* pipelineCtx)
+{
+    PRECONDITION(ptrOpHandler != nullptr, "opHandler context should not be null!");
+    PRECONDITION(pipelineCtx != nullptr, "pipeline context should not be null!");
+    dynamic_cast<LookupJoinOperatorHandler*>(ptrOpHandler)->start(*pipelineCtx, 0);
+}
+
+void terminateLookupJoinProxy(OperatorHandler* ptrOpHandler, PipelineExecutionContext* pipelineCtx)
+{
+    PRECONDITION(ptrOpHandler != nullptr, "opHandler context should not be null!");
+    PRECONDITION(pipelineCtx != nullptr, "pipeline context should not be null!");
+    dynamic_cast<LookupJoinOperatorHandler*>(ptrOpHandler)->stop(QueryTerminationType::Graceful, *pipelineCtx);
+}
+
+const LookupTable* pinLookupTableProxy(OperatorHandler* ptrOpHandler, const WorkerThreadId workerThreadId)
+{
+    PRECONDITION(ptrOpHandler != nullptr, "opHandler context should not be null!");
+    return dynamic_cast<LookupJoinOperatorHandler*>(ptrOpHandler)->pinTable(workerThreadId);
+}
+}
+
+/// Stores the table that the worker thread pinned for the current buffer
+class LookupJoinState : public OperatorState
+{
+public:
+    LookupJoinState(const nautilus::val<const LookupTable*>& table, const nautilus::val<int8_t*>& variableSizedData)
+        : table(table), variableSizedData(variableSizedData)
+    {
+    }
+
+    nautilus::val<const LookupTable*> table;
+    nautilus::val<int8_t*> variableSizedData;
+};
+
+LookupJoinPhysicalOperator::LookupJoinPhysicalOperator(
+    const OperatorHandlerId operatorHandlerId, PhysicalFunction streamKey, DataType tableKeyType, Schema tableSchema)
+    : operatorHandlerId(operatorHandlerId), tableProbe(std::move(streamKey), std::move(tableKeyType), std::move(tableSchema))
+{
+}
+
+void LookupJoinPhysicalOperator::setup(ExecutionContext& executionCtx, CompilationContext& compilationContext) const
+{
+    nautilus::invoke(setupLookupJoinProxy, executionCtx.getGlobalOperatorHandler(operatorHandlerId), executionCtx.pipelineContext);
+    setupChild(executionCtx, compilationContext);
+}
+
+void LookupJoinPhysicalOperator::open(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const
+{
+    /// Pinning the table once per buffer, such that a concurrent reload never affects the records of the buffer
+    const auto table
+        = nautilus::invoke(pinLookupTableProxy, executionCtx.getGlobalOperatorHandler(operatorHandlerId), executionCtx.workerThreadId);
+    const auto variableSizedData = LookupTableProbe::getVariableSizedData(table);
+    executionCtx.setLocalOperatorState(id, std::make_unique<LookupJoinState>(table, variableSizedData));
+    openChild(executionCtx, recordBuffer);
+}
+
+void LookupJoinPhysicalOperator::execute(ExecutionContext& executionCtx, Record& record) const
+{
+    auto* const state = dynamic_cast<LookupJoinState*>(executionCtx.getLocalState(id));
+
+    const auto key = tableProbe.readKey(executionCtx, record);
+    tableProbe.probe(
+        state->table, state->variableSizedData, key, record, [&](Record& joinedRecord) { executeChild(executionCtx, joinedRecord); });
+}
+
+void LookupJoinPhysicalOperator::terminate(ExecutionContext& executionCtx) const
+{
+    nautilus::invoke(terminateLookupJoinProxy, executionCtx.getGlobalOperatorHandler(operatorHandlerId), executionCtx.pipelineContext);
+    terminateChild(executionCtx);
+}
+
+std::optional<PhysicalOperator> LookupJoinPhysicalOperator::getChild() const
+{
+    return child;
+}
+
+void LookupJoinPhysicalOperator::setChild(PhysicalOperator child)
+{
+    this->child = std::move(child);
+}
+
+}
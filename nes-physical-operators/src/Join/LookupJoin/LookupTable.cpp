@@ -0,0 +1,217 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Join/LookupJoin/LookupTable.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <istream>
+#include <numeric>
+#include <optional>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Util/Strings.hpp>
+#include <ErrorHandling.hpp>
+
+namespace NES
+{
+
+namespace
+{
+template <typename T>
+void parseValue(const std::string_view value, const DataType& dataType, int8_t* destination)
+{
+    const auto parsedValue = Util::from_chars<T>(value);
+    if (not parsedValue.has_value())
+    {
+        throw CannotFormatMalformedStringValue("Cannot parse {} of the lookup table as {}", value, dataType);
+    }
+    std::memcpy(destination, &parsedValue.value(), sizeof(T));
+}
+
+void parseFixedSizeValue(const std::string_view value, const DataType& dataType, int8_t* destination)
+{
+    switch (dataType.type)
+    {
+        case DataType::Type::UINT8:
+            return parseValue<uint8_t>(value, dataType, destination);
+        case DataType::Type::UINT16:
+            return parseValue<uint16_t>(value, dataType, destination);
+        case DataType::Type::UINT32:
+            return parseValue<uint32_t>(value, dataType, destination);
+        case DataType::Type::UINT64:
+            return parseValue<uint64_t>(value, dataType, destination);
+        case DataType::Type::INT8:
+            return parseValue<int8_t>(value, dataType, destination);
+        case DataType::Type::INT16:
+            return parseValue<int16_t>(value, dataType, destination);
+        case DataType::Type::INT32:
+            return parseValue<int32_t>(value, dataType, destination);
+        case DataType::Type::INT64:
+            return parseValue<int64_t>(value, dataType, destination);
+        case DataType::Type::FLOAT32:
+            return parseValue<float>(value, dataType, destination);
+        case DataType::Type::FLOAT64:
+            return parseValue<double>(value, dataType, destination);
+        case DataType::Type::BOOLEAN:
+            return parseValue<bool>(value, dataType, destination);
+        case DataType::Type::CHAR:
+            return parseValue<char>(value, dataType, destination);
+        case DataType::Type::VARSIZED:
+        case DataType::Type::VARSIZED_POINTER_REP:
+        case DataType::Type::UNDEFINED:
+            throw UnknownDataType("Lookup tables do not support fields of type {}", dataType);
+    }
+    std::unreachable();
+}
+}
+
+LookupTableLayout::LookupTableLayout(const Schema& schema)
+{
+    for (const auto& field : schema)
+    {
+        fieldOffsets.emplace_back(rowSize);
+        rowSize += field.dataType.isType(DataType::Type::VARSIZED) ? sizeof(uint64_t) : field.dataType.getSizeInBytes();
+    }
+}
+
+LookupTable::LookupTable(const std::filesystem::path& filePath, const Schema& schema, const std::string& keyFieldName)
+    : layout(schema)
+{
+    std::ifstream file(filePath);
+    if (not file.is_open())
+    {
+        throw CannotOpenSource("Could not open the lookup table {}", filePath.string());
+    }
+    load(file, filePath.string(), schema, keyFieldName);
+}
+
+LookupTable::LookupTable(std::istream& lines, const std::string_view tableName, const Schema& schema, const std::string& keyFieldName)
+    : layout(schema)
+{
+    load(lines, tableName, schema, keyFieldName);
+}
+
+void LookupTable::load(std::istream& lines, const std::string_view tableName, const Schema& schema, const std::string& keyFieldName)
+{
+    const auto& fields = schema.getFields();
+    const auto keyField = std::ranges::find(fields, keyFieldName, &Schema::Field::name);
+    INVARIANT(keyField != fields.end(), "The key {} must be a field of the lookup table {}", keyFieldName, schema);
+    const auto keyFieldIndex = static_cast<uint64_t>(std::distance(fields.begin(), keyField));
+    const auto keyIsVariableSized = keyField->dataType.isType(DataType::Type::VARSIZED);
+
+    /// Parsing the rows in the order of the file
+    std::vector<int8_t> unorderedRows;
+    std::vector<std::string> keys;
+    std::string line;
+    while (std::getline(lines, line))
+    {
+        if (line.ends_with('\r'))
+        {
+            line.pop_back();
+        }
+        if (line.empty())
+        {
+            continue;
+        }
+
+        const auto values = std::views::split(line, ',')
+            | std::views::transform([](const auto& value) { return std::string_view(value.begin(), value.end()); })
+            | std::ranges::to<std::vector>();
+        if (values.size() != fields.size())
+        {
+            throw CannotFormatMalformedStringValue(
+                "Expected {} fields in each line of the lookup table {}, but got {} in: {}",
+                fields.size(),
+                tableName,
+                values.size(),
+                line);
+        }
+
+        unorderedRows.resize(unorderedRows.size() + layout.rowSize);
+        auto* const newRow = unorderedRows.data() + unorderedRows.size() - layout.rowSize;
+        for (uint64_t fieldIndex = 0; fieldIndex < fields.size(); ++fieldIndex)
+        {
+            auto* const destination = newRow + layout.fieldOffsets[fieldIndex];
+            if (fields[fieldIndex].dataType.isType(DataType::Type::VARSIZED))
+            {
+                const auto& value = values[fieldIndex];
+                const uint64_t offset = variableSizedData.size();
+                const auto size = static_cast<uint32_t>(value.size());
+                variableSizedData.resize(offset + sizeof(uint32_t) + size);
+                std::memcpy(variableSizedData.data() + offset, &size, sizeof(uint32_t));
+                std::memcpy(variableSizedData.data() + offset + sizeof(uint32_t), value.data(), size);
+                std::memcpy(destination, &offset, sizeof(offset));
+            }
+            else
+            {
+                parseFixedSizeValue(values[fieldIndex], fields[fieldIndex].dataType, destination);
+            }
+        }
+
+        if (keyIsVariableSized)
+        {
+            keys.emplace_back(values[keyFieldIndex]);
+        }
+        else
+        {
+            keys.emplace_back(
+                std::bit_cast<const char*>(newRow + layout.fieldOffsets[keyFieldIndex]), keyField->dataType.getSizeInBytes());
+        }
+    }
+
+    /// Storing the rows of the same key one after the other
+    std::vector<uint64_t> order(keys.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::ranges::stable_sort(order, {}, [&keys](const uint64_t rowIndex) -> const std::string& { return keys[rowIndex]; });
+    rows.resize(unorderedRows.size());
+    for (uint64_t position = 0; position < order.size(); ++position)
+    {
+        auto* const row = rows.data() + (position * layout.rowSize);
+        std::memcpy(row, unorderedRows.data() + (order[position] * layout.rowSize), layout.rowSize);
+
+        const auto rowsOfCurrentKey = rowsOfKey.try_emplace(keys[order[position]], Rows{.firstRow = row, .numberOfRows = 0}).first;
+        ++rowsOfCurrentKey->second.numberOfRows;
+    }
+}
+
+const LookupTable::Rows* LookupTable::find(const std::string_view key) const
+{
+    if (const auto rowsOfCurrentKey = rowsOfKey.find(key); rowsOfCurrentKey != rowsOfKey.end())
+    {
+        return &rowsOfCurrentKey->second;
+    }
+    return nullptr;
+}
+
+const int8_t* LookupTable::getVariableSizedData() const
+{
+    return variableSizedData.data();
+}
+
+uint64_t LookupTable::getNumberOfRows() const
+{
+    return rows.size() / std::max<uint64_t>(layout.rowSize, 1);
+}
+
+}
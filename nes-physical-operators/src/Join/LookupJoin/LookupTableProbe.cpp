@@ -0,0 +1,127 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Join/LookupJoin/LookupTableProbe.hpp>
+
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include <string_view>
+#include <utility>
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Functions/PhysicalFunction.hpp>
+#include <Join/LookupJoin/LookupTable.hpp>
+#include <Nautilus/DataTypes/DataTypesUtil.hpp>
+#include <Nautilus/DataTypes/VarVal.hpp>
+#include <Nautilus/DataTypes/VariableSizedData.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <Util/StdInt.hpp>
+#include <nautilus/val.hpp>
+#include <ErrorHandling.hpp>
+#include <ExecutionContext.hpp>
+#include <function.hpp>
+#include <val_ptr.hpp>
+
+namespace NES
+{
+
+namespace
+{
+int8_t* getVariableSizedDataProxy(const LookupTable* table)
+{
+    PRECONDITION(table != nullptr, "lookup table should not be null!");
+    /// The rows are solely read, but VariableSizedData requires a mutable pointer
+    return const_cast<int8_t*>(table->getVariableSizedData()); /// NOLINT(cppcoreguidelines-pro-type-const-cast)
+}
+
+const LookupTable::Rows* findRowsProxy(const LookupTable* table, const int8_t* key, const uint64_t keySize)
+{
+    PRECONDITION(table != nullptr, "lookup table should not be null!");
+    return table->find(std::string_view(std::bit_cast<const char*>(key), keySize));
+}
+
+uint64_t getNumberOfRowsProxy(const LookupTable::Rows* rows)
+{
+    return rows == nullptr ? 0 : rows->numberOfRows;
+}
+
+int8_t* getFirstRowProxy(const LookupTable::Rows* rows)
+{
+    /// NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    return rows == nullptr ? nullptr : const_cast<int8_t*>(rows->firstRow);
+}
+}
+
+LookupTableProbe::LookupTableProbe(PhysicalFunction streamKey, DataType tableKeyType, Schema tableSchema)
+    : streamKey(std::move(streamKey))
+    , tableKeyType(std::move(tableKeyType))
+    , tableSchema(std::move(tableSchema))
+    , tableLayout(this->tableSchema)
+{
+}
+
+LookupTableProbe::Key LookupTableProbe::readKey(ExecutionContext& executionCtx, Record& record) const
+{
+    /// The index expects the bytes of the key in the data type of the table key
+    const auto key = streamKey.execute(record, executionCtx.pipelineMemoryProvider.arena);
+    if (tableKeyType.isType(DataType::Type::VARSIZED))
+    {
+        const auto variableSizedKey = key.cast<VariableSizedData>();
+        return {.content = variableSizedKey.getContent(), .size = variableSizedKey.getContentSize()};
+    }
+    const nautilus::val<uint64_t> keySize = tableKeyType.getSizeInBytes();
+    const auto keyPointer = executionCtx.pipelineMemoryProvider.arena.allocateMemory(keySize);
+    key.castToType(tableKeyType.type).writeToMemory(keyPointer);
+    return {.content = keyPointer, .size = keySize};
+}
+
+void LookupTableProbe::probe(
+    const nautilus::val<const LookupTable*>& table,
+    const nautilus::val<int8_t*>& variableSizedData,
+    const Key& key,
+    const Record& record,
+    const std::function<void(Record&)>& emit) const
+{
+    const auto rows = nautilus::invoke(findRowsProxy, table, key.content, key.size);
+    const auto numberOfRows = nautilus::invoke(getNumberOfRowsProxy, rows);
+    const auto firstRow = nautilus::invoke(getFirstRowProxy, rows);
+    const auto fields = tableSchema.getFields();
+    for (nautilus::val<uint64_t> rowIndex = 0_u64; rowIndex < numberOfRows; rowIndex = rowIndex + 1_u64)
+    {
+        const auto row = firstRow + (rowIndex * nautilus::val<uint64_t>(tableLayout.rowSize));
+        Record joinedRecord(record);
+        for (uint64_t fieldIndex = 0; fieldIndex < fields.size(); ++fieldIndex)
+        {
+            const auto fieldPointer = row + nautilus::val<uint64_t>(tableLayout.fieldOffsets[fieldIndex]);
+            if (fields[fieldIndex].dataType.isType(DataType::Type::VARSIZED))
+            {
+                const auto offset = Nautilus::Util::readValueFromMemRef<uint64_t>(fieldPointer);
+                joinedRecord.write(fields[fieldIndex].name, VariableSizedData(variableSizedData + offset));
+            }
+            else
+            {
+                joinedRecord.write(fields[fieldIndex].name, VarVal::readVarValFromMemory(fieldPointer, fields[fieldIndex].dataType.type));
+            }
+        }
+        emit(joinedRecord);
+    }
+}
+
+nautilus::val<int8_t*> LookupTableProbe::getVariableSizedData(const nautilus::val<const LookupTable*>& table)
+{
+    return nautilus::invoke(getVariableSizedDataProxy, table);
+}
+
+}
@@ -0,0 +1,187 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Join/NestedLoopJoin/BandJoinProbePhysicalOperator.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <utility>
+#include <DataTypes/DataType.hpp>
+#include <Functions/PhysicalFunction.hpp>
+#include <Join/NestedLoopJoin/NLJProbePhysicalOperator.hpp>
+#include <Join/StreamJoinUtil.hpp>
+#include <Nautilus/DataTypes/DataTypesUtil.hpp>
+#include <Nautilus/DataTypes/VarVal.hpp>
+#include <Nautilus/Interface/BufferRef/TupleBufferRef.hpp>
+#include <Nautilus/Interface/PagedVector/PagedVectorRef.hpp>
+#include <Runtime/Execution/OperatorHandler.hpp>
+#include <Time/Timestamp.hpp>
+#include <Windowing/WindowMetaData.hpp>
+#include <ErrorHandling.hpp>
+#include <ExecutionContext.hpp>
+#include <function.hpp>
+#include <val.hpp>
+#include <val_ptr.hpp>
+
+namespace NES
+{
+
+uint64_t sortBandJoinEntriesProxy(BandJoinSortEntry* entries, const uint64_t numberOfEntries)
+{
+    PRECONDITION(entries != nullptr or numberOfEntries == 0, "The sort entries should not be null");
+    const std::span entrySpan(entries, numberOfEntries);
+    const auto nanEntries
+        = std::ranges::partition(entrySpan, [](const BandJoinSortEntry& entry) { return not std::isnan(entry.bandValue); });
+    const auto validEntries = std::span(entrySpan.begin(), nanEntries.begin());
+    std::ranges::sort(validEntries, {}, &BandJoinSortEntry::bandValue);
+    return validEntries.size();
+}
+
+namespace
+{
+nautilus::val<double> readBandValue(const nautilus::val<int8_t*>& entry)
+{
+    return Nautilus::Util::readValueFromMemRef<double>(Nautilus::Util::getMemberRef(entry, &BandJoinSortEntry::bandValue));
+}
+
+nautilus::val<uint64_t> readPosition(const nautilus::val<int8_t*>& entry)
+{
+    return Nautilus::Util::readValueFromMemRef<uint64_t>(Nautilus::Util::getMemberRef(entry, &BandJoinSortEntry::position));
+}
+}
+
+BandJoinProbePhysicalOperator::BandJoinProbePhysicalOperator(
+    const OperatorHandlerId operatorHandlerId,
+    PhysicalFunction joinFunction,
+    WindowMetaData windowMetaData,
+    const JoinSchema& joinSchema,
+    std::shared_ptr<TupleBufferRef> leftMemoryProvider,
+    std::shared_ptr<TupleBufferRef> rightMemoryProvider,
+    PhysicalFunction leftBandFunction,
+    PhysicalFunction rightBandFunction,
+    const double lowerBound,
+    const double upperBound)
+    : NLJProbePhysicalOperator(
+          operatorHandlerId,
+          std::move(joinFunction),
+          std::move(windowMetaData),
+          joinSchema,
+          std::move(leftMemoryProvider),
+          std::move(rightMemoryProvider))
+    , leftBandFunction(std::move(leftBandFunction))
+    , rightBandFunction(std::move(rightBandFunction))
+    , lowerBound(lowerBound)
+    , upperBound(upperBound)
+{
+    PRECONDITION(
+        std::isfinite(lowerBound) and std::isfinite(upperBound) and lowerBound <= upperBound,
+        "The band [{}, {}] must be finite and not empty",
+        lowerBound,
+        upperBound);
+}
+
+std::pair<nautilus::val<int8_t*>, nautilus::val<uint64_t>> BandJoinProbePhysicalOperator::sortByBandValue(
+    const Interface::PagedVectorRef& pagedVector,
+    const TupleBufferRef& memoryProvider,
+    const PhysicalFunction& bandFunction,
+    ExecutionContext& executionCtx) const
+{
+    /// The band attribute is a join field and thus, a key field of the paged vector
+    const auto keyFields = getJoinFunctionFields(memoryProvider);
+    const auto numberOfTuples = pagedVector.getNumberOfTuples();
+    const auto entries
+        = executionCtx.pipelineMemoryProvider.arena.allocateMemory(numberOfTuples * nautilus::val<uint64_t>(sizeof(BandJoinSortEntry)));
+
+    auto currentEntry = entries;
+    nautilus::val<uint64_t> position(0);
+    for (auto it = pagedVector.begin(keyFields); it != pagedVector.end(keyFields); ++it)
+    {
+        bandFunction.execute(*it, executionCtx.pipelineMemoryProvider.arena)
+            .castToType(DataType::Type::FLOAT64)
+            .writeToMemory(Nautilus::Util::getMemberRef(currentEntry, &BandJoinSortEntry::bandValue));
+        VarVal(position).writeToMemory(Nautilus::Util::getMemberRef(currentEntry, &BandJoinSortEntry::position));
+        currentEntry += sizeof(BandJoinSortEntry);
+        ++position;
+    }
+
+    const auto numberOfEntries = invoke(sortBandJoinEntriesProxy, static_cast<nautilus::val<BandJoinSortEntry*>>(entries), numberOfTuples);
+    return {entries, numberOfEntries};
+}
+
+void BandJoinProbePhysicalOperator::joinPagedVectors(
+    const Interface::PagedVectorRef& leftPagedVector,
+    const Interface::PagedVectorRef& rightPagedVector,
+    ExecutionContext& executionCtx,
+    const nautilus::val<Timestamp>& windowStart,
+    const nautilus::val<Timestamp>& windowEnd) const
+{
+    if (leftPagedVector.getNumberOfTuples() == 0 or rightPagedVector.getNumberOfTuples() == 0)
+    {
+        return;
+    }
+
+    const auto [leftEntries, numberOfLeftEntries] = sortByBandValue(leftPagedVector, *leftMemoryProvider, leftBandFunction, executionCtx);
+    const auto [rightEntries, numberOfRightEntries]
+        = sortByBandValue(rightPagedVector, *rightMemoryProvider, rightBandFunction, executionCtx);
+    const auto leftKeyFields = getJoinFunctionFields(*leftMemoryProvider);
+    const auto rightKeyFields = getJoinFunctionFields(*rightMemoryProvider);
+    const auto leftRemainingFields = getRemainingFields(*leftMemoryProvider);
+    const auto rightRemainingFields = getRemainingFields(*rightMemoryProvider);
+    const nautilus::val<uint64_t> entrySize(sizeof(BandJoinSortEntry));
+
+    /// The right records within the band of a left record satisfy leftBand - upperBound <= rightBand <= leftBand - lowerBound
+    nautilus::val<uint64_t> firstCandidate(0);
+    for (nautilus::val<uint64_t> leftIndex(0); leftIndex < numberOfLeftEntries; ++leftIndex)
+    {
+        const auto leftEntry = leftEntries + (leftIndex * entrySize);
+        const auto leftBandValue = readBandValue(leftEntry);
+
+        /// Right records below the band of this left record are below the bands of all following left records, too
+        while (firstCandidate < numberOfRightEntries)
+        {
+            if (readBandValue(rightEntries + (firstCandidate * entrySize)) >= leftBandValue - upperBound)
+            {
+                break;
+            }
+            ++firstCandidate;
+        }
+
+        const auto leftPosition = readPosition(leftEntry);
+        const auto leftKeyRecord = leftPagedVector.readRecord(leftPosition, leftKeyFields);
+        for (auto rightIndex = firstCandidate; rightIndex < numberOfRightEntries; ++rightIndex)
+        {
+            const auto rightEntry = rightEntries + (rightIndex * entrySize);
+            if (readBandValue(rightEntry) > leftBandValue - lowerBound)
+            {
+                break;
+            }
+
+            const auto rightPosition = readPosition(rightEntry);
+            const auto rightKeyRecord = rightPagedVector.readRecord(rightPosition, rightKeyFields);
+            auto joinedRecord = createJoinedRecord(leftKeyRecord, rightKeyRecord, windowStart, windowEnd, leftKeyFields, rightKeyFields);
+            if (joinFunction.execute(joinedRecord, executionCtx.pipelineMemoryProvider.arena))
+            {
+                /// Solely reading the remaining fields of both records, if they satisfy the join function
+                materializeFields(joinedRecord, leftPagedVector, leftPosition, leftRemainingFields);
+                materializeFields(joinedRecord, rightPagedVector, rightPosition, rightRemainingFields);
+                executeChild(executionCtx, joinedRecord);
+            }
+        }
+    }
+}
+
+}
@@ -20,6 +20,7 @@
 #include <Join/StreamJoinBuildPhysicalOperator.hpp>
 #include <Join/StreamJoinUtil.hpp>
 #include <Nautilus/Interface/BufferRef/TupleBufferRef.hpp>
+#include <Nautilus/Interface/PagedVector/PagedVector.hpp>
 #include <Nautilus/Interface/PagedVector/PagedVectorRef.hpp>
 #include <Nautilus/Interface/Record.hpp>
 #include <Runtime/Execution/OperatorHandler.hpp>
@@ -31,6 +32,7 @@
 #include <ExecutionContext.hpp>
 #include <WindowBuildPhysicalOperator.hpp>
 #include <function.hpp>
+#include <val_ptr.hpp>
 
 namespace NES
 {
@@ -57,35 +59,40 @@ NLJBuildPhysicalOperator::NLJBuildPhysicalOperator(
 
 void NLJBuildPhysicalOperator::execute(ExecutionContext& executionCtx, Record& record) const
 {
-    /// Getting the operator handler from the local state
-    auto* const localState = dynamic_cast<WindowOperatorBuildLocalState*>(executionCtx.getLocalState(id));
-    auto operatorHandler = localState->getOperatorHandler();
-
-    /// Get the current slice / pagedVector that we have to insert the tuple into
     const auto timestamp = timeFunction->getTs(executionCtx, record);
-    const auto sliceReference = invoke(
-        +[](OperatorHandler* ptrOpHandler, const Timestamp timestampVal)
-        {
-            PRECONDITION(ptrOpHandler != nullptr, "opHandler context should not be null!");
-            const auto* opHandler = dynamic_cast<NLJOperatorHandler*>(ptrOpHandler);
-            const auto createFunction = opHandler->getCreateNewSlicesFunction({});
-            return dynamic_cast<NLJSlice*>(opHandler->getSliceAndWindowStore().getSlicesOrCreate(timestampVal, createFunction)[0].get());
-        },
-        operatorHandler,
-        timestamp);
-    const auto nljPagedVectorMemRef = invoke(
-        +[](const NLJSlice* nljSlice, const WorkerThreadId workerThreadId, const JoinBuildSideType joinBuildSide)
-        {
-            PRECONDITION(nljSlice != nullptr, "nlj slice pointer should not be null!");
-            return nljSlice->getPagedVectorRef(workerThreadId, joinBuildSide);
-        },
-        sliceReference,
-        executionCtx.workerThreadId,
-        nautilus::val<JoinBuildSideType>(joinBuildSide));
-
+    if (not isLateRecord(executionCtx, timestamp))
+    {
+        /// Get the current slice / pagedVector that we have to insert the tuple into
+        const auto nljPagedVectorMemRef = static_cast<nautilus::val<Interface::PagedVector*>>(getSliceStateCached(
+            executionCtx,
+            timestamp,
+            [&](const nautilus::val<OperatorHandler*>& operatorHandler)
+            {
+                const auto sliceReference = invoke(
+                    +[](OperatorHandler* ptrOpHandler, const Timestamp timestampVal)
+                    {
+                        PRECONDITION(ptrOpHandler != nullptr, "opHandler context should not be null!");
+                        const auto* opHandler = dynamic_cast<NLJOperatorHandler*>(ptrOpHandler);
+                        const auto createFunction = opHandler->getCreateNewSlicesFunction({});
+                        return dynamic_cast<NLJSlice*>(
+                            opHandler->getSliceAndWindowStore().getSlicesOrCreate(timestampVal, createFunction)[0].get());
+                    },
+                    operatorHandler,
+                    timestamp);
+                return static_cast<nautilus::val<int8_t*>>(invoke(
+                    +[](const NLJSlice* nljSlice, const WorkerThreadId workerThreadId, const JoinBuildSideType joinBuildSide)
+                    {
+                        PRECONDITION(nljSlice != nullptr, "nlj slice pointer should not be null!");
+                        return nljSlice->getPagedVectorRef(workerThreadId, joinBuildSide);
+                    },
+                    sliceReference,
+                    executionCtx.workerThreadId,
+                    nautilus::val<JoinBuildSideType>(joinBuildSide)));
+            }));
 
-    /// Write record to the pagedVector
-    const Interface::PagedVectorRef pagedVectorRef(nljPagedVectorMemRef, bufferRef);
-    pagedVectorRef.writeRecord(record, executionCtx.pipelineMemoryProvider.bufferProvider);
+        /// Write record to the pagedVector
+        const Interface::PagedVectorRef pagedVectorRef(nljPagedVectorMemRef, bufferRef);
+        pagedVectorRef.writeRecord(record, executionCtx.pipelineMemoryProvider.bufferProvider);
+    }
 }
 }
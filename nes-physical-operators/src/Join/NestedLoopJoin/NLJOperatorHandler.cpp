@@ -15,7 +15,7 @@
 #include <Join/NestedLoopJoin/NLJOperatorHandler.hpp>
 
 #include <algorithm>
-#include <chrono>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <utility>
@@ -43,6 +43,12 @@ NLJOperatorHandler::NLJOperatorHandler(
 {
 }
 
+void NLJOperatorHandler::start(PipelineExecutionContext& pipelineExecutionContext, const uint32_t localStateVariableId)
+{
+    StreamJoinOperatorHandler::start(pipelineExecutionContext, localStateVariableId);
+    restoreCheckpoint(getCreateNewSlicesFunction({}), pipelineExecutionContext.getBufferManager().get());
+}
+
 std::function<std::vector<std::shared_ptr<Slice>>(SliceStart, SliceEnd)>
 NLJOperatorHandler::getCreateNewSlicesFunction(const CreateNewSlicesArguments&) const
 {
@@ -68,6 +74,9 @@ void NLJOperatorHandler::emitSlicesToProbe(
     auto& nljSliceLeft = dynamic_cast<NLJSlice&>(sliceLeft);
     auto& nljSliceRight = dynamic_cast<NLJSlice&>(sliceRight);
 
+    /// The slice store might have spilled the slices to disk, if they exceeded its memory budget
+    nljSliceLeft.reloadState(pipelineCtx->getBufferManager().get());
+    nljSliceRight.reloadState(pipelineCtx->getBufferManager().get());
     nljSliceLeft.combinePagedVectors();
     nljSliceRight.combinePagedVectors();
     const auto totalNumberOfTuples = nljSliceLeft.getNumberOfTuplesLeft() + nljSliceRight.getNumberOfTuplesRight();
@@ -82,13 +91,14 @@ void NLJOperatorHandler::emitSlicesToProbe(
     tupleBuffer.setLastChunk(sequenceData.lastChunk);
     tupleBuffer.setWatermark(windowInfo.windowStart);
     tupleBuffer.setNumberOfTuples(totalNumberOfTuples);
-    tupleBuffer.setCreationTimestampInMS(Timestamp(
-        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now().time_since_epoch()).count()));
+    auto creationTimestamps = sliceLeft.getCreationTimestamps();
+    creationTimestamps.merge(sliceRight.getCreationTimestamps());
+    setCreationTimestamps(tupleBuffer, creationTimestamps);
     new (tupleBuffer.getAvailableMemoryArea().data())
         EmittedNLJWindowTrigger{windowInfo, sliceLeft.getSliceEnd(), sliceRight.getSliceEnd()};
 
-    /// Dispatching the buffer to the probe operator via the task queue.
-    pipelineCtx->emitBuffer(tupleBuffer);
+    /// Dispatching the buffer to the probe operator via the task queue, which runs the triggers before other tasks by their window end.
+    pipelineCtx->emitBufferWithDeadline(tupleBuffer, windowInfo.windowEnd);
 
     NES_DEBUG(
         "Emitted leftSliceId {} rightSliceId {} with watermarkTs {} sequenceNumber {} originId {} for no. left tuples "
@@ -14,6 +14,7 @@
 
 #include <Join/NestedLoopJoin/NLJProbePhysicalOperator.hpp>
 
+#include <algorithm>
 #include <cstdint>
 #include <memory>
 #include <utility>
@@ -23,6 +24,7 @@
 #include <Join/NestedLoopJoin/NLJSlice.hpp>
 #include <Join/StreamJoinProbePhysicalOperator.hpp>
 #include <Join/StreamJoinUtil.hpp>
+#include <MemoryLayout/MemoryLayout.hpp>
 #include <Nautilus/Interface/BufferRef/TupleBufferRef.hpp>
 #include <Nautilus/Interface/NESStrongTypeRef.hpp>
 #include <Nautilus/Interface/PagedVector/PagedVectorRef.hpp>
@@ -105,29 +107,50 @@ void NLJProbePhysicalOperator::performNLJ(
     const nautilus::val<Timestamp>& windowStart,
     const nautilus::val<Timestamp>& windowEnd) const
 {
-    const auto outerKeyFields = outerMemoryProvider.getMemoryLayout()->getKeyFieldNames();
-    const auto innerKeyFields = innerMemoryProvider.getMemoryLayout()->getKeyFieldNames();
-    const auto outerFields = outerMemoryProvider.getMemoryLayout()->getSchema().getFieldNames();
-    const auto innerFields = innerMemoryProvider.getMemoryLayout()->getSchema().getFieldNames();
-
-    nautilus::val<uint64_t> outerItemPos(0);
-    for (auto outerIt = outerPagedVector.begin(outerKeyFields); outerIt != outerPagedVector.end(outerKeyFields); ++outerIt)
+    const auto outerKeyFields = getJoinFunctionFields(outerMemoryProvider);
+    const auto innerKeyFields = getJoinFunctionFields(innerMemoryProvider);
+    const auto outerRemainingFields = getRemainingFields(outerMemoryProvider);
+    const auto innerRemainingFields = getRemainingFields(innerMemoryProvider);
+
+    /// Block nested loop: each scan over the inner records joins them with a block of outer records, which stays in the cache for the
+    /// whole scan. Thus, we read the inner records once per block instead of once per outer record.
+    const auto outerTupleSize = std::max<uint64_t>(outerMemoryProvider.getMemoryLayout()->getTupleSize(), 1);
+    const nautilus::val<uint64_t> outerBlockSize(std::max<uint64_t>(OUTER_BLOCK_SIZE_IN_BYTES / outerTupleSize, 1));
+    const auto numberOfOuterTuples = outerPagedVector.getNumberOfTuples();
+
+    auto outerBlockBegin = outerPagedVector.begin(outerKeyFields);
+    for (nautilus::val<uint64_t> blockStart = 0; blockStart < numberOfOuterTuples; blockStart = blockStart + outerBlockSize)
     {
+        auto blockEnd = blockStart + outerBlockSize;
+        if (blockEnd > numberOfOuterTuples)
+        {
+            blockEnd = numberOfOuterTuples;
+        }
+
         nautilus::val<uint64_t> innerItemPos(0);
         for (auto innerIt = innerPagedVector.begin(innerKeyFields); innerIt != innerPagedVector.end(innerKeyFields); ++innerIt)
         {
-            const auto joinedKeyFields = createJoinedRecord(*outerIt, *innerIt, windowStart, windowEnd, outerKeyFields, innerKeyFields);
-            if (joinFunction.execute(joinedKeyFields, executionCtx.pipelineMemoryProvider.arena))
+            const auto innerKeyRecord = *innerIt;
+            auto outerIt = outerBlockBegin;
+            for (nautilus::val<uint64_t> outerItemPos = blockStart; outerItemPos < blockEnd; ++outerItemPos)
             {
-                auto outerRecord = outerPagedVector.readRecord(outerItemPos, outerFields);
-                auto innerRecord = innerPagedVector.readRecord(innerItemPos, innerFields);
-                auto joinedRecord = createJoinedRecord(outerRecord, innerRecord, windowStart, windowEnd, outerFields, innerFields);
-                executeChild(executionCtx, joinedRecord);
+                auto joinedRecord = createJoinedRecord(*outerIt, innerKeyRecord, windowStart, windowEnd, outerKeyFields, innerKeyFields);
+                if (joinFunction.execute(joinedRecord, executionCtx.pipelineMemoryProvider.arena))
+                {
+                    /// Solely reading the remaining fields of both records, if they satisfy the join function
+                    materializeFields(joinedRecord, outerPagedVector, outerItemPos, outerRemainingFields);
+                    materializeFields(joinedRecord, innerPagedVector, innerItemPos, innerRemainingFields);
+                    executeChild(executionCtx, joinedRecord);
+                }
+                ++outerIt;
             }
-
             ++innerItemPos;
         }
-        ++outerItemPos;
+
+        for (nautilus::val<uint64_t> outerItemPos = blockStart; outerItemPos < blockEnd; ++outerItemPos)
+        {
+            ++outerBlockBegin;
+        }
     }
 }
 
@@ -136,6 +159,8 @@ void NLJProbePhysicalOperator::open(ExecutionContext& executionCtx, RecordBuffer
     /// As this operator functions as a scan, we have to set the execution context for this pipeline
     executionCtx.watermarkTs = recordBuffer.getWatermarkTs();
     executionCtx.currentTs = recordBuffer.getCreatingTs();
+    executionCtx.creationTs = recordBuffer.getCreatingTs();
+    executionCtx.latestCreationTs = recordBuffer.getLatestCreationTs();
     executionCtx.sequenceNumber = recordBuffer.getSequenceNumber();
     executionCtx.chunkNumber = recordBuffer.getChunkNumber();
     executionCtx.lastChunk = recordBuffer.isLastChunk();
@@ -180,6 +205,16 @@ void NLJProbePhysicalOperator::open(ExecutionContext& executionCtx, RecordBuffer
 
     const Interface::PagedVectorRef leftPagedVector(leftPagedVectorRef, leftMemoryProvider);
     const Interface::PagedVectorRef rightPagedVector(rightPagedVectorRef, rightMemoryProvider);
+    joinPagedVectors(leftPagedVector, rightPagedVector, executionCtx, windowStart, windowEnd);
+}
+
+void NLJProbePhysicalOperator::joinPagedVectors(
+    const Interface::PagedVectorRef& leftPagedVector,
+    const Interface::PagedVectorRef& rightPagedVector,
+    ExecutionContext& executionCtx,
+    const nautilus::val<Timestamp>& windowStart,
+    const nautilus::val<Timestamp>& windowEnd) const
+{
     const auto numberOfTuplesLeft = leftPagedVector.getNumberOfTuples();
     const auto numberOfTuplesRight = rightPagedVector.getNumberOfTuples();
 
@@ -14,15 +14,22 @@
 
 #include <Join/NestedLoopJoin/NLJSlice.hpp>
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
+#include <cstdio>
+#include <filesystem>
 #include <memory>
 #include <mutex>
 #include <numeric>
 #include <utility>
+#include <vector>
 #include <Identifiers/Identifiers.hpp>
 #include <Join/StreamJoinUtil.hpp>
 #include <Nautilus/Interface/PagedVector/PagedVector.hpp>
+#include <Runtime/AbstractBufferProvider.hpp>
 #include <SliceStore/Slice.hpp>
+#include <ErrorHandling.hpp>
 
 namespace NES
 {
@@ -111,4 +118,122 @@ void NLJSlice::combinePagedVectors()
         rightPagedVectors.erase(rightPagedVectors.begin() + 1, rightPagedVectors.end());
     }
 }
+
+uint64_t NLJSlice::getStateSizeInBytes() const
+{
+    uint64_t sizeInBytes = 0;
+    for (const auto& pagedVector : leftPagedVectors)
+    {
+        sizeInBytes += pagedVector->getSizeOfPagesInBytes();
+    }
+    for (const auto& pagedVector : rightPagedVectors)
+    {
+        sizeInBytes += pagedVector->getSizeOfPagesInBytes();
+    }
+    return sizeInBytes;
+}
+
+void NLJSlice::addStateSizeInBytesPerWorkerThread(std::vector<uint64_t>& stateSizeInBytesPerWorkerThread) const
+{
+    stateSizeInBytesPerWorkerThread.resize(std::max(stateSizeInBytesPerWorkerThread.size(), leftPagedVectors.size()), 0);
+    for (size_t workerThread = 0; workerThread < leftPagedVectors.size(); ++workerThread)
+    {
+        stateSizeInBytesPerWorkerThread[workerThread] += leftPagedVectors[workerThread]->getSizeOfPagesInBytes();
+    }
+    stateSizeInBytesPerWorkerThread.resize(std::max(stateSizeInBytesPerWorkerThread.size(), rightPagedVectors.size()), 0);
+    for (size_t workerThread = 0; workerThread < rightPagedVectors.size(); ++workerThread)
+    {
+        stateSizeInBytesPerWorkerThread[workerThread] += rightPagedVectors[workerThread]->getSizeOfPagesInBytes();
+    }
+}
+
+uint64_t NLJSlice::spillState(const std::filesystem::path& spillDirectory)
+{
+    const std::scoped_lock lock(spillMutex);
+    if (spillFile != nullptr)
+    {
+        return 0;
+    }
+
+    spillFile = createSpillFile(spillDirectory);
+    uint64_t spilledBytes = 0;
+    for (auto* pagedVectors : {&leftPagedVectors, &rightPagedVectors})
+    {
+        for (const auto& pagedVector : *pagedVectors)
+        {
+            const auto sizeInBytes = pagedVector->getSizeOfPagesInBytes();
+            if (pagedVector->spillPages(spillFile.get()))
+            {
+                spilledBytes += sizeInBytes;
+            }
+        }
+    }
+    return spilledBytes;
+}
+
+void NLJSlice::reloadState(AbstractBufferProvider* bufferProvider)
+{
+    const std::scoped_lock lock(spillMutex);
+    if (spillFile == nullptr)
+    {
+        return;
+    }
+
+    for (auto* pagedVectors : {&leftPagedVectors, &rightPagedVectors})
+    {
+        for (const auto& pagedVector : *pagedVectors)
+        {
+            if (pagedVector->hasSpilledPages())
+            {
+                pagedVector->reloadPages(spillFile.get(), bufferProvider);
+            }
+        }
+    }
+    spillFile.reset();
+}
+
+bool NLJSlice::writeCheckpoint(std::FILE* file)
+{
+    /// A worker thread might combine the PagedVectors of this slice for the probe of an emitted window meanwhile
+    const std::scoped_lock lock(spillMutex, combinePagedVectorsMutex);
+    if (spillFile != nullptr)
+    {
+        return false;
+    }
+
+    for (auto* pagedVectors : {&leftPagedVectors, &rightPagedVectors})
+    {
+        const uint64_t numberOfPagedVectors = pagedVectors->size();
+        if (std::fwrite(&numberOfPagedVectors, sizeof(numberOfPagedVectors), 1, file) != 1)
+        {
+            throw CannotSpillState("Could not write the number of PagedVectors to the checkpoint file");
+        }
+        for (const auto& pagedVector : *pagedVectors)
+        {
+            if (not pagedVector->writePages(file))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+void NLJSlice::readCheckpoint(std::FILE* file, AbstractBufferProvider* bufferProvider)
+{
+    const std::scoped_lock lock(spillMutex, combinePagedVectorsMutex);
+    PRECONDITION(spillFile == nullptr, "A checkpoint must not be read into a spilled slice");
+    for (auto* pagedVectors : {&leftPagedVectors, &rightPagedVectors})
+    {
+        uint64_t numberOfPagedVectors = 0;
+        if (std::fread(&numberOfPagedVectors, sizeof(numberOfPagedVectors), 1, file) != 1)
+        {
+            throw CannotSpillState("Could not read the number of PagedVectors from the checkpoint file");
+        }
+        for (uint64_t i = 0; i < numberOfPagedVectors; ++i)
+        {
+            (*pagedVectors)[i % pagedVectors->size()]->readPages(file, bufferProvider);
+        }
+    }
+}
 }
@@ -0,0 +1,189 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Join/NestedLoopJoin/PointRTree.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <ErrorHandling.hpp>
+
+namespace NES
+{
+
+namespace
+{
+/// A tree over 2^64 entries has 16 levels, thus the depth-first traversal keeps at most 16 levels of siblings on its stack
+constexpr uint64_t MAX_DEPTH = 16;
+
+uint64_t ceilDiv(const uint64_t dividend, const uint64_t divisor)
+{
+    return (dividend + divisor - 1) / divisor;
+}
+
+/// Sorts the items into slabs by their x and each slab by their y, such that each NODE_CAPACITY consecutive items form a node
+template <typename Item, typename CoordinateX, typename CoordinateY>
+void sortTileRecursive(const std::span<Item> items, const CoordinateX& coordinateX, const CoordinateY& coordinateY)
+{
+    if (items.empty())
+    {
+        return;
+    }
+    const auto numberOfNodes = ceilDiv(items.size(), PointRTree::NODE_CAPACITY);
+    const auto numberOfSlabs = static_cast<uint64_t>(std::ceil(std::sqrt(static_cast<double>(numberOfNodes))));
+    const auto itemsPerSlab = ceilDiv(numberOfNodes, numberOfSlabs) * PointRTree::NODE_CAPACITY;
+    std::ranges::sort(items, {}, coordinateX);
+    for (uint64_t begin = 0; begin < items.size(); begin += itemsPerSlab)
+    {
+        std::ranges::sort(items.subspan(begin, std::min<uint64_t>(itemsPerSlab, items.size() - begin)), {}, coordinateY);
+    }
+}
+
+PointRTree::Range boundsOf(const PointRTree::Entry& entry)
+{
+    return {.xmin = entry.x, .ymin = entry.y, .xmax = entry.x, .ymax = entry.y, .tmin = entry.t, .tmax = entry.t};
+}
+
+void extend(PointRTree::Range& bounds, const PointRTree::Range& other)
+{
+    bounds.xmin = std::min(bounds.xmin, other.xmin);
+    bounds.ymin = std::min(bounds.ymin, other.ymin);
+    bounds.xmax = std::max(bounds.xmax, other.xmax);
+    bounds.ymax = std::max(bounds.ymax, other.ymax);
+    bounds.tmin = std::min(bounds.tmin, other.tmin);
+    bounds.tmax = std::max(bounds.tmax, other.tmax);
+}
+
+bool intersects(const PointRTree::Range& bounds, const PointRTree::Range& range)
+{
+    return bounds.xmin <= range.xmax and range.xmin <= bounds.xmax and bounds.ymin <= range.ymax and range.ymin <= bounds.ymax
+        and bounds.tmin <= range.tmax and range.tmin <= bounds.tmax;
+}
+
+bool contains(const PointRTree::Range& range, const PointRTree::Entry& entry)
+{
+    return range.xmin <= entry.x and entry.x <= range.xmax and range.ymin <= entry.y and entry.y <= range.ymax and range.tmin <= entry.t
+        and entry.t <= range.tmax;
+}
+
+double centerX(const PointRTree::Node& node)
+{
+    return (node.bounds.xmin / 2) + (node.bounds.xmax / 2);
+}
+
+double centerY(const PointRTree::Node& node)
+{
+    return (node.bounds.ymin / 2) + (node.bounds.ymax / 2);
+}
+}
+
+uint64_t PointRTree::getNumberOfNodes(const uint64_t numberOfEntries)
+{
+    if (numberOfEntries == 0)
+    {
+        return 0;
+    }
+    uint64_t numberOfNodes = 0;
+    uint64_t nodesOfLevel = numberOfEntries;
+    do
+    {
+        nodesOfLevel = ceilDiv(nodesOfLevel, NODE_CAPACITY);
+        numberOfNodes += nodesOfLevel;
+    } while (nodesOfLevel > 1);
+    return numberOfNodes;
+}
+
+uint64_t PointRTree::build(const std::span<Entry> entries, const std::span<Node> nodes)
+{
+    PRECONDITION(
+        nodes.size() >= getNumberOfNodes(entries.size()),
+        "The R-tree over {} entries requires {} nodes, but got {}",
+        entries.size(),
+        getNumberOfNodes(entries.size()),
+        nodes.size());
+    const auto nanEntries
+        = std::ranges::partition(entries, [](const Entry& entry) { return not std::isnan(entry.x) and not std::isnan(entry.y); });
+    const auto validEntries = std::span(entries.begin(), nanEntries.begin());
+
+    /// The leaves hold the entries in STR order
+    sortTileRecursive(validEntries, &Entry::x, &Entry::y);
+    uint64_t numberOfNodes = 0;
+    for (uint64_t begin = 0; begin < validEntries.size(); begin += NODE_CAPACITY)
+    {
+        const auto end = std::min<uint64_t>(begin + NODE_CAPACITY, validEntries.size());
+        Node leaf{.bounds = boundsOf(validEntries[begin]), .begin = begin, .end = end, .isLeaf = true};
+        for (auto index = begin + 1; index < end; ++index)
+        {
+            extend(leaf.bounds, boundsOf(validEntries[index]));
+        }
+        nodes[numberOfNodes++] = leaf;
+    }
+
+    /// Each level packs the nodes of the level below, until a single root remains.
+    /// Sorting the nodes of a level is fine, as solely the level above refers to their positions.
+    uint64_t levelBegin = 0;
+    while (numberOfNodes - levelBegin > 1)
+    {
+        const auto level = nodes.subspan(levelBegin, numberOfNodes - levelBegin);
+        sortTileRecursive(level, centerX, centerY);
+        for (uint64_t begin = 0; begin < level.size(); begin += NODE_CAPACITY)
+        {
+            const auto end = std::min<uint64_t>(begin + NODE_CAPACITY, level.size());
+            Node parent{.bounds = level[begin].bounds, .begin = levelBegin + begin, .end = levelBegin + end, .isLeaf = false};
+            for (auto index = begin + 1; index < end; ++index)
+            {
+                extend(parent.bounds, level[index].bounds);
+            }
+            nodes[numberOfNodes++] = parent;
+        }
+        levelBegin += level.size();
+    }
+    return numberOfNodes;
+}
+
+uint64_t PointRTree::query(
+    const std::span<const Entry> entries, const std::span<const Node> nodes, const Range& range, const std::span<uint64_t> positions)
+{
+    if (nodes.empty() or not intersects(nodes.back().bounds, range))
+    {
+        return 0;
+    }
+
+    /// Depth-first traversal, which solely pushes the children that intersect the range
+    std::array<uint64_t, NODE_CAPACITY * MAX_DEPTH> stack{};
+    size_t stackSize = 0;
+    stack[stackSize++] = nodes.size() - 1;
+    uint64_t numberOfPositions = 0;
+    while (stackSize > 0)
+    {
+        const auto& node = nodes[stack[--stackSize]];
+        for (auto child = node.begin; child < node.end; ++child)
+        {
+            if (node.isLeaf and contains(range, entries[child]))
+            {
+                positions[numberOfPositions++] = entries[child].position;
+            }
+            else if (not node.isLeaf and intersects(nodes[child].bounds, range))
+            {
+                stack[stackSize++] = child;
+            }
+        }
+    }
+    return numberOfPositions;
+}
+
+}
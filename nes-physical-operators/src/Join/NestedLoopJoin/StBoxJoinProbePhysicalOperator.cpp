@@ -0,0 +1,201 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Join/NestedLoopJoin/StBoxJoinProbePhysicalOperator.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <utility>
+#include <DataTypes/DataType.hpp>
+#include <Functions/PhysicalFunction.hpp>
+#include <Join/NestedLoopJoin/NLJProbePhysicalOperator.hpp>
+#include <Join/NestedLoopJoin/PointRTree.hpp>
+#include <Join/StreamJoinUtil.hpp>
+#include <Nautilus/DataTypes/DataTypesUtil.hpp>
+#include <Nautilus/DataTypes/VarVal.hpp>
+#include <Nautilus/DataTypes/VariableSizedData.hpp>
+#include <Nautilus/Interface/BufferRef/TupleBufferRef.hpp>
+#include <Nautilus/Interface/PagedVector/PagedVectorRef.hpp>
+#include <Runtime/Execution/OperatorHandler.hpp>
+#include <Time/Timestamp.hpp>
+#include <Windowing/WindowMetaData.hpp>
+#include <ErrorHandling.hpp>
+#include <ExecutionContext.hpp>
+#include <MEOSWrapper.hpp>
+#include <function.hpp>
+#include <val.hpp>
+#include <val_ptr.hpp>
+
+namespace NES
+{
+
+uint64_t buildStBoxJoinIndexProxy(
+    PointRTree::Entry* entries, const uint64_t numberOfEntries, PointRTree::Node* nodes, MEOS::Meos::EpochConverter* epochConverter)
+{
+    PRECONDITION(entries != nullptr or numberOfEntries == 0, "The entries should not be null");
+    PRECONDITION(epochConverter != nullptr, "The epoch converter should not be null");
+    const std::span entrySpan(entries, numberOfEntries);
+    /// The probe writes the epoch timestamps of the records, the STBoxes bound the MEOS timestamps
+    for (auto& entry : entrySpan)
+    {
+        entry.t = epochConverter->toTimestampTz(static_cast<uint64_t>(entry.t));
+    }
+    return PointRTree::build(entrySpan, std::span(nodes, PointRTree::getNumberOfNodes(numberOfEntries)));
+}
+
+uint64_t queryStBoxJoinIndexProxy(
+    const PointRTree::Entry* entries,
+    const uint64_t numberOfEntries,
+    const PointRTree::Node* nodes,
+    const uint64_t numberOfNodes,
+    const char* stbox,
+    const uint32_t stboxSize,
+    uint64_t* positions)
+{
+    const MEOS::Meos::SpatioTemporalBox box(MEOS::Meos::stripQuotes(std::string_view(stbox, stboxSize)));
+    const auto bounds = box.getBounds();
+    if (not bounds.has_value())
+    {
+        return 0;
+    }
+    const PointRTree::Range range{
+        .xmin = bounds->space.xmin,
+        .ymin = bounds->space.ymin,
+        .xmax = bounds->space.xmax,
+        .ymax = bounds->space.ymax,
+        .tmin = bounds->tmin,
+        .tmax = bounds->tmax};
+    return PointRTree::query(
+        std::span(entries, numberOfEntries), std::span(nodes, numberOfNodes), range, std::span(positions, numberOfEntries));
+}
+
+StBoxJoinProbePhysicalOperator::StBoxJoinProbePhysicalOperator(
+    const OperatorHandlerId operatorHandlerId,
+    PhysicalFunction joinFunction,
+    WindowMetaData windowMetaData,
+    const JoinSchema& joinSchema,
+    std::shared_ptr<TupleBufferRef> leftMemoryProvider,
+    std::shared_ptr<TupleBufferRef> rightMemoryProvider,
+    const JoinBuildSideType pointSide,
+    PhysicalFunction lonFunction,
+    PhysicalFunction latFunction,
+    PhysicalFunction timestampFunction,
+    PhysicalFunction stboxFunction)
+    : NLJProbePhysicalOperator(
+          operatorHandlerId,
+          std::move(joinFunction),
+          std::move(windowMetaData),
+          joinSchema,
+          std::move(leftMemoryProvider),
+          std::move(rightMemoryProvider))
+    , pointSide(pointSide)
+    , lonFunction(std::move(lonFunction))
+    , latFunction(std::move(latFunction))
+    , timestampFunction(std::move(timestampFunction))
+    , stboxFunction(std::move(stboxFunction))
+{
+}
+
+void StBoxJoinProbePhysicalOperator::joinPagedVectors(
+    const Interface::PagedVectorRef& leftPagedVector,
+    const Interface::PagedVectorRef& rightPagedVector,
+    ExecutionContext& executionCtx,
+    const nautilus::val<Timestamp>& windowStart,
+    const nautilus::val<Timestamp>& windowEnd) const
+{
+    const auto pointsAreLeft = pointSide == JoinBuildSideType::Left;
+    const auto& pointPagedVector = pointsAreLeft ? leftPagedVector : rightPagedVector;
+    const auto& boxPagedVector = pointsAreLeft ? rightPagedVector : leftPagedVector;
+    const auto& pointMemoryProvider = pointsAreLeft ? *leftMemoryProvider : *rightMemoryProvider;
+    const auto& boxMemoryProvider = pointsAreLeft ? *rightMemoryProvider : *leftMemoryProvider;
+    const auto numberOfPoints = pointPagedVector.getNumberOfTuples();
+    if (numberOfPoints == 0 or boxPagedVector.getNumberOfTuples() == 0)
+    {
+        return;
+    }
+
+    /// The coordinates of the points are join fields and thus, key fields of the paged vector
+    const auto pointKeyFields = getJoinFunctionFields(pointMemoryProvider);
+    const auto boxKeyFields = getJoinFunctionFields(boxMemoryProvider);
+    const auto pointRemainingFields = getRemainingFields(pointMemoryProvider);
+    const auto boxRemainingFields = getRemainingFields(boxMemoryProvider);
+    auto& arena = executionCtx.pipelineMemoryProvider.arena;
+
+    const auto entries = arena.allocateMemory(numberOfPoints * nautilus::val<uint64_t>(sizeof(PointRTree::Entry)));
+    auto currentEntry = entries;
+    nautilus::val<uint64_t> position(0);
+    for (auto it = pointPagedVector.begin(pointKeyFields); it != pointPagedVector.end(pointKeyFields); ++it)
+    {
+        const auto pointKeyRecord = *it;
+        lonFunction.execute(pointKeyRecord, arena)
+            .castToType(DataType::Type::FLOAT64)
+            .writeToMemory(Nautilus::Util::getMemberRef(currentEntry, &PointRTree::Entry::x));
+        latFunction.execute(pointKeyRecord, arena)
+            .castToType(DataType::Type::FLOAT64)
+            .writeToMemory(Nautilus::Util::getMemberRef(currentEntry, &PointRTree::Entry::y));
+        timestampFunction.execute(pointKeyRecord, arena)
+            .castToType(DataType::Type::UINT64)
+            .writeToMemory(Nautilus::Util::getMemberRef(currentEntry, &PointRTree::Entry::t));
+        VarVal(position).writeToMemory(Nautilus::Util::getMemberRef(currentEntry, &PointRTree::Entry::position));
+        currentEntry += sizeof(PointRTree::Entry);
+        ++position;
+    }
+
+    const auto maxNumberOfNodes
+        = nautilus::invoke(+[](const uint64_t numberOfEntries) { return PointRTree::getNumberOfNodes(numberOfEntries); }, numberOfPoints);
+    const auto nodes = arena.allocateMemory(maxNumberOfNodes * nautilus::val<uint64_t>(sizeof(PointRTree::Node)));
+    const auto numberOfNodes = nautilus::invoke(
+        buildStBoxJoinIndexProxy,
+        static_cast<nautilus::val<PointRTree::Entry*>>(entries),
+        numberOfPoints,
+        static_cast<nautilus::val<PointRTree::Node*>>(nodes),
+        nautilus::val<MEOS::Meos::EpochConverter*>(epochConverter.get()));
+    const auto candidates = arena.allocateMemory(numberOfPoints * nautilus::val<uint64_t>(sizeof(uint64_t)));
+
+    nautilus::val<uint64_t> boxPosition(0);
+    for (auto it = boxPagedVector.begin(boxKeyFields); it != boxPagedVector.end(boxKeyFields); ++it)
+    {
+        const auto boxKeyRecord = *it;
+        const auto stbox = stboxFunction.execute(boxKeyRecord, arena).cast<VariableSizedData>();
+        const auto numberOfCandidates = nautilus::invoke(
+            queryStBoxJoinIndexProxy,
+            static_cast<nautilus::val<const PointRTree::Entry*>>(entries),
+            numberOfPoints,
+            static_cast<nautilus::val<const PointRTree::Node*>>(nodes),
+            numberOfNodes,
+            stbox.getContent(),
+            stbox.getContentSize(),
+            static_cast<nautilus::val<uint64_t*>>(candidates));
+
+        for (nautilus::val<uint64_t> candidate(0); candidate < numberOfCandidates; ++candidate)
+        {
+            const auto pointPosition
+                = Nautilus::Util::readValueFromMemRef<uint64_t>(candidates + (candidate * nautilus::val<uint64_t>(sizeof(uint64_t))));
+            const auto pointKeyRecord = pointPagedVector.readRecord(pointPosition, pointKeyFields);
+            auto joinedRecord = createJoinedRecord(pointKeyRecord, boxKeyRecord, windowStart, windowEnd, pointKeyFields, boxKeyFields);
+            if (joinFunction.execute(joinedRecord, arena))
+            {
+                /// Solely reading the remaining fields of both records, if they satisfy the join function
+                materializeFields(joinedRecord, pointPagedVector, pointPosition, pointRemainingFields);
+                materializeFields(joinedRecord, boxPagedVector, boxPosition, boxRemainingFields);
+                executeChild(executionCtx, joinedRecord);
+            }
+        }
+        ++boxPosition;
+    }
+}
+
+}
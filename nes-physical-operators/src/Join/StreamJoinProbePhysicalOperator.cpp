@@ -14,13 +14,17 @@
 
 #include <Join/StreamJoinProbePhysicalOperator.hpp>
 
+#include <algorithm>
 #include <cstdint>
 #include <memory>
+#include <ranges>
 #include <utility>
 #include <vector>
 #include <Functions/PhysicalFunction.hpp>
 #include <Identifiers/Identifiers.hpp>
 #include <Join/StreamJoinUtil.hpp>
+#include <Nautilus/Interface/BufferRef/TupleBufferRef.hpp>
+#include <Nautilus/Interface/PagedVector/PagedVectorRef.hpp>
 #include <Nautilus/Interface/Record.hpp>
 #include <Nautilus/Interface/TimestampRef.hpp>
 #include <Runtime/Execution/OperatorHandler.hpp>
@@ -68,4 +72,38 @@ Record StreamJoinProbePhysicalOperator::createJoinedRecord(
 
     return joinedRecord;
 }
+
+std::vector<Record::RecordFieldIdentifier>
+StreamJoinProbePhysicalOperator::getJoinFunctionFields(const Interface::BufferRef::TupleBufferRef& memoryProvider)
+{
+    auto keyFields = memoryProvider.getMemoryLayout()->getKeyFieldNames();
+    if (keyFields.empty())
+    {
+        return memoryProvider.getMemoryLayout()->getSchema().getFieldNames();
+    }
+    return keyFields;
+}
+
+std::vector<Record::RecordFieldIdentifier>
+StreamJoinProbePhysicalOperator::getRemainingFields(const Interface::BufferRef::TupleBufferRef& memoryProvider)
+{
+    const auto joinFunctionFields = getJoinFunctionFields(memoryProvider);
+    return memoryProvider.getMemoryLayout()->getSchema().getFieldNames()
+        | std::views::filter([&](const auto& fieldName) { return not std::ranges::contains(joinFunctionFields, fieldName); })
+        | std::ranges::to<std::vector>();
+}
+
+void StreamJoinProbePhysicalOperator::materializeFields(
+    Record& joinedRecord,
+    const Interface::PagedVectorRef& pagedVector,
+    const nautilus::val<uint64_t>& pos,
+    const std::vector<Record::RecordFieldIdentifier>& fields)
+{
+    /// Reading a record without projections would read all fields
+    if (fields.empty())
+    {
+        return;
+    }
+    joinedRecord.reassignFields(pagedVector.readRecord(pos, fields));
+}
 }
@@ -47,4 +47,14 @@ void MapPhysicalOperator::setChild(PhysicalOperator child)
     this->child = std::move(child);
 }
 
+const Record::RecordFieldIdentifier& MapPhysicalOperator::getFieldToWriteTo() const
+{
+    return fieldToWriteTo;
+}
+
+const PhysicalFunction& MapPhysicalOperator::getMapFunction() const
+{
+    return mapFunction;
+}
+
 }
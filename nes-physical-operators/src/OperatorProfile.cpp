@@ -0,0 +1,125 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <OperatorProfile.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
+#include <fmt/format.h>
+#include <ErrorHandling.hpp>
+
+#if defined(__x86_64__)
+    #include <x86intrin.h>
+#endif
+
+namespace NES
+{
+
+OperatorProfile::OperatorProfile(const PipelineId pipelineId, const std::vector<std::pair<OperatorId, std::string>>& operators)
+    : pipelineId(pipelineId), counters(operators.size())
+{
+    for (size_t counter = 0; counter < operators.size(); ++counter)
+    {
+        std::tie(counters[counter].operatorId, counters[counter].name) = operators[counter];
+    }
+}
+
+std::optional<size_t> OperatorProfile::counterOf(const OperatorId operatorId) const
+{
+    const auto counter = std::ranges::find(counters, operatorId, &Counter::operatorId);
+    if (counter == counters.end())
+    {
+        return std::nullopt;
+    }
+    return std::distance(counters.begin(), counter);
+}
+
+void OperatorProfile::record(const size_t counter, const uint64_t cycles)
+{
+    PRECONDITION(counter < counters.size(), "The pipeline has {} profiled operators, but recorded operator {}", counters.size(), counter);
+    counters[counter].numberOfInvocations.fetch_add(1, std::memory_order_relaxed);
+    counters[counter].cycles.fetch_add(cycles, std::memory_order_relaxed);
+}
+
+uint64_t OperatorProfile::readCycleCounter()
+{
+#if defined(__x86_64__)
+    return __rdtsc();
+#elif defined(__aarch64__)
+    uint64_t value = 0;
+    asm volatile("mrs %0, cntvct_el0" : "=r"(value));
+    return value;
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+std::vector<OperatorProfile::OperatorCycles> OperatorProfile::getOperatorCycles() const
+{
+    std::vector<OperatorCycles> operatorCycles;
+    operatorCycles.reserve(counters.size());
+    for (const auto& counter : counters)
+    {
+        const auto cycles = counter.cycles.load(std::memory_order_relaxed);
+        operatorCycles.push_back(
+            {.operatorId = counter.operatorId,
+             .name = counter.name,
+             .numberOfInvocations = counter.numberOfInvocations.load(std::memory_order_relaxed),
+             .inclusiveCycles = cycles,
+             .exclusiveCycles = cycles});
+    }
+    /// The calls of the child are nested in the calls of its parent. As the counters are read one after another, the child may be ahead.
+    for (size_t parent = 0; parent + 1 < operatorCycles.size(); ++parent)
+    {
+        operatorCycles[parent].exclusiveCycles
+            -= std::min(operatorCycles[parent].inclusiveCycles, operatorCycles[parent + 1].inclusiveCycles);
+    }
+    return operatorCycles;
+}
+
+std::string OperatorProfile::toString() const
+{
+    auto operatorCycles = getOperatorCycles();
+    /// The calls of the root operator include all other calls of the pipeline
+    const auto totalCycles = operatorCycles.empty() ? 0 : operatorCycles.front().inclusiveCycles;
+    std::ranges::stable_sort(operatorCycles, std::ranges::greater{}, &OperatorCycles::exclusiveCycles);
+
+    std::string profile = fmt::format("Operator profile of pipeline {} ({} cycles):", pipelineId, totalCycles);
+    for (const auto& [operatorId, name, numberOfInvocations, inclusiveCycles, exclusiveCycles] : operatorCycles)
+    {
+        const auto share = totalCycles == 0 ? 0.0 : 100.0 * static_cast<double>(exclusiveCycles) / static_cast<double>(totalCycles);
+        profile += fmt::format(
+            "\n  Pipeline{}::{} ({}): {:.1f}% with {} cycles in {} invocations",
+            pipelineId,
+            name,
+            operatorId,
+            share,
+            exclusiveCycles,
+            numberOfInvocations);
+    }
+    return profile;
+}
+
+}
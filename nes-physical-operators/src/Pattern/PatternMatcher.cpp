@@ -0,0 +1,189 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Pattern/PatternMatcher.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <Time/Timestamp.hpp>
+#include <ErrorHandling.hpp>
+
+namespace NES
+{
+
+PatternMatcher::PatternMatcher(std::vector<Step> steps, const uint64_t within, const size_t maxRunsPerKey)
+    : steps(std::move(steps)), within(within), maxRunsPerKey(maxRunsPerKey)
+{
+    PRECONDITION(not this->steps.empty(), "A pattern requires at least one step");
+    PRECONDITION(maxRunsPerKey > 0, "A pattern requires at least one run per key");
+    for (const auto& step : this->steps)
+    {
+        PRECONDITION(step.events != 0, "A step of a pattern requires at least one event");
+        PRECONDITION(
+            step.type != Step::Type::ITERATION or std::has_single_bit(step.events), "An iteration of a pattern repeats a single event");
+    }
+}
+
+bool PatternMatcher::hasTimedOut(const Run& run, const Timestamp timestamp) const
+{
+    return timestamp.getRawValue() > run.start.getRawValue() + within;
+}
+
+bool PatternMatcher::tryAdvance(Run& run, const uint64_t matchedEvents, const Timestamp timestamp) const
+{
+    const auto& step = steps[run.step];
+    if (step.type == Step::Type::ITERATION and run.progress >= step.minimumRepetitions and run.step + 1 < steps.size()
+        and (matchedEvents & steps[run.step + 1].events) != 0)
+    {
+        /// The iteration has been repeated often enough and the record continues the pattern with the next step
+        ++run.step;
+        run.progress = 0;
+        return tryAdvance(run, matchedEvents, timestamp);
+    }
+
+    const auto matchedEventsOfStep = matchedEvents & step.events;
+    if (matchedEventsOfStep == 0)
+    {
+        return false;
+    }
+    bool completedStep = false;
+    switch (step.type)
+    {
+        case Step::Type::ANY:
+            completedStep = true;
+            break;
+        case Step::Type::ALL: {
+            const auto newEvents = matchedEventsOfStep & ~run.progress;
+            if (newEvents == 0)
+            {
+                return false;
+            }
+            /// A record is a single event of the conjunction, even if it matches multiple of its events
+            run.progress |= uint64_t{1} << std::countr_zero(newEvents);
+            completedStep = run.progress == step.events;
+            break;
+        }
+        case Step::Type::ITERATION: {
+            ++run.progress;
+            const bool isLastStep = run.step + 1 == steps.size();
+            completedStep = run.progress == step.maximumRepetitions or (isLastStep and run.progress == step.minimumRepetitions);
+            break;
+        }
+    }
+
+    if (completedStep)
+    {
+        ++run.step;
+        run.progress = 0;
+    }
+    run.last = timestamp;
+    ++run.numberOfEvents;
+    return true;
+}
+
+void PatternMatcher::advance(
+    const std::string_view key, const uint64_t matchedEvents, const Timestamp timestamp, std::vector<Match>& matches)
+{
+    auto runsIt = runsOfKey.find(key);
+    const bool startsRun = (matchedEvents & steps.front().events) != 0;
+    if (runsIt == runsOfKey.end())
+    {
+        if (not startsRun)
+        {
+            return;
+        }
+        runsIt = runsOfKey.emplace(std::string(key), std::vector<Run>{}).first;
+    }
+    auto& runs = runsIt->second;
+
+    const auto completeOrTimedOut = [&](Run& run)
+    {
+        if (hasTimedOut(run, timestamp))
+        {
+            return true;
+        }
+        if (tryAdvance(run, matchedEvents, timestamp) and run.step == steps.size())
+        {
+            matches.push_back({.start = run.start, .end = run.last, .numberOfEvents = run.numberOfEvents});
+            return true;
+        }
+        return false;
+    };
+    const auto numberOfRunsBefore = runs.size();
+    std::erase_if(runs, completeOrTimedOut);
+
+    if (startsRun)
+    {
+        Run run{.start = timestamp};
+        if (not completeOrTimedOut(run))
+        {
+            if (runs.size() >= maxRunsPerKey)
+            {
+                runs.erase(runs.begin());
+                ++numberOfDroppedRuns;
+            }
+            runs.push_back(run);
+        }
+    }
+
+    numberOfRuns = numberOfRuns - numberOfRunsBefore + runs.size();
+    if (runs.empty())
+    {
+        runsOfKey.erase(runsIt);
+    }
+}
+
+void PatternMatcher::collectGarbage(const Timestamp watermark)
+{
+    for (auto runsIt = runsOfKey.begin(); runsIt != runsOfKey.end();)
+    {
+        auto& runs = runsIt->second;
+        numberOfRuns -= std::erase_if(runs, [&](const Run& run) { return hasTimedOut(run, watermark); });
+        runsIt = runs.empty() ? runsOfKey.erase(runsIt) : std::next(runsIt);
+    }
+}
+
+size_t PatternMatcher::getNumberOfKeys() const
+{
+    return runsOfKey.size();
+}
+
+size_t PatternMatcher::getNumberOfRuns() const
+{
+    return numberOfRuns;
+}
+
+uint64_t PatternMatcher::getNumberOfDroppedRuns() const
+{
+    return numberOfDroppedRuns;
+}
+
+uint64_t PatternMatcher::getStateSizeInBytes() const
+{
+    uint64_t stateSize = numberOfRuns * sizeof(Run);
+    for (const auto& [key, runs] : runsOfKey)
+    {
+        stateSize += key.size() + sizeof(runs);
+    }
+    return stateSize;
+}
+
+}
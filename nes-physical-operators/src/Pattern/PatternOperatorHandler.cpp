@@ -0,0 +1,117 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Pattern/PatternOperatorHandler.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
+#include <Pattern/PatternMatcher.hpp>
+#include <Runtime/QueryTerminationType.hpp>
+#include <Time/Timestamp.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <ErrorHandling.hpp>
+#include <PipelineExecutionContext.hpp>
+
+namespace NES
+{
+
+PatternOperatorHandler::PatternOperatorHandler(std::vector<PatternMatcher::Step> steps, const uint64_t withinMs) : withinMs(withinMs)
+{
+    stripes.reserve(NUMBER_OF_STRIPES);
+    for (size_t stripe = 0; stripe < NUMBER_OF_STRIPES; ++stripe)
+    {
+        stripes.emplace_back(std::make_unique<Stripe>(PatternMatcher(steps, withinMs)));
+    }
+}
+
+void PatternOperatorHandler::start(PipelineExecutionContext& pipelineExecutionContext, uint32_t)
+{
+    std::call_once(
+        allocatedMatches,
+        [this, &pipelineExecutionContext] { matchesOfWorker.resize(pipelineExecutionContext.getNumberOfWorkerThreads()); });
+}
+
+void PatternOperatorHandler::stop(QueryTerminationType, PipelineExecutionContext&)
+{
+    size_t numberOfRuns = 0;
+    uint64_t numberOfDroppedRuns = 0;
+    for (const auto& stripe : stripes)
+    {
+        const std::scoped_lock lock(stripe->mutex);
+        numberOfRuns += stripe->matcher.getNumberOfRuns();
+        numberOfDroppedRuns += stripe->matcher.getNumberOfDroppedRuns();
+    }
+    NES_DEBUG("Stopped the pattern with {} incomplete partial matches, {} partial matches were dropped", numberOfRuns, numberOfDroppedRuns);
+}
+
+uint64_t PatternOperatorHandler::getStateSizeInBytes() const
+{
+    uint64_t stateSize = 0;
+    for (const auto& stripe : stripes)
+    {
+        const std::scoped_lock lock(stripe->mutex);
+        stateSize += stripe->matcher.getStateSizeInBytes();
+    }
+    return stateSize;
+}
+
+uint64_t PatternOperatorHandler::advance(
+    const WorkerThreadId workerThreadId, const std::string_view key, const uint64_t matchedEvents, const Timestamp timestamp)
+{
+    const auto workerThread = workerThreadId.getRawValue();
+    INVARIANT(
+        workerThread < matchesOfWorker.size(),
+        "Worker thread {} exceeds the number of worker threads {} of the pattern",
+        workerThreadId,
+        matchesOfWorker.size());
+    auto& matches = matchesOfWorker[workerThread];
+    matches.clear();
+
+    auto& stripe = *stripes[std::hash<std::string_view>{}(key) % NUMBER_OF_STRIPES];
+    const std::scoped_lock lock(stripe.mutex);
+    stripe.matcher.advance(key, matchedEvents, timestamp, matches);
+    return matches.size();
+}
+
+const PatternMatcher::Match& PatternOperatorHandler::getMatch(const WorkerThreadId workerThreadId, const uint64_t matchIndex) const
+{
+    const auto& matches = matchesOfWorker[workerThreadId.getRawValue()];
+    PRECONDITION(matchIndex < matches.size(), "Match {} exceeds the {} matches of the worker thread", matchIndex, matches.size());
+    return matches[matchIndex];
+}
+
+void PatternOperatorHandler::collectGarbage(const Timestamp watermark)
+{
+    auto lastWatermark = lastGarbageCollection.load(std::memory_order_relaxed);
+    /// Solely the worker thread, which wins the exchange, collects the garbage
+    if (watermark.getRawValue() < lastWatermark + withinMs
+        or not lastGarbageCollection.compare_exchange_strong(lastWatermark, watermark.getRawValue(), std::memory_order_relaxed))
+    {
+        return;
+    }
+    for (const auto& stripe : stripes)
+    {
+        const std::scoped_lock lock(stripe->mutex);
+        stripe->matcher.collectGarbage(watermark);
+    }
+}
+
+}
@@ -0,0 +1,232 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Pattern/PatternPhysicalOperator.hpp>
+
+#include <bit>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <DataTypes/DataType.hpp>
+#include <Functions/PhysicalFunction.hpp>
+#include <Identifiers/Identifiers.hpp>
+#include <Nautilus/DataTypes/VarVal.hpp>
+#include <Nautilus/DataTypes/VariableSizedData.hpp>
+#include <Nautilus/Interface/NESStrongTypeRef.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <Nautilus/Interface/RecordBuffer.hpp>
+#include <Nautilus/Interface/TimestampRef.hpp>
+#include <Pattern/PatternMatcher.hpp>
+#include <Pattern/PatternOperatorHandler.hpp>
+#include <Runtime/Execution/OperatorHandler.hpp>
+#include <Runtime/QueryTerminationType.hpp>
+#include <Time/Timestamp.hpp>
+#include <Util/StdInt.hpp>
+#include <Watermark/TimeFunction.hpp>
+#include <nautilus/std/cstring.h>
+#include <nautilus/val.hpp>
+#include <CompilationContext.hpp>
+#include <ErrorHandling.hpp>
+#include <ExecutionContext.hpp>
+#include <PhysicalOperator.hpp>
+#include <PipelineExecutionContext.hpp>
+#include <function.hpp>
+#include <val_ptr.hpp>
+
+namespace NES
+{
+
+namespace
+{
+void setupPatternProxy(OperatorHandler* ptrOpHandler, PipelineExecutionContext* pipelineCtx)
+{
+    PRECONDITION(ptrOpHandler != nullptr, "opHandler context should not be null!");
+    PRECONDITION(pipelineCtx != nullptr, "pipeline context should not be null!");
+    dynamic_cast<PatternOperatorHandler*>(ptrOpHandler)->start(*pipelineCtx, 0);
+}
+
+void terminatePatternProxy(OperatorHandler* ptrOpHandler, PipelineExecutionContext* pipelineCtx)
+{
+    PRECONDITION(ptrOpHandler != nullptr, "opHandler context should not be null!");
+    PRECONDITION(pipelineCtx != nullptr, "pipeline context should not be null!");
+    dynamic_cast<PatternOperatorHandler*>(ptrOpHandler)->stop(QueryTerminationType::Graceful, *pipelineCtx);
+}
+
+uint64_t advancePatternProxy(
+    OperatorHandler* ptrOpHandler,
+    const WorkerThreadId workerThreadId,
+    const int8_t* key,
+    const uint64_t keySize,
+    const uint64_t matchedEvents,
+    const Timestamp timestamp)
+{
+    PRECONDITION(ptrOpHandler != nullptr, "opHandler context should not be null!");
+    return dynamic_cast<PatternOperatorHandler*>(ptrOpHandler)
+        ->advance(workerThreadId, std::string_view(std::bit_cast<const char*>(key), keySize), matchedEvents, timestamp);
+}
+
+uint64_t getMatchStartProxy(OperatorHandler* ptrOpHandler, const WorkerThreadId workerThreadId, const uint64_t matchIndex)
+{
+    PRECONDITION(ptrOpHandler != nullptr, "opHandler context should not be null!");
+    return dynamic_cast<const PatternOperatorHandler*>(ptrOpHandler)->getMatch(workerThreadId, matchIndex).start.getRawValue();
+}
+
+uint64_t getMatchEndProxy(OperatorHandler* ptrOpHandler, const WorkerThreadId workerThreadId, const uint64_t matchIndex)
+{
+    PRECONDITION(ptrOpHandler != nullptr, "opHandler context should not be null!");
+    return dynamic_cast<const PatternOperatorHandler*>(ptrOpHandler)->getMatch(workerThreadId, matchIndex).end.getRawValue();
+}
+
+void collectPatternGarbageProxy(OperatorHandler* ptrOpHandler, const Timestamp watermark)
+{
+    PRECONDITION(ptrOpHandler != nullptr, "opHandler context should not be null!");
+    dynamic_cast<PatternOperatorHandler*>(ptrOpHandler)->collectGarbage(watermark);
+}
+}
+
+PatternPhysicalOperator::PatternPhysicalOperator(
+    const OperatorHandlerId operatorHandlerId,
+    std::vector<PhysicalFunction> eventPredicates,
+    std::vector<PartitionKey> partitionKeys,
+    EventTimeFunction timeFunction,
+    std::string startFieldName,
+    std::string endFieldName)
+    : operatorHandlerId(operatorHandlerId)
+    , eventPredicates(std::move(eventPredicates))
+    , partitionKeys(std::move(partitionKeys))
+    , timeFunction(std::move(timeFunction))
+    , startFieldName(std::move(startFieldName))
+    , endFieldName(std::move(endFieldName))
+{
+    PRECONDITION(
+        not this->eventPredicates.empty() and this->eventPredicates.size() <= PatternMatcher::MAX_NUMBER_OF_EVENTS,
+        "A pattern requires between 1 and {} event predicates, but got {}",
+        PatternMatcher::MAX_NUMBER_OF_EVENTS,
+        this->eventPredicates.size());
+}
+
+void PatternPhysicalOperator::setup(ExecutionContext& executionCtx, CompilationContext& compilationContext) const
+{
+    nautilus::invoke(setupPatternProxy, executionCtx.getGlobalOperatorHandler(operatorHandlerId), executionCtx.pipelineContext);
+    setupChild(executionCtx, compilationContext);
+}
+
+void PatternPhysicalOperator::open(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const
+{
+    timeFunction.open(executionCtx, recordBuffer);
+    openChild(executionCtx, recordBuffer);
+}
+
+std::pair<nautilus::val<int8_t*>, nautilus::val<uint64_t>>
+PatternPhysicalOperator::writeKey(ExecutionContext& executionCtx, Record& record) const
+{
+    uint64_t fixedKeySize = 0;
+    nautilus::val<uint64_t> keySize = 0_u64;
+    for (const auto& [fieldName, dataType] : partitionKeys)
+    {
+        if (dataType.isType(DataType::Type::VARSIZED))
+        {
+            keySize = keySize + sizeof(uint32_t) + record.read(fieldName).cast<VariableSizedData>().getContentSize();
+        }
+        else
+        {
+            fixedKeySize += dataType.getSizeInBytes();
+        }
+    }
+    keySize = keySize + fixedKeySize;
+
+    auto keyPointer = executionCtx.pipelineMemoryProvider.arena.allocateMemory(keySize);
+    nautilus::val<uint64_t> offset = 0_u64;
+    for (const auto& [fieldName, dataType] : partitionKeys)
+    {
+        const auto key = record.read(fieldName);
+        if (dataType.isType(DataType::Type::VARSIZED))
+        {
+            /// The size prefix distinguishes keys, whose variable sized fields only differ in where one field ends and the next one begins
+            const auto variableSizedKey = key.cast<VariableSizedData>();
+            VarVal(variableSizedKey.getContentSize()).writeToMemory(keyPointer + offset);
+            offset = offset + sizeof(uint32_t);
+            nautilus::memcpy(keyPointer + offset, variableSizedKey.getContent(), variableSizedKey.getContentSize());
+            offset = offset + variableSizedKey.getContentSize();
+        }
+        else
+        {
+            key.castToType(dataType.type).writeToMemory(keyPointer + offset);
+            offset = offset + dataType.getSizeInBytes();
+        }
+    }
+    return {keyPointer, keySize};
+}
+
+void PatternPhysicalOperator::execute(ExecutionContext& executionCtx, Record& record) const
+{
+    nautilus::val<uint64_t> matchedEvents = 0_u64;
+    for (uint64_t event = 0; event < eventPredicates.size(); ++event)
+    {
+        if (eventPredicates[event].execute(record, executionCtx.pipelineMemoryProvider.arena))
+        {
+            matchedEvents = matchedEvents | nautilus::val<uint64_t>(uint64_t{1} << event);
+        }
+    }
+    /// A record that matches no event advances no partial match, as partial matches skip unmatched records
+    if (matchedEvents == 0_u64)
+    {
+        return;
+    }
+
+    const auto timestamp = timeFunction.getTs(executionCtx, record);
+    const auto [key, keySize] = writeKey(executionCtx, record);
+    const auto operatorHandler = executionCtx.getGlobalOperatorHandler(operatorHandlerId);
+    const auto numberOfMatches
+        = nautilus::invoke(advancePatternProxy, operatorHandler, executionCtx.workerThreadId, key, keySize, matchedEvents, timestamp);
+    for (nautilus::val<uint64_t> matchIndex = 0_u64; matchIndex < numberOfMatches; matchIndex = matchIndex + 1_u64)
+    {
+        Record match;
+        match.write(startFieldName, nautilus::invoke(getMatchStartProxy, operatorHandler, executionCtx.workerThreadId, matchIndex));
+        match.write(endFieldName, nautilus::invoke(getMatchEndProxy, operatorHandler, executionCtx.workerThreadId, matchIndex));
+        for (const auto& partitionKey : partitionKeys)
+        {
+            match.write(partitionKey.fieldName, record.read(partitionKey.fieldName));
+        }
+        executeChild(executionCtx, match);
+    }
+}
+
+void PatternPhysicalOperator::close(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const
+{
+    nautilus::invoke(
+        collectPatternGarbageProxy, executionCtx.getGlobalOperatorHandler(operatorHandlerId), recordBuffer.getWatermarkTs());
+    closeChild(executionCtx, recordBuffer);
+}
+
+void PatternPhysicalOperator::terminate(ExecutionContext& executionCtx) const
+{
+    nautilus::invoke(terminatePatternProxy, executionCtx.getGlobalOperatorHandler(operatorHandlerId), executionCtx.pipelineContext);
+    terminateChild(executionCtx);
+}
+
+std::optional<PhysicalOperator> PatternPhysicalOperator::getChild() const
+{
+    return child;
+}
+
+void PatternPhysicalOperator::setChild(PhysicalOperator child)
+{
+    this->child = std::move(child);
+}
+
+}
@@ -14,6 +14,7 @@
 
 #include <PhysicalOperator.hpp>
 
+#include <cstdint>
 #include <memory>
 #include <optional>
 #include <string>
@@ -30,10 +31,36 @@
 #include <CompilationContext.hpp>
 #include <ErrorHandling.hpp>
 #include <ExecutionContext.hpp>
+#include <OperatorProfile.hpp>
+#include <function.hpp>
+#include <val.hpp>
 
 namespace NES
 {
 
+namespace
+{
+/// Counts the cycles of a call of an operator into the profile of the traced pipeline, c.f., ExecutionContext::operatorProfile
+template <typename Call>
+void profileCall(ExecutionContext& executionCtx, const OperatorId operatorId, const Call& call)
+{
+    const auto counter = executionCtx.operatorProfile ? executionCtx.operatorProfile->counterOf(operatorId) : std::nullopt;
+    if (not counter.has_value())
+    {
+        call();
+        return;
+    }
+    const auto start = invoke(+[] { return OperatorProfile::readCycleCounter(); });
+    call();
+    invoke(
+        +[](OperatorProfile* profile, const uint64_t profiledOperator, const uint64_t startCycles)
+        { profile->record(profiledOperator, OperatorProfile::readCycleCounter() - startCycles); },
+        nautilus::val<OperatorProfile*>(executionCtx.operatorProfile),
+        nautilus::val<uint64_t>(counter.value()),
+        start);
+}
+}
+
 PhysicalOperatorConcept::PhysicalOperatorConcept() : id(getNextPhysicalOperatorId())
 {
 }
@@ -131,12 +158,12 @@ void PhysicalOperator::setup(ExecutionContext& executionCtx, CompilationContext&
 
 void PhysicalOperator::open(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const
 {
-    self->open(executionCtx, recordBuffer);
+    profileCall(executionCtx, self->id, [&] { self->open(executionCtx, recordBuffer); });
 }
 
 void PhysicalOperator::close(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const
 {
-    self->close(executionCtx, recordBuffer);
+    profileCall(executionCtx, self->id, [&] { self->close(executionCtx, recordBuffer); });
 }
 
 void PhysicalOperator::terminate(ExecutionContext& executionCtx) const
@@ -146,7 +173,7 @@ void PhysicalOperator::terminate(ExecutionContext& executionCtx) const
 
 void PhysicalOperator::execute(ExecutionContext& executionCtx, Record& record) const
 {
-    self->execute(executionCtx, record);
+    profileCall(executionCtx, self->id, [&] { self->execute(executionCtx, record); });
 }
 
 std::string PhysicalOperator::toString() const
@@ -13,6 +13,7 @@
 */
 #include <PhysicalPlan.hpp>
 
+#include <chrono>
 #include <cstdint>
 #include <memory>
 #include <ostream>
@@ -20,6 +21,7 @@
 #include <string>
 #include <utility>
 #include <vector>
+#include <DataTypes/Schema.hpp>
 #include <Identifiers/Identifiers.hpp>
 #include <Util/ExecutionMode.hpp>
 #include <Util/QueryConsoleDumpHandler.hpp>
@@ -33,8 +35,17 @@ PhysicalPlan::PhysicalPlan(
     QueryId id,
     std::vector<std::shared_ptr<PhysicalOperatorWrapper>> rootOperators,
     ExecutionMode executionMode,
-    uint64_t operatorBufferSize)
-    : queryId(id), rootOperators(std::move(rootOperators)), executionMode(executionMode), operatorBufferSize(operatorBufferSize)
+    uint64_t operatorBufferSize,
+    std::chrono::milliseconds emitCoalescingMaxDelay,
+    std::chrono::milliseconds bufferCompressionDelay,
+    Schema::MemoryLayoutType operatorMemoryLayout)
+    : queryId(id)
+    , rootOperators(std::move(rootOperators))
+    , executionMode(executionMode)
+    , operatorBufferSize(operatorBufferSize)
+    , emitCoalescingMaxDelay(emitCoalescingMaxDelay)
+    , bufferCompressionDelay(bufferCompressionDelay)
+    , operatorMemoryLayout(operatorMemoryLayout)
 {
     for (const auto& rootOperator : this->rootOperators)
     {
@@ -73,6 +84,21 @@ uint64_t PhysicalPlan::getOperatorBufferSize() const
     return operatorBufferSize;
 }
 
+std::chrono::milliseconds PhysicalPlan::getEmitCoalescingMaxDelay() const
+{
+    return emitCoalescingMaxDelay;
+}
+
+std::chrono::milliseconds PhysicalPlan::getBufferCompressionDelay() const
+{
+    return bufferCompressionDelay;
+}
+
+Schema::MemoryLayoutType PhysicalPlan::getOperatorMemoryLayout() const
+{
+    return operatorMemoryLayout;
+}
+
 std::ostream& operator<<(std::ostream& os, const PhysicalPlan& plan)
 {
     os << plan.toString();
@@ -15,21 +15,64 @@
 
 #include <ScanPhysicalOperator.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <optional>
+#include <ranges>
 #include <utility>
 #include <vector>
+#include <Functions/VectorizedPredicate.hpp>
+#include <MemoryLayout/MemoryLayout.hpp>
+#include <Nautilus/DataTypes/DataTypesUtil.hpp>
 #include <Nautilus/Interface/BufferRef/TupleBufferRef.hpp>
 #include <Nautilus/Interface/Record.hpp>
 #include <Nautilus/Interface/RecordBuffer.hpp>
+#include <Time/Timestamp.hpp>
 #include <Util/StdInt.hpp>
+#include <Watermark/EventTimeWatermarkAssignerPhysicalOperator.hpp>
+#include <Watermark/VectorizedMaxTimestamp.hpp>
+#include <ErrorHandling.hpp>
 #include <ExecutionContext.hpp>
 #include <PhysicalOperator.hpp>
+#include <SelectionPhysicalOperator.hpp>
+#include <function.hpp>
+#include <val_ptr.hpp>
 
 namespace NES
 {
 
+namespace
+{
+uint64_t evaluateSelectionsProxy(
+    const std::vector<VectorizedPredicate>* predicates, const int8_t* buffer, const uint64_t numberOfTuples, int8_t* selectionVectorPtr)
+{
+    auto* selectionVector = reinterpret_cast<uint64_t*>(selectionVectorPtr); /// NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    auto numberOfSelectedTuples = predicates->front().evaluate(buffer, numberOfTuples, selectionVector);
+    for (const auto& predicate : *predicates | std::views::drop(1))
+    {
+        if (numberOfSelectedTuples == 0)
+        {
+            break;
+        }
+        numberOfSelectedTuples = predicate.refine(buffer, selectionVector, numberOfSelectedTuples);
+    }
+    return numberOfSelectedTuples;
+}
+
+uint64_t maxTimestampProxy(const VectorizedMaxTimestamp* maxTimestamp, const int8_t* buffer, const uint64_t numberOfTuples)
+{
+    return maxTimestamp->evaluate(buffer, numberOfTuples);
+}
+
+uint64_t maxSelectedTimestampProxy(
+    const VectorizedMaxTimestamp* maxTimestamp, const int8_t* buffer, int8_t* selectionVectorPtr, const uint64_t numberOfSelectedTuples)
+{
+    auto* selectionVector = reinterpret_cast<uint64_t*>(selectionVectorPtr); /// NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    return maxTimestamp->evaluate(buffer, selectionVector, numberOfSelectedTuples);
+}
+}
+
 ScanPhysicalOperator::ScanPhysicalOperator(
     std::shared_ptr<Interface::BufferRef::TupleBufferRef> bufferRef, std::vector<Record::RecordFieldIdentifier> projections)
     : bufferRef(std::move(bufferRef)), projections(std::move(projections))
@@ -42,13 +85,37 @@ void ScanPhysicalOperator::open(ExecutionContext& executionCtx, RecordBuffer& re
     executionCtx.watermarkTs = recordBuffer.getWatermarkTs();
     executionCtx.originId = recordBuffer.getOriginId();
     executionCtx.currentTs = recordBuffer.getCreatingTs();
+    executionCtx.creationTs = recordBuffer.getCreatingTs();
+    executionCtx.latestCreationTs = recordBuffer.getLatestCreationTs();
     executionCtx.sequenceNumber = recordBuffer.getSequenceNumber();
     executionCtx.chunkNumber = recordBuffer.getChunkNumber();
     executionCtx.lastChunk = recordBuffer.isLastChunk();
     /// call open on all child operators
     openChild(executionCtx, recordBuffer);
+    if (numberOfVectorizedSelections > 0)
+    {
+        openWithVectorizedSelection(executionCtx, recordBuffer);
+        return;
+    }
     /// iterate over records in buffer
     auto numberOfRecords = recordBuffer.getNumRecords();
+    if (vectorizedWatermark)
+    {
+        const auto assigner = child->tryGet<EventTimeWatermarkAssignerPhysicalOperator>();
+        const auto maxTimestamp = nautilus::invoke(
+            maxTimestampProxy,
+            nautilus::val<const VectorizedMaxTimestamp*>(vectorizedWatermark.get()),
+            recordBuffer.getMemArea(),
+            numberOfRecords);
+        assigner->updateWatermark(executionCtx, nautilus::val<Timestamp>(maxTimestamp));
+        const auto assignerChild = assigner->getChild();
+        for (nautilus::val<uint64_t> i = 0_u64; i < numberOfRecords; i = i + 1_u64)
+        {
+            auto record = bufferRef->readRecord(projections, recordBuffer, i);
+            assignerChild->execute(executionCtx, record);
+        }
+        return;
+    }
     for (nautilus::val<uint64_t> i = 0_u64; i < numberOfRecords; i = i + 1_u64)
     {
         auto record = bufferRef->readRecord(projections, recordBuffer, i);
@@ -56,6 +123,57 @@ void ScanPhysicalOperator::open(ExecutionContext& executionCtx, RecordBuffer& re
     }
 }
 
+void ScanPhysicalOperator::openWithVectorizedSelection(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const
+{
+    /// The selections forward only qualifying records to their child. As we already filtered the records, we skip the selections.
+    auto selectionChild = child;
+    for (size_t selection = 0; selection < numberOfVectorizedSelections; ++selection)
+    {
+        selectionChild = selectionChild->tryGet<SelectionPhysicalOperator>()->getChild();
+        INVARIANT(selectionChild.has_value(), "A selection must have a child");
+    }
+
+    const auto numberOfRecords = recordBuffer.getNumRecords();
+    const auto selectionVector
+        = executionCtx.pipelineMemoryProvider.arena.allocateMemory(numberOfRecords * nautilus::val<uint64_t>(sizeof(uint64_t)));
+    const auto numberOfSelectedRecords = nautilus::invoke(
+        evaluateSelectionsProxy,
+        nautilus::val<const std::vector<VectorizedPredicate>*>(vectorizedSelections.get()),
+        recordBuffer.getMemArea(),
+        numberOfRecords,
+        selectionVector);
+
+    if (vectorizedWatermark)
+    {
+        const auto assigner = selectionChild->tryGet<EventTimeWatermarkAssignerPhysicalOperator>();
+        const auto maxTimestamp = nautilus::invoke(
+            maxSelectedTimestampProxy,
+            nautilus::val<const VectorizedMaxTimestamp*>(vectorizedWatermark.get()),
+            recordBuffer.getMemArea(),
+            selectionVector,
+            numberOfSelectedRecords);
+        assigner->updateWatermark(executionCtx, nautilus::val<Timestamp>(maxTimestamp));
+        selectionChild = assigner->getChild();
+    }
+
+    for (nautilus::val<uint64_t> i = 0_u64; i < numberOfSelectedRecords; i = i + 1_u64)
+    {
+        auto recordIndex = Nautilus::Util::readValueFromMemRef<uint64_t>(selectionVector + (i * nautilus::val<uint64_t>(sizeof(uint64_t))));
+        auto record = bufferRef->readRecord(projections, recordBuffer, recordIndex);
+        selectionChild->execute(executionCtx, record);
+    }
+}
+
+std::shared_ptr<MemoryLayout> ScanPhysicalOperator::getMemoryLayout() const
+{
+    return bufferRef->getMemoryLayout();
+}
+
+const std::vector<Record::RecordFieldIdentifier>& ScanPhysicalOperator::getProjections() const
+{
+    return projections;
+}
+
 std::optional<PhysicalOperator> ScanPhysicalOperator::getChild() const
 {
     return child;
@@ -63,6 +181,49 @@ std::optional<PhysicalOperator> ScanPhysicalOperator::getChild() const
 
 void ScanPhysicalOperator::setChild(PhysicalOperator child)
 {
+    std::vector<VectorizedPredicate> boundPredicates;
+    for (auto selection = child.tryGet<SelectionPhysicalOperator>(); selection and selection->getVectorizedPredicate();)
+    {
+        auto boundPredicate = selection->getVectorizedPredicate()->bind(*bufferRef->getMemoryLayout());
+        if (not boundPredicate)
+        {
+            break;
+        }
+        boundPredicates.emplace_back(std::move(boundPredicate.value()));
+        const auto selectionChild = selection->getChild();
+        if (not selectionChild)
+        {
+            break;
+        }
+        selection = selectionChild->tryGet<SelectionPhysicalOperator>();
+    }
+    numberOfVectorizedSelections = boundPredicates.size();
+    vectorizedSelections = nullptr;
+    if (not boundPredicates.empty())
+    {
+        vectorizedSelections = std::make_shared<const std::vector<VectorizedPredicate>>(std::move(boundPredicates));
+    }
+
+    /// The scan computes the watermark of an event-time watermark assigner that directly follows the scan or its vectorized selections
+    std::optional<PhysicalOperator> assignerCandidate = child;
+    for (size_t selection = 0; selection < numberOfVectorizedSelections and assignerCandidate; ++selection)
+    {
+        assignerCandidate = assignerCandidate->tryGet<SelectionPhysicalOperator>()->getChild();
+    }
+    vectorizedWatermark = nullptr;
+    if (const auto assigner = assignerCandidate ? assignerCandidate->tryGet<EventTimeWatermarkAssignerPhysicalOperator>() : std::nullopt;
+        assigner and assigner->getChild())
+    {
+        const auto& timeFunction = assigner->getTimeFunction();
+        if (const auto timestampField = timeFunction.getTimestampField())
+        {
+            if (auto maxTimestamp = VectorizedMaxTimestamp::create(
+                    *timestampField, timeFunction.getUnit().getMillisecondsConversionMultiplier(), *bufferRef->getMemoryLayout()))
+            {
+                vectorizedWatermark = std::make_shared<const VectorizedMaxTimestamp>(std::move(maxTimestamp.value()));
+            }
+        }
+    }
     this->child = std::move(child);
 }
 
@@ -12,25 +12,100 @@
     limitations under the License.
 */
 
+#include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <optional>
+#include <span>
 #include <utility>
+#include <vector>
+#include <Functions/PhysicalFunction.hpp>
+#include <Functions/VectorizedPredicate.hpp>
 #include <Nautilus/Interface/Record.hpp>
+#include <ErrorHandling.hpp>
 #include <ExecutionContext.hpp>
 #include <PhysicalOperator.hpp>
 #include <SelectionPhysicalOperator.hpp>
+#include <SelectivityProfile.hpp>
+#include <function.hpp>
+#include <val.hpp>
+#include <val_ptr.hpp>
 
 namespace NES
 {
 
+SelectionPhysicalOperator::SelectionPhysicalOperator(
+    std::vector<PhysicalFunction> conjuncts, std::shared_ptr<const VectorizedPredicate> vectorizedPredicate)
+    : conjuncts(std::move(conjuncts))
+    , profile(std::make_shared<SelectivityProfile>(this->conjuncts.size()))
+    , vectorizedPredicate(std::move(vectorizedPredicate))
+{
+    PRECONDITION(not this->conjuncts.empty(), "A selection requires at least one conjunct");
+}
+
 void SelectionPhysicalOperator::execute(ExecutionContext& ctx, Record& record) const
 {
-    /// evaluate function and call child operator if function is valid
-    if (function.execute(record, ctx.pipelineMemoryProvider.arena))
+    if (conjuncts.size() == 1)
+    {
+        /// evaluate function and call child operator if function is valid
+        if (conjuncts.front().execute(record, ctx.pipelineMemoryProvider.arena))
+        {
+            executeChild(ctx, record);
+        }
+        return;
+    }
+    if (ctx.collectsProfile)
+    {
+        executeAndProfile(ctx, record);
+        return;
+    }
+    /// The order is a constant of the traced code, thus the compiled pipeline does not sort per record
+    const auto order = profile->getEvaluationOrder();
+    executeConjuncts(ctx, record, order);
+}
+
+void SelectionPhysicalOperator::executeAndProfile(ExecutionContext& ctx, Record& record) const
+{
+    /// Evaluates every conjunct, thus the pass rate of a conjunct does not depend on the conjuncts before it
+    nautilus::val<bool> allPassed = true;
+    for (size_t conjunct = 0; conjunct < conjuncts.size(); ++conjunct)
+    {
+        nautilus::val<bool> passed = false;
+        if (conjuncts[conjunct].execute(record, ctx.pipelineMemoryProvider.arena))
+        {
+            passed = true;
+        }
+        nautilus::invoke(
+            +[](SelectivityProfile* profile, const uint64_t conjunct, const bool passed) { profile->record(conjunct, passed); },
+            nautilus::val<SelectivityProfile*>(profile.get()),
+            nautilus::val<uint64_t>(conjunct),
+            passed);
+        allPassed = allPassed && passed;
+    }
+    if (allPassed)
     {
         executeChild(ctx, record);
     }
 }
 
+void SelectionPhysicalOperator::executeConjuncts(ExecutionContext& ctx, Record& record, const std::span<const size_t> order) const
+{
+    if (order.empty())
+    {
+        executeChild(ctx, record);
+        return;
+    }
+    if (conjuncts[order.front()].execute(record, ctx.pipelineMemoryProvider.arena))
+    {
+        executeConjuncts(ctx, record, order.subspan(1));
+    }
+}
+
+const std::shared_ptr<const VectorizedPredicate>& SelectionPhysicalOperator::getVectorizedPredicate() const
+{
+    return vectorizedPredicate;
+}
+
 std::optional<PhysicalOperator> SelectionPhysicalOperator::getChild() const
 {
     return child;
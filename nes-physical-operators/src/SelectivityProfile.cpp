@@ -0,0 +1,71 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <SelectivityProfile.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+#include <ErrorHandling.hpp>
+
+namespace NES
+{
+
+SelectivityProfile::SelectivityProfile(const size_t numberOfConjuncts) : counters(numberOfConjuncts)
+{
+}
+
+void SelectivityProfile::record(const size_t conjunct, const bool passed)
+{
+    PRECONDITION(conjunct < counters.size(), "The selection has {} conjuncts, but recorded conjunct {}", counters.size(), conjunct);
+    counters[conjunct].evaluated.fetch_add(1, std::memory_order_relaxed);
+    if (passed)
+    {
+        counters[conjunct].passed.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+uint64_t SelectivityProfile::getNumberOfEvaluations(const size_t conjunct) const
+{
+    return counters.at(conjunct).evaluated.load(std::memory_order_relaxed);
+}
+
+double SelectivityProfile::getPassRate(const size_t conjunct) const
+{
+    const auto& counter = counters.at(conjunct);
+    const auto evaluated = counter.evaluated.load(std::memory_order_relaxed);
+    if (evaluated == 0)
+    {
+        return 1;
+    }
+    return static_cast<double>(counter.passed.load(std::memory_order_relaxed)) / static_cast<double>(evaluated);
+}
+
+std::vector<size_t> SelectivityProfile::getEvaluationOrder() const
+{
+    std::vector<double> passRates(counters.size());
+    for (size_t conjunct = 0; conjunct < counters.size(); ++conjunct)
+    {
+        passRates[conjunct] = getPassRate(conjunct);
+    }
+    std::vector<size_t> order(counters.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::ranges::stable_sort(order, [&passRates](const size_t lhs, const size_t rhs) { return passRates[lhs] < passRates[rhs]; });
+    return order;
+}
+
+}
@@ -15,28 +15,147 @@
 #include <SliceStore/DefaultTimeBasedSliceStore.hpp>
 
 #include <algorithm>
+#include <cerrno>
+#include <charconv>
 #include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
 #include <functional>
+#include <iterator>
 #include <map>
 #include <memory>
 #include <optional>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <unistd.h>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 #include <Identifiers/Identifiers.hpp>
 #include <Join/StreamJoinUtil.hpp>
+#include <Runtime/AbstractBufferProvider.hpp>
 #include <SliceStore/Slice.hpp>
 #include <SliceStore/SliceAssigner.hpp>
 #include <SliceStore/WindowSlicesStoreInterface.hpp>
 #include <Time/Timestamp.hpp>
 #include <Util/Locks.hpp>
 #include <Util/Logger/Logger.hpp>
+#include <fmt/format.h>
 #include <folly/Synchronized.h>
 #include <ErrorHandling.hpp>
 
 namespace NES
 {
-DefaultTimeBasedSliceStore::DefaultTimeBasedSliceStore(const uint64_t windowSize, const uint64_t windowSlide)
-    : sliceAssigner(windowSize, windowSlide), sequenceNumber(SequenceNumber::INITIAL), numberOfActiveInputPipelines(0)
+
+namespace
+{
+using CheckpointFile = std::unique_ptr<std::FILE, int (*)(std::FILE*)>;
+
+/// Marks the checkpoint as complete and stores the watermark, up to which all slices have been written
+constexpr std::string_view WATERMARK_FILE_NAME = "watermark";
+constexpr std::string_view SLICE_FILE_PREFIX = "slice_";
+constexpr std::string_view TEMPORARY_FILE_EXTENSION = ".tmp";
+
+std::string getSliceFileName(const SliceStart sliceStart, const SliceEnd sliceEnd)
+{
+    return fmt::format("{}{}_{}", SLICE_FILE_PREFIX, sliceStart.getRawValue(), sliceEnd.getRawValue());
+}
+
+/// Reverts getSliceFileName(). Returns nullopt for all other files.
+std::optional<std::pair<SliceStart, SliceEnd>> parseSliceFileName(const std::string_view fileName)
+{
+    if (not fileName.starts_with(SLICE_FILE_PREFIX))
+    {
+        return {};
+    }
+    const auto timestamps = fileName.substr(SLICE_FILE_PREFIX.size());
+    const auto separator = timestamps.find('_');
+    if (separator == std::string_view::npos)
+    {
+        return {};
+    }
+
+    Timestamp::Underlying sliceStart = 0;
+    Timestamp::Underlying sliceEnd = 0;
+    const auto* const startEnd = timestamps.data() + separator;
+    const auto* const endEnd = timestamps.data() + timestamps.size();
+    const auto parsedStart = std::from_chars(timestamps.data(), startEnd, sliceStart);
+    const auto parsedEnd = std::from_chars(startEnd + 1, endEnd, sliceEnd);
+    if (parsedStart.ec != std::errc{} or parsedStart.ptr != startEnd or parsedEnd.ec != std::errc{} or parsedEnd.ptr != endEnd)
+    {
+        return {};
+    }
+    return std::pair{SliceStart(sliceStart), SliceEnd(sliceEnd)};
+}
+
+/// Writes into a temporary file next to the path and renames it afterward, so that a crash never leaves a partially written file at the
+/// path. Returns false and removes the temporary file, if write returns false.
+bool writeCheckpointFile(const std::filesystem::path& path, const std::function<bool(std::FILE*)>& write)
+{
+    auto temporaryPath = path;
+    temporaryPath += TEMPORARY_FILE_EXTENSION;
+    CheckpointFile file(std::fopen(temporaryPath.c_str(), "wb"), &std::fclose);
+    if (file == nullptr)
+    {
+        throw CannotSpillState("Could not create the checkpoint file {}: {}", temporaryPath.string(), std::strerror(errno));
+    }
+
+    std::error_code errorCode;
+    if (not write(file.get()))
+    {
+        file.reset();
+        std::filesystem::remove(temporaryPath, errorCode);
+        return false;
+    }
+    /// The rename solely publishes the content after a crash of the machine, if the content has reached the disk before
+    if (std::fflush(file.get()) != 0 or fsync(fileno(file.get())) != 0)
+    {
+        throw CannotSpillState("Could not flush the checkpoint file {}: {}", temporaryPath.string(), std::strerror(errno));
+    }
+    file.reset();
+    std::filesystem::rename(temporaryPath, path, errorCode);
+    if (errorCode)
+    {
+        throw CannotSpillState("Could not rename the checkpoint file {}: {}", temporaryPath.string(), errorCode.message());
+    }
+    return true;
+}
+
+std::optional<Timestamp> readCheckpointedWatermark(const std::filesystem::path& checkpointDirectory)
+{
+    const CheckpointFile file(std::fopen((checkpointDirectory / WATERMARK_FILE_NAME).c_str(), "rb"), &std::fclose);
+    if (file == nullptr)
+    {
+        return {};
+    }
+    Timestamp::Underlying watermark = 0;
+    if (std::fread(&watermark, sizeof(watermark), 1, file.get()) != 1)
+    {
+        throw CannotSpillState("Could not read the watermark of the checkpoint in {}", checkpointDirectory.string());
+    }
+    return Timestamp(watermark);
+}
+}
+
+DefaultTimeBasedSliceStore::DefaultTimeBasedSliceStore(
+    const uint64_t windowSize,
+    const uint64_t windowSlide,
+    const uint64_t memoryBudgetInBytes,
+    std::filesystem::path spillDirectory,
+    const uint64_t earlyFiringInterval,
+    std::filesystem::path checkpointDirectory)
+    : sliceAssigner(windowSize, windowSlide, earlyFiringInterval)
+    , sequenceNumber(SequenceNumber::INITIAL)
+    , lastEarlyFiringTs(Timestamp::INITIAL_VALUE)
+    , numberOfActiveInputPipelines(0)
+    , memoryBudgetInBytes(memoryBudgetInBytes)
+    , spillDirectory(std::move(spillDirectory))
+    , checkpointDirectory(std::move(checkpointDirectory))
+    , checkpointedWatermark(Timestamp::INITIAL_VALUE)
+    , checkpointRestored(false)
 {
 }
 
@@ -125,9 +244,247 @@ DefaultTimeBasedSliceStore::getTriggerableWindowSlices(const Timestamp globalWat
             windowsToSlices[{windowInfo, newSequenceNumber}].emplace_back(slice);
         }
     }
+
+    /// Checkpointing before spilling, as spilled slices can not be checkpointed
+    if (not checkpointDirectory.empty())
+    {
+        checkpointSealedSlices(globalWatermark);
+    }
+    if (memoryBudgetInBytes > 0)
+    {
+        spillIdleSlices(*windowsWriteLocked, globalWatermark);
+    }
+    return windowsToSlices;
+}
+
+std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>>
+DefaultTimeBasedSliceStore::getEarlyWindowSlices(const Timestamp globalWatermark)
+{
+    const auto earlyFiringInterval = sliceAssigner.getEarlyFiringInterval();
+    if (earlyFiringInterval == 0 or globalWatermark.getRawValue() == 0)
+    {
+        return {};
+    }
+
+    /// As for the triggering, the slices must end before the global watermark
+    const auto earlyFiringTs = Timestamp(((globalWatermark.getRawValue() - 1) / earlyFiringInterval) * earlyFiringInterval);
+    const auto windowsWriteLocked = windows.tryWLock();
+    if (windowsWriteLocked.isNull() or earlyFiringTs <= lastEarlyFiringTs)
+    {
+        return {};
+    }
+    lastEarlyFiringTs = earlyFiringTs;
+
+    std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>> windowsToSlices;
+    for (const auto& [windowInfo, windowSlicesAndState] : *windowsWriteLocked)
+    {
+        if (windowInfo.windowStart >= earlyFiringTs)
+        {
+            /// As all windows have the same size, they are sorted by their window start as well
+            break;
+        }
+        if (windowInfo.windowEnd <= earlyFiringTs or windowSlicesAndState.windowState != WindowInfoState::WINDOW_FILLING)
+        {
+            /// The final result of this window is emitted with the next triggering
+            continue;
+        }
+
+        std::vector<std::shared_ptr<Slice>> sealedSlices;
+        std::ranges::copy_if(
+            windowSlicesAndState.windowSlices,
+            std::back_inserter(sealedSlices),
+            [earlyFiringTs](const auto& slice) { return slice->getSliceEnd() <= earlyFiringTs; });
+        if (not sealedSlices.empty())
+        {
+            windowsToSlices.emplace(WindowInfoAndSequenceNumber{windowInfo, SequenceNumber(sequenceNumber++)}, std::move(sealedSlices));
+        }
+    }
     return windowsToSlices;
 }
 
+void DefaultTimeBasedSliceStore::spillIdleSlices(const std::map<WindowInfo, SlicesAndState>& lockedWindows, const Timestamp globalWatermark)
+{
+    /// We do not wait for the lock of the slices, as we already hold the lock of the windows
+    const auto slicesReadLocked = slices.tryRLock();
+    if (slicesReadLocked.isNull())
+    {
+        return;
+    }
+
+    /// Solely the state of slices behind the global watermark counts against the budget, as the build might still write into all others
+    const auto sealedSlices = *slicesReadLocked
+        | std::views::take_while([&](const auto& sliceEndAndSlice) { return sliceEndAndSlice.first <= globalWatermark; })
+        | std::views::values;
+    uint64_t stateSizeInBytes = 0;
+    for (const auto& slice : sealedSlices)
+    {
+        stateSizeInBytes += slice->getStateSizeInBytes();
+    }
+    if (stateSizeInBytes <= memoryBudgetInBytes)
+    {
+        return;
+    }
+
+    /// The probe might read the slices of emitted windows until the garbage collection removes the window
+    std::unordered_set<const Slice*> slicesOfEmittedWindows;
+    for (const auto& [windowInfo, windowSlicesAndState] : lockedWindows)
+    {
+        if (windowSlicesAndState.windowState == WindowInfoState::EMITTED_TO_PROBE)
+        {
+            for (const auto& slice : windowSlicesAndState.windowSlices)
+            {
+                slicesOfEmittedWindows.insert(slice.get());
+            }
+        }
+    }
+
+    for (const auto& slice : sealedSlices)
+    {
+        if (stateSizeInBytes <= memoryBudgetInBytes)
+        {
+            break;
+        }
+        const auto isCheckpointed = checkpointDirectory.empty() or checkpointedSlices.contains(slice->getSliceEnd());
+        if (isCheckpointed and not slicesOfEmittedWindows.contains(slice.get()))
+        {
+            const auto spilledBytes = slice->spillState(spillDirectory);
+            NES_DEBUG("Spilled {} bytes of the slice with slice end {} to {}", spilledBytes, slice->getSliceEnd(), spillDirectory.string());
+            stateSizeInBytes -= std::min(spilledBytes, stateSizeInBytes);
+        }
+    }
+}
+
+void DefaultTimeBasedSliceStore::checkpointSealedSlices(const Timestamp globalWatermark)
+{
+    if (globalWatermark <= checkpointedWatermark)
+    {
+        return;
+    }
+    /// We do not wait for the lock of the slices, as we already hold the lock of the windows
+    const auto slicesReadLocked = slices.tryRLock();
+    if (slicesReadLocked.isNull())
+    {
+        return;
+    }
+
+    try
+    {
+        for (const auto& [sliceEnd, slice] : *slicesReadLocked)
+        {
+            if (sliceEnd > globalWatermark)
+            {
+                break;
+            }
+            if (checkpointedSlices.contains(sliceEnd))
+            {
+                continue;
+            }
+
+            const auto sliceStart = slice->getSliceStart();
+            const auto slicePath = checkpointDirectory / getSliceFileName(sliceStart, sliceEnd);
+            if (not writeCheckpointFile(slicePath, [&slice](std::FILE* file) { return slice->writeCheckpoint(file); }))
+            {
+                NES_WARNING(
+                    "The slice with slice end {} does not support checkpoints, disabling the checkpoints in {}",
+                    sliceEnd,
+                    checkpointDirectory.string());
+                checkpointDirectory.clear();
+                return;
+            }
+            checkpointedSlices.emplace(sliceEnd, sliceStart);
+        }
+
+        writeCheckpointFile(
+            checkpointDirectory / WATERMARK_FILE_NAME,
+            [globalWatermark](std::FILE* file)
+            {
+                const auto watermark = globalWatermark.getRawValue();
+                if (std::fwrite(&watermark, sizeof(watermark), 1, file) != 1)
+                {
+                    throw CannotSpillState("Could not write the watermark {} of the checkpoint", globalWatermark);
+                }
+                return true;
+            });
+        checkpointedWatermark = globalWatermark;
+    }
+    catch (const Exception& exception)
+    {
+        NES_ERROR("Could not checkpoint the slices up to the watermark {}: {}", globalWatermark, exception.what());
+        return;
+    }
+
+    /// Windows containing a slice end before the slice end plus the window size, and all windows before the watermark have been triggered
+    while (not checkpointedSlices.empty() and checkpointedSlices.begin()->first + sliceAssigner.getWindowSize() < checkpointedWatermark)
+    {
+        const auto [sliceEnd, sliceStart] = *checkpointedSlices.begin();
+        std::error_code errorCode;
+        std::filesystem::remove(checkpointDirectory / getSliceFileName(sliceStart, sliceEnd), errorCode);
+        checkpointedSlices.erase(checkpointedSlices.begin());
+    }
+}
+
+Timestamp DefaultTimeBasedSliceStore::restoreCheckpoint(
+    const std::function<std::vector<std::shared_ptr<Slice>>(SliceStart, SliceEnd)>& createNewSlice, AbstractBufferProvider* bufferProvider)
+{
+    auto [slicesWriteLocked, windowsWriteLocked] = acquireLocked(slices, windows);
+    if (checkpointDirectory.empty() or std::exchange(checkpointRestored, true))
+    {
+        return checkpointedWatermark;
+    }
+
+    std::error_code errorCode;
+    std::filesystem::create_directories(checkpointDirectory, errorCode);
+    if (errorCode)
+    {
+        throw CannotSpillState("Could not create the checkpoint directory {}: {}", checkpointDirectory.string(), errorCode.message());
+    }
+
+    /// Temporary files and the slices after the watermark belong to an incomplete checkpoint
+    const auto watermark = readCheckpointedWatermark(checkpointDirectory).value_or(Timestamp(Timestamp::INITIAL_VALUE));
+    std::map<SliceEnd, SliceStart> restoredSlices;
+    for (const auto& entry : std::filesystem::directory_iterator(checkpointDirectory, errorCode))
+    {
+        const auto sliceStartAndEnd = parseSliceFileName(entry.path().filename().string());
+        if (sliceStartAndEnd.has_value() and sliceStartAndEnd->second <= watermark)
+        {
+            restoredSlices.emplace(sliceStartAndEnd->second, sliceStartAndEnd->first);
+        }
+        else if (sliceStartAndEnd.has_value() or entry.path().extension() == TEMPORARY_FILE_EXTENSION)
+        {
+            std::filesystem::remove(entry.path(), errorCode);
+        }
+    }
+
+    const auto numberOfExpectedSlices = sliceAssigner.getWindowSize() / sliceAssigner.getWindowSlide();
+    for (const auto& [sliceEnd, sliceStart] : restoredSlices)
+    {
+        const auto slicePath = checkpointDirectory / getSliceFileName(sliceStart, sliceEnd);
+        const CheckpointFile file(std::fopen(slicePath.c_str(), "rb"), &std::fclose);
+        if (file == nullptr)
+        {
+            throw CannotSpillState("Could not open the checkpoint file {}: {}", slicePath.string(), std::strerror(errno));
+        }
+        const auto newSlices = createNewSlice(sliceStart, sliceEnd);
+        INVARIANT(newSlices.size() == 1, "We assume that only one slice is created per timestamp for our default time-based slice store.");
+        const auto& newSlice = newSlices[0];
+        newSlice->readCheckpoint(file.get(), bufferProvider);
+        slicesWriteLocked->emplace(sliceEnd, newSlice);
+        checkpointedSlices.emplace(sliceEnd, sliceStart);
+
+        /// The previous run has triggered all windows that end before the watermark of the checkpoint
+        for (auto windowInfo : sliceAssigner.getAllWindowsForSlice(*newSlice))
+        {
+            auto& windowSlicesAndState = windowsWriteLocked->try_emplace(windowInfo, numberOfExpectedSlices).first->second;
+            windowSlicesAndState.windowState
+                = windowInfo.windowEnd < watermark ? WindowInfoState::EMITTED_TO_PROBE : WindowInfoState::WINDOW_FILLING;
+            windowSlicesAndState.windowSlices.emplace_back(newSlice);
+        }
+    }
+    checkpointedWatermark = watermark;
+    NES_INFO("Restored {} slices up to the watermark {} from {}", restoredSlices.size(), watermark, checkpointDirectory.string());
+    return watermark;
+}
+
 std::optional<std::shared_ptr<Slice>> DefaultTimeBasedSliceStore::getSliceBySliceEnd(const SliceEnd sliceEnd)
 {
     if (const auto slicesReadLocked = slices.rlock(); slicesReadLocked->contains(sliceEnd))
@@ -199,7 +556,7 @@ std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>> Defau
     return windowsToSlices;
 }
 
-void DefaultTimeBasedSliceStore::garbageCollectSlicesAndWindows(const Timestamp newGlobalWaterMark)
+std::vector<std::shared_ptr<Slice>> DefaultTimeBasedSliceStore::garbageCollectSlicesAndWindows(const Timestamp newGlobalWaterMark)
 {
     std::vector<std::shared_ptr<Slice>> slicesToDelete;
     {
@@ -257,8 +614,8 @@ void DefaultTimeBasedSliceStore::garbageCollectSlicesAndWindows(const Timestamp
         }
     }
 
-    /// Now we can remove/call destructor on every slice without still holding the lock
-    slicesToDelete.clear();
+    /// The caller destroys the slices without holding the lock
+    return slicesToDelete;
 }
 
 void DefaultTimeBasedSliceStore::deleteState()
@@ -277,4 +634,41 @@ uint64_t DefaultTimeBasedSliceStore::getWindowSize() const
 {
     return sliceAssigner.getWindowSize();
 }
+
+uint64_t DefaultTimeBasedSliceStore::getWindowSlide() const
+{
+    return sliceAssigner.getWindowSlide();
+}
+
+SliceStart DefaultTimeBasedSliceStore::getSliceStartTs(const Timestamp timestamp) const
+{
+    return sliceAssigner.getSliceStartTs(timestamp);
+}
+
+SliceEnd DefaultTimeBasedSliceStore::getSliceEndTs(const Timestamp timestamp) const
+{
+    return sliceAssigner.getSliceEndTs(timestamp);
+}
+
+uint64_t DefaultTimeBasedSliceStore::getStateSizeInBytes() const
+{
+    const auto slicesReadLocked = slices.rlock();
+    uint64_t stateSizeInBytes = 0;
+    for (const auto& slice : *slicesReadLocked | std::views::values)
+    {
+        stateSizeInBytes += slice->getStateSizeInBytes();
+    }
+    return stateSizeInBytes;
+}
+
+std::vector<uint64_t> DefaultTimeBasedSliceStore::getStateSizeInBytesPerWorkerThread() const
+{
+    const auto slicesReadLocked = slices.rlock();
+    std::vector<uint64_t> stateSizeInBytesPerWorkerThread;
+    for (const auto& slice : *slicesReadLocked | std::views::values)
+    {
+        slice->addStateSizeInBytesPerWorkerThread(stateSizeInBytesPerWorkerThread);
+    }
+    return stateSizeInBytesPerWorkerThread;
+}
 }
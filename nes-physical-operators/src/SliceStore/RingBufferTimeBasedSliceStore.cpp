@@ -0,0 +1,400 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <SliceStore/RingBufferTimeBasedSliceStore.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <ranges>
+#include <utility>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
+#include <Runtime/AbstractBufferProvider.hpp>
+#include <SliceStore/Slice.hpp>
+#include <SliceStore/WindowSlicesStoreInterface.hpp>
+#include <Time/Timestamp.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <folly/Synchronized.h>
+#include <ErrorHandling.hpp>
+
+namespace NES
+{
+
+namespace
+{
+uint64_t calculateNumberOfSlots(const uint64_t windowSize, const uint64_t sliceEndGranularity)
+{
+    const auto maxNumberOfSlicesPerWindow = windowSize / sliceEndGranularity;
+    const auto numberOfSlots = std::min(maxNumberOfSlicesPerWindow, RingBufferTimeBasedSliceStore::MAX_NUMBER_OF_SLOTS / 4) * 4;
+    return std::bit_ceil(std::max(numberOfSlots, RingBufferTimeBasedSliceStore::MIN_NUMBER_OF_SLOTS));
+}
+}
+
+RingBufferTimeBasedSliceStore::RingBufferTimeBasedSliceStore(const uint64_t windowSize, const uint64_t windowSlide)
+    : sliceAssigner(windowSize, windowSlide)
+    , sliceEndGranularity(std::gcd(windowSize, windowSlide))
+    , slots(calculateNumberOfSlots(windowSize, sliceEndGranularity))
+    , slotMask(slots.size() - 1)
+    , lastEmittedWindowEnd(Timestamp::INITIAL_VALUE)
+    , sequenceNumber(SequenceNumber::INITIAL)
+    , lastCollectedSliceEnd(Timestamp::INITIAL_VALUE)
+    , numberOfActiveInputPipelines(0)
+{
+    PRECONDITION(windowSize > 0 and windowSlide > 0, "Window size {} and slide {} must be greater than 0", windowSize, windowSlide);
+}
+
+RingBufferTimeBasedSliceStore::~RingBufferTimeBasedSliceStore()
+{
+    deleteState();
+}
+
+RingBufferTimeBasedSliceStore::Slot& RingBufferTimeBasedSliceStore::getSlot(const SliceEnd sliceEnd)
+{
+    return slots[(sliceEnd.getRawValue() / sliceEndGranularity) & slotMask];
+}
+
+void RingBufferTimeBasedSliceStore::forEachSlot(
+    const SliceEnd firstSliceEnd, const SliceEnd lastSliceEnd, const std::function<void(Slot&)>& function)
+{
+    const auto firstPosition = firstSliceEnd.getRawValue() / sliceEndGranularity;
+    const auto lastPosition = lastSliceEnd.getRawValue() / sliceEndGranularity;
+    if (lastPosition < firstPosition)
+    {
+        return;
+    }
+
+    const auto numberOfPositions = std::min(lastPosition - firstPosition, slots.size() - 1) + 1;
+    for (uint64_t position = firstPosition; position < firstPosition + numberOfPositions; ++position)
+    {
+        function(slots[position & slotMask]);
+    }
+}
+
+std::vector<std::shared_ptr<Slice>> RingBufferTimeBasedSliceStore::getSlicesOrCreate(
+    const Timestamp timestamp, const std::function<std::vector<std::shared_ptr<Slice>>(SliceStart, SliceEnd)>& createNewSlice)
+{
+    /// We first check, if the slot stores the slice already
+    const auto sliceStart = sliceAssigner.getSliceStartTs(timestamp);
+    const auto sliceEnd = sliceAssigner.getSliceEndTs(timestamp);
+    auto& slot = getSlot(sliceEnd);
+    auto occupant = slot.load(std::memory_order_acquire);
+    if (occupant and occupant->getSliceEnd() == sliceEnd) [[likely]]
+    {
+        return {occupant};
+    }
+    if (occupant)
+    {
+        /// The slot stores a different slice. Thus, our slice might have been stored in the overflow map
+        const auto overflowSlicesReadLocked = overflowSlices.rlock();
+        if (const auto existingSlice = overflowSlicesReadLocked->find(sliceEnd); existingSlice != overflowSlicesReadLocked->end())
+        {
+            return {existingSlice->second};
+        }
+    }
+
+    const auto newSlices = createNewSlice(sliceStart, sliceEnd);
+    INVARIANT(newSlices.size() == 1, "We assume that only one slice is created per timestamp for our ring buffer slice store.");
+    const auto& newSlice = newSlices[0];
+
+    /// If the slot is empty, no overflow slice exists for it, as garbage collecting the occupant of a slot moves an overflow slice into it
+    std::shared_ptr<Slice> expected;
+    if (slot.compare_exchange_strong(expected, newSlice, std::memory_order_acq_rel))
+    {
+        return {newSlice};
+    }
+    if (expected->getSliceEnd() == sliceEnd)
+    {
+        /// Another thread has created the slice in the meantime
+        return {expected};
+    }
+
+    /// While we hold the lock of the overflow map, the slot can solely change from empty to occupied
+    auto overflowSlicesWriteLocked = overflowSlices.wlock();
+    for (occupant = slot.load(std::memory_order_acquire); not occupant;)
+    {
+        if (slot.compare_exchange_strong(occupant, newSlice, std::memory_order_acq_rel))
+        {
+            return {newSlice};
+        }
+    }
+    if (occupant->getSliceEnd() == sliceEnd)
+    {
+        return {occupant};
+    }
+
+    NES_DEBUG(
+        "Storing the slice with slice end {} in the overflow map, as its slot stores slice end {}", sliceEnd, occupant->getSliceEnd());
+    const auto [slice, _] = overflowSlicesWriteLocked->try_emplace(sliceEnd, newSlice);
+    return {slice->second};
+}
+
+std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>>
+RingBufferTimeBasedSliceStore::emitWindows(const Timestamp maxWindowEnd)
+{
+    if (maxWindowEnd <= lastEmittedWindowEnd + 1)
+    {
+        return {};
+    }
+
+    /// Gathering the alive slices of all windows with a window end in (lastEmittedWindowEnd, maxWindowEnd) in the order of their slice end
+    const auto windowSize = sliceAssigner.getWindowSize();
+    const auto firstSliceEnd = lastEmittedWindowEnd.getRawValue() < windowSize ? SliceEnd(Timestamp::INITIAL_VALUE)
+                                                                               : lastEmittedWindowEnd - (windowSize - 1);
+    const auto lastSliceEnd = maxWindowEnd - 1;
+    std::map<SliceEnd, std::shared_ptr<Slice>> slicesToEmit;
+    forEachSlot(
+        firstSliceEnd,
+        lastSliceEnd,
+        [&](Slot& slot)
+        {
+            if (auto slice = slot.load(std::memory_order_acquire);
+                slice and slice->getSliceEnd() >= firstSliceEnd and slice->getSliceEnd() <= lastSliceEnd)
+            {
+                slicesToEmit.emplace(slice->getSliceEnd(), std::move(slice));
+            }
+        });
+    {
+        const auto overflowSlicesReadLocked = overflowSlices.rlock();
+        slicesToEmit.insert(overflowSlicesReadLocked->lower_bound(firstSliceEnd), overflowSlicesReadLocked->upper_bound(lastSliceEnd));
+    }
+
+    /// Deriving the windows from the slices, as std::map sorts them by their window end
+    std::map<WindowInfo, std::vector<std::shared_ptr<Slice>>> windows;
+    for (const auto& slice : slicesToEmit | std::views::values)
+    {
+        for (const auto& windowInfo : sliceAssigner.getAllWindowsForSlice(*slice))
+        {
+            if (windowInfo.windowEnd > lastEmittedWindowEnd and windowInfo.windowEnd < maxWindowEnd)
+            {
+                windows[windowInfo].emplace_back(slice);
+            }
+        }
+    }
+
+    std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>> windowsToSlices;
+    for (auto& [windowInfo, windowSlices] : windows)
+    {
+        /// As the windows are sorted, we can simply increment the sequence number here.
+        const auto newSequenceNumber = SequenceNumber(sequenceNumber++);
+        lastEmittedWindowEnd = windowInfo.windowEnd;
+        windowsToSlices.emplace(WindowInfoAndSequenceNumber{windowInfo, newSequenceNumber}, std::move(windowSlices));
+    }
+    return windowsToSlices;
+}
+
+std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>>
+RingBufferTimeBasedSliceStore::getTriggerableWindowSlices(const Timestamp globalWatermark)
+{
+    /// For performance reasons, we check if we can acquire a lock and if not we then simply skip checking if we can trigger anything
+    const std::unique_lock triggerLock(triggerMutex, std::try_to_lock);
+    if (not triggerLock.owns_lock())
+    {
+        return {};
+    }
+    return emitWindows(globalWatermark);
+}
+
+std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>> RingBufferTimeBasedSliceStore::getAllNonTriggeredSlices()
+{
+    const std::scoped_lock triggerLock(triggerMutex);
+
+    /// numberOfActiveInputPipelines is guarded by the trigger lock.
+    /// If this method gets called, we know that an input pipeline has terminated.
+    INVARIANT(numberOfActiveInputPipelines > 0, "Method should not be called if all input pipelines have terminated.");
+    numberOfActiveInputPipelines -= 1;
+
+    /// If we are waiting on another pipeline to terminate, we can not trigger the remaining windows yet
+    if (numberOfActiveInputPipelines > 0)
+    {
+        NES_TRACE("Waiting on termination of {} input pipelines", numberOfActiveInputPipelines);
+        return {};
+    }
+    return emitWindows(Timestamp(Timestamp::INVALID_VALUE));
+}
+
+std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>> RingBufferTimeBasedSliceStore::getEarlyWindowSlices(Timestamp)
+{
+    /// As the ring buffer does not track the windows, it does not emit early results
+    return {};
+}
+
+std::optional<std::shared_ptr<Slice>> RingBufferTimeBasedSliceStore::getSliceBySliceEnd(const SliceEnd sliceEnd)
+{
+    if (auto slice = getSlot(sliceEnd).load(std::memory_order_acquire); slice and slice->getSliceEnd() == sliceEnd)
+    {
+        return slice;
+    }
+    if (const auto overflowSlicesReadLocked = overflowSlices.rlock(); overflowSlicesReadLocked->contains(sliceEnd))
+    {
+        return overflowSlicesReadLocked->find(sliceEnd)->second;
+    }
+    return {};
+}
+
+std::vector<std::shared_ptr<Slice>> RingBufferTimeBasedSliceStore::garbageCollectSlicesAndWindows(const Timestamp newGlobalWaterMark)
+{
+    /// A slice can be deleted, once all of its windows have been probed, i.e., its slice end plus the window size is below the watermark
+    const auto windowSize = sliceAssigner.getWindowSize();
+    const std::unique_lock garbageCollectionLock(garbageCollectionMutex, std::try_to_lock);
+    if (not garbageCollectionLock.owns_lock() or newGlobalWaterMark.getRawValue() <= windowSize + 1)
+    {
+        return {};
+    }
+    const auto lastSliceEndToDelete = newGlobalWaterMark - (windowSize + 1);
+    if (lastSliceEndToDelete <= lastCollectedSliceEnd)
+    {
+        return {};
+    }
+    NES_TRACE("Performing garbage collection for new global watermark {}", newGlobalWaterMark);
+
+    /// We solely visit the slots of slices that have been created after the last garbage collection.
+    /// Slices that have been created for a timestamp behind the last garbage collection stay alive until the slice store gets destroyed.
+    std::vector<std::shared_ptr<Slice>> slicesToDelete;
+    {
+        auto overflowSlicesWriteLocked = overflowSlices.wlock();
+        forEachSlot(
+            lastCollectedSliceEnd + 1,
+            lastSliceEndToDelete,
+            [&](Slot& slot)
+            {
+                auto slice = slot.load(std::memory_order_acquire);
+                if (not slice or slice->getSliceEnd() > lastSliceEndToDelete)
+                {
+                    return;
+                }
+
+                /// Moving the oldest alive overflow slice of this slot into the slot, so that overflow slices only exist for occupied slots
+                std::shared_ptr<Slice> replacement;
+                for (auto overflowSlice = overflowSlicesWriteLocked->upper_bound(lastSliceEndToDelete);
+                     overflowSlice != overflowSlicesWriteLocked->end();
+                     ++overflowSlice)
+                {
+                    if (&getSlot(overflowSlice->first) == &slot)
+                    {
+                        replacement = std::move(overflowSlice->second);
+                        overflowSlicesWriteLocked->erase(overflowSlice);
+                        break;
+                    }
+                }
+                NES_TRACE("Deleting slice with sliceEnd {} as it is not used anymore", slice->getSliceEnd());
+                slot.store(std::move(replacement), std::memory_order_release);
+                slicesToDelete.emplace_back(std::move(slice));
+            });
+
+        /// As the overflow slices are sorted (due to std::map), all slices to delete are at the beginning
+        const auto endOfSlicesToDelete = overflowSlicesWriteLocked->upper_bound(lastSliceEndToDelete);
+        for (auto overflowSlice = overflowSlicesWriteLocked->begin(); overflowSlice != endOfSlicesToDelete; ++overflowSlice)
+        {
+            slicesToDelete.emplace_back(std::move(overflowSlice->second));
+        }
+        overflowSlicesWriteLocked->erase(overflowSlicesWriteLocked->begin(), endOfSlicesToDelete);
+    }
+    lastCollectedSliceEnd = lastSliceEndToDelete;
+
+    /// The caller destroys the slices without holding the lock
+    return slicesToDelete;
+}
+
+void RingBufferTimeBasedSliceStore::deleteState()
+{
+    const auto overflowSlicesWriteLocked = overflowSlices.wlock();
+    for (auto& slot : slots)
+    {
+        slot.store(nullptr, std::memory_order_release);
+    }
+    overflowSlicesWriteLocked->clear();
+}
+
+Timestamp RingBufferTimeBasedSliceStore::restoreCheckpoint(
+    const std::function<std::vector<std::shared_ptr<Slice>>(SliceStart, SliceEnd)>&, AbstractBufferProvider*)
+{
+    return Timestamp(Timestamp::INITIAL_VALUE);
+}
+
+void RingBufferTimeBasedSliceStore::incrementNumberOfInputPipelines()
+{
+    numberOfActiveInputPipelines += 1;
+}
+
+uint64_t RingBufferTimeBasedSliceStore::getWindowSize() const
+{
+    return sliceAssigner.getWindowSize();
+}
+
+uint64_t RingBufferTimeBasedSliceStore::getWindowSlide() const
+{
+    return sliceAssigner.getWindowSlide();
+}
+
+SliceStart RingBufferTimeBasedSliceStore::getSliceStartTs(const Timestamp timestamp) const
+{
+    return sliceAssigner.getSliceStartTs(timestamp);
+}
+
+SliceEnd RingBufferTimeBasedSliceStore::getSliceEndTs(const Timestamp timestamp) const
+{
+    return sliceAssigner.getSliceEndTs(timestamp);
+}
+
+uint64_t RingBufferTimeBasedSliceStore::getStateSizeInBytes() const
+{
+    uint64_t stateSizeInBytes = 0;
+    for (const auto& slot : slots)
+    {
+        if (const auto slice = slot.load(std::memory_order_acquire))
+        {
+            stateSizeInBytes += slice->getStateSizeInBytes();
+        }
+    }
+    /// A slice is either stored in its slot or in the overflow map, thus no slice is counted twice
+    const auto overflowSlicesReadLocked = overflowSlices.rlock();
+    for (const auto& slice : *overflowSlicesReadLocked | std::views::values)
+    {
+        stateSizeInBytes += slice->getStateSizeInBytes();
+    }
+    return stateSizeInBytes;
+}
+
+std::vector<uint64_t> RingBufferTimeBasedSliceStore::getStateSizeInBytesPerWorkerThread() const
+{
+    std::vector<uint64_t> stateSizeInBytesPerWorkerThread;
+    for (const auto& slot : slots)
+    {
+        if (const auto slice = slot.load(std::memory_order_acquire))
+        {
+            slice->addStateSizeInBytesPerWorkerThread(stateSizeInBytesPerWorkerThread);
+        }
+    }
+    const auto overflowSlicesReadLocked = overflowSlices.rlock();
+    for (const auto& slice : *overflowSlicesReadLocked | std::views::values)
+    {
+        slice->addStateSizeInBytesPerWorkerThread(stateSizeInBytesPerWorkerThread);
+    }
+    return stateSizeInBytesPerWorkerThread;
+}
+
+uint64_t RingBufferTimeBasedSliceStore::getNumberOfSlots() const
+{
+    return slots.size();
+}
+
+}
@@ -0,0 +1,290 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <SliceStore/SessionSliceStore.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <utility>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
+#include <Runtime/AbstractBufferProvider.hpp>
+#include <SliceStore/Slice.hpp>
+#include <SliceStore/WindowSlicesStoreInterface.hpp>
+#include <Time/Timestamp.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <folly/Synchronized.h>
+#include <ErrorHandling.hpp>
+
+namespace NES
+{
+
+SessionSliceStore::SessionSlice::SessionSlice(std::shared_ptr<Slice> slice, const Timestamp timestamp)
+    : slice(std::move(slice)), firstTimestamp(timestamp.getRawValue()), lastTimestamp(timestamp.getRawValue())
+{
+}
+
+void SessionSliceStore::SessionSlice::addTimestamp(const Timestamp timestamp) const
+{
+    const auto rawTimestamp = timestamp.getRawValue();
+    auto first = firstTimestamp.load(std::memory_order::relaxed);
+    while (rawTimestamp < first and not firstTimestamp.compare_exchange_weak(first, rawTimestamp, std::memory_order::relaxed))
+    {
+    }
+    auto last = lastTimestamp.load(std::memory_order::relaxed);
+    while (rawTimestamp > last and not lastTimestamp.compare_exchange_weak(last, rawTimestamp, std::memory_order::relaxed))
+    {
+    }
+}
+
+SessionSliceStore::SessionSliceStore(const uint64_t gap)
+    : sliceAssigner(gap, gap), gap(gap), sequenceNumber(SequenceNumber::INITIAL), numberOfActiveInputPipelines(0)
+{
+    PRECONDITION(gap > 0, "The gap of a session window must be greater than 0");
+}
+
+SessionSliceStore::~SessionSliceStore()
+{
+    deleteState();
+}
+
+std::vector<std::shared_ptr<Slice>> SessionSliceStore::getSlicesOrCreate(
+    const Timestamp timestamp, const std::function<std::vector<std::shared_ptr<Slice>>(SliceStart, SliceEnd)>& createNewSlice)
+{
+    const auto sliceStart = sliceAssigner.getSliceStartTs(timestamp);
+    const auto sliceEnd = sliceAssigner.getSliceEndTs(timestamp);
+    {
+        /// The timestamps of a slice are atomic, so that the build threads solely require the read lock to update them
+        const auto slicesReadLocked = slices.rlock();
+        if (const auto existingSlice = slicesReadLocked->find(sliceEnd); existingSlice != slicesReadLocked->end())
+        {
+            existingSlice->second.addTimestamp(timestamp);
+            return {existingSlice->second.slice};
+        }
+    }
+
+    /// As in the DefaultTimeBasedSliceStore, we create the slice without holding the lock and check again afterward
+    const auto newSlices = createNewSlice(sliceStart, sliceEnd);
+    INVARIANT(newSlices.size() == 1, "We assume that only one slice is created per timestamp for our session slice store.");
+    const auto slicesWriteLocked = slices.wlock();
+    const auto [slice, inserted] = slicesWriteLocked->try_emplace(sliceEnd, newSlices[0], timestamp);
+    if (not inserted)
+    {
+        slice->second.addTimestamp(timestamp);
+    }
+    return {slice->second.slice};
+}
+
+std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>>
+SessionSliceStore::emitSessions(std::map<SliceEnd, SessionSlice>& lockedSlices, const Timestamp maxSessionEnd)
+{
+    std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>> sessionsToSlices;
+    std::vector<SessionSlice*> sessionSlices;
+    Timestamp::Underlying sessionStart = 0;
+    Timestamp::Underlying sessionLastTimestamp = 0;
+
+    /// Returns false, if the session can not be emitted yet. As the sessions are sorted, no later session can be emitted either.
+    const auto emitSession = [&]
+    {
+        const auto sessionEnd = Timestamp(sessionLastTimestamp + gap);
+        if (sessionEnd >= maxSessionEnd)
+        {
+            return false;
+        }
+
+        auto& slicesOfSession = sessionsToSlices[{WindowInfo(sessionStart, sessionEnd.getRawValue()), SequenceNumber(sequenceNumber++)}];
+        for (auto* sessionSlice : sessionSlices)
+        {
+            slicesOfSession.emplace_back(sessionSlice->slice);
+            sessionSlice->emittedSessionEnd = sessionEnd;
+        }
+        sessionSlices.clear();
+        return true;
+    };
+
+    for (auto& sessionSlice : lockedSlices | std::views::values)
+    {
+        if (sessionSlice.emittedSessionEnd.has_value())
+        {
+            /// A late record might have created a slice next to an emitted session. We emit it as a session of its own.
+            if (not sessionSlices.empty() and not emitSession())
+            {
+                return sessionsToSlices;
+            }
+            continue;
+        }
+
+        const auto firstTimestamp = sessionSlice.firstTimestamp.load(std::memory_order::relaxed);
+        const auto lastTimestamp = sessionSlice.lastTimestamp.load(std::memory_order::relaxed);
+        if (not sessionSlices.empty() and firstTimestamp >= sessionLastTimestamp + gap and not emitSession())
+        {
+            return sessionsToSlices;
+        }
+        if (sessionSlices.empty())
+        {
+            sessionStart = firstTimestamp;
+            sessionLastTimestamp = lastTimestamp;
+        }
+        sessionSlices.emplace_back(&sessionSlice);
+        sessionLastTimestamp = std::max(sessionLastTimestamp, lastTimestamp);
+    }
+
+    if (not sessionSlices.empty())
+    {
+        emitSession();
+    }
+    return sessionsToSlices;
+}
+
+std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>>
+SessionSliceStore::getTriggerableWindowSlices(const Timestamp globalWatermark)
+{
+    /// For performance reasons, we skip the triggering, if another thread holds the lock
+    const auto slicesWriteLocked = slices.tryWLock();
+    if (slicesWriteLocked.isNull())
+    {
+        return {};
+    }
+    return emitSessions(*slicesWriteLocked, globalWatermark);
+}
+
+std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>> SessionSliceStore::getAllNonTriggeredSlices()
+{
+    const auto slicesWriteLocked = slices.wlock();
+
+    /// numberOfActiveInputPipelines is guarded by the slices lock.
+    /// If this method gets called, we know that an input pipeline has terminated.
+    INVARIANT(numberOfActiveInputPipelines > 0, "Method should not be called if all input pipelines have terminated.");
+    numberOfActiveInputPipelines -= 1;
+    if (numberOfActiveInputPipelines > 0)
+    {
+        NES_TRACE("Waiting on termination of {} input pipelines to emit the remaining sessions", numberOfActiveInputPipelines);
+        return {};
+    }
+    return emitSessions(*slicesWriteLocked, Timestamp(Timestamp::INVALID_VALUE));
+}
+
+std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>> SessionSliceStore::getEarlyWindowSlices(Timestamp)
+{
+    /// Sessions may still merge with later sessions, thus we do not emit early results
+    return {};
+}
+
+std::optional<std::shared_ptr<Slice>> SessionSliceStore::getSliceBySliceEnd(const SliceEnd sliceEnd)
+{
+    if (const auto slicesReadLocked = slices.rlock(); slicesReadLocked->contains(sliceEnd))
+    {
+        return slicesReadLocked->find(sliceEnd)->second.slice;
+    }
+    return {};
+}
+
+std::vector<std::shared_ptr<Slice>> SessionSliceStore::garbageCollectSlicesAndWindows(const Timestamp newGlobalWaterMark)
+{
+    NES_TRACE("Performing garbage collection for new global watermark {}", newGlobalWaterMark);
+    std::vector<std::shared_ptr<Slice>> slicesToDelete;
+    if (const auto slicesWriteLocked = slices.tryWLock())
+    {
+        /// The probe might read the slices of an emitted session, until the global watermark of the probe passes the session end
+        for (auto slicesLockedIt = slicesWriteLocked->begin(); slicesLockedIt != slicesWriteLocked->end();)
+        {
+            const auto& emittedSessionEnd = slicesLockedIt->second.emittedSessionEnd;
+            if (not emittedSessionEnd.has_value() or emittedSessionEnd.value() >= newGlobalWaterMark)
+            {
+                break;
+            }
+            slicesToDelete.emplace_back(slicesLockedIt->second.slice);
+            slicesLockedIt = slicesWriteLocked->erase(slicesLockedIt);
+        }
+    }
+
+    /// The caller destroys the slices without holding the lock
+    return slicesToDelete;
+}
+
+void SessionSliceStore::deleteState()
+{
+    slices.wlock()->clear();
+}
+
+Timestamp SessionSliceStore::restoreCheckpoint(
+    const std::function<std::vector<std::shared_ptr<Slice>>(SliceStart, SliceEnd)>&, AbstractBufferProvider*)
+{
+    return Timestamp(Timestamp::INITIAL_VALUE);
+}
+
+void SessionSliceStore::incrementNumberOfInputPipelines()
+{
+    numberOfActiveInputPipelines += 1;
+}
+
+uint64_t SessionSliceStore::getWindowSize() const
+{
+    return gap;
+}
+
+uint64_t SessionSliceStore::getWindowSlide() const
+{
+    return gap;
+}
+
+SliceStart SessionSliceStore::getSliceStartTs(const Timestamp timestamp) const
+{
+    const auto slicesReadLocked = slices.rlock();
+    if (const auto slice = slicesReadLocked->find(sliceAssigner.getSliceEndTs(timestamp)); slice != slicesReadLocked->end())
+    {
+        return SliceStart(std::min(slice->second.firstTimestamp.load(std::memory_order::relaxed), timestamp.getRawValue()));
+    }
+    return timestamp;
+}
+
+SliceEnd SessionSliceStore::getSliceEndTs(const Timestamp timestamp) const
+{
+    const auto slicesReadLocked = slices.rlock();
+    if (const auto slice = slicesReadLocked->find(sliceAssigner.getSliceEndTs(timestamp)); slice != slicesReadLocked->end())
+    {
+        return SliceEnd(std::max(slice->second.lastTimestamp.load(std::memory_order::relaxed), timestamp.getRawValue()) + 1);
+    }
+    return timestamp + 1;
+}
+
+uint64_t SessionSliceStore::getStateSizeInBytes() const
+{
+    const auto slicesReadLocked = slices.rlock();
+    uint64_t stateSizeInBytes = 0;
+    for (const auto& sessionSlice : *slicesReadLocked | std::views::values)
+    {
+        stateSizeInBytes += sessionSlice.slice->getStateSizeInBytes();
+    }
+    return stateSizeInBytes;
+}
+
+std::vector<uint64_t> SessionSliceStore::getStateSizeInBytesPerWorkerThread() const
+{
+    const auto slicesReadLocked = slices.rlock();
+    std::vector<uint64_t> stateSizeInBytesPerWorkerThread;
+    for (const auto& sessionSlice : *slicesReadLocked | std::views::values)
+    {
+        sessionSlice.slice->addStateSizeInBytesPerWorkerThread(stateSizeInBytesPerWorkerThread);
+    }
+    return stateSizeInBytesPerWorkerThread;
+}
+
+}
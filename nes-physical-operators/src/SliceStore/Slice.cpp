@@ -14,6 +14,19 @@
 
 #include <SliceStore/Slice.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+#include <unistd.h>
+#include <Runtime/AbstractBufferProvider.hpp>
+#include <ErrorHandling.hpp>
+
 namespace NES
 {
 
@@ -21,10 +34,42 @@ Slice::Slice(const SliceStart sliceStart, const SliceEnd sliceEnd) : sliceStart(
 {
 }
 
-Slice::Slice(const Slice& other) = default;
-Slice::Slice(Slice&& other) noexcept = default;
-Slice& Slice::operator=(const Slice& other) = default;
-Slice& Slice::operator=(Slice&& other) noexcept = default;
+void SliceCreationTimestamps::merge(const SliceCreationTimestamps& other)
+{
+    oldest = std::min(oldest, other.oldest);
+    latest = std::max(latest, other.latest);
+}
+
+bool SliceCreationTimestamps::isEmpty() const
+{
+    return oldest == Timestamp(Timestamp::INVALID_VALUE);
+}
+
+Slice::Slice(const Slice& other)
+    : sliceStart(other.sliceStart)
+    , sliceEnd(other.sliceEnd)
+    , oldestCreationTimestamp(other.oldestCreationTimestamp.load())
+    , latestCreationTimestamp(other.latestCreationTimestamp.load())
+{
+}
+
+Slice::Slice(Slice&& other) noexcept : Slice(other)
+{
+}
+
+Slice& Slice::operator=(const Slice& other)
+{
+    sliceStart = other.sliceStart;
+    sliceEnd = other.sliceEnd;
+    oldestCreationTimestamp = other.oldestCreationTimestamp.load();
+    latestCreationTimestamp = other.latestCreationTimestamp.load();
+    return *this;
+}
+
+Slice& Slice::operator=(Slice&& other) noexcept
+{
+    return *this = other;
+}
 
 SliceStart Slice::getSliceStart() const
 {
@@ -36,6 +81,32 @@ SliceEnd Slice::getSliceEnd() const
     return sliceEnd;
 }
 
+void Slice::addCreationTimestamps(const Timestamp creationTs, const Timestamp latestCreationTs)
+{
+    /// Buffers without a creation timestamp, e.g., of tests, do not contribute to the ingestion latency
+    if (creationTs == Timestamp(Timestamp::INITIAL_VALUE))
+    {
+        return;
+    }
+
+    /// Most buffers do not change the timestamps, thus we solely write to the shared cache line if they do
+    auto oldest = oldestCreationTimestamp.load(std::memory_order_relaxed);
+    while (creationTs.getRawValue() < oldest
+           and not oldestCreationTimestamp.compare_exchange_weak(oldest, creationTs.getRawValue(), std::memory_order_relaxed))
+    {
+    }
+    const auto latestTs = std::max(creationTs, latestCreationTs).getRawValue();
+    auto latest = latestCreationTimestamp.load(std::memory_order_relaxed);
+    while (latestTs > latest and not latestCreationTimestamp.compare_exchange_weak(latest, latestTs, std::memory_order_relaxed))
+    {
+    }
+}
+
+SliceCreationTimestamps Slice::getCreationTimestamps() const
+{
+    return {.oldest = Timestamp(oldestCreationTimestamp.load()), .latest = Timestamp(latestCreationTimestamp.load())};
+}
+
 bool Slice::operator==(const Slice& rhs) const
 {
     return (sliceStart == rhs.sliceStart && sliceEnd == rhs.sliceEnd);
@@ -45,4 +116,51 @@ bool Slice::operator!=(const Slice& rhs) const
 {
     return !(rhs == *this);
 }
+
+uint64_t Slice::getStateSizeInBytes() const
+{
+    return 0;
+}
+
+void Slice::addStateSizeInBytesPerWorkerThread(std::vector<uint64_t>&) const
+{
+}
+
+uint64_t Slice::spillState(const std::filesystem::path&)
+{
+    return 0;
+}
+
+void Slice::reloadState(AbstractBufferProvider*)
+{
+}
+
+bool Slice::writeCheckpoint(std::FILE*)
+{
+    return false;
+}
+
+void Slice::readCheckpoint(std::FILE*, AbstractBufferProvider*)
+{
+}
+
+Slice::SpillFile Slice::createSpillFile(const std::filesystem::path& spillDirectory)
+{
+    /// Unlinking the file right after its creation, so that the operating system deletes it once we close it, even after a crash
+    auto pathTemplate = (spillDirectory / "nes-slice-XXXXXX").string();
+    const auto fileDescriptor = mkstemp(pathTemplate.data());
+    if (fileDescriptor < 0)
+    {
+        throw CannotSpillState("Could not create a spill file in {}: {}", spillDirectory.string(), std::strerror(errno));
+    }
+    unlink(pathTemplate.c_str());
+
+    SpillFile file(fdopen(fileDescriptor, "w+b"), &std::fclose);
+    if (file == nullptr)
+    {
+        close(fileDescriptor);
+        throw CannotSpillState("Could not open the spill file in {}: {}", spillDirectory.string(), std::strerror(errno));
+    }
+    return file;
+}
 }
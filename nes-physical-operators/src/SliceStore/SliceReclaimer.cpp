@@ -0,0 +1,107 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <SliceStore/SliceReclaimer.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <SliceStore/Slice.hpp>
+#include <Util/ThreadNaming.hpp>
+
+namespace NES
+{
+
+SliceReclaimer::~SliceReclaimer()
+{
+    if (reclaimerThread.joinable())
+    {
+        reclaimerThread.request_stop();
+        reclaimerThread.join();
+    }
+    drain();
+}
+
+void SliceReclaimer::reclaim(std::vector<std::shared_ptr<Slice>> slices)
+{
+    if (slices.empty())
+    {
+        return;
+    }
+    {
+        const std::scoped_lock lock(mutex);
+        for (auto& slice : slices)
+        {
+            pendingSlices.emplace_back(std::move(slice));
+        }
+        if (not reclaimerThread.joinable())
+        {
+            reclaimerThread = std::jthread([this](const std::stop_token& stopToken) { runReclaimer(stopToken); });
+        }
+    }
+    slicesPending.notify_one();
+}
+
+void SliceReclaimer::drain()
+{
+    while (destroyOldestPendingSlice())
+    {
+    }
+}
+
+size_t SliceReclaimer::getNumberOfPendingSlices() const
+{
+    const std::scoped_lock lock(mutex);
+    return pendingSlices.size();
+}
+
+bool SliceReclaimer::destroyOldestPendingSlice()
+{
+    const std::scoped_lock destructionLock(destructionMutex);
+    std::shared_ptr<Slice> slice;
+    {
+        const std::scoped_lock lock(mutex);
+        if (pendingSlices.empty())
+        {
+            return false;
+        }
+        slice = std::move(pendingSlices.front());
+        pendingSlices.pop_front();
+    }
+    /// Destroying the slice without holding the lock of the queue, so that the garbage collection can enqueue further slices meanwhile
+    slice.reset();
+    return true;
+}
+
+void SliceReclaimer::runReclaimer(const std::stop_token& stopToken)
+{
+    setThreadName("SliceReclaimer");
+    while (not stopToken.stop_requested())
+    {
+        {
+            std::unique_lock lock(mutex);
+            if (not slicesPending.wait(lock, stopToken, [this] { return not pendingSlices.empty(); }))
+            {
+                return;
+            }
+        }
+        destroyOldestPendingSlice();
+    }
+}
+
+}
@@ -0,0 +1,46 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <SliceStore/WindowSlicesStoreInterface.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <utility>
+#include <SliceStore/DefaultTimeBasedSliceStore.hpp>
+#include <SliceStore/RingBufferTimeBasedSliceStore.hpp>
+
+namespace NES
+{
+
+std::unique_ptr<WindowSlicesStoreInterface> WindowSlicesStoreInterface::create(
+    const SliceStoreType sliceStoreType,
+    const uint64_t windowSize,
+    const uint64_t windowSlide,
+    const uint64_t memoryBudgetInBytes,
+    const std::filesystem::path& spillDirectory,
+    const std::filesystem::path& checkpointDirectory)
+{
+    switch (sliceStoreType)
+    {
+        case SliceStoreType::DEFAULT:
+            return std::make_unique<DefaultTimeBasedSliceStore>(
+                windowSize, windowSlide, memoryBudgetInBytes, spillDirectory, 0, checkpointDirectory);
+        case SliceStoreType::RING_BUFFER:
+            return std::make_unique<RingBufferTimeBasedSliceStore>(windowSize, windowSlide);
+    }
+    std::unreachable();
+}
+
+}
@@ -15,6 +15,7 @@
 #include <memory>
 #include <optional>
 #include <utility>
+#include <DataTypes/Schema.hpp>
 #include <Identifiers/Identifiers.hpp>
 #include <Sources/SourceDescriptor.hpp>
 #include <PhysicalOperator.hpp>
@@ -23,8 +24,8 @@
 namespace NES
 {
 
-SourcePhysicalOperator::SourcePhysicalOperator(SourceDescriptor descriptor, OriginId id)
-    : originId(id), descriptor(std::move(std::move(descriptor))) { };
+SourcePhysicalOperator::SourcePhysicalOperator(SourceDescriptor descriptor, OriginId id, std::optional<Schema> formattedSchema)
+    : originId(id), descriptor(std::move(std::move(descriptor))), formattedSchema(std::move(formattedSchema)) { };
 
 SourceDescriptor SourcePhysicalOperator::getDescriptor() const
 {
@@ -36,6 +37,11 @@ OriginId SourcePhysicalOperator::getOriginId() const
     return originId;
 };
 
+Schema SourcePhysicalOperator::getFormattedSchema() const
+{
+    return formattedSchema.value_or(*descriptor.getLogicalSource().getSchema());
+}
+
 bool SourcePhysicalOperator::operator==(const SourcePhysicalOperator& other) const
 {
     return descriptor == other.descriptor;
@@ -53,4 +53,14 @@ void UnionRenamePhysicalOperator::setChild(PhysicalOperator child)
     this->child = std::move(child);
 }
 
+const std::vector<std::string>& UnionRenamePhysicalOperator::getInputFields() const
+{
+    return inputFields;
+}
+
+const std::vector<std::string>& UnionRenamePhysicalOperator::getOutputFields() const
+{
+    return outputFields;
+}
+
 }
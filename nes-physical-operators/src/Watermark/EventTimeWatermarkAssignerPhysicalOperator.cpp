@@ -58,6 +58,16 @@ void EventTimeWatermarkAssignerPhysicalOperator::execute(ExecutionContext& ctx,
     executeChild(ctx, record);
 }
 
+void EventTimeWatermarkAssignerPhysicalOperator::updateWatermark(
+    ExecutionContext& executionCtx, const nautilus::val<Timestamp>& timestamp) const
+{
+    auto* const state = dynamic_cast<WatermarkState*>(executionCtx.getLocalState(id));
+    if (timestamp > state->currentWatermark)
+    {
+        state->currentWatermark = timestamp;
+    }
+}
+
 void EventTimeWatermarkAssignerPhysicalOperator::close(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const
 {
     PRECONDITION(
@@ -68,6 +78,11 @@ void EventTimeWatermarkAssignerPhysicalOperator::close(ExecutionContext& executi
     PhysicalOperatorConcept::close(executionCtx, recordBuffer);
 }
 
+const EventTimeFunction& EventTimeWatermarkAssignerPhysicalOperator::getTimeFunction() const
+{
+    return timeFunction;
+}
+
 std::optional<PhysicalOperator> EventTimeWatermarkAssignerPhysicalOperator::getChild() const
 {
     return child;
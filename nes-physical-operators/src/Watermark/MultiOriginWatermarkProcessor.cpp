@@ -12,16 +12,21 @@
     limitations under the License.
 */
 #include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include <Identifiers/Identifiers.hpp>
 #include <Sequencing/NonBlockingMonotonicSeqQueue.hpp>
 #include <Sequencing/SequenceData.hpp>
 #include <Time/Timestamp.hpp>
+#include <Util/Logger/Logger.hpp>
 #include <Watermark/MultiOriginWatermarkProcessor.hpp>
 #include <fmt/ranges.h>
 #include <ErrorHandling.hpp>
@@ -29,37 +34,148 @@
 namespace NES
 {
 
-MultiOriginWatermarkProcessor::MultiOriginWatermarkProcessor(const std::vector<OriginId>& origins) : origins(origins)
+namespace
 {
-    for (const auto& _ : origins)
+/// An origin that appears multiple times receives the same watermarks. Thus, it requires solely one leaf.
+std::vector<OriginId> withoutDuplicates(const std::vector<OriginId>& origins)
+{
+    std::vector<OriginId> uniqueOrigins;
+    for (const auto& origin : origins)
+    {
+        if (std::ranges::find(uniqueOrigins, origin) == uniqueOrigins.end())
+        {
+            uniqueOrigins.emplace_back(origin);
+        }
+    }
+    return uniqueOrigins;
+}
+
+std::unordered_map<OriginId, size_t> indexOrigins(const std::vector<OriginId>& origins)
+{
+    std::unordered_map<OriginId, size_t> originIndexes;
+    for (size_t originIndex = 0; originIndex < origins.size(); ++originIndex)
+    {
+        originIndexes.emplace(origins[originIndex], originIndex);
+    }
+    return originIndexes;
+}
+}
+
+MultiOriginWatermarkProcessor::MultiOriginWatermarkProcessor(
+    const std::vector<OriginId>& origins, const std::chrono::milliseconds idleTimeout)
+    : origins(withoutDuplicates(origins))
+    , originIndexes(indexOrigins(this->origins))
+    , numberOfLeaves(std::bit_ceil(std::max<size_t>(this->origins.size(), 1)))
+    , tournamentTree(2 * numberOfLeaves)
+    , idleTimeout(idleTimeout)
+    , lastUpdates(this->origins.size())
+    , lastIdleCheck(std::chrono::steady_clock::now())
+{
+    PRECONDITION(idleTimeout >= std::chrono::milliseconds::zero(), "The idle timeout {}ms must not be negative", idleTimeout.count());
+    for (const auto& _ : this->origins)
     {
         watermarkProcessors.emplace_back(std::make_shared<Sequencing::NonBlockingMonotonicSeqQueue<uint64_t>>());
     }
+    for (auto& lastUpdate : lastUpdates)
+    {
+        lastUpdate = lastIdleCheck.load();
+    }
+
+    for (size_t leaf = 0; leaf < numberOfLeaves; ++leaf)
+    {
+        tournamentTree[numberOfLeaves + leaf]
+            = leaf < watermarkProcessors.size() ? watermarkProcessors[leaf]->getCurrentValue() : UINT64_MAX;
+    }
+    for (size_t node = numberOfLeaves - 1; node > 0; --node)
+    {
+        tournamentTree[node] = std::min(tournamentTree[2 * node].load(), tournamentTree[(2 * node) + 1].load());
+    }
 };
 
-std::shared_ptr<MultiOriginWatermarkProcessor> MultiOriginWatermarkProcessor::create(const std::vector<OriginId>& origins)
+std::shared_ptr<MultiOriginWatermarkProcessor>
+MultiOriginWatermarkProcessor::create(const std::vector<OriginId>& origins, const std::chrono::milliseconds idleTimeout)
+{
+    return std::make_shared<MultiOriginWatermarkProcessor>(origins, idleTimeout);
+}
+
+size_t MultiOriginWatermarkProcessor::getOriginIndex(const OriginId origin) const
 {
-    return std::make_shared<MultiOriginWatermarkProcessor>(origins);
+    const auto originIndex = originIndexes.find(origin);
+    INVARIANT(
+        originIndex != originIndexes.end(),
+        "non existing origin={} number of origins size={} ids={}",
+        origin,
+        origins.size(),
+        fmt::join(origins, ","));
+    return originIndex->second;
 }
 
 Timestamp MultiOriginWatermarkProcessor::updateWatermark(Timestamp ts, SequenceData sequenceData, OriginId origin) const
 {
-    bool found = false;
+    const auto originIndex = getOriginIndex(origin);
+    watermarkProcessors[originIndex]->emplace(sequenceData, ts.getRawValue());
+    propagateWatermark(originIndex, watermarkProcessors[originIndex]->getCurrentValue());
+    if (idleTimeout > std::chrono::milliseconds::zero())
+    {
+        const auto now = std::chrono::steady_clock::now();
+        lastUpdates[originIndex] = now;
+        advanceIdleOrigins(now);
+    }
+    return getCurrentWatermark();
+}
+
+void MultiOriginWatermarkProcessor::advanceIdleOrigins(const std::chrono::steady_clock::time_point now) const
+{
+    auto lastCheck = lastIdleCheck.load();
+    if (now - lastCheck < idleTimeout / 2 or not lastIdleCheck.compare_exchange_strong(lastCheck, now))
+    {
+        return;
+    }
+
+    uint64_t maximalWatermark = 0;
     for (size_t originIndex = 0; originIndex < origins.size(); ++originIndex)
     {
-        if (origins[originIndex] == origin)
+        maximalWatermark = std::max(maximalWatermark, tournamentTree[numberOfLeaves + originIndex].load());
+    }
+    for (size_t originIndex = 0; originIndex < origins.size(); ++originIndex)
+    {
+        if (now - lastUpdates[originIndex].load() >= idleTimeout)
         {
-            watermarkProcessors[originIndex]->emplace(sequenceData, ts.getRawValue());
-            found = true;
+            NES_DEBUG("Advancing the watermark of the idle origin {} to {}", origins[originIndex], maximalWatermark);
+            propagateWatermark(originIndex, maximalWatermark);
+        }
+    }
+}
+
+void MultiOriginWatermarkProcessor::propagateWatermark(const size_t originIndex, const uint64_t watermark) const
+{
+    /// Increases the node to the value. Returns false, if the node already stores the value or a larger one.
+    const auto increase = [](std::atomic<uint64_t>& node, const uint64_t value)
+    {
+        auto currentValue = node.load();
+        while (currentValue < value)
+        {
+            if (node.compare_exchange_weak(currentValue, value))
+            {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    auto node = numberOfLeaves + originIndex;
+    if (not increase(tournamentTree[node], watermark))
+    {
+        return;
+    }
+    while (node > 1)
+    {
+        node /= 2;
+        if (not increase(tournamentTree[node], std::min(tournamentTree[2 * node].load(), tournamentTree[(2 * node) + 1].load())))
+        {
+            return;
         }
     }
-    INVARIANT(
-        found,
-        "update watermark for non existing origin={} number of origins size={} ids={}",
-        origin,
-        origins.size(),
-        fmt::join(origins, ","));
-    return getCurrentWatermark();
 }
 
 std::string MultiOriginWatermarkProcessor::getCurrentStatus()
@@ -67,19 +183,30 @@ std::string MultiOriginWatermarkProcessor::getCurrentStatus()
     std::stringstream ss;
     for (size_t originIndex = 0; originIndex < origins.size(); ++originIndex)
     {
-        ss << " id=" << origins[originIndex] << " watermark=" << watermarkProcessors[originIndex]->getCurrentValue();
+        ss << " id=" << origins[originIndex] << " watermark=" << watermarkProcessors[originIndex]->getCurrentValue()
+           << " lag=" << getWatermarkLag(origins[originIndex]);
     }
     return ss.str();
 }
 
 Timestamp MultiOriginWatermarkProcessor::getCurrentWatermark() const
 {
-    auto minimalWatermark = UINT64_MAX;
-    for (const auto& wt : watermarkProcessors)
+    return Timestamp(tournamentTree[1].load());
+}
+
+Timestamp MultiOriginWatermarkProcessor::getCurrentWatermark(const OriginId origin) const
+{
+    return Timestamp(tournamentTree[numberOfLeaves + getOriginIndex(origin)].load());
+}
+
+uint64_t MultiOriginWatermarkProcessor::getWatermarkLag(const OriginId origin) const
+{
+    uint64_t maximalWatermark = 0;
+    for (size_t originIndex = 0; originIndex < origins.size(); ++originIndex)
     {
-        minimalWatermark = std::min(minimalWatermark, wt->getCurrentValue());
+        maximalWatermark = std::max(maximalWatermark, tournamentTree[numberOfLeaves + originIndex].load());
     }
-    return Timestamp(minimalWatermark);
+    return maximalWatermark - getCurrentWatermark(origin).getRawValue();
 }
 
 }
@@ -13,8 +13,10 @@
 */
 
 #include <cstdint>
+#include <optional>
 #include <utility>
 #include <DataTypes/TimeUnit.hpp>
+#include <Functions/FieldAccessPhysicalFunction.hpp>
 #include <Functions/PhysicalFunction.hpp>
 #include <Nautilus/Interface/Record.hpp>
 #include <Nautilus/Interface/RecordBuffer.hpp>
@@ -46,6 +48,20 @@ nautilus::val<Timestamp> EventTimeFunction::getTs(ExecutionContext& ctx, Record&
     return tsInMs;
 }
 
+std::optional<Record::RecordFieldIdentifier> EventTimeFunction::getTimestampField() const
+{
+    if (const auto fieldAccess = timestampFunction.tryGet<FieldAccessPhysicalFunction>())
+    {
+        return fieldAccess->getField();
+    }
+    return std::nullopt;
+}
+
+const Windowing::TimeUnit& EventTimeFunction::getUnit() const
+{
+    return unit;
+}
+
 void IngestionTimeFunction::open(ExecutionContext& ctx, RecordBuffer& buffer) const
 {
     ctx.currentTs = buffer.getCreatingTs();
@@ -0,0 +1,130 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Watermark/VectorizedMaxTimestamp.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <string>
+#include <DataTypes/DataType.hpp>
+#include <MemoryLayout/ColumnLayout.hpp>
+#include <MemoryLayout/MemoryLayout.hpp>
+#include <Time/Timestamp.hpp>
+#include <magic_enum/magic_enum.hpp>
+#include <ErrorHandling.hpp>
+
+namespace NES
+{
+
+namespace
+{
+template <typename FieldType>
+uint64_t maxOfField(const int8_t* field, const uint64_t stride, const uint64_t numberOfTuples, const uint64_t* tupleIndexes)
+{
+    const auto valueAt = [field, stride](const uint64_t tupleIndex)
+    {
+        FieldType value;
+        std::memcpy(&value, field + (tupleIndex * stride), sizeof(FieldType));
+        return static_cast<uint64_t>(value);
+    };
+
+    uint64_t maximum = Timestamp::INITIAL_VALUE;
+    /// Gathers the selected tuples, which are not contiguous
+    if (tupleIndexes != nullptr)
+    {
+        for (uint64_t i = 0; i < numberOfTuples; ++i)
+        {
+            maximum = std::max(maximum, valueAt(tupleIndexes[i]));
+        }
+        return maximum;
+    }
+    /// Separate loop for contiguous columns, as a known stride allows the compiler to vectorize the loads.
+    if (stride == sizeof(FieldType))
+    {
+        for (uint64_t i = 0; i < numberOfTuples; ++i)
+        {
+            FieldType value;
+            std::memcpy(&value, field + (i * sizeof(FieldType)), sizeof(FieldType));
+            maximum = std::max(maximum, static_cast<uint64_t>(value));
+        }
+        return maximum;
+    }
+    for (uint64_t i = 0; i < numberOfTuples; ++i)
+    {
+        maximum = std::max(maximum, valueAt(i));
+    }
+    return maximum;
+}
+
+uint64_t maxOfField(
+    const DataType::Type fieldType, const int8_t* field, const uint64_t stride, const uint64_t numberOfTuples, const uint64_t* tupleIndexes)
+{
+    switch (fieldType)
+    {
+        case DataType::Type::INT8:
+            return maxOfField<int8_t>(field, stride, numberOfTuples, tupleIndexes);
+        case DataType::Type::INT16:
+            return maxOfField<int16_t>(field, stride, numberOfTuples, tupleIndexes);
+        case DataType::Type::INT32:
+            return maxOfField<int32_t>(field, stride, numberOfTuples, tupleIndexes);
+        case DataType::Type::INT64:
+            return maxOfField<int64_t>(field, stride, numberOfTuples, tupleIndexes);
+        case DataType::Type::UINT8:
+            return maxOfField<uint8_t>(field, stride, numberOfTuples, tupleIndexes);
+        case DataType::Type::UINT16:
+            return maxOfField<uint16_t>(field, stride, numberOfTuples, tupleIndexes);
+        case DataType::Type::UINT32:
+            return maxOfField<uint32_t>(field, stride, numberOfTuples, tupleIndexes);
+        case DataType::Type::UINT64:
+            return maxOfField<uint64_t>(field, stride, numberOfTuples, tupleIndexes);
+        default:
+            INVARIANT(false, "create() only accepts integer fields, but got {}", magic_enum::enum_name(fieldType));
+            return Timestamp::INITIAL_VALUE;
+    }
+}
+}
+
+std::optional<VectorizedMaxTimestamp> VectorizedMaxTimestamp::create(
+    const std::string& fieldName, const uint64_t millisecondsConversionMultiplier, const MemoryLayout& memoryLayout)
+{
+    const auto fieldIndex = memoryLayout.getFieldIndexFromName(fieldName);
+    if (not fieldIndex)
+    {
+        return std::nullopt;
+    }
+    const auto fieldType = memoryLayout.getSchema().getFieldByName(fieldName).value().dataType;
+    if (not fieldType.isInteger())
+    {
+        return std::nullopt;
+    }
+    const auto* columnLayout = dynamic_cast<const ColumnLayout*>(&memoryLayout);
+    const auto stride = (columnLayout != nullptr) ? memoryLayout.getFieldSize(*fieldIndex) : memoryLayout.getTupleSize();
+    return VectorizedMaxTimestamp(fieldType.type, memoryLayout.getFieldOffset(0, *fieldIndex), stride, millisecondsConversionMultiplier);
+}
+
+Timestamp::Underlying VectorizedMaxTimestamp::evaluate(const int8_t* buffer, const uint64_t numberOfTuples) const
+{
+    /// The maximum of the converted timestamps is the converted maximum, as the conversion to milliseconds is monotonic
+    return maxOfField(fieldType, buffer + offset, stride, numberOfTuples, nullptr) * millisecondsConversionMultiplier;
+}
+
+Timestamp::Underlying
+VectorizedMaxTimestamp::evaluate(const int8_t* buffer, const uint64_t* selectionVector, const uint64_t numberOfSelectedTuples) const
+{
+    return maxOfField(fieldType, buffer + offset, stride, numberOfSelectedTuples, selectionVector) * millisecondsConversionMultiplier;
+}
+
+}
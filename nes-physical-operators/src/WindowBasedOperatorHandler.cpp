@@ -14,15 +14,24 @@
 
 #include <WindowBasedOperatorHandler.hpp>
 
+#include <atomic>
+#include <chrono>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <utility>
 #include <vector>
 #include <Identifiers/Identifiers.hpp>
 #include <Join/StreamJoinUtil.hpp>
+#include <Runtime/AbstractBufferProvider.hpp>
 #include <Runtime/QueryTerminationType.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <SliceStore/Slice.hpp>
+#include <SliceStore/SliceReclaimer.hpp>
 #include <SliceStore/WindowSlicesStoreInterface.hpp>
+#include <Time/Timestamp.hpp>
 #include <Util/Logger/Logger.hpp>
+#include <Util/CoarseClock.hpp>
 #include <Watermark/MultiOriginWatermarkProcessor.hpp>
 #include <PipelineExecutionContext.hpp>
 
@@ -34,7 +43,12 @@ WindowBasedOperatorHandler::WindowBasedOperatorHandler(
     const OriginId outputOriginId,
     std::unique_ptr<WindowSlicesStoreInterface> sliceAndWindowStore)
     : sliceAndWindowStore(std::move(sliceAndWindowStore))
+    , sliceReclaimer(std::make_unique<SliceReclaimer>())
     , numberOfWorkerThreads(0)
+    , idleOriginTimeout(std::chrono::milliseconds::zero())
+    , allowedLateness(0)
+    , triggerWatermark(Timestamp::INITIAL_VALUE)
+    , numberOfLateRecords(0)
     , outputOriginId(outputOriginId)
     , inputOrigins(inputOrigins)
 {
@@ -45,15 +59,47 @@ void WindowBasedOperatorHandler::setWorkerThreads(const uint64_t numberOfWorkerT
     WindowBasedOperatorHandler::numberOfWorkerThreads = numberOfWorkerThreads;
 }
 
+void WindowBasedOperatorHandler::setIdleOriginTimeout(const std::chrono::milliseconds idleOriginTimeout)
+{
+    this->idleOriginTimeout = idleOriginTimeout;
+}
+
+void WindowBasedOperatorHandler::setAllowedLateness(const uint64_t allowedLateness)
+{
+    this->allowedLateness = allowedLateness;
+}
+
 void WindowBasedOperatorHandler::start(PipelineExecutionContext& pipelineExecutionContext, uint32_t)
 {
     numberOfWorkerThreads = pipelineExecutionContext.getNumberOfWorkerThreads();
-    watermarkProcessorBuild = std::make_unique<MultiOriginWatermarkProcessor>(inputOrigins);
+    watermarkProcessorBuild = std::make_unique<MultiOriginWatermarkProcessor>(inputOrigins, idleOriginTimeout);
     watermarkProcessorProbe = std::make_unique<MultiOriginWatermarkProcessor>(std::vector{outputOriginId});
 }
 
 void WindowBasedOperatorHandler::stop(QueryTerminationType, PipelineExecutionContext&)
 {
+    /// The cleanup of the slices may call into the compiled pipelines, thus we destroy them before the query releases its pipelines
+    sliceReclaimer->drain();
+    if (const auto lateRecords = numberOfLateRecords.load(); lateRecords > 0)
+    {
+        NES_WARNING(
+            "Dropped {} records of origin {} that arrived later than the allowed lateness {}",
+            lateRecords,
+            outputOriginId,
+            allowedLateness);
+    }
+}
+
+void WindowBasedOperatorHandler::restoreCheckpoint(
+    const std::function<std::vector<std::shared_ptr<Slice>>(SliceStart, SliceEnd)>& createNewSlice, AbstractBufferProvider* bufferProvider)
+{
+    /// The previous run of the query has triggered the windows up to the checkpointed watermark
+    const auto checkpointedWatermark = sliceAndWindowStore->restoreCheckpoint(createNewSlice, bufferProvider).getRawValue();
+    auto currentTriggerWatermark = triggerWatermark.load(std::memory_order::relaxed);
+    while (currentTriggerWatermark < checkpointedWatermark
+           and not triggerWatermark.compare_exchange_weak(currentTriggerWatermark, checkpointedWatermark))
+    {
+    }
 }
 
 WindowSlicesStoreInterface& WindowBasedOperatorHandler::getSliceAndWindowStore() const
@@ -61,6 +107,35 @@ WindowSlicesStoreInterface& WindowBasedOperatorHandler::getSliceAndWindowStore()
     return *sliceAndWindowStore;
 }
 
+uint64_t WindowBasedOperatorHandler::getStateSizeInBytes() const
+{
+    return sliceAndWindowStore->getStateSizeInBytes();
+}
+
+std::vector<uint64_t> WindowBasedOperatorHandler::getStateSizeInBytesPerWorkerThread() const
+{
+    return sliceAndWindowStore->getStateSizeInBytesPerWorkerThread();
+}
+
+Timestamp WindowBasedOperatorHandler::getOldestAcceptedTimestamp() const
+{
+    /// A window containing the timestamp ends at the latest at timestamp + window size. Triggering emits all windows ending before the
+    /// trigger watermark.
+    const auto triggeredUpTo = triggerWatermark.load(std::memory_order::relaxed);
+    const auto windowSize = sliceAndWindowStore->getWindowSize();
+    return Timestamp(triggeredUpTo > windowSize ? triggeredUpTo - windowSize : Timestamp::INITIAL_VALUE);
+}
+
+void WindowBasedOperatorHandler::countLateRecord()
+{
+    numberOfLateRecords.fetch_add(1, std::memory_order::relaxed);
+}
+
+uint64_t WindowBasedOperatorHandler::getNumberOfLateRecords() const
+{
+    return numberOfLateRecords.load(std::memory_order::relaxed);
+}
+
 void WindowBasedOperatorHandler::garbageCollectSlicesAndWindows(const BufferMetaData& bufferMetaData) const
 {
     const auto newGlobalWaterMarkProbe
@@ -72,7 +147,7 @@ void WindowBasedOperatorHandler::garbageCollectSlicesAndWindows(const BufferMeta
         bufferMetaData.originId,
         bufferMetaData.seqNumber,
         bufferMetaData.watermarkTs);
-    sliceAndWindowStore->garbageCollectSlicesAndWindows(newGlobalWaterMarkProbe);
+    sliceReclaimer->reclaim(sliceAndWindowStore->garbageCollectSlicesAndWindows(newGlobalWaterMarkProbe));
 }
 
 void WindowBasedOperatorHandler::checkAndTriggerWindows(const BufferMetaData& bufferMetaData, PipelineExecutionContext* pipelineCtx)
@@ -88,11 +163,33 @@ void WindowBasedOperatorHandler::checkAndTriggerWindows(const BufferMetaData& bu
         bufferMetaData.seqNumber,
         bufferMetaData.watermarkTs);
 
+    /// Windows stay open for the allowed lateness. As several threads trigger concurrently, the trigger watermark solely increases.
+    const auto newTriggerWatermark = newGlobalWatermark.getRawValue() > allowedLateness ? newGlobalWatermark - allowedLateness
+                                                                                        : Timestamp(Timestamp::INITIAL_VALUE);
+    auto currentTriggerWatermark = triggerWatermark.load(std::memory_order::relaxed);
+    while (currentTriggerWatermark < newTriggerWatermark.getRawValue()
+           and not triggerWatermark.compare_exchange_weak(currentTriggerWatermark, newTriggerWatermark.getRawValue()))
+    {
+    }
+
     /// Getting all slices that can be triggered and triggering them
-    const auto slicesAndWindowInfo = sliceAndWindowStore->getTriggerableWindowSlices(newGlobalWatermark);
+    const auto slicesAndWindowInfo = sliceAndWindowStore->getTriggerableWindowSlices(newTriggerWatermark);
     triggerSlices(slicesAndWindowInfo, pipelineCtx);
 }
 
+void WindowBasedOperatorHandler::setCreationTimestamps(TupleBuffer& tupleBuffer, const SliceCreationTimestamps& creationTimestamps)
+{
+    if (creationTimestamps.isEmpty())
+    {
+        const auto now = CoarseClock::now();
+        tupleBuffer.setCreationTimestampInMS(now);
+        tupleBuffer.setLatestCreationTimestampInMS(now);
+        return;
+    }
+    tupleBuffer.setCreationTimestampInMS(creationTimestamps.oldest);
+    tupleBuffer.setLatestCreationTimestampInMS(creationTimestamps.latest);
+}
+
 void WindowBasedOperatorHandler::triggerAllWindows(PipelineExecutionContext* pipelineCtx)
 {
     const auto slicesAndWindowInfo = sliceAndWindowStore->getAllNonTriggeredSlices();
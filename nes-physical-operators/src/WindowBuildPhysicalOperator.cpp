@@ -13,6 +13,8 @@
 */
 #include <WindowBuildPhysicalOperator.hpp>
 
+#include <cstdint>
+#include <functional>
 #include <memory>
 #include <optional>
 #include <utility>
@@ -28,6 +30,7 @@
 #include <PhysicalOperator.hpp>
 #include <WindowBasedOperatorHandler.hpp>
 #include <function.hpp>
+#include <val_ptr.hpp>
 
 namespace NES
 {
@@ -67,6 +70,45 @@ void registerActivePipeline(OperatorHandler* ptrOpHandler)
     opHandler->getSliceAndWindowStore().incrementNumberOfInputPipelines();
 }
 
+Timestamp getOldestAcceptedTimestampProxy(OperatorHandler* ptrOpHandler)
+{
+    PRECONDITION(ptrOpHandler != nullptr, "opHandler context should not be null!");
+    const auto* opHandler = dynamic_cast<WindowBasedOperatorHandler*>(ptrOpHandler);
+    return opHandler->getOldestAcceptedTimestamp();
+}
+
+void countLateRecordProxy(OperatorHandler* ptrOpHandler)
+{
+    PRECONDITION(ptrOpHandler != nullptr, "opHandler context should not be null!");
+    auto* opHandler = dynamic_cast<WindowBasedOperatorHandler*>(ptrOpHandler);
+    opHandler->countLateRecord();
+}
+
+SliceStart getSliceStartProxy(OperatorHandler* ptrOpHandler, const Timestamp timestamp)
+{
+    PRECONDITION(ptrOpHandler != nullptr, "opHandler context should not be null!");
+    const auto* opHandler = dynamic_cast<WindowBasedOperatorHandler*>(ptrOpHandler);
+    return opHandler->getSliceAndWindowStore().getSliceStartTs(timestamp);
+}
+
+SliceEnd getSliceEndProxy(OperatorHandler* ptrOpHandler, const Timestamp timestamp)
+{
+    PRECONDITION(ptrOpHandler != nullptr, "opHandler context should not be null!");
+    const auto* opHandler = dynamic_cast<WindowBasedOperatorHandler*>(ptrOpHandler);
+    return opHandler->getSliceAndWindowStore().getSliceEndTs(timestamp);
+}
+
+void addSliceCreationTimestampsProxy(
+    OperatorHandler* ptrOpHandler, const SliceEnd sliceEnd, const Timestamp creationTs, const Timestamp latestCreationTs)
+{
+    PRECONDITION(ptrOpHandler != nullptr, "opHandler context should not be null!");
+    const auto* opHandler = dynamic_cast<WindowBasedOperatorHandler*>(ptrOpHandler);
+    if (const auto slice = opHandler->getSliceAndWindowStore().getSliceBySliceEnd(sliceEnd); slice.has_value())
+    {
+        slice.value()->addCreationTimestamps(creationTs, latestCreationTs);
+    }
+}
+
 WindowBuildPhysicalOperator::WindowBuildPhysicalOperator(OperatorHandlerId operatorHandlerId, std::unique_ptr<TimeFunction> timeFunction)
     : operatorHandlerId(operatorHandlerId), timeFunction(std::move(timeFunction))
 {
@@ -100,7 +142,16 @@ void WindowBuildPhysicalOperator::open(ExecutionContext& executionCtx, RecordBuf
 
     /// Creating the local state for the window operator build.
     const auto operatorHandler = executionCtx.getGlobalOperatorHandler(operatorHandlerId);
-    executionCtx.setLocalOperatorState(id, std::make_unique<WindowOperatorBuildLocalState>(operatorHandler));
+    const auto oldestAcceptedTimestamp = invoke(getOldestAcceptedTimestampProxy, operatorHandler);
+    executionCtx.setLocalOperatorState(id, createLocalState(executionCtx, operatorHandler, oldestAcceptedTimestamp));
+}
+
+std::unique_ptr<WindowOperatorBuildLocalState> WindowBuildPhysicalOperator::createLocalState(
+    ExecutionContext&,
+    const nautilus::val<OperatorHandler*>& operatorHandler,
+    const nautilus::val<Timestamp>& oldestAcceptedTimestamp) const
+{
+    return std::make_unique<WindowOperatorBuildLocalState>(operatorHandler, oldestAcceptedTimestamp);
 }
 
 void WindowBuildPhysicalOperator::terminate(ExecutionContext& executionCtx) const
@@ -109,6 +160,36 @@ void WindowBuildPhysicalOperator::terminate(ExecutionContext& executionCtx) cons
     invoke(triggerAllWindowsProxy, operatorHandlerMemRef, executionCtx.pipelineContext);
 }
 
+nautilus::val<int8_t*> WindowBuildPhysicalOperator::getSliceStateCached(
+    ExecutionContext& executionCtx,
+    const nautilus::val<Timestamp>& timestamp,
+    const std::function<nautilus::val<int8_t*>(const nautilus::val<OperatorHandler*>&)>& getSliceState) const
+{
+    auto* const localState = dynamic_cast<WindowOperatorBuildLocalState*>(executionCtx.getLocalState(id));
+    if (not localState->isInCachedSlice(timestamp))
+    {
+        const auto operatorHandler = localState->getOperatorHandler();
+        const auto sliceStart = invoke(getSliceStartProxy, operatorHandler, timestamp);
+        const auto sliceEnd = invoke(getSliceEndProxy, operatorHandler, timestamp);
+        localState->cacheSlice(sliceStart, sliceEnd, getSliceState(operatorHandler));
+        /// The local state lives for a single input buffer, thus each input buffer adds its creation timestamps once per slice
+        invoke(addSliceCreationTimestampsProxy, operatorHandler, sliceEnd, executionCtx.creationTs, executionCtx.latestCreationTs);
+    }
+    return localState->getCachedSliceState();
+}
+
+nautilus::val<bool>
+WindowBuildPhysicalOperator::isLateRecord(ExecutionContext& executionCtx, const nautilus::val<Timestamp>& timestamp) const
+{
+    auto* const localState = dynamic_cast<WindowOperatorBuildLocalState*>(executionCtx.getLocalState(id));
+    const auto lateRecord = timestamp < localState->getOldestAcceptedTimestamp();
+    if (lateRecord)
+    {
+        invoke(countLateRecordProxy, localState->getOperatorHandler());
+    }
+    return lateRecord;
+}
+
 std::optional<PhysicalOperator> WindowBuildPhysicalOperator::getChild() const
 {
     return child;
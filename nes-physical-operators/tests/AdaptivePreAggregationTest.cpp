@@ -0,0 +1,110 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Aggregation/AdaptivePreAggregation.hpp>
+
+#include <cstdint>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+
+namespace NES
+{
+
+class AdaptivePreAggregationTest : public Testing::BaseUnitTest
+{
+public:
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("AdaptivePreAggregationTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup AdaptivePreAggregationTest class.");
+    }
+
+    /// Creates slices until the next sampling slice, without reporting any flushes
+    static void skipToSamplingSlice(AdaptivePreAggregation& preAggregation)
+    {
+        for (uint64_t slice = 1; slice < AdaptivePreAggregation::SAMPLING_INTERVAL; ++slice)
+        {
+            preAggregation.onNewSlice();
+            EXPECT_FALSE(preAggregation.isEnabled());
+        }
+        preAggregation.onNewSlice();
+    }
+};
+
+TEST_F(AdaptivePreAggregationTest, EnabledWithoutFlushes)
+{
+    AdaptivePreAggregation preAggregation;
+    EXPECT_TRUE(preAggregation.isEnabled());
+    EXPECT_DOUBLE_EQ(preAggregation.getReduction(), 1);
+    preAggregation.onNewSlice();
+    EXPECT_TRUE(preAggregation.isEnabled());
+
+    /// Empty flushes carry no information about the cardinality
+    preAggregation.recordFlush(0, 0);
+    preAggregation.onNewSlice();
+    EXPECT_TRUE(preAggregation.isEnabled());
+}
+
+TEST_F(AdaptivePreAggregationTest, StaysEnabledForFewHotKeys)
+{
+    AdaptivePreAggregation preAggregation;
+    preAggregation.recordFlush(1000, 10);
+    EXPECT_DOUBLE_EQ(preAggregation.getReduction(), 0.99);
+    preAggregation.onNewSlice();
+    EXPECT_TRUE(preAggregation.isEnabled());
+}
+
+TEST_F(AdaptivePreAggregationTest, DisablesAtHighCardinalityAndSamplesPeriodically)
+{
+    AdaptivePreAggregation preAggregation;
+    preAggregation.recordFlush(1000, 950);
+    preAggregation.onNewSlice();
+    EXPECT_FALSE(preAggregation.isEnabled());
+
+    /// The first slice has been the first of the sampling interval
+    for (uint64_t slice = 2; slice < AdaptivePreAggregation::SAMPLING_INTERVAL; ++slice)
+    {
+        preAggregation.onNewSlice();
+        EXPECT_FALSE(preAggregation.isEnabled());
+    }
+    preAggregation.onNewSlice();
+    EXPECT_TRUE(preAggregation.isEnabled());
+
+    /// The sampling slice still has a high cardinality, thus the next slice does not pre-aggregate
+    preAggregation.recordFlush(1000, 1000);
+    skipToSamplingSlice(preAggregation);
+    EXPECT_TRUE(preAggregation.isEnabled());
+}
+
+TEST_F(AdaptivePreAggregationTest, ReenablesOnceTheCardinalityDrops)
+{
+    AdaptivePreAggregation preAggregation;
+    preAggregation.recordFlush(1000, 1000);
+    preAggregation.onNewSlice();
+    EXPECT_FALSE(preAggregation.isEnabled());
+
+    /// The samples of the sampling slices outweigh the earlier high cardinality
+    for (uint64_t sample = 0; sample < AdaptivePreAggregation::NUMBER_OF_SAMPLES; ++sample)
+    {
+        preAggregation.recordFlush(1000, 100);
+    }
+    EXPECT_NEAR(preAggregation.getReduction(), 0.9, 1e-9);
+    preAggregation.onNewSlice();
+    EXPECT_TRUE(preAggregation.isEnabled());
+}
+
+}
@@ -0,0 +1,83 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Aggregation/Function/ApproxCountDistinctSketch.hpp>
+
+#include <cstdint>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+
+namespace NES
+{
+
+class ApproxCountDistinctSketchTest : public Testing::BaseUnitTest
+{
+public:
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("ApproxCountDistinctSketchTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup ApproxCountDistinctSketchTest class.");
+    }
+
+    void SetUp() override { BaseUnitTest::SetUp(); }
+
+    /// Finalizer of MurMur3, which the aggregation uses to hash the values, c.f., MurMur3HashFunction
+    static uint64_t hash(uint64_t value)
+    {
+        value ^= value >> 33;
+        value *= UINT64_C(0xff51afd7ed558ccd);
+        value ^= value >> 33;
+        value *= UINT64_C(0xc4ceb9fe1a85ec53);
+        value ^= value >> 33;
+        return value;
+    }
+};
+
+TEST_F(ApproxCountDistinctSketchTest, ignoresDuplicates)
+{
+    ApproxCountDistinctSketch sketch;
+    EXPECT_EQ(sketch.getNumberOfDistinctValues(), 0);
+
+    for (uint64_t i = 0; i < 1000; ++i)
+    {
+        sketch.insertHash(hash(i % 10));
+    }
+    EXPECT_EQ(sketch.getNumberOfDistinctValues(), 10);
+}
+
+TEST_F(ApproxCountDistinctSketchTest, boundsErrorOfMergedSketches)
+{
+    /// The slices share half of their values. Thus, merging them must not count the shared values twice.
+    for (const uint64_t numberOfDistinctValues : {1000, 100000, 1000000})
+    {
+        ApproxCountDistinctSketch firstSketch;
+        ApproxCountDistinctSketch secondSketch;
+        for (uint64_t i = 0; i < numberOfDistinctValues; ++i)
+        {
+            firstSketch.insertHash(hash(i));
+            secondSketch.insertHash(hash(i + (numberOfDistinctValues / 2)));
+        }
+        firstSketch.merge(secondSketch);
+
+        /// Allowing three times the relative standard error of the sketch
+        const auto expected = static_cast<double>(numberOfDistinctValues + (numberOfDistinctValues / 2));
+        EXPECT_NEAR(static_cast<double>(firstSketch.getNumberOfDistinctValues()), expected, 0.05 * expected)
+            << "distinct values " << numberOfDistinctValues;
+    }
+}
+
+}
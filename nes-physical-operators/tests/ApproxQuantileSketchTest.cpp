@@ -0,0 +1,100 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Aggregation/Function/ApproxQuantileSketch.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+
+namespace NES
+{
+
+class ApproxQuantileSketchTest : public Testing::BaseUnitTest
+{
+public:
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("ApproxQuantileSketchTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup ApproxQuantileSketchTest class.");
+    }
+
+    void SetUp() override { BaseUnitTest::SetUp(); }
+
+    /// Returns the rank of the value in the sorted values as a quantile
+    static double getRank(const std::vector<double>& sortedValues, const double value)
+    {
+        const auto numberOfSmallerValues = std::ranges::lower_bound(sortedValues, value) - sortedValues.begin();
+        return static_cast<double>(numberOfSmallerValues) / static_cast<double>(sortedValues.size());
+    }
+};
+
+TEST_F(ApproxQuantileSketchTest, isExactForFewValues)
+{
+    ApproxQuantileSketch sketch;
+    EXPECT_EQ(sketch.getQuantile(0.5), 0);
+
+    for (const auto value : {5.0, 1.0, 3.0})
+    {
+        sketch.insert(value);
+    }
+    EXPECT_EQ(sketch.getQuantile(0), 1);
+    EXPECT_EQ(sketch.getQuantile(0.5), 3);
+    EXPECT_EQ(sketch.getQuantile(1), 5);
+
+    sketch.insert(7);
+    EXPECT_EQ(sketch.getQuantile(0.5), 4);
+    EXPECT_EQ(sketch.getNumberOfValues(), 4);
+}
+
+TEST_F(ApproxQuantileSketchTest, boundsRankErrorOfMergedSketches)
+{
+    constexpr uint64_t numberOfSketches = 16;
+    constexpr uint64_t numberOfValuesPerSketch = 10000;
+    std::mt19937_64 randomGenerator(42);
+    std::normal_distribution distribution(100.0, 15.0);
+
+    /// Each sketch summarizes the values of one slice. Merging them must approximate the quantiles of all values.
+    std::vector<double> allValues;
+    ApproxQuantileSketch mergedSketch;
+    for (uint64_t sketchIdx = 0; sketchIdx < numberOfSketches; ++sketchIdx)
+    {
+        ApproxQuantileSketch sketch;
+        for (uint64_t i = 0; i < numberOfValuesPerSketch; ++i)
+        {
+            const auto value = distribution(randomGenerator);
+            sketch.insert(value);
+            allValues.emplace_back(value);
+        }
+        EXPECT_LE(sketch.getNumberOfCentroids(), ApproxQuantileSketch::CAPACITY);
+        mergedSketch.merge(sketch);
+    }
+    std::ranges::sort(allValues);
+
+    EXPECT_EQ(mergedSketch.getNumberOfValues(), numberOfSketches * numberOfValuesPerSketch);
+    EXPECT_EQ(mergedSketch.getQuantile(0), allValues.front());
+    EXPECT_EQ(mergedSketch.getQuantile(1), allValues.back());
+    for (const auto quantile : {0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99})
+    {
+        EXPECT_NEAR(getRank(allValues, mergedSketch.getQuantile(quantile)), quantile, 0.01) << "quantile " << quantile;
+    }
+}
+
+}
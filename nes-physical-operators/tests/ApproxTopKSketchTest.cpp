@@ -0,0 +1,90 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Aggregation/Function/ApproxTopKSketch.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+
+namespace NES
+{
+
+class ApproxTopKSketchTest : public Testing::BaseUnitTest
+{
+public:
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("ApproxTopKSketchTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup ApproxTopKSketchTest class.");
+    }
+
+    void SetUp() override { BaseUnitTest::SetUp(); }
+};
+
+TEST_F(ApproxTopKSketchTest, isExactForFewDistinctValues)
+{
+    ApproxTopKSketch sketch;
+    EXPECT_TRUE(sketch.getTopK(3).empty());
+
+    for (const auto key : {3, 1, 3, 2, 3, 1})
+    {
+        sketch.insert(key);
+    }
+    const auto topK = sketch.getTopK(2);
+    ASSERT_EQ(topK.size(), 2);
+    EXPECT_EQ(topK[0].key, 3);
+    EXPECT_EQ(topK[0].count, 3);
+    EXPECT_EQ(topK[1].key, 1);
+    EXPECT_EQ(topK[1].count, 2);
+    EXPECT_EQ(sketch.getTopK(ApproxTopKSketch::CAPACITY).size(), 3);
+}
+
+TEST_F(ApproxTopKSketchTest, findsMostFrequentValuesOfMergedSketches)
+{
+    constexpr uint64_t numberOfSketches = 8;
+    constexpr uint64_t numberOfValuesPerSketch = 20000;
+    std::mt19937_64 randomGenerator(42);
+    /// The frequency of the key i is proportional to 0.9^i, i.e., there are many more distinct keys with a small frequency than counters
+    std::geometric_distribution<uint64_t> distribution(0.1);
+
+    ApproxTopKSketch mergedSketch;
+    for (uint64_t sketchIdx = 0; sketchIdx < numberOfSketches; ++sketchIdx)
+    {
+        ApproxTopKSketch sketch;
+        for (uint64_t i = 0; i < numberOfValuesPerSketch; ++i)
+        {
+            sketch.insert(distribution(randomGenerator));
+        }
+        mergedSketch.merge(sketch);
+    }
+
+    const auto topK = mergedSketch.getTopK(5);
+    ASSERT_EQ(topK.size(), 5);
+    for (uint64_t rank = 0; rank < topK.size(); ++rank)
+    {
+        EXPECT_EQ(topK[rank].key, rank);
+        /// The count overestimates the frequency by at most the error. Thus, the expected frequency must lie within both.
+        const auto expectedCount = static_cast<double>(numberOfSketches * numberOfValuesPerSketch) * 0.1 * std::pow(0.9, rank);
+        EXPECT_LE(static_cast<double>(topK[rank].count - topK[rank].error), expectedCount * 1.05);
+        EXPECT_GE(static_cast<double>(topK[rank].count), expectedCount * 0.95);
+    }
+}
+
+}
@@ -0,0 +1,107 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <tuple>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
+#include <SliceStore/DefaultTimeBasedSliceStore.hpp>
+#include <SliceStore/Slice.hpp>
+#include <SliceStore/WindowSlicesStoreInterface.hpp>
+#include <Time/Timestamp.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+
+namespace NES
+{
+
+class DefaultTimeBasedSliceStoreTest : public Testing::BaseUnitTest
+{
+public:
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("DefaultTimeBasedSliceStoreTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup DefaultTimeBasedSliceStoreTest class.");
+    }
+
+    void SetUp() override { BaseUnitTest::SetUp(); }
+
+    static std::vector<std::shared_ptr<Slice>> createSlice(const SliceStart sliceStart, const SliceEnd sliceEnd)
+    {
+        return {std::make_shared<Slice>(sliceStart, sliceEnd)};
+    }
+
+    /// Maps the window start, window end, and sequence number of each emitted window to the sorted slice ends of the window
+    static std::map<std::tuple<uint64_t, uint64_t, uint64_t>, std::vector<uint64_t>>
+    toSliceEnds(const std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>>& windowsToSlices)
+    {
+        std::map<std::tuple<uint64_t, uint64_t, uint64_t>, std::vector<uint64_t>> sliceEnds;
+        for (const auto& [windowInfoAndSequenceNumber, slices] : windowsToSlices)
+        {
+            auto& windowSliceEnds = sliceEnds[{
+                windowInfoAndSequenceNumber.windowInfo.windowStart.getRawValue(),
+                windowInfoAndSequenceNumber.windowInfo.windowEnd.getRawValue(),
+                windowInfoAndSequenceNumber.sequenceNumber.getRawValue()}];
+            for (const auto& slice : slices)
+            {
+                windowSliceEnds.emplace_back(slice->getSliceEnd().getRawValue());
+            }
+            std::ranges::sort(windowSliceEnds);
+        }
+        return sliceEnds;
+    }
+};
+
+TEST_F(DefaultTimeBasedSliceStoreTest, emitsEarlyResultsOfFillingWindows)
+{
+    constexpr uint64_t windowSize = 10;
+    constexpr uint64_t earlyFiringInterval = 4;
+    DefaultTimeBasedSliceStore sliceStore(windowSize, windowSize, 0, std::filesystem::path{}, earlyFiringInterval);
+    sliceStore.incrementNumberOfInputPipelines();
+    for (const uint64_t timestamp : {1, 5, 9, 11})
+    {
+        sliceStore.getSlicesOrCreate(Timestamp(timestamp), createSlice);
+    }
+
+    using SliceEnds = std::map<std::tuple<uint64_t, uint64_t, uint64_t>, std::vector<uint64_t>>;
+    constexpr auto firstSequenceNumber = SequenceNumber::INITIAL;
+
+    /// Early results solely contain the slices that end before the last multiple of the interval behind the watermark
+    EXPECT_EQ(toSliceEnds(sliceStore.getEarlyWindowSlices(Timestamp(5))), (SliceEnds{{{0, 10, firstSequenceNumber}, {4}}}));
+    EXPECT_TRUE(sliceStore.getEarlyWindowSlices(Timestamp(6)).empty());
+    EXPECT_EQ(toSliceEnds(sliceStore.getEarlyWindowSlices(Timestamp(9))), (SliceEnds{{{0, 10, firstSequenceNumber + 1}, {4, 8}}}));
+
+    /// The final result of the window follows the early results and afterward, the window does not emit any early results
+    EXPECT_EQ(
+        toSliceEnds(sliceStore.getTriggerableWindowSlices(Timestamp(11))), (SliceEnds{{{0, 10, firstSequenceNumber + 2}, {4, 8, 10}}}));
+    EXPECT_EQ(toSliceEnds(sliceStore.getEarlyWindowSlices(Timestamp(13))), (SliceEnds{{{10, 20, firstSequenceNumber + 3}, {12}}}));
+}
+
+TEST_F(DefaultTimeBasedSliceStoreTest, emitsNoEarlyResultsWithoutInterval)
+{
+    DefaultTimeBasedSliceStore sliceStore(10, 10);
+    sliceStore.incrementNumberOfInputPipelines();
+    sliceStore.getSlicesOrCreate(Timestamp(1), createSlice);
+    EXPECT_TRUE(sliceStore.getEarlyWindowSlices(Timestamp(9)).empty());
+    EXPECT_EQ(sliceStore.getSlicesOrCreate(Timestamp(9), createSlice)[0]->getSliceEnd(), SliceEnd(10));
+}
+
+}
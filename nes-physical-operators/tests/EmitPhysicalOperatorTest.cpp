@@ -35,7 +35,9 @@
 #include <Identifiers/Identifiers.hpp>
 #include <Identifiers/NESStrongType.hpp>
 #include <MemoryLayout/RowLayout.hpp>
+#include <Nautilus/DataTypes/VarVal.hpp>
 #include <Nautilus/Interface/BufferRef/RowTupleBufferRef.hpp>
+#include <Nautilus/Interface/Record.hpp>
 #include <Nautilus/Interface/RecordBuffer.hpp>
 #include <Runtime/AbstractBufferProvider.hpp>
 #include <Runtime/BufferManager.hpp>
@@ -94,6 +96,8 @@ class EmitPhysicalOperatorTest : public Testing::BaseUnitTest
 
         void repeatTask(const TupleBuffer&, std::chrono::milliseconds) override { INVARIANT(false, "This function should not be called"); }
 
+        void submitTask(const TupleBuffer&) override { INVARIANT(false, "This function should not be called"); }
+
         ///NOLINTNEXTLINE(cppcoreguidelines-avoid-const-or-ref-data-members) lifetime is ensured by the `run` method.
         folly::Synchronized<std::vector<TupleBuffer>>& buffers;
         std::shared_ptr<BufferManager> bufferManager;
@@ -122,6 +126,26 @@ public:
         return emit;
     }
 
+    EmitPhysicalOperator createCoalescingUUT(const std::chrono::milliseconds maxDelay)
+    {
+        auto schema = Schema{}.addField("A_FIELD", DataType::Type::UINT32);
+        auto layout = std::make_shared<RowLayout>(512, schema);
+        EmitPhysicalOperator emit{OperatorHandlerId(0), std::make_shared<Interface::BufferRef::RowTupleBufferRef>(layout), true};
+        auto handler = std::make_shared<EmitOperatorHandler>(maxDelay);
+        handler->setupCoalescing(1);
+        handlers.insert_or_assign(OperatorHandlerId(0), std::move(handler));
+        return emit;
+    }
+
+    EmitPhysicalOperator createReusingUUT()
+    {
+        auto schema = Schema{}.addField("A_FIELD", DataType::Type::UINT32);
+        auto layout = std::make_shared<RowLayout>(512, schema);
+        EmitPhysicalOperator emit{OperatorHandlerId(0), std::make_shared<Interface::BufferRef::RowTupleBufferRef>(layout), false, true};
+        handlers.emplace(OperatorHandlerId(0), std::make_shared<EmitOperatorHandler>());
+        return emit;
+    }
+
     void run(const std::function<void(ExecutionContext&, RecordBuffer&)>& test, TupleBuffer buffer)
     {
         MockedPipelineContext pec{buffers, bm};
@@ -378,4 +402,86 @@ TEST_F(EmitPhysicalOperatorTest, ConcurrentSequenceChunkNumberTest)
         checkLastChunks();
     }
 }
+
+TEST_F(EmitPhysicalOperatorTest, CoalescesInvocationsUntilTheMaxDelay)
+{
+    std::vector<TupleBuffer> inputBuffers;
+    for (size_t seq = 0; seq < 10; seq++)
+    {
+        inputBuffers.emplace_back(createBuffer(SequenceNumber::INITIAL + seq, ChunkNumber::INITIAL, true));
+    }
+
+    EmitPhysicalOperator emit = createCoalescingUUT(std::chrono::hours(1));
+    for (auto& buffer : inputBuffers)
+    {
+        run(
+            [&](auto& executionContext, auto& recordBuffer)
+            {
+                emit.open(executionContext, recordBuffer);
+                Record record({{"A_FIELD", VarVal(nautilus::val<uint32_t>(42))}});
+                emit.execute(executionContext, record);
+                emit.close(executionContext, recordBuffer);
+            },
+            buffer);
+    }
+    /// The records of all invocations wait in a single buffer
+    checkNumberOfBuffers(0);
+
+    run([&](auto& executionContext, auto&) { emit.terminate(executionContext); },
+        createBuffer(SequenceNumber::INITIAL, ChunkNumber::INITIAL));
+    checkNumberOfBuffers(1);
+    checkBufferAt(0, SequenceNumber::INITIAL, ChunkNumber::INITIAL, true, INITIAL<OriginId>, 10);
+}
+
+TEST_F(EmitPhysicalOperatorTest, EmitsCoalescedBuffersAfterTheMaxDelay)
+{
+    EmitPhysicalOperator emit = createCoalescingUUT(std::chrono::milliseconds::zero());
+    for (size_t seq = 0; seq < 3; seq++)
+    {
+        run(
+            [&](auto& executionContext, auto& recordBuffer)
+            {
+                emit.open(executionContext, recordBuffer);
+                Record record({{"A_FIELD", VarVal(nautilus::val<uint32_t>(42))}});
+                emit.execute(executionContext, record);
+                emit.close(executionContext, recordBuffer);
+            },
+            createBuffer(SequenceNumber::INITIAL + seq, ChunkNumber::INITIAL, true));
+    }
+
+    /// Without a delay, each invocation emits its records in a buffer with consecutive sequence numbers
+    checkNumberOfBuffers(3);
+    for (size_t index = 0; index < 3; index++)
+    {
+        checkBufferAt(index, SequenceNumber::INITIAL + index, ChunkNumber::INITIAL, true, INITIAL<OriginId>, 1);
+    }
+}
+
+TEST_F(EmitPhysicalOperatorTest, ReusesExclusivelyOwnedInputBuffers)
+{
+    EmitPhysicalOperator emit = createReusingUUT();
+    const auto emitRecord = [&](auto& executionContext, auto& recordBuffer)
+    {
+        emit.open(executionContext, recordBuffer);
+        Record record({{"A_FIELD", VarVal(nautilus::val<uint32_t>(42))}});
+        emit.execute(executionContext, record);
+        emit.close(executionContext, recordBuffer);
+    };
+
+    /// The invocation holds the only reference to the input buffer, thus the emit writes its records into the input buffer
+    auto exclusiveBuffer = createBuffer(SequenceNumber::INITIAL, ChunkNumber::INITIAL, true, INITIAL<OriginId>, 3);
+    const auto* exclusiveMemory = exclusiveBuffer.getAvailableMemoryArea().data();
+    run(emitRecord, std::move(exclusiveBuffer));
+
+    /// Another holder of the input buffer may still read its records, thus the emit writes its records into a new buffer
+    const auto sharedBuffer = createBuffer(SequenceNumber::INITIAL + 1, ChunkNumber::INITIAL, true, INITIAL<OriginId>, 3);
+    run(emitRecord, sharedBuffer);
+
+    checkNumberOfBuffers(2);
+    checkBufferAt(0, SequenceNumber::INITIAL, ChunkNumber::INITIAL, true, INITIAL<OriginId>, 1);
+    checkBufferAt(1, SequenceNumber::INITIAL + 1, ChunkNumber::INITIAL, true, INITIAL<OriginId>, 1);
+    EXPECT_EQ(buffers.rlock()->at(0).getAvailableMemoryArea().data(), exclusiveMemory);
+    EXPECT_NE(buffers.rlock()->at(1).getAvailableMemoryArea().data(), sharedBuffer.getAvailableMemoryArea().data());
+    EXPECT_EQ(sharedBuffer.getNumberOfTuples(), 3);
+}
 }
@@ -0,0 +1,128 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstdint>
+#include <unordered_set>
+#include <Identifiers/Identifiers.hpp>
+#include <Join/HashJoin/HJSlice.hpp>
+#include <Join/StreamJoinUtil.hpp>
+#include <Nautilus/Interface/BloomFilter/BlockedBloomFilter.hpp>
+#include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMap.hpp>
+#include <Nautilus/Interface/HashMap/HashMap.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <SliceStore/Slice.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+#include <HashMapSlice.hpp>
+
+namespace NES
+{
+
+class HJSliceTest : public Testing::BaseUnitTest
+{
+public:
+    static constexpr uint64_t NUMBER_OF_WORKER_THREADS = 3;
+    static constexpr uint64_t NUMBER_OF_PARTITIONS = 4;
+
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("HJSliceTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup HJSliceTest class.");
+    }
+
+    void SetUp() override { BaseUnitTest::SetUp(); }
+
+    /// As the hash maps stay empty, the slice never calls the cleanup functions
+    static CreateNewHashMapSliceArgs createSliceArgs(const uint64_t numberOfPartitions)
+    {
+        return {
+            {nullptr, nullptr}, sizeof(uint64_t), sizeof(uint64_t), 1024, 16, Nautilus::Interface::HashMapType::CHAINED, numberOfPartitions};
+    }
+};
+
+TEST_F(HJSliceTest, eachWorkerSideAndPartitionHasItsOwnHashMap)
+{
+    HJSlice slice(SliceStart(0), SliceEnd(100), createSliceArgs(NUMBER_OF_PARTITIONS), NUMBER_OF_WORKER_THREADS);
+    EXPECT_EQ(slice.getNumberOfHashMapsForSide(), NUMBER_OF_WORKER_THREADS);
+    EXPECT_EQ(slice.getNumberOfPartitions(), NUMBER_OF_PARTITIONS);
+
+    std::unordered_set<Nautilus::Interface::HashMap*> allHashMaps;
+    for (const auto buildSide : {JoinBuildSideType::Left, JoinBuildSideType::Right})
+    {
+        for (uint64_t workerThread = 0; workerThread < NUMBER_OF_WORKER_THREADS; ++workerThread)
+        {
+            for (uint64_t partition = 0; partition < NUMBER_OF_PARTITIONS; ++partition)
+            {
+                EXPECT_EQ(slice.getHashMapPtr(WorkerThreadId(workerThread), buildSide, partition), nullptr);
+                auto* hashMap = slice.getHashMapPtrOrCreate(WorkerThreadId(workerThread), buildSide, partition);
+                ASSERT_NE(hashMap, nullptr);
+                EXPECT_EQ(slice.getHashMapPtr(WorkerThreadId(workerThread), buildSide, partition), hashMap);
+                allHashMaps.insert(hashMap);
+            }
+        }
+    }
+    EXPECT_EQ(allHashMaps.size(), 2 * NUMBER_OF_WORKER_THREADS * NUMBER_OF_PARTITIONS);
+    EXPECT_EQ(slice.getNumberOfHashMaps(), 2 * NUMBER_OF_WORKER_THREADS * NUMBER_OF_PARTITIONS);
+}
+
+TEST_F(HJSliceTest, singlePartitionKeepsOneHashMapPerWorker)
+{
+    HJSlice slice(SliceStart(0), SliceEnd(100), createSliceArgs(1), NUMBER_OF_WORKER_THREADS);
+    EXPECT_EQ(slice.getNumberOfHashMapsForSide(), NUMBER_OF_WORKER_THREADS);
+    EXPECT_EQ(slice.getNumberOfHashMaps(), 2 * NUMBER_OF_WORKER_THREADS);
+    EXPECT_NE(
+        slice.getHashMapPtrOrCreate(WorkerThreadId(0), JoinBuildSideType::Left, 0),
+        slice.getHashMapPtrOrCreate(WorkerThreadId(0), JoinBuildSideType::Right, 0));
+}
+
+TEST_F(HJSliceTest, bloomFilterContainsTheKeysOfAllLeftHashMapsOfThePartition)
+{
+    const auto bufferManager = BufferManager::create();
+    HJSlice slice(SliceStart(0), SliceEnd(100), createSliceArgs(NUMBER_OF_PARTITIONS), NUMBER_OF_WORKER_THREADS);
+
+    /// Inserting the hash h into the left hash map of worker h % #workers and partition h % #partitions
+    constexpr uint64_t NUMBER_OF_HASHES = 1000;
+    for (uint64_t hash = 0; hash < NUMBER_OF_HASHES; ++hash)
+    {
+        auto* hashMap = slice.getHashMapPtrOrCreate(
+            WorkerThreadId(hash % NUMBER_OF_WORKER_THREADS), JoinBuildSideType::Left, hash % NUMBER_OF_PARTITIONS);
+        hashMap->insertEntry(hash, bufferManager.get());
+    }
+
+    for (uint64_t partition = 0; partition < NUMBER_OF_PARTITIONS; ++partition)
+    {
+        const auto* bloomFilter = slice.getOrCreateBloomFilter(partition, bufferManager.get());
+        ASSERT_NE(bloomFilter, nullptr);
+        EXPECT_EQ(slice.getOrCreateBloomFilter(partition, bufferManager.get()), bloomFilter);
+        for (uint64_t hash = partition; hash < NUMBER_OF_HASHES; hash += NUMBER_OF_PARTITIONS)
+        {
+            EXPECT_TRUE(bloomFilter->mayContain(hash));
+        }
+    }
+
+    /// Clearing the hash maps, as the slice would call the cleanup functions for non-empty hash maps
+    for (uint64_t workerThread = 0; workerThread < NUMBER_OF_WORKER_THREADS; ++workerThread)
+    {
+        for (uint64_t partition = 0; partition < NUMBER_OF_PARTITIONS; ++partition)
+        {
+            auto* hashMap = slice.getHashMapPtr(WorkerThreadId(workerThread), JoinBuildSideType::Left, partition);
+            dynamic_cast<Nautilus::Interface::ChainedHashMap*>(hashMap)->clear();
+        }
+    }
+}
+
+}
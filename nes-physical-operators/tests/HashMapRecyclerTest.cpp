@@ -0,0 +1,121 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <HashMapRecycler.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMap.hpp>
+#include <Nautilus/Interface/HashMap/HashMap.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+
+namespace NES
+{
+
+class HashMapRecyclerTest : public Testing::BaseUnitTest
+{
+public:
+    static constexpr uint64_t PAGE_SIZE = 1024;
+    static constexpr HashMapRecycler::Configuration CONFIGURATION{
+        .hashMapType = Nautilus::Interface::HashMapType::CHAINED,
+        .keySize = sizeof(uint64_t),
+        .valueSize = sizeof(uint64_t),
+        .numberOfBuckets = 16,
+        .pageSize = PAGE_SIZE};
+
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("HashMapRecyclerTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup HashMapRecyclerTest class.");
+    }
+
+    void SetUp() override { BaseUnitTest::SetUp(); }
+
+    static std::unique_ptr<Nautilus::Interface::ChainedHashMap> createHashMap()
+    {
+        return std::make_unique<Nautilus::Interface::ChainedHashMap>(
+            CONFIGURATION.keySize, CONFIGURATION.valueSize, CONFIGURATION.numberOfBuckets, CONFIGURATION.pageSize);
+    }
+};
+
+TEST_F(HashMapRecyclerTest, acquireReturnsNullptrWithoutRecycledHashMaps)
+{
+    HashMapRecycler recycler;
+    EXPECT_EQ(recycler.acquire(CONFIGURATION), nullptr);
+    EXPECT_EQ(recycler.getNumberOfHashMaps(), 0);
+}
+
+TEST_F(HashMapRecyclerTest, recycledHashMapIsClearedAndKeepsItsRetainedPages)
+{
+    constexpr uint64_t MAX_RETAINED_PAGES = 2;
+    const auto bufferManager = BufferManager::create();
+    HashMapRecycler recycler(1, MAX_RETAINED_PAGES);
+
+    auto hashMap = createHashMap();
+    constexpr uint64_t NUMBER_OF_HASHES = 1000;
+    for (uint64_t hash = 0; hash < NUMBER_OF_HASHES; ++hash)
+    {
+        hashMap->insertEntry(hash, bufferManager.get());
+    }
+    ASSERT_GT(hashMap->getNumberOfPages(), MAX_RETAINED_PAGES);
+    auto* const recycledHashMap = hashMap.get();
+    recycler.recycle(CONFIGURATION, std::move(hashMap));
+    EXPECT_EQ(recycler.getNumberOfHashMaps(), 1);
+
+    auto acquiredHashMap = recycler.acquire(CONFIGURATION);
+    ASSERT_EQ(acquiredHashMap.get(), recycledHashMap);
+    EXPECT_EQ(recycler.getNumberOfHashMaps(), 0);
+    EXPECT_EQ(acquiredHashMap->getNumberOfTuples(), 0);
+    EXPECT_EQ(recycledHashMap->getNumberOfPages(), MAX_RETAINED_PAGES);
+
+    /// The hash map fills its retained pages before it allocates new ones
+    const auto entriesPerPage = PAGE_SIZE / (sizeof(Nautilus::Interface::ChainedHashMapEntry) + 2 * sizeof(uint64_t));
+    for (uint64_t hash = 0; hash < MAX_RETAINED_PAGES * entriesPerPage; ++hash)
+    {
+        recycledHashMap->insertEntry(hash, bufferManager.get());
+    }
+    EXPECT_EQ(recycledHashMap->getNumberOfPages(), MAX_RETAINED_PAGES);
+    recycledHashMap->insertEntry(0, bufferManager.get());
+    EXPECT_EQ(recycledHashMap->getNumberOfPages(), MAX_RETAINED_PAGES + 1);
+    recycledHashMap->clear();
+}
+
+TEST_F(HashMapRecyclerTest, hashMapsAreSolelyReusedForTheirConfiguration)
+{
+    HashMapRecycler recycler;
+    recycler.recycle(CONFIGURATION, createHashMap());
+
+    auto otherConfiguration = CONFIGURATION;
+    otherConfiguration.numberOfBuckets *= 2;
+    EXPECT_EQ(recycler.acquire(otherConfiguration), nullptr);
+    EXPECT_NE(recycler.acquire(CONFIGURATION), nullptr);
+}
+
+TEST_F(HashMapRecyclerTest, recyclerReleasesHashMapsBeyondItsCapacity)
+{
+    HashMapRecycler recycler(2);
+    for (uint64_t hashMap = 0; hashMap < 4; ++hashMap)
+    {
+        recycler.recycle(CONFIGURATION, createHashMap());
+    }
+    EXPECT_EQ(recycler.getNumberOfHashMaps(), 2);
+}
+
+}
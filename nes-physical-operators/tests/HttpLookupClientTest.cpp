@@ -0,0 +1,246 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Join/LookupJoin/HttpLookupClient.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+#include <ErrorHandling.hpp>
+
+namespace NES
+{
+
+class HttpLookupClientTest : public Testing::BaseUnitTest
+{
+public:
+    /// Answers every request on the loopback interface after a delay, which lets the requests of the client overlap
+    class LoopbackServer
+    {
+    public:
+        using Handler = std::function<std::string(const std::string& request)>;
+
+        LoopbackServer(Handler handler, const std::chrono::milliseconds responseDelay)
+            : handler(std::move(handler)), responseDelay(responseDelay)
+        {
+            listeningSocket = ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+            sockaddr_in address{};
+            address.sin_family = AF_INET;
+            address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            socklen_t addressLength = sizeof(address);
+            /// NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+            if (::bind(listeningSocket, reinterpret_cast<sockaddr*>(&address), addressLength) != 0 or ::listen(listeningSocket, 64) != 0
+                or getsockname(listeningSocket, reinterpret_cast<sockaddr*>(&address), &addressLength) != 0)
+            {
+                throw TestException("Could not listen on the loopback interface");
+            }
+            /// NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+            port = ntohs(address.sin_port);
+            thread = std::jthread([this](const std::stop_token& stopToken) { serve(stopToken); });
+        }
+
+        ~LoopbackServer()
+        {
+            thread.request_stop();
+            thread.join();
+            ::close(listeningSocket);
+        }
+
+        LoopbackServer(const LoopbackServer&) = delete;
+        LoopbackServer(LoopbackServer&&) = delete;
+        LoopbackServer& operator=(const LoopbackServer&) = delete;
+        LoopbackServer& operator=(LoopbackServer&&) = delete;
+
+        [[nodiscard]] uint16_t getPort() const { return port; }
+        [[nodiscard]] size_t getPeakNumberOfConnections() const { return peakNumberOfConnections.load(); }
+
+    private:
+        void serve(const std::stop_token& stopToken)
+        {
+            std::map<int, std::chrono::steady_clock::time_point> connections;
+            while (not stopToken.stop_requested())
+            {
+                pollfd descriptor{.fd = listeningSocket, .events = POLLIN, .revents = 0};
+                if (::poll(&descriptor, 1, 1) > 0)
+                {
+                    connections.emplace(accept4(listeningSocket, nullptr, nullptr, SOCK_CLOEXEC), std::chrono::steady_clock::now());
+                    peakNumberOfConnections = std::max(peakNumberOfConnections.load(), connections.size());
+                }
+                for (auto connection = connections.begin(); connection != connections.end();)
+                {
+                    if (std::chrono::steady_clock::now() - connection->second < responseDelay)
+                    {
+                        ++connection;
+                        continue;
+                    }
+                    std::array<char, 4096> request{};
+                    const auto numberOfReceivedBytes = ::recv(connection->first, request.data(), request.size(), 0);
+                    const auto response = handler(std::string(request.data(), std::max<ssize_t>(numberOfReceivedBytes, 0)));
+                    [[maybe_unused]] const auto numberOfSentBytes
+                        = ::send(connection->first, response.data(), response.size(), MSG_NOSIGNAL);
+                    ::close(connection->first);
+                    connection = connections.erase(connection);
+                }
+            }
+            for (const auto& connection : connections)
+            {
+                ::close(connection.first);
+            }
+        }
+
+        Handler handler;
+        std::chrono::milliseconds responseDelay;
+        int listeningSocket{-1};
+        uint16_t port{0};
+        std::atomic<size_t> peakNumberOfConnections{0};
+        std::jthread thread;
+    };
+
+    using Result = std::expected<HttpLookupClient::Response, std::string>;
+
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("HttpLookupClientTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup HttpLookupClientTest class.");
+    }
+
+    void SetUp() override { BaseUnitTest::SetUp(); }
+
+    HttpLookupClient::OnResponse recordResponses()
+    {
+        return [this](const std::string& key, Result response)
+        {
+            const std::scoped_lock lock(mutex);
+            responses.emplace(key, std::move(response));
+        };
+    }
+
+    /// Waits until the client responded to the number of requests
+    std::map<std::string, Result> awaitResponses(const size_t numberOfRequests)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (std::chrono::steady_clock::now() < deadline)
+        {
+            {
+                const std::scoped_lock lock(mutex);
+                if (responses.size() >= numberOfRequests)
+                {
+                    return responses;
+                }
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        const std::scoped_lock lock(mutex);
+        return responses;
+    }
+
+    std::mutex mutex;
+    std::map<std::string, Result> responses;
+};
+
+TEST_F(HttpLookupClientTest, respondsWithTheRowsOfTheKey)
+{
+    LoopbackServer server(
+        [](const std::string& request)
+        {
+            if (request.starts_with("GET /customers?id=42&format=csv HTTP/1.0\r\n"))
+            {
+                return std::string("HTTP/1.0 200 OK\r\nContent-Type: text/csv\r\n\r\n42,alice\n42,bob\n");
+            }
+            if (request.starts_with("GET /customers?id=a%20b%2Fc&format=csv HTTP/1.0\r\n"))
+            {
+                return std::string("HTTP/1.0 200 OK\r\n\r\n");
+            }
+            return std::string("HTTP/1.0 404 Not Found\r\n\r\n");
+        },
+        std::chrono::milliseconds(0));
+    const HttpLookupClient::OnResponse onResponse = recordResponses();
+    HttpLookupClient client(fmt::format("http://127.0.0.1:{}/customers?id={{}}&format=csv", server.getPort()), 2, onResponse);
+    client.request("first", "42");
+    client.request("second", "7");
+    client.request("third", "a b/c");
+
+    const auto receivedResponses = awaitResponses(3);
+    ASSERT_EQ(receivedResponses.size(), 3);
+    ASSERT_TRUE(receivedResponses.at("first").has_value());
+    EXPECT_EQ(receivedResponses.at("first")->statusCode, 200);
+    EXPECT_EQ(receivedResponses.at("first")->body, "42,alice\n42,bob\n");
+    ASSERT_TRUE(receivedResponses.at("second").has_value());
+    EXPECT_EQ(receivedResponses.at("second")->statusCode, 404);
+    ASSERT_TRUE(receivedResponses.at("third").has_value());
+    EXPECT_EQ(receivedResponses.at("third")->statusCode, 200);
+    EXPECT_TRUE(receivedResponses.at("third")->body.empty());
+}
+
+TEST_F(HttpLookupClientTest, boundsTheRequestsInFlight)
+{
+    LoopbackServer server([](const std::string&) { return std::string("HTTP/1.0 200 OK\r\n\r\n"); }, std::chrono::milliseconds(20));
+    constexpr size_t MAX_IN_FLIGHT = 2;
+    constexpr size_t NUMBER_OF_REQUESTS = 10;
+    HttpLookupClient client(fmt::format("http://127.0.0.1:{}/{{}}", server.getPort()), MAX_IN_FLIGHT, recordResponses());
+    for (size_t request = 0; request < NUMBER_OF_REQUESTS; ++request)
+    {
+        client.request(std::to_string(request), std::to_string(request));
+    }
+
+    const auto receivedResponses = awaitResponses(NUMBER_OF_REQUESTS);
+    EXPECT_EQ(receivedResponses.size(), NUMBER_OF_REQUESTS);
+    EXPECT_TRUE(std::ranges::all_of(receivedResponses, [](const auto& response) { return response.second.has_value(); }));
+    EXPECT_LE(server.getPeakNumberOfConnections(), MAX_IN_FLIGHT);
+}
+
+TEST_F(HttpLookupClientTest, failsRequestsToAnUnreachableServer)
+{
+    uint16_t closedPort = 0;
+    {
+        /// The port of a closed server refuses all connections
+        const LoopbackServer closedServer([](const std::string&) { return std::string(); }, std::chrono::milliseconds(0));
+        closedPort = closedServer.getPort();
+    }
+    HttpLookupClient client(fmt::format("http://127.0.0.1:{}/{{}}", closedPort), 1, recordResponses());
+    client.request("key", "1");
+
+    const auto receivedResponses = awaitResponses(1);
+    ASSERT_EQ(receivedResponses.size(), 1);
+    EXPECT_FALSE(receivedResponses.at("key").has_value());
+}
+
+TEST_F(HttpLookupClientTest, rejectsMalformedUrls)
+{
+    EXPECT_ANY_THROW(HttpLookupClient("https://127.0.0.1/{}", 1, recordResponses()));
+    EXPECT_ANY_THROW(HttpLookupClient("http://127.0.0.1/without-key", 1, recordResponses()));
+    EXPECT_ANY_THROW(HttpLookupClient("http://127.0.0.1:port/{}", 1, recordResponses()));
+}
+
+}
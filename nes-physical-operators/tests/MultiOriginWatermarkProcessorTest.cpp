@@ -0,0 +1,114 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
+#include <Sequencing/SequenceData.hpp>
+#include <Time/Timestamp.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <Watermark/MultiOriginWatermarkProcessor.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+
+namespace NES
+{
+
+class MultiOriginWatermarkProcessorTest : public Testing::BaseUnitTest
+{
+public:
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("MultiOriginWatermarkProcessorTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup MultiOriginWatermarkProcessorTest class.");
+    }
+
+    void SetUp() override { BaseUnitTest::SetUp(); }
+
+    static SequenceData toSequenceData(const uint64_t sequenceNumber)
+    {
+        return {SequenceNumber(sequenceNumber), ChunkNumber(ChunkNumber::INITIAL), true};
+    }
+};
+
+TEST_F(MultiOriginWatermarkProcessorTest, emitsMinimalWatermarkAcrossOrigins)
+{
+    /// Three origins do not fill the four leaves of the tournament tree
+    const MultiOriginWatermarkProcessor watermarkProcessor({OriginId(1), OriginId(2), OriginId(3)});
+    EXPECT_EQ(watermarkProcessor.updateWatermark(Timestamp(10), toSequenceData(1), OriginId(1)), Timestamp(0));
+    EXPECT_EQ(watermarkProcessor.updateWatermark(Timestamp(20), toSequenceData(1), OriginId(2)), Timestamp(0));
+    EXPECT_EQ(watermarkProcessor.updateWatermark(Timestamp(5), toSequenceData(1), OriginId(3)), Timestamp(5));
+    EXPECT_EQ(watermarkProcessor.getWatermarkLag(OriginId(3)), 15);
+    EXPECT_EQ(watermarkProcessor.getWatermarkLag(OriginId(2)), 0);
+
+    /// Out-of-order sequence numbers solely advance the watermark once all previous sequence numbers have arrived
+    EXPECT_EQ(watermarkProcessor.updateWatermark(Timestamp(30), toSequenceData(3), OriginId(3)), Timestamp(5));
+    EXPECT_EQ(watermarkProcessor.updateWatermark(Timestamp(25), toSequenceData(2), OriginId(3)), Timestamp(10));
+    EXPECT_EQ(watermarkProcessor.getCurrentWatermark(OriginId(3)), Timestamp(30));
+    EXPECT_EQ(watermarkProcessor.getCurrentWatermark(), Timestamp(10));
+}
+
+TEST_F(MultiOriginWatermarkProcessorTest, emitsMinimalWatermarkForConcurrentUpdates)
+{
+    constexpr uint64_t numberOfOrigins = 37;
+    constexpr uint64_t numberOfUpdates = 1000;
+    std::vector<OriginId> origins;
+    for (uint64_t origin = 1; origin <= numberOfOrigins; ++origin)
+    {
+        origins.emplace_back(origin);
+    }
+    const MultiOriginWatermarkProcessor watermarkProcessor(origins);
+
+    /// Each thread updates one origin, whose watermark increases with each sequence number
+    std::vector<std::jthread> threads;
+    for (const auto& origin : origins)
+    {
+        threads.emplace_back(
+            [&watermarkProcessor, origin]
+            {
+                for (uint64_t sequenceNumber = 1; sequenceNumber <= numberOfUpdates; ++sequenceNumber)
+                {
+                    const auto watermark = Timestamp((sequenceNumber * 10) + origin.getRawValue());
+                    EXPECT_LE(watermarkProcessor.updateWatermark(watermark, toSequenceData(sequenceNumber), origin), watermark);
+                }
+            });
+    }
+    threads.clear();
+
+    EXPECT_EQ(watermarkProcessor.getCurrentWatermark(), Timestamp((numberOfUpdates * 10) + 1));
+    EXPECT_EQ(watermarkProcessor.getWatermarkLag(OriginId(1)), numberOfOrigins - 1);
+}
+
+
+TEST_F(MultiOriginWatermarkProcessorTest, advancesWatermarkOfIdleOrigins)
+{
+    constexpr auto idleTimeout = std::chrono::milliseconds(10);
+    const MultiOriginWatermarkProcessor watermarkProcessor({OriginId(1), OriginId(2)}, idleTimeout);
+    EXPECT_EQ(watermarkProcessor.updateWatermark(Timestamp(10), toSequenceData(1), OriginId(1)), Timestamp(0));
+    EXPECT_EQ(watermarkProcessor.updateWatermark(Timestamp(5), toSequenceData(1), OriginId(2)), Timestamp(5));
+
+    /// The second origin is idle, thus the first origin solely determines the watermark
+    std::this_thread::sleep_for(2 * idleTimeout);
+    EXPECT_EQ(watermarkProcessor.updateWatermark(Timestamp(50), toSequenceData(2), OriginId(1)), Timestamp(50));
+
+    /// Once the second origin resumes, the watermark does not decrease
+    EXPECT_EQ(watermarkProcessor.updateWatermark(Timestamp(30), toSequenceData(2), OriginId(2)), Timestamp(50));
+    EXPECT_EQ(watermarkProcessor.getCurrentWatermark(OriginId(2)), Timestamp(50));
+}
+
+}
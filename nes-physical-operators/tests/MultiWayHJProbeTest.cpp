@@ -0,0 +1,319 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/DataTypeProvider.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Functions/FieldAccessPhysicalFunction.hpp>
+#include <Identifiers/Identifiers.hpp>
+#include <Join/HashJoin/HJBuildPhysicalOperator.hpp>
+#include <Join/HashJoin/MultiWayHJOperatorHandler.hpp>
+#include <Join/HashJoin/MultiWayHJProbePhysicalOperator.hpp>
+#include <Nautilus/DataTypes/VarVal.hpp>
+#include <Nautilus/Interface/BufferRef/TupleBufferRef.hpp>
+#include <Nautilus/Interface/Hash/HashFunction.hpp>
+#include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedEntryMemoryProvider.hpp>
+#include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMap.hpp>
+#include <Nautilus/Interface/HashMap/HashMap.hpp>
+#include <Nautilus/Interface/PagedVector/PagedVector.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <Nautilus/Interface/RecordBuffer.hpp>
+#include <Runtime/AbstractBufferProvider.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/Execution/OperatorHandler.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <SliceStore/WindowSlicesStoreInterface.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <Windowing/WindowMetaData.hpp>
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+#include <ErrorHandling.hpp>
+#include <ExecutionContext.hpp>
+#include <HashMapOptions.hpp>
+#include <PhysicalOperator.hpp>
+#include <PipelineExecutionContext.hpp>
+#include <function.hpp>
+#include <val.hpp>
+#include <val_ptr.hpp>
+
+namespace NES
+{
+
+namespace
+{
+using JoinedValues = std::vector<uint64_t>;
+
+/// Collects the values of the given fields of each record that the probe passes to its child
+class CollectRecordsPhysicalOperator final : public PhysicalOperatorConcept
+{
+public:
+    CollectRecordsPhysicalOperator(std::vector<Record::RecordFieldIdentifier> fields, std::vector<JoinedValues>* collectedRecords)
+        : fields(std::move(fields)), collectedRecords(collectedRecords)
+    {
+    }
+
+    void execute(ExecutionContext&, Record& record) const override
+    {
+        const nautilus::val<std::vector<JoinedValues>*> collectedRecordsRef{collectedRecords};
+        nautilus::invoke(+[](std::vector<JoinedValues>* records) { records->emplace_back(); }, collectedRecordsRef);
+        for (const auto& field : fields)
+        {
+            nautilus::invoke(
+                +[](std::vector<JoinedValues>* records, const uint64_t value) { records->back().push_back(value); },
+                collectedRecordsRef,
+                record.read(field).cast<nautilus::val<uint64_t>>());
+        }
+    }
+
+    [[nodiscard]] std::optional<PhysicalOperator> getChild() const override { return std::nullopt; }
+
+    void setChild(PhysicalOperator) override { INVARIANT(false, "The collecting operator has no child"); }
+
+private:
+    std::vector<Record::RecordFieldIdentifier> fields;
+    std::vector<JoinedValues>* collectedRecords;
+};
+}
+
+/// Tests the probe of the multi-way hash join on hash maps filled by the build of each input. Each input i has the fields s<i>$id, the
+/// join key, and s<i>$value.
+class MultiWayHJProbeTest : public Testing::BaseUnitTest
+{
+    struct MockedPipelineContext final : PipelineExecutionContext
+    {
+        explicit MockedPipelineContext(std::shared_ptr<BufferManager> bufferManager) : bufferManager(std::move(bufferManager)) { }
+
+        bool emitBuffer(const TupleBuffer&, ContinuationPolicy) override
+        {
+            INVARIANT(false, "The probe passes the joined records to its child instead of emitting buffers");
+            return false;
+        }
+
+        TupleBuffer allocateTupleBuffer() override { return bufferManager->getBufferBlocking(); }
+
+        [[nodiscard]] WorkerThreadId getId() const override { return INITIAL<WorkerThreadId>; }
+
+        [[nodiscard]] uint64_t getNumberOfWorkerThreads() const override { return 1; }
+
+        [[nodiscard]] std::shared_ptr<AbstractBufferProvider> getBufferManager() const override { return bufferManager; }
+
+        [[nodiscard]] PipelineId getPipelineId() const override { return PipelineId(1); }
+
+        std::unordered_map<OperatorHandlerId, std::shared_ptr<OperatorHandler>>& getOperatorHandlers() override { return operatorHandlers; }
+
+        void setOperatorHandlers(std::unordered_map<OperatorHandlerId, std::shared_ptr<OperatorHandler>>& opHandlers) override
+        {
+            operatorHandlers = opHandlers;
+        }
+
+        void repeatTask(const TupleBuffer&, std::chrono::milliseconds) override { INVARIANT(false, "This function should not be called"); }
+
+        void submitTask(const TupleBuffer&) override { INVARIANT(false, "This function should not be called"); }
+
+        std::shared_ptr<BufferManager> bufferManager;
+        std::unordered_map<OperatorHandlerId, std::shared_ptr<OperatorHandler>> operatorHandlers;
+    };
+
+public:
+    static constexpr uint64_t NUMBER_OF_INPUTS = 3;
+    static constexpr uint64_t PAGE_SIZE = 1024;
+    static constexpr uint64_t NUMBER_OF_BUCKETS = 16;
+
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("MultiWayHJProbeTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup MultiWayHJProbeTest class.");
+    }
+
+    void SetUp() override
+    {
+        BaseUnitTest::SetUp();
+        for (uint64_t input = 0; input < NUMBER_OF_INPUTS; ++input)
+        {
+            const auto schema = Schema{}
+                                    .addField(fmt::format("s{}$id", input), DataType::Type::UINT64)
+                                    .addField(fmt::format("s{}$value", input), DataType::Type::UINT64);
+            hashMapOptions.emplace_back(createHashMapOptions(schema, fmt::format("s{}$id", input)));
+            bufferRefs.emplace_back(Interface::BufferRef::TupleBufferRef::create(PAGE_SIZE, schema));
+        }
+    }
+
+    void TearDown() override
+    {
+        /// Destroying the paged vectors of the entries, which return their pages to the buffer manager
+        hashMaps.clear();
+        BaseUnitTest::TearDown();
+    }
+
+    /// Creates the options of a hash map with the join key as its single key and a paged vector of the records of the key as its value,
+    /// like the lowering of the multi-way join does
+    static HashMapOptions createHashMapOptions(const Schema& schema, const std::string& keyFieldName)
+    {
+        constexpr auto valueSize = sizeof(Nautilus::Interface::PagedVector);
+        const auto keyDataType = DataTypeProvider::provideDataType(DataType::Type::UINT64);
+        const auto keySize = Interface::BufferRef::ChainedEntryMemoryProvider::getFieldSizeInBytes(keyDataType);
+        const auto entrySize = sizeof(Nautilus::Interface::ChainedHashMapEntry) + keySize + valueSize;
+        const auto& [fieldKeys, fieldValues]
+            = Interface::BufferRef::ChainedEntryMemoryProvider::createFieldOffsets(schema, {keyFieldName}, {});
+        return HashMapOptions{
+            Nautilus::Interface::HashFunction::create(Nautilus::Interface::HashFunctionType::MURMUR3),
+            {FieldAccessPhysicalFunction(keyFieldName)},
+            fieldKeys,
+            fieldValues,
+            PAGE_SIZE / entrySize,
+            entrySize,
+            keySize,
+            valueSize,
+            PAGE_SIZE,
+            NUMBER_OF_BUCKETS};
+    }
+
+    /// Creates an empty hash map of the input, e.g., the hash map of a worker thread in a slice
+    Nautilus::Interface::HashMap* createHashMap(const uint64_t input)
+    {
+        const auto keySize = hashMapOptions[input].keySize;
+        auto hashMap = std::make_unique<Nautilus::Interface::ChainedHashMap>(
+            keySize, hashMapOptions[input].valueSize, NUMBER_OF_BUCKETS, PAGE_SIZE);
+        hashMap->setDestructorCallback(
+            [keySize](const Nautilus::Interface::ChainedHashMapEntry* entry)
+            {
+                const auto* memArea = reinterpret_cast<const int8_t*>(entry) + sizeof(Nautilus::Interface::ChainedHashMapEntry) + keySize;
+                reinterpret_cast<const Nautilus::Interface::PagedVector*>(memArea)->~PagedVector();
+            });
+        return hashMaps.emplace_back(std::move(hashMap)).get();
+    }
+
+    /// Inserts the records of the input into the hash map, like the build of the input does
+    void
+    insert(const uint64_t input, Nautilus::Interface::HashMap* hashMap, const std::vector<std::pair<uint64_t, uint64_t>>& idsAndValues)
+    {
+        MockedPipelineContext pec{bufferManager};
+        Arena arena(bufferManager);
+        ExecutionContext executionContext{&pec, &arena};
+        for (const auto& [id, value] : idsAndValues)
+        {
+            const Record record(
+                {{fmt::format("s{}$id", input), VarVal(nautilus::val<uint64_t>(id))},
+                 {fmt::format("s{}$value", input), VarVal(nautilus::val<uint64_t>(value))}});
+            HJBuildPhysicalOperator::insertIntoHashMap(
+                executionContext, record, nautilus::val<Nautilus::Interface::HashMap*>(hashMap), hashMapOptions[input], bufferRefs[input]);
+        }
+    }
+
+    /// Probes the hash maps of all inputs for the window [10, 20) and returns the window start and end and the fields of all inputs of each
+    /// joined record, sorted
+    std::vector<JoinedValues> probe(const std::vector<std::vector<Nautilus::Interface::HashMap*>>& inputHashMaps)
+    {
+        std::vector<WindowMetaData> windowMetaData;
+        std::vector<Record::RecordFieldIdentifier> collectedFields{"w1$start", "w2$end"};
+        for (uint64_t join = 1; join < NUMBER_OF_INPUTS; ++join)
+        {
+            windowMetaData.emplace_back(fmt::format("w{}$start", join), fmt::format("w{}$end", join));
+        }
+        for (uint64_t input = 0; input < NUMBER_OF_INPUTS; ++input)
+        {
+            collectedFields.emplace_back(fmt::format("s{}$id", input));
+            collectedFields.emplace_back(fmt::format("s{}$value", input));
+        }
+
+        std::vector<JoinedValues> joinedRecords;
+        MultiWayHJProbePhysicalOperator probeOperator{OperatorHandlerId(0), windowMetaData, bufferRefs, hashMapOptions};
+        probeOperator.setChild(CollectRecordsPhysicalOperator(collectedFields, &joinedRecords));
+
+        auto triggerBuffer = bufferManager->getBufferBlocking();
+        new (triggerBuffer.getAvailableMemoryArea().data()) EmittedMultiWayHJWindowTrigger{WindowInfo(10, 20), inputHashMaps};
+
+        MockedPipelineContext pec{bufferManager};
+        Arena arena(bufferManager);
+        ExecutionContext executionContext{&pec, &arena};
+        RecordBuffer recordBuffer(std::addressof(triggerBuffer));
+        probeOperator.open(executionContext, recordBuffer);
+
+        std::ranges::sort(joinedRecords);
+        return joinedRecords;
+    }
+
+    std::shared_ptr<BufferManager> bufferManager = BufferManager::create();
+    std::vector<HashMapOptions> hashMapOptions;
+    std::vector<std::shared_ptr<Interface::BufferRef::TupleBufferRef>> bufferRefs;
+    std::vector<std::unique_ptr<Nautilus::Interface::HashMap>> hashMaps;
+};
+
+/// Joins each record of the first input with every combination of records of the same key of the other inputs
+TEST_F(MultiWayHJProbeTest, joinsAllCombinationsOfRecordsWithTheSameKey)
+{
+    auto* factHashMap = createHashMap(0);
+    auto* firstDimensionHashMap = createHashMap(1);
+    auto* secondDimensionHashMap = createHashMap(2);
+    insert(0, factHashMap, {{1, 100}, {2, 200}, {3, 300}, {1, 101}});
+    insert(1, firstDimensionHashMap, {{1, 110}, {1, 111}, {2, 210}});
+    insert(2, secondDimensionHashMap, {{1, 120}, {3, 320}});
+
+    /// Key 2 has no record in the second, key 3 no record in the first dimension
+    const std::vector<JoinedValues> expectedRecords{
+        {10, 20, 1, 100, 1, 110, 1, 120},
+        {10, 20, 1, 100, 1, 111, 1, 120},
+        {10, 20, 1, 101, 1, 110, 1, 120},
+        {10, 20, 1, 101, 1, 111, 1, 120}};
+    EXPECT_EQ(probe({{factHashMap}, {firstDimensionHashMap}, {secondDimensionHashMap}}), expectedRecords);
+}
+
+/// The records of a window are spread over the hash maps of several slices and worker threads. The probe joins the records of a key
+/// regardless of which hash maps of the inputs contain them.
+TEST_F(MultiWayHJProbeTest, joinsMatchesAcrossTheHashMapsOfSeveralSlices)
+{
+    std::vector<std::vector<Nautilus::Interface::HashMap*>> inputHashMaps(NUMBER_OF_INPUTS);
+    for (uint64_t input = 0; input < NUMBER_OF_INPUTS; ++input)
+    {
+        inputHashMaps[input] = {createHashMap(input), createHashMap(input)};
+    }
+    insert(0, inputHashMaps[0][0], {{1, 100}});
+    insert(0, inputHashMaps[0][1], {{2, 200}});
+    insert(1, inputHashMaps[1][0], {{2, 210}});
+    insert(1, inputHashMaps[1][1], {{1, 110}});
+    insert(2, inputHashMaps[2][0], {{1, 120}, {2, 220}});
+    insert(2, inputHashMaps[2][1], {{1, 121}});
+
+    const std::vector<JoinedValues> expectedRecords{
+        {10, 20, 1, 100, 1, 110, 1, 120}, {10, 20, 1, 100, 1, 110, 1, 121}, {10, 20, 2, 200, 2, 210, 2, 220}};
+    EXPECT_EQ(probe(inputHashMaps), expectedRecords);
+}
+
+/// If any input has no records in the window, no record of the window joins
+TEST_F(MultiWayHJProbeTest, joinsNoRecordIfAnInputIsEmpty)
+{
+    auto* factHashMap = createHashMap(0);
+    auto* firstDimensionHashMap = createHashMap(1);
+    auto* emptyHashMap = createHashMap(2);
+    insert(0, factHashMap, {{1, 100}});
+    insert(1, firstDimensionHashMap, {{1, 110}});
+
+    /// The operator handler solely emits the non-empty hash maps of a window, but the probe does not rely on it
+    EXPECT_TRUE(probe({{factHashMap}, {firstDimensionHashMap}, {}}).empty());
+    EXPECT_TRUE(probe({{factHashMap}, {firstDimensionHashMap}, {emptyHashMap}}).empty());
+}
+
+}
@@ -0,0 +1,104 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstdint>
+#include <memory>
+#include <unordered_set>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
+#include <Join/HashJoin/MultiWayHJSlice.hpp>
+#include <Nautilus/Interface/HashMap/HashMap.hpp>
+#include <SliceStore/Slice.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+#include <HashMapSlice.hpp>
+
+namespace NES
+{
+
+class MultiWayHJSliceTest : public Testing::BaseUnitTest
+{
+public:
+    static constexpr uint64_t NUMBER_OF_WORKER_THREADS = 3;
+    static constexpr uint64_t NUMBER_OF_INPUTS = 4;
+
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("MultiWayHJSliceTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup MultiWayHJSliceTest class.");
+    }
+
+    void SetUp() override { BaseUnitTest::SetUp(); }
+
+    /// As the hash maps stay empty, the slice never calls the cleanup functions
+    static CreateNewHashMapSliceArgs createSliceArgs(const uint64_t numberOfInputs)
+    {
+        return {
+            std::vector<std::shared_ptr<CreateNewHashMapSliceArgs::NautilusCleanupExec>>(numberOfInputs),
+            sizeof(uint64_t),
+            sizeof(uint64_t),
+            1024,
+            16,
+            Nautilus::Interface::HashMapType::CHAINED};
+    }
+};
+
+TEST_F(MultiWayHJSliceTest, eachWorkerAndInputHasItsOwnHashMap)
+{
+    MultiWayHJSlice slice(SliceStart(0), SliceEnd(100), createSliceArgs(NUMBER_OF_INPUTS), NUMBER_OF_WORKER_THREADS, NUMBER_OF_INPUTS);
+    EXPECT_EQ(slice.getNumberOfInputs(), NUMBER_OF_INPUTS);
+    EXPECT_EQ(slice.getNumberOfHashMapsForInput(), NUMBER_OF_WORKER_THREADS);
+
+    std::unordered_set<Nautilus::Interface::HashMap*> allHashMaps;
+    for (uint64_t input = 0; input < NUMBER_OF_INPUTS; ++input)
+    {
+        for (uint64_t workerThread = 0; workerThread < NUMBER_OF_WORKER_THREADS; ++workerThread)
+        {
+            EXPECT_EQ(slice.getHashMapPtr(WorkerThreadId(workerThread), input), nullptr);
+            auto* hashMap = slice.getHashMapPtrOrCreate(WorkerThreadId(workerThread), input);
+            ASSERT_NE(hashMap, nullptr);
+            EXPECT_EQ(slice.getHashMapPtrOrCreate(WorkerThreadId(workerThread), input), hashMap);
+            EXPECT_EQ(slice.getHashMapPtr(WorkerThreadId(workerThread), input), hashMap);
+            allHashMaps.insert(hashMap);
+        }
+    }
+    EXPECT_EQ(allHashMaps.size(), NUMBER_OF_INPUTS * NUMBER_OF_WORKER_THREADS);
+    EXPECT_EQ(slice.getNumberOfHashMaps(), NUMBER_OF_INPUTS * NUMBER_OF_WORKER_THREADS);
+}
+
+TEST_F(MultiWayHJSliceTest, workerThreadsBeyondTheNumberOfHashMapsShareTheHashMapsOfAnInput)
+{
+    MultiWayHJSlice slice(SliceStart(0), SliceEnd(100), createSliceArgs(NUMBER_OF_INPUTS), NUMBER_OF_WORKER_THREADS, NUMBER_OF_INPUTS);
+    for (uint64_t input = 0; input < NUMBER_OF_INPUTS; ++input)
+    {
+        auto* hashMap = slice.getHashMapPtrOrCreate(WorkerThreadId(1), input);
+        EXPECT_EQ(slice.getHashMapPtr(WorkerThreadId(1 + NUMBER_OF_WORKER_THREADS), input), hashMap);
+        EXPECT_EQ(slice.getHashMapPtr(WorkerThreadId(0), input), nullptr);
+    }
+}
+
+TEST_F(MultiWayHJSliceTest, inputsDoNotShareHashMaps)
+{
+    MultiWayHJSlice slice(SliceStart(0), SliceEnd(100), createSliceArgs(2), 1, 2);
+    auto* firstInputHashMap = slice.getHashMapPtrOrCreate(WorkerThreadId(0), 0);
+    EXPECT_EQ(slice.getHashMapPtr(WorkerThreadId(0), 1), nullptr);
+    auto* secondInputHashMap = slice.getHashMapPtrOrCreate(WorkerThreadId(0), 1);
+    EXPECT_NE(firstInputHashMap, secondInputHashMap);
+    EXPECT_EQ(slice.getNumberOfHashMaps(), 2);
+}
+
+}
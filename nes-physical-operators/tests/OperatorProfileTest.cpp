@@ -0,0 +1,102 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+#include <OperatorProfile.hpp>
+
+namespace NES
+{
+
+class OperatorProfileTest : public Testing::BaseUnitTest
+{
+public:
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("OperatorProfileTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup OperatorProfileTest class.");
+    }
+
+    void SetUp() override { BaseUnitTest::SetUp(); }
+
+    static OperatorProfile createProfile()
+    {
+        return OperatorProfile(PipelineId(3), {{OperatorId(10), "Scan"}, {OperatorId(11), "Selection"}, {OperatorId(12), "Emit"}});
+    }
+};
+
+TEST_F(OperatorProfileTest, findsTheCountersOfThePipelineOperators)
+{
+    const auto profile = createProfile();
+    EXPECT_EQ(profile.counterOf(OperatorId(10)), 0);
+    EXPECT_EQ(profile.counterOf(OperatorId(12)), 2);
+    EXPECT_EQ(profile.counterOf(OperatorId(13)), std::nullopt);
+}
+
+TEST_F(OperatorProfileTest, subtractsTheCyclesOfTheChild)
+{
+    auto profile = createProfile();
+    profile.record(0, 100);
+    profile.record(1, 30);
+    profile.record(1, 40);
+    profile.record(2, 10);
+
+    const auto operatorCycles = profile.getOperatorCycles();
+    ASSERT_EQ(operatorCycles.size(), 3);
+    EXPECT_EQ(operatorCycles[0].inclusiveCycles, 100);
+    EXPECT_EQ(operatorCycles[0].exclusiveCycles, 30);
+    EXPECT_EQ(operatorCycles[1].numberOfInvocations, 2);
+    EXPECT_EQ(operatorCycles[1].exclusiveCycles, 60);
+    EXPECT_EQ(operatorCycles[2].exclusiveCycles, 10);
+
+    const auto report = profile.toString();
+    EXPECT_NE(report.find("Pipeline3::Selection"), std::string::npos);
+    /// The operator with the most exclusive cycles comes first
+    EXPECT_LT(report.find("Pipeline3::Selection"), report.find("Pipeline3::Scan"));
+}
+
+TEST_F(OperatorProfileTest, recordsConcurrently)
+{
+    constexpr size_t numberOfThreads = 4;
+    constexpr size_t numberOfRecords = 10000;
+    auto profile = createProfile();
+    {
+        std::vector<std::jthread> threads;
+        for (size_t thread = 0; thread < numberOfThreads; ++thread)
+        {
+            threads.emplace_back(
+                [&profile]
+                {
+                    for (size_t record = 0; record < numberOfRecords; ++record)
+                    {
+                        const auto start = OperatorProfile::readCycleCounter();
+                        profile.record(1, OperatorProfile::readCycleCounter() - start);
+                    }
+                });
+        }
+    }
+    EXPECT_EQ(profile.getOperatorCycles()[1].numberOfInvocations, numberOfThreads * numberOfRecords);
+}
+
+}
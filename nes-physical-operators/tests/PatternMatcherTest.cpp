@@ -0,0 +1,172 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Pattern/PatternMatcher.hpp>
+
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <Time/Timestamp.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+
+namespace NES
+{
+
+class PatternMatcherTest : public Testing::BaseUnitTest
+{
+public:
+    static constexpr uint64_t A = 1;
+    static constexpr uint64_t B = 2;
+    static constexpr uint64_t C = 4;
+    static constexpr uint64_t WITHIN = 100;
+
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("PatternMatcherTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup PatternMatcherTest class.");
+    }
+
+    static PatternMatcher::Step any(const uint64_t events) { return {.type = PatternMatcher::Step::Type::ANY, .events = events}; }
+
+    /// Feeds the records, i.e., their matched events and timestamps, of a single key and returns the complete matches
+    static std::vector<PatternMatcher::Match>
+    feed(PatternMatcher& matcher, const std::vector<std::pair<uint64_t, uint64_t>>& records, const std::string_view key = "key")
+    {
+        std::vector<PatternMatcher::Match> matches;
+        for (const auto& [matchedEvents, timestamp] : records)
+        {
+            matcher.advance(key, matchedEvents, Timestamp(timestamp), matches);
+        }
+        return matches;
+    }
+};
+
+TEST_F(PatternMatcherTest, sequenceSkipsUnmatchedRecords)
+{
+    PatternMatcher matcher({any(A), any(B)}, WITHIN);
+    const auto matches = feed(matcher, {{C, 1}, {A, 2}, {C, 3}, {B, 4}});
+    ASSERT_EQ(matches.size(), 1);
+    EXPECT_EQ(matches[0].start, Timestamp(2));
+    EXPECT_EQ(matches[0].end, Timestamp(4));
+    EXPECT_EQ(matches[0].numberOfEvents, 2);
+    EXPECT_EQ(matcher.getNumberOfRuns(), 0);
+    EXPECT_EQ(matcher.getNumberOfKeys(), 0);
+}
+
+TEST_F(PatternMatcherTest, everyStartEventStartsARun)
+{
+    PatternMatcher matcher({any(A), any(B)}, WITHIN);
+    const auto matches = feed(matcher, {{A, 1}, {A, 2}, {B, 3}});
+    ASSERT_EQ(matches.size(), 2);
+    EXPECT_EQ(matches[0].start, Timestamp(1));
+    EXPECT_EQ(matches[1].start, Timestamp(2));
+}
+
+TEST_F(PatternMatcherTest, runsTimeOutAfterWithin)
+{
+    PatternMatcher matcher({any(A), any(B)}, WITHIN);
+    EXPECT_TRUE(feed(matcher, {{A, 1}, {B, 102}}).empty());
+    EXPECT_EQ(feed(matcher, {{A, 200}, {B, 300}}).size(), 1);
+}
+
+TEST_F(PatternMatcherTest, keysAreMatchedIndependently)
+{
+    PatternMatcher matcher({any(A), any(B)}, WITHIN);
+    std::vector<PatternMatcher::Match> matches;
+    matcher.advance("train1", A, Timestamp(1), matches);
+    matcher.advance("train2", B, Timestamp(2), matches);
+    EXPECT_TRUE(matches.empty());
+    matcher.advance("train1", B, Timestamp(3), matches);
+    EXPECT_EQ(matches.size(), 1);
+}
+
+TEST_F(PatternMatcherTest, disjunctionMatchesAnyEvent)
+{
+    PatternMatcher matcher({any(A), any(B | C)}, WITHIN);
+    EXPECT_EQ(feed(matcher, {{A, 1}, {C, 2}, {A, 3}, {B, 4}}).size(), 2);
+}
+
+TEST_F(PatternMatcherTest, conjunctionMatchesAllEventsInAnyOrder)
+{
+    PatternMatcher matcher({any(A), {.type = PatternMatcher::Step::Type::ALL, .events = B | C}}, WITHIN);
+    EXPECT_TRUE(feed(matcher, {{A, 1}, {C, 2}, {C, 3}}).empty());
+    const auto matches = feed(matcher, {{B, 4}});
+    ASSERT_EQ(matches.size(), 1);
+    EXPECT_EQ(matches[0].numberOfEvents, 3);
+
+    /// A single record is a single event of the conjunction
+    EXPECT_TRUE(feed(matcher, {{A, 10}, {B | C, 11}}).empty());
+    EXPECT_EQ(feed(matcher, {{B | C, 12}}).size(), 1);
+}
+
+TEST_F(PatternMatcherTest, iterationRepeatsBetweenMinimumAndMaximum)
+{
+    const PatternMatcher::Step iteration{
+        .type = PatternMatcher::Step::Type::ITERATION, .events = A, .minimumRepetitions = 2, .maximumRepetitions = std::nullopt};
+    PatternMatcher matcher({iteration, any(B)}, WITHIN);
+
+    /// The B does not continue the run, whose A does not repeat often enough yet
+    EXPECT_TRUE(feed(matcher, {{A, 1}, {B, 2}}).empty());
+
+    /// The run started by the last A does not repeat often enough
+    const auto matches = feed(matcher, {{A, 3}, {A, 4}, {B, 5}});
+    ASSERT_EQ(matches.size(), 2);
+    EXPECT_EQ(matches[0].start, Timestamp(1));
+    EXPECT_EQ(matches[0].numberOfEvents, 4);
+    EXPECT_EQ(matches[1].start, Timestamp(3));
+    EXPECT_EQ(matches[1].numberOfEvents, 3);
+}
+
+TEST_F(PatternMatcherTest, boundedIterationAtTheEndCompletesAtItsMinimum)
+{
+    const PatternMatcher::Step iteration{
+        .type = PatternMatcher::Step::Type::ITERATION, .events = B, .minimumRepetitions = 2, .maximumRepetitions = 3};
+    PatternMatcher matcher({any(A), iteration}, WITHIN);
+    const auto matches = feed(matcher, {{A, 1}, {B, 2}, {B, 3}, {B, 4}});
+    ASSERT_EQ(matches.size(), 1);
+    EXPECT_EQ(matches[0].end, Timestamp(3));
+}
+
+TEST_F(PatternMatcherTest, garbageCollectionRemovesRunsThatCannotComplete)
+{
+    PatternMatcher matcher({any(A), any(B)}, WITHIN);
+    std::vector<PatternMatcher::Match> matches;
+    matcher.advance("train1", A, Timestamp(1), matches);
+    matcher.advance("train2", A, Timestamp(50), matches);
+    EXPECT_EQ(matcher.getNumberOfRuns(), 2);
+
+    matcher.collectGarbage(Timestamp(102));
+    EXPECT_EQ(matcher.getNumberOfRuns(), 1);
+    EXPECT_EQ(matcher.getNumberOfKeys(), 1);
+    matcher.collectGarbage(Timestamp(151));
+    EXPECT_EQ(matcher.getNumberOfRuns(), 0);
+    EXPECT_EQ(matcher.getNumberOfKeys(), 0);
+}
+
+TEST_F(PatternMatcherTest, startingRunsBeyondTheLimitDropsTheOldestRuns)
+{
+    PatternMatcher matcher({any(A), any(B)}, WITHIN, 2);
+    const auto matches = feed(matcher, {{A, 1}, {A, 2}, {A, 3}, {B, 4}});
+    ASSERT_EQ(matches.size(), 2);
+    EXPECT_EQ(matches[0].start, Timestamp(2));
+    EXPECT_EQ(matcher.getNumberOfDroppedRuns(), 1);
+}
+
+}
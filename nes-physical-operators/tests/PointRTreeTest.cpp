@@ -0,0 +1,141 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Join/NestedLoopJoin/PointRTree.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+
+namespace NES
+{
+
+class PointRTreeTest : public Testing::BaseUnitTest
+{
+public:
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("PointRTreeTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup PointRTreeTest class.");
+    }
+
+    void SetUp() override { BaseUnitTest::SetUp(); }
+
+    /// Builds the tree over the entries and returns the sorted positions of the entries within the range
+    static std::vector<uint64_t> buildAndQuery(std::vector<PointRTree::Entry> entries, const PointRTree::Range& range)
+    {
+        std::vector<PointRTree::Node> nodes(PointRTree::getNumberOfNodes(entries.size()));
+        const auto numberOfNodes = PointRTree::build(entries, nodes);
+        std::vector<uint64_t> positions(entries.size());
+        const auto numberOfPositions = PointRTree::query(entries, std::span(nodes).first(numberOfNodes), range, positions);
+        positions.resize(numberOfPositions);
+        std::ranges::sort(positions);
+        return positions;
+    }
+
+    static constexpr int64_t minTime = std::numeric_limits<int64_t>::min();
+    static constexpr int64_t maxTime = std::numeric_limits<int64_t>::max();
+};
+
+TEST_F(PointRTreeTest, NumberOfNodes)
+{
+    EXPECT_EQ(PointRTree::getNumberOfNodes(0), 0);
+    EXPECT_EQ(PointRTree::getNumberOfNodes(1), 1);
+    EXPECT_EQ(PointRTree::getNumberOfNodes(16), 1);
+    /// Two leaves and the root
+    EXPECT_EQ(PointRTree::getNumberOfNodes(17), 3);
+    /// 256 leaves, 16 inner nodes, and the root
+    EXPECT_EQ(PointRTree::getNumberOfNodes(4096), 273);
+}
+
+TEST_F(PointRTreeTest, EmptyTree)
+{
+    EXPECT_TRUE(buildAndQuery({}, {.xmin = 0, .ymin = 0, .xmax = 1, .ymax = 1, .tmin = minTime, .tmax = maxTime}).empty());
+}
+
+TEST_F(PointRTreeTest, InclusiveBoundsInAllDimensions)
+{
+    const std::vector<PointRTree::Entry> entries{
+        {.x = 4.0, .y = 50.0, .t = 10, .position = 0},
+        {.x = 4.6, .y = 50.8, .t = 20, .position = 1},
+        {.x = 4.3, .y = 50.4, .t = 30, .position = 2},
+        {.x = 4.7, .y = 50.4, .t = 20, .position = 3},
+        {.x = 4.3, .y = 50.9, .t = 20, .position = 4}};
+    EXPECT_EQ(
+        buildAndQuery(entries, {.xmin = 4.0, .ymin = 50.0, .xmax = 4.6, .ymax = 50.8, .tmin = minTime, .tmax = maxTime}),
+        (std::vector<uint64_t>{0, 1, 2}));
+    EXPECT_EQ(
+        buildAndQuery(entries, {.xmin = 4.0, .ymin = 50.0, .xmax = 4.6, .ymax = 50.8, .tmin = 10, .tmax = 20}),
+        (std::vector<uint64_t>{0, 1}));
+    EXPECT_EQ(
+        buildAndQuery(entries, {.xmin = 5, .ymin = 50.0, .xmax = 6, .ymax = 50.8, .tmin = minTime, .tmax = maxTime}),
+        (std::vector<uint64_t>{}));
+}
+
+TEST_F(PointRTreeTest, LeavesOutNaNCoordinates)
+{
+    constexpr auto nan = std::numeric_limits<double>::quiet_NaN();
+    constexpr auto infinity = std::numeric_limits<double>::infinity();
+    const std::vector<PointRTree::Entry> entries{
+        {.x = nan, .y = 1, .t = 0, .position = 0}, {.x = 1, .y = 1, .t = 0, .position = 1}, {.x = 1, .y = nan, .t = 0, .position = 2}};
+    std::vector<PointRTree::Node> nodes(PointRTree::getNumberOfNodes(entries.size()));
+    auto reorderedEntries = entries;
+    EXPECT_EQ(PointRTree::build(reorderedEntries, nodes), 1);
+    const PointRTree::Range everything{
+        .xmin = -infinity, .ymin = -infinity, .xmax = infinity, .ymax = infinity, .tmin = minTime, .tmax = maxTime};
+    EXPECT_EQ(buildAndQuery(entries, everything), (std::vector<uint64_t>{1}));
+}
+
+/// Multiple levels of inner nodes return the same entries as a scan over all entries
+TEST_F(PointRTreeTest, MatchesScanOverAllEntries)
+{
+    std::mt19937_64 generator(42);
+    std::uniform_real_distribution<double> lon(-10, 10);
+    std::uniform_real_distribution<double> lat(40, 60);
+    std::uniform_int_distribution<int64_t> time(0, 1000);
+    std::vector<PointRTree::Entry> entries;
+    for (uint64_t position = 0; position < 10000; ++position)
+    {
+        entries.push_back({.x = lon(generator), .y = lat(generator), .t = time(generator), .position = position});
+    }
+
+    for (size_t query = 0; query < 100; ++query)
+    {
+        const auto x = lon(generator);
+        const auto y = lat(generator);
+        const auto t = time(generator);
+        const PointRTree::Range range{.xmin = x, .ymin = y, .xmax = x + 2, .ymax = y + 1, .tmin = t, .tmax = t + 200};
+
+        std::vector<uint64_t> expectedPositions;
+        for (const auto& entry : entries)
+        {
+            if (range.xmin <= entry.x and entry.x <= range.xmax and range.ymin <= entry.y and entry.y <= range.ymax
+                and range.tmin <= entry.t and entry.t <= range.tmax)
+            {
+                expectedPositions.push_back(entry.position);
+            }
+        }
+        EXPECT_EQ(buildAndQuery(entries, range), expectedPositions);
+    }
+}
+
+}
@@ -0,0 +1,97 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Functions/QueryParameters.hpp>
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <DataTypes/DataType.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+#include <ErrorHandling.hpp>
+
+namespace NES
+{
+
+class QueryParametersTest : public Testing::BaseUnitTest
+{
+public:
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("QueryParametersTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup QueryParametersTest class.");
+    }
+
+    void SetUp() override { BaseUnitTest::SetUp(); }
+};
+
+TEST_F(QueryParametersTest, startsWithTheDefaultValue)
+{
+    const QueryParameter threshold("threshold", DataType::Type::INT32, "-42");
+    EXPECT_EQ(threshold.get<int32_t>(), -42);
+    const QueryParameter factor("factor", DataType::Type::FLOAT64, "0.5");
+    EXPECT_DOUBLE_EQ(factor.get<double>(), 0.5);
+    EXPECT_ANY_THROW(QueryParameter("invalid", DataType::Type::UINT8, "abc"));
+    EXPECT_ANY_THROW(QueryParameter("text", DataType::Type::VARSIZED, "abc"));
+}
+
+TEST_F(QueryParametersTest, sharesParametersOfTheSameName)
+{
+    QueryParameters parameters;
+    const auto first = parameters.getOrCreate("threshold", DataType::Type::UINT64, "10");
+    const auto second = parameters.getOrCreate("threshold", DataType::Type::UINT64, "20");
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(second->get<uint64_t>(), 10);
+    EXPECT_ANY_THROW(parameters.getOrCreate("threshold", DataType::Type::INT8, "10"));
+}
+
+TEST_F(QueryParametersTest, appliesAllOrNoneOfTheUpdates)
+{
+    QueryParameters parameters;
+    EXPECT_TRUE(parameters.empty());
+    const auto threshold = parameters.getOrCreate("threshold", DataType::Type::INT64, "10");
+    const auto enabled = parameters.getOrCreate("enabled", DataType::Type::BOOLEAN, "true");
+    EXPECT_FALSE(parameters.empty());
+
+    parameters.update({{"threshold", "30"}, {"enabled", "false"}});
+    EXPECT_EQ(threshold->get<int64_t>(), 30);
+    EXPECT_FALSE(enabled->get<bool>());
+
+    EXPECT_ANY_THROW(parameters.update({{"threshold", "40"}, {"enabled", "maybe"}}));
+    EXPECT_ANY_THROW(parameters.update({{"threshold", "40"}, {"unknown", "1"}}));
+    EXPECT_EQ(threshold->get<int64_t>(), 30);
+}
+
+TEST_F(QueryParametersTest, scopeCollectsTheParametersOfTheLowering)
+{
+    EXPECT_EQ(QueryParameters::current(), nullptr);
+    QueryParameters outer;
+    {
+        const QueryParameters::Scope outerScope(outer);
+        EXPECT_EQ(QueryParameters::current(), &outer);
+        QueryParameters inner;
+        {
+            const QueryParameters::Scope innerScope(inner);
+            EXPECT_EQ(QueryParameters::current(), &inner);
+        }
+        EXPECT_EQ(QueryParameters::current(), &outer);
+    }
+    EXPECT_EQ(QueryParameters::current(), nullptr);
+}
+
+}
@@ -0,0 +1,144 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <random>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
+#include <SliceStore/DefaultTimeBasedSliceStore.hpp>
+#include <SliceStore/RingBufferTimeBasedSliceStore.hpp>
+#include <SliceStore/Slice.hpp>
+#include <SliceStore/WindowSlicesStoreInterface.hpp>
+#include <Time/Timestamp.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+
+namespace NES
+{
+
+class RingBufferTimeBasedSliceStoreTest : public Testing::BaseUnitTest
+{
+public:
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("RingBufferTimeBasedSliceStoreTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup RingBufferTimeBasedSliceStoreTest class.");
+    }
+
+    void SetUp() override { BaseUnitTest::SetUp(); }
+
+    static std::vector<std::shared_ptr<Slice>> createSlice(const SliceStart sliceStart, const SliceEnd sliceEnd)
+    {
+        return {std::make_shared<Slice>(sliceStart, sliceEnd)};
+    }
+
+    /// Maps the window end and sequence number of each emitted window to the sorted slice ends of the window
+    static std::map<std::pair<uint64_t, uint64_t>, std::vector<uint64_t>>
+    toSliceEnds(const std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>>& windowsToSlices)
+    {
+        std::map<std::pair<uint64_t, uint64_t>, std::vector<uint64_t>> sliceEnds;
+        for (const auto& [windowInfoAndSequenceNumber, slices] : windowsToSlices)
+        {
+            auto& windowSliceEnds = sliceEnds[{
+                windowInfoAndSequenceNumber.windowInfo.windowEnd.getRawValue(), windowInfoAndSequenceNumber.sequenceNumber.getRawValue()}];
+            for (const auto& slice : slices)
+            {
+                windowSliceEnds.emplace_back(slice->getSliceEnd().getRawValue());
+            }
+            std::ranges::sort(windowSliceEnds);
+        }
+        return sliceEnds;
+    }
+};
+
+TEST_F(RingBufferTimeBasedSliceStoreTest, emitsSameWindowsAsDefaultSliceStore)
+{
+    /// The window size is no multiple of the slide, so that each slide consists of two slices
+    constexpr uint64_t windowSize = 100;
+    constexpr uint64_t windowSlide = 30;
+    constexpr uint64_t maxTimestamp = 2000;
+    const auto defaultSliceStore = WindowSlicesStoreInterface::create(SliceStoreType::DEFAULT, windowSize, windowSlide);
+    const auto ringBufferSliceStore = WindowSlicesStoreInterface::create(SliceStoreType::RING_BUFFER, windowSize, windowSlide);
+    defaultSliceStore->incrementNumberOfInputPipelines();
+    ringBufferSliceStore->incrementNumberOfInputPipelines();
+
+    std::mt19937_64 randomGenerator(42);
+    std::uniform_int_distribution<uint64_t> timestamps(0, maxTimestamp);
+    for (uint64_t i = 0; i < 1000; ++i)
+    {
+        const auto timestamp = Timestamp(timestamps(randomGenerator));
+        const auto expectedSlices = defaultSliceStore->getSlicesOrCreate(timestamp, createSlice);
+        const auto actualSlices = ringBufferSliceStore->getSlicesOrCreate(timestamp, createSlice);
+        ASSERT_EQ(actualSlices.size(), 1);
+        EXPECT_EQ(actualSlices[0]->getSliceStart(), expectedSlices[0]->getSliceStart());
+        EXPECT_EQ(actualSlices[0]->getSliceEnd(), expectedSlices[0]->getSliceEnd());
+
+        /// Looking up the slice again must return the same slice
+        EXPECT_EQ(ringBufferSliceStore->getSlicesOrCreate(timestamp, createSlice)[0], actualSlices[0]);
+        EXPECT_EQ(ringBufferSliceStore->getSliceBySliceEnd(actualSlices[0]->getSliceEnd()), actualSlices[0]);
+    }
+
+    const auto globalWatermark = Timestamp(maxTimestamp / 2);
+    const auto expectedTriggeredWindows = toSliceEnds(defaultSliceStore->getTriggerableWindowSlices(globalWatermark));
+    EXPECT_FALSE(expectedTriggeredWindows.empty());
+    EXPECT_EQ(toSliceEnds(ringBufferSliceStore->getTriggerableWindowSlices(globalWatermark)), expectedTriggeredWindows);
+
+    /// Windows must never be emitted twice
+    EXPECT_TRUE(ringBufferSliceStore->getTriggerableWindowSlices(globalWatermark).empty());
+
+    const auto expectedRemainingWindows = toSliceEnds(defaultSliceStore->getAllNonTriggeredSlices());
+    EXPECT_FALSE(expectedRemainingWindows.empty());
+    EXPECT_EQ(toSliceEnds(ringBufferSliceStore->getAllNonTriggeredSlices()), expectedRemainingWindows);
+
+    ringBufferSliceStore->garbageCollectSlicesAndWindows(globalWatermark);
+    EXPECT_FALSE(ringBufferSliceStore->getSliceBySliceEnd(SliceEnd(windowSlide)).has_value());
+    const auto aliveSlice = ringBufferSliceStore->getSlicesOrCreate(globalWatermark, createSlice)[0];
+    EXPECT_EQ(ringBufferSliceStore->getSliceBySliceEnd(aliveSlice->getSliceEnd()), aliveSlice);
+}
+
+TEST_F(RingBufferTimeBasedSliceStoreTest, storesSlicesOfOccupiedSlotsInOverflowMap)
+{
+    RingBufferTimeBasedSliceStore sliceStore(1, 1);
+    const auto numberOfSlots = sliceStore.getNumberOfSlots();
+    ASSERT_EQ(numberOfSlots, RingBufferTimeBasedSliceStore::MIN_NUMBER_OF_SLOTS);
+
+    /// Both slices share the same slot
+    const auto firstSlice = sliceStore.getSlicesOrCreate(Timestamp(5), createSlice)[0];
+    const auto secondSlice = sliceStore.getSlicesOrCreate(Timestamp(5 + numberOfSlots), createSlice)[0];
+    EXPECT_NE(firstSlice, secondSlice);
+    EXPECT_EQ(sliceStore.getSlicesOrCreate(Timestamp(5), createSlice)[0], firstSlice);
+    EXPECT_EQ(sliceStore.getSlicesOrCreate(Timestamp(5 + numberOfSlots), createSlice)[0], secondSlice);
+    EXPECT_EQ(sliceStore.getSliceBySliceEnd(firstSlice->getSliceEnd()), firstSlice);
+    EXPECT_EQ(sliceStore.getSliceBySliceEnd(secondSlice->getSliceEnd()), secondSlice);
+
+    /// Deleting the first slice moves the second slice from the overflow map into the slot
+    sliceStore.garbageCollectSlicesAndWindows(firstSlice->getSliceEnd() + 2);
+    EXPECT_FALSE(sliceStore.getSliceBySliceEnd(firstSlice->getSliceEnd()).has_value());
+    EXPECT_EQ(sliceStore.getSliceBySliceEnd(secondSlice->getSliceEnd()), secondSlice);
+    EXPECT_EQ(sliceStore.getSlicesOrCreate(Timestamp(5 + numberOfSlots), createSlice)[0], secondSlice);
+
+    sliceStore.incrementNumberOfInputPipelines();
+    const auto remainingWindows = sliceStore.getAllNonTriggeredSlices();
+    ASSERT_EQ(remainingWindows.size(), 1);
+    EXPECT_EQ(remainingWindows.begin()->second, std::vector{secondSlice});
+}
+
+}
@@ -0,0 +1,86 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstddef>
+#include <thread>
+#include <vector>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+#include <SelectivityProfile.hpp>
+
+namespace NES
+{
+
+class SelectivityProfileTest : public Testing::BaseUnitTest
+{
+public:
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("SelectivityProfileTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup SelectivityProfileTest class.");
+    }
+
+    void SetUp() override { BaseUnitTest::SetUp(); }
+};
+
+TEST_F(SelectivityProfileTest, keepsQueryOrderWithoutProfile)
+{
+    const SelectivityProfile profile(3);
+    EXPECT_EQ(profile.getPassRate(1), 1);
+    EXPECT_EQ(profile.getEvaluationOrder(), (std::vector<size_t>{0, 1, 2}));
+}
+
+TEST_F(SelectivityProfileTest, ordersConjunctsByAscendingPassRate)
+{
+    SelectivityProfile profile(3);
+    for (size_t record = 0; record < 100; ++record)
+    {
+        profile.record(0, true);
+        profile.record(1, record % 10 == 0);
+        profile.record(2, record % 2 == 0);
+    }
+    EXPECT_EQ(profile.getNumberOfEvaluations(1), 100);
+    EXPECT_DOUBLE_EQ(profile.getPassRate(1), 0.1);
+    EXPECT_EQ(profile.getEvaluationOrder(), (std::vector<size_t>{1, 2, 0}));
+}
+
+TEST_F(SelectivityProfileTest, recordsConcurrently)
+{
+    constexpr size_t numberOfThreads = 4;
+    constexpr size_t numberOfRecords = 10000;
+    SelectivityProfile profile(2);
+    {
+        std::vector<std::jthread> threads;
+        for (size_t thread = 0; thread < numberOfThreads; ++thread)
+        {
+            threads.emplace_back(
+                [&profile]
+                {
+                    for (size_t record = 0; record < numberOfRecords; ++record)
+                    {
+                        profile.record(0, false);
+                        profile.record(1, true);
+                    }
+                });
+        }
+    }
+    EXPECT_EQ(profile.getNumberOfEvaluations(0), numberOfThreads * numberOfRecords);
+    EXPECT_EQ(profile.getPassRate(1), 1);
+    EXPECT_EQ(profile.getEvaluationOrder(), (std::vector<size_t>{0, 1}));
+}
+
+}
@@ -0,0 +1,125 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
+#include <SliceStore/SessionSliceStore.hpp>
+#include <SliceStore/Slice.hpp>
+#include <SliceStore/WindowSlicesStoreInterface.hpp>
+#include <Time/Timestamp.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+
+namespace NES
+{
+
+class SessionSliceStoreTest : public Testing::BaseUnitTest
+{
+public:
+    static constexpr uint64_t GAP = 10;
+
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("SessionSliceStoreTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup SessionSliceStoreTest class.");
+    }
+
+    void SetUp() override { BaseUnitTest::SetUp(); }
+
+    static std::vector<std::shared_ptr<Slice>> createSlice(const SliceStart sliceStart, const SliceEnd sliceEnd)
+    {
+        return {std::make_shared<Slice>(sliceStart, sliceEnd)};
+    }
+
+    /// Maps the start and end of each emitted session to the slice ends of the session
+    static std::map<std::pair<uint64_t, uint64_t>, std::vector<uint64_t>>
+    toSessions(const std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>>& sessionsToSlices)
+    {
+        std::map<std::pair<uint64_t, uint64_t>, std::vector<uint64_t>> sessions;
+        for (const auto& [windowInfoAndSequenceNumber, slices] : sessionsToSlices)
+        {
+            auto& sliceEnds = sessions[{
+                windowInfoAndSequenceNumber.windowInfo.windowStart.getRawValue(), windowInfoAndSequenceNumber.windowInfo.windowEnd.getRawValue()}];
+            for (const auto& slice : slices)
+            {
+                sliceEnds.emplace_back(slice->getSliceEnd().getRawValue());
+            }
+        }
+        return sessions;
+    }
+};
+
+TEST_F(SessionSliceStoreTest, mergesSlicesIntoSessions)
+{
+    SessionSliceStore sliceStore(GAP);
+    sliceStore.incrementNumberOfInputPipelines();
+    for (const uint64_t timestamp : {1, 5, 25, 14})
+    {
+        const auto slices = sliceStore.getSlicesOrCreate(Timestamp(timestamp), createSlice);
+        ASSERT_EQ(slices.size(), 1);
+        EXPECT_EQ(slices[0]->getSliceEnd(), SliceEnd(timestamp - (timestamp % GAP) + GAP));
+    }
+
+    /// The record at 14 merges the sessions of the records at 1 and 5 and of the record at 14, as it is less than the gap apart from 5
+    EXPECT_TRUE(sliceStore.getTriggerableWindowSlices(Timestamp(24)).empty());
+    using SessionsAndSliceEnds = std::map<std::pair<uint64_t, uint64_t>, std::vector<uint64_t>>;
+    EXPECT_EQ(toSessions(sliceStore.getTriggerableWindowSlices(Timestamp(25))), (SessionsAndSliceEnds{{{1, 24}, {10, 20}}}));
+    EXPECT_TRUE(sliceStore.getTriggerableWindowSlices(Timestamp(25)).empty());
+
+    /// The record at 33 extends the session of the record at 25 into the next slice
+    sliceStore.getSlicesOrCreate(Timestamp(33), createSlice);
+    EXPECT_TRUE(sliceStore.getTriggerableWindowSlices(Timestamp(35)).empty());
+    EXPECT_EQ(toSessions(sliceStore.getAllNonTriggeredSlices()), (SessionsAndSliceEnds{{{25, 43}, {30, 40}}}));
+}
+
+TEST_F(SessionSliceStoreTest, cachesRangeOfTimestampsThatDoNotChangeTheSlice)
+{
+    SessionSliceStore sliceStore(GAP);
+    EXPECT_EQ(sliceStore.getSliceStartTs(Timestamp(3)), SliceStart(3));
+    EXPECT_EQ(sliceStore.getSliceEndTs(Timestamp(3)), SliceEnd(4));
+
+    sliceStore.getSlicesOrCreate(Timestamp(3), createSlice);
+    sliceStore.getSlicesOrCreate(Timestamp(6), createSlice);
+    EXPECT_EQ(sliceStore.getSliceStartTs(Timestamp(4)), SliceStart(3));
+    EXPECT_EQ(sliceStore.getSliceEndTs(Timestamp(4)), SliceEnd(7));
+    EXPECT_EQ(sliceStore.getSliceStartTs(Timestamp(1)), SliceStart(1));
+    EXPECT_EQ(sliceStore.getSliceEndTs(Timestamp(8)), SliceEnd(9));
+}
+
+TEST_F(SessionSliceStoreTest, deletesSlicesOfEmittedSessions)
+{
+    SessionSliceStore sliceStore(GAP);
+    const auto firstSlice = sliceStore.getSlicesOrCreate(Timestamp(2), createSlice)[0];
+    const auto secondSlice = sliceStore.getSlicesOrCreate(Timestamp(40), createSlice)[0];
+
+    /// The slice of a session, which has not been emitted, must stay alive
+    sliceStore.garbageCollectSlicesAndWindows(Timestamp(100));
+    EXPECT_EQ(sliceStore.getSliceBySliceEnd(firstSlice->getSliceEnd()), firstSlice);
+
+    EXPECT_EQ(sliceStore.getTriggerableWindowSlices(Timestamp(13)).size(), 1);
+    sliceStore.garbageCollectSlicesAndWindows(Timestamp(12));
+    EXPECT_EQ(sliceStore.getSliceBySliceEnd(firstSlice->getSliceEnd()), firstSlice);
+    sliceStore.garbageCollectSlicesAndWindows(Timestamp(13));
+    EXPECT_FALSE(sliceStore.getSliceBySliceEnd(firstSlice->getSliceEnd()).has_value());
+    EXPECT_EQ(sliceStore.getSliceBySliceEnd(secondSlice->getSliceEnd()), secondSlice);
+}
+
+}
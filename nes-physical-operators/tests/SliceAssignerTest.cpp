@@ -341,5 +341,27 @@ TEST_F(SliceAssignerTest, getSliceNonDividerSize10Slide7)
     runValidation(slicesForTimestamps, windows, sliceAssigner);
 }
 
+TEST_F(SliceAssignerTest, getSliceEarlyFiringSize10Slide5Interval3)
+{
+    /// Creating a slice store with a particular size and slide that additionally cuts the slices at multiples of the early firing interval
+    constexpr auto windowSize = 10;
+    constexpr auto windowSlide = 5;
+    constexpr auto earlyFiringInterval = 3;
+    const SliceAssigner sliceAssigner(windowSize, windowSlide, earlyFiringInterval);
+
+    /// Creating the expected slices for the given timestamps as well as the windows for each slice.
+    const std::vector<SlicesForTimestamp> slicesForTimestamps = {
+        {Timestamp(0), Timestamp(3), Timestamp(1)},
+        {Timestamp(3), Timestamp(5), Timestamp(4)},
+        {Timestamp(5), Timestamp(6), Timestamp(5)},
+        {Timestamp(6), Timestamp(9), Timestamp(7)},
+        {Timestamp(9), Timestamp(10), Timestamp(9)},
+        {Timestamp(10), Timestamp(12), Timestamp(11)},
+    };
+    const std::vector<std::vector<WindowInfo>> windows
+        = {{{0, 10}}, {{0, 10}}, {{0, 10}, {5, 15}}, {{0, 10}, {5, 15}}, {{0, 10}, {5, 15}}, {{5, 15}, {10, 20}}};
+    runValidation(slicesForTimestamps, windows, sliceAssigner);
+}
+
 
 }
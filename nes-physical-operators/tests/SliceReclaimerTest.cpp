@@ -0,0 +1,124 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <SliceStore/SliceReclaimer.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
+#include <SliceStore/Slice.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+
+namespace NES
+{
+
+class SliceReclaimerTest : public Testing::BaseUnitTest
+{
+public:
+    /// Records the thread that destroys the slice
+    class RecordingSlice final : public Slice
+    {
+    public:
+        RecordingSlice(const uint64_t sliceEnd, std::atomic<uint64_t>& numberOfDestroyedSlices, std::atomic<bool>& destroyedOnOtherThread)
+            : Slice(SliceStart(sliceEnd - 1), SliceEnd(sliceEnd))
+            , numberOfDestroyedSlices(numberOfDestroyedSlices)
+            , destroyedOnOtherThread(destroyedOnOtherThread)
+            , creatingThread(std::this_thread::get_id())
+        {
+        }
+
+        ~RecordingSlice() override
+        {
+            if (std::this_thread::get_id() != creatingThread)
+            {
+                destroyedOnOtherThread = true;
+            }
+            ++numberOfDestroyedSlices;
+        }
+
+    private:
+        std::atomic<uint64_t>& numberOfDestroyedSlices;
+        std::atomic<bool>& destroyedOnOtherThread;
+        std::thread::id creatingThread;
+    };
+
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("SliceReclaimerTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup SliceReclaimerTest class.");
+    }
+
+    void SetUp() override { BaseUnitTest::SetUp(); }
+
+    std::vector<std::shared_ptr<Slice>> createSlices(const uint64_t numberOfSlices)
+    {
+        std::vector<std::shared_ptr<Slice>> slices;
+        for (uint64_t sliceEnd = 1; sliceEnd <= numberOfSlices; ++sliceEnd)
+        {
+            slices.emplace_back(std::make_shared<RecordingSlice>(sliceEnd, numberOfDestroyedSlices, destroyedOnOtherThread));
+        }
+        return slices;
+    }
+
+    std::atomic<uint64_t> numberOfDestroyedSlices{0};
+    std::atomic<bool> destroyedOnOtherThread{false};
+};
+
+TEST_F(SliceReclaimerTest, destroysTheSlicesOnTheReclaimerThread)
+{
+    SliceReclaimer reclaimer;
+    constexpr uint64_t NUMBER_OF_SLICES = 100;
+    reclaimer.reclaim(createSlices(NUMBER_OF_SLICES));
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (numberOfDestroyedSlices < NUMBER_OF_SLICES and std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(numberOfDestroyedSlices, NUMBER_OF_SLICES);
+    EXPECT_EQ(reclaimer.getNumberOfPendingSlices(), 0);
+    EXPECT_TRUE(destroyedOnOtherThread);
+}
+
+TEST_F(SliceReclaimerTest, keepsSlicesAliveThatAreStillReferenced)
+{
+    auto slices = createSlices(2);
+    const auto referencedSlice = slices.front();
+    {
+        SliceReclaimer reclaimer;
+        reclaimer.reclaim(std::move(slices));
+    }
+    EXPECT_EQ(numberOfDestroyedSlices, 1);
+    EXPECT_EQ(referencedSlice.use_count(), 1);
+}
+
+TEST_F(SliceReclaimerTest, drainDestroysAllPendingSlices)
+{
+    constexpr uint64_t NUMBER_OF_SLICES = 1000;
+    SliceReclaimer reclaimer;
+    reclaimer.reclaim(createSlices(NUMBER_OF_SLICES));
+    reclaimer.drain();
+    EXPECT_EQ(reclaimer.getNumberOfPendingSlices(), 0);
+    EXPECT_EQ(numberOfDestroyedSlices, NUMBER_OF_SLICES);
+}
+
+}
@@ -0,0 +1,131 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Aggregation/Function/TrajectorySimplifier.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+
+namespace NES
+{
+
+class TrajectorySimplifierTest : public Testing::BaseUnitTest
+{
+public:
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("TrajectorySimplifierTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup TrajectorySimplifierTest class.");
+    }
+
+    void SetUp() override { BaseUnitTest::SetUp(); }
+
+    /// Returns the timestamps of the kept points, including the last dropped point that ends the trajectory
+    static std::vector<uint64_t> simplify(TrajectorySimplifier& simplifier, const std::vector<TrajectorySimplifier::Point>& points)
+    {
+        std::vector<uint64_t> keptTimestamps;
+        TrajectorySimplifier::KeptPoints keptPoints{};
+        for (const auto& point : points)
+        {
+            const auto numberOfKeptPoints = simplifier.insert(point, keptPoints);
+            for (size_t index = 0; index < numberOfKeptPoints; ++index)
+            {
+                keptTimestamps.push_back(keptPoints[index].timestamp);
+            }
+        }
+        if (const auto lastPoint = simplifier.flush())
+        {
+            keptTimestamps.push_back(lastPoint->timestamp);
+        }
+        return keptTimestamps;
+    }
+
+    /// About 11 meters per step in longitude at the equator
+    static constexpr double STEP = 0.0001;
+};
+
+TEST_F(TrajectorySimplifierTest, stationaryObjectKeepsItsFirstAndLastPoint)
+{
+    TrajectorySimplifier simplifier(5);
+    std::vector<TrajectorySimplifier::Point> points;
+    for (uint64_t timestamp = 0; timestamp < 10; ++timestamp)
+    {
+        points.push_back({.lon = 4.35, .lat = 50.85, .timestamp = timestamp * 1000});
+    }
+    EXPECT_EQ(simplify(simplifier, points), (std::vector<uint64_t>{0, 9000}));
+    EXPECT_EQ(simplifier.getNumberOfDroppedPoints(), 8);
+}
+
+TEST_F(TrajectorySimplifierTest, constantSpeedKeepsTheEndsOfTheSegment)
+{
+    TrajectorySimplifier simplifier(5);
+    std::vector<TrajectorySimplifier::Point> points;
+    for (uint64_t step = 0; step < 100; ++step)
+    {
+        points.push_back({.lon = static_cast<double>(step) * STEP, .lat = 0, .timestamp = step * 1000});
+    }
+    /// The second point establishes the velocity, all further points follow the prediction
+    EXPECT_EQ(simplify(simplifier, points), (std::vector<uint64_t>{0, 1000, 99000}));
+    EXPECT_EQ(simplifier.getNumberOfDroppedPoints(), 97);
+}
+
+TEST_F(TrajectorySimplifierTest, turnStartsANewSegment)
+{
+    TrajectorySimplifier simplifier(5);
+    std::vector<TrajectorySimplifier::Point> points;
+    for (uint64_t step = 0; step < 10; ++step)
+    {
+        points.push_back({.lon = static_cast<double>(step) * STEP, .lat = 0, .timestamp = step * 1000});
+    }
+    for (uint64_t step = 1; step < 10; ++step)
+    {
+        points.push_back({.lon = 9 * STEP, .lat = static_cast<double>(step) * STEP, .timestamp = (9 + step) * 1000});
+    }
+    /// The turn keeps the corner at 9000 and the first point after the corner, which establishes the new velocity
+    EXPECT_EQ(simplify(simplifier, points), (std::vector<uint64_t>{0, 1000, 9000, 10000, 18000}));
+}
+
+TEST_F(TrajectorySimplifierTest, zeroToleranceKeepsDeviatingPoints)
+{
+    TrajectorySimplifier simplifier(0);
+    const std::vector<TrajectorySimplifier::Point> points{
+        {.lon = 0, .lat = 0, .timestamp = 0},
+        {.lon = STEP, .lat = 0, .timestamp = 1000},
+        {.lon = 3 * STEP, .lat = 0, .timestamp = 2000},
+        {.lon = 3 * STEP, .lat = STEP, .timestamp = 3000}};
+    EXPECT_EQ(simplify(simplifier, points), (std::vector<uint64_t>{0, 1000, 2000, 3000}));
+    EXPECT_EQ(simplifier.getNumberOfDroppedPoints(), 0);
+}
+
+TEST_F(TrajectorySimplifierTest, distanceIsCloseToTheHaversineDistance)
+{
+    /// One millidegree of latitude is about 111 meters
+    EXPECT_NEAR(
+        TrajectorySimplifier::distanceInMeters({.lon = 4.35, .lat = 50.85, .timestamp = 0}, {.lon = 4.35, .lat = 50.851, .timestamp = 0}),
+        111.2,
+        0.1);
+    /// At a latitude of 60 degrees, a degree of longitude is half as long as at the equator
+    EXPECT_NEAR(
+        TrajectorySimplifier::distanceInMeters({.lon = 0, .lat = 60, .timestamp = 0}, {.lon = 0.002, .lat = 60, .timestamp = 0}),
+        111.2,
+        0.1);
+}
+
+}
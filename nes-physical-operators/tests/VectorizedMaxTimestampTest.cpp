@@ -0,0 +1,129 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Watermark/VectorizedMaxTimestamp.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/Schema.hpp>
+#include <MemoryLayout/ColumnLayout.hpp>
+#include <MemoryLayout/MemoryLayout.hpp>
+#include <MemoryLayout/RowLayout.hpp>
+#include <Time/Timestamp.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+
+/// NOLINTBEGIN(readability-magic-numbers)
+namespace NES
+{
+
+class VectorizedMaxTimestampTest : public Testing::BaseUnitTest
+{
+public:
+    static constexpr uint64_t NUMBER_OF_TUPLES = 1000;
+
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("VectorizedMaxTimestampTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup VectorizedMaxTimestampTest class.");
+    }
+
+    void SetUp() override { BaseUnitTest::SetUp(); }
+
+    Schema schema = Schema{Schema::MemoryLayoutType::ROW_LAYOUT}
+                        .addField("id", DataType::Type::UINT8)
+                        .addField("ts", DataType::Type::UINT32)
+                        .addField("value", DataType::Type::FLOAT64);
+
+    /// Out-of-order timestamps, whose maximum is at tuple 617
+    static uint32_t timestampOf(const uint64_t tupleIdx) { return tupleIdx == 617 ? 5000 : static_cast<uint32_t>((tupleIdx * 37) % 1000); }
+
+    std::vector<std::shared_ptr<MemoryLayout>> createLayouts() const
+    {
+        const auto bufferSize = NUMBER_OF_TUPLES * schema.getSizeOfSchemaInBytes();
+        return {RowLayout::create(bufferSize, schema), ColumnLayout::create(bufferSize, schema)};
+    }
+
+    static std::vector<int8_t> createBuffer(const MemoryLayout& layout)
+    {
+        std::vector<int8_t> buffer(layout.getBufferSize());
+        for (uint64_t tupleIdx = 0; tupleIdx < NUMBER_OF_TUPLES; ++tupleIdx)
+        {
+            const auto timestamp = timestampOf(tupleIdx);
+            std::memcpy(buffer.data() + layout.getFieldOffset(tupleIdx, 1), &timestamp, sizeof(timestamp));
+        }
+        return buffer;
+    }
+};
+
+TEST_F(VectorizedMaxTimestampTest, maxOfAllTuples)
+{
+    for (const auto& layout : createLayouts())
+    {
+        const auto buffer = createBuffer(*layout);
+        const auto maxTimestamp = VectorizedMaxTimestamp::create("ts", 1, *layout);
+        ASSERT_TRUE(maxTimestamp.has_value());
+        EXPECT_EQ(maxTimestamp->evaluate(buffer.data(), NUMBER_OF_TUPLES), 5000);
+        EXPECT_EQ(maxTimestamp->evaluate(buffer.data(), 617), 999);
+        EXPECT_EQ(maxTimestamp->evaluate(buffer.data(), 0), Timestamp::INITIAL_VALUE);
+    }
+}
+
+TEST_F(VectorizedMaxTimestampTest, maxOfSelectedTuples)
+{
+    const std::vector<uint64_t> selection{3, 10, 42, 999};
+    uint64_t expectedMax = 0;
+    for (const auto tupleIdx : selection)
+    {
+        expectedMax = std::max<uint64_t>(expectedMax, timestampOf(tupleIdx));
+    }
+
+    for (const auto& layout : createLayouts())
+    {
+        const auto buffer = createBuffer(*layout);
+        const auto maxTimestamp = VectorizedMaxTimestamp::create("ts", 1, *layout);
+        ASSERT_TRUE(maxTimestamp.has_value());
+        EXPECT_EQ(maxTimestamp->evaluate(buffer.data(), selection.data(), selection.size()), expectedMax);
+    }
+}
+
+TEST_F(VectorizedMaxTimestampTest, convertsToMilliseconds)
+{
+    for (const auto& layout : createLayouts())
+    {
+        const auto buffer = createBuffer(*layout);
+        const auto maxTimestamp = VectorizedMaxTimestamp::create("ts", 1000, *layout);
+        ASSERT_TRUE(maxTimestamp.has_value());
+        EXPECT_EQ(maxTimestamp->evaluate(buffer.data(), NUMBER_OF_TUPLES), 5000 * 1000);
+    }
+}
+
+TEST_F(VectorizedMaxTimestampTest, rejectsFieldsThatAreNoIntegerTimestamps)
+{
+    for (const auto& layout : createLayouts())
+    {
+        EXPECT_FALSE(VectorizedMaxTimestamp::create("value", 1, *layout).has_value());
+        EXPECT_FALSE(VectorizedMaxTimestamp::create("unknown", 1, *layout).has_value());
+    }
+}
+
+}
+/// NOLINTEND(readability-magic-numbers)
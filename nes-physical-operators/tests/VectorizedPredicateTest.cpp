@@ -0,0 +1,228 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/DataTypeProvider.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Functions/BooleanFunctions/AndLogicalFunction.hpp>
+#include <Functions/BooleanFunctions/EqualsLogicalFunction.hpp>
+#include <Functions/BooleanFunctions/NegateLogicalFunction.hpp>
+#include <Functions/BooleanFunctions/OrLogicalFunction.hpp>
+#include <Functions/ComparisonFunctions/GreaterLogicalFunction.hpp>
+#include <Functions/ComparisonFunctions/LessEqualsLogicalFunction.hpp>
+#include <Functions/ComparisonFunctions/LessLogicalFunction.hpp>
+#include <Functions/ConstantValueLogicalFunction.hpp>
+#include <Functions/FieldAccessLogicalFunction.hpp>
+#include <Functions/LogicalFunction.hpp>
+#include <Functions/VectorizedPredicate.hpp>
+#include <MemoryLayout/ColumnLayout.hpp>
+#include <MemoryLayout/MemoryLayout.hpp>
+#include <MemoryLayout/RowLayout.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+
+/// NOLINTBEGIN(readability-magic-numbers)
+namespace NES
+{
+
+class VectorizedPredicateTest : public Testing::BaseUnitTest
+{
+public:
+    /// Spans multiple chunks, to check that the predicate evaluates all chunks
+    static constexpr uint64_t NUMBER_OF_TUPLES = (2 * VectorizedPredicate::CHUNK_SIZE) + 17;
+
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("VectorizedPredicateTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup VectorizedPredicateTest class.");
+    }
+
+    void SetUp() override { BaseUnitTest::SetUp(); }
+
+    Schema schema = Schema{Schema::MemoryLayoutType::ROW_LAYOUT}
+                        .addField("speed", DataType::Type::INT32)
+                        .addField("id", DataType::Type::UINT64)
+                        .addField("ratio", DataType::Type::FLOAT64);
+
+    static int32_t speedOf(const uint64_t tupleIdx) { return static_cast<int32_t>(tupleIdx % 100) - 20; }
+    static uint64_t idOf(const uint64_t tupleIdx) { return tupleIdx % 7; }
+    static double ratioOf(const uint64_t tupleIdx) { return static_cast<double>(tupleIdx % 10) / 10.0; }
+
+    template <typename T>
+    static void writeField(std::vector<int8_t>& buffer, const MemoryLayout& layout, const uint64_t tupleIdx, const uint64_t fieldIdx, T value)
+    {
+        std::memcpy(buffer.data() + layout.getFieldOffset(tupleIdx, fieldIdx), &value, sizeof(T));
+    }
+
+    std::vector<int8_t> createBuffer(const MemoryLayout& layout) const
+    {
+        std::vector<int8_t> buffer(layout.getBufferSize());
+        for (uint64_t tupleIdx = 0; tupleIdx < NUMBER_OF_TUPLES; ++tupleIdx)
+        {
+            writeField(buffer, layout, tupleIdx, 0, speedOf(tupleIdx));
+            writeField(buffer, layout, tupleIdx, 1, idOf(tupleIdx));
+            writeField(buffer, layout, tupleIdx, 2, ratioOf(tupleIdx));
+        }
+        return buffer;
+    }
+
+    static LogicalFunction field(const DataType::Type type, const std::string& name)
+    {
+        return FieldAccessLogicalFunction(DataTypeProvider::provideDataType(type), name);
+    }
+
+    static LogicalFunction constant(const DataType::Type type, const std::string& value)
+    {
+        return ConstantValueLogicalFunction(DataTypeProvider::provideDataType(type), value);
+    }
+
+    /// Evaluates the predicate via the row and the column layout and compares the selected tuples with the expected ones
+    void runTest(const LogicalFunction& predicate, const std::function<bool(uint64_t)>& expectedPredicate) const
+    {
+        const auto vectorizedPredicate = VectorizedPredicate::create(predicate);
+        ASSERT_TRUE(vectorizedPredicate.has_value());
+
+        std::vector<uint64_t> expectedSelection;
+        for (uint64_t tupleIdx = 0; tupleIdx < NUMBER_OF_TUPLES; ++tupleIdx)
+        {
+            if (expectedPredicate(tupleIdx))
+            {
+                expectedSelection.emplace_back(tupleIdx);
+            }
+        }
+
+        const auto bufferSize = NUMBER_OF_TUPLES * schema.getSizeOfSchemaInBytes();
+        const std::vector<std::shared_ptr<MemoryLayout>> layouts{RowLayout::create(bufferSize, schema), ColumnLayout::create(bufferSize, schema)};
+        for (const auto& layout : layouts)
+        {
+            const auto buffer = createBuffer(*layout);
+            const auto boundPredicate = vectorizedPredicate->bind(*layout);
+            ASSERT_TRUE(boundPredicate.has_value());
+
+            std::vector<uint64_t> selection(NUMBER_OF_TUPLES);
+            const auto numberOfSelectedTuples = boundPredicate->evaluate(buffer.data(), NUMBER_OF_TUPLES, selection.data());
+            selection.resize(numberOfSelectedTuples);
+            EXPECT_EQ(selection, expectedSelection);
+        }
+    }
+};
+
+TEST_F(VectorizedPredicateTest, singleComparison)
+{
+    using enum DataType::Type;
+    runTest(GreaterLogicalFunction(field(INT32, "speed"), constant(INT32, "50")), [](const uint64_t idx) { return speedOf(idx) > 50; });
+}
+
+TEST_F(VectorizedPredicateTest, constantOnTheLeftSide)
+{
+    using enum DataType::Type;
+    runTest(LessLogicalFunction(constant(INT8, "-5"), field(INT32, "speed")), [](const uint64_t idx) { return -5 < speedOf(idx); });
+}
+
+TEST_F(VectorizedPredicateTest, conjunctionOfFields)
+{
+    using enum DataType::Type;
+    runTest(
+        AndLogicalFunction(
+            GreaterLogicalFunction(field(INT32, "speed"), constant(INT32, "10")), EqualsLogicalFunction(field(UINT64, "id"), constant(UINT64, "3"))),
+        [](const uint64_t idx) { return speedOf(idx) > 10 and idOf(idx) == 3; });
+}
+
+TEST_F(VectorizedPredicateTest, disjunctionAndNegation)
+{
+    using enum DataType::Type;
+    runTest(
+        OrLogicalFunction(
+            NegateLogicalFunction(LessEqualsLogicalFunction(field(FLOAT64, "ratio"), constant(FLOAT64, "0.5"))),
+            EqualsLogicalFunction(field(UINT64, "id"), constant(INT32, "0"))),
+        [](const uint64_t idx) { return not(ratioOf(idx) <= 0.5) or idOf(idx) == 0; });
+}
+
+TEST_F(VectorizedPredicateTest, integerFieldWithFloatingPointConstant)
+{
+    using enum DataType::Type;
+    runTest(LessLogicalFunction(field(INT32, "speed"), constant(FLOAT64, "10.5")), [](const uint64_t idx) { return speedOf(idx) < 10.5; });
+}
+
+TEST_F(VectorizedPredicateTest, refineEvaluatesOnlySelectedTuples)
+{
+    using enum DataType::Type;
+    const auto first = VectorizedPredicate::create(GreaterLogicalFunction(field(INT32, "speed"), constant(INT32, "10")));
+    const auto second = VectorizedPredicate::create(OrLogicalFunction(
+        EqualsLogicalFunction(field(UINT64, "id"), constant(UINT64, "3")),
+        LessLogicalFunction(field(FLOAT64, "ratio"), constant(FLOAT64, "0.2"))));
+    ASSERT_TRUE(first.has_value() and second.has_value());
+
+    std::vector<uint64_t> expectedSelection;
+    for (uint64_t tupleIdx = 0; tupleIdx < NUMBER_OF_TUPLES; ++tupleIdx)
+    {
+        if (speedOf(tupleIdx) > 10 and (idOf(tupleIdx) == 3 or ratioOf(tupleIdx) < 0.2))
+        {
+            expectedSelection.emplace_back(tupleIdx);
+        }
+    }
+
+    const auto bufferSize = NUMBER_OF_TUPLES * schema.getSizeOfSchemaInBytes();
+    const std::vector<std::shared_ptr<MemoryLayout>> layouts{RowLayout::create(bufferSize, schema), ColumnLayout::create(bufferSize, schema)};
+    for (const auto& layout : layouts)
+    {
+        const auto buffer = createBuffer(*layout);
+        const auto boundFirst = first->bind(*layout);
+        const auto boundSecond = second->bind(*layout);
+        ASSERT_TRUE(boundFirst.has_value() and boundSecond.has_value());
+
+        std::vector<uint64_t> selection(NUMBER_OF_TUPLES);
+        const auto numberOfSelectedTuples = boundFirst->evaluate(buffer.data(), NUMBER_OF_TUPLES, selection.data());
+        /// The first predicate selects more than a chunk of tuples, thus the refinement spans multiple chunks as well
+        ASSERT_GT(numberOfSelectedTuples, VectorizedPredicate::CHUNK_SIZE);
+        const auto numberOfRemainingTuples = boundSecond->refine(buffer.data(), selection.data(), numberOfSelectedTuples);
+        selection.resize(numberOfRemainingTuples);
+        EXPECT_EQ(selection, expectedSelection);
+    }
+}
+
+TEST_F(VectorizedPredicateTest, comparisonOfTwoFieldsIsNotVectorized)
+{
+    using enum DataType::Type;
+    EXPECT_FALSE(VectorizedPredicate::create(GreaterLogicalFunction(field(INT32, "speed"), field(UINT64, "id"))).has_value());
+}
+
+TEST_F(VectorizedPredicateTest, mixedSignednessIsNotBound)
+{
+    using enum DataType::Type;
+    const auto predicate = VectorizedPredicate::create(GreaterLogicalFunction(field(INT32, "speed"), constant(UINT64, "10")));
+    ASSERT_TRUE(predicate.has_value());
+    EXPECT_FALSE(predicate->bind(*RowLayout::create(4096, schema)).has_value());
+}
+
+TEST_F(VectorizedPredicateTest, unknownFieldIsNotBound)
+{
+    using enum DataType::Type;
+    const auto predicate = VectorizedPredicate::create(GreaterLogicalFunction(field(INT32, "unknown"), constant(INT32, "10")));
+    ASSERT_TRUE(predicate.has_value());
+    EXPECT_FALSE(predicate->bind(*RowLayout::create(4096, schema)).has_value());
+}
+
+}
+/// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,170 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <WindowBasedOperatorHandler.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <ranges>
+#include <unordered_map>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
+#include <Runtime/AbstractBufferProvider.hpp>
+#include <Runtime/Execution/OperatorHandler.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Sequencing/SequenceData.hpp>
+#include <SliceStore/Slice.hpp>
+#include <SliceStore/WindowSlicesStoreInterface.hpp>
+#include <Time/Timestamp.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+#include <ErrorHandling.hpp>
+#include <PipelineExecutionContext.hpp>
+
+namespace NES
+{
+
+class WindowBasedOperatorHandlerTest : public Testing::BaseUnitTest
+{
+    struct MockedPipelineContext final : PipelineExecutionContext
+    {
+        bool emitBuffer(const TupleBuffer&, ContinuationPolicy) override
+        {
+            INVARIANT(false, "This function should not be called");
+            return false;
+        }
+
+        void repeatTask(const TupleBuffer&, std::chrono::milliseconds) override { INVARIANT(false, "This function should not be called"); }
+
+        void submitTask(const TupleBuffer&) override { INVARIANT(false, "This function should not be called"); }
+
+        TupleBuffer allocateTupleBuffer() override
+        {
+            INVARIANT(false, "This function should not be called");
+            return {};
+        }
+
+        [[nodiscard]] WorkerThreadId getId() const override { return INITIAL<WorkerThreadId>; }
+
+        [[nodiscard]] uint64_t getNumberOfWorkerThreads() const override { return 1; }
+
+        [[nodiscard]] std::shared_ptr<AbstractBufferProvider> getBufferManager() const override { return nullptr; }
+
+        [[nodiscard]] PipelineId getPipelineId() const override { return PipelineId(1); }
+
+        std::unordered_map<OperatorHandlerId, std::shared_ptr<OperatorHandler>>& getOperatorHandlers() override { return operatorHandlers; }
+
+        void setOperatorHandlers(std::unordered_map<OperatorHandlerId, std::shared_ptr<OperatorHandler>>& opHandlers) override
+        {
+            operatorHandlers = opHandlers;
+        }
+
+        std::unordered_map<OperatorHandlerId, std::shared_ptr<OperatorHandler>> operatorHandlers;
+    };
+
+    /// Records the window ends of all triggered windows instead of emitting them to a probe
+    class TriggerRecordingOperatorHandler final : public WindowBasedOperatorHandler
+    {
+    public:
+        using WindowBasedOperatorHandler::WindowBasedOperatorHandler;
+
+        [[nodiscard]] std::function<std::vector<std::shared_ptr<Slice>>(SliceStart, SliceEnd)>
+        getCreateNewSlicesFunction(const CreateNewSlicesArguments&) const override
+        {
+            return [](const SliceStart sliceStart, const SliceEnd sliceEnd)
+            { return std::vector<std::shared_ptr<Slice>>{std::make_shared<Slice>(sliceStart, sliceEnd)}; };
+        }
+
+        std::vector<uint64_t> triggeredWindowEnds;
+
+    protected:
+        void triggerSlices(
+            const std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>>& slicesAndWindowInfo,
+            PipelineExecutionContext*) override
+        {
+            for (const auto& windowInfoAndSequenceNumber : slicesAndWindowInfo | std::views::keys)
+            {
+                triggeredWindowEnds.emplace_back(windowInfoAndSequenceNumber.windowInfo.windowEnd.getRawValue());
+            }
+        }
+    };
+
+public:
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("WindowBasedOperatorHandlerTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup WindowBasedOperatorHandlerTest class.");
+    }
+
+    void SetUp() override { BaseUnitTest::SetUp(); }
+
+    static BufferMetaData toBufferMetaData(const uint64_t watermark, const uint64_t sequenceNumber)
+    {
+        return {Timestamp(watermark), SequenceData(SequenceNumber(sequenceNumber), ChunkNumber(ChunkNumber::INITIAL), true), OriginId(1)};
+    }
+};
+
+TEST_F(WindowBasedOperatorHandlerTest, keepsWindowsOpenForAllowedLateness)
+{
+    constexpr uint64_t windowSize = 10;
+    constexpr uint64_t allowedLateness = 5;
+    MockedPipelineContext pipelineCtx;
+    TriggerRecordingOperatorHandler handler(
+        {OriginId(1)}, OriginId(2), WindowSlicesStoreInterface::create(SliceStoreType::DEFAULT, windowSize, windowSize));
+    handler.setAllowedLateness(allowedLateness);
+    handler.start(pipelineCtx, 0);
+    handler.getSliceAndWindowStore().getSlicesOrCreate(Timestamp(3), handler.getCreateNewSlicesFunction({}));
+    handler.getSliceAndWindowStore().getSlicesOrCreate(Timestamp(13), handler.getCreateNewSlicesFunction({}));
+
+    /// The watermark has passed the end of the first window, but not its end plus the allowed lateness
+    handler.checkAndTriggerWindows(toBufferMetaData(12, 1), &pipelineCtx);
+    EXPECT_TRUE(handler.triggeredWindowEnds.empty());
+    EXPECT_EQ(handler.getOldestAcceptedTimestamp(), Timestamp(0));
+
+    /// A record arriving out of order within the allowed lateness still finds the slice of the first window
+    EXPECT_EQ(
+        handler.getSliceAndWindowStore().getSlicesOrCreate(Timestamp(7), handler.getCreateNewSlicesFunction({}))[0]->getSliceEnd(),
+        SliceEnd(windowSize));
+
+    handler.checkAndTriggerWindows(toBufferMetaData(16, 2), &pipelineCtx);
+    EXPECT_EQ(handler.triggeredWindowEnds, std::vector<uint64_t>{windowSize});
+
+    /// Only records, whose windows have all been triggered, arrive later than the allowed lateness
+    EXPECT_EQ(handler.getOldestAcceptedTimestamp(), Timestamp(16 - allowedLateness - windowSize));
+    handler.countLateRecord();
+    EXPECT_EQ(handler.getNumberOfLateRecords(), 1);
+}
+
+TEST_F(WindowBasedOperatorHandlerTest, triggersWindowsAtWatermarkWithoutAllowedLateness)
+{
+    constexpr uint64_t windowSize = 10;
+    MockedPipelineContext pipelineCtx;
+    TriggerRecordingOperatorHandler handler(
+        {OriginId(1)}, OriginId(2), WindowSlicesStoreInterface::create(SliceStoreType::DEFAULT, windowSize, windowSize));
+    handler.start(pipelineCtx, 0);
+    handler.getSliceAndWindowStore().getSlicesOrCreate(Timestamp(3), handler.getCreateNewSlicesFunction({}));
+
+    handler.checkAndTriggerWindows(toBufferMetaData(12, 1), &pipelineCtx);
+    EXPECT_EQ(handler.triggeredWindowEnds, std::vector<uint64_t>{windowSize});
+    EXPECT_EQ(handler.getOldestAcceptedTimestamp(), Timestamp(12 - windowSize));
+    EXPECT_EQ(handler.getNumberOfLateRecords(), 0);
+}
+
+}
@@ -14,15 +14,14 @@
 
 // Include standard library headers first, before MEOS
 #include <string>
-#include <chrono>
-#include <ctime>
-#include <iomanip>
-#include <sstream>
-#include <iostream>
+#include <string_view>
+#include <algorithm>
+#include <cmath>
 #include <cstdlib>
 #include <mutex>
 #include <filesystem>
 #include <cstdint>
+#include <limits>
 
 // Include MEOS wrapper after standard headers
 #include <MEOSWrapper.hpp>
@@ -31,53 +30,70 @@
 
 namespace MEOS {
 
-    // Global MEOS initialization
-    static bool meos_initialized = false;
-    static std::mutex meos_init_mutex;
-    static std::mutex meos_parse_mutex;
-    static std::mutex meos_exec_mutex;
+    // MEOS keeps its session state (timezone cache, error handler) per thread. The process-wide part, i.e., the timezone
+    // environment and the first meos_initialize, runs exactly once. Afterwards, every thread initializes its own session
+    // state on first use, such that worker threads can call MEOS concurrently without a global lock.
+    static std::once_flag meos_process_init_flag;
+    static thread_local bool meos_thread_initialized = false;
+
+    // The default MEOS error handler terminates the process. MEOS functions return NULL/-1 after reporting an error,
+    // which our callers already treat as an invalid input, thus we ignore the error here.
+    static void ignoreMeosError(int /*errlevel*/, int /*errcode*/, const char* /*errmsg*/) { }
+
+    // The MEOS parsers require null-terminated strings. Reusing one buffer per thread avoids allocating a string for every record.
+    // The returned pointer is valid until the next call on the same thread.
+    static const char* toCString(std::string_view text) {
+        static thread_local std::string buffer;
+        buffer.assign(text);
+        return buffer.c_str();
+    }
 
     static void cleanupMeos() {
-        if (meos_initialized) {
-            meos_finalize();
-            meos_initialized = false;
-        }
+        meos_finalize();
     }
 
-    static void ensureMeosInitialized() {
-        std::lock_guard<std::mutex> lk(meos_init_mutex);
-        if (!meos_initialized) {
-            // Ensure a sane timezone environment before initializing MEOS (uses PostgreSQL tzdb)
-            const char* tzEnv = std::getenv("TZ");
-            if (!tzEnv || *tzEnv == '\0') {
-                setenv("TZ", "UTC", 1);
-            }
-            // PGTZ is used by the underlying PG timezone code; prefer same value as TZ
-            const char* pgtzEnv = std::getenv("PGTZ");
-            if (!pgtzEnv || *pgtzEnv == '\0') {
-                const char* tzNow = std::getenv("TZ");
-                setenv("PGTZ", tzNow ? tzNow : "UTC", 1);
-            }
-            // Provide a tz database directory if none is set and a common system path exists
-            const char* tzdirEnv = std::getenv("TZDIR");
-            if (!tzdirEnv || *tzdirEnv == '\0') {
-                namespace fs = std::filesystem;
-                const char* candidates[] = {"/usr/share/zoneinfo", "/usr/lib/zoneinfo", "/usr/share/lib/zoneinfo"};
-                for (const auto* cand : candidates) {
-                    std::error_code ec;
-                    if (fs::exists(cand, ec) && !ec) {
-                        setenv("TZDIR", cand, 1);
-                        break;
-                    }
+    static void initializeMeosProcess() {
+        // Ensure a sane timezone environment before initializing MEOS (uses PostgreSQL tzdb)
+        // setenv and tzset are not thread-safe, thus we only call them here
+        const char* tzEnv = std::getenv("TZ");
+        if (!tzEnv || *tzEnv == '\0') {
+            setenv("TZ", "UTC", 1);
+        }
+        // PGTZ is used by the underlying PG timezone code; prefer same value as TZ
+        const char* pgtzEnv = std::getenv("PGTZ");
+        if (!pgtzEnv || *pgtzEnv == '\0') {
+            const char* tzNow = std::getenv("TZ");
+            setenv("PGTZ", tzNow ? tzNow : "UTC", 1);
+        }
+        // Provide a tz database directory if none is set and a common system path exists
+        const char* tzdirEnv = std::getenv("TZDIR");
+        if (!tzdirEnv || *tzdirEnv == '\0') {
+            namespace fs = std::filesystem;
+            const char* candidates[] = {"/usr/share/zoneinfo", "/usr/lib/zoneinfo", "/usr/share/lib/zoneinfo"};
+            for (const auto* cand : candidates) {
+                std::error_code ec;
+                if (fs::exists(cand, ec) && !ec) {
+                    setenv("TZDIR", cand, 1);
+                    break;
                 }
             }
-            tzset();
+        }
+        tzset();
+
+        meos_initialize();
+        // Register cleanup function to be called at program exit
+        std::atexit(cleanupMeos);
+    }
 
-            meos_initialize();
-            meos_initialized = true;
-            // Register cleanup function to be called at program exit
-            std::atexit(cleanupMeos);
+    static void ensureMeosInitialized() {
+        if (meos_thread_initialized) [[likely]] {
+            return;
         }
+        std::call_once(meos_process_init_flag, initializeMeosProcess);
+        // Session state of the calling thread
+        meos_initialize_timezone(std::getenv("PGTZ"));
+        meos_initialize_error_handler(&ignoreMeosError);
+        meos_thread_initialized = true;
     }
 
     Meos::Meos() { 
@@ -89,74 +105,101 @@ namespace MEOS {
         //we finalize at cleanupMeos
     }
 
-    std::string Meos::convertSecondsToTimestamp(long long seconds) {
-        // Use UTC to avoid timezone ambiguities and Docker tz issues
-        std::chrono::seconds sec(seconds);
-        std::chrono::time_point<std::chrono::system_clock> tp(sec);
-
-        std::time_t time = std::chrono::system_clock::to_time_t(tp);
-        std::tm utc_tm{};
-#if defined(_WIN32)
-        gmtime_s(&utc_tm, &time);
-#else
-        utc_tm = *std::gmtime(&time);
-#endif
-
-        std::ostringstream oss;
-        // Append explicit UTC offset so MEOS parser reads a zoned timestamp
-        oss << std::put_time(&utc_tm, "%Y-%m-%d %H:%M:%S") << "+00";
-        return oss.str();
-    }
-
-    std::string Meos::convertEpochToTimestamp(unsigned long long epochLike) {
-        // Normalize to seconds using magnitude heuristics
-        // >=1e19 -> ns, >=1e16 -> us, >=1e13 -> ms, else seconds
-        unsigned long long secondsUll = epochLike;
-        if (epochLike >= 1000000000000000000ULL) {        // nanoseconds
-            secondsUll = epochLike / 1000000000ULL;
-        } else if (epochLike >= 1000000000000000ULL) {    // microseconds
-            secondsUll = epochLike / 1000000ULL;
-        } else if (epochLike >= 1000000000000ULL) {       // milliseconds
-            secondsUll = epochLike / 1000ULL;
-        } else {
-            // seconds already
-            secondsUll = epochLike;
+    std::string_view Meos::stripQuotes(std::string_view text) {
+        while (!text.empty() && (text.front() == '\'' || text.front() == '"')) {
+            text.remove_prefix(1);
         }
+        while (!text.empty() && (text.back() == '\'' || text.back() == '"')) {
+            text.remove_suffix(1);
+        }
+        return text;
+    }
 
-        // Clamp to a reasonable range to avoid tz library failures
-        // Here we clamp to [0, 4102444800] ~ 2100-01-01 for safety
-        const unsigned long long kMaxReasonable = 4102444800ULL; // 2100-01-01T00:00:00Z
-        if (secondsUll > kMaxReasonable) {
-            secondsUll = kMaxReasonable;
+    // >=1e18 -> ns, >=1e15 -> us, >=1e12 -> ms, else seconds
+    Meos::EpochUnit Meos::detectEpochUnit(unsigned long long epochLike) {
+        if (epochLike >= 1000000000000000000ULL) {
+            return EpochUnit::NANOSECONDS;
+        }
+        if (epochLike >= 1000000000000000ULL) {
+            return EpochUnit::MICROSECONDS;
+        }
+        if (epochLike >= 1000000000000ULL) {
+            return EpochUnit::MILLISECONDS;
         }
+        return EpochUnit::SECONDS;
+    }
+
+    // MEOS uses the PostgreSQL representation: microseconds since 2000-01-01T00:00:00Z
+    TimestampTz Meos::convertEpochToTimestampTz(unsigned long long epochLike, EpochUnit unit) {
+        constexpr long long kPostgresEpochInUnixMicroseconds = 946684800LL * 1000000LL;
+        // Clamp to 2100-01-01T00:00:00Z to avoid tz library failures
+        constexpr unsigned long long kMaxReasonableMicroseconds = 4102444800ULL * 1000000ULL;
+
+        unsigned long long microseconds = 0;
+        switch (unit) {
+            case EpochUnit::SECONDS:
+                microseconds = epochLike >= kMaxReasonableMicroseconds / 1000000ULL ? kMaxReasonableMicroseconds : epochLike * 1000000ULL;
+                break;
+            case EpochUnit::MILLISECONDS:
+                microseconds = epochLike >= kMaxReasonableMicroseconds / 1000ULL ? kMaxReasonableMicroseconds : epochLike * 1000ULL;
+                break;
+            case EpochUnit::MICROSECONDS:
+                microseconds = epochLike;
+                break;
+            case EpochUnit::NANOSECONDS:
+                microseconds = epochLike / 1000ULL;
+                break;
+        }
+        microseconds = std::min(microseconds, kMaxReasonableMicroseconds);
+        return static_cast<TimestampTz>(static_cast<long long>(microseconds) - kPostgresEpochInUnixMicroseconds);
+    }
 
-        return convertSecondsToTimestamp(static_cast<long long>(secondsUll));
+    // Unlike convertEpochToTimestampTz, keeps timestamps before the Unix epoch
+    static TimestampTz convertSecondsToTimestampTz(long long seconds) {
+        constexpr long long kPostgresEpochInUnixSeconds = 946684800LL;
+        constexpr long long kMicrosecondsPerSecond = 1000000LL;
+        return static_cast<TimestampTz>((seconds - kPostgresEpochInUnixSeconds) * kMicrosecondsPerSecond);
     }
 
-    // TemporalInstant constructor
-    Meos::TemporalInstant::TemporalInstant(double lon, double lat, long long ts, int srid) {
-        // Ensure MEOS is initialized
-        ensureMeosInitialized();
-        
-        std::string ts_string = Meos::convertSecondsToTimestamp(ts);
-        std::string str_pointbuffer = "SRID=" + std::to_string(srid) + ";POINT(" + std::to_string(lon) + " " + std::to_string(lat) + ")@" + ts_string;
+    TimestampTz Meos::convertEpochToTimestampTz(unsigned long long epochLike) {
+        return convertEpochToTimestampTz(epochLike, detectEpochUnit(epochLike));
+    }
 
-        std::cout << "Creating MEOS TemporalInstant from: " << str_pointbuffer << std::endl;
+    TimestampTz Meos::EpochConverter::toTimestampTz(unsigned long long epochLike) {
+        uint8_t detected = unit.load(std::memory_order_relaxed);
+        if (detected == UNDETECTED) {
+            const uint8_t candidate = static_cast<uint8_t>(detectEpochUnit(epochLike));
+            // Keeps the unit of a racing first call, such that all threads convert in the same unit
+            detected = unit.compare_exchange_strong(detected, candidate, std::memory_order_relaxed) ? candidate : detected;
+        }
+        return convertEpochToTimestampTz(epochLike, static_cast<EpochUnit>(detected));
+    }
 
-        Temporal *temp = nullptr;
-        {
-            std::lock_guard<std::mutex> lk(meos_parse_mutex);
-            temp = tgeompoint_in(str_pointbuffer.c_str());
+    std::optional<Meos::EpochUnit> Meos::EpochConverter::getUnit() const {
+        const uint8_t detected = unit.load(std::memory_order_relaxed);
+        if (detected == UNDETECTED) {
+            return std::nullopt;
         }
+        return static_cast<EpochUnit>(detected);
+    }
 
-        if (temp == nullptr) {
-            std::cout << "Failed to parse temporal point with temporal_from_text" << std::endl;
-            // Try alternative format or set to null
-            instant = nullptr;
-        } else {
-            instant = temp;
-            std::cout << "Successfully created temporal point" << std::endl;
+    // Builds a temporal point instant from its coordinates without a WKT round-trip.
+    // MEOS copies the point into the instant, thus we release the intermediate point right away.
+    static Temporal* makeTemporalPoint(double lon, double lat, TimestampTz timestamp, int srid) {
+        GSERIALIZED* point = geompoint_make2d(srid, lon, lat);
+        if (point == nullptr) {
+            return nullptr;
         }
+        Temporal* temporal = reinterpret_cast<Temporal*>(tpointinst_make(point, timestamp));
+        free(point);
+        return temporal;
+    }
+
+    // TemporalInstant constructor
+    Meos::TemporalInstant::TemporalInstant(double lon, double lat, long long ts, int srid) {
+        // Ensure MEOS is initialized
+        ensureMeosInitialized();
+        instant = makeTemporalPoint(lon, lat, convertSecondsToTimestampTz(ts), srid);
     }
 
 
@@ -167,36 +210,23 @@ namespace MEOS {
     }
 
     bool Meos::TemporalInstant::intersects(const TemporalInstant& point) const {  
-        std::cout << "TemporalInstant::intersects called" << std::endl;
         // Use MEOS eintersects function for temporal points  - this will change 
-        bool result = eintersects_tgeo_tgeo((const Temporal *)this->instant, (const Temporal *)point.instant);
-        if (result) {
-            std::cout << "TemporalInstant intersects" << std::endl;
-        }
-
-        return result;
+        return eintersects_tgeo_tgeo((const Temporal *)this->instant, (const Temporal *)point.instant);
     }
 
 
-    Meos::TemporalGeometry::TemporalGeometry(const std::string& wkt_string){
+    Meos::TemporalGeometry::TemporalGeometry(std::string_view wkt_string){
 
         ensureMeosInitialized();
 
-        std::cout << "Creating MEOS TemporalGeometry from: " << wkt_string << std::endl;
-
         // Try temporal point parser first
-        Temporal *temp = nullptr;
-        {
-            std::lock_guard<std::mutex> lk(meos_parse_mutex);
-            temp = tgeompoint_in(wkt_string.c_str());
-        }
+        Temporal *temp = tgeompoint_in(toCString(wkt_string));
 
         // If failed, try toggling POINT/Point case
         if (temp == nullptr) {
-            std::string alt = wkt_string;
+            std::string alt(wkt_string);
             if (auto pos = alt.find("Point("); pos != std::string::npos) {
                 alt.replace(pos, 6, "POINT(");
-                std::lock_guard<std::mutex> lk2(meos_parse_mutex);
                 temp = tgeompoint_in(alt.c_str());
             } else if (auto pos2 = alt.find("POINT("); pos2 != std::string::npos) {
                 alt.replace(pos2, 6, "Point(");
@@ -206,20 +236,23 @@ namespace MEOS {
 
         // Fall back to generic temporal geometry parser
         if (temp == nullptr) {
-            std::lock_guard<std::mutex> lk3(meos_parse_mutex);
-            temp = tgeometry_in(wkt_string.c_str());
+            temp = tgeometry_in(toCString(wkt_string));
         }
 
-        if (temp == nullptr) {
-            std::cout << "Failed to parse temporal geometry (tgeompoint_in/tgeometry_in)" << std::endl;
-            geometry = nullptr;
-        } else {
-            geometry = temp;
-            std::cout << "Successfully created temporal geometry" << std::endl;
-        }
+        geometry = temp;
 
     }
 
+    Meos::TemporalGeometry::TemporalGeometry(double lon, double lat, unsigned long long epochLike, int srid) {
+        ensureMeosInitialized();
+        geometry = makeTemporalPoint(lon, lat, convertEpochToTimestampTz(epochLike), srid);
+    }
+
+    Meos::TemporalGeometry::TemporalGeometry(double lon, double lat, unsigned long long epochLike, EpochConverter& converter, int srid) {
+        ensureMeosInitialized();
+        geometry = makeTemporalPoint(lon, lat, converter.toTimestampTz(epochLike), srid);
+    }
+
     Temporal* Meos::TemporalGeometry::getGeometry() const {
         return geometry;
     }
@@ -230,38 +263,42 @@ namespace MEOS {
     }
 
     int Meos::TemporalGeometry::intersects(const TemporalGeometry& geom) const{
-        std::cout << "TemporalGeometry::intersects called" << std::endl;        
         int result = eintersects_tgeo_tgeo((const Temporal *)this->geometry, (const Temporal *)geom.geometry);
         return result;
     }
 
     int Meos::TemporalGeometry::contains(const TemporalGeometry& geom) const{
-        std::cout << "TemporalGeometry::contains called" << std::endl;        
         int result = econtains_tgeo_tgeo((const Temporal *)this->geometry, (const Temporal *)geom.geometry);
         return result;
     }
 
     // StaticGeometry implementation
-    Meos::StaticGeometry::StaticGeometry(const std::string& wkt_string) {
+    Meos::StaticGeometry::StaticGeometry(std::string_view wkt_string) {
         ensureMeosInitialized();
 
-        std::cout << "Creating MEOS StaticGeometry from: " << wkt_string << std::endl;
-
         // Use geom_in to parse static WKT geometry (no temporal component)
-        {
-            std::lock_guard<std::mutex> lk(meos_parse_mutex);
-            geometry = geom_in(wkt_string.c_str(), -1);
-        }
+        geometry = geom_in(toCString(wkt_string), -1);
+    }
 
+    GSERIALIZED* Meos::StaticGeometry::getGeometry() const {
+        return geometry;
+    }
+
+    static std::optional<Meos::BoundingBox> computeBoundingBox(const GSERIALIZED* geometry) {
         if (geometry == nullptr) {
-            std::cout << "Failed to parse static geometry" << std::endl;
-        } else {
-            std::cout << "Successfully created static geometry" << std::endl;
+            return std::nullopt;
         }
+        STBox* box = geo_to_stbox(geometry);
+        Meos::BoundingBox result{0, 0, 0, 0};
+        const bool valid = box != nullptr && stbox_xmin(box, &result.xmin) && stbox_ymin(box, &result.ymin)
+            && stbox_xmax(box, &result.xmax) && stbox_ymax(box, &result.ymax);
+        free(box);
+        return valid ? std::optional(result) : std::nullopt;
     }
 
-    GSERIALIZED* Meos::StaticGeometry::getGeometry() const {
-        return geometry;
+    std::optional<Meos::BoundingBox> Meos::StaticGeometry::getBoundingBox() const {
+        ensureMeosInitialized();
+        return computeBoundingBox(geometry);
     }
 
     Meos::StaticGeometry::~StaticGeometry() {
@@ -270,8 +307,6 @@ namespace MEOS {
     }
 
     int Meos::TemporalGeometry::intersectsStatic(const StaticGeometry& static_geom) const {
-        std::cout << "TemporalGeometry::intersectsStatic called" << std::endl;
-        
         // Use eintersects_tgeo_geo for temporal-static intersection
         int result = eintersects_tgeo_geo((const Temporal*)this->geometry, static_geom.getGeometry());
 
@@ -279,14 +314,11 @@ namespace MEOS {
     }
 
     int Meos::TemporalGeometry::aintersects(const TemporalGeometry& geom) const{
-        std::cout << "TemporalGeometry::aintersects called" << std::endl;        
         int result = aintersects_tgeo_tgeo((const Temporal *)this->geometry, (const Temporal *)geom.geometry);
         return result;
     }   
 
     int Meos::TemporalGeometry::aintersectsStatic(const StaticGeometry& static_geom) const {
-        std::cout << "TemporalGeometry::aintersectsStatic called" << std::endl;
-        
         // Use aintersects_tgeo_geo for temporal-static intersection
         int result = aintersects_tgeo_geo((const Temporal*)this->geometry, static_geom.getGeometry());
 
@@ -295,27 +327,13 @@ namespace MEOS {
 
     // called if static geometry is the first parameter
     int Meos::StaticGeometry::containsTemporal(const TemporalGeometry& temporal_geom) const {
-        std::cout << "StaticGeometry::containsTemporal called" << std::endl;
         int result = econtains_geo_tgeo((const GSERIALIZED*)this->geometry, (const Temporal *)temporal_geom.getGeometry());
-        if (result==1) {
-            std::cout << "StaticGeometry contains TemporalGeometry" << std::endl;
-        }
-        else {
-            std::cout << "StaticGeometry does NOT contain TemporalGeometry" << std::endl;
-        }
         return result;
     }
 
     // called if temporal geometry is the first parameter
     int Meos::TemporalGeometry::containsStatic(const StaticGeometry& static_geom) const {
-        std::cout << "TemporalGeometry::containsStatic called" << std::endl;
         int result = econtains_tgeo_geo((const Temporal *)this->geometry, (const GSERIALIZED*)static_geom.getGeometry());
-        if (result==1) {
-            std::cout << "TemporalGeometry contains StaticGeometry" << std::endl;
-        }
-        else {
-            std::cout << "TemporalGeometry does NOT contain StaticGeometry" << std::endl;
-        }
         return result;
     }
 
@@ -327,9 +345,8 @@ namespace MEOS {
 
         sequence = nullptr;
         // TODO:call the aggregation function
-        
+        (void)instants;
         //TODO: with the result of the aggregation function, we can create a temporal sequence
-        std::cout << "TemporalSequence created from " << instants.size() << " temporal instants" << std::endl;
     }
    
 
@@ -346,7 +363,7 @@ namespace MEOS {
     }
     
     // Static wrapper functions for MEOS API
-    void* Meos::parseTemporalPoint(const std::string& trajStr) {
+    void* Meos::parseTemporalPoint(std::string_view trajStr) {
         ensureMeosInitialized();
         
         if (trajStr.empty()) {
@@ -356,10 +373,10 @@ namespace MEOS {
         // Clear any previous errors
         meos_errno_reset();
         
-        Temporal* temp = tgeompoint_in(trajStr.c_str());
+        Temporal* temp = tgeompoint_in(toCString(trajStr));
         if (!temp) {
             // Try with SRID prefix as fallback
-            std::string sridStr = "SRID=4326;" + trajStr;
+            std::string sridStr = "SRID=4326;" + std::string(trajStr);
             temp = tgeompoint_in(sridStr.c_str());
         }
         
@@ -372,6 +389,7 @@ namespace MEOS {
     }
     
     uint8_t* Meos::temporalToWKB(void* temporal, size_t& size) {
+        ensureMeosInitialized();
         if (!temporal) {
             size = 0;
             return nullptr;
@@ -382,86 +400,153 @@ namespace MEOS {
         return data;
     }
     
+    static Temporal* appendInstantToTrajectory(Temporal* trajectory, double lon, double lat, TimestampTz timestamp, int srid) {
+        Temporal* instant = makeTemporalPoint(lon, lat, timestamp, srid);
+        if (instant == nullptr) {
+            return trajectory;
+        }
+
+        Temporal* result = nullptr;
+        if (trajectory == nullptr) {
+            const TInstant* instants[] = {reinterpret_cast<const TInstant*>(instant)};
+            result = reinterpret_cast<Temporal*>(tsequence_make(instants, 1, true, true, DISCRETE, false));
+        } else if (timestamp > temporal_end_timestamptz(trajectory)) {
+            // MEOS appends in place if the expandable sequence has space left, otherwise it returns a copy with twice the capacity
+            result = temporal_append_tinstant(trajectory, reinterpret_cast<const TInstant*>(instant), DISCRETE, 0.0, nullptr, true);
+        } else {
+            result = temporal_merge(trajectory, instant);
+        }
+        free(instant);
+
+        if (result == nullptr) {
+            return trajectory;
+        }
+        if (result != trajectory) {
+            free(trajectory);
+        }
+        return result;
+    }
+
+    Temporal* Meos::appendToTrajectory(Temporal* trajectory, double lon, double lat, unsigned long long epochLike, int srid) {
+        ensureMeosInitialized();
+        return appendInstantToTrajectory(trajectory, lon, lat, convertEpochToTimestampTz(epochLike), srid);
+    }
+
+    Temporal* Meos::appendToTrajectory(
+        Temporal* trajectory, double lon, double lat, unsigned long long epochLike, EpochConverter& converter, int srid) {
+        ensureMeosInitialized();
+        return appendInstantToTrajectory(trajectory, lon, lat, converter.toTimestampTz(epochLike), srid);
+    }
+
+    Temporal* Meos::mergeTrajectories(Temporal* trajectory, const Temporal* other) {
+        ensureMeosInitialized();
+        if (other == nullptr) {
+            return trajectory;
+        }
+        if (trajectory == nullptr) {
+            return temporal_copy(other);
+        }
+        Temporal* result = temporal_merge(trajectory, other);
+        if (result == nullptr) {
+            return trajectory;
+        }
+        free(trajectory);
+        return result;
+    }
+
+    void Meos::freeTrajectory(Temporal* trajectory) {
+        free(trajectory);
+    }
+
     void Meos::ensureMeosInitialized() {
         MEOS::ensureMeosInitialized();
     }
 
     int Meos::safe_edwithin_tgeo_geo(const Temporal* temp, const GSERIALIZED* gs, double dist)
     {
-        std::lock_guard<std::mutex> lk(meos_exec_mutex);
+        ensureMeosInitialized();
         return edwithin_tgeo_geo(temp, gs, dist);
     }
 
+    int Meos::safe_edwithin_tgeo_point(const Temporal* temp, double lon, double lat, double dist, int srid)
+    {
+        ensureMeosInitialized();
+        GSERIALIZED* point = geompoint_make2d(srid, lon, lat);
+        if (point == nullptr) {
+            return -1;
+        }
+        const int result = edwithin_tgeo_geo(temp, point, dist);
+        free(point);
+        return result;
+    }
+
     int Meos::safe_eintersects_tgeo_geo(const Temporal* temp, const GSERIALIZED* gs)
     {
-        std::lock_guard<std::mutex> lk(meos_exec_mutex);
+        ensureMeosInitialized();
         return eintersects_tgeo_geo(temp, gs);
     }
 
     Temporal* Meos::safe_tgeo_at_stbox(const Temporal* temp, const STBox* box, bool border_inc)
     {
-        std::lock_guard<std::mutex> lk(meos_exec_mutex);
+        ensureMeosInitialized();
         return tgeo_at_stbox(temp, box, border_inc);
     }
 
     // SpatioTemporalBox implementation
-    Meos::SpatioTemporalBox::SpatioTemporalBox(const std::string& wkt_string) {
+    Meos::SpatioTemporalBox::SpatioTemporalBox(std::string_view wkt_string) {
         // Ensure MEOS is initialized
         ensureMeosInitialized();
         // Use MEOS stbox_in function to parse the WKT string
-        {
-            std::lock_guard<std::mutex> lk(meos_parse_mutex);
-            stbox_ptr = stbox_in(wkt_string.c_str());
-            if (!stbox_ptr) {
-                // Attempt to convert legacy STBOX((x,y,t),(x2,y2,t2)) into STBOX XT(((x,y),(x2,y2)),[t,t2])
-                std::string sridPrefix;
-                std::string core = wkt_string;
-                if (auto semi = core.find(';'); semi != std::string::npos) {
-                    sridPrefix = core.substr(0, semi + 1); // keep trailing ';'
-                    core = core.substr(semi + 1);
+        stbox_ptr = stbox_in(toCString(wkt_string));
+        if (!stbox_ptr) {
+            // Attempt to convert legacy STBOX((x,y,t),(x2,y2,t2)) into STBOX XT(((x,y),(x2,y2)),[t,t2])
+            std::string sridPrefix;
+            std::string core(wkt_string);
+            if (auto semi = core.find(';'); semi != std::string::npos) {
+                sridPrefix = core.substr(0, semi + 1); // keep trailing ';'
+                core = core.substr(semi + 1);
+            }
+            auto start = core.find("STBOX((");
+            auto end = core.rfind(")");
+            if (start != std::string::npos && end != std::string::npos && end > start + 8) {
+                std::string inner = core.substr(start + 7, end - (start + 7)); // after 'STBOX('
+                // Expect inner like: (x,y,t),(x2,y2,t2)
+                // Remove possible outer parentheses
+                if (!inner.empty() && inner.front() == '(' && inner.back() == ')') {
+                    inner = inner.substr(1, inner.size() - 2);
                 }
-                auto start = core.find("STBOX((");
-                auto end = core.rfind(")");
-                if (start != std::string::npos && end != std::string::npos && end > start + 8) {
-                    std::string inner = core.substr(start + 7, end - (start + 7)); // after 'STBOX('
-                    // Expect inner like: (x,y,t),(x2,y2,t2)
-                    // Remove possible outer parentheses
-                    if (!inner.empty() && inner.front() == '(' && inner.back() == ')') {
-                        inner = inner.substr(1, inner.size() - 2);
-                    }
-                    auto mid = inner.find("),(");
-                    if (mid != std::string::npos) {
-                        auto first = inner.substr(0, mid);
-                        auto second = inner.substr(mid + 3);
-                        auto trim = [](std::string& s){
+                auto mid = inner.find("),(");
+                if (mid != std::string::npos) {
+                    auto first = inner.substr(0, mid);
+                    auto second = inner.substr(mid + 3);
+                    auto trim = [](std::string& s){
+                        while (!s.empty() && (s.front()==' '||s.front()=='\t')) s.erase(s.begin());
+                        while (!s.empty() && (s.back()==' '||s.back()=='\t')) s.pop_back();
+                        if (!s.empty() && s.front()=='(') s.erase(s.begin());
+                        if (!s.empty() && s.back()==')') s.pop_back();
+                    };
+                    trim(first); trim(second);
+                    auto split3 = [](const std::string& s){
+                        std::vector<std::string> out; out.reserve(3);
+                        size_t p=0; size_t c1 = s.find(',');
+                        if (c1==std::string::npos) return out;
+                        size_t c2 = s.find(',', c1+1);
+                        if (c2==std::string::npos) return out;
+                        out.push_back(s.substr(0,c1));
+                        out.push_back(s.substr(c1+1, c2-(c1+1)));
+                        out.push_back(s.substr(c2+1));
+                        return out;
+                    };
+                    auto a = split3(first);
+                    auto b = split3(second);
+                    if (a.size()==3 && b.size()==3) {
+                        auto trimSpaces = [](std::string& s){
                             while (!s.empty() && (s.front()==' '||s.front()=='\t')) s.erase(s.begin());
                             while (!s.empty() && (s.back()==' '||s.back()=='\t')) s.pop_back();
-                            if (!s.empty() && s.front()=='(') s.erase(s.begin());
-                            if (!s.empty() && s.back()==')') s.pop_back();
-                        };
-                        trim(first); trim(second);
-                        auto split3 = [](const std::string& s){
-                            std::vector<std::string> out; out.reserve(3);
-                            size_t p=0; size_t c1 = s.find(',');
-                            if (c1==std::string::npos) return out;
-                            size_t c2 = s.find(',', c1+1);
-                            if (c2==std::string::npos) return out;
-                            out.push_back(s.substr(0,c1));
-                            out.push_back(s.substr(c1+1, c2-(c1+1)));
-                            out.push_back(s.substr(c2+1));
-                            return out;
                         };
-                        auto a = split3(first);
-                        auto b = split3(second);
-                        if (a.size()==3 && b.size()==3) {
-                            auto trimSpaces = [](std::string& s){
-                                while (!s.empty() && (s.front()==' '||s.front()=='\t')) s.erase(s.begin());
-                                while (!s.empty() && (s.back()==' '||s.back()=='\t')) s.pop_back();
-                            };
-                            for (auto* v : {&a[0],&a[1],&a[2],&b[0],&b[1],&b[2]}) trimSpaces(*v);
-                            std::string xt = sridPrefix + "STBOX XT(((" + a[0] + "," + a[1] + "),(" + b[0] + "," + b[1] + ")), [" + a[2] + ", " + b[2] + "])";
-                            stbox_ptr = stbox_in(xt.c_str());
-                        }
+                        for (auto* v : {&a[0],&a[1],&a[2],&b[0],&b[1],&b[2]}) trimSpaces(*v);
+                        std::string xt = sridPrefix + "STBOX XT(((" + a[0] + "," + a[1] + "),(" + b[0] + "," + b[1] + ")), [" + a[2] + ", " + b[2] + "])";
+                        stbox_ptr = stbox_in(xt.c_str());
                     }
                 }
             }
@@ -477,6 +562,147 @@ namespace MEOS {
         return static_cast<STBox*>(stbox_ptr);
     }
 
+    std::optional<Meos::SpatioTemporalBounds> Meos::SpatioTemporalBox::getBounds() const {
+        ensureMeosInitialized();
+        const STBox* box = getBox();
+        if (box == nullptr) {
+            return std::nullopt;
+        }
+        constexpr double infinity = std::numeric_limits<double>::infinity();
+        SpatioTemporalBounds bounds{
+            {-infinity, -infinity, infinity, infinity}, std::numeric_limits<TimestampTz>::min(), std::numeric_limits<TimestampTz>::max()};
+        if (stbox_hasx(box) && !stbox_isgeodetic(box)) {
+            stbox_xmin(box, &bounds.space.xmin);
+            stbox_ymin(box, &bounds.space.ymin);
+            stbox_xmax(box, &bounds.space.xmax);
+            stbox_ymax(box, &bounds.space.ymax);
+        }
+        if (stbox_hast(box)) {
+            stbox_tmin(box, &bounds.tmin);
+            stbox_tmax(box, &bounds.tmax);
+        }
+        return bounds;
+    }
+
+
+    Meos::GeofenceIndex::GeofenceIndex(std::string_view wkt_string) {
+        ensureMeosInitialized();
+        collection = geom_in(toCString(wkt_string), -1);
+        if (collection == nullptr) {
+            return;
+        }
+
+        // A geometry that is not a collection is its only geofence
+        const int count = geo_num_geos(collection);
+        geofences.reserve(count);
+        for (int n = 1; n <= count; ++n) {
+            GSERIALIZED* part = (count == 1) ? collection : geo_geoN(collection, n);
+            if (part == nullptr) {
+                continue;
+            }
+            const auto box = computeBoundingBox(part);
+            if (!box) {
+                if (part != collection) {
+                    free(part);
+                }
+                continue;
+            }
+            geofences.push_back({part, *box});
+        }
+        if (geofences.empty()) {
+            return;
+        }
+
+        // About one geofence per cell, if the geofences are evenly distributed
+        double gridXmax = geofences.front().box.xmax, gridYmax = geofences.front().box.ymax;
+        gridXmin = geofences.front().box.xmin;
+        gridYmin = geofences.front().box.ymin;
+        for (const auto& geofence : geofences) {
+            gridXmin = std::min(gridXmin, geofence.box.xmin);
+            gridYmin = std::min(gridYmin, geofence.box.ymin);
+            gridXmax = std::max(gridXmax, geofence.box.xmax);
+            gridYmax = std::max(gridYmax, geofence.box.ymax);
+        }
+        columns = rows = static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(geofences.size()))));
+        cellWidth = (gridXmax > gridXmin) ? (gridXmax - gridXmin) / static_cast<double>(columns) : 1.0;
+        cellHeight = (gridYmax > gridYmin) ? (gridYmax - gridYmin) / static_cast<double>(rows) : 1.0;
+        cells.resize(columns * rows);
+
+        const auto toCell = [](double value, double origin, double cellSize, size_t numberOfCells) {
+            const auto cell = static_cast<long long>(std::floor((value - origin) / cellSize));
+            return static_cast<size_t>(std::clamp<long long>(cell, 0, static_cast<long long>(numberOfCells) - 1));
+        };
+        for (uint32_t i = 0; i < geofences.size(); ++i) {
+            const auto& geofence = geofences[i];
+            const auto firstColumn = toCell(geofence.box.xmin, gridXmin, cellWidth, columns);
+            const auto lastColumn = toCell(geofence.box.xmax, gridXmin, cellWidth, columns);
+            const auto firstRow = toCell(geofence.box.ymin, gridYmin, cellHeight, rows);
+            const auto lastRow = toCell(geofence.box.ymax, gridYmin, cellHeight, rows);
+            for (size_t row = firstRow; row <= lastRow; ++row) {
+                for (size_t column = firstColumn; column <= lastColumn; ++column) {
+                    cells[row * columns + column].push_back(i);
+                }
+            }
+        }
+    }
+
+    Meos::GeofenceIndex::~GeofenceIndex() {
+        for (const auto& geofence : geofences) {
+            if (geofence.geometry != collection) {
+                free(geofence.geometry);
+            }
+        }
+        free(collection);
+    }
+
+    template <typename Predicate>
+    int Meos::GeofenceIndex::anyCandidate(double lon, double lat, const Predicate& predicate) const {
+        if (cells.empty()) {
+            return 0;
+        }
+        const double column = std::floor((lon - gridXmin) / cellWidth);
+        const double row = std::floor((lat - gridYmin) / cellHeight);
+        // Points on the upper border of the grid belong to the last cell
+        const auto lastColumn = static_cast<double>(columns - 1), lastRow = static_cast<double>(rows - 1);
+        if (column < 0 || row < 0 || column > lastColumn + 1 || row > lastRow + 1) {
+            return 0;
+        }
+        const auto& candidates = cells[static_cast<size_t>(std::min(row, lastRow)) * columns + static_cast<size_t>(std::min(column, lastColumn))];
+
+        int result = 0;
+        for (const auto candidate : candidates) {
+            const auto& geofence = geofences[candidate];
+            if (lon < geofence.box.xmin || lon > geofence.box.xmax || lat < geofence.box.ymin || lat > geofence.box.ymax) {
+                continue;
+            }
+            const int candidateResult = predicate(geofence.geometry);
+            if (candidateResult == 1) {
+                return 1;
+            }
+            if (candidateResult < 0) {
+                result = candidateResult;
+            }
+        }
+        return result;
+    }
+
+    int Meos::GeofenceIndex::aintersects(const TemporalGeometry& point, double lon, double lat) const {
+        return anyCandidate(lon, lat, [&point](const GSERIALIZED* geofence) {
+            return aintersects_tgeo_geo(point.getGeometry(), geofence);
+        });
+    }
+
+    int Meos::GeofenceIndex::containsTemporal(const TemporalGeometry& point, double lon, double lat) const {
+        return anyCandidate(lon, lat, [&point](const GSERIALIZED* geofence) {
+            return econtains_geo_tgeo(geofence, point.getGeometry());
+        });
+    }
+
+    int Meos::GeofenceIndex::containedByTemporal(const TemporalGeometry& point, double lon, double lat) const {
+        return anyCandidate(lon, lat, [&point](const GSERIALIZED* geofence) {
+            return econtains_tgeo_geo(point.getGeometry(), geofence);
+        });
+    }
 
     Meos::TemporalHolder::TemporalHolder(Temporal* temporalPtr)
         : temporal(temporalPtr) {}
@@ -15,7 +15,12 @@
 #ifndef NES_PLUGINS_MEOS_HPP
 #define NES_PLUGINS_MEOS_HPP
 
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 extern "C" {
@@ -25,6 +30,19 @@ extern "C" {
 
 namespace MEOS {
 
+/**
+ * Thread safety: MEOS keeps its session state (timezone cache, error handler) per thread. Every entry point of this wrapper
+ * initializes the session state of the calling thread on first use (see ensureMeosInitialized), thus worker threads can
+ * call it concurrently without a global lock:
+ *  - the constructors of TemporalInstant, TemporalGeometry, StaticGeometry, and SpatioTemporalBox,
+ *  - the predicates of TemporalGeometry and StaticGeometry and the safe_* functions,
+ *  - parseTemporalPoint, temporalToWKB, and freeTemporalObject.
+ * These are reentrant as long as threads do not share mutable MEOS objects. Reading the same object, e.g., a constant
+ * StaticGeometry, from multiple threads is fine.
+ *
+ * The parsing entry points take string views, such that callers can pass the content of a VariableSizedData without copying it.
+ * As the MEOS parsers require null-terminated strings, the wrapper copies the view into a buffer per thread, which it reuses.
+ */
 class Meos {
   public:
     /**
@@ -37,13 +55,24 @@ class Meos {
      */
     ~Meos();
 
+    // Spatial extent of a static geometry in its coordinate units
+    struct BoundingBox {
+        double xmin, ymin, xmax, ymax;
+    };
+
+    // Spatiotemporal extent of a box, c.f., SpatioTemporalBox::getBounds
+    struct SpatioTemporalBounds {
+        BoundingBox space;
+        TimestampTz tmin, tmax;
+    };
+
     class SpatioTemporalBox {
     public:
         /**
          * @brief Create SpatioTemporal from WKT string
          * @param wkt_string String in format "SRID=4326;SpatioTemporal X((3.5, 50.5),(4.5, 51.5))"
          */
-        explicit SpatioTemporalBox(const std::string& wkt_string);
+        explicit SpatioTemporalBox(std::string_view wkt_string);
         ~SpatioTemporalBox();
 
         // Non-copyable, movable to avoid double-free of MEOS-managed memory
@@ -57,6 +86,9 @@ class Meos {
 
         STBox* getBox() const;
 
+        // Inclusive extent of the box, dimensions that the box lacks are unbounded. nullopt if the box could not be parsed.
+        // The spatial extent of a geodetic box is not in longitude and latitude, thus it is unbounded, too.
+        std::optional<SpatioTemporalBounds> getBounds() const;
 
     private:
         void* stbox_ptr;
@@ -78,11 +110,12 @@ class Meos {
         Temporal* instant;
     };
 
+    class EpochConverter;
     class StaticGeometry;
     class TemporalGeometry;
     class StaticGeometry {
     public:
-        explicit StaticGeometry(const std::string& wkt_string);
+        explicit StaticGeometry(std::string_view wkt_string);
         ~StaticGeometry();
 
         StaticGeometry(const StaticGeometry&) = delete;
@@ -92,6 +125,9 @@ class Meos {
 
         GSERIALIZED* getGeometry() const;
 
+        // nullopt if the geometry is empty or could not be parsed
+        std::optional<BoundingBox> getBoundingBox() const;
+
         int containsTemporal(const TemporalGeometry& temporal_geom) const;
         // int coversTemporal(const TemporalGeometry& temporal_geom) const;
 
@@ -101,7 +137,14 @@ class Meos {
 
     class TemporalGeometry {
     public:
-        explicit TemporalGeometry(const std::string& wkt_string);
+        explicit TemporalGeometry(std::string_view wkt_string);
+        /**
+         * @brief Create a temporal point instant directly from its coordinates, without formatting and parsing a WKT string
+         * @param epochLike timestamp since the Unix epoch in seconds, milliseconds, microseconds, or nanoseconds (see detectEpochUnit)
+         */
+        TemporalGeometry(double lon, double lat, unsigned long long epochLike, int srid = 4326);
+        // Same as above, but converts the timestamp in the unit that the converter detected for the stream
+        TemporalGeometry(double lon, double lat, unsigned long long epochLike, EpochConverter& converter, int srid = 4326);
         ~TemporalGeometry();
 
         TemporalGeometry(const TemporalGeometry&) = delete;
@@ -164,6 +207,49 @@ class Meos {
     };
 
 
+    /**
+     * @brief Index over a set of static geofences, e.g., stations, depots, or speed zones
+     * The geofences are the parts of one geometry collection or multi-geometry, a single geometry is a set with one geofence.
+     * The index buckets the bounding boxes of the geofences into a uniform grid once. A lookup evaluates the exact MEOS predicate
+     * only for the geofences whose bounding box contains the point, instead of for every geofence.
+     * The predicates return 1 if they hold for any geofence, 0 if they hold for none, and -1 if MEOS failed for a candidate
+     * and no other candidate matched.
+     */
+    class GeofenceIndex {
+    public:
+        explicit GeofenceIndex(std::string_view wkt_string);
+        ~GeofenceIndex();
+
+        GeofenceIndex(const GeofenceIndex&) = delete;
+        GeofenceIndex& operator=(const GeofenceIndex&) = delete;
+
+        size_t size() const { return geofences.size(); }
+
+        // aintersects_tgeo_geo(point, geofence)
+        int aintersects(const TemporalGeometry& point, double lon, double lat) const;
+        // econtains_geo_tgeo(geofence, point)
+        int containsTemporal(const TemporalGeometry& point, double lon, double lat) const;
+        // econtains_tgeo_geo(point, geofence)
+        int containedByTemporal(const TemporalGeometry& point, double lon, double lat) const;
+
+    private:
+        struct Geofence {
+            GSERIALIZED* geometry;
+            BoundingBox box;
+        };
+
+        template <typename Predicate>
+        int anyCandidate(double lon, double lat, const Predicate& predicate) const;
+
+        GSERIALIZED* collection = nullptr;
+        std::vector<Geofence> geofences;
+        // Indexes of the geofences whose bounding box overlaps a grid cell, row-major
+        std::vector<std::vector<uint32_t>> cells;
+        size_t columns = 0;
+        size_t rows = 0;
+        double gridXmin = 0, gridYmin = 0, cellWidth = 1, cellHeight = 1;
+    };
+
     class TemporalHolder {
     public:
         explicit TemporalHolder(Temporal* temporalPtr);
@@ -181,16 +267,45 @@ class Meos {
     };
 
 
-    // Format a UTC timestamp string from seconds since epoch
-    static std::string convertSecondsToTimestamp(long long seconds);
+    // Removes the quotes around a string constant, e.g., 'POINT(1 2)', without copying it
+    static std::string_view stripQuotes(std::string_view text);
+
+    // Unit of a timestamp since the Unix epoch
+    enum class EpochUnit : uint8_t { SECONDS, MILLISECONDS, MICROSECONDS, NANOSECONDS };
 
-    // Heuristically interpret an epoch-like value that may be in seconds,
-    // milliseconds, microseconds, or nanoseconds, and format as UTC.
+    // Heuristically detect the unit of an epoch-like value from its magnitude.
     // Common thresholds: 10 digits (seconds), 13 (ms), 16 (us), 19 (ns).
-    static std::string convertEpochToTimestamp(unsigned long long epochLike);
+    static EpochUnit detectEpochUnit(unsigned long long epochLike);
 
-    // Thread-safe wrappers around selected MEOS functions to avoid internal races
+    // Convert a timestamp since the Unix epoch in the given unit to the MEOS timestamp representation, i.e., microseconds
+    // since 2000-01-01T00:00:00Z, without formatting and parsing a timestamp string. Keeps sub-second precision up to
+    // microseconds and clamps to 2100-01-01 to avoid tz library failures.
+    static TimestampTz convertEpochToTimestampTz(unsigned long long epochLike, EpochUnit unit);
+
+    // Same as above, but detects the unit of every value separately. Prefer an EpochConverter for a stream of timestamps.
+    static TimestampTz convertEpochToTimestampTz(unsigned long long epochLike);
+
+    /**
+     * @brief Converts the timestamps of a stream to MEOS timestamps in the unit detected from the first timestamp
+     * The timestamps of a field share their unit, thus detecting it once per query keeps the conversion consistent, e.g.,
+     * for millisecond timestamps close to the epoch, and saves the detection per value.
+     * The copies of a physical function share their converter, thus the worker threads may call toTimestampTz concurrently.
+     * Racing first calls detect the unit from their own timestamps, one of them wins.
+     */
+    class EpochConverter {
+    public:
+        TimestampTz toTimestampTz(unsigned long long epochLike);
+        std::optional<EpochUnit> getUnit() const;
+
+    private:
+        static constexpr uint8_t UNDETECTED = UINT8_MAX;
+        std::atomic<uint8_t> unit{UNDETECTED};
+    };
+
+    // Wrappers around selected MEOS functions that initialize the session state of the calling thread before the call
     static int safe_edwithin_tgeo_geo(const Temporal* temp, const GSERIALIZED* gs, double dist);
+    // Same as safe_edwithin_tgeo_geo for a 2D point, which must have the same SRID as the temporal point
+    static int safe_edwithin_tgeo_point(const Temporal* temp, double lon, double lat, double dist, int srid = 4326);
     static int safe_eintersects_tgeo_geo(const Temporal* temp, const GSERIALIZED* gs);
     static Temporal* safe_tgeo_at_stbox(const Temporal* temp, const STBox* box, bool border_inc);
     
@@ -199,7 +314,7 @@ class Meos {
      * @param trajStr String representation of temporal point (e.g., "{Point(1.0 2.0)@2023-01-01 00:00:00}")
      * @return Void pointer to Temporal object, nullptr on failure. Caller must free with freeTemporalObject()
      */
-    static void* parseTemporalPoint(const std::string& trajStr);
+    static void* parseTemporalPoint(std::string_view trajStr);
     
     /**
      * @brief Free a MEOS Temporal object
@@ -216,7 +331,35 @@ class Meos {
     static uint8_t* temporalToWKB(void* temporal, size_t& size);
     
     /**
-     * @brief Ensure MEOS is initialized
+     * @brief Append a point instant to a trajectory, i.e., a temporal point sequence with discrete interpolation
+     * The trajectory grows in place (MEOS expandable sequence), thus appending in timestamp order does not copy the trajectory.
+     * Out-of-order instants are merged at their position.
+     * @param trajectory nullptr to start a new trajectory
+     * @param epochLike timestamp since the Unix epoch (see detectEpochUnit)
+     * @return the trajectory, which may have been reallocated. The previous trajectory must not be used afterwards.
+     *         Returns the unchanged trajectory if MEOS can not create or append the instant.
+     */
+    static Temporal* appendToTrajectory(Temporal* trajectory, double lon, double lat, unsigned long long epochLike, int srid = 0);
+    // Same as above, but converts the timestamp in the unit that the converter detected for the stream
+    static Temporal* appendToTrajectory(
+        Temporal* trajectory, double lon, double lat, unsigned long long epochLike, EpochConverter& converter, int srid = 0);
+
+    /**
+     * @brief Merge the instants of another trajectory into a trajectory
+     * @param trajectory nullptr, if the trajectory is empty. Otherwise, it is replaced by the merged trajectory.
+     * @param other is copied and stays valid
+     * @return the merged trajectory, or the unchanged trajectory if MEOS can not merge them
+     */
+    static Temporal* mergeTrajectories(Temporal* trajectory, const Temporal* other);
+
+    /**
+     * @brief Free a trajectory created by appendToTrajectory or mergeTrajectories
+     */
+    static void freeTrajectory(Temporal* trajectory);
+
+    /**
+     * @brief Ensure MEOS is initialized for the calling thread.
+     * The process-wide initialization runs exactly once, afterwards each thread initializes its own timezone cache and error handler.
      */
     static void ensureMeosInitialized();
     
@@ -0,0 +1,168 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <ArrowFileSink.hpp>
+
+#include <memory>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include <arrow/io/file.h>
+#include <arrow/ipc/writer.h>
+#include <arrow/memory_pool.h>
+#include <arrow/util/compression.h>
+#include <fmt/format.h>
+#include <parquet/arrow/writer.h>
+#include <parquet/properties.h>
+
+#include <Configurations/Descriptor.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Sinks/SinkDescriptor.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <ErrorHandling.hpp>
+#include <PipelineExecutionContext.hpp>
+#include <SinkRegistry.hpp>
+#include <SinkValidationRegistry.hpp>
+
+namespace NES
+{
+
+ArrowFileSink::ArrowFileSink(const SinkDescriptor& sinkDescriptor, const Container container)
+    : outputFilePath(sinkDescriptor.getFromConfig(SinkDescriptor::FILE_PATH)), container(container), batchBuilder(*sinkDescriptor.getSchema())
+{
+    if (container == Container::PARQUET)
+    {
+        rowGroupSize = sinkDescriptor.getFromConfig(ConfigParametersParquetSink::ROW_GROUP_SIZE);
+        compression = sinkDescriptor.getFromConfig(ConfigParametersParquetSink::COMPRESSION);
+    }
+}
+
+std::ostream& ArrowFileSink::toString(std::ostream& str) const
+{
+    str << fmt::format(
+        "ArrowFileSink(filePathOutput: {}, container: {}, writtenBatches: {})",
+        outputFilePath,
+        container == Container::PARQUET ? PARQUET_NAME : ARROW_IPC_NAME,
+        writer.rlock()->numberOfWrittenBatches);
+    return str;
+}
+
+void ArrowFileSink::start(PipelineExecutionContext&)
+{
+    NES_DEBUG("Setting up arrow file sink: {}", *this);
+    auto lockedWriter = writer.wlock();
+    auto outputStream = arrow::io::FileOutputStream::Open(outputFilePath);
+    if (not outputStream.ok())
+    {
+        throw CannotOpenSink("Could not open output file; filePathOutput={}: {}", outputFilePath, outputStream.status().ToString());
+    }
+    lockedWriter->outputStream = std::move(outputStream).ValueUnsafe();
+
+    if (container == Container::ARROW_IPC)
+    {
+        auto ipcWriter = arrow::ipc::MakeFileWriter(lockedWriter->outputStream, batchBuilder.getArrowSchema());
+        if (not ipcWriter.ok())
+        {
+            throw CannotOpenSink("Could not create an Arrow IPC writer for {}: {}", outputFilePath, ipcWriter.status().ToString());
+        }
+        lockedWriter->ipcWriter = std::move(ipcWriter).ValueUnsafe();
+        return;
+    }
+
+    const auto compressionType = arrow::util::Codec::GetCompressionType(compression);
+    if (not compressionType.ok() or not arrow::util::Codec::IsAvailable(compressionType.ValueUnsafe()))
+    {
+        throw CannotOpenSink("The Parquet compression {} is not available", compression);
+    }
+    const auto properties
+        = parquet::WriterProperties::Builder().compression(compressionType.ValueUnsafe())->max_row_group_length(rowGroupSize)->build();
+    auto parquetWriter = parquet::arrow::FileWriter::Open(
+        *batchBuilder.getArrowSchema(), arrow::default_memory_pool(), lockedWriter->outputStream, properties);
+    if (not parquetWriter.ok())
+    {
+        throw CannotOpenSink("Could not create a Parquet writer for {}: {}", outputFilePath, parquetWriter.status().ToString());
+    }
+    lockedWriter->parquetWriter = std::move(parquetWriter).ValueUnsafe();
+}
+
+void ArrowFileSink::execute(const TupleBuffer& inputTupleBuffer, PipelineExecutionContext&)
+{
+    PRECONDITION(inputTupleBuffer, "Invalid input buffer in ArrowFileSink.");
+    if (inputTupleBuffer.getNumberOfTuples() == 0)
+    {
+        return;
+    }
+
+    const auto batch = batchBuilder.build(inputTupleBuffer);
+    auto lockedWriter = writer.wlock();
+    PRECONDITION(lockedWriter->outputStream != nullptr, "Sink was not opened");
+    const auto status = container == Container::ARROW_IPC ? lockedWriter->ipcWriter->WriteRecordBatch(*batch)
+                                                          : lockedWriter->parquetWriter->WriteRecordBatch(*batch);
+    if (not status.ok())
+    {
+        throw CannotWriteToSink("Could not write a record batch to {}: {}", outputFilePath, status.ToString());
+    }
+    ++lockedWriter->numberOfWrittenBatches;
+}
+
+void ArrowFileSink::stop(PipelineExecutionContext&)
+{
+    NES_DEBUG("Closing arrow file sink, filePathOutput={}", outputFilePath);
+    auto lockedWriter = writer.wlock();
+    /// Closing the writers writes the footer of the file
+    auto status = arrow::Status::OK();
+    if (lockedWriter->ipcWriter != nullptr)
+    {
+        status = lockedWriter->ipcWriter->Close();
+    }
+    if (lockedWriter->parquetWriter != nullptr)
+    {
+        status = lockedWriter->parquetWriter->Close();
+    }
+    if (lockedWriter->outputStream != nullptr and not lockedWriter->outputStream->closed())
+    {
+        status &= lockedWriter->outputStream->Close();
+    }
+    lockedWriter->ipcWriter.reset();
+    lockedWriter->parquetWriter.reset();
+    lockedWriter->outputStream.reset();
+    if (not status.ok())
+    {
+        throw CannotWriteToSink("Could not finish the file {}: {}", outputFilePath, status.ToString());
+    }
+}
+
+SinkValidationRegistryReturnType RegisterArrowIPCSinkValidation(SinkValidationRegistryArguments sinkConfig)
+{
+    return DescriptorConfig::validateAndFormat<ConfigParametersArrowIPCSink>(std::move(sinkConfig.config), ArrowFileSink::ARROW_IPC_NAME);
+}
+
+SinkRegistryReturnType RegisterArrowIPCSink(SinkRegistryArguments sinkRegistryArguments)
+{
+    return std::make_unique<ArrowFileSink>(sinkRegistryArguments.sinkDescriptor, ArrowFileSink::Container::ARROW_IPC);
+}
+
+SinkValidationRegistryReturnType RegisterParquetSinkValidation(SinkValidationRegistryArguments sinkConfig)
+{
+    return DescriptorConfig::validateAndFormat<ConfigParametersParquetSink>(std::move(sinkConfig.config), ArrowFileSink::PARQUET_NAME);
+}
+
+SinkRegistryReturnType RegisterParquetSink(SinkRegistryArguments sinkRegistryArguments)
+{
+    return std::make_unique<ArrowFileSink>(sinkRegistryArguments.sinkDescriptor, ArrowFileSink::Container::PARQUET);
+}
+
+}
@@ -0,0 +1,130 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include <arrow/io/file.h>
+#include <arrow/ipc/writer.h>
+#include <parquet/arrow/writer.h>
+
+#include <Configurations/Descriptor.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Sinks/Sink.hpp>
+#include <Sinks/SinkDescriptor.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <folly/Synchronized.h>
+#include <PipelineExecutionContext.hpp>
+#include <RowRecordBatchBuilder.hpp>
+
+namespace NES
+{
+
+/// Writes the result buffers as Arrow IPC or Parquet file, which downstream consumers read without parsing text.
+/// The worker threads convert their buffers into record batches without holding a lock, c.f., RowRecordBatchBuilder, while the writer of the
+/// file is shared. The IPC sink writes every buffer as one record batch. The Parquet sink buffers the batches into row groups of
+/// 'parquet_row_group_size' rows and compresses the columns with 'parquet_compression'.
+/// Both containers write their footer when the sink stops, thus the file is readable solely after the query stopped.
+class ArrowFileSink final : public Sink
+{
+public:
+    enum class Container : uint8_t
+    {
+        ARROW_IPC,
+        PARQUET
+    };
+
+    static constexpr std::string_view ARROW_IPC_NAME = "ArrowIPC";
+    static constexpr std::string_view PARQUET_NAME = "Parquet";
+
+    ArrowFileSink(const SinkDescriptor& sinkDescriptor, Container container);
+    ~ArrowFileSink() override = default;
+
+    ArrowFileSink(const ArrowFileSink&) = delete;
+    ArrowFileSink& operator=(const ArrowFileSink&) = delete;
+    ArrowFileSink(ArrowFileSink&&) = delete;
+    ArrowFileSink& operator=(ArrowFileSink&&) = delete;
+
+    void start(PipelineExecutionContext& pipelineExecutionContext) override;
+    void execute(const TupleBuffer& inputTupleBuffer, PipelineExecutionContext& pipelineExecutionContext) override;
+    void stop(PipelineExecutionContext& pipelineExecutionContext) override;
+
+protected:
+    std::ostream& toString(std::ostream& str) const override;
+
+private:
+    struct Writer
+    {
+        std::shared_ptr<arrow::io::FileOutputStream> outputStream;
+        std::shared_ptr<arrow::ipc::RecordBatchWriter> ipcWriter;
+        std::unique_ptr<parquet::arrow::FileWriter> parquetWriter;
+        uint64_t numberOfWrittenBatches{0};
+    };
+
+    std::string outputFilePath;
+    Container container;
+    int64_t rowGroupSize{0};
+    std::string compression;
+    RowRecordBatchBuilder batchBuilder;
+    folly::Synchronized<Writer> writer;
+};
+
+struct ConfigParametersArrowIPCSink
+{
+    static inline std::unordered_map<std::string, DescriptorConfig::ConfigParameterContainer> parameterMap
+        = DescriptorConfig::createConfigParameterContainerMap(SinkDescriptor::parameterMap, SinkDescriptor::FILE_PATH);
+};
+
+struct ConfigParametersParquetSink
+{
+    static inline const DescriptorConfig::ConfigParameter<int64_t> ROW_GROUP_SIZE{
+        "parquet_row_group_size",
+        1024 * 1024,
+        [](const std::unordered_map<std::string, std::string>& config) -> std::optional<int64_t>
+        {
+            const auto rowGroupSize = DescriptorConfig::tryGet(ROW_GROUP_SIZE, config);
+            if (rowGroupSize.has_value() and rowGroupSize.value() <= 0)
+            {
+                NES_ERROR("ParquetSink row group size is {}, but must be positive", rowGroupSize.value());
+                return std::nullopt;
+            }
+            return rowGroupSize;
+        }};
+
+    /// One of the codecs of Arrow, e.g., 'uncompressed', 'snappy', 'zstd', or 'lz4'
+    static inline const DescriptorConfig::ConfigParameter<std::string> COMPRESSION{
+        "parquet_compression",
+        "snappy",
+        [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(COMPRESSION, config); }};
+
+    static inline std::unordered_map<std::string, DescriptorConfig::ConfigParameterContainer> parameterMap
+        = DescriptorConfig::createConfigParameterContainerMap(SinkDescriptor::parameterMap, SinkDescriptor::FILE_PATH, ROW_GROUP_SIZE, COMPRESSION);
+};
+
+}
+
+namespace fmt
+{
+template <>
+struct formatter<NES::ArrowFileSink> : ostream_formatter
+{
+};
+}
@@ -0,0 +1,172 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <RowRecordBatchBuilder.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <arrow/buffer.h>
+#include <arrow/memory_pool.h>
+#include <arrow/record_batch.h>
+#include <arrow/type.h>
+#include <arrow/util/bit_util.h>
+
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <ErrorHandling.hpp>
+
+namespace NES
+{
+
+namespace
+{
+std::shared_ptr<arrow::DataType> toArrowType(const DataType::Type type)
+{
+    switch (type)
+    {
+        case DataType::Type::BOOLEAN:
+            return arrow::boolean();
+        case DataType::Type::CHAR:
+        case DataType::Type::INT8:
+            return arrow::int8();
+        case DataType::Type::UINT8:
+            return arrow::uint8();
+        case DataType::Type::UINT16:
+            return arrow::uint16();
+        case DataType::Type::INT16:
+            return arrow::int16();
+        case DataType::Type::UINT32:
+            return arrow::uint32();
+        case DataType::Type::INT32:
+            return arrow::int32();
+        case DataType::Type::UINT64:
+            return arrow::uint64();
+        case DataType::Type::INT64:
+            return arrow::int64();
+        case DataType::Type::FLOAT32:
+            return arrow::float32();
+        case DataType::Type::FLOAT64:
+            return arrow::float64();
+        case DataType::Type::VARSIZED:
+        case DataType::Type::VARSIZED_POINTER_REP:
+        case DataType::Type::UNDEFINED:
+            return nullptr;
+    }
+    std::unreachable();
+}
+
+/// The size is a template parameter, thus each memcpy becomes a single load and store
+template <size_t SizeInBytes>
+void gatherColumn(const std::byte* rows, const size_t tupleSizeInBytes, const size_t numberOfRows, std::byte* column)
+{
+    for (size_t row = 0; row < numberOfRows; ++row)
+    {
+        std::memcpy(column + (row * SizeInBytes), rows + (row * tupleSizeInBytes), SizeInBytes);
+    }
+}
+}
+
+RowRecordBatchBuilder::RowRecordBatchBuilder(const Schema& schema)
+{
+    std::vector<std::shared_ptr<arrow::Field>> arrowFields;
+    for (const auto& field : schema.getFields())
+    {
+        auto arrowType = toArrowType(field.dataType.type);
+        if (arrowType == nullptr)
+        {
+            throw UnknownSinkFormat("Arrow sinks do not support the field {} of type {}", field.name, field.dataType);
+        }
+        const auto sizeInBytes = field.dataType.getSizeInBytes();
+        fields.emplace_back(field.dataType.type, tupleSizeInBytes, sizeInBytes);
+        tupleSizeInBytes += sizeInBytes;
+        arrowFields.emplace_back(arrow::field(field.getUnqualifiedName(), std::move(arrowType), false));
+    }
+    arrowSchema = arrow::schema(std::move(arrowFields));
+}
+
+const std::shared_ptr<arrow::Schema>& RowRecordBatchBuilder::getArrowSchema() const
+{
+    return arrowSchema;
+}
+
+std::shared_ptr<arrow::RecordBatch> RowRecordBatchBuilder::build(const TupleBuffer& buffer) const
+{
+    const auto numberOfRows = buffer.getNumberOfTuples();
+    const auto* rows = buffer.getAvailableMemoryArea<std::byte>().data();
+    std::vector<std::shared_ptr<arrow::ArrayData>> columns;
+    columns.reserve(fields.size());
+    for (size_t fieldIdx = 0; fieldIdx < fields.size(); ++fieldIdx)
+    {
+        columns.emplace_back(buildColumn(fields[fieldIdx], arrowSchema->field(static_cast<int>(fieldIdx))->type(), rows, numberOfRows));
+    }
+    return arrow::RecordBatch::Make(arrowSchema, static_cast<int64_t>(numberOfRows), std::move(columns));
+}
+
+std::shared_ptr<arrow::ArrayData> RowRecordBatchBuilder::buildColumn(
+    const Field& field, const std::shared_ptr<arrow::DataType>& arrowType, const std::byte* rows, const size_t numberOfRows) const
+{
+    const auto* fieldOfFirstRow = rows + field.offsetInRow;
+    if (field.type == DataType::Type::BOOLEAN)
+    {
+        /// Arrow packs booleans into bits
+        auto bitmap = arrow::AllocateEmptyBitmap(static_cast<int64_t>(numberOfRows), arrow::default_memory_pool());
+        if (not bitmap.ok())
+        {
+            throw CannotWriteToSink("Could not allocate a column of {} booleans: {}", numberOfRows, bitmap.status().ToString());
+        }
+        auto* bits = bitmap.ValueUnsafe()->mutable_data();
+        for (size_t row = 0; row < numberOfRows; ++row)
+        {
+            if (fieldOfFirstRow[row * tupleSizeInBytes] != std::byte{0})
+            {
+                arrow::bit_util::SetBit(bits, static_cast<int64_t>(row));
+            }
+        }
+        return arrow::ArrayData::Make(arrowType, static_cast<int64_t>(numberOfRows), {nullptr, std::move(bitmap).ValueUnsafe()}, 0);
+    }
+
+    auto values = arrow::AllocateBuffer(static_cast<int64_t>(numberOfRows * field.sizeInBytes), arrow::default_memory_pool());
+    if (not values.ok())
+    {
+        throw CannotWriteToSink("Could not allocate a column of {} values: {}", numberOfRows, values.status().ToString());
+    }
+    auto* column = reinterpret_cast<std::byte*>(values.ValueUnsafe()->mutable_data()); /// NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    switch (field.sizeInBytes)
+    {
+        case 1:
+            gatherColumn<1>(fieldOfFirstRow, tupleSizeInBytes, numberOfRows, column);
+            break;
+        case 2:
+            gatherColumn<2>(fieldOfFirstRow, tupleSizeInBytes, numberOfRows, column);
+            break;
+        case 4:
+            gatherColumn<4>(fieldOfFirstRow, tupleSizeInBytes, numberOfRows, column);
+            break;
+        case 8:
+            gatherColumn<8>(fieldOfFirstRow, tupleSizeInBytes, numberOfRows, column);
+            break;
+        default:
+            INVARIANT(false, "Unexpected size {} of a fixed-size field", field.sizeInBytes);
+    }
+    return arrow::ArrayData::Make(
+        arrowType, static_cast<int64_t>(numberOfRows), {nullptr, std::shared_ptr<arrow::Buffer>(std::move(values).ValueUnsafe())}, 0);
+}
+
+}
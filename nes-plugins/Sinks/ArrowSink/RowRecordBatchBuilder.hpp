@@ -0,0 +1,62 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <arrow/record_batch.h>
+#include <arrow/type.h>
+
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Runtime/TupleBuffer.hpp>
+
+namespace NES
+{
+
+/// Converts the native rows of TupleBuffers into Arrow record batches, i.e., the reverse of the RecordBatchRowWriter of the Arrow sources.
+/// The builder gathers each field into a contiguous column with a single strided pass over the rows, instead of formatting the buffer tuple
+/// by tuple. The columns are named after the unqualified names of the fields, thus the Arrow sources read the written files with the same
+/// schema. CHAR fields become INT8 columns and BOOLEAN fields bit-packed BOOL columns.
+class RowRecordBatchBuilder
+{
+public:
+    /// @throws UnknownSinkFormat if the schema contains a variable-sized field
+    explicit RowRecordBatchBuilder(const Schema& schema);
+
+    [[nodiscard]] const std::shared_ptr<arrow::Schema>& getArrowSchema() const;
+
+    /// @throws CannotWriteToSink if Arrow cannot allocate the columns
+    [[nodiscard]] std::shared_ptr<arrow::RecordBatch> build(const TupleBuffer& buffer) const;
+
+private:
+    struct Field
+    {
+        DataType::Type type;
+        size_t offsetInRow;
+        size_t sizeInBytes;
+    };
+
+    [[nodiscard]] std::shared_ptr<arrow::ArrayData>
+    buildColumn(const Field& field, const std::shared_ptr<arrow::DataType>& arrowType, const std::byte* rows, size_t numberOfRows) const;
+
+    std::vector<Field> fields;
+    size_t tupleSizeInBytes{0};
+    std::shared_ptr<arrow::Schema> arrowSchema;
+};
+
+}
@@ -0,0 +1,169 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include <arrow/api.h>
+
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/DataTypeProvider.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+#include <ErrorHandling.hpp>
+#include <RecordBatchRowWriter.hpp>
+#include <RowRecordBatchBuilder.hpp>
+
+namespace NES
+{
+
+class RowRecordBatchBuilderTest : public Testing::BaseUnitTest
+{
+public:
+    /// The native rows pack the fields of the schema without padding
+    static constexpr size_t ID_OFFSET = 0;
+    static constexpr size_t VALUE_OFFSET = ID_OFFSET + sizeof(uint64_t);
+    static constexpr size_t FLAG_OFFSET = VALUE_OFFSET + sizeof(int32_t);
+    static constexpr size_t LETTER_OFFSET = FLAG_OFFSET + sizeof(bool);
+    static constexpr size_t PRICE_OFFSET = LETTER_OFFSET + sizeof(char);
+    static constexpr size_t TUPLE_SIZE = PRICE_OFFSET + sizeof(float);
+    /// Not a multiple of eight, thus the last byte of the bit-packed booleans is partially used
+    static constexpr size_t NUMBER_OF_TUPLES = 13;
+
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("RowRecordBatchBuilderTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup RowRecordBatchBuilderTest test class.");
+    }
+
+    void SetUp() override
+    {
+        BaseUnitTest::SetUp();
+        schema.addField("id", DataTypeProvider::provideDataType(DataType::Type::UINT64));
+        schema.addField("value", DataTypeProvider::provideDataType(DataType::Type::INT32));
+        schema.addField("flag", DataTypeProvider::provideDataType(DataType::Type::BOOLEAN));
+        schema.addField("letter", DataTypeProvider::provideDataType(DataType::Type::CHAR));
+        schema.addField("price", DataTypeProvider::provideDataType(DataType::Type::FLOAT32));
+        ASSERT_EQ(schema.getSizeOfSchemaInBytes(), TUPLE_SIZE);
+    }
+
+    static uint64_t idOf(const size_t tuple) { return tuple * 3; }
+    static int32_t valueOf(const size_t tuple) { return static_cast<int32_t>(tuple) - 5; }
+    static bool flagOf(const size_t tuple) { return tuple % 3 == 0; }
+    static char letterOf(const size_t tuple) { return static_cast<char>('a' + tuple); }
+    static float priceOf(const size_t tuple) { return static_cast<float>(tuple) * 0.25F; }
+
+    TupleBuffer createBuffer(const size_t numberOfTuples) const
+    {
+        auto buffer = bufferManager->getBufferBlocking();
+        auto* const rows = buffer.getAvailableMemoryArea<std::byte>().data();
+        for (size_t tuple = 0; tuple < numberOfTuples; ++tuple)
+        {
+            auto* const row = rows + (tuple * TUPLE_SIZE);
+            const auto id = idOf(tuple);
+            const auto value = valueOf(tuple);
+            const auto flag = flagOf(tuple);
+            const auto letter = letterOf(tuple);
+            const auto price = priceOf(tuple);
+            std::memcpy(row + ID_OFFSET, &id, sizeof(id));
+            std::memcpy(row + VALUE_OFFSET, &value, sizeof(value));
+            std::memcpy(row + FLAG_OFFSET, &flag, sizeof(flag));
+            std::memcpy(row + LETTER_OFFSET, &letter, sizeof(letter));
+            std::memcpy(row + PRICE_OFFSET, &price, sizeof(price));
+        }
+        buffer.setNumberOfTuples(numberOfTuples);
+        return buffer;
+    }
+
+    Schema schema;
+    std::shared_ptr<BufferManager> bufferManager = BufferManager::create();
+};
+
+TEST_F(RowRecordBatchBuilderTest, BuildsTypedColumnsNamedAfterTheFields)
+{
+    const RowRecordBatchBuilder builder(schema);
+    const auto batch = builder.build(createBuffer(NUMBER_OF_TUPLES));
+
+    ASSERT_EQ(batch->num_rows(), static_cast<int64_t>(NUMBER_OF_TUPLES));
+    ASSERT_TRUE(batch->ValidateFull().ok());
+    EXPECT_TRUE(batch->schema()->Equals(*builder.getArrowSchema()));
+    EXPECT_TRUE(batch->schema()->Equals(*arrow::schema(
+        {arrow::field("id", arrow::uint64(), false),
+         arrow::field("value", arrow::int32(), false),
+         arrow::field("flag", arrow::boolean(), false),
+         arrow::field("letter", arrow::int8(), false),
+         arrow::field("price", arrow::float32(), false)})));
+
+    const auto& ids = static_cast<const arrow::UInt64Array&>(*batch->column(0));
+    const auto& values = static_cast<const arrow::Int32Array&>(*batch->column(1));
+    const auto& flags = static_cast<const arrow::BooleanArray&>(*batch->column(2));
+    const auto& letters = static_cast<const arrow::Int8Array&>(*batch->column(3));
+    const auto& prices = static_cast<const arrow::FloatArray&>(*batch->column(4));
+    for (size_t tuple = 0; tuple < NUMBER_OF_TUPLES; ++tuple)
+    {
+        const auto row = static_cast<int64_t>(tuple);
+        EXPECT_EQ(ids.Value(row), idOf(tuple)) << "tuple " << tuple;
+        EXPECT_EQ(values.Value(row), valueOf(tuple)) << "tuple " << tuple;
+        EXPECT_EQ(flags.Value(row), flagOf(tuple)) << "tuple " << tuple;
+        EXPECT_EQ(letters.Value(row), static_cast<int8_t>(letterOf(tuple))) << "tuple " << tuple;
+        EXPECT_EQ(prices.Value(row), priceOf(tuple)) << "tuple " << tuple;
+    }
+    for (int column = 0; column < batch->num_columns(); ++column)
+    {
+        EXPECT_EQ(batch->column(column)->null_count(), 0);
+    }
+}
+
+TEST_F(RowRecordBatchBuilderTest, RecordBatchRowWriterRestoresTheRows)
+{
+    const RowRecordBatchBuilder builder(schema);
+    const auto buffer = createBuffer(NUMBER_OF_TUPLES);
+    const auto batch = builder.build(buffer);
+
+    /// The Arrow sources read the files of the Arrow sinks with the same schema, thus the round trip yields the original rows
+    auto reader = arrow::RecordBatchReader::Make({batch}, builder.getArrowSchema()).ValueOrDie();
+    RecordBatchRowWriter rowWriter(schema);
+    std::vector<std::byte> restoredRows(NUMBER_OF_TUPLES * TUPLE_SIZE);
+    ASSERT_EQ(rowWriter.writeRows(*reader, restoredRows), restoredRows.size());
+
+    const auto originalRows = buffer.getAvailableMemoryArea<std::byte>().first(NUMBER_OF_TUPLES * TUPLE_SIZE);
+    EXPECT_EQ(std::memcmp(restoredRows.data(), originalRows.data(), restoredRows.size()), 0);
+}
+
+TEST_F(RowRecordBatchBuilderTest, BuildsEmptyBatchForEmptyBuffer)
+{
+    const RowRecordBatchBuilder builder(schema);
+    const auto batch = builder.build(createBuffer(0));
+    EXPECT_EQ(batch->num_rows(), 0);
+    EXPECT_EQ(batch->num_columns(), 5);
+    EXPECT_TRUE(batch->ValidateFull().ok());
+}
+
+TEST_F(RowRecordBatchBuilderTest, RejectsVariableSizedFields)
+{
+    schema.addField("name", DataTypeProvider::provideDataType(DataType::Type::VARSIZED));
+    ASSERT_EXCEPTION_ERRORCODE(const RowRecordBatchBuilder builder(schema), ErrorCode::UnknownSinkFormat);
+}
+
+}
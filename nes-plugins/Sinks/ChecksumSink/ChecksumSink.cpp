@@ -14,18 +14,26 @@
 
 #include <ChecksumSink.hpp>
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <filesystem>
 #include <iostream>
 #include <memory>
+#include <span>
 #include <string>
+#include <string_view>
 #include <system_error>
 #include <unordered_map>
 #include <utility>
 #include <Configurations/Descriptor.hpp>
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/Schema.hpp>
+#include <MemoryLayout/MemoryLayout.hpp>
+#include <MemoryLayout/VariableSizedAccess.hpp>
 #include <Runtime/TupleBuffer.hpp>
 #include <Sinks/SinkDescriptor.hpp>
-#include <SinksParsing/CSVFormat.hpp>
 #include <Util/Logger/Logger.hpp>
 #include <fmt/ostream.h>
 #include <ErrorHandling.hpp>
@@ -36,11 +44,82 @@
 namespace NES
 {
 
+namespace
+{
+/// Fields of a tuple are not necessarily aligned to their type
+template <typename T>
+T readField(const std::byte* field)
+{
+    T value;
+    std::memcpy(&value, field, sizeof(T));
+    return value;
+}
+
+struct FieldChecksum
+{
+    size_t checksum = 0;
+    /// Newlines within var sized data count as tuples, as the systest checksum tool counts the lines of the CSV file
+    size_t numberOfNewlines = 0;
+};
+
+/// Accumulates the checksum of the field, as formatted by the CSVFormat with escaped strings
+FieldChecksum fieldChecksum(const TupleBuffer& buffer, const DataType& type, const std::byte* field)
+{
+    switch (type.type)
+    {
+        case DataType::Type::INT8:
+            return {.checksum = Checksum::decimalCharacterSum(static_cast<int64_t>(readField<int8_t>(field)))};
+        case DataType::Type::INT16:
+            return {.checksum = Checksum::decimalCharacterSum(static_cast<int64_t>(readField<int16_t>(field)))};
+        case DataType::Type::INT32:
+            return {.checksum = Checksum::decimalCharacterSum(static_cast<int64_t>(readField<int32_t>(field)))};
+        case DataType::Type::INT64:
+            return {.checksum = Checksum::decimalCharacterSum(readField<int64_t>(field))};
+        case DataType::Type::UINT8:
+            return {.checksum = Checksum::decimalCharacterSum(static_cast<uint64_t>(readField<uint8_t>(field)))};
+        case DataType::Type::UINT16:
+            return {.checksum = Checksum::decimalCharacterSum(static_cast<uint64_t>(readField<uint16_t>(field)))};
+        case DataType::Type::UINT32:
+            return {.checksum = Checksum::decimalCharacterSum(static_cast<uint64_t>(readField<uint32_t>(field)))};
+        case DataType::Type::UINT64:
+            return {.checksum = Checksum::decimalCharacterSum(readField<uint64_t>(field))};
+        case DataType::Type::BOOLEAN:
+            return {.checksum = readField<bool>(field) ? static_cast<size_t>('1') : static_cast<size_t>('0')};
+        case DataType::Type::VARSIZED: {
+            /// Reads the var sized data in place, i.e., inlined in the field or in the child buffer, without copying it
+            const auto varSizedField = std::span{field, sizeof(VariableSizedAccess)}.first<sizeof(VariableSizedAccess)>();
+            const auto data = MemoryLayout::loadVarSizedField(buffer, varSizedField).subspan(sizeof(uint32_t));
+            const std::string_view text{reinterpret_cast<const char*>(data.data()), data.size()};
+            return {
+                .checksum = (2 * static_cast<size_t>('"')) + Checksum::characterSum(text),
+                .numberOfNewlines = static_cast<size_t>(std::ranges::count(text, '\n'))};
+        }
+        case DataType::Type::FLOAT32:
+        case DataType::Type::FLOAT64:
+        case DataType::Type::CHAR:
+        case DataType::Type::VARSIZED_POINTER_REP:
+        case DataType::Type::UNDEFINED:
+            /// Floating points and chars are rare in results validated by checksums, thus they take the formatting path
+            return {.checksum = Checksum::characterSum(type.formattedBytesToString(field))};
+    }
+    std::unreachable();
+}
+}
+
 ChecksumSink::ChecksumSink(const SinkDescriptor& sinkDescriptor)
     : isOpen(false)
     , outputFilePath(sinkDescriptor.getFromConfig(SinkDescriptor::FILE_PATH))
-    , formatter(std::make_unique<CSVFormat>(*sinkDescriptor.getSchema(), true))
+    , tupleSizeInBytes(sinkDescriptor.getSchema()->getSizeOfSchemaInBytes())
 {
+    const auto& schema = *sinkDescriptor.getSchema();
+    PRECONDITION(schema.getNumberOfFields() != 0, "ChecksumSink expected a non-empty schema");
+    size_t offset = 0;
+    for (const auto& field : schema.getFields())
+    {
+        fieldTypes.push_back(field.dataType);
+        fieldOffsets.push_back(offset);
+        offset += field.dataType.getSizeInBytes();
+    }
 }
 
 void ChecksumSink::start(PipelineExecutionContext&)
@@ -84,8 +163,24 @@ void ChecksumSink::stop(PipelineExecutionContext&)
 void ChecksumSink::execute(const TupleBuffer& inputBuffer, PipelineExecutionContext&)
 {
     PRECONDITION(inputBuffer, "Invalid input buffer in ChecksumSink.");
-    const std::string formatted = formatter->getFormattedBuffer(inputBuffer);
-    checksum.add(formatted);
+    const auto numberOfTuples = inputBuffer.getNumberOfTuples();
+    const auto memory = inputBuffer.getAvailableMemoryArea().subspan(0, numberOfTuples * tupleSizeInBytes);
+
+    /// Every tuple is formatted with a comma between its fields and a trailing newline
+    const auto separatorChecksum = ((fieldTypes.size() - 1) * static_cast<size_t>(',')) + static_cast<size_t>('\n');
+    size_t bufferChecksum = numberOfTuples * separatorChecksum;
+    size_t bufferNumberOfTuples = numberOfTuples;
+    for (size_t tupleIndex = 0; tupleIndex < numberOfTuples; ++tupleIndex)
+    {
+        const auto tuple = memory.subspan(tupleIndex * tupleSizeInBytes, tupleSizeInBytes);
+        for (size_t fieldIndex = 0; fieldIndex < fieldTypes.size(); ++fieldIndex)
+        {
+            const auto [fieldSum, numberOfNewlines] = fieldChecksum(inputBuffer, fieldTypes[fieldIndex], &tuple[fieldOffsets[fieldIndex]]);
+            bufferChecksum += fieldSum;
+            bufferNumberOfTuples += numberOfNewlines;
+        }
+    }
+    checksum.add(bufferNumberOfTuples, bufferChecksum);
 }
 
 DescriptorConfig::Config ChecksumSink::validateAndFormat(std::unordered_map<std::string, std::string> config)
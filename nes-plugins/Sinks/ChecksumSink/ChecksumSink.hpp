@@ -16,17 +16,17 @@
 
 #include <cstddef>
 #include <fstream>
-#include <memory>
 #include <optional>
 #include <ostream>
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <vector>
 #include <Configurations/Descriptor.hpp>
+#include <DataTypes/DataType.hpp>
 #include <Runtime/TupleBuffer.hpp>
 #include <Sinks/Sink.hpp>
 #include <Sinks/SinkDescriptor.hpp>
-#include <SinksParsing/Format.hpp>
 #include <Util/Logger/Formatter.hpp>
 #include <Checksum.hpp>
 #include <PipelineExecutionContext.hpp>
@@ -38,6 +38,8 @@ namespace NES
 /// Example output of the sink:
 /// S$Count:UINT64,S$Checksum:UINT64
 /// 1042, 12390478290
+/// The checksum equals the one of the CSV representation of the tuples (c.f. the systest checksum tool), but the sink accumulates it from
+/// the native tuples without formatting them. As the checksum is a sum, the sink may process buffers in any order on multiple workers.
 class ChecksumSink : public Sink
 {
 public:
@@ -58,7 +60,9 @@ private:
     std::string outputFilePath;
     std::ofstream outputFileStream;
     Checksum checksum;
-    std::unique_ptr<Format> formatter;
+    std::vector<DataType> fieldTypes;
+    std::vector<size_t> fieldOffsets;
+    size_t tupleSizeInBytes;
 };
 
 struct ConfigParametersChecksum
@@ -0,0 +1,238 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <KafkaSink.hpp>
+
+#include <array>
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+#include <fmt/format.h>
+#include <librdkafka/rdkafka.h>
+
+#include <Configurations/Descriptor.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Sinks/Sink.hpp>
+#include <Sinks/SinkDescriptor.hpp>
+#include <SinksParsing/CSVFormat.hpp>
+#include <SinksParsing/JSONFormat.hpp>
+#include <SinksParsing/NativeFormat.hpp>
+#include <Util/Strings.hpp>
+#include <ErrorHandling.hpp>
+#include <PipelineExecutionContext.hpp>
+#include <SinkRegistry.hpp>
+#include <SinkValidationRegistry.hpp>
+
+namespace NES
+{
+
+namespace
+{
+void setProperty(rd_kafka_conf_t& configuration, const std::string& key, const std::string& value)
+{
+    std::array<char, 512> error{};
+    if (rd_kafka_conf_set(&configuration, key.c_str(), value.c_str(), error.data(), error.size()) != RD_KAFKA_CONF_OK)
+    {
+        throw CannotOpenSink("Invalid Kafka property {}={}: {}", key, value, error.data());
+    }
+}
+
+/// Sets the 'key=value' pairs of the properties, which are separated by ';'
+void setProperties(rd_kafka_conf_t& configuration, const std::string_view properties)
+{
+    for (const auto property : Util::splitWithStringDelimiter<std::string_view>(properties, ";"))
+    {
+        const auto trimmedProperty = Util::trimWhiteSpaces(property);
+        if (trimmedProperty.empty())
+        {
+            continue;
+        }
+        const auto separator = trimmedProperty.find('=');
+        if (separator == std::string_view::npos)
+        {
+            throw CannotOpenSink("Kafka property '{}' is not of the form 'key=value'", trimmedProperty);
+        }
+        setProperty(
+            configuration,
+            std::string(Util::trimWhiteSpaces(trimmedProperty.substr(0, separator))),
+            std::string(Util::trimWhiteSpaces(trimmedProperty.substr(separator + 1))));
+    }
+}
+}
+
+KafkaSink::KafkaSink(const SinkDescriptor& sinkDescriptor)
+    : Sink()
+    , brokers(sinkDescriptor.getFromConfig(ConfigParametersKafkaSink::BROKERS))
+    , topic(sinkDescriptor.getFromConfig(ConfigParametersKafkaSink::TOPIC))
+    , partition(sinkDescriptor.getFromConfig(ConfigParametersKafkaSink::PARTITION))
+    , compression(sinkDescriptor.getFromConfig(ConfigParametersKafkaSink::COMPRESSION))
+    , lingerMs(sinkDescriptor.getFromConfig(ConfigParametersKafkaSink::LINGER_MS))
+    , batchSizeBytes(sinkDescriptor.getFromConfig(ConfigParametersKafkaSink::BATCH_SIZE_BYTES))
+    , properties(sinkDescriptor.getFromConfig(ConfigParametersKafkaSink::PROPERTIES))
+{
+    switch (const auto inputFormat = sinkDescriptor.getFromConfig(ConfigParametersKafkaSink::INPUT_FORMAT))
+    {
+        case InputFormat::CSV:
+            formatter = std::make_unique<CSVFormat>(*sinkDescriptor.getSchema());
+            break;
+        case InputFormat::JSON:
+            formatter = std::make_unique<JSONFormat>(*sinkDescriptor.getSchema());
+            break;
+        case InputFormat::NATIVE:
+            formatter = std::make_unique<NativeFormat>(*sinkDescriptor.getSchema());
+            break;
+        default:
+            throw UnknownSinkFormat(fmt::format("Sink format: {} not supported.", magic_enum::enum_name(inputFormat)));
+    }
+}
+
+std::ostream& KafkaSink::toString(std::ostream& str) const
+{
+    str << fmt::format(
+        "KafkaSink(brokers: {}, topic: {}, partition: {}, compression: {}, lingerMs: {}, deliveredMessages: {}, failedMessages: {})",
+        brokers,
+        topic,
+        partition,
+        compression,
+        lingerMs,
+        numberOfDeliveredMessages.load(),
+        numberOfFailedMessages.load());
+    return str;
+}
+
+void KafkaSink::onDelivery(rd_kafka_t*, const rd_kafka_message_t* message, void* sink)
+{
+    /// The producer did not copy the payload, thus it is released once the producer is done with the message
+    const std::unique_ptr<std::string> payload(static_cast<std::string*>(message->_private));
+    auto& kafkaSink = *static_cast<KafkaSink*>(sink);
+    if (message->err == RD_KAFKA_RESP_ERR_NO_ERROR)
+    {
+        ++kafkaSink.numberOfDeliveredMessages;
+        return;
+    }
+    ++kafkaSink.numberOfFailedMessages;
+    NES_WARNING("KafkaSink: Delivery to {} failed: {}", kafkaSink.topic, rd_kafka_err2str(message->err));
+    auto error = kafkaSink.deliveryError.wlock();
+    if (not error->has_value())
+    {
+        *error = rd_kafka_err2str(message->err);
+    }
+}
+
+void KafkaSink::start(PipelineExecutionContext&)
+{
+    auto* configuration = rd_kafka_conf_new();
+    try
+    {
+        setProperty(*configuration, "bootstrap.servers", brokers);
+        setProperty(*configuration, "compression.type", compression);
+        setProperty(*configuration, "linger.ms", std::to_string(lingerMs));
+        setProperty(*configuration, "batch.size", std::to_string(batchSizeBytes));
+        setProperties(*configuration, properties);
+    }
+    catch (...)
+    {
+        rd_kafka_conf_destroy(configuration);
+        throw;
+    }
+    rd_kafka_conf_set_dr_msg_cb(configuration, &KafkaSink::onDelivery);
+    rd_kafka_conf_set_opaque(configuration, this);
+
+    std::array<char, 512> error{};
+    /// On success, the producer takes the ownership of the configuration
+    producer.reset(rd_kafka_new(RD_KAFKA_PRODUCER, configuration, error.data(), error.size()));
+    if (not producer)
+    {
+        rd_kafka_conf_destroy(configuration);
+        throw CannotOpenSink("Could not create a Kafka producer for {}: {}", brokers, error.data());
+    }
+    NES_DEBUG("KafkaSink: Producing to {} on {}.", topic, brokers);
+}
+
+void KafkaSink::execute(const TupleBuffer& inputBuffer, PipelineExecutionContext& pipelineExecutionContext)
+{
+    if (inputBuffer.getNumberOfTuples() == 0)
+    {
+        return;
+    }
+    if (const auto error = deliveryError.copy(); error.has_value())
+    {
+        throw CannotWriteToSink("Kafka delivery to {} failed: {}", topic, error.value());
+    }
+
+    auto payload = std::make_unique<std::string>(formatter->getFormattedBuffer(inputBuffer));
+    /// Without RD_KAFKA_MSG_F_COPY, the producer references the payload until it calls the delivery callback, which releases it
+    const auto errorCode = rd_kafka_producev(
+        producer.get(),
+        RD_KAFKA_V_TOPIC(topic.c_str()),
+        RD_KAFKA_V_PARTITION(partition < 0 ? RD_KAFKA_PARTITION_UA : partition),
+        RD_KAFKA_V_VALUE(payload->data(), payload->size()),
+        RD_KAFKA_V_OPAQUE(payload.get()),
+        RD_KAFKA_V_END);
+    if (errorCode == RD_KAFKA_RESP_ERR__QUEUE_FULL)
+    {
+        /// Serving the delivery callbacks frees the queue, while repeating the task later keeps the worker thread available
+        rd_kafka_poll(producer.get(), 0);
+        pipelineExecutionContext.repeatTask(inputBuffer, BACKPRESSURE_RETRY_INTERVAL);
+        return;
+    }
+    if (errorCode != RD_KAFKA_RESP_ERR_NO_ERROR)
+    {
+        throw CannotWriteToSink("Could not produce to the Kafka topic {}: {}", topic, rd_kafka_err2str(errorCode));
+    }
+    /// The delivery callback owns the payload now
+    payload.release();
+    rd_kafka_poll(producer.get(), 0);
+}
+
+void KafkaSink::stop(PipelineExecutionContext&)
+{
+    if (not producer)
+    {
+        return;
+    }
+    if (rd_kafka_flush(producer.get(), static_cast<int>(std::chrono::milliseconds(FLUSH_TIMEOUT).count())) != RD_KAFKA_RESP_ERR_NO_ERROR)
+    {
+        NES_WARNING("KafkaSink: Stopping before {} messages to {} were delivered.", rd_kafka_outq_len(producer.get()), topic);
+        /// Purged messages are reported to the delivery callback, which releases their payloads
+        rd_kafka_purge(producer.get(), RD_KAFKA_PURGE_F_QUEUE | RD_KAFKA_PURGE_F_INFLIGHT);
+        rd_kafka_poll(producer.get(), 0);
+    }
+    producer.reset();
+    NES_DEBUG(
+        "KafkaSink: Delivered {} messages to {}, {} failed.", numberOfDeliveredMessages.load(), topic, numberOfFailedMessages.load());
+}
+
+DescriptorConfig::Config KafkaSink::validateAndFormat(std::unordered_map<std::string, std::string> config)
+{
+    return DescriptorConfig::validateAndFormat<ConfigParametersKafkaSink>(std::move(config), NAME);
+}
+
+SinkValidationRegistryReturnType RegisterKafkaSinkValidation(SinkValidationRegistryArguments sinkConfig)
+{
+    return KafkaSink::validateAndFormat(std::move(sinkConfig.config));
+}
+
+SinkRegistryReturnType RegisterKafkaSink(SinkRegistryArguments sinkRegistryArguments)
+{
+    return std::make_unique<KafkaSink>(sinkRegistryArguments.sinkDescriptor);
+}
+
+}
@@ -0,0 +1,162 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include <librdkafka/rdkafka.h>
+
+#include <Configurations/Descriptor.hpp>
+#include <Configurations/Enums/EnumWrapper.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Sinks/Sink.hpp>
+#include <Sinks/SinkDescriptor.hpp>
+#include <SinksParsing/Format.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <folly/Synchronized.h>
+#include <PipelineExecutionContext.hpp>
+
+namespace NES
+{
+
+/// Produces every formatted buffer as one message to the 'kafka_topic'. The producer does not copy the payload, but owns it until the
+/// broker acknowledged the message, thus librdkafka batches the messages of all worker threads per partition without copying them again.
+/// 'kafka_linger_ms' and 'kafka_batch_size_bytes' bound the time and the size of these batches, and 'kafka_compression' compresses them.
+/// If the queue of the producer is full, the sink repeats the task of the buffer later instead of blocking the worker thread. Failed
+/// deliveries fail the next execution of the sink.
+class KafkaSink final : public Sink
+{
+public:
+    static constexpr std::string_view NAME = "Kafka";
+
+    explicit KafkaSink(const SinkDescriptor& sinkDescriptor);
+    ~KafkaSink() override = default;
+
+    KafkaSink(const KafkaSink&) = delete;
+    KafkaSink& operator=(const KafkaSink&) = delete;
+    KafkaSink(KafkaSink&&) = delete;
+    KafkaSink& operator=(KafkaSink&&) = delete;
+
+    void start(PipelineExecutionContext& pipelineExecutionContext) override;
+    void execute(const TupleBuffer& inputBuffer, PipelineExecutionContext& pipelineExecutionContext) override;
+    void stop(PipelineExecutionContext& pipelineExecutionContext) override;
+
+    static DescriptorConfig::Config validateAndFormat(std::unordered_map<std::string, std::string> config);
+
+protected:
+    std::ostream& toString(std::ostream& str) const override;
+
+    static constexpr std::chrono::milliseconds BACKPRESSURE_RETRY_INTERVAL{1};
+    static constexpr std::chrono::seconds FLUSH_TIMEOUT{10};
+
+private:
+    /// Called by librdkafka for every message once the broker acknowledged it or its delivery failed
+    static void onDelivery(rd_kafka_t* producer, const rd_kafka_message_t* message, void* sink);
+
+    std::string brokers;
+    std::string topic;
+    int32_t partition;
+    std::string compression;
+    uint32_t lingerMs;
+    uint32_t batchSizeBytes;
+    std::string properties;
+
+    std::unique_ptr<rd_kafka_t, decltype(&rd_kafka_destroy)> producer{nullptr, rd_kafka_destroy};
+    std::unique_ptr<Format> formatter;
+
+    std::atomic<uint64_t> numberOfDeliveredMessages{0};
+    std::atomic<uint64_t> numberOfFailedMessages{0};
+    folly::Synchronized<std::optional<std::string>> deliveryError;
+};
+
+struct ConfigParametersKafkaSink
+{
+    static inline const DescriptorConfig::ConfigParameter<std::string> BROKERS{
+        "kafka_brokers",
+        std::nullopt,
+        [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(BROKERS, config); }};
+
+    static inline const DescriptorConfig::ConfigParameter<std::string> TOPIC{
+        "kafka_topic",
+        std::nullopt,
+        [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(TOPIC, config); }};
+
+    /// Lets the partitioner of librdkafka choose the partition of every message, if negative
+    static inline const DescriptorConfig::ConfigParameter<int32_t> PARTITION{
+        "kafka_partition",
+        -1,
+        [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(PARTITION, config); }};
+
+    static inline const DescriptorConfig::ConfigParameter<std::string> COMPRESSION{
+        "kafka_compression",
+        "none",
+        [](const std::unordered_map<std::string, std::string>& config) -> std::optional<std::string>
+        {
+            constexpr std::array<std::string_view, 5> CODECS{"none", "gzip", "snappy", "lz4", "zstd"};
+            const auto compression = DescriptorConfig::tryGet(COMPRESSION, config);
+            if (compression.has_value() and std::ranges::find(CODECS, compression.value()) == CODECS.end())
+            {
+                NES_ERROR("KafkaSink compression is {}, but must be one of none, gzip, snappy, lz4, or zstd", compression.value());
+                return std::nullopt;
+            }
+            return compression;
+        }};
+
+    static inline const DescriptorConfig::ConfigParameter<uint32_t> LINGER_MS{
+        "kafka_linger_ms",
+        5,
+        [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(LINGER_MS, config); }};
+
+    static inline const DescriptorConfig::ConfigParameter<uint32_t> BATCH_SIZE_BYTES{
+        "kafka_batch_size_bytes",
+        1024 * 1024,
+        [](const std::unordered_map<std::string, std::string>& config) -> std::optional<uint32_t>
+        {
+            const auto batchSize = DescriptorConfig::tryGet(BATCH_SIZE_BYTES, config);
+            if (batchSize.has_value() and batchSize.value() == 0)
+            {
+                NES_ERROR("KafkaSink batch size must be positive");
+                return std::nullopt;
+            }
+            return batchSize;
+        }};
+
+    /// Further properties of librdkafka as 'key=value' pairs separated by ';'
+    static inline const DescriptorConfig::ConfigParameter<std::string> PROPERTIES{
+        "kafka_properties",
+        "",
+        [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(PROPERTIES, config); }};
+
+    static inline const DescriptorConfig::ConfigParameter<EnumWrapper, InputFormat> INPUT_FORMAT{
+        "input_format",
+        EnumWrapper(InputFormat::CSV),
+        [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(INPUT_FORMAT, config); }};
+
+    static inline std::unordered_map<std::string, DescriptorConfig::ConfigParameterContainer> parameterMap
+        = DescriptorConfig::createConfigParameterContainerMap(
+            SinkDescriptor::parameterMap, BROKERS, TOPIC, PARTITION, COMPRESSION, LINGER_MS, BATCH_SIZE_BYTES, PROPERTIES, INPUT_FORMAT);
+};
+
+}
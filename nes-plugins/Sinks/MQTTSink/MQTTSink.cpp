@@ -39,7 +39,8 @@
 namespace NES
 {
 
-MQTTSink::Callback::Callback(std::string serverUri) : targetServerUri(std::move(serverUri))
+MQTTSink::Callback::Callback(std::string serverUri, std::shared_ptr<PublishWindow> publishWindow)
+    : targetServerUri(std::move(serverUri)), publishWindow(std::move(publishWindow))
 {
 }
 
@@ -56,6 +57,10 @@ void MQTTSink::Callback::connection_lost(const std::string& cause)
 void MQTTSink::Callback::delivery_complete(mqtt::delivery_token_ptr token)
 {
     const auto count = ++deliveredCount;
+    if (publishWindow)
+    {
+        publishWindow->release();
+    }
     if (token)
     {
         NES_DEBUG(
@@ -70,6 +75,12 @@ void MQTTSink::Callback::delivery_complete(mqtt::delivery_token_ptr token)
     }
 }
 
+void MQTTSink::FailureListener::on_failure(const mqtt::token& token)
+{
+    NES_WARNING("MQTTSink: delivery failed (token id: {}, return code: {}).", token.get_message_id(), token.get_return_code());
+    publishWindow->fail(fmt::format("delivery of message {} failed with return code {}", token.get_message_id(), token.get_return_code()));
+}
+
 MQTTSink::MQTTSink(const SinkDescriptor& sinkDescriptor)
     : Sink()
     , serverUri(sinkDescriptor.getFromConfig(MQTTSinkConfig::SERVER_URI))
@@ -86,6 +97,9 @@ MQTTSink::MQTTSink(const SinkDescriptor& sinkDescriptor)
     , tlsClientCertPath(sinkDescriptor.tryGetFromConfig(MQTTSinkConfig::TLS_CLIENT_CERT))
     , tlsClientKeyPath(sinkDescriptor.tryGetFromConfig(MQTTSinkConfig::TLS_CLIENT_KEY))
     , tlsAllowInsecure(sinkDescriptor.getFromConfig(MQTTSinkConfig::TLS_ALLOW_INSECURE))
+    , publishWindowSize(
+          maxInflight.value_or(0) > 0 ? maxInflight.value() : (qos == 2 ? DEFAULT_MAX_INFLIGHT_QOS2 : DEFAULT_PUBLISH_WINDOW))
+    , coalesceBytes(sinkDescriptor.getFromConfig(MQTTSinkConfig::COALESCE_BYTES))
 {
     // Resolve input format (default provided by validator is CSV)
     switch (const auto inputFormat = sinkDescriptor.getFromConfig(MQTTSinkConfig::INPUT_FORMAT))
@@ -103,7 +117,14 @@ MQTTSink::MQTTSink(const SinkDescriptor& sinkDescriptor)
 
 std::ostream& MQTTSink::toString(std::ostream& str) const
 {
-    str << fmt::format("MQTTSink(serverURI: {}, clientId: {}, topic: {}, qos: {})", serverUri, clientId, topic, qos);
+    str << fmt::format(
+        "MQTTSink(serverURI: {}, clientId: {}, topic: {}, qos: {}, publishWindow: {}, coalesceBytes: {})",
+        serverUri,
+        clientId,
+        topic,
+        qos,
+        publishWindowSize,
+        coalesceBytes);
     return str;
 }
 
@@ -135,14 +156,14 @@ void MQTTSink::start(PipelineExecutionContext&)
             .automatic_reconnect(true)
             .clean_session(effectiveCleanSession);
 
+        /// The client must accept all messages of the publish window
         const int32_t configuredMaxInflight = maxInflight.value_or(0);
-        if (configuredMaxInflight > 0)
+        if (configuredMaxInflight > 0 or qos > 0)
         {
-            optionsBuilder.max_inflight(configuredMaxInflight);
+            optionsBuilder.max_inflight(publishWindowSize);
         }
-        else if (qos == 2)
+        if (configuredMaxInflight <= 0 and qos == 2)
         {
-            optionsBuilder.max_inflight(DEFAULT_MAX_INFLIGHT_QOS2);
             NES_INFO(
                 "MQTTSink: QoS2 enabled without 'maxInflight'; applying default {} inflight messages.",
                 DEFAULT_MAX_INFLIGHT_QOS2);
@@ -177,7 +198,9 @@ void MQTTSink::start(PipelineExecutionContext&)
 
         const auto connectOptions = optionsBuilder.finalize();
 
-        clientCallback = std::make_shared<Callback>(serverUri);
+        publishWindow = qos > 0 ? std::make_shared<PublishWindow>(publishWindowSize) : nullptr;
+        failureListener = qos > 0 ? std::make_shared<FailureListener>(publishWindow) : nullptr;
+        clientCallback = std::make_shared<Callback>(serverUri, publishWindow);
         client->set_callback(*clientCallback);
         client->connect(connectOptions)->wait();
     }
@@ -191,6 +214,19 @@ void MQTTSink::stop(PipelineExecutionContext&)
 {
     try
     {
+        if (auto pending = std::exchange(*coalescedPayload.wlock(), {}); not pending.empty())
+        {
+            /// All buffers were executed, thus waiting for a slot of the window does not block a worker thread
+            while (publishWindow and not publishWindow->tryAcquire())
+            {
+                publishWindow->waitUntilDrained(BACKPRESSURE_RETRY_INTERVAL);
+            }
+            publish(std::move(pending));
+        }
+        if (publishWindow and not publishWindow->waitUntilDrained(DRAIN_TIMEOUT))
+        {
+            NES_WARNING("MQTTSink: Disconnecting from {} before all messages were acknowledged.", serverUri);
+        }
         client->disconnect()->wait();
         clientCallback.reset();
     }
@@ -200,7 +236,7 @@ void MQTTSink::stop(PipelineExecutionContext&)
     }
 }
 
-void MQTTSink::execute(const TupleBuffer& inputBuffer, PipelineExecutionContext&)
+void MQTTSink::execute(const TupleBuffer& inputBuffer, PipelineExecutionContext& pipelineExecutionContext)
 {
     if (inputBuffer.getNumberOfTuples() == 0)
     {
@@ -213,31 +249,78 @@ void MQTTSink::execute(const TupleBuffer& inputBuffer, PipelineExecutionContext&
         throw CannotOpenSink("MQTT client is not connected to server {}", serverUri);
     }
 
-    const std::string fBuf = formatter->getFormattedBuffer(inputBuffer);
-    const mqtt::message_ptr message = mqtt::make_message(topic, fBuf);
+    if (publishWindow)
+    {
+        if (const auto error = publishWindow->getError(); error.has_value())
+        {
+            throw CannotOpenSink("MQTT publish to {} failed: {}", serverUri, error.value());
+        }
+        if (not publishWindow->tryAcquire())
+        {
+            /// Repeating the task later keeps the worker thread available instead of waiting for acknowledgments
+            pipelineExecutionContext.repeatTask(inputBuffer, BACKPRESSURE_RETRY_INTERVAL);
+            return;
+        }
+    }
+
+    auto payload = formatter->getFormattedBuffer(inputBuffer);
+    if (coalesceBytes > 0)
+    {
+        auto pending = coalescedPayload.wlock();
+        pending->append(payload);
+        if (pending->size() < coalesceBytes)
+        {
+            if (publishWindow)
+            {
+                publishWindow->release();
+            }
+            return;
+        }
+        payload = std::exchange(*pending, {});
+    }
+    publish(std::move(payload));
+}
+
+void MQTTSink::publish(std::string payload)
+{
+    const mqtt::message_ptr message = mqtt::make_message(topic, std::move(payload));
     message->set_qos(qos);
 
     try
     {
-        auto token = client->publish(message);
-        // Only wait for acknowledgment if QoS > 0
-        // QoS 0 is fire-and-forget and doesn't require acknowledgment
-        if (qos > 0)
+        /// With QoS 0, the client does not wait for an acknowledgment, thus the message does not occupy the window
+        if (failureListener)
         {
-            token->wait();
+            client->publish(message, nullptr, *failureListener);
+        }
+        else
+        {
+            client->publish(message);
         }
     }
     catch (const mqtt::exception& e)
     {
+        if (publishWindow)
+        {
+            publishWindow->release();
+        }
         // Handle specific MQTT exceptions with error code
         throw CannotOpenSink("MQTT publish failed with error [{}]: {}", e.get_reason_code(), e.what());
     }
     catch (const std::exception& e)
     {
+        if (publishWindow)
+        {
+            publishWindow->release();
+        }
         throw CannotOpenSink("Failed to publish to MQTT: {}", e.what());
     }
     catch (...)
     {
+        if (publishWindow)
+        {
+            publishWindow->release();
+        }
         throw wrapExternalException();
     }
 }
@@ -14,8 +14,10 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <atomic>
+#include <chrono>
 #include <memory>
 #include <optional>
 #include <ostream>
@@ -32,11 +34,19 @@
 #include <Sinks/SinkDescriptor.hpp>
 #include <SinksParsing/CSVFormat.hpp>
 #include <Util/Logger/Logger.hpp>
+#include <folly/Synchronized.h>
 #include <PipelineExecutionContext.hpp>
+#include <PublishWindow.hpp>
 
 namespace NES
 {
 
+/// Publishes every formatted buffer as one message to the 'topic'. With a QoS above 0, the sink does not wait for the acknowledgment of
+/// a message, but keeps up to 'maxInflight' messages in flight, which the client callback completes once the broker acknowledged them.
+/// If the window is full, the sink repeats the task of the buffer later instead of blocking the worker thread. Failed deliveries fail the
+/// next execution of the sink.
+/// With a positive 'coalesceBytes', the sink appends formatted buffers to a pending message, until the message reaches that size or the
+/// sink stops, which trades latency for fewer, larger messages.
 class MQTTSink : public Sink
 {
 public:
@@ -58,8 +68,16 @@ public:
 protected:
     std::ostream& toString(std::ostream& str) const override;
 
+    static constexpr int32_t DEFAULT_PUBLISH_WINDOW = 64;
+    static constexpr std::chrono::milliseconds BACKPRESSURE_RETRY_INTERVAL{1};
+    static constexpr std::chrono::seconds DRAIN_TIMEOUT{10};
+
 private:
     class Callback;
+    class FailureListener;
+    using PublishWindow = Sinks::PublishWindow;
+
+    void publish(std::string payload);
 
     std::string serverUri;
     std::string clientId;
@@ -76,18 +94,38 @@ private:
     std::optional<std::string> tlsClientKeyPath;
     bool tlsAllowInsecure;
 
+    int32_t publishWindowSize;
+    size_t coalesceBytes;
+
     std::unique_ptr<mqtt::async_client> client;
+    std::shared_ptr<PublishWindow> publishWindow;
     std::shared_ptr<Callback> clientCallback;
+    std::shared_ptr<FailureListener> failureListener;
+    folly::Synchronized<std::string> coalescedPayload;
 
     std::unique_ptr<Format> formatter;
 
     static constexpr int32_t DEFAULT_MAX_INFLIGHT_QOS2 = 20;
 };
 
+/// Releases the slot of a message in the publish window, if its delivery failed. Successful deliveries complete in the Callback.
+class MQTTSink::FailureListener : public mqtt::iaction_listener
+{
+public:
+    explicit FailureListener(std::shared_ptr<PublishWindow> publishWindow) : publishWindow(std::move(publishWindow)) { }
+
+    void on_failure(const mqtt::token& token) override;
+    void on_success(const mqtt::token&) override { }
+
+private:
+    std::shared_ptr<PublishWindow> publishWindow;
+};
+
 class MQTTSink::Callback : public mqtt::callback
 {
 public:
-    explicit Callback(std::string serverUri);
+    /// @param publishWindow is null, if the sink publishes with QoS 0
+    Callback(std::string serverUri, std::shared_ptr<PublishWindow> publishWindow);
 
     void connected(const std::string& cause) override;
     void connection_lost(const std::string& cause) override;
@@ -95,6 +133,7 @@ public:
 
 private:
     std::string targetServerUri;
+    std::shared_ptr<PublishWindow> publishWindow;
     std::atomic<uint64_t> deliveredCount{0};
 };
 
@@ -225,6 +264,20 @@ struct MQTTSinkConfig
             return 0;
         }};
 
+    static inline const DescriptorConfig::ConfigParameter<int32_t> COALESCE_BYTES{
+        "coalesceBytes",
+        0,
+        [](const std::unordered_map<std::string, std::string>& config) -> std::optional<int32_t>
+        {
+            const auto coalesceBytes = DescriptorConfig::tryGet(COALESCE_BYTES, config);
+            if (coalesceBytes.has_value() and coalesceBytes.value() < 0)
+            {
+                NES_ERROR("MQTTSink: coalesceBytes must not be negative, but was {}", coalesceBytes.value());
+                return std::nullopt;
+            }
+            return coalesceBytes;
+        }};
+
     static inline const DescriptorConfig::ConfigParameter<bool> USE_TLS{
         "useTls",
         false,
@@ -273,6 +326,7 @@ struct MQTTSinkConfig
             CLEAN_SESSION,
             PERSISTENCE_DIR,
             MAX_INFLIGHT,
+            COALESCE_BYTES,
             USE_TLS,
             TLS_CA_CERT,
             TLS_CLIENT_CERT,
@@ -0,0 +1,90 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+
+namespace NES::Sinks
+{
+
+/// Bounds the number of messages of the MQTTSink that wait for their acknowledgment. The sink acquires a slot before it publishes a
+/// message, and the client callbacks release it, once the broker acknowledged the message or its delivery failed.
+/// @note This object is thread-safe.
+class PublishWindow
+{
+public:
+    explicit PublishWindow(const int32_t capacity) : capacity(capacity) { }
+
+    /// Returns false, if the window is full
+    bool tryAcquire()
+    {
+        const std::scoped_lock lock(mutex);
+        if (inFlight >= capacity)
+        {
+            return false;
+        }
+        ++inFlight;
+        return true;
+    }
+
+    void release()
+    {
+        {
+            const std::scoped_lock lock(mutex);
+            --inFlight;
+        }
+        drained.notify_all();
+    }
+
+    void fail(std::string error)
+    {
+        {
+            const std::scoped_lock lock(mutex);
+            if (not firstError.has_value())
+            {
+                firstError = std::move(error);
+            }
+        }
+        release();
+    }
+
+    [[nodiscard]] std::optional<std::string> getError() const
+    {
+        const std::scoped_lock lock(mutex);
+        return firstError;
+    }
+
+    /// Returns false, if messages are still in flight after the timeout
+    bool waitUntilDrained(const std::chrono::milliseconds timeout)
+    {
+        std::unique_lock lock(mutex);
+        return drained.wait_for(lock, timeout, [this] { return inFlight == 0; });
+    }
+
+private:
+    int32_t capacity;
+    int32_t inFlight{0};
+    std::optional<std::string> firstError;
+    mutable std::mutex mutex;
+    std::condition_variable drained;
+};
+
+}
@@ -0,0 +1,119 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <thread>
+
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+#include <PublishWindow.hpp>
+
+namespace NES
+{
+
+using namespace std::chrono_literals;
+using Sinks::PublishWindow;
+
+class PublishWindowTest : public Testing::BaseUnitTest
+{
+public:
+    static constexpr int32_t CAPACITY = 3;
+
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("PublishWindowTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup PublishWindowTest test class.");
+    }
+
+    void SetUp() override { BaseUnitTest::SetUp(); }
+
+    PublishWindow window{CAPACITY};
+};
+
+TEST_F(PublishWindowTest, AcceptsMessagesUntilTheWindowIsFull)
+{
+    for (int32_t message = 0; message < CAPACITY; ++message)
+    {
+        EXPECT_TRUE(window.tryAcquire());
+    }
+    /// The sink repeats the task of the buffer instead of publishing another message
+    EXPECT_FALSE(window.tryAcquire());
+    EXPECT_FALSE(window.tryAcquire());
+
+    /// Every acknowledgment frees the slot of one message
+    window.release();
+    EXPECT_TRUE(window.tryAcquire());
+    EXPECT_FALSE(window.tryAcquire());
+}
+
+TEST_F(PublishWindowTest, FailedDeliveriesFreeTheirSlotAndKeepTheFirstError)
+{
+    EXPECT_EQ(window.getError(), std::nullopt);
+    for (int32_t message = 0; message < CAPACITY; ++message)
+    {
+        EXPECT_TRUE(window.tryAcquire());
+    }
+    window.fail("delivery of message 1 failed");
+    window.fail("delivery of message 2 failed");
+    EXPECT_EQ(window.getError(), "delivery of message 1 failed");
+
+    /// The failures freed two slots, thus solely the acknowledgment of the third message is outstanding
+    EXPECT_TRUE(window.tryAcquire());
+    EXPECT_TRUE(window.tryAcquire());
+    EXPECT_FALSE(window.tryAcquire());
+}
+
+TEST_F(PublishWindowTest, DrainingTimesOutWhileMessagesAreInFlight)
+{
+    EXPECT_TRUE(window.waitUntilDrained(0ms));
+    EXPECT_TRUE(window.tryAcquire());
+    EXPECT_FALSE(window.waitUntilDrained(10ms));
+    window.release();
+    EXPECT_TRUE(window.waitUntilDrained(0ms));
+}
+
+TEST_F(PublishWindowTest, DrainingWaitsForTheAcknowledgmentsOfTheClientCallbacks)
+{
+    for (int32_t message = 0; message < CAPACITY; ++message)
+    {
+        EXPECT_TRUE(window.tryAcquire());
+    }
+    /// The client acknowledges the messages on its own thread, like the callbacks of the MQTT client do
+    std::jthread client(
+        [this]
+        {
+            for (int32_t message = 0; message < CAPACITY; ++message)
+            {
+                std::this_thread::sleep_for(5ms);
+                if (message == 0)
+                {
+                    window.fail("delivery of message 0 failed");
+                }
+                else
+                {
+                    window.release();
+                }
+            }
+        });
+    EXPECT_TRUE(window.waitUntilDrained(60s));
+    EXPECT_EQ(window.getError(), "delivery of message 0 failed");
+    EXPECT_TRUE(window.tryAcquire());
+}
+
+}
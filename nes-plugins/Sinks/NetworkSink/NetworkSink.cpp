@@ -0,0 +1,309 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <NetworkSink.hpp>
+
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <span>
+#include <stop_token>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <fmt/format.h>
+
+#include <Configurations/Descriptor.hpp>
+#include <MemoryLayout/VariableSizedAccess.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Sinks/Sink.hpp>
+#include <Sinks/SinkDescriptor.hpp>
+#include <ErrorHandling.hpp>
+#include <NetworkProtocol.hpp>
+#include <PipelineExecutionContext.hpp>
+#include <SinkRegistry.hpp>
+#include <SinkValidationRegistry.hpp>
+
+namespace NES
+{
+
+namespace
+{
+std::string describeError(const int error)
+{
+    std::array<char, 256> errorBuffer{};
+    return strerror_r(error, errorBuffer.data(), errorBuffer.size());
+}
+}
+
+NetworkSink::NetworkSink(const SinkDescriptor& sinkDescriptor)
+    : Sink()
+    , host(sinkDescriptor.getFromConfig(ConfigParametersNetworkSink::HOST))
+    , port(std::to_string(sinkDescriptor.getFromConfig(ConfigParametersNetworkSink::PORT)))
+    , isCompressing(sinkDescriptor.getFromConfig(ConfigParametersNetworkSink::COMPRESSION) == "lz4")
+    , connectTimeout(sinkDescriptor.getFromConfig(ConfigParametersNetworkSink::CONNECT_TIMEOUT_SECONDS))
+    , tupleSizeInBytes(sinkDescriptor.getSchema()->getSizeOfSchemaInBytes())
+{
+}
+
+std::ostream& NetworkSink::toString(std::ostream& str) const
+{
+    str << fmt::format(
+        "NetworkSink(host: {}, port: {}, compression: {}, sentBuffers: {}, sentBytes: {}, backpressuredTasks: {})",
+        host,
+        port,
+        isCompressing ? "lz4" : "none",
+        numberOfSentBuffers.load(),
+        numberOfSentBytes.load(),
+        numberOfBackpressuredTasks.load());
+    return str;
+}
+
+bool NetworkSink::tryConnect()
+{
+    addrinfo hints{};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    addrinfo* result = nullptr;
+    if (const auto errorCode = getaddrinfo(host.c_str(), port.c_str(), &hints, &result); errorCode != 0)
+    {
+        throw CannotOpenSink("Could not resolve {}:{}: {}", host, port, gai_strerror(errorCode));
+    }
+    const std::unique_ptr<addrinfo, decltype(&freeaddrinfo)> resultGuard(result, freeaddrinfo);
+
+    for (const auto* address = result; address != nullptr; address = address->ai_next)
+    {
+        socket = ::socket(address->ai_family, address->ai_socktype | SOCK_CLOEXEC, address->ai_protocol);
+        if (socket == -1)
+        {
+            continue;
+        }
+        if (connect(socket, address->ai_addr, address->ai_addrlen) == 0)
+        {
+            return true;
+        }
+        const auto error = errno;
+        ::close(socket);
+        socket = -1;
+        if (error != ECONNREFUSED and error != EINTR)
+        {
+            throw CannotOpenSink("Could not connect to {}:{}: {}", host, port, describeError(error));
+        }
+    }
+    return false;
+}
+
+void NetworkSink::start(PipelineExecutionContext&)
+{
+    const auto deadline = std::chrono::steady_clock::now() + connectTimeout;
+    while (not tryConnect())
+    {
+        if (std::chrono::steady_clock::now() >= deadline)
+        {
+            throw CannotOpenSink("The NetworkSource at {}:{} did not accept a connection within {}s", host, port, connectTimeout.count());
+        }
+        std::this_thread::sleep_for(CONNECT_RETRY_INTERVAL);
+    }
+    /// Every execution sends a complete frame, whose last segment flushes it, thus Nagle's algorithm would solely delay the frames
+    constexpr int enable = 1;
+    setsockopt(socket, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+
+    const NetworkProtocol::Handshake handshake{.tupleSizeInBytes = tupleSizeInBytes};
+    if (not NetworkProtocol::sendAll(socket, NetworkProtocol::asBytes(handshake)))
+    {
+        const auto error = describeError(errno);
+        ::close(socket);
+        socket = -1;
+        throw CannotOpenSink("Could not send the handshake to {}:{}: {}", host, port, error);
+    }
+    /// The source grants its initial credits once its ingestion starts, until then the sink backpressures its query
+    creditReceiver = std::jthread([this](const std::stop_token& stopToken) { receiveCredits(stopToken); });
+    NES_DEBUG("NetworkSink: Connected to {}:{}.", host, port);
+}
+
+void NetworkSink::failWith(std::string error)
+{
+    NES_WARNING("NetworkSink: {}", error);
+    auto lockedError = connectionError.wlock();
+    if (not lockedError->has_value())
+    {
+        *lockedError = std::move(error);
+    }
+}
+
+void NetworkSink::receiveCredits(const std::stop_token& stopToken)
+{
+    while (true)
+    {
+        NetworkProtocol::Credits credits = 0;
+        switch (NetworkProtocol::receiveAll(socket, NetworkProtocol::asWritableBytes(credits), stopToken))
+        {
+            case NetworkProtocol::ReceiveStatus::RECEIVED:
+                numberOfCredits.fetch_add(credits);
+                break;
+            case NetworkProtocol::ReceiveStatus::STOPPED:
+                return;
+            case NetworkProtocol::ReceiveStatus::CLOSED:
+                failWith(fmt::format("The NetworkSource at {}:{} closed the connection", host, port));
+                return;
+            case NetworkProtocol::ReceiveStatus::FAILED:
+                failWith(fmt::format("Could not receive credits from {}:{}: {}", host, port, describeError(errno)));
+                return;
+        }
+    }
+}
+
+bool NetworkSink::tryTakeCredit()
+{
+    auto credits = numberOfCredits.load();
+    while (credits > 0)
+    {
+        if (numberOfCredits.compare_exchange_weak(credits, credits - 1))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void NetworkSink::sendFrame(const TupleBuffer& inputBuffer)
+{
+    const auto payload = inputBuffer.getAvailableMemoryArea<std::byte>().first(inputBuffer.getNumberOfTuples() * tupleSizeInBytes);
+    const auto numberOfChildBuffers = inputBuffer.getNumberOfChildBuffers();
+
+    /// The header announces the size of the payload on the wire, thus a compressed payload is compressed before sending the header
+    const auto compressedPayload = isCompressing ? NetworkProtocol::compress(payload) : std::nullopt;
+    const auto payloadOnWire = compressedPayload.has_value() ? std::span<const std::byte>(compressedPayload.value()) : payload;
+    const NetworkProtocol::FrameHeader header{
+        .originId = inputBuffer.getOriginId().getRawValue(),
+        .sequenceNumber = inputBuffer.getSequenceNumber().getRawValue(),
+        .chunkNumber = inputBuffer.getChunkNumber().getRawValue(),
+        .watermark = inputBuffer.getWatermark().getRawValue(),
+        .creationTimestamp = inputBuffer.getCreationTimestampInMS().getRawValue(),
+        .numberOfTuples = inputBuffer.getNumberOfTuples(),
+        .payloadSize = static_cast<uint32_t>(payload.size()),
+        .payloadSizeOnWire = static_cast<uint32_t>(payloadOnWire.size()),
+        .numberOfChildBuffers = numberOfChildBuffers,
+        .lastChunk = inputBuffer.isLastChunk() ? 1U : 0U};
+
+    const std::scoped_lock lock(sendMutex);
+    auto sentBytes = sizeof(header) + payloadOnWire.size();
+    if (not NetworkProtocol::sendAll(socket, NetworkProtocol::asBytes(header), MSG_MORE)
+        or not NetworkProtocol::sendAll(socket, payloadOnWire, numberOfChildBuffers > 0 ? MSG_MORE : 0))
+    {
+        throw CannotWriteToSink("Could not send to {}:{}: {}", host, port, describeError(errno));
+    }
+    for (uint32_t childIndex = 0; childIndex < numberOfChildBuffers; ++childIndex)
+    {
+        const auto childBuffer = inputBuffer.loadChildBuffer(VariableSizedAccess::Index{childIndex});
+        /// Child buffers store the number of their used bytes as their number of tuples
+        const auto child = childBuffer.getAvailableMemoryArea<std::byte>().first(childBuffer.getNumberOfTuples());
+        const auto compressedChild = isCompressing ? NetworkProtocol::compress(child) : std::nullopt;
+        const auto childOnWire = compressedChild.has_value() ? std::span<const std::byte>(compressedChild.value()) : child;
+        const NetworkProtocol::ChildHeader childHeader{
+            .size = static_cast<uint32_t>(child.size()), .sizeOnWire = static_cast<uint32_t>(childOnWire.size())};
+        const auto isLastSegment = childIndex + 1 == numberOfChildBuffers;
+        if (not NetworkProtocol::sendAll(socket, NetworkProtocol::asBytes(childHeader), MSG_MORE)
+            or not NetworkProtocol::sendAll(socket, childOnWire, isLastSegment ? 0 : MSG_MORE))
+        {
+            throw CannotWriteToSink("Could not send to {}:{}: {}", host, port, describeError(errno));
+        }
+        sentBytes += sizeof(childHeader) + childOnWire.size();
+    }
+    numberOfSentBytes += sentBytes;
+    ++numberOfSentBuffers;
+}
+
+void NetworkSink::execute(const TupleBuffer& inputBuffer, PipelineExecutionContext& pipelineExecutionContext)
+{
+    if (inputBuffer.getNumberOfTuples() == 0)
+    {
+        return;
+    }
+    if (const auto error = connectionError.copy(); error.has_value())
+    {
+        throw CannotWriteToSink("Streaming to {}:{} failed: {}", host, port, error.value());
+    }
+    if (not tryTakeCredit())
+    {
+        /// The source returns the credits once the downstream query released its buffers
+        ++numberOfBackpressuredTasks;
+        pipelineExecutionContext.repeatTask(inputBuffer, BACKPRESSURE_RETRY_INTERVAL);
+        return;
+    }
+    sendFrame(inputBuffer);
+}
+
+void NetworkSink::stop(PipelineExecutionContext&)
+{
+    if (socket < 0)
+    {
+        return;
+    }
+    {
+        const std::scoped_lock lock(sendMutex);
+        const NetworkProtocol::FrameHeader endOfStream{.flags = NetworkProtocol::END_OF_STREAM};
+        if (not NetworkProtocol::sendAll(socket, NetworkProtocol::asBytes(endOfStream)))
+        {
+            NES_WARNING("NetworkSink: Could not end the stream to {}:{}: {}", host, port, describeError(errno));
+        }
+    }
+    creditReceiver.request_stop();
+    if (creditReceiver.joinable())
+    {
+        creditReceiver.join();
+    }
+    ::shutdown(socket, SHUT_RDWR);
+    ::close(socket);
+    socket = -1;
+    NES_DEBUG(
+        "NetworkSink: Sent {} buffers with {} bytes to {}:{}, backpressured {} tasks.",
+        numberOfSentBuffers.load(),
+        numberOfSentBytes.load(),
+        host,
+        port,
+        numberOfBackpressuredTasks.load());
+}
+
+DescriptorConfig::Config NetworkSink::validateAndFormat(std::unordered_map<std::string, std::string> config)
+{
+    return DescriptorConfig::validateAndFormat<ConfigParametersNetworkSink>(std::move(config), NAME);
+}
+
+SinkValidationRegistryReturnType RegisterNetworkSinkValidation(SinkValidationRegistryArguments sinkConfig)
+{
+    return NetworkSink::validateAndFormat(std::move(sinkConfig.config));
+}
+
+SinkRegistryReturnType RegisterNetworkSink(SinkRegistryArguments sinkRegistryArguments)
+{
+    return std::make_unique<NetworkSink>(sinkRegistryArguments.sinkDescriptor);
+}
+
+}
@@ -0,0 +1,154 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <stop_token>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+
+#include <Configurations/Descriptor.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Sinks/Sink.hpp>
+#include <Sinks/SinkDescriptor.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <folly/Synchronized.h>
+#include <NetworkProtocol.hpp>
+#include <PipelineExecutionContext.hpp>
+
+namespace NES
+{
+
+/// Streams its input buffers as native TupleBuffers, i.e., the rows and the child buffers with the var-sized data, to the NetworkSource of
+/// a downstream worker at 'network_host':'network_port', c.f., NetworkProtocol.hpp. In contrast to the formatting sinks, neither this sink
+/// nor the NetworkSource serialize or parse the tuples. Var-sized data that is dictionary encoded refers to the dictionary of this worker,
+/// thus the sink does not support it.
+/// Every buffer spends one of the credits that the source granted. Without credits, the sink repeats the task of the buffer later instead
+/// of blocking the worker thread, thus a slow downstream worker backpressures the query at this worker.
+/// With 'network_compression' lz4, the sink compresses the payload and every child buffer individually, if doing so shrinks it.
+class NetworkSink final : public Sink
+{
+public:
+    static constexpr std::string_view NAME = "Network";
+
+    explicit NetworkSink(const SinkDescriptor& sinkDescriptor);
+    ~NetworkSink() override = default;
+
+    NetworkSink(const NetworkSink&) = delete;
+    NetworkSink& operator=(const NetworkSink&) = delete;
+    NetworkSink(NetworkSink&&) = delete;
+    NetworkSink& operator=(NetworkSink&&) = delete;
+
+    /// Connects to the source, which may not listen yet, and receives its credits in the background
+    void start(PipelineExecutionContext& pipelineExecutionContext) override;
+    void execute(const TupleBuffer& inputBuffer, PipelineExecutionContext& pipelineExecutionContext) override;
+    /// Ends the stream and closes the connection
+    void stop(PipelineExecutionContext& pipelineExecutionContext) override;
+
+    static DescriptorConfig::Config validateAndFormat(std::unordered_map<std::string, std::string> config);
+
+protected:
+    std::ostream& toString(std::ostream& str) const override;
+
+    static constexpr std::chrono::milliseconds BACKPRESSURE_RETRY_INTERVAL{1};
+    static constexpr std::chrono::milliseconds CONNECT_RETRY_INTERVAL{100};
+
+private:
+    /// Returns false, if the connection was refused, e.g., because the source does not listen yet. Throws on all other errors.
+    bool tryConnect();
+    void receiveCredits(const std::stop_token& stopToken);
+    bool tryTakeCredit();
+    void sendFrame(const TupleBuffer& inputBuffer);
+    void failWith(std::string error);
+
+    std::string host;
+    std::string port;
+    bool isCompressing;
+    std::chrono::seconds connectTimeout;
+    size_t tupleSizeInBytes;
+
+    int socket = -1;
+    /// Frames of concurrently executing worker threads must not interleave
+    std::mutex sendMutex;
+    std::atomic<NetworkProtocol::Credits> numberOfCredits{0};
+    std::jthread creditReceiver;
+    folly::Synchronized<std::optional<std::string>> connectionError;
+
+    std::atomic<uint64_t> numberOfSentBuffers{0};
+    std::atomic<uint64_t> numberOfSentBytes{0};
+    std::atomic<uint64_t> numberOfBackpressuredTasks{0};
+};
+
+struct ConfigParametersNetworkSink
+{
+    static inline const DescriptorConfig::ConfigParameter<std::string> HOST{
+        "network_host",
+        std::nullopt,
+        [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(HOST, config); }};
+
+    static inline const DescriptorConfig::ConfigParameter<uint32_t> PORT{
+        "network_port",
+        std::nullopt,
+        [](const std::unordered_map<std::string, std::string>& config) -> std::optional<uint32_t>
+        {
+            const auto port = DescriptorConfig::tryGet(PORT, config);
+            if (port.has_value() and (port.value() == 0 or port.value() > UINT16_MAX))
+            {
+                NES_ERROR("NetworkSink port is {}, but must be between 1 and {}", port.value(), UINT16_MAX);
+                return std::nullopt;
+            }
+            return port;
+        }};
+
+    static inline const DescriptorConfig::ConfigParameter<std::string> COMPRESSION{
+        "network_compression",
+        "none",
+        [](const std::unordered_map<std::string, std::string>& config) -> std::optional<std::string>
+        {
+            const auto compression = DescriptorConfig::tryGet(COMPRESSION, config);
+            if (compression.has_value() and compression.value() != "none" and compression.value() != "lz4")
+            {
+                NES_ERROR("NetworkSink compression is {}, but must be none or lz4", compression.value());
+                return std::nullopt;
+            }
+            if (compression.has_value() and compression.value() == "lz4" and not NetworkProtocol::IS_COMPRESSION_AVAILABLE)
+            {
+                NES_ERROR("NetworkSink compression lz4 requires building with NES_ENABLE_NETWORK_COMPRESSION");
+                return std::nullopt;
+            }
+            return compression;
+        }};
+
+    /// The downstream worker may start its query after this worker, thus the sink retries to connect for this duration
+    static inline const DescriptorConfig::ConfigParameter<uint32_t> CONNECT_TIMEOUT_SECONDS{
+        "connect_timeout_seconds",
+        30,
+        [](const std::unordered_map<std::string, std::string>& config)
+        { return DescriptorConfig::tryGet(CONNECT_TIMEOUT_SECONDS, config); }};
+
+    static inline std::unordered_map<std::string, DescriptorConfig::ConfigParameterContainer> parameterMap
+        = DescriptorConfig::createConfigParameterContainerMap(
+            SinkDescriptor::parameterMap, HOST, PORT, COMPRESSION, CONNECT_TIMEOUT_SECONDS);
+};
+
+}
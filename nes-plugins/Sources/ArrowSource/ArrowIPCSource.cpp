@@ -0,0 +1,100 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <ArrowIPCSource.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <ostream>
+#include <span>
+#include <stop_token>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include <arrow/io/file.h>
+#include <arrow/ipc/reader.h>
+#include <fmt/format.h>
+
+#include <Configurations/Descriptor.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Sources/SourceDescriptor.hpp>
+#include <ErrorHandling.hpp>
+#include <SourceRegistry.hpp>
+#include <SourceValidationRegistry.hpp>
+
+namespace NES
+{
+
+ArrowIPCSource::ArrowIPCSource(const SourceDescriptor& sourceDescriptor)
+    : filePath(sourceDescriptor.getFromConfig(ConfigParametersArrowIPC::FILEPATH))
+    , rowWriter(*sourceDescriptor.getLogicalSource().getSchema())
+{
+}
+
+void ArrowIPCSource::open()
+{
+    auto file = arrow::io::ReadableFile::Open(filePath);
+    if (not file.ok())
+    {
+        throw CannotOpenSource("Could not open the Arrow IPC file {}: {}", filePath, file.status().ToString());
+    }
+    auto streamReader = arrow::ipc::RecordBatchStreamReader::Open(std::move(file).ValueUnsafe());
+    if (not streamReader.ok())
+    {
+        throw CannotOpenSource("Could not read the Arrow IPC stream in {}: {}", filePath, streamReader.status().ToString());
+    }
+    reader = std::move(streamReader).ValueUnsafe();
+}
+
+void ArrowIPCSource::close()
+{
+    if (reader != nullptr)
+    {
+        [[maybe_unused]] const auto status = reader->Close();
+        reader.reset();
+    }
+}
+
+size_t ArrowIPCSource::fillTupleBuffer(TupleBuffer& tupleBuffer, const std::stop_token&)
+{
+    return rowWriter.writeRows(*reader, tupleBuffer.getAvailableMemoryArea<std::byte>());
+}
+
+DescriptorConfig::Config ArrowIPCSource::validateAndFormat(std::unordered_map<std::string, std::string> config)
+{
+    return DescriptorConfig::validateAndFormat<ConfigParametersArrowIPC>(std::move(config), NAME);
+}
+
+std::ostream& ArrowIPCSource::toString(std::ostream& str) const
+{
+    str << fmt::format(
+        "\nArrowIPCSource(filepath: {}, numberOfReadBatches: {}, numberOfWrittenRows: {})",
+        filePath,
+        rowWriter.getNumberOfReadBatches(),
+        rowWriter.getNumberOfWrittenRows());
+    return str;
+}
+
+SourceValidationRegistryReturnType RegisterArrowIPCSourceValidation(SourceValidationRegistryArguments sourceConfig)
+{
+    return ArrowIPCSource::validateAndFormat(std::move(sourceConfig.config));
+}
+
+SourceRegistryReturnType SourceGeneratedRegistrar::RegisterArrowIPCSource(SourceRegistryArguments sourceRegistryArguments)
+{
+    return std::make_unique<ArrowIPCSource>(sourceRegistryArguments.sourceDescriptor);
+}
+
+}
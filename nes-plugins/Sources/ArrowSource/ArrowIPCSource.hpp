@@ -0,0 +1,79 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <stop_token>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include <arrow/record_batch.h>
+
+#include <Configurations/Descriptor.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Sources/Source.hpp>
+#include <Sources/SourceDescriptor.hpp>
+#include <RecordBatchRowWriter.hpp>
+
+namespace NES
+{
+
+/// Reads a file in the Arrow IPC stream format and writes its record batches as native rows, c.f., RecordBatchRowWriter.
+/// Thus, queries must read the source with the 'Native' parser.
+class ArrowIPCSource final : public Source
+{
+public:
+    static constexpr std::string_view NAME = "ArrowIPC";
+
+    explicit ArrowIPCSource(const SourceDescriptor& sourceDescriptor);
+    ~ArrowIPCSource() override = default;
+
+    ArrowIPCSource(const ArrowIPCSource&) = delete;
+    ArrowIPCSource& operator=(const ArrowIPCSource&) = delete;
+    ArrowIPCSource(ArrowIPCSource&&) = delete;
+    ArrowIPCSource& operator=(ArrowIPCSource&&) = delete;
+
+    size_t fillTupleBuffer(TupleBuffer& tupleBuffer, const std::stop_token& stopToken) override;
+
+    /// Opens the file and reads the schema of the stream.
+    void open() override;
+    void close() override;
+
+    static DescriptorConfig::Config validateAndFormat(std::unordered_map<std::string, std::string> config);
+
+    [[nodiscard]] std::ostream& toString(std::ostream& str) const override;
+
+private:
+    std::string filePath;
+    RecordBatchRowWriter rowWriter;
+    std::shared_ptr<arrow::RecordBatchReader> reader;
+};
+
+struct ConfigParametersArrowIPC
+{
+    static inline const DescriptorConfig::ConfigParameter<std::string> FILEPATH{
+        "file_path",
+        std::nullopt,
+        [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(FILEPATH, config); }};
+
+    static inline std::unordered_map<std::string, DescriptorConfig::ConfigParameterContainer> parameterMap
+        = DescriptorConfig::createConfigParameterContainerMap(SourceDescriptor::parameterMap, FILEPATH);
+};
+
+}
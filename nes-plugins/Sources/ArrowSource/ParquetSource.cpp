@@ -0,0 +1,229 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <ParquetSource.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <ranges>
+#include <stop_token>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <arrow/io/file.h>
+#include <arrow/memory_pool.h>
+#include <fmt/format.h>
+#include <parquet/arrow/reader.h>
+#include <parquet/metadata.h>
+#include <parquet/schema.h>
+#include <parquet/statistics.h>
+#include <parquet/types.h>
+
+#include <Configurations/Descriptor.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Sources/SourceDescriptor.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <ErrorHandling.hpp>
+#include <SourceRegistry.hpp>
+#include <SourceValidationRegistry.hpp>
+
+namespace NES
+{
+
+namespace
+{
+template <typename StatisticsType>
+std::pair<double, double> getTypedMinMax(const parquet::Statistics& statistics, const bool isUnsigned)
+{
+    const auto& typedStatistics = static_cast<const StatisticsType&>(statistics);
+    using ValueType = std::remove_cvref_t<decltype(typedStatistics.min())>;
+    if constexpr (std::is_integral_v<ValueType>)
+    {
+        /// Parquet stores unsigned integers in the physical type of the signed integers of the same width
+        if (isUnsigned)
+        {
+            using UnsignedType = std::make_unsigned_t<ValueType>;
+            return {static_cast<double>(static_cast<UnsignedType>(typedStatistics.min())),
+                    static_cast<double>(static_cast<UnsignedType>(typedStatistics.max()))};
+        }
+    }
+    return {static_cast<double>(typedStatistics.min()), static_cast<double>(typedStatistics.max())};
+}
+
+/// Returns nullopt, if the statistics do not contain a numeric min and max
+std::optional<std::pair<double, double>> getMinMax(const parquet::Statistics& statistics)
+{
+    if (not statistics.HasMinMax())
+    {
+        return std::nullopt;
+    }
+    const auto& logicalType = statistics.descr()->logical_type();
+    const auto isUnsigned = logicalType != nullptr and logicalType->is_int()
+        and not static_cast<const parquet::IntLogicalType&>(*logicalType).is_signed();
+    switch (statistics.physical_type())
+    {
+        case parquet::Type::INT32:
+            return getTypedMinMax<parquet::Int32Statistics>(statistics, isUnsigned);
+        case parquet::Type::INT64:
+            return getTypedMinMax<parquet::Int64Statistics>(statistics, isUnsigned);
+        case parquet::Type::FLOAT:
+            return getTypedMinMax<parquet::FloatStatistics>(statistics, isUnsigned);
+        case parquet::Type::DOUBLE:
+            return getTypedMinMax<parquet::DoubleStatistics>(statistics, isUnsigned);
+        default:
+            return std::nullopt;
+    }
+}
+}
+
+ParquetSource::ParquetSource(const SourceDescriptor& sourceDescriptor)
+    : filePath(sourceDescriptor.getFromConfig(ConfigParametersParquet::FILEPATH))
+    , fieldNames(
+          sourceDescriptor.getLogicalSource().getSchema()->getFields()
+          | std::views::transform([](const Schema::Field& field) { return field.getUnqualifiedName(); }) | std::ranges::to<std::vector>())
+    , filterFieldName(sourceDescriptor.getFromConfig(ConfigParametersParquet::ROW_GROUP_FILTER_FIELD))
+    , filterMin(sourceDescriptor.getFromConfig(ConfigParametersParquet::ROW_GROUP_FILTER_MIN))
+    , filterMax(sourceDescriptor.getFromConfig(ConfigParametersParquet::ROW_GROUP_FILTER_MAX))
+    , rowWriter(*sourceDescriptor.getLogicalSource().getSchema())
+{
+}
+
+void ParquetSource::open()
+{
+    auto file = arrow::io::ReadableFile::Open(filePath);
+    if (not file.ok())
+    {
+        throw CannotOpenSource("Could not open the Parquet file {}: {}", filePath, file.status().ToString());
+    }
+    parquet::arrow::FileReaderBuilder builder;
+    if (const auto status = builder.Open(std::move(file).ValueUnsafe()); not status.ok())
+    {
+        throw CannotOpenSource("Could not read the footer of the Parquet file {}: {}", filePath, status.ToString());
+    }
+    if (const auto status = builder.memory_pool(arrow::default_memory_pool())->Build(&fileReader); not status.ok())
+    {
+        throw CannotOpenSource("Could not create a reader for the Parquet file {}: {}", filePath, status.ToString());
+    }
+
+    const auto& metaData = *fileReader->parquet_reader()->metadata();
+    const auto columns = selectColumns(metaData);
+    const auto rowGroups = selectRowGroups(metaData);
+    numberOfRowGroups = metaData.num_row_groups();
+    numberOfSkippedRowGroups = numberOfRowGroups - rowGroups.size();
+    NES_DEBUG("ParquetSource reads {} of {} row groups of {}", rowGroups.size(), numberOfRowGroups, filePath);
+
+    std::unique_ptr<arrow::RecordBatchReader> batchReader;
+    if (const auto status = fileReader->GetRecordBatchReader(rowGroups, columns, &batchReader); not status.ok())
+    {
+        throw CannotOpenSource("Could not read the row groups of the Parquet file {}: {}", filePath, status.ToString());
+    }
+    reader = std::move(batchReader);
+}
+
+std::vector<int> ParquetSource::selectColumns(const parquet::FileMetaData& metaData) const
+{
+    /// Reading only the columns of the schema, i.e., Parquet does not decompress or decode all other columns
+    std::vector<int> columns;
+    for (const auto& fieldName : fieldNames)
+    {
+        const auto column = metaData.schema()->ColumnIndex(fieldName);
+        if (column < 0)
+        {
+            throw CannotOpenSource("The Parquet file {} does not contain a column for the field {}", filePath, fieldName);
+        }
+        columns.emplace_back(column);
+    }
+    return columns;
+}
+
+std::vector<int> ParquetSource::selectRowGroups(const parquet::FileMetaData& metaData) const
+{
+    auto rowGroups = std::views::iota(0, metaData.num_row_groups()) | std::ranges::to<std::vector>();
+    if (filterFieldName.empty())
+    {
+        return rowGroups;
+    }
+
+    const auto filterColumn = metaData.schema()->ColumnIndex(filterFieldName);
+    if (filterColumn < 0)
+    {
+        throw CannotOpenSource("The Parquet file {} does not contain the row group filter column {}", filePath, filterFieldName);
+    }
+    std::erase_if(
+        rowGroups,
+        [&](const int rowGroup)
+        {
+            const auto statistics = metaData.RowGroup(rowGroup)->ColumnChunk(filterColumn)->statistics();
+            if (statistics == nullptr)
+            {
+                return false;
+            }
+            const auto minMax = getMinMax(*statistics);
+            return minMax.has_value() and (minMax->second < filterMin or minMax->first > filterMax);
+        });
+    return rowGroups;
+}
+
+void ParquetSource::close()
+{
+    if (reader != nullptr)
+    {
+        [[maybe_unused]] const auto status = reader->Close();
+        reader.reset();
+    }
+    fileReader.reset();
+}
+
+size_t ParquetSource::fillTupleBuffer(TupleBuffer& tupleBuffer, const std::stop_token&)
+{
+    return rowWriter.writeRows(*reader, tupleBuffer.getAvailableMemoryArea<std::byte>());
+}
+
+DescriptorConfig::Config ParquetSource::validateAndFormat(std::unordered_map<std::string, std::string> config)
+{
+    return DescriptorConfig::validateAndFormat<ConfigParametersParquet>(std::move(config), NAME);
+}
+
+std::ostream& ParquetSource::toString(std::ostream& str) const
+{
+    str << fmt::format(
+        "\nParquetSource(filepath: {}, rowGroupFilter: {} in [{}, {}], skippedRowGroups: {}/{}, numberOfWrittenRows: {})",
+        filePath,
+        filterFieldName.empty() ? "none" : filterFieldName,
+        filterMin,
+        filterMax,
+        numberOfSkippedRowGroups,
+        numberOfRowGroups,
+        rowWriter.getNumberOfWrittenRows());
+    return str;
+}
+
+SourceValidationRegistryReturnType RegisterParquetSourceValidation(SourceValidationRegistryArguments sourceConfig)
+{
+    return ParquetSource::validateAndFormat(std::move(sourceConfig.config));
+}
+
+SourceRegistryReturnType SourceGeneratedRegistrar::RegisterParquetSource(SourceRegistryArguments sourceRegistryArguments)
+{
+    return std::make_unique<ParquetSource>(sourceRegistryArguments.sourceDescriptor);
+}
+
+}
@@ -0,0 +1,113 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <stop_token>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <arrow/record_batch.h>
+#include <parquet/arrow/reader.h>
+#include <parquet/metadata.h>
+
+#include <Configurations/Descriptor.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Sources/Source.hpp>
+#include <Sources/SourceDescriptor.hpp>
+#include <RecordBatchRowWriter.hpp>
+
+namespace NES
+{
+
+/// Reads a Parquet file and writes its record batches as native rows, c.f., RecordBatchRowWriter. Thus, queries must read the source
+/// with the 'Native' parser.
+/// The source decodes only the columns of the fields of its schema, which may be a subset of the columns of the file. Additionally, it
+/// skips all row groups whose min/max statistics of the filter column do not overlap with [row_group_filter_min, row_group_filter_max].
+/// The filter is conservative, i.e., it keeps row groups without statistics and the rows of the remaining row groups outside of the
+/// range. Thus, queries must still apply their selections to the rows of the source.
+class ParquetSource final : public Source
+{
+public:
+    static constexpr std::string_view NAME = "Parquet";
+
+    explicit ParquetSource(const SourceDescriptor& sourceDescriptor);
+    ~ParquetSource() override = default;
+
+    ParquetSource(const ParquetSource&) = delete;
+    ParquetSource& operator=(const ParquetSource&) = delete;
+    ParquetSource(ParquetSource&&) = delete;
+    ParquetSource& operator=(ParquetSource&&) = delete;
+
+    size_t fillTupleBuffer(TupleBuffer& tupleBuffer, const std::stop_token& stopToken) override;
+
+    /// Opens the file, reads its footer and selects the columns and row groups to read.
+    void open() override;
+    void close() override;
+
+    static DescriptorConfig::Config validateAndFormat(std::unordered_map<std::string, std::string> config);
+
+    [[nodiscard]] std::ostream& toString(std::ostream& str) const override;
+
+private:
+    [[nodiscard]] std::vector<int> selectColumns(const parquet::FileMetaData& metaData) const;
+    [[nodiscard]] std::vector<int> selectRowGroups(const parquet::FileMetaData& metaData) const;
+
+    std::string filePath;
+    std::vector<std::string> fieldNames;
+    std::string filterFieldName;
+    double filterMin;
+    double filterMax;
+    RecordBatchRowWriter rowWriter;
+
+    std::unique_ptr<parquet::arrow::FileReader> fileReader;
+    std::shared_ptr<arrow::RecordBatchReader> reader;
+    size_t numberOfRowGroups{0};
+    size_t numberOfSkippedRowGroups{0};
+};
+
+struct ConfigParametersParquet
+{
+    static inline const DescriptorConfig::ConfigParameter<std::string> FILEPATH{
+        "file_path",
+        std::nullopt,
+        [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(FILEPATH, config); }};
+    /// If empty, the source reads all row groups
+    static inline const DescriptorConfig::ConfigParameter<std::string> ROW_GROUP_FILTER_FIELD{
+        "row_group_filter_field",
+        "",
+        [](const std::unordered_map<std::string, std::string>& config)
+        { return DescriptorConfig::tryGet(ROW_GROUP_FILTER_FIELD, config); }};
+    static inline const DescriptorConfig::ConfigParameter<double> ROW_GROUP_FILTER_MIN{
+        "row_group_filter_min",
+        std::numeric_limits<double>::lowest(),
+        [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(ROW_GROUP_FILTER_MIN, config); }};
+    static inline const DescriptorConfig::ConfigParameter<double> ROW_GROUP_FILTER_MAX{
+        "row_group_filter_max",
+        std::numeric_limits<double>::max(),
+        [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(ROW_GROUP_FILTER_MAX, config); }};
+
+    static inline std::unordered_map<std::string, DescriptorConfig::ConfigParameterContainer> parameterMap
+        = DescriptorConfig::createConfigParameterContainerMap(
+            SourceDescriptor::parameterMap, FILEPATH, ROW_GROUP_FILTER_FIELD, ROW_GROUP_FILTER_MIN, ROW_GROUP_FILTER_MAX);
+};
+
+}
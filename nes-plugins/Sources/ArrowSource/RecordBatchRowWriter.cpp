@@ -0,0 +1,212 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <RecordBatchRowWriter.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <utility>
+
+#include <arrow/array.h>
+#include <arrow/record_batch.h>
+#include <arrow/status.h>
+#include <arrow/type.h>
+#include <magic_enum/magic_enum.hpp>
+
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/Schema.hpp>
+#include <ErrorHandling.hpp>
+
+namespace NES
+{
+
+namespace
+{
+bool isCompatible(const arrow::Type::type arrowType, const DataType::Type type)
+{
+    switch (type)
+    {
+        case DataType::Type::BOOLEAN:
+            return arrowType == arrow::Type::BOOL;
+        case DataType::Type::CHAR:
+            return arrowType == arrow::Type::INT8 or arrowType == arrow::Type::UINT8;
+        case DataType::Type::UINT8:
+            return arrowType == arrow::Type::UINT8;
+        case DataType::Type::INT8:
+            return arrowType == arrow::Type::INT8;
+        case DataType::Type::UINT16:
+            return arrowType == arrow::Type::UINT16;
+        case DataType::Type::INT16:
+            return arrowType == arrow::Type::INT16;
+        case DataType::Type::UINT32:
+            return arrowType == arrow::Type::UINT32;
+        case DataType::Type::INT32:
+            return arrowType == arrow::Type::INT32 or arrowType == arrow::Type::DATE32 or arrowType == arrow::Type::TIME32;
+        case DataType::Type::UINT64:
+        case DataType::Type::INT64:
+            /// Arrow stores timestamps, dates and durations as signed 64-bit integers
+            return arrowType == (type == DataType::Type::UINT64 ? arrow::Type::UINT64 : arrow::Type::INT64)
+                or arrowType == arrow::Type::TIMESTAMP or arrowType == arrow::Type::DATE64 or arrowType == arrow::Type::TIME64
+                or arrowType == arrow::Type::DURATION;
+        case DataType::Type::FLOAT32:
+            return arrowType == arrow::Type::FLOAT;
+        case DataType::Type::FLOAT64:
+            return arrowType == arrow::Type::DOUBLE;
+        case DataType::Type::VARSIZED:
+        case DataType::Type::VARSIZED_POINTER_REP:
+        case DataType::Type::UNDEFINED:
+            return false;
+    }
+    std::unreachable();
+}
+}
+
+RecordBatchRowWriter::RecordBatchRowWriter(const Schema& schema)
+{
+    for (const auto& field : schema)
+    {
+        if (field.dataType.type == DataType::Type::VARSIZED or field.dataType.type == DataType::Type::VARSIZED_POINTER_REP)
+        {
+            throw InvalidConfigParameter(
+                "Arrow sources write native rows, which cannot contain the variable-sized field {}", field.getUnqualifiedName());
+        }
+        const auto sizeInBytes = field.dataType.getSizeInBytes();
+        fields.emplace_back(field.getUnqualifiedName(), field.dataType.type, tupleSizeInBytes, sizeInBytes);
+        tupleSizeInBytes += sizeInBytes;
+    }
+    PRECONDITION(tupleSizeInBytes > 0, "Arrow sources require a schema with at least one field");
+}
+
+size_t RecordBatchRowWriter::writeRows(arrow::RecordBatchReader& reader, std::span<std::byte> buffer)
+{
+    const auto capacityInRows = buffer.size() / tupleSizeInBytes;
+    size_t numberOfRowsInBuffer = 0;
+    while (numberOfRowsInBuffer < capacityInRows and not isReaderExhausted)
+    {
+        if (currentBatch == nullptr or nextRowOfCurrentBatch == currentBatch->num_rows())
+        {
+            if (const auto status = reader.ReadNext(&currentBatch); not status.ok())
+            {
+                throw CannotFormatSourceData("Could not read the next record batch: {}", status.ToString());
+            }
+            nextRowOfCurrentBatch = 0;
+            if (currentBatch == nullptr)
+            {
+                isReaderExhausted = true;
+                break;
+            }
+            ++numberOfReadBatches;
+            resolveColumns(currentBatch->schema());
+            /// Checking the number of rows again, because batches may be empty
+            continue;
+        }
+
+        const auto numberOfRows = std::min(
+            capacityInRows - numberOfRowsInBuffer, static_cast<size_t>(currentBatch->num_rows() - nextRowOfCurrentBatch));
+        const auto rows = buffer.subspan(numberOfRowsInBuffer * tupleSizeInBytes, numberOfRows * tupleSizeInBytes);
+        for (size_t fieldIdx = 0; fieldIdx < fields.size(); ++fieldIdx)
+        {
+            copyColumn(*currentBatch->column(columnOfField[fieldIdx]), fields[fieldIdx], nextRowOfCurrentBatch, numberOfRows, rows);
+        }
+        nextRowOfCurrentBatch += static_cast<int64_t>(numberOfRows);
+        numberOfRowsInBuffer += numberOfRows;
+    }
+    numberOfWrittenRows += numberOfRowsInBuffer;
+    return numberOfRowsInBuffer * tupleSizeInBytes;
+}
+
+void RecordBatchRowWriter::resolveColumns(const std::shared_ptr<arrow::Schema>& batchSchema)
+{
+    if (resolvedSchema != nullptr and resolvedSchema->Equals(*batchSchema))
+    {
+        return;
+    }
+    columnOfField.clear();
+    for (const auto& field : fields)
+    {
+        const auto column = batchSchema->GetFieldIndex(field.name);
+        if (column < 0)
+        {
+            throw CannotFormatSourceData("The record batch does not contain the field {}: {}", field.name, batchSchema->ToString());
+        }
+        const auto arrowType = batchSchema->field(column)->type()->id();
+        if (not isCompatible(arrowType, field.type))
+        {
+            throw CannotFormatSourceData(
+                "Cannot write the Arrow type {} of the field {} as {}",
+                batchSchema->field(column)->type()->ToString(),
+                field.name,
+                magic_enum::enum_name(field.type));
+        }
+        columnOfField.emplace_back(column);
+    }
+    resolvedSchema = batchSchema;
+}
+
+void RecordBatchRowWriter::copyColumn(
+    const arrow::Array& column, const Field& field, const int64_t firstRow, const size_t numberOfRows, std::span<std::byte> rows) const
+{
+    if (field.type == DataType::Type::BOOLEAN)
+    {
+        /// Arrow packs booleans into bits
+        const auto& booleans = static_cast<const arrow::BooleanArray&>(column);
+        for (size_t row = 0; row < numberOfRows; ++row)
+        {
+            const auto rowIdx = firstRow + static_cast<int64_t>(row);
+            rows[(row * tupleSizeInBytes) + field.offsetInRow] = std::byte{booleans.IsValid(rowIdx) and booleans.Value(rowIdx)};
+        }
+        return;
+    }
+
+    const auto* values = column.data()->buffers[1]->data() + ((column.offset() + firstRow) * static_cast<int64_t>(field.sizeInBytes));
+    if (tupleSizeInBytes == field.sizeInBytes)
+    {
+        std::memcpy(rows.data(), values, numberOfRows * field.sizeInBytes);
+    }
+    else
+    {
+        for (size_t row = 0; row < numberOfRows; ++row)
+        {
+            std::memcpy(&rows[(row * tupleSizeInBytes) + field.offsetInRow], values + (row * field.sizeInBytes), field.sizeInBytes);
+        }
+    }
+
+    /// The values of null slots are undefined
+    if (column.null_count() > 0)
+    {
+        for (size_t row = 0; row < numberOfRows; ++row)
+        {
+            if (column.IsNull(firstRow + static_cast<int64_t>(row)))
+            {
+                std::memset(&rows[(row * tupleSizeInBytes) + field.offsetInRow], 0, field.sizeInBytes);
+            }
+        }
+    }
+}
+
+size_t RecordBatchRowWriter::getNumberOfWrittenRows() const
+{
+    return numberOfWrittenRows;
+}
+
+size_t RecordBatchRowWriter::getNumberOfReadBatches() const
+{
+    return numberOfReadBatches;
+}
+
+}
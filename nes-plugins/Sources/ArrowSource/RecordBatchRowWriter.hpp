@@ -0,0 +1,81 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <arrow/array.h>
+#include <arrow/record_batch.h>
+#include <arrow/type.h>
+
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/Schema.hpp>
+
+namespace NES
+{
+
+/// Writes the rows of Arrow record batches in the native row format of a schema. Thus, sources that read Arrow data fill their buffers
+/// with rows that the 'Native' parser passes on without parsing any field.
+/// Arrow stores each column of a batch contiguously, so the writer copies a column of a batch in a single strided pass, instead of
+/// converting the batch tuple by tuple. If the schema has a single field, the native rows and the Arrow column have the same layout and
+/// the writer copies the values of the column with a single memcpy.
+/// The writer resolves the fields of the schema by their unqualified name. Arrow may store any fixed-size field with the same width,
+/// e.g., a UINT64 field as Arrow timestamp. Null values become zero (false).
+class RecordBatchRowWriter
+{
+public:
+    /// @throws InvalidConfigParameter if the schema contains a variable-sized field
+    explicit RecordBatchRowWriter(const Schema& schema);
+
+    /// Writes the rows of the next batches of the reader into the buffer, until the buffer cannot hold another row or the reader is
+    /// exhausted. Returns the number of written bytes, which is a multiple of the tuple size and zero if the reader is exhausted.
+    /// @throws CannotFormatSourceData if a batch lacks a field of the schema or stores it with an incompatible type
+    size_t writeRows(arrow::RecordBatchReader& reader, std::span<std::byte> buffer);
+
+    [[nodiscard]] size_t getNumberOfWrittenRows() const;
+    [[nodiscard]] size_t getNumberOfReadBatches() const;
+
+private:
+    struct Field
+    {
+        std::string name;
+        DataType::Type type;
+        size_t offsetInRow;
+        size_t sizeInBytes;
+    };
+
+    /// Maps each field to its column in batches of the given schema, if the schema differs from the one of the previous batch
+    void resolveColumns(const std::shared_ptr<arrow::Schema>& batchSchema);
+    void copyColumn(const arrow::Array& column, const Field& field, int64_t firstRow, size_t numberOfRows, std::span<std::byte> rows) const;
+
+    std::vector<Field> fields;
+    size_t tupleSizeInBytes{0};
+
+    std::shared_ptr<arrow::Schema> resolvedSchema;
+    std::vector<int> columnOfField;
+    std::shared_ptr<arrow::RecordBatch> currentBatch;
+    int64_t nextRowOfCurrentBatch{0};
+    bool isReaderExhausted{false};
+
+    size_t numberOfWrittenRows{0};
+    size_t numberOfReadBatches{0};
+};
+
+}
@@ -0,0 +1,340 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <stop_token>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <unistd.h>
+
+#include <arrow/api.h>
+#include <arrow/io/file.h>
+#include <arrow/ipc/writer.h>
+#include <parquet/arrow/writer.h>
+
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/DataTypeProvider.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Sources/LogicalSource.hpp>
+#include <Sources/SourceCatalog.hpp>
+#include <Sources/SourceDescriptor.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <ArrowIPCSource.hpp>
+#include <BaseUnitTest.hpp>
+#include <ErrorHandling.hpp>
+#include <ParquetSource.hpp>
+
+namespace NES
+{
+
+namespace
+{
+template <typename BuilderType, typename ValueType>
+std::shared_ptr<arrow::Array> makeArray(const std::vector<std::optional<ValueType>>& values)
+{
+    BuilderType builder;
+    for (const auto& value : values)
+    {
+        const auto status = value.has_value() ? builder.Append(value.value()) : builder.AppendNull();
+        INVARIANT(status.ok(), "Could not append to the Arrow array: {}", status.ToString());
+    }
+    return builder.Finish().ValueOrDie();
+}
+
+void checkStatus(const arrow::Status& status)
+{
+    INVARIANT(status.ok(), "Could not write the test file: {}", status.ToString());
+}
+}
+
+class ArrowSourceTest : public Testing::BaseUnitTest
+{
+public:
+    static constexpr size_t NUMBER_OF_ROWS = 12;
+
+    /// A row of the file, whose fields are null, if they are nullopt
+    struct Row
+    {
+        uint64_t id;
+        std::optional<int32_t> value;
+        std::optional<double> price;
+        std::optional<bool> flag;
+    };
+
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("ArrowSourceTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup ArrowSourceTest test class.");
+    }
+
+    void SetUp() override
+    {
+        BaseUnitTest::SetUp();
+        filePath = std::filesystem::temp_directory_path()
+            / ("ArrowSourceTest_" + std::to_string(getpid()) + "_" + ::testing::UnitTest::GetInstance()->current_test_info()->name());
+        for (uint64_t row = 0; row < NUMBER_OF_ROWS; ++row)
+        {
+            rows.emplace_back(
+                row,
+                row % 4 == 1 ? std::nullopt : std::optional(static_cast<int32_t>(row * 10) - 30),
+                row == 7 ? std::nullopt : std::optional(static_cast<double>(row) * 0.5),
+                row == 3 ? std::nullopt : std::optional(row % 2 == 0));
+        }
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove(filePath);
+        BaseUnitTest::TearDown();
+    }
+
+    /// The columns of the rows, followed by an utf8 column that no source schema contains
+    std::shared_ptr<arrow::Table> createTable() const
+    {
+        std::vector<std::optional<uint64_t>> ids;
+        std::vector<std::optional<int32_t>> values;
+        std::vector<std::optional<double>> prices;
+        std::vector<std::optional<bool>> flags;
+        std::vector<std::optional<std::string>> names;
+        for (const auto& row : rows)
+        {
+            ids.emplace_back(row.id);
+            values.emplace_back(row.value);
+            prices.emplace_back(row.price);
+            flags.emplace_back(row.flag);
+            names.emplace_back("name" + std::to_string(row.id));
+        }
+        const auto arrowSchema = arrow::schema(
+            {arrow::field("id", arrow::uint64()),
+             arrow::field("value", arrow::int32()),
+             arrow::field("price", arrow::float64()),
+             arrow::field("flag", arrow::boolean()),
+             arrow::field("name", arrow::utf8())});
+        return arrow::Table::Make(
+            arrowSchema,
+            {makeArray<arrow::UInt64Builder>(ids),
+             makeArray<arrow::Int32Builder>(values),
+             makeArray<arrow::DoubleBuilder>(prices),
+             makeArray<arrow::BooleanBuilder>(flags),
+             makeArray<arrow::StringBuilder>(names)});
+    }
+
+    /// Writes the table as Arrow IPC stream with batches of 'batchSize' rows, which are slices of the columns with an offset
+    void writeArrowIPCFile(const arrow::Table& table, const int64_t batchSize) const
+    {
+        const auto output = arrow::io::FileOutputStream::Open(filePath.string()).ValueOrDie();
+        const auto writer = arrow::ipc::MakeStreamWriter(output, table.schema()).ValueOrDie();
+        arrow::TableBatchReader batchReader(table);
+        batchReader.set_chunksize(batchSize);
+        std::shared_ptr<arrow::RecordBatch> batch;
+        while (batchReader.ReadNext(&batch).ok() and batch != nullptr)
+        {
+            checkStatus(writer->WriteRecordBatch(*batch));
+        }
+        checkStatus(writer->Close());
+        checkStatus(output->Close());
+    }
+
+    void writeParquetFile(const arrow::Table& table, const int64_t rowGroupSize) const
+    {
+        const auto output = arrow::io::FileOutputStream::Open(filePath.string()).ValueOrDie();
+        checkStatus(parquet::arrow::WriteTable(table, arrow::default_memory_pool(), output, rowGroupSize));
+        checkStatus(output->Close());
+    }
+
+    SourceDescriptor
+    createDescriptor(const Schema& schema, const std::string_view sourceType, std::unordered_map<std::string, std::string> config)
+    {
+        const auto logicalSource = sourceCatalog.addLogicalSource("testSource" + std::to_string(numberOfLogicalSources++), schema);
+        EXPECT_TRUE(logicalSource.has_value());
+        config.emplace("file_path", filePath.string());
+        const auto descriptor = sourceCatalog.addPhysicalSource(logicalSource.value(), sourceType, std::move(config), {{"type", "Native"}});
+        EXPECT_TRUE(descriptor.has_value());
+        return descriptor.value();
+    }
+
+    /// Fills buffers that hold a few rows only, thus the rows of a batch span several buffers and buffers span several batches
+    template <typename SourceType>
+    std::vector<std::byte> readAll(SourceType& source, const size_t tupleSizeInBytes) const
+    {
+        std::vector<std::byte> readRows;
+        while (true)
+        {
+            auto buffer = bufferManager->getBufferBlocking();
+            const auto numberOfBytes = source.fillTupleBuffer(buffer, std::stop_token{});
+            EXPECT_EQ(numberOfBytes % tupleSizeInBytes, 0);
+            if (numberOfBytes == 0)
+            {
+                return readRows;
+            }
+            const auto bytes = buffer.getAvailableMemoryArea<std::byte>().first(numberOfBytes);
+            readRows.insert(readRows.end(), bytes.begin(), bytes.end());
+        }
+    }
+
+    template <typename T>
+    static T readField(const std::vector<std::byte>& readRows, const size_t offset)
+    {
+        T value;
+        std::memcpy(&value, &readRows[offset], sizeof(T));
+        return value;
+    }
+
+    std::filesystem::path filePath;
+    std::vector<Row> rows;
+    SourceCatalog sourceCatalog;
+    size_t numberOfLogicalSources = 0;
+    /// Holds three rows of the schema with all fields
+    std::shared_ptr<BufferManager> bufferManager = BufferManager::create(64, 16);
+};
+
+/// clang tidy doesn't recognize the .has_value in the ASSERT_TRUE
+/// NOLINTBEGIN(bugprone-unchecked-optional-access)
+TEST_F(ArrowSourceTest, ArrowIPCSourceWritesTypedRowsWithNullsAsZero)
+{
+    writeArrowIPCFile(*createTable(), 5);
+    Schema schema;
+    schema.addField("id", DataTypeProvider::provideDataType(DataType::Type::UINT64));
+    schema.addField("value", DataTypeProvider::provideDataType(DataType::Type::INT32));
+    schema.addField("price", DataTypeProvider::provideDataType(DataType::Type::FLOAT64));
+    schema.addField("flag", DataTypeProvider::provideDataType(DataType::Type::BOOLEAN));
+    constexpr size_t tupleSize = sizeof(uint64_t) + sizeof(int32_t) + sizeof(double) + sizeof(bool);
+    ASSERT_EQ(schema.getSizeOfSchemaInBytes(), tupleSize);
+
+    ArrowIPCSource source(createDescriptor(schema, "ArrowIPC", {}));
+    source.open();
+    const auto readRows = readAll(source, tupleSize);
+    source.close();
+
+    ASSERT_EQ(readRows.size(), NUMBER_OF_ROWS * tupleSize);
+    for (size_t row = 0; row < NUMBER_OF_ROWS; ++row)
+    {
+        const auto rowOffset = row * tupleSize;
+        EXPECT_EQ(readField<uint64_t>(readRows, rowOffset), rows[row].id) << "row " << row;
+        EXPECT_EQ(readField<int32_t>(readRows, rowOffset + 8), rows[row].value.value_or(0)) << "row " << row;
+        EXPECT_EQ(readField<double>(readRows, rowOffset + 12), rows[row].price.value_or(0.0)) << "row " << row;
+        EXPECT_EQ(readField<bool>(readRows, rowOffset + 20), rows[row].flag.value_or(false)) << "row " << row;
+    }
+}
+
+TEST_F(ArrowSourceTest, ArrowIPCSourceCopiesSingleFieldWithNulls)
+{
+    writeArrowIPCFile(*createTable(), 5);
+    /// The rows of a single field have the layout of the Arrow column, thus the writer copies it as a whole and zeroes the nulls afterward
+    Schema schema;
+    schema.addField("value", DataTypeProvider::provideDataType(DataType::Type::INT32));
+
+    ArrowIPCSource source(createDescriptor(schema, "ArrowIPC", {}));
+    source.open();
+    const auto readRows = readAll(source, sizeof(int32_t));
+    source.close();
+
+    ASSERT_EQ(readRows.size(), NUMBER_OF_ROWS * sizeof(int32_t));
+    for (size_t row = 0; row < NUMBER_OF_ROWS; ++row)
+    {
+        EXPECT_EQ(readField<int32_t>(readRows, row * sizeof(int32_t)), rows[row].value.value_or(0)) << "row " << row;
+    }
+}
+
+TEST_F(ArrowSourceTest, ParquetSourceReadsProjectedColumnsOfSelectedRowGroups)
+{
+    writeParquetFile(*createTable(), 4);
+    /// The schema orders the fields differently from the file and does not contain all of its columns, e.g., the var-sized names
+    Schema schema;
+    schema.addField("flag", DataTypeProvider::provideDataType(DataType::Type::BOOLEAN));
+    schema.addField("id", DataTypeProvider::provideDataType(DataType::Type::UINT64));
+    schema.addField("value", DataTypeProvider::provideDataType(DataType::Type::INT32));
+    constexpr size_t tupleSize = sizeof(bool) + sizeof(uint64_t) + sizeof(int32_t);
+
+    /// Solely the second of the three row groups, i.e., the ids 4 to 7, overlaps with the filter
+    ParquetSource source(createDescriptor(
+        schema, "Parquet", {{"row_group_filter_field", "id"}, {"row_group_filter_min", "5"}, {"row_group_filter_max", "6"}}));
+    source.open();
+    const auto readRows = readAll(source, tupleSize);
+    source.close();
+
+    constexpr size_t firstRow = 4;
+    constexpr size_t numberOfReadRows = 4;
+    ASSERT_EQ(readRows.size(), numberOfReadRows * tupleSize);
+    for (size_t row = 0; row < numberOfReadRows; ++row)
+    {
+        const auto rowOffset = row * tupleSize;
+        const auto& expected = rows[firstRow + row];
+        EXPECT_EQ(readField<bool>(readRows, rowOffset), expected.flag.value_or(false)) << "row " << row;
+        EXPECT_EQ(readField<uint64_t>(readRows, rowOffset + 1), expected.id) << "row " << row;
+        EXPECT_EQ(readField<int32_t>(readRows, rowOffset + 9), expected.value.value_or(0)) << "row " << row;
+    }
+}
+
+TEST_F(ArrowSourceTest, ParquetSourceReadsAllRowGroupsWithoutFilter)
+{
+    writeParquetFile(*createTable(), 4);
+    Schema schema;
+    schema.addField("id", DataTypeProvider::provideDataType(DataType::Type::UINT64));
+    schema.addField("price", DataTypeProvider::provideDataType(DataType::Type::FLOAT64));
+    constexpr size_t tupleSize = sizeof(uint64_t) + sizeof(double);
+
+    ParquetSource source(createDescriptor(schema, "Parquet", {}));
+    source.open();
+    const auto readRows = readAll(source, tupleSize);
+    source.close();
+
+    ASSERT_EQ(readRows.size(), NUMBER_OF_ROWS * tupleSize);
+    for (size_t row = 0; row < NUMBER_OF_ROWS; ++row)
+    {
+        EXPECT_EQ(readField<uint64_t>(readRows, row * tupleSize), rows[row].id) << "row " << row;
+        EXPECT_EQ(readField<double>(readRows, (row * tupleSize) + 8), rows[row].price.value_or(0.0)) << "row " << row;
+    }
+}
+
+TEST_F(ArrowSourceTest, SourcesRejectVariableSizedFields)
+{
+    writeArrowIPCFile(*createTable(), 5);
+    /// Native rows cannot hold the var-sized names, thus the source rejects the schema instead of reading them
+    Schema schema;
+    schema.addField("id", DataTypeProvider::provideDataType(DataType::Type::UINT64));
+    schema.addField("name", DataTypeProvider::provideDataType(DataType::Type::VARSIZED));
+    const auto descriptor = createDescriptor(schema, "ArrowIPC", {});
+    ASSERT_EXCEPTION_ERRORCODE(ArrowIPCSource source(descriptor), ErrorCode::InvalidConfigParameter);
+}
+
+TEST_F(ArrowSourceTest, SourceRejectsIncompatibleArrowType)
+{
+    writeArrowIPCFile(*createTable(), 5);
+    /// The file stores the value as 32-bit integer
+    Schema schema;
+    schema.addField("value", DataTypeProvider::provideDataType(DataType::Type::INT64));
+
+    ArrowIPCSource source(createDescriptor(schema, "ArrowIPC", {}));
+    source.open();
+    auto buffer = bufferManager->getBufferBlocking();
+    ASSERT_EXCEPTION_ERRORCODE(
+        [[maybe_unused]] const auto numberOfBytes = source.fillTupleBuffer(buffer, std::stop_token{}), ErrorCode::CannotFormatSourceData);
+    source.close();
+}
+/// NOLINTEND(bugprone-unchecked-optional-access)
+
+}
@@ -14,9 +14,12 @@
 
 #include <Generator.hpp>
 
+#include <cstddef>
 #include <memory>
+#include <numeric>
 #include <ostream>
 #include <ranges>
+#include <span>
 #include <string_view>
 #include <utility>
 #include <variant>
@@ -55,6 +58,50 @@ void Generator::generateTuple(std::ostream& ostream)
     ostream << Generator::tupleDelimiter;
 }
 
+void Generator::generateNativeTuple(std::span<std::byte> row)
+{
+    PRECONDITION(not this->fields.empty(), "Cannot generate a row if there are no fields!");
+    size_t offset = 0;
+    const auto generateField = Overloaded{
+        [this, &row, &offset](GeneratorFields::BaseStoppableGeneratorField& field)
+        {
+            const bool fieldAlreadyStopped = field.stop;
+            field.generateNative(row.subspan(offset, field.getSizeInBytes()), this->randEng);
+            offset += field.getSizeInBytes();
+            if (field.stop && !fieldAlreadyStopped)
+            {
+                this->numStoppedFields++;
+            }
+        },
+        [this, &row, &offset](GeneratorFields::BaseGeneratorField& field)
+        {
+            field.generateNative(row.subspan(offset, field.getSizeInBytes()), this->randEng);
+            offset += field.getSizeInBytes();
+        }};
+
+    for (auto& field : this->fields)
+    {
+        std::visit(generateField, *field);
+    }
+}
+
+std::vector<size_t> Generator::getNativeFieldSizes() const
+{
+    std::vector<size_t> fieldSizes;
+    fieldSizes.reserve(this->fields.size());
+    for (const auto& field : this->fields)
+    {
+        fieldSizes.emplace_back(std::visit([](const GeneratorFields::BaseGeneratorField& field) { return field.getSizeInBytes(); }, *field));
+    }
+    return fieldSizes;
+}
+
+size_t Generator::getNativeTupleSize() const
+{
+    const auto fieldSizes = getNativeFieldSizes();
+    return std::accumulate(fieldSizes.begin(), fieldSizes.end(), size_t{0});
+}
+
 void Generator::addField(std::unique_ptr<GeneratorFields::GeneratorFieldType> field)
 {
     std::visit(
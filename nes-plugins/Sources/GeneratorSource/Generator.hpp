@@ -19,6 +19,7 @@
 #include <memory>
 #include <ostream>
 #include <random>
+#include <span>
 #include <string_view>
 #include <utility>
 #include <vector>
@@ -54,6 +55,14 @@ public:
     /// @param ostream output stream
     void generateTuple(std::ostream& ostream);
 
+    /// Generates a single row in its native layout, i.e., the binary values of the fields back to back without delimiters
+    /// @param row memory of exactly 'getNativeTupleSize()' bytes
+    void generateNativeTuple(std::span<std::byte> row);
+
+    /// Sizes of the binary values of the fields in the order of the generator schema
+    [[nodiscard]] std::vector<size_t> getNativeFieldSizes() const;
+    [[nodiscard]] size_t getNativeTupleSize() const;
+
     void addField(std::unique_ptr<GeneratorFields::GeneratorFieldType> field);
 
     /// TODO #355: Parse from YAML Nodes instead of a string
@@ -14,14 +14,18 @@
 
 #include <GeneratorFields.hpp>
 
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <iomanip>
 #include <ios>
 #include <ostream>
 #include <random>
 #include <ranges>
+#include <span>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <variant>
 #include <vector>
 #include <DataTypes/DataType.hpp>
@@ -231,6 +235,20 @@ SequenceField::SequenceField(std::string_view rawSchemaLine)
     this->stop = false;
 }
 
+template <class T>
+void SequenceField::advance(T& position)
+{
+    if (this->sequencePosition < this->sequenceEnd)
+    {
+        const auto& step = std::get<T>(sequenceStepSize);
+        position += step;
+    }
+    if (sequencePosition >= this->sequenceEnd)
+    {
+        this->stop = true;
+    }
+}
+
 std::ostream& SequenceField::generate(std::ostream& os, std::default_random_engine& /*re*/)
 {
     std::visit(
@@ -245,21 +263,28 @@ std::ostream& SequenceField::generate(std::ostream& os, std::default_random_engi
             {
                 os << pos;
             }
-
-            if (this->sequencePosition < this->sequenceEnd)
-            {
-                const auto& step = std::get<T>(sequenceStepSize);
-                pos += step;
-            }
+            advance(pos);
         },
         sequencePosition);
-    if (sequencePosition >= this->sequenceEnd)
-    {
-        this->stop = true;
-    }
     return os;
 }
 
+void SequenceField::generateNative(std::span<std::byte> destination, std::default_random_engine& /*re*/)
+{
+    std::visit(
+        [&]<typename T>(T& pos)
+        {
+            std::memcpy(destination.data(), &pos, sizeof(T));
+            advance(pos);
+        },
+        sequencePosition);
+}
+
+size_t SequenceField::getSizeInBytes() const
+{
+    return std::visit([]<typename T>(const T&) { return sizeof(T); }, sequencePosition);
+}
+
 namespace
 {
 template <typename T, typename U = double>
@@ -356,6 +381,22 @@ std::ostream& NormalDistributionField::generate(std::ostream& os, std::default_r
     return os;
 }
 
+void NormalDistributionField::generateNative(std::span<std::byte> destination, std::default_random_engine& randEng)
+{
+    std::visit(
+        [&destination, &randEng](auto& distribution)
+        {
+            const auto value = distribution(randEng);
+            std::memcpy(destination.data(), &value, sizeof(value));
+        },
+        distribution);
+}
+
+size_t NormalDistributionField::getSizeInBytes() const
+{
+    return std::visit([](const auto& distribution) { return sizeof(typename std::decay_t<decltype(distribution)>::result_type); }, distribution);
+}
+
 void NormalDistributionField::validate(std::string_view rawSchemaLine)
 {
     const auto parameters = Util::splitWithStringDelimiter<std::string_view>(rawSchemaLine, " ");
@@ -15,10 +15,12 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <ostream>
 #include <random>
+#include <span>
 #include <string_view>
 #include <unordered_map>
 #include <variant>
@@ -39,6 +41,9 @@ class BaseGeneratorField
 public:
     virtual ~BaseGeneratorField() = default;
     virtual std::ostream& generate(std::ostream& os, std::default_random_engine& /*randEng*/) = 0;
+    /// Writes the binary value to the destination, which has room for 'getSizeInBytes()' bytes
+    virtual void generateNative(std::span<std::byte> destination, std::default_random_engine& /*randEng*/) = 0;
+    [[nodiscard]] virtual size_t getSizeInBytes() const = 0;
 };
 
 class BaseStoppableGeneratorField : public BaseGeneratorField
@@ -57,6 +62,8 @@ public:
     explicit SequenceField(std::string_view rawSchemaLine);
 
     std::ostream& generate(std::ostream& os, std::default_random_engine& randEng) override;
+    void generateNative(std::span<std::byte> destination, std::default_random_engine& randEng) override;
+    [[nodiscard]] size_t getSizeInBytes() const override;
 
     static void validate(std::string_view rawSchemaLine);
 
@@ -68,6 +75,9 @@ public:
 private:
     template <class T>
     void parse(std::string_view start, std::string_view end, std::string_view step);
+    /// Moves the sequence to its next position and stops the field at the end of the sequence
+    template <class T>
+    void advance(T& position);
 };
 
 constexpr auto NUM_PARAMETERS_NORMAL_DISTRIBUTION_FIELD = 4;
@@ -97,6 +107,8 @@ public:
 
     explicit NormalDistributionField(std::string_view rawSchemaLine);
     std::ostream& generate(std::ostream& os, std::default_random_engine& randEng) override;
+    void generateNative(std::span<std::byte> destination, std::default_random_engine& randEng) override;
+    [[nodiscard]] size_t getSizeInBytes() const override;
     static void validate(std::string_view rawSchemaLine);
 
 private:
@@ -14,24 +14,35 @@
 
 #include <GeneratorSource.hpp>
 
+#include <algorithm>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <exception>
 #include <iostream>
+#include <limits>
 #include <memory>
+#include <optional>
+#include <span>
 #include <stop_token>
 #include <string>
 #include <thread>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 #include <Configurations/Descriptor.hpp>
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/Schema.hpp>
 #include <Runtime/TupleBuffer.hpp>
 #include <Sources/SourceDescriptor.hpp>
 #include <Util/Logger/Logger.hpp>
+#include <magic_enum/magic_enum.hpp>
+#include <ErrorHandling.hpp>
 #include <FixedGeneratorRate.hpp>
 #include <Generator.hpp>
 #include <GeneratorRate.hpp>
+#include <GeneratorWorkloads.hpp>
 #include <SinusGeneratorRate.hpp>
 #include <SourceRegistry.hpp>
 #include <SourceValidationRegistry.hpp>
@@ -44,10 +55,14 @@ GeneratorSource::GeneratorSource(const SourceDescriptor& sourceDescriptor)
     , maxRuntime(sourceDescriptor.getFromConfig(ConfigParametersGenerator::MAX_RUNTIME_MS))
     , generatorSchemaRaw(sourceDescriptor.getFromConfig(ConfigParametersGenerator::GENERATOR_SCHEMA))
     , generator(
-          seed,
-          sourceDescriptor.getFromConfig(ConfigParametersGenerator::SEQUENCE_STOPS_GENERATOR),
-          sourceDescriptor.getFromConfig(ConfigParametersGenerator::GENERATOR_SCHEMA))
+          generatorSchemaRaw.empty()
+              ? std::nullopt
+              : std::make_optional<Generator>(
+                    seed, sourceDescriptor.getFromConfig(ConfigParametersGenerator::SEQUENCE_STOPS_GENERATOR), generatorSchemaRaw))
+    , workloadType(sourceDescriptor.getFromConfig(ConfigParametersGenerator::WORKLOAD))
     , flushInterval(std::chrono::milliseconds{sourceDescriptor.getFromConfig(ConfigParametersGenerator::FLUSH_INTERVAL_MS)})
+    , outputFormat(sourceDescriptor.getFromConfig(ConfigParametersGenerator::OUTPUT_FORMAT))
+    , bufferPoolSize(sourceDescriptor.getFromConfig(ConfigParametersGenerator::BUFFER_POOL_SIZE))
 {
     NES_TRACE("Init GeneratorSource.")
     switch (sourceDescriptor.getFromConfig(ConfigParametersGenerator::GENERATOR_RATE_TYPE))
@@ -64,12 +79,70 @@ GeneratorSource::GeneratorSource(const SourceDescriptor& sourceDescriptor)
             generatorRate = std::make_unique<SinusGeneratorRate>(frequency, amplitude);
             break;
     }
+    if (workloadType != GeneratorWorkload::Type::NONE)
+    {
+        if (outputFormat != OutputFormat::NATIVE)
+        {
+            throw InvalidConfigParameter(
+                "The generator workload {} requires the NATIVE output format", magic_enum::enum_name(workloadType));
+        }
+        workload = GeneratorWorkload::create(
+            workloadType,
+            seed,
+            sourceDescriptor.getFromConfig(ConfigParametersGenerator::EVENT_RATE),
+            sourceDescriptor.getFromConfig(ConfigParametersGenerator::SKEW),
+            sourceDescriptor.getFromConfig(ConfigParametersGenerator::WORKLOAD_TUPLES));
+    }
+    else if (not generator.has_value())
+    {
+        throw InvalidConfigParameter("The GeneratorSource requires either a generator_schema or a generator_workload");
+    }
+    if (outputFormat != OutputFormat::NATIVE)
+    {
+        return;
+    }
+
+    const auto fieldSizes = workload ? workload->getNativeFieldSizes() : generator->getNativeFieldSizes();
+    const auto timestampFieldName = sourceDescriptor.getFromConfig(ConfigParametersGenerator::TIMESTAMP_FIELD);
+    const auto schema = sourceDescriptor.getLogicalSource().getSchema();
+    size_t fieldIdx = 0;
+    for (const auto& field : *schema)
+    {
+        if (fieldIdx >= fieldSizes.size() or field.dataType.getSizeInBytes() != fieldSizes[fieldIdx])
+        {
+            throw InvalidConfigParameter(
+                "The NATIVE output format of the GeneratorSource requires a generator schema that matches the fields of the logical source, "
+                "but the generator field {} does not match the field '{}'",
+                fieldIdx,
+                field.getUnqualifiedName());
+        }
+        if (field.getUnqualifiedName() == timestampFieldName)
+        {
+            if (field.dataType.type != DataType::Type::UINT64 and field.dataType.type != DataType::Type::INT64)
+            {
+                throw InvalidConfigParameter("The generator_timestamp_field '{}' must be a 64-bit integer", timestampFieldName);
+            }
+            timestampFieldOffset = nativeTupleSize;
+        }
+        nativeTupleSize += fieldSizes[fieldIdx++];
+    }
+    if (fieldIdx != fieldSizes.size())
+    {
+        throw InvalidConfigParameter(
+            "The generator schema has {} fields, but the logical source of the NATIVE GeneratorSource has {}", fieldSizes.size(), fieldIdx);
+    }
+    if (not timestampFieldName.empty() and not timestampFieldOffset.has_value())
+    {
+        throw InvalidConfigParameter("The generator_timestamp_field '{}' is not a field of the logical source", timestampFieldName);
+    }
 }
 
 void GeneratorSource::open()
 {
     this->generatorStartTime = std::chrono::system_clock::now();
     this->startOfInterval = std::chrono::system_clock::now();
+    this->bufferPool.clear();
+    this->nextPooledBuffer = 0;
     NES_TRACE("Opening GeneratorSource.");
 }
 
@@ -94,7 +167,8 @@ size_t GeneratorSource::fillTupleBuffer(TupleBuffer& tupleBuffer, const std::sto
 
         /// Asking the generatorRate how many tuples we should generate for this interval [now, now + flushInterval].
         /// If we receive 0 tuples, we do not return but wait till another interval, as a return value of 0 tuples results in the query being terminated.
-        uint64_t numberOfTuplesToGenerate = 0;
+        const auto isUnthrottled = outputFormat == OutputFormat::NATIVE and flushInterval.count() == 0;
+        uint64_t numberOfTuplesToGenerate = isUnthrottled ? std::numeric_limits<uint64_t>::max() : 0;
         uint64_t noIntervals = 1;
         while (numberOfTuplesToGenerate == 0)
         {
@@ -108,35 +182,14 @@ size_t GeneratorSource::fillTupleBuffer(TupleBuffer& tupleBuffer, const std::sto
             }
         }
 
-        /// Generating the required number of tuples. Any tuples that do not fit into the tuple buffer, we add to the orphanTuples and emit
-        /// a warning. Also, we first add the orphanTuples to the tuple buffer, before adding newly-created once.
-        const size_t rawTBSize = tupleBuffer.getBufferSize();
-        uint64_t curTupleCount = 0;
-        size_t writtenBytes = 0;
-        while (curTupleCount < numberOfTuplesToGenerate and not this->generator.shouldStop() and not stopToken.stop_requested())
-        {
-            auto insertedBytes = tuplesStream.tellp();
-            if (not orphanTuples.empty())
-            {
-                tuplesStream << orphanTuples;
-                orphanTuples.clear();
-            }
-            this->generator.generateTuple(tuplesStream);
-            ++generatedTuplesCounter;
-            insertedBytes = tuplesStream.tellp() - insertedBytes;
-            if (writtenBytes + insertedBytes > rawTBSize)
-            {
-                this->orphanTuples = tuplesStream.str().substr(writtenBytes, tuplesStream.str().length() - writtenBytes);
-                NES_WARNING("Not all required tuples fit into buffer of size {}. {} are left over", rawTBSize, tuplesStream.str().size());
-                break;
-            }
-            writtenBytes += insertedBytes;
-            ++curTupleCount;
-        }
-        tuplesStream.read(tupleBuffer.getAvailableMemoryArea<std::istream::char_type>().data(), writtenBytes);
+        const auto writtenBytes = outputFormat == OutputFormat::NATIVE ? writeNativeTuples(tupleBuffer, numberOfTuplesToGenerate, stopToken)
+                                                                       : writeCSVTuples(tupleBuffer, numberOfTuplesToGenerate, stopToken);
         ++generatedBuffers;
-        tuplesStream.str("");
         NES_DEBUG("Wrote {} bytes", writtenBytes);
+        if (isUnthrottled)
+        {
+            return writtenBytes;
+        }
 
         /// Calculating how long to sleep. The whole method should take the duration of the flushInterval. If we have some time left, we
         /// sleep for the remaining duration. If there is no time left, we print a warning.
@@ -169,7 +222,10 @@ std::ostream& GeneratorSource::toString(std::ostream& str) const
     str << "\nGeneratorSource(";
     str << "\n\tgenerated buffers: " << this->generatedBuffers;
     str << "\n\tschema: " << this->generatorSchemaRaw;
+    str << "\n\tworkload: " << magic_enum::enum_name(this->workloadType);
     str << "\n\tseed: " << this->seed;
+    str << "\n\toutput format: " << (this->outputFormat == OutputFormat::NATIVE ? "NATIVE" : "CSV");
+    str << "\n\tbuffer pool size: " << this->bufferPoolSize;
     str << ")\n";
     return str;
 }
@@ -179,6 +235,127 @@ DescriptorConfig::Config GeneratorSource::validateAndFormat(std::unordered_map<s
     return DescriptorConfig::validateAndFormat<ConfigParametersGenerator>(std::move(config), NAME);
 }
 
+size_t GeneratorSource::writeCSVTuples(TupleBuffer& tupleBuffer, const uint64_t numberOfTuples, const std::stop_token& stopToken)
+{
+    /// Generating the required number of tuples. Any tuples that do not fit into the tuple buffer, we add to the orphanTuples and emit
+    /// a warning. Also, we first add the orphanTuples to the tuple buffer, before adding newly-created once.
+    const size_t rawTBSize = tupleBuffer.getBufferSize();
+    uint64_t curTupleCount = 0;
+    size_t writtenBytes = 0;
+    while (curTupleCount < numberOfTuples and not shouldStop() and not stopToken.stop_requested())
+    {
+        auto insertedBytes = tuplesStream.tellp();
+        if (not orphanTuples.empty())
+        {
+            tuplesStream << orphanTuples;
+            orphanTuples.clear();
+        }
+        this->generator->generateTuple(tuplesStream);
+        ++generatedTuplesCounter;
+        insertedBytes = tuplesStream.tellp() - insertedBytes;
+        if (writtenBytes + insertedBytes > rawTBSize)
+        {
+            this->orphanTuples = tuplesStream.str().substr(writtenBytes, tuplesStream.str().length() - writtenBytes);
+            NES_WARNING("Not all required tuples fit into buffer of size {}. {} are left over", rawTBSize, tuplesStream.str().size());
+            break;
+        }
+        writtenBytes += insertedBytes;
+        ++curTupleCount;
+    }
+    tuplesStream.read(tupleBuffer.getAvailableMemoryArea<std::istream::char_type>().data(), writtenBytes);
+    tuplesStream.str("");
+    return writtenBytes;
+}
+
+size_t GeneratorSource::writeNativeTuples(TupleBuffer& tupleBuffer, const uint64_t numberOfTuples, const std::stop_token& stopToken)
+{
+    /// In contrast to the CSV format, the tuples that do not fit into the buffer are not generated, as the rate is solely approximated
+    const auto memory = tupleBuffer.getAvailableMemoryArea<std::byte>();
+    const auto tuplesPerBuffer = memory.size() / nativeTupleSize;
+    PRECONDITION(tuplesPerBuffer > 0, "A buffer of size {} cannot hold a single native tuple of size {}", memory.size(), nativeTupleSize);
+    const auto numberOfTuplesToWrite = std::min<uint64_t>(numberOfTuples, tuplesPerBuffer);
+
+    size_t writtenTuples = 0;
+    if (bufferPoolSize == 0)
+    {
+        while (writtenTuples < numberOfTuplesToWrite and not shouldStop() and not stopToken.stop_requested())
+        {
+            generateNativeTuple(memory.subspan(writtenTuples * nativeTupleSize, nativeTupleSize));
+            ++writtenTuples;
+        }
+    }
+    else
+    {
+        if (bufferPool.empty())
+        {
+            generateBufferPool(tuplesPerBuffer);
+        }
+        if (bufferPool.empty())
+        {
+            return 0;
+        }
+        const auto& pooledBuffer = bufferPool[nextPooledBuffer];
+        nextPooledBuffer = (nextPooledBuffer + 1) % bufferPool.size();
+        writtenTuples = std::min<uint64_t>(numberOfTuplesToWrite, pooledBuffer.size() / nativeTupleSize);
+        std::memcpy(memory.data(), pooledBuffer.data(), writtenTuples * nativeTupleSize);
+    }
+    generatedTuplesCounter += writtenTuples;
+    const auto writtenBytes = writtenTuples * nativeTupleSize;
+    overwriteTimestamps(memory.first(writtenBytes));
+    return writtenBytes;
+}
+
+void GeneratorSource::generateBufferPool(const size_t tuplesPerBuffer)
+{
+    const auto start = std::chrono::steady_clock::now();
+    bufferPool.reserve(bufferPoolSize);
+    for (uint32_t bufferIdx = 0; bufferIdx < bufferPoolSize and not shouldStop(); ++bufferIdx)
+    {
+        auto& pooledBuffer = bufferPool.emplace_back(tuplesPerBuffer * nativeTupleSize);
+        size_t generatedTuples = 0;
+        while (generatedTuples < tuplesPerBuffer and not shouldStop())
+        {
+            generateNativeTuple(std::span(pooledBuffer).subspan(generatedTuples * nativeTupleSize, nativeTupleSize));
+            ++generatedTuples;
+        }
+        pooledBuffer.resize(generatedTuples * nativeTupleSize);
+    }
+    NES_DEBUG(
+        "Generated a pool of {} buffers with {} tuples each in {}",
+        bufferPool.size(),
+        tuplesPerBuffer,
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start));
+}
+
+void GeneratorSource::overwriteTimestamps(std::span<std::byte> tuples) const
+{
+    if (not timestampFieldOffset.has_value())
+    {
+        return;
+    }
+    const auto timestamp = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+    for (size_t offset = timestampFieldOffset.value(); offset + sizeof(timestamp) <= tuples.size(); offset += nativeTupleSize)
+    {
+        std::memcpy(tuples.data() + offset, &timestamp, sizeof(timestamp));
+    }
+}
+
+void GeneratorSource::generateNativeTuple(std::span<std::byte> row)
+{
+    if (workload)
+    {
+        workload->generateNativeTuple(row);
+        return;
+    }
+    generator->generateNativeTuple(row);
+}
+
+bool GeneratorSource::shouldStop() const
+{
+    return workload ? workload->shouldStop() : generator->shouldStop();
+}
+
 SourceValidationRegistryReturnType
 ///NOLINTNEXTLINE (performance-unnecessary-value-param)
 RegisterGeneratorSourceValidation(SourceValidationRegistryArguments sourceConfig)
@@ -21,11 +21,13 @@
 #include <optional>
 #include <ostream>
 #include <ranges>
+#include <span>
 #include <sstream>
 #include <stop_token>
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <vector>
 #include <Configurations/Descriptor.hpp>
 #include <Configurations/Enums/EnumWrapper.hpp>
 #include <Runtime/TupleBuffer.hpp>
@@ -38,16 +40,32 @@
 #include <Generator.hpp>
 #include <GeneratorFields.hpp>
 #include <GeneratorRate.hpp>
+#include <GeneratorWorkloads.hpp>
 #include <SinusGeneratorRate.hpp>
 
 namespace NES
 {
 
+/// Generates tuples of the 'generator_schema' at the rate of the 'generator_rate_type'.
+/// With the NATIVE output format, the source writes the binary values of the fields back to back, which the 'Native' parser reads without
+/// parsing text, thus the fields of the generator schema must match the sizes of the fields of the logical source.
+/// With a positive 'generator_buffer_pool_size', the NATIVE source generates the tuples of that many buffers when it emits its first
+/// buffer, and replays them in a cycle afterward, as load tests at memory bandwidth must not be bound by generating random values.
+/// Replaying ignores the stop of the sequences. With a 'generator_timestamp_field', the source overwrites that field of all tuples in a
+/// buffer with the emission time in milliseconds, so that the replayed tuples advance in event time.
+/// Instead of a generator schema, a 'generator_workload' generates the deterministic Nexmark or Linear Road streams with the NATIVE output
+/// format, whose event time advances by the 'generator_event_rate' independent of the pace of the source.
 class GeneratorSource : public Source
 {
 public:
     constexpr static std::string_view NAME = "Generator";
 
+    enum class OutputFormat : uint8_t
+    {
+        CSV,
+        NATIVE
+    };
+
     explicit GeneratorSource(const SourceDescriptor& sourceDescriptor);
     ~GeneratorSource() override = default;
 
@@ -66,13 +84,23 @@ public:
     static DescriptorConfig::Config validateAndFormat(std::unordered_map<std::string, std::string> config);
 
 private:
+    size_t writeCSVTuples(TupleBuffer& tupleBuffer, uint64_t numberOfTuples, const std::stop_token& stopToken);
+    size_t writeNativeTuples(TupleBuffer& tupleBuffer, uint64_t numberOfTuples, const std::stop_token& stopToken);
+    void generateBufferPool(size_t tuplesPerBuffer);
+    void overwriteTimestamps(std::span<std::byte> tuples) const;
+    void generateNativeTuple(std::span<std::byte> row);
+    [[nodiscard]] bool shouldStop() const;
+
     uint32_t seed;
     int32_t maxRuntime;
     uint64_t generatedTuplesCounter{0};
     uint64_t generatedBuffers{0};
     std::string generatorSchemaRaw;
     std::chrono::time_point<std::chrono::system_clock> generatorStartTime;
-    Generator generator;
+    /// Either the generator of the generator schema or the workload generates the tuples
+    std::optional<Generator> generator;
+    GeneratorWorkload::Type workloadType;
+    std::unique_ptr<GeneratorWorkload> workload;
     std::stringstream tuplesStream;
     std::chrono::time_point<std::chrono::system_clock> startOfInterval;
     std::chrono::milliseconds flushInterval;
@@ -80,6 +108,14 @@ private:
 
     /// if inserting a set of generated tuples into the buffer would overflow it, this string saves them so it can be inserted into the next buffer
     std::string orphanTuples;
+
+    OutputFormat outputFormat;
+    size_t nativeTupleSize{0};
+    /// Offset of the timestamp field in a native tuple
+    std::optional<size_t> timestampFieldOffset;
+    uint32_t bufferPoolSize;
+    std::vector<std::vector<std::byte>> bufferPool;
+    size_t nextPooledBuffer{0};
 };
 
 struct ConfigParametersGenerator
@@ -159,12 +195,72 @@ struct ConfigParametersGenerator
             return std::optional<std::string>();
         }};
 
+    static inline const DescriptorConfig::ConfigParameter<EnumWrapper, GeneratorWorkload::Type> WORKLOAD{
+        "generator_workload",
+        EnumWrapper{GeneratorWorkload::Type::NONE},
+        [](const std::unordered_map<std::string, std::string>& config)
+        {
+            const auto optToken = DescriptorConfig::tryGet(WORKLOAD, config);
+            if (not optToken.has_value() or not optToken.value().asEnum<GeneratorWorkload::Type>().has_value())
+            {
+                return std::optional<EnumWrapper>();
+            }
+            return optToken;
+        }};
+
+    /// Events per second of event time of the generator workload
+    static inline const DescriptorConfig::ConfigParameter<uint64_t> EVENT_RATE{
+        "generator_event_rate",
+        1000,
+        [](const std::unordered_map<std::string, std::string>& config) -> std::optional<uint64_t>
+        {
+            const auto eventRate = DescriptorConfig::tryGet(EVENT_RATE, config);
+            if (eventRate.has_value() and eventRate.value() == 0)
+            {
+                NES_ERROR("The generator_event_rate must be positive");
+                return std::nullopt;
+            }
+            return eventRate;
+        }};
+
+    /// Zipf exponent of the keys of the generator workload, 0 distributes the keys uniformly
+    static inline const DescriptorConfig::ConfigParameter<double> SKEW{
+        "generator_skew",
+        0.0,
+        [](const std::unordered_map<std::string, std::string>& config) -> std::optional<double>
+        {
+            const auto skew = DescriptorConfig::tryGet(SKEW, config);
+            if (skew.has_value() and skew.value() < 0)
+            {
+                NES_ERROR("The generator_skew is {}, but must not be negative", skew.value());
+                return std::nullopt;
+            }
+            return skew;
+        }};
+
+    /// Number of tuples after which the generator workload stops. If 0, it generates tuples until the source stops.
+    static inline const DescriptorConfig::ConfigParameter<uint64_t> WORKLOAD_TUPLES{
+        "generator_workload_tuples",
+        0,
+        [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(WORKLOAD_TUPLES, config); }};
+
+    /// Mandatory, unless a generator workload generates the tuples
     static inline const DescriptorConfig::ConfigParameter<std::string> GENERATOR_SCHEMA{
         "generator_schema",
-        {},
+        "",
         [](const std::unordered_map<std::string, std::string>& config)
         {
             const std::string schema = DescriptorConfig::tryGet(GENERATOR_SCHEMA, config).value_or("");
+            if (const auto workload = DescriptorConfig::tryGet(WORKLOAD, config);
+                workload.has_value() and workload.value().asEnum<GeneratorWorkload::Type>() != GeneratorWorkload::Type::NONE)
+            {
+                if (not schema.empty())
+                {
+                    NES_ERROR("A generator workload cannot be combined with a generator schema!")
+                    throw InvalidConfigParameter("A generator workload cannot be combined with a generator schema!");
+                }
+                return std::optional<std::string>(schema);
+            }
             if (schema.empty())
             {
                 NES_ERROR("Generator schema cannot be empty!")
@@ -196,6 +292,32 @@ struct ConfigParametersGenerator
             return DescriptorConfig::tryGet(GENERATOR_SCHEMA, config);
         }};
 
+    static inline const DescriptorConfig::ConfigParameter<EnumWrapper, GeneratorSource::OutputFormat> OUTPUT_FORMAT{
+        "generator_output_format",
+        EnumWrapper{GeneratorSource::OutputFormat::CSV},
+        [](const std::unordered_map<std::string, std::string>& config)
+        {
+            const auto optToken = DescriptorConfig::tryGet(OUTPUT_FORMAT, config);
+            if (not optToken.has_value() or not optToken.value().asEnum<GeneratorSource::OutputFormat>().has_value())
+            {
+                return std::optional<EnumWrapper>();
+            }
+            return optToken;
+        }};
+
+    /// Number of buffers the NATIVE output format generates once and replays afterward. If 0, the source generates every tuple.
+    static inline const DescriptorConfig::ConfigParameter<uint32_t> BUFFER_POOL_SIZE{
+        "generator_buffer_pool_size",
+        0,
+        [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(BUFFER_POOL_SIZE, config); }};
+
+    /// 64-bit field of the logical source that the NATIVE output format overwrites with the emission time in milliseconds
+    static inline const DescriptorConfig::ConfigParameter<std::string> TIMESTAMP_FIELD{
+        "generator_timestamp_field",
+        "",
+        [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(TIMESTAMP_FIELD, config); }};
+
+    /// With the NATIVE output format, a flush interval of 0 emits full buffers as fast as possible, regardless of the generator rate
     static inline const NES::DescriptorConfig::ConfigParameter<uint64_t> FLUSH_INTERVAL_MS{
         "flush_interval_ms",
         10,
@@ -220,6 +342,13 @@ struct ConfigParametersGenerator
             SEQUENCE_STOPS_GENERATOR,
             GENERATOR_RATE_TYPE,
             GENERATOR_RATE_CONFIG,
+            OUTPUT_FORMAT,
+            BUFFER_POOL_SIZE,
+            TIMESTAMP_FIELD,
+            WORKLOAD,
+            EVENT_RATE,
+            SKEW,
+            WORKLOAD_TUPLES,
             FLUSH_INTERVAL_MS);
 };
 }
@@ -0,0 +1,311 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <GeneratorWorkloads.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <span>
+#include <vector>
+#include <ErrorHandling.hpp>
+
+namespace NES
+{
+
+namespace
+{
+template <typename T>
+size_t writeField(std::span<std::byte> row, const size_t offset, const T value)
+{
+    std::memcpy(row.data() + offset, &value, sizeof(T));
+    return offset + sizeof(T);
+}
+
+/// SplitMix64 finalizer, which maps consecutive inputs to statistically independent outputs
+uint64_t mix(uint64_t value)
+{
+    value += 0x9E3779B97F4A7C15ULL;
+    value = (value ^ (value >> 30U)) * 0xBF58476D1CE4E5B9ULL;
+    value = (value ^ (value >> 27U)) * 0x94D049BB133111EBULL;
+    return value ^ (value >> 31U);
+}
+
+/// Fields of the events, which select independent random bits of the same event
+enum Field : uint64_t
+{
+    AUCTION_ID,
+    BIDDER,
+    PRICE,
+    RESERVE,
+    EXPIRES,
+    SELLER,
+    CATEGORY,
+    CITY,
+    STATE,
+    HIGHWAY,
+    DIRECTION,
+    SEGMENT,
+    OFFSET_IN_SEGMENT,
+    LANE,
+    SPEED
+};
+}
+
+std::unique_ptr<GeneratorWorkload> GeneratorWorkload::create(
+    const Type type, const uint64_t seed, const uint64_t eventsPerSecond, const double skew, const uint64_t numberOfTuples)
+{
+    switch (type)
+    {
+        case Type::NEXMARK_PERSON:
+        case Type::NEXMARK_AUCTION:
+        case Type::NEXMARK_BID:
+            return std::make_unique<NexmarkWorkload>(type, seed, eventsPerSecond, skew, numberOfTuples);
+        case Type::LINEAR_ROAD:
+            return std::make_unique<LinearRoadWorkload>(seed, eventsPerSecond, skew, numberOfTuples);
+        case Type::NONE:
+            break;
+    }
+    throw InvalidConfigParameter("The generator workload NONE does not generate any tuples");
+}
+
+GeneratorWorkload::GeneratorWorkload(const uint64_t seed, const uint64_t eventsPerSecond, const uint64_t numberOfTuples)
+    : seed(mix(seed)), eventsPerSecond(eventsPerSecond), numberOfTuples(numberOfTuples)
+{
+    if (eventsPerSecond == 0)
+    {
+        throw InvalidConfigParameter("The event rate of a generator workload must be positive");
+    }
+}
+
+void GeneratorWorkload::generateNativeTuple(std::span<std::byte> row)
+{
+    PRECONDITION(not shouldStop(), "The generator workload already generated all of its {} tuples", numberOfTuples);
+    generateNativeTuple(row, nextTupleIndex++);
+}
+
+bool GeneratorWorkload::shouldStop() const
+{
+    return numberOfTuples > 0 and nextTupleIndex >= numberOfTuples;
+}
+
+uint64_t GeneratorWorkload::random(const uint64_t event, const uint64_t field) const
+{
+    return mix(seed ^ mix((event << 4U) + field));
+}
+
+double GeneratorWorkload::randomUnit(const uint64_t event, const uint64_t field) const
+{
+    /// The upper 53 bits fill the mantissa of the double
+    return static_cast<double>(random(event, field) >> 11U) * 0x1.0p-53;
+}
+
+uint64_t GeneratorWorkload::eventTimeMs(const uint64_t event) const
+{
+    return event * 1000 / eventsPerSecond;
+}
+
+ZipfDistribution::ZipfDistribution(const size_t maxElements, const double skew)
+{
+    if (skew < 0 or not std::isfinite(skew))
+    {
+        throw InvalidConfigParameter("The skew of a generator workload must be a non-negative number, but is {}", skew);
+    }
+    cumulativeWeights.reserve(maxElements);
+    double cumulativeWeight = 0;
+    for (size_t rank = 0; rank < maxElements; ++rank)
+    {
+        cumulativeWeight += 1.0 / std::pow(static_cast<double>(rank + 1), skew);
+        cumulativeWeights.emplace_back(cumulativeWeight);
+    }
+}
+
+size_t ZipfDistribution::rank(const double unit, const size_t numberOfElements) const
+{
+    PRECONDITION(
+        numberOfElements > 0 and numberOfElements <= cumulativeWeights.size(),
+        "Cannot sample from {} out of {} elements",
+        numberOfElements,
+        cumulativeWeights.size());
+    const auto candidates = std::span(cumulativeWeights).first(numberOfElements);
+    const auto rank = std::ranges::upper_bound(candidates, unit * candidates.back()) - candidates.begin();
+    return std::min(static_cast<size_t>(rank), numberOfElements - 1);
+}
+
+double ZipfDistribution::density(const size_t rank) const
+{
+    const auto weight = cumulativeWeights[rank] - (rank == 0 ? 0 : cumulativeWeights[rank - 1]);
+    return weight / cumulativeWeights.back() * static_cast<double>(cumulativeWeights.size());
+}
+
+size_t ZipfDistribution::getMaxElements() const
+{
+    return cumulativeWeights.size();
+}
+
+NexmarkWorkload::NexmarkWorkload(
+    const Type stream, const uint64_t seed, const uint64_t eventsPerSecond, const double skew, const uint64_t numberOfTuples)
+    : GeneratorWorkload(seed, eventsPerSecond, numberOfTuples)
+    , stream(stream)
+    , auctionDistribution(NUMBER_OF_IN_FLIGHT_AUCTIONS, skew)
+    , personDistribution(NUMBER_OF_ACTIVE_PERSONS, skew)
+{
+    PRECONDITION(
+        stream == Type::NEXMARK_PERSON or stream == Type::NEXMARK_AUCTION or stream == Type::NEXMARK_BID,
+        "The Nexmark workload requires one of its three streams");
+}
+
+std::vector<size_t> NexmarkWorkload::getNativeFieldSizes() const
+{
+    switch (stream)
+    {
+        case Type::NEXMARK_PERSON:
+            return {sizeof(int32_t), sizeof(int32_t), sizeof(int32_t), sizeof(uint64_t)};
+        case Type::NEXMARK_AUCTION:
+            return {
+                sizeof(uint64_t), sizeof(int32_t), sizeof(int32_t), sizeof(int32_t), sizeof(uint64_t), sizeof(int32_t), sizeof(int32_t)};
+        default:
+            return {sizeof(uint64_t), sizeof(int32_t), sizeof(int32_t), sizeof(double)};
+    }
+}
+
+void NexmarkWorkload::generateNativeTuple(std::span<std::byte> row, const uint64_t tupleIndex)
+{
+    switch (stream)
+    {
+        case Type::NEXMARK_PERSON:
+            writePerson(row, tupleIndex);
+            break;
+        case Type::NEXMARK_AUCTION:
+            writeAuction(row, tupleIndex);
+            break;
+        default:
+            writeBid(row, tupleIndex);
+            break;
+    }
+}
+
+int32_t NexmarkWorkload::recentId(
+    const ZipfDistribution& distribution,
+    const int32_t firstId,
+    const uint64_t numberOfElements,
+    const uint64_t event,
+    const uint64_t field) const
+{
+    const auto window = std::min<uint64_t>(numberOfElements, distribution.getMaxElements());
+    const auto rank = distribution.rank(randomUnit(event, field), window);
+    return firstId + static_cast<int32_t>(numberOfElements - 1 - rank);
+}
+
+double NexmarkWorkload::price(const uint64_t event, const uint64_t field) const
+{
+    return std::round(std::pow(10.0, randomUnit(event, field) * 6.0) * 100.0) / 100.0;
+}
+
+void NexmarkWorkload::writePerson(std::span<std::byte> row, const uint64_t person) const
+{
+    const auto event = person * EVENTS_PER_EPOCH;
+    size_t offset = writeField(row, 0, FIRST_PERSON_ID + static_cast<int32_t>(person));
+    offset = writeField(row, offset, static_cast<int32_t>(random(event, CITY) % NUMBER_OF_CITIES));
+    offset = writeField(row, offset, static_cast<int32_t>(random(event, STATE) % NUMBER_OF_STATES));
+    writeField(row, offset, eventTimeMs(event));
+}
+
+void NexmarkWorkload::writeAuction(std::span<std::byte> row, const uint64_t auction) const
+{
+    const auto epoch = auction / AUCTIONS_PER_EPOCH;
+    const auto event = (epoch * EVENTS_PER_EPOCH) + PERSONS_PER_EPOCH + (auction % AUCTIONS_PER_EPOCH);
+    const auto timestamp = eventTimeMs(event);
+    /// An auction lasts about as long as it takes to create the auctions in flight
+    const auto inFlightDurationMs = static_cast<double>(NUMBER_OF_IN_FLIGHT_AUCTIONS * EVENTS_PER_EPOCH * 1000)
+        / static_cast<double>(AUCTIONS_PER_EPOCH * eventsPerSecond);
+    const auto duration = static_cast<uint64_t>((0.5 + randomUnit(event, EXPIRES)) * inFlightDurationMs);
+    const auto initialBid = static_cast<int32_t>(price(event, PRICE) * 100);
+
+    size_t offset = writeField(row, 0, timestamp);
+    offset = writeField(row, offset, FIRST_AUCTION_ID + static_cast<int32_t>(auction));
+    offset = writeField(row, offset, initialBid);
+    offset = writeField(row, offset, initialBid + static_cast<int32_t>(price(event, RESERVE) * 100));
+    offset = writeField(row, offset, timestamp + duration);
+    offset = writeField(row, offset, recentId(personDistribution, FIRST_PERSON_ID, (epoch + 1) * PERSONS_PER_EPOCH, event, SELLER));
+    writeField(row, offset, FIRST_CATEGORY_ID + static_cast<int32_t>(random(event, CATEGORY) % NUMBER_OF_CATEGORIES));
+}
+
+void NexmarkWorkload::writeBid(std::span<std::byte> row, const uint64_t bid) const
+{
+    const auto epoch = bid / BIDS_PER_EPOCH;
+    const auto event = (epoch * EVENTS_PER_EPOCH) + PERSONS_PER_EPOCH + AUCTIONS_PER_EPOCH + (bid % BIDS_PER_EPOCH);
+    size_t offset = writeField(row, 0, eventTimeMs(event));
+    offset = writeField(row, offset, recentId(auctionDistribution, FIRST_AUCTION_ID, (epoch + 1) * AUCTIONS_PER_EPOCH, event, AUCTION_ID));
+    offset = writeField(row, offset, recentId(personDistribution, FIRST_PERSON_ID, (epoch + 1) * PERSONS_PER_EPOCH, event, BIDDER));
+    writeField(row, offset, price(event, PRICE));
+}
+
+LinearRoadWorkload::LinearRoadWorkload(
+    const uint64_t seed, const uint64_t eventsPerSecond, const double skew, const uint64_t numberOfTuples)
+    : GeneratorWorkload(seed, eventsPerSecond, numberOfTuples)
+    , segmentDistribution(NUMBER_OF_SEGMENTS, skew)
+    , vehicles(std::clamp<uint64_t>(eventsPerSecond * REPORT_INTERVAL_SECONDS, 1, std::numeric_limits<int16_t>::max()))
+{
+}
+
+std::vector<size_t> LinearRoadWorkload::getNativeFieldSizes() const
+{
+    return {sizeof(uint64_t), sizeof(int16_t), sizeof(float), sizeof(int16_t), sizeof(int16_t), sizeof(int16_t), sizeof(int32_t)};
+}
+
+void LinearRoadWorkload::generateNativeTuple(std::span<std::byte> row, const uint64_t tupleIndex)
+{
+    constexpr auto highwayLengthFeet = static_cast<double>(NUMBER_OF_SEGMENTS * SEGMENT_LENGTH_FEET);
+    /// Multiplying the rank with a number that is coprime to the number of segments spreads the congested segments over the highway
+    constexpr size_t rankToSegment = 37;
+    constexpr size_t segmentToRank = 73;
+    static_assert((rankToSegment * segmentToRank) % NUMBER_OF_SEGMENTS == 1);
+
+    const auto vehicleId = tupleIndex % vehicles.size();
+    const bool entersHighway = tupleIndex < vehicles.size();
+    auto& vehicle = vehicles[vehicleId];
+    if (entersHighway)
+    {
+        const auto rank = segmentDistribution.rank(randomUnit(tupleIndex, SEGMENT), NUMBER_OF_SEGMENTS);
+        const auto segment = (rank * rankToSegment) % NUMBER_OF_SEGMENTS;
+        vehicle.highway = static_cast<int16_t>(random(tupleIndex, HIGHWAY) % NUMBER_OF_HIGHWAYS);
+        vehicle.direction = static_cast<int16_t>(random(tupleIndex, DIRECTION) % 2);
+        vehicle.position = (static_cast<double>(segment) + randomUnit(tupleIndex, OFFSET_IN_SEGMENT)) * SEGMENT_LENGTH_FEET;
+    }
+
+    const auto segment = std::min(static_cast<size_t>(vehicle.position) / SEGMENT_LENGTH_FEET, NUMBER_OF_SEGMENTS - 1);
+    const auto density = segmentDistribution.density((segment * segmentToRank) % NUMBER_OF_SEGMENTS);
+    const auto speed = static_cast<float>(MAX_SPEED_MPH * (0.5 + (0.5 * randomUnit(tupleIndex, SPEED))) / std::max(1.0, density));
+    const auto lane = entersHighway ? int16_t{0} : static_cast<int16_t>(1 + (random(tupleIndex, LANE) % NUMBER_OF_TRAVEL_LANES));
+
+    size_t offset = writeField(row, 0, eventTimeMs(tupleIndex));
+    offset = writeField(row, offset, static_cast<int16_t>(vehicleId));
+    offset = writeField(row, offset, speed);
+    offset = writeField(row, offset, vehicle.highway);
+    offset = writeField(row, offset, lane);
+    offset = writeField(row, offset, vehicle.direction);
+    writeField(row, offset, static_cast<int32_t>(vehicle.position));
+
+    /// The vehicle drives at the reported speed until its next report, and the highways are circular
+    const auto distanceFeet = static_cast<double>(speed) * SEGMENT_LENGTH_FEET / 3600.0 * REPORT_INTERVAL_SECONDS;
+    const auto forward = vehicle.direction == 0 ? distanceFeet : highwayLengthFeet - distanceFeet;
+    vehicle.position = std::fmod(vehicle.position + forward, highwayLengthFeet);
+}
+
+}
@@ -0,0 +1,177 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace NES
+{
+
+/// @brief Generates the tuples of a benchmark workload in their native layout, instead of the independent fields of a generator schema.
+/// The values of a tuple derive from the seed and the index of the tuple, and the event time advances by the event rate, thus the
+/// same configuration produces the same data on every run, independent of the buffer size and the pace of the source.
+class GeneratorWorkload
+{
+public:
+    enum class Type : uint8_t
+    {
+        NONE,
+        NEXMARK_PERSON,
+        NEXMARK_AUCTION,
+        NEXMARK_BID,
+        LINEAR_ROAD
+    };
+
+    /// @param eventsPerSecond number of events per second of event time. For the Nexmark streams, it is the rate of all three streams
+    /// together, thus sources of the three streams with the same configuration refer to the same persons and auctions.
+    /// @param skew exponent of the Zipf distribution of the auctions and persons a Nexmark event refers to, respectively of the segments
+    /// where the Linear Road vehicles enter the highways. A skew of 0 distributes them uniformly.
+    /// @param numberOfTuples number of tuples after which the workload stops. If 0, the workload never stops.
+    static std::unique_ptr<GeneratorWorkload>
+    create(Type type, uint64_t seed, uint64_t eventsPerSecond, double skew, uint64_t numberOfTuples);
+
+    virtual ~GeneratorWorkload() = default;
+
+    /// Writes the next tuple into @param row of exactly 'getNativeTupleSize()' bytes
+    void generateNativeTuple(std::span<std::byte> row);
+
+    /// Sizes of the binary values of the fields in the order of the logical source of the workload
+    [[nodiscard]] virtual std::vector<size_t> getNativeFieldSizes() const = 0;
+    [[nodiscard]] bool shouldStop() const;
+
+protected:
+    GeneratorWorkload(uint64_t seed, uint64_t eventsPerSecond, uint64_t numberOfTuples);
+
+    virtual void generateNativeTuple(std::span<std::byte> row, uint64_t tupleIndex) = 0;
+
+    /// Uniformly distributed random bits of the event, which depend solely on the seed, the event, and the field
+    [[nodiscard]] uint64_t random(uint64_t event, uint64_t field) const;
+    /// Uniformly distributed in [0, 1)
+    [[nodiscard]] double randomUnit(uint64_t event, uint64_t field) const;
+    [[nodiscard]] uint64_t eventTimeMs(uint64_t event) const;
+
+    uint64_t seed;
+    uint64_t eventsPerSecond;
+
+private:
+    uint64_t numberOfTuples;
+    uint64_t nextTupleIndex{0};
+};
+
+/// @brief Samples the rank of one out of n elements from a Zipf distribution, where rank 0 is the most frequent element
+class ZipfDistribution
+{
+public:
+    ZipfDistribution(size_t maxElements, double skew);
+
+    /// Maps @param unit from [0, 1) to a rank of the first @param numberOfElements elements
+    [[nodiscard]] size_t rank(double unit, size_t numberOfElements) const;
+
+    /// Share of the element of @param rank out of all elements, times the number of elements, i.e., 1 for a uniform distribution
+    [[nodiscard]] double density(size_t rank) const;
+
+    [[nodiscard]] size_t getMaxElements() const;
+
+private:
+    /// Cumulative, unnormalized probabilities of the ranks
+    std::vector<double> cumulativeWeights;
+};
+
+/// @brief The person, auction, and bid streams of the Nexmark benchmark (https://github.com/nexmark/nexmark).
+/// The events of the three streams interleave in the proportion of 1 person, 3 auctions, and 46 bids out of 50 events, and a stream
+/// generates solely its share of the events. Auctions refer to recent sellers and bids to recent auctions and bidders.
+/// Fields of the persons, which are strings in Nexmark, are left out, as the native format is restricted to fixed size fields.
+class NexmarkWorkload final : public GeneratorWorkload
+{
+public:
+    /// Logical sources:
+    /// person(id INT32, city INT32, state INT32, timestamp UINT64)
+    /// auction(timestamp UINT64, id INT32, initialbid INT32, reserve INT32, expires UINT64, seller INT32, category INT32)
+    /// bid(timestamp UINT64, auctionId INT32, bidder INT32, price FLOAT64)
+    NexmarkWorkload(Type stream, uint64_t seed, uint64_t eventsPerSecond, double skew, uint64_t numberOfTuples);
+
+    [[nodiscard]] std::vector<size_t> getNativeFieldSizes() const override;
+
+    static constexpr uint64_t EVENTS_PER_EPOCH = 50;
+    static constexpr uint64_t PERSONS_PER_EPOCH = 1;
+    static constexpr uint64_t AUCTIONS_PER_EPOCH = 3;
+    static constexpr uint64_t BIDS_PER_EPOCH = 46;
+    static constexpr int32_t FIRST_PERSON_ID = 1000;
+    static constexpr int32_t FIRST_AUCTION_ID = 1000;
+    static constexpr int32_t FIRST_CATEGORY_ID = 10;
+    static constexpr int32_t NUMBER_OF_CATEGORIES = 5;
+    static constexpr int32_t NUMBER_OF_CITIES = 10;
+    static constexpr int32_t NUMBER_OF_STATES = 10;
+    /// Auctions, respectively persons, that events may refer to, counted back from the latest one
+    static constexpr size_t NUMBER_OF_IN_FLIGHT_AUCTIONS = 100;
+    static constexpr size_t NUMBER_OF_ACTIVE_PERSONS = 1000;
+
+private:
+    void generateNativeTuple(std::span<std::byte> row, uint64_t tupleIndex) override;
+
+    void writePerson(std::span<std::byte> row, uint64_t person) const;
+    void writeAuction(std::span<std::byte> row, uint64_t auction) const;
+    void writeBid(std::span<std::byte> row, uint64_t bid) const;
+
+    /// Id of a recent element out of the @param numberOfElements so far, preferring the latest ones with a positive skew
+    [[nodiscard]] int32_t recentId(
+        const ZipfDistribution& distribution, int32_t firstId, uint64_t numberOfElements, uint64_t event, uint64_t field) const;
+    /// Nexmark prices are between 1 and 10^6 dollars, with the same number of prices per order of magnitude
+    [[nodiscard]] double price(uint64_t event, uint64_t field) const;
+
+    Type stream;
+    ZipfDistribution auctionDistribution;
+    ZipfDistribution personDistribution;
+};
+
+/// @brief The position reports of the Linear Road benchmark (https://www.cs.brandeis.edu/~linearroad/linear-road.pdf).
+/// Every vehicle reports its position every 30 seconds of event time, thus the event rate determines the number of vehicles, which is
+/// bounded by the ids of the INT16 vehicle field. Vehicles enter a highway at a segment of the Zipf distribution and slow down in
+/// proportion to the density of their segment, thus a positive skew leads to congested segments.
+class LinearRoadWorkload final : public GeneratorWorkload
+{
+public:
+    /// Logical source: lrb(creationTS UINT64, vehicle INT16, speed FLOAT32, highway INT16, lane INT16, direction INT16, position INT32)
+    LinearRoadWorkload(uint64_t seed, uint64_t eventsPerSecond, double skew, uint64_t numberOfTuples);
+
+    [[nodiscard]] std::vector<size_t> getNativeFieldSizes() const override;
+
+    static constexpr uint64_t REPORT_INTERVAL_SECONDS = 30;
+    static constexpr int16_t NUMBER_OF_HIGHWAYS = 10;
+    static constexpr size_t NUMBER_OF_SEGMENTS = 100;
+    static constexpr int32_t SEGMENT_LENGTH_FEET = 5280;
+    static constexpr int16_t NUMBER_OF_TRAVEL_LANES = 3;
+    static constexpr float MAX_SPEED_MPH = 100;
+
+private:
+    struct VehicleState
+    {
+        int16_t highway = 0;
+        int16_t direction = 0;
+        /// Position on the highway in feet
+        double position = 0;
+    };
+
+    void generateNativeTuple(std::span<std::byte> row, uint64_t tupleIndex) override;
+
+    ZipfDistribution segmentDistribution;
+    std::vector<VehicleState> vehicles;
+};
+
+}
@@ -0,0 +1,215 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <stop_token>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/DataTypeProvider.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Sources/LogicalSource.hpp>
+#include <Sources/SourceCatalog.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+#include <ErrorHandling.hpp>
+#include <GeneratorSource.hpp>
+
+namespace NES
+{
+
+class GeneratorSourceTest : public Testing::BaseUnitTest
+{
+public:
+    /// Each native row packs an UINT64, an INT32 and a FLOAT64 without padding
+    static constexpr size_t TUPLE_SIZE = sizeof(uint64_t) + sizeof(int32_t) + sizeof(double);
+    static constexpr size_t TUPLES_PER_BUFFER = 5;
+    static constexpr size_t BUFFER_SIZE = TUPLES_PER_BUFFER * TUPLE_SIZE;
+
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("GeneratorSourceTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup GeneratorSourceTest test class.");
+    }
+
+    void SetUp() override { BaseUnitTest::SetUp(); }
+
+    /// Every source gets its own logical source, thus a test may create several sources
+    std::unique_ptr<GeneratorSource> createSource(const Schema& schema, std::unordered_map<std::string, std::string> config)
+    {
+        config.try_emplace("generator_output_format", "NATIVE");
+        config.try_emplace("stop_generator_when_sequence_finishes", "ALL");
+        config.try_emplace("flush_interval_ms", "0");
+        config.try_emplace("seed", "1");
+        const auto logicalSource = sourceCatalog.addLogicalSource(fmt::format("generatorSource{}", numberOfSources++), schema);
+        EXPECT_TRUE(logicalSource.has_value());
+        const auto descriptor
+            = sourceCatalog.addPhysicalSource(logicalSource.value(), "Generator", std::move(config), {{"type", "Native"}});
+        EXPECT_TRUE(descriptor.has_value());
+        return std::make_unique<GeneratorSource>(descriptor.value());
+    }
+
+    std::unique_ptr<GeneratorSource> createSource(std::unordered_map<std::string, std::string> config)
+    {
+        return createSource(createSchema(), std::move(config));
+    }
+
+    static Schema createSchema()
+    {
+        Schema schema;
+        schema.addField("id", DataTypeProvider::provideDataType(DataType::Type::UINT64));
+        schema.addField("value", DataTypeProvider::provideDataType(DataType::Type::INT32));
+        schema.addField("price", DataTypeProvider::provideDataType(DataType::Type::FLOAT64));
+        return schema;
+    }
+
+    /// The rows of the sequences 'SEQUENCE UINT64 0 n 1, SEQUENCE INT32 100 100+n 1, SEQUENCE FLOAT64 0.5 n+0.5 1' in their native layout
+    static std::vector<std::byte> createRows(const uint64_t first, const uint64_t numberOfRows)
+    {
+        std::vector<std::byte> rows(numberOfRows * TUPLE_SIZE);
+        for (uint64_t rowIdx = 0; rowIdx < numberOfRows; ++rowIdx)
+        {
+            const uint64_t id = first + rowIdx;
+            const auto value = static_cast<int32_t>(100 + id);
+            const auto price = static_cast<double>(id) + 0.5;
+            auto* row = rows.data() + (rowIdx * TUPLE_SIZE);
+            std::memcpy(row, &id, sizeof(id));
+            std::memcpy(row + sizeof(id), &value, sizeof(value));
+            std::memcpy(row + sizeof(id) + sizeof(value), &price, sizeof(price));
+        }
+        return rows;
+    }
+
+    std::vector<std::byte> fill(GeneratorSource& source) const
+    {
+        auto buffer = bufferManager->getBufferBlocking();
+        const auto numberOfBytes = source.fillTupleBuffer(buffer, stopSource.get_token());
+        const auto memory = buffer.getAvailableMemoryArea<std::byte>();
+        return std::vector<std::byte>(memory.begin(), memory.begin() + static_cast<std::ptrdiff_t>(numberOfBytes));
+    }
+
+    SourceCatalog sourceCatalog;
+    size_t numberOfSources = 0;
+    std::shared_ptr<BufferManager> bufferManager = BufferManager::create(BUFFER_SIZE, 8);
+    std::stop_source stopSource;
+};
+
+/// clang tidy doesn't recognize the .has_value in the EXPECT_TRUE
+/// NOLINTBEGIN(bugprone-unchecked-optional-access)
+TEST_F(GeneratorSourceTest, WritesTheBinaryValuesOfTheFieldsBackToBack)
+{
+    auto source = createSource({{"generator_schema", "SEQUENCE UINT64 0 7 1, SEQUENCE INT32 100 107 1, SEQUENCE FLOAT64 0.5 7.5 1"}});
+    source->open();
+    /// Without a flush interval, the source fills every buffer, until the sequences finish
+    EXPECT_EQ(fill(*source), createRows(0, TUPLES_PER_BUFFER));
+    EXPECT_EQ(fill(*source), createRows(TUPLES_PER_BUFFER, 2));
+    EXPECT_TRUE(fill(*source).empty());
+    source->close();
+}
+
+TEST_F(GeneratorSourceTest, ReplaysTheBufferPoolInACycle)
+{
+    auto source = createSource(
+        {{"generator_schema", "SEQUENCE UINT64 0 1000 1, SEQUENCE INT32 100 1100 1, SEQUENCE FLOAT64 0.5 1000.5 1"},
+         {"generator_buffer_pool_size", "2"}});
+    source->open();
+    for (size_t cycle = 0; cycle < 3; ++cycle)
+    {
+        EXPECT_EQ(fill(*source), createRows(0, TUPLES_PER_BUFFER));
+        EXPECT_EQ(fill(*source), createRows(TUPLES_PER_BUFFER, TUPLES_PER_BUFFER));
+    }
+    source->close();
+}
+
+TEST_F(GeneratorSourceTest, OverwritesTheTimestampFieldWithTheEmissionTime)
+{
+    Schema schema;
+    schema.addField("id", DataTypeProvider::provideDataType(DataType::Type::UINT64));
+    schema.addField("timestamp", DataTypeProvider::provideDataType(DataType::Type::UINT64));
+    auto source = createSource(
+        schema,
+        {{"generator_schema", "SEQUENCE UINT64 0 100 1, SEQUENCE UINT64 0 100 1"},
+         {"generator_buffer_pool_size", "1"},
+         {"generator_timestamp_field", "timestamp"}});
+    const auto now = []
+    {
+        return static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+    };
+
+    source->open();
+    /// The replayed buffers keep their ids, but carry the time of their emission
+    for (size_t replay = 0; replay < 2; ++replay)
+    {
+        const auto before = now();
+        const auto rows = fill(*source);
+        const auto after = now();
+        constexpr auto rowSize = 2 * sizeof(uint64_t);
+        ASSERT_EQ(rows.size(), (BUFFER_SIZE / rowSize) * rowSize);
+        for (size_t rowIdx = 0; rowIdx < rows.size() / rowSize; ++rowIdx)
+        {
+            uint64_t id = 0;
+            uint64_t timestamp = 0;
+            std::memcpy(&id, rows.data() + (rowIdx * rowSize), sizeof(id));
+            std::memcpy(&timestamp, rows.data() + (rowIdx * rowSize) + sizeof(id), sizeof(timestamp));
+            EXPECT_EQ(id, rowIdx);
+            EXPECT_GE(timestamp, before);
+            EXPECT_LE(timestamp, after);
+        }
+    }
+    source->close();
+}
+
+TEST_F(GeneratorSourceTest, RejectsGeneratorSchemasThatDoNotMatchTheLogicalSource)
+{
+    /// The INT64 field is larger than the INT32 field of the logical source
+    ASSERT_EXCEPTION_ERRORCODE(
+        createSource({{"generator_schema", "SEQUENCE UINT64 0 7 1, SEQUENCE INT64 100 107 1, SEQUENCE FLOAT64 0.5 7.5 1"}}),
+        ErrorCode::InvalidConfigParameter);
+    ASSERT_EXCEPTION_ERRORCODE(
+        createSource({{"generator_schema", "SEQUENCE UINT64 0 7 1, SEQUENCE INT32 100 107 1"}}), ErrorCode::InvalidConfigParameter);
+    ASSERT_EXCEPTION_ERRORCODE(
+        createSource(
+            {{"generator_schema", "SEQUENCE UINT64 0 7 1, SEQUENCE INT32 100 107 1, SEQUENCE FLOAT64 0.5 7.5 1, SEQUENCE UINT8 0 7 1"}}),
+        ErrorCode::InvalidConfigParameter);
+    /// The timestamp field must be a 64-bit integer of the logical source
+    ASSERT_EXCEPTION_ERRORCODE(
+        createSource(
+            {{"generator_schema", "SEQUENCE UINT64 0 7 1, SEQUENCE INT32 100 107 1, SEQUENCE FLOAT64 0.5 7.5 1"},
+             {"generator_timestamp_field", "value"}}),
+        ErrorCode::InvalidConfigParameter);
+    ASSERT_EXCEPTION_ERRORCODE(
+        createSource(
+            {{"generator_schema", "SEQUENCE UINT64 0 7 1, SEQUENCE INT32 100 107 1, SEQUENCE FLOAT64 0.5 7.5 1"},
+             {"generator_timestamp_field", "missing"}}),
+        ErrorCode::InvalidConfigParameter);
+}
+
+/// NOLINTEND(bugprone-unchecked-optional-access)
+
+}
@@ -0,0 +1,286 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <KafkaSource.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <span>
+#include <stop_token>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <Configurations/Descriptor.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Sources/SourceDescriptor.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Strings.hpp>
+#include <fmt/format.h>
+#include <librdkafka/rdkafka.h>
+#include <ErrorHandling.hpp>
+#include <SourceRegistry.hpp>
+#include <SourceValidationRegistry.hpp>
+
+namespace NES
+{
+
+namespace
+{
+void setProperty(rd_kafka_conf_t& configuration, const std::string& key, const std::string& value)
+{
+    std::array<char, 512> error{};
+    if (rd_kafka_conf_set(&configuration, key.c_str(), value.c_str(), error.data(), error.size()) != RD_KAFKA_CONF_OK)
+    {
+        throw CannotOpenSource("Invalid Kafka property {}={}: {}", key, value, error.data());
+    }
+}
+
+/// Sets the 'key=value' pairs of the properties, which are separated by ';'
+void setProperties(rd_kafka_conf_t& configuration, const std::string_view properties)
+{
+    for (const auto property : Util::splitWithStringDelimiter<std::string_view>(properties, ";"))
+    {
+        const auto trimmedProperty = Util::trimWhiteSpaces(property);
+        if (trimmedProperty.empty())
+        {
+            continue;
+        }
+        const auto separator = trimmedProperty.find('=');
+        if (separator == std::string_view::npos)
+        {
+            throw CannotOpenSource("Kafka property '{}' is not of the form 'key=value'", trimmedProperty);
+        }
+        setProperty(
+            configuration,
+            std::string(Util::trimWhiteSpaces(trimmedProperty.substr(0, separator))),
+            std::string(Util::trimWhiteSpaces(trimmedProperty.substr(separator + 1))));
+    }
+}
+}
+
+KafkaSource::KafkaSource(const SourceDescriptor& sourceDescriptor)
+    : brokers(sourceDescriptor.getFromConfig(ConfigParametersKafka::BROKERS))
+    , topic(sourceDescriptor.getFromConfig(ConfigParametersKafka::TOPIC))
+    , groupId(sourceDescriptor.getFromConfig(ConfigParametersKafka::GROUP_ID))
+    , partition(sourceDescriptor.getFromConfig(ConfigParametersKafka::PARTITION))
+    , autoOffsetReset(sourceDescriptor.getFromConfig(ConfigParametersKafka::AUTO_OFFSET_RESET))
+    , properties(sourceDescriptor.getFromConfig(ConfigParametersKafka::PROPERTIES))
+    , batchSize(sourceDescriptor.getFromConfig(ConfigParametersKafka::BATCH_SIZE))
+    , pollTimeout(std::chrono::milliseconds{sourceDescriptor.getFromConfig(ConfigParametersKafka::POLL_TIMEOUT_MS)})
+    , isZeroCopy(sourceDescriptor.getFromConfig(ConfigParametersKafka::ZERO_COPY))
+    , tupleDelimiter(sourceDescriptor.getFromConfig(ConfigParametersKafka::SEPARATOR))
+    , batch(batchSize)
+{
+}
+
+void KafkaSource::open()
+{
+    auto* configuration = rd_kafka_conf_new();
+    try
+    {
+        setProperty(*configuration, "bootstrap.servers", brokers);
+        setProperty(*configuration, "group.id", groupId);
+        setProperty(*configuration, "auto.offset.reset", autoOffsetReset);
+        setProperty(*configuration, "enable.partition.eof", "false");
+        setProperties(*configuration, properties);
+    }
+    catch (...)
+    {
+        rd_kafka_conf_destroy(configuration);
+        throw;
+    }
+
+    std::array<char, 512> error{};
+    /// On success, the consumer takes the ownership of the configuration
+    auto* handle = rd_kafka_new(RD_KAFKA_CONSUMER, configuration, error.data(), error.size());
+    if (handle == nullptr)
+    {
+        rd_kafka_conf_destroy(configuration);
+        throw CannotOpenSource("Could not create a Kafka consumer for {}: {}", brokers, error.data());
+    }
+    consumer = std::shared_ptr<rd_kafka_t>(handle, rd_kafka_destroy);
+    rd_kafka_poll_set_consumer(consumer.get());
+
+    const std::unique_ptr<rd_kafka_topic_partition_list_t, decltype(&rd_kafka_topic_partition_list_destroy)> topicPartitions(
+        rd_kafka_topic_partition_list_new(1), rd_kafka_topic_partition_list_destroy);
+    rd_kafka_topic_partition_list_add(topicPartitions.get(), topic.c_str(), partition < 0 ? RD_KAFKA_PARTITION_UA : partition);
+    const auto errorCode
+        = partition < 0 ? rd_kafka_subscribe(consumer.get(), topicPartitions.get()) : rd_kafka_assign(consumer.get(), topicPartitions.get());
+    if (errorCode != RD_KAFKA_RESP_ERR_NO_ERROR)
+    {
+        consumer.reset();
+        throw CannotOpenSource("Could not consume the Kafka topic {}: {}", topic, rd_kafka_err2str(errorCode));
+    }
+    queue.reset(rd_kafka_queue_get_consumer(consumer.get()));
+    NES_DEBUG(
+        "KafkaSource::open: Consuming {} from {}.", partition < 0 ? fmt::format("topic {}", topic) : fmt::format("{}[{}]", topic, partition), brokers);
+}
+
+void KafkaSource::close()
+{
+    pendingMessages.clear();
+    queue.reset();
+    if (consumer)
+    {
+        if (const auto errorCode = rd_kafka_consumer_close(consumer.get()); errorCode != RD_KAFKA_RESP_ERR_NO_ERROR)
+        {
+            NES_WARNING("KafkaSource::close: Could not leave the consumer group: {}", rd_kafka_err2str(errorCode));
+        }
+        /// TupleBuffers that still wrap messages keep the consumer alive
+        consumer.reset();
+    }
+    NES_DEBUG("KafkaSource::close: Consumed {} messages with {} bytes.", numberOfConsumedMessages, numberOfConsumedBytes);
+}
+
+size_t KafkaSource::consumeBatch(const std::chrono::milliseconds timeout)
+{
+    const auto numberOfMessages = rd_kafka_consume_batch_queue(queue.get(), static_cast<int>(timeout.count()), batch.data(), batch.size());
+    if (numberOfMessages < 0)
+    {
+        throw RunningRoutineFailure("Could not consume from the Kafka topic {}: {}", topic, rd_kafka_err2str(rd_kafka_last_error()));
+    }
+
+    size_t numberOfMessagesWithPayload = 0;
+    for (auto* rawMessage : std::span(batch).first(static_cast<size_t>(numberOfMessages)))
+    {
+        Message message(rawMessage);
+        if (message->err != RD_KAFKA_RESP_ERR_NO_ERROR)
+        {
+            if (message->err == RD_KAFKA_RESP_ERR__FATAL)
+            {
+                throw RunningRoutineFailure("The Kafka consumer of {} failed: {}", topic, rd_kafka_message_errstr(message.get()));
+            }
+            NES_WARNING("KafkaSource: Consuming from {} failed: {}", topic, rd_kafka_message_errstr(message.get()));
+            continue;
+        }
+        if (message->len == 0)
+        {
+            continue;
+        }
+        ++numberOfConsumedMessages;
+        numberOfConsumedBytes += message->len;
+        ++numberOfMessagesWithPayload;
+        pendingMessages.push_back(PendingMessage{.message = std::move(message)});
+    }
+    return numberOfMessagesWithPayload;
+}
+
+size_t KafkaSource::copyPendingMessage(const std::span<char> destination)
+{
+    auto& pendingMessage = pendingMessages.front();
+    const std::string_view payload(static_cast<const char*>(pendingMessage.message->payload), pendingMessage.message->len);
+    /// Tuples may span multiple buffers, thus a message that does not fit continues in the next buffer
+    const auto numberOfBytes = std::min(destination.size(), payload.size() - pendingMessage.offset);
+    std::memcpy(destination.data(), payload.data() + pendingMessage.offset, numberOfBytes);
+    pendingMessage.offset += numberOfBytes;
+
+    size_t writtenBytes = numberOfBytes;
+    if (pendingMessage.offset == payload.size())
+    {
+        if (payload.back() != tupleDelimiter)
+        {
+            if (writtenBytes == destination.size())
+            {
+                return writtenBytes;
+            }
+            destination[writtenBytes++] = tupleDelimiter;
+        }
+        pendingMessages.pop_front();
+    }
+    return writtenBytes;
+}
+
+size_t KafkaSource::fillTupleBuffer(TupleBuffer& tupleBuffer, const std::stop_token& stopToken)
+{
+    const auto memory = tupleBuffer.getAvailableMemoryArea<char>();
+    size_t numberOfBytes = 0;
+    while (numberOfBytes < memory.size() and not stopToken.stop_requested())
+    {
+        if (pendingMessages.empty())
+        {
+            /// Emitting once the consumer has no more messages available, instead of waiting for a full buffer
+            if (consumeBatch(numberOfBytes == 0 ? pollTimeout : std::chrono::milliseconds{0}) == 0 and numberOfBytes > 0)
+            {
+                break;
+            }
+            continue;
+        }
+        numberOfBytes += copyPendingMessage(memory.subspan(numberOfBytes));
+    }
+    return numberOfBytes;
+}
+
+bool KafkaSource::providesTupleBuffers() const
+{
+    return isZeroCopy;
+}
+
+std::optional<TupleBuffer> KafkaSource::provideTupleBuffer(const std::stop_token& stopToken)
+{
+    while (pendingMessages.empty())
+    {
+        if (stopToken.stop_requested())
+        {
+            return std::nullopt;
+        }
+        consumeBatch(pollTimeout);
+    }
+    auto* message = pendingMessages.front().message.release();
+    pendingMessages.pop_front();
+    return TupleBuffer::wrapMemory(
+        static_cast<uint8_t*>(message->payload),
+        static_cast<uint32_t>(message->len),
+        [message, consumer = this->consumer] { rd_kafka_message_destroy(message); });
+}
+
+DescriptorConfig::Config KafkaSource::validateAndFormat(std::unordered_map<std::string, std::string> config)
+{
+    return DescriptorConfig::validateAndFormat<ConfigParametersKafka>(std::move(config), NAME);
+}
+
+std::ostream& KafkaSource::toString(std::ostream& str) const
+{
+    str << fmt::format(
+        "\nKafkaSource(brokers: {}, topic: {}, groupId: {}, partition: {}, batchSize: {}, zeroCopy: {}, consumedMessages: {}, "
+        "consumedBytes: {})",
+        brokers,
+        topic,
+        groupId,
+        partition,
+        batchSize,
+        isZeroCopy,
+        numberOfConsumedMessages,
+        numberOfConsumedBytes);
+    return str;
+}
+
+SourceValidationRegistryReturnType RegisterKafkaSourceValidation(SourceValidationRegistryArguments sourceConfig)
+{
+    return KafkaSource::validateAndFormat(std::move(sourceConfig.config));
+}
+
+SourceRegistryReturnType SourceGeneratedRegistrar::RegisterKafkaSource(SourceRegistryArguments sourceRegistryArguments)
+{
+    return std::make_unique<KafkaSource>(sourceRegistryArguments.sourceDescriptor);
+}
+
+}
@@ -0,0 +1,204 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <span>
+#include <stop_token>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include <Configurations/Descriptor.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Sources/Source.hpp>
+#include <Sources/SourceDescriptor.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <librdkafka/rdkafka.h>
+
+namespace NES
+{
+
+/// Consumes the messages of the 'kafka_topic' and writes each of them as one or more tuples.
+/// Without a 'kafka_partition', the source joins the consumer group 'kafka_group_id', thus the broker distributes the partitions of the
+/// topic across all sources of the group, which ingest the topic in parallel. With a 'kafka_partition', the source consumes solely that
+/// partition, thus each partition maps to the origin of exactly one physical source.
+/// A single call consumes up to 'kafka_batch_size' messages. By default, the source copies the messages into the TupleBuffer and appends
+/// the tuple delimiter, unless a message already ends with it. With 'kafka_zero_copy', the source hands out the payload of every message as
+/// TupleBuffer without copying it, c.f., 'TupleBuffer::wrapMemory()', thus the producers must terminate every message with the delimiter.
+/// 'kafka_properties' passes further properties to librdkafka, e.g., 'security.protocol=ssl;fetch.min.bytes=65536'.
+class KafkaSource final : public Source
+{
+public:
+    static constexpr std::string_view NAME = "Kafka";
+
+    explicit KafkaSource(const SourceDescriptor& sourceDescriptor);
+    ~KafkaSource() override = default;
+
+    KafkaSource(const KafkaSource&) = delete;
+    KafkaSource& operator=(const KafkaSource&) = delete;
+    KafkaSource(KafkaSource&&) = delete;
+    KafkaSource& operator=(KafkaSource&&) = delete;
+
+    /// Copies the available messages into the buffer. Waits solely for the first message.
+    size_t fillTupleBuffer(TupleBuffer& tupleBuffer, const std::stop_token& stopToken) override;
+
+    [[nodiscard]] bool providesTupleBuffers() const override;
+    /// Returns the payload of the next message. Returns nullopt, if a stop was requested while waiting for it.
+    std::optional<TupleBuffer> provideTupleBuffer(const std::stop_token& stopToken) override;
+
+    /// Creates the consumer and subscribes to the topic or assigns the partition
+    void open() override;
+    void close() override;
+
+    static DescriptorConfig::Config validateAndFormat(std::unordered_map<std::string, std::string> config);
+
+    [[nodiscard]] std::ostream& toString(std::ostream& str) const override;
+
+private:
+    struct MessageDeleter
+    {
+        void operator()(rd_kafka_message_t* message) const { rd_kafka_message_destroy(message); }
+    };
+    using Message = std::unique_ptr<rd_kafka_message_t, MessageDeleter>;
+
+    struct PendingMessage
+    {
+        Message message;
+        /// Number of payload bytes already copied into previous buffers
+        size_t offset{0};
+    };
+
+    /// Consumes the next batch of messages into the pending messages. Returns the number of consumed messages with a payload.
+    size_t consumeBatch(std::chrono::milliseconds timeout);
+    /// Copies the front of the pending messages into the destination and returns the number of written bytes
+    size_t copyPendingMessage(std::span<char> destination);
+
+    std::string brokers;
+    std::string topic;
+    std::string groupId;
+    int32_t partition;
+    std::string autoOffsetReset;
+    std::string properties;
+    size_t batchSize;
+    std::chrono::milliseconds pollTimeout;
+    bool isZeroCopy;
+    char tupleDelimiter;
+
+    /// Shared with the TupleBuffers that wrap messages, as the consumer must outlive all of its messages
+    std::shared_ptr<rd_kafka_t> consumer;
+    std::unique_ptr<rd_kafka_queue_t, decltype(&rd_kafka_queue_destroy)> queue{nullptr, rd_kafka_queue_destroy};
+    std::vector<rd_kafka_message_t*> batch;
+    std::deque<PendingMessage> pendingMessages;
+
+    uint64_t numberOfConsumedMessages{0};
+    uint64_t numberOfConsumedBytes{0};
+};
+
+struct ConfigParametersKafka
+{
+    static inline const DescriptorConfig::ConfigParameter<std::string> BROKERS{
+        "kafka_brokers",
+        std::nullopt,
+        [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(BROKERS, config); }};
+
+    static inline const DescriptorConfig::ConfigParameter<std::string> TOPIC{
+        "kafka_topic",
+        std::nullopt,
+        [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(TOPIC, config); }};
+
+    static inline const DescriptorConfig::ConfigParameter<std::string> GROUP_ID{
+        "kafka_group_id",
+        "nebulastream",
+        [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(GROUP_ID, config); }};
+
+    /// If negative, the source joins the consumer group instead of consuming a fixed partition
+    static inline const DescriptorConfig::ConfigParameter<int32_t> PARTITION{
+        "kafka_partition",
+        -1,
+        [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(PARTITION, config); }};
+
+    /// Where the source starts, if its group has no committed offset
+    static inline const DescriptorConfig::ConfigParameter<std::string> AUTO_OFFSET_RESET{
+        "kafka_auto_offset_reset",
+        "latest",
+        [](const std::unordered_map<std::string, std::string>& config) -> std::optional<std::string>
+        {
+            const auto autoOffsetReset = DescriptorConfig::tryGet(AUTO_OFFSET_RESET, config);
+            if (autoOffsetReset.has_value() and autoOffsetReset.value() != "earliest" and autoOffsetReset.value() != "latest")
+            {
+                NES_ERROR("KafkaSource auto offset reset is {}, but must be earliest or latest", autoOffsetReset.value());
+                return std::nullopt;
+            }
+            return autoOffsetReset;
+        }};
+
+    /// Further librdkafka properties as 'key=value' pairs, separated by ';'
+    static inline const DescriptorConfig::ConfigParameter<std::string> PROPERTIES{
+        "kafka_properties",
+        "",
+        [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(PROPERTIES, config); }};
+
+    static inline const DescriptorConfig::ConfigParameter<uint32_t> BATCH_SIZE{
+        "kafka_batch_size",
+        1024,
+        [](const std::unordered_map<std::string, std::string>& config) -> std::optional<uint32_t>
+        {
+            const auto batchSize = DescriptorConfig::tryGet(BATCH_SIZE, config);
+            if (batchSize.has_value() and batchSize.value() == 0)
+            {
+                NES_ERROR("KafkaSource batch size must be positive");
+                return std::nullopt;
+            }
+            return batchSize;
+        }};
+
+    static inline const DescriptorConfig::ConfigParameter<uint32_t> POLL_TIMEOUT_MS{
+        "kafka_poll_timeout_ms",
+        100,
+        [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(POLL_TIMEOUT_MS, config); }};
+
+    static inline const DescriptorConfig::ConfigParameter<bool> ZERO_COPY{
+        "kafka_zero_copy",
+        false,
+        [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(ZERO_COPY, config); }};
+
+    static inline const DescriptorConfig::ConfigParameter<char> SEPARATOR{
+        "tuple_delimiter",
+        '\n',
+        [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(SEPARATOR, config); }};
+
+    static inline std::unordered_map<std::string, DescriptorConfig::ConfigParameterContainer> parameterMap
+        = DescriptorConfig::createConfigParameterContainerMap(
+            SourceDescriptor::parameterMap,
+            BROKERS,
+            TOPIC,
+            GROUP_ID,
+            PARTITION,
+            AUTO_OFFSET_RESET,
+            PROPERTIES,
+            BATCH_SIZE,
+            POLL_TIMEOUT_MS,
+            ZERO_COPY,
+            SEPARATOR);
+};
+
+}
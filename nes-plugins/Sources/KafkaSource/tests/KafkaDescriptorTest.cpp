@@ -0,0 +1,195 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include <Configurations/Descriptor.hpp>
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/DataTypeProvider.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Serialization/OperatorSerializationUtil.hpp>
+#include <Sinks/SinkCatalog.hpp>
+#include <Sinks/SinkDescriptor.hpp>
+#include <Sources/LogicalSource.hpp>
+#include <Sources/SourceCatalog.hpp>
+#include <Sources/SourceDescriptor.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+#include <ErrorHandling.hpp>
+#include <KafkaSink.hpp>
+#include <KafkaSource.hpp>
+
+namespace NES
+{
+
+class KafkaDescriptorTest : public Testing::BaseUnitTest
+{
+public:
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("KafkaDescriptorTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup KafkaDescriptorTest test class.");
+    }
+
+    void SetUp() override
+    {
+        BaseUnitTest::SetUp();
+        schema.addField("id", DataTypeProvider::provideDataType(DataType::Type::UINT64));
+        schema.addField("value", DataTypeProvider::provideDataType(DataType::Type::UINT64));
+        logicalSource = sourceCatalog.addLogicalSource("testSource", schema);
+        ASSERT_TRUE(logicalSource.has_value());
+    }
+
+    static std::unordered_map<std::string, std::string> withBrokerAndTopic(std::unordered_map<std::string, std::string> config)
+    {
+        config.emplace("kafka_brokers", "localhost:9092");
+        config.emplace("kafka_topic", "events");
+        return config;
+    }
+
+    Schema schema;
+    SourceCatalog sourceCatalog;
+    SinkCatalog sinkCatalog;
+    std::optional<LogicalSource> logicalSource;
+};
+
+/// clang tidy doesn't recognize the .has_value in the ASSERT_TRUE
+/// NOLINTBEGIN(bugprone-unchecked-optional-access)
+TEST_F(KafkaDescriptorTest, SourceUsesDefaultsForOptionalParameters)
+{
+    const auto config = KafkaSource::validateAndFormat(withBrokerAndTopic({}));
+    EXPECT_EQ(std::get<std::string>(config.at(ConfigParametersKafka::BROKERS)), "localhost:9092");
+    EXPECT_EQ(std::get<std::string>(config.at(ConfigParametersKafka::TOPIC)), "events");
+    EXPECT_EQ(std::get<std::string>(config.at(ConfigParametersKafka::GROUP_ID)), "nebulastream");
+    EXPECT_EQ(std::get<int32_t>(config.at(ConfigParametersKafka::PARTITION)), -1);
+    EXPECT_EQ(std::get<std::string>(config.at(ConfigParametersKafka::AUTO_OFFSET_RESET)), "latest");
+    EXPECT_EQ(std::get<std::string>(config.at(ConfigParametersKafka::PROPERTIES)), "");
+    EXPECT_EQ(std::get<uint32_t>(config.at(ConfigParametersKafka::BATCH_SIZE)), 1024U);
+    EXPECT_EQ(std::get<uint32_t>(config.at(ConfigParametersKafka::POLL_TIMEOUT_MS)), 100U);
+    EXPECT_FALSE(std::get<bool>(config.at(ConfigParametersKafka::ZERO_COPY)));
+    EXPECT_EQ(std::get<char>(config.at(ConfigParametersKafka::SEPARATOR)), '\n');
+}
+
+TEST_F(KafkaDescriptorTest, SourceAcceptsValidParameters)
+{
+    const auto config = KafkaSource::validateAndFormat(withBrokerAndTopic(
+        {{"kafka_group_id", "ingestion"},
+         {"kafka_partition", "3"},
+         {"kafka_auto_offset_reset", "earliest"},
+         {"kafka_properties", "fetch.min.bytes=65536"},
+         {"kafka_batch_size", "64"},
+         {"kafka_poll_timeout_ms", "10"},
+         {"kafka_zero_copy", "true"}}));
+    EXPECT_EQ(std::get<std::string>(config.at(ConfigParametersKafka::GROUP_ID)), "ingestion");
+    EXPECT_EQ(std::get<int32_t>(config.at(ConfigParametersKafka::PARTITION)), 3);
+    EXPECT_EQ(std::get<std::string>(config.at(ConfigParametersKafka::AUTO_OFFSET_RESET)), "earliest");
+    EXPECT_EQ(std::get<std::string>(config.at(ConfigParametersKafka::PROPERTIES)), "fetch.min.bytes=65536");
+    EXPECT_EQ(std::get<uint32_t>(config.at(ConfigParametersKafka::BATCH_SIZE)), 64U);
+    EXPECT_EQ(std::get<uint32_t>(config.at(ConfigParametersKafka::POLL_TIMEOUT_MS)), 10U);
+    EXPECT_TRUE(std::get<bool>(config.at(ConfigParametersKafka::ZERO_COPY)));
+}
+
+TEST_F(KafkaDescriptorTest, SourceRejectsInvalidParameters)
+{
+    ASSERT_EXCEPTION_ERRORCODE(
+        auto config = KafkaSource::validateAndFormat({{"kafka_topic", "events"}}), ErrorCode::InvalidConfigParameter);
+    ASSERT_EXCEPTION_ERRORCODE(
+        auto config = KafkaSource::validateAndFormat({{"kafka_brokers", "localhost:9092"}}), ErrorCode::InvalidConfigParameter);
+    ASSERT_EXCEPTION_ERRORCODE(
+        auto config = KafkaSource::validateAndFormat(withBrokerAndTopic({{"kafka_auto_offset_reset", "beginning"}})),
+        ErrorCode::InvalidConfigParameter);
+    ASSERT_EXCEPTION_ERRORCODE(
+        auto config = KafkaSource::validateAndFormat(withBrokerAndTopic({{"kafka_batch_size", "0"}})), ErrorCode::InvalidConfigParameter);
+    ASSERT_EXCEPTION_ERRORCODE(
+        auto config = KafkaSource::validateAndFormat(withBrokerAndTopic({{"kafka_partition", "first"}})),
+        ErrorCode::InvalidConfigParameter);
+    ASSERT_EXCEPTION_ERRORCODE(
+        auto config = KafkaSource::validateAndFormat(withBrokerAndTopic({{"kafka_offset", "0"}})), ErrorCode::InvalidConfigParameter);
+}
+
+TEST_F(KafkaDescriptorTest, SourceDescriptorSurvivesSerialization)
+{
+    const auto descriptor = sourceCatalog.addPhysicalSource(
+        logicalSource.value(),
+        "Kafka",
+        withBrokerAndTopic({{"kafka_partition", "2"}, {"kafka_zero_copy", "true"}, {"kafka_properties", "security.protocol=ssl"}}),
+        {{"type", "CSV"}});
+    ASSERT_TRUE(descriptor.has_value());
+
+    const auto deserialized = OperatorSerializationUtil::deserializeSourceDescriptor(descriptor->serialize());
+    EXPECT_EQ(deserialized, descriptor.value());
+    EXPECT_EQ(deserialized.getSourceType(), "Kafka");
+    EXPECT_EQ(deserialized.getFromConfig(ConfigParametersKafka::BROKERS), "localhost:9092");
+    EXPECT_EQ(deserialized.getFromConfig(ConfigParametersKafka::TOPIC), "events");
+    EXPECT_EQ(deserialized.getFromConfig(ConfigParametersKafka::PARTITION), 2);
+    EXPECT_EQ(deserialized.getFromConfig(ConfigParametersKafka::PROPERTIES), "security.protocol=ssl");
+    EXPECT_TRUE(deserialized.getFromConfig(ConfigParametersKafka::ZERO_COPY));
+    EXPECT_EQ(deserialized.getFromConfig(ConfigParametersKafka::SEPARATOR), '\n');
+}
+
+TEST_F(KafkaDescriptorTest, SinkUsesDefaultsForOptionalParameters)
+{
+    const auto config = KafkaSink::validateAndFormat(withBrokerAndTopic({}));
+    EXPECT_EQ(std::get<std::string>(config.at(ConfigParametersKafkaSink::BROKERS)), "localhost:9092");
+    EXPECT_EQ(std::get<std::string>(config.at(ConfigParametersKafkaSink::TOPIC)), "events");
+    EXPECT_EQ(std::get<int32_t>(config.at(ConfigParametersKafkaSink::PARTITION)), -1);
+    EXPECT_EQ(std::get<std::string>(config.at(ConfigParametersKafkaSink::COMPRESSION)), "none");
+    EXPECT_EQ(std::get<uint32_t>(config.at(ConfigParametersKafkaSink::LINGER_MS)), 5U);
+    EXPECT_EQ(std::get<uint32_t>(config.at(ConfigParametersKafkaSink::BATCH_SIZE_BYTES)), 1024U * 1024U);
+    EXPECT_EQ(std::get<std::string>(config.at(ConfigParametersKafkaSink::PROPERTIES)), "");
+    EXPECT_EQ(
+        std::get<EnumWrapper>(config.at(ConfigParametersKafkaSink::INPUT_FORMAT)).asEnum<InputFormat>().value(), InputFormat::CSV);
+}
+
+TEST_F(KafkaDescriptorTest, SinkRejectsInvalidParameters)
+{
+    ASSERT_EXCEPTION_ERRORCODE(auto config = KafkaSink::validateAndFormat({{"kafka_topic", "events"}}), ErrorCode::InvalidConfigParameter);
+    ASSERT_EXCEPTION_ERRORCODE(
+        auto config = KafkaSink::validateAndFormat(withBrokerAndTopic({{"kafka_compression", "brotli"}})),
+        ErrorCode::InvalidConfigParameter);
+    ASSERT_EXCEPTION_ERRORCODE(
+        auto config = KafkaSink::validateAndFormat(withBrokerAndTopic({{"kafka_batch_size_bytes", "0"}})),
+        ErrorCode::InvalidConfigParameter);
+    ASSERT_EXCEPTION_ERRORCODE(
+        auto config = KafkaSink::validateAndFormat(withBrokerAndTopic({{"input_format", "XML"}})), ErrorCode::InvalidConfigParameter);
+}
+
+TEST_F(KafkaDescriptorTest, SinkDescriptorSurvivesSerialization)
+{
+    const auto descriptor = sinkCatalog.addSinkDescriptor(
+        "kafkaSink",
+        schema,
+        "Kafka",
+        withBrokerAndTopic({{"kafka_compression", "zstd"}, {"kafka_linger_ms", "20"}, {"input_format", "JSON"}}));
+    ASSERT_TRUE(descriptor.has_value());
+
+    const auto deserialized = OperatorSerializationUtil::deserializeSinkDescriptor(descriptor->serialize());
+    EXPECT_EQ(deserialized, descriptor.value());
+    EXPECT_EQ(deserialized.getSinkType(), "Kafka");
+    EXPECT_EQ(*deserialized.getSchema(), schema);
+    EXPECT_EQ(deserialized.getFromConfig(ConfigParametersKafkaSink::BROKERS), "localhost:9092");
+    EXPECT_EQ(deserialized.getFromConfig(ConfigParametersKafkaSink::TOPIC), "events");
+    EXPECT_EQ(deserialized.getFromConfig(ConfigParametersKafkaSink::COMPRESSION), "zstd");
+    EXPECT_EQ(deserialized.getFromConfig(ConfigParametersKafkaSink::LINGER_MS), 20U);
+    EXPECT_EQ(deserialized.getFromConfig(ConfigParametersKafkaSink::INPUT_FORMAT), InputFormat::JSON);
+}
+/// NOLINTEND(bugprone-unchecked-optional-access)
+
+}
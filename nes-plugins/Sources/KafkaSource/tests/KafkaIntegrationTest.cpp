@@ -0,0 +1,226 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <optional>
+#include <stop_token>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <unistd.h>
+
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/DataTypeProvider.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Sinks/SinkCatalog.hpp>
+#include <SinksParsing/CSVFormat.hpp>
+#include <Sources/LogicalSource.hpp>
+#include <Sources/SourceCatalog.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+#include <KafkaSink.hpp>
+#include <KafkaSource.hpp>
+#include <TestTaskQueue.hpp>
+
+namespace NES
+{
+
+/// Produces with the KafkaSink and consumes with the KafkaSource through the broker in 'NES_KAFKA_TEST_BROKERS', e.g., 'localhost:9092'.
+/// The broker must create topics on demand. Without a broker, the tests skip themselves.
+class KafkaIntegrationTest : public Testing::BaseUnitTest
+{
+public:
+    static constexpr uint64_t NUMBER_OF_FIELDS = 2;
+    static constexpr std::chrono::seconds TIMEOUT{30};
+
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("KafkaIntegrationTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup KafkaIntegrationTest test class.");
+    }
+
+    void SetUp() override
+    {
+        BaseUnitTest::SetUp();
+        const auto* const testBrokers = std::getenv("NES_KAFKA_TEST_BROKERS");
+        if (testBrokers == nullptr)
+        {
+            GTEST_SKIP() << "NES_KAFKA_TEST_BROKERS does not name a Kafka broker";
+        }
+        brokers = testBrokers;
+        /// Every test produces to a topic of its own, thus reruns do not consume the messages of previous runs
+        topic = "nes-kafka-integration-test-" + std::to_string(getpid()) + "-"
+            + ::testing::UnitTest::GetInstance()->current_test_info()->name();
+        schema.addField("id", DataTypeProvider::provideDataType(DataType::Type::UINT64));
+        schema.addField("value", DataTypeProvider::provideDataType(DataType::Type::UINT64));
+        logicalSource = sourceCatalog.addLogicalSource("testSource", schema);
+        ASSERT_TRUE(logicalSource.has_value());
+    }
+
+    std::unique_ptr<KafkaSource> createSource(const bool isZeroCopy)
+    {
+        const auto descriptor = sourceCatalog.addPhysicalSource(
+            logicalSource.value(),
+            "Kafka",
+            {{"kafka_brokers", brokers},
+             {"kafka_topic", topic},
+             {"kafka_partition", "0"},
+             {"kafka_auto_offset_reset", "earliest"},
+             {"kafka_zero_copy", isZeroCopy ? "true" : "false"}},
+            {{"type", "CSV"}});
+        EXPECT_TRUE(descriptor.has_value());
+        return std::make_unique<KafkaSource>(descriptor.value());
+    }
+
+    std::unique_ptr<KafkaSink> createSink()
+    {
+        const auto descriptor = sinkCatalog.addSinkDescriptor(
+            "kafkaSink", schema, "Kafka", {{"kafka_brokers", brokers}, {"kafka_topic", topic}, {"kafka_partition", "0"}});
+        EXPECT_TRUE(descriptor.has_value());
+        return std::make_unique<KafkaSink>(descriptor.value());
+    }
+
+    TupleBuffer createBuffer(const uint64_t index, const uint64_t numberOfTuples) const
+    {
+        auto buffer = bufferManager->getBufferBlocking();
+        const auto rows = buffer.getAvailableMemoryArea<uint64_t>();
+        for (uint64_t tuple = 0; tuple < numberOfTuples; ++tuple)
+        {
+            rows[(tuple * NUMBER_OF_FIELDS)] = index;
+            rows[(tuple * NUMBER_OF_FIELDS) + 1] = tuple;
+        }
+        buffer.setNumberOfTuples(numberOfTuples);
+        return buffer;
+    }
+
+    /// Produces every buffer as one message and returns the formatted messages in the order of the partition
+    std::vector<std::string> produce(const uint64_t numberOfBuffers, const uint64_t numberOfTuples)
+    {
+        const CSVFormat format(schema);
+        auto sink = createSink();
+        TestPipelineExecutionContext pipelineExecutionContext;
+        bool isRepeated = false;
+        pipelineExecutionContext.setRepeatTaskCallback([&isRepeated] { isRepeated = true; });
+
+        std::vector<std::string> messages;
+        sink->start(pipelineExecutionContext);
+        for (uint64_t index = 0; index < numberOfBuffers; ++index)
+        {
+            const auto buffer = createBuffer(index, numberOfTuples);
+            do
+            {
+                isRepeated = false;
+                sink->execute(buffer, pipelineExecutionContext);
+            } while (isRepeated);
+            messages.emplace_back(format.getFormattedBuffer(buffer));
+        }
+        /// Stopping flushes the producer, thus all messages are on the broker afterward
+        sink->stop(pipelineExecutionContext);
+        return messages;
+    }
+
+    /// A consumer that does not receive all messages stops after the TIMEOUT instead of waiting forever
+    static std::jthread startWatchdog(std::stop_source& stopSource)
+    {
+        return std::jthread(
+            [&stopSource](const std::stop_token& stopToken)
+            {
+                const auto deadline = std::chrono::steady_clock::now() + TIMEOUT;
+                while (not stopToken.stop_requested() and std::chrono::steady_clock::now() < deadline)
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                }
+                stopSource.request_stop();
+            });
+    }
+
+    Schema schema;
+    SourceCatalog sourceCatalog;
+    SinkCatalog sinkCatalog;
+    std::optional<LogicalSource> logicalSource;
+    std::shared_ptr<BufferManager> bufferManager = BufferManager::create();
+    std::string brokers;
+    std::string topic;
+};
+
+/// clang tidy doesn't recognize the .has_value in the ASSERT_TRUE
+/// NOLINTBEGIN(bugprone-unchecked-optional-access)
+TEST_F(KafkaIntegrationTest, SourceCopiesAllProducedMessagesInOrder)
+{
+    const auto messages = produce(50, 20);
+    std::string expectedContent;
+    for (const auto& message : messages)
+    {
+        expectedContent += message;
+    }
+
+    auto source = createSource(false);
+    source->open();
+    std::stop_source stopSource;
+    const auto watchdog = startWatchdog(stopSource);
+    std::string consumedContent;
+    while (consumedContent.size() < expectedContent.size() and not stopSource.stop_requested())
+    {
+        auto buffer = bufferManager->getBufferBlocking();
+        const auto numberOfBytes = source->fillTupleBuffer(buffer, stopSource.get_token());
+        const auto bytes = buffer.getAvailableMemoryArea<char>().first(numberOfBytes);
+        consumedContent.append(bytes.begin(), bytes.end());
+    }
+    source->close();
+    EXPECT_EQ(consumedContent, expectedContent);
+}
+
+TEST_F(KafkaIntegrationTest, ZeroCopySourceProvidesOneBufferPerMessage)
+{
+    const auto messages = produce(50, 20);
+
+    auto source = createSource(true);
+    ASSERT_TRUE(source->providesTupleBuffers());
+    source->open();
+    std::stop_source stopSource;
+    const auto watchdog = startWatchdog(stopSource);
+    /// The buffers wrap the messages of the consumer, thus they remain valid until the test released them after closing the source
+    std::vector<TupleBuffer> buffers;
+    while (buffers.size() < messages.size())
+    {
+        auto buffer = source->provideTupleBuffer(stopSource.get_token());
+        if (not buffer.has_value())
+        {
+            break;
+        }
+        buffers.emplace_back(std::move(buffer.value()));
+    }
+    source->close();
+
+    ASSERT_EQ(buffers.size(), messages.size());
+    for (size_t index = 0; index < messages.size(); ++index)
+    {
+        const auto bytes = buffers[index].getAvailableMemoryArea<char>();
+        EXPECT_EQ(std::string(bytes.begin(), bytes.end()), messages[index]) << "message " << index;
+    }
+}
+/// NOLINTEND(bugprone-unchecked-optional-access)
+
+}
@@ -0,0 +1,145 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <optional>
+#include <ostream>
+#include <utility>
+#include <magic_enum/magic_enum.hpp>
+
+namespace NES::Sources
+{
+
+/// Decides when the MQTTSource flushes the buffer it currently fills. The source flushes, whichever comes first:
+/// 1. FILL_RATIO: the buffer is filled to the fill ratio.
+/// 2. MAX_LATENCY: the first byte in the buffer waited for the max latency.
+/// 3. IDLE (adaptive only): no message arrived for IDLE_FACTOR times the observed mean inter-arrival time. Thus, at low rates, the source
+///    flushes shortly after a burst of messages ended instead of waiting for the max latency, while, at high rates, the messages keep
+///    postponing the deadline until the buffer is filled.
+/// The policy counts the flushes per reason and their fill, which shows whether the configuration favors latency or throughput.
+/// @note This object is not thread-safe.
+class FlushPolicy
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    enum class FlushReason : uint8_t
+    {
+        FILL_RATIO,
+        MAX_LATENCY,
+        IDLE,
+        /// The source flushes the bytes it received before a stop was requested
+        STOP
+    };
+
+    /// Weight of the latest inter-arrival time in the exponentially weighted mean
+    static constexpr double INTER_ARRIVAL_WEIGHT = 0.125;
+    static constexpr double IDLE_FACTOR = 4.0;
+
+    FlushPolicy(const double fillRatio, const std::chrono::milliseconds maxLatency, const bool isAdaptive)
+        : fillRatio(fillRatio), maxLatency(maxLatency), isAdaptive(isAdaptive)
+    {
+    }
+
+    /// Must be called for every message, before its payload is written to the buffer
+    void onMessage(const Clock::time_point arrival, const size_t numberOfBytesInBuffer)
+    {
+        if (lastArrival.has_value())
+        {
+            const auto interArrival = std::chrono::duration<double, std::micro>(arrival - *lastArrival).count();
+            meanInterArrivalUs = meanInterArrivalUs.has_value()
+                ? ((INTER_ARRIVAL_WEIGHT * interArrival) + ((1 - INTER_ARRIVAL_WEIGHT) * *meanInterArrivalUs))
+                : interArrival;
+        }
+        lastArrival = arrival;
+        if (numberOfBytesInBuffer == 0)
+        {
+            firstByteArrival = arrival;
+        }
+    }
+
+    /// The buffer may contain bytes of a previous message, which the source did not fit into the previous buffer
+    void onStashedBytes(const Clock::time_point now) { firstByteArrival = now; }
+
+    [[nodiscard]] bool isFilled(const size_t numberOfBytesInBuffer, const size_t bufferSize) const
+    {
+        return static_cast<double>(numberOfBytesInBuffer) >= fillRatio * static_cast<double>(bufferSize);
+    }
+
+    /// Returns the time and the reason of the next flush, if the buffer contains bytes
+    [[nodiscard]] std::optional<std::pair<Clock::time_point, FlushReason>> getDeadline() const
+    {
+        if (not firstByteArrival.has_value())
+        {
+            return std::nullopt;
+        }
+        const auto maxLatencyDeadline = *firstByteArrival + maxLatency;
+        if (isAdaptive and meanInterArrivalUs.has_value() and lastArrival.has_value())
+        {
+            const auto idleDeadline = *lastArrival
+                + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double, std::micro>(IDLE_FACTOR * *meanInterArrivalUs));
+            if (idleDeadline < maxLatencyDeadline)
+            {
+                return std::pair{idleDeadline, FlushReason::IDLE};
+            }
+        }
+        return std::pair{maxLatencyDeadline, FlushReason::MAX_LATENCY};
+    }
+
+    void onFlush(const FlushReason reason, const size_t numberOfBytesInBuffer, const size_t bufferSize)
+    {
+        ++numberOfFlushes.at(static_cast<size_t>(reason));
+        sumOfFillRatios += static_cast<double>(numberOfBytesInBuffer) / static_cast<double>(bufferSize);
+        firstByteArrival.reset();
+    }
+
+    [[nodiscard]] uint64_t getNumberOfFlushes(const FlushReason reason) const { return numberOfFlushes.at(static_cast<size_t>(reason)); }
+
+    /// Mean fraction of the buffer size that the flushed buffers used
+    [[nodiscard]] double getMeanFillRatio() const
+    {
+        const auto totalNumberOfFlushes = std::accumulate(numberOfFlushes.begin(), numberOfFlushes.end(), uint64_t{0});
+        return totalNumberOfFlushes == 0 ? 0 : sumOfFillRatios / static_cast<double>(totalNumberOfFlushes);
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, const FlushPolicy& policy)
+    {
+        os << "FlushPolicy(fillRatio: " << policy.fillRatio << ", maxLatency: " << policy.maxLatency.count()
+           << "ms, adaptive: " << policy.isAdaptive << ", meanFill: " << policy.getMeanFillRatio();
+        for (const auto reason : magic_enum::enum_values<FlushReason>())
+        {
+            os << ", " << magic_enum::enum_name(reason) << ": " << policy.getNumberOfFlushes(reason);
+        }
+        return os << ")";
+    }
+
+private:
+    double fillRatio;
+    std::chrono::milliseconds maxLatency;
+    bool isAdaptive;
+
+    std::optional<Clock::time_point> firstByteArrival;
+    std::optional<Clock::time_point> lastArrival;
+    std::optional<double> meanInterArrivalUs;
+
+    std::array<uint64_t, magic_enum::enum_count<FlushReason>()> numberOfFlushes{};
+    double sumOfFillRatios{0};
+};
+
+}
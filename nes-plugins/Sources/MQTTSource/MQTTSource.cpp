@@ -15,6 +15,7 @@
 #include <MQTTSource.hpp>
 
 #include <algorithm>
+#include <chrono>
 #include <cstddef>
 #include <cstring>
 #include <memory>
@@ -25,11 +26,15 @@
 #include <utility>
 
 #include <mqtt/connect_options.h>
+#include <mqtt/create_options.h>
 #include <mqtt/exception.h>
 
 #include <Configurations/Descriptor.hpp>
 #include <Runtime/TupleBuffer.hpp>
 #include <Sources/SourceDescriptor.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <fmt/format.h>
+#include <fmt/ostream.h>
 #include <ErrorHandling.hpp>
 #include <SourceRegistry.hpp>
 #include <SourceValidationRegistry.hpp>
@@ -37,13 +42,26 @@
 namespace NES
 {
 
+namespace
+{
+constexpr auto EMPTY_BUFFER_WAIT_TIMEOUT = std::chrono::milliseconds(100);
+}
+
 MQTTSource::MQTTSource(const SourceDescriptor& sourceDescriptor)
     : serverURI(sourceDescriptor.getFromConfig(ConfigParametersMQTT::SERVER_URI))
     , clientId(sourceDescriptor.getFromConfig(ConfigParametersMQTT::CLIENT_ID))
     , topic(sourceDescriptor.getFromConfig(ConfigParametersMQTT::TOPIC))
+    , subscriptionTopic(
+          sourceDescriptor.getFromConfig(ConfigParametersMQTT::SHARED_SUBSCRIPTION_GROUP).empty()
+              ? topic
+              : fmt::format("$share/{}/{}", sourceDescriptor.getFromConfig(ConfigParametersMQTT::SHARED_SUBSCRIPTION_GROUP), topic))
     , qos(sourceDescriptor.getFromConfig(ConfigParametersMQTT::QOS))
     , flushingInterval(std::chrono::duration_cast<std::chrono::milliseconds>(
           std::chrono::duration<float, std::milli>(sourceDescriptor.getFromConfig(ConfigParametersMQTT::FLUSH_INTERVAL_MS))))
+    , flushPolicy(
+          sourceDescriptor.getFromConfig(ConfigParametersMQTT::FLUSH_FILL_RATIO),
+          flushingInterval,
+          sourceDescriptor.getFromConfig(ConfigParametersMQTT::ADAPTIVE_FLUSH))
 {
 }
 
@@ -53,18 +71,25 @@ std::ostream& MQTTSource::toString(std::ostream& str) const
     str << "\n  serverURI: " << serverURI;
     str << "\n  clientId: " << clientId;
     str << "\n  topic: " << topic;
+    str << "\n  subscription: " << subscriptionTopic;
     str << "\n  qos: " << qos;
+    str << "\n  " << flushPolicy;
     str << ")\n";
     return str;
 }
 
 void MQTTSource::open()
 {
-    client = std::make_unique<mqtt::async_client>(serverURI, clientId);
+    /// Shared subscriptions require MQTT v5
+    const auto isSharedSubscription = subscriptionTopic != topic;
+    const auto mqttVersion = isSharedSubscription ? MQTTVERSION_5 : MQTTVERSION_DEFAULT;
+    client = std::make_unique<mqtt::async_client>(serverURI, clientId, mqtt::create_options(mqttVersion));
 
     try
     {
-        const auto connectOptions = mqtt::connect_options_builder().automatic_reconnect(true).clean_session(false).finalize();
+        const auto connectOptions = isSharedSubscription
+            ? mqtt::connect_options_builder::v5().automatic_reconnect(true).clean_start(false).finalize()
+            : mqtt::connect_options_builder().automatic_reconnect(true).clean_session(false).finalize();
 
         client->start_consuming();
 
@@ -72,7 +97,7 @@ void MQTTSource::open()
 
         if (const auto response = token->get_connect_response(); !response.is_session_present())
         {
-            client->subscribe(topic, qos)->wait();
+            client->subscribe(subscriptionTopic, qos)->wait();
         }
     }
     catch (const mqtt::exception& e)
@@ -83,41 +108,47 @@ void MQTTSource::open()
 
 size_t MQTTSource::fillTupleBuffer(TupleBuffer& tupleBuffer, const std::stop_token& stopToken)
 {
+    using FlushReason = Sources::FlushPolicy::FlushReason;
     size_t tbOffset = 0;
     const auto tbSize = tupleBuffer.getBufferSize();
-    std::string_view payload;
-    auto nextFlush = std::chrono::system_clock::now() + std::chrono::milliseconds(flushingInterval);
 
     /// If there is a stashed payload, consume it first
     if (!payloadStash.empty())
     {
-        payload = payloadStash.consume(tbSize);
-        writePayloadToBuffer(payload, tupleBuffer, tbOffset);
+        flushPolicy.onStashedBytes(Sources::FlushPolicy::Clock::now());
+        writePayloadToBuffer(payloadStash.consume(tbSize), tupleBuffer, tbOffset);
     }
 
-    /// When the stashed payload is larger than a single TB, we skip the loop
-    while (tbOffset < tbSize && !stopToken.stop_requested())
+    auto flushReason = FlushReason::STOP;
+    /// When the stashed payload is larger than a single TB, the buffer is already filled
+    while (!stopToken.stop_requested())
     {
-        if (nextFlush < std::chrono::system_clock::now())
+        if (flushPolicy.isFilled(tbOffset, tbSize))
         {
-            if (tbOffset == 0)
-            {
-                nextFlush = std::chrono::system_clock::now() + std::chrono::milliseconds(flushingInterval);
-            }
-            else
-            {
-                break;
-            }
+            flushReason = FlushReason::FILL_RATIO;
+            break;
+        }
+        const auto deadline = flushPolicy.getDeadline();
+        if (deadline.has_value() and deadline->first <= Sources::FlushPolicy::Clock::now())
+        {
+            flushReason = deadline->second;
+            break;
         }
 
-        const auto message = client->try_consume_message_until(nextFlush);
+        /// Without bytes in the buffer, there is no deadline, but the source must still react to stop requests
+        const auto waitUntil = deadline.has_value() ? deadline->first : Sources::FlushPolicy::Clock::now() + EMPTY_BUFFER_WAIT_TIMEOUT;
+        const auto message = client->try_consume_message_until(waitUntil);
         if (!message)
         {
             continue;
         }
 
-        payload = message->get_payload();
-        writePayloadToBuffer(payload, tupleBuffer, tbOffset);
+        flushPolicy.onMessage(Sources::FlushPolicy::Clock::now(), tbOffset);
+        writePayloadToBuffer(message->get_payload(), tupleBuffer, tbOffset);
+    }
+    if (tbOffset != 0)
+    {
+        flushPolicy.onFlush(flushReason, tbOffset, tbSize);
     }
     return std::min(tbOffset, tbSize);
 }
@@ -146,9 +177,10 @@ void MQTTSource::writePayloadToBuffer(const std::string_view payload, TupleBuffe
 
 void MQTTSource::close()
 {
+    NES_INFO("MQTTSource for topic {} closes with {}", topic, fmt::streamed(flushPolicy));
     try
     {
-        client->unsubscribe(topic)->wait();
+        client->unsubscribe(subscriptionTopic)->wait();
         client->disconnect()->wait();
     }
     catch (const mqtt::exception& e)
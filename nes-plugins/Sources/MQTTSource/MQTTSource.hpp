@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <optional>
@@ -27,11 +28,17 @@
 #include <Sources/SourceDescriptor.hpp>
 #include <Util/Logger/Logger.hpp>
 #include <mqtt/async_client.h>
+#include <FlushPolicy.hpp>
 #include <PayloadStash.hpp>
 
 namespace NES
 {
 
+/// Subscribes to 'topic', which may contain the wildcards '+' and '#'. Thus, like any MQTT client, multiple sources with overlapping topic
+/// filters each receive a copy of the matching messages.
+/// With a 'sharedSubscriptionGroup', the source joins the MQTT v5 shared subscription '$share/<group>/<topic>', in which the broker delivers
+/// each message to only one of the subscribed clients. Thus, multiple sources with the same group consume one topic in parallel, each with
+/// its own client, consumer queue, and origin.
 class MQTTSource : public Source
 {
 public:
@@ -61,16 +68,46 @@ private:
     std::string serverURI;
     std::string clientId;
     std::string topic;
+    /// Differs from the topic for shared subscriptions
+    std::string subscriptionTopic;
     int32_t qos;
     std::chrono::milliseconds flushingInterval;
 
     std::unique_ptr<mqtt::async_client> client;
 
     Sources::PayloadStash payloadStash;
+    Sources::FlushPolicy flushPolicy;
 
     void writePayloadToBuffer(std::string_view payload, TupleBuffer& tb, size_t& tbOffset);
 };
 
+namespace detail
+{
+/// '+' must occupy a whole topic level and '#' must be the last one (MQTT v5, section 4.7.1)
+inline bool isValidTopicFilter(const std::string_view topicFilter)
+{
+    if (topicFilter.empty())
+    {
+        return false;
+    }
+    for (size_t levelStart = 0; levelStart <= topicFilter.size();)
+    {
+        const auto levelEnd = std::min(topicFilter.find('/', levelStart), topicFilter.size());
+        const auto level = topicFilter.substr(levelStart, levelEnd - levelStart);
+        if (level.find_first_of("+#") != std::string_view::npos and level.size() != 1)
+        {
+            return false;
+        }
+        if (level == "#" and levelEnd != topicFilter.size())
+        {
+            return false;
+        }
+        levelStart = levelEnd + 1;
+    }
+    return true;
+}
+}
+
 namespace detail::uuid
 {
 static std::random_device rd;
@@ -135,7 +172,31 @@ struct ConfigParametersMQTT
     static inline const DescriptorConfig::ConfigParameter<std::string> TOPIC{
         "topic",
         std::nullopt,
-        [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(TOPIC, config); }};
+        [](const std::unordered_map<std::string, std::string>& config) -> std::optional<std::string>
+        {
+            const auto topic = DescriptorConfig::tryGet(TOPIC, config);
+            if (topic.has_value() and not detail::isValidTopicFilter(topic.value()))
+            {
+                NES_ERROR("MQTTSource: topic is: {}, but wildcards must occupy a whole level and '#' must be the last level.", topic.value());
+                return std::nullopt;
+            }
+            return topic;
+        }};
+
+    /// Joins the shared subscription of the group, if not empty
+    static inline const DescriptorConfig::ConfigParameter<std::string> SHARED_SUBSCRIPTION_GROUP{
+        "sharedSubscriptionGroup",
+        "",
+        [](const std::unordered_map<std::string, std::string>& config) -> std::optional<std::string>
+        {
+            const auto group = DescriptorConfig::tryGet(SHARED_SUBSCRIPTION_GROUP, config);
+            if (group.has_value() and group.value().find_first_of("/+#") != std::string::npos)
+            {
+                NES_ERROR("MQTTSource: shared subscription group is: {}, but must not contain '/', '+', or '#'.", group.value());
+                return std::nullopt;
+            }
+            return group;
+        }};
 
     static inline const DescriptorConfig::ConfigParameter<float> FLUSH_INTERVAL_MS{
         "flushIntervalMS",
@@ -143,6 +204,27 @@ struct ConfigParametersMQTT
         [](const std::unordered_map<std::string, std::string>& config)
         { return DescriptorConfig::tryGet(FLUSH_INTERVAL_MS, config); }};
 
+    /// The source flushes a buffer once it is filled to this fraction of its size
+    static inline const DescriptorConfig::ConfigParameter<float> FLUSH_FILL_RATIO{
+        "flushFillRatio",
+        1,
+        [](const std::unordered_map<std::string, std::string>& config) -> std::optional<float>
+        {
+            const auto fillRatio = DescriptorConfig::tryGet(FLUSH_FILL_RATIO, config);
+            if (fillRatio.has_value() and (fillRatio.value() <= 0 or fillRatio.value() > 1))
+            {
+                NES_ERROR("MQTTSource: flush fill ratio is: {}, but must be in (0, 1].", fillRatio.value());
+                return std::nullopt;
+            }
+            return fillRatio;
+        }};
+
+    /// Flushes shortly after a burst of messages ended instead of waiting for the flush interval, c.f., FlushPolicy
+    static inline const DescriptorConfig::ConfigParameter<bool> ADAPTIVE_FLUSH{
+        "adaptiveFlush",
+        false,
+        [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(ADAPTIVE_FLUSH, config); }};
+
     static inline const DescriptorConfig::ConfigParameter<int32_t> QOS{
         "qos",
         1,
@@ -158,7 +240,8 @@ struct ConfigParametersMQTT
         }};
 
     static inline std::unordered_map<std::string, DescriptorConfig::ConfigParameterContainer> parameterMap
-        = DescriptorConfig::createConfigParameterContainerMap(SERVER_URI, CLIENT_ID, QOS, TOPIC, FLUSH_INTERVAL_MS);
+        = DescriptorConfig::createConfigParameterContainerMap(
+            SERVER_URI, CLIENT_ID, QOS, TOPIC, SHARED_SUBSCRIPTION_GROUP, FLUSH_INTERVAL_MS, FLUSH_FILL_RATIO, ADAPTIVE_FLUSH);
 };
 
 }
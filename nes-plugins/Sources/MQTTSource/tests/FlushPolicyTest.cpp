@@ -0,0 +1,163 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <chrono>
+#include <cstddef>
+#include <optional>
+#include <sstream>
+#include <utility>
+
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+#include <FlushPolicy.hpp>
+
+namespace NES
+{
+
+using namespace std::chrono_literals;
+using Sources::FlushPolicy;
+using FlushReason = Sources::FlushPolicy::FlushReason;
+
+/// The tests pass the arrival times to the policy, thus they do not depend on the timing of the machine
+class FlushPolicyTest : public Testing::BaseUnitTest
+{
+public:
+    static constexpr size_t BUFFER_SIZE = 100;
+    static constexpr auto MAX_LATENCY = 1000ms;
+    static constexpr auto START = FlushPolicy::Clock::time_point{} + 1h;
+
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("FlushPolicyTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup FlushPolicyTest test class.");
+    }
+
+    void SetUp() override { BaseUnitTest::SetUp(); }
+
+    /// Passes messages of 'messageSize' bytes, which arrive every 'interArrival' starting at START, and returns the time of the last one
+    static FlushPolicy::Clock::time_point
+    receiveMessages(FlushPolicy& policy, const size_t numberOfMessages, const FlushPolicy::Clock::duration interArrival)
+    {
+        constexpr size_t messageSize = 5;
+        auto arrival = START;
+        for (size_t messageIdx = 0; messageIdx < numberOfMessages; ++messageIdx, arrival += interArrival)
+        {
+            policy.onMessage(arrival, messageIdx * messageSize);
+        }
+        return arrival - interArrival;
+    }
+};
+
+TEST_F(FlushPolicyTest, IsFilledOnceTheBufferReachesTheFillRatio)
+{
+    const FlushPolicy policy(0.5, MAX_LATENCY, false);
+    EXPECT_FALSE(policy.isFilled(49, BUFFER_SIZE));
+    EXPECT_TRUE(policy.isFilled(50, BUFFER_SIZE));
+
+    const FlushPolicy fullBufferPolicy(1, MAX_LATENCY, false);
+    EXPECT_FALSE(fullBufferPolicy.isFilled(BUFFER_SIZE - 1, BUFFER_SIZE));
+    EXPECT_TRUE(fullBufferPolicy.isFilled(BUFFER_SIZE, BUFFER_SIZE));
+}
+
+TEST_F(FlushPolicyTest, FlushesTheMaxLatencyAfterTheFirstByteOfTheBuffer)
+{
+    FlushPolicy policy(1, MAX_LATENCY, false);
+    /// An empty buffer has no deadline
+    EXPECT_EQ(policy.getDeadline(), std::nullopt);
+
+    /// Later messages do not postpone the deadline of the first byte
+    receiveMessages(policy, 10, 10ms);
+    EXPECT_EQ(policy.getDeadline(), std::pair(START + MAX_LATENCY, FlushReason::MAX_LATENCY));
+
+    /// The first message after the flush starts the latency of the next buffer
+    policy.onFlush(FlushReason::MAX_LATENCY, 50, BUFFER_SIZE);
+    EXPECT_EQ(policy.getDeadline(), std::nullopt);
+    policy.onMessage(START + 1200ms, 0);
+    EXPECT_EQ(policy.getDeadline(), std::pair(START + 1200ms + MAX_LATENCY, FlushReason::MAX_LATENCY));
+}
+
+TEST_F(FlushPolicyTest, StashedBytesStartTheMaxLatency)
+{
+    FlushPolicy policy(1, MAX_LATENCY, false);
+    policy.onStashedBytes(START);
+    /// The next message finds the stashed bytes in the buffer, thus it does not restart the latency
+    policy.onMessage(START + 300ms, 20);
+    EXPECT_EQ(policy.getDeadline(), std::pair(START + MAX_LATENCY, FlushReason::MAX_LATENCY));
+}
+
+TEST_F(FlushPolicyTest, AdaptivePolicyFlushesShortlyAfterABurstEnds)
+{
+    FlushPolicy policy(1, MAX_LATENCY, true);
+    /// The mean inter-arrival time of the burst is 10ms, thus the policy waits 40ms after the last message for the next one
+    const auto lastArrival = receiveMessages(policy, 10, 10ms);
+    EXPECT_EQ(policy.getDeadline(), std::pair(lastArrival + 40ms, FlushReason::IDLE));
+
+    /// Every message of an ongoing burst postpones the deadline
+    policy.onMessage(lastArrival + 10ms, 50);
+    EXPECT_EQ(policy.getDeadline(), std::pair(lastArrival + 50ms, FlushReason::IDLE));
+}
+
+TEST_F(FlushPolicyTest, AdaptivePolicyWaitsForTheMaxLatencyAtLowRates)
+{
+    FlushPolicy policy(1, MAX_LATENCY, true);
+    /// Four times the mean inter-arrival time of 400ms exceed the max latency of the first byte
+    receiveMessages(policy, 2, 400ms);
+    EXPECT_EQ(policy.getDeadline(), std::pair(START + MAX_LATENCY, FlushReason::MAX_LATENCY));
+}
+
+TEST_F(FlushPolicyTest, NonAdaptivePolicyIgnoresTheEndOfABurst)
+{
+    FlushPolicy policy(1, MAX_LATENCY, false);
+    receiveMessages(policy, 10, 10ms);
+    EXPECT_EQ(policy.getDeadline(), std::pair(START + MAX_LATENCY, FlushReason::MAX_LATENCY));
+}
+
+TEST_F(FlushPolicyTest, WeightsTheLatestInterArrivalTimeExponentially)
+{
+    FlushPolicy policy(1, MAX_LATENCY, true);
+    policy.onMessage(START, 0);
+    policy.onMessage(START + 10ms, 5);
+    policy.onMessage(START + 90ms, 10);
+    /// The mean of 10ms moves by an eighth towards the inter-arrival time of 80ms, i.e., to 18.75ms
+    EXPECT_EQ(policy.getDeadline(), std::pair(START + 90ms + 75ms, FlushReason::IDLE));
+}
+
+TEST_F(FlushPolicyTest, CountsTheFlushesPerReasonAndTheirMeanFill)
+{
+    FlushPolicy policy(1, MAX_LATENCY, true);
+    EXPECT_EQ(policy.getMeanFillRatio(), 0.0);
+
+    policy.onFlush(FlushReason::FILL_RATIO, BUFFER_SIZE, BUFFER_SIZE);
+    policy.onFlush(FlushReason::FILL_RATIO, BUFFER_SIZE, BUFFER_SIZE);
+    policy.onFlush(FlushReason::MAX_LATENCY, 25, BUFFER_SIZE);
+    policy.onFlush(FlushReason::IDLE, 50, BUFFER_SIZE);
+    policy.onFlush(FlushReason::STOP, 25, BUFFER_SIZE);
+
+    EXPECT_EQ(policy.getNumberOfFlushes(FlushReason::FILL_RATIO), 2U);
+    EXPECT_EQ(policy.getNumberOfFlushes(FlushReason::MAX_LATENCY), 1U);
+    EXPECT_EQ(policy.getNumberOfFlushes(FlushReason::IDLE), 1U);
+    EXPECT_EQ(policy.getNumberOfFlushes(FlushReason::STOP), 1U);
+    EXPECT_DOUBLE_EQ(policy.getMeanFillRatio(), 0.6);
+
+    std::stringstream policyAsString;
+    policyAsString << policy;
+    EXPECT_EQ(
+        policyAsString.str(),
+        "FlushPolicy(fillRatio: 1, maxLatency: 1000ms, adaptive: 1, meanFill: 0.6, FILL_RATIO: 2, MAX_LATENCY: 1, IDLE: 1, STOP: 1)");
+}
+
+}
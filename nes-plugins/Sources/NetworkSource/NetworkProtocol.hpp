@@ -0,0 +1,216 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <stop_token>
+#include <type_traits>
+#include <vector>
+
+#include <poll.h>
+#include <sys/socket.h>
+
+#ifdef NES_ENABLE_NETWORK_COMPRESSION
+    #include <lz4.h>
+#endif
+
+/// The binary protocol between the NetworkSink of an upstream worker and the NetworkSource of a downstream worker, which stream native
+/// TupleBuffers, i.e., rows in the layout of the schema and their child buffers, without formatting them. Both peers run the same binary,
+/// thus all fields are in the byte order of the host.
+///
+/// The sink connects and sends a Handshake, the source answers with its initial credits. Afterward, the sink sends a frame per buffer:
+/// a FrameHeader, the payload, and per child buffer a ChildHeader followed by the bytes of the child. Every frame spends a credit. The
+/// source returns a credit once the query released the buffer of a frame, thus the sink never has more buffers in flight than the source
+/// admits. A frame with the END_OF_STREAM flag and no payload ends the stream.
+/// A segment, i.e., the payload or a child, is lz4 compressed, iff its size on the wire is below its size.
+namespace NES::NetworkProtocol
+{
+
+constexpr uint32_t MAGIC = 0x4E455354;
+constexpr uint32_t VERSION = 1;
+
+struct Handshake
+{
+    uint32_t magic = MAGIC;
+    uint32_t version = VERSION;
+    /// The source rejects streams whose rows do not match its schema
+    uint64_t tupleSizeInBytes = 0;
+};
+
+enum FrameFlags : uint32_t
+{
+    NONE = 0,
+    END_OF_STREAM = 1,
+};
+
+struct FrameHeader
+{
+    uint32_t magic = MAGIC;
+    uint32_t flags = NONE;
+    /// The metadata of the buffer at the sink. The source stamps its own origin and sequence numbers, like every source does.
+    uint64_t originId = 0;
+    uint64_t sequenceNumber = 0;
+    uint64_t chunkNumber = 0;
+    uint64_t watermark = 0;
+    uint64_t creationTimestamp = 0;
+    uint64_t numberOfTuples = 0;
+    uint32_t payloadSize = 0;
+    uint32_t payloadSizeOnWire = 0;
+    uint32_t numberOfChildBuffers = 0;
+    uint32_t lastChunk = 0;
+};
+
+struct ChildHeader
+{
+    uint32_t size = 0;
+    uint32_t sizeOnWire = 0;
+};
+
+/// The source sends the number of credits it returns to the sink
+using Credits = uint32_t;
+
+static_assert(std::is_trivially_copyable_v<Handshake> and std::is_trivially_copyable_v<FrameHeader>);
+static_assert(std::is_trivially_copyable_v<ChildHeader>);
+
+/// Waiting operations check whether a stop was requested in this interval
+constexpr int POLL_INTERVAL_MS = 100;
+
+#ifdef NES_ENABLE_NETWORK_COMPRESSION
+constexpr bool IS_COMPRESSION_AVAILABLE = true;
+#else
+constexpr bool IS_COMPRESSION_AVAILABLE = false;
+#endif
+
+template <typename T>
+std::span<const std::byte> asBytes(const T& value)
+{
+    return std::as_bytes(std::span(&value, 1));
+}
+
+template <typename T>
+std::span<std::byte> asWritableBytes(T& value)
+{
+    return std::as_writable_bytes(std::span(&value, 1));
+}
+
+/// Sends all bytes. Returns false and leaves errno set, if the connection failed.
+/// @param flags: MSG_MORE, if the caller sends further bytes of the same frame right away
+inline bool sendAll(const int socket, std::span<const std::byte> bytes, const int flags = 0)
+{
+    while (not bytes.empty())
+    {
+        const auto sentBytes = ::send(socket, bytes.data(), bytes.size(), flags | MSG_NOSIGNAL);
+        if (sentBytes < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return false;
+        }
+        bytes = bytes.subspan(static_cast<size_t>(sentBytes));
+    }
+    return true;
+}
+
+enum class ReceiveStatus : uint8_t
+{
+    RECEIVED,
+    /// The peer closed the connection
+    CLOSED,
+    STOPPED,
+    /// errno describes the error
+    FAILED,
+};
+
+/// Blocks until all bytes were received, the connection closed or failed, or a stop was requested
+inline ReceiveStatus receiveAll(const int socket, std::span<std::byte> bytes, const std::stop_token& stopToken)
+{
+    while (not bytes.empty())
+    {
+        if (stopToken.stop_requested())
+        {
+            return ReceiveStatus::STOPPED;
+        }
+        pollfd descriptor{.fd = socket, .events = POLLIN, .revents = 0};
+        const auto ready = ::poll(&descriptor, 1, POLL_INTERVAL_MS);
+        if (ready < 0 and errno != EINTR)
+        {
+            return ReceiveStatus::FAILED;
+        }
+        if (ready <= 0)
+        {
+            continue;
+        }
+        const auto receivedBytes = ::recv(socket, bytes.data(), bytes.size(), 0);
+        if (receivedBytes == 0)
+        {
+            return ReceiveStatus::CLOSED;
+        }
+        if (receivedBytes < 0)
+        {
+            if (errno == EINTR or errno == EAGAIN or errno == EWOULDBLOCK)
+            {
+                continue;
+            }
+            return ReceiveStatus::FAILED;
+        }
+        bytes = bytes.subspan(static_cast<size_t>(receivedBytes));
+    }
+    return ReceiveStatus::RECEIVED;
+}
+
+/// Returns the compressed segment, or nullopt if compressing it does not shrink it, in which case the sink sends it uncompressed
+inline std::optional<std::vector<std::byte>> compress([[maybe_unused]] const std::span<const std::byte> segment)
+{
+#ifdef NES_ENABLE_NETWORK_COMPRESSION
+    std::vector<std::byte> compressed(static_cast<size_t>(LZ4_compressBound(static_cast<int>(segment.size()))));
+    const auto compressedSize = LZ4_compress_default(
+        reinterpret_cast<const char*>(segment.data()),
+        reinterpret_cast<char*>(compressed.data()),
+        static_cast<int>(segment.size()),
+        static_cast<int>(compressed.size()));
+    if (compressedSize <= 0 or static_cast<size_t>(compressedSize) >= segment.size())
+    {
+        return std::nullopt;
+    }
+    compressed.resize(static_cast<size_t>(compressedSize));
+    return compressed;
+#else
+    return std::nullopt;
+#endif
+}
+
+/// Returns false, if the compressed segment does not decompress to exactly the size of the destination
+inline bool
+decompress([[maybe_unused]] const std::span<const std::byte> compressed, [[maybe_unused]] const std::span<std::byte> destination)
+{
+#ifdef NES_ENABLE_NETWORK_COMPRESSION
+    const auto decompressedSize = LZ4_decompress_safe(
+        reinterpret_cast<const char*>(compressed.data()),
+        reinterpret_cast<char*>(destination.data()),
+        static_cast<int>(compressed.size()),
+        static_cast<int>(destination.size()));
+    return decompressedSize >= 0 and static_cast<size_t>(decompressedSize) == destination.size();
+#else
+    return false;
+#endif
+}
+
+}
@@ -0,0 +1,368 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <NetworkSource.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <span>
+#include <stop_token>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <Configurations/Descriptor.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Sources/SourceDescriptor.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <fmt/format.h>
+#include <ErrorHandling.hpp>
+#include <NetworkProtocol.hpp>
+#include <SourceRegistry.hpp>
+#include <SourceValidationRegistry.hpp>
+
+namespace NES
+{
+
+namespace
+{
+std::string describeError(const int error)
+{
+    std::array<char, 256> errorBuffer{};
+    return strerror_r(error, errorBuffer.data(), errorBuffer.size());
+}
+}
+
+void NetworkSource::CreditChannel::returnCredit()
+{
+    const std::scoped_lock lock(mutex);
+    if (socket < 0)
+    {
+        return;
+    }
+    constexpr NetworkProtocol::Credits credit = 1;
+    /// A failed connection fails the next receive of the source, thus the credit is lost together with the connection
+    if (not NetworkProtocol::sendAll(socket, NetworkProtocol::asBytes(credit)))
+    {
+        NES_WARNING("NetworkSource: Could not return a credit: {}", describeError(errno));
+    }
+}
+
+void NetworkSource::CreditChannel::disconnect()
+{
+    const std::scoped_lock lock(mutex);
+    socket = -1;
+}
+
+NetworkSource::NetworkSource(const SourceDescriptor& sourceDescriptor)
+    : host(sourceDescriptor.getFromConfig(ConfigParametersNetworkSource::HOST))
+    , port(std::to_string(sourceDescriptor.getFromConfig(ConfigParametersNetworkSource::PORT)))
+    , numberOfCredits(sourceDescriptor.getFromConfig(ConfigParametersNetworkSource::CREDITS))
+    , tupleSizeInBytes(sourceDescriptor.getLogicalSource().getSchema()->getSizeOfSchemaInBytes())
+{
+    if (const auto parserType = sourceDescriptor.getParserConfig().parserType; parserType != "Native")
+    {
+        throw InvalidConfigParameter("The NetworkSource receives native buffers, thus its parser must be Native, but is {}", parserType);
+    }
+}
+
+void NetworkSource::open()
+{
+    addrinfo hints{};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_flags = AI_PASSIVE;
+    addrinfo* result = nullptr;
+    if (const auto errorCode = getaddrinfo(host.empty() ? nullptr : host.c_str(), port.c_str(), &hints, &result); errorCode != 0)
+    {
+        throw CannotOpenSource("Could not resolve {}:{}: {}", host, port, gai_strerror(errorCode));
+    }
+    const std::unique_ptr<addrinfo, decltype(&freeaddrinfo)> resultGuard(result, freeaddrinfo);
+
+    std::string lastError = "No valid address found to create socket.";
+    for (const auto* address = result; address != nullptr; address = address->ai_next)
+    {
+        listeningSocket = ::socket(address->ai_family, address->ai_socktype | SOCK_NONBLOCK | SOCK_CLOEXEC, address->ai_protocol);
+        if (listeningSocket == -1)
+        {
+            continue;
+        }
+        constexpr int enable = 1;
+        if (setsockopt(listeningSocket, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable)) == 0
+            and bind(listeningSocket, address->ai_addr, address->ai_addrlen) == 0 and listen(listeningSocket, 1) == 0)
+        {
+            NES_DEBUG("NetworkSource::open: Listening on {}:{}.", host, port);
+            return;
+        }
+        lastError = describeError(errno);
+        ::close(listeningSocket);
+        listeningSocket = -1;
+    }
+    throw CannotOpenSource("Could not listen on {}:{}: {}", host, port, lastError);
+}
+
+void NetworkSource::close()
+{
+    if (creditChannel)
+    {
+        creditChannel->disconnect();
+        creditChannel.reset();
+    }
+    for (auto* const descriptor : {&socket, &listeningSocket})
+    {
+        if (*descriptor >= 0)
+        {
+            ::close(*descriptor);
+            *descriptor = -1;
+        }
+    }
+    NES_DEBUG("NetworkSource::close: Received {} buffers with {} bytes.", numberOfReceivedBuffers, numberOfReceivedBytes);
+}
+
+bool NetworkSource::receive(const std::span<std::byte> bytes, const std::stop_token& stopToken)
+{
+    switch (NetworkProtocol::receiveAll(socket, bytes, stopToken))
+    {
+        case NetworkProtocol::ReceiveStatus::RECEIVED:
+            return true;
+        case NetworkProtocol::ReceiveStatus::CLOSED:
+            NES_DEBUG("NetworkSource: The sink closed the connection to {}:{}.", host, port);
+            return false;
+        case NetworkProtocol::ReceiveStatus::STOPPED:
+            return false;
+        case NetworkProtocol::ReceiveStatus::FAILED:
+            throw RunningRoutineFailure("Could not receive from the sink at {}:{}: {}", host, port, describeError(errno));
+    }
+    std::unreachable();
+}
+
+bool NetworkSource::acceptSink(const std::stop_token& stopToken)
+{
+    while (socket < 0)
+    {
+        if (stopToken.stop_requested())
+        {
+            return false;
+        }
+        pollfd descriptor{.fd = listeningSocket, .events = POLLIN, .revents = 0};
+        if (::poll(&descriptor, 1, NetworkProtocol::POLL_INTERVAL_MS) <= 0)
+        {
+            continue;
+        }
+        socket = accept4(listeningSocket, nullptr, nullptr, SOCK_CLOEXEC);
+        if (socket < 0 and errno != EAGAIN and errno != EWOULDBLOCK and errno != EINTR and errno != ECONNABORTED)
+        {
+            throw RunningRoutineFailure("Could not accept a sink on {}:{}: {}", host, port, describeError(errno));
+        }
+    }
+    ::close(listeningSocket);
+    listeningSocket = -1;
+    /// The credits are tiny messages, which must not wait for more data
+    constexpr int enable = 1;
+    setsockopt(socket, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+
+    NetworkProtocol::Handshake handshake;
+    if (not receive(NetworkProtocol::asWritableBytes(handshake), stopToken))
+    {
+        return false;
+    }
+    if (handshake.magic != NetworkProtocol::MAGIC or handshake.version != NetworkProtocol::VERSION)
+    {
+        throw RunningRoutineFailure(
+            "The peer at {}:{} does not speak version {} of the network protocol", host, port, NetworkProtocol::VERSION);
+    }
+    if (handshake.tupleSizeInBytes != tupleSizeInBytes)
+    {
+        throw RunningRoutineFailure(
+            "The sink at {}:{} sends tuples of {} bytes, but the schema of the source has {} bytes",
+            host,
+            port,
+            handshake.tupleSizeInBytes,
+            tupleSizeInBytes);
+    }
+    if (not NetworkProtocol::sendAll(socket, NetworkProtocol::asBytes(numberOfCredits)))
+    {
+        throw RunningRoutineFailure("Could not send the credits to the sink at {}:{}: {}", host, port, describeError(errno));
+    }
+    creditChannel = std::make_shared<CreditChannel>();
+    creditChannel->socket = socket;
+    NES_DEBUG("NetworkSource: Accepted a sink on {}:{} with {} credits.", host, port, numberOfCredits);
+    return true;
+}
+
+bool NetworkSource::receiveSegment(const std::span<std::byte> destination, const size_t sizeOnWire, const std::stop_token& stopToken)
+{
+    if (sizeOnWire == destination.size())
+    {
+        return receive(destination, stopToken);
+    }
+    if (not NetworkProtocol::IS_COMPRESSION_AVAILABLE or sizeOnWire > destination.size())
+    {
+        throw RunningRoutineFailure("The sink at {}:{} sent a compressed segment, which the source cannot decompress", host, port);
+    }
+    std::vector<std::byte> compressed(sizeOnWire);
+    if (not receive(compressed, stopToken))
+    {
+        return false;
+    }
+    if (not NetworkProtocol::decompress(compressed, destination))
+    {
+        throw RunningRoutineFailure("The sink at {}:{} sent a corrupt compressed segment", host, port);
+    }
+    return true;
+}
+
+std::optional<TupleBuffer> NetworkSource::receiveBuffer(
+    const uint32_t size, const uint32_t sizeOnWire, const std::stop_token& stopToken, std::function<void()> onRelease)
+{
+    auto memory = std::make_unique<uint8_t[]>(std::max<size_t>(size, 1));
+    auto buffer = TupleBuffer::wrapMemory(
+        memory.get(),
+        size,
+        [memory = memory.get(), onRelease = std::move(onRelease)]
+        {
+            delete[] memory;
+            if (onRelease)
+            {
+                onRelease();
+            }
+        });
+    memory.release();
+    if (not receiveSegment(buffer.getAvailableMemoryArea<std::byte>(), sizeOnWire, stopToken))
+    {
+        return std::nullopt;
+    }
+    numberOfReceivedBytes += sizeOnWire;
+    return buffer;
+}
+
+std::optional<TupleBuffer> NetworkSource::provideTupleBuffer(const std::stop_token& stopToken)
+{
+    if (socket < 0 and not acceptSink(stopToken))
+    {
+        return std::nullopt;
+    }
+
+    NetworkProtocol::FrameHeader header;
+    if (not receive(NetworkProtocol::asWritableBytes(header), stopToken))
+    {
+        return std::nullopt;
+    }
+    if (header.magic != NetworkProtocol::MAGIC)
+    {
+        throw RunningRoutineFailure("The sink at {}:{} sent a corrupt frame", host, port);
+    }
+    if ((header.flags & NetworkProtocol::END_OF_STREAM) != 0)
+    {
+        NES_DEBUG("NetworkSource: The sink at {}:{} ended the stream.", host, port);
+        /// The sink closes the connection after ending the stream, thus the credits of the remaining buffers are not returned
+        creditChannel->disconnect();
+        return std::nullopt;
+    }
+    if (header.payloadSize != header.numberOfTuples * tupleSizeInBytes)
+    {
+        throw RunningRoutineFailure(
+            "The sink at {}:{} sent {} bytes for {} tuples of {} bytes",
+            host,
+            port,
+            header.payloadSize,
+            header.numberOfTuples,
+            tupleSizeInBytes);
+    }
+
+    /// Once the query released the payload and thereby its children, the source returns the credit of the frame to the sink
+    auto payload = receiveBuffer(
+        header.payloadSize, header.payloadSizeOnWire, stopToken, [creditChannel = this->creditChannel] { creditChannel->returnCredit(); });
+    if (not payload)
+    {
+        return std::nullopt;
+    }
+    /// The child buffers keep their order, thus the indices in the var-sized fields of the rows refer to the same children as at the sink
+    for (uint32_t child = 0; child < header.numberOfChildBuffers; ++child)
+    {
+        NetworkProtocol::ChildHeader childHeader;
+        if (not receive(NetworkProtocol::asWritableBytes(childHeader), stopToken))
+        {
+            return std::nullopt;
+        }
+        auto childBuffer = receiveBuffer(childHeader.size, childHeader.sizeOnWire, stopToken);
+        if (not childBuffer)
+        {
+            return std::nullopt;
+        }
+        childBuffer->setNumberOfTuples(childHeader.size);
+        [[maybe_unused]] const auto index = payload->storeChildBuffer(childBuffer.value());
+    }
+    ++numberOfReceivedBuffers;
+    NES_TRACE(
+        "NetworkSource: Received buffer {} of origin {} with {} tuples from {}:{}.",
+        header.sequenceNumber,
+        header.originId,
+        header.numberOfTuples,
+        host,
+        port);
+
+    return payload;
+}
+
+size_t NetworkSource::fillTupleBuffer(TupleBuffer&, const std::stop_token&)
+{
+    throw NotImplemented("The NetworkSource solely provides its own TupleBuffers");
+}
+
+DescriptorConfig::Config NetworkSource::validateAndFormat(std::unordered_map<std::string, std::string> config)
+{
+    return DescriptorConfig::validateAndFormat<ConfigParametersNetworkSource>(std::move(config), NAME);
+}
+
+std::ostream& NetworkSource::toString(std::ostream& str) const
+{
+    str << fmt::format(
+        "\nNetworkSource(host: {}, port: {}, credits: {}, receivedBuffers: {}, receivedBytes: {})",
+        host,
+        port,
+        numberOfCredits,
+        numberOfReceivedBuffers,
+        numberOfReceivedBytes);
+    return str;
+}
+
+SourceValidationRegistryReturnType RegisterNetworkSourceValidation(SourceValidationRegistryArguments sourceConfig)
+{
+    return NetworkSource::validateAndFormat(std::move(sourceConfig.config));
+}
+
+SourceRegistryReturnType SourceGeneratedRegistrar::RegisterNetworkSource(SourceRegistryArguments sourceRegistryArguments)
+{
+    return std::make_unique<NetworkSource>(sourceRegistryArguments.sourceDescriptor);
+}
+
+}
@@ -0,0 +1,144 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <span>
+#include <stop_token>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <Configurations/Descriptor.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Sources/Source.hpp>
+#include <Sources/SourceDescriptor.hpp>
+#include <Util/Logger/Logger.hpp>
+
+namespace NES
+{
+
+/// Receives the native TupleBuffers, which the NetworkSink of an upstream worker streams to 'network_host':'network_port', c.f.,
+/// NetworkProtocol.hpp. The source listens once it opens and accepts a single sink once the ingestion starts.
+/// The source hands every received buffer, including its child buffers, to its successors without formatting it, thus its parser must be
+/// 'Native'. The sink may have at most 'network_credits' buffers in flight, i.e., sent but not yet released by the query at this worker.
+/// Thus, a slow downstream query backpressures the upstream query instead of the source buffering an unbounded number of buffers.
+class NetworkSource final : public Source
+{
+public:
+    static constexpr std::string_view NAME = "Network";
+
+    explicit NetworkSource(const SourceDescriptor& sourceDescriptor);
+    ~NetworkSource() override = default;
+
+    NetworkSource(const NetworkSource&) = delete;
+    NetworkSource& operator=(const NetworkSource&) = delete;
+    NetworkSource(NetworkSource&&) = delete;
+    NetworkSource& operator=(NetworkSource&&) = delete;
+
+    /// The source solely provides its own TupleBuffers
+    size_t fillTupleBuffer(TupleBuffer& tupleBuffer, const std::stop_token& stopToken) override;
+
+    [[nodiscard]] bool providesTupleBuffers() const override { return true; }
+    /// Returns the buffer of the next frame. Returns nullopt at the end of the stream or if a stop was requested while waiting for it.
+    std::optional<TupleBuffer> provideTupleBuffer(const std::stop_token& stopToken) override;
+
+    void open() override;
+    void close() override;
+
+    static DescriptorConfig::Config validateAndFormat(std::unordered_map<std::string, std::string> config);
+
+    [[nodiscard]] std::ostream& toString(std::ostream& str) const override;
+
+private:
+    /// Returns the credits of the released buffers to the sink. Shared with the TupleBuffers of the source, which may outlive the
+    /// connection.
+    struct CreditChannel
+    {
+        std::mutex mutex;
+        int socket = -1;
+        void returnCredit();
+        void disconnect();
+    };
+
+    /// Blocks until a sink connected and its tuple size matches the schema. Returns false if a stop was requested before.
+    bool acceptSink(const std::stop_token& stopToken);
+    /// Throws, if the connection failed. Returns false, if the sink closed the connection or a stop was requested.
+    bool receive(std::span<std::byte> bytes, const std::stop_token& stopToken);
+    /// Receives a segment of 'size' bytes, which are compressed if they are fewer on the wire, into the destination
+    bool receiveSegment(std::span<std::byte> destination, size_t sizeOnWire, const std::stop_token& stopToken);
+    /// Receives a segment into an allocation of its own and wraps it as TupleBuffer, which calls 'onRelease' once it is released
+    std::optional<TupleBuffer>
+    receiveBuffer(uint32_t size, uint32_t sizeOnWire, const std::stop_token& stopToken, std::function<void()> onRelease = {});
+
+    std::string host;
+    std::string port;
+    uint32_t numberOfCredits;
+    size_t tupleSizeInBytes;
+
+    int listeningSocket = -1;
+    int socket = -1;
+    std::shared_ptr<CreditChannel> creditChannel;
+
+    uint64_t numberOfReceivedBuffers{0};
+    uint64_t numberOfReceivedBytes{0};
+};
+
+struct ConfigParametersNetworkSource
+{
+    /// Listens on all interfaces, if empty
+    static inline const DescriptorConfig::ConfigParameter<std::string> HOST{
+        "network_host",
+        "",
+        [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(HOST, config); }};
+
+    static inline const DescriptorConfig::ConfigParameter<uint32_t> PORT{
+        "network_port",
+        std::nullopt,
+        [](const std::unordered_map<std::string, std::string>& config) -> std::optional<uint32_t>
+        {
+            const auto port = DescriptorConfig::tryGet(PORT, config);
+            if (port.has_value() and (port.value() == 0 or port.value() > UINT16_MAX))
+            {
+                NES_ERROR("NetworkSource port is {}, but must be between 1 and {}", port.value(), UINT16_MAX);
+                return std::nullopt;
+            }
+            return port;
+        }};
+
+    static inline const DescriptorConfig::ConfigParameter<uint32_t> CREDITS{
+        "network_credits",
+        64,
+        [](const std::unordered_map<std::string, std::string>& config) -> std::optional<uint32_t>
+        {
+            const auto credits = DescriptorConfig::tryGet(CREDITS, config);
+            if (credits.has_value() and credits.value() == 0)
+            {
+                NES_ERROR("NetworkSource requires at least one credit");
+                return std::nullopt;
+            }
+            return credits;
+        }};
+
+    static inline std::unordered_map<std::string, DescriptorConfig::ConfigParameterContainer> parameterMap
+        = DescriptorConfig::createConfigParameterContainerMap(SourceDescriptor::parameterMap, HOST, PORT, CREDITS);
+};
+
+}
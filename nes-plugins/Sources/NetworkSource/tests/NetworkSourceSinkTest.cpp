@@ -0,0 +1,370 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+#include <stop_token>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/DataTypeProvider.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Identifiers/Identifiers.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Sinks/SinkCatalog.hpp>
+#include <Sources/LogicalSource.hpp>
+#include <Sources/SourceCatalog.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+#include <ErrorHandling.hpp>
+#include <NetworkProtocol.hpp>
+#include <NetworkSink.hpp>
+#include <NetworkSource.hpp>
+#include <TestTaskQueue.hpp>
+
+namespace NES
+{
+
+namespace
+{
+/// A buffer as the source received it, copied, so that the receiver can release the buffer and thereby return its credit
+struct ReceivedBuffer
+{
+    std::vector<uint64_t> rows;
+    std::vector<std::vector<std::byte>> children;
+};
+
+/// Binds an ephemeral port on the loopback interface and releases it, thus the source of a test can listen on it afterward
+uint16_t findUnusedPort()
+{
+    const auto probingSocket = ::socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = 0;
+    socklen_t addressLength = sizeof(address);
+    const auto bound = ::bind(probingSocket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0
+        and ::getsockname(probingSocket, reinterpret_cast<sockaddr*>(&address), &addressLength) == 0;
+    ::close(probingSocket);
+    INVARIANT(bound, "Could not find an unused port");
+    return ntohs(address.sin_port);
+}
+
+/// Connects a raw socket to the source, which plays a faulty sink
+int connectToSource(const uint16_t port)
+{
+    const auto peerSocket = ::socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = htons(port);
+    INVARIANT(
+        ::connect(peerSocket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0, "Could not connect to the source on {}", port);
+    return peerSocket;
+}
+}
+
+class NetworkSourceSinkTest : public Testing::BaseUnitTest
+{
+public:
+    static constexpr uint64_t NUMBER_OF_FIELDS = 2;
+
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("NetworkSourceSinkTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup NetworkSourceSinkTest test class.");
+    }
+
+    void SetUp() override
+    {
+        BaseUnitTest::SetUp();
+        schema.addField("id", DataTypeProvider::provideDataType(DataType::Type::UINT64));
+        schema.addField("value", DataTypeProvider::provideDataType(DataType::Type::UINT64));
+        logicalSource = sourceCatalog.addLogicalSource("testSource", schema);
+        ASSERT_TRUE(logicalSource.has_value());
+        port = findUnusedPort();
+    }
+
+    std::unique_ptr<NetworkSource> createSource(const uint32_t numberOfCredits)
+    {
+        const auto descriptor = sourceCatalog.addPhysicalSource(
+            logicalSource.value(),
+            "Network",
+            {{"network_host", "127.0.0.1"}, {"network_port", std::to_string(port)}, {"network_credits", std::to_string(numberOfCredits)}},
+            {{"type", "Native"}});
+        EXPECT_TRUE(descriptor.has_value());
+        return std::make_unique<NetworkSource>(descriptor.value());
+    }
+
+    std::unique_ptr<NetworkSink> createSink()
+    {
+        const auto descriptor = sinkCatalog.addSinkDescriptor(
+            "networkSink",
+            schema,
+            "Network",
+            {{"network_host", "127.0.0.1"}, {"network_port", std::to_string(port)}, {"connect_timeout_seconds", "5"}});
+        EXPECT_TRUE(descriptor.has_value());
+        return std::make_unique<NetworkSink>(descriptor.value());
+    }
+
+    /// Buffer 'index' contains the rows (index, 0), (index, 1), ..., and every third buffer carries a child buffer with var-sized bytes
+    TupleBuffer createBuffer(const uint64_t index, const uint64_t numberOfTuples) const
+    {
+        auto buffer = bufferManager->getBufferBlocking();
+        const auto rows = buffer.getAvailableMemoryArea<uint64_t>();
+        for (uint64_t tuple = 0; tuple < numberOfTuples; ++tuple)
+        {
+            rows[(tuple * NUMBER_OF_FIELDS)] = index;
+            rows[(tuple * NUMBER_OF_FIELDS) + 1] = tuple;
+        }
+        buffer.setNumberOfTuples(numberOfTuples);
+        buffer.setSequenceNumber(SequenceNumber(index + 1));
+        if (index % 3 == 0)
+        {
+            auto child = bufferManager->getUnpooledBuffer(index + 1).value();
+            const auto bytes = child.getAvailableMemoryArea<std::byte>();
+            for (uint64_t byte = 0; byte <= index; ++byte)
+            {
+                bytes[byte] = static_cast<std::byte>(index + byte);
+            }
+            /// Child buffers store the number of their used bytes as their number of tuples
+            child.setNumberOfTuples(index + 1);
+            [[maybe_unused]] const auto childIndex = buffer.storeChildBuffer(child);
+        }
+        return buffer;
+    }
+
+    static ReceivedBuffer copyReceivedBuffer(const TupleBuffer& buffer)
+    {
+        ReceivedBuffer received;
+        const auto rows = buffer.getAvailableMemoryArea<uint64_t>().first(buffer.getNumberOfTuples() * NUMBER_OF_FIELDS);
+        received.rows.assign(rows.begin(), rows.end());
+        for (uint32_t child = 0; child < buffer.getNumberOfChildBuffers(); ++child)
+        {
+            const auto childBuffer = buffer.loadChildBuffer(VariableSizedAccess::Index{child});
+            const auto bytes = childBuffer.getAvailableMemoryArea<std::byte>().first(childBuffer.getNumberOfTuples());
+            received.children.emplace_back(bytes.begin(), bytes.end());
+        }
+        return received;
+    }
+
+    /// Receives until the stream ends and releases every buffer right away, thus the credits flow back to the sink
+    static std::vector<ReceivedBuffer> receiveAll(NetworkSource& source)
+    {
+        std::vector<ReceivedBuffer> receivedBuffers;
+        while (const auto buffer = source.provideTupleBuffer(std::stop_token{}))
+        {
+            receivedBuffers.emplace_back(copyReceivedBuffer(buffer.value()));
+        }
+        return receivedBuffers;
+    }
+
+    /// Executes the sink like the task queue does, i.e., repeats the task of the buffer until the sink had a credit for it
+    /// @return the number of times that the sink repeated the task
+    static size_t executeUntilSent(NetworkSink& sink, TestPipelineExecutionContext& pipelineExecutionContext, const TupleBuffer& buffer)
+    {
+        size_t numberOfRepetitions = 0;
+        bool isRepeated = true;
+        pipelineExecutionContext.setRepeatTaskCallback([&isRepeated] { isRepeated = true; });
+        while (isRepeated)
+        {
+            isRepeated = false;
+            sink.execute(buffer, pipelineExecutionContext);
+            if (isRepeated)
+            {
+                ++numberOfRepetitions;
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+        return numberOfRepetitions;
+    }
+
+    void expectBuffer(const ReceivedBuffer& received, const uint64_t index, const uint64_t numberOfTuples) const
+    {
+        const auto expected = copyReceivedBuffer(createBuffer(index, numberOfTuples));
+        EXPECT_EQ(received.rows, expected.rows) << "buffer " << index;
+        EXPECT_EQ(received.children, expected.children) << "buffer " << index;
+    }
+
+    Schema schema;
+    SourceCatalog sourceCatalog;
+    SinkCatalog sinkCatalog;
+    std::optional<LogicalSource> logicalSource;
+    std::shared_ptr<BufferManager> bufferManager = BufferManager::create();
+    uint16_t port = 0;
+};
+
+/// clang tidy doesn't recognize the .has_value in the ASSERT_TRUE
+/// NOLINTBEGIN(bugprone-unchecked-optional-access)
+TEST_F(NetworkSourceSinkTest, BuffersArriveCompleteAndInOrder)
+{
+    constexpr uint64_t numberOfBuffers = 100;
+    constexpr uint64_t numberOfTuples = 17;
+    /// Far fewer credits than buffers, thus the sink must wait for the source to return credits
+    auto source = createSource(4);
+    auto sink = createSink();
+    TestPipelineExecutionContext pipelineExecutionContext;
+
+    source->open();
+    std::vector<ReceivedBuffer> receivedBuffers;
+    std::thread receiver([&] { receivedBuffers = receiveAll(*source); });
+    sink->start(pipelineExecutionContext);
+    for (uint64_t index = 0; index < numberOfBuffers; ++index)
+    {
+        executeUntilSent(*sink, pipelineExecutionContext, createBuffer(index, numberOfTuples));
+    }
+    /// The sink skips empty buffers instead of spending a credit on them
+    executeUntilSent(*sink, pipelineExecutionContext, createBuffer(numberOfBuffers, 0));
+    sink->stop(pipelineExecutionContext);
+    receiver.join();
+    source->close();
+
+    ASSERT_EQ(receivedBuffers.size(), numberOfBuffers);
+    for (uint64_t index = 0; index < numberOfBuffers; ++index)
+    {
+        expectBuffer(receivedBuffers[index], index, numberOfTuples);
+    }
+}
+
+TEST_F(NetworkSourceSinkTest, SinkBackpressuresUntilTheSourceReleasesBuffers)
+{
+    constexpr uint64_t numberOfTuples = 5;
+    auto source = createSource(2);
+    auto sink = createSink();
+    TestPipelineExecutionContext pipelineExecutionContext;
+
+    source->open();
+    sink->start(pipelineExecutionContext);
+    /// The source accepts the sink and grants its credits on the first call
+    std::optional<TupleBuffer> firstBuffer;
+    std::thread receiver([&] { firstBuffer = source->provideTupleBuffer(std::stop_token{}); });
+    executeUntilSent(*sink, pipelineExecutionContext, createBuffer(0, numberOfTuples));
+    receiver.join();
+    executeUntilSent(*sink, pipelineExecutionContext, createBuffer(1, numberOfTuples));
+    auto secondBuffer = source->provideTupleBuffer(std::stop_token{});
+    ASSERT_TRUE(firstBuffer.has_value());
+    ASSERT_TRUE(secondBuffer.has_value());
+
+    /// The query holds both buffers, thus the sink spent all credits and repeats the task of the third buffer
+    bool isRepeated = false;
+    pipelineExecutionContext.setRepeatTaskCallback([&isRepeated] { isRepeated = true; });
+    sink->execute(createBuffer(2, numberOfTuples), pipelineExecutionContext);
+    EXPECT_TRUE(isRepeated);
+
+    /// Releasing a buffer returns its credit
+    expectBuffer(copyReceivedBuffer(firstBuffer.value()), 0, numberOfTuples);
+    firstBuffer.reset();
+    executeUntilSent(*sink, pipelineExecutionContext, createBuffer(2, numberOfTuples));
+    const auto thirdBuffer = source->provideTupleBuffer(std::stop_token{});
+    ASSERT_TRUE(thirdBuffer.has_value());
+    expectBuffer(copyReceivedBuffer(secondBuffer.value()), 1, numberOfTuples);
+    expectBuffer(copyReceivedBuffer(thirdBuffer.value()), 2, numberOfTuples);
+
+    sink->stop(pipelineExecutionContext);
+    EXPECT_FALSE(source->provideTupleBuffer(std::stop_token{}).has_value());
+    source->close();
+}
+
+TEST_F(NetworkSourceSinkTest, SinkConnectsOnceTheSourceListens)
+{
+    auto source = createSource(4);
+    auto sink = createSink();
+    TestPipelineExecutionContext pipelineExecutionContext;
+
+    /// The downstream worker starts its query after the upstream worker, thus the sink retries until the source listens
+    std::thread starter([&] { sink->start(pipelineExecutionContext); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    source->open();
+    std::vector<ReceivedBuffer> receivedBuffers;
+    std::thread receiver([&] { receivedBuffers = receiveAll(*source); });
+    starter.join();
+
+    executeUntilSent(*sink, pipelineExecutionContext, createBuffer(0, 3));
+    sink->stop(pipelineExecutionContext);
+    receiver.join();
+    source->close();
+
+    ASSERT_EQ(receivedBuffers.size(), 1);
+    expectBuffer(receivedBuffers.front(), 0, 3);
+}
+
+TEST_F(NetworkSourceSinkTest, SinkDisconnectingWithoutEndOfStreamEndsTheStream)
+{
+    auto source = createSource(4);
+    source->open();
+
+    /// The peer disconnects in the middle of a frame, e.g., because its worker crashed
+    std::thread peer(
+        [port = this->port, tupleSize = schema.getSizeOfSchemaInBytes()]
+        {
+            const auto peerSocket = connectToSource(port);
+            const NetworkProtocol::Handshake handshake{.tupleSizeInBytes = tupleSize};
+            NetworkProtocol::Credits credits = 0;
+            const NetworkProtocol::FrameHeader header{.numberOfTuples = 1, .payloadSize = static_cast<uint32_t>(tupleSize)};
+            EXPECT_TRUE(NetworkProtocol::sendAll(peerSocket, NetworkProtocol::asBytes(handshake)));
+            EXPECT_EQ(
+                NetworkProtocol::receiveAll(peerSocket, NetworkProtocol::asWritableBytes(credits), std::stop_token{}),
+                NetworkProtocol::ReceiveStatus::RECEIVED);
+            EXPECT_EQ(credits, 4U);
+            EXPECT_TRUE(NetworkProtocol::sendAll(peerSocket, NetworkProtocol::asBytes(header).first(sizeof(header) / 2)));
+            ::close(peerSocket);
+        });
+    /// The source ends the stream instead of waiting for the rest of the frame forever
+    EXPECT_FALSE(source->provideTupleBuffer(std::stop_token{}).has_value());
+    peer.join();
+    source->close();
+}
+
+TEST_F(NetworkSourceSinkTest, SourceRejectsSinkWithDifferentSchema)
+{
+    auto source = createSource(4);
+    source->open();
+
+    std::thread peer(
+        [port = this->port, tupleSize = schema.getSizeOfSchemaInBytes()]
+        {
+            const auto peerSocket = connectToSource(port);
+            const NetworkProtocol::Handshake handshake{.tupleSizeInBytes = tupleSize + 1};
+            EXPECT_TRUE(NetworkProtocol::sendAll(peerSocket, NetworkProtocol::asBytes(handshake)));
+            /// Waits until the source closes the connection, i.e., rejected the sink
+            NetworkProtocol::Credits credits = 0;
+            EXPECT_NE(
+                NetworkProtocol::receiveAll(peerSocket, NetworkProtocol::asWritableBytes(credits), std::stop_token{}),
+                NetworkProtocol::ReceiveStatus::RECEIVED);
+            ::close(peerSocket);
+        });
+    ASSERT_EXCEPTION_ERRORCODE(auto buffer = source->provideTupleBuffer(std::stop_token{}), ErrorCode::RunningRoutineFailure);
+    source->close();
+    peer.join();
+}
+/// NOLINTEND(bugprone-unchecked-optional-access)
+
+}
@@ -0,0 +1,306 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <ReplaySource.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <ios>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <stop_token>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <Configurations/Descriptor.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Sources/SourceDescriptor.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Strings.hpp>
+#include <fmt/format.h>
+#include <ErrorHandling.hpp>
+#include <FileDataRegistry.hpp>
+#include <InlineDataRegistry.hpp>
+#include <SourceRegistry.hpp>
+#include <SourceValidationRegistry.hpp>
+
+namespace NES
+{
+
+namespace
+{
+/// Sleeping overshoots the deadline by up to a scheduler time slice, thus the source sleeps until this long before the deadline and spins
+constexpr auto SPIN_DURATION = std::chrono::microseconds(200);
+
+std::string_view getField(std::string_view tuple, const std::string_view fieldDelimiter, const size_t fieldIdx)
+{
+    for (size_t idx = 0; idx < fieldIdx; ++idx)
+    {
+        const auto endOfField = tuple.find(fieldDelimiter);
+        if (endOfField == std::string_view::npos)
+        {
+            return {};
+        }
+        tuple.remove_prefix(endOfField + fieldDelimiter.size());
+    }
+    return tuple.substr(0, tuple.find(fieldDelimiter));
+}
+}
+
+ReplaySource::ReplaySource(const SourceDescriptor& sourceDescriptor)
+    : filePath(sourceDescriptor.getFromConfig(ConfigParametersReplay::FILE_PATH))
+    , replayMode(sourceDescriptor.getFromConfig(ConfigParametersReplay::REPLAY_MODE))
+    , tuplesPerSecond(sourceDescriptor.getFromConfig(ConfigParametersReplay::TUPLES_PER_SECOND))
+    , speedup(sourceDescriptor.getFromConfig(ConfigParametersReplay::SPEEDUP))
+    , chunkSize(sourceDescriptor.getFromConfig(ConfigParametersReplay::CHUNK_SIZE))
+    , flushInterval(std::chrono::milliseconds{sourceDescriptor.getFromConfig(ConfigParametersReplay::FLUSH_INTERVAL_MS)})
+    , tupleDelimiter(sourceDescriptor.getParserConfig().tupleDelimiter)
+    , fieldDelimiter(sourceDescriptor.getParserConfig().fieldDelimiter)
+{
+    if (tupleDelimiter.empty())
+    {
+        throw InvalidConfigParameter("The ReplaySource requires a tuple delimiter to determine the tuples it paces");
+    }
+    if (replayMode != ReplayMode::EVENT_TIME)
+    {
+        return;
+    }
+
+    const auto timestampFieldName = sourceDescriptor.getFromConfig(ConfigParametersReplay::TIMESTAMP_FIELD);
+    const auto schema = sourceDescriptor.getLogicalSource().getSchema();
+    for (const auto& field : *schema)
+    {
+        if (field.getUnqualifiedName() == timestampFieldName)
+        {
+            return;
+        }
+        ++timestampFieldIdx;
+    }
+    throw InvalidConfigParameter(
+        "The EVENT_TIME mode of the ReplaySource requires a replay_timestamp_field of the schema, but got '{}'", timestampFieldName);
+}
+
+void ReplaySource::open()
+{
+    std::ifstream inputFile(filePath, std::ios::binary);
+    if (not inputFile)
+    {
+        throw InvalidConfigParameter("Could not open file: {} - {}", filePath, std::strerror(errno));
+    }
+    fileContent = std::make_shared<std::vector<char>>(std::filesystem::file_size(filePath));
+    if (not inputFile.read(fileContent->data(), static_cast<std::streamsize>(fileContent->size())))
+    {
+        throw CannotOpenSource("Could not read the file {} into memory", filePath);
+    }
+    computeChunks();
+    nextChunkIdx = 0;
+    replayStart.reset();
+    NES_DEBUG("ReplaySource preloaded {} bytes in {} chunks from {}", fileContent->size(), chunks.size(), filePath);
+}
+
+void ReplaySource::computeChunks()
+{
+    chunks.clear();
+    const std::string_view content(fileContent->data(), fileContent->size());
+    std::optional<uint64_t> firstTimestamp;
+    std::chrono::nanoseconds deadline{0};
+    std::optional<Chunk> currentChunk;
+    std::chrono::nanoseconds deadlineOfFirstTupleInChunk{0};
+
+    size_t tupleIdx = 0;
+    for (size_t offset = 0; offset < content.size(); ++tupleIdx)
+    {
+        const auto endOfTuple = content.find(tupleDelimiter, offset);
+        const auto tuple = content.substr(offset, endOfTuple == std::string_view::npos ? std::string_view::npos : endOfTuple - offset);
+        const auto tupleSizeInBytes = std::min(tuple.size() + tupleDelimiter.size(), content.size() - offset);
+
+        if (replayMode == ReplayMode::FIXED_RATE)
+        {
+            deadline = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::duration<double>(static_cast<double>(tupleIdx) / tuplesPerSecond));
+        }
+        else if (not tuple.empty())
+        {
+            const auto timestamp = Util::from_chars<uint64_t>(getField(tuple, fieldDelimiter, timestampFieldIdx));
+            if (not timestamp.has_value())
+            {
+                throw CannotOpenSource("Could not parse the timestamp of the tuple '{}' in {}", tuple, filePath);
+            }
+            firstTimestamp = firstTimestamp.value_or(timestamp.value());
+            /// Out-of-order tuples are replayed as soon as possible, because the file determines the order of the tuples
+            const auto millisecondsSinceFirstTuple
+                = static_cast<double>(timestamp.value() - std::min(timestamp.value(), firstTimestamp.value())) / speedup;
+            deadline = std::max(
+                deadline,
+                std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::duration<double, std::milli>(millisecondsSinceFirstTuple)));
+        }
+
+        if (currentChunk.has_value()
+            and (currentChunk->sizeInBytes + tupleSizeInBytes > chunkSize or deadline - deadlineOfFirstTupleInChunk > flushInterval))
+        {
+            chunks.emplace_back(currentChunk.value());
+            currentChunk.reset();
+        }
+        if (not currentChunk.has_value())
+        {
+            currentChunk = Chunk{.offset = offset, .sizeInBytes = 0, .deadline = deadline};
+            deadlineOfFirstTupleInChunk = deadline;
+        }
+        currentChunk->sizeInBytes += tupleSizeInBytes;
+        currentChunk->deadline = deadline;
+        offset += tupleSizeInBytes;
+    }
+    if (currentChunk.has_value())
+    {
+        chunks.emplace_back(currentChunk.value());
+    }
+}
+
+void ReplaySource::close()
+{
+    NES_DEBUG("ReplaySource replayed {} of {} chunks, {} of them late", nextChunkIdx, chunks.size(), numberOfLateChunks);
+    chunks.clear();
+    /// TupleBuffers that still wrap chunks keep the content alive
+    fileContent.reset();
+}
+
+size_t ReplaySource::fillTupleBuffer(TupleBuffer&, const std::stop_token&)
+{
+    INVARIANT(false, "The ReplaySource provides its own TupleBuffers");
+    return 0;
+}
+
+bool ReplaySource::providesTupleBuffers() const
+{
+    return true;
+}
+
+std::optional<TupleBuffer> ReplaySource::provideTupleBuffer(const std::stop_token& stopToken)
+{
+    if (nextChunkIdx == chunks.size())
+    {
+        return std::nullopt;
+    }
+    /// The replay starts with the first request for a chunk, thus preloading the file does not delay the first chunks
+    const auto start = replayStart.value_or(std::chrono::steady_clock::now());
+    replayStart = start;
+
+    const auto& chunk = chunks[nextChunkIdx];
+    const auto deadline = start + chunk.deadline;
+    if (std::chrono::steady_clock::now() > deadline + flushInterval)
+    {
+        ++numberOfLateChunks;
+    }
+    if (not waitUntil(deadline, stopToken))
+    {
+        return std::nullopt;
+    }
+    ++nextChunkIdx;
+
+    return TupleBuffer::wrapMemory(
+        reinterpret_cast<uint8_t*>(fileContent->data() + chunk.offset), /// NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        static_cast<uint32_t>(chunk.sizeInBytes),
+        [fileContent = this->fileContent] { });
+}
+
+bool ReplaySource::waitUntil(const std::chrono::steady_clock::time_point deadline, const std::stop_token& stopToken)
+{
+    if (std::chrono::steady_clock::now() < deadline - SPIN_DURATION)
+    {
+        std::unique_lock lock(waitMutex);
+        /// Returns early solely if a stop is requested
+        waitCondition.wait_until(lock, stopToken, deadline - SPIN_DURATION, [] { return false; });
+    }
+    while (std::chrono::steady_clock::now() < deadline)
+    {
+        if (stopToken.stop_requested())
+        {
+            return false;
+        }
+    }
+    return not stopToken.stop_requested();
+}
+
+DescriptorConfig::Config ReplaySource::validateAndFormat(std::unordered_map<std::string, std::string> config)
+{
+    return DescriptorConfig::validateAndFormat<ConfigParametersReplay>(std::move(config), NAME);
+}
+
+std::ostream& ReplaySource::toString(std::ostream& str) const
+{
+    str << fmt::format(
+        "\nReplaySource(filepath: {}, mode: {}, tuplesPerSecond: {}, speedup: {}, chunks: {}, replayedChunks: {}, lateChunks: {})",
+        filePath,
+        replayMode == ReplayMode::FIXED_RATE ? "FIXED_RATE" : "EVENT_TIME",
+        tuplesPerSecond,
+        speedup,
+        chunks.size(),
+        nextChunkIdx,
+        numberOfLateChunks);
+    return str;
+}
+
+SourceValidationRegistryReturnType RegisterReplaySourceValidation(SourceValidationRegistryArguments sourceConfig)
+{
+    return ReplaySource::validateAndFormat(std::move(sourceConfig.config));
+}
+
+SourceRegistryReturnType SourceGeneratedRegistrar::RegisterReplaySource(SourceRegistryArguments sourceRegistryArguments)
+{
+    return std::make_unique<ReplaySource>(sourceRegistryArguments.sourceDescriptor);
+}
+
+InlineDataRegistryReturnType InlineDataGeneratedRegistrar::RegisterReplayInlineData(InlineDataRegistryArguments systestAdaptorArguments)
+{
+    if (systestAdaptorArguments.physicalSourceConfig.sourceConfig.contains(ConfigParametersReplay::FILE_PATH))
+    {
+        throw InvalidConfigParameter("The ReplaySource cannot use given inline data if a 'file_path' is set");
+    }
+    systestAdaptorArguments.physicalSourceConfig.sourceConfig.try_emplace(
+        ConfigParametersReplay::FILE_PATH, systestAdaptorArguments.testFilePath.string());
+
+    if (std::ofstream testFile(systestAdaptorArguments.testFilePath); testFile.is_open())
+    {
+        for (const auto& tuple : systestAdaptorArguments.tuples)
+        {
+            testFile << tuple << "\n";
+        }
+        testFile.flush();
+        return systestAdaptorArguments.physicalSourceConfig;
+    }
+    throw TestException("Could not open source file \"{}\"", systestAdaptorArguments.testFilePath);
+}
+
+FileDataRegistryReturnType FileDataGeneratedRegistrar::RegisterReplayFileData(FileDataRegistryArguments systestAdaptorArguments)
+{
+    if (systestAdaptorArguments.physicalSourceConfig.sourceConfig.contains(ConfigParametersReplay::FILE_PATH))
+    {
+        throw InvalidConfigParameter("The ReplaySource cannot use the file data if the file_path parameter is already set.");
+    }
+    systestAdaptorArguments.physicalSourceConfig.sourceConfig.emplace(
+        ConfigParametersReplay::FILE_PATH, systestAdaptorArguments.testFilePath.string());
+    return systestAdaptorArguments.physicalSourceConfig;
+}
+
+}
@@ -0,0 +1,194 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <stop_token>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include <Configurations/Descriptor.hpp>
+#include <Configurations/Enums/EnumWrapper.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Sources/Source.hpp>
+#include <Sources/SourceDescriptor.hpp>
+#include <Util/Logger/Logger.hpp>
+
+namespace NES
+{
+
+/// Replays a file at a controlled pace, so that latency measurements on recorded data are meaningful.
+/// In the FIXED_RATE mode, the source emits 'replay_tuples_per_second' tuples per second. In the EVENT_TIME mode, it reproduces the gaps
+/// between the timestamps (in milliseconds) of the 'replay_timestamp_field' of consecutive tuples, divided by 'replay_speedup'.
+/// The source reads the whole file into memory when it opens and precomputes the deadline of every tuple. It groups consecutive tuples into
+/// chunks of at most 'replay_chunk_size' bytes, whose deadlines differ by at most the flush interval, and emits a chunk once its last tuple
+/// is due. Thus, emitting a chunk solely waits for its deadline and hands out the region of the preloaded file without copying it.
+class ReplaySource final : public Source
+{
+public:
+    static constexpr std::string_view NAME = "Replay";
+
+    enum class ReplayMode : uint8_t
+    {
+        FIXED_RATE,
+        EVENT_TIME
+    };
+
+    explicit ReplaySource(const SourceDescriptor& sourceDescriptor);
+    ~ReplaySource() override = default;
+
+    ReplaySource(const ReplaySource&) = delete;
+    ReplaySource& operator=(const ReplaySource&) = delete;
+    ReplaySource(ReplaySource&&) = delete;
+    ReplaySource& operator=(ReplaySource&&) = delete;
+
+    /// The source hands out regions of the preloaded file, c.f., 'provideTupleBuffer()'
+    size_t fillTupleBuffer(TupleBuffer& tupleBuffer, const std::stop_token& stopToken) override;
+
+    [[nodiscard]] bool providesTupleBuffers() const override;
+    /// Waits until the next chunk is due and returns it. Returns nullopt at the end of the file or if a stop was requested while waiting.
+    std::optional<TupleBuffer> provideTupleBuffer(const std::stop_token& stopToken) override;
+
+    /// Reads the file into memory and computes the chunks and their deadlines
+    void open() override;
+    void close() override;
+
+    static DescriptorConfig::Config validateAndFormat(std::unordered_map<std::string, std::string> config);
+
+    [[nodiscard]] std::ostream& toString(std::ostream& str) const override;
+
+private:
+    struct Chunk
+    {
+        size_t offset;
+        size_t sizeInBytes;
+        /// Relative to the start of the replay
+        std::chrono::nanoseconds deadline;
+    };
+
+    void computeChunks();
+    /// Returns false, if a stop was requested before the deadline
+    bool waitUntil(std::chrono::steady_clock::time_point deadline, const std::stop_token& stopToken);
+
+    std::string filePath;
+    ReplayMode replayMode;
+    double tuplesPerSecond;
+    double speedup;
+    size_t chunkSize;
+    std::chrono::nanoseconds flushInterval;
+    std::string tupleDelimiter;
+    std::string fieldDelimiter;
+    /// Index of the timestamp field in each tuple, solely used by the EVENT_TIME mode
+    size_t timestampFieldIdx{0};
+
+    /// Shared with the TupleBuffers that wrap chunks of it
+    std::shared_ptr<std::vector<char>> fileContent;
+    std::vector<Chunk> chunks;
+    size_t nextChunkIdx{0};
+    std::optional<std::chrono::steady_clock::time_point> replayStart;
+    uint64_t numberOfLateChunks{0};
+
+    std::mutex waitMutex;
+    std::condition_variable_any waitCondition;
+};
+
+struct ConfigParametersReplay
+{
+    static inline const DescriptorConfig::ConfigParameter<std::string> FILE_PATH{
+        "file_path",
+        std::nullopt,
+        [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(FILE_PATH, config); }};
+
+    static inline const DescriptorConfig::ConfigParameter<EnumWrapper, ReplaySource::ReplayMode> REPLAY_MODE{
+        "replay_mode",
+        EnumWrapper{ReplaySource::ReplayMode::FIXED_RATE},
+        [](const std::unordered_map<std::string, std::string>& config)
+        {
+            const auto optToken = DescriptorConfig::tryGet(REPLAY_MODE, config);
+            if (not optToken.has_value() or not optToken.value().asEnum<ReplaySource::ReplayMode>().has_value())
+            {
+                return std::optional<EnumWrapper>();
+            }
+            return optToken;
+        }};
+
+    static inline const DescriptorConfig::ConfigParameter<double> TUPLES_PER_SECOND{
+        "replay_tuples_per_second",
+        1000.0,
+        [](const std::unordered_map<std::string, std::string>& config) -> std::optional<double>
+        {
+            const auto tuplesPerSecond = DescriptorConfig::tryGet(TUPLES_PER_SECOND, config);
+            if (tuplesPerSecond.has_value() and tuplesPerSecond.value() <= 0)
+            {
+                NES_ERROR("ReplaySource tuples per second is {}, but must be positive", tuplesPerSecond.value());
+                return std::nullopt;
+            }
+            return tuplesPerSecond;
+        }};
+
+    /// Mandatory for the EVENT_TIME mode
+    static inline const DescriptorConfig::ConfigParameter<std::string> TIMESTAMP_FIELD{
+        "replay_timestamp_field",
+        "",
+        [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(TIMESTAMP_FIELD, config); }};
+
+    static inline const DescriptorConfig::ConfigParameter<double> SPEEDUP{
+        "replay_speedup",
+        1.0,
+        [](const std::unordered_map<std::string, std::string>& config) -> std::optional<double>
+        {
+            const auto speedup = DescriptorConfig::tryGet(SPEEDUP, config);
+            if (speedup.has_value() and speedup.value() <= 0)
+            {
+                NES_ERROR("ReplaySource speedup is {}, but must be positive", speedup.value());
+                return std::nullopt;
+            }
+            return speedup;
+        }};
+
+    static inline const DescriptorConfig::ConfigParameter<size_t> CHUNK_SIZE{
+        "replay_chunk_size",
+        4096,
+        [](const std::unordered_map<std::string, std::string>& config) -> std::optional<size_t>
+        {
+            const auto chunkSize = DescriptorConfig::tryGet(CHUNK_SIZE, config);
+            if (chunkSize.has_value() and (chunkSize.value() == 0 or chunkSize.value() > std::numeric_limits<uint32_t>::max()))
+            {
+                NES_ERROR("ReplaySource chunk size is {}, but must be positive and below 4 GiB", chunkSize.value());
+                return std::nullopt;
+            }
+            return chunkSize;
+        }};
+
+    static inline const DescriptorConfig::ConfigParameter<uint64_t> FLUSH_INTERVAL_MS{
+        "flush_interval_ms",
+        10,
+        [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(FLUSH_INTERVAL_MS, config); }};
+
+    static inline std::unordered_map<std::string, DescriptorConfig::ConfigParameterContainer> parameterMap
+        = DescriptorConfig::createConfigParameterContainerMap(
+            SourceDescriptor::parameterMap, FILE_PATH, REPLAY_MODE, TUPLES_PER_SECOND, TIMESTAMP_FIELD, SPEEDUP, CHUNK_SIZE, FLUSH_INTERVAL_MS);
+};
+
+}
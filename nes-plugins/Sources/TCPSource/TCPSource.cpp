@@ -19,6 +19,7 @@
 #include <cstring>
 #include <exception>
 #include <memory>
+#include <optional>
 #include <ostream>
 #include <stop_token>
 #include <string>
@@ -31,6 +32,7 @@
 #include <cstdio>
 #include <fcntl.h>
 #include <netdb.h>
+#include <poll.h>
 #include <unistd.h> /// For read
 #include <Configurations/Descriptor.hpp>
 #include <Runtime/TupleBuffer.hpp>
@@ -50,11 +52,18 @@
 namespace NES
 {
 
+namespace
+{
+/// Bounds the time the blocking ingestion waits for a client before it checks for a stop request
+constexpr int ACCEPT_POLL_INTERVAL_MS = 100;
+}
+
 TCPSource::TCPSource(const SourceDescriptor& sourceDescriptor)
     : socketHost(sourceDescriptor.getFromConfig(ConfigParametersTCP::HOST))
     , socketPort(std::to_string(sourceDescriptor.getFromConfig(ConfigParametersTCP::PORT)))
     , socketType(sourceDescriptor.getFromConfig(ConfigParametersTCP::TYPE))
     , socketDomain(sourceDescriptor.getFromConfig(ConfigParametersTCP::DOMAIN))
+    , socketMode(sourceDescriptor.getFromConfig(ConfigParametersTCP::SOCKET_MODE))
     , tupleDelimiter(sourceDescriptor.getFromConfig(ConfigParametersTCP::SEPARATOR))
     , socketBufferSize(sourceDescriptor.getFromConfig(ConfigParametersTCP::SOCKET_BUFFER_SIZE))
     , bytesUsedForSocketBufferSizeTransfer(sourceDescriptor.getFromConfig(ConfigParametersTCP::SOCKET_BUFFER_TRANSFER_SIZE))
@@ -77,6 +86,7 @@ std::ostream& TCPSource::toString(std::ostream& str) const
     str << "\n  socketPort: " << socketPort;
     str << "\n  socketType: " << socketType;
     str << "\n  socketDomain: " << socketDomain;
+    str << "\n  socketMode: " << (socketMode == TCPSocketMode::CLIENT ? "CLIENT" : "SERVER");
     str << "\n  tupleDelimiter: " << tupleDelimiter;
     str << "\n  socketBufferSize: " << socketBufferSize;
     str << "\n  bytesUsedForSocketBufferSizeTransfer" << bytesUsedForSocketBufferSizeTransfer;
@@ -161,6 +171,55 @@ bool TCPSource::tryToConnect(const addrinfo* result, const int flags)
     return true;
 }
 
+void TCPSource::startListening(const addrinfo* result)
+{
+    std::string lastError = "No valid address found to create socket.";
+    for (; result != nullptr; result = result->ai_next)
+    {
+        listeningSockfd = socket(result->ai_family, result->ai_socktype | SOCK_NONBLOCK | SOCK_CLOEXEC, result->ai_protocol);
+        if (listeningSockfd == -1)
+        {
+            continue;
+        }
+        constexpr int enable = 1;
+        if (setsockopt(listeningSockfd, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable)) == 0
+            and setsockopt(listeningSockfd, SOL_SOCKET, SO_REUSEPORT, &enable, sizeof(enable)) == 0
+            and bind(listeningSockfd, result->ai_addr, result->ai_addrlen) == 0 and listen(listeningSockfd, SOMAXCONN) == 0)
+        {
+            return;
+        }
+        lastError = strerror_r(errno, errBuffer.data(), errBuffer.size());
+        ::close(listeningSockfd);
+        listeningSockfd = -1;
+    }
+    throw CannotOpenSource("Could not listen on: {}:{}. {}", socketHost, socketPort, lastError);
+}
+
+bool TCPSource::tryAccept()
+{
+    const auto clientSockfd = accept4(listeningSockfd, nullptr, nullptr, SOCK_CLOEXEC);
+    if (clientSockfd < 0)
+    {
+        /// The client may have reset its connection before the source accepted it
+        if (errno == EAGAIN or errno == EWOULDBLOCK or errno == EINTR or errno == ECONNABORTED)
+        {
+            return false;
+        }
+        const auto strerrorResult = strerror_r(errno, errBuffer.data(), errBuffer.size());
+        throw RunningRoutineFailure("Could not accept a client on: {}:{}. {}", socketHost, socketPort, strerrorResult);
+    }
+    sockfd = clientSockfd;
+    connection = 0;
+    /// The source serves a single client, thus the kernel hands the remaining clients to the other sources that listen on the port
+    ::close(listeningSockfd);
+    listeningSockfd = -1;
+
+    timeval timeout{.tv_sec = static_cast<time_t>(connectionTimeout), .tv_usec = IMPLICIT_TIMEOUT_USEC};
+    setsockopt(sockfd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    NES_DEBUG("TCPSource::tryAccept: Accepted a client on {}:{}.", socketHost, socketPort);
+    return true;
+}
+
 void TCPSource::open()
 {
     NES_TRACE("TCPSource::open: Trying to create socket and connect.");
@@ -170,11 +229,13 @@ void TCPSource::open()
 
     hints.ai_family = socketDomain;
     hints.ai_socktype = socketType;
-    hints.ai_flags = 0; /// use default behavior
+    /// A listening socket binds to the wildcard address, if 'socket_host' is empty
+    hints.ai_flags = socketMode == TCPSocketMode::SERVER ? AI_PASSIVE : 0;
     hints.ai_protocol
         = 0; /// specifying 0 in this field indicates that socket addresses with any protocol can be returned by getaddrinfo() ;
 
-    const auto errorCode = getaddrinfo(socketHost.c_str(), socketPort.c_str(), &hints, &result);
+    const auto* const host = socketMode == TCPSocketMode::SERVER and socketHost.empty() ? nullptr : socketHost.c_str();
+    const auto errorCode = getaddrinfo(host, socketPort.c_str(), &hints, &result);
     if (errorCode != 0)
     {
         throw CannotOpenSource("Failed getaddrinfo with error: {}", gai_strerror(errorCode));
@@ -183,6 +244,14 @@ void TCPSource::open()
     /// make sure that result is cleaned up automatically (RAII)
     const std::unique_ptr<addrinfo, decltype(&freeaddrinfo)> resultGuard(result, freeaddrinfo);
 
+    if (socketMode == TCPSocketMode::SERVER)
+    {
+        /// Accepting a client does not block opening, thus the source accepts it once the ingestion starts
+        startListening(result);
+        NES_TRACE("TCPSource::open: Listening for a client.");
+        return;
+    }
+
     const int flags = fcntl(sockfd, F_GETFL, 0);
 
     CPPTRACE_TRY
@@ -201,10 +270,23 @@ void TCPSource::open()
     NES_TRACE("TCPSource::open: Connected to server.");
 }
 
-size_t TCPSource::fillTupleBuffer(TupleBuffer& tupleBuffer, const std::stop_token&)
+size_t TCPSource::fillTupleBuffer(TupleBuffer& tupleBuffer, const std::stop_token& stopToken)
 {
     try
     {
+        while (sockfd < 0)
+        {
+            if (stopToken.stop_requested())
+            {
+                return 0;
+            }
+            pollfd listener{.fd = listeningSockfd, .events = POLLIN, .revents = 0};
+            if (poll(&listener, 1, ACCEPT_POLL_INTERVAL_MS) > 0)
+            {
+                tryAccept();
+            }
+        }
+
         size_t numReceivedBytes = 0;
         while (fillBuffer(tupleBuffer, numReceivedBytes))
         {
@@ -265,6 +347,38 @@ bool TCPSource::fillBuffer(TupleBuffer& tupleBuffer, size_t& numReceivedBytes)
     return numReceivedBytes == 0 and readWasValid;
 }
 
+std::optional<int> TCPSource::getFileDescriptor() const
+{
+    /// Changes to the connection, once the source accepted a client
+    return sockfd >= 0 ? sockfd : listeningSockfd;
+}
+
+std::optional<size_t> TCPSource::tryFillTupleBuffer(TupleBuffer& tupleBuffer, const size_t offset)
+{
+    if (sockfd < 0)
+    {
+        /// The listening socket became readable, the next readiness of the accepted connection triggers the next call
+        tryAccept();
+        return 0;
+    }
+    const auto availableMemory = tupleBuffer.getAvailableMemoryArea().subspan(offset);
+    const ssize_t bufferSizeReceived = recv(sockfd, availableMemory.data(), availableMemory.size(), MSG_DONTWAIT);
+    if (bufferSizeReceived == INVALID_RECEIVED_BUFFER_SIZE)
+    {
+        if (errno == EAGAIN or errno == EWOULDBLOCK)
+        {
+            return 0;
+        }
+        throw RunningRoutineFailure("An error occurred while reading from socket. Error: {}", strerror(errno));
+    }
+    if (bufferSizeReceived == EOF_RECEIVED_BUFFER_SIZE)
+    {
+        NES_INFO("TCP Source detected EoS");
+        return std::nullopt;
+    }
+    return static_cast<size_t>(bufferSizeReceived);
+}
+
 DescriptorConfig::Config TCPSource::validateAndFormat(std::unordered_map<std::string, std::string> config)
 {
     return DescriptorConfig::validateAndFormat<ConfigParametersTCP>(std::move(config), name());
@@ -273,11 +387,17 @@ DescriptorConfig::Config TCPSource::validateAndFormat(std::unordered_map<std::st
 void TCPSource::close()
 {
     NES_DEBUG("TCPSource::close: trying to close connection.");
-    if (connection >= 0)
+    if (connection >= 0 and sockfd >= 0)
     {
         ::close(sockfd);
+        sockfd = -1;
         NES_TRACE("TCPSource::close: connection closed.");
     }
+    if (listeningSockfd >= 0)
+    {
+        ::close(listeningSockfd);
+        listeningSockfd = -1;
+    }
 }
 
 SourceValidationRegistryReturnType RegisterTCPSourceValidation(SourceValidationRegistryArguments sourceConfig)
@@ -30,7 +30,7 @@
 #include <Configurations/Enums/EnumWrapper.hpp>
 #include <Runtime/AbstractBufferProvider.hpp>
 #include <Runtime/TupleBuffer.hpp>
-#include <Sources/Source.hpp>
+#include <Sources/AsyncSource.hpp>
 #include <Sources/SourceDescriptor.hpp>
 #include <Util/Logger/Logger.hpp>
 #include <sys/socket.h> /// For socket functions
@@ -39,6 +39,17 @@
 namespace NES
 {
 
+/// In the CLIENT mode, the source connects to the server at 'socket_host'. In the SERVER mode, the source listens on 'socket_host' and
+/// reads from the first client that connects. Listening sockets set SO_REUSEPORT, thus many sources can share a port, and the kernel
+/// distributes the connecting clients across them. Each client has its own source, with its own origin and sequence numbers.
+/// Thus, a partitioned source, c.f., SourceDescriptor::NUMBER_OF_PARTITIONS, ingests a client per partition in the SERVER mode, and opens
+/// a connection per partition in the CLIENT mode.
+enum class TCPSocketMode : uint8_t
+{
+    CLIENT,
+    SERVER
+};
+
 /// Defines the names, (optional) default values, (optional) validation & config functions, for all TCP config parameters.
 struct ConfigParametersTCP
 {
@@ -118,6 +129,19 @@ struct ConfigParametersTCP
                 socketTypeString)
             return std::nullopt;
         }};
+    static inline const DescriptorConfig::ConfigParameter<EnumWrapper, TCPSocketMode> SOCKET_MODE{
+        "socket_mode",
+        EnumWrapper{TCPSocketMode::CLIENT},
+        [](const std::unordered_map<std::string, std::string>& config)
+        {
+            const auto optToken = DescriptorConfig::tryGet(SOCKET_MODE, config);
+            if (not optToken.has_value() or not optToken.value().asEnum<TCPSocketMode>().has_value())
+            {
+                return std::optional<EnumWrapper>();
+            }
+            return optToken;
+        }};
+
     static inline const DescriptorConfig::ConfigParameter<char> SEPARATOR{
         "tuple_delimiter",
         '\n',
@@ -147,14 +171,18 @@ struct ConfigParametersTCP
             PORT,
             DOMAIN,
             TYPE,
+            SOCKET_MODE,
             SEPARATOR,
             FLUSH_INTERVAL_MS,
             SOCKET_BUFFER_SIZE,
             SOCKET_BUFFER_TRANSFER_SIZE,
-            CONNECT_TIMEOUT);
+            CONNECT_TIMEOUT,
+            SourceDescriptor::NUMBER_OF_PARTITIONS);
 };
 
-class TCPSource : public Source
+/// Opts into the AsyncSourceRuntime with its socket. There, it emits the received bytes once the socket has no more bytes available,
+/// instead of waiting for a full buffer or the flush interval.
+class TCPSource : public AsyncSource
 {
     constexpr static ssize_t INVALID_RECEIVED_BUFFER_SIZE = -1;
     /// A return value of '0' means an EoF in the context of a read(socket..) (https://man.archlinux.org/man/core/man-pages/read.2.en)
@@ -181,6 +209,9 @@ public:
 
     size_t fillTupleBuffer(TupleBuffer& tupleBuffer, const std::stop_token& stopToken) override;
 
+    [[nodiscard]] std::optional<int> getFileDescriptor() const override;
+    std::optional<size_t> tryFillTupleBuffer(TupleBuffer& tupleBuffer, size_t offset) override;
+
     /// Open TCP connection.
     void open() override;
     /// Close TCP connection.
@@ -192,10 +223,15 @@ public:
 
 private:
     bool tryToConnect(const addrinfo* result, int flags);
+    /// Creates a non-blocking socket that listens for clients, c.f., TCPSocketMode::SERVER
+    void startListening(const addrinfo* result);
+    /// Returns true, if the source accepted a client and reads from its connection from now on
+    bool tryAccept();
     bool fillBuffer(TupleBuffer& tupleBuffer, size_t& numReceivedBytes);
 
     int connection = -1;
     int sockfd = -1;
+    int listeningSockfd = -1;
 
     /// buffer for thread-safe strerror_r
     std::array<char, ERROR_MESSAGE_BUFFER_SIZE> errBuffer;
@@ -204,6 +240,7 @@ private:
     std::string socketPort;
     int socketType;
     int socketDomain;
+    TCPSocketMode socketMode;
     char tupleDelimiter;
     size_t socketBufferSize;
     size_t bytesUsedForSocketBufferSizeTransfer;
@@ -0,0 +1,277 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <UDPSource.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <stop_token>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <netdb.h>
+#include <poll.h>
+#include <unistd.h>
+#include <Configurations/Descriptor.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Sources/SourceDescriptor.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <fmt/format.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <ErrorHandling.hpp>
+#include <SourceRegistry.hpp>
+#include <SourceValidationRegistry.hpp>
+
+namespace NES
+{
+
+namespace
+{
+/// Bounds the time the blocking ingestion waits for a datagram before it checks for a stop request
+constexpr int RECEIVE_POLL_INTERVAL_MS = 100;
+}
+
+UDPSource::UDPSource(const SourceDescriptor& sourceDescriptor)
+    : socketHost(sourceDescriptor.getFromConfig(ConfigParametersUDP::HOST))
+    , socketPort(std::to_string(sourceDescriptor.getFromConfig(ConfigParametersUDP::PORT)))
+    , socketDomain(sourceDescriptor.getFromConfig(ConfigParametersUDP::DOMAIN))
+    , tupleDelimiter(sourceDescriptor.getFromConfig(ConfigParametersUDP::SEPARATOR))
+    , batchSize(sourceDescriptor.getFromConfig(ConfigParametersUDP::BATCH_SIZE))
+    , maxDatagramSize(sourceDescriptor.getFromConfig(ConfigParametersUDP::MAX_DATAGRAM_SIZE))
+    , reusePort(sourceDescriptor.getFromConfig(ConfigParametersUDP::REUSE_PORT))
+    , receiveBufferSize(sourceDescriptor.getFromConfig(ConfigParametersUDP::RECEIVE_BUFFER_SIZE))
+    , messages(batchSize)
+    , datagramSlots(batchSize)
+    , controlBuffers(batchSize)
+{
+}
+
+void UDPSource::open()
+{
+    addrinfo hints{};
+    hints.ai_family = socketDomain;
+    hints.ai_socktype = SOCK_DGRAM;
+    hints.ai_flags = AI_PASSIVE;
+
+    addrinfo* result = nullptr;
+    const auto errorCode = getaddrinfo(socketHost.empty() ? nullptr : socketHost.c_str(), socketPort.c_str(), &hints, &result);
+    if (errorCode != 0)
+    {
+        throw CannotOpenSource("Failed getaddrinfo with error: {}", gai_strerror(errorCode));
+    }
+    const std::unique_ptr<addrinfo, decltype(&freeaddrinfo)> resultGuard(result, freeaddrinfo);
+
+    std::string lastError = "No valid address found to create socket.";
+    for (const auto* address = result; address != nullptr; address = address->ai_next)
+    {
+        sockfd = socket(address->ai_family, address->ai_socktype | SOCK_NONBLOCK | SOCK_CLOEXEC, address->ai_protocol);
+        if (sockfd == -1)
+        {
+            continue;
+        }
+        constexpr int enable = 1;
+        const auto bufferSize = static_cast<int>(receiveBufferSize);
+        if (setsockopt(sockfd, SOL_SOCKET, SO_RXQ_OVFL, &enable, sizeof(enable)) == 0
+            and (not reusePort or setsockopt(sockfd, SOL_SOCKET, SO_REUSEPORT, &enable, sizeof(enable)) == 0)
+            and (receiveBufferSize == 0 or setsockopt(sockfd, SOL_SOCKET, SO_RCVBUF, &bufferSize, sizeof(bufferSize)) == 0)
+            and bind(sockfd, address->ai_addr, address->ai_addrlen) == 0)
+        {
+            numberOfDroppedDatagrams = 0;
+            NES_DEBUG("UDPSource::open: Bound to {}:{}.", socketHost, socketPort);
+            return;
+        }
+        lastError = std::strerror(errno);
+        ::close(sockfd);
+        sockfd = -1;
+    }
+    throw CannotOpenSource("Could not bind to: {}:{}. {}", socketHost, socketPort, lastError);
+}
+
+void UDPSource::close()
+{
+    if (sockfd >= 0)
+    {
+        ::close(sockfd);
+        sockfd = -1;
+    }
+    NES_DEBUG(
+        "UDPSource::close: Received {} datagrams, truncated {}, and the kernel dropped {}.",
+        numberOfReceivedDatagrams,
+        numberOfTruncatedDatagrams,
+        numberOfDroppedDatagrams);
+}
+
+size_t UDPSource::fillTupleBuffer(TupleBuffer& tupleBuffer, const std::stop_token& stopToken)
+{
+    size_t numberOfBytes = 0;
+    while (numberOfBytes == 0 and not stopToken.stop_requested())
+    {
+        pollfd socket{.fd = sockfd, .events = POLLIN, .revents = 0};
+        if (poll(&socket, 1, RECEIVE_POLL_INTERVAL_MS) > 0)
+        {
+            numberOfBytes = receiveDatagrams(tupleBuffer, 0);
+        }
+    }
+    /// Emitting once the socket has no more datagrams available, instead of waiting for a full buffer
+    for (auto numberOfReceivedBytes = numberOfBytes; numberOfReceivedBytes != 0;)
+    {
+        numberOfReceivedBytes = receiveDatagrams(tupleBuffer, numberOfBytes);
+        numberOfBytes += numberOfReceivedBytes;
+    }
+    return numberOfBytes;
+}
+
+std::optional<int> UDPSource::getFileDescriptor() const
+{
+    return sockfd;
+}
+
+std::optional<size_t> UDPSource::tryFillTupleBuffer(TupleBuffer& tupleBuffer, const size_t offset)
+{
+    return receiveDatagrams(tupleBuffer, offset);
+}
+
+size_t UDPSource::receiveDatagrams(TupleBuffer& tupleBuffer, const size_t offset)
+{
+    /// Each slot has room for the delimiter behind the datagram, thus compacting never moves a datagram to the right
+    const auto slotSize = maxDatagramSize + 1;
+    const auto memory = tupleBuffer.getAvailableMemoryArea<char>().subspan(offset);
+    const auto numberOfSlots = std::min(batchSize, memory.size() / slotSize);
+    if (numberOfSlots == 0)
+    {
+        if (offset == 0)
+        {
+            throw InvalidConfigParameter(
+                "The UDPSource requires buffers of at least {} bytes for its max datagram size, but got {}", slotSize, memory.size());
+        }
+        return 0;
+    }
+
+    for (size_t slot = 0; slot < numberOfSlots; ++slot)
+    {
+        datagramSlots[slot] = iovec{.iov_base = memory.data() + (slot * slotSize), .iov_len = maxDatagramSize};
+        messages[slot] = mmsghdr{
+            .msg_hdr
+            = msghdr{
+                .msg_name = nullptr,
+                .msg_namelen = 0,
+                .msg_iov = &datagramSlots[slot],
+                .msg_iovlen = 1,
+                .msg_control = controlBuffers[slot].data.data(),
+                .msg_controllen = controlBuffers[slot].data.size(),
+                .msg_flags = 0},
+            .msg_len = 0};
+    }
+
+    const auto numberOfDatagrams = recvmmsg(sockfd, messages.data(), numberOfSlots, MSG_DONTWAIT, nullptr);
+    if (numberOfDatagrams < 0)
+    {
+        if (errno == EAGAIN or errno == EWOULDBLOCK or errno == EINTR)
+        {
+            return 0;
+        }
+        throw RunningRoutineFailure("An error occurred while receiving datagrams on {}:{}. Error: {}", socketHost, socketPort, strerror(errno));
+    }
+
+    size_t numberOfBytes = 0;
+    for (size_t datagram = 0; datagram < static_cast<size_t>(numberOfDatagrams); ++datagram)
+    {
+        auto& message = messages[datagram];
+        updateNumberOfDroppedDatagrams(message.msg_hdr);
+        if ((message.msg_hdr.msg_flags & MSG_TRUNC) != 0)
+        {
+            ++numberOfTruncatedDatagrams;
+        }
+        if (message.msg_len == 0)
+        {
+            continue;
+        }
+        std::memmove(memory.data() + numberOfBytes, memory.data() + (datagram * slotSize), message.msg_len);
+        numberOfBytes += message.msg_len;
+        if (memory[numberOfBytes - 1] != tupleDelimiter)
+        {
+            memory[numberOfBytes++] = tupleDelimiter;
+        }
+    }
+    numberOfReceivedDatagrams += numberOfDatagrams;
+    return numberOfBytes;
+}
+
+void UDPSource::updateNumberOfDroppedDatagrams(msghdr& message)
+{
+    /// The kernel attaches the counter solely to datagrams that arrive after a drop
+    for (auto* header = CMSG_FIRSTHDR(&message); header != nullptr; header = CMSG_NXTHDR(&message, header))
+    {
+        if (header->cmsg_level != SOL_SOCKET or header->cmsg_type != SO_RXQ_OVFL)
+        {
+            continue;
+        }
+        uint32_t counter = 0;
+        std::memcpy(&counter, CMSG_DATA(header), sizeof(counter));
+        if (counter != numberOfDroppedDatagrams)
+        {
+            NES_WARNING(
+                "UDPSource on {}:{} lost {} datagrams, because its receive queue was full",
+                socketHost,
+                socketPort,
+                static_cast<uint32_t>(counter - numberOfDroppedDatagrams));
+            numberOfDroppedDatagrams = counter;
+        }
+    }
+}
+
+uint64_t UDPSource::getNumberOfDroppedDatagrams() const
+{
+    return numberOfDroppedDatagrams;
+}
+
+DescriptorConfig::Config UDPSource::validateAndFormat(std::unordered_map<std::string, std::string> config)
+{
+    return DescriptorConfig::validateAndFormat<ConfigParametersUDP>(std::move(config), NAME);
+}
+
+std::ostream& UDPSource::toString(std::ostream& str) const
+{
+    str << fmt::format(
+        "\nUDPSource(host: {}, port: {}, batchSize: {}, maxDatagramSize: {}, reusePort: {}, receivedDatagrams: {}, truncatedDatagrams: {}, "
+        "droppedDatagrams: {})",
+        socketHost,
+        socketPort,
+        batchSize,
+        maxDatagramSize,
+        reusePort,
+        numberOfReceivedDatagrams,
+        numberOfTruncatedDatagrams,
+        numberOfDroppedDatagrams);
+    return str;
+}
+
+SourceValidationRegistryReturnType RegisterUDPSourceValidation(SourceValidationRegistryArguments sourceConfig)
+{
+    return UDPSource::validateAndFormat(std::move(sourceConfig.config));
+}
+
+SourceRegistryReturnType SourceGeneratedRegistrar::RegisterUDPSource(SourceRegistryArguments sourceRegistryArguments)
+{
+    return std::make_unique<UDPSource>(sourceRegistryArguments.sourceDescriptor);
+}
+
+}
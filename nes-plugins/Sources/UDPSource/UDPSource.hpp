@@ -0,0 +1,198 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <ostream>
+#include <stop_token>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include <Configurations/Descriptor.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Sources/AsyncSource.hpp>
+#include <Sources/SourceDescriptor.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <strings.h>
+
+namespace NES
+{
+
+/// Receives UDP datagrams on 'socket_host':'socket_port' and writes each of them as one tuple, followed by the tuple delimiter, unless the
+/// datagram already ends with it.
+/// A single recvmmsg call receives up to 'udp_batch_size' datagrams directly into the TupleBuffer. Each datagram gets a slot of
+/// 'udp_max_datagram_size' bytes plus one for its delimiter, and the source compacts the received datagrams in place afterward.
+/// With 'udp_reuse_port', many sources bind to the same port and the kernel distributes the datagrams across them, thus the I/O threads of
+/// the AsyncSourceRuntime ingest a single port on multiple cores. UDP has no end of stream, thus the source runs until it is stopped.
+/// The source counts the datagrams that the kernel dropped, because the receive queue of the socket was full (SO_RXQ_OVFL).
+class UDPSource final : public AsyncSource
+{
+public:
+    static constexpr std::string_view NAME = "UDP";
+
+    explicit UDPSource(const SourceDescriptor& sourceDescriptor);
+    ~UDPSource() override = default;
+
+    UDPSource(const UDPSource&) = delete;
+    UDPSource& operator=(const UDPSource&) = delete;
+    UDPSource(UDPSource&&) = delete;
+    UDPSource& operator=(UDPSource&&) = delete;
+
+    /// Waits until at least one datagram arrived and receives all available datagrams that fit into the buffer
+    size_t fillTupleBuffer(TupleBuffer& tupleBuffer, const std::stop_token& stopToken) override;
+
+    [[nodiscard]] std::optional<int> getFileDescriptor() const override;
+    std::optional<size_t> tryFillTupleBuffer(TupleBuffer& tupleBuffer, size_t offset) override;
+
+    /// Binds the socket
+    void open() override;
+    void close() override;
+
+    /// Number of datagrams that the kernel dropped since the source opened its socket
+    [[nodiscard]] uint64_t getNumberOfDroppedDatagrams() const;
+
+    static DescriptorConfig::Config validateAndFormat(std::unordered_map<std::string, std::string> config);
+
+    [[nodiscard]] std::ostream& toString(std::ostream& str) const override;
+
+private:
+    struct ControlBuffer
+    {
+        alignas(cmsghdr) std::array<char, CMSG_SPACE(sizeof(uint32_t))> data;
+    };
+
+    /// Receives the available datagrams with a single recvmmsg call and appends them at 'offset'. Returns the number of appended bytes.
+    size_t receiveDatagrams(TupleBuffer& tupleBuffer, size_t offset);
+    void updateNumberOfDroppedDatagrams(msghdr& message);
+
+    std::string socketHost;
+    std::string socketPort;
+    int socketDomain;
+    char tupleDelimiter;
+    size_t batchSize;
+    size_t maxDatagramSize;
+    bool reusePort;
+    uint32_t receiveBufferSize;
+
+    int sockfd{-1};
+    std::vector<mmsghdr> messages;
+    std::vector<iovec> datagramSlots;
+    std::vector<ControlBuffer> controlBuffers;
+
+    uint64_t numberOfReceivedDatagrams{0};
+    uint64_t numberOfTruncatedDatagrams{0};
+    /// The kernel reports the drops as a counter of the socket, which wraps around at 32 bits
+    uint32_t numberOfDroppedDatagrams{0};
+};
+
+struct ConfigParametersUDP
+{
+    /// Binds to all addresses, if empty
+    static inline const DescriptorConfig::ConfigParameter<std::string> HOST{
+        "socket_host",
+        "",
+        [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(HOST, config); }};
+
+    static inline const DescriptorConfig::ConfigParameter<uint32_t> PORT{
+        "socket_port",
+        std::nullopt,
+        [](const std::unordered_map<std::string, std::string>& config) -> std::optional<uint32_t>
+        {
+            constexpr uint32_t PORT_NUMBER_MAX = 65535;
+            const auto portNumber = DescriptorConfig::tryGet(PORT, config);
+            if (portNumber.has_value() and portNumber.value() > PORT_NUMBER_MAX)
+            {
+                NES_ERROR("UDPSource port is {}, but ports must be between 0 and {}", portNumber.value(), PORT_NUMBER_MAX);
+                return std::nullopt;
+            }
+            return portNumber;
+        }};
+
+    static inline const DescriptorConfig::ConfigParameter<int32_t> DOMAIN{
+        "socket_domain",
+        AF_INET,
+        [](const std::unordered_map<std::string, std::string>& config) -> std::optional<int>
+        {
+            const auto& socketDomainString = config.at(DOMAIN);
+            if (strcasecmp(socketDomainString.c_str(), "AF_INET") == 0)
+            {
+                return AF_INET;
+            }
+            if (strcasecmp(socketDomainString.c_str(), "AF_INET6") == 0)
+            {
+                return AF_INET6;
+            }
+            NES_ERROR("UDPSource domain is {}, but the domain must be AF_INET or AF_INET6", socketDomainString);
+            return std::nullopt;
+        }};
+
+    static inline const DescriptorConfig::ConfigParameter<char> SEPARATOR{
+        "tuple_delimiter",
+        '\n',
+        [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(SEPARATOR, config); }};
+
+    static inline const DescriptorConfig::ConfigParameter<uint32_t> BATCH_SIZE{
+        "udp_batch_size",
+        64,
+        [](const std::unordered_map<std::string, std::string>& config) -> std::optional<uint32_t>
+        {
+            const auto batchSize = DescriptorConfig::tryGet(BATCH_SIZE, config);
+            if (batchSize.has_value() and (batchSize.value() == 0 or batchSize.value() > UIO_MAXIOV))
+            {
+                NES_ERROR("UDPSource batch size is {}, but must be between 1 and {}", batchSize.value(), UIO_MAXIOV);
+                return std::nullopt;
+            }
+            return batchSize;
+        }};
+
+    /// Datagrams that exceed the size are truncated. The default fits the payload of an Ethernet frame.
+    static inline const DescriptorConfig::ConfigParameter<uint32_t> MAX_DATAGRAM_SIZE{
+        "udp_max_datagram_size",
+        1472,
+        [](const std::unordered_map<std::string, std::string>& config) -> std::optional<uint32_t>
+        {
+            constexpr uint32_t MAX_UDP_PAYLOAD_SIZE = 65507;
+            const auto maxDatagramSize = DescriptorConfig::tryGet(MAX_DATAGRAM_SIZE, config);
+            if (maxDatagramSize.has_value() and (maxDatagramSize.value() == 0 or maxDatagramSize.value() > MAX_UDP_PAYLOAD_SIZE))
+            {
+                NES_ERROR("UDPSource max datagram size is {}, but must be between 1 and {}", maxDatagramSize.value(), MAX_UDP_PAYLOAD_SIZE);
+                return std::nullopt;
+            }
+            return maxDatagramSize;
+        }};
+
+    static inline const DescriptorConfig::ConfigParameter<bool> REUSE_PORT{
+        "udp_reuse_port",
+        false,
+        [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(REUSE_PORT, config); }};
+
+    /// Sets SO_RCVBUF, if positive, which bounds the number of bytes the kernel queues before it drops datagrams
+    static inline const DescriptorConfig::ConfigParameter<uint32_t> RECEIVE_BUFFER_SIZE{
+        "socket_receive_buffer_size",
+        0,
+        [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(RECEIVE_BUFFER_SIZE, config); }};
+
+    static inline std::unordered_map<std::string, DescriptorConfig::ConfigParameterContainer> parameterMap
+        = DescriptorConfig::createConfigParameterContainerMap(
+            SourceDescriptor::parameterMap, HOST, PORT, DOMAIN, SEPARATOR, BATCH_SIZE, MAX_DATAGRAM_SIZE, REUSE_PORT, RECEIVE_BUFFER_SIZE);
+};
+
+}
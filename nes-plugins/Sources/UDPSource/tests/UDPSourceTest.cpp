@@ -0,0 +1,241 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stop_token>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/DataTypeProvider.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Sources/LogicalSource.hpp>
+#include <Sources/SourceCatalog.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+#include <ErrorHandling.hpp>
+#include <UDPSource.hpp>
+
+namespace NES
+{
+
+namespace
+{
+/// Binds an ephemeral UDP port on the loopback interface and releases it, thus the source of a test can bind it afterward
+uint16_t findUnusedPort()
+{
+    const auto probingSocket = ::socket(AF_INET, SOCK_DGRAM, 0);
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = 0;
+    socklen_t addressLength = sizeof(address);
+    const auto bound = ::bind(probingSocket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0
+        and ::getsockname(probingSocket, reinterpret_cast<sockaddr*>(&address), &addressLength) == 0;
+    ::close(probingSocket);
+    INVARIANT(bound, "Could not find an unused port");
+    return ntohs(address.sin_port);
+}
+}
+
+class UDPSourceTest : public Testing::BaseUnitTest
+{
+public:
+    static constexpr size_t BUFFER_SIZE = 4096;
+    static constexpr size_t BATCH_SIZE = 8;
+    /// Small datagrams, thus a buffer has room for far more slots than a single recvmmsg batch
+    static constexpr size_t MAX_DATAGRAM_SIZE = 63;
+    /// Every datagram of a test is queued at the socket before the source receives, thus a buffer solely waits this long if none is left
+    static constexpr std::chrono::milliseconds RECEIVE_TIMEOUT{1000};
+
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("UDPSourceTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup UDPSourceTest test class.");
+    }
+
+    void SetUp() override
+    {
+        BaseUnitTest::SetUp();
+        schema.addField("id", DataTypeProvider::provideDataType(DataType::Type::UINT64));
+        logicalSource = sourceCatalog.addLogicalSource("testSource", schema);
+        ASSERT_TRUE(logicalSource.has_value());
+        port = findUnusedPort();
+
+        sender = ::socket(AF_INET, SOCK_DGRAM, 0);
+        ASSERT_GE(sender, 0);
+        receiver.sin_family = AF_INET;
+        receiver.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        receiver.sin_port = htons(port);
+    }
+
+    void TearDown() override
+    {
+        ::close(sender);
+        BaseUnitTest::TearDown();
+    }
+
+    std::unique_ptr<UDPSource> createSource()
+    {
+        const auto descriptor = sourceCatalog.addPhysicalSource(
+            logicalSource.value(),
+            "UDP",
+            {{"socket_host", "127.0.0.1"},
+             {"socket_port", std::to_string(port)},
+             {"udp_batch_size", std::to_string(BATCH_SIZE)},
+             {"udp_max_datagram_size", std::to_string(MAX_DATAGRAM_SIZE)},
+             /// Large enough to queue every datagram of a test before the source starts receiving
+             {"socket_receive_buffer_size", std::to_string(1024 * 1024)}},
+            {{"type", "CSV"}});
+        EXPECT_TRUE(descriptor.has_value());
+        return std::make_unique<UDPSource>(descriptor.value());
+    }
+
+    void send(const std::string& datagram) const
+    {
+        const auto sent = ::sendto(
+            sender, datagram.data(), datagram.size(), 0, reinterpret_cast<const sockaddr*>(&receiver), sizeof(receiver));
+        ASSERT_EQ(sent, static_cast<ssize_t>(datagram.size()));
+    }
+
+    /// Fills buffers until the source delivered 'expectedBytes' or a buffer stayed empty for the RECEIVE_TIMEOUT
+    std::string receive(UDPSource& source, const size_t expectedBytes)
+    {
+        std::string received;
+        while (received.size() < expectedBytes)
+        {
+            /// fillTupleBuffer polls the socket until it receives a datagram, thus solely a stop request ends the wait for a lost one
+            std::stop_source stopSource;
+            const std::jthread watchdog(
+                [&stopSource](const std::stop_token& watchdogToken)
+                {
+                    std::mutex mutex;
+                    std::condition_variable_any timeout;
+                    std::unique_lock lock(mutex);
+                    timeout.wait_for(lock, watchdogToken, RECEIVE_TIMEOUT, [] { return false; });
+                    if (not watchdogToken.stop_requested())
+                    {
+                        stopSource.request_stop();
+                    }
+                });
+            auto buffer = bufferManager->getBufferBlocking();
+            const auto numberOfBytes = source.fillTupleBuffer(buffer, stopSource.get_token());
+            if (numberOfBytes == 0)
+            {
+                break;
+            }
+            received.append(buffer.getAvailableMemoryArea<char>().data(), numberOfBytes);
+        }
+        return received;
+    }
+
+    Schema schema;
+    SourceCatalog sourceCatalog;
+    std::optional<LogicalSource> logicalSource;
+    std::shared_ptr<BufferManager> bufferManager = BufferManager::create(BUFFER_SIZE, 16);
+    uint16_t port = 0;
+    int sender = -1;
+    sockaddr_in receiver{};
+};
+
+/// clang tidy doesn't recognize the .has_value in the ASSERT_TRUE
+/// NOLINTBEGIN(bugprone-unchecked-optional-access)
+TEST_F(UDPSourceTest, ReceivesMoreDatagramsThanOneBatchWithoutLosingAny)
+{
+    constexpr size_t numberOfDatagrams = 100;
+    auto source = createSource();
+    source->open();
+
+    /// Every other datagram already ends with the delimiter, which the source must not duplicate
+    std::string expected;
+    for (size_t index = 0; index < numberOfDatagrams; ++index)
+    {
+        const auto tuple = std::to_string(index) + std::string(index % 40, 'x');
+        send(index % 2 == 0 ? tuple : tuple + "\n");
+        expected += tuple + "\n";
+    }
+
+    const auto received = receive(*source, expected.size());
+    source->close();
+
+    EXPECT_EQ(received, expected);
+    EXPECT_EQ(source->getNumberOfDroppedDatagrams(), 0U);
+}
+
+TEST_F(UDPSourceTest, TruncatesDatagramsLargerThanTheMaxDatagramSize)
+{
+    auto source = createSource();
+    source->open();
+
+    const std::string oversized(2 * MAX_DATAGRAM_SIZE, 'a');
+    send(oversized);
+    send("1");
+
+    const auto expected = oversized.substr(0, MAX_DATAGRAM_SIZE) + "\n1\n";
+    const auto received = receive(*source, expected.size());
+    source->close();
+
+    EXPECT_EQ(received, expected);
+    EXPECT_EQ(source->getNumberOfDroppedDatagrams(), 0U);
+}
+
+TEST_F(UDPSourceTest, ReturnsAnEmptyBufferOnceStopIsRequestedWithoutDatagrams)
+{
+    auto source = createSource();
+    source->open();
+
+    const auto start = std::chrono::steady_clock::now();
+    const auto received = receive(*source, 1);
+    const auto waited = std::chrono::steady_clock::now() - start;
+    source->close();
+
+    /// The source kept polling the idle socket until the stop request instead of returning early
+    EXPECT_TRUE(received.empty());
+    EXPECT_GE(waited, RECEIVE_TIMEOUT);
+}
+
+TEST_F(UDPSourceTest, RejectsBuffersThatCannotHoldASingleDatagram)
+{
+    auto source = createSource();
+    source->open();
+    send("1");
+
+    auto buffer = bufferManager->getUnpooledBuffer(MAX_DATAGRAM_SIZE);
+    ASSERT_TRUE(buffer.has_value());
+    ASSERT_EXCEPTION_ERRORCODE(source->tryFillTupleBuffer(buffer.value(), 0), ErrorCode::InvalidConfigParameter);
+    source->close();
+}
+
+/// NOLINTEND(bugprone-unchecked-optional-access)
+
+}
@@ -13,6 +13,7 @@
 */
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <Util/DumpMode.hpp>
 #include <CompiledQueryPlan.hpp>
@@ -29,6 +30,8 @@ struct QueryCompilationRequest
     /// IMPORTANT: only the queryPlan should influence the actual result, other request options only influence how much to debug print etc.
     bool debug = false;
     DumpMode dumpCompilationResult = DumpMode::NONE;
+    size_t numberOfRetainedArenaBuffers = 0;
+    bool profileOperators = false;
 };
 
 /// The query compiler behaves as a pure function: QueryPlan -> CompiledQueryPlan
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <unordered_map>
 #include <variant>
@@ -29,8 +30,11 @@ namespace NES
 class LowerToCompiledQueryPlanPhase
 {
 public:
-    explicit LowerToCompiledQueryPlanPhase(DumpMode dumpQueryCompilationIntermediateRepresentations)
+    explicit LowerToCompiledQueryPlanPhase(
+        DumpMode dumpQueryCompilationIntermediateRepresentations, size_t numberOfRetainedArenaBuffers = 0, bool profileOperators = false)
         : dumpQueryCompilationIntermediateRepresentations(dumpQueryCompilationIntermediateRepresentations)
+        , numberOfRetainedArenaBuffers(numberOfRetainedArenaBuffers)
+        , profileOperators(profileOperators)
     {
     }
 
@@ -56,5 +60,8 @@ private:
 
     /// Config parameter
     DumpMode dumpQueryCompilationIntermediateRepresentations;
+    size_t numberOfRetainedArenaBuffers;
+    /// Counts the cycles of each operator of the compiled pipelines, c.f., OperatorProfile
+    bool profileOperators;
 };
 }
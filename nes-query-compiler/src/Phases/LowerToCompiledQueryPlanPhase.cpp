@@ -15,32 +15,248 @@
 #include <Phases/LowerToCompiledQueryPlanPhase.hpp>
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <optional>
 #include <ranges>
+#include <string>
+#include <typeinfo>
 #include <unordered_map>
 #include <utility>
 #include <variant>
 #include <vector>
 #include <Configuration/WorkerConfiguration.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Functions/FieldAccessPhysicalFunction.hpp>
+#include <Functions/VectorizedPredicate.hpp>
 #include <Identifiers/Identifiers.hpp>
+#include <InputFormatters/FieldPredicate.hpp>
 #include <InputFormatters/InputFormatterProvider.hpp>
+#include <MemoryLayout/ColumnLayout.hpp>
+#include <MemoryLayout/MemoryLayout.hpp>
 #include <Pipelines/CompiledExecutablePipelineStage.hpp>
+#include <Pipelines/ForwardingExecutablePipelineStage.hpp>
 #include <Sources/SourceDescriptor.hpp>
 #include <Util/DumpMode.hpp>
 #include <Util/ExecutionMode.hpp>
+#include <Util/Logger/Logger.hpp>
 #include <CompiledQueryPlan.hpp>
+#include <EmitPhysicalOperator.hpp>
 #include <ErrorHandling.hpp>
 #include <ExecutablePipelineStage.hpp>
+#include <MapPhysicalOperator.hpp>
 #include <Pipeline.hpp>
 #include <PipelinedQueryPlan.hpp>
+#include <ScanPhysicalOperator.hpp>
+#include <SelectionPhysicalOperator.hpp>
 #include <SinkPhysicalOperator.hpp>
 #include <SourcePhysicalOperator.hpp>
+#include <UnionPhysicalOperator.hpp>
+#include <UnionRenamePhysicalOperator.hpp>
+#include <magic_enum/magic_enum.hpp>
 #include <options.hpp>
 
 namespace NES
 {
 
+namespace
+{
+/// The input formatter of a source writes the memory layout that the scans of its successor pipelines read.
+/// Sink pipelines read row-wise buffers. If the successors read different layouts, the input formatter falls back to the row layout.
+/// The PipeliningPhase already lets all pipelines that read from a source directly feeding a sink read rows.
+std::shared_ptr<MemoryLayout> getLayoutOfFormattedBuffers(const Pipeline& sourcePipeline)
+{
+    std::shared_ptr<MemoryLayout> formattedBufferLayout;
+    bool readsRows = false;
+    for (const auto& successor : sourcePipeline.getSuccessors())
+    {
+        const auto scan = successor->getRootOperator().tryGet<ScanPhysicalOperator>();
+        const auto successorLayout = scan ? scan->getMemoryLayout() : nullptr;
+        if (std::dynamic_pointer_cast<ColumnLayout>(successorLayout))
+        {
+            formattedBufferLayout = successorLayout;
+        }
+        else
+        {
+            readsRows = true;
+        }
+    }
+    if (formattedBufferLayout and readsRows)
+    {
+        NES_WARNING(
+            "The successors of source pipeline {} read different memory layouts, falling back to the row layout",
+            sourcePipeline.getPipelineId());
+        return nullptr;
+    }
+    return formattedBufferLayout;
+}
+
+/// The input formatter of a source solely parses the fields that the scans of its successor pipelines read, e.g., the fields that a
+/// projection directly after the source accesses. Sink pipelines and other successors read all fields.
+std::optional<std::vector<size_t>> getFieldsReadBySuccessors(const Pipeline& sourcePipeline)
+{
+    std::vector<size_t> readFields;
+    for (const auto& successor : sourcePipeline.getSuccessors())
+    {
+        const auto scan = successor->getRootOperator().tryGet<ScanPhysicalOperator>();
+        if (not scan)
+        {
+            return std::nullopt;
+        }
+        for (const auto& fieldName : scan->getProjections())
+        {
+            const auto fieldIndex = scan->getMemoryLayout()->getFieldIndexFromName(fieldName);
+            INVARIANT(fieldIndex.has_value(), "The scan of pipeline {} reads the unknown field {}", successor->getPipelineId(), fieldName);
+            readFields.emplace_back(fieldIndex.value());
+        }
+    }
+    std::ranges::sort(readFields);
+    const auto duplicates = std::ranges::unique(readFields);
+    readFields.erase(duplicates.begin(), duplicates.end());
+    return readFields;
+}
+
+/// The input formatter of a source skips all tuples that fail a comparison of the selections directly after the scan of its only successor,
+/// e.g., a selection of a single device. The selections still evaluate their predicates, as a predicate may contain further functions and
+/// formats that do not require formatting forward their raw buffers unfiltered.
+std::vector<FieldPredicate> getPredicatesOfSuccessor(const Pipeline& sourcePipeline)
+{
+    if (sourcePipeline.getSuccessors().size() != 1)
+    {
+        return {};
+    }
+    const auto scan = sourcePipeline.getSuccessors().front()->getRootOperator().tryGet<ScanPhysicalOperator>();
+    if (not scan)
+    {
+        return {};
+    }
+
+    std::vector<FieldPredicate> predicates;
+    for (auto current = scan->getChild(); current.has_value(); current = current->getChild())
+    {
+        const auto selection = current->tryGet<SelectionPhysicalOperator>();
+        if (not selection)
+        {
+            break;
+        }
+        /// Binding the predicate to the layout of the scan widens the constants to the types of the fields
+        const auto boundPredicate = selection->getVectorizedPredicate()
+            ? selection->getVectorizedPredicate()->bind(*scan->getMemoryLayout())
+            : std::nullopt;
+        if (not boundPredicate)
+        {
+            continue;
+        }
+        for (const auto& [fieldName, comparison, constant] : boundPredicate->getConjunctiveComparisons())
+        {
+            const auto fieldComparison = magic_enum::enum_cast<FieldPredicate::Comparison>(magic_enum::enum_name(comparison));
+            INVARIANT(fieldComparison.has_value(), "The input formatter lacks the comparison {}", magic_enum::enum_name(comparison));
+            predicates.emplace_back(fieldName, *fieldComparison, constant);
+        }
+    }
+    return predicates;
+}
+
+/// The input formatter of the native format forwards the raw buffers of its source as they are, if its successors read all fields in the
+/// row layout and it does not split the raw buffers into morsels. Then, the source emits its raw buffers directly to the successors, which
+/// skips a task per raw buffer. Successors that read the column layout still require the input formatter to transpose the raw rows.
+/// @return the size of the tuples of the raw buffers, or std::nullopt, if the source requires an input formatter
+std::optional<size_t> getTupleSizeOfFormattedRawBuffers(const Pipeline& sourcePipeline, const SourcePhysicalOperator& sourceOperator)
+{
+    const auto& schema = *sourceOperator.getDescriptor().getLogicalSource().getSchema();
+    const auto& parserConfig = sourceOperator.getDescriptor().getParserConfig();
+    if (parserConfig.parserType != "Native" or parserConfig.maxBytesPerFormattingTask != 0 or getLayoutOfFormattedBuffers(sourcePipeline)
+        or sourceOperator.getFormattedSchema().getNumberOfFields() != schema.getNumberOfFields() or schema.getSizeOfSchemaInBytes() == 0)
+    {
+        return std::nullopt;
+    }
+    return schema.getSizeOfSchemaInBytes();
+}
+
+/// Both layouts place every field of a tuple at the same position of a buffer of the same size
+bool haveSamePhysicalLayout(const MemoryLayout& lhs, const MemoryLayout& rhs)
+{
+    if (typeid(lhs) != typeid(rhs) or lhs.getBufferSize() != rhs.getBufferSize()
+        or lhs.getSchema().getNumberOfFields() != rhs.getSchema().getNumberOfFields())
+    {
+        return false;
+    }
+    return std::ranges::all_of(
+        std::views::iota(0UL, lhs.getSchema().getNumberOfFields()),
+        [&](const uint64_t fieldIndex) { return lhs.getPhysicalType(fieldIndex) == rhs.getPhysicalType(fieldIndex); });
+}
+
+/// A pipeline forwards its input buffers, if it solely renames fields, e.g., a union rename or a projection that keeps all fields in their
+/// order, and its emit writes the layout that its scan reads. Then, the emit would write each field to the position that it was read from.
+bool forwardsInputBuffers(const Pipeline& pipeline)
+{
+    const auto scan = pipeline.getRootOperator().tryGet<ScanPhysicalOperator>();
+    if (not scan)
+    {
+        return false;
+    }
+    /// Tracks the index of the scanned field that each field of the current record holds
+    const auto scanLayout = scan->getMemoryLayout();
+    std::unordered_map<std::string, uint64_t> scannedFieldIndexes;
+    for (const auto& fieldName : scan->getProjections())
+    {
+        const auto fieldIndex = scanLayout->getFieldIndexFromName(fieldName);
+        INVARIANT(fieldIndex.has_value(), "The scan of pipeline {} reads the unknown field {}", pipeline.getPipelineId(), fieldName);
+        scannedFieldIndexes.emplace(fieldName, fieldIndex.value());
+    }
+
+    for (auto current = scan->getChild(); current.has_value(); current = current->getChild())
+    {
+        if (const auto emit = current->tryGet<EmitPhysicalOperator>())
+        {
+            const auto emitLayout = emit->getMemoryLayout();
+            if (emit->getChild().has_value() or emit->coalescesInvocationsOfWorkerThreads()
+                or not haveSamePhysicalLayout(*scanLayout, *emitLayout))
+            {
+                return false;
+            }
+            return std::ranges::all_of(
+                std::views::iota(0UL, emitLayout->getSchema().getNumberOfFields()),
+                [&](const uint64_t fieldIndex)
+                {
+                    const auto scannedField = scannedFieldIndexes.find(emitLayout->getSchema().getFieldAt(fieldIndex).name);
+                    return scannedField != scannedFieldIndexes.end() and scannedField->second == fieldIndex;
+                });
+        }
+        if (const auto rename = current->tryGet<UnionRenamePhysicalOperator>())
+        {
+            std::unordered_map<std::string, uint64_t> renamedFieldIndexes;
+            for (const auto& [inputField, outputField] : std::views::zip(rename->getInputFields(), rename->getOutputFields()))
+            {
+                const auto scannedField = scannedFieldIndexes.find(inputField);
+                if (scannedField == scannedFieldIndexes.end())
+                {
+                    return false;
+                }
+                renamedFieldIndexes.emplace(outputField, scannedField->second);
+            }
+            scannedFieldIndexes = std::move(renamedFieldIndexes);
+        }
+        else if (const auto map = current->tryGet<MapPhysicalOperator>())
+        {
+            const auto fieldAccess = map->getMapFunction().tryGet<FieldAccessPhysicalFunction>();
+            const auto scannedField = fieldAccess ? scannedFieldIndexes.find(fieldAccess->getField()) : scannedFieldIndexes.end();
+            if (scannedField == scannedFieldIndexes.end())
+            {
+                return false;
+            }
+            scannedFieldIndexes.insert_or_assign(map->getFieldToWriteTo(), scannedField->second);
+        }
+        else if (not current->tryGet<UnionPhysicalOperator>())
+        {
+            return false;
+        }
+    }
+    return false;
+}
+}
+
 LowerToCompiledQueryPlanPhase::Successor
 LowerToCompiledQueryPlanPhase::processSuccessor(const Predecessor& predecessor, const std::shared_ptr<Pipeline>& pipeline)
 {
@@ -61,9 +277,35 @@ void LowerToCompiledQueryPlanPhase::processSource(const std::shared_ptr<Pipeline
     /// Convert logical source descriptor to actual source descriptor
     const auto sourceOperator = pipeline->getRootOperator().get<SourcePhysicalOperator>();
 
+    if (const auto formattedTupleSizeInBytes = getTupleSizeOfFormattedRawBuffers(*pipeline, sourceOperator))
+    {
+        NES_DEBUG("Source {} emits its raw buffers without an input formatter", sourceOperator.getOriginId());
+        std::vector<std::weak_ptr<ExecutablePipeline>> executableSuccessors;
+        for (const auto& successor : pipeline->getSuccessors())
+        {
+            if (auto executableSuccessor = processSuccessor(sourceOperator.id, successor))
+            {
+                executableSuccessors.emplace_back(*executableSuccessor);
+            }
+        }
+        pipelineQueryPlan->removePipeline(*pipeline);
+        sources.emplace_back(
+            sourceOperator.getOriginId(),
+            sourceOperator.id,
+            sourceOperator.getDescriptor(),
+            std::move(executableSuccessors),
+            *formattedTupleSizeInBytes);
+        return;
+    }
+
     const std::vector<std::shared_ptr<ExecutablePipeline>> executableSuccessorPipelines;
     auto inputFormatterTaskPipeline = provideInputFormatterTask(
-        *sourceOperator.getDescriptor().getLogicalSource().getSchema(), sourceOperator.getDescriptor().getParserConfig());
+        *sourceOperator.getDescriptor().getLogicalSource().getSchema(),
+        sourceOperator.getDescriptor().getParserConfig(),
+        getLayoutOfFormattedBuffers(*pipeline),
+        getFieldsReadBySuccessors(*pipeline),
+        sourceOperator.getFormattedSchema(),
+        getPredicatesOfSuccessor(*pipeline));
 
     auto executableInputFormatterPipeline
         = ExecutablePipeline::create(pipeline->getPipelineId(), std::move(inputFormatterTaskPipeline), executableSuccessorPipelines);
@@ -104,9 +346,11 @@ std::unique_ptr<ExecutablePipelineStage> LowerToCompiledQueryPlanPhase::getStage
     nautilus::engine::Options options;
     /// We disable multithreading in MLIR by default to not interfere with NebulaStream's thread model
     options.setOption("mlir.enableMultithreading", false);
-    switch (pipelineQueryPlan->getExecutionMode())
+    const auto executionMode = pipelineQueryPlan->getExecutionMode();
+    switch (executionMode)
     {
-        case ExecutionMode::COMPILER: {
+        case ExecutionMode::COMPILER:
+        case ExecutionMode::TIERED: {
             options.setOption("engine.Compilation", true);
             break;
         }
@@ -142,7 +386,13 @@ std::unique_ptr<ExecutablePipelineStage> LowerToCompiledQueryPlanPhase::getStage
             options.setOption("dump.file", true);
             break;
     }
-    return std::make_unique<CompiledExecutablePipelineStage>(pipeline, pipeline->getOperatorHandlers(), options);
+    return std::make_unique<CompiledExecutablePipelineStage>(
+        pipeline,
+        pipeline->getOperatorHandlers(),
+        options,
+        executionMode == ExecutionMode::TIERED,
+        numberOfRetainedArenaBuffers,
+        profileOperators);
 }
 
 std::shared_ptr<ExecutablePipeline> LowerToCompiledQueryPlanPhase::processOperatorPipeline(const std::shared_ptr<Pipeline>& pipeline)
@@ -152,7 +402,17 @@ std::shared_ptr<ExecutablePipeline> LowerToCompiledQueryPlanPhase::processOperat
     {
         return executable->second;
     }
-    auto executablePipeline = ExecutablePipeline::create(PipelineId(pipeline->getPipelineId()), getStage(pipeline), {});
+    std::unique_ptr<ExecutablePipelineStage> stage;
+    if (forwardsInputBuffers(*pipeline))
+    {
+        NES_DEBUG("Pipeline {} forwards its input buffers without compiling it", pipeline->getPipelineId());
+        stage = std::make_unique<ForwardingExecutablePipelineStage>(pipeline->getPipelineId());
+    }
+    else
+    {
+        stage = getStage(pipeline);
+    }
+    auto executablePipeline = ExecutablePipeline::create(PipelineId(pipeline->getPipelineId()), std::move(stage), {});
 
     for (const auto& successor : pipeline->getSuccessors())
     {
@@ -14,24 +14,32 @@
 
 #include <Phases/PipeliningPhase.hpp>
 
+#include <algorithm>
+#include <chrono>
 #include <cstdint>
 #include <memory>
 #include <unordered_map>
 #include <utility>
+#include <DataTypes/Schema.hpp>
+#include <DataTypes/DataType.hpp>
 #include <Identifiers/Identifiers.hpp>
 #include <MemoryLayout/RowLayout.hpp>
-#include <Nautilus/Interface/BufferRef/RowTupleBufferRef.hpp>
+#include <Nautilus/Interface/BufferRef/TupleBufferRef.hpp>
 #include <Runtime/Execution/OperatorHandler.hpp>
 #include <Util/Logger/Logger.hpp>
 #include <EmitOperatorHandler.hpp>
 #include <EmitPhysicalOperator.hpp>
 #include <ErrorHandling.hpp>
+#include <MapPhysicalOperator.hpp>
 #include <PhysicalOperator.hpp>
 #include <PhysicalPlan.hpp>
 #include <Pipeline.hpp>
 #include <PipelinedQueryPlan.hpp>
 #include <ScanPhysicalOperator.hpp>
+#include <SelectionPhysicalOperator.hpp>
 #include <SinkPhysicalOperator.hpp>
+#include <UnionPhysicalOperator.hpp>
+#include <UnionRenamePhysicalOperator.hpp>
 
 namespace NES::QueryCompilation::PipeliningPhase
 {
@@ -41,18 +49,40 @@ namespace
 
 using OperatorPipelineMap = std::unordered_map<OperatorId, std::shared_ptr<Pipeline>>;
 
+/// Describes the buffers that default scans and emits read and write
+/// @note Once we have refactored the memory layout and schema we can get rid of the configured buffer size.
+struct BufferLayout
+{
+    uint64_t bufferSize;
+    /// Emits that feed a sink coalesce the records of multiple invocations for at most this delay, if it is not zero
+    std::chrono::milliseconds emitCoalescingMaxDelay;
+    /// Layout of buffers between operator pipelines
+    Schema::MemoryLayoutType memoryLayout;
+    /// Layout of the buffers that the input formatter of the current source writes
+    Schema::MemoryLayoutType sourceMemoryLayout;
+};
+
+std::shared_ptr<Interface::BufferRef::TupleBufferRef>
+createBufferRef(const uint64_t bufferSize, Schema schema, const Schema::MemoryLayoutType memoryLayout)
+{
+    schema.memoryLayoutType = memoryLayout;
+    return Interface::BufferRef::TupleBufferRef::create(bufferSize, schema);
+}
+
 /// Helper function to add a default scan operator
 /// This is used only when the wrapped operator does not already provide a scan
-/// @note Once we have refactored the memory layout and schema we can get rid of the configured buffer size.
 /// Do not add further parameters here that should be part of the QueryExecutionConfiguration.
-void addDefaultScan(const std::shared_ptr<Pipeline>& pipeline, const PhysicalOperatorWrapper& wrappedOp, uint64_t configuredBufferSize)
+void addDefaultScan(
+    const std::shared_ptr<Pipeline>& pipeline,
+    const PhysicalOperatorWrapper& wrappedOp,
+    const uint64_t configuredBufferSize,
+    const Schema::MemoryLayoutType memoryLayout)
 {
     PRECONDITION(pipeline->isOperatorPipeline(), "Only add scan physical operator to operator pipelines");
     auto schema = wrappedOp.getInputSchema();
     INVARIANT(schema.has_value(), "Wrapped operator has no input schema");
 
-    auto layout = std::make_shared<RowLayout>(configuredBufferSize, schema.value());
-    const auto bufferRef = std::make_shared<Interface::BufferRef::RowTupleBufferRef>(layout);
+    const auto bufferRef = createBufferRef(configuredBufferSize, schema.value(), memoryLayout);
     /// Prepend the default scan operator.
     pipeline->prependOperator(ScanPhysicalOperator(bufferRef, schema->getFieldNames()));
 }
@@ -62,13 +92,12 @@ std::shared_ptr<Pipeline> createNewPiplineWithScan(
     const std::shared_ptr<Pipeline>& prevPipeline,
     OperatorPipelineMap& pipelineMap,
     const PhysicalOperatorWrapper& wrappedOpAfterScan,
-    uint64_t configuredBufferSize)
+    const BufferLayout& bufferLayout)
 {
     auto schema = wrappedOpAfterScan.getInputSchema();
     INVARIANT(schema.has_value(), "Wrapped operator has no input schema");
 
-    auto layout = std::make_shared<RowLayout>(configuredBufferSize, schema.value());
-    const auto bufferRef = std::make_shared<Interface::BufferRef::RowTupleBufferRef>(layout);
+    const auto bufferRef = createBufferRef(bufferLayout.bufferSize, schema.value(), bufferLayout.memoryLayout);
 
     const auto newPipeline = std::make_shared<Pipeline>(ScanPhysicalOperator(bufferRef, schema->getFieldNames()));
     prevPipeline->addSuccessor(newPipeline, prevPipeline);
@@ -77,22 +106,61 @@ std::shared_ptr<Pipeline> createNewPiplineWithScan(
     return newPipeline;
 }
 
+/// An emit may write its records into the exclusively owned input buffer of the pipeline, if the pipeline reads every input record before
+/// the emit writes any record at or behind its position. This is the case for a scan of row-wise buffers, which solely maps, selects, and
+/// renames its records, and whose output records do not exceed the size of its input records.
+/// Scans of var sized values point into the input records, thus the emit may overwrite a value that an operator did not read yet.
+bool reusesInputBuffers(const Pipeline& pipeline, const MemoryLayout& emitLayout)
+{
+    const auto scan = pipeline.getRootOperator().tryGet<ScanPhysicalOperator>();
+    if (not scan)
+    {
+        return false;
+    }
+    const auto scanLayout = scan->getMemoryLayout();
+    if (not std::dynamic_pointer_cast<RowLayout>(scanLayout) or not dynamic_cast<const RowLayout*>(&emitLayout)
+        or scanLayout->getBufferSize() != emitLayout.getBufferSize() or emitLayout.getTupleSize() > scanLayout->getTupleSize()
+        or std::ranges::any_of(
+            scanLayout->getSchema().getFields(), [](const auto& field) { return field.dataType.isType(DataType::Type::VARSIZED); }))
+    {
+        return false;
+    }
+
+    for (auto current = scan->getChild(); current.has_value(); current = current->getChild())
+    {
+        if (not current->tryGet<MapPhysicalOperator>() and not current->tryGet<SelectionPhysicalOperator>()
+            and not current->tryGet<UnionRenamePhysicalOperator>() and not current->tryGet<UnionPhysicalOperator>())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 /// Helper function to add a default emit operator
 /// This is used only when the wrapped operator does not already provide an emit
-/// @note Once we have refactored the memory layout and schema we can get rid of the configured buffer size.
+/// Sinks expect row-wise buffers, thus emits which feed a sink always write rows.
 /// Do not add further parameters here that should be part of the QueryExecutionConfiguration.
-void addDefaultEmit(const std::shared_ptr<Pipeline>& pipeline, const PhysicalOperatorWrapper& wrappedOp, uint64_t configuredBufferSize)
+void addDefaultEmit(
+    const std::shared_ptr<Pipeline>& pipeline,
+    const PhysicalOperatorWrapper& wrappedOp,
+    const BufferLayout& bufferLayout,
+    const bool emitsToSink)
 {
     PRECONDITION(pipeline->isOperatorPipeline(), "Only add emit physical operator to operator pipelines");
     auto schema = wrappedOp.getOutputSchema();
     INVARIANT(schema.has_value(), "Wrapped operator has no output schema");
 
-    auto layout = std::make_shared<RowLayout>(configuredBufferSize, schema.value());
-    const auto bufferRef = std::make_shared<Interface::BufferRef::RowTupleBufferRef>(layout);
+    const auto memoryLayout = emitsToSink ? Schema::MemoryLayoutType::ROW_LAYOUT : bufferLayout.memoryLayout;
+    const auto bufferRef = createBufferRef(bufferLayout.bufferSize, schema.value(), memoryLayout);
     /// Create an operator handler for the emit
+    /// Other pipelines rely on the sequence numbers of their input, thus solely emits that feed a sink coalesce invocations
+    const auto coalescesInvocations = emitsToSink and bufferLayout.emitCoalescingMaxDelay > std::chrono::milliseconds::zero();
     const OperatorHandlerId operatorHandlerIndex = getNextOperatorHandlerId();
-    pipeline->getOperatorHandlers().emplace(operatorHandlerIndex, std::make_shared<EmitOperatorHandler>());
-    pipeline->appendOperator(EmitPhysicalOperator(operatorHandlerIndex, bufferRef));
+    pipeline->getOperatorHandlers().emplace(
+        operatorHandlerIndex, std::make_shared<EmitOperatorHandler>(bufferLayout.emitCoalescingMaxDelay));
+    const auto reusesInput = not coalescesInvocations and reusesInputBuffers(*pipeline, *bufferRef->getMemoryLayout());
+    pipeline->appendOperator(EmitPhysicalOperator(operatorHandlerIndex, bufferRef, coalescesInvocations, reusesInput));
 }
 
 enum class PipelinePolicy : uint8_t
@@ -107,7 +175,7 @@ void buildPipelineRecursively(
     const std::shared_ptr<Pipeline>& currentPipeline,
     OperatorPipelineMap& pipelineMap,
     PipelinePolicy policy,
-    uint64_t configuredBufferSize)
+    const BufferLayout& bufferLayout)
 {
     /// Check if we've already seen this operator
     const OperatorId opId = opWrapper->getPhysicalOperator().getId();
@@ -115,7 +183,7 @@ void buildPipelineRecursively(
     {
         if (prevOpWrapper and prevOpWrapper->getPipelineLocation() != PhysicalOperatorWrapper::PipelineLocation::EMIT)
         {
-            addDefaultEmit(currentPipeline, *prevOpWrapper, configuredBufferSize);
+            addDefaultEmit(currentPipeline, *prevOpWrapper, bufferLayout, it->second->isSinkPipeline());
         }
         currentPipeline->addSuccessor(it->second, currentPipeline);
         return;
@@ -124,9 +192,22 @@ void buildPipelineRecursively(
     /// Case 1: Custom Scan
     if (opWrapper->getPipelineLocation() == PhysicalOperatorWrapper::PipelineLocation::SCAN)
     {
+        /// A buffer scan, e.g., of a projection, following a fusible operator, e.g., a union rename or a window probe, would solely read
+        /// the records that the current pipeline already holds. Thus, we fuse its children into the current pipeline instead of
+        /// materializing the records. The emit of the current pipeline writes solely the fields of its output schema.
+        if (opWrapper->getPhysicalOperator().tryGet<ScanPhysicalOperator>() and prevOpWrapper
+            and prevOpWrapper->getPipelineLocation() != PhysicalOperatorWrapper::PipelineLocation::EMIT
+            and currentPipeline->isOperatorPipeline())
+        {
+            for (auto& child : opWrapper->getChildren())
+            {
+                buildPipelineRecursively(child, opWrapper, currentPipeline, pipelineMap, PipelinePolicy::Continue, bufferLayout);
+            }
+            return;
+        }
         if (prevOpWrapper && prevOpWrapper->getPipelineLocation() != PhysicalOperatorWrapper::PipelineLocation::EMIT)
         {
-            addDefaultEmit(currentPipeline, *prevOpWrapper, configuredBufferSize);
+            addDefaultEmit(currentPipeline, *prevOpWrapper, bufferLayout, false);
         }
         auto newPipeline = std::make_shared<Pipeline>(opWrapper->getPhysicalOperator());
         if (opWrapper->getHandler() && opWrapper->getHandlerId())
@@ -138,7 +219,7 @@ void buildPipelineRecursively(
         const auto newPipelinePtr = currentPipeline->getSuccessors().back();
         for (auto& child : opWrapper->getChildren())
         {
-            buildPipelineRecursively(child, opWrapper, newPipelinePtr, pipelineMap, PipelinePolicy::Continue, configuredBufferSize);
+            buildPipelineRecursively(child, opWrapper, newPipelinePtr, pipelineMap, PipelinePolicy::Continue, bufferLayout);
         }
         return;
     }
@@ -151,7 +232,7 @@ void buildPipelineRecursively(
         {
             /// If the current operator is an emit operator and the prev operator was also an emit operator, we need to add a scan before the
             /// current operator to create a new pipeline
-            auto newPipeline = createNewPiplineWithScan(currentPipeline, pipelineMap, *opWrapper, configuredBufferSize);
+            auto newPipeline = createNewPiplineWithScan(currentPipeline, pipelineMap, *opWrapper, bufferLayout);
             if (opWrapper->getHandler().has_value())
             {
                 /// Create an operator handler for the custom emit operator
@@ -161,7 +242,7 @@ void buildPipelineRecursively(
 
             for (auto& child : opWrapper->getChildren())
             {
-                buildPipelineRecursively(child, opWrapper, newPipeline, pipelineMap, PipelinePolicy::ForceNew, configuredBufferSize);
+                buildPipelineRecursively(child, opWrapper, newPipeline, pipelineMap, PipelinePolicy::ForceNew, bufferLayout);
             }
         }
         else
@@ -173,7 +254,7 @@ void buildPipelineRecursively(
             }
             for (auto& child : opWrapper->getChildren())
             {
-                buildPipelineRecursively(child, opWrapper, currentPipeline, pipelineMap, PipelinePolicy::ForceNew, configuredBufferSize);
+                buildPipelineRecursively(child, opWrapper, currentPipeline, pipelineMap, PipelinePolicy::ForceNew, bufferLayout);
             }
         }
 
@@ -186,7 +267,7 @@ void buildPipelineRecursively(
         /// Add emit first if there is one needed
         if (prevOpWrapper and prevOpWrapper->getPipelineLocation() != PhysicalOperatorWrapper::PipelineLocation::EMIT)
         {
-            addDefaultEmit(currentPipeline, *prevOpWrapper, configuredBufferSize);
+            addDefaultEmit(currentPipeline, *prevOpWrapper, bufferLayout, true);
         }
         const auto newPipeline = std::make_shared<Pipeline>(*sink);
         currentPipeline->addSuccessor(newPipeline, currentPipeline);
@@ -194,7 +275,7 @@ void buildPipelineRecursively(
         pipelineMap.emplace(opId, newPipelinePtr);
         for (auto& child : opWrapper->getChildren())
         {
-            buildPipelineRecursively(child, opWrapper, newPipelinePtr, pipelineMap, PipelinePolicy::Continue, configuredBufferSize);
+            buildPipelineRecursively(child, opWrapper, newPipelinePtr, pipelineMap, PipelinePolicy::Continue, bufferLayout);
         }
         return;
     }
@@ -204,7 +285,7 @@ void buildPipelineRecursively(
     {
         if (prevOpWrapper and prevOpWrapper->getPipelineLocation() != PhysicalOperatorWrapper::PipelineLocation::EMIT)
         {
-            addDefaultEmit(currentPipeline, *opWrapper, configuredBufferSize);
+            addDefaultEmit(currentPipeline, *opWrapper, bufferLayout, false);
         }
         const auto newPipeline = std::make_shared<Pipeline>(opWrapper->getPhysicalOperator());
         if (auto handlerId = opWrapper->getHandlerId())
@@ -214,10 +295,12 @@ void buildPipelineRecursively(
         currentPipeline->addSuccessor(newPipeline, currentPipeline);
         const auto newPipelinePtr = currentPipeline->getSuccessors().back();
         pipelineMap[opId] = newPipelinePtr;
-        addDefaultScan(newPipelinePtr, *opWrapper, configuredBufferSize);
+        /// Without a previous operator, the new pipeline directly reads the buffers of the input formatter of a source
+        const auto scanLayout = prevOpWrapper ? bufferLayout.memoryLayout : bufferLayout.sourceMemoryLayout;
+        addDefaultScan(newPipelinePtr, *opWrapper, bufferLayout.bufferSize, scanLayout);
         for (auto& child : opWrapper->getChildren())
         {
-            buildPipelineRecursively(child, opWrapper, newPipelinePtr, pipelineMap, PipelinePolicy::Continue, configuredBufferSize);
+            buildPipelineRecursively(child, opWrapper, newPipelinePtr, pipelineMap, PipelinePolicy::Continue, bufferLayout);
         }
         return;
     }
@@ -227,7 +310,7 @@ void buildPipelineRecursively(
     {
         /// If the current operator is a fusible operator and the prev operator was an emit operator, we need to add a scan before the
         /// current operator to create a new pipeline.
-        createNewPiplineWithScan(currentPipeline, pipelineMap, *opWrapper, configuredBufferSize);
+        createNewPiplineWithScan(currentPipeline, pipelineMap, *opWrapper, bufferLayout);
     }
     else
     {
@@ -240,13 +323,13 @@ void buildPipelineRecursively(
     }
     if (opWrapper->getChildren().empty())
     {
-        addDefaultEmit(currentPipeline, *opWrapper, configuredBufferSize);
+        addDefaultEmit(currentPipeline, *opWrapper, bufferLayout, false);
     }
     else
     {
         for (auto& child : opWrapper->getChildren())
         {
-            buildPipelineRecursively(child, opWrapper, currentPipeline, pipelineMap, PipelinePolicy::Continue, configuredBufferSize);
+            buildPipelineRecursively(child, opWrapper, currentPipeline, pipelineMap, PipelinePolicy::Continue, bufferLayout);
         }
     }
 }
@@ -256,6 +339,7 @@ void buildPipelineRecursively(
 std::shared_ptr<PipelinedQueryPlan> apply(const PhysicalPlan& physicalPlan)
 {
     const uint64_t configuredBufferSize = physicalPlan.getOperatorBufferSize();
+    const auto memoryLayout = physicalPlan.getOperatorMemoryLayout();
     auto pipelinedPlan = std::make_shared<PipelinedQueryPlan>(physicalPlan.getQueryId(), physicalPlan.getExecutionMode());
 
     OperatorPipelineMap pipelineMap;
@@ -267,9 +351,20 @@ std::shared_ptr<PipelinedQueryPlan> apply(const PhysicalPlan& physicalPlan)
         pipelineMap.emplace(opId, rootPipeline);
         pipelinedPlan->addPipeline(rootPipeline);
 
+        /// The input formatter writes the layout of the pipelines reading from the source. If the source directly feeds a sink, which
+        /// expects rows, all pipelines reading from the source have to read rows as well.
+        const auto feedsSink = std::ranges::any_of(
+            rootWrapper->getChildren(),
+            [](const std::shared_ptr<PhysicalOperatorWrapper>& child)
+            { return child->getPhysicalOperator().tryGet<SinkPhysicalOperator>().has_value(); });
+        const BufferLayout bufferLayout{
+            .bufferSize = configuredBufferSize,
+            .emitCoalescingMaxDelay = physicalPlan.getEmitCoalescingMaxDelay(),
+            .memoryLayout = memoryLayout,
+            .sourceMemoryLayout = feedsSink ? Schema::MemoryLayoutType::ROW_LAYOUT : memoryLayout};
         for (const auto& child : rootWrapper->getChildren())
         {
-            buildPipelineRecursively(child, nullptr, rootPipeline, pipelineMap, PipelinePolicy::ForceNew, configuredBufferSize);
+            buildPipelineRecursively(child, nullptr, rootPipeline, pipelineMap, PipelinePolicy::ForceNew, bufferLayout);
         }
     }
 
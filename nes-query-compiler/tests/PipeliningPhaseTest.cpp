@@ -0,0 +1,364 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Functions/FieldAccessPhysicalFunction.hpp>
+#include <Identifiers/Identifiers.hpp>
+#include <Nautilus/Interface/BufferRef/TupleBufferRef.hpp>
+#include <Phases/PipeliningPhase.hpp>
+#include <Sinks/SinkCatalog.hpp>
+#include <Sources/SourceCatalog.hpp>
+#include <Util/ExecutionMode.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+#include <EmitPhysicalOperator.hpp>
+#include <MapPhysicalOperator.hpp>
+#include <PhysicalOperator.hpp>
+#include <PhysicalPlan.hpp>
+#include <PhysicalPlanBuilder.hpp>
+#include <Pipeline.hpp>
+#include <PipelinedQueryPlan.hpp>
+#include <ScanPhysicalOperator.hpp>
+#include <SinkPhysicalOperator.hpp>
+#include <SourcePhysicalOperator.hpp>
+#include <UnionPhysicalOperator.hpp>
+#include <UnionRenamePhysicalOperator.hpp>
+
+namespace NES
+{
+
+namespace
+{
+constexpr uint64_t BUFFER_SIZE = 4096;
+
+using Location = PhysicalOperatorWrapper::PipelineLocation;
+using Wrappers = std::vector<std::shared_ptr<PhysicalOperatorWrapper>>;
+/// Pairs of the projected field and the input field that it reads
+using Projections = std::vector<std::pair<std::string, std::string>>;
+
+/// Stands in for the build and the probe of a window or join, as the pipelining phase solely considers their pipeline locations
+struct StubPhysicalOperator final : PhysicalOperatorConcept
+{
+    [[nodiscard]] std::optional<PhysicalOperator> getChild() const override { return child; }
+
+    void setChild(PhysicalOperator newChild) override { child = std::move(newChild); }
+
+    std::optional<PhysicalOperator> child;
+};
+
+Schema createSchema(const std::vector<std::string>& fieldNames)
+{
+    Schema schema;
+    for (const auto& fieldName : fieldNames)
+    {
+        schema.addField(fieldName, DataType::Type::UINT64);
+    }
+    return schema;
+}
+
+std::shared_ptr<PhysicalOperatorWrapper> wrap(
+    PhysicalOperator physicalOperator,
+    const Schema& inputSchema,
+    const Schema& outputSchema,
+    const Location location,
+    Wrappers children = {})
+{
+    return std::make_shared<PhysicalOperatorWrapper>(
+        std::move(physicalOperator), inputSchema, outputSchema, std::nullopt, std::nullopt, location, std::move(children));
+}
+
+/// Lowers a projection like the LowerToPhysicalProjection rule, i.e., to a buffer scan followed by one map per projected field.
+/// As the plan is built from the sink to the sources, the input is the child of the scan and the last map is returned.
+std::shared_ptr<PhysicalOperatorWrapper> createProjection(const Schema& inputSchema, const Projections& projections, Wrappers input)
+{
+    std::vector<std::string> projectedFields;
+    std::vector<std::string> accessedFields;
+    for (const auto& [projectedField, accessedField] : projections)
+    {
+        projectedFields.emplace_back(projectedField);
+        accessedFields.emplace_back(accessedField);
+    }
+    const auto outputSchema = createSchema(projectedFields);
+    const auto scan = ScanPhysicalOperator(Interface::BufferRef::TupleBufferRef::create(BUFFER_SIZE, inputSchema), accessedFields);
+    auto child = wrap(scan, outputSchema, outputSchema, Location::SCAN, std::move(input));
+    for (const auto& [projectedField, accessedField] : projections)
+    {
+        child = wrap(
+            MapPhysicalOperator(projectedField, FieldAccessPhysicalFunction(accessedField)),
+            outputSchema,
+            outputSchema,
+            Location::INTERMEDIATE,
+            {child});
+    }
+    return child;
+}
+
+PhysicalPlan createPlan(std::shared_ptr<PhysicalOperatorWrapper> sink)
+{
+    PhysicalPlanBuilder builder(INITIAL<QueryId>);
+    builder.addSinkRoot(std::move(sink));
+    builder.setExecutionMode(ExecutionMode::INTERPRETER);
+    builder.setOperatorBufferSize(BUFFER_SIZE);
+    return std::move(builder).finalize();
+}
+
+/// Operators of the pipeline from its root to its last operator
+std::vector<PhysicalOperator> getOperators(const Pipeline& pipeline)
+{
+    std::vector<PhysicalOperator> operators;
+    for (std::optional current = pipeline.getRootOperator(); current.has_value(); current = current->getChild())
+    {
+        operators.emplace_back(*current);
+    }
+    return operators;
+}
+
+size_t countPipelines(const PipelinedQueryPlan& plan)
+{
+    std::unordered_set<const Pipeline*> visited;
+    auto visit = [&visited](const std::shared_ptr<Pipeline>& pipeline, auto&& self) -> void
+    {
+        if (visited.insert(pipeline.get()).second)
+        {
+            for (const auto& successor : pipeline->getSuccessors())
+            {
+                self(successor, self);
+            }
+        }
+    };
+    for (const auto& pipeline : plan.getPipelines())
+    {
+        visit(pipeline, visit);
+    }
+    return visited.size();
+}
+
+size_t countScans(const std::vector<PhysicalOperator>& operators)
+{
+    return std::ranges::count_if(operators, [](const auto& op) { return op.template tryGet<ScanPhysicalOperator>().has_value(); });
+}
+}
+
+/// Checks that the pipelining phase fuses the maps of a projection into the pipeline of the preceding operator instead of starting a
+/// pipeline at the buffer scan of the projection. The systests in operator/projection/ProjectionFusion.test check the produced records.
+class PipeliningPhaseTest : public Testing::BaseUnitTest
+{
+public:
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("PipeliningPhaseTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup PipeliningPhaseTest test class.");
+    }
+
+protected:
+    std::shared_ptr<PhysicalOperatorWrapper> createSource(const std::string& name, const Schema& schema)
+    {
+        const auto logicalSource = sourceCatalog.addLogicalSource(name, schema);
+        EXPECT_TRUE(logicalSource.has_value());
+        auto descriptor = sourceCatalog.addPhysicalSource(*logicalSource, "File", {{"file_path", "/dev/null"}}, {{"type", "CSV"}});
+        EXPECT_TRUE(descriptor.has_value());
+        const auto originId = OriginId(nextOriginId++);
+        return wrap(SourcePhysicalOperator(std::move(*descriptor), originId), schema, schema, Location::INTERMEDIATE);
+    }
+
+    std::shared_ptr<PhysicalOperatorWrapper> createSink(const Schema& schema, std::shared_ptr<PhysicalOperatorWrapper> input)
+    {
+        const auto descriptor = sinkCatalog.addSinkDescriptor("sink", schema, "Print", {{"input_format", "CSV"}});
+        EXPECT_TRUE(descriptor.has_value());
+        return wrap(SinkPhysicalOperator(*descriptor), schema, schema, Location::INTERMEDIATE, {std::move(input)});
+    }
+
+    /// A map that precedes the projection within the pipeline that reads the source
+    static std::shared_ptr<PhysicalOperatorWrapper> createMap(const Schema& schema, std::shared_ptr<PhysicalOperatorWrapper> input)
+    {
+        return wrap(
+            MapPhysicalOperator("value", FieldAccessPhysicalFunction("value")), schema, schema, Location::INTERMEDIATE, {std::move(input)});
+    }
+
+    /// Expects that the operator is an emit, which writes exactly the given fields
+    static void expectEmit(const PhysicalOperator& op, const std::vector<std::string>& fieldNames)
+    {
+        const auto emit = op.tryGet<EmitPhysicalOperator>();
+        ASSERT_TRUE(emit.has_value());
+        EXPECT_EQ(emit->getMemoryLayout()->getSchema().getFieldNames(), fieldNames);
+    }
+
+    SourceCatalog sourceCatalog;
+    SinkCatalog sinkCatalog;
+    uint64_t nextOriginId = 1;
+};
+
+TEST_F(PipeliningPhaseTest, ProjectionAfterUnionIsFusedIntoEveryUnionPipeline)
+{
+    const auto leftSchema = createSchema({"id", "value"});
+    const auto rightSchema = createSchema({"key", "amount"});
+    const auto unionSchema = createSchema({"id", "value"});
+    const Wrappers renames{
+        wrap(
+            UnionRenamePhysicalOperator(leftSchema.getFieldNames(), unionSchema.getFieldNames()),
+            leftSchema,
+            unionSchema,
+            Location::INTERMEDIATE,
+            {createSource("left", leftSchema)}),
+        wrap(
+            UnionRenamePhysicalOperator(rightSchema.getFieldNames(), unionSchema.getFieldNames()),
+            rightSchema,
+            unionSchema,
+            Location::INTERMEDIATE,
+            {createSource("right", rightSchema)})};
+    const auto unionWrapper = wrap(UnionPhysicalOperator(), unionSchema, unionSchema, Location::INTERMEDIATE, renames);
+    const auto projection = createProjection(unionSchema, {{"value", "value"}}, {unionWrapper});
+    const auto sink = createSink(createSchema({"value"}), projection);
+
+    const auto pipelinedPlan = QueryCompilation::PipeliningPhase::apply(createPlan(sink));
+
+    /// Both sources feed their own union pipeline, which ends with the projection, and both union pipelines feed the same sink
+    ASSERT_EQ(pipelinedPlan->getPipelines().size(), 2);
+    EXPECT_EQ(countPipelines(*pipelinedPlan), 5);
+    std::shared_ptr<Pipeline> sinkPipeline;
+    for (const auto& sourcePipeline : pipelinedPlan->getPipelines())
+    {
+        ASSERT_TRUE(sourcePipeline->isSourcePipeline());
+        ASSERT_EQ(sourcePipeline->getSuccessors().size(), 1);
+        const auto& unionPipeline = *sourcePipeline->getSuccessors().front();
+        const auto operators = getOperators(unionPipeline);
+        ASSERT_EQ(operators.size(), 5);
+        EXPECT_TRUE(operators[0].tryGet<ScanPhysicalOperator>().has_value());
+        EXPECT_TRUE(operators[1].tryGet<UnionRenamePhysicalOperator>().has_value());
+        EXPECT_TRUE(operators[2].tryGet<UnionPhysicalOperator>().has_value());
+        EXPECT_TRUE(operators[3].tryGet<MapPhysicalOperator>().has_value());
+        expectEmit(operators[4], {"value"});
+        EXPECT_EQ(countScans(operators), 1);
+
+        ASSERT_EQ(unionPipeline.getSuccessors().size(), 1);
+        EXPECT_TRUE(unionPipeline.getSuccessors().front()->isSinkPipeline());
+        if (sinkPipeline)
+        {
+            EXPECT_EQ(unionPipeline.getSuccessors().front(), sinkPipeline);
+        }
+        sinkPipeline = unionPipeline.getSuccessors().front();
+    }
+}
+
+TEST_F(PipeliningPhaseTest, ProjectionAfterProbeIsFusedIntoProbePipeline)
+{
+    const auto inputSchema = createSchema({"id", "value"});
+    const auto probeSchema = createSchema({"start", "end", "value"});
+    const StubPhysicalOperator build;
+    const StubPhysicalOperator probe;
+    const auto map = createMap(inputSchema, createSource("stream", inputSchema));
+    const auto buildWrapper = wrap(build, inputSchema, probeSchema, Location::EMIT, {map});
+    const auto probeWrapper = wrap(probe, probeSchema, probeSchema, Location::SCAN, {buildWrapper});
+    const auto projection = createProjection(probeSchema, {{"start", "start"}, {"value", "value"}}, {probeWrapper});
+    const auto sink = createSink(createSchema({"start", "value"}), projection);
+
+    const auto pipelinedPlan = QueryCompilation::PipeliningPhase::apply(createPlan(sink));
+
+    /// source -> scan, map, build -> probe, map, map, emit -> sink
+    ASSERT_EQ(pipelinedPlan->getPipelines().size(), 1);
+    EXPECT_EQ(countPipelines(*pipelinedPlan), 4);
+    const auto& sourcePipeline = *pipelinedPlan->getPipelines().front();
+    ASSERT_EQ(sourcePipeline.getSuccessors().size(), 1);
+    const auto& buildPipeline = *sourcePipeline.getSuccessors().front();
+    const auto buildOperators = getOperators(buildPipeline);
+    ASSERT_EQ(buildOperators.size(), 3);
+    EXPECT_EQ(buildOperators[2].getId(), build.id);
+
+    ASSERT_EQ(buildPipeline.getSuccessors().size(), 1);
+    const auto& probePipeline = *buildPipeline.getSuccessors().front();
+    const auto probeOperators = getOperators(probePipeline);
+    ASSERT_EQ(probeOperators.size(), 4);
+    EXPECT_EQ(probeOperators[0].getId(), probe.id);
+    EXPECT_TRUE(probeOperators[1].tryGet<MapPhysicalOperator>().has_value());
+    EXPECT_TRUE(probeOperators[2].tryGet<MapPhysicalOperator>().has_value());
+    expectEmit(probeOperators[3], {"start", "value"});
+    EXPECT_EQ(countScans(probeOperators), 0);
+
+    ASSERT_EQ(probePipeline.getSuccessors().size(), 1);
+    EXPECT_TRUE(probePipeline.getSuccessors().front()->isSinkPipeline());
+}
+
+TEST_F(PipeliningPhaseTest, RenamingProjectionEmitsRenamedFields)
+{
+    const auto inputSchema = createSchema({"id", "value", "timestamp"});
+    const auto map = createMap(inputSchema, createSource("stream", inputSchema));
+    const auto projection = createProjection(inputSchema, {{"key", "id"}, {"amount", "value"}}, {map});
+    const auto sink = createSink(createSchema({"key", "amount"}), projection);
+
+    const auto pipelinedPlan = QueryCompilation::PipeliningPhase::apply(createPlan(sink));
+
+    /// source -> scan, map, map, map, emit -> sink
+    ASSERT_EQ(pipelinedPlan->getPipelines().size(), 1);
+    EXPECT_EQ(countPipelines(*pipelinedPlan), 3);
+    const auto& sourcePipeline = *pipelinedPlan->getPipelines().front();
+    ASSERT_EQ(sourcePipeline.getSuccessors().size(), 1);
+    const auto& pipeline = *sourcePipeline.getSuccessors().front();
+    const auto operators = getOperators(pipeline);
+    ASSERT_EQ(operators.size(), 5);
+    const auto scan = operators[0].tryGet<ScanPhysicalOperator>();
+    ASSERT_TRUE(scan.has_value());
+    EXPECT_EQ(scan->getProjections(), inputSchema.getFieldNames());
+    EXPECT_EQ(countScans(operators), 1);
+    expectEmit(operators[4], {"key", "amount"});
+
+    ASSERT_EQ(pipeline.getSuccessors().size(), 1);
+    EXPECT_TRUE(pipeline.getSuccessors().front()->isSinkPipeline());
+}
+
+TEST_F(PipeliningPhaseTest, DroppingProjectionEmitsSolelyProjectedFields)
+{
+    const auto inputSchema = createSchema({"id", "value", "timestamp"});
+    const auto map = createMap(inputSchema, createSource("stream", inputSchema));
+    const auto projection = createProjection(inputSchema, {{"id", "id"}}, {map});
+    const auto sink = createSink(createSchema({"id"}), projection);
+
+    const auto pipelinedPlan = QueryCompilation::PipeliningPhase::apply(createPlan(sink));
+
+    /// source -> scan, map, map, emit -> sink
+    ASSERT_EQ(pipelinedPlan->getPipelines().size(), 1);
+    EXPECT_EQ(countPipelines(*pipelinedPlan), 3);
+    const auto& sourcePipeline = *pipelinedPlan->getPipelines().front();
+    ASSERT_EQ(sourcePipeline.getSuccessors().size(), 1);
+    const auto& pipeline = *sourcePipeline.getSuccessors().front();
+    const auto operators = getOperators(pipeline);
+    ASSERT_EQ(operators.size(), 4);
+    const auto scan = operators[0].tryGet<ScanPhysicalOperator>();
+    ASSERT_TRUE(scan.has_value());
+    EXPECT_EQ(countScans(operators), 1);
+    expectEmit(operators[3], {"id"});
+
+    /// The emit writes tuples of the single projected field instead of the tuples that the scan reads
+    const auto emit = operators[3].tryGet<EmitPhysicalOperator>();
+    ASSERT_TRUE(emit.has_value());
+    EXPECT_EQ(emit->getMemoryLayout()->getTupleSize(), DataType{DataType::Type::UINT64}.getSizeInBytes());
+    EXPECT_LT(emit->getMemoryLayout()->getTupleSize(), scan->getMemoryLayout()->getTupleSize());
+
+    ASSERT_EQ(pipeline.getSuccessors().size(), 1);
+    EXPECT_TRUE(pipeline.getSuccessors().front()->isSinkPipeline());
+}
+
+}
@@ -0,0 +1,148 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <BufferCompression.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <vector>
+#include <MemoryLayout/VariableSizedAccess.hpp>
+#include <Runtime/AbstractBufferProvider.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <ErrorHandling.hpp>
+
+#ifdef NES_ENABLE_BUFFER_COMPRESSION
+    #include <lz4.h>
+#endif
+
+namespace NES::BufferCompression
+{
+
+namespace
+{
+/// Precedes the compressed payload, as the size of an unpooled buffer may exceed the size it was requested with
+struct CompressedHeader
+{
+    uint32_t compressedSize;
+};
+
+void copyMetadataAndChildren(const TupleBuffer& from, TupleBuffer& to)
+{
+    to.setNumberOfTuples(from.getNumberOfTuples());
+    to.setOriginId(from.getOriginId());
+    to.setSequenceNumber(from.getSequenceNumber());
+    to.setChunkNumber(from.getChunkNumber());
+    to.setLastChunk(from.isLastChunk());
+    to.setWatermark(from.getWatermark());
+    to.setCreationTimestampInMS(from.getCreationTimestampInMS());
+    to.setLatestCreationTimestampInMS(from.getLatestCreationTimestampInMS());
+    /// The children are shared instead of copied, thus their indices, which the payload references, remain valid
+    for (size_t childIndex = 0; childIndex < from.getNumberOfChildBuffers(); ++childIndex)
+    {
+        auto child = from.loadChildBuffer(VariableSizedAccess::Index{childIndex});
+        [[maybe_unused]] const auto storedIndex = to.storeChildBuffer(child);
+        INVARIANT(storedIndex == VariableSizedAccess::Index{childIndex}, "Child buffer {} moved to index {}", childIndex, storedIndex);
+    }
+}
+}
+
+bool isAvailable()
+{
+#ifdef NES_ENABLE_BUFFER_COMPRESSION
+    return true;
+#else
+    return false;
+#endif
+}
+
+std::optional<TupleBuffer> compress([[maybe_unused]] const TupleBuffer& buffer, [[maybe_unused]] AbstractBufferProvider& bufferProvider)
+{
+#ifdef NES_ENABLE_BUFFER_COMPRESSION
+    const auto payload = buffer.getAvailableMemoryArea<std::byte>();
+    /// The compressed size is unknown upfront, thus lz4 compresses into a scratch area of the WorkerThread, which is copied afterward
+    thread_local std::vector<std::byte> scratch;
+    scratch.resize(static_cast<size_t>(LZ4_compressBound(static_cast<int>(payload.size()))));
+    const auto compressedSize = LZ4_compress_default(
+        reinterpret_cast<const char*>(payload.data()),
+        reinterpret_cast<char*>(scratch.data()),
+        static_cast<int>(payload.size()),
+        static_cast<int>(scratch.size()));
+    const auto sizeOfCompressedBuffer = sizeof(CompressedHeader) + static_cast<size_t>(compressedSize);
+    if (compressedSize <= 0
+        or static_cast<double>(sizeOfCompressedBuffer) > static_cast<double>(payload.size()) * MAX_COMPRESSION_RATIO)
+    {
+        return std::nullopt;
+    }
+
+    auto compressed = bufferProvider.getUnpooledBuffer(sizeOfCompressedBuffer);
+    if (not compressed)
+    {
+        return std::nullopt;
+    }
+    auto destination = compressed->getAvailableMemoryArea<std::byte>();
+    const CompressedHeader header{.compressedSize = static_cast<uint32_t>(compressedSize)};
+    std::memcpy(destination.data(), &header, sizeof(CompressedHeader));
+    std::memcpy(destination.data() + sizeof(CompressedHeader), scratch.data(), static_cast<size_t>(compressedSize));
+    copyMetadataAndChildren(buffer, *compressed);
+    return compressed;
+#else
+    return std::nullopt;
+#endif
+}
+
+TupleBuffer decompress(
+    [[maybe_unused]] const TupleBuffer& compressed,
+    [[maybe_unused]] const size_t uncompressedSize,
+    [[maybe_unused]] AbstractBufferProvider& bufferProvider)
+{
+#ifdef NES_ENABLE_BUFFER_COMPRESSION
+    auto buffer = [&]
+    {
+        if (uncompressedSize <= bufferProvider.getBufferSize())
+        {
+            return bufferProvider.getBufferBlocking();
+        }
+        if (auto unpooledBuffer = bufferProvider.getUnpooledBuffer(uncompressedSize))
+        {
+            return *unpooledBuffer;
+        }
+        throw CannotAllocateBuffer("Cannot allocate an unpooled buffer of {} bytes to decompress a queued buffer", uncompressedSize);
+    }();
+
+    const auto source = compressed.getAvailableMemoryArea<std::byte>();
+    CompressedHeader header{};
+    std::memcpy(&header, source.data(), sizeof(CompressedHeader));
+    const auto destination = buffer.getAvailableMemoryArea<std::byte>();
+    [[maybe_unused]] const auto decompressedSize = LZ4_decompress_safe(
+        reinterpret_cast<const char*>(source.data() + sizeof(CompressedHeader)),
+        reinterpret_cast<char*>(destination.data()),
+        static_cast<int>(header.compressedSize),
+        static_cast<int>(uncompressedSize));
+    INVARIANT(
+        decompressedSize >= 0 and static_cast<size_t>(decompressedSize) == uncompressedSize,
+        "A queued buffer decompressed to {} instead of {} bytes",
+        decompressedSize,
+        uncompressedSize);
+    copyMetadataAndChildren(compressed, buffer);
+    return buffer;
+#else
+    INVARIANT(false, "Buffers are solely compressed if the QueryEngine is built with NES_ENABLE_BUFFER_COMPRESSION");
+    return compressed;
+#endif
+}
+
+}
@@ -0,0 +1,48 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <Runtime/AbstractBufferProvider.hpp>
+#include <Runtime/TupleBuffer.hpp>
+
+/// Compresses the buffers that pipelines emit while the task queue is backlogged. A queued buffer holds a pooled buffer of the global
+/// buffer pool until a WorkerThread dequeues its task, thus a backlog of state-heavy queries, e.g., of their window triggers, exhausts the
+/// pool.
+/// The compressed buffer is an unpooled buffer of the size of the compressed payload, thus the pooled buffer returns to the pool while the
+/// task waits. The WorkerThread decompresses the buffer into a pooled buffer right before it executes the task, thus the pipelines scan
+/// the buffer as before.
+/// The payload is compressed with lz4, which is independent of the schema of the buffer. The child buffers, i.e., the variable sized data,
+/// are attached to the compressed buffer as they are.
+namespace NES::BufferCompression
+{
+
+/// The compressed buffer has to save at least half of the payload, otherwise the WorkerThreads keep the pooled buffer, as compressing
+/// and decompressing the buffer costs more than the memory it saves
+constexpr double MAX_COMPRESSION_RATIO = 0.5;
+
+/// Returns false if the QueryEngine was built without NES_ENABLE_BUFFER_COMPRESSION, in which case no buffer is compressed
+[[nodiscard]] bool isAvailable();
+
+/// Returns an unpooled buffer that holds the compressed payload, the metadata and the child buffers of the buffer.
+/// Returns nullopt if compression is unavailable, the buffer does not compress below MAX_COMPRESSION_RATIO, or the provider has no memory
+/// for the unpooled buffer.
+[[nodiscard]] std::optional<TupleBuffer> compress(const TupleBuffer& buffer, AbstractBufferProvider& bufferProvider);
+
+/// Returns the buffer of `uncompressedSize` bytes that `compress` compressed. Blocks until the provider has a pooled buffer.
+[[nodiscard]] TupleBuffer decompress(const TupleBuffer& compressed, size_t uncompressedSize, AbstractBufferProvider& bufferProvider);
+
+}
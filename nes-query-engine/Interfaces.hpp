@@ -15,10 +15,16 @@
 #pragma once
 #include <functional>
 #include <memory>
+#include <vector>
 #include <Identifiers/Identifiers.hpp>
+#include <Runtime/AbstractBufferProvider.hpp>
 #include <Runtime/TupleBuffer.hpp>
 #include <ErrorHandling.hpp>
+#include <LoadShedder.hpp>
 #include <PipelineExecutionContext.hpp>
+#include <PipelineStatistics.hpp>
+#include <QueryPriority.hpp>
+#include <SourceFlowControl.hpp>
 #include <Task.hpp>
 
 namespace NES
@@ -52,5 +58,16 @@ public:
     virtual void emitPipelineStart(QueryId, const std::shared_ptr<RunningQueryPlanNode>&, TaskCallback) = 0;
     virtual void emitPendingPipelineStop(QueryId, std::shared_ptr<RunningQueryPlanNode>, TaskCallback) = 0;
     virtual void emitPipelineStop(QueryId, std::unique_ptr<RunningQueryPlanNode>, TaskCallback) = 0;
+    /// Fraction of the global buffer pool which is in use, between 0 and 1. The sources adapt their credits to it, c.f., SourceFlowControl.
+    [[nodiscard]] virtual double getBufferPoolOccupancy() const = 0;
+    /// Returns nullptr if load shedding is disabled. The sources of the query drop buffers under overload, c.f., LoadShedder.
+    virtual std::shared_ptr<LoadShedder> createLoadShedder(QueryId, QueryPriority) = 0;
+    /// Returns nullptr if the pipeline statistics are disabled. The WorkerThreads count the tasks of the pipeline in it.
+    virtual std::shared_ptr<PipelineStatistics> createPipelineStatistics(QueryId, PipelineId) = 0;
+    /// Exposes the counters of the sources of the query until the flow control is destroyed together with the query
+    virtual void registerSourceFlowControl(QueryId, std::weak_ptr<SourceFlowControl>) = 0;
+    /// Creates the buffer providers of the query, indexed by NUMA node, which charge all buffers of its pipelines to a memory account of
+    /// the query. Returns an empty vector if the pipelines allocate from the buffer providers of the WorkerThreads.
+    virtual std::vector<std::shared_ptr<AbstractBufferProvider>> createBufferProviders(QueryId) = 0;
 };
 }
@@ -0,0 +1,99 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <LoadShedder.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <Identifiers/Identifiers.hpp>
+#include <ErrorHandling.hpp>
+#include <QueryEngineConfiguration.hpp>
+
+namespace NES
+{
+
+LoadShedder::LoadShedder(Configuration configuration, AdmissionOccupancy admissionOccupancy, OnShed onShed)
+    : configuration(configuration), admissionOccupancy(std::move(admissionOccupancy)), onShed(std::move(onShed))
+{
+    PRECONDITION(
+        configuration.admissionOccupancyThreshold >= 0 && configuration.admissionOccupancyThreshold <= 1,
+        "The admission occupancy threshold {} is not between 0 and 1",
+        configuration.admissionOccupancyThreshold);
+}
+
+double LoadShedder::shedProbability(const std::chrono::microseconds latency) const
+{
+    double probability = 0;
+    const auto occupancy = admissionOccupancy ? std::clamp(admissionOccupancy(), 0.0, 1.0) : 0.0;
+    if (occupancy > configuration.admissionOccupancyThreshold)
+    {
+        probability = (occupancy - configuration.admissionOccupancyThreshold) / (1 - configuration.admissionOccupancyThreshold);
+    }
+    if (configuration.maxLatency.count() > 0 && latency > configuration.maxLatency)
+    {
+        /// Shedding this share of the buffers reduces the load such that the remaining buffers meet the latency threshold
+        const auto maxLatency = std::chrono::duration_cast<std::chrono::microseconds>(configuration.maxLatency);
+        probability = std::max(probability, 1 - (static_cast<double>(maxLatency.count()) / static_cast<double>(latency.count())));
+    }
+    return probability;
+}
+
+bool LoadShedder::isOverloaded(const std::chrono::microseconds latency) const
+{
+    if (configuration.maxLatency.count() > 0 && latency > configuration.maxLatency)
+    {
+        return true;
+    }
+    return admissionOccupancy && admissionOccupancy() > configuration.admissionOccupancyThreshold;
+}
+
+bool LoadShedder::shouldShed(const OriginId source, const std::chrono::microseconds queueingDelay)
+{
+    bool shed = false;
+    switch (configuration.policy)
+    {
+        case LoadSheddingPolicy::NONE:
+            return false;
+        case LoadSheddingPolicy::RANDOM: {
+            const auto probability = shedProbability(queueingDelay);
+            thread_local std::minstd_rand random{std::random_device{}()};
+            shed = probability > 0 && std::uniform_real_distribution(0.0, 1.0)(random) < probability;
+            break;
+        }
+        case LoadSheddingPolicy::OLDEST_FIRST:
+            shed = isOverloaded(queueingDelay);
+            break;
+    }
+    if (not shed)
+    {
+        return false;
+    }
+
+    const auto shedBuffers = numberOfShedBuffers.fetch_add(1, std::memory_order_relaxed) + 1;
+    if (onShed)
+    {
+        onShed(source, shedBuffers);
+    }
+    return true;
+}
+
+uint64_t LoadShedder::getNumberOfShedBuffers() const
+{
+    return numberOfShedBuffers.load(std::memory_order_relaxed);
+}
+
+}
@@ -0,0 +1,75 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <Identifiers/Identifiers.hpp>
+#include <QueryEngineConfiguration.hpp>
+
+namespace NES
+{
+
+/// Sheds the tuples of a query under sustained overload, instead of backpressuring its sources until their data is arbitrarily stale.
+/// A query is overloaded while the admission queue of its priority class fills beyond the occupancy threshold, or while its source buffers
+/// wait longer than the latency threshold in the task queue.
+/// The successors of the sources, i.e., the input formatters, ask the shedder for every buffer they emit. The formatters still process
+/// every raw buffer, as tuples may span the raw buffers of adjacent sequence numbers. A shed buffer is emitted without its tuples, because
+/// the downstream operators track the sequence numbers of their input to advance the watermark. Shedding solely inspects whole buffers,
+/// i.e., it does not select tuples by their keys.
+/// - RANDOM: sheds a buffer with a probability that grows linearly from zero at the occupancy threshold to one at a full admission queue,
+///   respectively sheds the share of the buffers by which the latency exceeds the latency threshold.
+/// - OLDEST_FIRST: sheds the buffers of the raw buffers which waited longer than the latency threshold, or all buffers while the admission
+///   queue is above the occupancy threshold. The task queue hands out the oldest raw buffers first, thus fresh buffers remain.
+class LoadShedder
+{
+public:
+    struct Configuration
+    {
+        LoadSheddingPolicy policy = LoadSheddingPolicy::NONE;
+        /// Fraction of the admission queue, between 0 and 1. One disables the occupancy threshold.
+        double admissionOccupancyThreshold = 1;
+        /// Zero disables the latency threshold
+        std::chrono::milliseconds maxLatency{0};
+    };
+
+    /// Returns the fraction of the admission queue of the query's priority class which is in use, between 0 and 1
+    using AdmissionOccupancy = std::function<double()>;
+    /// Called for every shed buffer with the number of buffers the query shed so far
+    using OnShed = std::function<void(OriginId, uint64_t numberOfShedBuffers)>;
+
+    LoadShedder(Configuration configuration, AdmissionOccupancy admissionOccupancy, OnShed onShed);
+
+    /// Called by the WorkerThreads for every buffer that a successor of a source emits for a raw buffer of the source, which waited
+    /// `queueingDelay` in the task queue. Returns true if the buffer is shed.
+    bool shouldShed(OriginId source, std::chrono::microseconds queueingDelay);
+
+    [[nodiscard]] uint64_t getNumberOfShedBuffers() const;
+
+private:
+    /// Probability to shed a buffer, c.f., RANDOM
+    [[nodiscard]] double shedProbability(std::chrono::microseconds latency) const;
+    [[nodiscard]] bool isOverloaded(std::chrono::microseconds latency) const;
+
+    Configuration configuration;
+    AdmissionOccupancy admissionOccupancy;
+    OnShed onShed;
+
+    std::atomic<uint64_t> numberOfShedBuffers{0};
+};
+
+}
@@ -0,0 +1,202 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <PipelineStatistics.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <utility>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
+#include <Runtime/MemoryAccount.hpp>
+#include <ErrorHandling.hpp>
+#include <ExecutablePipelineStage.hpp>
+
+namespace NES
+{
+
+PipelineStatistics::PipelineStatistics(const size_t numberOfWorkerThreads) : threadCounters(numberOfWorkerThreads)
+{
+    PRECONDITION(numberOfWorkerThreads > 0, "The pipeline statistics require counters for at least one WorkerThread");
+}
+
+size_t PipelineStatistics::latencyBucketOf(const std::chrono::nanoseconds executionTime)
+{
+    PRECONDITION(executionTime.count() >= 0, "The execution time of a task cannot be negative");
+    const auto microseconds = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(executionTime).count());
+    return std::min<size_t>(std::bit_width(microseconds), NUMBER_OF_LATENCY_BUCKETS - 1);
+}
+
+size_t PipelineStatistics::ingestionLatencyBucketOf(const std::chrono::milliseconds latency)
+{
+    /// The clocks of the sources and the WorkerThreads may differ slightly, thus we count negative latencies as zero
+    const auto milliseconds = static_cast<uint64_t>(std::max<std::chrono::milliseconds::rep>(latency.count(), 0));
+    return std::min<size_t>(std::bit_width(milliseconds), NUMBER_OF_INGESTION_LATENCY_BUCKETS - 1);
+}
+
+void PipelineStatistics::record(
+    const WorkerThreadId threadId,
+    const uint64_t numberOfTuples,
+    const std::chrono::nanoseconds executionTime,
+    const std::chrono::nanoseconds queueingDelay)
+{
+    /// Solely the WorkerThread itself writes its counters, thus the relaxed increments do not contend for the cache line
+    auto& counters = threadCounters[threadId.getRawValue() % threadCounters.size()];
+    counters.numberOfTasks.fetch_add(1, std::memory_order_relaxed);
+    counters.numberOfTuples.fetch_add(numberOfTuples, std::memory_order_relaxed);
+    counters.latencyHistogram[latencyBucketOf(executionTime)].fetch_add(1, std::memory_order_relaxed);
+    counters.executionTimeInNanoseconds.fetch_add(static_cast<uint64_t>(executionTime.count()), std::memory_order_relaxed);
+    counters.queueingDelayInNanoseconds.fetch_add(static_cast<uint64_t>(queueingDelay.count()), std::memory_order_relaxed);
+}
+
+void PipelineStatistics::recordEmit(const WorkerThreadId threadId, const uint64_t numberOfTuples)
+{
+    auto& counters = threadCounters[threadId.getRawValue() % threadCounters.size()];
+    counters.numberOfEmittedTuples.fetch_add(numberOfTuples, std::memory_order_relaxed);
+    counters.numberOfEmittedBuffers.fetch_add(1, std::memory_order_relaxed);
+}
+
+void PipelineStatistics::recordIngestionLatency(
+    const WorkerThreadId threadId, const std::chrono::milliseconds latency, const std::chrono::milliseconds oldestLatency)
+{
+    auto& counters = threadCounters[threadId.getRawValue() % threadCounters.size()];
+    counters.ingestionLatencyHistogram[ingestionLatencyBucketOf(latency)].fetch_add(1, std::memory_order_relaxed);
+    counters.oldestIngestionLatencyHistogram[ingestionLatencyBucketOf(oldestLatency)].fetch_add(1, std::memory_order_relaxed);
+}
+
+PipelineStatistics::Snapshot PipelineStatistics::snapshot() const
+{
+    Snapshot snapshot;
+    for (const auto& counters : threadCounters)
+    {
+        snapshot.numberOfTasks += counters.numberOfTasks.load(std::memory_order_relaxed);
+        snapshot.numberOfTuples += counters.numberOfTuples.load(std::memory_order_relaxed);
+        snapshot.numberOfEmittedTuples += counters.numberOfEmittedTuples.load(std::memory_order_relaxed);
+        snapshot.numberOfEmittedBuffers += counters.numberOfEmittedBuffers.load(std::memory_order_relaxed);
+        snapshot.executionTime += std::chrono::nanoseconds(counters.executionTimeInNanoseconds.load(std::memory_order_relaxed));
+        snapshot.queueingDelay += std::chrono::nanoseconds(counters.queueingDelayInNanoseconds.load(std::memory_order_relaxed));
+        for (size_t bucket = 0; bucket < NUMBER_OF_LATENCY_BUCKETS; ++bucket)
+        {
+            snapshot.latencyHistogram[bucket] += counters.latencyHistogram[bucket].load(std::memory_order_relaxed);
+        }
+        for (size_t bucket = 0; bucket < NUMBER_OF_INGESTION_LATENCY_BUCKETS; ++bucket)
+        {
+            snapshot.ingestionLatencyHistogram[bucket] += counters.ingestionLatencyHistogram[bucket].load(std::memory_order_relaxed);
+            snapshot.oldestIngestionLatencyHistogram[bucket]
+                += counters.oldestIngestionLatencyHistogram[bucket].load(std::memory_order_relaxed);
+        }
+    }
+    return snapshot;
+}
+
+void PipelineStatistics::attachStage(const ExecutablePipelineStage& stage, std::vector<PipelineId> successors)
+{
+    const std::scoped_lock lock(stageMutex);
+    this->stage = std::addressof(stage);
+    stageSnapshot.successors = std::move(successors);
+}
+
+void PipelineStatistics::detachStage()
+{
+    const std::scoped_lock lock(stageMutex);
+    refreshStageSnapshot();
+    stage = nullptr;
+}
+
+void PipelineStatistics::attachMemoryAccount(std::shared_ptr<MemoryAccount> memoryAccount)
+{
+    const std::scoped_lock lock(stageMutex);
+    this->memoryAccount = std::move(memoryAccount);
+}
+
+PipelineStatistics::StageSnapshot PipelineStatistics::snapshotStage()
+{
+    const std::scoped_lock lock(stageMutex);
+    refreshStageSnapshot();
+    return stageSnapshot;
+}
+
+void PipelineStatistics::refreshStageSnapshot()
+{
+    if (memoryAccount)
+    {
+        stageSnapshot.bufferUsage = memoryAccount->getUsage();
+        stageSnapshot.peakBufferUsage = memoryAccount->getPeakUsage();
+    }
+    if (stage == nullptr)
+    {
+        return;
+    }
+    stageSnapshot.operatorCosts = stage->getOperatorCosts();
+    stageSnapshot.stateSizeInBytes = stage->getStateSizeInBytes();
+    stageSnapshot.peakStateSizeInBytes = std::max(stageSnapshot.peakStateSizeInBytes, stageSnapshot.stateSizeInBytes);
+    stageSnapshot.stateSizeInBytesPerWorkerThread = stage->getStateSizeInBytesPerWorkerThread();
+}
+
+double
+PipelineStatistics::stateImbalanceOf(const std::vector<uint64_t>& stateSizeInBytesPerWorkerThread, const size_t numberOfWorkerThreads)
+{
+    /// Worker threads whose ids exceed the number of entries share the entry of their id modulo the number of entries
+    const auto numberOfOwners = std::min(numberOfWorkerThreads, stateSizeInBytesPerWorkerThread.size());
+    const auto stateSizeInBytes
+        = std::accumulate(stateSizeInBytesPerWorkerThread.begin(), stateSizeInBytesPerWorkerThread.end(), uint64_t{0});
+    if (numberOfOwners == 0 or stateSizeInBytes == 0)
+    {
+        return 0;
+    }
+    const auto meanStateSizeInBytes = static_cast<double>(stateSizeInBytes) / static_cast<double>(numberOfOwners);
+    return (static_cast<double>(std::ranges::max(stateSizeInBytesPerWorkerThread)) / meanStateSizeInBytes) - 1;
+}
+
+void PipelineStatistics::updateRebalancing(const double maxStateImbalance, const size_t numberOfWorkerThreads)
+{
+    PRECONDITION(maxStateImbalance > 0, "The rebalancing requires a positive threshold of the state imbalance");
+    std::vector<uint64_t> stateSizeInBytesPerWorkerThread;
+    {
+        const std::scoped_lock lock(stageMutex);
+        if (stage != nullptr)
+        {
+            stateSizeInBytesPerWorkerThread = stage->getStateSizeInBytesPerWorkerThread();
+        }
+    }
+    const auto stateSizeInBytes
+        = std::accumulate(stateSizeInBytesPerWorkerThread.begin(), stateSizeInBytesPerWorkerThread.end(), uint64_t{0});
+    if (stateSizeInBytes < MIN_REBALANCED_STATE_SIZE_IN_BYTES)
+    {
+        rebalancing.store(false, std::memory_order_relaxed);
+        return;
+    }
+    const auto stateImbalance = stateImbalanceOf(stateSizeInBytesPerWorkerThread, numberOfWorkerThreads);
+    if (stateImbalance > maxStateImbalance)
+    {
+        rebalancing.store(true, std::memory_order_relaxed);
+    }
+    else if (stateImbalance <= maxStateImbalance / 2)
+    {
+        rebalancing.store(false, std::memory_order_relaxed);
+    }
+}
+
+bool PipelineStatistics::isRebalancing() const
+{
+    return rebalancing.load(std::memory_order_relaxed);
+}
+
+}
@@ -0,0 +1,143 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
+#include <Runtime/MemoryAccount.hpp>
+#include <ExecutablePipelineStage.hpp>
+
+namespace NES
+{
+
+/// Counts the tasks that the WorkerThreads execute for a pipeline, without synchronizing the WorkerThreads. Every WorkerThread increments
+/// the counters in a cache line of its own, thus counting a task costs a few uncontended increments instead of the locks and queues of
+/// the statistic listeners. The QueryEngine sums up the counters of all WorkerThreads periodically, c.f., PipelineStatisticsSample.
+class PipelineStatistics
+{
+public:
+    /// Bucket i counts the tasks that executed for at least 2^(i-1) and less than 2^i microseconds, the last bucket all longer tasks
+    static constexpr size_t NUMBER_OF_LATENCY_BUCKETS = 20;
+    /// Bucket i counts the buffers that the sources ingested at least 2^(i-1) and less than 2^i milliseconds ago, the last bucket all older
+    static constexpr size_t NUMBER_OF_INGESTION_LATENCY_BUCKETS = 24;
+    /// Partial states below this size combine quickly independent of their balance, thus they are never rebalanced
+    static constexpr uint64_t MIN_REBALANCED_STATE_SIZE_IN_BYTES = 1024 * 1024;
+
+    struct Snapshot
+    {
+        uint64_t numberOfTasks = 0;
+        uint64_t numberOfTuples = 0;
+        uint64_t numberOfEmittedTuples = 0;
+        uint64_t numberOfEmittedBuffers = 0;
+        std::chrono::nanoseconds executionTime{0};
+        /// Time that the tasks waited in the task queue before they executed
+        std::chrono::nanoseconds queueingDelay{0};
+        std::array<uint64_t, NUMBER_OF_LATENCY_BUCKETS> latencyHistogram{};
+        /// Time since the sources ingested the latest, respectively the oldest data of the input buffers. For pipelines without successors,
+        /// e.g., the sinks, this is the latency from the source to the sink.
+        std::array<uint64_t, NUMBER_OF_INGESTION_LATENCY_BUCKETS> ingestionLatencyHistogram{};
+        std::array<uint64_t, NUMBER_OF_INGESTION_LATENCY_BUCKETS> oldestIngestionLatencyHistogram{};
+    };
+
+    /// Costs and state of the operators of the pipeline, which the stage reports, c.f., attachStage()
+    struct StageSnapshot
+    {
+        std::vector<PipelineId> successors;
+        std::vector<ExecutablePipelineStage::OperatorCost> operatorCosts;
+        uint64_t stateSizeInBytes = 0;
+        /// Largest state of all snapshots of the stage, as the stop of the pipeline releases its state
+        uint64_t peakStateSizeInBytes = 0;
+        /// State by the worker threads which own it, c.f., ExecutablePipelineStage::getStateSizeInBytesPerWorkerThread()
+        std::vector<uint64_t> stateSizeInBytesPerWorkerThread;
+        /// Buffers that the pipeline allocated and that are not yet recycled, c.f., attachMemoryAccount()
+        MemoryAccount::Usage bufferUsage;
+        MemoryAccount::Usage peakBufferUsage;
+    };
+
+    /// WorkerThreads with the same id modulo the number of worker threads share their counters, which keeps the counts correct
+    explicit PipelineStatistics(size_t numberOfWorkerThreads);
+
+    /// Called by the WorkerThreads after executing a task of the pipeline
+    void record(
+        WorkerThreadId threadId, uint64_t numberOfTuples, std::chrono::nanoseconds executionTime, std::chrono::nanoseconds queueingDelay);
+    /// Called by the WorkerThreads for every buffer that a task of the pipeline emits, independent of the number of successors
+    void recordEmit(WorkerThreadId threadId, uint64_t numberOfTuples);
+    /// Called by the WorkerThreads for every input buffer of the pipeline that carries creation timestamps,
+    /// c.f., TupleBuffer::getCreationTimestampInMS()
+    void recordIngestionLatency(WorkerThreadId threadId, std::chrono::milliseconds latency, std::chrono::milliseconds oldestLatency);
+
+    /// Sums up the counters of all WorkerThreads. Tasks that complete concurrently may be counted partially.
+    [[nodiscard]] Snapshot snapshot() const;
+
+    /// Called by the RunningQueryPlanNode, which owns the stage, once it created the statistics, respectively before it destroys the stage.
+    /// Detaching takes a last snapshot of the stage, thus the statistics report the costs of the stopped pipeline until they are destroyed.
+    void attachStage(const ExecutablePipelineStage& stage, std::vector<PipelineId> successors);
+    void detachStage();
+    /// The pipeline charges the buffers that it allocates to the account, which outlives the stage, as the buffers may outlive the stage
+    void attachMemoryAccount(std::shared_ptr<MemoryAccount> memoryAccount);
+    /// Queries the operator costs and the state of the attached stage, or returns the last snapshot of a detached stage
+    [[nodiscard]] StageSnapshot snapshotStage();
+
+    /// Called periodically by the QueryEngine. Once the largest state that a worker thread owns for the attached stage exceeds the mean
+    /// state of the running worker threads by more than `maxStateImbalance`, the pipeline is rebalanced until the imbalance fell to half
+    /// of the threshold, which keeps the pipeline from toggling between both modes with every call.
+    void updateRebalancing(double maxStateImbalance, size_t numberOfWorkerThreads);
+    /// While a pipeline is rebalanced, the WorkerThreads distribute its tasks round robin instead of executing them themselves
+    [[nodiscard]] bool isRebalancing() const;
+
+    /// Ratio of the largest state of a worker thread to the mean state of `numberOfWorkerThreads` worker threads minus one, i.e., zero
+    /// for a perfectly balanced state
+    [[nodiscard]] static double
+    stateImbalanceOf(const std::vector<uint64_t>& stateSizeInBytesPerWorkerThread, size_t numberOfWorkerThreads);
+
+    [[nodiscard]] static size_t latencyBucketOf(std::chrono::nanoseconds executionTime);
+    [[nodiscard]] static size_t ingestionLatencyBucketOf(std::chrono::milliseconds latency);
+
+private:
+    struct alignas(std::hardware_destructive_interference_size) ThreadCounters
+    {
+        std::atomic<uint64_t> numberOfTasks{0};
+        std::atomic<uint64_t> numberOfTuples{0};
+        std::atomic<uint64_t> numberOfEmittedTuples{0};
+        std::atomic<uint64_t> numberOfEmittedBuffers{0};
+        std::atomic<uint64_t> executionTimeInNanoseconds{0};
+        std::atomic<uint64_t> queueingDelayInNanoseconds{0};
+        std::array<std::atomic<uint64_t>, NUMBER_OF_LATENCY_BUCKETS> latencyHistogram{};
+        std::array<std::atomic<uint64_t>, NUMBER_OF_INGESTION_LATENCY_BUCKETS> ingestionLatencyHistogram{};
+        std::array<std::atomic<uint64_t>, NUMBER_OF_INGESTION_LATENCY_BUCKETS> oldestIngestionLatencyHistogram{};
+    };
+
+    /// Updates the stage snapshot from the attached stage. Must be called while holding the stage mutex.
+    void refreshStageSnapshot();
+
+    std::vector<ThreadCounters> threadCounters;
+
+    /// Guards the stage against its destruction while the QueryEngine queries it
+    std::mutex stageMutex;
+    const ExecutablePipelineStage* stage = nullptr;
+    std::shared_ptr<MemoryAccount> memoryAccount;
+    StageSnapshot stageSnapshot;
+    std::atomic<bool> rebalancing{false};
+};
+
+}
@@ -17,12 +17,20 @@
 #include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <concepts>
+#include <condition_variable>
 #include <cstddef>
 #include <cstdint>
 #include <cstdio>
+#include <deque>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <mutex>
+#include <new>
+#include <optional>
+#include <ranges>
+#include <span>
 #include <stop_token>
 #include <thread>
 #include <unordered_map>
@@ -33,24 +41,37 @@
 #include <Identifiers/NESStrongType.hpp>
 #include <Listeners/AbstractQueryStatusListener.hpp>
 #include <Runtime/AbstractBufferProvider.hpp>
+#include <Runtime/AccountedBufferProvider.hpp>
+#include <Runtime/BufferManager.hpp>
 #include <Runtime/Execution/OperatorHandler.hpp>
 #include <Runtime/Execution/QueryStatus.hpp>
+#include <Runtime/MemoryAccount.hpp>
 #include <Runtime/QueryTerminationType.hpp>
 #include <Runtime/TupleBuffer.hpp>
+#include <Time/Timestamp.hpp>
 #include <Util/AtomicState.hpp>
+#include <Util/BloomFilterStatistics.hpp>
+#include <Util/CoarseClock.hpp>
+#include <Util/FunctionStatistics.hpp>
+#include <Util/NumaTopology.hpp>
 #include <Util/ThreadNaming.hpp>
 #include <fmt/format.h>
 #include <folly/MPMCQueue.h>
+#include <BufferCompression.hpp>
 #include <DelayedTaskSubmitter.hpp>
 #include <EngineLogger.hpp>
 #include <ErrorHandling.hpp>
 #include <ExecutablePipelineStage.hpp>
 #include <ExecutableQueryPlan.hpp>
 #include <Interfaces.hpp>
+#include <LoadShedder.hpp>
 #include <PipelineExecutionContext.hpp>
+#include <PipelineStatistics.hpp>
 #include <QueryEngineConfiguration.hpp>
 #include <QueryEngineStatisticListener.hpp>
+#include <QueryPriority.hpp>
 #include <RunningQueryPlan.hpp>
+#include <SourceFlowControl.hpp>
 #include <Task.hpp>
 #include <TaskQueue.hpp>
 
@@ -60,13 +81,33 @@ namespace NES
 namespace
 {
 
-/// Graceful pipeline shutdown can only happen if no task depends on the pipeline anymore.
-/// It could happen that tasks are waiting within the admission queue and do not get a chance to execute as long as the
-/// PendingPipelineStop task is repeatedly added to the internal queue.
-/// This backoff interval is used when a pending pipeline stop has repeatedly (PIPELINE_STOP_BACKOFF_THRESHOLD) failed to allow pending
-/// tasks to make progress.
-constexpr auto PIPELINE_STOP_BACKOFF_INTERVAL = std::chrono::milliseconds(25);
-constexpr auto PIPELINE_STOP_BACKOFF_THRESHOLD = 2;
+/// Interval in which an elastic ThreadPool checks the load of the TaskQueue, c.f., ThreadPool::startElasticScaling. Every check starts at
+/// most one additional WorkerThread, which limits the growth to 100 threads per second.
+constexpr auto ELASTIC_SCALING_INTERVAL = std::chrono::milliseconds(10);
+
+/// The priority classes of the TaskQueue are ordered like the QueryPriorities. Tasks that do not process data, e.g., starting or stopping
+/// a pipeline, belong to the NORMAL class.
+size_t toPriorityClass(const QueryPriority priority)
+{
+    return static_cast<size_t>(priority);
+}
+
+std::chrono::microseconds queueingDelayOf(const WorkTask& task)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - task.emitTime);
+}
+
+size_t priorityClassOf(const Task& task)
+{
+    if (const auto* workTask = std::get_if<WorkTask>(&task))
+    {
+        if (const auto pipeline = workTask->pipeline.lock())
+        {
+            return toPriorityClass(pipeline->priority);
+        }
+    }
+    return toPriorityClass(QueryPriority::NORMAL);
+}
 
 /// This function is unsafe because it requires the lifetime of the RunningQueryPlanNode exceed the lifetime of the callback
 auto injectQueryFailureUnsafe(RunningQueryPlanNode& node, TaskCallback::onFailure failure)
@@ -101,28 +142,6 @@ auto injectQueryFailure(std::weak_ptr<RunningQueryPlanNode> node, TaskCallback::
     };
 }
 
-auto injectReferenceCountReducer(
-    ENGINE_IF_LOG_DEBUG(QueryId qid, ) std::weak_ptr<RunningQueryPlanNode> node, TaskCallback::onComplete innerFunction)
-{
-    return [ENGINE_IF_LOG_DEBUG(qid, ) innerFunction = std::move(innerFunction), node = std::weak_ptr(std::move(node))]() mutable
-    {
-        if (innerFunction)
-        {
-            innerFunction();
-        }
-        if (auto existingNode = node.lock())
-        {
-            auto updatedCount = existingNode->pendingTasks.fetch_sub(1) - 1;
-            ENGINE_LOG_DEBUG("Decreasing number of pending tasks on pipeline {}-{} to {}", qid, existingNode->id, updatedCount);
-            INVARIANT(updatedCount >= 0, "ThreadPool returned a negative number of pending tasks.");
-        }
-        else
-        {
-            ENGINE_LOG_WARNING("Node Expired and pendingTasks could not be reduced");
-        }
-    };
-}
-
 }
 
 /// The Query has not been started yet. But a slot in the QueryCatalog has been reserved.
@@ -205,6 +224,8 @@ struct DefaultPEC final : PipelineExecutionContext
     std::unordered_map<OperatorHandlerId, std::shared_ptr<OperatorHandler>>* operatorHandlers = nullptr;
     std::function<bool(const TupleBuffer& tb, ContinuationPolicy)> handler;
     std::function<void(const TupleBuffer& tb, std::chrono::milliseconds duration)> repeatHandler;
+    std::function<void(const TupleBuffer& tb)> submitHandler;
+    std::function<bool(const TupleBuffer& tb, Timestamp deadline)> deadlineHandler;
     std::shared_ptr<AbstractBufferProvider> bm;
     size_t numberOfThreads;
     WorkerThreadId threadId;
@@ -220,9 +241,13 @@ struct DefaultPEC final : PipelineExecutionContext
         PipelineId pipelineId,
         std::shared_ptr<AbstractBufferProvider> bm,
         std::function<bool(const TupleBuffer& tb, ContinuationPolicy)> handler,
-        std::function<void(const TupleBuffer& tb, std::chrono::milliseconds)> repeatHandler)
+        std::function<void(const TupleBuffer& tb, std::chrono::milliseconds)> repeatHandler,
+        std::function<void(const TupleBuffer& tb)> submitHandler = {},
+        std::function<bool(const TupleBuffer& tb, Timestamp deadline)> deadlineHandler = {})
         : handler(std::move(handler))
         , repeatHandler(std::move(repeatHandler))
+        , submitHandler(std::move(submitHandler))
+        , deadlineHandler(std::move(deadlineHandler))
         , bm(std::move(bm))
         , numberOfThreads(numberOfThreads)
         , threadId(threadId)
@@ -254,6 +279,17 @@ struct DefaultPEC final : PipelineExecutionContext
         return handler(buffer, policy);
     }
 
+    /// Solely pipelines that execute WorkTasks order their buffers by deadline, e.g., a pipeline that stops flushes its buffers right away
+    bool emitBufferWithDeadline(const TupleBuffer& buffer, Timestamp deadline) override
+    {
+        PRECONDITION(!wasRepeated, "A task should terminate after repeating");
+        if (!deadlineHandler)
+        {
+            return handler(buffer, ContinuationPolicy::POSSIBLE);
+        }
+        return deadlineHandler(buffer, deadline);
+    }
+
     void repeatTask(const TupleBuffer& buffer, std::chrono::milliseconds duration) override
     {
         PRECONDITION(!wasRepeated, "A task should terminate after repeating");
@@ -264,6 +300,13 @@ struct DefaultPEC final : PipelineExecutionContext
         repeatHandler(buffer, duration);
     }
 
+    void submitTask(const TupleBuffer& buffer) override
+    {
+        PRECONDITION(!wasRepeated, "A task should terminate after repeating");
+        PRECONDITION(submitHandler != nullptr, "Solely the execution of a task may submit new tasks");
+        submitHandler(buffer);
+    }
+
     [[nodiscard]] std::shared_ptr<AbstractBufferProvider> getBufferManager() const override
     {
         PRECONDITION(!wasRepeated, "A task should terminate after repeating");
@@ -298,7 +341,14 @@ struct DefaultPEC final : PipelineExecutionContext
 class ThreadPool : public WorkEmitter, public QueryLifetimeController
 {
 public:
-    void addThread();
+    /// Starts a WorkerThread with the lowest WorkerThreadId that is not in use. Returns false if maxNumberOfThreads threads are running.
+    bool addThread();
+    /// Compilation threads start the pipelines, thus compiling a query does not occupy the WorkerThreads
+    void addCompilationThread();
+    /// Starts a thread which adds WorkerThreads, up to maxNumberOfThreads, while tasks queue up or sources wait for admission.
+    /// WorkerThreads beyond minNumberOfThreads stop after being idle for the idle timeout.
+    void startElasticScaling();
+    void startPipelineStatistics();
 
     bool emitWork(
         QueryId qid,
@@ -309,32 +359,64 @@ public:
     {
         [[maybe_unused]] auto updatedCount = node->pendingTasks.fetch_add(1) + 1;
         ENGINE_LOG_DEBUG("Increasing number of pending tasks on pipeline {}-{} to {}", qid, node->id, updatedCount);
-        auto [complete, failure, success] = std::move(callback).take();
-        /// Create a new callback that wraps the reference count reducer
-        auto wrappedCallback = TaskCallback{
-            TaskCallback::OnComplete(injectReferenceCountReducer(ENGINE_IF_LOG_DEBUG(qid, ) node, std::move(complete.callback))),
-            std::move(success),
-            TaskCallback::OnFailure(injectQueryFailure(node, std::move(failure.callback))),
-        };
-
-        auto task = WorkTask(qid, node->id, node, std::move(buffer), std::move(wrappedCallback));
+        /// The WorkTask reduces the number of pending tasks and reports failures of the pipeline itself
+        auto task = WorkTask(qid, node->id, node, std::move(buffer), std::move(callback));
         if (WorkerThread::id == INVALID<WorkerThreadId>)
         {
             /// Non-WorkerThread
-            taskQueue.addAdmissionTaskBlocking({}, std::move(task));
+            taskQueue.addAdmissionTaskBlocking({}, std::move(task), toPriorityClass(node->priority));
             ENGINE_LOG_DEBUG("Task written to AdmissionQueue");
             return true;
         }
 
         /// WorkerThread
-        switch (continuationPolicy)
+        if (node->statistics and node->statistics->isRebalancing())
         {
-            case PipelineExecutionContext::ContinuationPolicy::POSSIBLE:
-            case PipelineExecutionContext::ContinuationPolicy::NEVER:
-                addInternalTask(std::move(task));
-                return true;
+            addRebalancedTask(std::move(task), toPriorityClass(node->priority));
+            return true;
+        }
+        if (continuesInline(*node, continuationPolicy))
+        {
+            ++WorkerThread::inlineContinuationDepth;
+            handleTask(WorkerThread{*this, false}, std::move(task));
+            --WorkerThread::inlineContinuationDepth;
+            return true;
         }
-        std::unreachable();
+        addLocalTask(std::move(task), toPriorityClass(node->priority));
+        return true;
+    }
+
+    /// The successor is executed immediately while the emitted buffer is still hot in the cache of this core. Only successors with a single
+    /// predecessor are continued inline, and the depth limit bounds the growth of the stack for long pipeline chains.
+    [[nodiscard]] bool
+    continuesInline(const RunningQueryPlanNode& node, const PipelineExecutionContext::ContinuationPolicy continuationPolicy) const
+    {
+        return continuationPolicy == PipelineExecutionContext::ContinuationPolicy::POSSIBLE and node.numberOfPredecessors == 1
+            and WorkerThread::inlineContinuationDepth < maxInlineContinuationDepth;
+    }
+
+    /// A compressed buffer never continues inline, as solely buffers that wait in the task queue are compressed, c.f., BufferCompression
+    bool emitCompressedWork(
+        QueryId qid, const std::shared_ptr<RunningQueryPlanNode>& node, TupleBuffer compressedBuffer, const size_t uncompressedSize)
+    {
+        PRECONDITION(WorkerThread::id != INVALID<WorkerThreadId>, "Solely WorkerThreads compress the buffers they emit");
+        [[maybe_unused]] auto updatedCount = node->pendingTasks.fetch_add(1) + 1;
+        ENGINE_LOG_DEBUG("Increasing number of pending tasks on pipeline {}-{} to {}", qid, node->id, updatedCount);
+        auto task = WorkTask(qid, node->id, node, std::move(compressedBuffer), TaskCallback{});
+        task.uncompressedSize = uncompressedSize;
+        addLocalTask(std::move(task), toPriorityClass(node->priority));
+        return true;
+    }
+
+    /// Tasks with a deadline never continue inline, as the TaskQueue orders them by their deadline among all tagged tasks
+    bool emitWorkWithDeadline(QueryId qid, const std::shared_ptr<RunningQueryPlanNode>& node, TupleBuffer buffer, const Timestamp deadline)
+    {
+        PRECONDITION(WorkerThread::id != INVALID<WorkerThreadId>, "Solely WorkerThreads emit tasks with a deadline");
+        [[maybe_unused]] auto updatedCount = node->pendingTasks.fetch_add(1) + 1;
+        ENGINE_LOG_DEBUG("Increasing number of pending tasks on pipeline {}-{} to {}", qid, node->id, updatedCount);
+        taskQueue.addDeadlineTaskNonBlocking(
+            WorkTask(qid, node->id, node, std::move(buffer), TaskCallback{}), deadline.getRawValue(), toPriorityClass(node->priority));
+        return true;
     }
 
     void emitPipelineStart(QueryId qid, const std::shared_ptr<RunningQueryPlanNode>& node, TaskCallback callback) override
@@ -345,7 +427,17 @@ public:
             std::move(success),
             TaskCallback::OnFailure(injectQueryFailure(node, std::move(failure.callback))),
         };
-        addInternalTask(StartPipelineTask(qid, node->id, std::move(wrappedCallback), node));
+        auto task = StartPipelineTask(qid, node->id, std::move(wrappedCallback), node);
+        if (not compilationThreads.empty())
+        {
+            {
+                const std::scoped_lock lock(compilationMutex);
+                compilationTasks.emplace_back(std::move(task));
+            }
+            compilationCondition.notify_one();
+            return;
+        }
+        addInternalTask(std::move(task));
     }
 
     void emitPipelineStop(QueryId qid, std::unique_ptr<RunningQueryPlanNode> node, TaskCallback callback) override
@@ -389,23 +481,132 @@ public:
                     { listener->logSourceTermination(id, sourceId, QueryTerminationType::Graceful, std::chrono::system_clock::now()); })}});
     }
 
+    [[nodiscard]] double getBufferPoolOccupancy() const override
+    {
+        size_t numberOfBuffers = 0;
+        size_t numberOfAvailableBuffers = 0;
+        for (const auto& bufferManager : numaLocalBufferManagers)
+        {
+            numberOfBuffers += bufferManager->getNumOfPooledBuffers();
+            numberOfAvailableBuffers += bufferManager->getNumberOfAvailableBuffers();
+        }
+        if (numberOfBuffers == 0)
+        {
+            return 0;
+        }
+        return 1.0 - (static_cast<double>(std::min(numberOfAvailableBuffers, numberOfBuffers)) / static_cast<double>(numberOfBuffers));
+    }
+
+    std::shared_ptr<LoadShedder> createLoadShedder(QueryId queryId, QueryPriority priority) override
+    {
+        if (loadSheddingConfiguration.policy == LoadSheddingPolicy::NONE)
+        {
+            return nullptr;
+        }
+        return std::make_shared<LoadShedder>(
+            loadSheddingConfiguration,
+            [this, priorityClass = toPriorityClass(priority)] { return taskQueue.getAdmissionOccupancy(priorityClass); },
+            [this, queryId](OriginId source, uint64_t numberOfShedBuffers)
+            { statistic->onEvent(SourceBufferShed{WorkerThread::id, queryId, source, numberOfShedBuffers}); });
+    }
+
+    std::shared_ptr<PipelineStatistics> createPipelineStatistics(QueryId queryId, PipelineId pipelineId) override
+    {
+        if (pipelineStatisticsInterval == std::chrono::milliseconds::zero())
+        {
+            return nullptr;
+        }
+        /// Compilation threads execute the pipeline starts, thus they own counters as well
+        auto statistics = std::make_shared<PipelineStatistics>(maxNumberOfThreads + numberOfCompilationThreads + 1);
+        const std::scoped_lock lock(pipelineStatisticsMutex);
+        registeredPipelineStatistics.emplace_back(queryId, pipelineId, statistics);
+        return statistics;
+    }
+
+    void registerSourceFlowControl(QueryId queryId, std::weak_ptr<SourceFlowControl> flowControl) override
+    {
+        const std::scoped_lock lock(sourceFlowControlMutex);
+        std::erase_if(registeredSourceFlowControls, [](const auto& registered) { return registered.flowControl.expired(); });
+        registeredSourceFlowControls.emplace_back(queryId, std::move(flowControl));
+    }
+
+    std::vector<std::shared_ptr<AbstractBufferProvider>> createBufferProviders(QueryId queryId) override
+    {
+        auto memoryAccount = std::make_shared<MemoryAccount>(queryMemoryQuota);
+        std::vector<std::shared_ptr<AbstractBufferProvider>> bufferProviders;
+        bufferProviders.reserve(numaLocalBufferProviders.size());
+        for (const auto& numaLocalBufferProvider : numaLocalBufferProviders)
+        {
+            bufferProviders.push_back(std::make_shared<AccountedBufferProvider>(numaLocalBufferProvider, memoryAccount));
+        }
+
+        const std::scoped_lock lock(memoryAccountMutex);
+        std::erase_if(registeredMemoryAccounts, [](const auto& registered) { return registered.memoryAccount.expired(); });
+        registeredMemoryAccounts.emplace_back(queryId, std::move(memoryAccount));
+        return bufferProviders;
+    }
+
+    /// The events of a task are either reported for all or for none of its executions and emits, c.f., taskEventSamplingRate
+    [[nodiscard]] bool reportsEventsOf(const TaskId taskId) const
+    {
+        return taskEventSamplingRate != 0 and taskId.getRawValue() % taskEventSamplingRate == 0;
+    }
+
     void emitPendingPipelineStop(QueryId queryId, std::shared_ptr<RunningQueryPlanNode> node, TaskCallback callback) override
     {
         ENGINE_LOG_DEBUG("Inserting Pending Pipeline Stop for {}-{}", queryId, node->id);
-        addInternalTask(PendingPipelineStopTask{queryId, std::move(node), 0, std::move(callback)});
+        addInternalTask(PendingPipelineStopTask{queryId, std::move(node), std::move(callback)});
     }
 
     ThreadPool(
         std::shared_ptr<AbstractQueryStatusListener> listener,
         std::shared_ptr<QueryEngineStatisticListener> stats,
-        std::shared_ptr<AbstractBufferProvider> bufferProvider,
-        const size_t admissionQueueSize)
-        : listener(std::move(listener))
+        std::vector<std::shared_ptr<BufferManager>> numaLocalBufferManagers,
+        const QueryEngineConfiguration& config)
+        : maxInlineContinuationDepth(config.maxInlineContinuationDepth.getValue())
+        , maxWorkTaskBatchSize(config.maxWorkTaskBatchSize.getValue())
+        , maxWorkTaskBatchDuration(config.maxWorkTaskBatchDuration.getValue())
+        , minNumberOfThreads(config.numberOfWorkerThreads.getValue())
+        , maxNumberOfThreads(std::max(config.numberOfWorkerThreads.getValue(), config.maxNumberOfWorkerThreads.getValue()))
+        , idleTimeout(config.workerThreadIdleTimeout.getValue())
+        , pinningPolicy(config.workerPinning.getValue())
+        , numberOfCompilationThreads(config.numberOfCompilationThreads.getValue())
+        , pipelineStatisticsInterval(config.pipelineStatisticsInterval.getValue())
+        , maxStateImbalance(static_cast<double>(config.stateRebalancingThreshold.getValue()) / 100)
+        , taskEventSamplingRate(config.taskEventSamplingRate.getValue())
+        , loadSheddingConfiguration(
+              {.policy = config.loadSheddingPolicy.getValue(),
+               .admissionOccupancyThreshold = static_cast<double>(config.loadSheddingAdmissionOccupancy.getValue()) / 100,
+               .maxLatency = std::chrono::milliseconds(config.loadSheddingMaxLatency.getValue())})
+        , queryMemoryQuota(config.queryMemoryQuota.getValue())
+        , listener(std::move(listener))
         , statistic(std::move(std::move(stats)))
-        , bufferProvider(std::move(bufferProvider))
-        , taskQueue(admissionQueueSize)
-        , delayedTaskSubmitter([this](Task&& task) noexcept { taskQueue.addInternalTaskNonBlocking(std::move(task)); })
+        , bufferProvider(numaLocalBufferManagers.front())
+        , numaLocalBufferProviders(numaLocalBufferManagers.begin(), numaLocalBufferManagers.end())
+        , numaLocalBufferManagers(std::move(numaLocalBufferManagers))
+        , taskQueue(
+              config.admissionQueueSize.getValue(),
+              config.taskQueueMode.getValue() == TaskQueueMode::WORK_STEALING ? maxNumberOfThreads : 0,
+              {config.highPriorityWeight.getValue(), config.normalPriorityWeight.getValue(), config.lowPriorityWeight.getValue()})
+        , delayedTaskSubmitter(
+              [this](Task&& task) noexcept
+              {
+                  const auto priorityClass = priorityClassOf(task);
+                  taskQueue.addInternalTaskNonBlocking(std::move(task), priorityClass);
+              })
+        , isThreadRunning(maxNumberOfThreads, false)
+        , pool(maxNumberOfThreads)
+        , busyThreads(maxNumberOfThreads)
     {
+        if (pinningPolicy != WorkerPinningPolicy::NONE || this->numaLocalBufferProviders.size() > 1)
+        {
+            numaNodes = getNumaTopology();
+            INVARIANT(
+                this->numaLocalBufferProviders.size() <= numaNodes.size(),
+                "Got {} NUMA local buffer managers, but the machine only has {} NUMA nodes",
+                this->numaLocalBufferProviders.size(),
+                numaNodes.size());
+        }
     }
 
     /// Reserves the initial WorkerThreadId for the terminator thread, which is the thread which is calling shutdown.
@@ -414,10 +615,19 @@ public:
     constexpr static WorkerThreadId terminatorThreadId = INITIAL<WorkerThreadId>;
 
     [[nodiscard]] size_t numberOfThreads() const { return numberOfThreads_.load(); }
+    [[nodiscard]] bool isElastic() const { return maxNumberOfThreads > minNumberOfThreads; }
 
     struct WorkerThread
     {
         static thread_local WorkerThreadId id;
+        /// Index of the local task queue owned by this thread. Only set for threads created by the ThreadPool.
+        static thread_local size_t localQueueIndex;
+        /// Number of successor pipelines which are currently executed inline on the stack of this thread.
+        static thread_local size_t inlineContinuationDepth;
+        /// Index of the NUMA node this thread was assigned to. Only set for threads created by the ThreadPool.
+        static thread_local size_t numaNodeIndex;
+        /// Set while this thread executes a batch of WorkTasks, thus a task that ends the batch does not start a nested batch
+        static thread_local bool isExecutingBatch;
 
         [[nodiscard]] WorkerThread(ThreadPool& pool, bool terminating) : pool(pool), terminating(terminating) { }
 
@@ -438,32 +648,206 @@ public:
     };
 
 private:
-    void addInternalTask(Task&& task)
+    void addInternalTask(Task&& task, size_t priorityClass = toPriorityClass(QueryPriority::NORMAL))
     {
         PRECONDITION(ThreadPool::WorkerThread::id != INVALID<WorkerThreadId>, "This should only be called from a worker thread");
-        taskQueue.addInternalTaskNonBlocking(std::move(task)); /// NOLINT no move will happen if tryWriteUntil has failed
+        taskQueue.addInternalTaskNonBlocking(std::move(task), priorityClass); /// NOLINT no move will happen if tryWriteUntil has failed
+    }
+
+    /// WorkerThreads allocate buffers from the buffer manager of their NUMA node, all other threads use the default buffer manager.
+    [[nodiscard]] const std::shared_ptr<AbstractBufferProvider>& localBufferProvider() const
+    {
+        if (WorkerThread::numaNodeIndex < numaLocalBufferProviders.size())
+        {
+            return numaLocalBufferProviders[WorkerThread::numaNodeIndex];
+        }
+        return bufferProvider;
+    }
+
+    /// The buffer provider of the pipeline on the NUMA node of this thread, which charges the buffers to the query of the pipeline
+    [[nodiscard]] const std::shared_ptr<AbstractBufferProvider>& bufferProviderOf(const RunningQueryPlanNode& pipeline) const
+    {
+        if (pipeline.bufferProviders.empty())
+        {
+            return localBufferProvider();
+        }
+        if (WorkerThread::numaNodeIndex < pipeline.bufferProviders.size())
+        {
+            return pipeline.bufferProviders[WorkerThread::numaNodeIndex];
+        }
+        return pipeline.bufferProviders.front();
     }
 
+    /// WorkerThreads are assigned in contiguous blocks to the NUMA nodes which own a buffer manager. Neighbouring WorkerThreads thus
+    /// share a NUMA node, which also makes them the preferred victims in work stealing mode.
+    [[nodiscard]] size_t numaNodeOf(size_t workerIndex) const
+    {
+        const auto numberOfNodes = std::max<size_t>(1, numaLocalBufferProviders.size());
+        return std::min(workerIndex * numberOfNodes / std::max<size_t>(1, maxNumberOfThreads), numberOfNodes - 1);
+    }
+
+    void pinWorkerThread(size_t workerIndex, size_t nodeIndex) const
+    {
+        if (pinningPolicy == WorkerPinningPolicy::NONE)
+        {
+            return;
+        }
+        const auto& cpus = numaNodes.at(nodeIndex).cpus;
+        switch (pinningPolicy)
+        {
+            case WorkerPinningPolicy::NONE:
+                return;
+            case WorkerPinningPolicy::NUMA_NODE:
+                pinCurrentThread(cpus);
+                return;
+            case WorkerPinningPolicy::CPU: {
+                /// Index of the WorkerThread within the block of WorkerThreads assigned to the same node
+                size_t firstWorkerOnNode = workerIndex;
+                while (firstWorkerOnNode > 0 && numaNodeOf(firstWorkerOnNode - 1) == nodeIndex)
+                {
+                    --firstWorkerOnNode;
+                }
+                pinCurrentThread(std::span(&cpus.at((workerIndex - firstWorkerOnNode) % cpus.size()), 1));
+                return;
+            }
+        }
+    }
+
+    /// Tasks emitted by a WorkerThread are preferably executed by the same WorkerThread. If the TaskQueue is not in work stealing mode,
+    /// this is equivalent to `addInternalTask`.
+    void addLocalTask(Task&& task, size_t priorityClass)
+    {
+        PRECONDITION(ThreadPool::WorkerThread::id != INVALID<WorkerThreadId>, "This should only be called from a worker thread");
+        taskQueue.addLocalTaskNonBlocking(WorkerThread::localQueueIndex, std::move(task), priorityClass);
+    }
+
+    /// The WorkerThreads build the partial state of a pipeline, e.g., their hash maps of a window, from the tasks they execute. Thus, the
+    /// tasks of a pipeline, whose state is imbalanced, go round robin to the local queues of the running WorkerThreads instead of staying
+    /// at the emitting WorkerThread. If the TaskQueue is not in work stealing mode, this is equivalent to `addInternalTask`.
+    void addRebalancedTask(Task&& task, size_t priorityClass)
+    {
+        if (not taskQueue.isWorkStealing())
+        {
+            taskQueue.addInternalTaskNonBlocking(std::move(task), priorityClass);
+            return;
+        }
+        const auto workerIndex
+            = nextRebalancedWorkerThread.fetch_add(1, std::memory_order_relaxed) % std::max<size_t>(1, numberOfThreads());
+        taskQueue.addLocalTaskNonBlocking(workerIndex, std::move(task), priorityClass);
+    }
+
+    /// Returns nullopt, if a stop was requested while waiting for a task
+    std::optional<Task> takeCompilationTask(const std::stop_token& stopToken)
+    {
+        std::unique_lock lock(compilationMutex);
+        if (not compilationCondition.wait(lock, stopToken, [this] { return not compilationTasks.empty(); }))
+        {
+            return std::nullopt;
+        }
+        auto task = std::move(compilationTasks.front());
+        compilationTasks.pop_front();
+        return task;
+    }
+
+    size_t maxInlineContinuationDepth;
+    size_t maxWorkTaskBatchSize;
+    std::chrono::milliseconds maxWorkTaskBatchDuration;
+    size_t minNumberOfThreads;
+    /// WorkerThreadIds, local task queues and the per WorkerThread state of the pipelines are reserved for the maximum number of threads,
+    /// thus a WorkerThread that starts later finds its state in place.
+    size_t maxNumberOfThreads;
+    std::chrono::milliseconds idleTimeout;
+    WorkerPinningPolicy pinningPolicy;
+    size_t numberOfCompilationThreads;
+    std::vector<NumaNode> numaNodes;
+    /// Zero, if the WorkerThreads do not count the tasks of the pipelines
+    std::chrono::milliseconds pipelineStatisticsInterval;
+    /// Zero, if the tasks of pipelines with an imbalanced state are not rebalanced, c.f., PipelineStatistics::updateRebalancing()
+    double maxStateImbalance;
+    std::atomic<size_t> nextRebalancedWorkerThread{0};
+    size_t taskEventSamplingRate;
+    LoadShedder::Configuration loadSheddingConfiguration;
+    /// Zero, if the memory accounts of the queries solely track their memory
+    uint64_t queryMemoryQuota;
+
     /// Order of destruction matters: TaskQueue has to outlive the pool
     std::shared_ptr<AbstractQueryStatusListener> listener;
     std::shared_ptr<QueryEngineStatisticListener> statistic;
     std::shared_ptr<AbstractBufferProvider> bufferProvider;
+    std::vector<std::shared_ptr<AbstractBufferProvider>> numaLocalBufferProviders;
+    std::vector<std::shared_ptr<BufferManager>> numaLocalBufferManagers;
     std::atomic<TaskId::Underlying> taskIdCounter;
 
     TaskQueue<Task> taskQueue;
     DelayedTaskSubmitter<> delayedTaskSubmitter;
 
-    /// Class Invariant: numberOfThreads == pool.size().
+    /// The WorkerThreads terminate before the compilation threads, which may still emit tasks while they skip the pending pipeline starts
+    std::mutex compilationMutex;
+    std::condition_variable_any compilationCondition;
+    std::deque<Task> compilationTasks;
+    std::vector<std::jthread> compilationThreads;
+
+    /// Class Invariant: numberOfThreads == count(isThreadRunning).
     /// We don't want to expose the vector directly to anyone, as this would introduce a race condition.
     /// The number of threads is only available via the atomic.
+    /// The pool has a slot per WorkerThreadId. A stopped WorkerThread frees its slot, which joins the thread once the slot is reused.
+    std::mutex poolMutex;
+    std::vector<bool> isThreadRunning;
+    std::atomic<size_t> numberOfThreads_;
     std::vector<std::jthread> pool;
-    std::atomic<int32_t> numberOfThreads_;
+
+    /// Set while the WorkerThread of the slot handles a task, c.f., getEngineMetrics
+    struct alignas(std::hardware_destructive_interference_size) BusyFlag
+    {
+        std::atomic<bool> isBusy{false};
+    };
+
+    std::vector<BusyFlag> busyThreads;
+
+    /// The scaling thread adds threads to the pool, thus it has to stop before the pool is destroyed
+    std::jthread scalingThread;
+
+    struct RegisteredPipelineStatistics
+    {
+        QueryId queryId;
+        PipelineId pipelineId;
+        std::shared_ptr<PipelineStatistics> statistics;
+    };
+
+    /// The statistics thread reports the registered pipeline statistics, until it solely holds them after their pipeline was destroyed
+    std::mutex pipelineStatisticsMutex;
+    std::vector<RegisteredPipelineStatistics> registeredPipelineStatistics;
+
+    struct RegisteredSourceFlowControl
+    {
+        QueryId queryId;
+        std::weak_ptr<SourceFlowControl> flowControl;
+    };
+
+    /// The flow controls of the running queries expose the counters of their sources, c.f., getEngineMetrics
+    std::mutex sourceFlowControlMutex;
+    std::vector<RegisteredSourceFlowControl> registeredSourceFlowControls;
+
+    struct RegisteredMemoryAccount
+    {
+        QueryId queryId;
+        std::weak_ptr<MemoryAccount> memoryAccount;
+    };
+
+    /// An account expires once its query is destroyed and the query released all buffers it charged, c.f., getQueryMemory
+    std::mutex memoryAccountMutex;
+    std::vector<RegisteredMemoryAccount> registeredMemoryAccounts;
+    std::jthread statisticsThread;
 
     friend class QueryEngine;
 };
 
 /// Marks every Thread which has not explicitly been created by the ThreadPool as a non-worker thread
 thread_local WorkerThreadId ThreadPool::WorkerThread::id = INVALID<WorkerThreadId>;
+thread_local size_t ThreadPool::WorkerThread::localQueueIndex = TaskQueue<Task>::NoLocalQueue;
+thread_local size_t ThreadPool::WorkerThread::inlineContinuationDepth = 0;
+thread_local size_t ThreadPool::WorkerThread::numaNodeIndex = std::numeric_limits<size_t>::max();
+thread_local bool ThreadPool::WorkerThread::isExecutingBatch = false;
 
 bool ThreadPool::WorkerThread::operator()(WorkTask& task) const
 {
@@ -473,46 +857,210 @@ bool ThreadPool::WorkerThread::operator()(WorkTask& task) const
         return false;
     }
 
-    const auto taskId = TaskId(pool.taskIdCounter++);
+    auto taskId = TaskId(pool.taskIdCounter++);
     if (auto pipeline = task.pipeline.lock())
     {
         ENGINE_LOG_DEBUG("Handle Task for {}-{}. Tuples: {}", task.queryId, pipeline->id, task.buf.getNumberOfTuples());
+        /// The task of the batch that the pipeline currently executes, c.f., executeBatch
+        WorkTask* currentTask = std::addressof(task);
+        bool repeatedTask = false;
         DefaultPEC pec(
-            pool.numberOfThreads(),
+            pool.maxNumberOfThreads,
             WorkerThread::id,
             pipeline->id,
-            pool.bufferProvider,
+            pool.bufferProviderOf(*pipeline),
             [&](const TupleBuffer& tupleBuffer, PipelineExecutionContext::ContinuationPolicy continuationPolicy)
             {
                 ENGINE_LOG_DEBUG(
                     "Task emitted tuple buffer {}-{}. Tuples: {}", task.queryId, task.pipelineId, tupleBuffer.getNumberOfTuples());
+                if (pipeline->sourceFlowControl)
+                {
+                    pipeline->sourceFlowControl->reportWatermark(tupleBuffer.getOriginId(), tupleBuffer.getWatermark());
+                }
+                auto buffer = tupleBuffer;
+                if (pipeline->loadShedder && pipeline->loadShedder->shouldShed(buffer.getOriginId(), queueingDelayOf(*currentTask)))
+                {
+                    /// The shed buffer keeps its sequence number, chunk number and watermark, which the successors require to advance
+                    ENGINE_LOG_DEBUG("Shed tuple buffer {}-{}. Tuples: {}", task.queryId, task.pipelineId, buffer.getNumberOfTuples());
+                    buffer.setNumberOfTuples(0);
+                }
+                if (pipeline->statistics)
+                {
+                    pipeline->statistics->recordEmit(id, buffer.getNumberOfTuples());
+                }
+                /// The wait of the emitting task estimates the wait of the emitted buffer, as both wait in the same task queue. The buffer
+                /// is compressed at most once and shared by all successors that queue it.
+                const bool compressesBuffer = pipeline->bufferCompressionDelay > std::chrono::milliseconds::zero()
+                    and queueingDelayOf(*currentTask) >= pipeline->bufferCompressionDelay;
+                bool attemptedCompression = false;
+                std::optional<TupleBuffer> compressedBuffer;
                 return std::ranges::all_of(
                     pipeline->successors,
                     [&](const auto& successor)
                     {
-                        pool.statistic->onEvent(
-                            TaskEmit{id, task.queryId, pipeline->id, successor->id, taskId, tupleBuffer.getNumberOfTuples()});
-                        return pool.emitWork(task.queryId, successor, tupleBuffer, TaskCallback{}, continuationPolicy);
+                        if (pool.reportsEventsOf(taskId))
+                        {
+                            pool.statistic->onEvent(
+                                TaskEmit{id, task.queryId, pipeline->id, successor->id, taskId, buffer.getNumberOfTuples()});
+                        }
+                        if (compressesBuffer and not pool.continuesInline(*successor, continuationPolicy))
+                        {
+                            if (not attemptedCompression)
+                            {
+                                attemptedCompression = true;
+                                compressedBuffer = BufferCompression::compress(buffer, *pool.bufferProviderOf(*pipeline));
+                            }
+                            if (compressedBuffer)
+                            {
+                                return pool.emitCompressedWork(task.queryId, successor, *compressedBuffer, buffer.getBufferSize());
+                            }
+                        }
+                        return pool.emitWork(task.queryId, successor, buffer, TaskCallback{}, continuationPolicy);
                     });
             },
             [&](const TupleBuffer& tupleBuffer, std::chrono::milliseconds duration)
             {
+                repeatedTask = true;
+                /// The repeated task is a pending task of its own, as completing the current task decrements the pending tasks as well
+                pipeline->pendingTasks.fetch_add(1);
                 if (duration.count() > 0)
                 {
                     pool.delayedTaskSubmitter.submitTaskIn(
-                        WorkTask(task.queryId, pipeline->id, pipeline, tupleBuffer, std::move(task.callback)), duration);
+                        WorkTask(task.queryId, pipeline->id, pipeline, tupleBuffer, std::move(currentTask->callback)), duration);
                 }
                 else
                 {
-                    pool.addInternalTask(WorkTask(task.queryId, pipeline->id, pipeline, tupleBuffer, std::move(task.callback)));
+                    pool.addInternalTask(
+                        WorkTask(task.queryId, pipeline->id, pipeline, tupleBuffer, std::move(currentTask->callback)),
+                        toPriorityClass(pipeline->priority));
+                }
+                if (pool.reportsEventsOf(taskId))
+                {
+                    pool.statistic->onEvent(
+                        TaskEmit{id, task.queryId, pipeline->id, pipeline->id, taskId, tupleBuffer.getNumberOfTuples()});
+                }
+            },
+            [&](const TupleBuffer& tupleBuffer)
+            {
+                /// Submitted tasks never continue inline, as the pipeline submits them for other WorkerThreads to process concurrently
+                if (pool.reportsEventsOf(taskId))
+                {
+                    pool.statistic->onEvent(
+                        TaskEmit{id, task.queryId, pipeline->id, pipeline->id, taskId, tupleBuffer.getNumberOfTuples()});
+                }
+                pool.emitWork(task.queryId, pipeline, tupleBuffer, TaskCallback{}, PipelineExecutionContext::ContinuationPolicy::NEVER);
+            },
+            [&](const TupleBuffer& tupleBuffer, const Timestamp deadline)
+            {
+                ENGINE_LOG_DEBUG(
+                    "Task emitted tuple buffer {}-{} due at {}. Tuples: {}",
+                    task.queryId,
+                    task.pipelineId,
+                    deadline,
+                    tupleBuffer.getNumberOfTuples());
+                if (pipeline->statistics)
+                {
+                    pipeline->statistics->recordEmit(id, tupleBuffer.getNumberOfTuples());
+                }
+                return std::ranges::all_of(
+                    pipeline->successors,
+                    [&](const auto& successor)
+                    {
+                        if (pool.reportsEventsOf(taskId))
+                        {
+                            pool.statistic->onEvent(
+                                TaskEmit{id, task.queryId, pipeline->id, successor->id, taskId, tupleBuffer.getNumberOfTuples()});
+                        }
+                        return pool.emitWorkWithDeadline(task.queryId, successor, tupleBuffer, deadline);
+                    });
+            });
+        /// Counting the task in the pipeline statistics costs two reads of the clock, reporting its events costs two calls of the listeners
+        const auto execute = [&](WorkTask& executedTask)
+        {
+            if (executedTask.uncompressedSize > 0)
+            {
+                executedTask.buf = BufferCompression::decompress(
+                    executedTask.buf, executedTask.uncompressedSize, *pool.bufferProviderOf(*pipeline));
+                executedTask.uncompressedSize = 0;
+            }
+            const bool reportsEvents = pool.reportsEventsOf(taskId);
+            const auto numberOfTuples = executedTask.buf.getNumberOfTuples();
+            if (reportsEvents)
+            {
+                pool.statistic->onEvent(TaskExecutionStart{
+                    WorkerThread::id, task.queryId, pipeline->id, taskId, numberOfTuples, queueingDelayOf(executedTask)});
+            }
+            if (pipeline->statistics)
+            {
+                const auto start = std::chrono::steady_clock::now();
+                pipeline->stage->execute(executedTask.buf, pec);
+                pipeline->statistics->record(
+                    WorkerThread::id, numberOfTuples, std::chrono::steady_clock::now() - start, start - executedTask.emitTime);
+                /// Buffers without a creation timestamp, e.g., of tests or of empty watermark updates, carry no ingestion latency
+                if (const auto creationTs = executedTask.buf.getCreationTimestampInMS(); creationTs != Timestamp(Timestamp::INITIAL_VALUE))
+                {
+                    /// The same clock as the creation timestamps, otherwise a coarse clock would skew the latencies by its resolution
+                    const auto now = std::chrono::milliseconds(CoarseClock::now().getRawValue());
+                    const auto latestCreationTs = executedTask.buf.getLatestCreationTimestampInMS();
+                    pipeline->statistics->recordIngestionLatency(
+                        WorkerThread::id,
+                        now - std::chrono::milliseconds(latestCreationTs.getRawValue()),
+                        now - std::chrono::milliseconds(creationTs.getRawValue()));
                 }
-                pool.statistic->onEvent(TaskEmit{id, task.queryId, pipeline->id, pipeline->id, taskId, tupleBuffer.getNumberOfTuples()});
             }
+            else
+            {
+                pipeline->stage->execute(executedTask.buf, pec);
+            }
+            if (reportsEvents)
+            {
+                pool.statistic->onEvent(TaskExecutionComplete{WorkerThread::id, task.queryId, pipeline->id, taskId});
+            }
+        };
+        execute(task);
+
+        /// Inline continuations and the tasks that end a batch run on the stack of another task, thus they must not dequeue further tasks.
+        /// A repeated task leaves the pipeline execution context unusable.
+        if (pool.maxWorkTaskBatchSize <= 1 or repeatedTask or isExecutingBatch or inlineContinuationDepth > 0
+            or localQueueIndex == TaskQueue<Task>::NoLocalQueue)
+        {
+            return true;
+        }
 
-        );
-        pool.statistic->onEvent(TaskExecutionStart{WorkerThread::id, task.queryId, pipeline->id, taskId, task.buf.getNumberOfTuples()});
-        pipeline->stage->execute(task.buf, pec);
-        pool.statistic->onEvent(TaskExecutionComplete{WorkerThread::id, task.queryId, pipeline->id, taskId});
+        /// The WorkTasks of the same pipeline that are queued right behind this task reuse its pipeline execution context.
+        /// Solely tasks that are already queued join the batch, thus no task waits for a batch to fill up.
+        isExecutingBatch = true;
+        const auto executeBatchedTask = [&]<typename T>(T& batchedTask) -> bool
+        {
+            if constexpr (std::same_as<T, WorkTask>)
+            {
+                currentTask = std::addressof(batchedTask);
+                taskId = TaskId(pool.taskIdCounter++);
+                execute(batchedTask);
+                return true;
+            }
+            INVARIANT(false, "Solely WorkTasks of pipeline {}-{} are added to its batch", task.queryId, pipeline->id);
+            return false;
+        };
+        const auto batchStart = std::chrono::steady_clock::now();
+        for (size_t batchSize = 1; batchSize < pool.maxWorkTaskBatchSize and not repeatedTask
+             and std::chrono::steady_clock::now() - batchStart < pool.maxWorkTaskBatchDuration;
+             ++batchSize)
+        {
+            auto nextTask = pool.taskQueue.getNextTaskNonBlocking(localQueueIndex);
+            if (not nextTask)
+            {
+                break;
+            }
+            const auto* const nextWorkTask = std::get_if<WorkTask>(std::addressof(*nextTask));
+            if (nextWorkTask == nullptr or nextWorkTask->queryId != task.queryId or nextWorkTask->pipelineId != pipeline->id)
+            {
+                handleTask(*this, std::move(*nextTask));
+                break;
+            }
+            handleTask(executeBatchedTask, std::move(*nextTask));
+        }
+        isExecutingBatch = false;
         return true;
     }
 
@@ -534,10 +1082,10 @@ bool ThreadPool::WorkerThread::operator()(StartPipelineTask& startPipeline) cons
     {
         ENGINE_LOG_DEBUG("Setup Pipeline Task for {}-{}", startPipeline.queryId, pipeline->id);
         DefaultPEC pec(
-            pool.numberOfThreads(),
+            pool.maxNumberOfThreads,
             WorkerThread::id,
             pipeline->id,
-            pool.bufferProvider,
+            pool.bufferProviderOf(*pipeline),
             [](const TupleBuffer&, PipelineExecutionContext::ContinuationPolicy)
             {
                 /// Catch Emits, that are currently not supported during pipeline stage initialization.
@@ -554,8 +1102,11 @@ bool ThreadPool::WorkerThread::operator()(StartPipelineTask& startPipeline) cons
                     "Repeat pipeline setup is currently not supported. Although there is no inherit reason this wouldn't work, but its not "
                     "tested");
             });
+        const auto start = std::chrono::steady_clock::now();
         pipeline->stage->start(pec);
-        pool.statistic->onEvent(PipelineStart{WorkerThread::id, startPipeline.queryId, pipeline->id});
+        const auto startDuration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+        ENGINE_LOG_INFO("Started pipeline {}-{} in {}ms", startPipeline.queryId, pipeline->id, startDuration.count() / 1000.0);
+        pool.statistic->onEvent(PipelineStart{WorkerThread::id, startPipeline.queryId, pipeline->id, startDuration});
         return true;
     }
 
@@ -579,27 +1130,14 @@ bool ThreadPool::WorkerThread::operator()(PendingPipelineStopTask& pendingPipeli
     if (pendingPipelineStop.pipeline->pendingTasks > 0)
     {
         ENGINE_LOG_TRACE(
-            "Pipeline {}-{} is still active: {}. Seen for {}th time",
+            "Pipeline {}-{} is still active: {}. Deferring its stop until the last pending task completed",
             pendingPipelineStop.queryId,
             pendingPipelineStop.pipeline->id,
-            pendingPipelineStop.pipeline->pendingTasks,
-            pendingPipelineStop.attempts);
-
-        PendingPipelineStopTask repeatTask(
-            pendingPipelineStop.queryId,
-            pendingPipelineStop.pipeline,
-            pendingPipelineStop.attempts + 1,
-            std::move(pendingPipelineStop.callback));
-        /// If we have seen this pipeline for the third time, we will add some work from the admission queue to the internal queue.
-        /// We need to do this, as the pipeline might be stuck in a deadlock as it is waiting for data from a source which has not been moved into the internal queue.
-        if (pendingPipelineStop.attempts >= PIPELINE_STOP_BACKOFF_THRESHOLD)
-        {
-            pool.delayedTaskSubmitter.submitTaskIn(std::move(repeatTask), PIPELINE_STOP_BACKOFF_INTERVAL);
-        }
-        else
-        {
-            pool.addInternalTask(std::move(repeatTask));
-        }
+            pendingPipelineStop.pipeline->pendingTasks);
+        /// The deferred stop occupies no slot of the task queue, thus the pending tasks, including the ones in the admission queue,
+        /// drain without competing with the stop.
+        const auto pipeline = pendingPipelineStop.pipeline;
+        pipeline->deferPendingStop(std::move(pendingPipelineStop));
         return false;
     }
 
@@ -610,10 +1148,10 @@ bool ThreadPool::WorkerThread::operator()(StopPipelineTask& stopPipelineTask) co
 {
     ENGINE_LOG_DEBUG("Stop Pipeline Task for {}-{}", stopPipelineTask.queryId, stopPipelineTask.pipeline->id);
     DefaultPEC pec(
-        pool.numberOfThreads(),
+        pool.maxNumberOfThreads,
         WorkerThread::id,
         stopPipelineTask.pipeline->id,
-        pool.bufferProvider,
+        pool.bufferProviderOf(*stopPipelineTask.pipeline),
         [&](const TupleBuffer& tupleBuffer, PipelineExecutionContext::ContinuationPolicy policy)
         {
             if (terminating)
@@ -721,30 +1259,176 @@ bool ThreadPool::WorkerThread::operator()(FailSourceTask& failSource) const
     return false;
 }
 
-void ThreadPool::addThread()
+bool ThreadPool::addThread()
 {
-    pool.emplace_back(
-        [this, id = numberOfThreads_++](const std::stop_token& stopToken)
+    const std::scoped_lock lock(poolMutex);
+    const auto freeSlot = std::ranges::find(isThreadRunning, false);
+    if (freeSlot == isThreadRunning.end())
+    {
+        return false;
+    }
+    *freeSlot = true;
+    ++numberOfThreads_;
+    const auto id = static_cast<size_t>(std::distance(isThreadRunning.begin(), freeSlot));
+    pool[id] = std::jthread(
+        [this, id](const std::stop_token& stopToken)
         {
             WorkerThread::id = WorkerThreadId(WorkerThreadId::INITIAL + id);
+            WorkerThread::localQueueIndex = id;
+            WorkerThread::numaNodeIndex = numaNodeOf(id);
+            pinWorkerThread(id, WorkerThread::numaNodeIndex);
             setThreadName(fmt::format("WorkerThread-{}", id));
             const WorkerThread worker{*this, false};
+            /// Solely the WorkerThread writes its flag, thus marking a task costs two uncontended stores
+            auto& isBusy = busyThreads[id].isBusy;
+            const auto handleTaskBusy = [&](Task&& task)
+            {
+                isBusy.store(true, std::memory_order_relaxed);
+                handleTask(worker, std::move(task));
+                isBusy.store(false, std::memory_order_relaxed);
+            };
             while (!stopToken.stop_requested())
             {
-                if (auto task = taskQueue.getNextTaskBlocking(stopToken))
+                if (not isElastic())
+                {
+                    if (auto task = taskQueue.getNextTaskBlocking(stopToken, WorkerThread::localQueueIndex))
+                    {
+                        handleTaskBusy(std::move(*task));
+                    }
+                    continue;
+                }
+
+                if (auto task = taskQueue.getNextTaskBlocking(stopToken, idleTimeout, WorkerThread::localQueueIndex))
                 {
-                    handleTask(worker, std::move(*task));
+                    handleTaskBusy(std::move(*task));
+                    continue;
+                }
+                if (stopToken.stop_requested())
+                {
+                    break;
+                }
+                /// The WorkerThread was idle for the idle timeout. It owns no tasks anymore, as the owner of a local queue reads it first.
+                const std::scoped_lock poolLock(poolMutex);
+                if (numberOfThreads_ > minNumberOfThreads)
+                {
+                    ENGINE_LOG_INFO("WorkerThread {} stops after being idle for {}ms", id, idleTimeout.count());
+                    isThreadRunning[id] = false;
+                    --numberOfThreads_;
+                    return;
                 }
             }
 
             ENGINE_LOG_INFO("WorkerThread {} shutting down", id);
             /// Worker in termination mode will not emit further work and eventually clear the task queue and terminate.
             const WorkerThread terminatingWorker{*this, true};
-            while (auto task = taskQueue.getNextTaskNonBlocking())
+            while (auto task = taskQueue.getNextTaskNonBlocking(WorkerThread::localQueueIndex))
             {
                 handleTask(terminatingWorker, std::move(*task));
             }
         });
+    return true;
+}
+
+void ThreadPool::addCompilationThread()
+{
+    compilationThreads.emplace_back(
+        [this, id = compilationThreads.size()](const std::stop_token& stopToken)
+        {
+            /// Starting a pipeline may emit internal tasks, which requires a WorkerThreadId. Compilation threads own no local task queue.
+            WorkerThread::id = WorkerThreadId(WorkerThreadId::INITIAL + maxNumberOfThreads + id);
+            setThreadName(fmt::format("CompilerThread-{}", id));
+            const WorkerThread worker{*this, false};
+            while (auto task = takeCompilationTask(stopToken))
+            {
+                handleTask(worker, std::move(*task));
+            }
+
+            ENGINE_LOG_INFO("CompilationThread {} shutting down", id);
+            const WorkerThread terminatingWorker{*this, true};
+            std::deque<Task> pendingTasks;
+            {
+                const std::scoped_lock lock(compilationMutex);
+                pendingTasks.swap(compilationTasks);
+            }
+            for (auto& task : pendingTasks)
+            {
+                handleTask(terminatingWorker, std::move(task));
+            }
+        });
+}
+
+void ThreadPool::startElasticScaling()
+{
+    PRECONDITION(isElastic(), "Elastic scaling requires a maximum number of threads above the minimum number of threads");
+    scalingThread = std::jthread(
+        [this](const std::stop_token& stopToken)
+        {
+            setThreadName("WorkerScaling");
+            std::mutex mutex;
+            std::condition_variable_any stopped;
+            auto numberOfBlockedAdmissions = taskQueue.getNumberOfBlockedAdmissions();
+            std::unique_lock lock(mutex);
+            while (not stopToken.stop_requested())
+            {
+                /// Waits for the interval, unless a stop is requested
+                stopped.wait_for(lock, stopToken, ELASTIC_SCALING_INTERVAL, [] { return false; });
+                if (stopToken.stop_requested())
+                {
+                    return;
+                }
+                /// Every running WorkerThread has at least one task waiting for it, or a source had to wait for an admission slot
+                const auto currentBlockedAdmissions = taskQueue.getNumberOfBlockedAdmissions();
+                const bool admissionWasBlocked = currentBlockedAdmissions != numberOfBlockedAdmissions;
+                numberOfBlockedAdmissions = currentBlockedAdmissions;
+                if ((admissionWasBlocked || taskQueue.getApproximateNumberOfTasks() > numberOfThreads()) && addThread())
+                {
+                    ENGINE_LOG_INFO("Added WorkerThread, {} of at most {} WorkerThreads run", numberOfThreads(), maxNumberOfThreads);
+                }
+            }
+        });
+}
+
+void ThreadPool::startPipelineStatistics()
+{
+    PRECONDITION(
+        pipelineStatisticsInterval > std::chrono::milliseconds::zero(), "Reporting pipeline statistics requires an interval above zero");
+    statisticsThread = std::jthread(
+        [this](const std::stop_token& stopToken)
+        {
+            setThreadName("PipelineStats");
+            std::mutex mutex;
+            std::condition_variable_any stopped;
+            std::unique_lock lock(mutex);
+            while (not stopToken.stop_requested())
+            {
+                /// Waits for the interval, unless a stop is requested
+                stopped.wait_for(lock, stopToken, pipelineStatisticsInterval, [] { return false; });
+                std::vector<RegisteredPipelineStatistics> pipelines;
+                {
+                    const std::scoped_lock registryLock(pipelineStatisticsMutex);
+                    /// Statistics which solely the registry holds belong to destroyed pipelines, thus this is the last report of them
+                    const auto destroyedPipelines = std::ranges::partition(
+                        registeredPipelineStatistics, [](const auto& pipeline) { return pipeline.statistics.use_count() > 1; });
+                    pipelines = registeredPipelineStatistics;
+                    registeredPipelineStatistics.erase(destroyedPipelines.begin(), destroyedPipelines.end());
+                }
+                for (const auto& [queryId, pipelineId, statistics] : pipelines)
+                {
+                    if (maxStateImbalance > 0)
+                    {
+                        statistics->updateRebalancing(maxStateImbalance, numberOfThreads());
+                    }
+                    const auto snapshot = statistics->snapshot();
+                    statistic->onEvent(PipelineStatisticsSample{
+                        queryId,
+                        pipelineId,
+                        snapshot.numberOfTasks,
+                        snapshot.numberOfTuples,
+                        snapshot.executionTime,
+                        std::vector<uint64_t>(snapshot.latencyHistogram.begin(), snapshot.latencyHistogram.end())});
+                }
+            }
+        });
 }
 
 QueryEngine::QueryEngine(
@@ -752,16 +1436,41 @@ QueryEngine::QueryEngine(
     std::shared_ptr<QueryEngineStatisticListener> statListener,
     std::shared_ptr<AbstractQueryStatusListener> listener,
     std::shared_ptr<BufferManager> bm)
-    : bufferManager(std::move(bm))
+    : QueryEngine(config, std::move(statListener), std::move(listener), std::vector{std::move(bm)})
+{
+}
+
+QueryEngine::QueryEngine(
+    const QueryEngineConfiguration& config,
+    std::shared_ptr<QueryEngineStatisticListener> statListener,
+    std::shared_ptr<AbstractQueryStatusListener> listener,
+    std::vector<std::shared_ptr<BufferManager>> numaLocalBufferManagers)
+    : bufferManager(numaLocalBufferManagers.at(0))
     , statusListener(std::move(listener))
     , statisticListener(std::move(statListener))
     , queryCatalog(std::make_shared<QueryCatalog>())
-    , threadPool(std::make_unique<ThreadPool>(statusListener, statisticListener, bufferManager, config.admissionQueueSize.getValue()))
+    , threadPool(std::make_unique<ThreadPool>(
+          statusListener,
+          statisticListener,
+          std::move(numaLocalBufferManagers),
+          config))
 {
     for (size_t i = 0; i < config.numberOfWorkerThreads.getValue(); ++i)
     {
         threadPool->addThread();
     }
+    for (size_t i = 0; i < config.numberOfCompilationThreads.getValue(); ++i)
+    {
+        threadPool->addCompilationThread();
+    }
+    if (threadPool->isElastic())
+    {
+        threadPool->startElasticScaling();
+    }
+    if (config.pipelineStatisticsInterval.getValue() > 0)
+    {
+        threadPool->startPipelineStatistics();
+    }
 }
 
 /// NOLINTNEXTLINE Intentionally non-const
@@ -774,6 +1483,12 @@ void QueryEngine::stop(QueryId queryId)
 /// NOLINTNEXTLINE Intentionally non-const
 void QueryEngine::start(std::unique_ptr<ExecutableQueryPlan> executableQueryPlan)
 {
+    if (executableQueryPlan->bufferCompressionDelay > std::chrono::milliseconds::zero() and not BufferCompression::isAvailable())
+    {
+        ENGINE_LOG_WARNING(
+            "Query {} compresses its queued buffers, but the QueryEngine was built without NES_ENABLE_BUFFER_COMPRESSION",
+            executableQueryPlan->queryId);
+    }
     threadPool->taskQueue.addAdmissionTaskBlocking(
         {}, StartQueryTask{executableQueryPlan->queryId, std::move(executableQueryPlan), queryCatalog, TaskCallback{}});
 }
@@ -784,6 +1499,106 @@ QueryEngine::~QueryEngine()
     queryCatalog->clear();
 }
 
+EngineMetrics QueryEngine::getEngineMetrics() const
+{
+    EngineMetrics metrics{
+        .numberOfWorkerThreads = threadPool->numberOfThreads(),
+        .numberOfBusyWorkerThreads = static_cast<size_t>(std::ranges::count_if(
+            threadPool->busyThreads, [](const auto& flag) { return flag.isBusy.load(std::memory_order_relaxed); })),
+        .numberOfBlockedAdmissions = threadPool->taskQueue.getNumberOfBlockedAdmissions(),
+        .queueDepths = {},
+        .sources = {}};
+    for (size_t priorityClass = 0; priorityClass < threadPool->taskQueue.getNumberOfPriorityClasses(); ++priorityClass)
+    {
+        const auto [admission, internal, deadline] = threadPool->taskQueue.getQueueDepth(priorityClass);
+        metrics.queueDepths.push_back({.admission = admission, .internal = internal, .deadline = deadline});
+    }
+    for (const auto& numaLocalBufferManager : threadPool->numaLocalBufferManagers)
+    {
+        metrics.numberOfPooledBuffers += numaLocalBufferManager->getNumOfPooledBuffers();
+        metrics.numberOfAvailableBuffers += numaLocalBufferManager->getNumberOfAvailableBuffers();
+        metrics.numberOfUnpooledBuffers += numaLocalBufferManager->getNumOfUnpooledBuffers();
+    }
+
+    const std::scoped_lock lock(threadPool->sourceFlowControlMutex);
+    for (const auto& [queryId, registeredFlowControl] : threadPool->registeredSourceFlowControls)
+    {
+        if (const auto flowControl = registeredFlowControl.lock())
+        {
+            for (const auto& source : flowControl->getSourceMetrics())
+            {
+                metrics.sources.push_back(
+                    {.queryId = queryId,
+                     .originId = source.originId,
+                     .numberOfBuffers = source.numberOfBuffers,
+                     .numberOfBytes = source.numberOfBytes,
+                     .numberOfInflightBuffers = source.numberOfInflightBuffers,
+                     .peakNumberOfInflightBuffers = source.peakNumberOfInflightBuffers,
+                     .watermark = source.watermark});
+            }
+        }
+    }
+    return metrics;
+}
+
+std::vector<PipelineMetrics> QueryEngine::getPipelineMetrics(const QueryId queryId) const
+{
+    std::vector<PipelineMetrics> metrics;
+    const std::scoped_lock lock(threadPool->pipelineStatisticsMutex);
+    for (const auto& [pipelineQueryId, pipelineId, statistics] : threadPool->registeredPipelineStatistics)
+    {
+        /// Statistics which solely the registry holds belong to destroyed pipelines
+        if (pipelineQueryId != queryId || statistics.use_count() == 1)
+        {
+            continue;
+        }
+        const auto snapshot = statistics->snapshot();
+        auto stageSnapshot = statistics->snapshotStage();
+        metrics.push_back(
+            {.pipelineId = pipelineId,
+             .numberOfTasks = snapshot.numberOfTasks,
+             .numberOfInputTuples = snapshot.numberOfTuples,
+             .numberOfEmittedTuples = snapshot.numberOfEmittedTuples,
+             .numberOfEmittedBuffers = snapshot.numberOfEmittedBuffers,
+             .executionTime = snapshot.executionTime,
+             .queueingDelay = snapshot.queueingDelay,
+             .latencyHistogram = std::vector<uint64_t>(snapshot.latencyHistogram.begin(), snapshot.latencyHistogram.end()),
+             .ingestionLatencyHistogram
+             = std::vector<uint64_t>(snapshot.ingestionLatencyHistogram.begin(), snapshot.ingestionLatencyHistogram.end()),
+             .oldestIngestionLatencyHistogram
+             = std::vector<uint64_t>(snapshot.oldestIngestionLatencyHistogram.begin(), snapshot.oldestIngestionLatencyHistogram.end()),
+             .successors = std::move(stageSnapshot.successors),
+             .operatorCosts = std::move(stageSnapshot.operatorCosts),
+             .stateSizeInBytes = stageSnapshot.stateSizeInBytes,
+             .peakStateSizeInBytes = stageSnapshot.peakStateSizeInBytes,
+             .stateSizeInBytesPerWorkerThread = std::move(stageSnapshot.stateSizeInBytesPerWorkerThread),
+             .isRebalancing = statistics->isRebalancing(),
+             .bufferUsage = stageSnapshot.bufferUsage,
+             .peakBufferUsage = stageSnapshot.peakBufferUsage});
+    }
+    return metrics;
+}
+
+std::optional<QueryMemoryMetrics> QueryEngine::getQueryMemory(const QueryId queryId) const
+{
+    const std::scoped_lock lock(threadPool->memoryAccountMutex);
+    /// A restarted query registers a new account, thus the latest account of the query is reported
+    for (const auto& [accountQueryId, registeredAccount] : threadPool->registeredMemoryAccounts | std::views::reverse)
+    {
+        if (accountQueryId != queryId)
+        {
+            continue;
+        }
+        if (const auto account = registeredAccount.lock())
+        {
+            return QueryMemoryMetrics{
+                .usedBytes = account->getUsedBytes(), .peakBytes = account->getPeakBytes(), .quotaInBytes = account->getQuotaInBytes()};
+        }
+        return std::nullopt;
+    }
+    return std::nullopt;
+}
+
 void QueryCatalog::start(
     QueryId queryId,
     std::unique_ptr<ExecutableQueryPlan> plan,
@@ -883,6 +1698,16 @@ void QueryCatalog::start(
                 {
                     listener->logQueryStatusChange(queryId, QueryState::Stopped, timestamp);
                     statistic->onEvent(QueryStop(ThreadPool::WorkerThread::id, queryId));
+                    for (auto& [functionName, calls, invalidInputs, errors] : FunctionStatistics::snapshot())
+                    {
+                        statistic->onEvent(
+                            FunctionStatistic(ThreadPool::WorkerThread::id, queryId, std::move(functionName), calls, invalidInputs, errors));
+                    }
+                    for (auto& [operatorName, filters, filterSizeInBytes, probes, hits] : BloomFilterStatistics::snapshot())
+                    {
+                        statistic->onEvent(BloomFilterStatistic(
+                            ThreadPool::WorkerThread::id, queryId, std::move(operatorName), filters, filterSizeInBytes, probes, hits));
+                    }
                 }
             }
         }
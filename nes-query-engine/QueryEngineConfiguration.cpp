@@ -81,4 +81,42 @@ std::shared_ptr<ConfigurationValidation> QueryEngineConfiguration::queueSizeVali
 
     return std::make_shared<Validator>();
 }
+
+std::shared_ptr<ConfigurationValidation> QueryEngineConfiguration::priorityWeightValidator()
+{
+    struct Validator : ConfigurationValidation
+    {
+        [[nodiscard]] bool isValid(const std::string& stringValue) const override
+        {
+            const auto parsed = Util::from_chars<size_t>(stringValue);
+            if (!parsed || *parsed == 0)
+            {
+                NES_ERROR("Invalid priority weight configuration: {}. Must be a positive number", stringValue.data());
+                return false;
+            }
+            return true;
+        }
+    };
+
+    return std::make_shared<Validator>();
+}
+
+std::shared_ptr<ConfigurationValidation> QueryEngineConfiguration::percentageValidator()
+{
+    struct Validator : ConfigurationValidation
+    {
+        [[nodiscard]] bool isValid(const std::string& stringValue) const override
+        {
+            const auto parsed = Util::from_chars<size_t>(stringValue);
+            if (!parsed || *parsed > 100)
+            {
+                NES_ERROR("Invalid percentage configuration: {}. Must be a number between 0 and 100", stringValue.data());
+                return false;
+            }
+            return true;
+        }
+    };
+
+    return std::make_shared<Validator>();
+}
 }
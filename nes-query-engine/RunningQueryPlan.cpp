@@ -28,6 +28,9 @@
 #include <utility>
 #include <vector>
 #include <Identifiers/Identifiers.hpp>
+#include <Runtime/AbstractBufferProvider.hpp>
+#include <Runtime/AccountedBufferProvider.hpp>
+#include <Runtime/MemoryAccount.hpp>
 #include <Sources/SourceHandle.hpp>
 #include <Sources/SourceReturnType.hpp>
 #include <absl/functional/any_invocable.h>
@@ -37,7 +40,10 @@
 #include <ExecutablePipelineStage.hpp>
 #include <ExecutableQueryPlan.hpp>
 #include <Interfaces.hpp>
+#include <PipelineStatistics.hpp>
 #include <RunningSource.hpp>
+#include <SourceFlowControl.hpp>
+#include <Task.hpp>
 
 namespace NES
 {
@@ -170,6 +176,29 @@ void RunningQueryPlanNode::RunningQueryPlanNodeDeleter::operator()(RunningQueryP
     }
 }
 
+/// With pipeline statistics, every pipeline charges its buffers to an account of its own, which charges the account of the query in turn.
+/// Thus, the statistics break the memory of the query down to the pipelines, which allocated the buffers.
+static std::vector<std::shared_ptr<AbstractBufferProvider>>
+accountPipelineBuffers(PipelineStatistics& statistics, std::vector<std::shared_ptr<AbstractBufferProvider>> bufferProviders)
+{
+    std::shared_ptr<MemoryAccount> pipelineAccount;
+    for (auto& bufferProvider : bufferProviders)
+    {
+        const auto queryBufferProvider = std::dynamic_pointer_cast<AccountedBufferProvider>(bufferProvider);
+        if (not queryBufferProvider)
+        {
+            continue;
+        }
+        if (not pipelineAccount)
+        {
+            pipelineAccount = std::make_shared<MemoryAccount>(0, queryBufferProvider->getMemoryAccount());
+            statistics.attachMemoryAccount(pipelineAccount);
+        }
+        bufferProvider = std::make_shared<AccountedBufferProvider>(queryBufferProvider->getBufferProvider(), pipelineAccount);
+    }
+    return bufferProviders;
+}
+
 std::shared_ptr<RunningQueryPlanNode> RunningQueryPlanNode::create(
     QueryId queryId,
     PipelineId pipelineId,
@@ -178,11 +207,23 @@ std::shared_ptr<RunningQueryPlanNode> RunningQueryPlanNode::create(
     std::unique_ptr<ExecutablePipelineStage> stage,
     std::function<void(Exception)> unregisterWithError,
     CallbackRef planRef,
-    CallbackRef setupCallback)
+    CallbackRef setupCallback,
+    std::vector<std::shared_ptr<AbstractBufferProvider>> bufferProviders)
 {
     auto node = std::shared_ptr<RunningQueryPlanNode>(
         new RunningQueryPlanNode(pipelineId, std::move(successors), std::move(stage), std::move(unregisterWithError), std::move(planRef)),
         RunningQueryPlanNodeDeleter{.emitter = emitter, .queryId = queryId});
+    node->statistics = emitter.createPipelineStatistics(queryId, pipelineId);
+    if (node->statistics and node->stage)
+    {
+        node->statistics->attachStage(
+            *node->stage,
+            node->successors | std::views::transform([](const auto& successor) { return successor->id; })
+                | std::ranges::to<std::vector>());
+    }
+    /// The pipeline start already allocates the state of the pipeline, thus the buffer providers are set before it is emitted
+    node->bufferProviders
+        = node->statistics ? accountPipelineBuffers(*node->statistics, std::move(bufferProviders)) : std::move(bufferProviders);
     emitter.emitPipelineStart(
         queryId,
         node,
@@ -202,6 +243,50 @@ std::shared_ptr<RunningQueryPlanNode> RunningQueryPlanNode::create(
 RunningQueryPlanNode::~RunningQueryPlanNode()
 {
     assert(!requiresTermination && "Node was destroyed without termination. This should not happen");
+    if (statistics)
+    {
+        /// The stage is destroyed after the body of the destructor
+        statistics->detachStage();
+    }
+}
+
+void RunningQueryPlanNode::deferPendingStop(PendingPipelineStopTask pendingStop)
+{
+    {
+        auto locked = deferredPendingStops.wlock();
+        locked->emplace_back(std::move(pendingStop));
+        hasDeferredPendingStops = true;
+    }
+    /// The last pending task might have completed before the pending stop was deferred and thus did not release it
+    if (pendingTasks == 0)
+    {
+        releasePendingStops();
+    }
+}
+
+void RunningQueryPlanNode::releasePendingStops()
+{
+    if (not hasDeferredPendingStops)
+    {
+        return;
+    }
+    std::vector<PendingPipelineStopTask> releasedStops;
+    {
+        auto locked = deferredPendingStops.wlock();
+        releasedStops.swap(*locked);
+        hasDeferredPendingStops = false;
+    }
+    for (auto& pendingStop : releasedStops)
+    {
+        ENGINE_LOG_DEBUG("Releasing Pending Pipeline Stop for {}-{}", pendingStop.queryId, id);
+        /// The decision for a soft stop might have been overruled by a hardstop or system shutdown
+        if (requiresTermination)
+        {
+            pendingStop.succeed();
+        }
+        pendingStop.complete();
+    }
+    /// Destroying the released stops may destroy this node, thus it must not be accessed afterward
 }
 
 void RunningQueryPlanNode::fail(Exception exception) const
@@ -221,6 +306,23 @@ std::
     std::vector<std::pair<std::unique_ptr<SourceHandle>, std::vector<std::shared_ptr<RunningQueryPlanNode>>>> sources;
     std::vector<std::weak_ptr<RunningQueryPlanNode>> pipelines;
     std::unordered_map<ExecutablePipeline*, std::shared_ptr<RunningQueryPlanNode>> cache;
+    std::unordered_map<ExecutablePipeline*, size_t> numberOfPredecessors;
+    const auto bufferProviders = emitter.createBufferProviders(queryId);
+    for (const auto& pipeline : queryPlan.pipelines)
+    {
+        for (const auto& successor : pipeline->successors)
+        {
+            ++numberOfPredecessors[successor.lock().get()];
+        }
+    }
+    for (const auto& [source, successors] : queryPlan.sources)
+    {
+        for (const auto& successor : successors)
+        {
+            ++numberOfPredecessors[successor.lock().get()];
+        }
+    }
+
     std::function<std::shared_ptr<RunningQueryPlanNode>(ExecutablePipeline*)> getOrCreate = [&](ExecutablePipeline* pipeline)
     {
         INVARIANT(pipeline, "Pipeline should not be nullptr");
@@ -241,7 +343,11 @@ std::
             std::move(pipeline->stage),
             unregisterWithError,
             terminationCallbackRef,
-            pipelineSetupCallbackRef);
+            pipelineSetupCallbackRef,
+            bufferProviders);
+        node->numberOfPredecessors = numberOfPredecessors[pipeline];
+        node->priority = queryPlan.priority;
+        node->bufferCompressionDelay = queryPlan.bufferCompressionDelay;
         pipelines.emplace_back(node);
         cache[pipeline] = std::move(node);
         return cache[pipeline];
@@ -317,8 +423,24 @@ std::pair<std::unique_ptr<RunningQueryPlan>, CallbackRef> RunningQueryPlan::star
 
                 /// The RunningQueryPlan is guaranteed to be alive at this point. Otherwise the callback would have been cleared.
                 ENGINE_LOG_DEBUG("Pipeline Setup Completed");
+                std::vector<std::pair<OriginId, size_t>> inflightBufferLimits;
+                for (const auto& [source, successors] : sources)
+                {
+                    inflightBufferLimits.emplace_back(source->getSourceId(), source->getRuntimeConfiguration().inflightBufferLimit);
+                }
+                auto flowControl = std::make_shared<SourceFlowControl>(
+                    inflightBufferLimits, [&emitter] { return emitter.getBufferPoolOccupancy(); });
+                emitter.registerSourceFlowControl(queryId, flowControl);
+                auto loadShedder = emitter.createLoadShedder(queryId, internal.qep->priority);
                 for (auto& [source, successors] : sources)
                 {
+                    /// No task was emitted into the successors of the sources yet, thus the WorkerThreads cannot read the flow control
+                    /// and the load shedder
+                    for (const auto& successor : successors)
+                    {
+                        successor->sourceFlowControl = flowControl;
+                        successor->loadShedder = loadShedder;
+                    }
                     auto sourceId = source->getSourceId();
                     internal.sources.emplace(
                         sourceId,
@@ -350,6 +472,7 @@ std::pair<std::unique_ptr<RunningQueryPlan>, CallbackRef> RunningQueryPlan::star
                                 return true;
                             },
                             [listener](const Exception& exception) { listener->onFailure(exception); },
+                            flowControl,
                             controller,
                             emitter));
                 }
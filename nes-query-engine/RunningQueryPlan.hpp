@@ -14,6 +14,7 @@
 
 #pragma once
 #include <atomic>
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -23,13 +24,19 @@
 #include <utility>
 #include <vector>
 #include <Identifiers/Identifiers.hpp>
+#include <Runtime/AbstractBufferProvider.hpp>
 #include <absl/functional/any_invocable.h>
 #include <folly/Synchronized.h>
 #include <ErrorHandling.hpp>
 #include <ExecutablePipelineStage.hpp>
 #include <ExecutableQueryPlan.hpp>
 #include <Interfaces.hpp>
+#include <LoadShedder.hpp>
+#include <PipelineStatistics.hpp>
+#include <QueryPriority.hpp>
 #include <RunningSource.hpp>
+#include <SourceFlowControl.hpp>
+#include <Task.hpp>
 
 namespace NES
 {
@@ -122,7 +129,8 @@ struct RunningQueryPlanNode
         std::unique_ptr<ExecutablePipelineStage> stage,
         std::function<void(Exception)> unregisterWithError,
         CallbackRef planRef,
-        CallbackRef setupCallback);
+        CallbackRef setupCallback,
+        std::vector<std::shared_ptr<AbstractBufferProvider>> bufferProviders = {});
 
 
     ~RunningQueryPlanNode();
@@ -143,15 +151,42 @@ struct RunningQueryPlanNode
 
     void fail(Exception exception) const;
 
+    /// A pending pipeline stop waits at the pipeline until the pending tasks of the pipeline completed, instead of polling them.
+    /// If the last pending task completed meanwhile, the pending stop is released immediately.
+    void deferPendingStop(PendingPipelineStopTask pendingStop);
+    /// Completes the deferred pending stops, which releases their references onto the pipeline. Called by the last pending task.
+    void releasePendingStops();
+
     PipelineId id;
 
     std::atomic_bool requiresTermination = false;
     std::atomic<ssize_t> pendingTasks = 0;
+    /// Number of sources and pipelines emitting into this pipeline. Only pipelines with a single predecessor are eligible to be
+    /// continued inline on the emitting WorkerThread.
+    size_t numberOfPredecessors = 0;
+    /// Priority class of the tasks of this pipeline within the TaskQueue
+    QueryPriority priority = QueryPriority::NORMAL;
+    /// The WorkerThreads compress the buffers that a task of this pipeline emits, once the task waited longer than the delay in the task
+    /// queue, c.f., BufferCompression. Zero disables the compression.
+    std::chrono::milliseconds bufferCompressionDelay{0};
+    /// Set for the successors of sources, which report the watermarks of the buffers they emit to the flow control of the sources
+    std::shared_ptr<SourceFlowControl> sourceFlowControl;
+    /// Set for the successors of sources if the query sheds load. The successors drop the buffers they dequeue under overload.
+    std::shared_ptr<LoadShedder> loadShedder;
+    /// Set if the QueryEngine reports pipeline statistics. The WorkerThreads count the tasks they execute for the pipeline.
+    std::shared_ptr<PipelineStatistics> statistics;
+    /// Indexed by NUMA node. Charges the buffers of the pipeline to the memory account of its query, c.f.,
+    /// WorkEmitter::createBufferProviders
+    std::vector<std::shared_ptr<AbstractBufferProvider>> bufferProviders;
     std::vector<std::shared_ptr<RunningQueryPlanNode>> successors;
     std::unique_ptr<ExecutablePipelineStage> stage;
 
     std::function<void(Exception)> unregisterWithError;
     CallbackRef planRef;
+
+    /// Solely accessed while tasks of the pipeline are pending during a graceful stop. The flag lets completing tasks skip the lock.
+    folly::Synchronized<std::vector<PendingPipelineStopTask>> deferredPendingStops;
+    std::atomic_bool hasDeferredPendingStops = false;
 };
 
 struct QueryLifetimeListener
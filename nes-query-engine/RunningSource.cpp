@@ -16,11 +16,9 @@
 
 #include <algorithm>
 #include <chrono>
-#include <cstdint>
+#include <cstddef>
 #include <functional>
-#include <limits>
 #include <memory>
-#include <semaphore>
 #include <stop_token>
 #include <utility>
 #include <variant>
@@ -33,6 +31,7 @@
 #include <Interfaces.hpp>
 #include <PipelineExecutionContext.hpp>
 #include <RunningQueryPlan.hpp>
+#include <SourceFlowControl.hpp>
 
 namespace NES
 {
@@ -41,15 +40,16 @@ namespace
 {
 SourceReturnType::EmitFunction emitFunction(
     QueryId queryId,
-    size_t numberOfInflightBuffers,
+    std::shared_ptr<SourceFlowControl> flowControl,
     std::weak_ptr<RunningSource> source,
     std::vector<std::shared_ptr<RunningQueryPlanNode>> successors,
+    const size_t formattedTupleSizeInBytes,
     QueryLifetimeController& controller,
     WorkEmitter& emitter)
 {
-    auto availableBuffer = std::make_shared<std::counting_semaphore<>>(
-        std::min(numberOfInflightBuffers, static_cast<size_t>(std::numeric_limits<int32_t>::max())));
-    return [&controller, successors = std::move(successors), source, &emitter, queryId, availableBuffer = std::move(availableBuffer)](
+    /// Raw buffers of the sources carry their number of bytes as their number of tuples, formatted buffers their number of tuples
+    const auto tupleSize = std::max<size_t>(1, formattedTupleSizeInBytes);
+    return [&controller, successors = std::move(successors), source, &emitter, queryId, flowControl = std::move(flowControl), tupleSize](
                const OriginId sourceId,
                SourceReturnType::SourceReturnType event,
                const std::stop_token& stopToken) -> SourceReturnType::EmitResult
@@ -58,23 +58,20 @@ SourceReturnType::EmitFunction emitFunction(
             Overloaded{
                 [&](const SourceReturnType::Data& data)
                 {
+                    flowControl->reportIngest(sourceId, data.buffer.getNumberOfTuples() * tupleSize);
                     for (const auto& successor : successors)
                     {
+                        /// Every task of the source requires a credit, which the completion of the task refunds
+                        if (not flowControl->acquire(sourceId, stopToken))
                         {
-                            /// release the semaphore in case the source wants to terminate
-                            const std::stop_callback callback(stopToken, [&]() { availableBuffer->release(); });
-                            availableBuffer->acquire();
-                            if (stopToken.stop_requested())
-                            {
-                                return SourceReturnType::EmitResult::STOP_REQUESTED;
-                            }
+                            return SourceReturnType::EmitResult::STOP_REQUESTED;
                         }
                         /// The admission queue might be full, we have to reattempt
                         while (not emitter.emitWork(
                             queryId,
                             successor,
                             data.buffer,
-                            TaskCallback{TaskCallback::OnComplete([availableBuffer] { availableBuffer->release(); })},
+                            TaskCallback{TaskCallback::OnComplete([flowControl, sourceId] { flowControl->refund(sourceId); })},
                             PipelineExecutionContext::ContinuationPolicy::NEVER))
                         {
                             if (stopToken.stop_requested())
@@ -125,14 +122,16 @@ std::shared_ptr<RunningSource> RunningSource::create(
     std::vector<std::shared_ptr<RunningQueryPlanNode>> successors,
     std::function<bool(std::vector<std::shared_ptr<RunningQueryPlanNode>>&&)> tryUnregister,
     std::function<void(Exception)> unregisterWithError,
+    std::shared_ptr<SourceFlowControl> flowControl,
     QueryLifetimeController& controller,
     WorkEmitter& emitter)
 {
-    const auto maxInflightBuffers = source->getRuntimeConfiguration().inflightBufferLimit;
     auto runningSource = std::shared_ptr<RunningSource>(
         new RunningSource(successors, std::move(source), std::move(tryUnregister), std::move(unregisterWithError)));
     ENGINE_LOG_DEBUG("Starting Running Source");
-    runningSource->source->start(emitFunction(queryId, maxInflightBuffers, runningSource, std::move(successors), controller, emitter));
+    const auto formattedTupleSizeInBytes = runningSource->source->getRuntimeConfiguration().formattedTupleSizeInBytes;
+    runningSource->source->start(emitFunction(
+        queryId, std::move(flowControl), runningSource, std::move(successors), formattedTupleSizeInBytes, controller, emitter));
     return runningSource;
 }
 
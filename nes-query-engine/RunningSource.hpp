@@ -20,6 +20,7 @@
 #include <Sources/SourceHandle.hpp>
 #include <ErrorHandling.hpp>
 #include <Interfaces.hpp>
+#include <SourceFlowControl.hpp>
 
 namespace NES
 {
@@ -39,12 +40,14 @@ public:
     /// Creates and starts the underlying source implementation. As long as the RunningSource is kept alive the source will run,
     /// once the last reference to the RunningSource is destroyed the source is stopped.
     /// UnRegistering a source should not block, but it may not succeed (immediately), the tryUnregister
+    /// The source obtains the credits for its tasks from the flow control, which it shares with the other sources of the query.
     static std::shared_ptr<RunningSource> create(
         QueryId queryId,
         std::unique_ptr<SourceHandle> source,
         std::vector<std::shared_ptr<RunningQueryPlanNode>> successors,
         std::function<bool(std::vector<std::shared_ptr<RunningQueryPlanNode>>&&)> tryUnregister,
         std::function<void(Exception)> unregisterWithError,
+        std::shared_ptr<SourceFlowControl> flowControl,
         QueryLifetimeController& controller,
         WorkEmitter& emitter);
 
@@ -0,0 +1,203 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <SourceFlowControl.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ranges>
+#include <stop_token>
+#include <utility>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
+#include <Time/Timestamp.hpp>
+#include <ErrorHandling.hpp>
+
+namespace NES
+{
+
+SourceFlowControl::SourceFlowControl(
+    const std::vector<std::pair<OriginId, size_t>>& inflightBufferLimits, BufferPoolOccupancy bufferPoolOccupancy)
+    : sources(inflightBufferLimits.size()), bufferPoolOccupancy(std::move(bufferPoolOccupancy))
+{
+    PRECONDITION(not inflightBufferLimits.empty(), "The flow control requires at least one source");
+    for (size_t index = 0; index < inflightBufferLimits.size(); ++index)
+    {
+        const auto& [originId, inflightBufferLimit] = inflightBufferLimits[index];
+        PRECONDITION(inflightBufferLimit > 0, "Source {} requires at least one inflight buffer", originId);
+        sources[index].originId = originId;
+        sources[index].inflightBufferLimit = inflightBufferLimit;
+    }
+}
+
+SourceFlowControl::SourceState* SourceFlowControl::findState(const OriginId source)
+{
+    const auto state = std::ranges::find(sources, source, &SourceState::originId);
+    return state == sources.end() ? nullptr : std::addressof(*state);
+}
+
+SourceFlowControl::SourceState& SourceFlowControl::stateOf(const OriginId source)
+{
+    auto* state = findState(source);
+    PRECONDITION(state != nullptr, "Source {} is not registered at the flow control", source);
+    return *state;
+}
+
+double SourceFlowControl::currentOccupancy()
+{
+    if (not bufferPoolOccupancy)
+    {
+        return 0;
+    }
+    const auto now = std::chrono::steady_clock::now().time_since_epoch().count();
+    auto lastRefresh = lastOccupancyRefresh.load(std::memory_order_relaxed);
+    /// Solely the source which wins the exchange refreshes the occupancy, all others use the cached value
+    if (now - lastRefresh >= std::chrono::steady_clock::duration(OCCUPANCY_REFRESH_INTERVAL).count()
+        && lastOccupancyRefresh.compare_exchange_strong(lastRefresh, now, std::memory_order_relaxed))
+    {
+        cachedOccupancy.store(std::clamp(bufferPoolOccupancy(), 0.0, 1.0), std::memory_order_relaxed);
+    }
+    return cachedOccupancy.load(std::memory_order_relaxed);
+}
+
+size_t SourceFlowControl::creditsOf(const SourceState& state)
+{
+    const auto minimumWatermark = std::ranges::min(
+        sources | std::views::transform([](const auto& source) { return source.watermark.load(std::memory_order_relaxed); }));
+    const bool isAhead = state.watermark.load(std::memory_order_relaxed) > minimumWatermark;
+    const auto throttleOccupancy = isAhead ? AHEAD_THROTTLE_OCCUPANCY : THROTTLE_OCCUPANCY;
+
+    const auto occupancy = currentOccupancy();
+    if (occupancy <= throttleOccupancy)
+    {
+        return state.inflightBufferLimit;
+    }
+    /// The credits shrink linearly from the full limit at the throttle occupancy to a single credit at a full buffer pool
+    const auto share = (1.0 - occupancy) / (1.0 - throttleOccupancy);
+    return std::max<size_t>(1, static_cast<size_t>(std::floor(static_cast<double>(state.inflightBufferLimit) * share)));
+}
+
+bool SourceFlowControl::tryTakeCredit(SourceState& state)
+{
+    const auto credits = creditsOf(state);
+    auto inflightBuffers = state.inflightBuffers.load(std::memory_order_relaxed);
+    while (inflightBuffers < credits)
+    {
+        if (state.inflightBuffers.compare_exchange_weak(inflightBuffers, inflightBuffers + 1, std::memory_order_acquire))
+        {
+            auto peak = state.peakInflightBuffers.load(std::memory_order_relaxed);
+            while (peak <= inflightBuffers
+                   && not state.peakInflightBuffers.compare_exchange_weak(peak, inflightBuffers + 1, std::memory_order_relaxed))
+            {
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+bool SourceFlowControl::acquire(const OriginId source, const std::stop_token& stopToken)
+{
+    auto& state = stateOf(source);
+    if (tryTakeCredit(state))
+    {
+        return true;
+    }
+
+    std::unique_lock lock(mutex);
+    numberOfWaitingSources.fetch_add(1);
+    while (not stopToken.stop_requested())
+    {
+        if (creditsChanged.wait_for(lock, stopToken, OCCUPANCY_REFRESH_INTERVAL, [&] { return tryTakeCredit(state); }))
+        {
+            numberOfWaitingSources.fetch_sub(1);
+            return true;
+        }
+    }
+    numberOfWaitingSources.fetch_sub(1);
+    return false;
+}
+
+void SourceFlowControl::notifyWaitingSources()
+{
+    if (numberOfWaitingSources.load() > 0)
+    {
+        /// Taking the lock prevents the notification from getting lost between the check and the wait of a source
+        const std::scoped_lock lock(mutex);
+        creditsChanged.notify_all();
+    }
+}
+
+void SourceFlowControl::refund(const OriginId source)
+{
+    auto& state = stateOf(source);
+    [[maybe_unused]] const auto previousInflightBuffers = state.inflightBuffers.fetch_sub(1, std::memory_order_release);
+    INVARIANT(previousInflightBuffers > 0, "Source {} refunded more credits than it acquired", source);
+    notifyWaitingSources();
+}
+
+void SourceFlowControl::reportWatermark(const OriginId source, const Timestamp watermark)
+{
+    auto* state = findState(source);
+    if (state == nullptr)
+    {
+        return;
+    }
+    auto current = state->watermark.load(std::memory_order_relaxed);
+    while (current < watermark.getRawValue())
+    {
+        if (state->watermark.compare_exchange_weak(current, watermark.getRawValue(), std::memory_order_relaxed))
+        {
+            /// A lagging source that advances may stop throttling the sources which are ahead of it
+            notifyWaitingSources();
+            return;
+        }
+    }
+}
+
+void SourceFlowControl::reportIngest(const OriginId source, const uint64_t numberOfBytes)
+{
+    auto& state = stateOf(source);
+    state.numberOfBuffers.fetch_add(1, std::memory_order_relaxed);
+    state.numberOfBytes.fetch_add(numberOfBytes, std::memory_order_relaxed);
+}
+
+std::vector<SourceFlowControl::SourceMetrics> SourceFlowControl::getSourceMetrics() const
+{
+    std::vector<SourceMetrics> metrics;
+    metrics.reserve(sources.size());
+    for (const auto& source : sources)
+    {
+        metrics.push_back(
+            {.originId = source.originId,
+             .numberOfBuffers = source.numberOfBuffers.load(std::memory_order_relaxed),
+             .numberOfBytes = source.numberOfBytes.load(std::memory_order_relaxed),
+             .numberOfInflightBuffers = source.inflightBuffers.load(std::memory_order_relaxed),
+             .peakNumberOfInflightBuffers = source.peakInflightBuffers.load(std::memory_order_relaxed),
+             .watermark = source.watermark.load(std::memory_order_relaxed)});
+    }
+    return metrics;
+}
+
+size_t SourceFlowControl::getNumberOfCredits(const OriginId source)
+{
+    return creditsOf(stateOf(source));
+}
+
+}
@@ -0,0 +1,111 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <stop_token>
+#include <utility>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
+#include <Time/Timestamp.hpp>
+
+namespace NES
+{
+
+/// Credit based flow control for the sources of a query. A source spends a credit for every task it emits and regains the credit once the
+/// task completed, thus a source cannot emit faster than its successor pipelines drain its buffers.
+/// The credits of a source are bounded by its inflight buffer limit and shrink while the global buffer pool fills up. Sources which are
+/// ahead in event time, i.e., whose successors reported a watermark beyond the minimum watermark of all sources of the query, are throttled
+/// first. The lagging source keeps its credits, which advances the watermark of the query, thus windows trigger and release their buffers
+/// instead of the leading sources exhausting the buffer pool. Every source keeps at least one credit.
+class SourceFlowControl
+{
+public:
+    /// Returns the fraction of the global buffer pool which is in use, between 0 and 1
+    using BufferPoolOccupancy = std::function<double()>;
+
+    struct SourceMetrics
+    {
+        OriginId originId = INVALID_ORIGIN_ID;
+        uint64_t numberOfBuffers = 0;
+        uint64_t numberOfBytes = 0;
+        size_t numberOfInflightBuffers = 0;
+        size_t peakNumberOfInflightBuffers = 0;
+        Timestamp::Underlying watermark = Timestamp::INITIAL_VALUE;
+    };
+
+    /// Below these occupancies of the buffer pool, the sources which are ahead, respectively all other sources, may use all their credits
+    static constexpr double AHEAD_THROTTLE_OCCUPANCY = 0.5;
+    static constexpr double THROTTLE_OCCUPANCY = 0.75;
+    /// The occupancy of the buffer pool changes without notifying the waiting sources, thus they reevaluate their credits periodically
+    static constexpr std::chrono::milliseconds OCCUPANCY_REFRESH_INTERVAL{1};
+
+    /// Every entry of `inflightBufferLimits` registers a source with the maximum number of its inflight buffers
+    SourceFlowControl(const std::vector<std::pair<OriginId, size_t>>& inflightBufferLimits, BufferPoolOccupancy bufferPoolOccupancy);
+
+    /// Blocks until the source obtained a credit. Returns false if a stop was requested before.
+    bool acquire(OriginId source, const std::stop_token& stopToken);
+    /// Returns the credit of a completed task
+    void refund(OriginId source);
+    /// The successors of the sources report the watermarks of the buffers they emit. Buffers of unknown origins are ignored.
+    void reportWatermark(OriginId source, Timestamp watermark);
+    /// Called by the source for every raw buffer it emits. Solely the thread of the source writes its counters.
+    void reportIngest(OriginId source, uint64_t numberOfBytes);
+
+    /// Reads the counters of all sources without synchronizing the sources
+    [[nodiscard]] std::vector<SourceMetrics> getSourceMetrics() const;
+
+    /// Number of tasks the source may have in flight at the current occupancy of the buffer pool
+    [[nodiscard]] size_t getNumberOfCredits(OriginId source);
+
+private:
+    struct SourceState
+    {
+        OriginId originId = INVALID_ORIGIN_ID;
+        size_t inflightBufferLimit = 0;
+        std::atomic<size_t> inflightBuffers{0};
+        /// The buffers of a source stem from its own buffer pool, thus the peak of its inflight buffers sizes the pool
+        std::atomic<size_t> peakInflightBuffers{0};
+        std::atomic<Timestamp::Underlying> watermark{Timestamp::INITIAL_VALUE};
+        std::atomic<uint64_t> numberOfBuffers{0};
+        std::atomic<uint64_t> numberOfBytes{0};
+    };
+
+    [[nodiscard]] SourceState& stateOf(OriginId source);
+    [[nodiscard]] SourceState* findState(OriginId source);
+    [[nodiscard]] size_t creditsOf(const SourceState& state);
+    [[nodiscard]] double currentOccupancy();
+    bool tryTakeCredit(SourceState& state);
+    void notifyWaitingSources();
+
+    std::vector<SourceState> sources;
+    BufferPoolOccupancy bufferPoolOccupancy;
+
+    /// The occupancy is cached, as computing it iterates over the buffer caches of all threads
+    std::atomic<double> cachedOccupancy{0};
+    std::atomic<std::chrono::steady_clock::rep> lastOccupancyRefresh{0};
+
+    std::mutex mutex;
+    std::condition_variable_any creditsChanged;
+    std::atomic<size_t> numberOfWaitingSources{0};
+};
+
+}
@@ -14,6 +14,7 @@
 
 #include <Task.hpp>
 
+#include <chrono>
 #include <cstddef>
 #include <memory>
 #include <tuple>
@@ -44,54 +45,75 @@ TaskCallback::OnFailure::OnFailure(onFailure callback) : callback(std::move(call
 
 void TaskCallback::callOnComplete()
 {
-    if (onCompleteCallback)
+    if (callbacks && callbacks->onCompleteCallback)
     {
         ENGINE_LOG_DEBUG("TaskCallback::callOnComplete");
-        onCompleteCallback();
+        callbacks->onCompleteCallback();
     }
 }
 
 void TaskCallback::callOnSuccess()
 {
-    if (onSuccessCallback)
+    if (callbacks && callbacks->onSuccessCallback)
     {
         ENGINE_LOG_DEBUG("TaskCallback::callOnSuccess");
-        onSuccessCallback();
+        callbacks->onSuccessCallback();
     }
 }
 
 void TaskCallback::callOnFailure(Exception exception)
 {
-    if (onFailureCallback)
+    if (callbacks && callbacks->onFailureCallback)
     {
         ENGINE_LOG_ERROR("TaskCallback::callOnFailure");
-        onFailureCallback(std::move(exception));
+        callbacks->onFailureCallback(std::move(exception));
     }
 }
 
 std::tuple<TaskCallback::OnComplete, TaskCallback::OnFailure, TaskCallback::OnSuccess> TaskCallback::take() &&
 {
-    auto callbacks = std::make_tuple(
-        OnComplete{std::move(onCompleteCallback)}, OnFailure{std::move(onFailureCallback)}, OnSuccess{std::move(onSuccessCallback)});
-    this->onCompleteCallback = {};
-    this->onSuccessCallback = {};
-    this->onFailureCallback = {};
-    return callbacks;
+    if (!callbacks)
+    {
+        return std::make_tuple(OnComplete{{}}, OnFailure{{}}, OnSuccess{{}});
+    }
+    auto taken = std::move(callbacks);
+    return std::make_tuple(
+        OnComplete{std::move(taken->onCompleteCallback)},
+        OnFailure{std::move(taken->onFailureCallback)},
+        OnSuccess{std::move(taken->onSuccessCallback)});
+}
+
+TaskCallback::Callbacks& TaskCallback::getOrCreateCallbacks()
+{
+    if (!callbacks)
+    {
+        callbacks = std::make_unique<Callbacks>();
+    }
+    return *callbacks;
 }
 
 void TaskCallback::processArgs(OnComplete onComplete)
 {
-    onCompleteCallback = std::move(onComplete.callback);
+    if (onComplete.callback)
+    {
+        getOrCreateCallbacks().onCompleteCallback = std::move(onComplete.callback);
+    }
 }
 
 void TaskCallback::processArgs(OnSuccess onSuccess)
 {
-    onSuccessCallback = std::move(onSuccess.callback);
+    if (onSuccess.callback)
+    {
+        getOrCreateCallbacks().onSuccessCallback = std::move(onSuccess.callback);
+    }
 }
 
 void TaskCallback::processArgs(OnFailure onFailure)
 {
-    onFailureCallback = std::move(onFailure.callback);
+    if (onFailure.callback)
+    {
+        getOrCreateCallbacks().onFailureCallback = std::move(onFailure.callback);
+    }
 }
 
 BaseTask::BaseTask(QueryId queryId, TaskCallback callback) : queryId(queryId), callback(std::move(callback))
@@ -115,10 +137,45 @@ void BaseTask::fail(Exception exception)
 
 WorkTask::WorkTask(
     QueryId queryId, PipelineId pipelineId, std::weak_ptr<RunningQueryPlanNode> pipeline, TupleBuffer buf, TaskCallback callback)
-    : BaseTask(queryId, std::move(callback)), pipeline(std::move(pipeline)), pipelineId(pipelineId), buf(std::move(buf))
+    : BaseTask(queryId, std::move(callback))
+    , pipeline(std::move(pipeline))
+    , pipelineId(pipelineId)
+    , buf(std::move(buf))
+    , emitTime(std::chrono::steady_clock::now())
 {
 }
 
+void WorkTask::complete()
+{
+    BaseTask::complete();
+    if (const auto existingPipeline = pipeline.lock())
+    {
+        [[maybe_unused]] const auto updatedCount = existingPipeline->pendingTasks.fetch_sub(1) - 1;
+        ENGINE_LOG_DEBUG("Decreasing number of pending tasks on pipeline {}-{} to {}", queryId, pipelineId, updatedCount);
+        INVARIANT(updatedCount >= 0, "ThreadPool returned a negative number of pending tasks.");
+        if (updatedCount == 0)
+        {
+            existingPipeline->releasePendingStops();
+        }
+    }
+    else
+    {
+        ENGINE_LOG_WARNING("Node Expired and pendingTasks could not be reduced");
+    }
+}
+
+void WorkTask::fail(Exception exception)
+{
+    const auto existingPipeline = pipeline.lock();
+    if (!existingPipeline)
+    {
+        ENGINE_LOG_ERROR("Query Failure could not be reported as query has already been terminated. Original Error: {}", exception.what());
+        return;
+    }
+    BaseTask::fail(exception);
+    existingPipeline->fail(std::move(exception));
+}
+
 StartPipelineTask::StartPipelineTask(
     QueryId queryId, PipelineId pipelineId, TaskCallback callback, std::weak_ptr<RunningQueryPlanNode> pipeline)
     : BaseTask(std::move(queryId), std::move(callback)), pipeline(std::move(pipeline)), pipelineId(std::move(pipelineId))
@@ -155,9 +212,8 @@ StartQueryTask::StartQueryTask(
 {
 }
 
-PendingPipelineStopTask::PendingPipelineStopTask(
-    QueryId queryId, std::shared_ptr<RunningQueryPlanNode> pipeline, size_t attempts, TaskCallback callback)
-    : BaseTask(std::move(queryId), std::move(callback)), attempts(attempts), pipeline(std::move(pipeline))
+PendingPipelineStopTask::PendingPipelineStopTask(QueryId queryId, std::shared_ptr<RunningQueryPlanNode> pipeline, TaskCallback callback)
+    : BaseTask(std::move(queryId), std::move(callback)), pipeline(std::move(pipeline))
 {
 }
 
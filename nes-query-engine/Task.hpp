@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <cstddef>
 #include <memory>
 #include <tuple>
@@ -42,6 +43,8 @@ class QueryCatalog;
 ///     but could be skipped for tasks that are deemed unsuccessful, even without an exception.
 /// The failure callback is invoked if the task fails with an exception.
 /// Callbacks are move only, thus every callback is invoked at most once.
+/// Most tasks do not register any callback, thus the callbacks are stored out of line and only allocated if a task registers one.
+/// This keeps the tasks small, as they are moved through the task queues for every buffer.
 class TaskCallback
 {
 public:
@@ -99,9 +102,17 @@ private:
     /// Process OnFailure tag and callback
     void processArgs(OnFailure onFailure);
 
-    onComplete onCompleteCallback;
-    onSuccess onSuccessCallback;
-    onFailure onFailureCallback;
+    struct Callbacks
+    {
+        onComplete onCompleteCallback;
+        onSuccess onSuccessCallback;
+        onFailure onFailureCallback;
+    };
+
+    /// Returns the callbacks, allocating them if this is the first registered callback
+    Callbacks& getOrCreateCallbacks();
+
+    std::unique_ptr<Callbacks> callbacks;
 };
 
 class BaseTask
@@ -124,14 +135,26 @@ private:
     /// No need for onSuccessCalled and onErrorCalled since TaskCallback handles this
 };
 
+/// A WorkTask accounts for one of the pending tasks of its pipeline, which the emitter of the task has to increment.
+/// Completing the task decrements the pending tasks of the pipeline and failing the task fails the pipeline. Both are part of the task
+/// instead of a callback, thus a WorkTask without a callback of its own does not allocate.
 struct WorkTask : BaseTask
 {
     WorkTask(QueryId queryId, PipelineId pipelineId, std::weak_ptr<RunningQueryPlanNode> pipeline, TupleBuffer buf, TaskCallback callback);
 
     WorkTask() = default;
+
+    void complete();
+
+    void fail(Exception exception);
+
     std::weak_ptr<RunningQueryPlanNode> pipeline;
     PipelineId pipelineId = INVALID<PipelineId>;
     TupleBuffer buf;
+    /// Time at which the task was emitted, which denotes the start of its queueing delay
+    std::chrono::steady_clock::time_point emitTime;
+    /// Non-zero if `buf` is compressed, in which case the WorkerThread decompresses it to this size, c.f., BufferCompression
+    size_t uncompressedSize = 0;
 };
 
 struct StartPipelineTask : BaseTask
@@ -184,11 +207,12 @@ struct StartQueryTask : BaseTask
     std::weak_ptr<QueryCatalog> catalog;
 };
 
+/// Keeps the pipeline alive until its pending tasks completed. If tasks are pending, the task is deferred at the pipeline and completed by
+/// the last pending task, c.f., RunningQueryPlanNode::deferPendingStop.
 struct PendingPipelineStopTask : BaseTask
 {
-    PendingPipelineStopTask(QueryId queryId, std::shared_ptr<RunningQueryPlanNode> pipeline, size_t attempts, TaskCallback callback);
+    PendingPipelineStopTask(QueryId queryId, std::shared_ptr<RunningQueryPlanNode> pipeline, TaskCallback callback);
 
-    size_t attempts;
     std::shared_ptr<RunningQueryPlanNode> pipeline;
 };
 
@@ -14,14 +14,26 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <mutex>
+#include <new>
+#include <numeric>
 #include <optional>
 #include <semaphore>
 #include <stop_token>
 #include <utility>
+#include <vector>
 #include <folly/MPMCQueue.h>
 #include <folly/concurrency/UnboundedQueue.h>
+#include <ErrorHandling.hpp>
 
 namespace NES
 {
@@ -31,72 +43,361 @@ namespace NES
 /// internal queue, which is unbounded to deal with occasionally bursty loads like a large join. Access to the internal task queue is always
 /// non-blocking. The TaskQueue exposes a blocking `getNextTaskBlocking` method which reads from either queue without spinning and is
 /// supposed to be used by the worker threads.
+///
+/// Optionally, the TaskQueue can be created with one local queue per WorkerThread (work stealing mode). A WorkerThread pushes tasks it
+/// emits itself into its own local queue and pops them in LIFO order, which keeps the emitted buffer hot in the cache of the emitting
+/// core. Idle WorkerThreads steal in FIFO order from their peers before they fall back to the admission queue. The admission queue
+/// remains the only bounded queue and thus the backpressure point for sources.
+///
+/// Optionally, the TaskQueue can be created with multiple weighted priority classes. Every priority class has its own queues, including
+/// its own admission queue, thus a backpressured class does not block the writers of the other classes. Readers select the priority class
+/// by a weighted round robin, i.e., a deficit round robin in which every task costs one unit, and serve a class with a weight of w up to w
+/// times per round. Empty classes are skipped, thus a reader never idles while any class has tasks.
+///
+/// Writers can tag tasks with a deadline, e.g., the window triggers of an aggregation or join. Within their priority class, tagged tasks
+/// are read before all untagged tasks, earliest deadline first. Deadlines are only compared with each other, thus any monotonic notion of
+/// time works.
 template <typename TaskType>
 class TaskQueue
 {
-    folly::UMPMCQueue<TaskType, true> internal;
-    folly::MPMCQueue<TaskType> admission;
+    /// Local queues are only accessed by their owner and by occasional thieves, thus a small lock per queue is sufficient. The alignment
+    /// prevents false sharing between the locks of neighbouring WorkerThreads.
+    struct alignas(std::hardware_destructive_interference_size) LocalQueue
+    {
+        std::mutex mutex;
+        /// One deque per priority class
+        std::vector<std::deque<TaskType>> tasks;
+    };
+
+    struct DeadlineTask
+    {
+        uint64_t deadline;
+        TaskType task;
+    };
+
+    /// Comparator for the heap of deadline tasks - earlier deadlines have higher priority
+    struct DeadlineComparator
+    {
+        bool operator()(const DeadlineTask& left, const DeadlineTask& right) const { return left.deadline > right.deadline; }
+    };
+
+    struct PriorityClass
+    {
+        folly::UMPMCQueue<TaskType, true> internal;
+        folly::MPMCQueue<TaskType> admission;
+        /// Tagged tasks are rare compared to the untagged tasks, thus a heap behind a lock is sufficient. The counter lets readers skip
+        /// the lock if there is no tagged task.
+        std::mutex deadlineMutex;
+        std::vector<DeadlineTask> deadlineTasks;
+        std::atomic<size_t> numberOfDeadlineTasks{0};
+        /// Upper bound of the tasks of this class across all of its queues, which lets readers skip empty classes. Writers increment it
+        /// before they write a task and readers decrement it after they read a task. Solely maintained if there are multiple classes.
+        std::atomic<size_t> numberOfTasks{0};
+    };
+
+    std::vector<PriorityClass> priorityClasses;
+    std::vector<LocalQueue> localQueues;
 
-    /// INVARIANT: internal.size() + admission.size() >= tasksAvailable
+    /// The order in which readers prefer the priority classes, in which every class appears as often as its weight
+    std::vector<size_t> schedule;
+    std::atomic<size_t> nextScheduleSlot{0};
+    /// The order in which readers fall back to other classes if the preferred class is empty, i.e., by descending weight
+    std::vector<size_t> fallbackOrder;
+
+    /// INVARIANT: sum(internal.size() + admission.size() + deadlineTasks.size()) + sum(localQueues.size()) >= tasksAvailable
     std::counting_semaphore<> tasksAvailable{0};
 
+    /// Number of admission writes which found the admission queue of their class full, i.e., had to wait for the readers
+    std::atomic<size_t> numberOfBlockedAdmissions{0};
+
     /// To provide cancellation, we only block for StopTokenCheckInterval.
     /// This parameter could be tuned to allow for more timely cancellation
     static constexpr std::chrono::milliseconds StopTokenCheckInterval{100};
 
-    TaskType readElementAssumingItExists()
+    [[nodiscard]] bool hasMultiplePriorityClasses() const { return priorityClasses.size() > 1; }
+
+    void notifyWrite(size_t priority)
     {
-        TaskType task;
-        /// The semaphore guarantees that there is at least one element in either one of the queues.
-        if (internal.try_dequeue(task))
+        if (hasMultiplePriorityClasses())
+        {
+            priorityClasses[priority].numberOfTasks.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    bool tryPopDeadline(size_t priority, TaskType& task)
+    {
+        auto& priorityClass = priorityClasses[priority];
+        if (priorityClass.numberOfDeadlineTasks.load(std::memory_order_relaxed) == 0)
+        {
+            return false;
+        }
+        const std::scoped_lock lock(priorityClass.deadlineMutex);
+        if (priorityClass.deadlineTasks.empty())
+        {
+            return false;
+        }
+        std::ranges::pop_heap(priorityClass.deadlineTasks, DeadlineComparator{});
+        task = std::move(priorityClass.deadlineTasks.back().task);
+        priorityClass.deadlineTasks.pop_back();
+        priorityClass.numberOfDeadlineTasks.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    /// Owner side of the local queue: LIFO
+    bool tryPopLocal(size_t workerIndex, size_t priority, TaskType& task)
+    {
+        if (workerIndex >= localQueues.size())
+        {
+            return false;
+        }
+        auto& local = localQueues[workerIndex];
+        const std::scoped_lock lock(local.mutex);
+        auto& tasks = local.tasks[priority];
+        if (tasks.empty())
+        {
+            return false;
+        }
+        task = std::move(tasks.back());
+        tasks.pop_back();
+        return true;
+    }
+
+    /// Thief side of the local queues: FIFO. Thieves start with their right neighbour to spread steals across the pool and skip queues
+    /// which are currently locked, as the caller retries anyway.
+    bool trySteal(size_t workerIndex, size_t priority, TaskType& task)
+    {
+        const auto numberOfLocalQueues = localQueues.size();
+        for (size_t offset = 1; offset <= numberOfLocalQueues; ++offset)
         {
-            return task;
+            const auto victimIndex = workerIndex >= numberOfLocalQueues ? offset - 1 : (workerIndex + offset) % numberOfLocalQueues;
+            auto& victim = localQueues[victimIndex];
+            const std::unique_lock lock(victim.mutex, std::try_to_lock);
+            if (!lock.owns_lock() || victim.tasks[priority].empty())
+            {
+                continue;
+            }
+            task = std::move(victim.tasks[priority].front());
+            victim.tasks[priority].pop_front();
+            return true;
         }
+        return false;
+    }
 
-        /// However, the MPMC `read` can spuriously fail under high contention, the alternative `readIfNotEmpty` does not but is
-        /// significantly slower.
-        while (!admission.read(task)) [[unlikely]]
+    bool tryRead(size_t workerIndex, size_t priority, TaskType& task)
+    {
+        auto& priorityClass = priorityClasses[priority];
+        if (hasMultiplePriorityClasses() && priorityClass.numberOfTasks.load(std::memory_order_relaxed) == 0)
         {
+            return false;
         }
+        /// The MPMC `read` can spuriously fail under high contention, the alternative `readIfNotEmpty` does not but is significantly
+        /// slower. The caller retries anyway.
+        if (tryPopDeadline(priority, task) || tryPopLocal(workerIndex, priority, task) || priorityClass.internal.try_dequeue(task)
+            || trySteal(workerIndex, priority, task) || priorityClass.admission.read(task))
+        {
+            if (hasMultiplePriorityClasses())
+            {
+                priorityClass.numberOfTasks.fetch_sub(1, std::memory_order_relaxed);
+            }
+            return true;
+        }
+        return false;
+    }
+
+    TaskType readElementAssumingItExists(size_t workerIndex)
+    {
+        const auto preferred
+            = hasMultiplePriorityClasses() ? schedule[nextScheduleSlot.fetch_add(1, std::memory_order_relaxed) % schedule.size()] : 0;
 
-        return task;
+        /// The semaphore guarantees that there is at least one element in one of the queues, but a concurrent reader might take the
+        /// element we acquired the permit for from a different queue. Thus, we have to retry until one of the queues yields a task.
+        TaskType task;
+        while (true)
+        {
+            if (tryRead(workerIndex, preferred, task))
+            {
+                return task;
+            }
+            for (const auto priority : fallbackOrder)
+            {
+                if (priority != preferred && tryRead(workerIndex, priority, task))
+                {
+                    return task;
+                }
+            }
+        }
     }
 
 public:
-    explicit TaskQueue(size_t admissionTaskQueueSize) : admission(admissionTaskQueueSize) { }
+    /// Used by readers and writers which do not own a local queue, e.g. in shared mode or for non-worker threads.
+    static constexpr size_t NoLocalQueue = std::numeric_limits<size_t>::max();
+
+    explicit TaskQueue(size_t admissionTaskQueueSize) : TaskQueue(admissionTaskQueueSize, 0) { }
+
+    /// Creates the TaskQueue in work stealing mode with one local queue per WorkerThread. Passing zero local queues is equivalent to the
+    /// shared mode. Every entry of `priorityWeights` creates a priority class with the given weight, which writers address by its index.
+    TaskQueue(size_t admissionTaskQueueSize, size_t numberOfLocalQueues, const std::vector<size_t>& priorityWeights = {1})
+        : priorityClasses(priorityWeights.size()), localQueues(numberOfLocalQueues)
+    {
+        PRECONDITION(!priorityWeights.empty(), "The TaskQueue requires at least one priority class");
+        PRECONDITION(std::ranges::none_of(priorityWeights, [](auto weight) { return weight == 0; }), "Priority weights must be positive");
+        for (auto& priorityClass : priorityClasses)
+        {
+            priorityClass.admission = folly::MPMCQueue<TaskType>(admissionTaskQueueSize);
+        }
+        for (auto& local : localQueues)
+        {
+            local.tasks.resize(priorityWeights.size());
+        }
+
+        /// Smooth weighted round robin: the classes are interleaved instead of being served in bursts of their weight
+        const auto totalWeight = std::accumulate(priorityWeights.begin(), priorityWeights.end(), size_t{0});
+        std::vector<ptrdiff_t> credits(priorityWeights.size(), 0);
+        for (size_t slot = 0; slot < totalWeight; ++slot)
+        {
+            for (size_t priority = 0; priority < priorityWeights.size(); ++priority)
+            {
+                credits[priority] += static_cast<ptrdiff_t>(priorityWeights[priority]);
+            }
+            const auto selected = static_cast<size_t>(std::distance(credits.begin(), std::ranges::max_element(credits)));
+            credits[selected] -= static_cast<ptrdiff_t>(totalWeight);
+            schedule.push_back(selected);
+        }
+
+        fallbackOrder.resize(priorityWeights.size());
+        std::iota(fallbackOrder.begin(), fallbackOrder.end(), 0);
+        std::ranges::stable_sort(fallbackOrder, std::greater{}, [&](const auto priority) { return priorityWeights[priority]; });
+    }
+
+    [[nodiscard]] bool isWorkStealing() const { return !localQueues.empty(); }
+
+    /// Approximate number of tasks which wait in the shared queues of all priority classes. The local queues are excluded, as their owners
+    /// are busy anyway while they have tasks.
+    [[nodiscard]] size_t getApproximateNumberOfTasks() const
+    {
+        size_t numberOfTasks = 0;
+        for (const auto& priorityClass : priorityClasses)
+        {
+            numberOfTasks += static_cast<size_t>(std::max<ptrdiff_t>(0, priorityClass.admission.sizeGuess()));
+            numberOfTasks += priorityClass.internal.size();
+            numberOfTasks += priorityClass.numberOfDeadlineTasks.load(std::memory_order_relaxed);
+        }
+        return numberOfTasks;
+    }
+
+    struct QueueDepth
+    {
+        size_t admission = 0;
+        size_t internal = 0;
+        size_t deadline = 0;
+    };
+
+    [[nodiscard]] size_t getNumberOfPriorityClasses() const { return priorityClasses.size(); }
+
+    /// Approximate number of tasks which wait in the shared queues of the priority class, c.f., getApproximateNumberOfTasks
+    [[nodiscard]] QueueDepth getQueueDepth(size_t priority) const
+    {
+        const auto& priorityClass = priorityClasses[priority];
+        return {
+            .admission = static_cast<size_t>(std::max<ptrdiff_t>(0, priorityClass.admission.sizeGuess())),
+            .internal = static_cast<size_t>(priorityClass.internal.size()),
+            .deadline = priorityClass.numberOfDeadlineTasks.load(std::memory_order_relaxed)};
+    }
+
+    /// Approximate fraction of the admission queue of the priority class which is in use, between 0 and 1
+    [[nodiscard]] double getAdmissionOccupancy(size_t priority) const
+    {
+        const auto& admission = priorityClasses[priority].admission;
+        const auto numberOfTasks = std::clamp<ptrdiff_t>(admission.sizeGuess(), 0, static_cast<ptrdiff_t>(admission.capacity()));
+        return static_cast<double>(numberOfTasks) / static_cast<double>(std::max<size_t>(1, admission.capacity()));
+    }
+
+    /// Monotonic counter of the admission writes which had to wait, because the admission queue of their class was full
+    [[nodiscard]] size_t getNumberOfBlockedAdmissions() const { return numberOfBlockedAdmissions.load(std::memory_order_relaxed); }
 
     /// By design the admission queue is bounded, which could lead to writes being blocked.
     /// The stop token allows cancellation. In case the writing was canceled, this method returns false.
     template <typename T = TaskType>
-    bool addAdmissionTaskBlocking(const std::stop_token& stoken, T&& task)
+    bool addAdmissionTaskBlocking(const std::stop_token& stoken, T&& task, size_t priority = 0)
     {
+        auto& admission = priorityClasses[priority].admission;
+        if (admission.isFull())
+        {
+            numberOfBlockedAdmissions.fetch_add(1, std::memory_order_relaxed);
+        }
         while (!stoken.stop_requested())
         {
             /// The order of operation upholds the invariant
+            notifyWrite(priority);
             if (admission.tryWriteUntil(std::chrono::steady_clock::now() + StopTokenCheckInterval, std::forward<T>(task)))
             {
                 /// tasksAvailable is only increased if write to admission queue was successful.
                 tasksAvailable.release();
                 return true;
             }
+            if (hasMultiplePriorityClasses())
+            {
+                priorityClasses[priority].numberOfTasks.fetch_sub(1, std::memory_order_relaxed);
+            }
         }
         return false;
     }
 
     /// Write a Task to the internal task queue. The internal task queue is unbounded thus this operation will always succeed
     template <typename T = TaskType>
-    void addInternalTaskNonBlocking(T&& task)
+    void addInternalTaskNonBlocking(T&& task, size_t priority = 0)
     {
         /// The order of operation upholds the invariant. internal is unbounded which makes this write always succeed (unless oom)
-        internal.enqueue(std::forward<T>(task));
+        notifyWrite(priority);
+        priorityClasses[priority].internal.enqueue(std::forward<T>(task));
+        tasksAvailable.release();
+    }
+
+    /// Write a Task that is due at `deadline` to its priority class. Tagged tasks are unbounded, thus this operation will always succeed.
+    template <typename T = TaskType>
+    void addDeadlineTaskNonBlocking(T&& task, uint64_t deadline, size_t priority = 0)
+    {
+        notifyWrite(priority);
+        {
+            auto& priorityClass = priorityClasses[priority];
+            const std::scoped_lock lock(priorityClass.deadlineMutex);
+            priorityClass.deadlineTasks.emplace_back(DeadlineTask{deadline, std::forward<T>(task)});
+            std::ranges::push_heap(priorityClass.deadlineTasks, DeadlineComparator{});
+            priorityClass.numberOfDeadlineTasks.fetch_add(1, std::memory_order_relaxed);
+        }
+        tasksAvailable.release();
+    }
+
+    /// Write a Task to the local queue of the WorkerThread with index `workerIndex`. Local queues are unbounded, thus this operation
+    /// will always succeed. If the TaskQueue is not in work stealing mode or the caller does not own a local queue, the task is written
+    /// to the internal task queue.
+    template <typename T = TaskType>
+    void addLocalTaskNonBlocking(size_t workerIndex, T&& task, size_t priority = 0)
+    {
+        if (workerIndex >= localQueues.size())
+        {
+            addInternalTaskNonBlocking(std::forward<T>(task), priority);
+            return;
+        }
+
+        notifyWrite(priority);
+        {
+            auto& local = localQueues[workerIndex];
+            const std::scoped_lock lock(local.mutex);
+            local.tasks[priority].emplace_back(std::forward<T>(task));
+        }
+        /// The permit is released after the write to uphold the invariant. Idle WorkerThreads wake up and steal the task if the owner
+        /// is busy.
         tasksAvailable.release();
     }
 
     /// Blocking read to retrieve the next task from the internal queue, or the admission queue if the internal task queue is empty.
+    /// In work stealing mode the caller's local queue is read first, followed by the internal queue, the local queues of other
+    /// WorkerThreads and finally the admission queue.
     /// This operation can be canceled using a stop token. In case of a cancellation, this method returns an empty optional.
     /// The method prioritizes reading over cancellation. This implies, if a read is non-blocking, it succeeds regardless of the state of
     /// the stop token.
-    std::optional<TaskType> getNextTaskBlocking(const std::stop_token& stoken)
+    std::optional<TaskType> getNextTaskBlocking(const std::stop_token& stoken, size_t workerIndex = NoLocalQueue)
     {
         while (!tasksAvailable.try_acquire_for(StopTokenCheckInterval))
         {
@@ -106,18 +407,34 @@ public:
             }
         }
 
-        return readElementAssumingItExists();
+        return readElementAssumingItExists(workerIndex);
+    }
+
+    /// Version of `getNextTaskBlocking` which additionally returns an empty optional, if no task arrived within `timeout`.
+    std::optional<TaskType>
+    getNextTaskBlocking(const std::stop_token& stoken, const std::chrono::milliseconds timeout, size_t workerIndex = NoLocalQueue)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        while (!tasksAvailable.try_acquire_until(std::min(std::chrono::steady_clock::now() + StopTokenCheckInterval, deadline)))
+        {
+            if (stoken.stop_requested() || std::chrono::steady_clock::now() >= deadline)
+            {
+                return std::nullopt;
+            }
+        }
+
+        return readElementAssumingItExists(workerIndex);
     }
 
     /// Non-Blocking version of `getNextTaskBlocking` if the queue is empty, this method returns an empty optional.
-    std::optional<TaskType> getNextTaskNonBlocking()
+    std::optional<TaskType> getNextTaskNonBlocking(size_t workerIndex = NoLocalQueue)
     {
         if (!tasksAvailable.try_acquire())
         {
             return std::nullopt;
         }
 
-        return readElementAssumingItExists();
+        return readElementAssumingItExists(workerIndex);
     }
 };
 }
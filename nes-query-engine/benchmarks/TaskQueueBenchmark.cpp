@@ -0,0 +1,122 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <Identifiers/Identifiers.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <benchmark/benchmark.h>
+#include <Task.hpp>
+#include <TaskQueue.hpp>
+
+/// This Benchmark measures the throughput of WorkTasks through the TaskQueue, which every buffer of a query passes at least once.
+/// Every thread writes a task to the queue and reads the next task from it, thus with multiple threads the tasks are exchanged between
+/// threads. The first argument selects whether the tasks register a callback, which allocates the callbacks out of line.
+/// BM_ProducersAndConsumers splits the threads into sources, which write to the admission queue, and WorkerThreads, which read from it.
+
+namespace
+{
+constexpr size_t AdmissionQueueSize = 1000;
+std::unique_ptr<NES::TaskQueue<NES::Task>> taskQueue;
+
+void setUp(const benchmark::State& state)
+{
+    if (state.thread_index() == 0)
+    {
+        taskQueue = std::make_unique<NES::TaskQueue<NES::Task>>(AdmissionQueueSize);
+    }
+}
+
+void tearDown(const benchmark::State& state)
+{
+    if (state.thread_index() == 0)
+    {
+        taskQueue.reset();
+    }
+}
+
+NES::WorkTask createTask(const bool withCallback)
+{
+    auto callback = withCallback ? NES::TaskCallback{NES::TaskCallback::OnComplete([] { })} : NES::TaskCallback{};
+    return {NES::QueryId(1), NES::PipelineId(1), std::weak_ptr<NES::RunningQueryPlanNode>(), NES::TupleBuffer(), std::move(callback)};
+}
+}
+
+/// Writes a task to the unbounded internal queue and reads the next task
+static void BM_InternalQueueRoundTrip(benchmark::State& state)
+{
+    const bool withCallback = state.range(0) != 0;
+    for (auto _ : state)
+    {
+        taskQueue->addInternalTaskNonBlocking(createTask(withCallback));
+        auto task = taskQueue->getNextTaskNonBlocking();
+        benchmark::DoNotOptimize(task);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+/// Writes a task to the bounded admission queue, which sources write to, and reads the next task
+static void BM_AdmissionQueueRoundTrip(benchmark::State& state)
+{
+    const bool withCallback = state.range(0) != 0;
+    for (auto _ : state)
+    {
+        taskQueue->addAdmissionTaskBlocking({}, createTask(withCallback));
+        auto task = taskQueue->getNextTaskNonBlocking();
+        benchmark::DoNotOptimize(task);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+/// Every even thread writes tasks to the bounded admission queue, every odd thread reads them, thus half of the threads produce
+static void BM_ProducersAndConsumers(benchmark::State& state)
+{
+    const bool isProducer = state.thread_index() % 2 == 0;
+    for (auto _ : state)
+    {
+        if (isProducer)
+        {
+            taskQueue->addAdmissionTaskBlocking({}, createTask(false));
+        }
+        else
+        {
+            /// Every thread runs the same number of iterations, thus every task written by a producer is read by a consumer
+            auto task = taskQueue->getNextTaskBlocking({});
+            benchmark::DoNotOptimize(task);
+        }
+    }
+    /// Solely the consumers count the tasks, which passed the queue
+    if (not isProducer)
+    {
+        state.SetItemsProcessed(state.iterations());
+    }
+}
+
+static void BM_TaskSize(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(sizeof(NES::Task));
+    }
+    state.counters["sizeof(Task)"] = sizeof(NES::Task);
+    state.counters["sizeof(WorkTask)"] = sizeof(NES::WorkTask);
+}
+
+BENCHMARK(BM_InternalQueueRoundTrip)->Setup(setUp)->Teardown(tearDown)->Arg(0)->Arg(1)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_AdmissionQueueRoundTrip)->Setup(setUp)->Teardown(tearDown)->Arg(0)->Arg(1)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_ProducersAndConsumers)->Setup(setUp)->Teardown(tearDown)->Threads(2)->Threads(4)->Threads(8)->Threads(16)->UseRealTime();
+BENCHMARK(BM_TaskSize)->Iterations(1);
+
+BENCHMARK_MAIN();
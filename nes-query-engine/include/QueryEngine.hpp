@@ -13,10 +13,17 @@
 */
 
 #pragma once
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <optional>
+#include <vector>
 #include <Identifiers/Identifiers.hpp>
 #include <Listeners/AbstractQueryStatusListener.hpp>
 #include <Runtime/BufferManager.hpp>
+#include <Runtime/MemoryAccount.hpp>
+#include <ExecutablePipelineStage.hpp>
 #include <ExecutableQueryPlan.hpp>
 #include <QueryEngineConfiguration.hpp>
 #include <QueryEngineStatisticListener.hpp>
@@ -27,6 +34,86 @@ namespace NES
 class QueryCatalog;
 class ThreadPool;
 
+/// Counters of a pipeline, which accumulate since the pipeline started, c.f., QueryEngineConfiguration::pipelineStatisticsInterval
+struct PipelineMetrics
+{
+    PipelineId pipelineId = INVALID<PipelineId>;
+    uint64_t numberOfTasks = 0;
+    uint64_t numberOfInputTuples = 0;
+    uint64_t numberOfEmittedTuples = 0;
+    uint64_t numberOfEmittedBuffers = 0;
+    std::chrono::nanoseconds executionTime{0};
+    /// Time that the tasks of the pipeline waited in the task queue
+    std::chrono::nanoseconds queueingDelay{0};
+    /// Bucket i counts the tasks that executed for at least 2^(i-1) and less than 2^i microseconds, the last bucket all longer tasks
+    std::vector<uint64_t> latencyHistogram;
+    /// Bucket i counts the input buffers whose latest, respectively oldest data the sources ingested at least 2^(i-1) and less than 2^i
+    /// milliseconds before the pipeline processed them. For the pipelines of the sinks, this is the latency from the source to the sink.
+    std::vector<uint64_t> ingestionLatencyHistogram;
+    std::vector<uint64_t> oldestIngestionLatencyHistogram;
+    /// Pipelines that receive the emitted buffers of the pipeline
+    std::vector<PipelineId> successors;
+    /// Cycles of the operators from the root to the last child of the pipeline. Solely reported with `profile_operators`.
+    std::vector<ExecutablePipelineStage::OperatorCost> operatorCosts;
+    /// Memory of the operator state, e.g., the slices of a window, that the pipeline currently, respectively at most accessed
+    uint64_t stateSizeInBytes = 0;
+    uint64_t peakStateSizeInBytes = 0;
+    /// Current state by the WorkerThreadIds, modulo the number of worker threads, which own it. Empty, if no worker thread owns state.
+    std::vector<uint64_t> stateSizeInBytesPerWorkerThread;
+    /// Set while the tasks of the pipeline are distributed round robin, as its state is imbalanced, c.f., `state_rebalancing_threshold`
+    bool isRebalancing = false;
+    /// Buffers that the pipeline allocated and that are not yet recycled, independent of the pipeline which currently holds them
+    MemoryAccount::Usage bufferUsage;
+    MemoryAccount::Usage peakBufferUsage;
+};
+
+/// Momentary state of the QueryEngine, which is read without synchronizing the WorkerThreads and the sources
+struct EngineMetrics
+{
+    /// Approximate number of the tasks which wait in the shared queues of a priority class
+    struct QueueDepth
+    {
+        size_t admission = 0;
+        size_t internal = 0;
+        size_t deadline = 0;
+    };
+
+    /// Counters of a source, which accumulate since its query started
+    struct SourceMetrics
+    {
+        QueryId queryId = INVALID_QUERY_ID;
+        OriginId originId = INVALID_ORIGIN_ID;
+        uint64_t numberOfBuffers = 0;
+        uint64_t numberOfBytes = 0;
+        size_t numberOfInflightBuffers = 0;
+        size_t peakNumberOfInflightBuffers = 0;
+        /// Latest watermark that the successors of the source reported
+        uint64_t watermark = 0;
+    };
+
+    size_t numberOfWorkerThreads = 0;
+    /// WorkerThreads that currently handle a task
+    size_t numberOfBusyWorkerThreads = 0;
+    /// Monotonic counter of the admission writes which had to wait for a full admission queue
+    uint64_t numberOfBlockedAdmissions = 0;
+    /// Indexed by the priority class, i.e., in the order of QueryPriority
+    std::vector<QueueDepth> queueDepths;
+    std::vector<SourceMetrics> sources;
+    /// Summed up over the buffer managers of all NUMA nodes
+    size_t numberOfPooledBuffers = 0;
+    size_t numberOfAvailableBuffers = 0;
+    size_t numberOfUnpooledBuffers = 0;
+};
+
+/// Memory of the buffers that the pipelines of a query hold, c.f., QueryEngineConfiguration::queryMemoryQuota
+struct QueryMemoryMetrics
+{
+    uint64_t usedBytes = 0;
+    uint64_t peakBytes = 0;
+    /// Zero, if the memory of the query is solely tracked
+    uint64_t quotaInBytes = 0;
+};
+
 class QueryEngine
 {
 public:
@@ -35,10 +122,26 @@ public:
         std::shared_ptr<QueryEngineStatisticListener> statListener,
         std::shared_ptr<AbstractQueryStatusListener> listener,
         std::shared_ptr<BufferManager> bm);
+
+    /// Creates a NUMA-aware QueryEngine. WorkerThreads are distributed in contiguous blocks across the NUMA nodes and allocate their
+    /// buffers from the buffer manager of their node. `numaLocalBufferManagers[i]` has to be local to the i-th node returned by
+    /// `getNumaTopology()`. The first buffer manager serves all non-worker threads.
+    QueryEngine(
+        const QueryEngineConfiguration& configuration,
+        std::shared_ptr<QueryEngineStatisticListener> statListener,
+        std::shared_ptr<AbstractQueryStatusListener> listener,
+        std::vector<std::shared_ptr<BufferManager>> numaLocalBufferManagers);
     void stop(QueryId queryId);
     void start(std::unique_ptr<ExecutableQueryPlan> executableQueryPlan);
     ~QueryEngine();
 
+    /// Sums up the per-thread counters of the pipelines of the query. Empty if the pipeline statistics are disabled or the query is not
+    /// running.
+    [[nodiscard]] std::vector<PipelineMetrics> getPipelineMetrics(QueryId queryId) const;
+    [[nodiscard]] EngineMetrics getEngineMetrics() const;
+    /// Empty if the query never started or released all of its buffers after it terminated
+    [[nodiscard]] std::optional<QueryMemoryMetrics> getQueryMemory(QueryId queryId) const;
+
     /// Order of Member construction is top to bottom and order of destruction is reversed
     /// Starting the ThreadPool is the very **last** thing the query engine does and **stopping**
     /// the ThreadPool is the first thing that happens during destruction.
@@ -14,21 +14,56 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
 #include <Configurations/BaseConfiguration.hpp>
 #include <Configurations/BaseOption.hpp>
+#include <Configurations/Enums/EnumOption.hpp>
 #include <Configurations/ScalarOption.hpp>
 #include <Configurations/Validation/ConfigurationValidation.hpp>
+#include <Configurations/Validation/NumberValidation.hpp>
+#include <fmt/format.h>
 
 namespace NES
 {
+
+enum class TaskQueueMode : uint8_t
+{
+    /// All WorkerThreads share a single internal task queue.
+    SHARED,
+    /// Every WorkerThread owns a local LIFO queue for the tasks it emits. Idle WorkerThreads steal from their peers.
+    WORK_STEALING
+};
+
+enum class WorkerPinningPolicy : uint8_t
+{
+    /// WorkerThreads are scheduled freely by the operating system.
+    NONE,
+    /// Every WorkerThread is restricted to the CPUs of the NUMA node it was assigned to.
+    NUMA_NODE,
+    /// Every WorkerThread is pinned to a single CPU of the NUMA node it was assigned to.
+    CPU
+};
+
+enum class LoadSheddingPolicy : uint8_t
+{
+    /// Sources are backpressured, but never drop data.
+    NONE,
+    /// Under overload, sources drop incoming buffers with a probability that grows with the overload.
+    RANDOM,
+    /// Under overload, WorkerThreads drop the queued buffers of sources which waited the longest, thus fresh data is processed first.
+    OLDEST_FIRST
+};
+
 class QueryEngineConfiguration final : public BaseConfiguration
 {
     /// validators to prevent nonsensical values for the number of threads and task queue size
     static std::shared_ptr<ConfigurationValidation> numberOfThreadsValidator();
     static std::shared_ptr<ConfigurationValidation> queueSizeValidator();
+    static std::shared_ptr<ConfigurationValidation> priorityWeightValidator();
+    static std::shared_ptr<ConfigurationValidation> percentageValidator();
 
 public:
     QueryEngineConfiguration() = default;
@@ -37,10 +72,137 @@ public:
 
     UIntOption numberOfWorkerThreads
         = {"number_of_worker_threads", "2", "Number of worker threads used within the QueryEngine", {numberOfThreadsValidator()}};
+    UIntOption maxNumberOfWorkerThreads
+        = {"max_number_of_worker_threads",
+           "0",
+           "Upper bound of worker threads used within the QueryEngine. If it exceeds number_of_worker_threads, the QueryEngine starts "
+           "additional worker threads while tasks queue up or sources wait for admission. Zero disables elastic sizing",
+           {std::make_shared<NumberValidation>()}};
+    UIntOption workerThreadIdleTimeout
+        = {"worker_thread_idle_timeout",
+           "1000",
+           "Milliseconds after which an idle worker thread stops, as long as more than number_of_worker_threads threads are running",
+           {std::make_shared<NumberValidation>()}};
     UIntOption admissionQueueSize
         = {"admission_queue_size", "1000", "Size of the bounded admission queue used within the QueryEngine", {queueSizeValidator()}};
+    EnumOption<TaskQueueMode> taskQueueMode
+        = {"task_queue_mode",
+           TaskQueueMode::SHARED,
+           fmt::format("Organization of the internal task queue used within the QueryEngine: {}", enumPipeList<TaskQueueMode>())};
+    UIntOption maxInlineContinuationDepth
+        = {"max_inline_continuation_depth",
+           "0",
+           "Maximum number of successor pipelines a WorkerThread executes inline instead of dispatching them as a new task. Zero "
+           "disables inline continuation",
+           {std::make_shared<NumberValidation>()}};
+    EnumOption<WorkerPinningPolicy> workerPinning
+        = {"worker_pinning",
+           WorkerPinningPolicy::NONE,
+           fmt::format("Pinning of WorkerThreads to the CPUs of their NUMA node: {}", enumPipeList<WorkerPinningPolicy>())};
+    UIntOption numberOfCompilationThreads
+        = {"number_of_compilation_threads",
+           "0",
+           "Number of threads, separate from the worker threads, that start and thus compile the pipelines of queries concurrently. Zero "
+           "starts the pipelines on the worker threads",
+           {std::make_shared<NumberValidation>()}};
+    UIntOption maxWorkTaskBatchSize
+        = {"max_work_task_batch_size",
+           "1",
+           "Maximum number of queued tasks of the same pipeline that a WorkerThread executes back to back with the same pipeline "
+           "execution context, instead of dequeuing and setting up each task on its own. 0 and 1 disable batching",
+           {std::make_shared<NumberValidation>()}};
+    UIntOption maxWorkTaskBatchDuration
+        = {"max_work_task_batch_duration",
+           "1",
+           "Milliseconds after which a WorkerThread stops adding queued tasks to its current batch, such that a batch does not delay the "
+           "tasks of other pipelines",
+           {std::make_shared<NumberValidation>()}};
+    /// The WorkerThreads serve the priority classes of the queries in a weighted round robin, c.f., QueryPriority
+    UIntOption highPriorityWeight
+        = {"high_priority_weight",
+           "4",
+           "Share of the tasks that the WorkerThreads take from HIGH priority queries",
+           {priorityWeightValidator()}};
+    UIntOption normalPriorityWeight
+        = {"normal_priority_weight",
+           "2",
+           "Share of the tasks that the WorkerThreads take from NORMAL priority queries",
+           {priorityWeightValidator()}};
+    UIntOption lowPriorityWeight
+        = {"low_priority_weight",
+           "1",
+           "Share of the tasks that the WorkerThreads take from LOW priority queries",
+           {priorityWeightValidator()}};
+    /// The load shedder drops source buffers of queries once either threshold is crossed, c.f., LoadShedder
+    EnumOption<LoadSheddingPolicy> loadSheddingPolicy
+        = {"load_shedding_policy",
+           LoadSheddingPolicy::NONE,
+           fmt::format("Dropping of source buffers under sustained overload: {}", enumPipeList<LoadSheddingPolicy>())};
+    UIntOption loadSheddingAdmissionOccupancy
+        = {"load_shedding_admission_occupancy",
+           "90",
+           "Percentage of the admission queue of a query's priority class above which the load shedder drops source buffers. 100 "
+           "disables the occupancy threshold",
+           {percentageValidator()}};
+    UIntOption loadSheddingMaxLatency
+        = {"load_shedding_max_latency",
+           "0",
+           "Milliseconds a source buffer may wait in the task queue before the load shedder drops source buffers. Zero disables the "
+           "latency threshold",
+           {std::make_shared<NumberValidation>()}};
+    /// WorkerThreads count the tasks of every pipeline in counters of their own, which the QueryEngine aggregates off the critical path
+    UIntOption pipelineStatisticsInterval
+        = {"pipeline_statistics_interval",
+           "0",
+           "Milliseconds after which the QueryEngine reports the number of tasks, tuples, and the histogram of the execution times of each "
+           "pipeline, which the worker threads count without synchronizing each other. Zero disables the pipeline statistics",
+           {std::make_shared<NumberValidation>()}};
+    /// The QueryEngine evaluates the balance of the state of the pipelines at the pipeline statistics interval, c.f., PipelineStatistics
+    UIntOption stateRebalancingThreshold
+        = {"state_rebalancing_threshold",
+           "0",
+           "Percentage by which the largest state that a worker thread builds for a pipeline, e.g., its hash maps of a window, may exceed "
+           "the mean state of all worker threads, before the worker threads distribute the tasks of the pipeline round robin across all "
+           "worker threads instead of executing them themselves. Requires the pipeline statistics. Zero disables the rebalancing",
+           {std::make_shared<NumberValidation>()}};
+    UIntOption taskEventSamplingRate
+        = {"task_event_sampling_rate",
+           "1",
+           "The worker threads report the execution and emits of every n-th task as events to the statistic listeners, e.g., the event "
+           "trace. Zero disables the events of tasks",
+           {std::make_shared<NumberValidation>()}};
+    /// The pipelines of a query charge their buffers to a memory account of the query, c.f., AccountedBufferProvider
+    UIntOption queryMemoryQuota
+        = {"query_memory_quota",
+           "0",
+           "Bytes of pooled, unpooled, and state buffers that the pipelines of a single query may hold. A query that allocates beyond its "
+           "quota fails. Zero solely tracks the memory of the queries",
+           {std::make_shared<NumberValidation>()}};
 
 protected:
-    std::vector<BaseOption*> getOptions() override { return {&numberOfWorkerThreads, &admissionQueueSize}; }
+    std::vector<BaseOption*> getOptions() override
+    {
+        return {
+            &numberOfWorkerThreads,
+            &maxNumberOfWorkerThreads,
+            &workerThreadIdleTimeout,
+            &admissionQueueSize,
+            &taskQueueMode,
+            &maxInlineContinuationDepth,
+            &workerPinning,
+            &numberOfCompilationThreads,
+            &maxWorkTaskBatchSize,
+            &maxWorkTaskBatchDuration,
+            &highPriorityWeight,
+            &normalPriorityWeight,
+            &lowPriorityWeight,
+            &loadSheddingPolicy,
+            &loadSheddingAdmissionOccupancy,
+            &loadSheddingMaxLatency,
+            &pipelineStatisticsInterval,
+            &stateRebalancingThreshold,
+            &taskEventSamplingRate,
+            &queryMemoryQuota};
+    }
 };
 }
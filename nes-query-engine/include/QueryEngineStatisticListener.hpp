@@ -15,7 +15,11 @@
 #pragma once
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
 #include <variant>
+#include <vector>
 #include <Identifiers/Identifiers.hpp>
 #include <Identifiers/NESStrongType.hpp>
 
@@ -37,8 +41,18 @@ struct EventBase
 
 struct TaskExecutionStart : EventBase
 {
-    TaskExecutionStart(WorkerThreadId threadId, QueryId queryId, PipelineId pipelineId, TaskId taskId, size_t numberOfTuples)
-        : EventBase(threadId, queryId), pipelineId(pipelineId), taskId(taskId), numberOfTuples(numberOfTuples)
+    TaskExecutionStart(
+        WorkerThreadId threadId,
+        QueryId queryId,
+        PipelineId pipelineId,
+        TaskId taskId,
+        size_t numberOfTuples,
+        std::chrono::microseconds queueingDelay)
+        : EventBase(threadId, queryId)
+        , pipelineId(pipelineId)
+        , taskId(taskId)
+        , numberOfTuples(numberOfTuples)
+        , queueingDelay(queueingDelay)
     {
     }
 
@@ -47,6 +61,8 @@ struct TaskExecutionStart : EventBase
     PipelineId pipelineId = INVALID<PipelineId>;
     TaskId taskId = INVALID<TaskId>;
     size_t numberOfTuples;
+    /// Time the task waited in the TaskQueue, which reflects how well the priority class of the query isolates it from other queries
+    std::chrono::microseconds queueingDelay{0};
 };
 
 struct TaskEmit : EventBase
@@ -89,6 +105,52 @@ struct TaskExpired : EventBase
     TaskId taskId = INVALID<TaskId>;
 };
 
+/// A source buffer was dropped by the load shedder of the query, c.f., LoadSheddingPolicy. Results of the query lack its tuples.
+struct SourceBufferShed : EventBase
+{
+    SourceBufferShed(WorkerThreadId threadId, QueryId queryId, OriginId originId, uint64_t numberOfShedBuffers)
+        : EventBase(threadId, queryId), originId(originId), numberOfShedBuffers(numberOfShedBuffers)
+    {
+    }
+
+    SourceBufferShed() = default;
+
+    OriginId originId = INVALID<OriginId>;
+    /// Number of buffers the query dropped since it started
+    uint64_t numberOfShedBuffers = 0;
+};
+
+/// Periodic sample of the counters of a pipeline, c.f., QueryEngineConfiguration::pipelineStatisticsInterval. The counters accumulate
+/// since the pipeline started. Reported by the QueryEngine instead of a WorkerThread.
+struct PipelineStatisticsSample : EventBase
+{
+    PipelineStatisticsSample(
+        QueryId queryId,
+        PipelineId pipelineId,
+        uint64_t numberOfTasks,
+        uint64_t numberOfTuples,
+        std::chrono::nanoseconds executionTime,
+        std::vector<uint64_t> latencyHistogram)
+        : EventBase(INVALID<WorkerThreadId>, queryId)
+        , pipelineId(pipelineId)
+        , numberOfTasks(numberOfTasks)
+        , numberOfTuples(numberOfTuples)
+        , executionTime(executionTime)
+        , latencyHistogram(std::move(latencyHistogram))
+    {
+    }
+
+    PipelineStatisticsSample() = default;
+
+    PipelineId pipelineId = INVALID<PipelineId>;
+    uint64_t numberOfTasks = 0;
+    uint64_t numberOfTuples = 0;
+    std::chrono::nanoseconds executionTime{0};
+    /// Bucket i counts the tasks that executed for at least 2^(i-1) and less than 2^i microseconds, the last bucket all longer tasks.
+    /// A vector instead of an array keeps the size of all events small, as every event is passed by value.
+    std::vector<uint64_t> latencyHistogram;
+};
+
 struct QueryStart : EventBase
 {
     QueryStart(WorkerThreadId threadId, QueryId queryId) : EventBase(threadId, queryId) { }
@@ -119,12 +181,14 @@ struct QueryFail : EventBase
 
 struct PipelineStart : EventBase
 {
-    PipelineStart(WorkerThreadId threadId, QueryId queryId, PipelineId pipelineId)
-        : EventBase(threadId, queryId), pipelineId(pipelineId) { }
+    PipelineStart(WorkerThreadId threadId, QueryId queryId, PipelineId pipelineId, std::chrono::microseconds startDuration)
+        : EventBase(threadId, queryId), pipelineId(pipelineId), startDuration(startDuration) { }
 
     PipelineStart() = default;
 
     PipelineId pipelineId = INVALID<PipelineId>;
+    /// Time the stage took to start, which includes compiling the pipeline
+    std::chrono::microseconds startDuration{0};
 };
 
 struct PipelineStop : EventBase
@@ -138,17 +202,73 @@ struct PipelineStop : EventBase
     PipelineId pipelineId = INVALID<PipelineId>;
 };
 
+/// Counters of a physical function (see FunctionStatistics), which count since the start of the process.
+/// The query engine reports all counters whenever a query stops.
+struct FunctionStatistic : EventBase
+{
+    FunctionStatistic(
+        WorkerThreadId threadId, QueryId queryId, std::string functionName, uint64_t calls, uint64_t invalidInputs, uint64_t errors)
+        : EventBase(threadId, queryId)
+        , functionName(std::move(functionName))
+        , calls(calls)
+        , invalidInputs(invalidInputs)
+        , errors(errors)
+    {
+    }
+
+    FunctionStatistic() = default;
+
+    std::string functionName;
+    uint64_t calls = 0;
+    uint64_t invalidInputs = 0;
+    uint64_t errors = 0;
+};
+
+/// Counters of the Bloom filters of an operator (see BloomFilterStatistics), which count since the start of the process.
+/// The hit rate hits / probes is the fraction of hash map lookups that the filters did not skip.
+struct BloomFilterStatistic : EventBase
+{
+    BloomFilterStatistic(
+        WorkerThreadId threadId,
+        QueryId queryId,
+        std::string operatorName,
+        uint64_t filters,
+        uint64_t filterSizeInBytes,
+        uint64_t probes,
+        uint64_t hits)
+        : EventBase(threadId, queryId)
+        , operatorName(std::move(operatorName))
+        , filters(filters)
+        , filterSizeInBytes(filterSizeInBytes)
+        , probes(probes)
+        , hits(hits)
+    {
+    }
+
+    BloomFilterStatistic() = default;
+
+    std::string operatorName;
+    uint64_t filters = 0;
+    uint64_t filterSizeInBytes = 0;
+    uint64_t probes = 0;
+    uint64_t hits = 0;
+};
+
 using Event = std::variant<
     TaskExecutionStart,
     TaskEmit,
     TaskExecutionComplete,
     TaskExpired,
+    SourceBufferShed,
+    PipelineStatisticsSample,
     PipelineStart,
     PipelineStop,
     QueryStart,
     QueryStopRequest,
     QueryStop,
-    QueryFail>;
+    QueryFail,
+    FunctionStatistic,
+    BloomFilterStatistic>;
 
 struct QueryEngineStatisticListener
 {
@@ -0,0 +1,101 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <BufferCompression.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <Identifiers/Identifiers.hpp>
+#include <MemoryLayout/VariableSizedAccess.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Time/Timestamp.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+
+namespace NES::Testing
+{
+
+class BufferCompressionTest : public BaseUnitTest
+{
+public:
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("BufferCompressionTest.log", NES::LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup BufferCompressionTest test class.");
+    }
+
+    void SetUp() override
+    {
+        BaseUnitTest::SetUp();
+        if (not BufferCompression::isAvailable())
+        {
+            GTEST_SKIP() << "The QueryEngine was built without NES_ENABLE_BUFFER_COMPRESSION";
+        }
+    }
+
+    std::shared_ptr<BufferManager> bufferManager = BufferManager::create(4096, 8);
+};
+
+TEST_F(BufferCompressionTest, RestoresThePayloadMetadataAndChildren)
+{
+    auto buffer = bufferManager->getBufferBlocking();
+    /// A sparse buffer of small values, whose unused tail is zeroed, like the buffers of a window trigger
+    auto values = buffer.getAvailableMemoryArea<uint64_t>();
+    std::ranges::fill(values, 0);
+    for (size_t index = 0; index < 64; ++index)
+    {
+        values[index] = index % 7;
+    }
+    buffer.setNumberOfTuples(64);
+    buffer.setOriginId(OriginId(3));
+    buffer.setSequenceNumber(SequenceNumber(42));
+    buffer.setChunkNumber(ChunkNumber(2));
+    buffer.setLastChunk(false);
+    buffer.setWatermark(Timestamp(1000));
+    auto child = bufferManager->getBufferBlocking();
+    child.getAvailableMemoryArea<uint64_t>()[0] = 7;
+    const auto childIndex = buffer.storeChildBuffer(child);
+
+    const auto compressed = BufferCompression::compress(buffer, *bufferManager);
+    ASSERT_TRUE(compressed.has_value());
+    EXPECT_LE(compressed->getBufferSize(), buffer.getBufferSize() / 2);
+
+    const auto decompressed = BufferCompression::decompress(*compressed, buffer.getBufferSize(), *bufferManager);
+    EXPECT_TRUE(std::ranges::equal(decompressed.getAvailableMemoryArea<uint64_t>(), buffer.getAvailableMemoryArea<uint64_t>()));
+    EXPECT_EQ(decompressed.getNumberOfTuples(), 64);
+    EXPECT_EQ(decompressed.getOriginId(), OriginId(3));
+    EXPECT_EQ(decompressed.getSequenceNumber(), SequenceNumber(42));
+    EXPECT_EQ(decompressed.getChunkNumber(), ChunkNumber(2));
+    EXPECT_FALSE(decompressed.isLastChunk());
+    EXPECT_EQ(decompressed.getWatermark(), Timestamp(1000));
+    ASSERT_EQ(decompressed.getNumberOfChildBuffers(), 1);
+    EXPECT_EQ(decompressed.loadChildBuffer(childIndex).getAvailableMemoryArea<uint64_t>()[0], 7);
+}
+
+TEST_F(BufferCompressionTest, KeepsIncompressibleBuffers)
+{
+    auto buffer = bufferManager->getBufferBlocking();
+    std::mt19937_64 random(42);
+    std::ranges::generate(buffer.getAvailableMemoryArea<uint64_t>(), random);
+    EXPECT_FALSE(BufferCompression::compress(buffer, *bufferManager).has_value());
+}
+
+}
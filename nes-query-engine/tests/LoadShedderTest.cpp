@@ -0,0 +1,124 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <LoadShedder.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+#include <QueryEngineConfiguration.hpp>
+
+namespace NES::Testing
+{
+
+class LoadShedderTest : public BaseUnitTest
+{
+public:
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("LoadShedderTest.log", NES::LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup LoadShedderTest test class.");
+    }
+
+    LoadShedder createShedder(const LoadSheddingPolicy policy)
+    {
+        return LoadShedder{
+            {.policy = policy, .admissionOccupancyThreshold = 0.5, .maxLatency = std::chrono::milliseconds(10)},
+            [this] { return occupancy; },
+            [this](OriginId, uint64_t numberOfShedBuffers) { reportedShedBuffers.push_back(numberOfShedBuffers); }};
+    }
+
+    /// Number of buffers that the shedder sheds out of `numberOfBuffers` buffers, which waited `queueingDelay`
+    static size_t shed(LoadShedder& shedder, const size_t numberOfBuffers, const std::chrono::microseconds queueingDelay)
+    {
+        size_t numberOfShedBuffers = 0;
+        for (size_t buffer = 0; buffer < numberOfBuffers; ++buffer)
+        {
+            numberOfShedBuffers += shedder.shouldShed(source, queueingDelay) ? 1 : 0;
+        }
+        return numberOfShedBuffers;
+    }
+
+    static constexpr OriginId source{1};
+    static constexpr std::chrono::microseconds fresh{0};
+    double occupancy = 0;
+    std::vector<uint64_t> reportedShedBuffers;
+};
+
+TEST_F(LoadShedderTest, NoSheddingWithoutOverload)
+{
+    for (const auto policy : {LoadSheddingPolicy::NONE, LoadSheddingPolicy::RANDOM, LoadSheddingPolicy::OLDEST_FIRST})
+    {
+        auto shedder = createShedder(policy);
+        occupancy = 0.5;
+        EXPECT_EQ(shed(shedder, 1000, std::chrono::milliseconds(10)), 0);
+        EXPECT_EQ(shedder.getNumberOfShedBuffers(), 0);
+    }
+
+    auto shedder = createShedder(LoadSheddingPolicy::NONE);
+    occupancy = 1;
+    EXPECT_EQ(shed(shedder, 1000, std::chrono::seconds(1)), 0);
+}
+
+TEST_F(LoadShedderTest, RandomShedsProportionallyToTheOverload)
+{
+    auto shedder = createShedder(LoadSheddingPolicy::RANDOM);
+
+    /// Halfway between the threshold and a full admission queue, half of the buffers are shed
+    occupancy = 0.75;
+    const auto shedAtOccupancy = shed(shedder, 10000, fresh);
+    EXPECT_GT(shedAtOccupancy, 4000);
+    EXPECT_LT(shedAtOccupancy, 6000);
+
+    occupancy = 1;
+    EXPECT_EQ(shed(shedder, 1000, fresh), 1000);
+
+    /// Buffers that waited four times the latency threshold shed three out of four buffers
+    occupancy = 0;
+    const auto shedAtLatency = shed(shedder, 10000, std::chrono::milliseconds(40));
+    EXPECT_GT(shedAtLatency, 6500);
+    EXPECT_LT(shedAtLatency, 8500);
+
+    EXPECT_EQ(shedder.getNumberOfShedBuffers(), shedAtOccupancy + 1000 + shedAtLatency);
+}
+
+TEST_F(LoadShedderTest, OldestFirstShedsStaleBuffers)
+{
+    auto shedder = createShedder(LoadSheddingPolicy::OLDEST_FIRST);
+    EXPECT_EQ(shed(shedder, 10, std::chrono::milliseconds(11)), 10);
+    EXPECT_EQ(shed(shedder, 10, std::chrono::milliseconds(9)), 0);
+
+    /// Above the occupancy threshold, the WorkerThreads shed every queued buffer until the admission queue drained
+    occupancy = 0.6;
+    EXPECT_EQ(shed(shedder, 10, fresh), 10);
+    occupancy = 0.4;
+    EXPECT_EQ(shed(shedder, 10, fresh), 0);
+}
+
+TEST_F(LoadShedderTest, ReportsTheShedBuffersOfTheQuery)
+{
+    auto shedder = createShedder(LoadSheddingPolicy::OLDEST_FIRST);
+    shed(shedder, 3, std::chrono::milliseconds(20));
+    EXPECT_EQ(reportedShedBuffers, (std::vector<uint64_t>{1, 2, 3}));
+    EXPECT_EQ(shedder.getNumberOfShedBuffers(), 3);
+}
+
+}
@@ -0,0 +1,221 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <PipelineStatistics.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <thread>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
+#include <Runtime/AccountedBufferProvider.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/MemoryAccount.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+#include <ExecutablePipelineStage.hpp>
+#include <PipelineExecutionContext.hpp>
+
+namespace NES::Testing
+{
+
+class PipelineStatisticsTest : public BaseUnitTest
+{
+public:
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("PipelineStatisticsTest.log", NES::LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup PipelineStatisticsTest test class.");
+    }
+
+    /// Reports fixed operator costs and the state that the test sets
+    class ReportingStage final : public ExecutablePipelineStage
+    {
+    public:
+        void start(PipelineExecutionContext&) override { }
+        void execute(const TupleBuffer&, PipelineExecutionContext&) override { }
+        void stop(PipelineExecutionContext&) override { }
+
+        [[nodiscard]] std::vector<OperatorCost> getOperatorCosts() const override
+        {
+            return {
+                {.operatorId = OperatorId(1), .name = "Selection", .numberOfInvocations = 2, .inclusiveCycles = 30, .exclusiveCycles = 10}};
+        }
+
+        [[nodiscard]] uint64_t getStateSizeInBytes() const override { return stateSizeInBytes; }
+        [[nodiscard]] std::vector<uint64_t> getStateSizeInBytesPerWorkerThread() const override { return stateSizeInBytesPerWorkerThread; }
+
+        uint64_t stateSizeInBytes = 0;
+        std::vector<uint64_t> stateSizeInBytesPerWorkerThread;
+
+    protected:
+        std::ostream& toString(std::ostream& os) const override { return os << "ReportingStage"; }
+    };
+};
+
+TEST_F(PipelineStatisticsTest, LatencyBucketsDoubleTheirUpperBound)
+{
+    EXPECT_EQ(PipelineStatistics::latencyBucketOf(std::chrono::nanoseconds(999)), 0);
+    EXPECT_EQ(PipelineStatistics::latencyBucketOf(std::chrono::microseconds(1)), 1);
+    EXPECT_EQ(PipelineStatistics::latencyBucketOf(std::chrono::microseconds(3)), 2);
+    EXPECT_EQ(PipelineStatistics::latencyBucketOf(std::chrono::microseconds(4)), 3);
+    EXPECT_EQ(PipelineStatistics::latencyBucketOf(std::chrono::hours(1)), PipelineStatistics::NUMBER_OF_LATENCY_BUCKETS - 1);
+}
+
+TEST_F(PipelineStatisticsTest, IngestionLatencyBucketsCountNegativeLatenciesAsZero)
+{
+    EXPECT_EQ(PipelineStatistics::ingestionLatencyBucketOf(std::chrono::milliseconds(-3)), 0);
+    EXPECT_EQ(PipelineStatistics::ingestionLatencyBucketOf(std::chrono::milliseconds(0)), 0);
+    EXPECT_EQ(PipelineStatistics::ingestionLatencyBucketOf(std::chrono::milliseconds(1)), 1);
+    EXPECT_EQ(PipelineStatistics::ingestionLatencyBucketOf(std::chrono::milliseconds(1000)), 10);
+    EXPECT_EQ(
+        PipelineStatistics::ingestionLatencyBucketOf(std::chrono::hours(24)), PipelineStatistics::NUMBER_OF_INGESTION_LATENCY_BUCKETS - 1);
+}
+
+TEST_F(PipelineStatisticsTest, SumsTheCountersOfAllWorkerThreads)
+{
+    constexpr size_t numberOfThreads = 4;
+    constexpr size_t numberOfTasksPerThread = 10000;
+    PipelineStatistics statistics(numberOfThreads);
+    {
+        std::vector<std::jthread> threads;
+        /// More threads than counters, thus some threads share their counters
+        for (size_t thread = 0; thread < numberOfThreads + 2; ++thread)
+        {
+            threads.emplace_back(
+                [&statistics, thread]
+                {
+                    for (size_t task = 0; task < numberOfTasksPerThread; ++task)
+                    {
+                        const WorkerThreadId threadId{WorkerThreadId::INITIAL + thread};
+                        statistics.record(threadId, 2, std::chrono::microseconds(5), std::chrono::microseconds(7));
+                        statistics.recordEmit(threadId, 1);
+                        statistics.recordIngestionLatency(threadId, std::chrono::milliseconds(3), std::chrono::milliseconds(40));
+                    }
+                });
+        }
+    }
+
+    const auto snapshot = statistics.snapshot();
+    constexpr uint64_t numberOfTasks = (numberOfThreads + 2) * numberOfTasksPerThread;
+    EXPECT_EQ(snapshot.numberOfTasks, numberOfTasks);
+    EXPECT_EQ(snapshot.numberOfTuples, 2 * numberOfTasks);
+    EXPECT_EQ(snapshot.numberOfEmittedTuples, numberOfTasks);
+    EXPECT_EQ(snapshot.numberOfEmittedBuffers, numberOfTasks);
+    EXPECT_EQ(snapshot.executionTime, std::chrono::microseconds(5) * numberOfTasks);
+    EXPECT_EQ(snapshot.queueingDelay, std::chrono::microseconds(7) * numberOfTasks);
+    EXPECT_EQ(snapshot.latencyHistogram[PipelineStatistics::latencyBucketOf(std::chrono::microseconds(5))], numberOfTasks);
+    EXPECT_EQ(
+        snapshot.ingestionLatencyHistogram[PipelineStatistics::ingestionLatencyBucketOf(std::chrono::milliseconds(3))], numberOfTasks);
+    EXPECT_EQ(
+        snapshot.oldestIngestionLatencyHistogram[PipelineStatistics::ingestionLatencyBucketOf(std::chrono::milliseconds(40))],
+        numberOfTasks);
+}
+
+TEST_F(PipelineStatisticsTest, KeepsTheLastSnapshotOfADetachedStage)
+{
+    PipelineStatistics statistics(1);
+    EXPECT_TRUE(statistics.snapshotStage().operatorCosts.empty());
+
+    ReportingStage stage;
+    statistics.attachStage(stage, {PipelineId(2), PipelineId(3)});
+    stage.stateSizeInBytes = 1024;
+    EXPECT_EQ(statistics.snapshotStage().stateSizeInBytes, 1024);
+
+    /// The stop of the pipeline releases its state, but the peak of the snapshots remains
+    stage.stateSizeInBytes = 0;
+    statistics.detachStage();
+    stage.stateSizeInBytes = 4096;
+    const auto snapshot = statistics.snapshotStage();
+    EXPECT_EQ(snapshot.successors, (std::vector{PipelineId(2), PipelineId(3)}));
+    ASSERT_EQ(snapshot.operatorCosts.size(), 1);
+    EXPECT_EQ(snapshot.operatorCosts.front().name, "Selection");
+    EXPECT_EQ(snapshot.operatorCosts.front().exclusiveCycles, 10);
+    EXPECT_EQ(snapshot.stateSizeInBytes, 0);
+    EXPECT_EQ(snapshot.peakStateSizeInBytes, 1024);
+}
+
+TEST_F(PipelineStatisticsTest, ReportsTheBuffersOfTheAttachedAccount)
+{
+    PipelineStatistics statistics(1);
+    const auto account = std::make_shared<MemoryAccount>(0);
+    statistics.attachMemoryAccount(account);
+    AccountedBufferProvider provider(BufferManager::create(1024, 4), account);
+    {
+        const auto buffer = provider.getBufferBlocking();
+        EXPECT_EQ(statistics.snapshotStage().bufferUsage.numberOfPooledBuffers, 1);
+    }
+
+    /// The buffers of a pipeline may outlive its stage, thus the account is still read after the stage was detached
+    ReportingStage stage;
+    statistics.attachStage(stage, {});
+    statistics.detachStage();
+    const auto snapshot = statistics.snapshotStage();
+    EXPECT_EQ(snapshot.bufferUsage.bytes, 0);
+    EXPECT_EQ(snapshot.peakBufferUsage.bytes, 1024);
+}
+
+TEST_F(PipelineStatisticsTest, MeasuresTheImbalanceOfTheRunningWorkerThreads)
+{
+    EXPECT_EQ(PipelineStatistics::stateImbalanceOf({}, 4), 0);
+    EXPECT_EQ(PipelineStatistics::stateImbalanceOf({0, 0, 0, 0}, 4), 0);
+    EXPECT_EQ(PipelineStatistics::stateImbalanceOf({100, 100, 100, 100}, 4), 0);
+    EXPECT_EQ(PipelineStatistics::stateImbalanceOf({400, 0, 0, 0}, 4), 3);
+    /// Solely the state of the two running worker threads is reserved, the others are not counted
+    EXPECT_EQ(PipelineStatistics::stateImbalanceOf({300, 100, 0, 0}, 2), 0.5);
+}
+
+TEST_F(PipelineStatisticsTest, RebalancesAnImbalancedStateUntilItIsBalanced)
+{
+    constexpr auto megabyte = PipelineStatistics::MIN_REBALANCED_STATE_SIZE_IN_BYTES;
+    PipelineStatistics statistics(1);
+    ReportingStage stage;
+    statistics.attachStage(stage, {});
+
+    /// A small state is never rebalanced
+    stage.stateSizeInBytesPerWorkerThread = {megabyte / 2, 0};
+    statistics.updateRebalancing(0.5, 2);
+    EXPECT_FALSE(statistics.isRebalancing());
+
+    stage.stateSizeInBytesPerWorkerThread = {3 * megabyte, megabyte};
+    statistics.updateRebalancing(0.4, 2);
+    EXPECT_TRUE(statistics.isRebalancing());
+    EXPECT_EQ(statistics.snapshotStage().stateSizeInBytesPerWorkerThread, stage.stateSizeInBytesPerWorkerThread);
+
+    /// Below the threshold but above half of it, the rebalancing continues
+    stage.stateSizeInBytesPerWorkerThread = {5 * megabyte, 3 * megabyte};
+    statistics.updateRebalancing(0.4, 2);
+    EXPECT_TRUE(statistics.isRebalancing());
+
+    stage.stateSizeInBytesPerWorkerThread = {6 * megabyte, 5 * megabyte};
+    statistics.updateRebalancing(0.4, 2);
+    EXPECT_FALSE(statistics.isRebalancing());
+
+    /// A stopped pipeline has no state to rebalance
+    stage.stateSizeInBytesPerWorkerThread = {3 * megabyte, 0};
+    statistics.updateRebalancing(0.4, 2);
+    EXPECT_TRUE(statistics.isRebalancing());
+    statistics.detachStage();
+    statistics.updateRebalancing(0.4, 2);
+    EXPECT_FALSE(statistics.isRebalancing());
+}
+
+}
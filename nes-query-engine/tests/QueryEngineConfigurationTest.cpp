@@ -38,6 +38,73 @@ TEST_F(QueryEngineConfigurationTest, testConfigurationsDefault)
     const QueryEngineConfiguration defaultConfig;
     EXPECT_EQ(defaultConfig.admissionQueueSize.getValue(), 1000);
     EXPECT_EQ(defaultConfig.numberOfWorkerThreads.getValue(), 4);
+    EXPECT_EQ(defaultConfig.maxNumberOfWorkerThreads.getValue(), 0);
+    EXPECT_EQ(defaultConfig.workerThreadIdleTimeout.getValue(), 1000);
+    EXPECT_EQ(defaultConfig.taskQueueMode.getValue(), TaskQueueMode::SHARED);
+    EXPECT_EQ(defaultConfig.maxInlineContinuationDepth.getValue(), 0);
+    EXPECT_EQ(defaultConfig.numberOfCompilationThreads.getValue(), 0);
+    EXPECT_EQ(defaultConfig.maxWorkTaskBatchSize.getValue(), 1);
+    EXPECT_EQ(defaultConfig.maxWorkTaskBatchDuration.getValue(), 1);
+    EXPECT_EQ(defaultConfig.highPriorityWeight.getValue(), 4);
+    EXPECT_EQ(defaultConfig.normalPriorityWeight.getValue(), 2);
+    EXPECT_EQ(defaultConfig.lowPriorityWeight.getValue(), 1);
+}
+
+TEST_F(QueryEngineConfigurationTest, testConfigurationsTaskQueueMode)
+{
+    QueryEngineConfiguration config;
+    config.overwriteConfigWithCommandLineInput({{"task_queue_mode", "WORK_STEALING"}});
+    EXPECT_EQ(config.taskQueueMode.getValue(), TaskQueueMode::WORK_STEALING);
+
+    QueryEngineConfiguration invalidConfig;
+    EXPECT_ANY_THROW(invalidConfig.overwriteConfigWithCommandLineInput({{"task_queue_mode", "XX"}}));
+}
+
+TEST_F(QueryEngineConfigurationTest, testConfigurationsPriorityWeights)
+{
+    QueryEngineConfiguration config;
+    config.overwriteConfigWithCommandLineInput({{"high_priority_weight", "10"}, {"low_priority_weight", "3"}});
+    EXPECT_EQ(config.highPriorityWeight.getValue(), 10);
+    EXPECT_EQ(config.normalPriorityWeight.getValue(), 2);
+    EXPECT_EQ(config.lowPriorityWeight.getValue(), 3);
+
+    QueryEngineConfiguration invalidConfig;
+    EXPECT_ANY_THROW(invalidConfig.overwriteConfigWithCommandLineInput({{"normal_priority_weight", "0"}}));
+}
+
+TEST_F(QueryEngineConfigurationTest, testConfigurationsElasticWorkerThreads)
+{
+    QueryEngineConfiguration config;
+    config.overwriteConfigWithCommandLineInput({{"max_number_of_worker_threads", "8"}, {"worker_thread_idle_timeout", "250"}});
+    EXPECT_EQ(config.maxNumberOfWorkerThreads.getValue(), 8);
+    EXPECT_EQ(config.workerThreadIdleTimeout.getValue(), 250);
+}
+
+TEST_F(QueryEngineConfigurationTest, testConfigurationsLoadShedding)
+{
+    QueryEngineConfiguration config;
+    EXPECT_EQ(config.loadSheddingPolicy.getValue(), LoadSheddingPolicy::NONE);
+    config.overwriteConfigWithCommandLineInput(
+        {{"load_shedding_policy", "OLDEST_FIRST"}, {"load_shedding_admission_occupancy", "80"}, {"load_shedding_max_latency", "50"}});
+    EXPECT_EQ(config.loadSheddingPolicy.getValue(), LoadSheddingPolicy::OLDEST_FIRST);
+    EXPECT_EQ(config.loadSheddingAdmissionOccupancy.getValue(), 80);
+    EXPECT_EQ(config.loadSheddingMaxLatency.getValue(), 50);
+
+    QueryEngineConfiguration badConfig;
+    EXPECT_ANY_THROW(badConfig.overwriteConfigWithCommandLineInput({{"load_shedding_admission_occupancy", "101"}}));
+}
+
+TEST_F(QueryEngineConfigurationTest, testConfigurationsStatistics)
+{
+    QueryEngineConfiguration config;
+    EXPECT_EQ(config.pipelineStatisticsInterval.getValue(), 0);
+    EXPECT_EQ(config.taskEventSamplingRate.getValue(), 1);
+    EXPECT_EQ(config.stateRebalancingThreshold.getValue(), 0);
+    config.overwriteConfigWithCommandLineInput(
+        {{"pipeline_statistics_interval", "100"}, {"task_event_sampling_rate", "64"}, {"state_rebalancing_threshold", "50"}});
+    EXPECT_EQ(config.pipelineStatisticsInterval.getValue(), 100);
+    EXPECT_EQ(config.taskEventSamplingRate.getValue(), 64);
+    EXPECT_EQ(config.stateRebalancingThreshold.getValue(), 50);
 }
 
 TEST_F(QueryEngineConfigurationTest, testConfigurationsValidInput)
@@ -139,6 +139,7 @@ concept RangeOf = std::ranges::range<R> && std::same_as<std::ranges::range_value
 struct TestPipelineExecutionContext : PipelineExecutionContext
 {
     MOCK_METHOD(void, repeatTask, (const TupleBuffer&, std::chrono::milliseconds), (override));
+    MOCK_METHOD(void, submitTask, (const TupleBuffer&), (override));
     MOCK_METHOD(WorkerThreadId, getId, (), (const, override));
     MOCK_METHOD(TupleBuffer, allocateTupleBuffer, (), (override));
     MOCK_METHOD(uint64_t, getNumberOfWorkerThreads, (), (const, override));
@@ -0,0 +1,139 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <SourceFlowControl.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <stop_token>
+#include <thread>
+#include <Identifiers/Identifiers.hpp>
+#include <Time/Timestamp.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+
+namespace NES::Testing
+{
+
+class SourceFlowControlTest : public BaseUnitTest
+{
+public:
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("SourceFlowControlTest.log", NES::LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup SourceFlowControlTest test class.");
+    }
+
+    /// Changes the occupancy of the buffer pool and waits until the flow control observes it
+    void setOccupancy(const double newOccupancy)
+    {
+        occupancy = newOccupancy;
+        std::this_thread::sleep_for(2 * SourceFlowControl::OCCUPANCY_REFRESH_INTERVAL);
+    }
+
+    static constexpr OriginId firstSource{1};
+    static constexpr OriginId secondSource{2};
+    std::atomic<double> occupancy{0};
+    SourceFlowControl flowControl{{{firstSource, 8}, {secondSource, 8}}, [this] { return occupancy.load(); }};
+};
+
+TEST_F(SourceFlowControlTest, CreditsAreRefundedOnCompletion)
+{
+    for (int i = 0; i < 8; ++i)
+    {
+        ASSERT_TRUE(flowControl.acquire(firstSource, std::stop_token{}));
+    }
+
+    /// The source ran out of credits and waits until one of its tasks completes
+    auto blockedAcquire = std::async(std::launch::async, [this] { return flowControl.acquire(firstSource, std::stop_token{}); });
+    EXPECT_EQ(blockedAcquire.wait_for(std::chrono::milliseconds(50)), std::future_status::timeout);
+    flowControl.refund(firstSource);
+    EXPECT_TRUE(blockedAcquire.get());
+
+    /// The credits of one source are independent of the other sources
+    EXPECT_TRUE(flowControl.acquire(secondSource, std::stop_token{}));
+}
+
+TEST_F(SourceFlowControlTest, StopRequestCancelsAcquire)
+{
+    for (int i = 0; i < 8; ++i)
+    {
+        ASSERT_TRUE(flowControl.acquire(firstSource, std::stop_token{}));
+    }
+    std::stop_source stopSource;
+    auto blockedAcquire = std::async(std::launch::async, [&] { return flowControl.acquire(firstSource, stopSource.get_token()); });
+    stopSource.request_stop();
+    EXPECT_FALSE(blockedAcquire.get());
+}
+
+TEST_F(SourceFlowControlTest, SourcesAheadInEventTimeAreThrottledFirst)
+{
+    flowControl.reportWatermark(firstSource, Timestamp(1000));
+
+    setOccupancy(0.4);
+    EXPECT_EQ(flowControl.getNumberOfCredits(firstSource), 8);
+    EXPECT_EQ(flowControl.getNumberOfCredits(secondSource), 8);
+
+    /// Solely the source which is ahead loses credits
+    setOccupancy(0.6);
+    EXPECT_EQ(flowControl.getNumberOfCredits(firstSource), 6);
+    EXPECT_EQ(flowControl.getNumberOfCredits(secondSource), 8);
+
+    /// Both sources lose credits, but every source keeps at least one
+    setOccupancy(1.0);
+    EXPECT_EQ(flowControl.getNumberOfCredits(firstSource), 1);
+    EXPECT_EQ(flowControl.getNumberOfCredits(secondSource), 1);
+
+    /// Once the lagging source catches up, no source is ahead anymore
+    setOccupancy(0.6);
+    flowControl.reportWatermark(secondSource, Timestamp(1000));
+    EXPECT_EQ(flowControl.getNumberOfCredits(firstSource), 8);
+    EXPECT_EQ(flowControl.getNumberOfCredits(secondSource), 8);
+}
+
+TEST_F(SourceFlowControlTest, CountsTheIngestOfEverySource)
+{
+    flowControl.reportIngest(firstSource, 100);
+    flowControl.reportIngest(firstSource, 50);
+    flowControl.reportWatermark(firstSource, Timestamp(1000));
+    ASSERT_TRUE(flowControl.acquire(secondSource, std::stop_token{}));
+
+    const auto metrics = flowControl.getSourceMetrics();
+    ASSERT_EQ(metrics.size(), 2);
+    EXPECT_EQ(metrics[0].originId, firstSource);
+    EXPECT_EQ(metrics[0].numberOfBuffers, 2);
+    EXPECT_EQ(metrics[0].numberOfBytes, 150);
+    EXPECT_EQ(metrics[0].watermark, 1000);
+    EXPECT_EQ(metrics[1].numberOfBuffers, 0);
+    EXPECT_EQ(metrics[1].numberOfInflightBuffers, 1);
+}
+
+TEST_F(SourceFlowControlTest, KeepsThePeakOfTheInflightBuffers)
+{
+    ASSERT_TRUE(flowControl.acquire(firstSource, std::stop_token{}));
+    ASSERT_TRUE(flowControl.acquire(firstSource, std::stop_token{}));
+    flowControl.refund(firstSource);
+    flowControl.refund(firstSource);
+    ASSERT_TRUE(flowControl.acquire(firstSource, std::stop_token{}));
+
+    const auto metrics = flowControl.getSourceMetrics();
+    EXPECT_EQ(metrics[0].numberOfInflightBuffers, 1);
+    EXPECT_EQ(metrics[0].peakNumberOfInflightBuffers, 2);
+}
+
+}
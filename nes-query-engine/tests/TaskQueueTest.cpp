@@ -36,8 +36,8 @@ namespace NES
 class TaskQueueTest : public ::testing::Test
 {
 protected:
-    /// NOLINTNEXTLINE(readability-magic-numbers) 142 is roughly the current task size
-    using Task = std::tuple<int, int, std::array<std::byte, 142>>; /// {thread_id, sequence_number, payload}
+    /// NOLINTNEXTLINE(readability-magic-numbers) 72 is roughly the current task size
+    using Task = std::tuple<int, int, std::array<std::byte, 72>>; /// {thread_id, sequence_number, payload}
     TaskQueue<Task> queue{100};
 
     template <size_t NumberOfConsumers>
@@ -244,4 +244,135 @@ TEST_F(TaskQueueTest, StressTest)
     consumedTasks.verifyUnique();
 }
 
+/// Work stealing mode: Every worker pushes its follow-up tasks into its own local queue, while only a subset of workers produces
+/// follow-up tasks. All tasks have to be consumed exactly once, which requires the remaining workers to steal from their peers.
+TEST_F(TaskQueueTest, WorkStealingTest)
+{
+    constexpr int numberOfSources = 2;
+    constexpr int numberOfWorkerThreads = 4;
+    constexpr int tasksPerSource = 10000;
+    constexpr int followUpTasksPerTask = 4;
+
+    TaskQueue<Task> workStealingQueue{100, numberOfWorkerThreads};
+    ASSERT_TRUE(workStealingQueue.isWorkStealing());
+
+    std::atomic tasksAdded{0};
+    ConsumedTasks<numberOfWorkerThreads> consumedTasks;
+    std::barrier syncBarrier{numberOfWorkerThreads + numberOfSources};
+
+    std::vector<std::jthread> sources;
+    sources.reserve(numberOfSources);
+    for (int sourceId = 0; sourceId < numberOfSources; ++sourceId)
+    {
+        sources.emplace_back(
+            [&, sourceId]
+            {
+                syncBarrier.arrive_and_wait();
+                for (int i = 0; i < tasksPerSource; ++i)
+                {
+                    workStealingQueue.addAdmissionTaskBlocking({}, Task{sourceId, i, {}});
+                }
+                tasksAdded.fetch_add(tasksPerSource, std::memory_order::relaxed);
+            });
+    }
+
+    std::vector<std::jthread> worker;
+    worker.reserve(numberOfWorkerThreads);
+    for (int workerId = 0; workerId < numberOfWorkerThreads; ++workerId)
+    {
+        worker.emplace_back(
+            [&, workerId](const std::stop_token& stoken)
+            {
+                syncBarrier.arrive_and_wait();
+                int count = 0;
+                while (!stoken.stop_requested())
+                {
+                    if (auto task = workStealingQueue.getNextTaskBlocking(stoken, workerId))
+                    {
+                        /// Only even workers emit follow-up tasks, which have to be stolen by the odd workers.
+                        const bool isAdmissionTask = std::get<0>(*task) < numberOfSources;
+                        if (workerId % 2 == 0 && isAdmissionTask)
+                        {
+                            for (int i = 0; i < followUpTasksPerTask; ++i)
+                            {
+                                workStealingQueue.addLocalTaskNonBlocking(workerId, Task{workerId + numberOfSources, count++, {}});
+                            }
+                        }
+                        consumedTasks.localCounters.at(workerId).add(*task);
+                    }
+                }
+                tasksAdded.fetch_add(count, std::memory_order::relaxed);
+            });
+    }
+
+    sources.clear();
+    /// Give the workers some time to process the follow-up tasks before requesting them to stop
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    worker.clear();
+
+    /// Drain remaining tasks, which may reside in any of the local queues
+    while (auto task = workStealingQueue.getNextTaskNonBlocking())
+    {
+        consumedTasks.localCounters.back().add(*task);
+    }
+
+    EXPECT_EQ(consumedTasks.size(), tasksAdded.load());
+    consumedTasks.verifyUnique();
+}
+
+TEST_F(TaskQueueTest, PriorityTest)
+{
+    constexpr int tasksPerPriority = 70;
+    constexpr int tasksPerRound = 7;
+    TaskQueue<Task> priorityQueue{100, 0, {4, 2, 1}};
+
+    for (int i = 0; i < tasksPerPriority; ++i)
+    {
+        priorityQueue.addInternalTaskNonBlocking(Task{0, i, {}}, 0);
+        priorityQueue.addAdmissionTaskBlocking({}, Task{1, i, {}}, 1);
+        priorityQueue.addInternalTaskNonBlocking(Task{2, i, {}}, 2);
+    }
+
+    /// While all priority classes have tasks, every round of 7 tasks serves the classes according to their weights
+    std::array<int, 3> tasksPerClass{};
+    for (int i = 0; i < tasksPerRound * 10; ++i)
+    {
+        const auto task = priorityQueue.getNextTaskNonBlocking();
+        ASSERT_TRUE(task.has_value());
+        ++tasksPerClass.at(std::get<0>(*task));
+    }
+    EXPECT_EQ(tasksPerClass, (std::array{40, 20, 10}));
+
+    /// The exhausted first class does not stall the remaining classes, which are still served in FIFO order
+    std::array<int, 3> nextSequenceNumber{tasksPerClass};
+    for (int i = 0; i < 3 * tasksPerPriority - (tasksPerRound * 10); ++i)
+    {
+        const auto task = priorityQueue.getNextTaskNonBlocking();
+        ASSERT_TRUE(task.has_value());
+        const auto [priority, sequenceNumber, payload] = *task;
+        EXPECT_EQ(sequenceNumber, nextSequenceNumber.at(priority)++);
+    }
+    EXPECT_FALSE(priorityQueue.getNextTaskNonBlocking().has_value());
+}
+
+TEST_F(TaskQueueTest, DeadlineTest)
+{
+    TaskQueue<Task> deadlineQueue{100, 0};
+
+    deadlineQueue.addInternalTaskNonBlocking(Task{0, 0, {}});
+    deadlineQueue.addDeadlineTaskNonBlocking(Task{0, 1, {}}, 30);
+    deadlineQueue.addAdmissionTaskBlocking({}, Task{0, 2, {}});
+    deadlineQueue.addDeadlineTaskNonBlocking(Task{0, 3, {}}, 10);
+    deadlineQueue.addDeadlineTaskNonBlocking(Task{0, 4, {}}, 20);
+
+    /// Tasks with a deadline are read earliest deadline first, before the tasks without a deadline
+    for (const int expectedSequenceNumber : {3, 4, 1, 0, 2})
+    {
+        const auto task = deadlineQueue.getNextTaskNonBlocking();
+        ASSERT_TRUE(task.has_value());
+        EXPECT_EQ(std::get<1>(*task), expectedSequenceNumber);
+    }
+    EXPECT_FALSE(deadlineQueue.getNextTaskNonBlocking().has_value());
+}
+
 }
@@ -118,6 +118,8 @@ struct ExpectStats
     STAT_TYPE(TaskExecutionStart);
     STAT_TYPE(TaskExecutionComplete);
     STAT_TYPE(TaskExpired);
+    STAT_TYPE(SourceBufferShed);
+    STAT_TYPE(PipelineStatisticsSample);
     STAT_TYPE(TaskEmit);
 
     explicit ExpectStats(std::shared_ptr<TestQueryStatisticListener> listener) : listener(std::move(listener))
@@ -136,12 +138,20 @@ struct ExpectStats
             .WillRepeatedly(::testing::Invoke([](auto) { }));
         EXPECT_CALL(*this->listener, onEvent(::testing::VariantWith<NES::TaskExpired>(::testing::_)))
             .WillRepeatedly(::testing::Invoke([](auto) { }));
+        EXPECT_CALL(*this->listener, onEvent(::testing::VariantWith<NES::SourceBufferShed>(::testing::_)))
+            .WillRepeatedly(::testing::Invoke([](auto) { }));
+        EXPECT_CALL(*this->listener, onEvent(::testing::VariantWith<NES::PipelineStatisticsSample>(::testing::_)))
+            .WillRepeatedly(::testing::Invoke([](auto) { }));
         EXPECT_CALL(*this->listener, onEvent(::testing::VariantWith<NES::TaskEmit>(::testing::_)))
             .WillRepeatedly(::testing::Invoke([](auto) { }));
         EXPECT_CALL(*this->listener, onEvent(::testing::VariantWith<NES::QueryStopRequest>(::testing::_)))
             .WillRepeatedly(::testing::Invoke([](auto) { }));
         EXPECT_CALL(*this->listener, onEvent(::testing::VariantWith<NES::QueryFail>(::testing::_)))
             .WillRepeatedly(::testing::Invoke([](auto) { }));
+        EXPECT_CALL(*this->listener, onEvent(::testing::VariantWith<NES::FunctionStatistic>(::testing::_)))
+            .WillRepeatedly(::testing::Invoke([](auto) { }));
+        EXPECT_CALL(*this->listener, onEvent(::testing::VariantWith<NES::BloomFilterStatistic>(::testing::_)))
+            .WillRepeatedly(::testing::Invoke([](auto) { }));
     }
 
     template <typename... Args>
@@ -173,6 +183,11 @@ struct TestWorkEmitter : WorkEmitter
     MOCK_METHOD(void, emitPipelineStart, (QueryId, const std::shared_ptr<RunningQueryPlanNode>&, TaskCallback), (override));
     MOCK_METHOD(void, emitPendingPipelineStop, (QueryId, std::shared_ptr<RunningQueryPlanNode>, TaskCallback), (override));
     MOCK_METHOD(void, emitPipelineStop, (QueryId, std::unique_ptr<RunningQueryPlanNode>, TaskCallback), (override));
+    MOCK_METHOD(double, getBufferPoolOccupancy, (), (const, override));
+    MOCK_METHOD(std::shared_ptr<LoadShedder>, createLoadShedder, (QueryId, QueryPriority), (override));
+    MOCK_METHOD(std::shared_ptr<PipelineStatistics>, createPipelineStatistics, (QueryId, PipelineId), (override));
+    MOCK_METHOD(void, registerSourceFlowControl, (QueryId, std::weak_ptr<SourceFlowControl>), (override));
+    MOCK_METHOD(std::vector<std::shared_ptr<AbstractBufferProvider>>, createBufferProviders, (QueryId), (override));
 };
 
 struct TestQueryLifetimeController : QueryLifetimeController
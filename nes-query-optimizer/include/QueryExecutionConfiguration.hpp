@@ -24,12 +24,15 @@
 #include <Configurations/ScalarOption.hpp>
 #include <Configurations/Validation/FloatValidation.hpp>
 #include <Configurations/Validation/NumberValidation.hpp>
+#include <Nautilus/Interface/Hash/HashFunction.hpp>
+#include <Nautilus/Interface/HashMap/HashMap.hpp>
+#include <SliceStore/WindowSlicesStoreInterface.hpp>
 #include <Util/ExecutionMode.hpp>
 
 namespace NES
 {
 
-static constexpr auto DEFAULT_NUMBER_OF_PARTITIONS_DATASTRUCTURES = 100;
+static constexpr auto DEFAULT_NUMBER_OF_HASH_JOIN_PARTITIONS = 1;
 static constexpr auto DEFAULT_PAGED_VECTOR_SIZE = 1024;
 static constexpr auto DEFAULT_OPERATOR_BUFFER_SIZE = 4096;
 static constexpr auto DEFAULT_NUMBER_OF_RECORDS_PER_KEY = 10;
@@ -42,6 +45,15 @@ enum class StreamJoinStrategy : uint8_t
     OPTIMIZER_CHOOSES
 };
 
+/// Memory layout of the tuple buffers that are passed between pipelines. Buffers that are passed to sinks are always row-wise.
+enum class MemoryLayoutPolicy : uint8_t
+{
+    ROW,
+    COLUMNAR,
+    /// Uses the columnar layout if the query projects few fields of a wide schema
+    OPTIMIZER_CHOOSES
+};
+
 class QueryExecutionConfiguration : public BaseConfiguration
 {
 public:
@@ -52,11 +64,12 @@ public:
         = {"execution_mode",
            ExecutionMode::COMPILER,
            "Execution mode for the query compiler"
-           "[COMPILER|INTERPRETER]."};
+           "[COMPILER|INTERPRETER|TIERED]."};
     UIntOption numberOfPartitions
         = {"number_of_partitions",
-           std::to_string(DEFAULT_NUMBER_OF_PARTITIONS_DATASTRUCTURES),
-           "Partitions in a hash table",
+           std::to_string(DEFAULT_NUMBER_OF_HASH_JOIN_PARTITIONS),
+           "Radix partitions of hash joins and windowed aggregations, rounded up to a power of 2. Each partition of a window is probed by "
+           "a separate task. 1 disables it.",
            {std::make_shared<NumberValidation>()}};
     UIntOption pageSize
         = {"page_size",
@@ -71,18 +84,125 @@ public:
     UIntOption maxNumberOfBuckets = {
         "max_number_of_buckets",
         std::to_string(DEFAULT_MAX_NUMBER_OF_BUCKETS),
-        "Maximal number of buckets for a hash table. If set too low or high degrades either the performance or increases the memory usage.",
+        "Maximal number of buckets that a hash table starts with. Chained hash tables double their buckets, once they store more keys "
+        "than buckets.",
         {std::make_shared<FloatValidation>()}};
     UIntOption operatorBufferSize
         = {"operator_buffer_size",
            std::to_string(DEFAULT_OPERATOR_BUFFER_SIZE),
            "Buffer size of a operator e.g. during scan",
            {std::make_shared<NumberValidation>()}};
+    UIntOption emitCoalescingMaxDelay
+        = {"emit_coalescing_max_delay",
+           "0",
+           "Milliseconds, for which emits that feed a sink may hold back records to coalesce the records of multiple pipeline invocations "
+           "into one buffer, instead of emitting a sparse buffer per input buffer. Latency-critical queries keep it at 0 and may reduce "
+           "the operator_buffer_size instead. 0 disables it.",
+           {std::make_shared<NumberValidation>()}};
+    UIntOption bufferCompressionDelay
+        = {"buffer_compression_delay",
+           "0",
+           "Milliseconds a buffer has to wait in the task queue, before the worker threads lz4 compress the buffers that the pipelines of "
+           "the query emit into unpooled buffers, which return the pooled buffers while the buffers wait. The worker threads estimate the "
+           "wait of a buffer by the wait of the task that emits it. Requires building with NES_ENABLE_BUFFER_COMPRESSION. 0 disables it.",
+           {std::make_shared<NumberValidation>()}};
+    EnumOption<SliceStoreType> sliceStoreType
+        = {"slice_store_type",
+           SliceStoreType::DEFAULT,
+           "Slice store of windowed aggregations and joins. RING_BUFFER looks up and creates slices without locks"
+           "[DEFAULT|RING_BUFFER]."};
+    UIntOption sliceStoreMemoryBudget
+        = {"slice_store_memory_budget",
+           "0",
+           "Bytes of nested loop join state behind the watermark that the slice store keeps in memory, before it spills idle slices to "
+           "disk. 0 disables spilling.",
+           {std::make_shared<NumberValidation>()}};
+    StringOption spillDirectory = {"spill_directory", "/tmp", "Directory, in which the slice store creates the files of spilled slices."};
+    StringOption checkpointDirectory
+        = {"checkpoint_directory",
+           "",
+           "Directory, in which nested loop joins checkpoint their slices behind the watermark, and from which they restore the slices "
+           "when the same query starts again. Empty disables checkpointing."};
+    UIntOption idleOriginTimeout
+        = {"idle_origin_timeout",
+           "0",
+           "Milliseconds without buffers, after which windowed aggregations and joins advance the watermark of an input origin to the "
+           "most advanced input origin, so that an idle origin does not block the windows. Its records behind the watermark are late. "
+           "0 disables it.",
+           {std::make_shared<NumberValidation>()}};
+    UIntOption allowedLateness
+        = {"allowed_lateness",
+           "0",
+           "Time units of the event time, for which windowed aggregations and joins keep a window open after the watermark has passed its "
+           "end, so that out-of-order records still contribute to it. Records arriving later are dropped and counted.",
+           {std::make_shared<NumberValidation>()}};
+    UIntOption preAggregationTableSize
+        = {"pre_aggregation_table_size",
+           "0",
+           "Keys of the small per thread table, in which windowed aggregations pre-aggregate the records of a buffer before merging them "
+           "into the hash map of the slice. Solely applies to sum, count, min, max, and avg. 0 disables it.",
+           {std::make_shared<NumberValidation>()}};
+    BoolOption incrementalSlidingWindowAggregation
+        = {"incremental_sliding_window_aggregation",
+           "false",
+           "Combines per sliding window the precombined states of two chunks of slices instead of the states of all slices of the window, "
+           "if a window spans more than two slides."};
+    BoolOption hashJoinBloomFilter
+        = {"hash_join_bloom_filter",
+           "true",
+           "Checks a Bloom filter over the keys of one side of the hash join before probing the hash maps with the keys of the other side."};
+    BoolOption symmetricHashJoin
+        = {"symmetric_hash_join",
+           "false",
+           "Probes each record of a hash join with tumbling windows against the hash maps of the other side right after inserting it. "
+           "Thus, the join emits results per input buffer instead of once the window ends."};
+    BoolOption sharedSlidingWindowHashJoin
+        = {"shared_sliding_window_hash_join",
+           "false",
+           "Probes each pair of slices of a hash join with sliding windows once and emits its joined records for all windows that contain "
+           "both slices, instead of probing the pair again for each of these windows."};
+    UIntOption hashJoinSkewedProbeTasks
+        = {"hash_join_skewed_probe_tasks",
+           "4",
+           "Maximal number of tasks that probe a partition of a hash join window, if a heavy hitter key would let a single task join more "
+           "pairs than an even spread over the worker threads. Each task probes a share of the hash maps of the right side against all "
+           "hash maps of the left side. 1 disables it.",
+           {std::make_shared<NumberValidation>()}};
+    BoolOption multiWayJoin
+        = {"multi_way_join",
+           "true",
+           "Collapses left-deep chains of at least two hash joins on the same key and tumbling window into a single multi-way hash join. "
+           "Thus, the join probes the keys of the first input once against all other inputs without materializing intermediate results."};
     EnumOption<StreamJoinStrategy> joinStrategy
         = {"join_strategy",
            StreamJoinStrategy::OPTIMIZER_CHOOSES,
            "Join Strategy"
            "[NESTED_LOOP_JOIN|HASH_JOIN|OPTIMIZER_CHOOSES]."};
+    UIntOption expectedJoinInputRate
+        = {"expected_join_input_rate",
+           "0",
+           "Expected records per second of each join input. If set and the optimizer chooses the join strategy, equi-joins whose windows "
+           "hold too few records to amortize building the hash tables use a nested loop join. 0 disables the estimate.",
+           {std::make_shared<NumberValidation>()}};
+    EnumOption<Nautilus::Interface::HashMapType> hashMapType
+        = {"hash_map_type",
+           Nautilus::Interface::HashMapType::CHAINED,
+           "Collision resolution of the hash maps in aggregations and hash joins"
+           "[CHAINED|OPEN_ADDRESSING]."};
+    EnumOption<Nautilus::Interface::HashFunctionType> hashFunction
+        = {"hash_function",
+           Nautilus::Interface::HashFunctionType::MURMUR3,
+           "Hash function for the keys of aggregations and hash joins. CRC32 requires SSE4.2 or ARMv8 CRC instructions to be fast"
+           "[MURMUR3|CRC32|XXH3]."};
+    EnumOption<MemoryLayoutPolicy> memoryLayout
+        = {"memory_layout",
+           MemoryLayoutPolicy::ROW,
+           "Memory layout of the buffers between pipelines"
+           "[ROW|COLUMNAR|OPTIMIZER_CHOOSES]."};
+    BoolOption vectorizedSelection
+        = {"vectorized_selection",
+           "true",
+           "Evaluates simple selection predicates over whole buffers instead of per record, if the selection directly follows a scan."};
 
 private:
     std::vector<BaseOption*> getOptions() override
@@ -92,9 +212,29 @@ private:
             &pageSize,
             &numberOfPartitions,
             &joinStrategy,
+            &expectedJoinInputRate,
+            &hashJoinBloomFilter,
+            &symmetricHashJoin,
+            &sharedSlidingWindowHashJoin,
+            &hashJoinSkewedProbeTasks,
+            &multiWayJoin,
             &numberOfRecordsPerKey,
             &maxNumberOfBuckets,
-            &operatorBufferSize};
+            &incrementalSlidingWindowAggregation,
+            &hashMapType,
+            &hashFunction,
+            &operatorBufferSize,
+            &emitCoalescingMaxDelay,
+            &bufferCompressionDelay,
+            &sliceStoreType,
+            &sliceStoreMemoryBudget,
+            &spillDirectory,
+            &checkpointDirectory,
+            &idleOriginTimeout,
+            &allowedLateness,
+            &preAggregationTableSize,
+            &memoryLayout,
+            &vectorizedSelection};
     }
 };
 
@@ -31,6 +31,12 @@ enum class JoinImplementation : uint8_t
 {
     NESTED_LOOP_JOIN,
     HASH_JOIN,
+    /// Hash join over the cells of a grid for joins whose join function is a distance between the positions of both sides
+    SPATIAL_HASH_JOIN,
+    /// Sort-merge join over an attribute of both sides for joins whose join function bounds the difference of the attributes
+    BAND_JOIN,
+    /// Nested loop join over an R-tree of the points of one side for joins whose join function clips them to the STBoxes of the other side
+    STBOX_JOIN,
     CHOICELESS
 };
 
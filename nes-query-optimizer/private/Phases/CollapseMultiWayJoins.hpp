@@ -0,0 +1,33 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+#include <Operators/LogicalOperator.hpp>
+#include <Plans/LogicalPlan.hpp>
+
+namespace NES
+{
+
+/// Replaces a left-deep chain of at least two equi joins on the same key and the same tumbling window, e.g., a star join of a fact stream
+/// with several dimension streams, by a single MultiWayJoinLogicalOperator. Thus, the join probes each key of the first input once
+/// against all other inputs, instead of materializing and rehashing the intermediate result of every binary join.
+class CollapseMultiWayJoins
+{
+public:
+    LogicalPlan apply(const LogicalPlan& queryPlan);
+
+private:
+    LogicalOperator apply(const LogicalOperator& logicalOperator);
+};
+}
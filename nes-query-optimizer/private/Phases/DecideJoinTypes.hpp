@@ -13,6 +13,8 @@
 */
 
 #pragma once
+#include <cstdint>
+#include <Operators/Windows/JoinLogicalOperator.hpp>
 #include <Plans/LogicalPlan.hpp>
 
 #include <QueryExecutionConfiguration.hpp>
@@ -20,16 +22,30 @@
 namespace NES
 {
 
-/// Decides what join implementation should be used. For now, we support HashJoin or a NestedLoopJoin
+/// Decides what join implementation should be used. For now, we support HashJoin, a spatial HashJoin over grid cells, or a NestedLoopJoin
+/// If the expected input rate is known, the optimizer estimates the records per window of each input. A nested loop join compares every
+/// pair of records, while a hash join pays for hashing, inserting and probing every record, thus small windows favor the nested loop join
+/// even on equi-joins.
 class DecideJoinTypes
 {
 public:
-    explicit DecideJoinTypes(const StreamJoinStrategy joinStrategy) : joinStrategy(joinStrategy) { }
+    /// Estimated cost of building and probing the hash tables per record, in comparisons of the nested loop join
+    static constexpr uint64_t HASH_JOIN_COST_PER_RECORD = 8;
+
+    explicit DecideJoinTypes(const StreamJoinStrategy joinStrategy, const uint64_t expectedInputRate = 0)
+        : joinStrategy(joinStrategy), expectedInputRate(expectedInputRate)
+    {
+    }
 
     LogicalPlan apply(const LogicalPlan& queryPlan);
 
 private:
     LogicalOperator apply(const LogicalOperator& logicalOperator);
+    /// True, if the estimated records per window make the nested loop join cheaper than the hash join
+    [[nodiscard]] bool prefersNestedLoopJoin(const JoinLogicalOperator& joinOperator) const;
+
     StreamJoinStrategy joinStrategy;
+    /// Records per second of each join input, 0 if unknown
+    uint64_t expectedInputRate;
 };
 }
@@ -0,0 +1,44 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+
+#pragma once
+
+#include <optional>
+#include <string>
+#include <unordered_set>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
+#include <Operators/LogicalOperator.hpp>
+#include <Plans/LogicalPlan.hpp>
+
+namespace NES
+{
+
+/// Narrows the output schema of each source, which solely feeds selections followed by a projection, to the fields that the selections
+/// and the projection read. Thus, the input formatter of the source solely converts the fields that the query reads, and the formatted
+/// buffers shrink accordingly. Sources that feed any other operator keep all fields, as we do not know which fields the operator reads.
+class PushProjectionsIntoSources
+{
+public:
+    LogicalPlan apply(const LogicalPlan& queryPlan);
+
+private:
+    /// @param readFields fields that the ancestors of the operator read, nullopt if we do not know them
+    LogicalOperator apply(const LogicalOperator& logicalOperator, const std::optional<std::vector<std::string>>& readFields);
+
+    /// Sources that occur multiple times in the plan, whose ancestors may read different fields
+    std::unordered_set<OperatorId> sharedSources;
+};
+}
@@ -14,9 +14,11 @@
 
 #pragma once
 
+#include <chrono>
 #include <cstdint>
 #include <memory>
 #include <vector>
+#include <DataTypes/Schema.hpp>
 #include <Identifiers/Identifiers.hpp>
 #include <Util/ExecutionMode.hpp>
 #include <PhysicalOperator.hpp>
@@ -35,6 +37,9 @@ public:
     void addSinkRoot(std::shared_ptr<PhysicalOperatorWrapper> sink);
     void setExecutionMode(ExecutionMode mode);
     void setOperatorBufferSize(uint64_t bufferSize);
+    void setEmitCoalescingMaxDelay(std::chrono::milliseconds maxDelay);
+    void setBufferCompressionDelay(std::chrono::milliseconds delay);
+    void setOperatorMemoryLayout(Schema::MemoryLayoutType memoryLayout);
 
     /// R-value as finalize should be called once at the end, with a move() to 'build' the plan.
     [[nodiscard]] PhysicalPlan finalize() &&;
@@ -44,6 +49,9 @@ private:
     Roots sinks;
     ExecutionMode executionMode;
     uint64_t operatorBufferSize{};
+    std::chrono::milliseconds emitCoalescingMaxDelay{0};
+    std::chrono::milliseconds bufferCompressionDelay{0};
+    Schema::MemoryLayoutType operatorMemoryLayout{Schema::MemoryLayoutType::ROW_LAYOUT};
 
     /// Used internally to flip the plan from sink->source tstatic o source->sink
     static Roots flip(const Roots& roots);
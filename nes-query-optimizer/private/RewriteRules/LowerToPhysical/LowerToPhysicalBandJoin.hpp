@@ -0,0 +1,57 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <optional>
+#include <utility>
+#include <DataTypes/Schema.hpp>
+#include <Functions/FieldAccessLogicalFunction.hpp>
+#include <Functions/LogicalFunction.hpp>
+#include <Operators/LogicalOperator.hpp>
+#include <RewriteRules/AbstractRewriteRule.hpp>
+#include <QueryExecutionConfiguration.hpp>
+
+namespace NES
+{
+
+/// Numeric fields of both join sides, whose difference the join function bounds by lowerBound <= leftField - rightField <= upperBound
+struct BandJoinPredicate
+{
+    FieldAccessLogicalFunction leftField;
+    FieldAccessLogicalFunction rightField;
+    double lowerBound;
+    double upperBound;
+};
+
+/// Returns the band join predicate, if the conjuncts of the join function contain a lower and an upper bound on the difference of the same
+/// pair of fields, e.g., left.ts >= right.ts - 5 AND left.ts <= right.ts + 5. Each bound must be a comparison between two sums of a field
+/// and constants. Otherwise, returns nullopt. The bounds are inclusive, as the probe evaluates the complete join function anyway, and
+/// assume that adding the constants does not overflow.
+std::optional<BandJoinPredicate>
+getBandJoinPredicate(const LogicalFunction& joinFunction, const Schema& leftInputSchema, const Schema& rightInputSchema);
+
+/// Lowers a join with a band join predicate to a sort-merge band join (NLJBuild and BandJoinProbe).
+/// The probe evaluates the complete join function for all records within the band.
+struct LowerToPhysicalBandJoin : AbstractRewriteRule
+{
+    explicit LowerToPhysicalBandJoin(QueryExecutionConfiguration conf) : conf(std::move(conf)) { }
+
+    RewriteRuleResultSubgraph apply(LogicalOperator logicalOperator) override;
+
+private:
+    QueryExecutionConfiguration conf;
+};
+
+}
@@ -0,0 +1,45 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <utility>
+#include <DataTypes/Schema.hpp>
+#include <Operators/LogicalOperator.hpp>
+#include <Operators/LookupJoinLogicalOperator.hpp>
+#include <RewriteRules/AbstractRewriteRule.hpp>
+#include <QueryExecutionConfiguration.hpp>
+
+namespace NES
+{
+
+struct LowerToPhysicalLookupJoin : AbstractRewriteRule
+{
+    LowerToPhysicalLookupJoin(QueryExecutionConfiguration conf, const Schema::MemoryLayoutType operatorMemoryLayout)
+        : conf(std::move(conf)), operatorMemoryLayout(operatorMemoryLayout)
+    {
+    }
+
+    RewriteRuleResultSubgraph apply(LogicalOperator logicalOperator) override;
+
+private:
+    /// Lowers a lookup join with an external table, whose rows are requested during the execution of the query
+    RewriteRuleResultSubgraph
+    lowerExternalTable(const LogicalOperator& logicalOperator, const LookupJoinLogicalOperator::ExternalTable& externalTable);
+
+    QueryExecutionConfiguration conf;
+    Schema::MemoryLayoutType operatorMemoryLayout;
+};
+
+}
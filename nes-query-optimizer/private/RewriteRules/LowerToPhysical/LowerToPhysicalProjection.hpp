@@ -15,6 +15,7 @@
 #pragma once
 
 #include <utility>
+#include <DataTypes/Schema.hpp>
 #include <Operators/LogicalOperator.hpp>
 #include <RewriteRules/AbstractRewriteRule.hpp>
 #include <QueryExecutionConfiguration.hpp>
@@ -24,12 +25,16 @@ namespace NES
 
 struct LowerToPhysicalProjection : AbstractRewriteRule
 {
-    explicit LowerToPhysicalProjection(QueryExecutionConfiguration conf) : conf(std::move(conf)) { }
+    LowerToPhysicalProjection(QueryExecutionConfiguration conf, const Schema::MemoryLayoutType operatorMemoryLayout)
+        : conf(std::move(conf)), operatorMemoryLayout(operatorMemoryLayout)
+    {
+    }
 
     RewriteRuleResultSubgraph apply(LogicalOperator logicalOperator) override;
 
 private:
     QueryExecutionConfiguration conf;
+    Schema::MemoryLayoutType operatorMemoryLayout;
 };
 
 }
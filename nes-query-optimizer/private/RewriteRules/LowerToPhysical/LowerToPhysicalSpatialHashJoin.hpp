@@ -0,0 +1,56 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+
+#pragma once
+
+#include <optional>
+#include <utility>
+#include <DataTypes/Schema.hpp>
+#include <Functions/LogicalFunction.hpp>
+#include <Operators/LogicalOperator.hpp>
+#include <RewriteRules/AbstractRewriteRule.hpp>
+#include <QueryExecutionConfiguration.hpp>
+
+namespace NES
+{
+
+/// Positions of both join sides and the distance of a point-to-point EDWITHIN_TGEO_GEO in the join function
+struct SpatialJoinPredicate
+{
+    LogicalFunction leftLon;
+    LogicalFunction leftLat;
+    LogicalFunction rightLon;
+    LogicalFunction rightLat;
+    double distance;
+};
+
+/// Returns the spatial join predicate, if the join function or one of its conjuncts is a point-to-point EDWITHIN_TGEO_GEO
+/// between fields of the left and the right side with a positive constant distance. Otherwise, returns nullopt.
+std::optional<SpatialJoinPredicate>
+getSpatialJoinPredicate(const LogicalFunction& joinFunction, const Schema& leftInputSchema, const Schema& rightInputSchema);
+
+/// Lowers a join with a spatial join predicate to a hash join over the cells of a grid (SpatialHJBuild and HJProbe).
+/// The probe evaluates the complete join function for all records that share a cell.
+struct LowerToPhysicalSpatialHashJoin : AbstractRewriteRule
+{
+    explicit LowerToPhysicalSpatialHashJoin(QueryExecutionConfiguration conf) : conf(std::move(conf)) { }
+
+    RewriteRuleResultSubgraph apply(LogicalOperator logicalOperator) override;
+
+private:
+    QueryExecutionConfiguration conf;
+};
+
+}
@@ -0,0 +1,56 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <optional>
+#include <utility>
+#include <DataTypes/Schema.hpp>
+#include <Functions/LogicalFunction.hpp>
+#include <Join/StreamJoinUtil.hpp>
+#include <Operators/LogicalOperator.hpp>
+#include <RewriteRules/AbstractRewriteRule.hpp>
+#include <QueryExecutionConfiguration.hpp>
+
+namespace NES
+{
+
+/// Position and timestamp of the points of one join side and the STBox of the other side of a TGEO_AT_STBOX in the join function
+struct StBoxJoinPredicate
+{
+    JoinBuildSideType pointSide;
+    LogicalFunction lon;
+    LogicalFunction lat;
+    LogicalFunction timestamp;
+    LogicalFunction stbox;
+};
+
+/// Returns the STBox join predicate, if the join function or one of its conjuncts is TGEO_AT_STBOX(lon, lat, timestamp, stbox) = 1,
+/// whose point is given by fields of one side and whose STBox is a field of the other side. Otherwise, returns nullopt.
+std::optional<StBoxJoinPredicate>
+getStBoxJoinPredicate(const LogicalFunction& joinFunction, const Schema& leftInputSchema, const Schema& rightInputSchema);
+
+/// Lowers a join with an STBox join predicate to an NLJ that indexes the points of a window by an R-tree (NLJBuild and StBoxJoinProbe).
+/// The probe evaluates the complete join function for all points within the bounds of an STBox.
+struct LowerToPhysicalStBoxJoin : AbstractRewriteRule
+{
+    explicit LowerToPhysicalStBoxJoin(QueryExecutionConfiguration conf) : conf(std::move(conf)) { }
+
+    RewriteRuleResultSubgraph apply(LogicalOperator logicalOperator) override;
+
+private:
+    QueryExecutionConfiguration conf;
+};
+
+}
@@ -16,6 +16,7 @@
 
 #include <memory>
 #include <string>
+#include <DataTypes/Schema.hpp>
 #include <RewriteRules/AbstractRewriteRule.hpp>
 #include <Util/Registry.hpp>
 #include <QueryExecutionConfiguration.hpp>
@@ -28,6 +29,8 @@ using RewriteRuleRegistryReturnType = std::unique_ptr<AbstractRewriteRule>;
 struct RewriteRuleRegistryArguments
 {
     QueryExecutionConfiguration conf;
+    /// Memory layout of the buffers between pipelines, as resolved from the MemoryLayoutPolicy of the configuration
+    Schema::MemoryLayoutType operatorMemoryLayout = Schema::MemoryLayoutType::ROW_LAYOUT;
 };
 
 class RewriteRuleRegistry
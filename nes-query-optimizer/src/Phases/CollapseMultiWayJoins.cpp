@@ -0,0 +1,163 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Phases/CollapseMultiWayJoins.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+#include <Functions/BooleanFunctions/EqualsLogicalFunction.hpp>
+#include <Functions/FieldAccessLogicalFunction.hpp>
+#include <Functions/LogicalFunction.hpp>
+#include <Operators/LogicalOperator.hpp>
+#include <Operators/Windows/JoinLogicalOperator.hpp>
+#include <Operators/Windows/MultiWayJoinLogicalOperator.hpp>
+#include <Plans/LogicalPlan.hpp>
+#include <WindowTypes/Types/TumblingWindow.hpp>
+#include <WindowTypes/Types/WindowType.hpp>
+#include <ErrorHandling.hpp>
+
+namespace NES
+{
+
+namespace
+{
+/// The inputs and their join fields of a left-deep chain of equi joins on the same key
+struct JoinChain
+{
+    std::vector<LogicalOperator> inputs;
+    std::vector<LogicalFunction> joinFields;
+};
+
+/// Returns the join field of the left and the right input, if the join function solely compares one field of each input for equality
+std::optional<std::pair<LogicalFunction, LogicalFunction>> getEquiJoinFields(const JoinLogicalOperator& join)
+{
+    const auto equals = join.getJoinFunction().tryGet<EqualsLogicalFunction>();
+    if (not equals.has_value())
+    {
+        return std::nullopt;
+    }
+    const auto children = equals->getChildren();
+    const auto firstField = children.at(0).tryGet<FieldAccessLogicalFunction>();
+    const auto secondField = children.at(1).tryGet<FieldAccessLogicalFunction>();
+    if (not(firstField.has_value() and secondField.has_value()) or firstField->getDataType() != secondField->getDataType())
+    {
+        return std::nullopt;
+    }
+
+    if (join.getLeftSchema().contains(firstField->getFieldName()) and join.getRightSchema().contains(secondField->getFieldName()))
+    {
+        return std::make_pair(children.at(0), children.at(1));
+    }
+    if (join.getLeftSchema().contains(secondField->getFieldName()) and join.getRightSchema().contains(firstField->getFieldName()))
+    {
+        return std::make_pair(children.at(1), children.at(0));
+    }
+    return std::nullopt;
+}
+
+/// As the multi-way join assigns all records to the windows of the same slices, we solely collapse joins with the same tumbling windows.
+/// Nested sliding windows would join records of different windows of the inner join in one window of the outer join.
+bool haveSameTumblingWindow(const JoinLogicalOperator& join, const JoinLogicalOperator& otherJoin)
+{
+    const auto window = std::dynamic_pointer_cast<Windowing::TumblingWindow>(join.getWindowType());
+    const auto otherWindow = std::dynamic_pointer_cast<Windowing::TumblingWindow>(otherJoin.getWindowType());
+    if (window == nullptr or otherWindow == nullptr)
+    {
+        return false;
+    }
+
+    /// The time characteristic of a join is qualified by the first input containing the timestamp field
+    const auto& timeCharacteristic = window->getTimeCharacteristic();
+    const auto& otherTimeCharacteristic = otherWindow->getTimeCharacteristic();
+    return window->getSize().getTime() == otherWindow->getSize().getTime()
+        and timeCharacteristic.getType() == otherTimeCharacteristic.getType()
+        and timeCharacteristic.getTimeUnit() == otherTimeCharacteristic.getTimeUnit()
+        and timeCharacteristic.field.getUnqualifiedName() == otherTimeCharacteristic.field.getUnqualifiedName();
+}
+
+/// Collects the inputs of the longest left-deep chain of equi joins on the same key and window that ends in the given join
+std::optional<JoinChain> getJoinChain(const JoinLogicalOperator& join)
+{
+    const auto joinFields = getEquiJoinFields(join);
+    if (not joinFields.has_value() or std::dynamic_pointer_cast<Windowing::TumblingWindow>(join.getWindowType()) == nullptr)
+    {
+        return std::nullopt;
+    }
+    const auto& [leftField, rightField] = joinFields.value();
+    const auto children = join.getChildren();
+
+    if (const auto leftJoin = children.at(0).tryGetAs<JoinLogicalOperator>(); leftJoin and haveSameTumblingWindow(join, *leftJoin.value()))
+    {
+        if (auto leftChain = getJoinChain(*leftJoin.value()))
+        {
+            /// As all join fields of the chain are equal, the left join field may be any of them
+            const auto leftFieldName = leftField.get<FieldAccessLogicalFunction>().getFieldName();
+            const auto joinsOnSameKey = std::ranges::any_of(
+                leftChain->joinFields,
+                [&leftFieldName](const LogicalFunction& joinField)
+                { return joinField.get<FieldAccessLogicalFunction>().getFieldName() == leftFieldName; });
+            if (joinsOnSameKey and leftChain->joinFields.front().getDataType() == leftField.getDataType())
+            {
+                leftChain->inputs.emplace_back(children.at(1));
+                leftChain->joinFields.emplace_back(rightField);
+                return leftChain;
+            }
+        }
+    }
+    return JoinChain{.inputs = {children.at(0), children.at(1)}, .joinFields = {leftField, rightField}};
+}
+}
+
+LogicalPlan CollapseMultiWayJoins::apply(const LogicalPlan& queryPlan)
+{
+    PRECONDITION(queryPlan.getRootOperators().size() == 1, "Only single root operators are supported for now");
+    return LogicalPlan{queryPlan.getQueryId(), {apply(queryPlan.getRootOperators()[0])}};
+}
+
+LogicalOperator CollapseMultiWayJoins::apply(const LogicalOperator& logicalOperator)
+{
+    if (const auto join = logicalOperator.tryGetAs<JoinLogicalOperator>())
+    {
+        /// A single binary join gains nothing from the multi-way join
+        if (auto chain = getJoinChain(*join.value()); chain.has_value() and chain->inputs.size() > 2)
+        {
+            const auto inputs = chain->inputs
+                | std::views::transform([this](const LogicalOperator& input) { return apply(input); }) | std::ranges::to<std::vector>();
+            const auto inputSchemas = inputs | std::views::transform([](const LogicalOperator& input) { return input.getOutputSchema(); })
+                | std::ranges::to<std::vector>();
+
+            /// The multi-way join takes over the output origin id of the outermost join, as it produces the same records
+            const auto multiWayJoin = MultiWayJoinLogicalOperator(std::move(chain->joinFields), join.value()->getWindowType())
+                                          .withChildren(inputs)
+                                          .withInferredSchema(inputSchemas)
+                                          .withTraitSet(logicalOperator.getTraitSet());
+            INVARIANT(
+                multiWayJoin.getOutputSchema() == logicalOperator.getOutputSchema(),
+                "The multi-way join must produce the same schema as the joins it replaces, but got {} instead of {}",
+                multiWayJoin.getOutputSchema(),
+                logicalOperator.getOutputSchema());
+            return LogicalOperator{multiWayJoin};
+        }
+    }
+
+    const auto children = logicalOperator.getChildren()
+        | std::views::transform([this](const LogicalOperator& child) { return apply(child); }) | std::ranges::to<std::vector>();
+    return logicalOperator.withChildren(children);
+}
+}
@@ -14,6 +14,7 @@
 #include <Phases/DecideJoinTypes.hpp>
 
 #include <algorithm>
+#include <cstdint>
 #include <ranges>
 #include <unordered_set>
 #include <vector>
@@ -27,10 +28,15 @@
 #include <Operators/LogicalOperator.hpp>
 #include <Operators/Windows/JoinLogicalOperator.hpp>
 #include <Plans/LogicalPlan.hpp>
+#include <RewriteRules/LowerToPhysical/LowerToPhysicalBandJoin.hpp>
+#include <RewriteRules/LowerToPhysical/LowerToPhysicalSpatialHashJoin.hpp>
+#include <RewriteRules/LowerToPhysical/LowerToPhysicalStBoxJoin.hpp>
 #include <Traits/ImplementationTypeTrait.hpp>
 #include <Traits/Trait.hpp>
 #include <Traits/TraitSet.hpp>
 #include <Util/Logger/Logger.hpp>
+#include <WindowTypes/Measures/TimeMeasure.hpp>
+#include <WindowTypes/Types/TimeBasedWindowType.hpp>
 #include <ErrorHandling.hpp>
 #include <QueryExecutionConfiguration.hpp>
 
@@ -78,6 +84,25 @@ bool shallUseHashJoin(const LogicalFunction& joinFunction)
 }
 }
 
+bool DecideJoinTypes::prefersNestedLoopJoin(const JoinLogicalOperator& joinOperator) const
+{
+    auto* windowType = dynamic_cast<Windowing::TimeBasedWindowType*>(joinOperator.getWindowType().get());
+    if (expectedInputRate == 0 or windowType == nullptr)
+    {
+        return false;
+    }
+    /// The nested loop join compares n * n pairs of records per window, while the hash join costs about 2 * n * HASH_JOIN_COST_PER_RECORD
+    constexpr uint64_t millisecondsPerSecond = 1000;
+    const auto recordsPerWindow = expectedInputRate * windowType->getSize().getTime() / millisecondsPerSecond;
+    const auto prefersNestedLoopJoin = recordsPerWindow < 2 * HASH_JOIN_COST_PER_RECORD;
+    NES_DEBUG(
+        "Join on {} expects {} records per window and input, thus it prefers the {}",
+        joinOperator.getJoinFunction(),
+        recordsPerWindow,
+        prefersNestedLoopJoin ? "nested loop join" : "hash join");
+    return prefersNestedLoopJoin;
+}
+
 LogicalPlan DecideJoinTypes::apply(const LogicalPlan& queryPlan)
 {
     PRECONDITION(queryPlan.getRootOperators().size() == 1, "Only single root operators are supported for now");
@@ -96,10 +121,37 @@ LogicalOperator DecideJoinTypes::apply(const LogicalOperator& logicalOperator)
         {
             tryInsert(traitSet, ImplementationTypeTrait{JoinImplementation::NESTED_LOOP_JOIN});
         }
+        else if (getSpatialJoinPredicate(
+                     joinOperator.value()->getJoinFunction(), joinOperator.value()->getLeftSchema(), joinOperator.value()->getRightSchema())
+                     .has_value())
+        {
+            /// A distance between the positions of both sides only requires to compare records in the same or neighbouring grid cells
+            tryInsert(traitSet, ImplementationTypeTrait{JoinImplementation::SPATIAL_HASH_JOIN});
+        }
+        else if (
+            this->joinStrategy == StreamJoinStrategy::OPTIMIZER_CHOOSES and shallUseHashJoin(joinOperator.value()->getJoinFunction())
+            and prefersNestedLoopJoin(*joinOperator.value()))
+        {
+            tryInsert(traitSet, ImplementationTypeTrait{JoinImplementation::NESTED_LOOP_JOIN});
+        }
         else if (shallUseHashJoin(joinOperator.value()->getJoinFunction()))
         {
             tryInsert(traitSet, ImplementationTypeTrait{JoinImplementation::HASH_JOIN});
         }
+        else if (getBandJoinPredicate(
+                     joinOperator.value()->getJoinFunction(), joinOperator.value()->getLeftSchema(), joinOperator.value()->getRightSchema())
+                     .has_value())
+        {
+            /// A bounded difference between attributes of both sides only requires to compare records within the band after sorting
+            tryInsert(traitSet, ImplementationTypeTrait{JoinImplementation::BAND_JOIN});
+        }
+        else if (getStBoxJoinPredicate(
+                     joinOperator.value()->getJoinFunction(), joinOperator.value()->getLeftSchema(), joinOperator.value()->getRightSchema())
+                     .has_value())
+        {
+            /// Clipping the points of one side to the STBoxes of the other side only requires to compare the points within the box bounds
+            tryInsert(traitSet, ImplementationTypeTrait{JoinImplementation::STBOX_JOIN});
+        }
         else
         {
             tryInsert(traitSet, ImplementationTypeTrait{JoinImplementation::NESTED_LOOP_JOIN});
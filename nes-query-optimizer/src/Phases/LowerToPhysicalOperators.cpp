@@ -14,18 +14,23 @@
 #include <Phases/LowerToPhysicalOperators.hpp>
 
 #include <algorithm>
+#include <chrono>
+#include <cstddef>
 #include <memory>
 #include <ranges>
 #include <string>
 #include <utility>
 #include <vector>
+#include <DataTypes/Schema.hpp>
 #include <Operators/LogicalOperator.hpp>
+#include <Operators/ProjectionLogicalOperator.hpp>
 #include <Plans/LogicalPlan.hpp>
 #include <RewriteRules/AbstractRewriteRule.hpp>
 #include <Traits/ImplementationTypeTrait.hpp>
 #include <Traits/Trait.hpp>
 #include <Traits/TraitSet.hpp>
 #include <Util/Logger/Logger.hpp>
+#include <magic_enum/magic_enum.hpp>
 #include <ErrorHandling.hpp>
 #include <PhysicalOperator.hpp>
 #include <PhysicalPlan.hpp>
@@ -38,6 +43,34 @@ namespace NES::LowerToPhysicalOperators
 
 namespace
 {
+/// Schemas with fewer fields are narrow enough that reading full rows wastes little memory bandwidth
+constexpr size_t MIN_NUMBER_OF_FIELDS_FOR_COLUMNAR_LAYOUT = 8;
+
+/// A columnar layout pays off if a projection reads at most half of the fields of a wide schema, as only the accessed columns have to
+/// be loaded. Otherwise, the row layout avoids scattered accesses when whole records are read or written.
+Schema::MemoryLayoutType chooseMemoryLayout(const LogicalPlan& queryPlan, const MemoryLayoutPolicy policy)
+{
+    switch (policy)
+    {
+        case MemoryLayoutPolicy::ROW:
+            return Schema::MemoryLayoutType::ROW_LAYOUT;
+        case MemoryLayoutPolicy::COLUMNAR:
+            return Schema::MemoryLayoutType::COLUMNAR_LAYOUT;
+        case MemoryLayoutPolicy::OPTIMIZER_CHOOSES: {
+            const auto projections = getOperatorByType<ProjectionLogicalOperator>(queryPlan);
+            const auto isSelectiveProjection = [](const auto& projection)
+            {
+                const auto numberOfInputFields = projection->getInputSchemas()[0].getNumberOfFields();
+                return numberOfInputFields >= MIN_NUMBER_OF_FIELDS_FOR_COLUMNAR_LAYOUT
+                    and 2 * projection->getAccessedFields().size() <= numberOfInputFields;
+            };
+            return std::ranges::any_of(projections, isSelectiveProjection) ? Schema::MemoryLayoutType::COLUMNAR_LAYOUT
+                                                                           : Schema::MemoryLayoutType::ROW_LAYOUT;
+        }
+    }
+    std::unreachable();
+}
+
 std::unique_ptr<AbstractRewriteRule>
 resolveRewriteRule(const LogicalOperator& logicalOperator, const RewriteRuleRegistryArguments& registryArgument)
 {
@@ -56,6 +89,27 @@ resolveRewriteRule(const LogicalOperator& logicalOperator, const RewriteRuleRegi
                 }
                 throw UnknownOptimizerRule("Rewrite rule for logical operator '{}' can't be resolved", logicalOperator.getName());
             }
+            case JoinImplementation::SPATIAL_HASH_JOIN: {
+                if (auto ruleOptional = RewriteRuleRegistry::instance().create(std::string("SpatialHashJoin"), registryArgument))
+                {
+                    return std::move(ruleOptional.value());
+                }
+                throw UnknownOptimizerRule("Rewrite rule for logical operator '{}' can't be resolved", logicalOperator.getName());
+            }
+            case JoinImplementation::BAND_JOIN: {
+                if (auto ruleOptional = RewriteRuleRegistry::instance().create(std::string("BandJoin"), registryArgument))
+                {
+                    return std::move(ruleOptional.value());
+                }
+                throw UnknownOptimizerRule("Rewrite rule for logical operator '{}' can't be resolved", logicalOperator.getName());
+            }
+            case JoinImplementation::STBOX_JOIN: {
+                if (auto ruleOptional = RewriteRuleRegistry::instance().create(std::string("StBoxJoin"), registryArgument))
+                {
+                    return std::move(ruleOptional.value());
+                }
+                throw UnknownOptimizerRule("Rewrite rule for logical operator '{}' can't be resolved", logicalOperator.getName());
+            }
             case JoinImplementation::NESTED_LOOP_JOIN: {
                 if (auto ruleOptional = RewriteRuleRegistry::instance().create(std::string("NLJoin"), registryArgument))
                 {
@@ -125,7 +179,9 @@ lowerOperatorRecursively(const LogicalOperator& logicalOperator, const RewriteRu
 
 PhysicalPlan apply(const LogicalPlan& queryPlan, const QueryExecutionConfiguration& conf) /// NOLINT
 {
-    const auto registryArgument = RewriteRuleRegistryArguments{conf};
+    const auto operatorMemoryLayout = chooseMemoryLayout(queryPlan, conf.memoryLayout.getValue());
+    NES_DEBUG("Using the {} for buffers between pipelines", magic_enum::enum_name(operatorMemoryLayout));
+    const auto registryArgument = RewriteRuleRegistryArguments{.conf = conf, .operatorMemoryLayout = operatorMemoryLayout};
     std::vector<std::shared_ptr<PhysicalOperatorWrapper>> newRootOperators;
     newRootOperators.reserve(queryPlan.getRootOperators().size());
     for (const auto& logicalRoot : queryPlan.getRootOperators())
@@ -138,6 +194,9 @@ PhysicalPlan apply(const LogicalPlan& queryPlan, const QueryExecutionConfigurati
     physicalPlanBuilder.addSinkRoot(newRootOperators[0]);
     physicalPlanBuilder.setExecutionMode(conf.executionMode.getValue());
     physicalPlanBuilder.setOperatorBufferSize(conf.operatorBufferSize.getValue());
+    physicalPlanBuilder.setEmitCoalescingMaxDelay(std::chrono::milliseconds(conf.emitCoalescingMaxDelay.getValue()));
+    physicalPlanBuilder.setBufferCompressionDelay(std::chrono::milliseconds(conf.bufferCompressionDelay.getValue()));
+    physicalPlanBuilder.setOperatorMemoryLayout(operatorMemoryLayout);
     return std::move(physicalPlanBuilder).finalize();
 }
 }
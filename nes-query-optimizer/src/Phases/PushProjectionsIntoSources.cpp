@@ -0,0 +1,113 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+
+#include <Phases/PushProjectionsIntoSources.hpp>
+
+#include <algorithm>
+#include <optional>
+#include <ranges>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include <Functions/FieldAccessLogicalFunction.hpp>
+#include <Functions/LogicalFunction.hpp>
+#include <Identifiers/Identifiers.hpp>
+#include <Iterators/BFSIterator.hpp>
+#include <Operators/LogicalOperator.hpp>
+#include <Operators/ProjectionLogicalOperator.hpp>
+#include <Operators/SelectionLogicalOperator.hpp>
+#include <Operators/Sources/SourceDescriptorLogicalOperator.hpp>
+#include <Plans/LogicalPlan.hpp>
+#include <ErrorHandling.hpp>
+
+namespace NES
+{
+
+LogicalPlan PushProjectionsIntoSources::apply(const LogicalPlan& queryPlan)
+{
+    PRECONDITION(queryPlan.getRootOperators().size() == 1, "Only single root operators are supported for now");
+    std::unordered_set<OperatorId> seenSources;
+    sharedSources.clear();
+    for (const auto& source : getOperatorByType<SourceDescriptorLogicalOperator>(queryPlan))
+    {
+        if (not seenSources.emplace(source.getId()).second)
+        {
+            sharedSources.emplace(source.getId());
+        }
+    }
+    return LogicalPlan{queryPlan.getQueryId(), {apply(queryPlan.getRootOperators()[0], std::nullopt)}};
+}
+
+LogicalOperator
+PushProjectionsIntoSources::apply(const LogicalOperator& logicalOperator, const std::optional<std::vector<std::string>>& readFields)
+{
+    if (const auto source = logicalOperator.tryGetAs<SourceDescriptorLogicalOperator>())
+    {
+        const auto outputSchema = logicalOperator.getOutputSchema();
+        const auto readsAllFields = not readFields.has_value() or readFields->empty()
+            or readFields->size() >= outputSchema.getNumberOfFields()
+            or not std::ranges::all_of(*readFields, [&outputSchema](const auto& fieldName) { return outputSchema.contains(fieldName); });
+        if (readsAllFields or source.value()->isProjected() or sharedSources.contains(logicalOperator.getId()))
+        {
+            return logicalOperator;
+        }
+        return source.value()->withProjectedFields(readFields.value());
+    }
+
+    /// A selection reads the fields of its predicate in addition to the fields that its ancestors read
+    std::optional<std::vector<std::string>> readFieldsOfChildren;
+    if (const auto projection = logicalOperator.tryGetAs<ProjectionLogicalOperator>())
+    {
+        readFieldsOfChildren = projection.value()->getAccessedFields();
+    }
+    else if (const auto selection = logicalOperator.tryGetAs<SelectionLogicalOperator>(); selection and readFields)
+    {
+        readFieldsOfChildren = readFields;
+        for (const auto& function : BFSRange(selection.value()->getPredicate()))
+        {
+            if (const auto fieldAccess = function.tryGet<FieldAccessLogicalFunction>())
+            {
+                readFieldsOfChildren->emplace_back(fieldAccess->getFieldName());
+            }
+        }
+    }
+    if (readFieldsOfChildren)
+    {
+        std::ranges::sort(*readFieldsOfChildren);
+        const auto duplicates = std::ranges::unique(*readFieldsOfChildren);
+        readFieldsOfChildren->erase(duplicates.begin(), duplicates.end());
+    }
+
+    const auto children = logicalOperator.getChildren()
+        | std::views::transform([this, &readFieldsOfChildren](const LogicalOperator& child) { return apply(child, readFieldsOfChildren); })
+        | std::ranges::to<std::vector>();
+    if (std::ranges::equal(children, logicalOperator.getChildren()))
+    {
+        return logicalOperator.withChildren(children);
+    }
+
+    /// The narrowed schemas of the sources propagate up to the projection, which produces the same output schema as before
+    const auto inputSchemas = children | std::views::transform([](const LogicalOperator& child) { return child.getOutputSchema(); })
+        | std::ranges::to<std::vector>();
+    auto rewrittenOperator = logicalOperator.withChildren(children).withInferredSchema(inputSchemas);
+    INVARIANT(
+        not logicalOperator.tryGetAs<ProjectionLogicalOperator>().has_value()
+            or rewrittenOperator.getOutputSchema() == logicalOperator.getOutputSchema(),
+        "Narrowing the sources must not change the output schema of the projection {}",
+        logicalOperator);
+    return rewrittenOperator;
+}
+}
@@ -13,12 +13,14 @@
 */
 #include <PhysicalPlanBuilder.hpp>
 
+#include <chrono>
 #include <cstdint>
 #include <memory>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
+#include <DataTypes/Schema.hpp>
 #include <Identifiers/Identifiers.hpp>
 #include <Util/ExecutionMode.hpp>
 #include <ErrorHandling.hpp>
@@ -50,10 +52,32 @@ void PhysicalPlanBuilder::setOperatorBufferSize(uint64_t bufferSize)
     operatorBufferSize = bufferSize;
 }
 
+void PhysicalPlanBuilder::setEmitCoalescingMaxDelay(std::chrono::milliseconds maxDelay)
+{
+    emitCoalescingMaxDelay = maxDelay;
+}
+
+void PhysicalPlanBuilder::setBufferCompressionDelay(std::chrono::milliseconds delay)
+{
+    bufferCompressionDelay = delay;
+}
+
+void PhysicalPlanBuilder::setOperatorMemoryLayout(Schema::MemoryLayoutType memoryLayout)
+{
+    operatorMemoryLayout = memoryLayout;
+}
+
 PhysicalPlan PhysicalPlanBuilder::finalize() &&
 {
     auto sources = flip(sinks);
-    return {queryId, std::move(sources), executionMode, operatorBufferSize};
+    return {
+        queryId,
+        std::move(sources),
+        executionMode,
+        operatorBufferSize,
+        emitCoalescingMaxDelay,
+        bufferCompressionDelay,
+        operatorMemoryLayout};
 }
 
 using PhysicalOpPtr = std::shared_ptr<PhysicalOperatorWrapper>;
@@ -14,8 +14,10 @@
 
 #include <QueryOptimizer.hpp>
 
+#include <Phases/CollapseMultiWayJoins.hpp>
 #include <Phases/DecideJoinTypes.hpp>
 #include <Phases/LowerToPhysicalOperators.hpp>
+#include <Phases/PushProjectionsIntoSources.hpp>
 #include <Plans/LogicalPlan.hpp>
 #include <PhysicalPlan.hpp>
 
@@ -29,9 +31,18 @@ PhysicalPlan QueryOptimizer::optimize(const LogicalPlan& plan) const
 PhysicalPlan QueryOptimizer::optimize(const LogicalPlan& plan, const QueryExecutionConfiguration& defaultQueryExecution)
 {
     /// In the future, we will have a real rule matching engine / rule driver for our optimizer.
-    /// For now, we just decide the join type (if one exists in the query) and lower to physical operators in a pure function.
-    DecideJoinTypes joinTypeDecider(defaultQueryExecution.joinStrategy);
-    const auto optimizedPlan = joinTypeDecider.apply(plan);
+    /// For now, we just narrow the sources to the fields that the query reads, collapse chains of hash joins, decide the join type (if one
+    /// exists in the query) and lower to physical operators in a pure function.
+    PushProjectionsIntoSources projectionPusher;
+    auto collapsedPlan = projectionPusher.apply(plan);
+    if (defaultQueryExecution.multiWayJoin.getValue()
+        and defaultQueryExecution.joinStrategy.getValue() != StreamJoinStrategy::NESTED_LOOP_JOIN)
+    {
+        CollapseMultiWayJoins multiWayJoinCollapser;
+        collapsedPlan = multiWayJoinCollapser.apply(collapsedPlan);
+    }
+    DecideJoinTypes joinTypeDecider(defaultQueryExecution.joinStrategy, defaultQueryExecution.expectedJoinInputRate.getValue());
+    const auto optimizedPlan = joinTypeDecider.apply(collapsedPlan);
     return LowerToPhysicalOperators::apply(optimizedPlan, defaultQueryExecution);
 }
 
@@ -0,0 +1,352 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <RewriteRules/LowerToPhysical/LowerToPhysicalBandJoin.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/DataTypeProvider.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Functions/ArithmeticalFunctions/AddLogicalFunction.hpp>
+#include <Functions/ArithmeticalFunctions/SubLogicalFunction.hpp>
+#include <Functions/BooleanFunctions/AndLogicalFunction.hpp>
+#include <Functions/CastToTypeLogicalFunction.hpp>
+#include <Functions/ComparisonFunctions/GreaterEqualsLogicalFunction.hpp>
+#include <Functions/ComparisonFunctions/GreaterLogicalFunction.hpp>
+#include <Functions/ComparisonFunctions/LessEqualsLogicalFunction.hpp>
+#include <Functions/ComparisonFunctions/LessLogicalFunction.hpp>
+#include <Functions/ConstantValueLogicalFunction.hpp>
+#include <Functions/FieldAccessLogicalFunction.hpp>
+#include <Functions/FunctionProvider.hpp>
+#include <Functions/LogicalFunction.hpp>
+#include <Functions/PhysicalFunction.hpp>
+#include <Identifiers/Identifiers.hpp>
+#include <Iterators/BFSIterator.hpp>
+#include <Join/NestedLoopJoin/BandJoinProbePhysicalOperator.hpp>
+#include <Join/NestedLoopJoin/NLJBuildPhysicalOperator.hpp>
+#include <Join/NestedLoopJoin/NLJOperatorHandler.hpp>
+#include <Join/StreamJoinUtil.hpp>
+#include <Nautilus/Interface/BufferRef/TupleBufferRef.hpp>
+#include <Operators/LogicalOperator.hpp>
+#include <Operators/Windows/JoinLogicalOperator.hpp>
+#include <RewriteRules/AbstractRewriteRule.hpp>
+#include <SliceStore/WindowSlicesStoreInterface.hpp>
+#include <Traits/OutputOriginIdsTrait.hpp>
+#include <Traits/TraitSet.hpp>
+#include <Util/Common.hpp>
+#include <Util/Strings.hpp>
+#include <Watermark/TimestampField.hpp>
+#include <WindowTypes/Types/TimeBasedWindowType.hpp>
+#include <ErrorHandling.hpp>
+#include <PhysicalOperator.hpp>
+#include <RewriteRuleRegistry.hpp>
+
+namespace NES
+{
+
+namespace
+{
+/// A side of a comparison as sign * field + offset. Without a field, the side is the constant offset.
+struct LinearTerm
+{
+    std::optional<FieldAccessLogicalFunction> field;
+    double sign;
+    double offset;
+};
+
+std::optional<LinearTerm> toLinearTerm(const LogicalFunction& function)
+{
+    if (const auto fieldAccess = function.tryGet<FieldAccessLogicalFunction>())
+    {
+        if (not fieldAccess->getDataType().isNumeric())
+        {
+            return std::nullopt;
+        }
+        return LinearTerm{.field = *fieldAccess, .sign = 1, .offset = 0};
+    }
+    if (const auto constant = function.tryGet<ConstantValueLogicalFunction>())
+    {
+        const auto value = Util::from_chars<double>(constant->getConstantValue());
+        if (not value.has_value() or not std::isfinite(*value))
+        {
+            return std::nullopt;
+        }
+        return LinearTerm{.field = std::nullopt, .sign = 0, .offset = *value};
+    }
+
+    const auto isAdd = function.tryGet<AddLogicalFunction>().has_value();
+    const auto isSub = function.tryGet<SubLogicalFunction>().has_value();
+    const auto children = function.getChildren();
+    if (not(isAdd or isSub) or children.size() != 2)
+    {
+        return std::nullopt;
+    }
+    const auto lhs = toLinearTerm(children[0]);
+    const auto rhs = toLinearTerm(children[1]);
+    if (not lhs.has_value() or not rhs.has_value() or (lhs->field.has_value() and rhs->field.has_value()))
+    {
+        return std::nullopt;
+    }
+    const double rhsFactor = isAdd ? 1 : -1;
+    return LinearTerm{
+        .field = lhs->field.has_value() ? lhs->field : rhs->field,
+        .sign = lhs->field.has_value() ? lhs->sign : rhsFactor * rhs->sign,
+        .offset = lhs->offset + (rhsFactor * rhs->offset)};
+}
+
+/// Bound of a comparison on the difference between a field of the left and a field of the right side
+struct DifferenceBound
+{
+    FieldAccessLogicalFunction leftField;
+    FieldAccessLogicalFunction rightField;
+    double bound;
+    bool isUpperBound;
+};
+
+std::optional<DifferenceBound>
+toDifferenceBound(const LogicalFunction& comparison, const Schema& leftInputSchema, const Schema& rightInputSchema)
+{
+    const auto isLess = comparison.tryGet<LessLogicalFunction>().has_value() or comparison.tryGet<LessEqualsLogicalFunction>().has_value();
+    const auto isGreater
+        = comparison.tryGet<GreaterLogicalFunction>().has_value() or comparison.tryGet<GreaterEqualsLogicalFunction>().has_value();
+    const auto children = comparison.getChildren();
+    if (not(isLess or isGreater) or children.size() != 2)
+    {
+        return std::nullopt;
+    }
+    const auto lhs = toLinearTerm(children[0]);
+    const auto rhs = toLinearTerm(children[1]);
+    if (not lhs.has_value() or not rhs.has_value() or not lhs->field.has_value() or not rhs->field.has_value())
+    {
+        return std::nullopt;
+    }
+
+    /// lhs - rhs = signLeft * leftField + signRight * rightField + offset, which is a multiple of the difference, iff the signs differ
+    const auto isLeft
+        = [&](const FieldAccessLogicalFunction& field) { return leftInputSchema.getFieldByName(field.getFieldName()).has_value(); };
+    const auto isRight
+        = [&](const FieldAccessLogicalFunction& field) { return rightInputSchema.getFieldByName(field.getFieldName()).has_value(); };
+    const auto offset = lhs->offset - rhs->offset;
+    if (isLeft(*lhs->field) and isRight(*rhs->field) and lhs->sign == rhs->sign)
+    {
+        /// lhs.sign * (leftField - rightField) + offset compared to 0
+        return DifferenceBound{
+            .leftField = *lhs->field, .rightField = *rhs->field, .bound = -lhs->sign * offset, .isUpperBound = isLess == (lhs->sign > 0)};
+    }
+    if (isRight(*lhs->field) and isLeft(*rhs->field) and lhs->sign == rhs->sign)
+    {
+        /// -lhs.sign * (leftField - rightField) + offset compared to 0
+        return DifferenceBound{
+            .leftField = *rhs->field, .rightField = *lhs->field, .bound = lhs->sign * offset, .isUpperBound = isLess == (lhs->sign < 0)};
+    }
+    return std::nullopt;
+}
+
+PhysicalFunction lowerBandField(const FieldAccessLogicalFunction& field)
+{
+    return QueryCompilation::FunctionProvider::lowerFunction(
+        CastToTypeLogicalFunction(DataTypeProvider::provideDataType(DataType::Type::FLOAT64), field));
+}
+
+auto getJoinFieldNames(const Schema& inputSchema, const LogicalFunction& joinFunction)
+{
+    return BFSRange(joinFunction)
+        | std::views::filter([](const auto& child) { return child.template tryGet<FieldAccessLogicalFunction>().has_value(); })
+        | std::views::transform([](const auto& child) { return child.template tryGet<FieldAccessLogicalFunction>()->getFieldName(); })
+        | std::views::filter([&](const auto& fieldName) { return inputSchema.contains(fieldName); })
+        | std::ranges::to<std::vector<std::string>>();
+}
+}
+
+std::optional<BandJoinPredicate>
+getBandJoinPredicate(const LogicalFunction& joinFunction, const Schema& leftInputSchema, const Schema& rightInputSchema)
+{
+    /// Collecting the conjuncts of the join function. The probe evaluates all of them for each candidate within the band.
+    std::vector<LogicalFunction> conjuncts;
+    std::vector pending{joinFunction};
+    while (not pending.empty())
+    {
+        const auto function = pending.back();
+        pending.pop_back();
+        if (function.tryGet<AndLogicalFunction>().has_value())
+        {
+            std::ranges::copy(function.getChildren(), std::back_inserter(pending));
+        }
+        else
+        {
+            conjuncts.emplace_back(function);
+        }
+    }
+
+    /// Intersecting the bounds of each pair of fields and returning the first pair that has a lower and an upper bound
+    struct PartialBand
+    {
+        FieldAccessLogicalFunction leftField;
+        FieldAccessLogicalFunction rightField;
+        std::optional<double> lowerBound;
+        std::optional<double> upperBound;
+    };
+    std::vector<PartialBand> bands;
+    for (const auto& conjunct : conjuncts)
+    {
+        const auto differenceBound = toDifferenceBound(conjunct, leftInputSchema, rightInputSchema);
+        if (not differenceBound.has_value())
+        {
+            continue;
+        }
+        auto band = std::ranges::find_if(
+            bands,
+            [&](const PartialBand& partialBand)
+            {
+                return partialBand.leftField.getFieldName() == differenceBound->leftField.getFieldName()
+                    and partialBand.rightField.getFieldName() == differenceBound->rightField.getFieldName();
+            });
+        if (band == bands.end())
+        {
+            band = bands.insert(
+                bands.end(),
+                PartialBand{
+                    .leftField = differenceBound->leftField,
+                    .rightField = differenceBound->rightField,
+                    .lowerBound = std::nullopt,
+                    .upperBound = std::nullopt});
+        }
+        if (differenceBound->isUpperBound)
+        {
+            band->upperBound = std::min(band->upperBound.value_or(differenceBound->bound), differenceBound->bound);
+        }
+        else
+        {
+            band->lowerBound = std::max(band->lowerBound.value_or(differenceBound->bound), differenceBound->bound);
+        }
+    }
+
+    for (const auto& [leftField, rightField, lowerBound, upperBound] : bands)
+    {
+        if (lowerBound.has_value() and upperBound.has_value() and *lowerBound <= *upperBound)
+        {
+            return BandJoinPredicate{
+                .leftField = leftField, .rightField = rightField, .lowerBound = *lowerBound, .upperBound = *upperBound};
+        }
+    }
+    return std::nullopt;
+}
+
+RewriteRuleResultSubgraph LowerToPhysicalBandJoin::apply(LogicalOperator logicalOperator)
+{
+    PRECONDITION(logicalOperator.tryGetAs<JoinLogicalOperator>(), "Expected a JoinLogicalOperator");
+    PRECONDITION(std::ranges::size(logicalOperator.getChildren()) == 2, "Expected two children");
+    auto outputOriginIdsOpt = getTrait<OutputOriginIdsTrait>(logicalOperator.getTraitSet());
+    PRECONDITION(outputOriginIdsOpt.has_value(), "Expected the outputOriginIds trait to be set");
+    auto& outputOriginIds = outputOriginIdsOpt.value();
+    PRECONDITION(std::ranges::size(outputOriginIdsOpt.value()) == 1, "Expected one output origin id");
+    PRECONDITION(logicalOperator.getInputSchemas().size() == 2, "Expected two input schemas");
+
+    auto join = logicalOperator.getAs<JoinLogicalOperator>();
+    auto handlerId = getNextOperatorHandlerId();
+
+    auto leftInputSchema = join->getLeftSchema();
+    auto rightInputSchema = join->getRightSchema();
+    auto outputSchema = join.getOutputSchema();
+    auto outputOriginId = outputOriginIds[0];
+    auto logicalJoinFunction = join->getJoinFunction();
+    auto windowType = NES::Util::as<Windowing::TimeBasedWindowType>(join->getWindowType());
+    const auto pageSize = conf.pageSize.getValue();
+    const auto bandJoinPredicate = getBandJoinPredicate(logicalJoinFunction, leftInputSchema, rightInputSchema);
+    PRECONDITION(bandJoinPredicate.has_value(), "Expected a band join predicate in the join function {}", logicalJoinFunction);
+
+    const auto inputOriginIds
+        = join.getChildren()
+        | std::views::transform(
+              [](const auto& child)
+              {
+                  auto childOutputOriginIds = getTrait<OutputOriginIdsTrait>(child.getTraitSet());
+                  PRECONDITION(childOutputOriginIds.has_value(), "Expected the outputOriginIds trait of the child to be set");
+                  return childOutputOriginIds.value();
+              })
+        | std::views::join | std::ranges::to<std::vector<OriginId>>();
+
+    /// The builds are the ones of the NLJ. Both band fields are join fields and thus, key fields of the paged vectors.
+    auto joinFunction = QueryCompilation::FunctionProvider::lowerFunction(logicalJoinFunction);
+    auto leftBufferRef = TupleBufferRef::create(pageSize, leftInputSchema);
+    leftBufferRef->getMemoryLayout()->setKeyFieldNames(getJoinFieldNames(leftInputSchema, logicalJoinFunction));
+    leftBufferRef->getMemoryLayout()->optimizeFieldPlacement(leftBufferRef->getMemoryLayout()->getKeyFieldNames());
+    auto rightBufferRef = TupleBufferRef::create(pageSize, rightInputSchema);
+    rightBufferRef->getMemoryLayout()->setKeyFieldNames(getJoinFieldNames(rightInputSchema, logicalJoinFunction));
+    rightBufferRef->getMemoryLayout()->optimizeFieldPlacement(rightBufferRef->getMemoryLayout()->getKeyFieldNames());
+
+    auto [timeStampFieldLeft, timeStampFieldRight] = TimestampField::getTimestampLeftAndRight(*join, windowType);
+    auto leftBuildOperator
+        = NLJBuildPhysicalOperator(handlerId, JoinBuildSideType::Left, timeStampFieldLeft.toTimeFunction(), leftBufferRef);
+    auto rightBuildOperator
+        = NLJBuildPhysicalOperator(handlerId, JoinBuildSideType::Right, timeStampFieldRight.toTimeFunction(), rightBufferRef);
+
+    auto joinSchema = JoinSchema(leftInputSchema, rightInputSchema, outputSchema);
+    auto probeOperator = BandJoinProbePhysicalOperator(
+        handlerId,
+        joinFunction,
+        join->getWindowMetaData(),
+        joinSchema,
+        leftBufferRef,
+        rightBufferRef,
+        lowerBandField(bandJoinPredicate->leftField),
+        lowerBandField(bandJoinPredicate->rightField),
+        bandJoinPredicate->lowerBound,
+        bandJoinPredicate->upperBound);
+
+    auto sliceAndWindowStore = WindowSlicesStoreInterface::create(
+        conf.sliceStoreType.getValue(),
+        windowType->getSize().getTime(),
+        windowType->getSlide().getTime(),
+        conf.sliceStoreMemoryBudget.getValue(),
+        conf.spillDirectory.getValue());
+    auto handler = std::make_shared<NLJOperatorHandler>(inputOriginIds, outputOriginId, std::move(sliceAndWindowStore));
+    handler->setIdleOriginTimeout(std::chrono::milliseconds(conf.idleOriginTimeout.getValue()));
+    handler->setAllowedLateness(conf.allowedLateness.getValue());
+
+    auto leftBuildWrapper = std::make_shared<PhysicalOperatorWrapper>(
+        std::move(leftBuildOperator), leftInputSchema, outputSchema, handlerId, handler, PhysicalOperatorWrapper::PipelineLocation::EMIT);
+
+    auto rightBuildWrapper = std::make_shared<PhysicalOperatorWrapper>(
+        std::move(rightBuildOperator), rightInputSchema, outputSchema, handlerId, handler, PhysicalOperatorWrapper::PipelineLocation::EMIT);
+
+    auto probeWrapper = std::make_shared<PhysicalOperatorWrapper>(
+        std::move(probeOperator),
+        outputSchema,
+        outputSchema,
+        handlerId,
+        handler,
+        PhysicalOperatorWrapper::PipelineLocation::SCAN,
+        std::vector{leftBuildWrapper, rightBuildWrapper});
+
+    return {.root = {probeWrapper}, .leafs = {leftBuildWrapper, rightBuildWrapper}};
+};
+
+std::unique_ptr<AbstractRewriteRule>
+RewriteRuleGeneratedRegistrar::RegisterBandJoinRewriteRule(RewriteRuleRegistryArguments argument) /// NOLINT
+{
+    return std::make_unique<LowerToPhysicalBandJoin>(argument.conf);
+}
+
+}
@@ -0,0 +1,96 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <RewriteRules/LowerToPhysical/LowerToPhysicalEventTimeSort.hpp>
+
+#include <chrono>
+#include <memory>
+#include <vector>
+#include <EventTimeSort/EventTimeSortBuildPhysicalOperator.hpp>
+#include <EventTimeSort/EventTimeSortOperatorHandler.hpp>
+#include <EventTimeSort/EventTimeSortProbePhysicalOperator.hpp>
+#include <Functions/FieldAccessLogicalFunction.hpp>
+#include <Functions/FieldAccessPhysicalFunction.hpp>
+#include <Identifiers/Identifiers.hpp>
+#include <Nautilus/Interface/BufferRef/TupleBufferRef.hpp>
+#include <Operators/EventTimeSortLogicalOperator.hpp>
+#include <Operators/LogicalOperator.hpp>
+#include <RewriteRules/AbstractRewriteRule.hpp>
+#include <SliceStore/WindowSlicesStoreInterface.hpp>
+#include <Traits/OutputOriginIdsTrait.hpp>
+#include <Traits/TraitSet.hpp>
+#include <Watermark/TimeFunction.hpp>
+#include <Watermark/TimestampField.hpp>
+#include <ErrorHandling.hpp>
+#include <PhysicalOperator.hpp>
+#include <RewriteRuleRegistry.hpp>
+
+namespace NES
+{
+
+RewriteRuleResultSubgraph LowerToPhysicalEventTimeSort::apply(LogicalOperator logicalOperator)
+{
+    PRECONDITION(logicalOperator.tryGetAs<EventTimeSortLogicalOperator>(), "Expected an EventTimeSortLogicalOperator");
+    PRECONDITION(logicalOperator.getChildren().size() == 1, "Expected one child");
+    const auto outputOriginIds = getTrait<OutputOriginIdsTrait>(logicalOperator.getTraitSet());
+    PRECONDITION(outputOriginIds.has_value() and outputOriginIds->size() == 1, "Expected one output origin id");
+    const auto inputOriginIds = getTrait<OutputOriginIdsTrait>(logicalOperator.getChildren()[0].getTraitSet());
+    PRECONDITION(inputOriginIds.has_value(), "Expected the outputOriginIds trait of the child to be set");
+
+    const auto sort = logicalOperator.getAs<EventTimeSortLogicalOperator>();
+    const auto handlerId = getNextOperatorHandlerId();
+    const auto inputSchema = sort.getInputSchemas()[0];
+    const auto outputSchema = sort.getOutputSchema();
+    const auto timestampFieldName = sort->getOnField().get<FieldAccessLogicalFunction>().getFieldName();
+
+    /// The build and the probe share the PagedVectors of the slices, thus they use the same layout of the records
+    auto bufferRef = Nautilus::Interface::BufferRef::TupleBufferRef::create(conf.pageSize.getValue(), inputSchema);
+    auto buildOperator = EventTimeSortBuildPhysicalOperator(
+        handlerId, TimestampField::eventTime(timestampFieldName, sort->getUnit()).toTimeFunction(), bufferRef);
+    auto probeOperator = EventTimeSortProbePhysicalOperator(
+        handlerId, EventTimeFunction(FieldAccessPhysicalFunction(timestampFieldName), sort->getUnit()), timestampFieldName, bufferRef);
+
+    /// Each reorder interval is a tumbling window of a single slice
+    auto sliceAndWindowStore = WindowSlicesStoreInterface::create(
+        conf.sliceStoreType.getValue(),
+        sort->getReorderIntervalMs(),
+        sort->getReorderIntervalMs(),
+        conf.sliceStoreMemoryBudget.getValue(),
+        conf.spillDirectory.getValue());
+    auto handler = std::make_shared<EventTimeSortOperatorHandler>(
+        std::vector(inputOriginIds->begin(), inputOriginIds->end()), outputOriginIds.value()[0], std::move(sliceAndWindowStore));
+    handler->setIdleOriginTimeout(std::chrono::milliseconds(conf.idleOriginTimeout.getValue()));
+    handler->setAllowedLateness(conf.allowedLateness.getValue());
+
+    auto buildWrapper = std::make_shared<PhysicalOperatorWrapper>(
+        std::move(buildOperator), inputSchema, outputSchema, handlerId, handler, PhysicalOperatorWrapper::PipelineLocation::EMIT);
+    auto probeWrapper = std::make_shared<PhysicalOperatorWrapper>(
+        std::move(probeOperator),
+        outputSchema,
+        outputSchema,
+        handlerId,
+        handler,
+        PhysicalOperatorWrapper::PipelineLocation::SCAN,
+        std::vector{buildWrapper});
+
+    return {.root = {probeWrapper}, .leafs = {buildWrapper}};
+}
+
+std::unique_ptr<AbstractRewriteRule>
+RewriteRuleGeneratedRegistrar::RegisterEventTimeSortRewriteRule(RewriteRuleRegistryArguments argument) /// NOLINT
+{
+    return std::make_unique<LowerToPhysicalEventTimeSort>(argument.conf);
+}
+
+}
@@ -14,8 +14,11 @@
 #include <RewriteRules/LowerToPhysical/LowerToPhysicalHashJoin.hpp>
 
 #include <algorithm>
+#include <bit>
+#include <chrono>
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <ranges>
 #include <string>
 #include <tuple>
@@ -39,7 +42,7 @@
 #include <Join/HashJoin/HJProbePhysicalOperator.hpp>
 #include <Join/StreamJoinUtil.hpp>
 #include <Nautilus/Interface/BufferRef/TupleBufferRef.hpp>
-#include <Nautilus/Interface/Hash/MurMur3HashFunction.hpp>
+#include <Nautilus/Interface/Hash/HashFunction.hpp>
 #include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedEntryMemoryProvider.hpp>
 #include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMap.hpp>
 #include <Nautilus/Interface/PagedVector/PagedVector.hpp>
@@ -47,7 +50,7 @@
 #include <Operators/Windows/JoinLogicalOperator.hpp>
 #include <RewriteRules/AbstractRewriteRule.hpp>
 #include <Runtime/Execution/OperatorHandler.hpp>
-#include <SliceStore/DefaultTimeBasedSliceStore.hpp>
+#include <SliceStore/WindowSlicesStoreInterface.hpp>
 #include <Traits/OutputOriginIdsTrait.hpp>
 #include <Traits/TraitSet.hpp>
 #include <Util/Common.hpp>
@@ -200,13 +203,13 @@ createHashMapOptions(std::vector<FieldNamesExtension>& joinFieldExtensions, Sche
             const bool fieldReplaceSuccess = inputSchema.replaceTypeOfField(fieldExtension.newName, fieldExtension.newDataType);
             INVARIANT(fieldReplaceSuccess, "Expect to change the type of {} for {}", fieldExtension.newName, inputSchema);
         }
-        keySize += fieldExtension.newDataType.getSizeInBytes();
+        keySize += Interface::BufferRef::ChainedEntryMemoryProvider::getFieldSizeInBytes(fieldExtension.newDataType);
         keyFunctions.emplace_back(QueryCompilation::FunctionProvider::lowerFunction(fieldAccessKey));
         fieldKeyNames.emplace_back(fieldExtension.newName);
     }
 
     const auto pageSize = conf.pageSize.getValue();
-    const auto numberOfBuckets = conf.numberOfPartitions.getValue();
+    const auto numberOfBuckets = conf.maxNumberOfBuckets.getValue();
     const auto entrySize = sizeof(Nautilus::Interface::ChainedHashMapEntry) + keySize + valueSize;
     const auto entriesPerPage = pageSize / entrySize;
 
@@ -214,7 +217,7 @@ createHashMapOptions(std::vector<FieldNamesExtension>& joinFieldExtensions, Sche
     const auto& [fieldKeys, fieldValues]
         = Interface::BufferRef::ChainedEntryMemoryProvider::createFieldOffsets(inputSchema, fieldKeyNames, {});
     HashMapOptions hashMapOptions{
-        std::make_unique<Nautilus::Interface::MurMur3HashFunction>(),
+        Nautilus::Interface::HashFunction::create(conf.hashFunction.getValue()),
         std::move(keyFunctions),
         fieldKeys,
         fieldValues,
@@ -223,7 +226,8 @@ createHashMapOptions(std::vector<FieldNamesExtension>& joinFieldExtensions, Sche
         keySize,
         valueSize,
         pageSize,
-        numberOfBuckets};
+        numberOfBuckets,
+        conf.hashMapType.getValue()};
     return hashMapOptions;
 }
 }
@@ -271,12 +275,51 @@ RewriteRuleResultSubgraph LowerToPhysicalHashJoin::apply(LogicalOperator logical
     auto leftHashMapOptions = createHashMapOptions(leftJoinFields, newLeftInputSchema, conf);
     auto rightHashMapOptions = createHashMapOptions(rightJoinFields, newRightInputSchema, conf);
 
-    /// Creating the left and right hash join build operator
+    /// Creating the left and right hash join build operator. Both sides have to radix-partition their tuples into the same partitions.
+    const auto numberOfPartitions = std::clamp(
+        std::bit_ceil(static_cast<uint64_t>(conf.numberOfPartitions.getValue())),
+        uint64_t{1},
+        HJBuildPhysicalOperator::MAX_NUMBER_OF_PARTITIONS);
     auto handlerId = getNextOperatorHandlerId();
+
+    /// Solely for tumbling windows, each slice is a window. Thus, the builds can join a record with all records of its slice.
+    const auto symmetric = conf.symmetricHashJoin.getValue() and windowType->getSize().getTime() == windowType->getSlide().getTime();
+    /// Solely for sliding windows, a pair of slices belongs to more than one window
+    const auto shareSlicePairs
+        = conf.sharedSlidingWindowHashJoin.getValue() and windowType->getSize().getTime() > windowType->getSlide().getTime();
+    std::optional<SymmetricHashJoinOptions> leftSymmetricOptions;
+    std::optional<SymmetricHashJoinOptions> rightSymmetricOptions;
+    std::shared_ptr<Interface::BufferRef::TupleBufferRef> joinedBufferRef;
+    if (symmetric)
+    {
+        joinedBufferRef = Interface::BufferRef::TupleBufferRef::create(conf.operatorBufferSize.getValue(), outputSchema);
+        leftSymmetricOptions = SymmetricHashJoinOptions{
+            .otherSideHashMapOptions = rightHashMapOptions,
+            .otherSideBufferRef = rightBufferRef,
+            .joinedBufferRef = joinedBufferRef,
+            .windowMetaData = join->getWindowMetaData()};
+        rightSymmetricOptions = SymmetricHashJoinOptions{
+            .otherSideHashMapOptions = leftHashMapOptions,
+            .otherSideBufferRef = leftBufferRef,
+            .joinedBufferRef = joinedBufferRef,
+            .windowMetaData = join->getWindowMetaData()};
+    }
     const HJBuildPhysicalOperator leftBuildOperator{
-        handlerId, JoinBuildSideType::Left, timeStampFieldLeft.toTimeFunction(), leftBufferRef, leftHashMapOptions};
+        handlerId,
+        JoinBuildSideType::Left,
+        timeStampFieldLeft.toTimeFunction(),
+        leftBufferRef,
+        leftHashMapOptions,
+        numberOfPartitions,
+        leftSymmetricOptions};
     const HJBuildPhysicalOperator rightBuildOperator{
-        handlerId, JoinBuildSideType::Right, timeStampFieldRight.toTimeFunction(), rightBufferRef, rightHashMapOptions};
+        handlerId,
+        JoinBuildSideType::Right,
+        timeStampFieldRight.toTimeFunction(),
+        rightBufferRef,
+        rightHashMapOptions,
+        numberOfPartitions,
+        rightSymmetricOptions};
 
     /// Creating the hash join probe
     auto joinSchema = JoinSchema(newLeftInputSchema, newRightInputSchema, outputSchema);
@@ -288,14 +331,25 @@ RewriteRuleResultSubgraph LowerToPhysicalHashJoin::apply(LogicalOperator logical
         leftBufferRef,
         rightBufferRef,
         leftHashMapOptions,
-        rightHashMapOptions);
+        rightHashMapOptions,
+        false,
+        joinedBufferRef);
 
 
     /// Creating the hash join operator handler
-    auto sliceAndWindowStore
-        = std::make_unique<DefaultTimeBasedSliceStore>(windowType->getSize().getTime(), windowType->getSlide().getTime());
-    auto handler
-        = std::make_shared<HJOperatorHandler>(inputOriginIds, outputOriginId, std::move(sliceAndWindowStore), conf.maxNumberOfBuckets);
+    auto sliceAndWindowStore = WindowSlicesStoreInterface::create(
+        conf.sliceStoreType.getValue(), windowType->getSize().getTime(), windowType->getSlide().getTime());
+    auto handler = std::make_shared<HJOperatorHandler>(
+        inputOriginIds,
+        outputOriginId,
+        std::move(sliceAndWindowStore),
+        conf.maxNumberOfBuckets,
+        conf.hashJoinBloomFilter.getValue(),
+        symmetric,
+        std::max<uint64_t>(1, conf.hashJoinSkewedProbeTasks.getValue()),
+        shareSlicePairs);
+    handler->setIdleOriginTimeout(std::chrono::milliseconds(conf.idleOriginTimeout.getValue()));
+    handler->setAllowedLateness(conf.allowedLateness.getValue());
 
 
     /// Building operator wrapper for the two builds and the probe.
@@ -0,0 +1,119 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <RewriteRules/LowerToPhysical/LowerToPhysicalLookupJoin.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <Functions/FieldAccessLogicalFunction.hpp>
+#include <Functions/FunctionProvider.hpp>
+#include <Join/LookupJoin/AsyncLookupJoinOperatorHandler.hpp>
+#include <Join/LookupJoin/AsyncLookupJoinPhysicalOperator.hpp>
+#include <Join/LookupJoin/LookupJoinOperatorHandler.hpp>
+#include <Join/LookupJoin/LookupJoinPhysicalOperator.hpp>
+#include <Nautilus/Interface/BufferRef/TupleBufferRef.hpp>
+#include <Operators/LogicalOperator.hpp>
+#include <Operators/LookupJoinLogicalOperator.hpp>
+#include <RewriteRules/AbstractRewriteRule.hpp>
+#include <Runtime/Execution/OperatorHandler.hpp>
+#include <ErrorHandling.hpp>
+#include <PhysicalOperator.hpp>
+#include <RewriteRuleRegistry.hpp>
+
+namespace NES
+{
+
+RewriteRuleResultSubgraph LowerToPhysicalLookupJoin::apply(LogicalOperator logicalOperator)
+{
+    PRECONDITION(logicalOperator.tryGetAs<LookupJoinLogicalOperator>(), "Expected a LookupJoinLogicalOperator");
+    const auto lookupJoin = logicalOperator.getAs<LookupJoinLogicalOperator>();
+    const auto& tableKey = lookupJoin->getTableKey();
+    if (const auto& externalTable = lookupJoin->getExternalTable(); externalTable.has_value())
+    {
+        return lowerExternalTable(logicalOperator, externalTable.value());
+    }
+
+    const auto handlerId = getNextOperatorHandlerId();
+    const auto handler = std::make_shared<LookupJoinOperatorHandler>(
+        lookupJoin->getTableFilePath(),
+        lookupJoin->getTableSchema(),
+        tableKey.name,
+        std::chrono::milliseconds(lookupJoin->getReloadIntervalMs()));
+    auto physicalOperator = LookupJoinPhysicalOperator(
+        handlerId,
+        QueryCompilation::FunctionProvider::lowerFunction(lookupJoin->getStreamKey()),
+        tableKey.dataType,
+        lookupJoin->getTableSchema());
+    auto wrapper = std::make_shared<PhysicalOperatorWrapper>(
+        physicalOperator,
+        logicalOperator.getInputSchemas()[0],
+        logicalOperator.getOutputSchema(),
+        handlerId,
+        handler,
+        PhysicalOperatorWrapper::PipelineLocation::INTERMEDIATE);
+
+    /// Creates a physical leaf for each logical leaf. Required, as this operator can have any number of sources.
+    std::vector leafes(logicalOperator.getChildren().size(), wrapper);
+    return {.root = wrapper, .leafs = {leafes}};
+}
+
+RewriteRuleResultSubgraph LowerToPhysicalLookupJoin::lowerExternalTable(
+    const LogicalOperator& logicalOperator, const LookupJoinLogicalOperator::ExternalTable& externalTable)
+{
+    const auto lookupJoin = logicalOperator.getAs<LookupJoinLogicalOperator>();
+    const auto& tableKey = lookupJoin->getTableKey();
+    const auto inputSchema = logicalOperator.getInputSchemas()[0];
+
+    /// The join scans the buffers of the preceding pipeline, thus it has to use the same buffer size and memory layout as its emit
+    const auto bufferSize = conf.operatorBufferSize.getValue();
+    auto scanSchema = inputSchema;
+    scanSchema.memoryLayoutType = operatorMemoryLayout;
+    auto scanBufferRef = Interface::BufferRef::TupleBufferRef::create(bufferSize, scanSchema);
+
+    /// A buffer waits until the rows of all its keys are cached, thus the cache must hold the keys of at least one buffer
+    const auto keysPerBuffer = bufferSize / std::max<uint64_t>(inputSchema.getSizeOfSchemaInBytes(), 1);
+    const auto cacheSize = std::max<uint64_t>(externalTable.cacheSize, keysPerBuffer);
+
+    const auto handlerId = getNextOperatorHandlerId();
+    const auto handler = std::make_shared<AsyncLookupJoinOperatorHandler>(
+        externalTable.url, cacheSize, externalTable.maxInFlight, lookupJoin->getTableSchema(), tableKey.name);
+    const auto streamKey = lookupJoin->getStreamKey();
+    auto physicalOperator = AsyncLookupJoinPhysicalOperator(
+        handlerId,
+        std::move(scanBufferRef),
+        QueryCompilation::FunctionProvider::lowerFunction(streamKey),
+        streamKey.get<FieldAccessLogicalFunction>().getFieldName(),
+        tableKey.dataType,
+        lookupJoin->getTableSchema());
+    auto wrapper = std::make_shared<PhysicalOperatorWrapper>(
+        physicalOperator,
+        inputSchema,
+        logicalOperator.getOutputSchema(),
+        handlerId,
+        handler,
+        PhysicalOperatorWrapper::PipelineLocation::SCAN);
+
+    std::vector leafes(logicalOperator.getChildren().size(), wrapper);
+    return {.root = wrapper, .leafs = {leafes}};
+}
+
+std::unique_ptr<AbstractRewriteRule>
+RewriteRuleGeneratedRegistrar::RegisterLookupJoinRewriteRule(RewriteRuleRegistryArguments argument) /// NOLINT
+{
+    return std::make_unique<LowerToPhysicalLookupJoin>(argument.conf, argument.operatorMemoryLayout);
+}
+}
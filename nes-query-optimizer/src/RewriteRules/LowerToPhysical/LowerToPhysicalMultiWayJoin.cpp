@@ -0,0 +1,169 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <RewriteRules/LowerToPhysical/LowerToPhysicalMultiWayJoin.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Functions/FieldAccessLogicalFunction.hpp>
+#include <Functions/FunctionProvider.hpp>
+#include <Functions/PhysicalFunction.hpp>
+#include <Identifiers/Identifiers.hpp>
+#include <Join/HashJoin/MultiWayHJBuildPhysicalOperator.hpp>
+#include <Join/HashJoin/MultiWayHJOperatorHandler.hpp>
+#include <Join/HashJoin/MultiWayHJProbePhysicalOperator.hpp>
+#include <Nautilus/Interface/BufferRef/TupleBufferRef.hpp>
+#include <Nautilus/Interface/Hash/HashFunction.hpp>
+#include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedEntryMemoryProvider.hpp>
+#include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMap.hpp>
+#include <Nautilus/Interface/PagedVector/PagedVector.hpp>
+#include <Operators/LogicalOperator.hpp>
+#include <Operators/Windows/MultiWayJoinLogicalOperator.hpp>
+#include <RewriteRules/AbstractRewriteRule.hpp>
+#include <Runtime/Execution/OperatorHandler.hpp>
+#include <SliceStore/WindowSlicesStoreInterface.hpp>
+#include <Traits/OutputOriginIdsTrait.hpp>
+#include <Traits/TraitSet.hpp>
+#include <Util/Common.hpp>
+#include <Watermark/TimestampField.hpp>
+#include <WindowTypes/Types/TimeBasedWindowType.hpp>
+#include <ErrorHandling.hpp>
+#include <HashMapOptions.hpp>
+#include <PhysicalOperator.hpp>
+#include <RewriteRuleRegistry.hpp>
+
+namespace NES
+{
+
+namespace
+{
+/// Creates the options of a hash map with the join field as its single key and a paged vector of the records of the key as its value.
+/// As all inputs use the same key layout, the probe can look up the key of an entry of one input in the hash maps of all other inputs.
+HashMapOptions createHashMapOptions(const FieldAccessLogicalFunction& joinField, Schema& inputSchema, const QueryExecutionConfiguration& conf)
+{
+    constexpr auto valueSize = sizeof(Nautilus::Interface::PagedVector);
+    auto keyDataType = joinField.getDataType();
+    if (keyDataType.isType(DataType::Type::VARSIZED))
+    {
+        keyDataType.type = DataType::Type::VARSIZED_POINTER_REP;
+        const bool fieldReplaceSuccess = inputSchema.replaceTypeOfField(joinField.getFieldName(), keyDataType);
+        INVARIANT(fieldReplaceSuccess, "Expect to change the type of {} for {}", joinField.getFieldName(), inputSchema);
+    }
+    const FieldAccessLogicalFunction fieldAccessKey{keyDataType, joinField.getFieldName()};
+    const auto keySize = Interface::BufferRef::ChainedEntryMemoryProvider::getFieldSizeInBytes(keyDataType);
+
+    const auto pageSize = conf.pageSize.getValue();
+    const auto entrySize = sizeof(Nautilus::Interface::ChainedHashMapEntry) + keySize + valueSize;
+    const auto& [fieldKeys, fieldValues]
+        = Interface::BufferRef::ChainedEntryMemoryProvider::createFieldOffsets(inputSchema, {joinField.getFieldName()}, {});
+    return HashMapOptions{
+        Nautilus::Interface::HashFunction::create(conf.hashFunction.getValue()),
+        {QueryCompilation::FunctionProvider::lowerFunction(fieldAccessKey)},
+        fieldKeys,
+        fieldValues,
+        pageSize / entrySize,
+        entrySize,
+        keySize,
+        valueSize,
+        pageSize,
+        conf.maxNumberOfBuckets.getValue(),
+        conf.hashMapType.getValue()};
+}
+}
+
+RewriteRuleResultSubgraph LowerToPhysicalMultiWayJoin::apply(LogicalOperator logicalOperator)
+{
+    PRECONDITION(logicalOperator.tryGetAs<MultiWayJoinLogicalOperator>(), "Expected a MultiWayJoinLogicalOperator");
+    auto outputOriginIdsOpt = getTrait<OutputOriginIdsTrait>(logicalOperator.getTraitSet());
+    PRECONDITION(outputOriginIdsOpt.has_value(), "Expected the outputOriginIds trait to be set");
+    PRECONDITION(std::ranges::size(outputOriginIdsOpt.value()) == 1, "Expected one output origin id");
+
+    const auto multiWayJoin = logicalOperator.getAs<MultiWayJoinLogicalOperator>();
+    const auto numberOfInputs = multiWayJoin->getChildren().size();
+    PRECONDITION(
+        numberOfInputs >= 2 and multiWayJoin->getInputSchemas().size() == numberOfInputs,
+        "Expected an input schema for each of at least two children");
+
+    const auto outputSchema = multiWayJoin->getOutputSchema();
+    const auto outputOriginId = outputOriginIdsOpt.value()[0];
+    const auto windowType = NES::Util::as<Windowing::TimeBasedWindowType>(multiWayJoin->getWindowType());
+    const auto timestampFields = TimestampField::getTimestampsOfInputs(multiWayJoin->getInputSchemas(), windowType);
+    const auto inputOriginIds
+        = multiWayJoin->getChildren()
+        | std::views::transform(
+              [](const auto& child)
+              {
+                  auto childOutputOriginIds = getTrait<OutputOriginIdsTrait>(child.getTraitSet());
+                  PRECONDITION(childOutputOriginIds.has_value(), "Expected the outputOriginIds trait of the child to be set");
+                  return childOutputOriginIds.value();
+              })
+        | std::views::join | std::ranges::to<std::vector<OriginId>>();
+
+    /// Creating the multi-way hash join operator handler
+    auto handlerId = getNextOperatorHandlerId();
+    auto sliceAndWindowStore = WindowSlicesStoreInterface::create(
+        conf.sliceStoreType.getValue(), windowType->getSize().getTime(), windowType->getSlide().getTime());
+    auto handler = std::make_shared<MultiWayHJOperatorHandler>(
+        inputOriginIds, outputOriginId, std::move(sliceAndWindowStore), numberOfInputs, conf.maxNumberOfBuckets.getValue());
+    handler->setIdleOriginTimeout(std::chrono::milliseconds(conf.idleOriginTimeout.getValue()));
+    handler->setAllowedLateness(conf.allowedLateness.getValue());
+
+    /// Creating one build per input, which stores the records of its input in the hash maps of the same key layout
+    std::vector<std::shared_ptr<Interface::BufferRef::TupleBufferRef>> bufferRefs;
+    std::vector<HashMapOptions> hashMapOptions;
+    std::vector<std::shared_ptr<PhysicalOperatorWrapper>> buildWrappers;
+    for (uint64_t input = 0; input < numberOfInputs; ++input)
+    {
+        auto inputSchema = multiWayJoin->getInputSchemas()[input];
+        const auto& joinField = multiWayJoin->getJoinFields()[input].get<FieldAccessLogicalFunction>();
+        auto inputHashMapOptions = createHashMapOptions(joinField, inputSchema, conf);
+        auto bufferRef = Interface::BufferRef::TupleBufferRef::create(
+            conf.numberOfRecordsPerKey.getValue() * inputSchema.getSizeOfSchemaInBytes(), inputSchema);
+
+        const MultiWayHJBuildPhysicalOperator buildOperator{
+            handlerId, input, timestampFields[input].toTimeFunction(), bufferRef, inputHashMapOptions};
+        buildWrappers.emplace_back(std::make_shared<PhysicalOperatorWrapper>(
+            buildOperator, inputSchema, outputSchema, handlerId, handler, PhysicalOperatorWrapper::PipelineLocation::EMIT));
+        bufferRefs.emplace_back(std::move(bufferRef));
+        hashMapOptions.emplace_back(std::move(inputHashMapOptions));
+    }
+
+    /// Creating the single probe over the hash maps of all inputs
+    auto probeOperator
+        = MultiWayHJProbePhysicalOperator(handlerId, multiWayJoin->getWindowMetaData(), std::move(bufferRefs), std::move(hashMapOptions));
+    auto probeWrapper = std::make_shared<PhysicalOperatorWrapper>(
+        std::move(probeOperator),
+        outputSchema,
+        outputSchema,
+        handlerId,
+        handler,
+        PhysicalOperatorWrapper::PipelineLocation::SCAN,
+        buildWrappers);
+
+    return {.root = {probeWrapper}, .leafs = buildWrappers};
+};
+
+std::unique_ptr<AbstractRewriteRule>
+RewriteRuleGeneratedRegistrar::RegisterMultiWayJoinRewriteRule(RewriteRuleRegistryArguments argument) /// NOLINT
+{
+    return std::make_unique<LowerToPhysicalMultiWayJoin>(argument.conf);
+}
+}
@@ -14,6 +14,8 @@
 
 #include <RewriteRules/LowerToPhysical/LowerToPhysicalNLJoin.hpp>
 
+#include <chrono>
+#include <filesystem>
 #include <memory>
 #include <ranges>
 #include <string>
@@ -38,7 +40,7 @@
 #include <Operators/Windows/JoinLogicalOperator.hpp>
 #include <RewriteRules/AbstractRewriteRule.hpp>
 #include <Runtime/Execution/OperatorHandler.hpp>
-#include <SliceStore/DefaultTimeBasedSliceStore.hpp>
+#include <SliceStore/WindowSlicesStoreInterface.hpp>
 #include <Traits/OutputOriginIdsTrait.hpp>
 #include <Traits/TraitSet.hpp>
 #include <Util/Common.hpp>
@@ -47,6 +49,7 @@
 #include <Watermark/TimestampField.hpp>
 #include <WindowTypes/Measures/TimeCharacteristic.hpp>
 #include <WindowTypes/Types/TimeBasedWindowType.hpp>
+#include <fmt/format.h>
 #include <ErrorHandling.hpp>
 #include <PhysicalOperator.hpp>
 #include <RewriteRuleRegistry.hpp>
@@ -97,10 +100,13 @@ RewriteRuleResultSubgraph LowerToPhysicalNLJoin::apply(LogicalOperator logicalOp
         | std::views::join | std::ranges::to<std::vector<OriginId>>();
 
     auto joinFunction = QueryCompilation::FunctionProvider::lowerFunction(logicalJoinFunction);
+    /// The paged vectors are solely read by the probe of this join, thus their tuples start with the join fields that the probe compares
     auto leftBufferRef = TupleBufferRef::create(pageSize, leftInputSchema);
     leftBufferRef->getMemoryLayout()->setKeyFieldNames(getJoinFieldNames(leftInputSchema, logicalJoinFunction));
+    leftBufferRef->getMemoryLayout()->optimizeFieldPlacement(leftBufferRef->getMemoryLayout()->getKeyFieldNames());
     auto rightBufferRef = TupleBufferRef::create(pageSize, rightInputSchema);
     rightBufferRef->getMemoryLayout()->setKeyFieldNames(getJoinFieldNames(rightInputSchema, logicalJoinFunction));
+    rightBufferRef->getMemoryLayout()->optimizeFieldPlacement(rightBufferRef->getMemoryLayout()->getKeyFieldNames());
 
     auto [timeStampFieldLeft, timeStampFieldRight] = TimestampField::getTimestampLeftAndRight(*join, windowType);
 
@@ -114,9 +120,22 @@ RewriteRuleResultSubgraph LowerToPhysicalNLJoin::apply(LogicalOperator logicalOp
     auto probeOperator
         = NLJProbePhysicalOperator(handlerId, joinFunction, join->getWindowMetaData(), joinSchema, leftBufferRef, rightBufferRef);
 
-    auto sliceAndWindowStore
-        = std::make_unique<DefaultTimeBasedSliceStore>(windowType->getSize().getTime(), windowType->getSlide().getTime());
+    /// The id of the logical join is part of the serialized query plan, thus the join finds its checkpoint when the plan is submitted again
+    std::filesystem::path checkpointDirectory;
+    if (not conf.checkpointDirectory.getValue().empty())
+    {
+        checkpointDirectory = std::filesystem::path(conf.checkpointDirectory.getValue()) / fmt::format("join_{}", join.getId());
+    }
+    auto sliceAndWindowStore = WindowSlicesStoreInterface::create(
+        conf.sliceStoreType.getValue(),
+        windowType->getSize().getTime(),
+        windowType->getSlide().getTime(),
+        conf.sliceStoreMemoryBudget.getValue(),
+        conf.spillDirectory.getValue(),
+        checkpointDirectory);
     auto handler = std::make_shared<NLJOperatorHandler>(inputOriginIds, outputOriginId, std::move(sliceAndWindowStore));
+    handler->setIdleOriginTimeout(std::chrono::milliseconds(conf.idleOriginTimeout.getValue()));
+    handler->setAllowedLateness(conf.allowedLateness.getValue());
 
     auto leftBuildWrapper = std::make_shared<PhysicalOperatorWrapper>(
         std::move(leftBuildOperator), leftInputSchema, outputSchema, handlerId, handler, PhysicalOperatorWrapper::PipelineLocation::EMIT);
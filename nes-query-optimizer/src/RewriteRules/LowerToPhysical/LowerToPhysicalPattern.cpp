@@ -0,0 +1,117 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <RewriteRules/LowerToPhysical/LowerToPhysicalPattern.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <Functions/FieldAccessLogicalFunction.hpp>
+#include <Functions/FieldAccessPhysicalFunction.hpp>
+#include <Functions/FunctionProvider.hpp>
+#include <Functions/PhysicalFunction.hpp>
+#include <Operators/LogicalOperator.hpp>
+#include <Operators/PatternLogicalOperator.hpp>
+#include <Pattern/PatternMatcher.hpp>
+#include <Pattern/PatternOperatorHandler.hpp>
+#include <Pattern/PatternPhysicalOperator.hpp>
+#include <RewriteRules/AbstractRewriteRule.hpp>
+#include <Runtime/Execution/OperatorHandler.hpp>
+#include <Watermark/TimeFunction.hpp>
+#include <ErrorHandling.hpp>
+#include <PhysicalOperator.hpp>
+#include <RewriteRuleRegistry.hpp>
+
+namespace NES
+{
+
+namespace
+{
+PatternMatcher::Step lowerStep(const PatternLogicalOperator::Step& step)
+{
+    PatternMatcher::Step loweredStep;
+    for (const auto event : step.events)
+    {
+        loweredStep.events |= uint64_t{1} << event;
+    }
+    switch (step.type)
+    {
+        case PatternLogicalOperator::Step::Type::EVENT:
+        case PatternLogicalOperator::Step::Type::OR:
+            loweredStep.type = PatternMatcher::Step::Type::ANY;
+            break;
+        case PatternLogicalOperator::Step::Type::AND:
+            loweredStep.type = PatternMatcher::Step::Type::ALL;
+            break;
+        case PatternLogicalOperator::Step::Type::ITERATION:
+            loweredStep.type = PatternMatcher::Step::Type::ITERATION;
+            loweredStep.minimumRepetitions = step.minimumRepetitions;
+            loweredStep.maximumRepetitions = step.maximumRepetitions;
+            break;
+    }
+    return loweredStep;
+}
+}
+
+RewriteRuleResultSubgraph LowerToPhysicalPattern::apply(LogicalOperator logicalOperator)
+{
+    PRECONDITION(logicalOperator.tryGetAs<PatternLogicalOperator>(), "Expected a PatternLogicalOperator");
+    const auto pattern = logicalOperator.getAs<PatternLogicalOperator>();
+
+    std::vector<PatternMatcher::Step> steps;
+    for (const auto& step : pattern->getSteps())
+    {
+        steps.push_back(lowerStep(step));
+    }
+    std::vector<PhysicalFunction> eventPredicates;
+    for (const auto& predicate : pattern->getEventPredicates())
+    {
+        eventPredicates.push_back(QueryCompilation::FunctionProvider::lowerFunction(predicate));
+    }
+    std::vector<PatternPhysicalOperator::PartitionKey> partitionKeys;
+    for (const auto& key : pattern->getPartitionKeys())
+    {
+        partitionKeys.push_back({.fieldName = key.getFieldName(), .dataType = key.getDataType()});
+    }
+    const auto timestampFieldName = pattern->getOnField().get<FieldAccessLogicalFunction>().getFieldName();
+
+    const auto handlerId = getNextOperatorHandlerId();
+    const auto handler = std::make_shared<PatternOperatorHandler>(std::move(steps), pattern->getWithinMs());
+    auto physicalOperator = PatternPhysicalOperator(
+        handlerId,
+        std::move(eventPredicates),
+        std::move(partitionKeys),
+        EventTimeFunction(FieldAccessPhysicalFunction(timestampFieldName), pattern->getUnit()),
+        pattern->getStartFieldName(),
+        pattern->getEndFieldName());
+    auto wrapper = std::make_shared<PhysicalOperatorWrapper>(
+        physicalOperator,
+        logicalOperator.getInputSchemas()[0],
+        logicalOperator.getOutputSchema(),
+        handlerId,
+        handler,
+        PhysicalOperatorWrapper::PipelineLocation::INTERMEDIATE);
+
+    /// Creates a physical leaf for each logical leaf. Required, as this operator can have any number of sources.
+    std::vector leafes(logicalOperator.getChildren().size(), wrapper);
+    return {.root = wrapper, .leafs = {leafes}};
+}
+
+std::unique_ptr<AbstractRewriteRule>
+RewriteRuleGeneratedRegistrar::RegisterPatternRewriteRule(RewriteRuleRegistryArguments argument) /// NOLINT
+{
+    return std::make_unique<LowerToPhysicalPattern>(argument.conf);
+}
+}
@@ -14,13 +14,19 @@
 
 #include <RewriteRules/LowerToPhysical/LowerToPhysicalProjection.hpp>
 
+#include <algorithm>
 #include <memory>
 #include <optional>
 #include <ranges>
+#include <string>
+#include <utility>
 #include <vector>
+#include <DataTypes/Schema.hpp>
+#include <Functions/FieldAccessLogicalFunction.hpp>
 #include <Functions/FunctionProvider.hpp>
-#include <MemoryLayout/RowLayout.hpp>
-#include <Nautilus/Interface/BufferRef/RowTupleBufferRef.hpp>
+#include <Functions/LogicalFunction.hpp>
+#include <Iterators/BFSIterator.hpp>
+#include <Nautilus/Interface/BufferRef/TupleBufferRef.hpp>
 #include <Operators/LogicalOperator.hpp>
 #include <Operators/ProjectionLogicalOperator.hpp>
 #include <RewriteRules/AbstractRewriteRule.hpp>
@@ -33,28 +39,53 @@
 namespace NES
 {
 
+namespace
+{
+std::vector<std::string> getAccessedFieldNames(const LogicalFunction& function)
+{
+    return BFSRange(function)
+        | std::views::filter([](const LogicalFunction& child) { return child.tryGet<FieldAccessLogicalFunction>().has_value(); })
+        | std::views::transform([](const LogicalFunction& child) { return child.get<FieldAccessLogicalFunction>().getFieldName(); })
+        | std::ranges::to<std::vector>();
+}
+}
+
 RewriteRuleResultSubgraph LowerToPhysicalProjection::apply(LogicalOperator projectionLogicalOperator)
 {
     auto projection = projectionLogicalOperator.getAs<ProjectionLogicalOperator>();
     auto inputSchema = projectionLogicalOperator.getInputSchemas()[0];
     auto outputSchema = projectionLogicalOperator.getOutputSchema();
-    auto bufferSize = conf.pageSize.getValue();
-
-    auto scanLayout = std::make_shared<RowLayout>(bufferSize, inputSchema);
-    auto scanBufferRef = std::make_shared<Interface::BufferRef::RowTupleBufferRef>(scanLayout);
+    /// The scan reads the buffers of the preceding pipeline, thus it has to use the same buffer size and memory layout as its emit
+    auto bufferSize = conf.operatorBufferSize.getValue();
+    auto scanSchema = inputSchema;
+    scanSchema.memoryLayoutType = operatorMemoryLayout;
+    auto scanBufferRef = Interface::BufferRef::TupleBufferRef::create(bufferSize, scanSchema);
     auto accessedFields = projection->getAccessedFields();
     auto scan = ScanPhysicalOperator(scanBufferRef, accessedFields);
     auto scanWrapper = std::make_shared<PhysicalOperatorWrapper>(
         scan, outputSchema, outputSchema, std::nullopt, std::nullopt, PhysicalOperatorWrapper::PipelineLocation::SCAN);
 
     auto child = scanWrapper;
+    /// The maps write their results to the record, thus later maps read the results instead of recomputing equal sub-functions
+    std::vector<QueryCompilation::FunctionProvider::ComputedField> computedFields;
     for (const auto& [fieldName, function] : projection->getProjections())
     {
-        auto physicalFunction = QueryCompilation::FunctionProvider::lowerFunction(function);
-        auto physicalOperator = MapPhysicalOperator(
-            fieldName.transform([](const auto& identifier) { return identifier.getFieldName(); })
-                .value_or(function.explain(ExplainVerbosity::Short)),
-            physicalFunction);
+        auto physicalFunction = QueryCompilation::FunctionProvider::lowerFunction(function, computedFields);
+        auto outputFieldName = fieldName.transform([](const auto& identifier) { return identifier.getFieldName(); })
+                                   .value_or(function.explain(ExplainVerbosity::Short));
+        /// A later map reading the field would otherwise read the overwritten input field instead of the computed one
+        std::erase_if(
+            computedFields,
+            [&outputFieldName](const auto& computedField)
+            {
+                return computedField.second == outputFieldName
+                    or std::ranges::contains(getAccessedFieldNames(computedField.first), outputFieldName);
+            });
+        if (not function.getChildren().empty() and not std::ranges::contains(getAccessedFieldNames(function), outputFieldName))
+        {
+            computedFields.emplace_back(function, outputFieldName);
+        }
+        auto physicalOperator = MapPhysicalOperator(std::move(outputFieldName), physicalFunction);
         child = std::make_shared<PhysicalOperatorWrapper>(
             physicalOperator,
             outputSchema,
@@ -73,6 +104,6 @@ RewriteRuleResultSubgraph LowerToPhysicalProjection::apply(LogicalOperator proje
 std::unique_ptr<AbstractRewriteRule>
 RewriteRuleGeneratedRegistrar::RegisterProjectionRewriteRule(RewriteRuleRegistryArguments argument) /// NOLINT
 {
-    return std::make_unique<LowerToPhysicalProjection>(argument.conf);
+    return std::make_unique<LowerToPhysicalProjection>(argument.conf, argument.operatorMemoryLayout);
 }
 }
@@ -15,7 +15,13 @@
 #include <RewriteRules/LowerToPhysical/LowerToPhysicalSelection.hpp>
 
 #include <memory>
+#include <utility>
+#include <vector>
+#include <Functions/BooleanFunctions/AndLogicalFunction.hpp>
 #include <Functions/FunctionProvider.hpp>
+#include <Functions/LogicalFunction.hpp>
+#include <Functions/PhysicalFunction.hpp>
+#include <Functions/VectorizedPredicate.hpp>
 #include <Operators/LogicalOperator.hpp>
 #include <Operators/SelectionLogicalOperator.hpp>
 #include <RewriteRules/AbstractRewriteRule.hpp>
@@ -27,13 +33,39 @@
 namespace NES
 {
 
+namespace
+{
+/// Flattens nested conjunctions, thus the selection may reorder all of their conjuncts
+void lowerConjuncts(const LogicalFunction& function, std::vector<PhysicalFunction>& conjuncts)
+{
+    if (function.tryGet<AndLogicalFunction>())
+    {
+        for (const auto& child : function.getChildren())
+        {
+            lowerConjuncts(child, conjuncts);
+        }
+        return;
+    }
+    conjuncts.push_back(QueryCompilation::FunctionProvider::lowerFunction(function));
+}
+}
+
 RewriteRuleResultSubgraph LowerToPhysicalSelection::apply(LogicalOperator logicalOperator)
 {
     PRECONDITION(logicalOperator.tryGetAs<SelectionLogicalOperator>(), "Expected a SelectionLogicalOperator");
     auto selection = logicalOperator.getAs<SelectionLogicalOperator>();
     auto function = selection->getPredicate();
-    auto func = QueryCompilation::FunctionProvider::lowerFunction(function);
-    auto physicalOperator = SelectionPhysicalOperator(func);
+    std::vector<PhysicalFunction> conjuncts;
+    lowerConjuncts(function, conjuncts);
+    std::shared_ptr<const VectorizedPredicate> vectorizedPredicate;
+    if (conf.vectorizedSelection.getValue())
+    {
+        if (auto predicate = VectorizedPredicate::create(function))
+        {
+            vectorizedPredicate = std::make_shared<const VectorizedPredicate>(std::move(predicate.value()));
+        }
+    }
+    auto physicalOperator = SelectionPhysicalOperator(std::move(conjuncts), std::move(vectorizedPredicate));
     auto wrapper = std::make_shared<PhysicalOperatorWrapper>(
         physicalOperator,
         logicalOperator.getInputSchemas()[0],
@@ -40,7 +40,8 @@ RewriteRuleResultSubgraph LowerToPhysicalSource::apply(LogicalOperator logicalOp
         outputOriginIdsOpt.has_value() && std::ranges::size(outputOriginIdsOpt.value()) == 1,
         "SourceDescriptorLogicalOperator should have exactly one origin id, but has {}",
         std::ranges::size(*outputOriginIdsOpt));
-    auto physicalOperator = SourcePhysicalOperator(source->getSourceDescriptor(), outputOriginIdsOpt.value()[0]);
+    auto physicalOperator
+        = SourcePhysicalOperator(source->getSourceDescriptor(), outputOriginIdsOpt.value()[0], logicalOperator.getOutputSchema());
 
     const auto inputSchemas = logicalOperator.getInputSchemas();
     PRECONDITION(
@@ -0,0 +1,294 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <RewriteRules/LowerToPhysical/LowerToPhysicalSpatialHashJoin.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/DataTypeProvider.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Functions/BooleanFunctions/AndLogicalFunction.hpp>
+#include <Functions/CastToTypeLogicalFunction.hpp>
+#include <Functions/ConstantValueLogicalFunction.hpp>
+#include <Functions/FieldAccessLogicalFunction.hpp>
+#include <Functions/FunctionProvider.hpp>
+#include <Functions/LogicalFunction.hpp>
+#include <Functions/Meos/TemporalEDWithinGeometryLogicalFunction.hpp>
+#include <Functions/PhysicalFunction.hpp>
+#include <Identifiers/Identifiers.hpp>
+#include <Iterators/BFSIterator.hpp>
+#include <Join/HashJoin/HJOperatorHandler.hpp>
+#include <Join/HashJoin/HJProbePhysicalOperator.hpp>
+#include <Join/HashJoin/SpatialHJBuildPhysicalOperator.hpp>
+#include <Join/StreamJoinUtil.hpp>
+#include <Nautilus/Interface/BufferRef/TupleBufferRef.hpp>
+#include <Nautilus/Interface/Hash/HashFunction.hpp>
+#include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedEntryMemoryProvider.hpp>
+#include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMap.hpp>
+#include <Nautilus/Interface/PagedVector/PagedVector.hpp>
+#include <Operators/LogicalOperator.hpp>
+#include <Operators/Windows/JoinLogicalOperator.hpp>
+#include <RewriteRules/AbstractRewriteRule.hpp>
+#include <SliceStore/WindowSlicesStoreInterface.hpp>
+#include <Traits/OutputOriginIdsTrait.hpp>
+#include <Traits/TraitSet.hpp>
+#include <Util/Common.hpp>
+#include <Util/Strings.hpp>
+#include <Watermark/TimestampField.hpp>
+#include <WindowTypes/Types/TimeBasedWindowType.hpp>
+#include <ErrorHandling.hpp>
+#include <HashMapOptions.hpp>
+#include <PhysicalOperator.hpp>
+#include <RewriteRuleRegistry.hpp>
+
+namespace NES
+{
+
+namespace
+{
+bool isFieldOf(const LogicalFunction& function, const Schema& schema)
+{
+    const auto fieldAccess = function.tryGet<FieldAccessLogicalFunction>();
+    return fieldAccess.has_value() and schema.getFieldByName(fieldAccess->getFieldName()).has_value();
+}
+
+/// Adds a UINT64 field for the grid cell to the schema and creates the hash map options with the grid cell as the only key.
+/// We do not need key functions, as the build computes the cells itself.
+HashMapOptions createSpatialHashMapOptions(Schema& inputSchema, const std::string& cellFieldName, const QueryExecutionConfiguration& conf)
+{
+    const auto cellDataType = DataTypeProvider::provideDataType(DataType::Type::UINT64);
+    inputSchema.addField(cellFieldName, cellDataType);
+
+    const auto keySize = cellDataType.getSizeInBytes();
+    constexpr auto valueSize = sizeof(Nautilus::Interface::PagedVector);
+    const auto pageSize = conf.pageSize.getValue();
+    const auto numberOfBuckets = conf.maxNumberOfBuckets.getValue();
+    const auto entrySize = sizeof(Nautilus::Interface::ChainedHashMapEntry) + keySize + valueSize;
+    const auto entriesPerPage = pageSize / entrySize;
+
+    const auto& [fieldKeys, fieldValues]
+        = Interface::BufferRef::ChainedEntryMemoryProvider::createFieldOffsets(inputSchema, {cellFieldName}, {});
+    return HashMapOptions{
+        Nautilus::Interface::HashFunction::create(conf.hashFunction.getValue()),
+        {},
+        fieldKeys,
+        fieldValues,
+        entriesPerPage,
+        entrySize,
+        keySize,
+        valueSize,
+        pageSize,
+        numberOfBuckets,
+        conf.hashMapType.getValue()};
+}
+
+/// The probe solely reads these fields for evaluating the join function on the records that share a cell
+std::vector<std::string> getJoinFieldNames(const Schema& inputSchema, const LogicalFunction& joinFunction)
+{
+    return BFSRange(joinFunction)
+        | std::views::filter([](const auto& child) { return child.template tryGet<FieldAccessLogicalFunction>().has_value(); })
+        | std::views::transform([](const auto& child) { return child.template tryGet<FieldAccessLogicalFunction>()->getFieldName(); })
+        | std::views::filter([&](const auto& fieldName) { return inputSchema.contains(fieldName); })
+        | std::ranges::to<std::vector<std::string>>();
+}
+
+PhysicalFunction lowerCoordinate(const LogicalFunction& coordinate)
+{
+    return QueryCompilation::FunctionProvider::lowerFunction(
+        CastToTypeLogicalFunction(DataTypeProvider::provideDataType(DataType::Type::FLOAT64), coordinate));
+}
+}
+
+std::optional<SpatialJoinPredicate>
+getSpatialJoinPredicate(const LogicalFunction& joinFunction, const Schema& leftInputSchema, const Schema& rightInputSchema)
+{
+    /// All other conjuncts are evaluated by the probe for each candidate, thus, it is sufficient if one conjunct is a spatial join predicate
+    if (joinFunction.tryGet<AndLogicalFunction>().has_value())
+    {
+        for (const auto& child : joinFunction.getChildren())
+        {
+            if (auto spatialJoinPredicate = getSpatialJoinPredicate(child, leftInputSchema, rightInputSchema))
+            {
+                return spatialJoinPredicate;
+            }
+        }
+        return std::nullopt;
+    }
+
+    const auto parameters = joinFunction.getChildren();
+    if (not joinFunction.tryGet<TemporalEDWithinGeometryLogicalFunction>().has_value() or parameters.size() != 6)
+    {
+        return std::nullopt;
+    }
+
+    /// The distance determines the size of the grid cells, thus, it must be known before the query runs
+    const auto distanceConstant = parameters[5].tryGet<ConstantValueLogicalFunction>();
+    if (not distanceConstant.has_value())
+    {
+        return std::nullopt;
+    }
+    const auto distance = Util::from_chars<double>(distanceConstant->getConstantValue());
+    if (not distance.has_value() or not std::isfinite(*distance) or *distance <= 0)
+    {
+        return std::nullopt;
+    }
+
+    if (isFieldOf(parameters[0], leftInputSchema) and isFieldOf(parameters[1], leftInputSchema)
+        and isFieldOf(parameters[3], rightInputSchema) and isFieldOf(parameters[4], rightInputSchema))
+    {
+        return SpatialJoinPredicate{
+            .leftLon = parameters[0], .leftLat = parameters[1], .rightLon = parameters[3], .rightLat = parameters[4], .distance = *distance};
+    }
+    if (isFieldOf(parameters[0], rightInputSchema) and isFieldOf(parameters[1], rightInputSchema)
+        and isFieldOf(parameters[3], leftInputSchema) and isFieldOf(parameters[4], leftInputSchema))
+    {
+        return SpatialJoinPredicate{
+            .leftLon = parameters[3], .leftLat = parameters[4], .rightLon = parameters[0], .rightLat = parameters[1], .distance = *distance};
+    }
+    return std::nullopt;
+}
+
+RewriteRuleResultSubgraph LowerToPhysicalSpatialHashJoin::apply(LogicalOperator logicalOperator)
+{
+    PRECONDITION(logicalOperator.tryGetAs<JoinLogicalOperator>(), "Expected a JoinLogicalOperator");
+    PRECONDITION(std::ranges::size(logicalOperator.getChildren()) == 2, "Expected two children");
+    auto outputOriginIdsOpt = getTrait<OutputOriginIdsTrait>(logicalOperator.getTraitSet());
+    PRECONDITION(outputOriginIdsOpt.has_value(), "Expected the outputOriginIds trait to be set");
+    auto& outputOriginIds = outputOriginIdsOpt.value();
+    PRECONDITION(std::ranges::size(outputOriginIdsOpt.value()) == 1, "Expected one output origin id");
+    PRECONDITION(logicalOperator.getInputSchemas().size() == 2, "Expected two input schemas");
+
+    auto join = logicalOperator.getAs<JoinLogicalOperator>();
+
+    auto outputSchema = join.getOutputSchema();
+    auto outputOriginId = outputOriginIds[0];
+    auto logicalJoinFunction = join->getJoinFunction();
+    const auto spatialJoinPredicate = getSpatialJoinPredicate(logicalJoinFunction, join->getLeftSchema(), join->getRightSchema());
+    PRECONDITION(spatialJoinPredicate.has_value(), "Expected a spatial join predicate in the join function {}", logicalJoinFunction);
+    auto windowType = NES::Util::as<Windowing::TimeBasedWindowType>(join->getWindowType());
+    auto [timeStampFieldLeft, timeStampFieldRight] = TimestampField::getTimestampLeftAndRight(join.get(), windowType);
+    auto physicalJoinFunction = QueryCompilation::FunctionProvider::lowerFunction(logicalJoinFunction);
+    const auto inputOriginIds
+        = join.getChildren()
+        | std::views::transform(
+              [](const auto& child)
+              {
+                  auto childOutputOriginIds = getTrait<OutputOriginIdsTrait>(child.getTraitSet());
+                  PRECONDITION(childOutputOriginIds.has_value(), "Expected the outputOriginIds trait of the child to be set");
+                  return childOutputOriginIds.value();
+              })
+        | std::views::join | std::ranges::to<std::vector<OriginId>>();
+
+    /// Both sides store the grid cell of a record in an additional field, which is the key of the hash maps
+    auto leftInputSchema = join->getLeftSchema();
+    auto rightInputSchema = join->getRightSchema();
+    const auto leftCellFieldName = spatialJoinPredicate->leftLon.get<FieldAccessLogicalFunction>().getFieldName() + "_cell";
+    const auto rightCellFieldName = spatialJoinPredicate->rightLon.get<FieldAccessLogicalFunction>().getFieldName() + "_cell";
+    auto leftHashMapOptions = createSpatialHashMapOptions(leftInputSchema, leftCellFieldName, conf);
+    auto rightHashMapOptions = createSpatialHashMapOptions(rightInputSchema, rightCellFieldName, conf);
+    auto leftBufferRef = Interface::BufferRef::TupleBufferRef::create(
+        conf.numberOfRecordsPerKey.getValue() * leftInputSchema.getSizeOfSchemaInBytes(), leftInputSchema);
+    auto rightBufferRef = Interface::BufferRef::TupleBufferRef::create(
+        conf.numberOfRecordsPerKey.getValue() * rightInputSchema.getSizeOfSchemaInBytes(), rightInputSchema);
+    leftBufferRef->getMemoryLayout()->setKeyFieldNames(getJoinFieldNames(leftInputSchema, logicalJoinFunction));
+    rightBufferRef->getMemoryLayout()->setKeyFieldNames(getJoinFieldNames(rightInputSchema, logicalJoinFunction));
+
+    /// Creating the left and right spatial hash join build operator. Grid cells as large as the distance guarantee that all positions
+    /// within the distance lie in the same or in a neighbouring cell.
+    auto handlerId = getNextOperatorHandlerId();
+    const SpatialHJBuildPhysicalOperator leftBuildOperator{
+        handlerId,
+        JoinBuildSideType::Left,
+        timeStampFieldLeft.toTimeFunction(),
+        leftBufferRef,
+        leftHashMapOptions,
+        lowerCoordinate(spatialJoinPredicate->leftLon),
+        lowerCoordinate(spatialJoinPredicate->leftLat),
+        spatialJoinPredicate->distance};
+    const SpatialHJBuildPhysicalOperator rightBuildOperator{
+        handlerId,
+        JoinBuildSideType::Right,
+        timeStampFieldRight.toTimeFunction(),
+        rightBufferRef,
+        rightHashMapOptions,
+        lowerCoordinate(spatialJoinPredicate->rightLon),
+        lowerCoordinate(spatialJoinPredicate->rightLat),
+        spatialJoinPredicate->distance};
+
+    /// Creating the hash join probe, which evaluates the join function for all records that share a cell
+    auto joinSchema = JoinSchema(leftInputSchema, rightInputSchema, outputSchema);
+    auto probeOperator = HJProbePhysicalOperator(
+        handlerId,
+        physicalJoinFunction,
+        join->getWindowMetaData(),
+        joinSchema,
+        leftBufferRef,
+        rightBufferRef,
+        leftHashMapOptions,
+        rightHashMapOptions,
+        true);
+
+    /// Creating the hash join operator handler
+    auto sliceAndWindowStore = WindowSlicesStoreInterface::create(
+        conf.sliceStoreType.getValue(), windowType->getSize().getTime(), windowType->getSlide().getTime());
+    auto handler = std::make_shared<HJOperatorHandler>(
+        inputOriginIds, outputOriginId, std::move(sliceAndWindowStore), conf.maxNumberOfBuckets, conf.hashJoinBloomFilter.getValue());
+    handler->setIdleOriginTimeout(std::chrono::milliseconds(conf.idleOriginTimeout.getValue()));
+    handler->setAllowedLateness(conf.allowedLateness.getValue());
+
+    /// Building operator wrapper for the two builds and the probe. The builds receive the records of their children without the cell field.
+    auto leftBuildWrapper = std::make_shared<PhysicalOperatorWrapper>(
+        std::move(leftBuildOperator),
+        join->getLeftSchema(),
+        outputSchema,
+        handlerId,
+        handler,
+        PhysicalOperatorWrapper::PipelineLocation::EMIT);
+
+    auto rightBuildWrapper = std::make_shared<PhysicalOperatorWrapper>(
+        std::move(rightBuildOperator),
+        join->getRightSchema(),
+        outputSchema,
+        handlerId,
+        handler,
+        PhysicalOperatorWrapper::PipelineLocation::EMIT);
+
+    auto probeWrapper = std::make_shared<PhysicalOperatorWrapper>(
+        std::move(probeOperator),
+        outputSchema,
+        outputSchema,
+        handlerId,
+        handler,
+        PhysicalOperatorWrapper::PipelineLocation::SCAN,
+        std::vector{leftBuildWrapper, rightBuildWrapper});
+
+    return {.root = {probeWrapper}, .leafs = {leftBuildWrapper, rightBuildWrapper}};
+}
+
+std::unique_ptr<AbstractRewriteRule>
+RewriteRuleGeneratedRegistrar::RegisterSpatialHashJoinRewriteRule(RewriteRuleRegistryArguments argument) /// NOLINT
+{
+    return std::make_unique<LowerToPhysicalSpatialHashJoin>(argument.conf);
+}
+
+}
@@ -0,0 +1,258 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <RewriteRules/LowerToPhysical/LowerToPhysicalStBoxJoin.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/DataTypeProvider.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Functions/BooleanFunctions/AndLogicalFunction.hpp>
+#include <Functions/BooleanFunctions/EqualsLogicalFunction.hpp>
+#include <Functions/CastToTypeLogicalFunction.hpp>
+#include <Functions/ConstantValueLogicalFunction.hpp>
+#include <Functions/FieldAccessLogicalFunction.hpp>
+#include <Functions/FunctionProvider.hpp>
+#include <Functions/LogicalFunction.hpp>
+#include <Functions/Meos/TemporalAtStBoxLogicalFunction.hpp>
+#include <Functions/PhysicalFunction.hpp>
+#include <Identifiers/Identifiers.hpp>
+#include <Iterators/BFSIterator.hpp>
+#include <Join/NestedLoopJoin/NLJBuildPhysicalOperator.hpp>
+#include <Join/NestedLoopJoin/NLJOperatorHandler.hpp>
+#include <Join/NestedLoopJoin/StBoxJoinProbePhysicalOperator.hpp>
+#include <Join/StreamJoinUtil.hpp>
+#include <Nautilus/Interface/BufferRef/TupleBufferRef.hpp>
+#include <Operators/LogicalOperator.hpp>
+#include <Operators/Windows/JoinLogicalOperator.hpp>
+#include <RewriteRules/AbstractRewriteRule.hpp>
+#include <SliceStore/WindowSlicesStoreInterface.hpp>
+#include <Traits/OutputOriginIdsTrait.hpp>
+#include <Traits/TraitSet.hpp>
+#include <Util/Common.hpp>
+#include <Util/Strings.hpp>
+#include <Watermark/TimestampField.hpp>
+#include <WindowTypes/Types/TimeBasedWindowType.hpp>
+#include <ErrorHandling.hpp>
+#include <PhysicalOperator.hpp>
+#include <RewriteRuleRegistry.hpp>
+
+namespace NES
+{
+
+namespace
+{
+bool isFieldOf(const LogicalFunction& function, const Schema& schema)
+{
+    const auto fieldAccess = function.tryGet<FieldAccessLogicalFunction>();
+    return fieldAccess.has_value() and schema.getFieldByName(fieldAccess->getFieldName()).has_value();
+}
+
+bool isConstantOne(const LogicalFunction& function)
+{
+    const auto constant = function.tryGet<ConstantValueLogicalFunction>();
+    return constant.has_value() and Util::from_chars<int64_t>(constant->getConstantValue()) == 1;
+}
+
+/// Returns the TGEO_AT_STBOX of a comparison TGEO_AT_STBOX(...) = 1, as solely the points within the STBox satisfy it
+std::optional<LogicalFunction> getClippingFunction(const LogicalFunction& comparison)
+{
+    const auto children = comparison.getChildren();
+    if (not comparison.tryGet<EqualsLogicalFunction>().has_value() or children.size() != 2)
+    {
+        return std::nullopt;
+    }
+    for (const auto& [clipping, constant] : {std::pair{children[0], children[1]}, std::pair{children[1], children[0]}})
+    {
+        if (clipping.tryGet<TemporalAtStBoxLogicalFunction>().has_value() and isConstantOne(constant))
+        {
+            return clipping;
+        }
+    }
+    return std::nullopt;
+}
+
+/// The probe solely reads these fields for evaluating the join function on the points within the bounds of an STBox
+std::vector<std::string> getJoinFieldNames(const Schema& inputSchema, const LogicalFunction& joinFunction)
+{
+    return BFSRange(joinFunction)
+        | std::views::filter([](const auto& child) { return child.template tryGet<FieldAccessLogicalFunction>().has_value(); })
+        | std::views::transform([](const auto& child) { return child.template tryGet<FieldAccessLogicalFunction>()->getFieldName(); })
+        | std::views::filter([&](const auto& fieldName) { return inputSchema.contains(fieldName); })
+        | std::ranges::to<std::vector<std::string>>();
+}
+
+PhysicalFunction lowerCoordinate(const LogicalFunction& coordinate)
+{
+    return QueryCompilation::FunctionProvider::lowerFunction(
+        CastToTypeLogicalFunction(DataTypeProvider::provideDataType(DataType::Type::FLOAT64), coordinate));
+}
+}
+
+std::optional<StBoxJoinPredicate>
+getStBoxJoinPredicate(const LogicalFunction& joinFunction, const Schema& leftInputSchema, const Schema& rightInputSchema)
+{
+    /// All other conjuncts are evaluated by the probe for each candidate, thus, it is sufficient if one conjunct is an STBox join predicate
+    if (joinFunction.tryGet<AndLogicalFunction>().has_value())
+    {
+        for (const auto& child : joinFunction.getChildren())
+        {
+            if (auto stBoxJoinPredicate = getStBoxJoinPredicate(child, leftInputSchema, rightInputSchema))
+            {
+                return stBoxJoinPredicate;
+            }
+        }
+        return std::nullopt;
+    }
+
+    const auto clipping = getClippingFunction(joinFunction);
+    if (not clipping.has_value())
+    {
+        return std::nullopt;
+    }
+    const auto parameters = clipping->getChildren();
+    if (parameters.size() < 4)
+    {
+        return std::nullopt;
+    }
+
+    const auto isPointOf = [&](const Schema& schema)
+    { return isFieldOf(parameters[0], schema) and isFieldOf(parameters[1], schema) and isFieldOf(parameters[2], schema); };
+    if (isPointOf(leftInputSchema) and isFieldOf(parameters[3], rightInputSchema))
+    {
+        return StBoxJoinPredicate{
+            .pointSide = JoinBuildSideType::Left,
+            .lon = parameters[0],
+            .lat = parameters[1],
+            .timestamp = parameters[2],
+            .stbox = parameters[3]};
+    }
+    if (isPointOf(rightInputSchema) and isFieldOf(parameters[3], leftInputSchema))
+    {
+        return StBoxJoinPredicate{
+            .pointSide = JoinBuildSideType::Right,
+            .lon = parameters[0],
+            .lat = parameters[1],
+            .timestamp = parameters[2],
+            .stbox = parameters[3]};
+    }
+    return std::nullopt;
+}
+
+RewriteRuleResultSubgraph LowerToPhysicalStBoxJoin::apply(LogicalOperator logicalOperator)
+{
+    PRECONDITION(logicalOperator.tryGetAs<JoinLogicalOperator>(), "Expected a JoinLogicalOperator");
+    PRECONDITION(std::ranges::size(logicalOperator.getChildren()) == 2, "Expected two children");
+    auto outputOriginIdsOpt = getTrait<OutputOriginIdsTrait>(logicalOperator.getTraitSet());
+    PRECONDITION(outputOriginIdsOpt.has_value(), "Expected the outputOriginIds trait to be set");
+    auto& outputOriginIds = outputOriginIdsOpt.value();
+    PRECONDITION(std::ranges::size(outputOriginIdsOpt.value()) == 1, "Expected one output origin id");
+    PRECONDITION(logicalOperator.getInputSchemas().size() == 2, "Expected two input schemas");
+
+    auto join = logicalOperator.getAs<JoinLogicalOperator>();
+    auto handlerId = getNextOperatorHandlerId();
+
+    auto leftInputSchema = join->getLeftSchema();
+    auto rightInputSchema = join->getRightSchema();
+    auto outputSchema = join.getOutputSchema();
+    auto outputOriginId = outputOriginIds[0];
+    auto logicalJoinFunction = join->getJoinFunction();
+    auto windowType = NES::Util::as<Windowing::TimeBasedWindowType>(join->getWindowType());
+    const auto pageSize = conf.pageSize.getValue();
+    const auto stBoxJoinPredicate = getStBoxJoinPredicate(logicalJoinFunction, leftInputSchema, rightInputSchema);
+    PRECONDITION(stBoxJoinPredicate.has_value(), "Expected an STBox join predicate in the join function {}", logicalJoinFunction);
+
+    const auto inputOriginIds
+        = join.getChildren()
+        | std::views::transform(
+              [](const auto& child)
+              {
+                  auto childOutputOriginIds = getTrait<OutputOriginIdsTrait>(child.getTraitSet());
+                  PRECONDITION(childOutputOriginIds.has_value(), "Expected the outputOriginIds trait of the child to be set");
+                  return childOutputOriginIds.value();
+              })
+        | std::views::join | std::ranges::to<std::vector<OriginId>>();
+
+    /// The builds are the ones of the NLJ. The position and the STBox are join fields and thus, key fields of the paged vectors.
+    auto joinFunction = QueryCompilation::FunctionProvider::lowerFunction(logicalJoinFunction);
+    auto leftBufferRef = TupleBufferRef::create(pageSize, leftInputSchema);
+    leftBufferRef->getMemoryLayout()->setKeyFieldNames(getJoinFieldNames(leftInputSchema, logicalJoinFunction));
+    leftBufferRef->getMemoryLayout()->optimizeFieldPlacement(leftBufferRef->getMemoryLayout()->getKeyFieldNames());
+    auto rightBufferRef = TupleBufferRef::create(pageSize, rightInputSchema);
+    rightBufferRef->getMemoryLayout()->setKeyFieldNames(getJoinFieldNames(rightInputSchema, logicalJoinFunction));
+    rightBufferRef->getMemoryLayout()->optimizeFieldPlacement(rightBufferRef->getMemoryLayout()->getKeyFieldNames());
+
+    auto [timeStampFieldLeft, timeStampFieldRight] = TimestampField::getTimestampLeftAndRight(*join, windowType);
+    auto leftBuildOperator
+        = NLJBuildPhysicalOperator(handlerId, JoinBuildSideType::Left, timeStampFieldLeft.toTimeFunction(), leftBufferRef);
+    auto rightBuildOperator
+        = NLJBuildPhysicalOperator(handlerId, JoinBuildSideType::Right, timeStampFieldRight.toTimeFunction(), rightBufferRef);
+
+    auto joinSchema = JoinSchema(leftInputSchema, rightInputSchema, outputSchema);
+    auto probeOperator = StBoxJoinProbePhysicalOperator(
+        handlerId,
+        joinFunction,
+        join->getWindowMetaData(),
+        joinSchema,
+        leftBufferRef,
+        rightBufferRef,
+        stBoxJoinPredicate->pointSide,
+        lowerCoordinate(stBoxJoinPredicate->lon),
+        lowerCoordinate(stBoxJoinPredicate->lat),
+        QueryCompilation::FunctionProvider::lowerFunction(stBoxJoinPredicate->timestamp),
+        QueryCompilation::FunctionProvider::lowerFunction(stBoxJoinPredicate->stbox));
+
+    auto sliceAndWindowStore = WindowSlicesStoreInterface::create(
+        conf.sliceStoreType.getValue(),
+        windowType->getSize().getTime(),
+        windowType->getSlide().getTime(),
+        conf.sliceStoreMemoryBudget.getValue(),
+        conf.spillDirectory.getValue());
+    auto handler = std::make_shared<NLJOperatorHandler>(inputOriginIds, outputOriginId, std::move(sliceAndWindowStore));
+    handler->setIdleOriginTimeout(std::chrono::milliseconds(conf.idleOriginTimeout.getValue()));
+    handler->setAllowedLateness(conf.allowedLateness.getValue());
+
+    auto leftBuildWrapper = std::make_shared<PhysicalOperatorWrapper>(
+        std::move(leftBuildOperator), leftInputSchema, outputSchema, handlerId, handler, PhysicalOperatorWrapper::PipelineLocation::EMIT);
+
+    auto rightBuildWrapper = std::make_shared<PhysicalOperatorWrapper>(
+        std::move(rightBuildOperator), rightInputSchema, outputSchema, handlerId, handler, PhysicalOperatorWrapper::PipelineLocation::EMIT);
+
+    auto probeWrapper = std::make_shared<PhysicalOperatorWrapper>(
+        std::move(probeOperator),
+        outputSchema,
+        outputSchema,
+        handlerId,
+        handler,
+        PhysicalOperatorWrapper::PipelineLocation::SCAN,
+        std::vector{leftBuildWrapper, rightBuildWrapper});
+
+    return {.root = {probeWrapper}, .leafs = {leftBuildWrapper, rightBuildWrapper}};
+};
+
+std::unique_ptr<AbstractRewriteRule>
+RewriteRuleGeneratedRegistrar::RegisterStBoxJoinRewriteRule(RewriteRuleRegistryArguments argument) /// NOLINT
+{
+    return std::make_unique<LowerToPhysicalStBoxJoin>(argument.conf);
+}
+
+}
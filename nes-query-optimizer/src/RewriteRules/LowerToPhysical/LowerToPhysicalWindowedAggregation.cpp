@@ -14,10 +14,17 @@
 
 #include <RewriteRules/LowerToPhysical/LowerToPhysicalWindowedAggregation.hpp>
 
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
 #include <cstdint>
+#include <filesystem>
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <ranges>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -25,6 +32,8 @@
 #include <Aggregation/AggregationOperatorHandler.hpp>
 #include <Aggregation/AggregationProbePhysicalOperator.hpp>
 #include <Aggregation/Function/AggregationPhysicalFunction.hpp>
+#include <Aggregation/Function/DuplicateAggregationPhysicalFunction.hpp>
+#include <Aggregation/Function/SharedStateAvgAggregationPhysicalFunction.hpp>
 #include <DataTypes/DataTypeProvider.hpp>
 #include <DataTypes/Schema.hpp>
 #include <Functions/FieldAccessPhysicalFunction.hpp>
@@ -32,20 +41,29 @@
 #include <Functions/PhysicalFunction.hpp>
 #include <MemoryLayout/ColumnLayout.hpp>
 #include <Nautilus/Interface/BufferRef/ColumnTupleBufferRef.hpp>
-#include <Nautilus/Interface/Hash/MurMur3HashFunction.hpp>
+#include <Nautilus/Interface/Hash/HashFunction.hpp>
 #include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedEntryMemoryProvider.hpp>
 #include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMap.hpp>
 #include <Nautilus/Interface/Record.hpp>
 #include <Operators/LogicalOperator.hpp>
+#include <Operators/Windows/Aggregations/ApproxQuantileAggregationLogicalFunction.hpp>
+#include <Operators/Windows/Aggregations/ApproxTopKAggregationLogicalFunction.hpp>
+#include <Operators/Windows/Aggregations/CorrAggregationLogicalFunction.hpp>
+#include <Operators/Windows/Aggregations/CovarPopAggregationLogicalFunction.hpp>
+#include <Operators/Windows/Aggregations/WindowAggregationLogicalFunction.hpp>
 #include <Operators/Windows/WindowedAggregationLogicalOperator.hpp>
 #include <RewriteRules/AbstractRewriteRule.hpp>
 #include <Runtime/Execution/OperatorHandler.hpp>
 #include <SliceStore/DefaultTimeBasedSliceStore.hpp>
+#include <SliceStore/SessionSliceStore.hpp>
+#include <SliceStore/WindowSlicesStoreInterface.hpp>
 #include <Traits/OutputOriginIdsTrait.hpp>
 #include <Traits/TraitSet.hpp>
 #include <Watermark/TimeFunction.hpp>
 #include <WindowTypes/Measures/TimeCharacteristic.hpp>
+#include <WindowTypes/Types/SessionWindow.hpp>
 #include <WindowTypes/Types/TimeBasedWindowType.hpp>
+#include <google/protobuf/util/message_differencer.h>
 #include <magic_enum/magic_enum.hpp>
 #include <AggregationPhysicalFunctionRegistry.hpp>
 #include <ErrorHandling.hpp>
@@ -122,9 +140,6 @@ getAggregationPhysicalFunctions(const WindowedAggregationLogicalOperator& logica
         auto physicalFinalType = DataTypeProvider::provideDataType(descriptor->getFinalAggregateStamp().type);
 
         const auto resultFieldIdentifier = descriptor->asField.getFieldName();
-        auto layout = std::make_shared<ColumnLayout>(configuration.pageSize.getValue(), logicalOperator.getInputSchemas()[0]);
-        auto columnBufferRef = std::make_shared<Interface::BufferRef::ColumnTupleBufferRef>(layout);
-
         const auto name = descriptor->getName();
 
         // Custom lowering path for TEMPORAL_SEQUENCE: needs three field functions (lon, lat, ts)
@@ -138,16 +153,6 @@ getAggregationPhysicalFunctions(const WindowedAggregationLogicalOperator& logica
             auto latPF = QueryCompilation::FunctionProvider::lowerFunction(tsDescriptor->getLatField());
             auto tsPF = QueryCompilation::FunctionProvider::lowerFunction(tsDescriptor->getTimestampField());
 
-            // Create a dedicated in-memory layout for the aggregation state (PagedVector) that
-            // matches the field identifiers used by the physical function ("lon", "lat", "timestamp").
-            // Using the input schema here is incorrect because it would not match the internal
-            // record written by the aggregation state, causing lookups by name to fail.
-            Schema stateSchema;
-            stateSchema.addField("lon", tsDescriptor->getLonField().getDataType());
-            stateSchema.addField("lat", tsDescriptor->getLatField().getDataType());
-            stateSchema.addField("timestamp", tsDescriptor->getTimestampField().getDataType());
-            auto tupleBufferRef = Interface::BufferRef::TupleBufferRef::create(configuration.pageSize.getValue(), stateSchema);
-
             auto phys = std::make_shared<TemporalSequenceAggregationPhysicalFunction>(
                 std::move(physicalInputType),
                 std::move(physicalFinalType),
@@ -155,12 +160,18 @@ getAggregationPhysicalFunctions(const WindowedAggregationLogicalOperator& logica
                 latPF,
                 tsPF,
                 resultFieldIdentifier,
-                tupleBufferRef);
+                tsDescriptor->getToleranceInMeters());
             aggregationPhysicalFunctions.push_back(std::move(phys));
             continue;
         }
 
         // Default path: use registry for single-input aggregations
+        /// Aggregations that keep their input records in a paged vector, e.g., the median, solely read the field of the aggregation.
+        /// Thus, the pages store only this field instead of the full input record, which reduces the memory of the state per record.
+        const auto projectedInputSchema = Schema{Schema::MemoryLayoutType::COLUMNAR_LAYOUT}.addField(
+            descriptor->onField.getFieldName(), descriptor->getInputStamp());
+        auto layout = std::make_shared<ColumnLayout>(configuration.pageSize.getValue(), projectedInputSchema);
+        auto columnBufferRef = std::make_shared<Interface::BufferRef::ColumnTupleBufferRef>(layout);
         auto aggregationInputFunction = QueryCompilation::FunctionProvider::lowerFunction(descriptor->onField);
         auto aggregationArguments = AggregationPhysicalFunctionRegistryArguments(
             std::move(physicalInputType),
@@ -168,6 +179,24 @@ getAggregationPhysicalFunctions(const WindowedAggregationLogicalOperator& logica
             std::move(aggregationInputFunction),
             resultFieldIdentifier,
             columnBufferRef);
+        if (const auto quantileDescriptor = std::dynamic_pointer_cast<ApproxQuantileAggregationLogicalFunction>(descriptor))
+        {
+            aggregationArguments.quantile = quantileDescriptor->getQuantile();
+        }
+        if (const auto topKDescriptor = std::dynamic_pointer_cast<ApproxTopKAggregationLogicalFunction>(descriptor))
+        {
+            aggregationArguments.k = topKDescriptor->getK();
+        }
+        if (const auto covarianceDescriptor = std::dynamic_pointer_cast<CovarPopAggregationLogicalFunction>(descriptor))
+        {
+            aggregationArguments.secondInputFunction
+                = QueryCompilation::FunctionProvider::lowerFunction(covarianceDescriptor->getSecondOnField());
+        }
+        else if (const auto correlationDescriptor = std::dynamic_pointer_cast<CorrAggregationLogicalFunction>(descriptor))
+        {
+            aggregationArguments.secondInputFunction
+                = QueryCompilation::FunctionProvider::lowerFunction(correlationDescriptor->getSecondOnField());
+        }
         if (auto aggregationPhysicalFunction
             = AggregationPhysicalFunctionRegistry::instance().create(std::string(name), std::move(aggregationArguments)))
         {
@@ -180,6 +209,138 @@ getAggregationPhysicalFunctions(const WindowedAggregationLogicalOperator& logica
     }
     return aggregationPhysicalFunctions;
 }
+
+/// Aggregations, whose result the states of other aggregations already determine, share these states instead of updating a state of
+/// their own per record, c.f., SharedStateAggregationPhysicalFunction. These are duplicates, i.e., aggregations that solely differ in
+/// their result field, and averages next to a sum over the same field and a count.
+/// The remaining states lie contiguously in the value area of an entry, ordered by their alignment. Thus, no state follows a state,
+/// whose size is not a multiple of its alignment, and all states stay aligned, as long as the value area is.
+std::vector<std::shared_ptr<AggregationPhysicalFunction>> shareAggregationStates(
+    const std::vector<std::shared_ptr<WindowAggregationLogicalFunction>>& descriptors,
+    const std::vector<std::shared_ptr<AggregationPhysicalFunction>>& aggregationPhysicalFunctions)
+{
+    const auto calculateSameState = [](const auto& descriptor, const auto& otherDescriptor)
+    {
+        auto serializedDescriptor = descriptor->serialize();
+        auto serializedOtherDescriptor = otherDescriptor->serialize();
+        serializedDescriptor.clear_as_field();
+        serializedOtherDescriptor.clear_as_field();
+        return google::protobuf::util::MessageDifferencer::Equals(serializedDescriptor, serializedOtherDescriptor);
+    };
+
+    /// An aggregation either owns its state, is a duplicate of an aggregation owning its state, or an average over a sum and a count
+    std::vector<std::optional<size_t>> originals(descriptors.size());
+    std::vector<std::optional<std::pair<size_t, size_t>>> sumsAndCounts(descriptors.size());
+    const auto findOwner = [&](const auto& predicate, const size_t end) -> std::optional<size_t>
+    {
+        for (size_t i = 0; i < end; ++i)
+        {
+            if (not originals[i].has_value() and predicate(descriptors[i]))
+            {
+                return i;
+            }
+        }
+        return std::nullopt;
+    };
+    for (size_t i = 0; i < descriptors.size(); ++i)
+    {
+        originals[i] = findOwner([&](const auto& descriptor) { return calculateSameState(descriptors[i], descriptor); }, i);
+    }
+    const auto count
+        = findOwner([](const auto& descriptor) { return descriptor->getName() == std::string_view("Count"); }, descriptors.size());
+    for (size_t i = 0; i < descriptors.size(); ++i)
+    {
+        const auto& avg = descriptors[i];
+        if (originals[i].has_value() or avg->getName() != std::string_view("Avg") or not count.has_value())
+        {
+            continue;
+        }
+        /// The average widens the type of its sum. Thus, it solely shares sums of the widened type.
+        const auto sum = findOwner(
+            [&](const auto& descriptor)
+            {
+                return descriptor->getName() == std::string_view("Sum")
+                    and descriptor->onField.getFieldName() == avg->onField.getFieldName()
+                    and descriptor->getInputStamp() == avg->getInputStamp();
+            },
+            descriptors.size());
+        if (sum.has_value())
+        {
+            sumsAndCounts[i] = std::make_pair(sum.value(), count.value());
+        }
+    }
+    for (size_t i = 0; i < descriptors.size(); ++i)
+    {
+        if (originals[i].has_value() and sumsAndCounts[originals[i].value()].has_value())
+        {
+            sumsAndCounts[i] = sumsAndCounts[originals[i].value()];
+            originals[i].reset();
+        }
+    }
+
+    /// A state is aligned to the largest power of two up to eight bytes that divides its size
+    const auto getAlignment = [](const size_t sizeOfState) { return size_t{1} << std::min(3, std::countr_zero(sizeOfState)); };
+    auto owners = std::views::iota(size_t{0}, descriptors.size())
+        | std::views::filter([&](const auto i) { return not originals[i].has_value() and not sumsAndCounts[i].has_value(); })
+        | std::ranges::to<std::vector>();
+    std::ranges::stable_sort(
+        owners,
+        std::ranges::greater{},
+        [&](const auto owner) { return getAlignment(aggregationPhysicalFunctions[owner]->getSizeOfStateInBytes()); });
+    std::vector<size_t> stateOffsets(descriptors.size());
+    size_t stateOffset = 0;
+    for (const auto owner : owners)
+    {
+        stateOffsets[owner] = stateOffset;
+        stateOffset += aggregationPhysicalFunctions[owner]->getSizeOfStateInBytes();
+    }
+
+    /// Aggregations without a state of their own come first. Thus, they receive the start of the value area as their state.
+    std::vector<std::shared_ptr<AggregationPhysicalFunction>> sharingAggregationPhysicalFunctions;
+    for (size_t i = 0; i < descriptors.size(); ++i)
+    {
+        const auto& descriptor = descriptors[i];
+        auto physicalInputType = DataTypeProvider::provideDataType(descriptor->getInputStamp().type);
+        auto physicalFinalType = DataTypeProvider::provideDataType(descriptor->getFinalAggregateStamp().type);
+        auto aggregationInputFunction = QueryCompilation::FunctionProvider::lowerFunction(descriptor->onField);
+        if (const auto original = originals[i])
+        {
+            sharingAggregationPhysicalFunctions.emplace_back(std::make_shared<DuplicateAggregationPhysicalFunction>(
+                std::move(physicalInputType),
+                std::move(physicalFinalType),
+                std::move(aggregationInputFunction),
+                descriptor->asField.getFieldName(),
+                aggregationPhysicalFunctions[original.value()],
+                descriptors[original.value()]->asField.getFieldName(),
+                stateOffsets[original.value()]));
+        }
+        else if (const auto sumAndCount = sumsAndCounts[i])
+        {
+            sharingAggregationPhysicalFunctions.emplace_back(std::make_shared<SharedStateAvgAggregationPhysicalFunction>(
+                std::move(physicalInputType),
+                std::move(physicalFinalType),
+                std::move(aggregationInputFunction),
+                descriptor->asField.getFieldName(),
+                stateOffsets[sumAndCount->first],
+                stateOffsets[sumAndCount->second]));
+        }
+    }
+    for (const auto owner : owners)
+    {
+        sharingAggregationPhysicalFunctions.emplace_back(aggregationPhysicalFunctions[owner]);
+    }
+    return sharingAggregationPhysicalFunctions;
+}
+
+/// The pre-aggregation table gets cleared without calling the cleanup of its states. Thus, we solely use it for aggregations, whose
+/// fixed-size states lie in the table itself, c.f., AggregationBuildPhysicalOperator
+bool isPreAggregatable(const WindowedAggregationLogicalOperator& logicalOperator)
+{
+    constexpr std::array<std::string_view, 5> preAggregatableFunctions{"Sum", "Count", "Min", "Max", "Avg"};
+    return std::ranges::all_of(
+        logicalOperator.getWindowAggregation(),
+        [&](const auto& descriptor) { return std::ranges::contains(preAggregatableFunctions, descriptor->getName()); });
+}
 }
 
 RewriteRuleResultSubgraph LowerToPhysicalWindowedAggregation::apply(LogicalOperator logicalOperator)
@@ -202,7 +363,8 @@ RewriteRuleResultSubgraph LowerToPhysicalWindowedAggregation::apply(LogicalOpera
     auto timeFunction = getTimeFunction(*aggregation);
     auto windowType = std::dynamic_pointer_cast<Windowing::TimeBasedWindowType>(aggregation->getWindowType());
     INVARIANT(windowType != nullptr, "Window type must be a time-based window type");
-    auto aggregationPhysicalFunctions = getAggregationPhysicalFunctions(*aggregation, conf);
+    auto aggregationPhysicalFunctions
+        = shareAggregationStates(aggregation->getWindowAggregation(), getAggregationPhysicalFunctions(*aggregation, conf));
 
     const auto valueSize = std::accumulate(
         aggregationPhysicalFunctions.begin(),
@@ -223,10 +385,10 @@ RewriteRuleResultSubgraph LowerToPhysicalWindowedAggregation::apply(LogicalOpera
             INVARIANT(fieldReplaceSuccess, "Expect to change the type of {} for {}", nodeFunctionKey.getFieldName(), newInputSchema);
         }
         keyFunctions.emplace_back(QueryCompilation::FunctionProvider::lowerFunction(nodeFunctionKey));
-        keySize += DataTypeProvider::provideDataType(loweredFunctionType.type).getSizeInBytes();
+        keySize += Interface::BufferRef::ChainedEntryMemoryProvider::getFieldSizeInBytes(loweredFunctionType);
     }
     const auto entrySize = sizeof(Interface::ChainedHashMapEntry) + keySize + valueSize;
-    const auto numberOfBuckets = conf.numberOfPartitions.getValue();
+    const auto numberOfBuckets = conf.maxNumberOfBuckets.getValue();
     const auto pageSize = conf.pageSize.getValue();
     const auto entriesPerPage = pageSize / entrySize;
 
@@ -237,7 +399,7 @@ RewriteRuleResultSubgraph LowerToPhysicalWindowedAggregation::apply(LogicalOpera
     const auto windowMetaData = WindowMetaData{aggregation->getWindowStartFieldName(), aggregation->getWindowEndFieldName()};
 
     const HashMapOptions hashMapOptions(
-        std::make_unique<Interface::MurMur3HashFunction>(),
+        Interface::HashFunction::create(conf.hashFunction.getValue()),
         keyFunctions,
         fieldKeys,
         fieldValues,
@@ -246,14 +408,63 @@ RewriteRuleResultSubgraph LowerToPhysicalWindowedAggregation::apply(LogicalOpera
         keySize,
         valueSize,
         pageSize,
-        numberOfBuckets);
+        numberOfBuckets,
+        conf.hashMapType.getValue());
 
-    auto sliceAndWindowStore
-        = std::make_unique<DefaultTimeBasedSliceStore>(windowType->getSize().getTime(), windowType->getSlide().getTime());
+    const auto windowSize = windowType->getSize().getTime();
+    const auto windowSlide = windowType->getSlide().getTime();
+    const auto earlyFiringInterval = windowType->getEarlyFiringInterval();
+    /// The probe combines and lowers each radix partition of a window in a separate task.
+    /// The top n of a window requires all of its keys, thus it disables the partitioning.
+    const auto& topN = aggregation->getTopN();
+    const auto numberOfPartitions = topN.has_value()
+        ? uint64_t{1}
+        : std::clamp(
+              std::bit_ceil(static_cast<uint64_t>(conf.numberOfPartitions.getValue())),
+              uint64_t{1},
+              HashMapOptions::MAX_NUMBER_OF_PARTITIONS);
+    /// If a window consists of at most two slides, combining the prefix and suffix hash maps does not save any work.
+    /// Early results and partitions consist of a subset of the slices or keys of a window, which the prefix and suffix hash maps do not
+    /// cover.
+    const auto incrementalAggregation = conf.incrementalSlidingWindowAggregation.getValue() and windowSize > 2 * windowSlide
+        and not earlyFiringInterval.has_value() and numberOfPartitions == 1;
+    /// With multiple partitions, consecutive records mostly belong to different hash maps of a slice and would flush the table
+    const auto preAggregationTableSize
+        = isPreAggregatable(*aggregation) and numberOfPartitions == 1 ? conf.preAggregationTableSize.getValue() : uint64_t{0};
+    /// Session windows have no fixed size and slide. Thus, they require their own slice store that merges the slices into sessions.
+    std::unique_ptr<WindowSlicesStoreInterface> sliceAndWindowStore;
+    if (const auto sessionWindow = std::dynamic_pointer_cast<Windowing::SessionWindow>(windowType))
+    {
+        sliceAndWindowStore = std::make_unique<SessionSliceStore>(sessionWindow->getGap().getTime());
+    }
+    else if (earlyFiringInterval.has_value())
+    {
+        /// Solely the default slice store emits early results
+        sliceAndWindowStore = std::make_unique<DefaultTimeBasedSliceStore>(
+            windowSize, windowSlide, 0, std::filesystem::path{}, earlyFiringInterval->getTime());
+    }
+    else
+    {
+        sliceAndWindowStore = WindowSlicesStoreInterface::create(conf.sliceStoreType.getValue(), windowSize, windowSlide);
+    }
     auto handler = std::make_shared<AggregationOperatorHandler>(
-        inputOriginIds | std::ranges::to<std::vector>(), outputOriginId, std::move(sliceAndWindowStore), conf.maxNumberOfBuckets);
-    auto build = AggregationBuildPhysicalOperator(handlerId, std::move(timeFunction), aggregationPhysicalFunctions, hashMapOptions);
-    auto probe = AggregationProbePhysicalOperator(hashMapOptions, aggregationPhysicalFunctions, handlerId, windowMetaData);
+        inputOriginIds | std::ranges::to<std::vector>(),
+        outputOriginId,
+        std::move(sliceAndWindowStore),
+        conf.maxNumberOfBuckets,
+        incrementalAggregation);
+    handler->setIdleOriginTimeout(std::chrono::milliseconds(conf.idleOriginTimeout.getValue()));
+    handler->setAllowedLateness(conf.allowedLateness.getValue());
+    auto build = AggregationBuildPhysicalOperator(
+        handlerId, std::move(timeFunction), aggregationPhysicalFunctions, hashMapOptions, numberOfPartitions, preAggregationTableSize);
+    std::optional<AggregationProbePhysicalOperator::TopN> probeTopN;
+    if (topN.has_value())
+    {
+        probeTopN = AggregationProbePhysicalOperator::TopN{
+            .orderFieldName = topN->orderFieldName, .descending = topN->descending, .limit = topN->limit};
+    }
+    auto probe = AggregationProbePhysicalOperator(
+        hashMapOptions, aggregationPhysicalFunctions, handlerId, windowMetaData, incrementalAggregation, std::move(probeTopN));
 
     auto buildWrapper = std::make_shared<PhysicalOperatorWrapper>(
         build, newInputSchema, outputSchema, handlerId, handler, PhysicalOperatorWrapper::PipelineLocation::EMIT);
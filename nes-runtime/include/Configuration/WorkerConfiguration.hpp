@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -21,6 +22,7 @@
 #include <Configurations/BaseOption.hpp>
 #include <Configurations/Enums/EnumOption.hpp>
 #include <Configurations/ScalarOption.hpp>
+#include <Configurations/SequenceOption.hpp>
 #include <Configurations/Validation/NumberValidation.hpp>
 #include <Util/DumpMode.hpp>
 #include <QueryEngineConfiguration.hpp>
@@ -28,6 +30,20 @@
 
 namespace NES
 {
+
+/// Memory resource used to allocate the global buffer pool
+enum class BufferPoolAllocator : uint8_t
+{
+    /// posix_memalign, pages are faulted in on first access
+    DEFAULT,
+    /// Pre-faulted anonymous mapping with regular pages
+    MMAP,
+    /// Mapping backed by transparent huge pages
+    TRANSPARENT_HUGE_PAGES,
+    /// Mapping backed by explicit huge pages (hugetlbfs), falls back to transparent huge pages if none are available
+    HUGE_PAGES
+};
+
 class WorkerConfiguration final : public BaseConfiguration
 {
 public:
@@ -44,6 +60,18 @@ public:
            "Number buffers in global buffer pool.",
            {std::make_shared<NumberValidation>()}};
 
+    EnumOption<BufferPoolAllocator> bufferPoolAllocator
+        = {"buffer_pool_allocator",
+           BufferPoolAllocator::DEFAULT,
+           fmt::format(
+               "Memory allocator of the global buffer pool: {}. HUGE_PAGES falls back to TRANSPARENT_HUGE_PAGES if the hugetlbfs pool is "
+               "exhausted.",
+               enumPipeList<BufferPoolAllocator>())};
+
+    /// Locking the buffer pool prevents it from being swapped out, but requires a sufficient RLIMIT_MEMLOCK.
+    BoolOption lockBufferPoolMemory
+        = {"lock_buffer_pool_memory", "false", "Locks the memory of the global buffer pool via mlock. Requires an mmap based allocator."};
+
     /// Configures the buffer size of individual TupleBuffers in bytes. This property has to be the same over a whole deployment.
     UIntOption bufferSizeInBytes
         = {"buffer_size_in_bytes",
@@ -51,6 +79,25 @@ public:
            "Configures the buffer size of individual TupleBuffers in bytes.",
            {std::make_shared<NumberValidation>()}};
 
+    /// Number of free buffers every thread may cache in front of the global buffer pool. Caching reduces the contention on the shared
+    /// queue of free buffers if many threads allocate and release buffers at a high rate.
+    UIntOption bufferCacheSize
+        = {"buffer_cache_size",
+           "0",
+           "Number of free buffers each thread caches locally in front of the global buffer pool. Zero disables the caches.",
+           {std::make_shared<NumberValidation>()}};
+
+    /// Unpooled buffer requests (e.g., for variable sized data or hash map pages) are served from pools of fixed buffer sizes before they
+    /// fall back to allocating memory on the fly. Every size in bytes configures one such size class.
+    SequenceOption<UIntOption> bufferSizeClasses
+        = {"buffer_size_classes", "Buffer sizes in bytes of the size class pools serving unpooled buffer requests, e.g., 8192, 65536"};
+
+    UIntOption numberOfBuffersPerSizeClass
+        = {"number_of_buffers_per_size_class",
+           "64",
+           "Number of buffers in the pool of each buffer size class.",
+           {std::make_shared<NumberValidation>()}};
+
     /// Indicates how many buffers a single data source can allocate. This property controls the backpressure mechanism as a data source that can't allocate new records can't ingest more data.
     UIntOption defaultMaxInflightBuffers
         = {"default_max_inflight_buffers",
@@ -59,6 +106,36 @@ public:
            "SourceDescriptor).",
            {std::make_shared<NumberValidation>()}};
 
+    /// Sources that support non-blocking reads (e.g., File and TCP) share this many I/O threads instead of running one thread each.
+    UIntOption numberOfAsyncSourceThreads
+        = {"number_of_async_source_threads",
+           "0",
+           "Number of I/O threads that ingest data from all sources supporting non-blocking reads. Zero runs one thread per source.",
+           {std::make_shared<NumberValidation>()}};
+
+    /// Splits the global buffer pool into one pool per NUMA node. WorkerThreads allocate from the pool local to their NUMA node, see
+    /// `query_engine.worker_pinning` to additionally restrict WorkerThreads to the CPUs of their node.
+    UIntOption numberOfNumaNodes
+        = {"number_of_numa_nodes",
+           "1",
+           "Number of NUMA nodes the worker distributes its buffer pools and WorkerThreads across. Zero uses all available nodes.",
+           {std::make_shared<NumberValidation>()}};
+
+    /// Pipeline invocations allocate memory for variable sized intermediates from an arena, which takes buffers from the buffer pool.
+    UIntOption numberOfRetainedArenaBuffers
+        = {"number_of_retained_arena_buffers",
+           "0",
+           "Number of buffers that each WorkerThread retains in its arena of a pipeline across invocations, instead of releasing them after "
+           "every invocation. Zero creates a new arena for every invocation.",
+           {std::make_shared<NumberValidation>()}};
+
+    /// Counts the cycles of every physical operator in the compiled pipelines and logs them per pipeline once a query stops
+    BoolOption profileOperators
+        = {"profile_operators",
+           "false",
+           "Counts the cycles that the compiled pipelines spend in each operator and logs them when the query stops. Slows the pipelines "
+           "down, as every operator call reads the cycle counter."};
+
     EnumOption<DumpMode> dumpQueryCompilationIntermediateRepresentations
         = {"dump_compilation_result",
            DumpMode::NONE,
@@ -71,8 +148,17 @@ private:
             &queryEngine,
             &defaultQueryExecution,
             &numberOfBuffersInGlobalBufferManager,
+            &bufferPoolAllocator,
+            &lockBufferPoolMemory,
             &defaultMaxInflightBuffers,
+            &numberOfAsyncSourceThreads,
             &bufferSizeInBytes,
+            &bufferCacheSize,
+            &bufferSizeClasses,
+            &numberOfBuffersPerSizeClass,
+            &numberOfNumaNodes,
+            &numberOfRetainedArenaBuffers,
+            &profileOperators,
             &dumpQueryCompilationIntermediateRepresentations};
     }
 };
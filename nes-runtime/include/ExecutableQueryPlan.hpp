@@ -13,6 +13,7 @@
 */
 
 #pragma once
+#include <chrono>
 #include <memory>
 #include <ostream>
 #include <utility>
@@ -22,6 +23,7 @@
 #include <Sources/SourceProvider.hpp>
 #include <Util/Logger/Formatter.hpp>
 #include <CompiledQueryPlan.hpp>
+#include <QueryPriority.hpp>
 
 namespace NES
 {
@@ -39,6 +41,8 @@ struct ExecutableQueryPlan
     QueryId queryId;
     std::vector<std::shared_ptr<ExecutablePipeline>> pipelines;
     std::vector<SourceWithSuccessor> sources;
+    QueryPriority priority = QueryPriority::NORMAL;
+    std::chrono::milliseconds bufferCompressionDelay{0};
     friend std::ostream& operator<<(std::ostream& os, const ExecutableQueryPlan& executableQueryPlan);
 };
 }
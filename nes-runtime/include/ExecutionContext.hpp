@@ -35,6 +35,7 @@
 #include <nautilus/val_concepts.hpp>
 #include <nautilus/val_ptr.hpp>
 #include <ErrorHandling.hpp>
+#include <OperatorProfile.hpp>
 #include <OperatorState.hpp>
 #include <PipelineExecutionContext.hpp>
 #include <function.hpp>
@@ -47,20 +48,28 @@ using namespace Nautilus;
 /// The arena is a memory management system that provides memory to the operators during a pipeline invocation.
 /// As the memory is destroyed / returned to the arena after the pipeline invocation, the memory is not persistent and thus, it is not
 /// suitable for storing state across pipeline invocations. For storing state across pipeline invocations, the operator handler should be used.
+/// An arena may serve multiple pipeline invocations one after another, c.f., reset(), thus it does not request buffers from the buffer
+/// provider for every invocation.
 struct Arena
 {
     explicit Arena(std::shared_ptr<AbstractBufferProvider> bufferProvider) : bufferProvider(std::move(bufferProvider)) { }
 
     /// Allocating memory by the buffer provider. There are three cases:
     /// 1. The required size is larger than the buffer provider's buffer size. In this case, we allocate an unpooled buffer.
-    /// 2. The required size is larger than the last buffer size. In this case, we allocate a new buffer of fixed size.
-    /// 3. The required size is smaller than the last buffer size. In this case, we return the pointer to the address in the last buffer.
+    /// 2. The required size does not fit into the current buffer. In this case, we continue in the next retained buffer or allocate a new
+    ///    buffer of fixed size.
+    /// 3. The required size fits into the current buffer. In this case, we return the pointer to the address in the current buffer.
     std::span<std::byte> allocateMemory(size_t sizeInBytes);
 
+    /// Invalidates all memory of the previous pipeline invocation. Keeps up to 'numberOfRetainedBuffers' fixed size buffers for the next
+    /// invocation and releases the others, as well as all unpooled buffers, which are mostly one-off allocations of large sizes.
+    void reset(size_t numberOfRetainedBuffers);
+
     std::shared_ptr<AbstractBufferProvider> bufferProvider;
     std::vector<TupleBuffer> fixedSizeBuffers;
     std::vector<TupleBuffer> unpooledBuffers;
-    size_t lastAllocationSize{0};
+    /// The fixed size buffer that serves the next allocation
+    size_t currentBufferIndex{0};
     size_t currentOffset{0};
 };
 
@@ -134,9 +143,18 @@ struct ExecutionContext final
     nautilus::val<OriginId> originId; /// Stores the current origin id of the incoming tuple buffer. This is set in the scan.
     nautilus::val<Timestamp> watermarkTs; /// Stores the watermark timestamp of the incoming tuple buffer. This is set in the scan.
     nautilus::val<Timestamp> currentTs; /// Stores the current timestamp. This is set by a time function
+    /// Stores the ingestion timestamps of the oldest and the latest data of the incoming tuple buffer. This is set in the scan.
+    nautilus::val<Timestamp> creationTs;
+    nautilus::val<Timestamp> latestCreationTs;
     nautilus::val<SequenceNumber> sequenceNumber; /// Stores the sequence number id of the incoming tuple buffer. This is set in the scan.
     nautilus::val<ChunkNumber> chunkNumber; /// Stores the chunk number of the incoming tuple buffer. This is set in the scan.
     nautilus::val<bool> lastChunk;
+    /// Set while the tiered execution interprets the pipeline. Operators may then record runtime statistics that the compilation uses.
+    /// As it is not a nautilus value, the compiled pipeline does not contain the recording.
+    bool collectsProfile{false};
+    /// Set while tracing a pipeline with `profile_operators`. The physical operators then count the cycles of their open, execute, and
+    /// close calls, c.f., OperatorProfile.
+    OperatorProfile* operatorProfile{nullptr};
 
 private:
     std::unordered_map<OperatorId, std::unique_ptr<OperatorState>> localStateMap;
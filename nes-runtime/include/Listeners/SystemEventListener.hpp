@@ -15,6 +15,7 @@
 #pragma once
 
 #include <chrono>
+#include <cstddef>
 #include <string>
 #include <type_traits>
 #include <utility>
@@ -57,7 +58,22 @@ struct StopQuerySystemEvent : BaseSystemEvent
     QueryId queryId = INVALID<QueryId>;
 };
 
-using SystemEvent = std::variant<SubmitQuerySystemEvent, StartQuerySystemEvent, StopQuerySystemEvent>;
+/// Occupancy of a buffer size class of the global buffer manager
+struct BufferSizeClassOccupancySystemEvent : BaseSystemEvent
+{
+    BufferSizeClassOccupancySystemEvent(size_t bufferSize, size_t numberOfBuffers, size_t numberOfAvailableBuffers)
+        : bufferSize(bufferSize), numberOfBuffers(numberOfBuffers), numberOfAvailableBuffers(numberOfAvailableBuffers)
+    {
+    }
+
+    BufferSizeClassOccupancySystemEvent() = default;
+    size_t bufferSize = 0;
+    size_t numberOfBuffers = 0;
+    size_t numberOfAvailableBuffers = 0;
+};
+
+using SystemEvent
+    = std::variant<SubmitQuerySystemEvent, StartQuerySystemEvent, StopQuerySystemEvent, BufferSizeClassOccupancySystemEvent>;
 static_assert(std::is_default_constructible_v<SystemEvent>, "Events should be default constructible");
 
 struct SystemEventListener
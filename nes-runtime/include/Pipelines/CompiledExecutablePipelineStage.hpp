@@ -13,8 +13,15 @@
 */
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
 #include <memory>
+#include <optional>
+#include <stop_token>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 #include <Runtime/Execution/OperatorHandler.hpp>
@@ -22,6 +29,7 @@
 #include <nautilus/Engine.hpp>
 #include <ExecutablePipelineStage.hpp>
 #include <ExecutionContext.hpp>
+#include <OperatorProfile.hpp>
 #include <Pipeline.hpp>
 
 namespace NES
@@ -29,27 +37,77 @@ namespace NES
 class DumpHelper;
 
 /// A compiled executable pipeline stage uses nautilus-lib to compile a pipeline to a code snippet.
+/// With 'compileInBackground' (tiered execution), the stage starts with interpreting the pipeline, while a background thread compiles it
+/// with the 'options'. Once the compiled function is ready, the stage atomically switches to it, thus the first tuples do not wait for the
+/// compilation. If the compilation fails, the stage keeps interpreting the pipeline.
+/// The interpreted pipeline collects a profile, e.g., the pass rates of the conjuncts of a selection. Thus, the background thread waits for
+/// a few interpreted buffers, or at most for the warm-up duration, before it compiles the pipeline with the profile.
+/// With 'numberOfRetainedArenaBuffers', every WorkerThread keeps an arena across the invocations of the stage, which retains up to that many
+/// buffers, thus short invocations that allocate variable sized intermediates do not request buffers from the buffer provider every time.
+/// With 'profileOperators', the compiled function counts the cycles of each operator, which the stage logs once it stops, c.f.,
+/// OperatorProfile. The interpreted function of the tiered execution does not count them, as it would distort the profile.
+/// @note The compiled code embeds addresses of this process, e.g., of the physical operators or their constant arguments that the traced
+/// proxy calls receive, thus a compiled pipeline is specific to its stage and can neither be shared with other queries nor cached on disk.
+/// This also holds for structurally identical pipelines of concurrent queries: their traced IR differs exactly in these addresses, thus a
+/// fingerprint of the IR that ignores them would map the stages to a function that calls into the operators of another query. Sharing
+/// a compiled function requires that the traced code reaches all of its state through the PipelineExecutionContext, e.g., its operator
+/// handlers, instead of embedding it.
 class CompiledExecutablePipelineStage final : public ExecutablePipelineStage
 {
 public:
     CompiledExecutablePipelineStage(
         std::shared_ptr<Pipeline> pipeline,
         std::unordered_map<OperatorHandlerId, std::shared_ptr<OperatorHandler>> operatorHandler,
-        nautilus::engine::Options options);
+        nautilus::engine::Options options,
+        bool compileInBackground = false,
+        size_t numberOfRetainedArenaBuffers = 0,
+        bool profileOperators = false);
     void start(PipelineExecutionContext& pipelineExecutionContext) override;
     void execute(const TupleBuffer& inputTupleBuffer, PipelineExecutionContext& pipelineExecutionContext) override;
     void stop(PipelineExecutionContext& pipelineExecutionContext) override;
+    /// Empty without 'profileOperators'
+    [[nodiscard]] std::vector<OperatorCost> getOperatorCosts() const override;
+    /// Sums up the state of the operator handlers of the pipeline. As the build and the probe pipeline of a window share their operator
+    /// handler, both report its state.
+    [[nodiscard]] uint64_t getStateSizeInBytes() const override;
+    [[nodiscard]] std::vector<uint64_t> getStateSizeInBytesPerWorkerThread() const override;
 
 protected:
     std::ostream& toString(std::ostream& os) const override;
 
 private:
-    [[nodiscard]] nautilus::engine::CallableFunction<void, PipelineExecutionContext*, const TupleBuffer*, const Arena*>
-    compilePipeline() const;
+    using PipelineFunction = nautilus::engine::CallableFunction<void, PipelineExecutionContext*, const TupleBuffer*, const Arena*>;
+
+    static constexpr uint64_t WARM_UP_BUFFERS = 16;
+    static constexpr std::chrono::milliseconds MAX_WARM_UP_DURATION{100};
+
+    /// The arena of a WorkerThread, which WorkerThreads with colliding ids use exclusively, c.f., execute()
+    struct WorkerArena
+    {
+        std::atomic_flag isUsed;
+        std::optional<Arena> arena;
+    };
+
+    [[nodiscard]] PipelineFunction compilePipeline(const nautilus::engine::NautilusEngine& pipelineEngine, bool collectsProfile) const;
+    void compileInBackgroundThread(const std::stop_token& stopToken);
+
     nautilus::engine::NautilusEngine engine;
-    nautilus::engine::CallableFunction<void, PipelineExecutionContext*, const TupleBuffer*, const Arena*> compiledPipelineFunction;
+    /// Solely set in the tiered execution, interprets the pipeline until the engine compiled it
+    std::optional<nautilus::engine::NautilusEngine> interpreterEngine;
+    PipelineFunction compiledPipelineFunction;
+    PipelineFunction interpretedPipelineFunction;
+    /// Points to the function that the worker threads execute. Both functions live as long as the stage, thus the switch is a single store.
+    std::atomic<PipelineFunction*> activePipelineFunction{nullptr};
+    std::atomic<uint64_t> numberOfInterpretedBuffers{0};
     std::unordered_map<OperatorHandlerId, std::shared_ptr<OperatorHandler>> operatorHandlers;
     std::shared_ptr<Pipeline> pipeline;
+    size_t numberOfRetainedArenaBuffers;
+    /// Empty, if the invocations do not retain arena buffers. Otherwise, one arena per WorkerThread.
+    std::vector<std::unique_ptr<WorkerArena>> workerArenas;
+    /// Solely set with 'profileOperators'. The compiled function embeds its address, thus it lives as long as the stage.
+    std::unique_ptr<OperatorProfile> operatorProfile;
+    /// Declared last, thus destroying the stage joins the compilation before it destroys the functions and the pipeline
+    std::jthread compilerThread;
 };
 
 }
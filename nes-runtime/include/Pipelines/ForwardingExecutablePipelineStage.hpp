@@ -0,0 +1,45 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <ostream>
+#include <Identifiers/Identifiers.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <ExecutablePipelineStage.hpp>
+#include <PipelineExecutionContext.hpp>
+
+namespace NES
+{
+
+/// Executes a pass-through pipeline, e.g., the rename of a union, whose emit would write each record of the input buffer unchanged, i.e.,
+/// to the same position in a buffer of the same memory layout. Instead of compiling the pipeline, the stage forwards the input buffer with
+/// its metadata, thus it neither reads nor copies any record.
+class ForwardingExecutablePipelineStage final : public ExecutablePipelineStage
+{
+public:
+    explicit ForwardingExecutablePipelineStage(PipelineId pipelineId);
+
+    void start(PipelineExecutionContext& pipelineExecutionContext) override;
+    void execute(const TupleBuffer& inputTupleBuffer, PipelineExecutionContext& pipelineExecutionContext) override;
+    void stop(PipelineExecutionContext& pipelineExecutionContext) override;
+
+protected:
+    std::ostream& toString(std::ostream& os) const override;
+
+private:
+    PipelineId pipelineId;
+};
+
+}
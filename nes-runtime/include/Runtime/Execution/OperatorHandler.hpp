@@ -15,6 +15,7 @@
 #pragma once
 #include <atomic>
 #include <cstdint>
+#include <vector>
 #include <Identifiers/NESStrongType.hpp>
 #include <Runtime/QueryTerminationType.hpp>
 
@@ -46,6 +47,14 @@ public:
     virtual void start(PipelineExecutionContext& pipelineExecutionContext, uint32_t localStateVariableId) = 0;
 
     virtual void stop(QueryTerminationType terminationType, PipelineExecutionContext& pipelineExecutionContext) = 0;
+
+    /// Returns the number of bytes that the state of the operator occupies in memory. Handlers without state that grows with the input
+    /// return zero.
+    [[nodiscard]] virtual uint64_t getStateSizeInBytes() const { return 0; }
+
+    /// Returns the state of getStateSizeInBytes() by the WorkerThreadIds, modulo the number of worker threads, which built it. Handlers
+    /// whose state is not owned by worker threads return an empty vector.
+    [[nodiscard]] virtual std::vector<uint64_t> getStateSizeInBytesPerWorkerThread() const { return {}; }
 };
 
 }
@@ -27,6 +27,7 @@ enum class QueryState : uint8_t
     Running, /// Deployed->Running when calling start()
     Stopped, /// Running->Stopped when calling stop() and in Running state
     Failed,
+    Compiling, /// Registered asynchronously, the query moves to Registered once its compilation succeeded, or to Failed
 };
 
 inline std::ostream& operator<<(std::ostream& ostream, const QueryState& status)
@@ -14,6 +14,8 @@
 
 #pragma once
 #include <memory>
+#include <optional>
+#include <vector>
 #include <Identifiers/Identifiers.hpp>
 #include <Listeners/QueryLog.hpp>
 #include <Listeners/SystemEventListener.hpp>
@@ -61,7 +63,17 @@ public:
 
     [[nodiscard]] std::shared_ptr<const QueryLog> getQueryLog() const { return queryLog; }
 
+    /// Counters of the running pipelines of the query, c.f., QueryEngine::getPipelineMetrics
+    [[nodiscard]] std::vector<PipelineMetrics> getPipelineMetrics(QueryId queryId) const;
+    /// Momentary state of the WorkerThreads, the task queue and the sources, c.f., QueryEngine::getEngineMetrics
+    [[nodiscard]] EngineMetrics getEngineMetrics() const;
+    /// Memory of the buffers that the pipelines of the query hold, c.f., QueryEngine::getQueryMemory
+    [[nodiscard]] std::optional<QueryMemoryMetrics> getQueryMemory(QueryId queryId) const;
+
 private:
+    /// Emits the occupancy of every buffer size class of the global buffer manager to the system event listener
+    void reportBufferSizeClassOccupancy() const;
+
     std::shared_ptr<BufferManager> bufferManager;
     std::shared_ptr<QueryLog> queryLog;
 
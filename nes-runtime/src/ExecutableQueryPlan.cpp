@@ -82,14 +82,18 @@ ExecutableQueryPlan::instantiate(CompiledQueryPlan& compiledQueryPlan, const Sou
         }
     }
 
-    for (auto [originId, operatorId, descriptor, successors] : compiledQueryPlan.sources)
+    for (auto [originId, operatorId, descriptor, successors, formattedTupleSizeInBytes] : compiledQueryPlan.sources)
     {
         std::ranges::copy(instantiatedSinksWithSourcePredecessor[operatorId], std::back_inserter(successors));
-        instantiatedSources.emplace_back(sourceProvider.lower(originId, descriptor), std::move(successors));
+        instantiatedSources.emplace_back(sourceProvider.lower(originId, descriptor, formattedTupleSizeInBytes), std::move(successors));
     }
 
 
-    return std::make_unique<ExecutableQueryPlan>(compiledQueryPlan.queryId, compiledQueryPlan.pipelines, std::move(instantiatedSources));
+    auto executableQueryPlan
+        = std::make_unique<ExecutableQueryPlan>(compiledQueryPlan.queryId, compiledQueryPlan.pipelines, std::move(instantiatedSources));
+    executableQueryPlan->priority = compiledQueryPlan.priority;
+    executableQueryPlan->bufferCompressionDelay = compiledQueryPlan.bufferCompressionDelay;
+    return executableQueryPlan;
 }
 
 ExecutableQueryPlan::ExecutableQueryPlan(
@@ -63,33 +63,38 @@ std::span<std::byte> Arena::allocateMemory(const size_t sizeInBytes)
             throw CannotAllocateBuffer("Cannot allocate unpooled buffer of size " + std::to_string(sizeInBytes));
         }
         unpooledBuffers.emplace_back(unpooledBufferOpt.value());
-        lastAllocationSize = sizeInBytes;
         return unpooledBuffers.back().getAvailableMemoryArea().subspan(0, sizeInBytes);
     }
 
-    if (fixedSizeBuffers.empty())
+    /// Case 2
+    if (currentBufferIndex < fixedSizeBuffers.size() and fixedSizeBuffers[currentBufferIndex].getBufferSize() < currentOffset + sizeInBytes)
     {
-        fixedSizeBuffers.emplace_back(bufferProvider->getBufferBlocking());
-        lastAllocationSize = bufferProvider->getBufferSize();
-        currentOffset += sizeInBytes;
-        return fixedSizeBuffers.back().getAvailableMemoryArea().subspan(0, sizeInBytes);
+        ++currentBufferIndex;
+        currentOffset = 0;
     }
-
-    /// Case 2
-    if (lastAllocationSize < currentOffset + sizeInBytes)
+    if (currentBufferIndex == fixedSizeBuffers.size())
     {
         fixedSizeBuffers.emplace_back(bufferProvider->getBufferBlocking());
-        this->currentOffset = 0;
+        currentOffset = 0;
     }
 
     /// Case 3
-    auto& lastBuffer = fixedSizeBuffers.back();
-    lastAllocationSize = lastBuffer.getBufferSize();
-    const auto result = lastBuffer.getAvailableMemoryArea().subspan(currentOffset, sizeInBytes);
+    const auto result = fixedSizeBuffers[currentBufferIndex].getAvailableMemoryArea().subspan(currentOffset, sizeInBytes);
     currentOffset += sizeInBytes;
     return result;
 }
 
+void Arena::reset(const size_t numberOfRetainedBuffers)
+{
+    unpooledBuffers.clear();
+    if (fixedSizeBuffers.size() > numberOfRetainedBuffers)
+    {
+        fixedSizeBuffers.erase(fixedSizeBuffers.begin() + static_cast<std::ptrdiff_t>(numberOfRetainedBuffers), fixedSizeBuffers.end());
+    }
+    currentBufferIndex = 0;
+    currentOffset = 0;
+}
+
 nautilus::val<int8_t*> ArenaRef::allocateMemory(const nautilus::val<size_t>& sizeInBytes)
 {
     /// If the available space for the pointer is smaller than the required size, we allocate a new buffer from the arena.
@@ -117,6 +122,8 @@ ExecutionContext::ExecutionContext(const nautilus::val<PipelineExecutionContext*
     , originId(INVALID<OriginId>)
     , watermarkTs(0_u64)
     , currentTs(0_u64)
+    , creationTs(0_u64)
+    , latestCreationTs(0_u64)
     , sequenceNumber(INVALID<SequenceNumber>)
     , chunkNumber(INVALID<ChunkNumber>)
     , lastChunk(true)
@@ -98,9 +98,10 @@ std::optional<LocalQueryStatus> getQueryStatusImpl(const auto& log, QueryId quer
     {
         /// Unfortunately the multithreaded nature of the query engine cannot guarantee event ordering.
         /// We handle out-of-order events by keeping the most recent timestamp for each event type.
-        /// Final state is determined by priority: Failed > Stopped > Running > Started > Registered.
+        /// Final state is determined by priority: Failed > Stopped > Running > Started > Registered > Compiling.
         LocalQueryStatus status;
         status.queryId = queryId;
+        bool registered = false;
 
         for (const auto& statusChange : queryLog->second)
         {
@@ -120,12 +121,15 @@ std::optional<LocalQueryStatus> getQueryStatusImpl(const auto& log, QueryId quer
                     status.metrics.running = statusChange.timestamp;
                     break;
                 case QueryState::Registered:
+                    registered = true;
+                    break;
+                case QueryState::Compiling:
                     break;
             }
         }
 
         /// Determine state based on available metrics and timestamps
-        auto state = QueryState::Registered;
+        auto state = registered ? QueryState::Registered : QueryState::Compiling;
         if (status.metrics.error.has_value())
         {
             state = QueryState::Failed;
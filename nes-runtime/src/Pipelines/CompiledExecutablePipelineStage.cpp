@@ -13,66 +13,176 @@
 */
 #include <Pipelines/CompiledExecutablePipelineStage.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <ostream>
+#include <ranges>
+#include <stop_token>
+#include <string>
+#include <string_view>
+#include <thread>
 #include <unordered_map>
 #include <utility>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
 #include <Nautilus/Interface/RecordBuffer.hpp>
 #include <Runtime/Execution/OperatorHandler.hpp>
 #include <Runtime/TupleBuffer.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/ThreadNaming.hpp>
 #include <cpptrace/from_current.hpp>
 #include <fmt/format.h>
 #include <nautilus/val_ptr.hpp>
 #include <CompilationContext.hpp>
 #include <Engine.hpp>
+#include <ErrorHandling.hpp>
 #include <ExecutionContext.hpp>
+#include <OperatorProfile.hpp>
 #include <PhysicalOperator.hpp>
 #include <Pipeline.hpp>
 #include <options.hpp>
 
 namespace NES
 {
+namespace
+{
+/// Resets the arena of a WorkerThread and hands it to the next invocation, even if the pipeline throws
+class ArenaLease
+{
+public:
+    ArenaLease(Arena& arena, std::atomic_flag& isUsed, const size_t numberOfRetainedBuffers)
+        : arena(arena), isUsed(isUsed), numberOfRetainedBuffers(numberOfRetainedBuffers)
+    {
+    }
+
+    ArenaLease(const ArenaLease&) = delete;
+    ArenaLease& operator=(const ArenaLease&) = delete;
+    ArenaLease(ArenaLease&&) = delete;
+    ArenaLease& operator=(ArenaLease&&) = delete;
+
+    ~ArenaLease()
+    {
+        arena.reset(numberOfRetainedBuffers);
+        isUsed.clear(std::memory_order_release);
+    }
+
+private:
+    Arena& arena;
+    std::atomic_flag& isUsed;
+    size_t numberOfRetainedBuffers;
+};
+
+/// Names an operator by its type without the namespace and the common suffix, e.g., `Selection` for the SelectionPhysicalOperator
+std::string profiledNameOf(const PhysicalOperator& physicalOperator)
+{
+    std::string name = physicalOperator.toString();
+    constexpr std::string_view wrapperPrefix = "PhysicalOperator(";
+    if (name.starts_with(wrapperPrefix) and name.ends_with(')'))
+    {
+        name = name.substr(wrapperPrefix.size(), name.size() - wrapperPrefix.size() - 1);
+    }
+    if (const auto namespaceEnd = name.rfind("::"); namespaceEnd != std::string::npos)
+    {
+        name = name.substr(namespaceEnd + 2);
+    }
+    if (constexpr std::string_view suffix = "PhysicalOperator"; name.ends_with(suffix) and name.size() > suffix.size())
+    {
+        name.resize(name.size() - suffix.size());
+    }
+    return name;
+}
+
+std::unique_ptr<OperatorProfile> createOperatorProfile(const Pipeline& pipeline)
+{
+    std::vector<std::pair<OperatorId, std::string>> operators;
+    for (std::optional current = pipeline.getRootOperator(); current.has_value(); current = current->getChild())
+    {
+        operators.emplace_back(current->getId(), profiledNameOf(*current));
+    }
+    return std::make_unique<OperatorProfile>(pipeline.getPipelineId(), operators);
+}
+}
 
 CompiledExecutablePipelineStage::CompiledExecutablePipelineStage(
     std::shared_ptr<Pipeline> pipeline,
     std::unordered_map<OperatorHandlerId, std::shared_ptr<OperatorHandler>> operatorHandlers,
-    nautilus::engine::Options options)
-    : engine(std::move(options))
+    nautilus::engine::Options options,
+    const bool compileInBackground,
+    const size_t numberOfRetainedArenaBuffers,
+    const bool profileOperators)
+    : engine(options)
     , compiledPipelineFunction(nullptr)
+    , interpretedPipelineFunction(nullptr)
     , operatorHandlers(std::move(operatorHandlers))
     , pipeline(std::move(pipeline))
+    , numberOfRetainedArenaBuffers(numberOfRetainedArenaBuffers)
+    , operatorProfile(profileOperators ? createOperatorProfile(*this->pipeline) : nullptr)
 {
+    if (compileInBackground)
+    {
+        options.setOption("engine.Compilation", false);
+        interpreterEngine.emplace(std::move(options));
+    }
 }
 
 void CompiledExecutablePipelineStage::execute(const TupleBuffer& inputTupleBuffer, PipelineExecutionContext& pipelineExecutionContext)
 {
     /// we call the compiled pipeline function with an input buffer and the execution context
     pipelineExecutionContext.setOperatorHandlers(operatorHandlers);
-    Arena arena(pipelineExecutionContext.getBufferManager());
-    compiledPipelineFunction(std::addressof(pipelineExecutionContext), std::addressof(inputTupleBuffer), std::addressof(arena));
+    auto* pipelineFunction = activePipelineFunction.load(std::memory_order_acquire);
+    if (pipelineFunction == std::addressof(interpretedPipelineFunction))
+    {
+        numberOfInterpretedBuffers.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /// Threads, whose ids exceed the number of WorkerThreads, e.g., compilation threads, may collide with a WorkerThread
+    if (workerArenas.empty()
+        or workerArenas[pipelineExecutionContext.getId() % workerArenas.size()]->isUsed.test_and_set(std::memory_order_acquire))
+    {
+        Arena arena(pipelineExecutionContext.getBufferManager());
+        (*pipelineFunction)(std::addressof(pipelineExecutionContext), std::addressof(inputTupleBuffer), std::addressof(arena));
+        return;
+    }
+
+    auto& workerArena = *workerArenas[pipelineExecutionContext.getId() % workerArenas.size()];
+    if (not workerArena.arena.has_value())
+    {
+        workerArena.arena.emplace(pipelineExecutionContext.getBufferManager());
+    }
+    const ArenaLease lease(*workerArena.arena, workerArena.isUsed, numberOfRetainedArenaBuffers);
+    (*pipelineFunction)(std::addressof(pipelineExecutionContext), std::addressof(inputTupleBuffer), std::addressof(*workerArena.arena));
 }
 
-nautilus::engine::CallableFunction<void, PipelineExecutionContext*, const TupleBuffer*, const Arena*>
-CompiledExecutablePipelineStage::compilePipeline() const
+CompiledExecutablePipelineStage::PipelineFunction
+CompiledExecutablePipelineStage::compilePipeline(const nautilus::engine::NautilusEngine& pipelineEngine, const bool collectsProfile) const
 {
     CPPTRACE_TRY
     {
         /// We must capture the operatorPipeline by value to ensure it is not destroyed before the function is called
         /// Additionally, we can NOT use const or const references for the parameters of the lambda function
         /// NOLINTBEGIN(performance-unnecessary-value-param)
-        const std::function compiledFunction = [&](nautilus::val<PipelineExecutionContext*> pipelineExecutionContext,
-                                                   nautilus::val<const TupleBuffer*> recordBufferRef,
-                                                   nautilus::val<const Arena*> arenaRef)
+        const std::function compiledFunction
+            = [&, collectsProfile](
+                  nautilus::val<PipelineExecutionContext*> pipelineExecutionContext,
+                  nautilus::val<const TupleBuffer*> recordBufferRef,
+                  nautilus::val<const Arena*> arenaRef)
         {
             auto ctx = ExecutionContext(pipelineExecutionContext, arenaRef);
+            ctx.collectsProfile = collectsProfile;
+            ctx.operatorProfile = collectsProfile ? nullptr : operatorProfile.get();
             RecordBuffer recordBuffer(recordBufferRef);
 
             pipeline->getRootOperator().open(ctx, recordBuffer);
             pipeline->getRootOperator().close(ctx, recordBuffer);
         };
         /// NOLINTEND(performance-unnecessary-value-param)
-        return engine.registerFunction(compiledFunction);
+        return pipelineEngine.registerFunction(compiledFunction);
     }
     CPPTRACE_CATCH(...)
     {
@@ -81,27 +191,128 @@ CompiledExecutablePipelineStage::compilePipeline() const
     std::unreachable();
 }
 
+void CompiledExecutablePipelineStage::compileInBackgroundThread(const std::stop_token& stopToken)
+{
+    setThreadName("PipelineCompiler");
+    const auto start = std::chrono::steady_clock::now();
+    while (numberOfInterpretedBuffers.load(std::memory_order_relaxed) < WARM_UP_BUFFERS
+           and std::chrono::steady_clock::now() - start < MAX_WARM_UP_DURATION and not stopToken.stop_requested())
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    try
+    {
+        compiledPipelineFunction = compilePipeline(engine, false);
+    }
+    catch (...)
+    {
+        tryLogCurrentException();
+        NES_WARNING("Could not compile pipeline {} in the background, thus it keeps being interpreted", pipeline->getPipelineId());
+        return;
+    }
+    activePipelineFunction.store(std::addressof(compiledPipelineFunction), std::memory_order_release);
+    NES_DEBUG(
+        "Switched pipeline {} to its compiled function after {}ms and {} interpreted buffers",
+        pipeline->getPipelineId(),
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count(),
+        numberOfInterpretedBuffers.load(std::memory_order_relaxed));
+}
+
 void CompiledExecutablePipelineStage::stop(PipelineExecutionContext& pipelineExecutionContext)
 {
+    /// The compilation traces the operators of the pipeline, thus it must complete before they terminate
+    if (compilerThread.joinable())
+    {
+        compilerThread.request_stop();
+        compilerThread.join();
+    }
     pipelineExecutionContext.setOperatorHandlers(operatorHandlers);
     Arena arena(pipelineExecutionContext.getBufferManager());
     ExecutionContext ctx(std::addressof(pipelineExecutionContext), std::addressof(arena));
     pipeline->getRootOperator().terminate(ctx);
+    /// Returns the retained buffers to the buffer provider
+    workerArenas.clear();
+    if (operatorProfile)
+    {
+        NES_INFO("{}", operatorProfile->toString());
+    }
+}
+
+std::vector<ExecutablePipelineStage::OperatorCost> CompiledExecutablePipelineStage::getOperatorCosts() const
+{
+    if (not operatorProfile)
+    {
+        return {};
+    }
+    std::vector<OperatorCost> operatorCosts;
+    for (auto& [operatorId, name, numberOfInvocations, inclusiveCycles, exclusiveCycles] : operatorProfile->getOperatorCycles())
+    {
+        operatorCosts.push_back(
+            {.operatorId = operatorId,
+             .name = std::move(name),
+             .numberOfInvocations = numberOfInvocations,
+             .inclusiveCycles = inclusiveCycles,
+             .exclusiveCycles = exclusiveCycles});
+    }
+    return operatorCosts;
+}
+
+uint64_t CompiledExecutablePipelineStage::getStateSizeInBytes() const
+{
+    uint64_t stateSizeInBytes = 0;
+    for (const auto& operatorHandler : operatorHandlers | std::views::values)
+    {
+        stateSizeInBytes += operatorHandler->getStateSizeInBytes();
+    }
+    return stateSizeInBytes;
+}
+
+std::vector<uint64_t> CompiledExecutablePipelineStage::getStateSizeInBytesPerWorkerThread() const
+{
+    std::vector<uint64_t> stateSizeInBytesPerWorkerThread;
+    for (const auto& operatorHandler : operatorHandlers | std::views::values)
+    {
+        const auto handlerStateSizeInBytes = operatorHandler->getStateSizeInBytesPerWorkerThread();
+        stateSizeInBytesPerWorkerThread.resize(std::max(stateSizeInBytesPerWorkerThread.size(), handlerStateSizeInBytes.size()), 0);
+        for (size_t workerThread = 0; workerThread < handlerStateSizeInBytes.size(); ++workerThread)
+        {
+            stateSizeInBytesPerWorkerThread[workerThread] += handlerStateSizeInBytes[workerThread];
+        }
+    }
+    return stateSizeInBytesPerWorkerThread;
 }
 
 std::ostream& CompiledExecutablePipelineStage::toString(std::ostream& os) const
 {
-    return os << "CompiledExecutablePipelineStage()";
+    return os << "CompiledExecutablePipelineStage(tiered: " << interpreterEngine.has_value() << ")";
 }
 
 void CompiledExecutablePipelineStage::start(PipelineExecutionContext& pipelineExecutionContext)
 {
     pipelineExecutionContext.setOperatorHandlers(operatorHandlers);
+    if (numberOfRetainedArenaBuffers > 0)
+    {
+        for (size_t workerThread = 0; workerThread < pipelineExecutionContext.getNumberOfWorkerThreads(); ++workerThread)
+        {
+            workerArenas.emplace_back(std::make_unique<WorkerArena>());
+        }
+    }
     Arena arena(pipelineExecutionContext.getBufferManager());
     ExecutionContext ctx(std::addressof(pipelineExecutionContext), std::addressof(arena));
+    if (interpreterEngine.has_value())
+    {
+        /// Functions that the operators register during the setup are interpreted as well, which solely affects their setup and cleanup
+        CompilationContext compilationCtx{*interpreterEngine};
+        pipeline->getRootOperator().setup(ctx, compilationCtx);
+        interpretedPipelineFunction = this->compilePipeline(*interpreterEngine, true);
+        activePipelineFunction.store(std::addressof(interpretedPipelineFunction), std::memory_order_release);
+        compilerThread = std::jthread([this](const std::stop_token& stopToken) { compileInBackgroundThread(stopToken); });
+        return;
+    }
     CompilationContext compilationCtx{engine};
     pipeline->getRootOperator().setup(ctx, compilationCtx);
-    compiledPipelineFunction = this->compilePipeline();
+    compiledPipelineFunction = this->compilePipeline(engine, false);
+    activePipelineFunction.store(std::addressof(compiledPipelineFunction), std::memory_order_release);
 }
 
 }
@@ -0,0 +1,48 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Pipelines/ForwardingExecutablePipelineStage.hpp>
+
+#include <ostream>
+#include <Identifiers/Identifiers.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <PipelineExecutionContext.hpp>
+
+namespace NES
+{
+
+ForwardingExecutablePipelineStage::ForwardingExecutablePipelineStage(const PipelineId pipelineId) : pipelineId(pipelineId)
+{
+}
+
+void ForwardingExecutablePipelineStage::start(PipelineExecutionContext&)
+{
+}
+
+void ForwardingExecutablePipelineStage::execute(const TupleBuffer& inputTupleBuffer, PipelineExecutionContext& pipelineExecutionContext)
+{
+    /// The buffer keeps its origin id, sequence number and chunk number, as the pipeline emits exactly one buffer per input buffer
+    pipelineExecutionContext.emitBuffer(inputTupleBuffer, PipelineExecutionContext::ContinuationPolicy::POSSIBLE);
+}
+
+void ForwardingExecutablePipelineStage::stop(PipelineExecutionContext&)
+{
+}
+
+std::ostream& ForwardingExecutablePipelineStage::toString(std::ostream& os) const
+{
+    return os << "ForwardingExecutablePipelineStage(pipeline: " << pipelineId << ")";
+}
+
+}
@@ -18,6 +18,7 @@
 #include <memory>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 #include <Identifiers/Identifiers.hpp>
 #include <Listeners/QueryLog.hpp>
 #include <Listeners/SystemEventListener.hpp>
@@ -110,6 +111,7 @@ void NodeEngine::startQuery(QueryId queryId)
     {
         systemEventListener->onEvent(StartQuerySystemEvent(queryId));
         queryEngine->start(ExecutableQueryPlan::instantiate(*qep, *sourceProvider));
+        reportBufferSizeClassOccupancy();
     }
     else
     {
@@ -130,6 +132,30 @@ void NodeEngine::stopQuery(QueryId queryId, QueryTerminationType)
     NES_INFO("Stop {}", queryId);
     systemEventListener->onEvent(StopQuerySystemEvent(queryId));
     queryEngine->stop(queryId);
+    reportBufferSizeClassOccupancy();
+}
+
+std::vector<PipelineMetrics> NodeEngine::getPipelineMetrics(const QueryId queryId) const
+{
+    return queryEngine->getPipelineMetrics(queryId);
+}
+
+EngineMetrics NodeEngine::getEngineMetrics() const
+{
+    return queryEngine->getEngineMetrics();
+}
+
+std::optional<QueryMemoryMetrics> NodeEngine::getQueryMemory(const QueryId queryId) const
+{
+    return queryEngine->getQueryMemory(queryId);
+}
+
+void NodeEngine::reportBufferSizeClassOccupancy() const
+{
+    for (const auto& [bufferSize, numberOfBuffers, numberOfAvailableBuffers] : bufferManager->getSizeClassOccupancy())
+    {
+        systemEventListener->onEvent(BufferSizeClassOccupancySystemEvent(bufferSize, numberOfBuffers, numberOfAvailableBuffers));
+    }
 }
 
 }
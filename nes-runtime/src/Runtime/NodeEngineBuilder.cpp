@@ -14,18 +14,108 @@
 
 #include <Runtime/NodeEngineBuilder.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <memory_resource>
+#include <thread>
 #include <utility>
+#include <vector>
 #include <Configuration/WorkerConfiguration.hpp>
 #include <Listeners/QueryLog.hpp>
+#include <Runtime/Allocator/NesDefaultMemoryAllocator.hpp>
+#include <Runtime/Allocator/NesMmapMemoryAllocator.hpp>
 #include <Runtime/BufferManager.hpp>
 #include <Runtime/NodeEngine.hpp>
+#include <Sources/AsyncSourceRuntime.hpp>
 #include <Sources/SourceProvider.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/NumaTopology.hpp>
+#include <Util/ThreadNaming.hpp>
+#include <fmt/format.h>
 #include <QueryEngine.hpp>
 
 namespace NES
 {
 
+namespace
+{
+std::shared_ptr<std::pmr::memory_resource> createBufferPoolAllocator(const WorkerConfiguration& configuration)
+{
+    const auto lockMemory = configuration.lockBufferPoolMemory.getValue();
+    switch (configuration.bufferPoolAllocator.getValue())
+    {
+        case BufferPoolAllocator::DEFAULT:
+            if (lockMemory)
+            {
+                NES_WARNING("lock_buffer_pool_memory requires an mmap based buffer pool allocator and is ignored");
+            }
+            return std::make_shared<NesDefaultMemoryAllocator>();
+        case BufferPoolAllocator::MMAP:
+            return std::make_shared<NesMmapMemoryAllocator>(HugePagePolicy::NONE, lockMemory);
+        case BufferPoolAllocator::TRANSPARENT_HUGE_PAGES:
+            return std::make_shared<NesMmapMemoryAllocator>(HugePagePolicy::TRANSPARENT, lockMemory);
+        case BufferPoolAllocator::HUGE_PAGES:
+            return std::make_shared<NesMmapMemoryAllocator>(HugePagePolicy::EXPLICIT, lockMemory);
+    }
+    std::unreachable();
+}
+
+/// The buffers of every size class are split across the given number of buffer managers
+std::vector<BufferSizeClass> createBufferSizeClasses(const WorkerConfiguration& configuration, size_t numberOfBufferManagers)
+{
+    const auto buffersPerSizeClass
+        = std::max<size_t>(1, configuration.numberOfBuffersPerSizeClass.getValue() / numberOfBufferManagers);
+    std::vector<BufferSizeClass> sizeClasses;
+    for (const auto& bufferSize : configuration.bufferSizeClasses.getValues())
+    {
+        sizeClasses.emplace_back(static_cast<uint32_t>(bufferSize.getValue()), static_cast<uint32_t>(buffersPerSizeClass));
+    }
+    return sizeClasses;
+}
+
+/// Creates one buffer manager per NUMA node. Each buffer manager is created on a thread which is pinned to the CPUs of its node, thus
+/// the first touch of its memory happens on the node. The mmap based allocators pre-fault the payload on threads with the same CPU
+/// affinity, otherwise the payload is first touched by the WorkerThreads of the node, which are the only ones allocating from the pool.
+std::vector<std::shared_ptr<BufferManager>> createNumaLocalBufferManagers(const WorkerConfiguration& configuration)
+{
+    const auto topology = getNumaTopology();
+    const auto configuredNodes = configuration.numberOfNumaNodes.getValue();
+    auto numberOfNodes = configuredNodes == 0 ? topology.size() : configuredNodes;
+    if (numberOfNodes > topology.size())
+    {
+        NES_WARNING("Configured {} NUMA nodes, but only {} are available", numberOfNodes, topology.size());
+        numberOfNodes = topology.size();
+    }
+
+    const auto buffersPerNode = std::max<size_t>(1, configuration.numberOfBuffersInGlobalBufferManager.getValue() / numberOfNodes);
+    std::vector<std::shared_ptr<BufferManager>> bufferManagers(numberOfNodes);
+    {
+        std::vector<std::jthread> allocationThreads;
+        allocationThreads.reserve(numberOfNodes);
+        for (size_t node = 0; node < numberOfNodes; ++node)
+        {
+            allocationThreads.emplace_back(
+                [&, node]
+                {
+                    setThreadName(fmt::format("NumaAlloc-{}", topology[node].id));
+                    pinCurrentThread(topology[node].cpus);
+                    bufferManagers[node] = BufferManager::create(
+                        configuration.bufferSizeInBytes.getValue(),
+                        buffersPerNode,
+                        createBufferPoolAllocator(configuration),
+                        BufferManager::DEFAULT_ALIGNMENT,
+                        configuration.bufferCacheSize.getValue(),
+                        createBufferSizeClasses(configuration, numberOfNodes));
+                });
+        }
+    }
+    return bufferManagers;
+}
+}
+
 
 NodeEngineBuilder::NodeEngineBuilder(const WorkerConfiguration& workerConfiguration, std::shared_ptr<StatisticListener> statisticsListener)
     : workerConfiguration(workerConfiguration), statisticsListener(std::move(statisticsListener))
@@ -34,13 +124,44 @@ NodeEngineBuilder::NodeEngineBuilder(const WorkerConfiguration& workerConfigurat
 
 std::unique_ptr<NodeEngine> NodeEngineBuilder::build()
 {
-    auto bufferManager = BufferManager::create(
-        workerConfiguration.bufferSizeInBytes.getValue(), workerConfiguration.numberOfBuffersInGlobalBufferManager.getValue());
     auto queryLog = std::make_shared<QueryLog>();
+    std::shared_ptr<BufferManager> bufferManager;
+    std::unique_ptr<QueryEngine> queryEngine;
+    const auto start = std::chrono::steady_clock::now();
+    auto bufferPoolsCreated = start;
+    if (workerConfiguration.numberOfNumaNodes.getValue() == 1)
+    {
+        bufferManager = BufferManager::create(
+            workerConfiguration.bufferSizeInBytes.getValue(),
+            workerConfiguration.numberOfBuffersInGlobalBufferManager.getValue(),
+            createBufferPoolAllocator(workerConfiguration),
+            BufferManager::DEFAULT_ALIGNMENT,
+            workerConfiguration.bufferCacheSize.getValue(),
+            createBufferSizeClasses(workerConfiguration, 1));
+        bufferPoolsCreated = std::chrono::steady_clock::now();
+        queryEngine = std::make_unique<QueryEngine>(workerConfiguration.queryEngine, statisticsListener, queryLog, bufferManager);
+    }
+    else
+    {
+        auto numaLocalBufferManagers = createNumaLocalBufferManagers(workerConfiguration);
+        bufferPoolsCreated = std::chrono::steady_clock::now();
+        /// Sources and all other non-worker threads use the buffer manager of the first NUMA node
+        bufferManager = numaLocalBufferManagers.front();
+        queryEngine = std::make_unique<QueryEngine>(
+            workerConfiguration.queryEngine, statisticsListener, queryLog, std::move(numaLocalBufferManagers));
+    }
+    NES_INFO(
+        "Created the buffer pools in {}ms and the query engine in {}ms",
+        std::chrono::duration_cast<std::chrono::milliseconds>(bufferPoolsCreated - start).count(),
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - bufferPoolsCreated).count());
 
-    auto queryEngine = std::make_unique<QueryEngine>(workerConfiguration.queryEngine, statisticsListener, queryLog, bufferManager);
-
-    auto sourceProvider = std::make_unique<SourceProvider>(workerConfiguration.defaultMaxInflightBuffers.getValue(), bufferManager);
+    std::shared_ptr<AsyncSourceRuntime> asyncSourceRuntime;
+    if (workerConfiguration.numberOfAsyncSourceThreads.getValue() > 0)
+    {
+        asyncSourceRuntime = std::make_shared<AsyncSourceRuntime>(workerConfiguration.numberOfAsyncSourceThreads.getValue());
+    }
+    auto sourceProvider = std::make_unique<SourceProvider>(
+        workerConfiguration.defaultMaxInflightBuffers.getValue(), bufferManager, std::move(asyncSourceRuntime));
 
     return std::make_unique<NodeEngine>(
         std::move(bufferManager), statisticsListener, std::move(queryLog), std::move(queryEngine), std::move(sourceProvider));
@@ -0,0 +1,106 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <Identifiers/Identifiers.hpp>
+#include <Pipelines/ForwardingExecutablePipelineStage.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Time/Timestamp.hpp>
+#include <TestTaskQueue.hpp>
+
+namespace NES
+{
+
+class ForwardingExecutablePipelineStageTest : public ::testing::Test
+{
+protected:
+    static constexpr size_t BUFFER_SIZE = 1024;
+    static constexpr size_t NUMBER_OF_BUFFERS = 16;
+
+    TupleBuffer createBuffer(const uint64_t sequenceNumber, const uint64_t chunkNumber, const bool isLastChunk) const
+    {
+        auto buffer = bufferManager->getBufferBlocking();
+        buffer.setOriginId(OriginId(3));
+        buffer.setSequenceNumber(SequenceNumber(sequenceNumber));
+        buffer.setChunkNumber(ChunkNumber(chunkNumber));
+        buffer.setLastChunk(isLastChunk);
+        buffer.setWatermark(Timestamp(sequenceNumber * 1000));
+        buffer.setCreationTimestampInMS(Timestamp(42));
+        buffer.setNumberOfTuples(sequenceNumber + chunkNumber);
+        return buffer;
+    }
+
+    std::shared_ptr<BufferManager> bufferManager = BufferManager::create(BUFFER_SIZE, NUMBER_OF_BUFFERS);
+    std::shared_ptr<std::vector<std::vector<TupleBuffer>>> resultBuffers = std::make_shared<std::vector<std::vector<TupleBuffer>>>(1);
+    TestPipelineExecutionContext pipelineExecutionContext{bufferManager, resultBuffers};
+    ForwardingExecutablePipelineStage stage{PipelineId(1)};
+};
+
+/// NOLINTBEGIN(readability-magic-numbers)
+TEST_F(ForwardingExecutablePipelineStageTest, EmitsTheInputBufferWithItsSequenceNumbersChunkNumbersAndLastChunkFlags)
+{
+    /// The chunks of sequence number 1 arrive out of order and sequence number 2 has a single chunk
+    const std::vector inputBuffers{
+        createBuffer(1, 2, false), createBuffer(1, 3, true), createBuffer(2, 1, true), createBuffer(1, 1, false)};
+    stage.start(pipelineExecutionContext);
+    for (const auto& inputBuffer : inputBuffers)
+    {
+        stage.execute(inputBuffer, pipelineExecutionContext);
+    }
+    stage.stop(pipelineExecutionContext);
+
+    const auto& emittedBuffers = resultBuffers->front();
+    ASSERT_EQ(emittedBuffers.size(), inputBuffers.size());
+    for (size_t bufferIdx = 0; bufferIdx < inputBuffers.size(); ++bufferIdx)
+    {
+        const auto& input = inputBuffers[bufferIdx];
+        const auto& emitted = emittedBuffers[bufferIdx];
+        /// The stage neither copies the records nor allocates a buffer
+        EXPECT_EQ(emitted.getAvailableMemoryArea().data(), input.getAvailableMemoryArea().data());
+        EXPECT_EQ(emitted.getNumberOfTuples(), input.getNumberOfTuples());
+        EXPECT_EQ(emitted.getOriginId(), input.getOriginId());
+        EXPECT_EQ(emitted.getSequenceNumber(), input.getSequenceNumber());
+        EXPECT_EQ(emitted.getChunkNumber(), input.getChunkNumber());
+        EXPECT_EQ(emitted.isLastChunk(), input.isLastChunk());
+        EXPECT_EQ(emitted.getWatermark(), input.getWatermark());
+        EXPECT_EQ(emitted.getCreationTimestampInMS(), input.getCreationTimestampInMS());
+    }
+    EXPECT_EQ(bufferManager->getNumberOfAvailableBuffers(), NUMBER_OF_BUFFERS - inputBuffers.size());
+}
+
+TEST_F(ForwardingExecutablePipelineStageTest, EmitsTheChildBuffersOfTheInputBuffer)
+{
+    auto inputBuffer = createBuffer(1, 1, true);
+    auto childBuffer = bufferManager->getBufferBlocking();
+    childBuffer.getAvailableMemoryArea<uint64_t>()[0] = 7;
+    const auto childBufferIndex = inputBuffer.storeChildBuffer(childBuffer);
+
+    stage.execute(inputBuffer, pipelineExecutionContext);
+
+    ASSERT_EQ(resultBuffers->front().size(), 1U);
+    const auto& emitted = resultBuffers->front().front();
+    ASSERT_EQ(emitted.getNumberOfChildBuffers(), 1U);
+    EXPECT_EQ(emitted.loadChildBuffer(childBufferIndex).getAvailableMemoryArea<uint64_t>()[0], 7U);
+}
+
+/// NOLINTEND(readability-magic-numbers)
+
+}
@@ -0,0 +1,70 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstddef>
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include <Runtime/BufferManager.hpp>
+#include <ExecutionContext.hpp>
+
+namespace NES
+{
+
+class ArenaTest : public ::testing::Test
+{
+protected:
+    static constexpr size_t BUFFER_SIZE = 1024;
+    static constexpr size_t NUMBER_OF_BUFFERS = 8;
+
+    std::shared_ptr<BufferManager> bufferManager = BufferManager::create(BUFFER_SIZE, NUMBER_OF_BUFFERS);
+};
+
+/// NOLINTBEGIN(readability-magic-numbers)
+TEST_F(ArenaTest, AllocationsThatDoNotFitContinueInTheNextBuffer)
+{
+    Arena arena(bufferManager);
+    const auto first = arena.allocateMemory(600);
+    const auto second = arena.allocateMemory(400);
+    const auto third = arena.allocateMemory(100);
+    EXPECT_EQ(second.data(), first.data() + 600);
+    EXPECT_EQ(arena.fixedSizeBuffers.size(), 2);
+    EXPECT_EQ(third.data(), arena.fixedSizeBuffers[1].getAvailableMemoryArea().data());
+}
+
+TEST_F(ArenaTest, ResetRetainsBuffersForTheNextInvocation)
+{
+    Arena arena(bufferManager);
+    const auto first = arena.allocateMemory(BUFFER_SIZE);
+    const auto second = arena.allocateMemory(BUFFER_SIZE);
+    arena.allocateMemory(BUFFER_SIZE);
+    arena.allocateMemory(4 * BUFFER_SIZE);
+    EXPECT_EQ(bufferManager->getNumberOfAvailableBuffers(), NUMBER_OF_BUFFERS - 3);
+
+    arena.reset(2);
+    EXPECT_EQ(bufferManager->getNumberOfAvailableBuffers(), NUMBER_OF_BUFFERS - 2);
+    EXPECT_TRUE(arena.unpooledBuffers.empty());
+
+    /// The next invocation reuses the retained buffers in the same order
+    EXPECT_EQ(arena.allocateMemory(BUFFER_SIZE).data(), first.data());
+    EXPECT_EQ(arena.allocateMemory(8).data(), second.data());
+    EXPECT_EQ(bufferManager->getNumberOfAvailableBuffers(), NUMBER_OF_BUFFERS - 2);
+
+    arena.reset(0);
+    EXPECT_EQ(bufferManager->getNumberOfAvailableBuffers(), NUMBER_OF_BUFFERS);
+}
+/// NOLINTEND(readability-magic-numbers)
+
+}
@@ -329,4 +329,35 @@ TEST_F(RowMemoryLayoutTest, getFieldOffset)
     ASSERT_EXCEPTION_ERRORCODE(auto result = columnLayout->getFieldOffset(1000000000, 2), ErrorCode::CannotAccessBuffer);
 }
 
+/**
+ * @brief Tests that the hot fields are placed first, all fields are aligned, and the records keep their logical field order.
+ */
+TEST_F(RowMemoryLayoutTest, optimizeFieldPlacement)
+{
+    const auto schema = Schema{Schema::MemoryLayoutType::ROW_LAYOUT}
+                            .addField("t1", DataType::Type::UINT8)
+                            .addField("t2", DataType::Type::UINT64)
+                            .addField("t3", DataType::Type::UINT16)
+                            .addField("t4", DataType::Type::UINT32)
+                            .addField("t5", DataType::Type::UINT64);
+    const auto rowLayout = RowLayout::create(bufferManager->getBufferSize(), schema);
+    rowLayout->optimizeFieldPlacement({"t3", "t5", "unknown"});
+
+    ASSERT_EQ(rowLayout->getFieldOffset(4), 0);
+    ASSERT_EQ(rowLayout->getFieldOffset(2), 8);
+    ASSERT_EQ(rowLayout->getFieldOffset(1), 16);
+    ASSERT_EQ(rowLayout->getFieldOffset(3), 24);
+    ASSERT_EQ(rowLayout->getFieldOffset(0), 28);
+    ASSERT_EQ(rowLayout->getTupleSize(), 32);
+    ASSERT_EQ(rowLayout->getCapacity(), bufferManager->getBufferSize() / 32);
+    ASSERT_EQ(rowLayout->getFieldOffset(2, 1), (32 * 2) + 16);
+
+    auto tupleBuffer = bufferManager->getBufferBlocking();
+    const auto testBuffer = std::make_unique<TestTupleBuffer>(rowLayout, tupleBuffer);
+    const std::tuple<uint8_t, uint64_t, uint16_t, uint32_t, uint64_t> writeRecord(1, 2, 3, 4, 5);
+    testBuffer->pushRecordToBuffer(writeRecord);
+    testBuffer->pushRecordToBuffer(writeRecord);
+    ASSERT_EQ((testBuffer->readRecordFromBuffer<uint8_t, uint64_t, uint16_t, uint32_t, uint64_t>(1)), writeRecord);
+}
+
 }
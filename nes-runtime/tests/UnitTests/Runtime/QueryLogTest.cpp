@@ -132,6 +132,23 @@ TEST_F(QueryLogTest, GetQuerySummaryPartialExecution)
     EXPECT_FALSE(status->metrics.error.has_value());
 }
 
+TEST_F(QueryLogTest, GetQuerySummaryOfCompilingQuery)
+{
+    queryLog->logQueryStatusChange(testQueryId, QueryState::Compiling, testTime);
+    EXPECT_EQ(queryLog->getQueryStatus(testQueryId)->state, QueryState::Compiling);
+
+    queryLog->logQueryStatusChange(testQueryId, QueryState::Registered, testTime + 100ms);
+    EXPECT_EQ(queryLog->getQueryStatus(testQueryId)->state, QueryState::Registered);
+
+    constexpr QueryId failedQuery{43};
+    queryLog->logQueryStatusChange(failedQuery, QueryState::Compiling, testTime);
+    queryLog->logQueryFailure(failedQuery, Exception{"Compilation failed", 2126}, testTime + 100ms);
+    const auto status = queryLog->getQueryStatus(failedQuery);
+    ASSERT_TRUE(status.has_value());
+    EXPECT_EQ(status->state, QueryState::Failed);
+    EXPECT_EQ(status->metrics.error->code(), 2126);
+}
+
 TEST_F(QueryLogTest, GetQuerySummaryForNonExistentQuery)
 {
     const auto status = queryLog->getQueryStatus(QueryId{999});
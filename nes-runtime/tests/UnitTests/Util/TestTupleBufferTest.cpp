@@ -22,6 +22,7 @@
 #include <DataTypes/DataType.hpp>
 #include <DataTypes/DataTypeProvider.hpp>
 #include <DataTypes/Schema.hpp>
+#include <MemoryLayout/VariableSizedAccess.hpp>
 #include <Runtime/BufferManager.hpp>
 #include <Util/Logger/LogLevel.hpp>
 #include <Util/Logger/Logger.hpp>
@@ -349,6 +350,25 @@ TEST_P(TestTupleBufferTest, DynamicTupleCompareVarSizeData)
     ASSERT_TRUE((*testBufferVarSize)[1] == (*testBufferVarSize)[3]);
 }
 
+TEST_P(TestTupleBufferTest, shortVarSizedDataIsStoredInline)
+{
+    /// Var sized data of up to four bytes fits into the field and thus does not require a child buffer
+    const std::string shortValue(VariableSizedAccess::INLINE_CAPACITY, 'a');
+    (*testBufferVarSize)[0].writeVarSized("test$t2", "", *bufferManager);
+    (*testBufferVarSize)[0].writeVarSized("test$t4", shortValue, *bufferManager);
+    ASSERT_EQ(testBufferVarSize->getBuffer().getNumberOfChildBuffers(), 0);
+    ASSERT_EQ((*testBufferVarSize)[0].readVarSized("test$t2"), "");
+    ASSERT_EQ((*testBufferVarSize)[0].readVarSized("test$t4"), shortValue);
+
+    const std::string longValue(VariableSizedAccess::INLINE_CAPACITY + 1, 'b');
+    (*testBufferVarSize)[1].writeVarSized("test$t2", longValue, *bufferManager);
+    (*testBufferVarSize)[1].writeVarSized("test$t4", shortValue, *bufferManager);
+    ASSERT_EQ(testBufferVarSize->getBuffer().getNumberOfChildBuffers(), 1);
+    ASSERT_EQ((*testBufferVarSize)[1].readVarSized("test$t2"), longValue);
+    ASSERT_EQ((*testBufferVarSize)[1].readVarSized("test$t4"), shortValue);
+    ASSERT_EQ((*testBufferVarSize)[0].readVarSized("test$t4"), shortValue);
+}
+
 INSTANTIATE_TEST_CASE_P(
     TestInputs,
     TestTupleBufferTest,
@@ -14,12 +14,16 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <deque>
 #include <filesystem>
 #include <fstream>
+#include <mutex>
+#include <ostream>
 #include <stop_token>
 #include <string>
 #include <thread>
@@ -27,6 +31,7 @@
 #include <unordered_map>
 #include <utility>
 #include <variant>
+#include <vector>
 #include <Identifiers/Identifiers.hpp>
 #include <Listeners/StatisticListener.hpp>
 #include <folly/MPMCQueue.h>
@@ -46,15 +51,27 @@ namespace NES
 {
 /// This printer generates Chrome DevTools trace files that can be opened in Chrome's
 /// chrome://tracing/ interface for performance analysis (or any other event trace visualizer)
+/// The emitting threads write their events into one of several lock-free queues, such that the WorkerThreads do not contend on a single
+/// queue. Task events are sampled by their task id, thus the start and the completion of a task are either both traced or both dropped.
+/// In the flight recorder mode, the printer solely retains the events of the last seconds in memory. These are dumped on demand, e.g., via
+/// the gRPC interface or SIGUSR1, and written to the trace file once the printer stops.
 struct GoogleEventTracePrinter final : StatisticListener
 {
+    struct Configuration
+    {
+        /// Traces the events of every n-th task. One traces all tasks.
+        size_t samplingRate = 1;
+        /// Zero writes all events continuously to the trace file
+        std::chrono::seconds flightRecorderDuration{0};
+    };
+
     using CombinedEventType = FlattenVariant<SystemEvent, Event>::type;
     void onEvent(Event event) override;
     void onEvent(SystemEvent event) override;
 
     /// Constructs a GoogleEventTracePrinter that writes to the specified file path
     /// @param path The file path where the trace will be written
-    explicit GoogleEventTracePrinter(const std::filesystem::path& path);
+    explicit GoogleEventTracePrinter(const std::filesystem::path& path, Configuration configuration = {});
     ~GoogleEventTracePrinter() override;
 
     /// Start the event processing thread. Must be called after construction.
@@ -63,8 +80,23 @@ struct GoogleEventTracePrinter final : StatisticListener
     /// Flushes the trace file and closes it, blocking until all pending events are written
     void flush();
 
+    /// Writes the retained events of the flight recorder into a new trace file next to the trace file and returns its path.
+    /// In the continuous mode, the trace file is flushed instead.
+    std::filesystem::path dump();
+
+    /// Async-signal-safe, the trace thread of every printer dumps once it observes the request
+    static void requestDump() noexcept;
+
 private:
     static constexpr size_t QUEUE_LENGTH = 1000;
+    static constexpr size_t NUMBER_OF_SHARDS = 16;
+
+    /// An event of the flight recorder, in the serialized form of the trace file
+    struct RecordedEvent
+    {
+        uint64_t timestamp;
+        std::string json;
+    };
 
     enum class Category : int
     {
@@ -78,7 +110,8 @@ private:
     {
         Begin,
         End,
-        Instant
+        Instant,
+        Counter
     };
 
     static uint64_t timestampToMicroseconds(const std::chrono::system_clock::time_point& timestamp);
@@ -90,9 +123,17 @@ private:
     void threadRoutine(const std::stop_token& token);
     void writeTraceHeader();
     void writeTraceFooter();
-
+    /// Retains the event in the flight recorder and evicts all events that are older than the flight recorder duration
+    void record(const nlohmann::json& event);
+    /// Writes a complete trace of the events, ordered by their timestamps
+    static void writeTrace(std::ostream& out, std::vector<RecordedEvent> recordedEvents);
+    /// Queue of the calling thread
+    folly::MPMCQueue<CombinedEventType>& shardOfThisThread();
+
+    std::filesystem::path path;
+    Configuration configuration;
     std::ofstream file;
-    folly::MPMCQueue<CombinedEventType> events{QUEUE_LENGTH};
+    std::array<folly::MPMCQueue<CombinedEventType>, NUMBER_OF_SHARDS> events;
     std::jthread traceThread;
     std::atomic<bool> headerWritten{false};
     std::atomic<bool> footerWritten{false};
@@ -103,5 +144,12 @@ private:
     /// Track active queries and pipelines for cleanup
     std::unordered_map<QueryId, std::pair<std::chrono::system_clock::time_point, WorkerThreadId>> activeQueries;
     std::unordered_map<PipelineId, std::tuple<QueryId, std::chrono::system_clock::time_point, WorkerThreadId>> activePipelines;
+
+    std::mutex flightRecorderMutex;
+    std::deque<RecordedEvent> flightRecorder;
+    uint64_t latestRecordedTimestamp = 0;
+
+    inline static std::atomic<size_t> nextShard{0};
+    inline static std::atomic<bool> dumpRequested{false};
 };
 }
@@ -13,6 +13,7 @@
 */
 
 #pragma once
+#include <Serialization/PlanFragmentCache.hpp>
 #include <SingleNodeWorker.hpp>
 #include <SingleNodeWorkerRPCService.grpc.pb.h>
 
@@ -27,19 +28,32 @@ class GRPCServer final : public WorkerRPCService::Service
 public:
     grpc::Status RegisterQuery(grpc::ServerContext*, const RegisterQueryRequest*, RegisterQueryReply*) override;
 
+    grpc::Status
+    RegisterAndStartQueries(grpc::ServerContext*, const RegisterQueriesRequest*, grpc::ServerWriter<QueryDeploymentReply>*) override;
+
     grpc::Status UnregisterQuery(grpc::ServerContext*, const UnregisterQueryRequest*, google::protobuf::Empty*) override;
 
     grpc::Status StartQuery(grpc::ServerContext*, const StartQueryRequest*, google::protobuf::Empty*) override;
 
     grpc::Status StopQuery(grpc::ServerContext*, const StopQueryRequest*, google::protobuf::Empty*) override;
 
+    grpc::Status UpdateQueryParameters(grpc::ServerContext*, const UpdateQueryParametersRequest*, google::protobuf::Empty*) override;
+
     grpc::Status RequestQueryStatus(grpc::ServerContext*, const QueryStatusRequest*, QueryStatusReply*) override;
 
     grpc::Status RequestQueryLog(grpc::ServerContext* context, const QueryLogRequest* request, QueryLogReply* response) override;
 
+    grpc::Status StreamQueryMetrics(grpc::ServerContext*, const QueryMetricsRequest*, grpc::ServerWriter<QueryMetricsReply>*) override;
+
+    grpc::Status RequestWorkerMetrics(grpc::ServerContext*, const google::protobuf::Empty*, WorkerMetricsReply*) override;
+
+    grpc::Status DumpEventTrace(grpc::ServerContext*, const google::protobuf::Empty*, DumpEventTraceReply*) override;
+
     explicit GRPCServer(SingleNodeWorker&& delegate) : delegate(std::move(delegate)) { }
 
 private:
     SingleNodeWorker delegate;
+    /// Operators of the registered plans, which clients reference by their hash in subsequent plans
+    PlanFragmentCache fragmentCache;
 };
 }
@@ -0,0 +1,29 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <string>
+#include <Runtime/BufferManager.hpp>
+#include <QueryEngine.hpp>
+
+namespace NES
+{
+
+/// Renders the state of the worker in the OpenMetrics text format, which Prometheus scrapes. All values are read from counters and
+/// gauges that the WorkerThreads and sources maintain anyway, thus rendering the metrics does not slow down query processing.
+/// The watermark lag of a source is the distance of its watermark to the leading source of its query.
+std::string renderOpenMetrics(const EngineMetrics& engineMetrics, const BufferManager& bufferManager);
+
+}
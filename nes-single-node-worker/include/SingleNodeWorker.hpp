@@ -14,9 +14,16 @@
 
 #pragma once
 
+#include <cstddef>
 #include <expected>
+#include <filesystem>
+#include <functional>
 #include <memory>
 #include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <Functions/QueryParameters.hpp>
 #include <Identifiers/Identifiers.hpp>
 #include <Listeners/QueryLog.hpp>
 #include <Plans/LogicalPlan.hpp>
@@ -24,15 +31,21 @@
 #include <Runtime/NodeEngine.hpp>
 #include <Runtime/QueryTerminationType.hpp>
 #include <Util/Pointers.hpp>
+#include <folly/Synchronized.h>
 #include <CompositeStatisticListener.hpp>
 #include <ErrorHandling.hpp>
+#include <GoogleEventTracePrinter.hpp>
 #include <QueryCompiler.hpp>
+#include <QueryEngine.hpp>
 #include <QueryOptimizer.hpp>
+#include <QueryPriority.hpp>
 #include <SingleNodeWorkerConfiguration.hpp>
 
 namespace NES
 {
 
+class BackgroundQueryCompilation;
+
 /// @brief The SingleNodeWorker is a compiling StreamProcessingEngine, working alone on local sources and sinks, without external
 /// coordination. The SingleNodeWorker can register LogicalQueryPlans which are lowered into an executable format, by the
 /// QueryCompiler. The user can manage the lifecycle of queries inside the NodeEngine using the SingleNodeWorkers interface.
@@ -40,10 +53,19 @@ namespace NES
 class SingleNodeWorker
 {
     SharedPtr<CompositeStatisticListener> listener;
+    /// Null if the Google Event Trace is disabled
+    SharedPtr<GoogleEventTracePrinter> eventTracePrinter;
     SharedPtr<NodeEngine> nodeEngine;
     UniquePtr<QueryOptimizer> optimizer;
     UniquePtr<QueryCompilation::QueryCompiler> compiler;
     SingleNodeWorkerConfiguration configuration;
+    /// Parameters of the registered queries which declare at least one parameter
+    UniquePtr<folly::Synchronized<std::unordered_map<QueryId, SharedPtr<QueryParameters>>>> queryParameters;
+    /// Declared last, as its threads use the compiler and the NodeEngine until they are joined
+    UniquePtr<BackgroundQueryCompilation> backgroundCompilation;
+
+    /// Assigns the QueryId to the plan and optimizes it. Collects the parameters that the lowering of the plan creates.
+    std::unique_ptr<QueryCompilation::QueryCompilationRequest> createCompilationRequest(LogicalPlan& plan);
 
 public:
     explicit SingleNodeWorker(const SingleNodeWorkerConfiguration&);
@@ -59,8 +81,31 @@ public:
     /// Registers a DecomposedQueryPlan which internally triggers the QueryCompiler and registers the executable query plan. Once
     /// returned the query can be started with the QueryId. The registered Query will be in the StoppedState
     /// @param plan Fully Specified LogicalQueryPlan.
+    /// @param priority the priority class of the tasks of the query
     /// @return QueryId which identifies the registered Query
-    [[nodiscard]] std::expected<QueryId, Exception> registerQuery(LogicalPlan plan) noexcept;
+    [[nodiscard]] std::expected<QueryId, Exception>
+    registerQuery(LogicalPlan plan, QueryPriority priority = QueryPriority::NORMAL) noexcept;
+
+    /// Optimizes the plan and returns before the query is compiled. The query is Compiling until one of the numberOfCompilationThreads
+    /// compiled it, afterward the query is Registered, respectively Failed if its compilation threw. A query which is unregistered
+    /// while it is compiling is Stopped once its compilation completed.
+    /// @return QueryId which identifies the compiling Query
+    [[nodiscard]] std::expected<QueryId, Exception>
+    registerQueryAsync(LogicalPlan plan, QueryPriority priority = QueryPriority::NORMAL) noexcept;
+
+    struct QueryDeployment
+    {
+        LogicalPlan plan;
+        QueryPriority priority = QueryPriority::NORMAL;
+    };
+
+    /// Called once per deployment with its index and the id of the started query, respectively the reason why the deployment failed
+    using OnQueryDeployed = std::function<void(size_t index, std::expected<QueryId, Exception> result)>;
+
+    /// Registers and starts the queries concurrently on up to numberOfDeploymentThreads threads. Returns once all queries were deployed.
+    /// The callbacks are invoked in the order in which the deployments complete, but never concurrently. A query which was registered
+    /// but failed to start is unregistered again.
+    void registerAndStartQueries(std::vector<QueryDeployment> deployments, const OnQueryDeployed& onQueryDeployed) noexcept;
 
     /// Starts the Query asynchronously and moves it into the RunningState. Query execution error are only reported during runtime
     /// of the query.
@@ -73,6 +118,13 @@ public:
     /// @param terminationType dictates what happens with in in-flight data
     std::expected<void, Exception> stopQuery(QueryId queryId, QueryTerminationType terminationType) noexcept;
 
+    /// Updates the parameters of the query, which the running query reads for every subsequent record.
+    /// Either all or none of the values are applied, e.g., if the query has no parameter with one of the names.
+    /// @param queryId identifies the registered query
+    /// @param parameters the new values by the name of the parameter
+    std::expected<void, Exception>
+    updateQueryParameters(QueryId queryId, const std::unordered_map<std::string, std::string>& parameters) noexcept;
+
     /// Unregisters a stopped Query.
     /// @param queryId identifies the registered stopped query
     std::expected<void, Exception> unregisterQuery(QueryId queryId) noexcept;
@@ -81,5 +133,18 @@ public:
     [[nodiscard]] std::optional<QueryLog::Log> getQueryLog(QueryId queryId) const;
     /// Summary structure for query.
     [[nodiscard]] std::expected<LocalQueryStatus, Exception> getQueryStatus(QueryId queryId) const noexcept;
+    /// Counters of the running pipelines of the query, which the WorkerThreads count without synchronizing each other.
+    /// @return nullopt if the pipeline statistics are disabled, c.f., QueryEngineConfiguration::pipelineStatisticsInterval
+    [[nodiscard]] std::optional<std::vector<PipelineMetrics>> getPipelineMetrics(QueryId queryId) const;
+    /// Memory of the buffers that the pipelines of the query hold. Empty once a terminated query released all of its buffers.
+    [[nodiscard]] std::optional<QueryMemoryMetrics> getQueryMemory(QueryId queryId) const;
+    /// Momentary state of the buffer pool, the task queue, the WorkerThreads and the sources
+    [[nodiscard]] EngineMetrics getEngineMetrics() const;
+    /// State of the buffer pool, the task queue, the WorkerThreads and the sources in the OpenMetrics text format
+    [[nodiscard]] std::string getOpenMetrics();
+
+    /// Dumps the events the Google Event Trace retained in its flight recorder.
+    /// @return path of the dumped trace, or nullopt if the Google Event Trace is disabled
+    [[nodiscard]] std::optional<std::filesystem::path> dumpEventTrace();
 };
 }
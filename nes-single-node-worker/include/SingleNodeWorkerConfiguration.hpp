@@ -13,10 +13,13 @@
 */
 
 #pragma once
+#include <memory>
 #include <string>
+#include <vector>
 #include <Configuration/WorkerConfiguration.hpp>
 #include <Configurations/BaseConfiguration.hpp>
 #include <Configurations/ScalarOption.hpp>
+#include <Configurations/Validation/NumberValidation.hpp>
 
 namespace NES
 {
@@ -40,8 +43,57 @@ connections.  Valid values include dns:///localhost:1234,
            "false",
            "Enable Google Event Trace logging that generates Chrome tracing compatible JSON files for performance analysis."};
 
+    /// Traces the events of every n-th task, the events of queries and pipelines are always traced
+    UIntOption googleEventTraceSamplingRate
+        = {"google_event_trace_sampling_rate",
+           "1",
+           "Traces the events of every n-th task in the Google Event Trace. One traces all tasks.",
+           {std::make_shared<NumberValidation>()}};
+
+    /// Retains solely the events of the last seconds, which are dumped on demand via gRPC or SIGUSR1
+    UIntOption googleEventTraceFlightRecorder
+        = {"google_event_trace_flight_recorder",
+           "0",
+           "Seconds of events the Google Event Trace retains in memory and dumps on demand, i.e., via gRPC or SIGUSR1. "
+           "Zero writes all events continuously.",
+           {std::make_shared<NumberValidation>()}};
+
+    /// Threads which optimize and compile the queries of a batch deployment concurrently
+    UIntOption numberOfDeploymentThreads
+        = {"number_of_deployment_threads",
+           "0",
+           "Number of threads which optimize, compile and start the queries of a batch deployment concurrently. Zero uses one thread per "
+           "hardware thread.",
+           {std::make_shared<NumberValidation>()}};
+
+    /// Threads which compile the asynchronously registered queries in the background
+    UIntOption numberOfCompilationThreads
+        = {"number_of_compilation_threads",
+           "2",
+           "Number of threads which compile the asynchronously registered queries in the background.",
+           {std::make_shared<NumberValidation>()}};
+
+    /// Resolution of the clock which timestamps the ingested buffers, c.f., CoarseClock
+    UIntOption ingestionClockResolution
+        = {"ingestion_clock_resolution",
+           "0",
+           "Milliseconds between the updates of the clock which timestamps the ingested buffers. Zero reads the system clock for every "
+           "buffer.",
+           {std::make_shared<NumberValidation>()}};
+
 protected:
-    std::vector<BaseOption*> getOptions() override { return {&workerConfiguration, &grpcAddressUri, &enableGoogleEventTrace}; }
+    std::vector<BaseOption*> getOptions() override
+    {
+        return {
+            &workerConfiguration,
+            &grpcAddressUri,
+            &enableGoogleEventTrace,
+            &googleEventTraceSamplingRate,
+            &googleEventTraceFlightRecorder,
+            &numberOfDeploymentThreads,
+            &numberOfCompilationThreads,
+            &ingestionClockResolution};
+    }
 
     template <typename T>
     friend void generateHelp(std::ostream& ostream);
@@ -14,32 +14,42 @@
 
 #include <GoogleEventTracePrinter.hpp>
 
+#include <algorithm>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <filesystem>
 #include <fstream>
+#include <functional>
 #include <ios>
+#include <mutex>
+#include <ostream>
 #include <stop_token>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <tuple>
 #include <utility>
 #include <variant>
+#include <vector>
 #include <Identifiers/Identifiers.hpp>
 #include <Listeners/SystemEventListener.hpp>
 #include <Util/Logger/Logger.hpp>
 #include <Util/Overloaded.hpp>
 #include <Util/ThreadNaming.hpp>
+#include <fmt/chrono.h>
 #include <fmt/format.h>
 #include <folly/MPMCQueue.h>
 #include <nlohmann/json.hpp>
 #include <nlohmann/json_fwd.hpp>
+#include <ErrorHandling.hpp>
 #include <QueryEngineStatisticListener.hpp>
 
 namespace NES
 {
 
-constexpr uint64_t READ_RETRY_MS = 100;
+/// The trace thread sleeps while all queues are empty
+constexpr uint64_t IDLE_BACKOFF_MS = 1;
 
 uint64_t GoogleEventTracePrinter::timestampToMicroseconds(const std::chrono::system_clock::time_point& timestamp)
 {
@@ -81,6 +91,9 @@ nlohmann::json GoogleEventTracePrinter::createTraceEvent(
         case Phase::Instant:
             event["ph"] = "i";
             break;
+        case Phase::Counter:
+            event["ph"] = "C";
+            break;
     }
 
     event["ts"] = timestamp;
@@ -120,16 +133,86 @@ void GoogleEventTracePrinter::writeTraceFooter()
     }
 }
 
+void GoogleEventTracePrinter::writeTrace(std::ostream& out, std::vector<RecordedEvent> recordedEvents)
+{
+    /// The events of different shards interleave in the flight recorder
+    std::ranges::stable_sort(recordedEvents, std::less{}, &RecordedEvent::timestamp);
+    out << "{\n";
+    out << "  \"traceEvents\": [\n";
+    for (size_t index = 0; index < recordedEvents.size(); ++index)
+    {
+        out << (index == 0 ? "    " : ",\n    ") << recordedEvents[index].json;
+    }
+    out << "\n  ]\n";
+    out << "}\n";
+}
+
+void GoogleEventTracePrinter::record(const nlohmann::json& event)
+{
+    const auto timestamp = event.at("ts").get<uint64_t>();
+    const auto retainedMicroseconds = std::chrono::duration_cast<std::chrono::microseconds>(configuration.flightRecorderDuration).count();
+
+    const std::scoped_lock lock(flightRecorderMutex);
+    latestRecordedTimestamp = std::max(latestRecordedTimestamp, timestamp);
+    flightRecorder.emplace_back(timestamp, event.dump());
+    while (flightRecorder.front().timestamp + retainedMicroseconds < latestRecordedTimestamp)
+    {
+        flightRecorder.pop_front();
+    }
+}
+
+std::filesystem::path GoogleEventTracePrinter::dump()
+{
+    if (configuration.flightRecorderDuration.count() == 0)
+    {
+        /// The trace thread owns the trace file, thus the dump solely requests the flush
+        requestDump();
+        return path;
+    }
+
+    std::vector<RecordedEvent> recordedEvents;
+    {
+        const std::scoped_lock lock(flightRecorderMutex);
+        recordedEvents.assign(flightRecorder.begin(), flightRecorder.end());
+    }
+    auto dumpPath = path;
+    dumpPath.replace_filename(fmt::format("{}_dump_{:%Y-%m-%d_%H-%M-%S}.json", path.stem().string(), std::chrono::system_clock::now()));
+    std::ofstream dumpFile(dumpPath, std::ios::out | std::ios::trunc);
+    writeTrace(dumpFile, std::move(recordedEvents));
+    NES_INFO("Dumped the Google Event Trace of the last {} to: {}", configuration.flightRecorderDuration, dumpPath);
+    return dumpPath;
+}
+
+void GoogleEventTracePrinter::requestDump() noexcept
+{
+    dumpRequested.store(true, std::memory_order_relaxed);
+}
+
+folly::MPMCQueue<GoogleEventTracePrinter::CombinedEventType>& GoogleEventTracePrinter::shardOfThisThread()
+{
+    thread_local const size_t shard = nextShard.fetch_add(1, std::memory_order_relaxed) % NUMBER_OF_SHARDS;
+    return events[shard];
+}
+
 void GoogleEventTracePrinter::threadRoutine(const std::stop_token& token)
 {
     setThreadName("GoogleEventTracePrinter");
-    writeTraceHeader();
+    const bool isFlightRecorder = configuration.flightRecorderDuration.count() > 0;
+    if (not isFlightRecorder)
+    {
+        writeTraceHeader();
+    }
 
     bool firstEvent = true;
 
     /// Helper function to emit events with proper comma handling
     auto emit = [&](const nlohmann::json& evt)
     {
+        if (isFlightRecorder)
+        {
+            record(evt);
+            return;
+        }
         if (!firstEvent)
         {
             file << ",\n";
@@ -138,12 +221,41 @@ void GoogleEventTracePrinter::threadRoutine(const std::stop_token& token)
         file << "    " << evt.dump();
     };
 
+    /// Round-robin over the shards, such that a busy thread does not starve the events of the other threads
+    size_t nextShardToRead = 0;
+    auto readNextEvent = [&](CombinedEventType& event)
+    {
+        for (size_t attempt = 0; attempt < NUMBER_OF_SHARDS; ++attempt)
+        {
+            auto& shard = events[nextShardToRead];
+            nextShardToRead = (nextShardToRead + 1) % NUMBER_OF_SHARDS;
+            if (shard.read(event))
+            {
+                return true;
+            }
+        }
+        return false;
+    };
+
     while (!token.stop_requested())
     {
+        if (dumpRequested.exchange(false, std::memory_order_relaxed))
+        {
+            if (isFlightRecorder)
+            {
+                dump();
+            }
+            else
+            {
+                file.flush();
+            }
+        }
+
         CombinedEventType event = QueryStart{WorkerThreadId(0), QueryId(0)}; /// Will be overwritten
 
-        if (!events.tryReadUntil(std::chrono::high_resolution_clock::now() + std::chrono::milliseconds(READ_RETRY_MS), event))
+        if (!readNextEvent(event))
         {
+            std::this_thread::sleep_for(std::chrono::milliseconds(IDLE_BACKOFF_MS));
             continue;
         }
 
@@ -187,6 +299,95 @@ void GoogleEventTracePrinter::threadRoutine(const std::stop_token& token)
 
                     emit(traceEvent);
                 },
+                [&](const BufferSizeClassOccupancySystemEvent& occupancyEvent)
+                {
+                    auto args = nlohmann::json::object();
+                    args["used"] = occupancyEvent.numberOfBuffers - occupancyEvent.numberOfAvailableBuffers;
+                    args["available"] = occupancyEvent.numberOfAvailableBuffers;
+
+                    auto traceEvent = createTraceEvent(
+                        fmt::format("Buffer Size Class {}", occupancyEvent.bufferSize),
+                        Category::System,
+                        Phase::Counter,
+                        timestampToMicroseconds(occupancyEvent.timestamp),
+                        0,
+                        args);
+                    traceEvent["tid"] = 0; /// System thread
+
+                    emit(traceEvent);
+                },
+                [&](const FunctionStatistic& functionStatistic)
+                {
+                    auto args = nlohmann::json::object();
+                    args["calls"] = functionStatistic.calls;
+                    args["invalid_inputs"] = functionStatistic.invalidInputs;
+                    args["errors"] = functionStatistic.errors;
+
+                    auto traceEvent = createTraceEvent(
+                        fmt::format("Function {}", functionStatistic.functionName),
+                        Category::System,
+                        Phase::Counter,
+                        timestampToMicroseconds(functionStatistic.timestamp),
+                        0,
+                        args);
+                    traceEvent["tid"] = 0; /// System thread
+
+                    emit(traceEvent);
+                },
+                [&](const BloomFilterStatistic& bloomFilterStatistic)
+                {
+                    auto args = nlohmann::json::object();
+                    args["filters"] = bloomFilterStatistic.filters;
+                    args["filter_size_in_bytes"] = bloomFilterStatistic.filterSizeInBytes;
+                    args["probes"] = bloomFilterStatistic.probes;
+                    args["hits"] = bloomFilterStatistic.hits;
+
+                    auto traceEvent = createTraceEvent(
+                        fmt::format("Bloom filter {}", bloomFilterStatistic.operatorName),
+                        Category::System,
+                        Phase::Counter,
+                        timestampToMicroseconds(bloomFilterStatistic.timestamp),
+                        0,
+                        args);
+                    traceEvent["tid"] = 0; /// System thread
+
+                    emit(traceEvent);
+                },
+                [&](const SourceBufferShed& sourceBufferShed)
+                {
+                    auto args = nlohmann::json::object();
+                    args["shed_buffers"] = sourceBufferShed.numberOfShedBuffers;
+
+                    auto traceEvent = createTraceEvent(
+                        fmt::format("Shed Buffers (Query {})", sourceBufferShed.queryId),
+                        Category::Query,
+                        Phase::Counter,
+                        timestampToMicroseconds(sourceBufferShed.timestamp),
+                        0,
+                        args);
+                    traceEvent["tid"] = sourceBufferShed.threadId.getRawValue();
+
+                    emit(traceEvent);
+                },
+                [&](const PipelineStatisticsSample& pipelineStatistics)
+                {
+                    auto args = nlohmann::json::object();
+                    args["tasks"] = pipelineStatistics.numberOfTasks;
+                    args["tuples"] = pipelineStatistics.numberOfTuples;
+                    args["execution_time_us"]
+                        = std::chrono::duration_cast<std::chrono::microseconds>(pipelineStatistics.executionTime).count();
+
+                    auto traceEvent = createTraceEvent(
+                        fmt::format("Pipeline {}-{}", pipelineStatistics.queryId, pipelineStatistics.pipelineId),
+                        Category::Query,
+                        Phase::Counter,
+                        timestampToMicroseconds(pipelineStatistics.timestamp),
+                        0,
+                        args);
+                    traceEvent["tid"] = 0; /// System thread
+
+                    emit(traceEvent);
+                },
                 [&](const QueryStart& queryStart)
                 {
                     auto traceEvent = createTraceEvent(
@@ -257,6 +458,7 @@ void GoogleEventTracePrinter::threadRoutine(const std::stop_token& token)
                 {
                     auto args = nlohmann::json::object();
                     args["pipeline_id"] = pipelineStart.pipelineId.getRawValue();
+                    args["start_duration_us"] = pipelineStart.startDuration.count();
 
                     auto traceEvent = createTraceEvent(
                         fmt::format("Pipeline {} (Query {})", pipelineStart.pipelineId, pipelineStart.queryId),
@@ -303,6 +505,7 @@ void GoogleEventTracePrinter::threadRoutine(const std::stop_token& token)
                     args["pipeline_id"] = taskStart.pipelineId.getRawValue();
                     args["task_id"] = taskStart.taskId.getRawValue();
                     args["tuples"] = taskStart.numberOfTuples;
+                    args["queueing_delay_us"] = taskStart.queueingDelay.count();
 
                     auto traceEvent = createTraceEvent(
                         fmt::format("Task {} (Pipeline {}, Query {})", taskStart.taskId, taskStart.pipelineId, taskStart.queryId),
@@ -391,22 +594,57 @@ void GoogleEventTracePrinter::threadRoutine(const std::stop_token& token)
             event);
     }
 
+    if (isFlightRecorder)
+    {
+        /// The trace file holds the events of the last seconds before the printer stopped
+        const std::scoped_lock lock(flightRecorderMutex);
+        writeTrace(file, std::vector<RecordedEvent>(flightRecorder.begin(), flightRecorder.end()));
+        return;
+    }
+
     /// Write the footer when the thread stops
     writeTraceFooter();
 }
 
 void GoogleEventTracePrinter::onEvent(Event event)
 {
-    events.writeIfNotFull(std::visit([]<typename T>(T&& arg) { return CombinedEventType(std::forward<T>(arg)); }, std::move(event)));
+    const bool sampledOut = std::visit(
+        [this]<typename T>(const T& arg)
+        {
+            if constexpr (requires { arg.taskId; })
+            {
+                return arg.taskId.getRawValue() % configuration.samplingRate != 0;
+            }
+            return false;
+        },
+        event);
+    if (sampledOut)
+    {
+        return;
+    }
+    shardOfThisThread().writeIfNotFull(
+        std::visit([]<typename T>(T&& arg) { return CombinedEventType(std::forward<T>(arg)); }, std::move(event)));
 }
 
 void GoogleEventTracePrinter::onEvent(SystemEvent event)
 {
-    events.writeIfNotFull(std::visit([]<typename T>(T&& arg) { return CombinedEventType(std::forward<T>(arg)); }, std::move(event)));
+    shardOfThisThread().writeIfNotFull(
+        std::visit([]<typename T>(T&& arg) { return CombinedEventType(std::forward<T>(arg)); }, std::move(event)));
 }
 
-GoogleEventTracePrinter::GoogleEventTracePrinter(const std::filesystem::path& path) : file(path, std::ios::out | std::ios::trunc)
+GoogleEventTracePrinter::GoogleEventTracePrinter(const std::filesystem::path& path, const Configuration configuration)
+    : path(path), configuration(configuration), file(path, std::ios::out | std::ios::trunc)
 {
+    PRECONDITION(configuration.samplingRate > 0, "The sampling rate of the Google Event Trace must be at least one");
+    for (auto& shard : events)
+    {
+        shard = folly::MPMCQueue<CombinedEventType>(QUEUE_LENGTH);
+    }
+    if (configuration.flightRecorderDuration.count() > 0)
+    {
+        NES_INFO("Recording the last {} of the Google Event Trace to: {}", configuration.flightRecorderDuration, path);
+        return;
+    }
     NES_INFO("Writing Google Event Trace to: {}", path);
 }
 
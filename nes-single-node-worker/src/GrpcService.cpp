@@ -14,12 +14,20 @@
 
 #include <GrpcService.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
 #include <exception>
+#include <expected>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 #include <Identifiers/Identifiers.hpp>
 #include <Plans/LogicalPlan.hpp>
 #include <Runtime/QueryTerminationType.hpp>
+#include <Serialization/PlanFragmentCache.hpp>
 #include <Serialization/QueryPlanSerializationUtil.hpp>
 #include <Util/Strings.hpp>
 #include <cpptrace/basic.hpp>
@@ -27,13 +35,19 @@
 #include <google/protobuf/empty.pb.h>
 #include <grpcpp/server_context.h>
 #include <grpcpp/support/status.h>
+#include <grpcpp/support/sync_stream.h>
 #include <ErrorHandling.hpp>
+#include <QueryEngine.hpp>
+#include <QueryPriority.hpp>
 #include <SingleNodeWorkerRPCService.pb.h>
 
 namespace NES
 {
 namespace
 {
+/// Bounds the rate of the metrics that a single stream requests
+constexpr std::chrono::milliseconds MIN_METRICS_INTERVAL{10};
+
 grpc::Status handleError(const std::exception& exception, grpc::ServerContext* context)
 {
     NES_ERROR("GRPC Request failed with exception: {}", exception.what());
@@ -52,6 +66,40 @@ grpc::Status handleError(const Exception& exception, grpc::ServerContext* contex
     return {grpc::INTERNAL, exception.what()};
 }
 
+QueryPriority toQueryPriority(const ::QueryPriority priority)
+{
+    switch (priority)
+    {
+        case ::HighPriority:
+            return QueryPriority::HIGH;
+        case ::LowPriority:
+            return QueryPriority::LOW;
+        default:
+            return QueryPriority::NORMAL;
+    }
+}
+
+void setError(::Error& error, const Exception& exception)
+{
+    error.set_message(exception.what());
+    error.set_stacktrace(exception.trace().to_string());
+    error.set_code(exception.code());
+    error.set_location(std::string(exception.where()->filename) + ":" + std::to_string(exception.where()->line.value_or(0)));
+}
+
+std::expected<LogicalPlan, Exception> tryDeserializeQueryPlan(const SerializableQueryPlan& serializedPlan, PlanFragmentCache& fragmentCache)
+{
+    CPPTRACE_TRY
+    {
+        return QueryPlanSerializationUtil::deserializeQueryPlan(serializedPlan, fragmentCache);
+    }
+    CPPTRACE_CATCH(...)
+    {
+        return std::unexpected(wrapExternalException());
+    }
+    std::unreachable();
+}
+
 template <typename T>
 T getValueOrThrow(std::expected<T, Exception> expected)
 {
@@ -65,10 +113,12 @@ T getValueOrThrow(std::expected<T, Exception> expected)
 
 grpc::Status GRPCServer::RegisterQuery(grpc::ServerContext* context, const RegisterQueryRequest* request, RegisterQueryReply* response)
 {
-    auto fullySpecifiedQueryPlan = QueryPlanSerializationUtil::deserializeQueryPlan(request->queryplan());
     CPPTRACE_TRY
     {
-        auto result = delegate.registerQuery(std::move(fullySpecifiedQueryPlan));
+        auto fullySpecifiedQueryPlan = getValueOrThrow(tryDeserializeQueryPlan(request->queryplan(), fragmentCache));
+        const auto priority = toQueryPriority(request->priority());
+        auto result = request->asynchronous() ? delegate.registerQueryAsync(std::move(fullySpecifiedQueryPlan), priority)
+                                              : delegate.registerQuery(std::move(fullySpecifiedQueryPlan), priority);
         if (result.has_value())
         {
             response->set_queryid(result->getRawValue());
@@ -76,7 +126,64 @@ grpc::Status GRPCServer::RegisterQuery(grpc::ServerContext* context, const Regis
         }
         return handleError(result.error(), context);
     }
-    CPPTRACE_CATCH(const std::exception& e)
+    CPPTRACE_CATCH(const Exception& e)
+    {
+        return handleError(e, context);
+    }
+    CPPTRACE_CATCH_ALT(const std::exception& e)
+    {
+        return handleError(e, context);
+    }
+    return {grpc::INTERNAL, "unknown exception"};
+}
+
+grpc::Status GRPCServer::RegisterAndStartQueries(
+    grpc::ServerContext* context, const RegisterQueriesRequest* request, grpc::ServerWriter<QueryDeploymentReply>* writer)
+{
+    CPPTRACE_TRY
+    {
+        std::vector<SingleNodeWorker::QueryDeployment> deployments;
+        /// Index of every deployment in the request, as plans which cannot be deserialized are not deployed
+        std::vector<size_t> requestIndices;
+        for (int index = 0; index < request->queries_size(); ++index)
+        {
+            const auto& query = request->queries(index);
+            auto plan = tryDeserializeQueryPlan(query.queryplan(), fragmentCache);
+            if (not plan.has_value())
+            {
+                QueryDeploymentReply reply;
+                reply.set_index(index);
+                setError(*reply.mutable_error(), plan.error());
+                writer->Write(reply);
+                continue;
+            }
+            deployments.push_back({.plan = std::move(*plan), .priority = toQueryPriority(query.priority())});
+            requestIndices.push_back(index);
+        }
+
+        delegate.registerAndStartQueries(
+            std::move(deployments),
+            [&](const size_t index, const std::expected<QueryId, Exception>& result)
+            {
+                QueryDeploymentReply reply;
+                reply.set_index(requestIndices[index]);
+                if (result.has_value())
+                {
+                    reply.set_queryid(result->getRawValue());
+                }
+                else
+                {
+                    setError(*reply.mutable_error(), result.error());
+                }
+                writer->Write(reply);
+            });
+        return grpc::Status::OK;
+    }
+    CPPTRACE_CATCH(const Exception& e)
+    {
+        return handleError(e, context);
+    }
+    CPPTRACE_CATCH_ALT(const std::exception& e)
     {
         return handleError(e, context);
     }
@@ -141,6 +248,27 @@ grpc::Status GRPCServer::StopQuery(grpc::ServerContext* context, const StopQuery
     return {grpc::INTERNAL, "unknown exception"};
 }
 
+grpc::Status
+GRPCServer::UpdateQueryParameters(grpc::ServerContext* context, const UpdateQueryParametersRequest* request, google::protobuf::Empty*)
+{
+    const auto queryId = QueryId(request->queryid());
+    CPPTRACE_TRY
+    {
+        const std::unordered_map<std::string, std::string> parameters(request->parameters().begin(), request->parameters().end());
+        getValueOrThrow(delegate.updateQueryParameters(queryId, parameters));
+        return grpc::Status::OK;
+    }
+    CPPTRACE_CATCH(const Exception& e)
+    {
+        return handleError(e, context);
+    }
+    CPPTRACE_CATCH_ALT(const std::exception& e)
+    {
+        return handleError(e, context);
+    }
+    return {grpc::INTERNAL, "unknown exception"};
+}
+
 grpc::Status GRPCServer::RequestQueryStatus(grpc::ServerContext* context, const QueryStatusRequest* request, QueryStatusReply* reply)
 {
     CPPTRACE_TRY
@@ -178,6 +306,13 @@ grpc::Status GRPCServer::RequestQueryStatus(grpc::ServerContext* context, const
                 errorProto->set_code(error->code());
                 errorProto->set_location(std::string{error->where()->filename} + ":" + std::to_string(error->where()->line.value_or(0)));
             }
+
+            if (const auto memory = delegate.getQueryMemory(queryId); memory.has_value())
+            {
+                reply->mutable_metrics()->set_usedmemoryinbytes(memory->usedBytes);
+                reply->mutable_metrics()->set_peakmemoryinbytes(memory->peakBytes);
+                reply->mutable_metrics()->set_memoryquotainbytes(memory->quotaInBytes);
+            }
             return grpc::Status::OK;
         }
         return {grpc::NOT_FOUND, "Query does not exist"};
@@ -235,4 +370,116 @@ grpc::Status GRPCServer::RequestQueryLog(grpc::ServerContext* context, const Que
     return {grpc::INTERNAL, "unkown exception"};
 }
 
+grpc::Status GRPCServer::StreamQueryMetrics(
+    grpc::ServerContext* context, const QueryMetricsRequest* request, grpc::ServerWriter<QueryMetricsReply>* writer)
+{
+    CPPTRACE_TRY
+    {
+        const auto queryId = QueryId{request->queryid()};
+        const auto interval = std::max(std::chrono::milliseconds(request->intervalinms()), MIN_METRICS_INTERVAL);
+        while (not context->IsCancelled())
+        {
+            const auto queryStatus = delegate.getQueryStatus(queryId);
+            if (not queryStatus.has_value())
+            {
+                return {grpc::NOT_FOUND, "Query does not exist"};
+            }
+            const auto pipelineMetrics = delegate.getPipelineMetrics(queryId);
+            if (not pipelineMetrics.has_value())
+            {
+                return {grpc::FAILED_PRECONDITION, "The pipeline statistics are disabled"};
+            }
+
+            QueryMetricsReply reply;
+            reply.set_queryid(queryId.getRawValue());
+            reply.set_state(static_cast<::QueryState>(queryStatus->state));
+            reply.set_unixtimeinms(
+                std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+            for (const auto& metrics : *pipelineMetrics)
+            {
+                auto* pipeline = reply.add_pipelines();
+                pipeline->set_pipelineid(metrics.pipelineId.getRawValue());
+                pipeline->set_tasks(metrics.numberOfTasks);
+                pipeline->set_inputtuples(metrics.numberOfInputTuples);
+                pipeline->set_emittedtuples(metrics.numberOfEmittedTuples);
+                pipeline->set_executiontimeinus(std::chrono::duration_cast<std::chrono::microseconds>(metrics.executionTime).count());
+                pipeline->set_queueingdelayinus(std::chrono::duration_cast<std::chrono::microseconds>(metrics.queueingDelay).count());
+                for (const auto bucket : metrics.latencyHistogram)
+                {
+                    pipeline->add_latencyhistogram(bucket);
+                }
+                for (const auto bucket : metrics.ingestionLatencyHistogram)
+                {
+                    pipeline->add_ingestionlatencyhistogram(bucket);
+                }
+                for (const auto bucket : metrics.oldestIngestionLatencyHistogram)
+                {
+                    pipeline->add_oldestingestionlatencyhistogram(bucket);
+                }
+            }
+
+            /// The client closed the stream
+            if (not writer->Write(reply))
+            {
+                return grpc::Status::OK;
+            }
+            if (queryStatus->state == QueryState::Stopped || queryStatus->state == QueryState::Failed)
+            {
+                return grpc::Status::OK;
+            }
+            std::this_thread::sleep_for(interval);
+        }
+        return grpc::Status::CANCELLED;
+    }
+    CPPTRACE_CATCH(const Exception& e)
+    {
+        return handleError(e, context);
+    }
+    CPPTRACE_CATCH_ALT(const std::exception& e)
+    {
+        return handleError(e, context);
+    }
+    return {grpc::INTERNAL, "unknown exception"};
+}
+
+grpc::Status GRPCServer::RequestWorkerMetrics(grpc::ServerContext* context, const google::protobuf::Empty*, WorkerMetricsReply* reply)
+{
+    CPPTRACE_TRY
+    {
+        reply->set_openmetrics(delegate.getOpenMetrics());
+        return grpc::Status::OK;
+    }
+    CPPTRACE_CATCH(const Exception& e)
+    {
+        return handleError(e, context);
+    }
+    CPPTRACE_CATCH_ALT(const std::exception& e)
+    {
+        return handleError(e, context);
+    }
+    return {grpc::INTERNAL, "unknown exception"};
+}
+
+grpc::Status GRPCServer::DumpEventTrace(grpc::ServerContext* context, const google::protobuf::Empty*, DumpEventTraceReply* reply)
+{
+    CPPTRACE_TRY
+    {
+        if (const auto path = delegate.dumpEventTrace(); path.has_value())
+        {
+            reply->set_path(path->string());
+            return grpc::Status::OK;
+        }
+        return {grpc::FAILED_PRECONDITION, "The Google Event Trace is disabled"};
+    }
+    CPPTRACE_CATCH(const Exception& e)
+    {
+        return handleError(e, context);
+    }
+    CPPTRACE_CATCH_ALT(const std::exception& e)
+    {
+        return handleError(e, context);
+    }
+    return {grpc::INTERNAL, "unknown exception"};
+}
+
 }
@@ -0,0 +1,105 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <OpenMetrics.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <Identifiers/Identifiers.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <fmt/format.h>
+#include <magic_enum/magic_enum.hpp>
+#include <QueryEngine.hpp>
+#include <QueryPriority.hpp>
+
+namespace NES
+{
+
+std::string renderOpenMetrics(const EngineMetrics& engineMetrics, const BufferManager& bufferManager)
+{
+    std::string text;
+    auto out = std::back_inserter(text);
+    const auto family = [&](const std::string_view name, const std::string_view type, const std::string_view help)
+    { fmt::format_to(out, "# TYPE {0} {1}\n# HELP {0} {2}\n", name, type, help); };
+
+    family("nes_worker_threads", "gauge", "Number of running WorkerThreads.");
+    fmt::format_to(out, "nes_worker_threads {}\n", engineMetrics.numberOfWorkerThreads);
+    family("nes_worker_threads_busy", "gauge", "Number of WorkerThreads that currently handle a task.");
+    fmt::format_to(out, "nes_worker_threads_busy {}\n", engineMetrics.numberOfBusyWorkerThreads);
+
+    family("nes_task_queue_tasks", "gauge", "Approximate number of tasks waiting in the shared task queues.");
+    for (size_t priorityClass = 0; priorityClass < engineMetrics.queueDepths.size(); ++priorityClass)
+    {
+        const auto priority = magic_enum::enum_name(static_cast<QueryPriority>(priorityClass));
+        const auto& [admission, internal, deadline] = engineMetrics.queueDepths[priorityClass];
+        fmt::format_to(out, "nes_task_queue_tasks{{priority=\"{}\",queue=\"admission\"}} {}\n", priority, admission);
+        fmt::format_to(out, "nes_task_queue_tasks{{priority=\"{}\",queue=\"internal\"}} {}\n", priority, internal);
+        fmt::format_to(out, "nes_task_queue_tasks{{priority=\"{}\",queue=\"deadline\"}} {}\n", priority, deadline);
+    }
+    family("nes_task_queue_blocked_admissions", "counter", "Admission writes that waited for a full admission queue.");
+    fmt::format_to(out, "nes_task_queue_blocked_admissions_total {}\n", engineMetrics.numberOfBlockedAdmissions);
+
+    family("nes_buffer_pool_buffers", "gauge", "Number of pooled buffers of the global buffer manager.");
+    fmt::format_to(out, "nes_buffer_pool_buffers {}\n", bufferManager.getNumOfPooledBuffers());
+    family("nes_buffer_pool_available_buffers", "gauge", "Number of available pooled buffers, including the thread local caches.");
+    fmt::format_to(out, "nes_buffer_pool_available_buffers {}\n", bufferManager.getNumberOfAvailableBuffers());
+    family("nes_buffer_pool_unpooled_buffers", "gauge", "Number of unpooled buffers of the global buffer manager.");
+    fmt::format_to(out, "nes_buffer_pool_unpooled_buffers {}\n", bufferManager.getNumOfUnpooledBuffers());
+    const auto sizeClasses = bufferManager.getSizeClassOccupancy();
+    family("nes_buffer_size_class_buffers", "gauge", "Number of buffers of a buffer size class.");
+    for (const auto& [bufferSize, numberOfBuffers, numberOfAvailableBuffers] : sizeClasses)
+    {
+        fmt::format_to(out, "nes_buffer_size_class_buffers{{size=\"{}\"}} {}\n", bufferSize, numberOfBuffers);
+    }
+    family("nes_buffer_size_class_available_buffers", "gauge", "Number of available buffers of a buffer size class.");
+    for (const auto& [bufferSize, numberOfBuffers, numberOfAvailableBuffers] : sizeClasses)
+    {
+        fmt::format_to(out, "nes_buffer_size_class_available_buffers{{size=\"{}\"}} {}\n", bufferSize, numberOfAvailableBuffers);
+    }
+
+    std::unordered_map<QueryId, uint64_t> leadingWatermarks;
+    for (const auto& source : engineMetrics.sources)
+    {
+        auto& leadingWatermark = leadingWatermarks[source.queryId];
+        leadingWatermark = std::max(leadingWatermark, source.watermark);
+    }
+    const auto perSource = [&](const std::string_view name, auto value)
+    {
+        for (const auto& source : engineMetrics.sources)
+        {
+            fmt::format_to(out, "{}{{query=\"{}\",origin=\"{}\"}} {}\n", name, source.queryId, source.originId, value(source));
+        }
+    };
+    family("nes_source_ingested_buffers", "counter", "Raw buffers that a source emitted since its query started.");
+    perSource("nes_source_ingested_buffers_total", [](const auto& source) { return source.numberOfBuffers; });
+    family("nes_source_ingested_bytes", "counter", "Bytes that a source emitted since its query started.");
+    perSource("nes_source_ingested_bytes_total", [](const auto& source) { return source.numberOfBytes; });
+    family("nes_source_inflight_buffers", "gauge", "Raw buffers of a source whose tasks did not complete yet.");
+    perSource("nes_source_inflight_buffers", [](const auto& source) { return source.numberOfInflightBuffers; });
+    family("nes_source_watermark", "gauge", "Latest watermark that the successors of a source reported.");
+    perSource("nes_source_watermark", [](const auto& source) { return source.watermark; });
+    family("nes_source_watermark_lag", "gauge", "Distance of the watermark of a source to the leading source of its query.");
+    perSource(
+        "nes_source_watermark_lag", [&](const auto& source) { return leadingWatermarks.at(source.queryId) - source.watermark; });
+
+    fmt::format_to(out, "# EOF\n");
+    return text;
+}
+
+}
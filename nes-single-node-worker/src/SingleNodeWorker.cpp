@@ -14,31 +14,164 @@
 
 #include <SingleNodeWorker.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <filesystem>
 #include <memory>
+#include <mutex>
 #include <optional>
+#include <stop_token>
+#include <string>
+#include <thread>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 #include <unistd.h>
+#include <Functions/QueryParameters.hpp>
 #include <Identifiers/Identifiers.hpp>
 #include <Identifiers/NESStrongType.hpp>
 #include <Listeners/QueryLog.hpp>
 #include <Plans/LogicalPlan.hpp>
+#include <Runtime/Execution/QueryStatus.hpp>
 #include <Runtime/NodeEngineBuilder.hpp>
 #include <Runtime/QueryTerminationType.hpp>
+#include <Util/CoarseClock.hpp>
+#include <Util/Logger/Logger.hpp>
 #include <Util/PlanRenderer.hpp>
 #include <Util/Pointers.hpp>
 #include <cpptrace/from_current.hpp>
+#include <folly/Synchronized.h>
+#include <CompiledQueryPlan.hpp>
 #include <CompositeStatisticListener.hpp>
 #include <ErrorHandling.hpp>
 #include <GoogleEventTracePrinter.hpp>
+#include <OpenMetrics.hpp>
 #include <QueryCompiler.hpp>
+#include <QueryEngine.hpp>
 #include <QueryOptimizer.hpp>
+#include <QueryPriority.hpp>
 #include <SingleNodeWorkerConfiguration.hpp>
 
 namespace NES
 {
 
+/// Compiles the asynchronously registered queries on a fixed number of threads and registers them at the NodeEngine
+class BackgroundQueryCompilation
+{
+public:
+    BackgroundQueryCompilation(QueryCompilation::QueryCompiler& compiler, SharedPtr<NodeEngine> nodeEngine, const size_t numberOfThreads)
+        : compiler(compiler), nodeEngine(std::move(nodeEngine))
+    {
+        threads.reserve(numberOfThreads);
+        for (size_t thread = 0; thread < numberOfThreads; ++thread)
+        {
+            threads.emplace_back([this](const std::stop_token& stopToken) { compileQueries(stopToken); });
+        }
+    }
+
+    void enqueue(const QueryId queryId, std::unique_ptr<QueryCompilation::QueryCompilationRequest> request, const QueryPriority priority)
+    {
+        {
+            const std::scoped_lock lock(mutex);
+            compilingQueries.emplace(queryId, false);
+            pendingCompilations.push_back({queryId, std::move(request), priority});
+        }
+        compilationAvailable.notify_one();
+    }
+
+    [[nodiscard]] bool isCompiling(const QueryId queryId) const
+    {
+        const std::scoped_lock lock(mutex);
+        return compilingQueries.contains(queryId);
+    }
+
+    /// Returns false if the query is not compiling, otherwise the query is dropped once its compilation completed
+    bool cancel(const QueryId queryId)
+    {
+        const std::scoped_lock lock(mutex);
+        const auto compiling = compilingQueries.find(queryId);
+        if (compiling == compilingQueries.end())
+        {
+            return false;
+        }
+        compiling->second = true;
+        return true;
+    }
+
+private:
+    struct PendingCompilation
+    {
+        QueryId queryId = INVALID_QUERY_ID;
+        std::unique_ptr<QueryCompilation::QueryCompilationRequest> request;
+        QueryPriority priority = QueryPriority::NORMAL;
+    };
+
+    void compileQueries(const std::stop_token& stopToken)
+    {
+        while (true)
+        {
+            PendingCompilation compilation;
+            {
+                std::unique_lock lock(mutex);
+                if (not compilationAvailable.wait(lock, stopToken, [this] { return not pendingCompilations.empty(); }))
+                {
+                    return;
+                }
+                compilation = std::move(pendingCompilations.front());
+                pendingCompilations.pop_front();
+            }
+            compile(std::move(compilation));
+        }
+    }
+
+    void compile(PendingCompilation compilation)
+    {
+        const auto queryLog = nodeEngine->getQueryLog();
+        CPPTRACE_TRY
+        {
+            auto result = compiler.compileQuery(std::move(compilation.request));
+            INVARIANT(result, "expected successfull query compilation or exception, but got nothing");
+            result->priority = compilation.priority;
+
+            /// The query leaves the compiling queries while holding the lock, thus a concurrent unregistration either cancels it or
+            /// finds it at the NodeEngine
+            const std::scoped_lock lock(mutex);
+            const auto cancelled = compilingQueries.extract(compilation.queryId).mapped();
+            if (cancelled)
+            {
+                queryLog->logQueryStatusChange(compilation.queryId, QueryState::Stopped, std::chrono::system_clock::now());
+                return;
+            }
+            [[maybe_unused]] auto queryId = nodeEngine->registerCompiledQueryPlan(std::move(result));
+        }
+        CPPTRACE_CATCH(...)
+        {
+            auto exception = wrapExternalException();
+            NES_ERROR("Compilation of query {} failed: {}", compilation.queryId, exception.what());
+            {
+                const std::scoped_lock lock(mutex);
+                compilingQueries.erase(compilation.queryId);
+            }
+            queryLog->logQueryFailure(compilation.queryId, std::move(exception), std::chrono::system_clock::now());
+        }
+    }
+
+    QueryCompilation::QueryCompiler& compiler;
+    SharedPtr<NodeEngine> nodeEngine;
+
+    mutable std::mutex mutex;
+    std::condition_variable_any compilationAvailable;
+    std::deque<PendingCompilation> pendingCompilations;
+    /// Queries which are either pending or compiling, true if the query was unregistered in the meantime
+    std::unordered_map<QueryId, bool> compilingQueries;
+    /// Declared last, thus the threads are joined before the other members are destroyed
+    std::vector<std::jthread> threads;
+};
+
 SingleNodeWorker::~SingleNodeWorker() = default;
 SingleNodeWorker::SingleNodeWorker(SingleNodeWorker&& other) noexcept = default;
 SingleNodeWorker& SingleNodeWorker::operator=(SingleNodeWorker&& other) noexcept = default;
@@ -48,16 +181,32 @@ SingleNodeWorker::SingleNodeWorker(const SingleNodeWorkerConfiguration& configur
 {
     if (configuration.enableGoogleEventTrace.getValue())
     {
+        if (configuration.googleEventTraceSamplingRate.getValue() == 0)
+        {
+            throw InvalidConfigParameter("The sampling rate of the Google Event Trace must be at least one");
+        }
         auto googleTracePrinter = std::make_shared<GoogleEventTracePrinter>(
-            fmt::format("GoogleEventTrace_{:%Y-%m-%d_%H-%M-%S}_{:d}.json", std::chrono::system_clock::now(), ::getpid()));
+            fmt::format("GoogleEventTrace_{:%Y-%m-%d_%H-%M-%S}_{:d}.json", std::chrono::system_clock::now(), ::getpid()),
+            GoogleEventTracePrinter::Configuration{
+                .samplingRate = configuration.googleEventTraceSamplingRate.getValue(),
+                .flightRecorderDuration = std::chrono::seconds(configuration.googleEventTraceFlightRecorder.getValue())});
         googleTracePrinter->start();
         listener->addListener(googleTracePrinter);
+        eventTracePrinter = std::move(googleTracePrinter);
+    }
+
+    if (configuration.ingestionClockResolution.getValue() != 0)
+    {
+        CoarseClock::setResolution(std::chrono::milliseconds(configuration.ingestionClockResolution.getValue()));
     }
 
     nodeEngine = NodeEngineBuilder(configuration.workerConfiguration, copyPtr(listener)).build();
 
     optimizer = std::make_unique<QueryOptimizer>(configuration.workerConfiguration.defaultQueryExecution);
     compiler = std::make_unique<QueryCompilation::QueryCompiler>();
+    queryParameters = std::make_unique<folly::Synchronized<std::unordered_map<QueryId, SharedPtr<QueryParameters>>>>();
+    backgroundCompilation
+        = std::make_unique<BackgroundQueryCompilation>(*compiler, nodeEngine, configuration.numberOfCompilationThreads.getValue());
 
     if (configuration.workerConfiguration.bufferSizeInBytes.getValue()
         < configuration.workerConfiguration.defaultQueryExecution.operatorBufferSize.getValue())
@@ -73,17 +222,34 @@ SingleNodeWorker::SingleNodeWorker(const SingleNodeWorkerConfiguration& configur
 /// We might want to move this to the engine.
 static std::atomic queryIdCounter = INITIAL<QueryId>.getRawValue();
 
-std::expected<QueryId, Exception> SingleNodeWorker::registerQuery(LogicalPlan plan) noexcept
+std::unique_ptr<QueryCompilation::QueryCompilationRequest> SingleNodeWorker::createCompilationRequest(LogicalPlan& plan)
+{
+    plan.setQueryId(QueryId(queryIdCounter++));
+    auto parameters = std::make_shared<QueryParameters>();
+    auto queryPlan = [&]
+    {
+        const QueryParameters::Scope scope(*parameters);
+        return optimizer->optimize(plan);
+    }();
+    if (not parameters->empty())
+    {
+        queryParameters->wlock()->emplace(plan.getQueryId(), std::move(parameters));
+    }
+    listener->onEvent(SubmitQuerySystemEvent{queryPlan.getQueryId(), explain(plan, ExplainVerbosity::Debug)});
+    auto request = std::make_unique<QueryCompilation::QueryCompilationRequest>(queryPlan);
+    request->dumpCompilationResult = configuration.workerConfiguration.dumpQueryCompilationIntermediateRepresentations.getValue();
+    request->numberOfRetainedArenaBuffers = configuration.workerConfiguration.numberOfRetainedArenaBuffers.getValue();
+    request->profileOperators = configuration.workerConfiguration.profileOperators.getValue();
+    return request;
+}
+
+std::expected<QueryId, Exception> SingleNodeWorker::registerQuery(LogicalPlan plan, const QueryPriority priority) noexcept
 {
     CPPTRACE_TRY
     {
-        plan.setQueryId(QueryId(queryIdCounter++));
-        auto queryPlan = optimizer->optimize(plan);
-        listener->onEvent(SubmitQuerySystemEvent{queryPlan.getQueryId(), explain(plan, ExplainVerbosity::Debug)});
-        auto request = std::make_unique<QueryCompilation::QueryCompilationRequest>(queryPlan);
-        request->dumpCompilationResult = configuration.workerConfiguration.dumpQueryCompilationIntermediateRepresentations.getValue();
-        auto result = compiler->compileQuery(std::move(request));
+        auto result = compiler->compileQuery(createCompilationRequest(plan));
         INVARIANT(result, "expected successfull query compilation or exception, but got nothing");
+        result->priority = priority;
         return nodeEngine->registerCompiledQueryPlan(std::move(result));
     }
     CPPTRACE_CATCH(...)
@@ -93,11 +259,32 @@ std::expected<QueryId, Exception> SingleNodeWorker::registerQuery(LogicalPlan pl
     std::unreachable();
 }
 
+std::expected<QueryId, Exception> SingleNodeWorker::registerQueryAsync(LogicalPlan plan, const QueryPriority priority) noexcept
+{
+    CPPTRACE_TRY
+    {
+        auto request = createCompilationRequest(plan);
+        const auto queryId = plan.getQueryId();
+        nodeEngine->getQueryLog()->logQueryStatusChange(queryId, QueryState::Compiling, std::chrono::system_clock::now());
+        backgroundCompilation->enqueue(queryId, std::move(request), priority);
+        return queryId;
+    }
+    CPPTRACE_CATCH(...)
+    {
+        return std::unexpected(wrapExternalException());
+    }
+    std::unreachable();
+}
+
 std::expected<void, Exception> SingleNodeWorker::startQuery(QueryId queryId) noexcept
 {
     CPPTRACE_TRY
     {
         PRECONDITION(queryId != INVALID_QUERY_ID, "QueryId must be not invalid!");
+        if (backgroundCompilation->isCompiling(queryId))
+        {
+            throw QueryNotRegistered("Query with queryId {} is still compiling", queryId);
+        }
         nodeEngine->startQuery(queryId);
         return {};
     }
@@ -108,6 +295,44 @@ std::expected<void, Exception> SingleNodeWorker::startQuery(QueryId queryId) noe
     std::unreachable();
 }
 
+void SingleNodeWorker::registerAndStartQueries(std::vector<QueryDeployment> deployments, const OnQueryDeployed& onQueryDeployed) noexcept
+{
+    std::mutex callbackMutex;
+    std::atomic<size_t> nextDeployment{0};
+    const auto deploy = [&]
+    {
+        /// The deployment threads claim the queries one at a time, thus a slow compilation does not delay the queries behind it
+        for (auto index = nextDeployment++; index < deployments.size(); index = nextDeployment++)
+        {
+            auto& [plan, priority] = deployments[index];
+            auto result = registerQuery(std::move(plan), priority);
+            if (result.has_value())
+            {
+                if (auto started = startQuery(*result); not started.has_value())
+                {
+                    [[maybe_unused]] auto unregistered = unregisterQuery(*result);
+                    result = std::unexpected(std::move(started.error()));
+                }
+            }
+            const std::scoped_lock lock(callbackMutex);
+            onQueryDeployed(index, std::move(result));
+        }
+    };
+
+    const auto configuredThreads = configuration.numberOfDeploymentThreads.getValue();
+    const auto numberOfThreads = std::min<size_t>(
+        configuredThreads == 0 ? std::max(1U, std::thread::hardware_concurrency()) : configuredThreads, deployments.size());
+    {
+        /// The calling thread deploys as well, the additional threads join at the end of the scope
+        std::vector<std::jthread> deploymentThreads;
+        for (size_t thread = 1; thread < numberOfThreads; ++thread)
+        {
+            deploymentThreads.emplace_back(deploy);
+        }
+        deploy();
+    }
+}
+
 std::expected<void, Exception> SingleNodeWorker::stopQuery(QueryId queryId, QueryTerminationType type) noexcept
 {
     CPPTRACE_TRY
@@ -123,11 +348,41 @@ std::expected<void, Exception> SingleNodeWorker::stopQuery(QueryId queryId, Quer
     std::unreachable();
 }
 
+std::expected<void, Exception>
+SingleNodeWorker::updateQueryParameters(const QueryId queryId, const std::unordered_map<std::string, std::string>& parameters) noexcept
+{
+    CPPTRACE_TRY
+    {
+        const auto parametersOfQuery = queryParameters->withRLock(
+            [queryId](const auto& parametersByQuery) -> SharedPtr<QueryParameters>
+            {
+                const auto parametersOfQuery = parametersByQuery.find(queryId);
+                return parametersOfQuery == parametersByQuery.end() ? nullptr : parametersOfQuery->second;
+            });
+        if (not parametersOfQuery)
+        {
+            throw InvalidQueryParameter("Query {} is not registered or declares no parameters", queryId);
+        }
+        parametersOfQuery->update(parameters);
+        return {};
+    }
+    CPPTRACE_CATCH(...)
+    {
+        return std::unexpected(wrapExternalException());
+    }
+    std::unreachable();
+}
+
 std::expected<void, Exception> SingleNodeWorker::unregisterQuery(QueryId queryId) noexcept
 {
     CPPTRACE_TRY
     {
         PRECONDITION(queryId != INVALID_QUERY_ID, "QueryId must be not invalid!");
+        queryParameters->wlock()->erase(queryId);
+        if (backgroundCompilation->cancel(queryId))
+        {
+            return {};
+        }
         nodeEngine->unregisterQuery(queryId);
         return {};
     }
@@ -161,4 +416,37 @@ std::optional<QueryLog::Log> SingleNodeWorker::getQueryLog(QueryId queryId) cons
     return nodeEngine->getQueryLog()->getLogForQuery(queryId);
 }
 
+std::optional<std::vector<PipelineMetrics>> SingleNodeWorker::getPipelineMetrics(QueryId queryId) const
+{
+    if (configuration.workerConfiguration.queryEngine.pipelineStatisticsInterval.getValue() == 0)
+    {
+        return std::nullopt;
+    }
+    return nodeEngine->getPipelineMetrics(queryId);
+}
+
+std::optional<QueryMemoryMetrics> SingleNodeWorker::getQueryMemory(QueryId queryId) const
+{
+    return nodeEngine->getQueryMemory(queryId);
+}
+
+EngineMetrics SingleNodeWorker::getEngineMetrics() const
+{
+    return nodeEngine->getEngineMetrics();
+}
+
+std::string SingleNodeWorker::getOpenMetrics()
+{
+    return renderOpenMetrics(nodeEngine->getEngineMetrics(), *nodeEngine->getBufferManager());
+}
+
+std::optional<std::filesystem::path> SingleNodeWorker::dumpEventTrace()
+{
+    if (not eventTracePrinter)
+    {
+        return std::nullopt;
+    }
+    return eventTracePrinter->dump();
+}
+
 }
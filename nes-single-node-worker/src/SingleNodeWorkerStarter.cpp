@@ -12,7 +12,9 @@
     limitations under the License.
 */
 
+#include <chrono>
 #include <csignal>
+#include <cstdint>
 #include <semaphore>
 #include <thread>
 #include <Configurations/Util.hpp>
@@ -23,6 +25,7 @@
 #include <grpcpp/security/server_credentials.h>
 #include <grpcpp/server_builder.h>
 #include <ErrorHandling.hpp>
+#include <GoogleEventTracePrinter.hpp>
 #include <GrpcService.hpp>
 #include <SingleNodeWorker.hpp>
 #include <SingleNodeWorkerConfiguration.hpp>
@@ -41,6 +44,17 @@ void signalHandler(int signal)
     shutdownBarrier.release();
 }
 
+/// Async-signal-safe, the trace thread of the Google Event Trace performs the dump
+void dumpEventTraceHandler(int)
+{
+    NES::GoogleEventTracePrinter::requestDump();
+}
+
+int64_t millisecondsBetween(const std::chrono::steady_clock::time_point begin, const std::chrono::steady_clock::time_point end)
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count();
+}
+
 std::jthread shutdownHook(grpc::Server& server)
 {
     return std::jthread(
@@ -56,6 +70,7 @@ int main(const int argc, const char* argv[])
 {
     CPPTRACE_TRY
     {
+        const auto start = std::chrono::steady_clock::now();
         NES::Logger::setupLogging("singleNodeWorker.log", NES::LogLevel::LOG_DEBUG);
         if (std::signal(SIGINT, signalHandler) == SIG_ERR)
         {
@@ -65,13 +80,19 @@ int main(const int argc, const char* argv[])
         {
             NES_ERROR("Failed to set SIGTERM signal handler")
         }
+        if (std::signal(SIGUSR1, dumpEventTraceHandler) == SIG_ERR)
+        {
+            NES_ERROR("Failed to set SIGUSR1 signal handler")
+        }
         auto configuration = NES::loadConfiguration<NES::SingleNodeWorkerConfiguration>(argc, argv);
         if (!configuration)
         {
             return 0;
         }
         {
+            const auto configurationLoaded = std::chrono::steady_clock::now();
             NES::GRPCServer workerService{NES::SingleNodeWorker(*configuration)};
+            const auto workerCreated = std::chrono::steady_clock::now();
 
             grpc::ServerBuilder builder;
             builder.SetMaxMessageSize(-1);
@@ -80,7 +101,14 @@ int main(const int argc, const char* argv[])
 
             const auto server = builder.BuildAndStart();
             const auto hook = shutdownHook(*server);
+            const auto serverStarted = std::chrono::steady_clock::now();
             NES_INFO("Server listening on {}", static_cast<const std::string&>(configuration->grpcAddressUri));
+            NES_INFO(
+                "Worker startup took {}ms: logging and configuration {}ms, worker {}ms, gRPC server {}ms",
+                millisecondsBetween(start, serverStarted),
+                millisecondsBetween(start, configurationLoaded),
+                millisecondsBetween(configurationLoaded, workerCreated),
+                millisecondsBetween(workerCreated, serverStarted));
             server->Wait();
             NES_INFO("GRPC Server was shutdown. Terminating the SingleNodeWorker");
         }
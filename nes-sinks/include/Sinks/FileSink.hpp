@@ -14,27 +14,46 @@
 
 #pragma once
 
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
 #include <cstdint>
 #include <fstream>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <ostream>
+#include <span>
+#include <stop_token>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <unordered_map>
+#include <vector>
+#include <sys/uio.h>
 
 #include <Configurations/Descriptor.hpp>
 #include <Identifiers/Identifiers.hpp>
 #include <Runtime/TupleBuffer.hpp>
+#include <Sinks/SequenceReorderBuffer.hpp>
 #include <Sinks/Sink.hpp>
 #include <Sinks/SinkDescriptor.hpp>
 #include <SinksParsing/CSVFormat.hpp>
 #include <SinksParsing/Format.hpp>
+#include <Util/Logger/Logger.hpp>
 #include <folly/Synchronized.h>
 #include <PipelineExecutionContext.hpp>
 
 namespace NES
 {
 /// A sink that writes formatted TupleBuffers to arbitrary files.
+/// By default, the worker threads write and flush every formatted buffer under a lock of the file. With 'async_write', the worker threads
+/// solely format their buffers and enqueue the formatted strings, while a writer thread writes all queued strings with a single writev
+/// call, once 'write_batch_size' bytes are queued, 'write_interval_ms' passed, or the sink stops. If the writer falls behind by
+/// MAX_PENDING_BATCHES batches, the sink repeats the task of the buffer later instead of queueing it.
+/// With 'ordered_output', the sink writes the buffers of every origin in (sequenceNumber, chunkNumber) order, while the worker threads
+/// still format them in parallel, c.f., SequenceReorderBuffer. A buffer waits until all buffers of lower sequence numbers of its origin
+/// were written. Thus, the file needs no sorting afterward, but the sink holds back buffers, if a preceding buffer is delayed.
 class FileSink final : public Sink
 {
 public:
@@ -53,6 +72,12 @@ public:
 
     static DescriptorConfig::Config validateAndFormat(std::unordered_map<std::string, std::string> config);
 
+    static constexpr size_t MAX_PENDING_BATCHES = 4;
+
+    /// Advances the chunks of a writev call past its 'writtenBytes', which may end in the middle of a chunk after a partial write
+    /// @return the chunks that remain to be written
+    static std::span<iovec> skipWrittenBytes(std::span<iovec> chunks, size_t writtenBytes);
+
 protected:
     std::ostream& toString(std::ostream& str) const override;
 
@@ -63,6 +88,26 @@ private:
     bool isOpen;
     std::unique_ptr<Format> formatter;
     folly::Synchronized<std::ofstream> outputFileStream;
+
+    /// Writes and flushes the formatted buffers while the caller holds the lock of the output file stream
+    static void writeToStream(std::ofstream& stream, const std::vector<std::string>& formattedBuffers);
+    void runWriter(const std::stop_token& stopToken);
+    void writeBatch(std::vector<std::string>& batch);
+
+    bool isAsync;
+    size_t writeBatchSize;
+    std::chrono::milliseconds writeInterval;
+    /// Opened in append mode alongside the output file stream, which solely writes the schema in the asynchronous mode
+    int fileDescriptor{-1};
+    std::mutex pendingMutex;
+    std::condition_variable_any pendingCondition;
+    std::vector<std::string> pendingBuffers;
+    size_t pendingBytes{0};
+    folly::Synchronized<std::optional<std::string>> writeError;
+    std::jthread writerThread;
+
+    bool isOrdered;
+    SequenceReorderBuffer reorderBuffer;
 };
 
 /// Todo #355 : combine configuration with source configuration (get rid of duplicated code)
@@ -77,9 +122,42 @@ struct ConfigParametersFile
         false,
         [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(APPEND, config); }};
 
+    static inline const DescriptorConfig::ConfigParameter<bool> ASYNC_WRITE{
+        "async_write",
+        false,
+        [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(ASYNC_WRITE, config); }};
+    static inline const DescriptorConfig::ConfigParameter<uint64_t> WRITE_BATCH_SIZE{
+        "write_batch_size",
+        4 * 1024 * 1024,
+        [](const std::unordered_map<std::string, std::string>& config) -> std::optional<uint64_t>
+        {
+            const auto writeBatchSize = DescriptorConfig::tryGet(WRITE_BATCH_SIZE, config);
+            if (writeBatchSize.has_value() and writeBatchSize.value() == 0)
+            {
+                NES_ERROR("FileSink write batch size must be positive");
+                return std::nullopt;
+            }
+            return writeBatchSize;
+        }};
+    static inline const DescriptorConfig::ConfigParameter<uint64_t> WRITE_INTERVAL_MS{
+        "write_interval_ms",
+        100,
+        [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(WRITE_INTERVAL_MS, config); }};
+    static inline const DescriptorConfig::ConfigParameter<bool> ORDERED_OUTPUT{
+        "ordered_output",
+        false,
+        [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(ORDERED_OUTPUT, config); }};
+
     static inline std::unordered_map<std::string, DescriptorConfig::ConfigParameterContainer> parameterMap
         = DescriptorConfig::createConfigParameterContainerMap(
-            SinkDescriptor::parameterMap, SinkDescriptor::FILE_PATH, INPUT_FORMAT, APPEND);
+            SinkDescriptor::parameterMap,
+            SinkDescriptor::FILE_PATH,
+            INPUT_FORMAT,
+            APPEND,
+            ASYNC_WRITE,
+            WRITE_BATCH_SIZE,
+            WRITE_INTERVAL_MS,
+            ORDERED_OUTPUT);
 };
 
 }
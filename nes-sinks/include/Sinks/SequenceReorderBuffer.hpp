@@ -0,0 +1,66 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <Identifiers/Identifiers.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Sequencing/NonBlockingMonotonicSeqQueue.hpp>
+#include <Sequencing/SequenceData.hpp>
+#include <folly/Synchronized.h>
+
+namespace NES
+{
+
+/// Lets the worker threads of a sink format their buffers in parallel, while the sink commits the formatted buffers of every origin in
+/// (sequenceNumber, chunkNumber) order. The worker threads insert their formatted buffers in any order. The NonBlockingMonotonicSeqQueue of
+/// the origin tracks the highest sequence number, up to which all sequence numbers received all chunks, thus all pending buffers up to it
+/// are committable. Buffers of different origins are not ordered with respect to each other.
+class SequenceReorderBuffer
+{
+public:
+    /// Thread-safe
+    void insert(const TupleBuffer& buffer, std::string formattedBuffer);
+
+    /// Appends the committable formatted buffers to 'committed' in order and returns the number of appended bytes.
+    /// @note The caller must serialize the calls, e.g., by holding the lock of its output, as formatted buffers taken by one call precede
+    /// the formatted buffers taken by the next call.
+    size_t takeCommittable(std::vector<std::string>& committed);
+
+    /// Appends all pending formatted buffers, including those of incomplete sequence numbers, e.g., when the sink stops
+    size_t takeRemaining(std::vector<std::string>& committed);
+
+    [[nodiscard]] size_t getNumberOfPendingBuffers() const;
+
+private:
+    struct Origin
+    {
+        Sequencing::NonBlockingMonotonicSeqQueue<SequenceNumber::Underlying> completedSequenceNumbers;
+        folly::Synchronized<std::map<SequenceData, std::string>> pendingBuffers;
+    };
+
+    size_t take(std::vector<std::string>& committed, bool includeIncomplete);
+
+    /// The origins are never removed, thus the worker threads solely lock the map to find the origin of their buffer
+    folly::Synchronized<std::unordered_map<OriginId, std::unique_ptr<Origin>>> origins;
+};
+
+}
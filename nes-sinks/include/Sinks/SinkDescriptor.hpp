@@ -44,7 +44,9 @@ namespace NES
 enum class InputFormat : uint8_t
 {
     CSV,
-    JSON
+    JSON,
+    /// The binary rows of the buffers, c.f., NativeFormat
+    NATIVE
 };
 
 class SinkDescriptor final : public Descriptor
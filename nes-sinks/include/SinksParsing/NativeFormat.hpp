@@ -0,0 +1,45 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+#pragma once
+#include <SinksParsing/Format.hpp>
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <DataTypes/Schema.hpp>
+#include <Runtime/TupleBuffer.hpp>
+
+namespace NES
+{
+
+/// Writes the tuples of a TupleBuffer in their native row layout, i.e., the binary values of the fields back to back, without formatting
+/// a single field. Consumers determine the layout of the rows from the schema line that the sink writes into the header of the file.
+/// The native rows of variable-sized fields solely contain references to child buffers, thus the format requires fixed-size fields.
+class NativeFormat : public Format
+{
+public:
+    /// @throws UnknownSinkFormat if the schema contains a variable-sized field
+    explicit NativeFormat(const Schema& schema);
+
+    [[nodiscard]] std::string getFormattedBuffer(const TupleBuffer& inputBuffer) const override;
+
+    std::ostream& toString(std::ostream& os) const override { return os << *this; }
+
+    friend std::ostream& operator<<(std::ostream& out, const NativeFormat& format);
+
+private:
+    size_t schemaSizeInBytes;
+};
+
+}
@@ -14,15 +14,28 @@
 
 #include <Sinks/FileSink.hpp>
 
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <climits>
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
 #include <memory>
+#include <mutex>
+#include <span>
+#include <stop_token>
 #include <string>
 #include <system_error>
+#include <thread>
 #include <unordered_map>
 #include <utility>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
 
 #include <Configurations/Descriptor.hpp>
 #include <Runtime/TupleBuffer.hpp>
@@ -30,9 +43,12 @@
 #include <Sinks/SinkDescriptor.hpp>
 #include <SinksParsing/CSVFormat.hpp>
 #include <SinksParsing/JSONFormat.hpp>
+#include <SinksParsing/NativeFormat.hpp>
 #include <Util/Logger/Logger.hpp>
+#include <Util/ThreadNaming.hpp>
 #include <fmt/format.h>
 #include <magic_enum/magic_enum.hpp>
+#include <sys/uio.h>
 #include <ErrorHandling.hpp>
 #include <PipelineExecutionContext.hpp>
 #include <SinkRegistry.hpp>
@@ -46,6 +62,10 @@ FileSink::FileSink(const SinkDescriptor& sinkDescriptor)
     , outputFilePath(sinkDescriptor.getFromConfig(SinkDescriptor::FILE_PATH))
     , isAppend(sinkDescriptor.getFromConfig(ConfigParametersFile::APPEND))
     , isOpen(false)
+    , isAsync(sinkDescriptor.getFromConfig(ConfigParametersFile::ASYNC_WRITE))
+    , writeBatchSize(sinkDescriptor.getFromConfig(ConfigParametersFile::WRITE_BATCH_SIZE))
+    , writeInterval(std::chrono::milliseconds{sinkDescriptor.getFromConfig(ConfigParametersFile::WRITE_INTERVAL_MS)})
+    , isOrdered(sinkDescriptor.getFromConfig(ConfigParametersFile::ORDERED_OUTPUT))
 {
     switch (const auto inputFormat = sinkDescriptor.getFromConfig(ConfigParametersFile::INPUT_FORMAT))
     {
@@ -55,6 +75,9 @@ FileSink::FileSink(const SinkDescriptor& sinkDescriptor)
         case InputFormat::JSON:
             formatter = std::make_unique<JSONFormat>(*sinkDescriptor.getSchema());
             break;
+        case InputFormat::NATIVE:
+            formatter = std::make_unique<NativeFormat>(*sinkDescriptor.getSchema());
+            break;
         default:
             throw UnknownSinkFormat(fmt::format("Sink format: {} not supported.", magic_enum::enum_name(inputFormat)));
     }
@@ -62,7 +85,8 @@ FileSink::FileSink(const SinkDescriptor& sinkDescriptor)
 
 std::ostream& FileSink::toString(std::ostream& str) const
 {
-    str << fmt::format("FileSink(filePathOutput: {}, isAppend: {})", outputFilePath, isAppend);
+    str << fmt::format(
+        "FileSink(filePathOutput: {}, isAppend: {}, isAsync: {}, isOrdered: {})", outputFilePath, isAppend, isAsync, isOrdered);
     return str;
 }
 
@@ -102,16 +126,79 @@ void FileSink::start(PipelineExecutionContext&)
         const auto schemaStr = formatter->getFormattedSchema();
         stream->write(schemaStr.c_str(), static_cast<int64_t>(schemaStr.length()));
     }
+
+    if (isAsync)
+    {
+        stream->flush();
+        fileDescriptor = ::open(outputFilePath.c_str(), O_WRONLY | O_APPEND | O_CLOEXEC);
+        if (fileDescriptor == -1)
+        {
+            isOpen = false;
+            throw CannotOpenSink(
+                "Could not open output file for asynchronous writes; filePathOutput={}: {}", outputFilePath, strerror(errno));
+        }
+        writerThread = std::jthread([this](const std::stop_token& stopToken) { runWriter(stopToken); });
+    }
 }
 
-void FileSink::execute(const TupleBuffer& inputTupleBuffer, PipelineExecutionContext&)
+void FileSink::execute(const TupleBuffer& inputTupleBuffer, PipelineExecutionContext& pipelineExecutionContext)
 {
     PRECONDITION(inputTupleBuffer, "Invalid input buffer in FileSink.");
     PRECONDITION(isOpen, "Sink was not opened");
 
+    if (isAsync)
+    {
+        if (const auto error = writeError.rlock(); error->has_value())
+        {
+            throw CannotWriteToSink("Could not write to output file; filePathOutput={}: {}", outputFilePath, error->value());
+        }
+        {
+            const std::scoped_lock lock(pendingMutex);
+            if (pendingBytes >= MAX_PENDING_BATCHES * writeBatchSize)
+            {
+                /// Repeating the task later keeps the worker thread available instead of waiting for the writer
+                pipelineExecutionContext.repeatTask(inputTupleBuffer, writeInterval);
+                return;
+            }
+        }
+        /// Formatting happens on the worker thread without holding any lock
+        auto fBuffer = formatter->getFormattedBuffer(inputTupleBuffer);
+        if (isOrdered)
+        {
+            reorderBuffer.insert(inputTupleBuffer, std::move(fBuffer));
+        }
+        {
+            const std::scoped_lock lock(pendingMutex);
+            if (isOrdered)
+            {
+                pendingBytes += reorderBuffer.takeCommittable(pendingBuffers);
+            }
+            else
+            {
+                pendingBytes += fBuffer.size();
+                pendingBuffers.emplace_back(std::move(fBuffer));
+            }
+            if (pendingBytes < writeBatchSize)
+            {
+                return;
+            }
+        }
+        pendingCondition.notify_one();
+        return;
+    }
+
     {
         auto fBuffer = formatter->getFormattedBuffer(inputTupleBuffer);
         NES_TRACE("Writing tuples to file sink; filePathOutput={}, fBuffer={}", outputFilePath, fBuffer);
+        if (isOrdered)
+        {
+            reorderBuffer.insert(inputTupleBuffer, std::move(fBuffer));
+            std::vector<std::string> committable;
+            auto wlocked = outputFileStream.wlock();
+            reorderBuffer.takeCommittable(committable);
+            writeToStream(*wlocked, committable);
+            return;
+        }
         {
             auto wlocked = outputFileStream.wlock();
             wlocked->write(fBuffer.c_str(), static_cast<long>(fBuffer.size()));
@@ -120,12 +207,135 @@ void FileSink::execute(const TupleBuffer& inputTupleBuffer, PipelineExecutionCon
     }
 }
 
+void FileSink::writeToStream(std::ofstream& stream, const std::vector<std::string>& formattedBuffers)
+{
+    if (formattedBuffers.empty())
+    {
+        return;
+    }
+    for (const auto& formattedBuffer : formattedBuffers)
+    {
+        stream.write(formattedBuffer.c_str(), static_cast<long>(formattedBuffer.size()));
+    }
+    stream.flush();
+}
+
 void FileSink::stop(PipelineExecutionContext&)
 {
     NES_DEBUG("Closing file sink, filePathOutput={}", outputFilePath);
+    if (isOrdered and reorderBuffer.getNumberOfPendingBuffers() > 0)
+    {
+        /// Sequence numbers that never completed would otherwise be lost
+        NES_WARNING(
+            "FileSink writes {} buffers of incomplete sequence numbers to {}", reorderBuffer.getNumberOfPendingBuffers(), outputFilePath);
+        if (isAsync)
+        {
+            const std::scoped_lock lock(pendingMutex);
+            pendingBytes += reorderBuffer.takeRemaining(pendingBuffers);
+        }
+        else
+        {
+            std::vector<std::string> remaining;
+            auto wlocked = outputFileStream.wlock();
+            reorderBuffer.takeRemaining(remaining);
+            writeToStream(*wlocked, remaining);
+        }
+    }
+    if (writerThread.joinable())
+    {
+        /// The writer writes all pending buffers before it terminates
+        writerThread.request_stop();
+        writerThread.join();
+    }
+    if (fileDescriptor != -1)
+    {
+        ::close(fileDescriptor);
+        fileDescriptor = -1;
+    }
     auto stream = outputFileStream.wlock();
     stream->flush();
     stream->close();
+    if (const auto error = writeError.rlock(); error->has_value())
+    {
+        throw CannotWriteToSink("Could not write to output file; filePathOutput={}: {}", outputFilePath, error->value());
+    }
+}
+
+void FileSink::runWriter(const std::stop_token& stopToken)
+{
+    setThreadName("FileSinkWriter");
+    std::vector<std::string> batch;
+    while (true)
+    {
+        bool isStopping = false;
+        {
+            std::unique_lock lock(pendingMutex);
+            pendingCondition.wait_for(lock, stopToken, writeInterval, [this] { return pendingBytes >= writeBatchSize; });
+            /// All buffers of the sink were enqueued before the stop was requested, thus this batch is the last
+            isStopping = stopToken.stop_requested();
+            batch.swap(pendingBuffers);
+            pendingBytes = 0;
+        }
+        writeBatch(batch);
+        batch.clear();
+        if (isStopping)
+        {
+            return;
+        }
+    }
+}
+
+void FileSink::writeBatch(std::vector<std::string>& batch)
+{
+    if (batch.empty() or writeError.rlock()->has_value())
+    {
+        return;
+    }
+    std::vector<iovec> chunks;
+    chunks.reserve(batch.size());
+    for (auto& formattedBuffer : batch)
+    {
+        if (not formattedBuffer.empty())
+        {
+            chunks.emplace_back(iovec{.iov_base = formattedBuffer.data(), .iov_len = formattedBuffer.size()});
+        }
+    }
+
+    std::span remainingChunks(chunks);
+    while (not remainingChunks.empty())
+    {
+        const auto numberOfChunks = std::min<size_t>(remainingChunks.size(), IOV_MAX);
+        const auto writtenBytes = ::writev(fileDescriptor, remainingChunks.data(), static_cast<int>(numberOfChunks));
+        if (writtenBytes < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            const std::string error = strerror(errno);
+            NES_ERROR("FileSink could not write to {}: {}", outputFilePath, error);
+            *writeError.wlock() = error;
+            return;
+        }
+        remainingChunks = skipWrittenBytes(remainingChunks, static_cast<size_t>(writtenBytes));
+    }
+}
+
+std::span<iovec> FileSink::skipWrittenBytes(std::span<iovec> chunks, size_t writtenBytes)
+{
+    /// A partial write continues in the middle of the first chunk that was not written completely
+    while (not chunks.empty() and writtenBytes >= chunks.front().iov_len)
+    {
+        writtenBytes -= chunks.front().iov_len;
+        chunks = chunks.subspan(1);
+    }
+    if (writtenBytes > 0)
+    {
+        INVARIANT(not chunks.empty(), "writev wrote more bytes than the chunks contain");
+        chunks.front().iov_base = static_cast<char*>(chunks.front().iov_base) + writtenBytes;
+        chunks.front().iov_len -= writtenBytes;
+    }
+    return chunks;
 }
 
 DescriptorConfig::Config FileSink::validateAndFormat(std::unordered_map<std::string, std::string> config)
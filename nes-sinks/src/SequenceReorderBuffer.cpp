@@ -0,0 +1,92 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Sinks/SequenceReorderBuffer.hpp>
+
+#include <cstddef>
+#include <limits>
+#include <map>
+#include <memory>
+#include <ranges>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <Identifiers/Identifiers.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Sequencing/SequenceData.hpp>
+
+namespace NES
+{
+
+void SequenceReorderBuffer::insert(const TupleBuffer& buffer, std::string formattedBuffer)
+{
+    const SequenceData sequenceData{buffer.getSequenceNumber(), buffer.getChunkNumber(), buffer.isLastChunk()};
+    auto& origin = [&]() -> Origin&
+    {
+        auto locked = origins.ulock();
+        if (const auto it = locked->find(buffer.getOriginId()); it != locked->end())
+        {
+            return *it->second;
+        }
+        auto wlocked = locked.moveFromUpgradeToWrite();
+        return *wlocked->try_emplace(buffer.getOriginId(), std::make_unique<Origin>()).first->second;
+    }();
+
+    /// The buffer must be pending before its chunk may complete the sequence number, as a concurrent commit may take it right after
+    origin.pendingBuffers.wlock()->emplace(sequenceData, std::move(formattedBuffer));
+    origin.completedSequenceNumbers.emplace(sequenceData, sequenceData.sequenceNumber);
+}
+
+size_t SequenceReorderBuffer::takeCommittable(std::vector<std::string>& committed)
+{
+    return take(committed, false);
+}
+
+size_t SequenceReorderBuffer::takeRemaining(std::vector<std::string>& committed)
+{
+    return take(committed, true);
+}
+
+size_t SequenceReorderBuffer::take(std::vector<std::string>& committed, const bool includeIncomplete)
+{
+    size_t numberOfBytes = 0;
+    for (const auto& origin : *origins.rlock() | std::views::values)
+    {
+        /// All sequence numbers up to the current value received all of their chunks
+        const auto lastCompleteSequenceNumber = includeIncomplete ? std::numeric_limits<SequenceNumber::Underlying>::max()
+                                                                  : origin->completedSequenceNumbers.getCurrentValue();
+        auto pending = origin->pendingBuffers.wlock();
+        auto end = pending->begin();
+        for (; end != pending->end() and end->first.sequenceNumber <= lastCompleteSequenceNumber; ++end)
+        {
+            numberOfBytes += end->second.size();
+            committed.emplace_back(std::move(end->second));
+        }
+        pending->erase(pending->begin(), end);
+    }
+    return numberOfBytes;
+}
+
+size_t SequenceReorderBuffer::getNumberOfPendingBuffers() const
+{
+    size_t numberOfPendingBuffers = 0;
+    for (const auto& origin : *origins.rlock() | std::views::values)
+    {
+        numberOfPendingBuffers += origin->pendingBuffers.rlock()->size();
+    }
+    return numberOfPendingBuffers;
+}
+
+}
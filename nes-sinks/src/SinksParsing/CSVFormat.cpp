@@ -71,9 +71,8 @@ std::string CSVFormat::tupleBufferToFormattedCSVString(TupleBuffer tbuffer, cons
                               const auto physicalType = formattingContext.physicalTypes[index];
                               if (physicalType.type == DataType::Type::VARSIZED)
                               {
-                                  const VariableSizedAccess variableSizedAccess{
-                                      *std::bit_cast<const uint64_t*>(&tuple[formattingContext.offsets[index]])};
-                                  auto varSizedData = MemoryLayout::readVarSizedDataAsString(tbuffer, variableSizedAccess);
+                                  const auto field = tuple.subspan(formattingContext.offsets[index]).first<sizeof(VariableSizedAccess)>();
+                                  auto varSizedData = MemoryLayout::readVarSizedFieldAsString(tbuffer, field);
                                   if (copyOfEscapeStrings)
                                   {
                                       return "\"" + varSizedData + "\"";
@@ -70,9 +70,8 @@ std::string JSONFormat::tupleBufferToFormattedJSONString(TupleBuffer tbuffer, co
                       auto offset = formattingContext.offsets[index];
                       if (type.type == DataType::Type::VARSIZED)
                       {
-                          const VariableSizedAccess variableSizedAccess{
-                              *std::bit_cast<const uint64_t*>(&tuple[formattingContext.offsets[index]])};
-                          const auto varSizedData = MemoryLayout::readVarSizedDataAsString(tbuffer, variableSizedAccess);
+                          const auto field = tuple.subspan(offset).first<sizeof(VariableSizedAccess)>();
+                          const auto varSizedData = MemoryLayout::readVarSizedFieldAsString(tbuffer, field);
                           return fmt::format(R"("{}":"{}")", formattingContext.names.at(index), varSizedData);
                       }
                       return fmt::format("\"{}\":{}", formattingContext.names.at(index), type.formattedBytesToString(&tuple[offset]));
@@ -0,0 +1,53 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <SinksParsing/NativeFormat.hpp>
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <SinksParsing/Format.hpp>
+#include <fmt/format.h>
+#include <ErrorHandling.hpp>
+
+namespace NES
+{
+
+NativeFormat::NativeFormat(const Schema& pSchema) : Format(pSchema), schemaSizeInBytes(pSchema.getSizeOfSchemaInBytes())
+{
+    PRECONDITION(schema.getNumberOfFields() != 0, "Formatter expected a non-empty schema");
+    for (const auto& field : schema.getFields())
+    {
+        if (field.dataType.type == DataType::Type::VARSIZED or field.dataType.type == DataType::Type::VARSIZED_POINTER_REP)
+        {
+            throw UnknownSinkFormat("The native sink format does not support the variable-sized field {}", field.name);
+        }
+    }
+}
+
+std::string NativeFormat::getFormattedBuffer(const TupleBuffer& inputBuffer) const
+{
+    const auto rows = inputBuffer.getAvailableMemoryArea<char>().subspan(0, inputBuffer.getNumberOfTuples() * schemaSizeInBytes);
+    return {rows.begin(), rows.end()};
+}
+
+std::ostream& operator<<(std::ostream& out, const NativeFormat& format)
+{
+    return out << fmt::format("NativeFormat(Schema: {})", format.schema);
+}
+
+}
@@ -0,0 +1,218 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <climits>
+#include <csignal>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <sys/resource.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/DataTypeProvider.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Sinks/FileSink.hpp>
+#include <Sinks/SinkCatalog.hpp>
+#include <SinksParsing/NativeFormat.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+#include <ErrorHandling.hpp>
+#include <TestTaskQueue.hpp>
+
+namespace NES
+{
+
+class FileSinkTest : public Testing::BaseUnitTest
+{
+public:
+    static constexpr size_t BUFFER_SIZE = 4096;
+    static constexpr size_t TUPLES_PER_BUFFER = BUFFER_SIZE / sizeof(uint64_t);
+
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("FileSinkTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup FileSinkTest test class.");
+    }
+
+    void SetUp() override
+    {
+        BaseUnitTest::SetUp();
+        filePath = std::filesystem::temp_directory_path()
+            / ("FileSinkTest_" + std::to_string(getpid()) + "_" + ::testing::UnitTest::GetInstance()->current_test_info()->name()
+               + ".bin");
+        schema.addField("id", DataTypeProvider::provideDataType(DataType::Type::UINT64));
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove(filePath);
+        BaseUnitTest::TearDown();
+    }
+
+    std::unique_ptr<FileSink> createSink(std::unordered_map<std::string, std::string> config)
+    {
+        config.try_emplace("file_path", filePath.string());
+        config.try_emplace("input_format", "NATIVE");
+        config.try_emplace("async_write", "true");
+        const auto descriptor = sinkCatalog.addSinkDescriptor("fileSink", schema, FileSink::NAME, std::move(config));
+        EXPECT_TRUE(descriptor.has_value());
+        return std::make_unique<FileSink>(descriptor.value());
+    }
+
+    /// Buffer 'index' contains the ids index * TUPLES_PER_BUFFER, ..., i.e., the ids of all buffers count up without gaps
+    TupleBuffer createBuffer(const uint64_t index, const uint64_t numberOfTuples) const
+    {
+        auto buffer = bufferManager->getBufferBlocking();
+        const auto ids = buffer.getAvailableMemoryArea<uint64_t>();
+        for (uint64_t tuple = 0; tuple < numberOfTuples; ++tuple)
+        {
+            ids[tuple] = (index * TUPLES_PER_BUFFER) + tuple;
+        }
+        buffer.setNumberOfTuples(numberOfTuples);
+        return buffer;
+    }
+
+    /// Executes the sink like the task queue does, i.e., repeats the task of the buffer until the sink enqueued it
+    static void executeUntilEnqueued(FileSink& sink, TestPipelineExecutionContext& pipelineExecutionContext, const TupleBuffer& buffer)
+    {
+        bool isRepeated = true;
+        pipelineExecutionContext.setRepeatTaskCallback([&isRepeated] { isRepeated = true; });
+        while (isRepeated)
+        {
+            isRepeated = false;
+            sink.execute(buffer, pipelineExecutionContext);
+        }
+    }
+
+    /// Executes 'numberOfBuffers' buffers and returns the content that the sink must write for them, including the schema line
+    std::string executeBuffers(FileSink& sink, const uint64_t numberOfBuffers, const uint64_t numberOfTuples)
+    {
+        const NativeFormat format(schema);
+        auto expected = format.getFormattedSchema();
+        for (uint64_t index = 0; index < numberOfBuffers; ++index)
+        {
+            const auto buffer = createBuffer(index, numberOfTuples);
+            executeUntilEnqueued(sink, pipelineExecutionContext, buffer);
+            expected += format.getFormattedBuffer(buffer);
+        }
+        return expected;
+    }
+
+    std::string readFile() const
+    {
+        std::ifstream file(filePath, std::ios::binary);
+        return {std::istreambuf_iterator(file), std::istreambuf_iterator<char>()};
+    }
+
+    /// Returns the remaining chunks after skipping 'writtenBytes' as a string
+    static std::string skipWrittenBytes(std::vector<std::string> formattedBuffers, const size_t writtenBytes)
+    {
+        std::vector<iovec> chunks;
+        for (auto& formattedBuffer : formattedBuffers)
+        {
+            chunks.emplace_back(iovec{.iov_base = formattedBuffer.data(), .iov_len = formattedBuffer.size()});
+        }
+        std::string remaining;
+        for (const auto& chunk : FileSink::skipWrittenBytes(chunks, writtenBytes))
+        {
+            remaining.append(static_cast<const char*>(chunk.iov_base), chunk.iov_len);
+        }
+        return remaining;
+    }
+
+    std::filesystem::path filePath;
+    Schema schema;
+    SinkCatalog sinkCatalog;
+    std::shared_ptr<BufferManager> bufferManager = BufferManager::create(BUFFER_SIZE, 64);
+    TestPipelineExecutionContext pipelineExecutionContext;
+};
+
+/// clang tidy doesn't recognize the .has_value in the EXPECT_TRUE
+/// NOLINTBEGIN(bugprone-unchecked-optional-access)
+TEST_F(FileSinkTest, WritesAllBuffersInOrderInBatches)
+{
+    /// A batch holds about three buffers, thus the writer writes many batches while the worker still enqueues buffers
+    auto sink = createSink({{"write_batch_size", std::to_string(3 * BUFFER_SIZE)}, {"write_interval_ms", "1"}});
+    sink->start(pipelineExecutionContext);
+    const auto expected = executeBuffers(*sink, 200, TUPLES_PER_BUFFER);
+    sink->stop(pipelineExecutionContext);
+    EXPECT_EQ(readFile(), expected);
+}
+
+TEST_F(FileSinkTest, WritesBatchesOfMoreBuffersThanASingleWritevCallAccepts)
+{
+    /// Neither the batch size nor the interval elapse, thus the writer writes all buffers in a single batch on stop, which takes several
+    /// writev calls of at most IOV_MAX chunks
+    auto sink = createSink({{"write_batch_size", std::to_string(64 * 1024 * 1024)}, {"write_interval_ms", "600000"}});
+    sink->start(pipelineExecutionContext);
+    const auto expected = executeBuffers(*sink, (2 * IOV_MAX) + 5, 3);
+    sink->stop(pipelineExecutionContext);
+    EXPECT_EQ(readFile(), expected);
+}
+
+TEST_F(FileSinkTest, ContinuesAPartialWriteInTheMiddleOfAChunk)
+{
+    const std::vector<std::string> formattedBuffers{"abc", "", "defg", "hi"};
+    EXPECT_EQ(skipWrittenBytes(formattedBuffers, 0), "abcdefghi");
+    EXPECT_EQ(skipWrittenBytes(formattedBuffers, 2), "cdefghi");
+    /// A partial write that ends at the end of a chunk skips the empty chunk after it as well
+    EXPECT_EQ(skipWrittenBytes(formattedBuffers, 3), "defghi");
+    EXPECT_EQ(skipWrittenBytes(formattedBuffers, 5), "fghi");
+    EXPECT_EQ(skipWrittenBytes(formattedBuffers, 8), "i");
+    EXPECT_EQ(skipWrittenBytes(formattedBuffers, 9), "");
+}
+
+TEST_F(FileSinkTest, ReportsTheErrorAfterAShortWrite)
+{
+    auto sink = createSink({{"write_batch_size", std::to_string(64 * 1024 * 1024)}, {"write_interval_ms", "600000"}});
+    sink->start(pipelineExecutionContext);
+    const auto expected = executeBuffers(*sink, 4097, TUPLES_PER_BUFFER);
+
+    /// The file size limit ends in the middle of a buffer, thus the single writev call of the batch writes a part of the batch and the
+    /// following call, which continues the partial write, fails with EFBIG instead of raising SIGXFSZ.
+    /// The limit of 16 MiB exceeds the other files of the test process, e.g., the log file, which must stay writable.
+    const auto fileSizeLimit = expected.size() - (BUFFER_SIZE / 2);
+    rlimit previousLimit{};
+    ASSERT_EQ(getrlimit(RLIMIT_FSIZE, &previousLimit), 0);
+    rlimit limit = previousLimit;
+    limit.rlim_cur = fileSizeLimit;
+    const auto previousHandler = std::signal(SIGXFSZ, SIG_IGN);
+    ASSERT_EQ(setrlimit(RLIMIT_FSIZE, &limit), 0);
+    ASSERT_EXCEPTION_ERRORCODE(sink->stop(pipelineExecutionContext), ErrorCode::CannotWriteToSink);
+    ASSERT_EQ(setrlimit(RLIMIT_FSIZE, &previousLimit), 0);
+    std::signal(SIGXFSZ, previousHandler);
+
+    /// The partial write wrote the bytes up to the limit in their order
+    EXPECT_EQ(readFile(), expected.substr(0, fileSizeLimit));
+}
+
+/// NOLINTEND(bugprone-unchecked-optional-access)
+
+}
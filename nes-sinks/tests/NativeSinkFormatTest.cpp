@@ -0,0 +1,157 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/DataTypeProvider.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <SinksParsing/NativeFormat.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+#include <ErrorHandling.hpp>
+
+namespace NES
+{
+
+class NativeSinkFormatTest : public Testing::BaseUnitTest
+{
+public:
+    struct Row
+    {
+        uint64_t id;
+        int32_t value;
+        bool flag;
+        char letter;
+        double price;
+    };
+
+    /// The native rows pack the fields of the schema without padding
+    static constexpr size_t ID_OFFSET = 0;
+    static constexpr size_t VALUE_OFFSET = ID_OFFSET + sizeof(uint64_t);
+    static constexpr size_t FLAG_OFFSET = VALUE_OFFSET + sizeof(int32_t);
+    static constexpr size_t LETTER_OFFSET = FLAG_OFFSET + sizeof(bool);
+    static constexpr size_t PRICE_OFFSET = LETTER_OFFSET + sizeof(char);
+    static constexpr size_t TUPLE_SIZE = PRICE_OFFSET + sizeof(double);
+
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("NativeSinkFormatTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup NativeSinkFormatTest test class.");
+    }
+
+    void SetUp() override
+    {
+        BaseUnitTest::SetUp();
+        schema.addField("id", DataTypeProvider::provideDataType(DataType::Type::UINT64));
+        schema.addField("value", DataTypeProvider::provideDataType(DataType::Type::INT32));
+        schema.addField("flag", DataTypeProvider::provideDataType(DataType::Type::BOOLEAN));
+        schema.addField("letter", DataTypeProvider::provideDataType(DataType::Type::CHAR));
+        schema.addField("price", DataTypeProvider::provideDataType(DataType::Type::FLOAT64));
+        ASSERT_EQ(schema.getSizeOfSchemaInBytes(), TUPLE_SIZE);
+    }
+
+    static Row createRow(const size_t index)
+    {
+        return Row{
+            .id = index,
+            .value = static_cast<int32_t>(index) - 7,
+            .flag = index % 2 == 0,
+            .letter = static_cast<char>('a' + (index % 26)),
+            .price = static_cast<double>(index) * 1.25};
+    }
+
+    TupleBuffer createBuffer(const size_t numberOfTuples) const
+    {
+        auto buffer = bufferManager->getBufferBlocking();
+        const auto memory = buffer.getAvailableMemoryArea<std::byte>();
+        for (size_t tuple = 0; tuple < numberOfTuples; ++tuple)
+        {
+            const auto row = createRow(tuple);
+            auto* const rowStart = &memory[tuple * TUPLE_SIZE];
+            std::memcpy(rowStart + ID_OFFSET, &row.id, sizeof(row.id));
+            std::memcpy(rowStart + VALUE_OFFSET, &row.value, sizeof(row.value));
+            std::memcpy(rowStart + FLAG_OFFSET, &row.flag, sizeof(row.flag));
+            std::memcpy(rowStart + LETTER_OFFSET, &row.letter, sizeof(row.letter));
+            std::memcpy(rowStart + PRICE_OFFSET, &row.price, sizeof(row.price));
+        }
+        buffer.setNumberOfTuples(numberOfTuples);
+        return buffer;
+    }
+
+    static Row readRow(const std::string& formatted, const size_t tuple)
+    {
+        const auto* const rowStart = formatted.data() + (tuple * TUPLE_SIZE);
+        Row row{};
+        std::memcpy(&row.id, rowStart + ID_OFFSET, sizeof(row.id));
+        std::memcpy(&row.value, rowStart + VALUE_OFFSET, sizeof(row.value));
+        std::memcpy(&row.flag, rowStart + FLAG_OFFSET, sizeof(row.flag));
+        std::memcpy(&row.letter, rowStart + LETTER_OFFSET, sizeof(row.letter));
+        std::memcpy(&row.price, rowStart + PRICE_OFFSET, sizeof(row.price));
+        return row;
+    }
+
+    Schema schema;
+    std::shared_ptr<BufferManager> bufferManager = BufferManager::create();
+};
+
+TEST_F(NativeSinkFormatTest, FormattedBufferContainsTheRowsOfAllTuples)
+{
+    const NativeFormat format(schema);
+    const auto numberOfTuples = bufferManager->getBufferSize() / TUPLE_SIZE;
+    const auto formatted = format.getFormattedBuffer(createBuffer(numberOfTuples));
+
+    /// The format writes the rows as they are, thus a consumer reads them back with the layout of the schema
+    ASSERT_EQ(formatted.size(), numberOfTuples * TUPLE_SIZE);
+    for (size_t tuple = 0; tuple < numberOfTuples; ++tuple)
+    {
+        const auto row = readRow(formatted, tuple);
+        const auto expected = createRow(tuple);
+        EXPECT_EQ(row.id, expected.id) << "tuple " << tuple;
+        EXPECT_EQ(row.value, expected.value) << "tuple " << tuple;
+        EXPECT_EQ(row.flag, expected.flag) << "tuple " << tuple;
+        EXPECT_EQ(row.letter, expected.letter) << "tuple " << tuple;
+        EXPECT_EQ(row.price, expected.price) << "tuple " << tuple;
+    }
+}
+
+TEST_F(NativeSinkFormatTest, FormattedBufferExcludesUnusedMemory)
+{
+    const NativeFormat format(schema);
+    EXPECT_EQ(format.getFormattedBuffer(createBuffer(3)).size(), 3 * TUPLE_SIZE);
+    EXPECT_TRUE(format.getFormattedBuffer(createBuffer(0)).empty());
+}
+
+TEST_F(NativeSinkFormatTest, SchemaLineDescribesTheLayoutOfTheRows)
+{
+    const NativeFormat format(schema);
+    EXPECT_EQ(format.getFormattedSchema(), "id:UINT64,value:INT32,flag:BOOLEAN,letter:CHAR,price:FLOAT64\n");
+}
+
+TEST_F(NativeSinkFormatTest, RejectsVariableSizedFields)
+{
+    schema.addField("name", DataTypeProvider::provideDataType(DataType::Type::VARSIZED));
+    ASSERT_EXCEPTION_ERRORCODE(const NativeFormat format(schema), ErrorCode::UnknownSinkFormat);
+}
+
+}
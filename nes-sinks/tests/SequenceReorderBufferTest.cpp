@@ -0,0 +1,222 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <Identifiers/Identifiers.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Sinks/SequenceReorderBuffer.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+
+namespace NES
+{
+
+class SequenceReorderBufferTest : public Testing::BaseUnitTest
+{
+public:
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("SequenceReorderBufferTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup SequenceReorderBufferTest test class.");
+    }
+
+    void SetUp() override { BaseUnitTest::SetUp(); }
+
+    /// Inserts a buffer, whose formatted content names its origin, sequence number and chunk number, e.g., '1:3.2'
+    void insert(const uint64_t originId, const uint64_t sequenceNumber, const uint64_t chunkNumber, const bool isLastChunk)
+    {
+        auto buffer = bufferManager->getBufferBlocking();
+        buffer.setOriginId(OriginId(originId));
+        buffer.setSequenceNumber(SequenceNumber(sequenceNumber));
+        buffer.setChunkNumber(ChunkNumber(chunkNumber));
+        buffer.setLastChunk(isLastChunk);
+        reorderBuffer.insert(buffer, format(originId, sequenceNumber, chunkNumber));
+    }
+
+    static std::string format(const uint64_t originId, const uint64_t sequenceNumber, const uint64_t chunkNumber)
+    {
+        return fmt::format("{}:{}.{}", originId, sequenceNumber, chunkNumber);
+    }
+
+    std::vector<std::string> takeCommittable()
+    {
+        std::vector<std::string> committed;
+        const auto numberOfBytes = reorderBuffer.takeCommittable(committed);
+        EXPECT_EQ(numberOfBytes, countBytes(committed));
+        return committed;
+    }
+
+    std::vector<std::string> takeRemaining()
+    {
+        std::vector<std::string> committed;
+        const auto numberOfBytes = reorderBuffer.takeRemaining(committed);
+        EXPECT_EQ(numberOfBytes, countBytes(committed));
+        return committed;
+    }
+
+    static size_t countBytes(const std::vector<std::string>& formattedBuffers)
+    {
+        size_t numberOfBytes = 0;
+        for (const auto& formattedBuffer : formattedBuffers)
+        {
+            numberOfBytes += formattedBuffer.size();
+        }
+        return numberOfBytes;
+    }
+
+    std::shared_ptr<BufferManager> bufferManager = BufferManager::create(1024, 64);
+    SequenceReorderBuffer reorderBuffer;
+};
+
+TEST_F(SequenceReorderBufferTest, CommitsOutOfOrderSequenceNumbersInOrder)
+{
+    insert(1, 3, 1, true);
+    insert(1, 2, 1, true);
+    /// Sequence number 1 is missing, thus nothing is committable
+    EXPECT_TRUE(takeCommittable().empty());
+    EXPECT_EQ(reorderBuffer.getNumberOfPendingBuffers(), 2U);
+
+    insert(1, 1, 1, true);
+    EXPECT_EQ(takeCommittable(), (std::vector{format(1, 1, 1), format(1, 2, 1), format(1, 3, 1)}));
+    EXPECT_EQ(reorderBuffer.getNumberOfPendingBuffers(), 0U);
+
+    insert(1, 5, 1, true);
+    insert(1, 4, 1, true);
+    EXPECT_EQ(takeCommittable(), (std::vector{format(1, 4, 1), format(1, 5, 1)}));
+    EXPECT_TRUE(takeCommittable().empty());
+}
+
+TEST_F(SequenceReorderBufferTest, CommitsASequenceNumberOnceAllOfItsChunksArrived)
+{
+    insert(1, 1, 3, true);
+    insert(1, 1, 1, false);
+    /// The last chunk tells the number of chunks, but chunk 2 is missing
+    EXPECT_TRUE(takeCommittable().empty());
+    insert(1, 2, 1, true);
+    EXPECT_TRUE(takeCommittable().empty());
+
+    insert(1, 1, 2, false);
+    EXPECT_EQ(takeCommittable(), (std::vector{format(1, 1, 1), format(1, 1, 2), format(1, 1, 3), format(1, 2, 1)}));
+}
+
+TEST_F(SequenceReorderBufferTest, OrdersTheBuffersOfEveryOriginSeparately)
+{
+    insert(1, 2, 1, true);
+    insert(2, 1, 1, true);
+    /// Origin 2 is complete up to sequence number 1, while origin 1 still waits for it
+    EXPECT_EQ(takeCommittable(), (std::vector{format(2, 1, 1)}));
+
+    insert(1, 1, 1, true);
+    EXPECT_EQ(takeCommittable(), (std::vector{format(1, 1, 1), format(1, 2, 1)}));
+}
+
+TEST_F(SequenceReorderBufferTest, TakesTheBuffersOfIncompleteSequenceNumbersInOrderOnFlush)
+{
+    insert(1, 1, 1, true);
+    insert(1, 4, 1, true);
+    insert(1, 3, 2, true);
+    EXPECT_EQ(takeCommittable(), (std::vector{format(1, 1, 1)}));
+
+    /// Neither sequence number 2 nor chunk 1 of sequence number 3 arrive, e.g., because the sink stops
+    EXPECT_EQ(takeRemaining(), (std::vector{format(1, 3, 2), format(1, 4, 1)}));
+    EXPECT_EQ(reorderBuffer.getNumberOfPendingBuffers(), 0U);
+    EXPECT_TRUE(takeRemaining().empty());
+}
+
+TEST_F(SequenceReorderBufferTest, CommitsTheBuffersOfConcurrentWorkerThreadsInOrder)
+{
+    constexpr size_t numberOfThreads = 4;
+    constexpr uint64_t numberOfSequenceNumbers = 1000;
+    constexpr uint64_t numberOfChunks = 2;
+    constexpr uint64_t numberOfOrigins = 2;
+
+    /// Every thread inserts its share of the sequence numbers in descending order and the last chunk first, thus most buffers arrive out
+    /// of order, while a single committer takes the committable buffers concurrently
+    std::atomic<size_t> numberOfRunningThreads = numberOfThreads;
+    std::vector<std::string> committed;
+    {
+        std::jthread committer(
+            [&]
+            {
+                while (numberOfRunningThreads > 0)
+                {
+                    reorderBuffer.takeCommittable(committed);
+                }
+            });
+        std::vector<std::jthread> workers;
+        for (size_t threadIdx = 0; threadIdx < numberOfThreads; ++threadIdx)
+        {
+            workers.emplace_back(
+                [&, threadIdx]
+                {
+                    for (auto sequenceNumber = numberOfSequenceNumbers; sequenceNumber > 0; --sequenceNumber)
+                    {
+                        if (sequenceNumber % numberOfThreads != threadIdx)
+                        {
+                            continue;
+                        }
+                        for (uint64_t originId = 1; originId <= numberOfOrigins; ++originId)
+                        {
+                            for (auto chunkNumber = numberOfChunks; chunkNumber > 0; --chunkNumber)
+                            {
+                                insert(originId, sequenceNumber, chunkNumber, chunkNumber == numberOfChunks);
+                            }
+                        }
+                    }
+                    --numberOfRunningThreads;
+                });
+        }
+    }
+
+    /// Once all workers finished, every sequence number is complete, thus the final commit takes all buffers left by the committer
+    reorderBuffer.takeCommittable(committed);
+    EXPECT_EQ(reorderBuffer.getNumberOfPendingBuffers(), 0U);
+    ASSERT_EQ(committed.size(), numberOfOrigins * numberOfSequenceNumbers * numberOfChunks);
+
+    /// The buffers of different origins interleave, but the buffers of every origin follow their order
+    for (uint64_t originId = 1; originId <= numberOfOrigins; ++originId)
+    {
+        std::vector<std::string> expected;
+        for (uint64_t sequenceNumber = 1; sequenceNumber <= numberOfSequenceNumbers; ++sequenceNumber)
+        {
+            for (uint64_t chunkNumber = 1; chunkNumber <= numberOfChunks; ++chunkNumber)
+            {
+                expected.emplace_back(format(originId, sequenceNumber, chunkNumber));
+            }
+        }
+        std::vector<std::string> committedOfOrigin;
+        for (const auto& formattedBuffer : committed)
+        {
+            if (formattedBuffer.starts_with(fmt::format("{}:", originId)))
+            {
+                committedOfOrigin.emplace_back(formattedBuffer);
+            }
+        }
+        EXPECT_EQ(committedOfOrigin, expected);
+    }
+}
+
+}
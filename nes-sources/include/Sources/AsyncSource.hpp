@@ -0,0 +1,43 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <Runtime/TupleBuffer.hpp>
+#include <Sources/Source.hpp>
+
+namespace NES
+{
+
+/// AsyncSource is the non-blocking variant of Source. Instead of blocking in 'fillTupleBuffer()' on a SourceThread of its own, it exposes
+/// the file descriptor it reads from. Given an AsyncSourceRuntime, one of its I/O threads waits until the descriptor becomes readable and
+/// then calls 'tryFillTupleBuffer()'. Thus, a few I/O threads ingest data from many sources.
+/// AsyncSources remain Sources, i.e., without an AsyncSourceRuntime, a SourceThread drives them via the blocking 'fillTupleBuffer()'.
+class AsyncSource : public Source
+{
+public:
+    /// Returns the descriptor the source reads from, which must be valid between 'open()' and 'close()'.
+    /// Returns std::nullopt, if the source is always readable, e.g., a regular file, which epoll cannot wait for.
+    /// The descriptor may change during a call to 'tryFillTupleBuffer()' that appended no bytes, e.g., once a listening socket accepted the
+    /// connection that the source reads from. The source may have closed the previous descriptor.
+    [[nodiscard]] virtual std::optional<int> getFileDescriptor() const = 0;
+
+    /// Appends the currently available bytes to the buffer, starting at 'offset', without blocking.
+    /// @return the number of appended bytes, which is zero if no data is available (yet), or std::nullopt at the end of the stream
+    virtual std::optional<size_t> tryFillTupleBuffer(TupleBuffer& tupleBuffer, size_t offset) = 0;
+};
+
+}
@@ -0,0 +1,54 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace NES
+{
+
+/// Hides the AsyncSourceIOThread implementation.
+class AsyncSourceIOThread;
+
+/// Ingests data from many AsyncSources on a small pool of I/O threads, instead of running one thread per source.
+/// Each I/O thread waits via epoll until the descriptors of its sources become readable, fills pooled buffers from them and emits the
+/// buffers like a SourceThread, i.e., it assigns the same buffer metadata and applies the same backpressure.
+/// A SourceThread, whose source implements AsyncSource, registers the source with the I/O thread that owns the fewest sources.
+/// The runtime must outlive all SourceThreads that use it, which is why they share its ownership.
+class AsyncSourceRuntime
+{
+public:
+    explicit AsyncSourceRuntime(size_t numberOfIOThreads);
+    ~AsyncSourceRuntime();
+
+    AsyncSourceRuntime(const AsyncSourceRuntime&) = delete;
+    AsyncSourceRuntime(AsyncSourceRuntime&&) = delete;
+    AsyncSourceRuntime& operator=(const AsyncSourceRuntime&) = delete;
+    AsyncSourceRuntime& operator=(AsyncSourceRuntime&&) = delete;
+
+    [[nodiscard]] size_t getNumberOfIOThreads() const;
+
+private:
+    friend class SourceThread;
+
+    /// Returns the I/O thread that currently owns the fewest sources
+    AsyncSourceIOThread& selectIOThread();
+
+    std::vector<std::unique_ptr<AsyncSourceIOThread>> ioThreads;
+};
+
+}
@@ -15,11 +15,13 @@
 #pragma once
 
 #include <cstddef>
+#include <optional>
 #include <stop_token>
 #include <string>
 #include <Runtime/TupleBuffer.hpp>
 #include <Sources/SourceDescriptor.hpp>
 #include <Util/Logger/Formatter.hpp>
+#include <ErrorHandling.hpp>
 
 namespace NES
 {
@@ -37,6 +39,17 @@ public:
     /// @return the number of bytes read
     virtual size_t fillTupleBuffer(TupleBuffer& tupleBuffer, const std::stop_token& stopToken) = 0;
 
+    /// Sources that hold their data in memory, e.g., a memory-mapped file, may hand out regions of it as TupleBuffers instead of copying
+    /// them into pooled TupleBuffers, c.f., 'TupleBuffer::wrapMemory()'. If true, the SourceThread calls 'provideTupleBuffer()' instead of
+    /// 'fillTupleBuffer()'.
+    [[nodiscard]] virtual bool providesTupleBuffers() const { return false; }
+
+    /// Returns the next region of the data as a TupleBuffer, whose bytes are all valid, or nullopt at the end of the stream.
+    virtual std::optional<TupleBuffer> provideTupleBuffer(const std::stop_token&)
+    {
+        throw NotImplemented("The source does not provide its own TupleBuffers");
+    }
+
     /// If applicable, opens a connection, e.g., a socket connection to get ready for data consumption.
     virtual void open() = 0;
     /// If applicable, closes a connection, e.g., a socket connection.
@@ -16,7 +16,6 @@
 
 #include <atomic>
 #include <cstdint>
-#include <mutex>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -27,12 +26,15 @@
 #include <Identifiers/Identifiers.hpp>
 #include <Sources/LogicalSource.hpp>
 #include <Sources/SourceDescriptor.hpp>
+#include <folly/Synchronized.h>
 
 namespace NES
 {
 /// @brief The source catalog handles the mapping of logical to physical sources.
 /// We expect the class to be used behind frontends that permit concurrent read-write access (like a REST server),
 /// so all individual operations in this class are thread safe and atomic.
+/// Registering a physical source validates its configuration before locking the catalog, so that concurrent registrations solely
+/// serialize on inserting the validated descriptors.
 class SourceCatalog
 {
 public:
@@ -88,10 +90,16 @@ public:
 
 
 private:
-    mutable std::recursive_mutex catalogMutex;
+    /// All mappings change together, thus a single lock guards them. Binding queries solely reads the catalog, thus lookups take the lock
+    /// shared and do not wait for each other, c.f., folly::Synchronized.
+    struct Mappings
+    {
+        std::unordered_map<std::string, LogicalSource> namesToLogicalSourceMapping;
+        std::unordered_map<PhysicalSourceId, SourceDescriptor> idsToPhysicalSources;
+        std::unordered_map<LogicalSource, std::unordered_set<SourceDescriptor>> logicalToPhysicalSourceMapping;
+    };
+
     mutable std::atomic<PhysicalSourceId::Underlying> nextPhysicalSourceId{INITIAL_PHYSICAL_SOURCE_ID.getRawValue()};
-    std::unordered_map<std::string, LogicalSource> namesToLogicalSourceMapping;
-    std::unordered_map<PhysicalSourceId, SourceDescriptor> idsToPhysicalSources;
-    std::unordered_map<LogicalSource, std::unordered_set<SourceDescriptor>> logicalToPhysicalSourceMapping;
+    folly::Synchronized<Mappings> mappings;
 };
 }
@@ -23,6 +23,8 @@
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <Configurations/Descriptor.hpp>
 #include <Configurations/Enums/EnumWrapper.hpp>
@@ -46,6 +48,14 @@ struct ParserConfig
     std::string parserType;
     std::string tupleDelimiter;
     std::string fieldDelimiter;
+    /// If set, the input formatter splits each raw buffer into ranges of at most this many bytes that worker threads format concurrently.
+    /// Thus, sources may read large buffers to amortize the cost of I/O, without formatting each buffer on a single worker thread.
+    /// Raw buffers of the native format are split into morsels of whole tuples, which successors process as chunks of the raw buffer.
+    /// Zero (default) formats each raw buffer as a whole.
+    size_t maxBytesPerFormattingTask = 0;
+    /// If set, the input formatter stores the values of var sized fields in the VarSizedDictionary, which all sources share.
+    /// Thus, the tuple buffers of low-cardinality fields, e.g., station names, do not carry a copy of each value.
+    bool dictionaryEncoding = false;
     friend bool operator==(const ParserConfig& lhs, const ParserConfig& rhs) = default;
     friend std::ostream& operator<<(std::ostream& os, const ParserConfig& obj);
     static ParserConfig create(std::unordered_map<std::string, std::string> configMap);
@@ -73,6 +83,12 @@ public:
 
     [[nodiscard]] PhysicalSourceId getPhysicalSourceId() const;
 
+    /// Returns a descriptor per partition of the physical source, which differ solely in their PARTITION_INDEX, or the descriptor itself
+    /// if the source is not partitioned
+    [[nodiscard]] std::vector<SourceDescriptor> partition() const;
+    /// Returns the index of the partition and the number of partitions of the physical source, which the descriptor reads
+    [[nodiscard]] std::pair<size_t, size_t> getPartition() const;
+
     [[nodiscard]] SerializableSourceDescriptor serialize() const;
     [[nodiscard]] std::string explain(ExplainVerbosity verbosity) const;
 
@@ -104,9 +120,41 @@ public:
         [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(MAX_INFLIGHT_BUFFERS, config); }};
 
 
+    /// If set, all queries that read the same physical source share a single instance of the source, e.g., a single socket connection,
+    /// and read the same raw buffers, instead of ingesting the data once per query. A query that starts later reads from the current
+    /// position of the shared source on, thus sharing only suits sources that do not replay their data to each query.
+    /// NOLINTNEXTLINE(cert-err58-cpp)
+    static inline const DescriptorConfig::ConfigParameter<bool> SHARED{
+        "shared", false, [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(SHARED, config); }};
+
+    /// Splits the physical source into this many partitions, which the LogicalSourceExpansionRule expands into sources of their own, thus
+    /// separate SourceThreads ingest them in parallel as origins of their own, whose watermarks the successors merge. Solely sources that
+    /// can split their input accept it in their configuration, e.g., the FileSource by byte ranges and the TCPSource by connections.
+    /// NOLINTNEXTLINE(cert-err58-cpp)
+    static inline const DescriptorConfig::ConfigParameter<size_t> NUMBER_OF_PARTITIONS{
+        "partitions",
+        1,
+        [](const std::unordered_map<std::string, std::string>& config) -> std::optional<size_t>
+        {
+            const auto numberOfPartitions = DescriptorConfig::tryGet(NUMBER_OF_PARTITIONS, config);
+            if (numberOfPartitions.has_value() and numberOfPartitions.value() == 0)
+            {
+                NES_ERROR("A source requires at least one partition");
+                return std::nullopt;
+            }
+            return numberOfPartitions;
+        }};
+
+    /// Set by 'partition()' for every partition, thus it is no parameter that users configure
+    /// NOLINTNEXTLINE(cert-err58-cpp)
+    static inline const DescriptorConfig::ConfigParameter<size_t> PARTITION_INDEX{
+        "partition_index",
+        0,
+        [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(PARTITION_INDEX, config); }};
+
     /// NOLINTNEXTLINE(cert-err58-cpp)
     static inline std::unordered_map<std::string, DescriptorConfig::ConfigParameterContainer> parameterMap
-        = DescriptorConfig::createConfigParameterContainerMap(MAX_INFLIGHT_BUFFERS);
+        = DescriptorConfig::createConfigParameterContainerMap(MAX_INFLIGHT_BUFFERS, SHARED);
 };
 
 }
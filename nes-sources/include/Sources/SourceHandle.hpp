@@ -18,6 +18,7 @@
 #include <cstddef>
 #include <memory>
 #include <Runtime/AbstractBufferProvider.hpp>
+#include <Sources/AsyncSourceRuntime.hpp>
 #include <Sources/Source.hpp>
 #include <Sources/SourceReturnType.hpp>
 #include <Util/Logger/Formatter.hpp>
@@ -33,6 +34,9 @@ class SourceThread;
 struct SourceRuntimeConfiguration
 {
     size_t inflightBufferLimit;
+    /// If set, the source emits its buffers directly to the successors of its input formatter, as they already contain tuples of this size
+    /// in the row layout, c.f., 'CompiledQueryPlan::Source'. Thus, the buffers carry their number of tuples instead of their bytes.
+    size_t formattedTupleSizeInBytes = 0;
 };
 
 /// Interface class to handle sources.
@@ -47,7 +51,8 @@ public:
         OriginId originId, /// Todo #241: Rethink use of originId for sources, use new identifier for unique identification.
         SourceRuntimeConfiguration configuration,
         std::shared_ptr<AbstractBufferProvider> bufferPool,
-        std::unique_ptr<Source> sourceImplementation);
+        std::unique_ptr<Source> sourceImplementation,
+        std::shared_ptr<AsyncSourceRuntime> asyncSourceRuntime = nullptr);
 
     ~SourceHandle();
 
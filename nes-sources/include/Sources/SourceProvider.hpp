@@ -13,16 +13,21 @@
 */
 #pragma once
 
+#include <cstddef>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 
 #include <Identifiers/Identifiers.hpp>
 #include <Runtime/AbstractBufferProvider.hpp>
+#include <Sources/AsyncSourceRuntime.hpp>
 #include <Sources/SourceDescriptor.hpp>
 #include <Sources/SourceHandle.hpp>
 
 namespace NES
 {
+class SharedSourceReader;
 
 /// Takes a SourceDescriptor and in exchange returns a SourceHandle.
 /// The SourceThread spawns an independent thread for data ingestion and it manages the pipeline and task logic.
@@ -31,13 +36,25 @@ class SourceProvider
 {
     size_t defaultMaxInflightBuffers;
     std::shared_ptr<AbstractBufferProvider> bufferPool;
+    std::shared_ptr<AsyncSourceRuntime> asyncSourceRuntime;
+    /// Readers of the shared sources, c.f., 'SourceDescriptor::SHARED'. A reader lives as long as one of the queries that share it.
+    mutable std::mutex sharedSourcesMutex;
+    mutable std::unordered_map<SourceDescriptor, std::weak_ptr<SharedSourceReader>> sharedSources;
+
+    [[nodiscard]] std::unique_ptr<Source> createSharedSource(const SourceDescriptor& sourceDescriptor) const;
 
 public:
     /// Constructor that can be configured with various options
-    SourceProvider(size_t defaultMaxInflightBuffers, std::shared_ptr<AbstractBufferProvider> bufferPool);
+    /// @param asyncSourceRuntime if set, drives all sources that implement AsyncSource instead of a thread per source
+    SourceProvider(
+        size_t defaultMaxInflightBuffers,
+        std::shared_ptr<AbstractBufferProvider> bufferPool,
+        std::shared_ptr<AsyncSourceRuntime> asyncSourceRuntime = nullptr);
 
     /// Returning a shared pointer, because sources may be shared by multiple executable query plans (qeps).
-    [[nodiscard]] std::unique_ptr<SourceHandle> lower(OriginId originId, const SourceDescriptor& sourceDescriptor) const;
+    /// @param formattedTupleSizeInBytes if set, the source emits formatted buffers of tuples of this size, c.f., SourceRuntimeConfiguration
+    [[nodiscard]] std::unique_ptr<SourceHandle>
+    lower(OriginId originId, const SourceDescriptor& sourceDescriptor, size_t formattedTupleSizeInBytes = 0) const;
 
     [[nodiscard]] bool contains(const std::string& sourceType) const;
 };
@@ -0,0 +1,121 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stop_token>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
+#include <Runtime/AbstractBufferProvider.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Sources/AsyncSource.hpp>
+#include <Sources/SourceReturnType.hpp>
+#include <SourceThread.hpp>
+
+namespace NES
+{
+
+/// Drives the AsyncSources that the AsyncSourceRuntime assigned to it on a single thread, c.f., AsyncSourceRuntime.
+/// The thread waits via epoll for the descriptors of its sources and an eventfd, which wakes it up on registrations and stop requests.
+/// Level-triggered epoll reports a descriptor until the source read all available bytes. Thus, the thread fills at most one buffer per
+/// source and wakeup, which keeps a busy source from starving the other ones.
+/// If the buffer pool is exhausted, the thread stops watching the source until it succeeds in acquiring a buffer, instead of blocking.
+class AsyncSourceIOThread
+{
+public:
+    /// Everything a SourceThread hands over to the I/O thread, which owns it until the source terminates.
+    struct Registration
+    {
+        OriginId originId;
+        AsyncSource& source; ///NOLINT The SourceThread owns the source and waits for the termination before releasing it
+        std::shared_ptr<AbstractBufferProvider> bufferProvider;
+        SourceReturnType::EmitFunction emit;
+        /// Zero, if the source emits raw buffers to an input formatter, c.f., SourceRuntimeConfiguration
+        size_t formattedTupleSizeInBytes;
+        std::promise<SourceImplementationTermination> termination;
+        std::stop_token stopToken;
+    };
+
+    explicit AsyncSourceIOThread(size_t ioThreadIdx);
+    ~AsyncSourceIOThread();
+
+    AsyncSourceIOThread(const AsyncSourceIOThread&) = delete;
+    AsyncSourceIOThread(AsyncSourceIOThread&&) = delete;
+    AsyncSourceIOThread& operator=(const AsyncSourceIOThread&) = delete;
+    AsyncSourceIOThread& operator=(AsyncSourceIOThread&&) = delete;
+
+    /// Thread-safe. The I/O thread opens the source and sets the termination of the registration, once the source terminated.
+    void registerSource(Registration registration);
+
+    [[nodiscard]] size_t getNumberOfSources() const;
+
+private:
+    struct ActiveSource
+    {
+        explicit ActiveSource(Registration registration) : registration(std::move(registration)) { }
+
+        Registration registration;
+        std::optional<int> fileDescriptor;
+        std::optional<std::stop_callback<std::function<void()>>> wakeUpOnStop;
+        std::optional<TupleBuffer> buffer;
+        size_t numberOfBytesInBuffer{0};
+        /// Bytes of the last tuple of the previous buffer, if the source emits formatted buffers and read only a part of the tuple.
+        /// The next buffer starts with them, thus every emitted buffer contains whole tuples.
+        std::vector<std::byte> partialTuple;
+        size_t nextSequenceNumber{SequenceNumber::INITIAL};
+        bool isOpen{false};
+        bool isWaitingForBuffer{false};
+        bool isTerminated{false};
+    };
+
+    void run(const std::stop_token& stopToken);
+    void wakeUp() const;
+
+    void activatePendingSources();
+    /// Fills the buffer of the source with the available bytes and emits it, once it is full or the source has no more bytes available.
+    /// A source that emits formatted buffers waits for its first whole tuple.
+    void ingest(ActiveSource& activeSource);
+    bool tryAcquireBuffer(ActiveSource& activeSource);
+    void emitBuffer(ActiveSource& activeSource);
+    void watch(const ActiveSource& activeSource, bool isWatched) const;
+    /// Watches the new descriptor instead of the previous one, if the source changed it, c.f., AsyncSource::getFileDescriptor()
+    void updateFileDescriptor(ActiveSource& activeSource) const;
+    void terminate(ActiveSource& activeSource, SourceImplementationTermination termination);
+    void fail(ActiveSource& activeSource, const std::exception& exception);
+    void closeSource(ActiveSource& activeSource);
+
+    int epollFd;
+    int wakeUpFd;
+    std::atomic<size_t> numberOfSources{0};
+
+    std::mutex pendingRegistrationsMutex;
+    std::vector<Registration> pendingRegistrations;
+
+    /// Only accessed by the I/O thread
+    std::vector<std::unique_ptr<ActiveSource>> activeSources;
+
+    std::jthread thread;
+};
+
+}
@@ -16,24 +16,36 @@
 
 #include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <fstream>
+#include <limits>
 #include <memory>
 #include <optional>
 #include <stop_token>
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <utility>
+#include <unistd.h>
 
 #include <Runtime/TupleBuffer.hpp>
-#include <Sources/Source.hpp>
+#include <Sources/AsyncSource.hpp>
 #include <Sources/SourceDescriptor.hpp>
+#include <Util/Logger/Logger.hpp>
 
 namespace NES
 {
 
 static constexpr std::string_view SYSTEST_FILE_PATH_PARAMETER = "file_path";
 
-class FileSource final : public Source
+/// Opts into the AsyncSourceRuntime as an always readable source, because epoll cannot wait for regular files.
+/// If 'memory_mapped' is set, the source maps the file into memory and hands out regions of the mapping as TupleBuffers, instead of
+/// copying the file from the page cache into pooled TupleBuffers. The mapping remains valid until the source is closed and all of its
+/// TupleBuffers are released. Released regions give up their pages, thus replaying large files does not grow the resident memory.
+/// A partitioned source, c.f., SourceDescriptor::NUMBER_OF_PARTITIONS, reads solely the byte range of its partition. The ranges start and
+/// end at tuple boundaries, i.e., after a tuple delimiter or, for the native format, at a multiple of the tuple size, thus every tuple
+/// belongs to exactly one partition.
+class FileSource final : public AsyncSource
 {
 public:
     static constexpr std::string_view NAME = "File";
@@ -48,6 +60,12 @@ public:
 
     size_t fillTupleBuffer(TupleBuffer& tupleBuffer, const std::stop_token& stopToken) override;
 
+    [[nodiscard]] bool providesTupleBuffers() const override;
+    std::optional<TupleBuffer> provideTupleBuffer(const std::stop_token& stopToken) override;
+
+    [[nodiscard]] std::optional<int> getFileDescriptor() const override;
+    std::optional<size_t> tryFillTupleBuffer(TupleBuffer& tupleBuffer, size_t offset) override;
+
     /// Open file socket.
     void open() override;
     /// Close file socket.
@@ -59,9 +77,33 @@ public:
     [[nodiscard]] std::ostream& toString(std::ostream& str) const override;
 
 private:
+    struct MappedFile;
+
+    void openMapping(const char* realPath);
+    /// Returns the byte range of the file that the partition of this source reads
+    [[nodiscard]] std::pair<size_t, size_t> computePartitionRange(size_t fileSize);
+    /// Returns the offset after the first tuple delimiter at or after the byte that precedes the offset, or the file size if there is none
+    [[nodiscard]] size_t findTupleStart(size_t offset, size_t fileSize);
+
     std::ifstream inputFile;
     std::string filePath;
     std::atomic<size_t> totalNumBytesRead;
+
+    size_t partitionIndex;
+    size_t numberOfPartitions;
+    char tupleDelimiter;
+    /// Zero, unless the file contains tuples in the native format
+    size_t nativeTupleSizeInBytes;
+    /// Number of bytes of the partition that the copying source did not read yet
+    size_t remainingBytes{std::numeric_limits<size_t>::max()};
+
+    bool isMemoryMapped;
+    size_t memoryMappedRegionSize;
+    /// Shared with the TupleBuffers that wrap regions of the mapping
+    std::shared_ptr<MappedFile> mappedFile;
+    size_t nextRegionOffset{0};
+    /// End of the partition in the mapping
+    size_t regionsEnd{0};
 };
 
 struct ConfigParametersCSV
@@ -70,9 +112,37 @@ struct ConfigParametersCSV
         std::string(SYSTEST_FILE_PATH_PARAMETER),
         std::nullopt,
         [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(FILEPATH, config); }};
+    static inline const DescriptorConfig::ConfigParameter<bool> MEMORY_MAPPED{
+        "memory_mapped",
+        false,
+        [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(MEMORY_MAPPED, config); }};
+    /// Size of the regions of the mapping that the source hands out as TupleBuffers, must be a multiple of the page size
+    static inline const DescriptorConfig::ConfigParameter<size_t> MEMORY_MAPPED_REGION_SIZE{
+        "memory_mapped_region_size",
+        1024 * 1024,
+        [](const std::unordered_map<std::string, std::string>& config) -> std::optional<size_t>
+        {
+            const auto regionSize = DescriptorConfig::tryGet(MEMORY_MAPPED_REGION_SIZE, config);
+            if (not regionSize.has_value())
+            {
+                return regionSize;
+            }
+            const auto pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+            if (regionSize.value() == 0 or regionSize.value() % pageSize != 0
+                or regionSize.value() > std::numeric_limits<uint32_t>::max())
+            {
+                NES_ERROR(
+                    "FileSource memory mapped region size is {}, but it must be a positive multiple of the page size {} below 4 GiB",
+                    regionSize.value(),
+                    pageSize);
+                return std::nullopt;
+            }
+            return regionSize;
+        }};
 
     static inline std::unordered_map<std::string, DescriptorConfig::ConfigParameterContainer> parameterMap
-        = DescriptorConfig::createConfigParameterContainerMap(SourceDescriptor::parameterMap, FILEPATH);
+        = DescriptorConfig::createConfigParameterContainerMap(
+            SourceDescriptor::parameterMap, FILEPATH, MEMORY_MAPPED, MEMORY_MAPPED_REGION_SIZE, SourceDescriptor::NUMBER_OF_PARTITIONS);
 };
 
 }
@@ -0,0 +1,111 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <stop_token>
+#include <Runtime/AbstractBufferProvider.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Sources/Source.hpp>
+#include <Util/Logger/Formatter.hpp>
+
+namespace NES
+{
+
+/// Reads a single source on behalf of all queries that subscribed to it, c.f., 'SourceDescriptor::SHARED'.
+/// There is no dedicated thread for the source. Instead, the subscriber that runs out of buffers first reads the next buffer and hands out
+/// a view of it to every subscriber, thus all queries ingest the same bytes, while the source reads them once.
+/// The first subscriber opens the source and the last one closes it. A subscriber reads the buffers that the source read after it subscribed.
+/// Each subscriber queues at most MAX_PENDING_BUFFERS buffers, thus the slowest query paces the source.
+class SharedSourceReader
+{
+public:
+    static constexpr size_t MAX_PENDING_BUFFERS = 16;
+
+    struct Subscription
+    {
+        std::deque<TupleBuffer> pendingBuffers;
+    };
+
+    SharedSourceReader(std::unique_ptr<Source> source, std::shared_ptr<AbstractBufferProvider> bufferProvider);
+
+    /// Opens the source, if this is the first subscription
+    std::shared_ptr<Subscription> subscribe();
+    /// Closes the source, if this was the last subscription
+    void unsubscribe(const std::shared_ptr<Subscription>& subscription);
+
+    /// Returns the next buffer of the subscription or nullopt at the end of the stream or if a stop was requested.
+    /// Rethrows the failure of the source to every subscriber.
+    std::optional<TupleBuffer> getNextBuffer(Subscription& subscription, const std::stop_token& stopToken);
+
+    [[nodiscard]] size_t getNumberOfSubscriptions() const;
+
+    friend std::ostream& operator<<(std::ostream& out, const SharedSourceReader& reader);
+
+private:
+    /// Reads the next buffer from the source. Returns nullopt if the source reached the end of the stream.
+    std::optional<TupleBuffer> readFromSource(const std::stop_token& stopToken);
+    [[nodiscard]] bool hasFullSubscription() const;
+
+    std::unique_ptr<Source> source;
+    std::shared_ptr<AbstractBufferProvider> bufferProvider;
+
+    mutable std::mutex mutex;
+    std::condition_variable_any stateChanged;
+    std::list<std::shared_ptr<Subscription>> subscriptions;
+    bool isReading{false};
+    bool isEndOfStream{false};
+    std::exception_ptr failure;
+};
+
+/// The Source of a single query that reads from a SharedSourceReader
+class SharedSource final : public Source
+{
+public:
+    explicit SharedSource(std::shared_ptr<SharedSourceReader> reader);
+    ~SharedSource() override = default;
+
+    SharedSource(const SharedSource&) = delete;
+    SharedSource& operator=(const SharedSource&) = delete;
+    SharedSource(SharedSource&&) = delete;
+    SharedSource& operator=(SharedSource&&) = delete;
+
+    size_t fillTupleBuffer(TupleBuffer& tupleBuffer, const std::stop_token& stopToken) override;
+
+    [[nodiscard]] bool providesTupleBuffers() const override { return true; }
+
+    std::optional<TupleBuffer> provideTupleBuffer(const std::stop_token& stopToken) override;
+
+    void open() override;
+    void close() override;
+
+    [[nodiscard]] std::ostream& toString(std::ostream& str) const override;
+
+private:
+    std::shared_ptr<SharedSourceReader> reader;
+    std::shared_ptr<SharedSourceReader::Subscription> subscription;
+};
+
+}
+
+FMT_OSTREAM(NES::SharedSourceReader);
@@ -25,6 +25,7 @@
 #include <Identifiers/Identifiers.hpp>
 #include <Runtime/AbstractBufferProvider.hpp>
 #include <Runtime/TupleBuffer.hpp>
+#include <Sources/AsyncSourceRuntime.hpp>
 #include <Sources/Source.hpp>
 #include <Sources/SourceReturnType.hpp>
 #include <Util/Logger/Formatter.hpp>
@@ -46,7 +47,18 @@ struct SourceImplementationTermination
     }
 };
 
+namespace detail
+{
+/// Sets the origin, creation timestamp, sequence number and chunk metadata of a buffer that a source filled
+void addBufferMetaData(OriginId originId, SequenceNumber sequenceNumber, TupleBuffer& buffer);
+/// Raw buffers carry their number of bytes as their number of tuples, which the InputFormatterTask uses to determine the number of tuples.
+/// If the source emits formatted buffers, i.e., 'formattedTupleSizeInBytes' is set, the buffer must contain whole tuples.
+void setNumberOfTuplesOfFilledBuffer(TupleBuffer& buffer, size_t numberOfBytes, size_t formattedTupleSizeInBytes);
+}
+
 /// The sourceThread starts a detached thread that runs 'runningRoutine()' upon calling 'start()'.
+/// If the source implements AsyncSource and an AsyncSourceRuntime is given, 'start()' instead registers the source with one of the I/O
+/// threads of the runtime. Both terminate the source via the same termination future.
 /// The runningRoutine orchestrates data ingestion until an end of stream (EOS) or a failure happens.
 /// The data source emits tasks into the TaskQueue when buffers are full, a timeout was hit, or a flush happens.
 /// The data source can call 'addEndOfStream()' from the QueryManager to stop a query via a reconfiguration message.
@@ -59,7 +71,12 @@ public:
     explicit SourceThread(
         OriginId originId, /// Todo #241: Rethink use of originId for sources, use new identifier for unique identification.
         std::shared_ptr<AbstractBufferProvider> bufferManager,
-        std::unique_ptr<Source> sourceImplementation);
+        std::unique_ptr<Source> sourceImplementation,
+        std::shared_ptr<AsyncSourceRuntime> asyncSourceRuntime = nullptr,
+        size_t formattedTupleSizeInBytes = 0);
+
+    /// Waits until the AsyncSourceRuntime no longer uses the source, if the source was registered with it.
+    ~SourceThread();
 
     SourceThread() = delete;
     SourceThread(const SourceThread& other) = delete;
@@ -90,10 +107,16 @@ protected:
     std::shared_ptr<AbstractBufferProvider> localBufferManager;
     std::unique_ptr<Source> sourceImplementation;
     std::atomic_bool started;
+    /// Zero, if the source emits raw buffers to an input formatter, c.f., SourceRuntimeConfiguration
+    size_t formattedTupleSizeInBytes;
 
     std::jthread thread;
     std::future<SourceImplementationTermination> terminationFuture;
 
+    std::shared_ptr<AsyncSourceRuntime> asyncSourceRuntime;
+    std::stop_source asyncStopSource;
+    bool isRegisteredWithAsyncSourceRuntime{false};
+
     /// Runs in detached thread and kills thread when finishing.
     /// while (running) { ... }: orchestrates data ingestion until end of stream or failure.
     void runningRoutine(const std::stop_token& stopToken, std::promise<SourceImplementationTermination>&);
@@ -0,0 +1,410 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <AsyncSourceIOThread.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <ranges>
+#include <stop_token>
+#include <utility>
+#include <vector>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <Identifiers/Identifiers.hpp>
+#include <Sources/SourceReturnType.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/ThreadNaming.hpp>
+#include <cpptrace/from_current.hpp>
+#include <fmt/format.h>
+#include <ErrorHandling.hpp>
+#include <SourceThread.hpp>
+
+namespace NES
+{
+
+namespace
+{
+constexpr int MAX_NUMBER_OF_EVENTS = 64;
+/// Bounds the time an I/O thread waits before it retries to acquire buffers for sources that found the buffer pool exhausted
+constexpr int BUFFER_RETRY_INTERVAL_MS = 1;
+constexpr int WAIT_INDEFINITELY = -1;
+}
+
+AsyncSourceIOThread::AsyncSourceIOThread(const size_t ioThreadIdx)
+    : epollFd(epoll_create1(EPOLL_CLOEXEC)), wakeUpFd(eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC))
+{
+    /// The eventfd is the only descriptor without an ActiveSource, which is why it carries a nullptr
+    epoll_event wakeUpEvent{.events = EPOLLIN, .data = {.ptr = nullptr}};
+    if (epollFd < 0 or wakeUpFd < 0 or epoll_ctl(epollFd, EPOLL_CTL_ADD, wakeUpFd, &wakeUpEvent) != 0)
+    {
+        const auto error = errno;
+        ::close(epollFd);
+        ::close(wakeUpFd);
+        throw CannotOpenSource("Could not create the epoll instance of the async source runtime: {}", std::strerror(error));
+    }
+    thread = std::jthread(
+        [this, ioThreadIdx](const std::stop_token& stopToken)
+        {
+            setThreadName(fmt::format("AsyncSrc-{}", ioThreadIdx));
+            run(stopToken);
+        });
+}
+
+AsyncSourceIOThread::~AsyncSourceIOThread()
+{
+    thread.request_stop();
+    wakeUp();
+    thread.join();
+    ::close(epollFd);
+    ::close(wakeUpFd);
+}
+
+void AsyncSourceIOThread::registerSource(Registration registration)
+{
+    ++numberOfSources;
+    {
+        const std::scoped_lock lock(pendingRegistrationsMutex);
+        pendingRegistrations.emplace_back(std::move(registration));
+    }
+    wakeUp();
+}
+
+size_t AsyncSourceIOThread::getNumberOfSources() const
+{
+    return numberOfSources.load();
+}
+
+void AsyncSourceIOThread::wakeUp() const
+{
+    constexpr uint64_t increment = 1;
+    [[maybe_unused]] const auto numberOfWrittenBytes = write(wakeUpFd, &increment, sizeof(increment));
+}
+
+void AsyncSourceIOThread::run(const std::stop_token& stopToken)
+{
+    std::array<epoll_event, MAX_NUMBER_OF_EVENTS> events{};
+    while (not stopToken.stop_requested())
+    {
+        activatePendingSources();
+        for (auto& activeSource : activeSources)
+        {
+            if (activeSource->registration.stopToken.stop_requested())
+            {
+                terminate(*activeSource, {SourceImplementationTermination::StopRequested});
+            }
+            else if (activeSource->isWaitingForBuffer and tryAcquireBuffer(*activeSource))
+            {
+                try
+                {
+                    watch(*activeSource, true);
+                }
+                catch (const std::exception& exception)
+                {
+                    fail(*activeSource, exception);
+                }
+            }
+        }
+        std::erase_if(activeSources, [](const auto& activeSource) { return activeSource->isTerminated; });
+
+        /// Sources without a descriptor are always readable, thus the I/O thread must not wait for events, if any of them has a buffer
+        const auto hasReadySource = std::ranges::any_of(
+            activeSources,
+            [](const auto& activeSource) { return not activeSource->fileDescriptor.has_value() and not activeSource->isWaitingForBuffer; });
+        const auto hasSourceWaitingForBuffer
+            = std::ranges::any_of(activeSources, [](const auto& activeSource) { return activeSource->isWaitingForBuffer; });
+        const auto timeout = hasReadySource ? 0 : (hasSourceWaitingForBuffer ? BUFFER_RETRY_INTERVAL_MS : WAIT_INDEFINITELY);
+
+        const auto numberOfEvents = epoll_wait(epollFd, events.data(), MAX_NUMBER_OF_EVENTS, timeout);
+        if (numberOfEvents < 0 and errno != EINTR)
+        {
+            NES_ERROR("AsyncSourceIOThread failed to wait for events: {}", std::strerror(errno));
+        }
+        for (const auto& event : events | std::views::take(std::max(numberOfEvents, 0)))
+        {
+            if (event.data.ptr == nullptr)
+            {
+                uint64_t numberOfWakeUps = 0;
+                [[maybe_unused]] const auto numberOfReadBytes = read(wakeUpFd, &numberOfWakeUps, sizeof(numberOfWakeUps));
+                continue;
+            }
+            ingest(*static_cast<ActiveSource*>(event.data.ptr));
+        }
+        for (auto& activeSource : activeSources)
+        {
+            if (not activeSource->fileDescriptor.has_value() and not activeSource->isTerminated)
+            {
+                ingest(*activeSource);
+            }
+        }
+        std::erase_if(activeSources, [](const auto& activeSource) { return activeSource->isTerminated; });
+    }
+
+    activatePendingSources();
+    for (auto& activeSource : activeSources)
+    {
+        terminate(*activeSource, {SourceImplementationTermination::StopRequested});
+    }
+    activeSources.clear();
+}
+
+void AsyncSourceIOThread::activatePendingSources()
+{
+    std::vector<Registration> registrations;
+    {
+        const std::scoped_lock lock(pendingRegistrationsMutex);
+        registrations.swap(pendingRegistrations);
+    }
+
+    for (auto& registration : registrations)
+    {
+        auto& activeSource = *activeSources.emplace_back(std::make_unique<ActiveSource>(std::move(registration)));
+        activeSource.wakeUpOnStop.emplace(activeSource.registration.stopToken, [this] { wakeUp(); });
+        try
+        {
+            activeSource.registration.source.open();
+            activeSource.isOpen = true;
+            activeSource.fileDescriptor = activeSource.registration.source.getFileDescriptor();
+            if (activeSource.fileDescriptor.has_value())
+            {
+                epoll_event event{.events = 0, .data = {.ptr = &activeSource}};
+                if (epoll_ctl(epollFd, EPOLL_CTL_ADD, *activeSource.fileDescriptor, &event) != 0)
+                {
+                    throw CannotOpenSource(
+                        "Could not watch the descriptor of source {}: {}", activeSource.registration.originId, std::strerror(errno));
+                }
+            }
+            if (tryAcquireBuffer(activeSource))
+            {
+                watch(activeSource, true);
+            }
+        }
+        catch (const std::exception& exception)
+        {
+            fail(activeSource, exception);
+        }
+    }
+}
+
+void AsyncSourceIOThread::ingest(ActiveSource& activeSource)
+{
+    if (activeSource.isTerminated or activeSource.isWaitingForBuffer)
+    {
+        return;
+    }
+    try
+    {
+        if (activeSource.registration.source.providesTupleBuffers())
+        {
+            auto providedBuffer = activeSource.registration.source.provideTupleBuffer(activeSource.registration.stopToken);
+            if (not providedBuffer.has_value())
+            {
+                terminate(activeSource, {SourceImplementationTermination::EndOfStream});
+                return;
+            }
+            activeSource.numberOfBytesInBuffer = providedBuffer->getBufferSize();
+            activeSource.buffer = std::move(providedBuffer);
+            emitBuffer(activeSource);
+            return;
+        }
+        /// Raw buffers may end anywhere, formatted buffers must contain at least one whole tuple
+        const auto minNumberOfBytesToEmit = std::max<size_t>(1, activeSource.registration.formattedTupleSizeInBytes);
+        while (true)
+        {
+            auto& buffer = activeSource.buffer.value();
+            const auto numberOfReadBytes = activeSource.registration.source.tryFillTupleBuffer(buffer, activeSource.numberOfBytesInBuffer);
+            if (not numberOfReadBytes.has_value())
+            {
+                if (activeSource.numberOfBytesInBuffer >= minNumberOfBytesToEmit)
+                {
+                    emitBuffer(activeSource);
+                }
+                if (not activeSource.partialTuple.empty() or activeSource.numberOfBytesInBuffer != 0)
+                {
+                    NES_WARNING("Source {} ended within a tuple, which it discards", activeSource.registration.originId);
+                }
+                terminate(activeSource, {SourceImplementationTermination::EndOfStream});
+                return;
+            }
+
+            activeSource.numberOfBytesInBuffer += *numberOfReadBytes;
+            if (*numberOfReadBytes == 0)
+            {
+                updateFileDescriptor(activeSource);
+            }
+            const auto isBufferFull = activeSource.numberOfBytesInBuffer == buffer.getBufferSize();
+            if (isBufferFull or (*numberOfReadBytes == 0 and activeSource.numberOfBytesInBuffer >= minNumberOfBytesToEmit))
+            {
+                /// Emitting at most one buffer per wakeup, level-triggered epoll reports the remaining bytes again
+                emitBuffer(activeSource);
+                if (tryAcquireBuffer(activeSource))
+                {
+                    return;
+                }
+                watch(activeSource, false);
+                return;
+            }
+            if (*numberOfReadBytes == 0)
+            {
+                return;
+            }
+        }
+    }
+    catch (const std::exception& exception)
+    {
+        fail(activeSource, exception);
+    }
+}
+
+bool AsyncSourceIOThread::tryAcquireBuffer(ActiveSource& activeSource)
+{
+    if (activeSource.registration.source.providesTupleBuffers())
+    {
+        /// The source hands out its own buffers, thus it never waits for a pooled one
+        activeSource.isWaitingForBuffer = false;
+        return true;
+    }
+    activeSource.buffer = activeSource.registration.bufferProvider->getBufferNoBlocking();
+    activeSource.isWaitingForBuffer = not activeSource.buffer.has_value();
+    if (activeSource.buffer.has_value() and not activeSource.partialTuple.empty())
+    {
+        std::ranges::copy(activeSource.partialTuple, activeSource.buffer->getAvailableMemoryArea().begin());
+        activeSource.numberOfBytesInBuffer = activeSource.partialTuple.size();
+        activeSource.partialTuple.clear();
+    }
+    return activeSource.buffer.has_value();
+}
+
+void AsyncSourceIOThread::emitBuffer(ActiveSource& activeSource)
+{
+    auto buffer = std::move(activeSource.buffer.value());
+    activeSource.buffer.reset();
+    if (const auto tupleSize = activeSource.registration.formattedTupleSizeInBytes; tupleSize != 0)
+    {
+        /// The next buffer continues with the partial tuple, which is at most a few bytes in contrast to copying the whole buffer
+        const auto numberOfBytesOfPartialTuple = activeSource.numberOfBytesInBuffer % tupleSize;
+        INVARIANT(
+            numberOfBytesOfPartialTuple == 0 or not activeSource.registration.source.providesTupleBuffers(),
+            "Source {} provided a buffer of {} bytes, which is not a multiple of the tuple size {} bytes",
+            activeSource.registration.originId,
+            activeSource.numberOfBytesInBuffer,
+            tupleSize);
+        const auto bufferMemory = buffer.getAvailableMemoryArea().first(activeSource.numberOfBytesInBuffer);
+        activeSource.partialTuple.assign(bufferMemory.end() - numberOfBytesOfPartialTuple, bufferMemory.end());
+        activeSource.numberOfBytesInBuffer -= numberOfBytesOfPartialTuple;
+    }
+    detail::setNumberOfTuplesOfFilledBuffer(
+        buffer, activeSource.numberOfBytesInBuffer, activeSource.registration.formattedTupleSizeInBytes);
+    activeSource.numberOfBytesInBuffer = 0;
+    detail::addBufferMetaData(activeSource.registration.originId, SequenceNumber(activeSource.nextSequenceNumber++), buffer);
+    /// Emitting blocks, if the source exceeds its inflight buffers, i.e., backpressure stalls all sources of this I/O thread
+    activeSource.registration.emit(
+        activeSource.registration.originId, SourceReturnType::Data{std::move(buffer)}, activeSource.registration.stopToken);
+}
+
+void AsyncSourceIOThread::watch(const ActiveSource& activeSource, const bool isWatched) const
+{
+    if (activeSource.fileDescriptor.has_value())
+    {
+        /// A source without interest in any event remains registered, but epoll does not report it
+        epoll_event event{
+            .events = isWatched ? static_cast<uint32_t>(EPOLLIN) : 0, .data = {.ptr = const_cast<ActiveSource*>(&activeSource)}};
+        if (epoll_ctl(epollFd, EPOLL_CTL_MOD, *activeSource.fileDescriptor, &event) != 0)
+        {
+            throw CannotOpenSource(
+                "Could not watch the descriptor of source {}: {}", activeSource.registration.originId, std::strerror(errno));
+        }
+    }
+}
+
+void AsyncSourceIOThread::updateFileDescriptor(ActiveSource& activeSource) const
+{
+    const auto fileDescriptor = activeSource.registration.source.getFileDescriptor();
+    if (fileDescriptor == activeSource.fileDescriptor)
+    {
+        return;
+    }
+    if (activeSource.fileDescriptor.has_value())
+    {
+        /// Fails, if the source already closed the previous descriptor, which removed it from the epoll instance
+        epoll_ctl(epollFd, EPOLL_CTL_DEL, *activeSource.fileDescriptor, nullptr);
+    }
+    activeSource.fileDescriptor = fileDescriptor;
+    if (fileDescriptor.has_value())
+    {
+        epoll_event event{.events = EPOLLIN, .data = {.ptr = &activeSource}};
+        if (epoll_ctl(epollFd, EPOLL_CTL_ADD, *fileDescriptor, &event) != 0)
+        {
+            throw CannotOpenSource(
+                "Could not watch the new descriptor of source {}: {}", activeSource.registration.originId, std::strerror(errno));
+        }
+    }
+}
+
+void AsyncSourceIOThread::terminate(ActiveSource& activeSource, const SourceImplementationTermination termination)
+{
+    closeSource(activeSource);
+    if (termination.result == SourceImplementationTermination::EndOfStream and not activeSource.registration.stopToken.stop_requested())
+    {
+        activeSource.registration.emit(activeSource.registration.originId, SourceReturnType::EoS{}, activeSource.registration.stopToken);
+    }
+    /// The SourceThread may release the source after the termination was set, thus this must be the last access to the registration
+    activeSource.registration.termination.set_value(termination);
+}
+
+void AsyncSourceIOThread::fail(ActiveSource& activeSource, const std::exception& exception)
+{
+    closeSource(activeSource);
+    auto ingestionException = RunningRoutineFailure(exception.what());
+    activeSource.registration.emit(
+        activeSource.registration.originId, SourceReturnType::Error{ingestionException}, activeSource.registration.stopToken);
+    activeSource.registration.termination.set_exception(std::make_exception_ptr(std::move(ingestionException)));
+}
+
+void AsyncSourceIOThread::closeSource(ActiveSource& activeSource)
+{
+    activeSource.isTerminated = true;
+    activeSource.wakeUpOnStop.reset();
+    activeSource.buffer.reset();
+    --numberOfSources;
+    if (not activeSource.isOpen)
+    {
+        return;
+    }
+    if (activeSource.fileDescriptor.has_value())
+    {
+        epoll_ctl(epollFd, EPOLL_CTL_DEL, *activeSource.fileDescriptor, nullptr);
+    }
+    /// Throwing would skip setting the termination of the source, c.f., the SourceHandle of the SourceThread
+    CPPTRACE_TRY
+    {
+        activeSource.registration.source.close();
+    }
+    CPPTRACE_CATCH(...)
+    {
+        tryLogCurrentException();
+    }
+    activeSource.isOpen = false;
+}
+
+}
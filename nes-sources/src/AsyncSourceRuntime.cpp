@@ -0,0 +1,47 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Sources/AsyncSourceRuntime.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <AsyncSourceIOThread.hpp>
+#include <ErrorHandling.hpp>
+
+namespace NES
+{
+
+AsyncSourceRuntime::AsyncSourceRuntime(const size_t numberOfIOThreads)
+{
+    PRECONDITION(numberOfIOThreads > 0, "The async source runtime requires at least one I/O thread");
+    for (size_t ioThreadIdx = 0; ioThreadIdx < numberOfIOThreads; ++ioThreadIdx)
+    {
+        ioThreads.emplace_back(std::make_unique<AsyncSourceIOThread>(ioThreadIdx));
+    }
+}
+
+AsyncSourceRuntime::~AsyncSourceRuntime() = default;
+
+size_t AsyncSourceRuntime::getNumberOfIOThreads() const
+{
+    return ioThreads.size();
+}
+
+AsyncSourceIOThread& AsyncSourceRuntime::selectIOThread()
+{
+    return **std::ranges::min_element(ioThreads, {}, [](const auto& ioThread) { return ioThread->getNumberOfSources(); });
+}
+
+}
@@ -14,7 +14,11 @@
 
 #include <FileSource.hpp>
 
+#include <algorithm>
+#include <array>
 #include <cerrno>
+#include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <cstring>
 #include <format>
@@ -22,11 +26,17 @@
 #include <ios>
 #include <istream>
 #include <memory>
+#include <optional>
 #include <ostream>
 #include <stop_token>
 #include <string>
+#include <tuple>
 #include <unordered_map>
 #include <utility>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include <Configurations/Descriptor.hpp>
 #include <Runtime/TupleBuffer.hpp>
 #include <Sources/SourceDescriptor.hpp>
@@ -39,31 +49,242 @@
 namespace NES
 {
 
-FileSource::FileSource(const SourceDescriptor& sourceDescriptor) : filePath(sourceDescriptor.getFromConfig(ConfigParametersCSV::FILEPATH))
+namespace
 {
+size_t getPageSize()
+{
+    static const auto pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return pageSize;
+}
+
+char getTupleDelimiter(const ParserConfig& parserConfig)
+{
+    return parserConfig.tupleDelimiter.empty() ? '\n' : parserConfig.tupleDelimiter.front();
+}
+
+size_t getNativeTupleSizeInBytes(const SourceDescriptor& sourceDescriptor)
+{
+    if (sourceDescriptor.getParserConfig().parserType != "Native")
+    {
+        return 0;
+    }
+    return sourceDescriptor.getLogicalSource().getSchema()->getSizeOfSchemaInBytes();
+}
+}
+
+struct FileSource::MappedFile
+{
+    MappedFile(std::byte* data, const size_t sizeInBytes) : data(data), sizeInBytes(sizeInBytes) { }
+    ~MappedFile() { munmap(data, sizeInBytes); }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&&) = delete;
+    MappedFile& operator=(MappedFile&&) = delete;
+
+    std::byte* data;
+    size_t sizeInBytes;
+};
+
+FileSource::FileSource(const SourceDescriptor& sourceDescriptor)
+    : filePath(sourceDescriptor.getFromConfig(ConfigParametersCSV::FILEPATH))
+    , isMemoryMapped(sourceDescriptor.getFromConfig(ConfigParametersCSV::MEMORY_MAPPED))
+    , memoryMappedRegionSize(sourceDescriptor.getFromConfig(ConfigParametersCSV::MEMORY_MAPPED_REGION_SIZE))
+    , partitionIndex(sourceDescriptor.getPartition().first)
+    , numberOfPartitions(sourceDescriptor.getPartition().second)
+    , tupleDelimiter(getTupleDelimiter(sourceDescriptor.getParserConfig()))
+    , nativeTupleSizeInBytes(getNativeTupleSizeInBytes(sourceDescriptor))
+{
+}
+
+size_t FileSource::findTupleStart(const size_t offset, const size_t fileSize)
+{
+    if (offset == 0)
+    {
+        return 0;
+    }
+    if (mappedFile != nullptr)
+    {
+        const auto* const end = mappedFile->data + fileSize;
+        const auto* const delimiter = std::find(mappedFile->data + offset - 1, end, static_cast<std::byte>(tupleDelimiter));
+        return delimiter == end ? fileSize : static_cast<size_t>(delimiter - mappedFile->data) + 1;
+    }
+    std::array<char, 4096> chunk{};
+    for (auto position = offset - 1; position < fileSize;)
+    {
+        this->inputFile.clear();
+        this->inputFile.seekg(static_cast<std::streamoff>(position));
+        this->inputFile.read(chunk.data(), static_cast<std::streamsize>(std::min(chunk.size(), fileSize - position)));
+        const auto numBytesRead = static_cast<size_t>(this->inputFile.gcount());
+        if (numBytesRead == 0)
+        {
+            break;
+        }
+        const auto* const delimiter = std::find(chunk.data(), chunk.data() + numBytesRead, tupleDelimiter);
+        if (delimiter != chunk.data() + numBytesRead)
+        {
+            return position + static_cast<size_t>(delimiter - chunk.data()) + 1;
+        }
+        position += numBytesRead;
+    }
+    return fileSize;
+}
+
+std::pair<size_t, size_t> FileSource::computePartitionRange(const size_t fileSize)
+{
+    /// Neighboring partitions compute their shared boundary alike, thus the ranges of all partitions cover the file without overlapping
+    const auto boundaryOf = [&](const size_t partition) -> size_t
+    {
+        if (partition == 0 or partition == numberOfPartitions)
+        {
+            return partition == 0 ? 0 : fileSize;
+        }
+        if (nativeTupleSizeInBytes > 0)
+        {
+            return (fileSize / nativeTupleSizeInBytes) * partition / numberOfPartitions * nativeTupleSizeInBytes;
+        }
+        return findTupleStart(fileSize * partition / numberOfPartitions, fileSize);
+    };
+    return {boundaryOf(partitionIndex), boundaryOf(partitionIndex + 1)};
 }
 
 void FileSource::open()
 {
     const auto realCSVPath = std::unique_ptr<char, decltype(std::free)*>{realpath(this->filePath.c_str(), nullptr), std::free};
+    if (isMemoryMapped)
+    {
+        openMapping(realCSVPath.get());
+        return;
+    }
     this->inputFile = std::ifstream(realCSVPath.get(), std::ios::binary);
     if (not this->inputFile)
     {
         throw InvalidConfigParameter("Could not determine absolute pathname: {} - {}", this->filePath.c_str(), std::strerror(errno));
     }
+    if (numberOfPartitions > 1)
+    {
+        this->inputFile.seekg(0, std::ios::end);
+        const auto [begin, end] = computePartitionRange(static_cast<size_t>(this->inputFile.tellg()));
+        this->inputFile.clear();
+        this->inputFile.seekg(static_cast<std::streamoff>(begin));
+        remainingBytes = end - begin;
+        NES_DEBUG(
+            "FileSource: Partition {} of {} reads the bytes [{}, {}) of {}.", partitionIndex, numberOfPartitions, begin, end, filePath);
+    }
+}
+
+void FileSource::openMapping(const char* realPath)
+{
+    const auto fileDescriptor = realPath == nullptr ? -1 : ::open(realPath, O_RDONLY | O_CLOEXEC);
+    if (fileDescriptor < 0)
+    {
+        throw InvalidConfigParameter("Could not determine absolute pathname: {} - {}", this->filePath.c_str(), std::strerror(errno));
+    }
+    struct stat fileStatus{};
+    if (fstat(fileDescriptor, &fileStatus) != 0)
+    {
+        const auto error = errno;
+        ::close(fileDescriptor);
+        throw CannotOpenSource("Could not determine the size of {}: {}", this->filePath, std::strerror(error));
+    }
+
+    nextRegionOffset = 0;
+    regionsEnd = 0;
+    const auto fileSize = static_cast<size_t>(fileStatus.st_size);
+    if (fileSize == 0)
+    {
+        /// mmap rejects empty mappings, an empty file ends the stream immediately
+        ::close(fileDescriptor);
+        return;
+    }
+    /// The mapping is private and writable, so that a TupleBuffer that is written to copies the page instead of faulting.
+    /// The mapping outlives the descriptor.
+    auto* data = mmap(nullptr, fileSize, PROT_READ | PROT_WRITE, MAP_PRIVATE, fileDescriptor, 0);
+    const auto error = errno;
+    ::close(fileDescriptor);
+    if (data == MAP_FAILED)
+    {
+        throw CannotOpenSource("Could not map {} into memory: {}", this->filePath, std::strerror(error));
+    }
+    /// Lets the kernel read ahead aggressively and drop pages behind the read position
+    madvise(data, fileSize, MADV_SEQUENTIAL);
+    mappedFile = std::make_shared<MappedFile>(static_cast<std::byte*>(data), fileSize);
+    std::tie(nextRegionOffset, regionsEnd) = computePartitionRange(fileSize);
 }
 
 void FileSource::close()
 {
     this->inputFile.close();
+    /// TupleBuffers that still wrap regions of the mapping keep it alive
+    mappedFile.reset();
+}
+
+bool FileSource::providesTupleBuffers() const
+{
+    return isMemoryMapped;
+}
+
+std::optional<TupleBuffer> FileSource::provideTupleBuffer(const std::stop_token&)
+{
+    PRECONDITION(isMemoryMapped, "Only a memory mapped FileSource provides TupleBuffers");
+    if (mappedFile == nullptr or nextRegionOffset == regionsEnd)
+    {
+        return std::nullopt;
+    }
+
+    /// Regions end at multiples of the region size, thus the first region of a partition, which may start anywhere, is shorter
+    const auto regionOffset = std::exchange(
+        nextRegionOffset, std::min(nextRegionOffset - (nextRegionOffset % memoryMappedRegionSize) + memoryMappedRegionSize, regionsEnd));
+    const auto regionSize = nextRegionOffset - regionOffset;
+    auto* const region = mappedFile->data + regionOffset;
+    if (nextRegionOffset != regionsEnd)
+    {
+        /// Reading the next region ahead, while the pipelines process this one
+        madvise(mappedFile->data + nextRegionOffset, std::min(memoryMappedRegionSize, regionsEnd - nextRegionOffset), MADV_WILLNEED);
+    }
+    this->totalNumBytesRead += regionSize;
+
+    const auto offsetInPage = regionOffset % getPageSize();
+    return TupleBuffer::wrapMemory(
+        reinterpret_cast<uint8_t*>(region), /// NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        static_cast<uint32_t>(regionSize),
+        [mappedFile = this->mappedFile, region, regionSize, offsetInPage]
+        {
+            /// Only the first region may start and only the last one may end within a page, whose remainder the source never hands out,
+            /// as it lies outside the partition
+            madvise(region - offsetInPage, regionSize + offsetInPage, MADV_DONTNEED);
+        });
 }
 
 size_t FileSource::fillTupleBuffer(TupleBuffer& tupleBuffer, const std::stop_token&)
 {
+    PRECONDITION(not isMemoryMapped, "A memory mapped FileSource provides its own TupleBuffers");
     this->inputFile.read(
-        tupleBuffer.getAvailableMemoryArea<std::istream::char_type>().data(), static_cast<std::streamsize>(tupleBuffer.getBufferSize()));
-    const auto numBytesRead = this->inputFile.gcount();
+        tupleBuffer.getAvailableMemoryArea<std::istream::char_type>().data(),
+        static_cast<std::streamsize>(std::min<size_t>(tupleBuffer.getBufferSize(), remainingBytes)));
+    const auto numBytesRead = static_cast<size_t>(this->inputFile.gcount());
     this->totalNumBytesRead += numBytesRead;
+    remainingBytes -= numBytesRead;
+    return numBytesRead;
+}
+
+std::optional<int> FileSource::getFileDescriptor() const
+{
+    return std::nullopt;
+}
+
+std::optional<size_t> FileSource::tryFillTupleBuffer(TupleBuffer& tupleBuffer, const size_t offset)
+{
+    PRECONDITION(not isMemoryMapped, "A memory mapped FileSource provides its own TupleBuffers");
+    const auto availableMemory = tupleBuffer.getAvailableMemoryArea<std::istream::char_type>().subspan(offset);
+    this->inputFile.read(availableMemory.data(), static_cast<std::streamsize>(std::min(availableMemory.size(), remainingBytes)));
+    const auto numBytesRead = static_cast<size_t>(this->inputFile.gcount());
+    this->totalNumBytesRead += numBytesRead;
+    remainingBytes -= numBytesRead;
+    if (numBytesRead == 0)
+    {
+        return std::nullopt;
+    }
     return numBytesRead;
 }
 
@@ -74,7 +295,13 @@ DescriptorConfig::Config FileSource::validateAndFormat(std::unordered_map<std::s
 
 std::ostream& FileSource::toString(std::ostream& str) const
 {
-    str << std::format("\nFileSource(filepath: {}, totalNumBytesRead: {})", this->filePath, this->totalNumBytesRead.load());
+    str << std::format(
+        "\nFileSource(filepath: {}, memoryMapped: {}, partition: {} of {}, totalNumBytesRead: {})",
+        this->filePath,
+        this->isMemoryMapped,
+        this->partitionIndex,
+        this->numberOfPartitions,
+        this->totalNumBytesRead.load());
     return str;
 }
 
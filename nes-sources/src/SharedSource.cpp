@@ -0,0 +1,207 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <SharedSource.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <stop_token>
+#include <utility>
+#include <Runtime/AbstractBufferProvider.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Sources/Source.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <ErrorHandling.hpp>
+
+namespace NES
+{
+
+SharedSourceReader::SharedSourceReader(std::unique_ptr<Source> source, std::shared_ptr<AbstractBufferProvider> bufferProvider)
+    : source(std::move(source)), bufferProvider(std::move(bufferProvider))
+{
+}
+
+std::shared_ptr<SharedSourceReader::Subscription> SharedSourceReader::subscribe()
+{
+    const std::scoped_lock lock(mutex);
+    if (subscriptions.empty())
+    {
+        source->open();
+        isEndOfStream = false;
+        failure = nullptr;
+    }
+    return subscriptions.emplace_back(std::make_shared<Subscription>());
+}
+
+void SharedSourceReader::unsubscribe(const std::shared_ptr<Subscription>& subscription)
+{
+    const std::scoped_lock lock(mutex);
+    subscriptions.remove(subscription);
+    /// The remaining subscribers may wait until the removed subscription consumed its buffers
+    stateChanged.notify_all();
+    if (subscriptions.empty())
+    {
+        source->close();
+    }
+}
+
+bool SharedSourceReader::hasFullSubscription() const
+{
+    return std::ranges::any_of(
+        subscriptions, [](const auto& subscription) { return subscription->pendingBuffers.size() >= MAX_PENDING_BUFFERS; });
+}
+
+std::optional<TupleBuffer> SharedSourceReader::readFromSource(const std::stop_token& stopToken)
+{
+    if (source->providesTupleBuffers())
+    {
+        return source->provideTupleBuffer(stopToken);
+    }
+    auto buffer = bufferProvider->getBufferBlocking();
+    const auto numberOfBytes = source->fillTupleBuffer(buffer, stopToken);
+    if (numberOfBytes == 0)
+    {
+        return std::nullopt;
+    }
+    /// The subscribers receive views of the valid bytes, which the SourceThread emits as a whole
+    auto* const data = buffer.getAvailableMemoryArea<uint8_t>().data();
+    return TupleBuffer::wrapMemory(data, static_cast<uint32_t>(numberOfBytes), [buffer = std::move(buffer)] { });
+}
+
+std::optional<TupleBuffer> SharedSourceReader::getNextBuffer(Subscription& subscription, const std::stop_token& stopToken)
+{
+    std::unique_lock lock(mutex);
+    while (not stopToken.stop_requested())
+    {
+        if (not subscription.pendingBuffers.empty())
+        {
+            auto buffer = std::move(subscription.pendingBuffers.front());
+            subscription.pendingBuffers.pop_front();
+            stateChanged.notify_all();
+            return buffer;
+        }
+        if (failure)
+        {
+            std::rethrow_exception(failure);
+        }
+        if (isEndOfStream)
+        {
+            return std::nullopt;
+        }
+        if (isReading or hasFullSubscription())
+        {
+            /// Waits until another subscriber read the next buffer or the slowest subscriber consumed one of its buffers
+            stateChanged.wait(
+                lock,
+                stopToken,
+                [&]
+                {
+                    return not subscription.pendingBuffers.empty() or isEndOfStream or failure != nullptr
+                        or (not isReading and not hasFullSubscription());
+                });
+            continue;
+        }
+
+        /// This subscriber ran out of buffers first, thus it reads the next buffer for all subscribers, without blocking them meanwhile
+        isReading = true;
+        lock.unlock();
+        std::optional<TupleBuffer> buffer;
+        std::exception_ptr readFailure;
+        try
+        {
+            buffer = readFromSource(stopToken);
+        }
+        catch (...)
+        {
+            readFailure = std::current_exception();
+        }
+        lock.lock();
+        isReading = false;
+
+        if (readFailure)
+        {
+            failure = readFailure;
+        }
+        else if (buffer.has_value())
+        {
+            /// Each subscriber gets its own TupleBuffer, because the SourceThread of each query sets the metadata, e.g., the sequence number
+            for (const auto& other : subscriptions)
+            {
+                other->pendingBuffers.emplace_back(TupleBuffer::wrapMemory(
+                    buffer->getAvailableMemoryArea<uint8_t>().data(), buffer->getBufferSize(), [sharedBuffer = *buffer] { }));
+            }
+        }
+        else if (not stopToken.stop_requested())
+        {
+            /// Sources may return early due to the stop of this query, which does not end the stream of the other subscribers
+            isEndOfStream = true;
+        }
+        stateChanged.notify_all();
+    }
+    return std::nullopt;
+}
+
+size_t SharedSourceReader::getNumberOfSubscriptions() const
+{
+    const std::scoped_lock lock(mutex);
+    return subscriptions.size();
+}
+
+std::ostream& operator<<(std::ostream& out, const SharedSourceReader& reader)
+{
+    return out << "SharedSourceReader(source: " << *reader.source << ", subscriptions: " << reader.getNumberOfSubscriptions() << ")";
+}
+
+SharedSource::SharedSource(std::shared_ptr<SharedSourceReader> reader) : reader(std::move(reader))
+{
+}
+
+size_t SharedSource::fillTupleBuffer(TupleBuffer&, const std::stop_token&)
+{
+    throw NotImplemented("A SharedSource provides its own TupleBuffers");
+}
+
+std::optional<TupleBuffer> SharedSource::provideTupleBuffer(const std::stop_token& stopToken)
+{
+    PRECONDITION(subscription != nullptr, "A SharedSource must be opened before it provides TupleBuffers");
+    return reader->getNextBuffer(*subscription, stopToken);
+}
+
+void SharedSource::open()
+{
+    subscription = reader->subscribe();
+    NES_DEBUG("Subscribed to {}", *reader);
+}
+
+void SharedSource::close()
+{
+    if (subscription != nullptr)
+    {
+        reader->unsubscribe(subscription);
+        subscription.reset();
+    }
+}
+
+std::ostream& SharedSource::toString(std::ostream& str) const
+{
+    return str << "SharedSource(" << *reader << ")";
+}
+
+}
@@ -16,7 +16,6 @@
 
 #include <cstdint>
 #include <memory>
-#include <mutex>
 #include <optional>
 #include <ranges>
 #include <string>
@@ -52,12 +51,12 @@ std::optional<LogicalSource> SourceCatalog::addLogicalSource(const std::string&
                 field.name);
         }
     }
-    const std::unique_lock lock(catalogMutex);
-    if (!containsLogicalSource(logicalSourceName))
+    const auto lockedMappings = mappings.wlock();
+    if (!lockedMappings->namesToLogicalSourceMapping.contains(logicalSourceName))
     {
         LogicalSource logicalSource{logicalSourceName, newSchema};
-        namesToLogicalSourceMapping.emplace(logicalSourceName, logicalSource);
-        logicalToPhysicalSourceMapping.emplace(logicalSource, std::unordered_set<SourceDescriptor>{});
+        lockedMappings->namesToLogicalSourceMapping.emplace(logicalSourceName, logicalSource);
+        lockedMappings->logicalToPhysicalSourceMapping.emplace(logicalSource, std::unordered_set<SourceDescriptor>{});
         NES_DEBUG("Added logical source {}", logicalSourceName);
         return logicalSource;
     }
@@ -71,15 +70,14 @@ std::optional<SourceDescriptor> SourceCatalog::addPhysicalSource(
     std::unordered_map<std::string, std::string> descriptorConfig,
     const std::unordered_map<std::string, std::string>& parserConfig)
 {
-    const std::unique_lock lock(catalogMutex);
-
-    const auto logicalPhysicalIter = logicalToPhysicalSourceMapping.find(logicalSource);
-    if (logicalPhysicalIter == logicalToPhysicalSourceMapping.end())
+    if (not mappings.rlock()->logicalToPhysicalSourceMapping.contains(logicalSource))
     {
         NES_DEBUG("Trying to create physical source for logical source \"{}\" which does not exist", logicalSource.getLogicalSourceName());
         return std::nullopt;
     }
-    auto id = PhysicalSourceId{nextPhysicalSourceId.fetch_add(1)};
+
+    /// Validating the configuration takes longer than inserting the descriptor. Thus, we validate without holding the lock and check
+    /// again afterward, whether the logical source has been removed in the meantime.
     auto descriptorConfigOpt = SourceValidationProvider::provide(sourceType, std::move(descriptorConfig));
     if (not descriptorConfigOpt.has_value())
     {
@@ -92,8 +90,16 @@ std::optional<SourceDescriptor> SourceCatalog::addPhysicalSource(
         throw InvalidConfigParameter("Invalid parser type {}", parserConfigObject.parserType);
     }
 
+    const auto lockedMappings = mappings.wlock();
+    const auto logicalPhysicalIter = lockedMappings->logicalToPhysicalSourceMapping.find(logicalSource);
+    if (logicalPhysicalIter == lockedMappings->logicalToPhysicalSourceMapping.end())
+    {
+        NES_DEBUG("Logical source \"{}\" was removed while validating its physical source", logicalSource.getLogicalSourceName());
+        return std::nullopt;
+    }
+    auto id = PhysicalSourceId{nextPhysicalSourceId.fetch_add(1)};
     SourceDescriptor descriptor{id, logicalSource, sourceType, std::move(descriptorConfigOpt.value()), parserConfigObject};
-    idsToPhysicalSources.emplace(id, descriptor);
+    lockedMappings->idsToPhysicalSources.emplace(id, descriptor);
     logicalPhysicalIter->second.insert(descriptor);
     NES_DEBUG("Successfully registered new physical source of type {} with id {}", descriptor.getSourceType(), id);
     return descriptor;
@@ -101,8 +107,9 @@ std::optional<SourceDescriptor> SourceCatalog::addPhysicalSource(
 
 std::optional<LogicalSource> SourceCatalog::getLogicalSource(const std::string& logicalSourceName) const
 {
-    const std::unique_lock lock(catalogMutex);
-    if (const auto found = namesToLogicalSourceMapping.find(logicalSourceName); found != namesToLogicalSourceMapping.end())
+    const auto lockedMappings = mappings.rlock();
+    if (const auto found = lockedMappings->namesToLogicalSourceMapping.find(logicalSourceName);
+        found != lockedMappings->namesToLogicalSourceMapping.end())
     {
         return found->second;
     }
@@ -111,9 +118,9 @@ std::optional<LogicalSource> SourceCatalog::getLogicalSource(const std::string&
 
 bool SourceCatalog::containsLogicalSource(const LogicalSource& logicalSource) const
 {
-    const std::unique_lock lock(catalogMutex);
-    if (const auto found = namesToLogicalSourceMapping.find(logicalSource.getLogicalSourceName());
-        found != namesToLogicalSourceMapping.end())
+    const auto lockedMappings = mappings.rlock();
+    if (const auto found = lockedMappings->namesToLogicalSourceMapping.find(logicalSource.getLogicalSourceName());
+        found != lockedMappings->namesToLogicalSourceMapping.end())
     {
         const auto equals = found->second == logicalSource;
         {
@@ -126,14 +133,14 @@ bool SourceCatalog::containsLogicalSource(const LogicalSource& logicalSource) co
 
 bool SourceCatalog::containsLogicalSource(const std::string& logicalSourceName) const
 {
-    const std::unique_lock lock{catalogMutex};
-    return namesToLogicalSourceMapping.contains(logicalSourceName);
+    return mappings.rlock()->namesToLogicalSourceMapping.contains(logicalSourceName);
 }
 
 std::optional<SourceDescriptor> SourceCatalog::getPhysicalSource(const PhysicalSourceId physicalSourceID) const
 {
-    const std::unique_lock lock{catalogMutex};
-    if (const auto physicalSourceIter = idsToPhysicalSources.find(physicalSourceID); physicalSourceIter != idsToPhysicalSources.end())
+    const auto lockedMappings = mappings.rlock();
+    if (const auto physicalSourceIter = lockedMappings->idsToPhysicalSources.find(physicalSourceID);
+        physicalSourceIter != lockedMappings->idsToPhysicalSources.end())
     {
         return physicalSourceIter->second;
     }
@@ -164,8 +171,9 @@ std::optional<SourceDescriptor> SourceCatalog::getInlineSource(
 
 std::optional<std::unordered_set<SourceDescriptor>> SourceCatalog::getPhysicalSources(const LogicalSource& logicalSource) const
 {
-    const std::unique_lock lock(catalogMutex);
-    if (const auto found = logicalToPhysicalSourceMapping.find(logicalSource); found != logicalToPhysicalSourceMapping.end())
+    const auto lockedMappings = mappings.rlock();
+    if (const auto found = lockedMappings->logicalToPhysicalSourceMapping.find(logicalSource);
+        found != lockedMappings->logicalToPhysicalSourceMapping.end())
     {
         return found->second;
     }
@@ -174,7 +182,8 @@ std::optional<std::unordered_set<SourceDescriptor>> SourceCatalog::getPhysicalSo
 
 bool SourceCatalog::removeLogicalSource(const LogicalSource& logicalSource)
 {
-    const std::unique_lock lock(catalogMutex);
+    const auto lockedMappings = mappings.wlock();
+    auto& [namesToLogicalSourceMapping, idsToPhysicalSources, logicalToPhysicalSourceMapping] = *lockedMappings;
     if (const auto removedByName = namesToLogicalSourceMapping.erase(logicalSource.getLogicalSourceName()); removedByName == 0)
     {
         NES_TRACE("Trying to remove logical source \"{}\", but it was not registered by name", logicalSource.getLogicalSourceName());
@@ -205,7 +214,9 @@ bool SourceCatalog::removeLogicalSource(const LogicalSource& logicalSource)
 
 bool SourceCatalog::removePhysicalSource(const SourceDescriptor& physicalSource)
 {
-    const std::unique_lock lock{catalogMutex};
+    const auto lockedMappings = mappings.wlock();
+    auto& idsToPhysicalSources = lockedMappings->idsToPhysicalSources;
+    auto& logicalToPhysicalSourceMapping = lockedMappings->logicalToPhysicalSourceMapping;
     const auto physicalSourcePair = idsToPhysicalSources.find(physicalSource.getPhysicalSourceId());
     /// Verify that physical source is still registered, otherwise the invariants later don't make sense
     if (physicalSourcePair == idsToPhysicalSources.end())
@@ -235,15 +246,14 @@ bool SourceCatalog::removePhysicalSource(const SourceDescriptor& physicalSource)
 
 std::unordered_set<LogicalSource> SourceCatalog::getAllLogicalSources() const
 {
-    const std::unique_lock lock{catalogMutex};
-    return namesToLogicalSourceMapping | std::ranges::views::transform([](auto& pair) { return pair.second; })
+    const auto lockedMappings = mappings.rlock();
+    return lockedMappings->namesToLogicalSourceMapping | std::ranges::views::transform([](auto& pair) { return pair.second; })
         | std::ranges::to<std::unordered_set<LogicalSource>>();
 }
 
 std::unordered_map<LogicalSource, std::unordered_set<SourceDescriptor>> SourceCatalog::getLogicalToPhysicalSourceMapping() const
 {
-    const std::unique_lock lock{catalogMutex};
-    return logicalToPhysicalSourceMapping;
+    return mappings.rlock()->logicalToPhysicalSourceMapping;
 }
 
 }
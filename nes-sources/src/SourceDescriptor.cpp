@@ -14,12 +14,14 @@
 
 #include <Sources/SourceDescriptor.hpp>
 
+#include <cstddef>
 #include <ostream>
 #include <sstream>
 #include <string>
 #include <string_view>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 #include <Configurations/Descriptor.hpp>
 #include <Identifiers/Identifiers.hpp>
 #include <Serialization/SchemaSerializationUtil.hpp>
@@ -66,13 +68,40 @@ ParserConfig ParserConfig::create(std::unordered_map<std::string, std::string> c
         NES_DEBUG("Parser configuration did not contain: field_delimiter, using default: ,");
         created.fieldDelimiter = ",";
     }
+    if (const auto maxBytesPerFormattingTask = configMap.find("max_bytes_per_formatting_task");
+        maxBytesPerFormattingTask != configMap.end())
+    {
+        const auto parsedMaxBytesPerFormattingTask = Util::from_chars<size_t>(maxBytesPerFormattingTask->second);
+        if (not parsedMaxBytesPerFormattingTask.has_value())
+        {
+            throw InvalidConfigParameter(
+                "Parser configuration max_bytes_per_formatting_task must be a number of bytes, but got: {}",
+                maxBytesPerFormattingTask->second);
+        }
+        created.maxBytesPerFormattingTask = parsedMaxBytesPerFormattingTask.value();
+    }
+    if (const auto dictionaryEncoding = configMap.find("dictionary_encoding"); dictionaryEncoding != configMap.end())
+    {
+        const auto parsedDictionaryEncoding = Util::from_chars<bool>(dictionaryEncoding->second);
+        if (not parsedDictionaryEncoding.has_value())
+        {
+            throw InvalidConfigParameter(
+                "Parser configuration dictionary_encoding must be either true or false, but got: {}", dictionaryEncoding->second);
+        }
+        created.dictionaryEncoding = parsedDictionaryEncoding.value();
+    }
     return created;
 }
 
 std::ostream& operator<<(std::ostream& os, const ParserConfig& obj)
 {
     return os << fmt::format(
-               "ParserConfig(type: {}, tupleDelimiter: {}, fieldDelimiter: {})", obj.parserType, obj.tupleDelimiter, obj.fieldDelimiter);
+               "ParserConfig(type: {}, tupleDelimiter: {}, fieldDelimiter: {}, maxBytesPerFormattingTask: {}, dictionaryEncoding: {})",
+               obj.parserType,
+               obj.tupleDelimiter,
+               obj.fieldDelimiter,
+               obj.maxBytesPerFormattingTask,
+               obj.dictionaryEncoding);
 }
 
 SourceDescriptor::SourceDescriptor(
@@ -109,9 +138,39 @@ PhysicalSourceId SourceDescriptor::getPhysicalSourceId() const
     return physicalSourceId;
 }
 
+std::vector<SourceDescriptor> SourceDescriptor::partition() const
+{
+    const auto numberOfPartitions = tryGetFromConfig(NUMBER_OF_PARTITIONS).value_or(1);
+    if (numberOfPartitions <= 1)
+    {
+        return {*this};
+    }
+    std::vector<SourceDescriptor> partitions;
+    partitions.reserve(numberOfPartitions);
+    for (size_t partitionIndex = 0; partitionIndex < numberOfPartitions; ++partitionIndex)
+    {
+        auto config = getConfig();
+        config.insert_or_assign(PARTITION_INDEX, partitionIndex);
+        partitions.push_back(SourceDescriptor{physicalSourceId, logicalSource, sourceType, std::move(config), parserConfig});
+    }
+    return partitions;
+}
+
+std::pair<size_t, size_t> SourceDescriptor::getPartition() const
+{
+    const auto numberOfPartitions = tryGetFromConfig(NUMBER_OF_PARTITIONS).value_or(1);
+    const auto partitionIndex = tryGetFromConfig(PARTITION_INDEX).value_or(0);
+    INVARIANT(partitionIndex < numberOfPartitions, "Partition {} of a source with {} partitions", partitionIndex, numberOfPartitions);
+    return {partitionIndex, numberOfPartitions};
+}
+
 std::weak_ordering operator<=>(const SourceDescriptor& lhs, const SourceDescriptor& rhs)
 {
-    return lhs.physicalSourceId <=> rhs.physicalSourceId;
+    if (const auto order = lhs.physicalSourceId <=> rhs.physicalSourceId; order != 0)
+    {
+        return order;
+    }
+    return lhs.getPartition().first <=> rhs.getPartition().first;
 }
 
 std::string SourceDescriptor::explain(ExplainVerbosity verbosity) const
@@ -155,6 +214,8 @@ SerializableSourceDescriptor SourceDescriptor::serialize() const
     serializedParserConfig->set_type(parserConfig.parserType);
     serializedParserConfig->set_tupledelimiter(parserConfig.tupleDelimiter);
     serializedParserConfig->set_fielddelimiter(parserConfig.fieldDelimiter);
+    serializedParserConfig->set_maxbytesperformattingtask(parserConfig.maxBytesPerFormattingTask);
+    serializedParserConfig->set_dictionaryencoding(parserConfig.dictionaryEncoding);
     serializableSourceDescriptor.set_allocated_parserconfig(serializedParserConfig);
 
     /// Iterate over SourceDescriptor config and serialize all key-value pairs.
@@ -21,6 +21,7 @@
 #include <utility>
 #include <Identifiers/Identifiers.hpp>
 #include <Runtime/AbstractBufferProvider.hpp>
+#include <Sources/AsyncSourceRuntime.hpp>
 #include <Sources/Source.hpp>
 #include <Sources/SourceReturnType.hpp>
 #include <SourceThread.hpp>
@@ -31,10 +32,16 @@ SourceHandle::SourceHandle(
     OriginId originId,
     SourceRuntimeConfiguration configuration,
     std::shared_ptr<AbstractBufferProvider> bufferPool,
-    std::unique_ptr<Source> sourceImplementation)
+    std::unique_ptr<Source> sourceImplementation,
+    std::shared_ptr<AsyncSourceRuntime> asyncSourceRuntime)
     : configuration(std::move(configuration))
 {
-    this->sourceThread = std::make_unique<SourceThread>(std::move(originId), std::move(bufferPool), std::move(sourceImplementation));
+    this->sourceThread = std::make_unique<SourceThread>(
+        std::move(originId),
+        std::move(bufferPool),
+        std::move(sourceImplementation),
+        std::move(asyncSourceRuntime),
+        this->configuration.formattedTupleSizeInBytes);
 }
 
 SourceHandle::~SourceHandle() = default;
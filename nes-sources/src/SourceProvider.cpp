@@ -14,38 +14,74 @@
 
 #include <Sources/SourceProvider.hpp>
 
+#include <cstddef>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <Identifiers/Identifiers.hpp>
 #include <Runtime/AbstractBufferProvider.hpp>
+#include <Sources/AsyncSourceRuntime.hpp>
 #include <Sources/SourceDescriptor.hpp>
 #include <Sources/SourceHandle.hpp>
 #include <ErrorHandling.hpp>
+#include <SharedSource.hpp>
 #include <SourceRegistry.hpp>
 
 namespace NES
 {
 
-SourceProvider::SourceProvider(size_t defaultMaxInflightBuffers, std::shared_ptr<AbstractBufferProvider> bufferPool)
-    : defaultMaxInflightBuffers(defaultMaxInflightBuffers), bufferPool(std::move(bufferPool))
+SourceProvider::SourceProvider(
+    size_t defaultMaxInflightBuffers,
+    std::shared_ptr<AbstractBufferProvider> bufferPool,
+    std::shared_ptr<AsyncSourceRuntime> asyncSourceRuntime)
+    : defaultMaxInflightBuffers(defaultMaxInflightBuffers)
+    , bufferPool(std::move(bufferPool))
+    , asyncSourceRuntime(std::move(asyncSourceRuntime))
 {
 }
 
-std::unique_ptr<SourceHandle> SourceProvider::lower(OriginId originId, const SourceDescriptor& sourceDescriptor) const
+std::unique_ptr<Source> SourceProvider::createSharedSource(const SourceDescriptor& sourceDescriptor) const
+{
+    const std::scoped_lock lock(sharedSourcesMutex);
+    std::erase_if(sharedSources, [](const auto& sharedSource) { return sharedSource.second.expired(); });
+    if (const auto sharedSource = sharedSources.find(sourceDescriptor); sharedSource != sharedSources.end())
+    {
+        return std::make_unique<SharedSource>(sharedSource->second.lock());
+    }
+
+    auto sourceArguments = SourceRegistryArguments(sourceDescriptor);
+    auto source = SourceRegistry::instance().create(sourceDescriptor.getSourceType(), sourceArguments);
+    if (not source.has_value())
+    {
+        throw UnknownSourceType("unknown source descriptor type: {}", sourceDescriptor.getSourceType());
+    }
+    auto reader = std::make_shared<SharedSourceReader>(std::move(source.value()), bufferPool);
+    sharedSources.emplace(sourceDescriptor, reader);
+    return std::make_unique<SharedSource>(std::move(reader));
+}
+
+std::unique_ptr<SourceHandle>
+SourceProvider::lower(OriginId originId, const SourceDescriptor& sourceDescriptor, const size_t formattedTupleSizeInBytes) const
 {
     /// Todo #241: Get the new source identfier from the source descriptor and pass it to SourceHandle.
     auto sourceArguments = SourceRegistryArguments(sourceDescriptor);
-    if (auto source = SourceRegistry::instance().create(sourceDescriptor.getSourceType(), sourceArguments))
+    auto source = sourceDescriptor.getFromConfig(SourceDescriptor::SHARED)
+        ? std::optional{createSharedSource(sourceDescriptor)}
+        : SourceRegistry::instance().create(sourceDescriptor.getSourceType(), sourceArguments);
+    if (source)
     {
         /// The source-specific configuration of maxInflightBuffers takes priority.
         /// If not specified (0), we take the NodeEngine-wide configuration.
         const auto maxInflightBuffers = (sourceDescriptor.getFromConfig(SourceDescriptor::MAX_INFLIGHT_BUFFERS) > 0)
             ? sourceDescriptor.getFromConfig(SourceDescriptor::MAX_INFLIGHT_BUFFERS)
             : defaultMaxInflightBuffers;
-        SourceRuntimeConfiguration runtimeConfig{maxInflightBuffers};
+        SourceRuntimeConfiguration runtimeConfig{
+            .inflightBufferLimit = maxInflightBuffers, .formattedTupleSizeInBytes = formattedTupleSizeInBytes};
 
-        return std::make_unique<SourceHandle>(std::move(originId), std::move(runtimeConfig), bufferPool, std::move(source.value()));
+        return std::make_unique<SourceHandle>(
+            std::move(originId), std::move(runtimeConfig), bufferPool, std::move(source.value()), asyncSourceRuntime);
     }
     throw UnknownSourceType("unknown source descriptor type: {}", sourceDescriptor.getSourceType());
 }
@@ -29,23 +29,49 @@
 #include <Identifiers/Identifiers.hpp>
 #include <Runtime/AbstractBufferProvider.hpp>
 #include <Runtime/TupleBuffer.hpp>
+#include <Sources/AsyncSource.hpp>
+#include <Sources/AsyncSourceRuntime.hpp>
 #include <Sources/Source.hpp>
 #include <Sources/SourceReturnType.hpp>
 #include <Time/Timestamp.hpp>
+#include <Util/CoarseClock.hpp>
 #include <Util/Logger/Logger.hpp>
 #include <Util/ThreadNaming.hpp>
 #include <cpptrace/from_current.hpp>
 #include <fmt/format.h>
+#include <AsyncSourceIOThread.hpp>
 #include <ErrorHandling.hpp>
 
 namespace NES
 {
 
 SourceThread::SourceThread(
-    OriginId originId, std::shared_ptr<AbstractBufferProvider> poolProvider, std::unique_ptr<Source> sourceImplementation)
-    : originId(originId), localBufferManager(std::move(poolProvider)), sourceImplementation(std::move(sourceImplementation))
+    OriginId originId,
+    std::shared_ptr<AbstractBufferProvider> poolProvider,
+    std::unique_ptr<Source> sourceImplementation,
+    std::shared_ptr<AsyncSourceRuntime> asyncSourceRuntime,
+    const size_t formattedTupleSizeInBytes)
+    : originId(originId)
+    , localBufferManager(std::move(poolProvider))
+    , sourceImplementation(std::move(sourceImplementation))
+    , formattedTupleSizeInBytes(formattedTupleSizeInBytes)
+    , asyncSourceRuntime(std::move(asyncSourceRuntime))
 {
     PRECONDITION(this->localBufferManager, "Invalid buffer manager");
+    PRECONDITION(
+        formattedTupleSizeInBytes <= this->localBufferManager->getBufferSize(),
+        "A tuple of {} bytes does not fit into a buffer of {} bytes",
+        formattedTupleSizeInBytes,
+        this->localBufferManager->getBufferSize());
+}
+
+SourceThread::~SourceThread()
+{
+    if (isRegisteredWithAsyncSourceRuntime and terminationFuture.valid())
+    {
+        asyncStopSource.request_stop();
+        terminationFuture.wait();
+    }
 }
 
 namespace detail
@@ -55,8 +81,7 @@ void addBufferMetaData(OriginId originId, SequenceNumber sequenceNumber, TupleBu
     /// set the origin id for this source
     buffer.setOriginId(originId);
     /// set the creation timestamp
-    buffer.setCreationTimestampInMS(Timestamp(
-        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now().time_since_epoch()).count()));
+    buffer.setCreationTimestampInMS(CoarseClock::now());
     /// Set the sequence number of this buffer.
     /// A data source generates a monotonic increasing sequence number
     buffer.setSequenceNumber(sequenceNumber);
@@ -71,6 +96,21 @@ void addBufferMetaData(OriginId originId, SequenceNumber sequenceNumber, TupleBu
         buffer.isLastChunk());
 }
 
+void setNumberOfTuplesOfFilledBuffer(TupleBuffer& buffer, const size_t numberOfBytes, const size_t formattedTupleSizeInBytes)
+{
+    if (formattedTupleSizeInBytes == 0)
+    {
+        buffer.setNumberOfTuples(numberOfBytes);
+        return;
+    }
+    INVARIANT(
+        numberOfBytes % formattedTupleSizeInBytes == 0,
+        "The source filled {} bytes, which is not a multiple of the tuple size {} bytes.",
+        numberOfBytes,
+        formattedTupleSizeInBytes);
+    buffer.setNumberOfTuples(numberOfBytes / formattedTupleSizeInBytes);
+}
+
 using EmitFn = std::function<void(TupleBuffer, bool addBufferMetadata)>;
 
 void threadSetup(OriginId originId)
@@ -104,8 +144,12 @@ struct SourceHandle
     Source& source; ///NOLINT Source handle should never outlive the source
 };
 
-SourceImplementationTermination
-dataSourceThreadRoutine(const std::stop_token& stopToken, Source& source, AbstractBufferProvider& bufferProvider, const EmitFn& emit)
+SourceImplementationTermination dataSourceThreadRoutine(
+    const std::stop_token& stopToken,
+    Source& source,
+    AbstractBufferProvider& bufferProvider,
+    const size_t formattedTupleSizeInBytes,
+    const EmitFn& emit)
 {
     const SourceHandle sourceHandle(source);
     while (!stopToken.stop_requested())
@@ -118,14 +162,32 @@ dataSourceThreadRoutine(const std::stop_token& stopToken, Source& source, Abstra
         ///    The thread exits with `EndOfStream`
         /// 4. Failure. The fillTupleBuffer method will throw an exception, the exception is propagted to the SourceThread via the return promise.
         ///    The thread exists with an exception
+        if (source.providesTupleBuffers())
+        {
+            auto providedBuffer = source.provideTupleBuffer(stopToken);
+            if (providedBuffer.has_value())
+            {
+                setNumberOfTuplesOfFilledBuffer(*providedBuffer, providedBuffer->getBufferSize(), formattedTupleSizeInBytes);
+                emit(std::move(*providedBuffer), true);
+            }
+            if (stopToken.stop_requested())
+            {
+                return {SourceImplementationTermination::StopRequested};
+            }
+            if (not providedBuffer.has_value())
+            {
+                return {SourceImplementationTermination::EndOfStream};
+            }
+            continue;
+        }
+
         auto emptyBuffer = bufferProvider.getBufferBlocking();
         const auto numReadBytes = source.fillTupleBuffer(emptyBuffer, stopToken);
 
         if (numReadBytes != 0)
         {
-            /// The source read in raw bytes, thus we don't know the number of tuples yet.
-            /// The InputFormatterTask expects that the source set the number of bytes this way and uses it to determine the number of tuples.
-            emptyBuffer.setNumberOfTuples(numReadBytes);
+            /// Unless the source emits formatted buffers, it read in raw bytes, thus we don't know the number of tuples yet.
+            setNumberOfTuplesOfFilledBuffer(emptyBuffer, numReadBytes, formattedTupleSizeInBytes);
             emit(emptyBuffer, true);
         }
 
@@ -149,7 +211,8 @@ void dataSourceThread(
     SourceReturnType::EmitFunction emit,
     const OriginId originId,
     ///NOLINTNEXTLINE(performance-unnecessary-value-param) `jthread` does not allow references
-    std::shared_ptr<AbstractBufferProvider> bufferProvider)
+    std::shared_ptr<AbstractBufferProvider> bufferProvider,
+    const size_t formattedTupleSizeInBytes)
 {
     threadSetup(originId);
 
@@ -165,7 +228,7 @@ void dataSourceThread(
 
     try
     {
-        result.set_value_at_thread_exit(dataSourceThreadRoutine(stopToken, *source, *bufferProvider, dataEmit));
+        result.set_value_at_thread_exit(dataSourceThreadRoutine(stopToken, *source, *bufferProvider, formattedTupleSizeInBytes, dataEmit));
         if (!stopToken.stop_requested())
         {
             emit(originId, SourceReturnType::EoS{}, stopToken);
@@ -192,13 +255,28 @@ bool SourceThread::start(SourceReturnType::EmitFunction&& emitFunction)
     std::promise<SourceImplementationTermination> terminationPromise;
     this->terminationFuture = terminationPromise.get_future();
 
+    if (auto* asyncSource = dynamic_cast<AsyncSource*>(sourceImplementation.get()); asyncSource != nullptr and asyncSourceRuntime)
+    {
+        asyncSourceRuntime->selectIOThread().registerSource(
+            {.originId = originId,
+             .source = *asyncSource,
+             .bufferProvider = localBufferManager,
+             .emit = std::move(emitFunction),
+             .formattedTupleSizeInBytes = formattedTupleSizeInBytes,
+             .termination = std::move(terminationPromise),
+             .stopToken = asyncStopSource.get_token()});
+        isRegisteredWithAsyncSourceRuntime = true;
+        return true;
+    }
+
     std::jthread sourceThread(
         detail::dataSourceThread,
         std::move(terminationPromise),
         sourceImplementation.get(),
         std::move(emitFunction),
         originId,
-        localBufferManager);
+        localBufferManager,
+        formattedTupleSizeInBytes);
     thread = std::move(sourceThread);
     return true;
 }
@@ -209,6 +287,7 @@ void SourceThread::stop()
 
     NES_DEBUG("SourceThread  {} : stop source", originId);
     thread.request_stop();
+    asyncStopSource.request_stop();
     {
         auto deletedOnScopeExit = std::move(thread);
     }
@@ -229,6 +308,7 @@ SourceReturnType::TryStopResult SourceThread::tryStop(std::chrono::milliseconds
     PRECONDITION(thread.get_id() != std::this_thread::get_id(), "DataSrc Thread should never request the source termination");
     NES_DEBUG("SourceThread  {} : attempting to stop source", originId);
     thread.request_stop();
+    asyncStopSource.request_stop();
 
     try
     {
@@ -258,6 +338,8 @@ std::ostream& operator<<(std::ostream& out, const SourceThread& sourceThread)
 {
     out << "\nSourceThread(";
     out << "\n  originId: " << sourceThread.originId;
+    out << "\n  formattedTupleSizeInBytes: " << sourceThread.formattedTupleSizeInBytes;
+    out << "\n  asyncSourceRuntime: " << (sourceThread.isRegisteredWithAsyncSourceRuntime ? "true" : "false");
     out << "\n  source implementation:" << *sourceThread.sourceImplementation;
     out << ")\n";
     return out;
@@ -0,0 +1,479 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <stop_token>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+#include <Identifiers/Identifiers.hpp>
+#include <Runtime/AbstractBufferProvider.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Sources/AsyncSource.hpp>
+#include <Sources/AsyncSourceRuntime.hpp>
+#include <Sources/SourceReturnType.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+#include <ErrorHandling.hpp>
+#include <SourceThread.hpp>
+
+namespace NES
+{
+namespace
+{
+constexpr auto DEFAULT_TIMEOUT = std::chrono::seconds(5);
+constexpr size_t DEFAULT_BUFFER_SIZE = 4096;
+constexpr size_t DEFAULT_NUMBER_OF_BUFFERS = 64;
+
+/// Reads from the non-blocking end of a pipe, which the test writes to
+class PipeSource final : public AsyncSource
+{
+public:
+    explicit PipeSource(std::shared_ptr<std::atomic_bool> wasClosed, const bool failDuringOpen = false)
+        : wasClosed(std::move(wasClosed)), failDuringOpen(failDuringOpen)
+    {
+        if (pipe2(pipeFds.data(), O_NONBLOCK) != 0)
+        {
+            throw TestException("Could not create pipe: {}", std::strerror(errno));
+        }
+    }
+
+    ~PipeSource() override
+    {
+        ::close(pipeFds[0]);
+        closeWriteEnd();
+    }
+
+    PipeSource(const PipeSource&) = delete;
+    PipeSource(PipeSource&&) = delete;
+    PipeSource& operator=(const PipeSource&) = delete;
+    PipeSource& operator=(PipeSource&&) = delete;
+
+    void write(const std::string& data) const
+    {
+        ASSERT_EQ(::write(pipeFds[1], data.data(), data.size()), static_cast<ssize_t>(data.size()));
+    }
+
+    void closeWriteEnd()
+    {
+        if (pipeFds[1] >= 0)
+        {
+            ::close(pipeFds[1]);
+            pipeFds[1] = -1;
+        }
+    }
+
+    size_t fillTupleBuffer(TupleBuffer&, const std::stop_token&) override
+    {
+        throw TestException("The async source runtime must not call the blocking fillTupleBuffer");
+    }
+
+    std::optional<int> getFileDescriptor() const override { return pipeFds[0]; }
+
+    std::optional<size_t> tryFillTupleBuffer(TupleBuffer& tupleBuffer, const size_t offset) override
+    {
+        const auto availableMemory = tupleBuffer.getAvailableMemoryArea().subspan(offset);
+        const auto numberOfReadBytes = ::read(pipeFds[0], availableMemory.data(), availableMemory.size());
+        if (numberOfReadBytes < 0 and errno == EAGAIN)
+        {
+            return 0;
+        }
+        if (numberOfReadBytes < 0)
+        {
+            throw TestException("Could not read: {}", std::strerror(errno));
+        }
+        if (numberOfReadBytes == 0)
+        {
+            return std::nullopt;
+        }
+        return static_cast<size_t>(numberOfReadBytes);
+    }
+
+    void open() override
+    {
+        if (failDuringOpen)
+        {
+            throw TestException("I should fail");
+        }
+    }
+
+    void close() override { *wasClosed = true; }
+
+protected:
+    std::ostream& toString(std::ostream& str) const override { return str << "PipeSource"; }
+
+private:
+    std::array<int, 2> pipeFds{-1, -1};
+    std::shared_ptr<std::atomic_bool> wasClosed;
+    bool failDuringOpen;
+};
+
+/// Returns a fixed number of full buffers without a descriptor, like a regular file
+class AlwaysReadableSource final : public AsyncSource
+{
+public:
+    explicit AlwaysReadableSource(const size_t numberOfBuffers) : numberOfRemainingBuffers(numberOfBuffers) { }
+
+    size_t fillTupleBuffer(TupleBuffer&, const std::stop_token&) override
+    {
+        throw TestException("The async source runtime must not call the blocking fillTupleBuffer");
+    }
+
+    std::optional<int> getFileDescriptor() const override { return std::nullopt; }
+
+    std::optional<size_t> tryFillTupleBuffer(TupleBuffer& tupleBuffer, const size_t offset) override
+    {
+        if (numberOfRemainingBuffers == 0)
+        {
+            return std::nullopt;
+        }
+        --numberOfRemainingBuffers;
+        return tupleBuffer.getBufferSize() - offset;
+    }
+
+    void open() override { }
+
+    void close() override { }
+
+protected:
+    std::ostream& toString(std::ostream& str) const override { return str << "AlwaysReadableSource"; }
+
+private:
+    size_t numberOfRemainingBuffers;
+};
+
+/// Waits for a byte on a handshake pipe and reads from a data pipe afterward, like a listening socket that accepted a connection
+class HandoverSource final : public AsyncSource
+{
+public:
+    HandoverSource()
+    {
+        if (pipe2(handshakeFds.data(), O_NONBLOCK) != 0 or pipe2(dataFds.data(), O_NONBLOCK) != 0)
+        {
+            throw TestException("Could not create pipe: {}", std::strerror(errno));
+        }
+    }
+
+    ~HandoverSource() override
+    {
+        for (const auto fd : {handshakeFds[0], handshakeFds[1], dataFds[0], dataFds[1]})
+        {
+            ::close(fd);
+        }
+    }
+
+    HandoverSource(const HandoverSource&) = delete;
+    HandoverSource(HandoverSource&&) = delete;
+    HandoverSource& operator=(const HandoverSource&) = delete;
+    HandoverSource& operator=(HandoverSource&&) = delete;
+
+    void handshake() const { ASSERT_EQ(::write(handshakeFds[1], "x", 1), 1); }
+
+    void write(const std::string& data) const
+    {
+        ASSERT_EQ(::write(dataFds[1], data.data(), data.size()), static_cast<ssize_t>(data.size()));
+    }
+
+    void closeWriteEnd()
+    {
+        ::close(dataFds[1]);
+        dataFds[1] = -1;
+    }
+
+    size_t fillTupleBuffer(TupleBuffer&, const std::stop_token&) override
+    {
+        throw TestException("The async source runtime must not call the blocking fillTupleBuffer");
+    }
+
+    std::optional<int> getFileDescriptor() const override { return handshakeFds[0] >= 0 ? handshakeFds[0] : dataFds[0]; }
+
+    std::optional<size_t> tryFillTupleBuffer(TupleBuffer& tupleBuffer, const size_t offset) override
+    {
+        if (handshakeFds[0] >= 0)
+        {
+            /// Closing the handshake pipe removes it from the epoll instance
+            ::close(handshakeFds[0]);
+            handshakeFds[0] = -1;
+            return 0;
+        }
+        const auto availableMemory = tupleBuffer.getAvailableMemoryArea().subspan(offset);
+        const auto numberOfReadBytes = ::read(dataFds[0], availableMemory.data(), availableMemory.size());
+        if (numberOfReadBytes < 0 and errno == EAGAIN)
+        {
+            return 0;
+        }
+        if (numberOfReadBytes <= 0)
+        {
+            return std::nullopt;
+        }
+        return static_cast<size_t>(numberOfReadBytes);
+    }
+
+    void open() override { }
+
+    void close() override { }
+
+protected:
+    std::ostream& toString(std::ostream& str) const override { return str << "HandoverSource"; }
+
+private:
+    std::array<int, 2> handshakeFds{-1, -1};
+    std::array<int, 2> dataFds{-1, -1};
+};
+
+struct RecordingEmitFunction
+{
+    SourceReturnType::EmitFunction create()
+    {
+        return [this](const OriginId, SourceReturnType::SourceReturnType event, const std::stop_token&)
+        {
+            {
+                const std::scoped_lock lock(mutex);
+                if (auto* data = std::get_if<SourceReturnType::Data>(&event))
+                {
+                    receivedBytes += data->buffer.getNumberOfTuples();
+                    receivedData.append(
+                        data->buffer.getAvailableMemoryArea<char>().data(), data->buffer.getNumberOfTuples() * tupleSizeInBytes);
+                    sequenceNumbers.emplace_back(data->buffer.getSequenceNumber());
+                }
+                else if (std::holds_alternative<SourceReturnType::EoS>(event))
+                {
+                    ++numberOfEndOfStreams;
+                }
+                else
+                {
+                    ++numberOfErrors;
+                }
+            }
+            emitted.notify_all();
+            return SourceReturnType::EmitResult::SUCCESS;
+        };
+    }
+
+    bool waitFor(const std::function<bool()>& predicate)
+    {
+        std::unique_lock lock(mutex);
+        return emitted.wait_for(lock, DEFAULT_TIMEOUT, predicate);
+    }
+
+    std::mutex mutex;
+    std::condition_variable emitted;
+    /// Raw buffers carry their number of bytes as their number of tuples
+    size_t tupleSizeInBytes{1};
+    size_t receivedBytes{0};
+    std::string receivedData;
+    size_t numberOfEndOfStreams{0};
+    size_t numberOfErrors{0};
+    std::vector<SequenceNumber> sequenceNumbers;
+};
+}
+
+class AsyncSourceRuntimeTest : public Testing::BaseUnitTest
+{
+public:
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("AsyncSourceRuntimeTest.log", LogLevel::LOG_DEBUG);
+        NES_INFO("Setup AsyncSourceRuntimeTest test class.");
+    }
+
+    void SetUp() override { Testing::BaseUnitTest::SetUp(); }
+
+    std::shared_ptr<BufferManager> bufferManager = BufferManager::create(DEFAULT_BUFFER_SIZE, DEFAULT_NUMBER_OF_BUFFERS);
+};
+
+TEST_F(AsyncSourceRuntimeTest, EmitsAvailableBytesAndEndOfStream)
+{
+    auto runtime = std::make_shared<AsyncSourceRuntime>(1);
+    RecordingEmitFunction recorder;
+    auto wasClosed = std::make_shared<std::atomic_bool>(false);
+    auto source = std::make_unique<PipeSource>(wasClosed);
+    auto& pipe = *source;
+    {
+        SourceThread sourceThread(INITIAL<OriginId>, bufferManager, std::move(source), runtime);
+        ASSERT_TRUE(sourceThread.start(recorder.create()));
+
+        pipe.write("first");
+        ASSERT_TRUE(recorder.waitFor([&] { return recorder.receivedBytes == 5; }));
+        pipe.write("second");
+        ASSERT_TRUE(recorder.waitFor([&] { return recorder.receivedBytes == 11; }));
+        pipe.closeWriteEnd();
+        ASSERT_TRUE(recorder.waitFor([&] { return recorder.numberOfEndOfStreams == 1; }));
+        sourceThread.stop();
+    }
+
+    EXPECT_TRUE(*wasClosed);
+    EXPECT_EQ(recorder.sequenceNumbers, (std::vector{SequenceNumber(1), SequenceNumber(2)}));
+}
+
+TEST_F(AsyncSourceRuntimeTest, StopsIdleSource)
+{
+    auto runtime = std::make_shared<AsyncSourceRuntime>(1);
+    RecordingEmitFunction recorder;
+    auto wasClosed = std::make_shared<std::atomic_bool>(false);
+    {
+        SourceThread sourceThread(INITIAL<OriginId>, bufferManager, std::make_unique<PipeSource>(wasClosed), runtime);
+        ASSERT_TRUE(sourceThread.start(recorder.create()));
+        EXPECT_EQ(sourceThread.tryStop(std::chrono::duration_cast<std::chrono::milliseconds>(DEFAULT_TIMEOUT)),
+                  SourceReturnType::TryStopResult::SUCCESS);
+    }
+
+    EXPECT_TRUE(*wasClosed);
+    EXPECT_EQ(recorder.numberOfEndOfStreams, 0);
+    EXPECT_EQ(recorder.receivedBytes, 0);
+}
+
+TEST_F(AsyncSourceRuntimeTest, DestructionStopsSource)
+{
+    auto runtime = std::make_shared<AsyncSourceRuntime>(1);
+    RecordingEmitFunction recorder;
+    auto wasClosed = std::make_shared<std::atomic_bool>(false);
+    {
+        SourceThread sourceThread(INITIAL<OriginId>, bufferManager, std::make_unique<PipeSource>(wasClosed), runtime);
+        ASSERT_TRUE(sourceThread.start(recorder.create()));
+    }
+    EXPECT_TRUE(*wasClosed) << "The SourceThread destructor should wait until the I/O thread closed the source";
+}
+
+TEST_F(AsyncSourceRuntimeTest, FailureDuringOpen)
+{
+    auto runtime = std::make_shared<AsyncSourceRuntime>(1);
+    RecordingEmitFunction recorder;
+    auto wasClosed = std::make_shared<std::atomic_bool>(false);
+    {
+        SourceThread sourceThread(INITIAL<OriginId>, bufferManager, std::make_unique<PipeSource>(wasClosed, true), runtime);
+        ASSERT_TRUE(sourceThread.start(recorder.create()));
+        ASSERT_TRUE(recorder.waitFor([&] { return recorder.numberOfErrors == 1; }));
+        sourceThread.stop();
+    }
+    EXPECT_FALSE(*wasClosed) << "The I/O thread should not close a source that failed to open";
+}
+
+TEST_F(AsyncSourceRuntimeTest, ManySourcesShareFewIOThreads)
+{
+    constexpr size_t numberOfSources = 32;
+    auto runtime = std::make_shared<AsyncSourceRuntime>(2);
+    std::vector<std::unique_ptr<RecordingEmitFunction>> recorders;
+    std::vector<PipeSource*> pipes;
+    std::vector<std::unique_ptr<SourceThread>> sourceThreads;
+    for (size_t sourceIdx = 0; sourceIdx < numberOfSources; ++sourceIdx)
+    {
+        auto source = std::make_unique<PipeSource>(std::make_shared<std::atomic_bool>(false));
+        pipes.emplace_back(source.get());
+        auto& recorder = *recorders.emplace_back(std::make_unique<RecordingEmitFunction>());
+        auto& sourceThread = *sourceThreads.emplace_back(
+            std::make_unique<SourceThread>(OriginId(sourceIdx + 1), bufferManager, std::move(source), runtime));
+        ASSERT_TRUE(sourceThread.start(recorder.create()));
+    }
+
+    for (auto* pipe : pipes)
+    {
+        pipe->write("data");
+        pipe->closeWriteEnd();
+    }
+    for (auto& recorder : recorders)
+    {
+        ASSERT_TRUE(recorder->waitFor([&] { return recorder->numberOfEndOfStreams == 1; }));
+        EXPECT_EQ(recorder->receivedBytes, 4);
+    }
+    for (auto& sourceThread : sourceThreads)
+    {
+        sourceThread->stop();
+    }
+}
+
+TEST_F(AsyncSourceRuntimeTest, FollowsChangedFileDescriptor)
+{
+    auto runtime = std::make_shared<AsyncSourceRuntime>(1);
+    RecordingEmitFunction recorder;
+    auto source = std::make_unique<HandoverSource>();
+    auto& handover = *source;
+    {
+        SourceThread sourceThread(INITIAL<OriginId>, bufferManager, std::move(source), runtime);
+        ASSERT_TRUE(sourceThread.start(recorder.create()));
+
+        /// The source watches the handshake pipe, thus it must not read the data before the handshake
+        handover.write("data");
+        handover.handshake();
+        ASSERT_TRUE(recorder.waitFor([&] { return recorder.receivedBytes == 4; }));
+        handover.closeWriteEnd();
+        ASSERT_TRUE(recorder.waitFor([&] { return recorder.numberOfEndOfStreams == 1; }));
+        sourceThread.stop();
+    }
+    EXPECT_EQ(recorder.numberOfErrors, 0);
+    EXPECT_EQ(recorder.sequenceNumbers, (std::vector{SequenceNumber(1)}));
+}
+
+TEST_F(AsyncSourceRuntimeTest, AlwaysReadableSourceFillsBuffers)
+{
+    constexpr size_t numberOfBuffers = 3 * DEFAULT_NUMBER_OF_BUFFERS;
+    auto runtime = std::make_shared<AsyncSourceRuntime>(1);
+    RecordingEmitFunction recorder;
+    {
+        SourceThread sourceThread(INITIAL<OriginId>, bufferManager, std::make_unique<AlwaysReadableSource>(numberOfBuffers), runtime);
+        ASSERT_TRUE(sourceThread.start(recorder.create()));
+        ASSERT_TRUE(recorder.waitFor([&] { return recorder.numberOfEndOfStreams == 1; }));
+        sourceThread.stop();
+    }
+    EXPECT_EQ(recorder.receivedBytes, numberOfBuffers * DEFAULT_BUFFER_SIZE);
+    EXPECT_EQ(recorder.sequenceNumbers.size(), numberOfBuffers);
+}
+
+TEST_F(AsyncSourceRuntimeTest, FormattedBuffersContainWholeTuples)
+{
+    constexpr size_t tupleSizeInBytes = 4;
+    auto runtime = std::make_shared<AsyncSourceRuntime>(1);
+    RecordingEmitFunction recorder;
+    recorder.tupleSizeInBytes = tupleSizeInBytes;
+    auto source = std::make_unique<PipeSource>(std::make_shared<std::atomic_bool>(false));
+    auto& pipe = *source;
+    {
+        SourceThread sourceThread(INITIAL<OriginId>, bufferManager, std::move(source), runtime, tupleSizeInBytes);
+        ASSERT_TRUE(sourceThread.start(recorder.create()));
+
+        /// The next buffer starts with the partial tuple of the previous one
+        pipe.write("abcdef");
+        ASSERT_TRUE(recorder.waitFor([&] { return recorder.receivedData == "abcd"; }));
+        pipe.write("gh");
+        ASSERT_TRUE(recorder.waitFor([&] { return recorder.receivedData == "abcdefgh"; }));
+        /// A partial tuple at the end of the stream is discarded
+        pipe.write("ij");
+        pipe.closeWriteEnd();
+        ASSERT_TRUE(recorder.waitFor([&] { return recorder.numberOfEndOfStreams == 1; }));
+        sourceThread.stop();
+    }
+    EXPECT_EQ(recorder.receivedData, "abcdefgh");
+    EXPECT_EQ(recorder.receivedBytes, 2) << "Formatted buffers carry their number of tuples";
+    EXPECT_EQ(recorder.sequenceNumbers, (std::vector{SequenceNumber(1), SequenceNumber(2)}));
+}
+
+}
@@ -0,0 +1,234 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <stop_token>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <unistd.h>
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/DataTypeProvider.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Sources/LogicalSource.hpp>
+#include <Sources/SourceCatalog.hpp>
+#include <Sources/SourceDescriptor.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+#include <FileSource.hpp>
+
+namespace NES
+{
+
+class FileSourceTest : public Testing::BaseUnitTest
+{
+public:
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("FileSourceTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup FileSourceTest test class.");
+    }
+
+    void SetUp() override
+    {
+        BaseUnitTest::SetUp();
+        filePath = std::filesystem::temp_directory_path()
+            / ("FileSourceTest_" + std::to_string(getpid()) + "_"
+               + ::testing::UnitTest::GetInstance()->current_test_info()->name() + ".csv");
+        auto schema = Schema{};
+        schema.addField("id", DataTypeProvider::provideDataType(DataType::Type::UINT64));
+        schema.addField("value", DataTypeProvider::provideDataType(DataType::Type::UINT64));
+        logicalSource = sourceCatalog.addLogicalSource("testSource", schema);
+        ASSERT_TRUE(logicalSource.has_value());
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove(filePath);
+        BaseUnitTest::TearDown();
+    }
+
+    /// Writes 'numberOfBytes' bytes of distinguishable lines to the test file and returns them
+    std::string writeTestFile(const size_t numberOfBytes) const
+    {
+        std::string content;
+        for (size_t line = 0; content.size() < numberOfBytes; ++line)
+        {
+            content += std::to_string(line) + ",42\n";
+        }
+        content.resize(numberOfBytes);
+        std::ofstream(filePath, std::ios::binary) << content;
+        return content;
+    }
+
+    SourceDescriptor createDescriptor(std::unordered_map<std::string, std::string> config)
+    {
+        config.emplace("file_path", filePath.string());
+        const auto descriptor = sourceCatalog.addPhysicalSource(logicalSource.value(), "File", std::move(config), {{"type", "CSV"}});
+        EXPECT_TRUE(descriptor.has_value());
+        return descriptor.value();
+    }
+
+    /// Reads the whole partition of the source in either mode
+    static std::string readAll(FileSource& fileSource, BufferManager& bufferManager)
+    {
+        std::string readContent;
+        while (true)
+        {
+            if (fileSource.providesTupleBuffers())
+            {
+                const auto region = fileSource.provideTupleBuffer(std::stop_token{});
+                if (not region.has_value())
+                {
+                    return readContent;
+                }
+                const auto bytes = region->getAvailableMemoryArea<char>();
+                readContent.append(bytes.begin(), bytes.end());
+                continue;
+            }
+            auto buffer = bufferManager.getBufferBlocking();
+            const auto numberOfBytes = fileSource.fillTupleBuffer(buffer, std::stop_token{});
+            if (numberOfBytes == 0)
+            {
+                return readContent;
+            }
+            const auto bytes = buffer.getAvailableMemoryArea<char>().first(numberOfBytes);
+            readContent.append(bytes.begin(), bytes.end());
+        }
+    }
+
+    std::filesystem::path filePath;
+    SourceCatalog sourceCatalog;
+    std::optional<LogicalSource> logicalSource;
+    const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+};
+
+/// clang tidy doesn't recognize the .has_value in the ASSERT_TRUE
+/// NOLINTBEGIN(bugprone-unchecked-optional-access)
+TEST_F(FileSourceTest, MemoryMappedRegionsCoverTheFile)
+{
+    const auto content = writeTestFile((2 * pageSize) + (pageSize / 2));
+    FileSource fileSource(createDescriptor({{"memory_mapped", "true"}, {"memory_mapped_region_size", std::to_string(pageSize)}}));
+    ASSERT_TRUE(fileSource.providesTupleBuffers());
+
+    fileSource.open();
+    std::vector<TupleBuffer> regions;
+    while (auto region = fileSource.provideTupleBuffer(std::stop_token{}))
+    {
+        regions.emplace_back(std::move(region.value()));
+    }
+    /// The regions remain valid after the source closed the mapping
+    fileSource.close();
+
+    ASSERT_EQ(regions.size(), 3);
+    std::string mappedContent;
+    for (const auto& region : regions)
+    {
+        const auto bytes = region.getAvailableMemoryArea<char>();
+        mappedContent.append(bytes.begin(), bytes.end());
+    }
+    EXPECT_EQ(regions[0].getBufferSize(), pageSize);
+    EXPECT_EQ(regions[2].getBufferSize(), pageSize / 2);
+    EXPECT_EQ(mappedContent, content);
+}
+
+TEST_F(FileSourceTest, MemoryMappedAndCopyingModesReadTheSameBytes)
+{
+    const auto content = writeTestFile((3 * pageSize) + 17);
+    auto bufferManager = BufferManager::create(1000, 8);
+
+    FileSource copyingSource(createDescriptor({}));
+    ASSERT_FALSE(copyingSource.providesTupleBuffers());
+    copyingSource.open();
+    std::string copiedContent;
+    while (true)
+    {
+        auto buffer = bufferManager->getBufferBlocking();
+        const auto numberOfBytes = copyingSource.fillTupleBuffer(buffer, std::stop_token{});
+        if (numberOfBytes == 0)
+        {
+            break;
+        }
+        const auto bytes = buffer.getAvailableMemoryArea<char>().first(numberOfBytes);
+        copiedContent.append(bytes.begin(), bytes.end());
+    }
+    copyingSource.close();
+
+    FileSource mappedSource(createDescriptor({{"memory_mapped", "true"}}));
+    mappedSource.open();
+    std::string mappedContent;
+    while (const auto region = mappedSource.provideTupleBuffer(std::stop_token{}))
+    {
+        const auto bytes = region->getAvailableMemoryArea<char>();
+        mappedContent.append(bytes.begin(), bytes.end());
+    }
+    mappedSource.close();
+
+    EXPECT_EQ(copiedContent, content);
+    EXPECT_EQ(mappedContent, content);
+}
+
+TEST_F(FileSourceTest, MemoryMappedEmptyFileEndsTheStream)
+{
+    writeTestFile(0);
+    FileSource fileSource(createDescriptor({{"memory_mapped", "true"}}));
+    fileSource.open();
+    EXPECT_FALSE(fileSource.provideTupleBuffer(std::stop_token{}).has_value());
+    fileSource.close();
+}
+
+TEST_F(FileSourceTest, PartitionsReadEveryTupleOnce)
+{
+    const auto content = writeTestFile((3 * pageSize) + 17);
+    auto bufferManager = BufferManager::create(1000, 8);
+    for (const auto* const memoryMapped : {"false", "true"})
+    {
+        const auto partitions = createDescriptor({{"memory_mapped", memoryMapped}, {"partitions", "3"}}).partition();
+        ASSERT_EQ(partitions.size(), 3);
+
+        std::string partitionedContent;
+        for (const auto& partition : partitions)
+        {
+            FileSource fileSource(partition);
+            fileSource.open();
+            const auto partitionContent = readAll(fileSource, *bufferManager);
+            fileSource.close();
+            /// Every partition but the last one ends with a whole tuple
+            ASSERT_FALSE(partitionContent.empty());
+            if (partition.getPartition().first + 1 < partitions.size())
+            {
+                EXPECT_EQ(partitionContent.back(), '\n');
+            }
+            partitionedContent += partitionContent;
+        }
+        EXPECT_EQ(partitionedContent, content);
+    }
+}
+
+TEST_F(FileSourceTest, RegionSizeMustBeAMultipleOfThePageSize)
+{
+    writeTestFile(pageSize);
+    EXPECT_ANY_THROW(createDescriptor({{"memory_mapped", "true"}, {"memory_mapped_region_size", std::to_string(pageSize + 1)}}));
+}
+/// NOLINTEND(bugprone-unchecked-optional-access)
+
+}
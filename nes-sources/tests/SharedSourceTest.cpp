@@ -0,0 +1,170 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <stop_token>
+#include <string>
+#include <unordered_map>
+#include <unistd.h>
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/DataTypeProvider.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Sources/LogicalSource.hpp>
+#include <Sources/SourceCatalog.hpp>
+#include <Sources/SourceDescriptor.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+#include <FileSource.hpp>
+#include <SharedSource.hpp>
+
+namespace NES
+{
+
+class SharedSourceTest : public Testing::BaseUnitTest
+{
+public:
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("SharedSourceTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup SharedSourceTest test class.");
+    }
+
+    void SetUp() override
+    {
+        BaseUnitTest::SetUp();
+        filePath = std::filesystem::temp_directory_path()
+            / ("SharedSourceTest_" + std::to_string(getpid()) + "_"
+               + ::testing::UnitTest::GetInstance()->current_test_info()->name() + ".csv");
+        auto schema = Schema{};
+        schema.addField("id", DataTypeProvider::provideDataType(DataType::Type::UINT64));
+        schema.addField("value", DataTypeProvider::provideDataType(DataType::Type::UINT64));
+        logicalSource = sourceCatalog.addLogicalSource("testSource", schema);
+        ASSERT_TRUE(logicalSource.has_value());
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove(filePath);
+        BaseUnitTest::TearDown();
+    }
+
+    /// Writes 'numberOfBytes' bytes of distinguishable lines to the test file and returns them
+    std::string writeTestFile(const size_t numberOfBytes) const
+    {
+        std::string content;
+        for (size_t line = 0; content.size() < numberOfBytes; ++line)
+        {
+            content += std::to_string(line) + ",42\n";
+        }
+        content.resize(numberOfBytes);
+        std::ofstream(filePath, std::ios::binary) << content;
+        return content;
+    }
+
+    std::shared_ptr<SharedSourceReader> createReader()
+    {
+        const auto descriptor = sourceCatalog.addPhysicalSource(
+            logicalSource.value(), "File", {{"file_path", filePath.string()}, {"shared", "true"}}, {{"type", "CSV"}});
+        EXPECT_TRUE(descriptor.has_value());
+        return std::make_shared<SharedSourceReader>(std::make_unique<FileSource>(descriptor.value()), bufferManager);
+    }
+
+    /// Reads the remaining buffers of the source
+    static std::string readAll(SharedSource& source)
+    {
+        std::string content;
+        while (const auto buffer = source.provideTupleBuffer(std::stop_token{}))
+        {
+            const auto bytes = buffer->getAvailableMemoryArea<char>();
+            content.append(bytes.begin(), bytes.end());
+        }
+        return content;
+    }
+
+    std::filesystem::path filePath;
+    SourceCatalog sourceCatalog;
+    std::optional<LogicalSource> logicalSource;
+    std::shared_ptr<BufferManager> bufferManager = BufferManager::create(1000, 16);
+};
+
+/// clang tidy doesn't recognize the .has_value in the ASSERT_TRUE
+/// NOLINTBEGIN(bugprone-unchecked-optional-access)
+TEST_F(SharedSourceTest, AllSubscribersReadTheSameBytes)
+{
+    const auto content = writeTestFile(5500);
+    const auto reader = createReader();
+    SharedSource firstSource(reader);
+    SharedSource secondSource(reader);
+    firstSource.open();
+    secondSource.open();
+    ASSERT_EQ(reader->getNumberOfSubscriptions(), 2);
+
+    /// The first source reads the file for both sources
+    EXPECT_EQ(readAll(firstSource), content);
+    EXPECT_EQ(readAll(secondSource), content);
+
+    firstSource.close();
+    secondSource.close();
+    EXPECT_EQ(reader->getNumberOfSubscriptions(), 0);
+}
+
+TEST_F(SharedSourceTest, LateSubscriberReadsFromTheCurrentPosition)
+{
+    const auto content = writeTestFile(3000);
+    const auto reader = createReader();
+    SharedSource firstSource(reader);
+    SharedSource lateSource(reader);
+    firstSource.open();
+
+    const auto firstBuffer = firstSource.provideTupleBuffer(std::stop_token{});
+    ASSERT_TRUE(firstBuffer.has_value());
+    ASSERT_EQ(firstBuffer->getBufferSize(), 1000);
+
+    lateSource.open();
+    EXPECT_EQ(readAll(lateSource), content.substr(1000));
+    EXPECT_EQ(readAll(firstSource), content.substr(1000));
+
+    firstSource.close();
+    lateSource.close();
+}
+
+TEST_F(SharedSourceTest, StopOfOneSubscriberDoesNotEndTheStream)
+{
+    const auto content = writeTestFile(2000);
+    const auto reader = createReader();
+    SharedSource stoppedSource(reader);
+    SharedSource runningSource(reader);
+    stoppedSource.open();
+    runningSource.open();
+
+    std::stop_source stopSource;
+    stopSource.request_stop();
+    EXPECT_FALSE(stoppedSource.provideTupleBuffer(stopSource.get_token()).has_value());
+    stoppedSource.close();
+
+    EXPECT_EQ(readAll(runningSource), content);
+    runningSource.close();
+}
+/// NOLINTEND(bugprone-unchecked-optional-access)
+
+}
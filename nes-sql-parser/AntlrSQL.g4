@@ -58,7 +58,7 @@ singleStatement: statement ';'? EOF;
 
 terminatedStatement: statement ';';
 multipleStatements: (statement (';' statement)* ';'?)? EOF;
-statement: query | createStatement | dropStatement | showStatement;
+statement: query | createStatement | dropStatement | showStatement | prepareStatement | executeStatement;
 
 createStatement: CREATE createDefinition;
 createDefinition: createLogicalSourceDefinition | createPhysicalSourceDefinition | createSinkDefinition;
@@ -95,6 +95,10 @@ showSubject: QUERIES #showQueriesSubject
 
 showFilter: attr=strictIdentifier EQ value=constant;
 
+prepareStatement: PREPARE name=strictIdentifier AS query;
+executeStatement: EXECUTE name=strictIdentifier (USING '(' bindings+=parameterBinding (',' bindings+=parameterBinding)* ')')?;
+parameterBinding: parameterName=constant EQ value=constant;
+
 query : queryTerm queryOrganization;
 
 queryOrganization:
@@ -115,7 +119,8 @@ queryPrimary
     | '(' query ')'                                                         #subquery
     ;
 /// new layout to be closer to traditional SQL
-querySpecification: selectClause fromClause whereClause? windowedAggregationClause? havingClause? sinkClause?;
+querySpecification: selectClause fromClause whereClause? reorderClause? patternClause? windowedAggregationClause? havingClause? topNClause?
+                    sinkClause?;
 
 
 fromClause: FROM relation (',' relation)*;
@@ -127,6 +132,11 @@ relation
 joinRelation
     : (joinType) JOIN right=relationPrimary joinCriteria? windowClause
     | NATURAL joinType JOIN right=relationPrimary windowClause
+    | (joinType) JOIN lookupTable joinCriteria
+    ;
+
+lookupTable
+    : LOOKUP '(' parameters=namedConfigExpressionSeq ')' AS? name=identifier
     ;
 
 joinType
@@ -162,6 +172,27 @@ whereClause: WHERE booleanExpression;
 
 havingClause: HAVING booleanExpression;
 
+/// Emits the records in the order of the timestamp field, by sorting the records of each interval once the watermark has passed it
+reorderClause: REORDER BY timestamp=identifier EVERY interval=INTEGER_VALUE timeUnit;
+
+/// Detects a sequence of events per partition key, whose events occurred within the interval, and emits the partition keys and the start
+/// and end of every match. A step is an event, an iteration of an event, i.e., `event+` for at least once, `event[min, max]` or
+/// `event[min,]`, or all events of an AND(...) in any order, or any event of an OR(...).
+patternClause: PATTERN SEQ '(' patternStep (',' patternStep)* ')'
+    WITHIN '(' timestamp=identifier ',' interval=INTEGER_VALUE timeUnit ')'
+    (PARTITION BY '(' partitionKeys+=identifier (',' partitionKeys+=identifier)* ')')?
+    DEFINE patternEvent (',' patternEvent)*;
+
+patternStep
+    : event=identifier (iteration=PLUS | '[' minimum=INTEGER_VALUE ',' maximum=INTEGER_VALUE? ']')?      #eventPatternStep
+    | op=(AND | OR) '(' events+=identifier (',' events+=identifier)* ')'                                #compositePatternStep
+    ;
+
+patternEvent: name=identifier AS booleanExpression;
+
+/// Emits solely the `limit` records with the highest (DESC, the default) or lowest (ASC) value of the order field per window
+topNClause: ORDER BY orderField=identifier ordering=(ASC | DESC)? LIMIT limit=INTEGER_VALUE;
+
 inlineTable
     : VALUES expression (',' expression)* tableAlias
     ;
@@ -236,8 +267,8 @@ booleanExpression
 
 /// Problem fixed that the querySpecification rule could match an empty string
 windowedAggregationClause:
-    groupByClause? windowClause watermarkClause?
-    | windowClause groupByClause? watermarkClause?;
+    groupByClause? windowClause emitClause? watermarkClause?
+    | windowClause groupByClause? emitClause? watermarkClause?;
 
 groupByClause
     : GROUP BY groupingExpressions+=expression (',' groupingExpressions+=expression)* (
@@ -258,6 +289,9 @@ windowClause
 
 watermarkClause: WATERMARK '(' watermarkParameters ')';
 
+/// Emits early results of open windows, whenever the watermark passes a multiple of the interval
+emitClause: EMIT EVERY interval=INTEGER_VALUE timeUnit;
+
 watermarkParameters: watermarkIdentifier=identifier ',' watermark=INTEGER_VALUE watermarkTimeUnit=timeUnit;
 /// Adding Threshold Windows
 windowSpec:
@@ -269,6 +303,7 @@ windowSpec:
 timeWindow
     : TUMBLING '(' (timestampParameter ',')?  sizeParameter ')'                       #tumblingWindow
     | SLIDING '(' (timestampParameter ',')? sizeParameter ',' advancebyParameter ')' #slidingWindow
+    | SESSION '(' (timestampParameter ',')? gapParameter ')'                          #sessionWindow
     ;
 
 countWindow:
@@ -286,6 +321,8 @@ sizeParameter: SIZE INTEGER_VALUE timeUnit;
 
 advancebyParameter: ADVANCE BY INTEGER_VALUE timeUnit;
 
+gapParameter: GAP INTEGER_VALUE timeUnit;
+
 timeUnit: MS
         | SEC
         | MINUTE
@@ -402,6 +439,7 @@ BETWEEN: 'BETWEEN' | 'between';
 BY: 'BY' | 'by';
 COMMENT: 'COMMENT';
 CUBE: 'CUBE';
+DEFINE: 'DEFINE' | 'define';
 DELETE: 'DELETE';
 DESC: 'DESC' | 'desc';
 DISTINCT: 'DISTINCT';
@@ -431,6 +469,7 @@ LEFT: 'LEFT';
 LIKE: 'LIKE';
 LIMIT: 'LIMIT' | 'limit';
 LIST: 'LIST';
+LOOKUP: 'LOOKUP' | 'lookup';
 MERGE: 'MERGE' | 'merge';
 NATURAL: 'NATURAL';
 NOT: 'NOT' | 'not' | '!';
@@ -440,13 +479,17 @@ OF: 'OF';
 ON: 'ON' | 'on';
 OR: 'OR' | 'or';
 ORDER: 'ORDER' | 'order';
+PARTITION: 'PARTITION' | 'partition';
+PATTERN: 'PATTERN' | 'pattern';
 QUERY: 'QUERY';
 RECOVER: 'RECOVER';
+REORDER: 'REORDER' | 'reorder';
 RIGHT: 'RIGHT';
 RLIKE: 'RLIKE' | 'REGEXP';
 ROLLUP: 'ROLLUP';
 SCHEMA: 'SCHEMA';
 SELECT: 'SELECT' | 'select';
+SEQ: 'SEQ' | 'seq';
 SETS: 'SETS';
 SOME: 'SOME';
 START: 'START';
@@ -463,12 +506,17 @@ WHEN: 'WHEN';
 WHERE: 'WHERE' | 'where';
 WINDOW: 'WINDOW' | 'window';
 WITH: 'WITH';
+WITHIN: 'WITHIN' | 'within';
 SET: 'SET';
 TUMBLING: 'TUMBLING' | 'tumbling';
 SLIDING: 'SLIDING' | 'sliding';
+SESSION: 'SESSION' | 'session';
 THRESHOLD : 'THRESHOLD'|'threshold';
 SIZE: 'SIZE' | 'size';
 ADVANCE: 'ADVANCE' | 'advance';
+GAP: 'GAP' | 'gap';
+EMIT: 'EMIT' | 'emit';
+EVERY: 'EVERY' | 'every';
 MS: 'MS' | 'ms';
 SEC: 'SEC' | 'sec';
 MINUTE: 'MINUTE' | 'minute' | 'MINUTES' | 'minutes';
@@ -591,6 +639,8 @@ SOURCE : 'SOURCE';
 LOGICAL: 'LOGICAL';
 PHYSICAL: 'PHYSICAL';
 SINK : 'SINK';
+PREPARE: 'PREPARE';
+EXECUTE: 'EXECUTE';
 
 //Make sure that you add lexer rules for keywords before the identifier rule,
 //otherwise it will take priority and your grammars will not work
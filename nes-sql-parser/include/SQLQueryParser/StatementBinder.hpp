@@ -124,6 +124,22 @@ struct DropQueryStatement
     QueryId id;
 };
 
+/// Registers the query as a template under the name, which is parsed and optimized once. The PARAMETER functions of the query are its
+/// placeholders, c.f., QueryParameterLogicalFunction.
+struct PrepareQueryStatement
+{
+    std::string name;
+    LogicalPlan plan;
+};
+
+/// Submits an instance of the prepared query, whose parameters are set to the values by their name. Parameters without a value keep
+/// their default value.
+struct ExecuteQueryStatement
+{
+    std::string name;
+    std::unordered_map<std::string, std::string> parameters;
+};
+
 using Statement = std::variant<
     CreateLogicalSourceStatement,
     CreatePhysicalSourceStatement,
@@ -136,7 +152,9 @@ using Statement = std::variant<
     QueryStatement,
     ShowQueriesStatement,
     ShowSinksStatement,
-    DropQueryStatement>;
+    DropQueryStatement,
+    PrepareQueryStatement,
+    ExecuteQueryStatement>;
 
 inline std::optional<StatementOutputFormat> getOutputFormat(const Statement& statement)
 {
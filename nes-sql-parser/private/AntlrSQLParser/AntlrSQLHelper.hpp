@@ -15,6 +15,7 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <optional>
 #include <string>
@@ -22,8 +23,10 @@
 #include <vector>
 #include <Functions/FieldAccessLogicalFunction.hpp>
 #include <Functions/LogicalFunction.hpp>
+#include <Operators/PatternLogicalOperator.hpp>
 #include <Operators/Windows/Aggregations/WindowAggregationLogicalFunction.hpp>
 #include <Operators/Windows/JoinLogicalOperator.hpp>
+#include <Operators/Windows/WindowedAggregationLogicalOperator.hpp>
 #include <Plans/LogicalPlan.hpp>
 #include <Sinks/SinkDescriptor.hpp>
 #include <WindowTypes/Types/WindowType.hpp>
@@ -79,6 +82,25 @@ public:
     std::vector<LogicalFunction> joinKeyRelationHelper;
     std::vector<std::string> joinSourceRenames;
     JoinLogicalOperator::JoinType joinType = JoinLogicalOperator::JoinType::INNER_JOIN;
+    /// Name and options of the static table of a lookup join
+    std::optional<std::pair<std::string, ConfigMap>> lookupTable;
+    /// Set by `ORDER BY ... LIMIT ...`, which restricts the records per window of the window aggregation
+    std::optional<WindowedAggregationLogicalOperator::TopN> topN;
+    /// Set by `REORDER BY ... EVERY ...`, the timestamp field and the reorder interval in milliseconds of the event time sort
+    std::optional<std::pair<std::string, uint64_t>> eventTimeSort;
+    /// The predicates of the events of `PATTERN ... DEFINE ...` in the order of their definition
+    std::vector<LogicalFunction> patternEventPredicates;
+    /// Set by `PATTERN ... DEFINE ...`, c.f., LogicalPlanBuilder::addPattern
+    struct Pattern
+    {
+        std::vector<std::string> eventNames;
+        std::vector<LogicalFunction> eventPredicates;
+        std::vector<PatternLogicalOperator::Step> steps;
+        std::vector<FieldAccessLogicalFunction> partitionKeys;
+        std::string timestampFieldName;
+        uint64_t withinMs = 0;
+    };
+    std::optional<Pattern> pattern;
 
     /// Utility variables to keep state between enter/exit parser function calls.
     size_t opBoolean{}; ///anonymous token enum in AntlrSQLLexer.h
@@ -89,6 +111,7 @@ public:
     /// Utility variables used to keep track of the parsing state.
     int size{};
     int advanceBy{};
+    int gap{};
     size_t timeUnit{}; ///anonymous token enum in AntlrSQLLexer.h
     size_t timeUnitAdvanceBy{};
     std::optional<int> minimumCount;
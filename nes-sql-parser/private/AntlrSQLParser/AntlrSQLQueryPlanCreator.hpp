@@ -53,6 +53,7 @@ public:
     void exitHavingClause(AntlrSQLParser::HavingClauseContext* context) override;
     void enterJoinRelation(AntlrSQLParser::JoinRelationContext* context) override;
     void exitJoinRelation(AntlrSQLParser::JoinRelationContext* context) override;
+    void exitLookupTable(AntlrSQLParser::LookupTableContext* context) override;
     void enterWindowClause(AntlrSQLParser::WindowClauseContext* context) override;
     void exitWindowClause(AntlrSQLParser::WindowClauseContext* context) override;
     void enterGroupByClause(AntlrSQLParser::GroupByClauseContext* context) override;
@@ -71,9 +72,17 @@ public:
     void enterTimeUnit(AntlrSQLParser::TimeUnitContext* context) override;
     void exitSizeParameter(AntlrSQLParser::SizeParameterContext* context) override;
     void exitAdvancebyParameter(AntlrSQLParser::AdvancebyParameterContext* context) override;
+    void exitGapParameter(AntlrSQLParser::GapParameterContext* context) override;
     void exitTimestampParameter(AntlrSQLParser::TimestampParameterContext* context) override;
     void exitTumblingWindow(AntlrSQLParser::TumblingWindowContext* context) override;
     void exitSlidingWindow(AntlrSQLParser::SlidingWindowContext* context) override;
+    void exitSessionWindow(AntlrSQLParser::SessionWindowContext* context) override;
+    void exitEmitClause(AntlrSQLParser::EmitClauseContext* context) override;
+    void exitTopNClause(AntlrSQLParser::TopNClauseContext* context) override;
+    void exitReorderClause(AntlrSQLParser::ReorderClauseContext* context) override;
+    void exitPatternClause(AntlrSQLParser::PatternClauseContext* context) override;
+    void enterPatternEvent(AntlrSQLParser::PatternEventContext* context) override;
+    void exitPatternEvent(AntlrSQLParser::PatternEventContext* context) override;
     void exitNamedExpression(AntlrSQLParser::NamedExpressionContext* context) override;
     void exitArithmeticUnary(AntlrSQLParser::ArithmeticUnaryContext* context) override;
     void exitArithmeticBinary(AntlrSQLParser::ArithmeticBinaryContext* context) override;
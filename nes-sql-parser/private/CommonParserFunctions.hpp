@@ -36,8 +36,10 @@ ConfigMap bindConfigOptions(const std::vector<AntlrSQLParser::NamedConfigExpress
 std::unordered_map<std::string, std::string> getParserConfig(const ConfigMap& configOptions);
 std::unordered_map<std::string, std::string> getSourceConfig(const ConfigMap& configOptions);
 std::unordered_map<std::string, std::string> getSinkConfig(const ConfigMap& configOptions);
+std::unordered_map<std::string, std::string> getTableConfig(const ConfigMap& configOptions);
 std::optional<Schema> getSourceSchema(ConfigMap configOptions);
 std::optional<Schema> getSinkSchema(ConfigMap configOptions);
+std::optional<Schema> getTableSchema(ConfigMap configOptions);
 
 Literal bindLiteral(AntlrSQLParser::ConstantContext* literalAST);
 bool bindBooleanLiteral(AntlrSQLParser::BooleanLiteralContext* booleanLiteral);
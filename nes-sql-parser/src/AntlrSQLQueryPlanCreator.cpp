@@ -14,15 +14,18 @@
 
 #include <AntlrSQLParser/AntlrSQLQueryPlanCreator.hpp>
 
+#include <algorithm>
 #include <cctype>
 #include <cstddef>
 #include <cstdint>
+#include <iterator>
 #include <memory>
 #include <optional>
 #include <ranges>
 #include <string>
 #include <utility>
 #include <variant>
+#include <vector>
 
 #include <AntlrSQLBaseListener.h>
 #include <AntlrSQLLexer.h>
@@ -51,9 +54,17 @@
 #include <Functions/FieldAssignmentLogicalFunction.hpp>
 #include <Functions/LogicalFunction.hpp>
 #include <Functions/LogicalFunctionProvider.hpp>
+#include <Functions/QueryParameterLogicalFunction.hpp>
+#include <Operators/LookupJoinLogicalOperator.hpp>
+#include <Operators/PatternLogicalOperator.hpp>
+#include <Operators/Windows/Aggregations/ApproxCountDistinctAggregationLogicalFunction.hpp>
+#include <Operators/Windows/Aggregations/ApproxQuantileAggregationLogicalFunction.hpp>
+#include <Operators/Windows/Aggregations/ApproxTopKAggregationLogicalFunction.hpp>
 #include <Operators/Windows/Aggregations/ArrayAggregationLogicalFunction.hpp>
 #include <Operators/Windows/Aggregations/AvgAggregationLogicalFunction.hpp>
+#include <Operators/Windows/Aggregations/CorrAggregationLogicalFunction.hpp>
 #include <Operators/Windows/Aggregations/CountAggregationLogicalFunction.hpp>
+#include <Operators/Windows/Aggregations/CovarPopAggregationLogicalFunction.hpp>
 #include <Operators/Windows/Aggregations/MaxAggregationLogicalFunction.hpp>
 #include <Operators/Windows/Aggregations/MedianAggregationLogicalFunction.hpp>
 #include <Operators/Windows/Aggregations/Meos/VarAggregationLogicalFunction.hpp>
@@ -61,21 +72,30 @@
 #include <Operators/Windows/Aggregations/MinAggregationLogicalFunction.hpp>
 #include <Functions/Meos/TemporalEContainsGeometryLogicalFunction.hpp>
 #include <Functions/Meos/TemporalIntersectsFunction.hpp>
+#include <Operators/Windows/Aggregations/StddevPopAggregationLogicalFunction.hpp>
 #include <Operators/Windows/Aggregations/SumAggregationLogicalFunction.hpp>
+#include <Operators/Windows/Aggregations/VarPopAggregationLogicalFunction.hpp>
 #include <Operators/Windows/JoinLogicalOperator.hpp>
+#include <Operators/Windows/WindowedAggregationLogicalOperator.hpp>
 #include <Operators/Windows/Aggregations/Meos/VarAggregationLogicalFunction.hpp>
 #include <Operators/Windows/Aggregations/Meos/TemporalSequenceAggregationLogicalFunction.hpp>
 #include <Functions/Meos/TemporalIntersectsGeometryLogicalFunction.hpp>
 #include <Functions/Meos/TemporalAIntersectsGeometryLogicalFunction.hpp>
 #include <Functions/Meos/TemporalEDWithinGeometryLogicalFunction.hpp>
 #include <Functions/Meos/TemporalAtStBoxLogicalFunction.hpp>
+#include <Functions/Spatial/GeohashLogicalFunction.hpp>
+#include <Functions/Spatial/GeohashNeighborLogicalFunction.hpp>
+#include <Functions/Spatial/HaversineDistanceLogicalFunction.hpp>
+#include <Functions/Spatial/PointInBBoxLogicalFunction.hpp>
 #include <Plans/LogicalPlan.hpp>
 #include <Plans/LogicalPlanBuilder.hpp>
 #include <Util/Overloaded.hpp>
 #include <Util/Strings.hpp>
 #include <WindowTypes/Measures/TimeCharacteristic.hpp>
 #include <WindowTypes/Measures/TimeMeasure.hpp>
+#include <WindowTypes/Types/SessionWindow.hpp>
 #include <WindowTypes/Types/SlidingWindow.hpp>
+#include <WindowTypes/Types/TimeBasedWindowType.hpp>
 #include <WindowTypes/Types/TumblingWindow.hpp>
 #include <fmt/format.h>
 #include <fmt/ranges.h>
@@ -174,6 +194,39 @@ static LogicalFunction createLogicalBinaryFunction(LogicalFunction leftFunction,
     }
 }
 
+/// Collects the arguments of a function call in the order of the call. Numeric literals are still in the constant builder,
+/// whereas all other arguments are already in the function builder. We interpret numeric literals as FLOAT64.
+static std::vector<LogicalFunction> popFunctionArguments(AntlrSQLHelper& helper, AntlrSQLParser::FunctionCallContext* context)
+{
+    const auto arguments = context->expression();
+    const auto isNumericLiteral = [](const AntlrSQLParser::ExpressionContext* argument)
+    { return Util::from_chars<double>(argument->getText()).has_value(); };
+    const auto numberOfConstants = static_cast<size_t>(std::ranges::count_if(arguments, isNumericLiteral));
+    const auto numberOfFunctions = arguments.size() - numberOfConstants;
+    if (helper.constantBuilder.size() < numberOfConstants or helper.functionBuilder.size() < numberOfFunctions)
+    {
+        throw InvalidQuerySyntax("Could not resolve the arguments of {}", context->getText());
+    }
+
+    auto nextConstant = helper.constantBuilder.end() - static_cast<std::ptrdiff_t>(numberOfConstants);
+    auto nextFunction = helper.functionBuilder.end() - static_cast<std::ptrdiff_t>(numberOfFunctions);
+    std::vector<LogicalFunction> result;
+    for (const auto* argument : arguments)
+    {
+        if (isNumericLiteral(argument))
+        {
+            result.emplace_back(ConstantValueLogicalFunction(DataTypeProvider::provideDataType(DataType::Type::FLOAT64), *nextConstant++));
+        }
+        else
+        {
+            result.emplace_back(*nextFunction++);
+        }
+    }
+    helper.constantBuilder.resize(helper.constantBuilder.size() - numberOfConstants);
+    helper.functionBuilder.resize(helper.functionBuilder.size() - numberOfFunctions);
+    return result;
+}
+
 void AntlrSQLQueryPlanCreator::enterSelectClause(AntlrSQLParser::SelectClauseContext* context)
 {
     helpers.top().isSelect = true;
@@ -493,10 +546,40 @@ void AntlrSQLQueryPlanCreator::exitPrimaryQuery(AntlrSQLParser::PrimaryQueryCont
         queryPlan = LogicalPlanBuilder::addSelection(std::move(*whereExpr), queryPlan);
     }
 
+    if (const auto& eventTimeSort = helpers.top().eventTimeSort; eventTimeSort.has_value())
+    {
+        const auto& [timestampFieldName, reorderIntervalMs] = *eventTimeSort;
+        queryPlan = LogicalPlanBuilder::addEventTimeSort(queryPlan, FieldAccessLogicalFunction(timestampFieldName), reorderIntervalMs);
+    }
+
+    if (auto& pattern = helpers.top().pattern; pattern.has_value())
+    {
+        queryPlan = LogicalPlanBuilder::addPattern(
+            queryPlan,
+            std::move(pattern->eventNames),
+            std::move(pattern->eventPredicates),
+            std::move(pattern->steps),
+            std::move(pattern->partitionKeys),
+            FieldAccessLogicalFunction(pattern->timestampFieldName),
+            pattern->withinMs);
+    }
+
+    if (helpers.top().topN.has_value())
+    {
+        if (not helpers.top().isInAggFunction())
+        {
+            throw InvalidQuerySyntax("ORDER BY ... LIMIT is solely supported for window aggregations");
+        }
+        /// The top n restricts the records per window before the having clauses would select among them
+        if (not helpers.top().getHavingClauses().empty())
+        {
+            throw InvalidQuerySyntax("ORDER BY ... LIMIT cannot be combined with a HAVING clause");
+        }
+    }
     if (helpers.top().isInAggFunction())
     {
         queryPlan = LogicalPlanBuilder::addWindowAggregation(
-            queryPlan, helpers.top().windowType, helpers.top().windowAggs, helpers.top().groupByFields);
+            queryPlan, helpers.top().windowType, helpers.top().windowAggs, helpers.top().groupByFields, helpers.top().topN);
     }
 
     queryPlan = LogicalPlanBuilder::addProjection(helpers.top().getProjections(), helpers.top().asterisk, queryPlan);
@@ -575,6 +658,20 @@ void AntlrSQLQueryPlanCreator::exitAdvancebyParameter(AntlrSQLParser::AdvancebyP
     AntlrSQLBaseListener::exitAdvancebyParameter(context);
 }
 
+void AntlrSQLQueryPlanCreator::exitGapParameter(AntlrSQLParser::GapParameterContext* context)
+{
+    if (context->children.size() < 3)
+    {
+        throw InvalidQuerySyntax("GapParameter must have 'GAP', a number, and a time unit.");
+    }
+    helpers.top().gap = std::stoi(context->children.at(1)->getText());
+    if (helpers.top().gap <= 0)
+    {
+        throw InvalidQuerySyntax("The gap of a session window must be greater than 0, but is {}", helpers.top().gap);
+    }
+    AntlrSQLBaseListener::exitGapParameter(context);
+}
+
 void AntlrSQLQueryPlanCreator::exitTimestampParameter(AntlrSQLParser::TimestampParameterContext* context)
 {
     helpers.top().timestamp = bindIdentifier(context->name);
@@ -616,6 +713,188 @@ void AntlrSQLQueryPlanCreator::exitSlidingWindow(AntlrSQLParser::SlidingWindowCo
     AntlrSQLBaseListener::exitSlidingWindow(context);
 }
 
+void AntlrSQLQueryPlanCreator::exitSessionWindow(AntlrSQLParser::SessionWindowContext* context)
+{
+    const auto gap = buildTimeMeasure(helpers.top().gap, helpers.top().timeUnit);
+    /// We use the ingestion time if the query does not have a timestamp fieldname specified
+    if (helpers.top().timestamp.empty())
+    {
+        helpers.top().windowType = std::make_shared<Windowing::SessionWindow>(API::IngestionTime(), gap);
+    }
+    else
+    {
+        helpers.top().windowType = std::make_shared<Windowing::SessionWindow>(
+            Windowing::TimeCharacteristic::createEventTime(FieldAccessLogicalFunction(helpers.top().timestamp)), gap);
+    }
+    AntlrSQLBaseListener::exitSessionWindow(context);
+}
+
+void AntlrSQLQueryPlanCreator::exitEmitClause(AntlrSQLParser::EmitClauseContext* context)
+{
+    auto* const timeBasedWindow = dynamic_cast<Windowing::TimeBasedWindowType*>(helpers.top().windowType.get());
+    if (timeBasedWindow == nullptr)
+    {
+        throw InvalidQuerySyntax("Solely time-based windows can emit early results");
+    }
+    const auto interval = std::stoi(context->interval->getText());
+    if (interval <= 0)
+    {
+        throw InvalidQuerySyntax("The interval of early results must be greater than 0, but is {}", interval);
+    }
+    /// The time unit of the interval is the last time unit that we have entered
+    timeBasedWindow->setEarlyFiringInterval(buildTimeMeasure(interval, helpers.top().timeUnit));
+    AntlrSQLBaseListener::exitEmitClause(context);
+}
+
+void AntlrSQLQueryPlanCreator::exitTopNClause(AntlrSQLParser::TopNClauseContext* context)
+{
+    const auto limit = Util::from_chars<uint64_t>(context->limit->getText());
+    if (not limit.has_value() or *limit == 0)
+    {
+        throw InvalidQuerySyntax("The limit of ORDER BY ... LIMIT must be greater than 0, but is {}", context->limit->getText());
+    }
+    helpers.top().topN = WindowedAggregationLogicalOperator::TopN{
+        .orderFieldName = bindIdentifier(context->orderField),
+        .descending = context->ordering == nullptr or context->ordering->getType() == AntlrSQLLexer::DESC,
+        .limit = *limit};
+    AntlrSQLBaseListener::exitTopNClause(context);
+}
+
+void AntlrSQLQueryPlanCreator::exitReorderClause(AntlrSQLParser::ReorderClauseContext* context)
+{
+    const auto interval = Util::from_chars<uint64_t>(context->interval->getText());
+    if (not interval.has_value() or *interval == 0)
+    {
+        throw InvalidQuerySyntax("The interval of REORDER BY ... EVERY must be greater than 0, but is {}", context->interval->getText());
+    }
+    /// The time unit of the interval is the last time unit that we have entered
+    const auto reorderInterval = buildTimeMeasure(static_cast<int>(*interval), helpers.top().timeUnit);
+    helpers.top().eventTimeSort = std::make_pair(bindIdentifier(context->timestamp), reorderInterval.getTime());
+    AntlrSQLBaseListener::exitReorderClause(context);
+}
+
+void AntlrSQLQueryPlanCreator::enterPatternEvent(AntlrSQLParser::PatternEventContext* context)
+{
+    /// The predicate of an event is parsed like a where clause
+    helpers.top().isWhereOrHaving = true;
+    AntlrSQLBaseListener::enterPatternEvent(context);
+}
+
+void AntlrSQLQueryPlanCreator::exitPatternEvent(AntlrSQLParser::PatternEventContext* context)
+{
+    helpers.top().isWhereOrHaving = false;
+    if (helpers.top().functionBuilder.size() != 1)
+    {
+        throw InvalidQuerySyntax("The event {} of PATTERN must be defined by exactly one predicate", context->name->getText());
+    }
+    helpers.top().patternEventPredicates.push_back(helpers.top().functionBuilder.back());
+    helpers.top().functionBuilder.clear();
+    AntlrSQLBaseListener::exitPatternEvent(context);
+}
+
+void AntlrSQLQueryPlanCreator::exitPatternClause(AntlrSQLParser::PatternClauseContext* context)
+{
+    AntlrSQLHelper::Pattern pattern;
+    for (auto* const event : context->patternEvent())
+    {
+        auto eventName = bindIdentifier(event->name);
+        if (std::ranges::find(pattern.eventNames, eventName) != pattern.eventNames.end())
+        {
+            throw InvalidQuerySyntax("The event {} of PATTERN is defined more than once", eventName);
+        }
+        pattern.eventNames.push_back(std::move(eventName));
+    }
+    if (pattern.eventNames.size() > PatternLogicalOperator::MAX_NUMBER_OF_EVENTS)
+    {
+        throw InvalidQuerySyntax(
+            "PATTERN supports at most {} events, but defines {}", PatternLogicalOperator::MAX_NUMBER_OF_EVENTS, pattern.eventNames.size());
+    }
+    pattern.eventPredicates = std::move(helpers.top().patternEventPredicates);
+    helpers.top().patternEventPredicates.clear();
+    INVARIANT(pattern.eventPredicates.size() == pattern.eventNames.size(), "Every event of PATTERN must have exactly one predicate");
+
+    const auto indexOfEvent = [&pattern](AntlrSQLParser::IdentifierContext* eventContext)
+    {
+        const auto eventName = bindIdentifier(eventContext);
+        const auto event = std::ranges::find(pattern.eventNames, eventName);
+        if (event == pattern.eventNames.end())
+        {
+            throw InvalidQuerySyntax("The event {} of PATTERN is not defined", eventName);
+        }
+        return static_cast<uint64_t>(std::distance(pattern.eventNames.begin(), event));
+    };
+    for (auto* const stepContext : context->patternStep())
+    {
+        PatternLogicalOperator::Step step;
+        if (auto* const eventStep = dynamic_cast<AntlrSQLParser::EventPatternStepContext*>(stepContext))
+        {
+            step.type = PatternLogicalOperator::Step::Type::EVENT;
+            step.events.push_back(indexOfEvent(eventStep->event));
+            if (eventStep->iteration != nullptr)
+            {
+                step.type = PatternLogicalOperator::Step::Type::ITERATION;
+                step.maximumRepetitions = std::nullopt;
+            }
+            else if (eventStep->minimum != nullptr)
+            {
+                step.type = PatternLogicalOperator::Step::Type::ITERATION;
+                const auto minimum = Util::from_chars<uint64_t>(eventStep->minimum->getText());
+                if (not minimum.has_value() or *minimum == 0)
+                {
+                    throw InvalidQuerySyntax(
+                        "The minimum repetitions of {} must be greater than 0, but is {}",
+                        eventStep->getText(),
+                        eventStep->minimum->getText());
+                }
+                step.minimumRepetitions = *minimum;
+                step.maximumRepetitions = std::nullopt;
+                if (eventStep->maximum != nullptr)
+                {
+                    const auto maximum = Util::from_chars<uint64_t>(eventStep->maximum->getText());
+                    if (not maximum.has_value() or *maximum < *minimum)
+                    {
+                        throw InvalidQuerySyntax(
+                            "The maximum repetitions of {} must not be less than its minimum, but is {}",
+                            eventStep->getText(),
+                            eventStep->maximum->getText());
+                    }
+                    step.maximumRepetitions = *maximum;
+                }
+            }
+        }
+        else if (auto* const compositeStep = dynamic_cast<AntlrSQLParser::CompositePatternStepContext*>(stepContext))
+        {
+            step.type = compositeStep->op->getType() == AntlrSQLLexer::AND ? PatternLogicalOperator::Step::Type::AND
+                                                                            : PatternLogicalOperator::Step::Type::OR;
+            for (auto* const event : compositeStep->events)
+            {
+                step.events.push_back(indexOfEvent(event));
+            }
+        }
+        else
+        {
+            throw InvalidQuerySyntax("Unknown step of PATTERN: {}", stepContext->getText());
+        }
+        pattern.steps.push_back(std::move(step));
+    }
+
+    for (auto* const partitionKey : context->partitionKeys)
+    {
+        pattern.partitionKeys.emplace_back(bindIdentifier(partitionKey));
+    }
+    pattern.timestampFieldName = bindIdentifier(context->timestamp);
+
+    const auto within = Util::from_chars<uint64_t>(context->interval->getText());
+    if (not within.has_value() or *within == 0)
+    {
+        throw InvalidQuerySyntax("The interval of PATTERN ... WITHIN must be greater than 0, but is {}", context->interval->getText());
+    }
+    /// The time unit of the interval is the last time unit that we have entered
+    pattern.withinMs = buildTimeMeasure(static_cast<int>(*within), helpers.top().timeUnit).getTime();
+    helpers.top().pattern = std::move(pattern);
+    AntlrSQLBaseListener::exitPatternClause(context);
+}
+
 void AntlrSQLQueryPlanCreator::exitNamedExpression(AntlrSQLParser::NamedExpressionContext* context)
 {
     AntlrSQLHelper& helper = helpers.top();
@@ -742,9 +1021,92 @@ void AntlrSQLQueryPlanCreator::exitJoinType(AntlrSQLParser::JoinTypeContext* con
     AntlrSQLBaseListener::exitJoinType(context);
 }
 
+void AntlrSQLQueryPlanCreator::exitLookupTable(AntlrSQLParser::LookupTableContext* context)
+{
+    INVARIANT(helpers.top().isJoinRelation, "Lookup table must be inside a join relation.");
+    const auto configOptions = context->parameters->namedConfigExpression();
+    helpers.top().lookupTable = std::make_pair(bindIdentifier(context->name), bindConfigOptions(configOptions));
+
+    /// The options are bound from the context, thus, their constants must not be used as constants of the query
+    const auto numberOfConstants = std::ranges::count_if(configOptions, [](auto* configOption) { return configOption->constant() != nullptr; });
+    helpers.top().constantBuilder.resize(helpers.top().constantBuilder.size() - static_cast<size_t>(numberOfConstants));
+    AntlrSQLBaseListener::exitLookupTable(context);
+}
+
 void AntlrSQLQueryPlanCreator::exitJoinRelation(AntlrSQLParser::JoinRelationContext* context)
 {
     helpers.top().isJoinRelation = false;
+    if (helpers.top().lookupTable.has_value())
+    {
+        const auto [tableName, configOptions] = std::move(helpers.top().lookupTable.value());
+        helpers.top().lookupTable.reset();
+        if (helpers.top().queryPlans.size() != 1 or helpers.top().joinKeyRelationHelper.size() != 1)
+        {
+            throw InvalidQuerySyntax("Lookup join requires one subquery and a join function at {}", context->getText());
+        }
+
+        const auto tableConfig = getTableConfig(configOptions);
+        const auto filePath = tableConfig.find("file_path");
+        const auto url = tableConfig.find("url");
+        const auto schema = getTableSchema(configOptions);
+        if ((filePath == tableConfig.end()) == (url == tableConfig.end()) or not schema.has_value())
+        {
+            throw InvalidConfigParameter("Lookup table {} requires either a file path or a url and a schema definition", tableName);
+        }
+        const auto parseOption = [&](const std::string& option, const uint64_t defaultValue)
+        {
+            const auto value = tableConfig.find(option);
+            if (value == tableConfig.end())
+            {
+                return defaultValue;
+            }
+            const auto parsedValue = Util::from_chars<uint64_t>(value->second);
+            if (not parsedValue.has_value())
+            {
+                throw InvalidConfigParameter("Invalid {} of lookup table {}: {}", option, tableName, value->second);
+            }
+            return parsedValue.value();
+        };
+        const auto reloadIntervalMs = parseOption("reload_interval_ms", 0);
+
+        /// Qualifying the fields of the table by its name, like the fields of a source
+        Schema tableSchema{schema->memoryLayoutType};
+        for (const auto& field : *schema)
+        {
+            tableSchema.addField(tableName + Schema::ATTRIBUTE_NAME_SEPARATOR + field.name, field.dataType);
+        }
+
+        if (url != tableConfig.end())
+        {
+            if (not url->second.starts_with("http://") or not url->second.contains("{}"))
+            {
+                throw InvalidConfigParameter("The url of lookup table {} must start with http:// and contain {{}} for the key", tableName);
+            }
+            const LookupJoinLogicalOperator::ExternalTable externalTable{
+                .url = url->second,
+                .cacheSize = parseOption("cache_size", LookupJoinLogicalOperator::DEFAULT_CACHE_SIZE),
+                .maxInFlight = parseOption("max_in_flight", LookupJoinLogicalOperator::DEFAULT_MAX_IN_FLIGHT)};
+            if (externalTable.cacheSize == 0 or externalTable.maxInFlight == 0)
+            {
+                throw InvalidConfigParameter(
+                    "The cache size and the maximum in flight requests of lookup table {} must be positive", tableName);
+            }
+            helpers.top().queryPlans.front() = LogicalPlanBuilder::addLookupJoin(
+                helpers.top().queryPlans.front(), externalTable, std::move(tableSchema), helpers.top().joinKeyRelationHelper.at(0));
+            AntlrSQLBaseListener::exitJoinRelation(context);
+            return;
+        }
+
+        helpers.top().queryPlans.front() = LogicalPlanBuilder::addLookupJoin(
+            helpers.top().queryPlans.front(),
+            filePath->second,
+            std::move(tableSchema),
+            helpers.top().joinKeyRelationHelper.at(0),
+            reloadIntervalMs);
+        AntlrSQLBaseListener::exitJoinRelation(context);
+        return;
+    }
+
     if (helpers.top().joinSources.size() == helpers.top().joinSourceRenames.size() + 1)
     {
         helpers.top().joinSourceRenames.emplace_back("");
@@ -836,6 +1198,25 @@ void AntlrSQLQueryPlanCreator::exitConstantDefault(AntlrSQLParser::ConstantDefau
     }
 }
 
+namespace
+{
+/// Consumes the constant tolerance in meters of `TEMPORAL_SEQUENCE(lon, lat, ts, tolerance)`, if there is one
+std::optional<double> parseTemporalSequenceTolerance(AntlrSQLHelper& helper, AntlrSQLParser::FunctionCallContext* context)
+{
+    if (helper.constantBuilder.empty())
+    {
+        return std::nullopt;
+    }
+    const auto tolerance = Util::from_chars<double>(helper.constantBuilder.back());
+    if (not tolerance.has_value() or *tolerance < 0)
+    {
+        throw InvalidQuerySyntax("The tolerance of TEMPORAL_SEQUENCE must be a non-negative number of meters at {}", context->getText());
+    }
+    helper.constantBuilder.pop_back();
+    return tolerance;
+}
+}
+
 void AntlrSQLQueryPlanCreator::exitFunctionCall(AntlrSQLParser::FunctionCallContext* context)
 {
     const auto funcName = Util::toUpperCase(context->children[0]->getText());
@@ -923,10 +1304,13 @@ void AntlrSQLQueryPlanCreator::exitFunctionCall(AntlrSQLParser::FunctionCallCont
                     throw InvalidQuerySyntax("TEMPORAL_SEQUENCE arguments must be field references");
                 }
                 
+                /// The optional fourth argument is the tolerance in meters of the trajectory simplification
+                const auto toleranceInMeters = parseTemporalSequenceTolerance(helpers.top(), context);
                 helpers.top().windowAggs.push_back(
                     TemporalSequenceAggregationLogicalFunctionV2::create(longitudeFunction.get<FieldAccessLogicalFunction>(),
                                                                         latitudeFunction.get<FieldAccessLogicalFunction>(),
-                                                                        timestampFunction.get<FieldAccessLogicalFunction>()));
+                                                                        timestampFunction.get<FieldAccessLogicalFunction>(),
+                                                                        toleranceInMeters));
                 // Push back one field access function to satisfy parser expectations
                 // This prevents the functionBuilder from being empty when processing the identifier
                 helpers.top().functionBuilder.push_back(longitudeFunction);
@@ -1082,9 +1466,9 @@ void AntlrSQLQueryPlanCreator::exitFunctionCall(AntlrSQLParser::FunctionCallCont
         case AntlrSQLLexer::EDWITHIN_TGEO_GEO:
         {
             const auto argCount = context->expression().size();
-            if (argCount != 5)
+            if (argCount != 5 && argCount != 6)
             {
-                throw InvalidQuerySyntax("EDWITHIN_TGEO_GEO requires exactly five arguments (lon, lat, timestamp, geometry, distance), but got {}", argCount);
+                throw InvalidQuerySyntax("EDWITHIN_TGEO_GEO requires either 5 arguments (lon, lat, timestamp, geometry, distance) or 6 arguments (lon1, lat1, timestamp1, lon2, lat2, distance), but got {}", argCount);
             }
 
             // Move pending constants into the function builder (WKT last)
@@ -1116,6 +1500,22 @@ void AntlrSQLQueryPlanCreator::exitFunctionCall(AntlrSQLParser::FunctionCallCont
             }
 
             const auto total = helpers.top().functionBuilder.size();
+            if (argCount == 6)
+            {
+                PRECONDITION(total >= 6, "EDWITHIN_TGEO_GEO requires (lon1, lat1, timestamp1, lon2, lat2, distance), but got {}", total);
+
+                // Order after move: [lon1, lat1, ts1, lon2, lat2, distance]
+                auto distanceFunction = helpers.top().functionBuilder.back(); helpers.top().functionBuilder.pop_back();
+                auto lat2Function = helpers.top().functionBuilder.back(); helpers.top().functionBuilder.pop_back();
+                auto lon2Function = helpers.top().functionBuilder.back(); helpers.top().functionBuilder.pop_back();
+                auto timestampFunction = helpers.top().functionBuilder.back(); helpers.top().functionBuilder.pop_back();
+                auto latFunction = helpers.top().functionBuilder.back(); helpers.top().functionBuilder.pop_back();
+                auto lonFunction = helpers.top().functionBuilder.back(); helpers.top().functionBuilder.pop_back();
+
+                helpers.top().functionBuilder.emplace_back(TemporalEDWithinGeometryLogicalFunction(
+                    lonFunction, latFunction, timestampFunction, lon2Function, lat2Function, distanceFunction));
+                break;
+            }
             PRECONDITION(total >= 5, "EDWITHIN_TGEO_GEO requires (lon, lat, timestamp, geometry, distance), but got {}", total);
 
             // Order after move: [lon, lat, ts, distance, geometry]
@@ -1211,6 +1611,80 @@ void AntlrSQLQueryPlanCreator::exitFunctionCall(AntlrSQLParser::FunctionCallCont
                 const auto& lastArg = helpers.top().functionBuilder.back().get<FieldAccessLogicalFunction>();
                 helpers.top().windowAggs.push_back(std::make_shared<VarAggregationLogicalFunction>(lastArg));
             }
+            else if (funcName == "APPROX_QUANTILE")
+            {
+                if (helpers.top().functionBuilder.empty() or helpers.top().constantBuilder.empty())
+                {
+                    throw InvalidQuerySyntax("APPROX_QUANTILE requires a field and a constant quantile at {}", context->getText());
+                }
+                const auto quantile = Util::from_chars<double>(helpers.top().constantBuilder.back());
+                if (not quantile.has_value())
+                {
+                    throw InvalidQuerySyntax("The quantile of APPROX_QUANTILE must be a number at {}", context->getText());
+                }
+                helpers.top().constantBuilder.pop_back();
+                helpers.top().windowAggs.push_back(std::make_shared<ApproxQuantileAggregationLogicalFunction>(
+                    helpers.top().functionBuilder.back().get<FieldAccessLogicalFunction>(), quantile.value()));
+            }
+            else if (funcName == "VAR_POP" or funcName == "STDDEV_POP")
+            {
+                if (helpers.top().functionBuilder.empty())
+                {
+                    throw InvalidQuerySyntax("Aggregation requires argument at {}", context->getText());
+                }
+                const auto& lastArg = helpers.top().functionBuilder.back().get<FieldAccessLogicalFunction>();
+                if (funcName == "VAR_POP")
+                {
+                    helpers.top().windowAggs.push_back(std::make_shared<VarPopAggregationLogicalFunction>(lastArg));
+                }
+                else
+                {
+                    helpers.top().windowAggs.push_back(std::make_shared<StddevPopAggregationLogicalFunction>(lastArg));
+                }
+            }
+            else if (funcName == "COVAR_POP" or funcName == "CORR")
+            {
+                if (helpers.top().functionBuilder.size() < 2)
+                {
+                    throw InvalidQuerySyntax("{} requires two arguments at {}", funcName, context->getText());
+                }
+                /// Keeping the first field in the function builder, as for aggregations over a single field
+                const auto secondField = helpers.top().functionBuilder.back().get<FieldAccessLogicalFunction>();
+                helpers.top().functionBuilder.pop_back();
+                const auto& firstField = helpers.top().functionBuilder.back().get<FieldAccessLogicalFunction>();
+                if (funcName == "COVAR_POP")
+                {
+                    helpers.top().windowAggs.push_back(std::make_shared<CovarPopAggregationLogicalFunction>(firstField, secondField));
+                }
+                else
+                {
+                    helpers.top().windowAggs.push_back(std::make_shared<CorrAggregationLogicalFunction>(firstField, secondField));
+                }
+            }
+            else if (funcName == "APPROX_COUNT_DISTINCT")
+            {
+                if (helpers.top().functionBuilder.empty())
+                {
+                    throw InvalidQuerySyntax("Aggregation requires argument at {}", context->getText());
+                }
+                helpers.top().windowAggs.push_back(std::make_shared<ApproxCountDistinctAggregationLogicalFunction>(
+                    helpers.top().functionBuilder.back().get<FieldAccessLogicalFunction>()));
+            }
+            else if (funcName == "APPROX_TOP_K")
+            {
+                if (helpers.top().functionBuilder.empty() or helpers.top().constantBuilder.empty())
+                {
+                    throw InvalidQuerySyntax("APPROX_TOP_K requires a field and a constant k at {}", context->getText());
+                }
+                const auto k = Util::from_chars<uint64_t>(helpers.top().constantBuilder.back());
+                if (not k.has_value())
+                {
+                    throw InvalidQuerySyntax("The k of APPROX_TOP_K must be a positive integer at {}", context->getText());
+                }
+                helpers.top().constantBuilder.pop_back();
+                helpers.top().windowAggs.push_back(std::make_shared<ApproxTopKAggregationLogicalFunction>(
+                    helpers.top().functionBuilder.back().get<FieldAccessLogicalFunction>(), k.value()));
+            }
             else if (funcName == "TEMPORAL_SEQUENCE")
             {
                 if (helpers.top().functionBuilder.size() < 3)
@@ -1223,7 +1697,24 @@ void AntlrSQLQueryPlanCreator::exitFunctionCall(AntlrSQLParser::FunctionCallCont
                 helpers.top().functionBuilder.pop_back();
                 const auto lon = helpers.top().functionBuilder.back().get<FieldAccessLogicalFunction>();
                 helpers.top().functionBuilder.pop_back();
-                helpers.top().windowAggs.push_back(TemporalSequenceAggregationLogicalFunctionV2::create(lon, lat, ts));
+                const auto toleranceInMeters = parseTemporalSequenceTolerance(helpers.top(), context);
+                helpers.top().windowAggs.push_back(TemporalSequenceAggregationLogicalFunctionV2::create(lon, lat, ts, toleranceInMeters));
+            }
+            else if (funcName == "PARAMETER")
+            {
+                /// PARAMETER('name', INT32(10)) declares a query parameter with its type and its default value
+                if (helpers.top().constantBuilder.empty() or helpers.top().functionBuilder.empty()
+                    or not helpers.top().functionBuilder.back().tryGet<ConstantValueLogicalFunction>())
+                {
+                    throw InvalidQuerySyntax(
+                        "PARAMETER requires a name and a typed default value, e.g., PARAMETER('threshold', INT32(10)), at {}",
+                        context->getText());
+                }
+                auto parameterName = std::move(helpers.top().constantBuilder.back());
+                helpers.top().constantBuilder.pop_back();
+                const auto defaultValue = helpers.top().functionBuilder.back().get<ConstantValueLogicalFunction>();
+                helpers.top().functionBuilder.back()
+                    = QueryParameterLogicalFunction(std::move(parameterName), defaultValue.getDataType(), defaultValue.getConstantValue());
             }
             else if (auto logicalFunction = LogicalFunctionProvider::tryProvide(funcName, helpers.top().functionBuilder))
             {
@@ -1244,6 +1735,49 @@ void AntlrSQLQueryPlanCreator::exitFunctionCall(AntlrSQLParser::FunctionCallCont
                 helpers.top().functionBuilder.pop_back();
                 helpers.top().functionBuilder.emplace_back(TemporalIntersectsFunction(lon, lat, ts));
             }
+            else if (funcName == "HAVERSINE_DISTANCE")
+            {
+                const auto arguments = popFunctionArguments(helpers.top(), context);
+                if (arguments.size() != 4)
+                {
+                    throw InvalidQuerySyntax(
+                        "HAVERSINE_DISTANCE requires exactly four arguments (lon1, lat1, lon2, lat2), but got {}", arguments.size());
+                }
+                helpers.top().functionBuilder.emplace_back(HaversineDistanceLogicalFunction(arguments[0], arguments[1], arguments[2], arguments[3]));
+            }
+            else if (funcName == "GEOHASH")
+            {
+                const auto arguments = popFunctionArguments(helpers.top(), context);
+                if (arguments.size() != 3)
+                {
+                    throw InvalidQuerySyntax(
+                        "GEOHASH requires exactly three arguments (lon, lat, precision), but got {}", arguments.size());
+                }
+                helpers.top().functionBuilder.emplace_back(GeohashLogicalFunction(arguments[0], arguments[1], arguments[2]));
+            }
+            else if (funcName == "GEOHASH_NEIGHBOR")
+            {
+                const auto arguments = popFunctionArguments(helpers.top(), context);
+                if (arguments.size() != 4)
+                {
+                    throw InvalidQuerySyntax(
+                        "GEOHASH_NEIGHBOR requires exactly four arguments (cell, precision, lonOffset, latOffset), but got {}",
+                        arguments.size());
+                }
+                helpers.top().functionBuilder.emplace_back(
+                    GeohashNeighborLogicalFunction(arguments[0], arguments[1], arguments[2], arguments[3]));
+            }
+            else if (funcName == "POINT_IN_BBOX")
+            {
+                const auto arguments = popFunctionArguments(helpers.top(), context);
+                if (arguments.size() != 6)
+                {
+                    throw InvalidQuerySyntax(
+                        "POINT_IN_BBOX requires exactly six arguments (lon, lat, xmin, ymin, xmax, ymax), but got {}", arguments.size());
+                }
+                helpers.top().functionBuilder.emplace_back(
+                    PointInBBoxLogicalFunction(arguments[0], arguments[1], arguments[2], arguments[3], arguments[4], arguments[5]));
+            }
             else
             {
                 throw InvalidQuerySyntax("Unknown (aggregation) function: {}, resolved to token type: {}", funcName, tokenType);
@@ -141,6 +141,21 @@ std::unordered_map<std::string, std::string> getSinkConfig(const ConfigMap& conf
     return sinkOptions;
 }
 
+std::unordered_map<std::string, std::string> getTableConfig(const ConfigMap& configOptions)
+{
+    std::unordered_map<std::string, std::string> tableOptions{};
+    if (const auto tableConfigIter = configOptions.find("TABLE"); tableConfigIter != configOptions.end())
+    {
+        tableOptions
+            = tableConfigIter->second | std::views::filter([](auto& pair) { return std::holds_alternative<Literal>(pair.second); })
+            | std::views::transform(
+                  [](auto& pair) { return std::make_pair(Util::toLowerCase(pair.first), literalToString(std::get<Literal>(pair.second))); })
+            | std::ranges::to<std::unordered_map<std::string, std::string>>();
+    }
+
+    return tableOptions;
+}
+
 namespace
 {
 std::optional<Schema> getSchema(ConfigMap configOptions, const std::string& configName)
@@ -169,6 +184,11 @@ std::optional<Schema> getSinkSchema(ConfigMap configOptions)
     return getSchema(std::move(configOptions), "SINK");
 }
 
+std::optional<Schema> getTableSchema(ConfigMap configOptions)
+{
+    return getSchema(std::move(configOptions), "TABLE");
+}
+
 std::string bindStringLiteral(AntlrSQLParser::StringLiteralContext* stringLiteral)
 {
     PRECONDITION(stringLiteral->getText().size() > 1, "String literal must have at least two characters for quotation marks");
@@ -343,6 +343,29 @@ public:
         throw InvalidStatement("Unrecognized DROP statement");
     }
 
+    PrepareQueryStatement bindPrepareStatement(AntlrSQLParser::PrepareStatementContext* prepareAst) const
+    {
+        return PrepareQueryStatement{.name = bindIdentifier(prepareAst->name), .plan = queryBinder(prepareAst->query())};
+    }
+
+    ExecuteQueryStatement bindExecuteStatement(AntlrSQLParser::ExecuteStatementContext* executeAst) const
+    {
+        std::unordered_map<std::string, std::string> parameters;
+        for (auto* const binding : executeAst->bindings)
+        {
+            const auto parameterName = bindLiteral(binding->parameterName);
+            if (not std::holds_alternative<std::string>(parameterName))
+            {
+                throw InvalidQuerySyntax("The name of a parameter must be a string, but was {}", binding->parameterName->getText());
+            }
+            if (not parameters.try_emplace(std::get<std::string>(parameterName), literalToString(bindLiteral(binding->value))).second)
+            {
+                throw InvalidQuerySyntax("The parameter {} is bound twice", std::get<std::string>(parameterName));
+            }
+        }
+        return ExecuteQueryStatement{.name = bindIdentifier(executeAst->name), .parameters = std::move(parameters)};
+    }
+
     std::expected<Statement, Exception> bind(AntlrSQLParser::StatementContext* statementAST) const
     {
         if (statementAST->query() != nullptr)
@@ -363,6 +386,14 @@ public:
             {
                 return bindDropStatement(dropAst);
             }
+            if (auto* prepareAst = statementAST->prepareStatement(); prepareAst != nullptr)
+            {
+                return bindPrepareStatement(prepareAst);
+            }
+            if (auto* executeAst = statementAST->executeStatement(); executeAst != nullptr)
+            {
+                return bindExecuteStatement(executeAst);
+            }
             if (auto* const queryAst = statementAST->query(); queryAst != nullptr)
             {
                 return queryBinder(queryAst);
@@ -311,6 +311,32 @@ TEST_F(StatementBinderTest, BindDropQuery)
     ASSERT_EQ(statement2.error().code(), ErrorCode::InvalidQuerySyntax);
 }
 
+TEST_F(StatementBinderTest, BindPrepareAndExecuteQuery)
+{
+    const std::string prepareString
+        = "PREPARE alerts AS SELECT a FROM inputStream WHERE b < PARAMETER('threshold', UINT32(5)) INTO outputStream";
+    const auto prepareStatement = binder->parseAndBindSingle(prepareString);
+    ASSERT_TRUE(prepareStatement.has_value());
+    ASSERT_TRUE(std::holds_alternative<PrepareQueryStatement>(*prepareStatement));
+    ASSERT_EQ(std::get<PrepareQueryStatement>(*prepareStatement).name, "ALERTS");
+
+    const std::string executeString = "EXECUTE alerts USING ('threshold' = 10, 'device' = 'train')";
+    const auto executeStatement = binder->parseAndBindSingle(executeString);
+    ASSERT_TRUE(executeStatement.has_value());
+    ASSERT_TRUE(std::holds_alternative<ExecuteQueryStatement>(*executeStatement));
+    const auto& [name, parameters] = std::get<ExecuteQueryStatement>(*executeStatement);
+    ASSERT_EQ(name, "ALERTS");
+    const std::unordered_map<std::string, std::string> expectedParameters{{"threshold", "10"}, {"device", "train"}};
+    ASSERT_EQ(parameters, expectedParameters);
+
+    const auto executeWithoutParameters = binder->parseAndBindSingle("EXECUTE alerts");
+    ASSERT_TRUE(executeWithoutParameters.has_value());
+    ASSERT_TRUE(std::get<ExecuteQueryStatement>(*executeWithoutParameters).parameters.empty());
+
+    ASSERT_FALSE(binder->parseAndBindSingle("EXECUTE alerts USING ('threshold' = 10, 'threshold' = 11)").has_value());
+    ASSERT_FALSE(binder->parseAndBindSingle("EXECUTE alerts USING (10 = 10)").has_value());
+}
+
 TEST_F(StatementBinderTest, ShowLogicalSources)
 {
     const std::vector<std::string_view> createLogicalSources{
@@ -17,17 +17,46 @@
 #include <algorithm>
 #include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <numeric>
 #include <ostream>
 #include <string_view>
 
 void Checksum::add(std::string_view data)
 {
-    const auto localNumberOfTuples = std::ranges::count(data, '\n');
-    const auto localChecksum = std::accumulate(data.cbegin(), data.cend(), static_cast<size_t>(0));
+    add(static_cast<size_t>(std::ranges::count(data, '\n')), characterSum(data));
+}
+
+void Checksum::add(const size_t addedTuples, const size_t addedChecksum)
+{
+    checksum.fetch_add(addedChecksum, std::memory_order::relaxed);
+    numberOfTuples.fetch_add(addedTuples, std::memory_order::relaxed);
+}
 
-    checksum.fetch_add(localChecksum, std::memory_order::relaxed);
-    numberOfTuples.fetch_add(localNumberOfTuples, std::memory_order::relaxed);
+size_t Checksum::characterSum(const std::string_view data)
+{
+    return std::accumulate(data.cbegin(), data.cend(), static_cast<size_t>(0));
+}
+
+size_t Checksum::decimalCharacterSum(uint64_t value)
+{
+    size_t sum = 0;
+    do
+    {
+        sum += '0' + (value % 10);
+        value /= 10;
+    } while (value != 0);
+    return sum;
+}
+
+size_t Checksum::decimalCharacterSum(const int64_t value)
+{
+    if (value >= 0)
+    {
+        return decimalCharacterSum(static_cast<uint64_t>(value));
+    }
+    /// Negating in the unsigned domain also covers the smallest int64_t
+    return '-' + decimalCharacterSum(-static_cast<uint64_t>(value));
 }
 
 std::ostream& operator<<(std::ostream& os, const Checksum& obj)
@@ -16,12 +16,22 @@
 #pragma once
 #include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <ostream>
 #include <string_view>
 
 struct Checksum
 {
     void add(std::string_view data);
+    /// Adds tuples whose checksum was accumulated without formatting them as text, e.g., by the ChecksumSink
+    void add(size_t addedTuples, size_t addedChecksum);
+
+    /// Sum of the characters of the data, as accumulated by add(std::string_view)
+    static size_t characterSum(std::string_view data);
+    /// Equals characterSum(std::to_string(value)) without formatting the value
+    static size_t decimalCharacterSum(uint64_t value);
+    static size_t decimalCharacterSum(int64_t value);
+
     bool operator==(const Checksum&) const = default;
 
     friend std::ostream& operator<<(std::ostream& os, const Checksum& obj);
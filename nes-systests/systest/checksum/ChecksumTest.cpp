@@ -16,6 +16,9 @@
 
 #include <barrier>
 #include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
 #include <thread>
 #include <vector>
 #include <gtest/gtest.h>
@@ -95,6 +98,29 @@ TEST(ChecksumTest, EqualCheck)
     EXPECT_NE(checksum1, checksum3);
 }
 
+TEST(ChecksumTest, NativeValuesMatchTheirTextualRepresentation)
+{
+    for (const int64_t value :
+         {int64_t{0}, int64_t{7}, int64_t{-1}, int64_t{-120}, int64_t{1234567890}, std::numeric_limits<int64_t>::min()})
+    {
+        EXPECT_EQ(Checksum::decimalCharacterSum(value), Checksum::characterSum(std::to_string(value))) << value;
+    }
+    for (const uint64_t value : {uint64_t{0}, uint64_t{10}, uint64_t{255}, std::numeric_limits<uint64_t>::max()})
+    {
+        EXPECT_EQ(Checksum::decimalCharacterSum(value), Checksum::characterSum(std::to_string(value))) << value;
+    }
+
+    /// A tuple accumulated from its native fields equals the tuple added as text
+    Checksum text;
+    text.add("-12,1,\"a\"\n");
+    Checksum native;
+    native.add(
+        1,
+        Checksum::decimalCharacterSum(int64_t{-12}) + Checksum::decimalCharacterSum(uint64_t{1}) + Checksum::characterSum("\"a\"")
+            + Checksum::characterSum(",,\n"));
+    EXPECT_EQ(text, native);
+}
+
 TEST(ChecksumTest, MultiThreaded)
 {
     constexpr size_t numberOfThreads = 8;
@@ -0,0 +1,101 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
+#include <Runtime/MemoryAccount.hpp>
+#include <nlohmann/json.hpp>
+#include <QueryEngine.hpp>
+
+namespace NES::Systest
+{
+
+/// Tracks the buffers of a query over time by their owner and reports the peaks once the query stopped, c.f., `--memory-profile`.
+/// The buffer pool is shared by all queries, while the sources hold the buffers of their own pools and the pipelines hold the buffers which
+/// they allocated, e.g., the state of their operator handlers or the buffers that they emit, until the buffers are recycled.
+/// The peak of the pooled buffers in use sizes `numberOfBuffersInGlobalBufferManager`.
+class MemoryProfile
+{
+public:
+    /// The pipelines without predecessor pipelines format the raw buffers of the sources and the pipelines without successors are the sinks
+    enum class Owner : uint8_t
+    {
+        SOURCE,
+        FORMATTER,
+        OPERATOR,
+        SINK
+    };
+    static constexpr size_t NUMBER_OF_OWNERS = 4;
+
+    struct Sample
+    {
+        /// Since the first sample
+        std::chrono::milliseconds time{0};
+        size_t numberOfPooledBuffersInUse = 0;
+        size_t numberOfUnpooledBuffers = 0;
+        uint64_t queryBytes = 0;
+        /// State of the operator handlers of all pipelines of the query, e.g., the slices of the windows
+        uint64_t stateSizeInBytes = 0;
+        /// Indexed by Owner. The sources solely report their inflight buffers, which are pooled buffers of unknown size.
+        std::array<MemoryAccount::Usage, NUMBER_OF_OWNERS> owners{};
+    };
+
+    /// The timeline keeps at most this number of samples by dropping every other sample, once it is full
+    static constexpr size_t MAX_NUMBER_OF_SAMPLES = 1024;
+
+    /// Adds a sample of the metrics of the query. Pipelines and sources that stopped since the previous sample keep their last metrics.
+    void update(
+        std::chrono::steady_clock::time_point now,
+        QueryId queryId,
+        const EngineMetrics& engine,
+        const std::optional<QueryMemoryMetrics>& queryMemory,
+        const std::vector<PipelineMetrics>& pipelines);
+
+    [[nodiscard]] bool empty() const { return timeline.empty(); }
+    [[nodiscard]] const std::vector<Sample>& getTimeline() const { return timeline; }
+    [[nodiscard]] Owner ownerOf(PipelineId pipelineId) const;
+
+    /// The peaks of the buffer pool, the query, the sources, and the pipelines
+    [[nodiscard]] std::string render() const;
+    /// The timeline and the peaks
+    [[nodiscard]] nlohmann::json toJson() const;
+
+    [[nodiscard]] static std::string_view nameOf(Owner owner);
+
+private:
+    std::optional<std::chrono::steady_clock::time_point> start;
+    std::vector<Sample> timeline;
+    /// Solely every `sampleStride`-th update is added to the timeline, while all updates count towards the peaks
+    size_t sampleStride = 1;
+    size_t numberOfUpdates = 0;
+
+    size_t numberOfPooledBuffers = 0;
+    size_t peakNumberOfPooledBuffersInUse = 0;
+    size_t peakNumberOfUnpooledBuffers = 0;
+    uint64_t peakQueryBytes = 0;
+    std::map<OriginId, EngineMetrics::SourceMetrics> sources;
+    std::map<PipelineId, PipelineMetrics> pipelines;
+};
+
+}
@@ -0,0 +1,69 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
+#include <Util/PlanRenderer.hpp>
+#include <nlohmann/json.hpp>
+#include <QueryEngine.hpp>
+
+namespace NES::Systest
+{
+
+/// Breaks down the costs of a query by its pipelines and their operators, like EXPLAIN ANALYZE, c.f., `--explain-analyze`.
+/// The QueryEngine solely reports the metrics of running pipelines, thus the report keeps the last metrics of every pipeline that a sample
+/// contained. The rendered plan starts at the pipelines without successors, e.g., the sinks, and the children of a pipeline are the
+/// pipelines that emit into it.
+class PipelineReport
+{
+public:
+    /// A pipeline of the rendered plan, c.f., PlanRenderer
+    class Node
+    {
+    public:
+        Node(const PipelineReport& report, PipelineId pipelineId) : report(&report), pipelineId(pipelineId) { }
+
+        /// The tasks, tuples, cpu time, state, and emitted buffers of the pipeline, followed by the share of the cycles of each of its
+        /// operators. The debug verbosity adds the cycles and invocations of the operators.
+        [[nodiscard]] std::string explain(ExplainVerbosity verbosity) const;
+        [[nodiscard]] PipelineId getId() const { return pipelineId; }
+        [[nodiscard]] std::vector<Node> getChildren() const;
+
+    private:
+        const PipelineReport* report;
+        PipelineId pipelineId;
+    };
+
+    /// Replaces the metrics of the sampled pipelines. Pipelines that stopped since the previous sample keep their last metrics.
+    void update(const std::vector<PipelineMetrics>& pipelines);
+
+    [[nodiscard]] bool empty() const { return pipelines.empty(); }
+    [[nodiscard]] std::vector<Node> getRootOperators() const;
+
+    [[nodiscard]] std::string render(ExplainVerbosity verbosity = ExplainVerbosity::Short) const;
+    [[nodiscard]] nlohmann::json toJson() const;
+
+    /// Formats the bytes in binary units, e.g., 1.5 KiB instead of 1536 B
+    [[nodiscard]] static std::string formatBytes(uint64_t bytes);
+
+private:
+    std::map<PipelineId, PipelineMetrics> pipelines;
+};
+
+}
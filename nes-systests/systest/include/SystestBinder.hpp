@@ -15,6 +15,7 @@
 #pragma once
 #include <cstddef>
 #include <filesystem>
+#include <optional>
 #include <utility>
 #include <vector>
 
@@ -32,6 +33,12 @@ public:
     /// In the future we might need to inject a factory for the LegacyOptimizer when it requires more setup than the catalogs
     explicit SystestBinder(
         const std::filesystem::path& workingDir, const std::filesystem::path& testDataDir, const std::filesystem::path& configDir);
+    /// Replays the test data of all file sources at the given rate of tuples per second and source, c.f., the Replay source
+    SystestBinder(
+        const std::filesystem::path& workingDir,
+        const std::filesystem::path& testDataDir,
+        const std::filesystem::path& configDir,
+        std::optional<double> replayTuplesPerSecond);
 
     /// @return the loaded systest queries and the number of loaded files
     [[nodiscard]] std::pair<std::vector<SystestQuery>, size_t> loadOptimizeQueries(const TestFileMap& discoveredTestFiles);
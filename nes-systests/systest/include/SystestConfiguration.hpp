@@ -50,6 +50,25 @@ public:
     BoolOption randomQueryOrder = {"random_query_order", "false", "run queries in random order"};
     UIntOption numberConcurrentQueries = {"number_concurrent_queries", "6", "number of maximal concurrently running queries"};
     BoolOption benchmark = {"benchmark_queries", "false", "Records the execution time of each query"};
+    BoolOption explainAnalyze
+        = {"explain_analyze", "false", "Breaks the execution of each benchmarked query down by its pipelines and operators"};
+    BoolOption memoryProfile
+        = {"memory_profile", "false", "Tracks the buffers of each benchmarked query by their owner and reports their timeline and peaks"};
+    UIntOption benchmarkStartRate
+        = {"benchmark_start_rate",
+           "0",
+           "Tuples per second and source at which the rate benchmark starts and doubles until the query saturates. Zero disables it"};
+    UIntOption benchmarkMaxRate = {"benchmark_max_rate", "100000000", "Tuples per second and source at which the rate benchmark stops"};
+    UIntOption benchmarkLatencyBound
+        = {"benchmark_latency_bound_ms", "1000", "Highest p99 latency in milliseconds at which a query sustains the offered rate"};
+    UIntOption benchmarkMaxConcurrentQueries
+        = {"benchmark_max_concurrent_queries",
+           "0",
+           "Number of concurrent copies of each query up to which the scalability benchmark doubles the copies. Zero disables it"};
+    BoolOption compareExecutionModes
+        = {"compare_execution_modes",
+           "false",
+           "Runs each query under every execution mode and compares their compile time, time to the first result, and throughput"};
     SequenceOption<StringOption> testGroups = {"test_groups", "test groups to run"};
     SequenceOption<StringOption> excludeGroups = {"exclude_groups", "test groups to exclude"};
     StringOption workerConfig = {"worker_config", "", "used worker config file (.yaml)"};
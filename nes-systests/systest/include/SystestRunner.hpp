@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <expected>
@@ -73,8 +74,59 @@ inline std::string discardPerformanceMessage(RunningQuery&)
 runQueriesAtRemoteWorker(const std::vector<SystestQuery>& queries, uint64_t numConcurrentQueries, const std::string& serverURI);
 
 /// Run queries sequentially locally and benchmark the run time of each query.
+/// With `explainAnalyze`, the worker profiles the operators of the compiled pipelines and each query prints its pipelines annotated with
+/// their costs and adds them to its benchmark result, c.f., PipelineReport.
+/// With `memoryProfile`, each query samples its buffers by their owner and prints their peaks, and adds the timeline and the peaks to its
+/// benchmark result, c.f., MemoryProfile.
 /// @return vector containing failed queries
 [[nodiscard]] std::vector<RunningQuery> runQueriesAndBenchmark(
+    const std::vector<SystestQuery>& queries,
+    const SingleNodeWorkerConfiguration& configuration,
+    nlohmann::json& resultJson,
+    bool explainAnalyze = false,
+    bool memoryProfile = false);
+
+struct RateBenchmarkConfiguration
+{
+    /// Tuples per second that every source of a query replays in the first step, each further step doubles the rate
+    double startRate = 0;
+    double maxRate = 0;
+    /// A query, whose p99 latency from the sources to the sinks exceeds the bound, does not sustain the rate
+    std::chrono::milliseconds latencyBound{0};
+};
+
+/// Loads the queries such that their sources replay their input at the given rate in tuples per second and source
+using QueryLoaderAtRate = std::function<std::vector<SystestQuery>(double tuplesPerSecond)>;
+
+/// Run queries sequentially locally at increasing input rates and record the throughput, the latency percentiles from the sources to the
+/// sinks, the cpu utilization and the peak memory of each step. The highest rate that a query sustains is its sustainable throughput.
+/// @return vector containing failed queries
+[[nodiscard]] std::vector<RunningQuery> runQueriesAndBenchmark(
+    const QueryLoaderAtRate& loadQueries,
+    const RateBenchmarkConfiguration& benchmarkConfiguration,
+    const SingleNodeWorkerConfiguration& configuration,
+    nlohmann::json& resultJson);
+
+/// Loads the queries of a copy, which writes its results into a working directory of its own
+using QueryLoaderForCopy = std::function<std::vector<SystestQuery>(size_t copy)>;
+
+/// Run each query locally as 1, 2, 4, ... up to `maxConcurrentQueries` concurrent copies on one worker and record the aggregate throughput,
+/// the throughput and latency of every copy, the fairness between the copies, their startup time, and the peak memory of each step.
+/// @return vector containing failed queries
+[[nodiscard]] std::vector<RunningQuery> runQueriesAndBenchmarkScalability(
+    const QueryLoaderForCopy& loadQueries,
+    uint64_t maxConcurrentQueries,
+    const SingleNodeWorkerConfiguration& configuration,
+    nlohmann::json& resultJson);
+
+/// A query, whose startup until it runs takes more than this share of its total runtime, is dominated by its compilation
+constexpr double COMPILATION_DOMINATED_SHARE = 0.5;
+
+/// Run each query locally once under every execution mode, e.g., the interpreter, the compiler, and the tiered execution, and record the
+/// time until the query runs, i.e., the compilation of its pipelines, the time to its first result, and its steady-state throughput after
+/// the first result. Queries that are dominated by their compilation in a mode are highlighted.
+/// @return vector containing failed queries
+[[nodiscard]] std::vector<RunningQuery> runQueriesAndCompareExecutionModes(
     const std::vector<SystestQuery>& queries, const SingleNodeWorkerConfiguration& configuration, nlohmann::json& resultJson);
 
 /// Prints the error message, if the query has failed/passed and the expected and result tuples, like below
@@ -0,0 +1,219 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <MemoryProfile.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
+#include <Runtime/MemoryAccount.hpp>
+#include <fmt/format.h>
+#include <nlohmann/json.hpp>
+#include <PipelineReport.hpp>
+#include <QueryEngine.hpp>
+
+namespace NES::Systest
+{
+
+namespace
+{
+void add(MemoryAccount::Usage& total, const MemoryAccount::Usage& usage)
+{
+    total.bytes += usage.bytes;
+    total.numberOfPooledBuffers += usage.numberOfPooledBuffers;
+    total.numberOfUnpooledBuffers += usage.numberOfUnpooledBuffers;
+}
+
+nlohmann::json toJson(const MemoryAccount::Usage& usage)
+{
+    return {
+        {"bytes", usage.bytes},
+        {"pooledBuffers", usage.numberOfPooledBuffers},
+        {"unpooledBuffers", usage.numberOfUnpooledBuffers},
+    };
+}
+}
+
+void MemoryProfile::update(
+    const std::chrono::steady_clock::time_point now,
+    const QueryId queryId,
+    const EngineMetrics& engine,
+    const std::optional<QueryMemoryMetrics>& queryMemory,
+    const std::vector<PipelineMetrics>& pipelines)
+{
+    if (not start.has_value())
+    {
+        start = now;
+    }
+    for (const auto& pipeline : pipelines)
+    {
+        this->pipelines.insert_or_assign(pipeline.pipelineId, pipeline);
+    }
+
+    Sample sample{
+        .time = std::chrono::duration_cast<std::chrono::milliseconds>(now - *start),
+        .numberOfPooledBuffersInUse
+        = engine.numberOfPooledBuffers - std::min(engine.numberOfAvailableBuffers, engine.numberOfPooledBuffers),
+        .numberOfUnpooledBuffers = engine.numberOfUnpooledBuffers,
+        .queryBytes = queryMemory.has_value() ? queryMemory->usedBytes : 0};
+    /// The samples solely contain the running pipelines and sources, as the stopped ones released their buffers
+    for (const auto& pipeline : pipelines)
+    {
+        add(sample.owners[static_cast<size_t>(ownerOf(pipeline.pipelineId))], pipeline.bufferUsage);
+        sample.stateSizeInBytes += pipeline.stateSizeInBytes;
+    }
+    for (const auto& source : engine.sources)
+    {
+        if (source.queryId == queryId)
+        {
+            sources.insert_or_assign(source.originId, source);
+            sample.owners[static_cast<size_t>(Owner::SOURCE)].numberOfPooledBuffers += source.numberOfInflightBuffers;
+        }
+    }
+
+    numberOfPooledBuffers = engine.numberOfPooledBuffers;
+    peakNumberOfPooledBuffersInUse = std::max(peakNumberOfPooledBuffersInUse, sample.numberOfPooledBuffersInUse);
+    peakNumberOfUnpooledBuffers = std::max(peakNumberOfUnpooledBuffers, sample.numberOfUnpooledBuffers);
+    if (queryMemory.has_value())
+    {
+        peakQueryBytes = std::max(peakQueryBytes, queryMemory->peakBytes);
+    }
+
+    if (numberOfUpdates++ % sampleStride != 0)
+    {
+        return;
+    }
+    timeline.push_back(sample);
+    if (timeline.size() > MAX_NUMBER_OF_SAMPLES)
+    {
+        /// Keeps the samples at the even indices, i.e., the first sample and every `sampleStride`-th update afterward
+        for (size_t index = 0; 2 * index < timeline.size(); ++index)
+        {
+            timeline[index] = timeline[2 * index];
+        }
+        timeline.resize((timeline.size() + 1) / 2);
+        sampleStride *= 2;
+    }
+}
+
+MemoryProfile::Owner MemoryProfile::ownerOf(const PipelineId pipelineId) const
+{
+    const auto pipeline = pipelines.find(pipelineId);
+    if (pipeline == pipelines.end() || pipeline->second.successors.empty())
+    {
+        return Owner::SINK;
+    }
+    const auto isPredecessor = [pipelineId](const auto& other) { return std::ranges::contains(other.second.successors, pipelineId); };
+    return std::ranges::any_of(pipelines, isPredecessor) ? Owner::OPERATOR : Owner::FORMATTER;
+}
+
+std::string MemoryProfile::render() const
+{
+    auto rendered = fmt::format(
+        "Memory: peak {} of {} pooled buffers in use, peak {} unpooled buffers, peak {} of the query\n",
+        peakNumberOfPooledBuffersInUse,
+        numberOfPooledBuffers,
+        peakNumberOfUnpooledBuffers,
+        PipelineReport::formatBytes(peakQueryBytes));
+    for (const auto& [originId, source] : sources)
+    {
+        rendered += fmt::format("  Source {}: peak {} inflight buffers\n", originId, source.peakNumberOfInflightBuffers);
+    }
+    for (const auto& [pipelineId, pipeline] : pipelines)
+    {
+        rendered += fmt::format(
+            "  {} pipeline {}: peak {} pooled and {} unpooled buffers, {}, state {}\n",
+            nameOf(ownerOf(pipelineId)),
+            pipelineId,
+            pipeline.peakBufferUsage.numberOfPooledBuffers,
+            pipeline.peakBufferUsage.numberOfUnpooledBuffers,
+            PipelineReport::formatBytes(pipeline.peakBufferUsage.bytes),
+            PipelineReport::formatBytes(pipeline.peakStateSizeInBytes));
+    }
+    return rendered;
+}
+
+nlohmann::json MemoryProfile::toJson() const
+{
+    auto samples = nlohmann::json::array();
+    for (const auto& sample : timeline)
+    {
+        nlohmann::json owners;
+        for (size_t owner = 0; owner < NUMBER_OF_OWNERS; ++owner)
+        {
+            owners[std::string(nameOf(static_cast<Owner>(owner)))] = Systest::toJson(sample.owners[owner]);
+        }
+        samples.push_back({
+            {"timeMs", sample.time.count()},
+            {"pooledBuffersInUse", sample.numberOfPooledBuffersInUse},
+            {"unpooledBuffers", sample.numberOfUnpooledBuffers},
+            {"queryBytes", sample.queryBytes},
+            {"stateBytes", sample.stateSizeInBytes},
+            {"owners", owners},
+        });
+    }
+
+    auto peakSources = nlohmann::json::array();
+    for (const auto& [originId, source] : sources)
+    {
+        peakSources.push_back({{"originId", originId.getRawValue()}, {"inflightBuffers", source.peakNumberOfInflightBuffers}});
+    }
+    auto peakPipelines = nlohmann::json::array();
+    for (const auto& [pipelineId, pipeline] : pipelines)
+    {
+        auto peak = Systest::toJson(pipeline.peakBufferUsage);
+        peak["pipelineId"] = pipelineId.getRawValue();
+        peak["owner"] = std::string(nameOf(ownerOf(pipelineId)));
+        peak["stateBytes"] = pipeline.peakStateSizeInBytes;
+        peakPipelines.push_back(std::move(peak));
+    }
+    return {
+        {"timeline", samples},
+        {"peak",
+         {
+             {"pooledBuffers", numberOfPooledBuffers},
+             {"pooledBuffersInUse", peakNumberOfPooledBuffersInUse},
+             {"unpooledBuffers", peakNumberOfUnpooledBuffers},
+             {"queryBytes", peakQueryBytes},
+             {"sources", peakSources},
+             {"pipelines", peakPipelines},
+         }},
+    };
+}
+
+std::string_view MemoryProfile::nameOf(const Owner owner)
+{
+    switch (owner)
+    {
+        case Owner::SOURCE:
+            return "source";
+        case Owner::FORMATTER:
+            return "formatter";
+        case Owner::OPERATOR:
+            return "operator";
+        case Owner::SINK:
+            return "sink";
+    }
+    std::unreachable();
+}
+
+}
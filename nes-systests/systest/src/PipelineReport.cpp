@@ -0,0 +1,170 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <PipelineReport.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <ranges>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
+#include <Util/PlanRenderer.hpp>
+#include <fmt/format.h>
+#include <nlohmann/json.hpp>
+#include <QueryEngine.hpp>
+
+namespace NES::Systest
+{
+
+std::string PipelineReport::Node::explain(const ExplainVerbosity verbosity) const
+{
+    const auto& pipeline = report->pipelines.at(pipelineId);
+    const std::chrono::duration<double, std::milli> cpuTime = pipeline.executionTime;
+    auto explanation = fmt::format(
+        "Pipeline {}: {} tasks, {} tuples -> {} tuples in {} buffers, {:.3f} ms, state {}",
+        pipelineId,
+        pipeline.numberOfTasks,
+        pipeline.numberOfInputTuples,
+        pipeline.numberOfEmittedTuples,
+        pipeline.numberOfEmittedBuffers,
+        cpuTime.count(),
+        formatBytes(pipeline.peakStateSizeInBytes));
+    if (not pipeline.stateSizeInBytesPerWorkerThread.empty())
+    {
+        explanation += fmt::format(
+            " (largest worker thread {}{})",
+            formatBytes(std::ranges::max(pipeline.stateSizeInBytesPerWorkerThread)),
+            pipeline.isRebalancing ? ", rebalancing" : "");
+    }
+    if (pipeline.operatorCosts.empty())
+    {
+        return explanation;
+    }
+
+    /// The calls of the root operator include all other calls of the pipeline
+    const auto totalCycles = pipeline.operatorCosts.front().inclusiveCycles;
+    std::string_view separator = " | ";
+    for (const auto& [operatorId, name, numberOfInvocations, inclusiveCycles, exclusiveCycles] : pipeline.operatorCosts)
+    {
+        const auto share = totalCycles == 0 ? 0.0 : 100.0 * static_cast<double>(exclusiveCycles) / static_cast<double>(totalCycles);
+        explanation += fmt::format("{}{} {:.1f}%", separator, name, share);
+        separator = ", ";
+        if (verbosity == ExplainVerbosity::Debug)
+        {
+            explanation += fmt::format(" ({} cycles in {} invocations)", exclusiveCycles, numberOfInvocations);
+        }
+    }
+    return explanation;
+}
+
+std::vector<PipelineReport::Node> PipelineReport::Node::getChildren() const
+{
+    std::vector<Node> children;
+    for (const auto& [predecessorId, predecessor] : report->pipelines)
+    {
+        if (std::ranges::contains(predecessor.successors, pipelineId))
+        {
+            children.emplace_back(*report, predecessorId);
+        }
+    }
+    return children;
+}
+
+void PipelineReport::update(const std::vector<PipelineMetrics>& pipelines)
+{
+    for (const auto& pipeline : pipelines)
+    {
+        this->pipelines.insert_or_assign(pipeline.pipelineId, pipeline);
+    }
+}
+
+std::vector<PipelineReport::Node> PipelineReport::getRootOperators() const
+{
+    /// Successors that the report does not contain, e.g., as they stopped before the first sample, do not hide their predecessors
+    const auto isReported = [this](const PipelineId successor) { return pipelines.contains(successor); };
+    std::vector<Node> roots;
+    for (const auto& [pipelineId, pipeline] : pipelines)
+    {
+        if (std::ranges::none_of(pipeline.successors, isReported))
+        {
+            roots.emplace_back(*this, pipelineId);
+        }
+    }
+    return roots;
+}
+
+std::string PipelineReport::render(const ExplainVerbosity verbosity) const
+{
+    std::stringstream stream;
+    PlanRenderer<PipelineReport, Node>(stream, verbosity).dump(*this);
+    return stream.str();
+}
+
+nlohmann::json PipelineReport::toJson() const
+{
+    auto json = nlohmann::json::array();
+    for (const auto& [pipelineId, pipeline] : pipelines)
+    {
+        auto operators = nlohmann::json::array();
+        for (const auto& [operatorId, name, numberOfInvocations, inclusiveCycles, exclusiveCycles] : pipeline.operatorCosts)
+        {
+            operators.push_back({
+                {"operatorId", operatorId.getRawValue()},
+                {"name", name},
+                {"invocations", numberOfInvocations},
+                {"inclusiveCycles", inclusiveCycles},
+                {"exclusiveCycles", exclusiveCycles},
+            });
+        }
+        json.push_back({
+            {"pipelineId", pipelineId.getRawValue()},
+            {"successors",
+             pipeline.successors | std::views::transform([](const auto& successor) { return successor.getRawValue(); })
+                 | std::ranges::to<std::vector>()},
+            {"tasks", pipeline.numberOfTasks},
+            {"inputTuples", pipeline.numberOfInputTuples},
+            {"emittedTuples", pipeline.numberOfEmittedTuples},
+            {"emittedBuffers", pipeline.numberOfEmittedBuffers},
+            {"cpuTimeMs", std::chrono::duration<double, std::milli>(pipeline.executionTime).count()},
+            {"peakStateBytes", pipeline.peakStateSizeInBytes},
+            {"stateBytesPerWorkerThread", pipeline.stateSizeInBytesPerWorkerThread},
+            {"rebalancing", pipeline.isRebalancing},
+            {"operators", operators},
+        });
+    }
+    return json;
+}
+
+std::string PipelineReport::formatBytes(const uint64_t bytes)
+{
+    const std::array<std::string, 5> units = {"B", "KiB", "MiB", "GiB", "TiB"};
+    auto value = static_cast<double>(bytes);
+    size_t unitIndex = 0;
+    constexpr auto nextUnit = 1024;
+    while (value >= nextUnit && unitIndex < units.size() - 1)
+    {
+        value /= nextUnit;
+        unitIndex++;
+    }
+    return unitIndex == 0 ? fmt::format("{} B", bytes) : fmt::format("{:.1f} {}", value, units[unitIndex]);
+}
+
+}
@@ -42,6 +42,7 @@
 #include <DataTypes/Schema.hpp>
 #include <Identifiers/NESStrongType.hpp>
 #include <Operators/LogicalOperator.hpp>
+#include <Operators/LookupJoinLogicalOperator.hpp>
 #include <Operators/Sinks/InlineSinkLogicalOperator.hpp>
 #include <Operators/Sinks/SinkLogicalOperator.hpp>
 #include <Operators/Sources/InlineSourceLogicalOperator.hpp>
@@ -319,8 +320,15 @@ private:
 
 struct SystestBinder::Impl
 {
-    explicit Impl(std::filesystem::path workingDir, std::filesystem::path testDataDir, std::filesystem::path configDir)
-        : workingDir(std::move(workingDir)), testDataDir(std::move(testDataDir)), configDir(std::move(configDir))
+    explicit Impl(
+        std::filesystem::path workingDir,
+        std::filesystem::path testDataDir,
+        std::filesystem::path configDir,
+        const std::optional<double> replayTuplesPerSecond)
+        : workingDir(std::move(workingDir))
+        , testDataDir(std::move(testDataDir))
+        , configDir(std::move(configDir))
+        , replayTuplesPerSecond(replayTuplesPerSecond)
     {
     }
 
@@ -445,6 +453,13 @@ struct SystestBinder::Impl
         std::unordered_map<std::string, std::string> defaultParserConfig{{"type", "CSV"}};
         physicalSourceConfig.parserConfig.merge(defaultParserConfig);
 
+        if (testData.has_value() && replayTuplesPerSecond.has_value() && physicalSourceConfig.type == "File")
+        {
+            physicalSourceConfig.type = "Replay";
+            physicalSourceConfig.sourceConfig.insert_or_assign("replay_mode", "FIXED_RATE");
+            physicalSourceConfig.sourceConfig.insert_or_assign("replay_tuples_per_second", fmt::format("{}", *replayTuplesPerSecond));
+        }
+
         if (testData.has_value())
         {
             physicalSourceConfig = setUpSourceWithTestData(physicalSourceConfig, sourceThreads, std::move(testData.value()));
@@ -542,6 +557,19 @@ struct SystestBinder::Impl
             }
         }
 
+        /// The tables of lookup joins are relative to the testDataDir, too
+        if (const auto lookupJoin = current.tryGetAs<LookupJoinLogicalOperator>();
+            lookupJoin.has_value() && !lookupJoin.value()->getExternalTable().has_value()
+            && !lookupJoin.value()->getTableFilePath().starts_with("/"))
+        {
+            const LookupJoinLogicalOperator newOperator{
+                (testDataDir / lookupJoin.value()->getTableFilePath()).string(),
+                lookupJoin.value()->getTableSchema(),
+                lookupJoin.value()->getJoinFunction(),
+                lookupJoin.value()->getReloadIntervalMs()};
+            return newOperator.withChildren(newChildren);
+        }
+
         return current.withChildren(std::move(newChildren));
     }
 
@@ -795,11 +823,21 @@ private:
     std::filesystem::path workingDir;
     std::filesystem::path testDataDir;
     std::filesystem::path configDir;
+    std::optional<double> replayTuplesPerSecond;
 };
 
 SystestBinder::SystestBinder(
     const std::filesystem::path& workingDir, const std::filesystem::path& testDataDir, const std::filesystem::path& configDir)
-    : impl(std::make_unique<Impl>(workingDir, testDataDir, configDir))
+    : SystestBinder(workingDir, testDataDir, configDir, std::nullopt)
+{
+}
+
+SystestBinder::SystestBinder(
+    const std::filesystem::path& workingDir,
+    const std::filesystem::path& testDataDir,
+    const std::filesystem::path& configDir,
+    const std::optional<double> replayTuplesPerSecond)
+    : impl(std::make_unique<Impl>(workingDir, testDataDir, configDir, replayTuplesPerSecond))
 {
 }
 
@@ -17,6 +17,7 @@
 #include <algorithm>
 #include <cctype>
 #include <chrono>
+#include <cstdint>
 #include <cstdlib>
 #include <exception>
 #include <filesystem>
@@ -122,6 +123,42 @@ SystestConfiguration readConfiguration(int argc, const char** argv)
         .help("Benchmark (time) all specified queries and store results into 'BenchmarkResults.json' in the result directory")
         .default_value(false)
         .implicit_value(true);
+    program.add_argument("--explain-analyze")
+        .help("benchmark all specified queries like -b, profile the operators of their pipelines, and print the query plan of each query "
+              "annotated with the tasks, tuples, cpu time, state, and emitted buffers of its pipelines and the cycles of its operators")
+        .default_value(false)
+        .implicit_value(true);
+    program.add_argument("--memory-profile")
+        .help("benchmark all specified queries like -b, track the pooled and unpooled buffers of the sources, formatters, operators, and "
+              "sinks of each query over time, and print their peaks, e.g., to size the global buffer pool")
+        .default_value(false)
+        .implicit_value(true);
+
+    /// Benchmark the sustainable throughput and the latency of all specified queries
+    program.add_argument("--rate-benchmark")
+        .help("replay the input of each query at this rate in tuples per second and source, doubling it until the query saturates, and "
+              "store the results into 'RateBenchmarkResults.json' in the result directory")
+        .scan<'u', uint64_t>();
+    program.add_argument("--max-rate")
+        .help("rate in tuples per second and source at which the rate benchmark stops. Default: 100000000")
+        .scan<'u', uint64_t>();
+    program.add_argument("--latency-bound")
+        .help("highest p99 latency in milliseconds at which a query sustains the rate of the rate benchmark. Default: 1000")
+        .scan<'u', uint64_t>();
+
+    /// Benchmark the scalability of all specified queries with the number of concurrent queries
+    program.add_argument("--scalability-benchmark")
+        .help("run 1, 2, 4, ... up to this number of concurrent copies of each query on one worker and store the results into "
+              "'ScalabilityBenchmarkResults.json' in the result directory")
+        .scan<'u', uint64_t>();
+
+    /// Compare the execution modes, e.g., the interpreter and the compiler, on all specified queries
+    program.add_argument("--compare-execution-modes")
+        .help("run each query under every execution mode, report its compile time, time to the first result, and throughput, highlight "
+              "the queries whose compilation dominates their runtime, and store the results into 'ExecutionModeComparison.json' in the "
+              "result directory")
+        .default_value(false)
+        .implicit_value(true);
 
     try
     {
@@ -141,9 +178,11 @@ SystestConfiguration readConfiguration(int argc, const char** argv)
 
     auto config = SystestConfiguration();
 
-    if (program.is_used("-b"))
+    if (program.is_used("-b") || program.is_used("--explain-analyze") || program.is_used("--memory-profile"))
     {
         config.benchmark = true;
+        config.explainAnalyze = program.is_used("--explain-analyze");
+        config.memoryProfile = program.is_used("--memory-profile");
         if ((program.is_used("-n") || program.is_used("--numberConcurrentQueries"))
             && (program.get<int>("--numberConcurrentQueries") > 1 || program.get<int>("-n") > 1))
         {
@@ -155,6 +194,43 @@ SystestConfiguration readConfiguration(int argc, const char** argv)
         config.numberConcurrentQueries = 1;
     }
 
+    if (program.is_used("--rate-benchmark"))
+    {
+        config.benchmarkStartRate = program.get<uint64_t>("--rate-benchmark");
+        if (config.benchmarkStartRate.getValue() == 0)
+        {
+            std::cerr << "The rate benchmark requires a start rate above zero\n";
+            std::exit(1); ///NOLINT(concurrency-mt-unsafe)
+        }
+        if (program.is_used("--max-rate"))
+        {
+            config.benchmarkMaxRate = program.get<uint64_t>("--max-rate");
+        }
+        if (program.is_used("--latency-bound"))
+        {
+            config.benchmarkLatencyBound = program.get<uint64_t>("--latency-bound");
+        }
+        std::cout << "Running systests in rate benchmarking mode. Only one query is run at a time!\n";
+        config.numberConcurrentQueries = 1;
+    }
+
+    if (program.is_used("--scalability-benchmark"))
+    {
+        config.benchmarkMaxConcurrentQueries = program.get<uint64_t>("--scalability-benchmark");
+        if (config.benchmarkMaxConcurrentQueries.getValue() == 0)
+        {
+            std::cerr << "The scalability benchmark requires at least one concurrent query\n";
+            std::exit(1); ///NOLINT(concurrency-mt-unsafe)
+        }
+        std::cout << "Running systests in scalability benchmarking mode. The copies of one query are run at a time!\n";
+    }
+
+    if (program.is_used("--compare-execution-modes"))
+    {
+        config.compareExecutionModes = true;
+        std::cout << "Running systests in execution mode comparison mode. Only one query is run at a time!\n";
+    }
+
     if (program.is_used("-d"))
     {
         Logger::setupLogging("systest.log", LogLevel::LOG_DEBUG);
@@ -546,10 +622,58 @@ SystestExecutorResult executeSystests(SystestConfiguration config)
             {
                 singleNodeWorkerConfiguration = config.singleNodeWorkerConfig.value();
             }
-            if (config.benchmark)
+            if (config.benchmarkStartRate.getValue() > 0)
+            {
+                const Systest::RateBenchmarkConfiguration rateBenchmarkConfiguration{
+                    .startRate = static_cast<double>(config.benchmarkStartRate.getValue()),
+                    .maxRate = static_cast<double>(config.benchmarkMaxRate.getValue()),
+                    .latencyBound = std::chrono::milliseconds(config.benchmarkLatencyBound.getValue())};
+                const auto loadQueriesAtRate = [&config, &discoveredTestFiles](const double tuplesPerSecond)
+                {
+                    Systest::SystestBinder rateBinder{
+                        config.workingDir.getValue(), config.testDataDir.getValue(), config.configDir.getValue(), tuplesPerSecond};
+                    return rateBinder.loadOptimizeQueries(discoveredTestFiles).first;
+                };
+                nlohmann::json benchmarkResults;
+                failedQueries = Systest::runQueriesAndBenchmark(
+                    loadQueriesAtRate, rateBenchmarkConfiguration, singleNodeWorkerConfiguration, benchmarkResults);
+                std::cout << benchmarkResults.dump(4);
+                std::ofstream outputFile(std::filesystem::path(config.workingDir.getValue()) / "RateBenchmarkResults.json");
+                outputFile << benchmarkResults.dump(4);
+            }
+            else if (config.benchmarkMaxConcurrentQueries.getValue() > 0)
+            {
+                const auto loadQueryCopy = [&config, &discoveredTestFiles](const size_t copy)
+                {
+                    const auto copyWorkingDir = std::filesystem::path(config.workingDir.getValue()) / fmt::format("copy{}", copy);
+                    std::filesystem::create_directories(copyWorkingDir);
+                    Systest::SystestBinder copyBinder{copyWorkingDir, config.testDataDir.getValue(), config.configDir.getValue()};
+                    return copyBinder.loadOptimizeQueries(discoveredTestFiles).first;
+                };
+                nlohmann::json benchmarkResults;
+                failedQueries = Systest::runQueriesAndBenchmarkScalability(
+                    loadQueryCopy, config.benchmarkMaxConcurrentQueries.getValue(), singleNodeWorkerConfiguration, benchmarkResults);
+                std::cout << benchmarkResults.dump(4);
+                std::ofstream outputFile(std::filesystem::path(config.workingDir.getValue()) / "ScalabilityBenchmarkResults.json");
+                outputFile << benchmarkResults.dump(4);
+            }
+            else if (config.compareExecutionModes)
+            {
+                nlohmann::json comparisonResults;
+                failedQueries = Systest::runQueriesAndCompareExecutionModes(queries, singleNodeWorkerConfiguration, comparisonResults);
+                std::cout << comparisonResults.dump(4);
+                std::ofstream outputFile(std::filesystem::path(config.workingDir.getValue()) / "ExecutionModeComparison.json");
+                outputFile << comparisonResults.dump(4);
+            }
+            else if (config.benchmark)
             {
                 nlohmann::json benchmarkResults;
-                failedQueries = Systest::runQueriesAndBenchmark(queries, singleNodeWorkerConfiguration, benchmarkResults);
+                failedQueries = Systest::runQueriesAndBenchmark(
+                    queries,
+                    singleNodeWorkerConfiguration,
+                    benchmarkResults,
+                    config.explainAnalyze.getValue(),
+                    config.memoryProfile.getValue());
                 std::cout << benchmarkResults.dump(4);
                 const auto outputPath = std::filesystem::path(config.workingDir.getValue()) / "BenchmarkResults.json";
                 std::ofstream outputFile(outputPath);
@@ -14,28 +14,36 @@
 
 #include <SystestRunner.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <cerrno>
 #include <chrono>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <expected> /// NOLINT(misc-include-cleaner)
 #include <filesystem>
 #include <fstream>
 #include <iostream>
 #include <memory>
+#include <numeric>
 #include <optional>
 #include <ostream>
 #include <queue>
 #include <ranges>
 #include <regex>
+#include <stop_token>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <unordered_map>
 #include <utility>
 #include <variant>
 #include <vector>
+#include <sys/resource.h>
+#include <unistd.h>
 #include <fmt/base.h>
 #include <fmt/color.h>
 #include <fmt/format.h>
@@ -50,12 +58,16 @@
 #include <QueryManager/EmbeddedWorkerQueryManager.hpp>
 #include <QueryManager/GRPCQueryManager.hpp>
 #include <Runtime/Execution/QueryStatus.hpp>
+#include <Util/ExecutionMode.hpp>
 #include <Util/Logger/Logger.hpp>
 #include <Util/Strings.hpp>
 #include <grpcpp/create_channel.h>
 #include <grpcpp/security/credentials.h>
+#include <magic_enum/magic_enum.hpp>
 #include <nlohmann/json_fwd.hpp>
 #include <ErrorHandling.hpp>
+#include <MemoryProfile.hpp>
+#include <PipelineReport.hpp>
 #include <QuerySubmitter.hpp>
 #include <SingleNodeWorker.hpp>
 #include <SingleNodeWorkerConfiguration.hpp>
@@ -333,6 +345,7 @@ std::vector<RunningQuery> serializeExecutionResults(const std::vector<RunningQue
         const auto executionTimeInSeconds = queryRan.getElapsedTime().count();
         resultJson.push_back({
             {"query name", queryRan.systestQuery.testName},
+            {"query number", queryRan.systestQuery.queryIdInFile.getRawValue()},
             {"time", executionTimeInSeconds},
             {"bytesPerSecond", static_cast<double>(queryRan.bytesProcessed.value_or(NAN)) / executionTimeInSeconds},
             {"tuplesPerSecond", static_cast<double>(queryRan.tuplesProcessed.value_or(NAN)) / executionTimeInSeconds},
@@ -340,14 +353,178 @@ std::vector<RunningQuery> serializeExecutionResults(const std::vector<RunningQue
     }
     return failedQueries;
 }
+
+struct SourceInput
+{
+    size_t bytes = 0;
+    size_t tuples = 0;
+    uint64_t occurrencesInQuery = 0;
+};
+
+/// Reads the size and the number of tuples of the input files of the query's sources. Returns nullopt, if a source has no input file.
+std::optional<std::vector<SourceInput>> readSourceInputs(const SystestQuery& query)
+{
+    std::vector<SourceInput> inputs;
+    for (const auto& [sourcePath, sourceOccurrencesInQuery] :
+         query.planInfoOrException.value().sourcesToFilePathsAndCounts | std::views::values)
+    {
+        if (not(std::filesystem::exists(sourcePath.getRawValue()) and sourcePath.getRawValue().has_filename()))
+        {
+            NES_ERROR("Source path is empty or does not exist.");
+            return std::nullopt;
+        }
+
+        /// Counting the lines, i.e., \n in the sourcePath
+        std::ifstream inFile(sourcePath.getRawValue());
+        inputs.push_back(
+            {.bytes = std::filesystem::file_size(sourcePath.getRawValue()),
+             .tuples = static_cast<size_t>(std::count(std::istreambuf_iterator(inFile), std::istreambuf_iterator<char>(), '\n')),
+             .occurrencesInQuery = sourceOccurrencesInQuery});
+    }
+    return inputs;
+}
+
+/// Number of bytes and tuples that all sources of the query ingest
+std::pair<size_t, size_t> countProcessedInput(const std::optional<std::vector<SourceInput>>& inputs)
+{
+    size_t bytesProcessed = 0;
+    size_t tuplesProcessed = 0;
+    for (const auto& input : inputs.value_or(std::vector<SourceInput>{}))
+    {
+        bytesProcessed += input.bytes * input.occurrencesInQuery;
+        tuplesProcessed += input.tuples * input.occurrencesInQuery;
+    }
+    return {bytesProcessed, tuplesProcessed};
+}
+
+/// The rate and the scalability benchmark sample the pipeline metrics and the memory of the process in this interval while queries run
+constexpr std::chrono::milliseconds BENCHMARK_SAMPLING_INTERVAL{10};
+/// The metrics are read from the live counters of the pipelines, thus the interval solely needs to enable the pipeline statistics
+constexpr uint64_t BENCHMARK_PIPELINE_STATISTICS_INTERVAL_MS = 1000;
+
+/// Enables the pipeline statistics, which report the latencies of the queries, unless the configuration enabled them already
+SingleNodeWorkerConfiguration withPipelineStatistics(SingleNodeWorkerConfiguration configuration)
+{
+    auto& pipelineStatisticsInterval = configuration.workerConfiguration.queryEngine.pipelineStatisticsInterval;
+    if (pipelineStatisticsInterval.getValue() == 0)
+    {
+        pipelineStatisticsInterval = BENCHMARK_PIPELINE_STATISTICS_INTERVAL_MS;
+    }
+    return configuration;
+}
+
+/// Counts the cycles of the operators of the compiled pipelines, which breaks the costs of the pipelines down to their operators
+SingleNodeWorkerConfiguration withOperatorProfiling(SingleNodeWorkerConfiguration configuration)
+{
+    configuration.workerConfiguration.profileOperators = true;
+    return withPipelineStatistics(std::move(configuration));
+}
+
+/// A query sustains a rate, if it runs for at most 1 / SUSTAINED_RATE_SHARE times the duration of replaying its input at the rate
+constexpr double SUSTAINED_RATE_SHARE = 0.95;
+
+/// Upper bound in milliseconds of the bucket of an ingestion latency histogram, which contains the percentile. The histogram buckets are
+/// powers of two, thus this overestimates the latency by up to a factor of two.
+std::optional<uint64_t> latencyPercentile(const std::vector<uint64_t>& histogram, const double percentile)
+{
+    const auto total = std::accumulate(histogram.begin(), histogram.end(), uint64_t{0});
+    if (total == 0)
+    {
+        return std::nullopt;
+    }
+    const auto rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(percentile * static_cast<double>(total))));
+    uint64_t count = 0;
+    for (size_t bucket = 0; bucket < histogram.size(); ++bucket)
+    {
+        count += histogram[bucket];
+        if (count >= rank)
+        {
+            return uint64_t{1} << bucket;
+        }
+    }
+    return uint64_t{1} << (histogram.size() - 1);
+}
+
+/// The pipelines of the sinks process the oldest data of the query, thus their ingestion latency is the latency from the sources to the
+/// sinks. We select the pipeline with the highest median ingestion latency instead of resolving the sinks in the query plan.
+std::vector<uint64_t> sinkIngestionLatencyHistogram(const std::vector<PipelineMetrics>& pipelines)
+{
+    const auto latencyOf = [](const PipelineMetrics& pipeline)
+    {
+        return std::make_pair(
+            latencyPercentile(pipeline.ingestionLatencyHistogram, 0.5).value_or(0),
+            latencyPercentile(pipeline.ingestionLatencyHistogram, 0.99).value_or(0));
+    };
+    const auto sink = std::ranges::max_element(pipelines, {}, latencyOf);
+    return sink == pipelines.end() ? std::vector<uint64_t>{} : sink->ingestionLatencyHistogram;
+}
+
+/// User and system time that all threads of the process spent on the cpu
+std::chrono::duration<double> processCpuTime()
+{
+    rusage usage{};
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+    {
+        NES_WARNING("Could not read the cpu time of the process: {}", std::strerror(errno));
+        return std::chrono::duration<double>{0};
+    }
+    const auto toDuration = [](const timeval& time) { return std::chrono::seconds(time.tv_sec) + std::chrono::microseconds(time.tv_usec); };
+    return toDuration(usage.ru_utime) + toDuration(usage.ru_stime);
+}
+
+size_t residentBytes()
+{
+    std::ifstream statm("/proc/self/statm");
+    size_t totalPages = 0;
+    size_t residentPages = 0;
+    if (not(statm >> totalPages >> residentPages))
+    {
+        return 0;
+    }
+    return residentPages * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+}
+
+/// Last metrics of the pipelines of a query, i.e., before the query stopped and destroyed its pipelines, and the peak memory of the process
+struct RateBenchmarkSamples
+{
+    std::vector<PipelineMetrics> pipelineMetrics;
+    size_t peakResidentBytes = 0;
+};
+
+/// Missing measurements, e.g., of queries without sinks that report ingestion latencies, are null
+template <typename T>
+nlohmann::json toJson(const std::optional<T>& value)
+{
+    return value.has_value() ? nlohmann::json(*value) : nlohmann::json(nullptr);
+}
+
+struct RateBenchmarkQuery
+{
+    nlohmann::json rates = nlohmann::json::array();
+    std::optional<double> sustainableThroughput;
+    std::optional<double> breakingRate;
+    bool saturated = false;
+};
 }
 
 std::vector<RunningQuery> runQueriesAndBenchmark(
-    const std::vector<SystestQuery>& queries, const SingleNodeWorkerConfiguration& configuration, nlohmann::json& resultJson)
+    const std::vector<SystestQuery>& queries,
+    const SingleNodeWorkerConfiguration& configuration,
+    nlohmann::json& resultJson,
+    const bool explainAnalyze,
+    const bool memoryProfile)
 {
-    auto worker = std::make_unique<EmbeddedWorkerQueryManager>(configuration);
+    auto workerConfiguration = memoryProfile ? withPipelineStatistics(configuration) : configuration;
+    if (explainAnalyze)
+    {
+        workerConfiguration = withOperatorProfiling(std::move(workerConfiguration));
+    }
+    auto worker = std::make_unique<EmbeddedWorkerQueryManager>(workerConfiguration);
+    const auto& queryManager = *worker;
     QuerySubmitter submitter(std::move(worker));
     std::vector<std::shared_ptr<RunningQuery>> ranQueries;
+    std::vector<PipelineReport> pipelineReports;
+    std::vector<MemoryProfile> memoryProfiles;
     std::size_t queryFinishedCounter = 0;
     const auto totalQueries = queries.size();
     for (const auto& queryToRun : queries)
@@ -369,8 +546,40 @@ std::vector<RunningQuery> runQueriesAndBenchmark(
         auto runningQueryPtr = std::make_shared<RunningQuery>(queryToRun, queryId);
         runningQueryPtr->passed = false;
         ranQueries.emplace_back(runningQueryPtr);
+        auto& pipelineReport = pipelineReports.emplace_back();
+        auto& memoryProfileOfQuery = memoryProfiles.emplace_back();
         submitter.startQuery(queryId);
-        const auto summary = submitter.finishedQueries().at(0);
+        LocalQueryStatus summary;
+        {
+            std::jthread sampler;
+            if (explainAnalyze || memoryProfile)
+            {
+                sampler = std::jthread(
+                    [&pipelineReport, &memoryProfileOfQuery, &queryManager, queryId, explainAnalyze, memoryProfile](
+                        const std::stop_token& stopToken)
+                    {
+                        while (not stopToken.stop_requested())
+                        {
+                            const auto metrics = queryManager.pipelineMetrics(queryId);
+                            if (explainAnalyze && metrics.has_value())
+                            {
+                                pipelineReport.update(*metrics);
+                            }
+                            if (memoryProfile)
+                            {
+                                memoryProfileOfQuery.update(
+                                    std::chrono::steady_clock::now(),
+                                    queryId,
+                                    queryManager.engineMetrics(),
+                                    queryManager.queryMemory(queryId),
+                                    metrics.value_or(std::vector<PipelineMetrics>{}));
+                            }
+                            std::this_thread::sleep_for(BENCHMARK_SAMPLING_INTERVAL);
+                        }
+                    });
+            }
+            summary = submitter.finishedQueries().at(0);
+        }
 
         if (summary.state == QueryState::Failed)
         {
@@ -394,26 +603,7 @@ std::vector<RunningQuery> runQueriesAndBenchmark(
         runningQueryPtr->queryStatus = summary;
 
         /// Getting the size and no. tuples of all input files to pass this information to currentRunningQuery.bytesProcessed
-        size_t bytesProcessed = 0;
-        size_t tuplesProcessed = 0;
-        for (const auto& [sourcePath, sourceOccurrencesInQuery] :
-             queryToRun.planInfoOrException.value().sourcesToFilePathsAndCounts | std::views::values)
-        {
-            if (not(std::filesystem::exists(sourcePath.getRawValue()) and sourcePath.getRawValue().has_filename()))
-            {
-                NES_ERROR("Source path is empty or does not exist.");
-                bytesProcessed = 0;
-                tuplesProcessed = 0;
-                break;
-            }
-
-            bytesProcessed += (std::filesystem::file_size(sourcePath.getRawValue()) * sourceOccurrencesInQuery);
-
-            /// Counting the lines, i.e., \n in the sourcePath
-            std::ifstream inFile(sourcePath.getRawValue());
-            tuplesProcessed
-                += std::count(std::istreambuf_iterator(inFile), std::istreambuf_iterator<char>(), '\n') * sourceOccurrencesInQuery;
-        }
+        const auto [bytesProcessed, tuplesProcessed] = countProcessedInput(readSourceInputs(queryToRun));
         ranQueries.back()->bytesProcessed = bytesProcessed;
         ranQueries.back()->tuplesProcessed = tuplesProcessed;
 
@@ -423,14 +613,580 @@ std::vector<RunningQuery> runQueriesAndBenchmark(
             = fmt::format(" in {} ({})", ranQueries.back()->getElapsedTime(), ranQueries.back()->getThroughput());
         printQueryResultToStdOut(
             *ranQueries.back(), errorMessage.value_or(""), queryFinishedCounter, totalQueries, queryPerformanceMessage);
+        if (not pipelineReport.empty())
+        {
+            std::cout << pipelineReport.render();
+        }
+        if (not memoryProfileOfQuery.empty())
+        {
+            std::cout << memoryProfileOfQuery.render();
+        }
 
         queryFinishedCounter += 1;
     }
 
-    return serializeExecutionResults(
+    auto failedQueries = serializeExecutionResults(
         ranQueries | std::views::transform([](const auto& query) { return *query; }) | std::ranges::to<std::vector>(), resultJson);
+    if (explainAnalyze || memoryProfile)
+    {
+        /// The results of the queries are the last entries of the result json, in the order in which the queries ran
+        const auto firstResult = resultJson.size() - pipelineReports.size();
+        for (size_t query = 0; query < pipelineReports.size(); ++query)
+        {
+            if (explainAnalyze)
+            {
+                resultJson[firstResult + query]["pipelines"] = pipelineReports[query].toJson();
+            }
+            if (memoryProfile)
+            {
+                resultJson[firstResult + query]["memory"] = memoryProfiles[query].toJson();
+            }
+        }
+    }
+    return failedQueries;
 }
 
+/// NOLINTBEGIN(readability-function-cognitive-complexity)
+std::vector<RunningQuery> runQueriesAndBenchmark(
+    const QueryLoaderAtRate& loadQueries,
+    const RateBenchmarkConfiguration& benchmarkConfiguration,
+    const SingleNodeWorkerConfiguration& configuration,
+    nlohmann::json& resultJson)
+{
+    PRECONDITION(
+        benchmarkConfiguration.startRate > 0 && benchmarkConfiguration.startRate <= benchmarkConfiguration.maxRate,
+        "The rate benchmark requires a start rate above zero and at most the max rate, but got {} and {}",
+        benchmarkConfiguration.startRate,
+        benchmarkConfiguration.maxRate);
+
+    const auto workerConfiguration = withPipelineStatistics(configuration);
+
+    std::vector<RateBenchmarkQuery> benchmarkedQueries;
+    std::vector<std::string> queryNames;
+    std::vector<SystestQueryId::Underlying> queryNumbers;
+    std::vector<RunningQuery> failedQueries;
+    for (auto rate = benchmarkConfiguration.startRate; rate <= benchmarkConfiguration.maxRate; rate *= 2)
+    {
+        const auto queries = loadQueries(rate);
+        if (benchmarkedQueries.empty())
+        {
+            benchmarkedQueries.resize(queries.size());
+            queryNames = queries | std::views::transform([](const auto& query) { return query.testName; }) | std::ranges::to<std::vector>();
+            queryNumbers = queries | std::views::transform([](const auto& query) { return query.queryIdInFile.getRawValue(); })
+                | std::ranges::to<std::vector>();
+        }
+        INVARIANT(
+            queries.size() == benchmarkedQueries.size(),
+            "Loaded {} queries, but benchmarked {}",
+            queries.size(),
+            benchmarkedQueries.size());
+
+        /// Every rate starts from a fresh worker, such that the peak memory does not include the state of previous runs
+        auto worker = std::make_unique<EmbeddedWorkerQueryManager>(workerConfiguration);
+        const auto& queryManager = *worker;
+        QuerySubmitter submitter(std::move(worker));
+        const auto totalQueries = static_cast<size_t>(std::ranges::count(benchmarkedQueries, false, &RateBenchmarkQuery::saturated));
+        size_t queryFinishedCounter = 0;
+        for (const auto& [queryToRun, benchmarkedQuery] : std::views::zip(queries, benchmarkedQueries))
+        {
+            if (benchmarkedQuery.saturated)
+            {
+                continue;
+            }
+            benchmarkedQuery.saturated = true;
+            if (not queryToRun.planInfoOrException.has_value())
+            {
+                NES_ERROR("skip failing query: {}", queryToRun.testName);
+                continue;
+            }
+            const auto registrationResult = submitter.registerQuery(queryToRun.planInfoOrException.value().queryPlan);
+            if (not registrationResult.has_value())
+            {
+                NES_ERROR("skip failing query: {}", queryToRun.testName);
+                continue;
+            }
+            const auto queryId = registrationResult.value();
+
+            RateBenchmarkSamples samples;
+            const auto cpuTimeAtStart = processCpuTime();
+            const auto start = std::chrono::steady_clock::now();
+            submitter.startQuery(queryId);
+            LocalQueryStatus summary;
+            {
+                const std::jthread sampler(
+                    [&samples, &queryManager, queryId](const std::stop_token& stopToken)
+                    {
+                        while (not stopToken.stop_requested())
+                        {
+                            if (auto metrics = queryManager.pipelineMetrics(queryId); metrics.has_value() && not metrics->empty())
+                            {
+                                samples.pipelineMetrics = std::move(*metrics);
+                            }
+                            samples.peakResidentBytes = std::max(samples.peakResidentBytes, residentBytes());
+                            std::this_thread::sleep_for(BENCHMARK_SAMPLING_INTERVAL);
+                        }
+                    });
+                summary = submitter.finishedQueries().at(0);
+            }
+            const std::chrono::duration<double> wallTime = std::chrono::steady_clock::now() - start;
+            const auto cpuTime = processCpuTime() - cpuTimeAtStart;
+
+            if (summary.state != QueryState::Stopped)
+            {
+                NES_ERROR(
+                    "Query {} terminated in state {} at {} tuples per second: {}",
+                    queryId,
+                    summary.state,
+                    rate,
+                    summary.metrics.error.has_value() ? summary.metrics.error->what() : "no error details");
+                failedQueries.emplace_back(queryToRun, queryId);
+                failedQueries.back().passed = false;
+                continue;
+            }
+
+            RunningQuery runningQuery{queryToRun, queryId};
+            runningQuery.queryStatus = summary;
+            const auto sourceInputs = readSourceInputs(queryToRun);
+            const auto [bytesProcessed, tuplesProcessed] = countProcessedInput(sourceInputs);
+            runningQuery.bytesProcessed = bytesProcessed;
+            runningQuery.tuplesProcessed = tuplesProcessed;
+            const auto errorMessage = checkResult(runningQuery);
+            runningQuery.passed = not errorMessage.has_value();
+
+            /// Every source replays its input at the rate, thus the source with the most tuples determines the duration of the query
+            size_t maxSourceTuples = 0;
+            for (const auto& input : sourceInputs.value_or(std::vector<SourceInput>{}))
+            {
+                maxSourceTuples = std::max(maxSourceTuples, input.tuples);
+            }
+            const auto elapsedTime = runningQuery.getElapsedTime().count();
+            const auto replayTime = static_cast<double>(maxSourceTuples) / rate;
+            const auto sinkLatencies = sinkIngestionLatencyHistogram(samples.pipelineMetrics);
+            const auto p99 = latencyPercentile(sinkLatencies, 0.99);
+            const bool sustainable = runningQuery.passed && elapsedTime > 0 && replayTime / elapsedTime >= SUSTAINED_RATE_SHARE
+                && p99.value_or(0) <= static_cast<uint64_t>(benchmarkConfiguration.latencyBound.count());
+            const auto throughput = static_cast<double>(tuplesProcessed) / elapsedTime;
+
+            benchmarkedQuery.rates.push_back({
+                {"tuplesPerSecondPerSource", rate},
+                {"offeredTuplesPerSecond", replayTime > 0 ? static_cast<double>(tuplesProcessed) / replayTime : NAN},
+                {"tuplesPerSecond", throughput},
+                {"time", elapsedTime},
+                {"latencyP50Ms", toJson(latencyPercentile(sinkLatencies, 0.5))},
+                {"latencyP99Ms", toJson(p99)},
+                {"latencyP999Ms", toJson(latencyPercentile(sinkLatencies, 0.999))},
+                {"cpuUtilization", wallTime.count() > 0 ? cpuTime.count() / wallTime.count() : NAN},
+                {"peakResidentBytes", samples.peakResidentBytes},
+                {"sustainable", sustainable},
+            });
+            if (sustainable)
+            {
+                benchmarkedQuery.sustainableThroughput = std::max(benchmarkedQuery.sustainableThroughput.value_or(0), throughput);
+                benchmarkedQuery.saturated = false;
+            }
+            else if (runningQuery.passed)
+            {
+                benchmarkedQuery.breakingRate = rate;
+            }
+            else
+            {
+                failedQueries.push_back(runningQuery);
+            }
+
+            const auto queryPerformanceMessage = fmt::format(
+                " at {} tuples/s per source in {} ({}, p99 {}ms){}",
+                rate,
+                runningQuery.getElapsedTime(),
+                runningQuery.getThroughput(),
+                p99.has_value() ? std::to_string(*p99) : "-",
+                sustainable ? "" : " saturated");
+            printQueryResultToStdOut(
+                runningQuery, errorMessage.value_or(""), queryFinishedCounter++, totalQueries, queryPerformanceMessage);
+        }
+
+        if (std::ranges::all_of(benchmarkedQueries, &RateBenchmarkQuery::saturated))
+        {
+            break;
+        }
+    }
+
+    for (const auto& [queryName, queryNumber, benchmarkedQuery] : std::views::zip(queryNames, queryNumbers, benchmarkedQueries))
+    {
+        resultJson.push_back({
+            {"query name", queryName},
+            {"query number", queryNumber},
+            {"rates", benchmarkedQuery.rates},
+            {"sustainableThroughput", toJson(benchmarkedQuery.sustainableThroughput)},
+            {"breakingRate", toJson(benchmarkedQuery.breakingRate)},
+        });
+    }
+    return failedQueries;
+}
+
+std::vector<RunningQuery> runQueriesAndBenchmarkScalability(
+    const QueryLoaderForCopy& loadQueries,
+    const uint64_t maxConcurrentQueries,
+    const SingleNodeWorkerConfiguration& configuration,
+    nlohmann::json& resultJson)
+{
+    PRECONDITION(maxConcurrentQueries > 0, "The scalability benchmark requires at least one concurrent query");
+    const auto workerConfiguration = withPipelineStatistics(configuration);
+
+    /// The copies of one query are bound by separate binders, thus their sinks write to separate result files, while all copies read the
+    /// same input files
+    std::vector<std::vector<SystestQuery>> copies;
+    copies.reserve(maxConcurrentQueries);
+    for (size_t copy = 0; copy < maxConcurrentQueries; ++copy)
+    {
+        copies.push_back(loadQueries(copy));
+        INVARIANT(
+            copies.back().size() == copies.front().size(),
+            "Copy {} loaded {} queries, but the first copy {}",
+            copy,
+            copies.back().size(),
+            copies.front().size());
+    }
+
+    std::vector<uint64_t> numbersOfConcurrentQueries;
+    for (uint64_t numberOfQueries = 1; numberOfQueries < maxConcurrentQueries; numberOfQueries *= 2)
+    {
+        numbersOfConcurrentQueries.push_back(numberOfQueries);
+    }
+    numbersOfConcurrentQueries.push_back(maxConcurrentQueries);
+
+    std::vector<RunningQuery> failedQueries;
+    size_t queryFinishedCounter = 0;
+    for (size_t queryIndex = 0; queryIndex < copies.front().size(); ++queryIndex)
+    {
+        const auto& queryToRun = copies.front().at(queryIndex);
+        if (not queryToRun.planInfoOrException.has_value())
+        {
+            NES_ERROR("skip failing query: {}", queryToRun.testName);
+            continue;
+        }
+
+        nlohmann::json scales = nlohmann::json::array();
+        for (const auto numberOfQueries : numbersOfConcurrentQueries)
+        {
+            /// Every step starts from a fresh worker, such that the peak memory does not include the state of previous steps
+            auto worker = std::make_unique<EmbeddedWorkerQueryManager>(workerConfiguration);
+            const auto& queryManager = *worker;
+            QuerySubmitter submitter(std::move(worker));
+
+            const auto registrationStart = std::chrono::steady_clock::now();
+            std::unordered_map<QueryId, RunningQuery> runningQueries;
+            for (size_t copy = 0; copy < numberOfQueries; ++copy)
+            {
+                const auto& copyToRun = copies.at(copy).at(queryIndex);
+                if (const auto registrationResult = submitter.registerQuery(copyToRun.planInfoOrException.value().queryPlan))
+                {
+                    runningQueries.emplace(*registrationResult, RunningQuery{copyToRun, *registrationResult});
+                }
+                else
+                {
+                    NES_ERROR("Could not register copy {} of query {}: {}", copy, copyToRun.testName, registrationResult.error().what());
+                }
+            }
+            const std::chrono::duration<double> registrationTime = std::chrono::steady_clock::now() - registrationStart;
+            if (runningQueries.empty())
+            {
+                break;
+            }
+
+            std::unordered_map<QueryId, std::vector<PipelineMetrics>> pipelineMetrics;
+            size_t peakResidentBytes = 0;
+            {
+                const auto queryIds = runningQueries | std::views::keys | std::ranges::to<std::vector>();
+                const std::jthread sampler(
+                    [&pipelineMetrics, &peakResidentBytes, &queryManager, queryIds](const std::stop_token& stopToken)
+                    {
+                        while (not stopToken.stop_requested())
+                        {
+                            for (const auto queryId : queryIds)
+                            {
+                                if (auto metrics = queryManager.pipelineMetrics(queryId); metrics.has_value() && not metrics->empty())
+                                {
+                                    pipelineMetrics.insert_or_assign(queryId, std::move(*metrics));
+                                }
+                            }
+                            peakResidentBytes = std::max(peakResidentBytes, residentBytes());
+                            std::this_thread::sleep_for(BENCHMARK_SAMPLING_INTERVAL);
+                        }
+                    });
+                for (const auto queryId : queryIds)
+                {
+                    submitter.startQuery(queryId);
+                }
+                size_t numberOfFinishedQueries = 0;
+                while (numberOfFinishedQueries < queryIds.size())
+                {
+                    for (const auto& summary : submitter.finishedQueries())
+                    {
+                        runningQueries.at(summary.queryId).queryStatus = summary;
+                        ++numberOfFinishedQueries;
+                    }
+                }
+            }
+
+            std::vector<double> queryThroughputs;
+            std::optional<uint64_t> maxLatencyP99;
+            std::chrono::duration<double> maxStartupTime{0};
+            std::optional<std::chrono::system_clock::time_point> firstRunning;
+            std::optional<std::chrono::system_clock::time_point> lastStop;
+            size_t totalTuples = 0;
+            size_t numberOfFailedQueries = 0;
+            for (auto& [queryId, runningQuery] : runningQueries)
+            {
+                if (runningQuery.queryStatus.state != QueryState::Stopped)
+                {
+                    NES_ERROR(
+                        "Query {} terminated in state {} with {} concurrent queries: {}",
+                        queryId,
+                        runningQuery.queryStatus.state,
+                        numberOfQueries,
+                        runningQuery.queryStatus.metrics.error.has_value() ? runningQuery.queryStatus.metrics.error->what()
+                                                                           : "no error details");
+                    runningQuery.passed = false;
+                    failedQueries.push_back(runningQuery);
+                    ++numberOfFailedQueries;
+                    continue;
+                }
+
+                const auto [bytesProcessed, tuplesProcessed] = countProcessedInput(readSourceInputs(runningQuery.systestQuery));
+                runningQuery.bytesProcessed = bytesProcessed;
+                runningQuery.tuplesProcessed = tuplesProcessed;
+                const auto errorMessage = checkResult(runningQuery);
+                runningQuery.passed = not errorMessage.has_value();
+                if (not runningQuery.passed)
+                {
+                    NES_ERROR("Query {} of {} failed: {}", queryId, runningQuery.systestQuery.testName, errorMessage.value_or(""));
+                    failedQueries.push_back(runningQuery);
+                    ++numberOfFailedQueries;
+                }
+
+                const auto& metrics = runningQuery.queryStatus.metrics;
+                totalTuples += tuplesProcessed;
+                queryThroughputs.push_back(static_cast<double>(tuplesProcessed) / runningQuery.getElapsedTime().count());
+                maxStartupTime = std::max<std::chrono::duration<double>>(maxStartupTime, metrics.running.value() - metrics.start.value());
+                firstRunning = std::min(firstRunning.value_or(metrics.running.value()), metrics.running.value());
+                lastStop = std::max(lastStop.value_or(metrics.stop.value()), metrics.stop.value());
+                if (const auto p99 = latencyPercentile(sinkIngestionLatencyHistogram(pipelineMetrics[queryId]), 0.99))
+                {
+                    maxLatencyP99 = std::max(maxLatencyP99.value_or(0), *p99);
+                }
+            }
+
+            const auto time = firstRunning.has_value() ? std::chrono::duration<double>(*lastStop - *firstRunning).count() : NAN;
+            const auto throughput = static_cast<double>(totalTuples) / time;
+            /// Jain's fairness index, which is one if all copies achieve the same throughput and 1/n if a single copy starves all others
+            const auto sumOfThroughputs = std::accumulate(queryThroughputs.begin(), queryThroughputs.end(), 0.0);
+            const auto sumOfSquaredThroughputs = std::inner_product(
+                queryThroughputs.begin(), queryThroughputs.end(), queryThroughputs.begin(), 0.0);
+            const auto fairness = sumOfSquaredThroughputs > 0
+                ? (sumOfThroughputs * sumOfThroughputs) / (static_cast<double>(queryThroughputs.size()) * sumOfSquaredThroughputs)
+                : NAN;
+
+            scales.push_back({
+                {"concurrentQueries", numberOfQueries},
+                {"tuplesPerSecond", throughput},
+                {"time", time},
+                {"queryTuplesPerSecond", queryThroughputs},
+                {"fairness", fairness},
+                {"latencyP99Ms", toJson(maxLatencyP99)},
+                {"registrationTime", registrationTime.count()},
+                {"startupTime", maxStartupTime.count()},
+                {"peakResidentBytes", peakResidentBytes},
+                {"failedQueries", numberOfFailedQueries},
+            });
+
+            RunningQuery reportedQuery{queryToRun};
+            reportedQuery.passed = numberOfFailedQueries == 0;
+            const auto queryPerformanceMessage = fmt::format(
+                " with {} concurrent queries: {:.0f} tuples/s, fairness {:.2f}, p99 {}ms, startup {}",
+                numberOfQueries,
+                throughput,
+                fairness,
+                maxLatencyP99.has_value() ? std::to_string(*maxLatencyP99) : "-",
+                maxStartupTime);
+            printQueryResultToStdOut(
+                reportedQuery,
+                fmt::format("{} of {} concurrent queries failed", numberOfFailedQueries, numberOfQueries),
+                queryFinishedCounter,
+                copies.front().size(),
+                queryPerformanceMessage);
+        }
+        ++queryFinishedCounter;
+
+        resultJson.push_back(
+            {{"query name", queryToRun.testName}, {"query number", queryToRun.queryIdInFile.getRawValue()}, {"scales", scales}});
+    }
+    return failedQueries;
+}
+
+/// NOLINTEND(readability-function-cognitive-complexity)
+
+namespace
+{
+/// The time to the first result is at most this interval late, thus the comparison samples the sinks more often than the benchmarks
+constexpr std::chrono::milliseconds EXECUTION_MODE_SAMPLING_INTERVAL{1};
+
+/// Tuples that the pipelines of the sinks, i.e., the pipelines without successors, received
+uint64_t numberOfSinkInputTuples(const std::vector<PipelineMetrics>& pipelines)
+{
+    uint64_t numberOfTuples = 0;
+    for (const auto& pipeline : pipelines)
+    {
+        if (pipeline.successors.empty())
+        {
+            numberOfTuples += pipeline.numberOfInputTuples;
+        }
+    }
+    return numberOfTuples;
+}
+}
+
+/// NOLINTBEGIN(readability-function-cognitive-complexity)
+std::vector<RunningQuery> runQueriesAndCompareExecutionModes(
+    const std::vector<SystestQuery>& queries, const SingleNodeWorkerConfiguration& configuration, nlohmann::json& resultJson)
+{
+    std::vector<RunningQuery> failedQueries;
+    std::vector<std::pair<std::string, ExecutionMode>> compilationDominatedQueries;
+    size_t queryFinishedCounter = 0;
+    for (const auto& queryToRun : queries)
+    {
+        if (not queryToRun.planInfoOrException.has_value())
+        {
+            NES_ERROR("skip failing query: {}", queryToRun.testName);
+            continue;
+        }
+
+        nlohmann::json modes = nlohmann::json::array();
+        for (const auto executionMode : magic_enum::enum_values<ExecutionMode>())
+        {
+            /// Every mode starts from a fresh worker, such that no mode profits from the warm caches or the buffers of a previous mode
+            auto workerConfiguration = withPipelineStatistics(configuration);
+            workerConfiguration.workerConfiguration.defaultQueryExecution.executionMode = executionMode;
+            auto worker = std::make_unique<EmbeddedWorkerQueryManager>(workerConfiguration);
+            const auto& queryManager = *worker;
+            QuerySubmitter submitter(std::move(worker));
+
+            const auto registrationResult = submitter.registerQuery(queryToRun.planInfoOrException.value().queryPlan);
+            if (not registrationResult.has_value())
+            {
+                NES_ERROR(
+                    "Could not register query {} in mode {}: {}",
+                    queryToRun.testName,
+                    magic_enum::enum_name(executionMode),
+                    registrationResult.error().what());
+                continue;
+            }
+            const auto queryId = registrationResult.value();
+            RunningQuery runningQuery{queryToRun, queryId};
+
+            std::optional<std::chrono::system_clock::time_point> firstResult;
+            {
+                const std::jthread sampler(
+                    [&firstResult, &queryManager, queryId](const std::stop_token& stopToken)
+                    {
+                        while (not stopToken.stop_requested() && not firstResult.has_value())
+                        {
+                            if (const auto metrics = queryManager.pipelineMetrics(queryId);
+                                metrics.has_value() && numberOfSinkInputTuples(*metrics) > 0)
+                            {
+                                firstResult = std::chrono::system_clock::now();
+                            }
+                            std::this_thread::sleep_for(EXECUTION_MODE_SAMPLING_INTERVAL);
+                        }
+                    });
+                submitter.startQuery(queryId);
+                runningQuery.queryStatus = submitter.finishedQueries().at(0);
+            }
+
+            if (runningQuery.queryStatus.state != QueryState::Stopped)
+            {
+                NES_ERROR(
+                    "Query {} terminated in state {} in mode {}: {}",
+                    queryId,
+                    runningQuery.queryStatus.state,
+                    magic_enum::enum_name(executionMode),
+                    runningQuery.queryStatus.metrics.error.has_value() ? runningQuery.queryStatus.metrics.error->what()
+                                                                       : "no error details");
+                runningQuery.passed = false;
+                failedQueries.push_back(runningQuery);
+                continue;
+            }
+
+            const auto [bytesProcessed, tuplesProcessed] = countProcessedInput(readSourceInputs(queryToRun));
+            runningQuery.bytesProcessed = bytesProcessed;
+            runningQuery.tuplesProcessed = tuplesProcessed;
+            const auto errorMessage = checkResult(runningQuery);
+            runningQuery.passed = not errorMessage.has_value();
+            if (not runningQuery.passed)
+            {
+                failedQueries.push_back(runningQuery);
+            }
+
+            /// The query starts to run once all its pipelines are set up, which compiles them, except for the interpreter and the
+            /// tiered execution, which compiles them in the background while the query runs
+            const auto& metrics = runningQuery.queryStatus.metrics;
+            const std::chrono::duration<double> compileTime = metrics.running.value() - metrics.start.value();
+            const std::chrono::duration<double> totalTime = metrics.stop.value() - metrics.start.value();
+            std::optional<double> timeToFirstResult;
+            if (firstResult.has_value())
+            {
+                timeToFirstResult = std::chrono::duration<double>(*firstResult - metrics.start.value()).count();
+            }
+            const auto steadyStateThroughput = static_cast<double>(tuplesProcessed) / runningQuery.getElapsedTime().count();
+            const bool compilationDominated = compileTime.count() > COMPILATION_DOMINATED_SHARE * totalTime.count();
+            if (compilationDominated)
+            {
+                compilationDominatedQueries.emplace_back(
+                    fmt::format("{}:{}", queryToRun.testName, queryToRun.queryIdInFile.getRawValue()), executionMode);
+            }
+
+            modes.push_back({
+                {"executionMode", magic_enum::enum_name(executionMode)},
+                {"compileTime", compileTime.count()},
+                {"timeToFirstResult", toJson(timeToFirstResult)},
+                {"time", totalTime.count()},
+                {"tuplesPerSecond", steadyStateThroughput},
+                {"compilationDominated", compilationDominated},
+                {"passed", runningQuery.passed},
+            });
+
+            const auto queryPerformanceMessage = fmt::format(
+                " in {}: compile {}, first result {}, total {}, {:.0f} tuples/s{}",
+                magic_enum::enum_name(executionMode),
+                compileTime,
+                timeToFirstResult.has_value() ? fmt::format("{:.3f}s", *timeToFirstResult) : "-",
+                totalTime,
+                steadyStateThroughput,
+                compilationDominated ? ", dominated by its compilation" : "");
+            printQueryResultToStdOut(
+                runningQuery, errorMessage.value_or(""), queryFinishedCounter, queries.size(), queryPerformanceMessage);
+        }
+        ++queryFinishedCounter;
+
+        resultJson.push_back(
+            {{"query name", queryToRun.testName}, {"query number", queryToRun.queryIdInFile.getRawValue()}, {"modes", modes}});
+    }
+
+    if (not compilationDominatedQueries.empty())
+    {
+        fmt::print(
+            fmt::emphasis::bold | fg(fmt::color::yellow),
+            "The compilation takes more than {:.0f}% of the runtime of these queries, which may profit from a tiered execution:\n",
+            COMPILATION_DOMINATED_SHARE * 100);
+        for (const auto& [query, executionMode] : compilationDominatedQueries)
+        {
+            std::cout << "- " << query << " in " << magic_enum::enum_name(executionMode) << '\n';
+        }
+    }
+    return failedQueries;
+}
+
+/// NOLINTEND(readability-function-cognitive-complexity)
+
 void printQueryResultToStdOut(
     const RunningQuery& runningQuery,
     const std::string& errorMessage,
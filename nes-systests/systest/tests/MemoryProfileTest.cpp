@@ -0,0 +1,136 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <MemoryProfile.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+#include <QueryEngine.hpp>
+
+namespace NES::Systest
+{
+
+class MemoryProfileTest : public Testing::BaseUnitTest
+{
+public:
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("MemoryProfileTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup MemoryProfileTest test class.");
+    }
+
+    /// A formatter, which emits into a window operator, which emits into the sink
+    static std::vector<PipelineMetrics> sampleQuery(const uint64_t numberOfBuffers)
+    {
+        const PipelineMetrics formatter{
+            .pipelineId = PipelineId(1),
+            .successors = {PipelineId(2)},
+            .bufferUsage = {.bytes = numberOfBuffers * 1024, .numberOfPooledBuffers = numberOfBuffers},
+            .peakBufferUsage = {.bytes = numberOfBuffers * 1024, .numberOfPooledBuffers = numberOfBuffers}};
+        const PipelineMetrics window{
+            .pipelineId = PipelineId(2),
+            .successors = {PipelineId(3)},
+            .stateSizeInBytes = numberOfBuffers * 100,
+            .peakStateSizeInBytes = numberOfBuffers * 100,
+            .bufferUsage = {.bytes = 4096, .numberOfUnpooledBuffers = 1},
+            .peakBufferUsage = {.bytes = 4096, .numberOfUnpooledBuffers = 1}};
+        const PipelineMetrics sink{.pipelineId = PipelineId(3)};
+        return {formatter, window, sink};
+    }
+
+    static EngineMetrics engineMetrics(const size_t numberOfAvailableBuffers)
+    {
+        EngineMetrics metrics{.sources = {{.queryId = queryId, .originId = OriginId(1), .numberOfInflightBuffers = 2},
+                                          {.queryId = QueryId(2), .originId = OriginId(1), .numberOfInflightBuffers = 8}}};
+        metrics.sources.front().peakNumberOfInflightBuffers = 3;
+        metrics.numberOfPooledBuffers = 100;
+        metrics.numberOfAvailableBuffers = numberOfAvailableBuffers;
+        return metrics;
+    }
+
+    static constexpr QueryId queryId{1};
+};
+
+TEST_F(MemoryProfileTest, AttributesTheBuffersToTheirOwners)
+{
+    MemoryProfile profile;
+    EXPECT_TRUE(profile.empty());
+    const auto start = std::chrono::steady_clock::now();
+    profile.update(start, queryId, engineMetrics(90), QueryMemoryMetrics{.usedBytes = 6000, .peakBytes = 6000}, sampleQuery(2));
+
+    EXPECT_EQ(profile.ownerOf(PipelineId(1)), MemoryProfile::Owner::FORMATTER);
+    EXPECT_EQ(profile.ownerOf(PipelineId(2)), MemoryProfile::Owner::OPERATOR);
+    EXPECT_EQ(profile.ownerOf(PipelineId(3)), MemoryProfile::Owner::SINK);
+
+    ASSERT_EQ(profile.getTimeline().size(), 1);
+    const auto& sample = profile.getTimeline().front();
+    EXPECT_EQ(sample.numberOfPooledBuffersInUse, 10);
+    EXPECT_EQ(sample.queryBytes, 6000);
+    EXPECT_EQ(sample.stateSizeInBytes, 200);
+    /// The sources of other queries are not part of the profile
+    EXPECT_EQ(sample.owners[static_cast<size_t>(MemoryProfile::Owner::SOURCE)].numberOfPooledBuffers, 2);
+    EXPECT_EQ(sample.owners[static_cast<size_t>(MemoryProfile::Owner::FORMATTER)].numberOfPooledBuffers, 2);
+    EXPECT_EQ(sample.owners[static_cast<size_t>(MemoryProfile::Owner::OPERATOR)].numberOfUnpooledBuffers, 1);
+}
+
+TEST_F(MemoryProfileTest, ReportsThePeaksOfTheTimeline)
+{
+    MemoryProfile profile;
+    const auto start = std::chrono::steady_clock::now();
+    profile.update(start, queryId, engineMetrics(60), std::nullopt, sampleQuery(40));
+    /// The formatter stopped before the second sample
+    profile.update(start + std::chrono::milliseconds(10), queryId, engineMetrics(95), std::nullopt, {sampleQuery(1).back()});
+
+    ASSERT_EQ(profile.getTimeline().size(), 2);
+    EXPECT_EQ(profile.getTimeline().back().time, std::chrono::milliseconds(10));
+    EXPECT_EQ(profile.getTimeline().back().owners[static_cast<size_t>(MemoryProfile::Owner::FORMATTER)].numberOfPooledBuffers, 0);
+
+    const auto rendered = profile.render();
+    EXPECT_NE(rendered.find("peak 40 of 100 pooled buffers in use"), std::string::npos) << rendered;
+    EXPECT_NE(rendered.find("Source 1: peak 3 inflight buffers"), std::string::npos) << rendered;
+    EXPECT_NE(rendered.find("formatter pipeline 1: peak 40 pooled and 0 unpooled buffers, 40.0 KiB"), std::string::npos) << rendered;
+    EXPECT_NE(rendered.find("operator pipeline 2: peak 0 pooled and 1 unpooled buffers, 4.0 KiB, state 3.9 KiB"), std::string::npos)
+        << rendered;
+
+    const auto json = profile.toJson();
+    EXPECT_EQ(json["peak"]["pooledBuffersInUse"], 40);
+    EXPECT_EQ(json["peak"]["pipelines"].size(), 3);
+    EXPECT_EQ(json["timeline"][0]["owners"]["formatter"]["pooledBuffers"], 40);
+}
+
+TEST_F(MemoryProfileTest, BoundsTheNumberOfSamples)
+{
+    MemoryProfile profile;
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t update = 0; update < 3 * MemoryProfile::MAX_NUMBER_OF_SAMPLES; ++update)
+    {
+        profile.update(start + std::chrono::milliseconds(update), queryId, engineMetrics(100), std::nullopt, {});
+    }
+    const auto& timeline = profile.getTimeline();
+    EXPECT_LE(timeline.size(), MemoryProfile::MAX_NUMBER_OF_SAMPLES);
+    EXPECT_GE(timeline.size(), MemoryProfile::MAX_NUMBER_OF_SAMPLES / 2);
+    EXPECT_EQ(timeline.front().time, std::chrono::milliseconds(0));
+    /// The remaining samples are evenly spaced
+    EXPECT_EQ(timeline[2].time - timeline[1].time, timeline[1].time - timeline[0].time);
+}
+
+}
@@ -0,0 +1,139 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <PipelineReport.hpp>
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <Util/PlanRenderer.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+#include <QueryEngine.hpp>
+
+namespace NES::Systest
+{
+
+class PipelineReportTest : public Testing::BaseUnitTest
+{
+public:
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("PipelineReportTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup PipelineReportTest test class.");
+    }
+
+    /// Two pipelines that emit into the pipeline of the sink
+    static std::vector<PipelineMetrics> sampleQuery()
+    {
+        PipelineMetrics selection{
+            .pipelineId = PipelineId(1),
+            .numberOfTasks = 10,
+            .numberOfInputTuples = 1000,
+            .numberOfEmittedTuples = 500,
+            .numberOfEmittedBuffers = 10,
+            .executionTime = std::chrono::microseconds(1500),
+            .successors = {PipelineId(3)}};
+        selection.operatorCosts
+            = {{.operatorId = OperatorId(5), .name = "Scan", .numberOfInvocations = 10, .inclusiveCycles = 400, .exclusiveCycles = 100},
+               {.operatorId = OperatorId(6),
+                .name = "Selection",
+                .numberOfInvocations = 1000,
+                .inclusiveCycles = 300,
+                .exclusiveCycles = 300}};
+        const PipelineMetrics build{
+            .pipelineId = PipelineId(2), .numberOfTasks = 5, .successors = {PipelineId(3)}, .peakStateSizeInBytes = 1536};
+        const PipelineMetrics sink{.pipelineId = PipelineId(3), .numberOfTasks = 15};
+        return {selection, build, sink};
+    }
+};
+
+TEST_F(PipelineReportTest, KeepsTheMetricsOfStoppedPipelines)
+{
+    PipelineReport report;
+    EXPECT_TRUE(report.empty());
+    report.update(sampleQuery());
+
+    /// The first pipeline stopped before the second sample, which updates the sink
+    auto sink = sampleQuery().back();
+    sink.numberOfTasks = 20;
+    report.update({sink});
+
+    const auto roots = report.getRootOperators();
+    ASSERT_EQ(roots.size(), 1);
+    EXPECT_EQ(roots.front().getId(), PipelineId(3));
+    EXPECT_EQ(
+        roots.front().explain(ExplainVerbosity::Short), "Pipeline 3: 20 tasks, 0 tuples -> 0 tuples in 0 buffers, 0.000 ms, state 0 B");
+    const auto children = roots.front().getChildren();
+    ASSERT_EQ(children.size(), 2);
+    EXPECT_EQ(children[0].getId(), PipelineId(1));
+    EXPECT_EQ(children[1].getId(), PipelineId(2));
+    EXPECT_TRUE(children[0].getChildren().empty());
+}
+
+TEST_F(PipelineReportTest, AnnotatesThePipelinesWithTheirCosts)
+{
+    PipelineReport report;
+    report.update(sampleQuery());
+    const auto children = report.getRootOperators().front().getChildren();
+    EXPECT_EQ(
+        children[0].explain(ExplainVerbosity::Short),
+        "Pipeline 1: 10 tasks, 1000 tuples -> 500 tuples in 10 buffers, 1.500 ms, state 0 B | Scan 25.0%, Selection 75.0%");
+    EXPECT_EQ(
+        children[0].explain(ExplainVerbosity::Debug),
+        "Pipeline 1: 10 tasks, 1000 tuples -> 500 tuples in 10 buffers, 1.500 ms, state 0 B | Scan 25.0% (100 cycles in 10 invocations), "
+        "Selection 75.0% (300 cycles in 1000 invocations)");
+    EXPECT_EQ(
+        children[1].explain(ExplainVerbosity::Short), "Pipeline 2: 5 tasks, 0 tuples -> 0 tuples in 0 buffers, 0.000 ms, state 1.5 KiB");
+
+    const auto rendered = report.render();
+    EXPECT_NE(rendered.find("Pipeline 1"), std::string::npos);
+    EXPECT_NE(rendered.find("Pipeline 3"), std::string::npos);
+
+    const auto json = report.toJson();
+    ASSERT_EQ(json.size(), 3);
+    EXPECT_EQ(json[0]["emittedBuffers"], 10);
+    EXPECT_EQ(json[0]["successors"], nlohmann::json::array({3}));
+    EXPECT_EQ(json[0]["operators"][1]["name"], "Selection");
+    EXPECT_EQ(json[1]["peakStateBytes"], 1536);
+}
+
+TEST_F(PipelineReportTest, AnnotatesTheLargestStateOfAWorkerThread)
+{
+    PipelineReport report;
+    report.update(
+        {{.pipelineId = PipelineId(1),
+          .peakStateSizeInBytes = 4096,
+          .stateSizeInBytesPerWorkerThread = {3072, 1024},
+          .isRebalancing = true}});
+    EXPECT_EQ(
+        report.getRootOperators().front().explain(ExplainVerbosity::Short),
+        "Pipeline 1: 0 tasks, 0 tuples -> 0 tuples in 0 buffers, 0.000 ms, state 4.0 KiB (largest worker thread 3.0 KiB, rebalancing)");
+    const auto json = report.toJson();
+    EXPECT_EQ(json[0]["stateBytesPerWorkerThread"], nlohmann::json::array({3072, 1024}));
+    EXPECT_TRUE(json[0]["rebalancing"]);
+}
+
+TEST_F(PipelineReportTest, FormatsBytesInBinaryUnits)
+{
+    EXPECT_EQ(PipelineReport::formatBytes(1023), "1023 B");
+    EXPECT_EQ(PipelineReport::formatBytes(1536), "1.5 KiB");
+    EXPECT_EQ(PipelineReport::formatBytes(3ULL << 30), "3.0 GiB");
+}
+
+}
@@ -109,6 +109,11 @@ public:
     MOCK_METHOD((std::expected<void, Exception>), start, (QueryId), (noexcept, override));
     MOCK_METHOD((std::expected<void, Exception>), stop, (QueryId), (noexcept, override));
     MOCK_METHOD((std::expected<void, Exception>), unregister, (QueryId), (noexcept, override));
+    MOCK_METHOD(
+        (std::expected<void, Exception>),
+        updateParameters,
+        (QueryId, (const std::unordered_map<std::string, std::string>&)),
+        (noexcept, override));
     MOCK_METHOD((std::expected<LocalQueryStatus, Exception>), status, (QueryId), (const, noexcept, override));
 };
 
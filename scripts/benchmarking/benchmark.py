@@ -59,13 +59,17 @@ class SystestAdapter(BenchmarkAdapter):
         benchmarkResults = []
 
         for result in raw_results:
+            # A test file contains multiple queries, thus the query number distinguishes their results
+            name = result["query name"]
+            if "query number" in result:
+                name += ":" + str(result["query number"])
             benchmarkResults.append(BenchmarkResult(
                 stats={
                     "data": [result["time"]],
                     "unit": "ns"
                 },
                 context={"benchmark_language": "systest"},
-                tags={"name": result["query name"]},
+                tags={"name": name},
             ))
             benchmarkResults.append(BenchmarkResult(
                 stats={
@@ -73,7 +77,15 @@ class SystestAdapter(BenchmarkAdapter):
                     "unit": "B/s"
                 },
                 context={"benchmark_language": "systest"},
-                tags={"name": result["query name"] + "_Bps"},
+                tags={"name": name + "_Bps"},
+            ))
+            benchmarkResults.append(BenchmarkResult(
+                stats={
+                    "data": [result["tuplesPerSecond"]],
+                    "unit": "tuples/s"
+                },
+                context={"benchmark_language": "systest"},
+                tags={"name": name + "_Tps"},
             ))
 
         return benchmarkResults
@@ -0,0 +1,280 @@
+#!/usr/bin/env python3
+
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+
+#    https://www.apache.org/licenses/LICENSE-2.0
+
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+Tracks performance regressions independently of any CI system.
+
+`run` executes the microbenchmarks (the run_benchmarks target) and the systests in benchmark mode repeatedly, and stores all samples
+together with the environment, i.e., the cpu, the commit and the build configuration, in a results file below the results directory.
+`compare` compares a results file against a baseline results file. A benchmark regresses if a two-sided Mann-Whitney U test over the
+repetitions rejects that both runs stem from the same distribution, and if the median changed by more than the threshold for the worse.
+The exit code is 1 if any benchmark regressed, thus a CI job or a git bisect can use the script without parsing its output.
+"""
+import argparse
+import datetime
+import itertools
+import json
+import math
+import os
+import platform
+import shutil
+import statistics
+import subprocess
+import sys
+import tempfile
+from pathlib import Path
+from typing import Dict, List, Optional, Tuple
+
+CMAKE_CACHE_ENTRIES = ["CMAKE_BUILD_TYPE", "CMAKE_CXX_COMPILER", "CMAKE_CXX_FLAGS", "USE_LIBCXX_IF_AVAILABLE", "NES_ENABLE_BENCHMARKS"]
+# Below this number of samples per run, the exact distribution of the U statistic is computed instead of its normal approximation
+EXACT_MANN_WHITNEY_LIMIT = 20
+
+
+def git_output(*args: str) -> str:
+    try:
+        return subprocess.run(["git", *args], check=True, capture_output=True, text=True).stdout.strip()
+    except (OSError, subprocess.CalledProcessError):
+        return "unknown"
+
+
+def cpu_model() -> str:
+    try:
+        with open("/proc/cpuinfo", "r") as cpuinfo:
+            for line in cpuinfo:
+                if line.startswith("model name"):
+                    return line.split(":", 1)[1].strip()
+    except OSError:
+        pass
+    return platform.processor() or "unknown"
+
+
+def cmake_cache(build_dir: Path) -> Dict[str, str]:
+    entries = {}
+    cache = build_dir / "CMakeCache.txt"
+    if not cache.exists():
+        return entries
+    with open(cache, "r") as f:
+        for line in f:
+            if line.startswith(("#", "//")) or "=" not in line:
+                continue
+            key_and_type, value = line.rstrip("\n").split("=", 1)
+            key = key_and_type.split(":", 1)[0]
+            if key in CMAKE_CACHE_ENTRIES:
+                entries[key] = value
+    return entries
+
+
+def environment(build_dir: Path, worker_args: List[str]) -> dict:
+    return {
+        "timestamp": datetime.datetime.now(datetime.timezone.utc).isoformat(),
+        "commit": git_output("rev-parse", "HEAD"),
+        "dirty": git_output("status", "--porcelain", "--untracked-files=no") != "",
+        "host": platform.node(),
+        "cpu": cpu_model(),
+        "cpus": os.cpu_count(),
+        "kernel": platform.release(),
+        "build": cmake_cache(build_dir),
+        "worker_args": worker_args,
+    }
+
+
+def add_sample(benchmarks: dict, name: str, value: float, unit: str, higher_is_better: bool) -> None:
+    if value is None or (isinstance(value, float) and math.isnan(value)):
+        return
+    benchmark = benchmarks.setdefault(name, {"unit": unit, "higher_is_better": higher_is_better, "samples": []})
+    benchmark["samples"].append(value)
+
+
+def run_microbenchmarks(build_dir: Path, repetitions: int, output_dir: Path, benchmarks: dict) -> None:
+    # The run_benchmarks target passes NES_BENCHMARK_ARGS to every benchmark and writes the results to NES_BENCHMARK_RESULTS_DIR
+    output_dir.mkdir(parents=True, exist_ok=True)
+    subprocess.run(
+        ["cmake", "-B", str(build_dir), "-DNES_ENABLE_BENCHMARKS=ON",
+         f"-DNES_BENCHMARK_RESULTS_DIR={output_dir}", f"-DNES_BENCHMARK_ARGS=--benchmark_repetitions={repetitions}"],
+        check=True)
+    subprocess.run(["cmake", "--build", str(build_dir), "--target", "run_benchmarks"], check=True)
+    for result_file in sorted(output_dir.glob("*.json")):
+        with open(result_file, "r") as f:
+            results = json.load(f)
+        for result in results.get("benchmarks", []):
+            # The aggregates, e.g., the mean of the repetitions, are computed from the samples of the repetitions again
+            if result.get("run_type") == "aggregate" or result.get("error_occurred", False):
+                continue
+            name = f"{result_file.stem}/{result['run_name'] if 'run_name' in result else result['name']}"
+            add_sample(benchmarks, name, result["real_time"], result.get("time_unit", "ns"), False)
+
+
+def run_systests(build_dir: Path, repetitions: int, systest_args: List[str], worker_args: List[str], benchmarks: dict) -> None:
+    systest = build_dir / "nes-systests" / "systest" / "systest"
+    for repetition in range(repetitions):
+        with tempfile.TemporaryDirectory(prefix="systest-benchmark-") as working_dir:
+            command = [str(systest), "-b", f"--workingDir={working_dir}", *systest_args]
+            if worker_args:
+                command += ["--", *worker_args]
+            print(f"Systest benchmark repetition {repetition + 1}/{repetitions}: {' '.join(command)}", flush=True)
+            # Failing queries are reported by the systest, while the results of the passing queries remain comparable
+            subprocess.run(command, check=False)
+            result_file = Path(working_dir) / "BenchmarkResults.json"
+            if not result_file.exists():
+                raise RuntimeError(f"The systest did not write {result_file}")
+            with open(result_file, "r") as f:
+                results = json.load(f)
+        for result in results:
+            name = f"systest/{result['query name']}:{result.get('query number', 0)}"
+            add_sample(benchmarks, name + "/time", result["time"], "s", False)
+            add_sample(benchmarks, name + "/tuplesPerSecond", result["tuplesPerSecond"], "tuples/s", True)
+
+
+def mann_whitney_u(first: List[float], second: List[float]) -> Tuple[float, float]:
+    """Returns the U statistic of the first sample and the two-sided p-value"""
+    n1, n2 = len(first), len(second)
+    values = sorted(itertools.chain(((value, 0) for value in first), ((value, 1) for value in second)))
+    ranks = [0.0] * len(values)
+    tie_correction = 0.0
+    index = 0
+    while index < len(values):
+        end = index
+        while end + 1 < len(values) and values[end + 1][0] == values[index][0]:
+            end += 1
+        for tied in range(index, end + 1):
+            ranks[tied] = (index + end) / 2 + 1
+        ties = end - index + 1
+        tie_correction += ties ** 3 - ties
+        index = end + 1
+    rank_sum = sum(rank for rank, (_, source) in zip(ranks, values) if source == 0)
+    u1 = rank_sum - n1 * (n1 + 1) / 2
+    u = min(u1, n1 * n2 - u1)
+
+    if tie_correction == 0 and n1 <= EXACT_MANN_WHITNEY_LIMIT and n2 <= EXACT_MANN_WHITNEY_LIMIT:
+        # counts[k] is the number of arrangements of n1 and n2 samples whose U statistic is k
+        counts = [[[0] * (i * j + 1) for j in range(n2 + 1)] for i in range(n1 + 1)]
+        for i in range(n1 + 1):
+            for j in range(n2 + 1):
+                if i == 0 or j == 0:
+                    counts[i][j][0] = 1
+                    continue
+                for k in range(i * j + 1):
+                    # The largest value belongs either to the first sample, which then exceeds all j values of the second sample, or not
+                    counts[i][j][k] = (counts[i - 1][j][k - j] if k >= j else 0) + (counts[i][j - 1][k] if k <= i * (j - 1) else 0)
+        total = math.comb(n1 + n2, n1)
+        p_value = 2 * sum(counts[n1][n2][k] for k in range(int(u) + 1)) / total
+        return u1, min(1.0, p_value)
+
+    n = n1 + n2
+    variance = n1 * n2 / 12 * ((n + 1) - tie_correction / (n * (n - 1)))
+    if variance <= 0:
+        return u1, 1.0
+    # The continuity correction accounts for the discrete U statistic
+    z = (abs(u1 - n1 * n2 / 2) - 0.5) / math.sqrt(variance)
+    return u1, min(1.0, math.erfc(max(z, 0) / math.sqrt(2)))
+
+
+def compare(baseline: dict, current: dict, alpha: float, threshold: float) -> List[str]:
+    regressions = []
+    rows = []
+    for name in sorted(set(baseline["benchmarks"]) & set(current["benchmarks"])):
+        base = baseline["benchmarks"][name]
+        cur = current["benchmarks"][name]
+        base_median = statistics.median(base["samples"])
+        cur_median = statistics.median(cur["samples"])
+        change = (cur_median - base_median) / base_median if base_median != 0 else 0.0
+        worse = -change if cur["higher_is_better"] else change
+        p_value: Optional[float] = None
+        if len(base["samples"]) >= 2 and len(cur["samples"]) >= 2:
+            _, p_value = mann_whitney_u(base["samples"], cur["samples"])
+        verdict = ""
+        if p_value is not None and p_value < alpha and worse > threshold:
+            verdict = "REGRESSION"
+            regressions.append(name)
+        elif p_value is not None and p_value < alpha and worse < -threshold:
+            verdict = "improvement"
+        elif p_value is None:
+            verdict = "too few samples"
+        rows.append((name, f"{base_median:.6g}", f"{cur_median:.6g}", cur["unit"], f"{change:+.1%}",
+                     "-" if p_value is None else f"{p_value:.3f}", verdict))
+
+    widths = [max(len(str(row[column])) for row in rows + [("benchmark", "baseline", "current", "unit", "change", "p", "")])
+              for column in range(7)]
+    header = ("benchmark", "baseline", "current", "unit", "change", "p", "")
+    for row in [header] + rows:
+        print("  ".join(str(value).ljust(width) for value, width in zip(row, widths)).rstrip())
+    for name in sorted(set(baseline["benchmarks"]) ^ set(current["benchmarks"])):
+        print(f"{name} is solely part of the {'baseline' if name in baseline['benchmarks'] else 'current'} results")
+    for key in ("cpu", "build", "worker_args"):
+        if baseline["environment"].get(key) != current["environment"].get(key):
+            print(f"Warning: the {key} differs between the baseline and the current results")
+    return regressions
+
+
+def load(path: Path) -> dict:
+    with open(path, "r") as f:
+        return json.load(f)
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    commands = parser.add_subparsers(dest="command", required=True)
+
+    run_parser = commands.add_parser("run", help="run the benchmarks and store their results")
+    run_parser.add_argument("--build-dir", type=Path, default=Path("build"), help="configured build directory. Default: build")
+    run_parser.add_argument("--results-dir", type=Path, default=Path("benchmark-results"),
+                            help="directory of the results files. Default: benchmark-results")
+    run_parser.add_argument("--repetitions", type=int, default=5, help="repetitions of every benchmark. Default: 5")
+    run_parser.add_argument("--no-microbenchmarks", action="store_true", help="skip the microbenchmarks")
+    run_parser.add_argument("--no-systests", action="store_true", help="skip the systests in benchmark mode")
+    run_parser.add_argument("--systest-args", nargs=argparse.REMAINDER, default=["--groups", "benchmark"],
+                            help="arguments of the systest. Default: --groups benchmark")
+    run_parser.add_argument("--worker-arg", action="append", default=[], dest="worker_args",
+                            help="argument of the worker config, e.g., --worker-arg=--worker.query_engine.number_of_worker_threads=4")
+    run_parser.add_argument("--baseline", type=Path, help="compare the results against this results file")
+    run_parser.add_argument("--alpha", type=float, default=0.05, help="significance level of the Mann-Whitney U test. Default: 0.05")
+    run_parser.add_argument("--threshold", type=float, default=0.05,
+                            help="relative change of the median that counts as a regression. Default: 0.05")
+
+    compare_parser = commands.add_parser("compare", help="compare a results file against a baseline results file")
+    compare_parser.add_argument("baseline", type=Path)
+    compare_parser.add_argument("current", type=Path)
+    compare_parser.add_argument("--alpha", type=float, default=0.05, help="significance level of the Mann-Whitney U test. Default: 0.05")
+    compare_parser.add_argument("--threshold", type=float, default=0.05,
+                                help="relative change of the median that counts as a regression. Default: 0.05")
+
+    args = parser.parse_args()
+    if args.command == "run":
+        results = {"environment": environment(args.build_dir, args.worker_args), "benchmarks": {}}
+        run_dir = args.results_dir / f"{results['environment']['timestamp'].replace(':', '-')}-{results['environment']['commit'][:12]}"
+        run_dir.mkdir(parents=True, exist_ok=True)
+        if not args.no_microbenchmarks:
+            run_microbenchmarks(args.build_dir.resolve(), args.repetitions, (run_dir / "microbenchmarks").resolve(), results["benchmarks"])
+        if not args.no_systests:
+            run_systests(args.build_dir, args.repetitions, args.systest_args, args.worker_args, results["benchmarks"])
+        result_file = run_dir / "results.json"
+        with open(result_file, "w") as f:
+            json.dump(results, f, indent=4)
+        shutil.copyfile(result_file, args.results_dir / "latest.json")
+        print(f"Stored the results of {len(results['benchmarks'])} benchmarks in {result_file}")
+        if args.baseline is None:
+            return 0
+        baseline, current = load(args.baseline), results
+    else:
+        baseline, current = load(args.baseline), load(args.current)
+
+    regressions = compare(baseline, current, args.alpha, args.threshold)
+    if regressions:
+        print(f"{len(regressions)} benchmarks regressed: {', '.join(regressions)}")
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())